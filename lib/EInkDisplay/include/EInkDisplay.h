@@ -38,20 +38,42 @@ class EInkDisplay {
   void copyGrayscaleBuffers(const uint8_t* lsbBuffer, const uint8_t* msbBuffer);
   void copyGrayscaleLsbBuffers(const uint8_t* lsbBuffer);
   void copyGrayscaleMsbBuffers(const uint8_t* msbBuffer);
+  // Write a band of full-width rows to both grayscale planes (LSB -> BW RAM, MSB -> RED RAM)
+  void writeGrayscaleBand(uint16_t y, uint16_t h, const uint8_t* lsbBand, const uint8_t* msbBand);
 #ifdef EINK_DISPLAY_SINGLE_BUFFER_MODE
   void cleanupGrayscaleBuffers(const uint8_t* bwBuffer);
 #endif
 
   void displayBuffer(RefreshMode mode = FAST_REFRESH, bool turnOffScreen = false);
+  // Load the frame buffer into both RAMs without refreshing, for when the panel already shows it
+  // (e.g. a frame restored after deep sleep). The next fast refresh then diffs against it.
+  void writeBaseline();
+  // Switch on the clock and analog circuits and load the temperature without running a refresh, as the first
+  // full refresh after a controller reset would. With writeBaseline this lets the first displayBuffer after
+  // power-on be a real FAST_REFRESH: displayBuffer only forces a HALF_REFRESH while the screen is off.
+  void powerOn();
   // EXPERIMENTAL: Windowed update - display only a rectangular region
   void displayWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool turnOffScreen = false);
   void displayGrayBuffer(bool turnOffScreen = false);
+  // The panel already shows the grayscale planes just written to RAM (e.g. the sleep screen after deep sleep):
+  // as after displayGrayBuffer, the next BW refresh reverts them first
+  void markGrayscaleShown() { inGrayscaleMode = true; }
 
   void refreshDisplay(RefreshMode mode = FAST_REFRESH, bool turnOffScreen = false);
 
   // debug function
   void grayscaleRevert();
 
+  // Invert frame data on its way to the panel (dark mode). Grayscale planes are never inverted.
+  void setInvertOutput(bool enabled) { invertOutput = enabled; }
+  bool isOutputInverted() const { return invertOutput; }
+
+  // Held around each frame upload, for a bus shared with other devices (the SD card). Optional.
+  void setBusLock(void (*acquire)(), void (*release)()) {
+    busAcquire = acquire;
+    busRelease = release;
+  }
+
   // LUT control
   void setCustomLUT(bool enabled, const unsigned char* lutData = nullptr);
 
@@ -86,16 +108,20 @@ class EInkDisplay {
   bool customLutActive;
   bool inGrayscaleMode;
   bool drawGrayscale;
+  bool invertOutput;
+  void (*busAcquire)() = nullptr;
+  void (*busRelease)() = nullptr;
 
   // Low-level display control
   void resetDisplay();
   void sendCommand(uint8_t command);
   void sendData(uint8_t data);
   void sendData(const uint8_t* data, uint16_t length);
+  void sendDataInverted(const uint8_t* data, uint32_t length);
   void waitWhileBusy(const char* comment = nullptr);
   void initDisplayController();
 
   // Low-level display operations
   void setRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
-  void writeRamBuffer(uint8_t ramBuffer, const uint8_t* data, uint32_t size);
+  void writeRamBuffer(uint8_t ramBuffer, const uint8_t* data, uint32_t size, bool isFrameData = true);
 };
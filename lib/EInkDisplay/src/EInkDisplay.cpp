@@ -1,5 +1,6 @@
 #include "EInkDisplay.h"
 
+#include <algorithm>
 #include <cstring>
 #include <fstream>
 #include <vector>
@@ -121,7 +122,8 @@ EInkDisplay::EInkDisplay(int8_t sclk, int8_t mosi, int8_t cs, int8_t dc, int8_t
       isScreenOn(false),
       customLutActive(false),
       inGrayscaleMode(false),
-      drawGrayscale(false) {
+      drawGrayscale(false),
+      invertOutput(false) {
   if (Serial) Serial.printf("[%lu] EInkDisplay: Constructor called\n", millis());
   if (Serial) Serial.printf("[%lu]   SCLK=%d, MOSI=%d, CS=%d, DC=%d, RST=%d, BUSY=%d\n", millis(), sclk, mosi, cs, dc, rst, busy);
 }
@@ -212,6 +214,29 @@ void EInkDisplay::sendData(const uint8_t* data, uint16_t length) {
   SPI.endTransaction();
 }
 
+// Sends frame data with every bit flipped. The data is inverted a word at a time in a small staging
+// buffer as it is clocked out, so the frame buffer itself is never touched.
+void EInkDisplay::sendDataInverted(const uint8_t* data, uint32_t length) {
+  constexpr size_t STAGING_WORDS = 128;
+  uint32_t staging[STAGING_WORDS];
+
+  SPI.beginTransaction(spiSettings);
+  digitalWrite(_dc, HIGH);  // Data mode
+  digitalWrite(_cs, LOW);   // Select chip
+  while (length > 0) {
+    const size_t chunk = std::min<size_t>(length, sizeof(staging));
+    memcpy(staging, data, chunk);
+    for (size_t i = 0; i < (chunk + 3) / 4; i++) {
+      staging[i] = ~staging[i];
+    }
+    SPI.writeBytes(reinterpret_cast<const uint8_t*>(staging), chunk);
+    data += chunk;
+    length -= chunk;
+  }
+  digitalWrite(_cs, HIGH);  // Deselect chip
+  SPI.endTransaction();
+}
+
 void EInkDisplay::waitWhileBusy(const char* comment) {
   unsigned long start = millis();
   while (digitalRead(_busy) == HIGH) {
@@ -347,13 +372,19 @@ void EInkDisplay::drawImage(const uint8_t* imageData, const uint16_t x, const ui
   if (Serial) Serial.printf("[%lu]   Image drawn to frame buffer\n", millis());
 }
 
-void EInkDisplay::writeRamBuffer(uint8_t ramBuffer, const uint8_t* data, uint32_t size) {
+void EInkDisplay::writeRamBuffer(uint8_t ramBuffer, const uint8_t* data, uint32_t size, const bool isFrameData) {
   const char* bufferName = (ramBuffer == CMD_WRITE_RAM_BW) ? "BW" : "RED";
   const unsigned long startTime = millis();
   if (Serial) Serial.printf("[%lu]   Writing frame buffer to %s RAM (%lu bytes)...\n", startTime, bufferName, size);
 
+  if (busAcquire) busAcquire();
   sendCommand(ramBuffer);
-  sendData(data, size);
+  if (invertOutput && isFrameData) {
+    sendDataInverted(data, size);
+  } else {
+    sendData(data, size);
+  }
+  if (busRelease) busRelease();
 
   const unsigned long duration = millis() - startTime;
   if (Serial) Serial.printf("[%lu]   %s RAM write complete (%lu ms)\n", millis(), bufferName, duration);
@@ -386,18 +417,44 @@ void EInkDisplay::grayscaleRevert() {
 
 void EInkDisplay::copyGrayscaleLsbBuffers(const uint8_t* lsbBuffer) {
   setRamArea(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
-  writeRamBuffer(CMD_WRITE_RAM_BW, lsbBuffer, BUFFER_SIZE);
+  writeRamBuffer(CMD_WRITE_RAM_BW, lsbBuffer, BUFFER_SIZE, false);
 }
 
 void EInkDisplay::copyGrayscaleMsbBuffers(const uint8_t* msbBuffer) {
   setRamArea(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
-  writeRamBuffer(CMD_WRITE_RAM_RED, msbBuffer, BUFFER_SIZE);
+  writeRamBuffer(CMD_WRITE_RAM_RED, msbBuffer, BUFFER_SIZE, false);
 }
 
 void EInkDisplay::copyGrayscaleBuffers(const uint8_t* lsbBuffer, const uint8_t* msbBuffer) {
   setRamArea(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
-  writeRamBuffer(CMD_WRITE_RAM_BW, lsbBuffer, BUFFER_SIZE);
-  writeRamBuffer(CMD_WRITE_RAM_RED, msbBuffer, BUFFER_SIZE);
+  writeRamBuffer(CMD_WRITE_RAM_BW, lsbBuffer, BUFFER_SIZE, false);
+  writeRamBuffer(CMD_WRITE_RAM_RED, msbBuffer, BUFFER_SIZE, false);
+}
+
+/**
+ * Streams a band of `h` full-width rows starting at panel row `y` into both grayscale planes.
+ * Lets callers compose the planes a few rows at a time instead of holding two full-screen buffers.
+ * Follow the last band with `displayGrayBuffer`.
+ */
+void EInkDisplay::writeGrayscaleBand(const uint16_t y, const uint16_t h, const uint8_t* lsbBand,
+                                     const uint8_t* msbBand) {
+  if (y + h > DISPLAY_HEIGHT) {
+    if (Serial) Serial.printf("[%lu]   ERROR: Grayscale band exceeds display height!\n", millis());
+    return;
+  }
+
+  const uint16_t bandSize = DISPLAY_WIDTH_BYTES * h;
+
+  // Both planes of the band in one hold of the bus, like writeRamBuffer
+  if (busAcquire) busAcquire();
+  setRamArea(0, y, DISPLAY_WIDTH, h);
+  sendCommand(CMD_WRITE_RAM_BW);
+  sendData(lsbBand, bandSize);
+
+  setRamArea(0, y, DISPLAY_WIDTH, h);
+  sendCommand(CMD_WRITE_RAM_RED);
+  sendData(msbBand, bandSize);
+  if (busRelease) busRelease();
 }
 
 #ifdef EINK_DISPLAY_SINGLE_BUFFER_MODE
@@ -457,6 +514,28 @@ void EInkDisplay::displayBuffer(RefreshMode mode, const bool turnOffScreen) {
 #endif
 }
 
+void EInkDisplay::writeBaseline() {
+  inGrayscaleMode = false;
+
+  // The frame was sent as-is when it was displayed, so it is written back without inversion
+  setRamArea(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+  writeRamBuffer(CMD_WRITE_RAM_BW, frameBuffer, BUFFER_SIZE, false);
+  writeRamBuffer(CMD_WRITE_RAM_RED, frameBuffer, BUFFER_SIZE, false);
+}
+
+void EInkDisplay::powerOn() {
+  if (isScreenOn) {
+    return;
+  }
+
+  if (Serial) Serial.printf("[%lu]   Powering on display without refresh...\n", millis());
+  sendCommand(CMD_DISPLAY_UPDATE_CTRL2);
+  sendData(0xE0);  // CLOCK_ON, ANALOG_ON and TEMP_LOAD (see refreshDisplay), DISPLAY_START left clear
+  sendCommand(CMD_MASTER_ACTIVATION);
+  waitWhileBusy(" display power-on");
+  isScreenOn = true;
+}
+
 // EXPERIMENTAL: Windowed update support
 // Displays only a rectangular region of the frame buffer, preserving the rest of the screen.
 // Requirements: x and w must be byte-aligned (multiples of 8 pixels)
@@ -1,41 +1,100 @@
 #include "EpdFont.h"
 
+#include "EpdFontFile.h"
+
+#include <Arduino.h>
 #include <Utf8.h>
 
 #include <algorithm>
 
-void EpdFont::getTextBounds(const char* string, const int startX, const int startY, int* minX, int* minY, int* maxX,
-                            int* maxY) const {
-  *minX = startX;
-  *minY = startY;
-  *maxX = startX;
-  *maxY = startY;
+EpdFont::EpdFont(const EpdFontData* data) : data(data) {
+  for (uint32_t cp = ASCII_FIRST; cp <= ASCII_LAST; cp++) {
+    const EpdGlyph* glyph = findGlyph(cp);
+    asciiGlyphs[cp - ASCII_FIRST] = glyph ? static_cast<uint16_t>(glyph - data->glyph) : NO_GLYPH;
+  }
 
-  if (*string == '\0') {
-    return;
+  if (data->metrics) {
+    metrics = data->metrics;
+  } else {
+    computeMetrics();
+    metrics = &computedMetrics;
+  }
+}
+
+// Same values fontconvert.py writes into the metrics block
+void EpdFont::computeMetrics() {
+  EpdFontMetrics& m = computedMetrics;
+  const uint32_t count = getGlyphCount();
+  for (uint32_t i = 0; i < count; i++) {
+    const EpdGlyph& glyph = data->glyph[i];
+    const int16_t bottom = static_cast<int16_t>(glyph.top - glyph.height);
+    const int16_t right = static_cast<int16_t>(glyph.left + glyph.width);
+    if (i == 0) {
+      m.minLeft = glyph.left;
+      m.maxRight = right;
+      m.maxTop = glyph.top;
+      m.minBottom = bottom;
+    }
+    m.maxAdvanceX = std::max(m.maxAdvanceX, glyph.advanceX);
+    m.minLeft = std::min(m.minLeft, glyph.left);
+    m.maxRight = std::max(m.maxRight, right);
+    m.maxTop = std::max(m.maxTop, glyph.top);
+    m.minBottom = std::min(m.minBottom, bottom);
+  }
+
+  const EpdGlyph* replacement = findGlyph(REPLACEMENT_GLYPH);
+  for (uint32_t cp = ' '; cp <= '~'; cp++) {
+    const EpdGlyph* glyph = getGlyph(cp);
+    if (!glyph) glyph = replacement;
+    m.asciiAdvanceX[cp - ' '] = glyph ? glyph->advanceX : 0;
   }
 
-  int cursorX = startX;
-  const int cursorY = startY;
+  int lowercase = 0;
+  for (uint32_t cp = 'a'; cp <= 'z'; cp++) lowercase += m.asciiAdvanceX[cp - ' '];
+  m.avgAdvanceX = static_cast<uint8_t>(lowercase / 26);
+  m.spaceAdvanceX = m.asciiAdvanceX[0];
+}
+
+uint32_t EpdFont::getGlyphCount() const {
+  if (data->intervalCount == 0) return 0;
+  const EpdUnicodeInterval& last = data->intervals[data->intervalCount - 1];
+  return last.offset + (last.last - last.first) + 1;
+}
+
+void EpdFont::getTextBounds(const char* string, const int startX, const int startY, int* minX, int* minY, int* maxX,
+                            int* maxY) const {
+  TextCursor cursor;
   uint32_t cp;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&string)))) {
-    const EpdGlyph* glyph = getGlyph(cp);
+    addCodepoint(cursor, cp);
+  }
 
-    if (!glyph) {
-      glyph = getGlyph(REPLACEMENT_GLYPH);
-    }
+  *minX = startX + cursor.minX;
+  *minY = startY + cursor.minY;
+  *maxX = startX + cursor.maxX;
+  *maxY = startY + cursor.maxY;
+}
 
-    if (!glyph) {
-      // TODO: Better handle this?
-      continue;
-    }
+void EpdFont::addCodepoint(TextCursor& cursor, const uint32_t cp) const {
+  cursor.x += getKerning(cursor.prevCp, cp);
+  cursor.prevCp = cp;
+
+  const EpdGlyph* glyph = getGlyph(cp);
+
+  if (!glyph) {
+    glyph = getGlyph(REPLACEMENT_GLYPH);
+  }
 
-    *minX = std::min(*minX, cursorX + glyph->left);
-    *maxX = std::max(*maxX, cursorX + glyph->left + glyph->width);
-    *minY = std::min(*minY, cursorY + glyph->top - glyph->height);
-    *maxY = std::max(*maxY, cursorY + glyph->top);
-    cursorX += glyph->advanceX;
+  if (!glyph) {
+    // TODO: Better handle this?
+    return;
   }
+
+  cursor.minX = std::min(cursor.minX, cursor.x + glyph->left);
+  cursor.maxX = std::max(cursor.maxX, cursor.x + glyph->left + glyph->width);
+  cursor.minY = std::min(cursor.minY, glyph->top - glyph->height);
+  cursor.maxY = std::max(cursor.maxY, static_cast<int>(glyph->top));
+  cursor.x += glyph->advanceX;
 }
 
 void EpdFont::getTextDimensions(const char* string, int* w, int* h) const {
@@ -55,7 +114,63 @@ bool EpdFont::hasPrintableChars(const char* string) const {
   return w > 0 || h > 0;
 }
 
+int EpdFont::getKerning(const uint32_t leftCp, const uint32_t rightCp) const {
+  if (data->kernTableSize == 0 || leftCp == 0 || leftCp > 0xFFFF || rightCp > 0xFFFF) return 0;
+
+  // Linear probing; the table always has an empty slot, so a missing pair ends the probe
+  const uint32_t key = (leftCp << 16) | rightCp;
+  const uint32_t mask = data->kernTableSize - 1;
+  for (uint32_t slot = kernSlot(key, data->kernTableSize);; slot = (slot + 1) & mask) {
+    const EpdKernPair& pair = data->kernPairs[slot];
+    if (pair.key == key) return pair.adjustX;
+    if (pair.key == 0) return 0;
+  }
+}
+
+EpdFont::EpdFont(EpdFontFile* file) : EpdFont(file->getData()) { this->file = file; }
+
+const uint8_t* EpdFont::getGlyphBitmap(const EpdGlyph* glyph) const {
+  if (file) return file->getBitmap(glyph);
+  if (!data->runCodeLengths) return &data->bitmap[glyph->dataOffset];
+  if (glyph->width == 0 || glyph->height == 0) return nullptr;  // Spaces: nothing to decode or cache
+
+  const uint32_t index = glyph - data->glyph;
+  if (!bitmapCache.isActive()) {
+    if (!codecTable.build(data->runCodeLengths)) {
+      Serial.printf("[%lu] [EPF] !! Invalid glyph code table\n", millis());
+      return nullptr;
+    }
+    if (!bitmapCache.begin(getGlyphCount(), COMPRESSED_CACHE_SIZE)) return nullptr;
+  }
+  if (const uint8_t* cached = bitmapCache.find(index)) return cached;
+
+  uint8_t* slot = bitmapCache.allocate(index, EpdGlyphCodec::unpackedSize(*glyph, data->is2Bit));
+  if (!slot) return nullptr;
+  if (!EpdGlyphCodec::decode(codecTable, &data->bitmap[glyph->dataOffset], glyph->dataLength, slot, *glyph,
+                             data->is2Bit)) {
+    bitmapCache.remove(index);
+    return nullptr;
+  }
+  return slot;
+}
+
 const EpdGlyph* EpdFont::getGlyph(const uint32_t cp) const {
+  if (cp >= ASCII_FIRST && cp <= ASCII_LAST) {
+    const uint16_t index = asciiGlyphs[cp - ASCII_FIRST];
+    return index == NO_GLYPH ? nullptr : &data->glyph[index];
+  }
+
+  // One slot per code point: a hit is a single compare and a miss costs no more than the search itself. Letters of
+  // one script are consecutive code points, so they rarely evict each other.
+  RecentGlyph& slot = recentGlyphs[cp % RECENT_GLYPHS];
+  if (slot.cp == cp && cp != 0) return slot.glyph;
+
+  const EpdGlyph* glyph = findGlyph(cp);
+  slot = {cp, glyph};
+  return glyph;
+}
+
+const EpdGlyph* EpdFont::findGlyph(const uint32_t cp) const {
   const EpdUnicodeInterval* intervals = data->intervals;
   const int count = data->intervalCount;
 
@@ -1,15 +1,63 @@
 #pragma once
 #include "EpdFontData.h"
+#include "EpdGlyphCache.h"
+#include "EpdGlyphCodec.h"
+
+class EpdFontFile;
 
 class EpdFont {
+  // Printable ASCII is looked up directly; other codepoints go through a small direct-mapped cache before the
+  // interval search
+  static constexpr uint32_t ASCII_FIRST = 0x20;
+  static constexpr uint32_t ASCII_LAST = 0x7F;
+  static constexpr uint16_t NO_GLYPH = 0xFFFF;
+  static constexpr uint32_t RECENT_GLYPHS = 32;  // Power of two; a whole Cyrillic or Greek alphabet fits
+  static constexpr size_t COMPRESSED_CACHE_SIZE = 4 * 1024;  // Decoded bitmaps of compressed built-in fonts
+
+  struct RecentGlyph {
+    uint32_t cp;
+    const EpdGlyph* glyph;
+  };
+
+  uint16_t asciiGlyphs[ASCII_LAST - ASCII_FIRST + 1];  // Index into data->glyph, NO_GLYPH if missing
+  mutable RecentGlyph recentGlyphs[RECENT_GLYPHS] = {};  // Slot cp % RECENT_GLYPHS; cp 0 marks an empty slot
+  EpdFontFile* file = nullptr;  // Set for fonts streamed from SD; bitmaps then come from its glyph cache
+  mutable EpdGlyphCache bitmapCache;  // Allocated on first use, only for compressed fonts in flash
+  mutable EpdGlyphCodec::Table codecTable = {};
+  EpdFontMetrics computedMetrics = {};  // Only filled in for fonts converted without a metrics block
+  const EpdFontMetrics* metrics;
+
   void getTextBounds(const char* string, int startX, int startY, int* minX, int* minY, int* maxX, int* maxY) const;
+  const EpdGlyph* findGlyph(uint32_t cp) const;
+  uint32_t getGlyphCount() const;
+  void computeMetrics();
 
  public:
+  // Running bounds of a string measured one code point at a time, relative to the start of the string
+  struct TextCursor {
+    int x = 0;
+    int minX = 0, minY = 0, maxX = 0, maxY = 0;
+    uint32_t prevCp = 0;
+  };
+
   const EpdFontData* data;
-  explicit EpdFont(const EpdFontData* data) : data(data) {}
+  explicit EpdFont(const EpdFontData* data);
+  explicit EpdFont(EpdFontFile* file);  // The file must be loaded and outlive the font
   ~EpdFont() = default;
   void getTextDimensions(const char* string, int* w, int* h) const;
+  // Extend the cursor by one code point, with the same kerning and fallback rules as getTextDimensions
+  void addCodepoint(TextCursor& cursor, uint32_t cp) const;
   bool hasPrintableChars(const char* string) const;
 
   const EpdGlyph* getGlyph(uint32_t cp) const;
+  // Pointer to the glyph's bitmap. For streamed fonts it is only valid until the next call.
+  const uint8_t* getGlyphBitmap(const EpdGlyph* glyph) const;
+  bool hasResidentBitmaps() const { return file == nullptr && !data->runCodeLengths; }
+  // Decoded bitmaps of a compressed font in flash (inactive for other fonts), for its hit and miss counters
+  const EpdGlyphCache& getBitmapCache() const { return bitmapCache; }
+  const EpdFontMetrics& getMetrics() const { return *metrics; }
+  // Pen adjustment between two consecutive code points (0 if the pair is not kerned)
+  int getKerning(uint32_t leftCp, uint32_t rightCp) const;
+  // Slot a pair key hashes to, shared with fontconvert.py
+  static uint32_t kernSlot(uint32_t key, uint32_t tableSize) { return ((key * 0x9E3779B1u) >> 16) & (tableSize - 1); }
 };
@@ -22,6 +22,24 @@ typedef struct {
   uint32_t offset;  ///< Index of the first code point into the glyph array
 } EpdUnicodeInterval;
 
+/// Kerning pair, one slot of the hash table in EpdFontData::kernPairs
+typedef struct {
+  uint32_t key;    ///< (left code point << 16) | right code point, both in the BMP. 0 marks an empty slot
+  int8_t adjustX;  ///< Added to the pen position between the two glyphs
+} EpdKernPair;
+
+/// Layout metrics of a font, emitted by fontconvert.py (or computed when the font is created)
+typedef struct {
+  uint8_t avgAdvanceX;        ///< Average advance of 'a'..'z', rounded down
+  uint8_t maxAdvanceX;        ///< Largest advance of any glyph
+  uint8_t spaceAdvanceX;      ///< Advance of ' '
+  int16_t minLeft;            ///< Union of all glyph boxes, relative to the cursor and base line
+  int16_t maxRight;
+  int16_t maxTop;
+  int16_t minBottom;
+  uint8_t asciiAdvanceX[95];  ///< Advance drawn for ' '..'~' (the replacement glyph's if missing)
+} EpdFontMetrics;
+
 /// Data stored for FONT AS A WHOLE
 typedef struct {
   const uint8_t* bitmap;                ///< Glyph bitmaps, concatenated
@@ -32,4 +50,10 @@ typedef struct {
   int ascender;                         ///< Maximal height of a glyph above the base line
   int descender;                        ///< Maximal height of a glyph below the base line
   bool is2Bit;
+  const uint8_t* runCodeLengths = nullptr;  ///< Set if bitmaps are compressed: code length per run symbol
+                                           ///< (see EpdGlyphCodec.h), dataLength is then the coded size
+  const EpdFontMetrics* metrics = nullptr;  ///< Precomputed metrics, EpdFont computes them if not set
+  const EpdKernPair* kernPairs = nullptr;   ///< Open-addressed hash table of kerning pairs, see EpdFont::getKerning
+  uint32_t kernTableSize = 0;               ///< Slots in kernPairs (a power of two, at least one empty), 0 if none
+  bool rowAligned = false;                  ///< 1-bit bitmaps with every row starting on a byte boundary
 } EpdFontData;
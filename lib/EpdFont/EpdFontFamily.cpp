@@ -31,3 +31,19 @@ const EpdFontData* EpdFontFamily::getData(const Style style) const { return getF
 const EpdGlyph* EpdFontFamily::getGlyph(const uint32_t cp, const Style style) const {
   return getFont(style)->getGlyph(cp);
 };
+
+const uint8_t* EpdFontFamily::getGlyphBitmap(const EpdGlyph* glyph, const Style style) const {
+  return getFont(style)->getGlyphBitmap(glyph);
+}
+
+bool EpdFontFamily::hasResidentBitmaps(const Style style) const { return getFont(style)->hasResidentBitmaps(); }
+
+const EpdFontMetrics& EpdFontFamily::getMetrics(const Style style) const { return getFont(style)->getMetrics(); }
+
+int EpdFontFamily::getKerning(const uint32_t leftCp, const uint32_t rightCp, const Style style) const {
+  return getFont(style)->getKerning(leftCp, rightCp);
+}
+
+void EpdFontFamily::addCodepoint(EpdFont::TextCursor& cursor, const uint32_t cp, const Style style) const {
+  getFont(style)->addCodepoint(cursor, cp);
+}
@@ -10,9 +10,14 @@ class EpdFontFamily {
       : regular(regular), bold(bold), italic(italic), boldItalic(boldItalic) {}
   ~EpdFontFamily() = default;
   void getTextDimensions(const char* string, int* w, int* h, Style style = REGULAR) const;
+  void addCodepoint(EpdFont::TextCursor& cursor, uint32_t cp, Style style = REGULAR) const;
   bool hasPrintableChars(const char* string, Style style = REGULAR) const;
   const EpdFontData* getData(Style style = REGULAR) const;
   const EpdGlyph* getGlyph(uint32_t cp, Style style = REGULAR) const;
+  const uint8_t* getGlyphBitmap(const EpdGlyph* glyph, Style style = REGULAR) const;
+  bool hasResidentBitmaps(Style style = REGULAR) const;
+  const EpdFontMetrics& getMetrics(Style style = REGULAR) const;
+  int getKerning(uint32_t leftCp, uint32_t rightCp, Style style = REGULAR) const;
 
  private:
   const EpdFont* regular;
@@ -0,0 +1,190 @@
+#include "EpdFontFile.h"
+
+#include <Arduino.h>
+#include <SDCardManager.h>
+
+#include "EpdGlyphCodec.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+uint16_t readU16(const uint8_t* p) { return p[0] | (p[1] << 8); }
+uint32_t readU32(const uint8_t* p) { return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24); }
+}  // namespace
+
+EpdFontFile::~EpdFontFile() { unload(); }
+
+bool EpdFontFile::load(const char* path, const size_t cacheSize) {
+  unload();
+
+  FsFile file;
+  if (!SdMan.openFileForRead("EFF", path, file)) {
+    return false;
+  }
+
+  uint8_t header[HEADER_SIZE];
+  if (file.read(header, HEADER_SIZE) != static_cast<int>(HEADER_SIZE) || memcmp(header, "EPDF", 4) != 0 || header[4] != VERSION) {
+    Serial.printf("[%lu] [EFF] !! %s is not a version %d .epdfont file\n", millis(), path, VERSION);
+    file.close();
+    return false;
+  }
+
+  const uint32_t intervalCount = readU32(header + 12);
+  glyphCount = readU32(header + 16);
+  const uint32_t bitmapSize = readU32(header + 20);
+  const uint16_t maxGlyphBytes = readU16(header + 24);
+  const uint32_t kernTableSize = readU32(header + 28);
+  const bool is2Bit = (header[5] & FLAG_2BIT) != 0;
+  const bool compressed = (header[5] & FLAG_COMPRESSED) != 0;
+  const bool rowAligned = (header[5] & FLAG_ROW_ALIGNED) != 0;
+  const size_t codesSize = compressed ? EpdGlyphCodec::MAX_SYMBOLS : 0;
+  bitmapStart = HEADER_SIZE + codesSize + intervalCount * INTERVAL_RECORD_SIZE + glyphCount * GLYPH_RECORD_SIZE +
+                kernTableSize * KERN_RECORD_SIZE;
+
+  if ((kernTableSize & (kernTableSize - 1)) != 0 || kernTableSize > MAX_KERN_TABLE_SIZE ||
+      (rowAligned && (is2Bit || compressed))) {
+    Serial.printf("[%lu] [EFF] !! %s has an invalid header\n", millis(), path);
+    file.close();
+    return false;
+  }
+
+  if (compressed && (file.read(runCodeLengths, codesSize) != static_cast<int>(codesSize) ||
+                     !codecTable.build(runCodeLengths))) {
+    Serial.printf("[%lu] [EFF] !! %s has an invalid glyph code table\n", millis(), path);
+    file.close();
+    return false;
+  }
+
+  intervals = static_cast<EpdUnicodeInterval*>(malloc(intervalCount * sizeof(EpdUnicodeInterval)));
+  glyphs = static_cast<EpdGlyph*>(malloc(glyphCount * sizeof(EpdGlyph)));
+  kernPairs = kernTableSize ? static_cast<EpdKernPair*>(malloc(kernTableSize * sizeof(EpdKernPair))) : nullptr;
+  if (!intervals || !glyphs || (kernTableSize && !kernPairs) ||
+      !cache.begin(glyphCount, std::max<size_t>(cacheSize, maxGlyphBytes))) {
+    Serial.printf("[%lu] [EFF] !! Not enough memory for %s (%lu glyphs)\n", millis(), path, glyphCount);
+    file.close();
+    unload();
+    return false;
+  }
+
+  // Records are read in small batches to keep the stack buffer bounded
+  uint8_t records[32 * GLYPH_RECORD_SIZE];
+  bool ok = true;
+
+  for (uint32_t i = 0; ok && i < intervalCount;) {
+    const uint32_t batch = std::min<uint32_t>(intervalCount - i, sizeof(records) / INTERVAL_RECORD_SIZE);
+    ok = file.read(records, batch * INTERVAL_RECORD_SIZE) == static_cast<int>(batch * INTERVAL_RECORD_SIZE);
+    for (uint32_t j = 0; ok && j < batch; j++, i++) {
+      const uint8_t* r = records + j * INTERVAL_RECORD_SIZE;
+      intervals[i] = {readU32(r), readU32(r + 4), readU32(r + 8)};
+      ok = intervals[i].first <= intervals[i].last &&
+           intervals[i].offset + (intervals[i].last - intervals[i].first) < glyphCount;
+    }
+  }
+
+  for (uint32_t i = 0; ok && i < glyphCount;) {
+    const uint32_t batch = std::min<uint32_t>(glyphCount - i, sizeof(records) / GLYPH_RECORD_SIZE);
+    ok = file.read(records, batch * GLYPH_RECORD_SIZE) == static_cast<int>(batch * GLYPH_RECORD_SIZE);
+    for (uint32_t j = 0; ok && j < batch; j++, i++) {
+      const uint8_t* r = records + j * GLYPH_RECORD_SIZE;
+      EpdGlyph& glyph = glyphs[i];
+      glyph.width = r[0];
+      glyph.height = r[1];
+      glyph.advanceX = r[2];
+      glyph.left = static_cast<int16_t>(readU16(r + 4));
+      glyph.top = static_cast<int16_t>(readU16(r + 6));
+      glyph.dataLength = readU16(r + 8);
+      glyph.dataOffset = readU32(r + 12);
+      ok = glyph.dataOffset + glyph.dataLength <= bitmapSize &&
+           (compressed ? EpdGlyphCodec::unpackedSize(glyph, is2Bit) : glyph.dataLength) <= maxGlyphBytes;
+    }
+  }
+
+  // Lookups stop at an empty slot, so the table must have at least one
+  bool hasEmptySlot = false;
+  for (uint32_t i = 0; ok && i < kernTableSize;) {
+    const uint32_t batch = std::min<uint32_t>(kernTableSize - i, sizeof(records) / KERN_RECORD_SIZE);
+    ok = file.read(records, batch * KERN_RECORD_SIZE) == static_cast<int>(batch * KERN_RECORD_SIZE);
+    for (uint32_t j = 0; ok && j < batch; j++, i++) {
+      const uint8_t* r = records + j * KERN_RECORD_SIZE;
+      kernPairs[i] = {readU32(r), static_cast<int8_t>(r[4])};
+      hasEmptySlot = hasEmptySlot || kernPairs[i].key == 0;
+    }
+  }
+  ok = ok && (kernTableSize == 0 || hasEmptySlot);
+  file.close();
+
+  if (!ok) {
+    Serial.printf("[%lu] [EFF] !! %s is truncated or corrupt\n", millis(), path);
+    unload();
+    return false;
+  }
+
+  this->path = path;
+  data.bitmap = nullptr;  // Bitmaps are only reachable through getBitmap
+  data.glyph = glyphs;
+  data.intervals = intervals;
+  data.intervalCount = intervalCount;
+  data.advanceY = header[6];
+  data.ascender = static_cast<int16_t>(readU16(header + 8));
+  data.descender = static_cast<int16_t>(readU16(header + 10));
+  data.is2Bit = is2Bit;
+  data.runCodeLengths = compressed ? runCodeLengths : nullptr;
+  data.kernPairs = kernPairs;
+  data.kernTableSize = kernTableSize;
+  data.rowAligned = rowAligned;
+
+  Serial.printf("[%lu] [EFF] Loaded %s: %lu glyphs, %lu bytes of bitmaps\n", millis(), path, glyphCount, bitmapSize);
+  return true;
+}
+
+void EpdFontFile::unload() {
+  cache.end();
+  free(intervals);
+  free(glyphs);
+  free(kernPairs);
+  intervals = nullptr;
+  glyphs = nullptr;
+  kernPairs = nullptr;
+  glyphCount = 0;
+  data = {};
+  path.clear();
+}
+
+const uint8_t* EpdFontFile::getBitmap(const EpdGlyph* glyph) {
+  if (!glyphs || glyph < glyphs || glyph >= glyphs + glyphCount || glyph->dataLength == 0) return nullptr;
+
+  const uint32_t index = glyph - glyphs;
+  if (const uint8_t* cached = cache.find(index)) return cached;
+
+  const bool compressed = data.runCodeLengths != nullptr;
+  const size_t length = compressed ? EpdGlyphCodec::unpackedSize(*glyph, data.is2Bit) : glyph->dataLength;
+  uint8_t* slot = cache.allocate(index, length);
+  if (!slot) return nullptr;
+
+  // The card may have been re-initialized since the last miss, so the file is reopened each time
+  FsFile file = SdMan.open(path.c_str(), O_RDONLY);
+  bool ok = file && file.seekSet(bitmapStart + glyph->dataOffset);
+  if (ok && compressed) {
+    // Decode straight from small reads into the cache slot
+    EpdGlyphCodec::Decoder decoder(codecTable, slot, *glyph, data.is2Bit);
+    uint8_t chunk[64];
+    for (size_t remaining = glyph->dataLength; ok && remaining > 0;) {
+      const size_t n = std::min(remaining, sizeof(chunk));
+      ok = file.read(chunk, n) == static_cast<int>(n) && decoder.feed(chunk, n);
+      remaining -= n;
+    }
+    ok = ok && decoder.done();
+  } else if (ok) {
+    ok = file.read(slot, glyph->dataLength) == static_cast<int>(glyph->dataLength);
+  }
+  if (file) file.close();
+
+  if (!ok) {
+    Serial.printf("[%lu] [EFF] !! Failed to read glyph %lu from %s\n", millis(), index, path.c_str());
+    cache.remove(index);
+    return nullptr;
+  }
+  return slot;
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include <string>
+
+#include "EpdFontData.h"
+#include "EpdGlyphCache.h"
+#include "EpdGlyphCodec.h"
+
+// A font in the binary .epdfont format (see scripts/fontconvert.py --binary), opened from the SD card.
+// Intervals and glyph metrics are loaded into RAM; bitmaps are read from the file on demand through a
+// fixed-size glyph cache.
+//
+// File layout, little endian:
+//   header    32 bytes: "EPDF", version, flags, advanceY, reserved, ascender (i16), descender (i16),
+//             intervalCount, glyphCount, bitmapSize (u32 each), maxGlyphBytes (u16), reserved (u16),
+//             kernTableSize (u32)
+//   codes     only with FLAG_COMPRESSED: EpdGlyphCodec::MAX_SYMBOLS code lengths (u8 each)
+//   intervals intervalCount x {first, last, offset} (u32 each)
+//   glyphs    glyphCount x {width, height, advanceX (u8), pad, left, top (i16), dataLength (u16), pad (u16),
+//             dataOffset (u32)}
+//   kerning   kernTableSize x {key (u32), adjustX (i8), pad (3)}, the hash table of EpdFontData::kernPairs
+//   bitmaps   bitmapSize bytes, glyph dataOffset is relative to the start of this block
+// maxGlyphBytes is the largest decoded bitmap; with FLAG_COMPRESSED, dataLength is the coded size.
+class EpdFontFile {
+ public:
+  static constexpr uint8_t VERSION = 1;
+  static constexpr uint8_t FLAG_2BIT = 0x01;
+  static constexpr uint8_t FLAG_COMPRESSED = 0x02;  // Bitmaps are Huffman-coded runs, see EpdGlyphCodec.h
+  static constexpr uint8_t FLAG_ROW_ALIGNED = 0x04;  // 1-bit rows start on byte boundaries (EpdFontData::rowAligned)
+  static constexpr size_t DEFAULT_CACHE_SIZE = 12 * 1024;
+
+  EpdFontFile() = default;
+  ~EpdFontFile();
+  EpdFontFile(const EpdFontFile& other) = delete;
+  EpdFontFile& operator=(const EpdFontFile& other) = delete;
+
+  bool load(const char* path, size_t cacheSize = DEFAULT_CACHE_SIZE);
+  void unload();
+  bool isLoaded() const { return glyphs != nullptr; }
+
+  const EpdFontData* getData() const { return &data; }
+  // Bitmap for a glyph of this font, read from the card on a cache miss. Valid until the next call.
+  const uint8_t* getBitmap(const EpdGlyph* glyph);
+
+ private:
+  static constexpr size_t HEADER_SIZE = 32;
+  static constexpr size_t INTERVAL_RECORD_SIZE = 12;
+  static constexpr size_t GLYPH_RECORD_SIZE = 16;
+  static constexpr size_t KERN_RECORD_SIZE = 8;
+  static constexpr uint32_t MAX_KERN_TABLE_SIZE = 1 << 16;  // Range of EpdFont::kernSlot
+
+  std::string path;
+  EpdFontData data = {};
+  EpdUnicodeInterval* intervals = nullptr;
+  EpdGlyph* glyphs = nullptr;
+  EpdKernPair* kernPairs = nullptr;
+  uint32_t glyphCount = 0;
+  uint32_t bitmapStart = 0;  // File offset of the bitmap block
+  uint8_t runCodeLengths[EpdGlyphCodec::MAX_SYMBOLS] = {};
+  EpdGlyphCodec::Table codecTable = {};
+  EpdGlyphCache cache;
+};
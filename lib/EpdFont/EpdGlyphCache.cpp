@@ -0,0 +1,106 @@
+#include "EpdGlyphCache.h"
+
+#include <Arduino.h>
+
+#include <cstdlib>
+#include <cstring>
+
+EpdGlyphCache::~EpdGlyphCache() { end(); }
+
+bool EpdGlyphCache::begin(const uint32_t glyphCount, const size_t arenaSize) {
+  end();
+
+  arena = static_cast<uint8_t*>(malloc(arenaSize));
+  glyphEntry = static_cast<uint16_t*>(malloc(glyphCount * sizeof(uint16_t)));
+  entries = static_cast<Entry*>(malloc(MAX_ENTRIES * sizeof(Entry)));
+  if (!arena || !glyphEntry || !entries) {
+    Serial.printf("[%lu] [GLC] !! Failed to allocate glyph cache (%zu bytes)\n", millis(),
+                  arenaSize + glyphCount * sizeof(uint16_t) + MAX_ENTRIES * sizeof(Entry));
+    end();
+    return false;
+  }
+
+  this->arenaSize = arenaSize;
+  this->glyphCount = glyphCount;
+  hits = 0;
+  misses = 0;
+  clear();
+  return true;
+}
+
+void EpdGlyphCache::end() {
+  free(arena);
+  free(glyphEntry);
+  free(entries);
+  arena = nullptr;
+  glyphEntry = nullptr;
+  entries = nullptr;
+  arenaSize = 0;
+  glyphCount = 0;
+  head = 0;
+  count = 0;
+  writePos = 0;
+}
+
+void EpdGlyphCache::clear() {
+  if (glyphEntry) memset(glyphEntry, 0xFF, glyphCount * sizeof(uint16_t));
+  head = 0;
+  count = 0;
+  writePos = 0;
+}
+
+const uint8_t* EpdGlyphCache::find(const uint32_t glyphIndex) const {
+  if (glyphIndex >= glyphCount) return nullptr;
+  const uint16_t entry = glyphEntry[glyphIndex];
+  if (entry == NO_ENTRY) {
+    misses++;
+    return nullptr;
+  }
+  hits++;
+  return arena + entries[entry].offset;
+}
+
+void EpdGlyphCache::evictOldest() {
+  // A removed glyph may have been cached again in a newer entry; leave that mapping alone
+  const uint32_t glyphIndex = entries[head].glyphIndex;
+  if (glyphEntry[glyphIndex] == head) glyphEntry[glyphIndex] = NO_ENTRY;
+  head = (head + 1) % MAX_ENTRIES;
+  count--;
+}
+
+uint8_t* EpdGlyphCache::allocate(const uint32_t glyphIndex, const size_t length) {
+  if (!arena || glyphIndex >= glyphCount || length == 0 || length > arenaSize) return nullptr;
+  remove(glyphIndex);
+
+  // Wrap when the tail is too short; whatever was stored past writePos is the oldest data and goes first
+  size_t offset = writePos;
+  const bool wrapped = offset + length > arenaSize;
+  if (wrapped) offset = 0;
+
+  while (count > 0) {
+    const Entry& oldest = entries[head];
+    const bool inSkippedTail = wrapped && oldest.offset >= writePos;
+    const bool overlaps = oldest.offset < offset + length && oldest.offset + oldest.length > offset;
+    if (count < MAX_ENTRIES && !inSkippedTail && !overlaps) break;
+    evictOldest();
+  }
+
+  const int slot = (head + count) % MAX_ENTRIES;
+  entries[slot] = {glyphIndex, static_cast<uint32_t>(offset), static_cast<uint32_t>(length)};
+  glyphEntry[glyphIndex] = static_cast<uint16_t>(slot);
+  count++;
+  writePos = offset + length;
+  return arena + offset;
+}
+
+void EpdGlyphCache::remove(const uint32_t glyphIndex) {
+  if (glyphIndex >= glyphCount || glyphEntry[glyphIndex] == NO_ENTRY) return;
+
+  // Only the newest entry can be reclaimed outright; older ones just stop being found and age out
+  const int slot = glyphEntry[glyphIndex];
+  glyphEntry[glyphIndex] = NO_ENTRY;
+  if (slot == (head + count - 1) % MAX_ENTRIES) {
+    count--;
+    writePos = entries[slot].offset;
+  }
+}
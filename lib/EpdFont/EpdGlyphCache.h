@@ -0,0 +1,53 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Fixed-size cache of glyph bitmaps, keyed by glyph index.
+// Bitmaps are packed into a ring buffer and evicted oldest first, so glyphs of very different sizes share the
+// memory without per-slot waste. Lookups are a single table read per glyph.
+class EpdGlyphCache {
+ public:
+  static constexpr int MAX_ENTRIES = 256;
+
+  EpdGlyphCache() = default;
+  ~EpdGlyphCache();
+  EpdGlyphCache(const EpdGlyphCache& other) = delete;
+  EpdGlyphCache& operator=(const EpdGlyphCache& other) = delete;
+
+  bool begin(uint32_t glyphCount, size_t arenaSize);  // Memory is only held between begin and end
+  void end();
+  bool isActive() const { return arena != nullptr; }
+  void clear();
+
+  const uint8_t* find(uint32_t glyphIndex) const;
+  // Reserve `length` bytes for a glyph, evicting older glyphs as needed. Returns nullptr if it can never fit.
+  // The pointer (like the ones from find) is valid until the next allocate.
+  uint8_t* allocate(uint32_t glyphIndex, size_t length);
+  void remove(uint32_t glyphIndex);  // Drop a glyph whose bitmap could not be filled in
+
+  // Lookup statistics since begin
+  uint32_t getHits() const { return hits; }
+  uint32_t getMisses() const { return misses; }
+
+ private:
+  static constexpr uint16_t NO_ENTRY = 0xFFFF;
+
+  struct Entry {
+    uint32_t glyphIndex;
+    uint32_t offset;
+    uint32_t length;
+  };
+
+  uint8_t* arena = nullptr;
+  size_t arenaSize = 0;
+  size_t writePos = 0;
+  uint16_t* glyphEntry = nullptr;  // Per glyph: index into entries, NO_ENTRY if not cached
+  uint32_t glyphCount = 0;
+  Entry* entries = nullptr;  // MAX_ENTRIES ring in insertion order, oldest at `head`
+  int head = 0;
+  int count = 0;
+  mutable uint32_t hits = 0;
+  mutable uint32_t misses = 0;
+
+  void evictOldest();
+};
@@ -0,0 +1,83 @@
+#include "EpdGlyphCodec.h"
+
+#include <cstring>
+
+namespace EpdGlyphCodec {
+
+bool Table::build(const uint8_t codeLengths[MAX_SYMBOLS]) {
+  memset(count, 0, sizeof(count));
+  for (int s = 0; s < MAX_SYMBOLS; s++) {
+    if (codeLengths[s] > MAX_CODE_LENGTH) return false;
+    count[codeLengths[s]]++;
+  }
+  count[0] = 0;
+
+  // Reject over-subscribed codes (an incomplete code is fine, unused codes just never match)
+  int left = 1;
+  for (int len = 1; len <= MAX_CODE_LENGTH; len++) {
+    left = (left << 1) - count[len];
+    if (left < 0) return false;
+  }
+
+  uint16_t offsets[MAX_CODE_LENGTH + 1];
+  offsets[1] = 0;
+  for (int len = 1; len < MAX_CODE_LENGTH; len++) {
+    offsets[len + 1] = offsets[len] + count[len];
+  }
+  for (int s = 0; s < MAX_SYMBOLS; s++) {
+    if (codeLengths[s] != 0) symbol[offsets[codeLengths[s]]++] = static_cast<uint8_t>(s);
+  }
+  return true;
+}
+
+Decoder::Decoder(const Table& table, uint8_t* dst, const EpdGlyph& glyph, const bool is2Bit)
+    : table(table), dst(dst), totalPixels(static_cast<size_t>(glyph.width) * glyph.height), is2Bit(is2Bit) {
+  memset(dst, 0, unpackedSize(glyph, is2Bit));
+}
+
+bool Decoder::emit(const uint8_t symbol) {
+  const uint8_t value = symbol / MAX_RUN;
+  const size_t run = symbol % MAX_RUN + 1;
+  if (pixel + run > totalPixels || value > (is2Bit ? 3 : 1)) return false;
+
+  // Background runs are already zero
+  if (value != 0) {
+    for (size_t p = pixel; p < pixel + run; p++) {
+      if (is2Bit) {
+        dst[p / 4] |= value << ((3 - p % 4) * 2);
+      } else {
+        dst[p / 8] |= 0x80 >> (p % 8);
+      }
+    }
+  }
+  pixel += run;
+  return true;
+}
+
+bool Decoder::feed(const uint8_t* src, const size_t len) {
+  for (size_t i = 0; i < len && !done(); i++) {
+    for (int bit = 7; bit >= 0 && !done(); bit--) {
+      code |= (src[i] >> bit) & 1;
+      length++;
+      const int countAtLength = table.count[length];
+      if (code - countAtLength < first) {
+        if (!emit(table.symbol[index + (code - first)])) return false;
+        code = first = index = length = 0;
+        continue;
+      }
+      if (length == MAX_CODE_LENGTH) return false;
+      index += countAtLength;
+      first = (first + countAtLength) << 1;
+      code <<= 1;
+    }
+  }
+  return true;
+}
+
+bool decode(const Table& table, const uint8_t* src, const size_t len, uint8_t* dst, const EpdGlyph& glyph,
+            const bool is2Bit) {
+  Decoder decoder(table, dst, glyph, is2Bit);
+  return decoder.feed(src, len) && decoder.done();
+}
+
+}  // namespace EpdGlyphCodec
@@ -0,0 +1,53 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include "EpdFontData.h"
+
+// Compressed glyph bitmaps (fontconvert.py --compress).
+// Pixels are walked in the same row-major order as the packed bitmap and split into runs of one value, at most
+// MAX_RUN long. Each run is the symbol value * MAX_RUN + (length - 1), written with a canonical Huffman code
+// whose code lengths are stored once per font. Every glyph starts on a byte boundary, bits are MSB first.
+namespace EpdGlyphCodec {
+constexpr int MAX_RUN = 16;
+constexpr int MAX_SYMBOLS = 4 * MAX_RUN;  // 2-bit fonts use all of them, 1-bit fonts the first half
+constexpr int MAX_CODE_LENGTH = 15;
+
+// Size of the packed (uncompressed) bitmap of a glyph
+inline size_t unpackedSize(const EpdGlyph& glyph, const bool is2Bit) {
+  const size_t pixels = static_cast<size_t>(glyph.width) * glyph.height;
+  return is2Bit ? (pixels + 3) / 4 : (pixels + 7) / 8;
+}
+
+// Canonical decoding table built from the per-font code lengths
+struct Table {
+  uint16_t count[MAX_CODE_LENGTH + 1];  // Number of codes of each length
+  uint8_t symbol[MAX_SYMBOLS];          // Symbols ordered by code
+  bool build(const uint8_t codeLengths[MAX_SYMBOLS]);  // False if the lengths do not form a valid code
+};
+
+// Incremental decoder so coded data can be fed in chunks straight from a file
+class Decoder {
+ public:
+  // `dst` must hold unpackedSize(glyph) bytes
+  Decoder(const Table& table, uint8_t* dst, const EpdGlyph& glyph, bool is2Bit);
+  bool feed(const uint8_t* src, size_t len);  // False on an invalid code or runs overflowing the bitmap
+  bool done() const { return pixel == totalPixels; }
+
+ private:
+  const Table& table;
+  uint8_t* dst;
+  size_t totalPixels;
+  size_t pixel = 0;
+  bool is2Bit;
+  // Canonical decode state, kept between feeds since codes cross chunk boundaries
+  int code = 0;
+  int first = 0;
+  int index = 0;
+  int length = 0;
+
+  bool emit(uint8_t symbol);
+};
+
+bool decode(const Table& table, const uint8_t* src, size_t len, uint8_t* dst, const EpdGlyph& glyph, bool is2Bit);
+}  // namespace EpdGlyphCodec
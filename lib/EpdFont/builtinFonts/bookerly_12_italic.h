@@ -3,7 +3,7 @@
  * name: bookerly_12_italic
  * size: 12
  * mode: 2-bit
- * Command used: fontconvert.py bookerly_12_italic 12 ../builtinFonts/source/Bookerly/Bookerly-Italic.ttf --2bit
+ * Command used: fontconvert.py bookerly_12_italic 12 ../builtinFonts/source/Bookerly/Bookerly-Italic.ttf --2bit --kern-manifest font-manifest.txt
  */
 #pragma once
 #include "EpdFontData.h"
@@ -3921,6 +3921,8214 @@ static const EpdUnicodeInterval bookerly_12_italicIntervals[] = {
     { 0xFFFD, 0xFFFD, 0x2EA },
 };
 
+static const EpdFontMetrics bookerly_12_italicMetrics = {
+    12, 34, 5,
+    -5, 33, 26, -7,
+    {
+        5, 8, 9, 16, 16, 24, 23, 5, 10, 10, 10, 16, 8, 9, 8, 12,
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 8, 8, 16, 16, 16, 10,
+        24, 18, 16, 16, 18, 15, 14, 18, 20, 9, 9, 18, 14, 23, 19, 18,
+        15, 18, 16, 13, 16, 19, 18, 26, 17, 16, 15, 8, 12, 8, 16, 13,
+        15, 15, 14, 11, 15, 12, 10, 12, 15, 8, 7, 13, 8, 22, 15, 14,
+        14, 14, 11, 10, 10, 15, 13, 19, 14, 13, 12, 10, 7, 10, 16,
+    },
+};
+
+static const EpdKernPair bookerly_12_italicKernPairs[32768] = {
+    { 0x00DC0065, -1 }, { 0x011A0061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10166, -2 }, { 0x015900E9, -1 }, { 0x017800E7, -2 },
+    { 0x01560076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013B0177, -1 }, { 0x00DB010A, -1 },
+    { 0x01760100, -3 }, { 0x0059002C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500D2, -1 }, { 0x00000000, 0 },
+    { 0x00D90123, -1 }, { 0x0155011B, -1 }, { 0x01740119, -2 }, { 0x00F2003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015000C1, -1 }, { 0x0074005C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0059015D, -2 }, { 0x00000000, 0 }, { 0x005600EA, -2 },
+    { 0x00CF006F, -1 }, { 0x016A0065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540103, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0136, -1 }, { 0x201A00C3, 1 },
+    { 0x00000000, 0 }, { 0x0052011C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B014F, -2 },
+    { 0x201800DC, -1 }, { 0x00000000, 0 }, { 0x01290127, 1 }, { 0x002E00C4, 1 },
+    { 0x01040043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190168, -1 }, { 0x00000000, 0 }, { 0x002F0150, -1 }, { 0x00000000, 0 },
+    { 0x002C00DD, -2 }, { 0x00670066, 2 }, { 0x0102005C, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004900F4, -1 }, { 0x00C500EC, -1 }, { 0x00C20079, -2 }, { 0x01000075, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01040174, -3 }, { 0x0028010F, -1 }, { 0x0066010B, -1 }, { 0x00C30105, -1 },
+    { 0x0159201A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1011E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0175002C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0137, -1 },
+    { 0x00000000, 0 }, { 0x00DB00C2, -2 }, { 0x005C0057, -3 }, { 0x01540047, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DC014E, -1 }, { 0x00000000, 0 }, { 0x013600D5, -1 }, { 0x01140064, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013400EE, 1 },
+    { 0x017200EA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01540178, -2 }, { 0x00590115, -2 },
+    { 0x01700103, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016E011C, -1 }, { 0x00000000, 0 }, { 0x012A003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005200D4, -1 }, { 0x014A00C4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B0107, -2 }, { 0x016A014E, -1 }, { 0x00CC00E5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190120, -2 }, { 0x00000000, 0 }, { 0x00492025, -1 },
+    { 0x002F0108, -1 }, { 0x00C5201D, -2 }, { 0x00CD0171, -1 }, { 0x00E4201B, -1 },
+    { 0x012A016B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006B011D, 1 }, { 0x00C80117, -1 }, { 0x00000000, 0 },
+    { 0x0100002D, -1 }, { 0x013E0029, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002800C7, -1 },
+    { 0x004700C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480151, -1 },
+    { 0x00C100D6, -1 }, { 0x00C40149, -1 }, { 0x00DD0061, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C20162, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011D0175, 1 }, { 0x00DC0106, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA011F, -1 },
+    { 0x0118011B, -1 }, { 0x00580041, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D500C5, -1 }, { 0x00000000, 0 }, { 0x014E004A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250173, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0114014D, -1 }, { 0x005700E6, -2 }, { 0x00540073, -1 },
+    { 0x016E00D4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0050201E, -3 }, { 0x006F201C, -1 },
+    { 0x01500162, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00BF, -3 }, { 0x0110017F, -1 },
+    { 0x016A0106, -1 }, { 0x2018004C, -1 }, { 0x00C9002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900D8, -2 },
+    { 0x00000000, 0 }, { 0x0168011F, -1 }, { 0x002F00C0, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0164, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EA0140, -1 }, { 0x00000000, 0 },
+    { 0x00490064, -1 }, { 0x00C5005C, -4 }, { 0x01220056, -1 }, { 0x01410054, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0165, -1 }, { 0x01450153, -1 },
+    { 0x00C600E8, -1 }, { 0x00C30075, -1 }, { 0x010400E4, -1 }, { 0x01640151, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C70174, -1 },
+    { 0x00480109, -1 }, { 0x00622026, -1 }, { 0x00C40101, -1 }, { 0x00DE201E, -3 },
+    { 0x010200FD, -2 }, { 0x011C201A, -1 }, { 0x012100FB, 1 }, { 0x013B2018, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00133, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01740041, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0153005C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B00F6, -1 }, { 0x00000000, 0 }, { 0x01700073, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F02026, -1 }, { 0x01140105, -1 },
+    { 0x01520101, -1 }, { 0x016C201E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00EA, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0103, -2 }, { 0x00000000, 0 }, { 0x00CD00E1, -1 }, { 0x00000000, 0 },
+    { 0x002F0078, -1 }, { 0x00E9006C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A011C, -1 }, { 0x00520175, -1 }, { 0x004F0102, -1 },
+    { 0x00CE016D, -1 }, { 0x01042015, -1 }, { 0x012800F4, -1 }, { 0x014700F2, -1 },
+    { 0x016600F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0048203A, -1 },
+    { 0x002E011D, 1 }, { 0x00C90113, -1 }, { 0x0126010D, -1 }, { 0x00C3002D, -1 },
+    { 0x0145010B, -1 }, { 0x01640109, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x017B003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0049014D, -1 }, { 0x00C200D2, -1 },
+    { 0x00000000, 0 }, { 0x011C0059, -1 }, { 0x013B0057, -2 }, { 0x015A0055, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00470166, -1 },
+    { 0x00C000EB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10177, -2 }, { 0x00DD0102, -3 }, { 0x011B00FE, -1 }, { 0x01542019, -1 },
+    { 0x017800F8, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB011B, -1 }, { 0x01570113, -1 },
+    { 0x01760111, -2 }, { 0x0132002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D600C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E201B, -3 }, { 0x2026016F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005800E2, -1 }, { 0x0055006F, -1 }, { 0x00D10067, -1 },
+    { 0x012E0061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0051201A, -2 }, { 0x00702018, -1 }, { 0x00D50166, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D3017F, -1 }, { 0x01282025, -1 },
+    { 0x014C0104, -1 }, { 0x004E002E, -2 }, { 0x20190048, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0147, -1 }, { 0x201A00D4, -1 }, { 0x00000000, 0 },
+    { 0x014A011D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0106003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0160, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00EB013C, -1 }, { 0x002E00D5, -1 }, { 0x01040054, -2 },
+    { 0x014500C3, -1 }, { 0x016400C1, -2 }, { 0x00000000, 0 }, { 0x20112025, -1 },
+    { 0x20190179, -1 }, { 0x002F0161, -2 }, { 0x004E015F, -1 }, { 0x00000000, 0 },
+    { 0x00670077, 1 }, { 0x00C40071, -1 }, { 0x0102006D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0178, -2 }, { 0x00C0201C, -3 },
+    { 0x00490105, -1 }, { 0x00C500FD, -2 }, { 0x00FE2018, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00280120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC002E, -2 },
+    { 0x011A002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1012F, -1 }, { 0x004200C4, -1 },
+    { 0x00DA0047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB00D3, -1 }, { 0x007B0066, 1 }, { 0x01540058, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410169, -1 },
+    { 0x00582013, -1 }, { 0x00DC015F, -1 }, { 0x013600E6, -1 }, { 0x01520071, -1 },
+    { 0x015500E4, -1 }, { 0x017400E2, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01560170, -1 }, { 0x005B010D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016A002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0073, -2 },
+    { 0x00000000, 0 }, { 0x00D000C4, -1 }, { 0x00510059, -1 }, { 0x010E00C0, -1 },
+    { 0x01680047, -1 }, { 0x00000000, 0 }, { 0x2018201E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EA0068, -1 },
+    { 0x01280064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B0118, -1 }, { 0x00CF0169, -1 }, { 0x00CC00F6, -1 }, { 0x012C0163, -1 },
+    { 0x016A015F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190131, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0119, -3 },
+    { 0x004E0117, -1 }, { 0x00CA010F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002800D8, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C100E7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20173, -1 },
+    { 0x00F8201B, -1 }, { 0x0100016F, -1 }, { 0x011F016D, 1 }, { 0x013E016B, 1 },
+    { 0x01742013, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410121, 1 }, { 0x00DC0117, -1 }, { 0x011A0113, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D4004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B014F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D60162, -1 }, { 0x013000E9, -1 }, { 0x016E00E5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0167201D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B00D0, -1 }, { 0x00000000, 0 }, { 0x012C011B, -1 },
+    { 0x016A0117, -1 }, { 0x00000000, 0 }, { 0x00C9003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C015C, -1 }, { 0x201900E9, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0175, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CB0153, -1 }, { 0x00C800E0, -1 }, { 0x00490075, -1 },
+    { 0x00C5006D, -1 }, { 0x0128014D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0176, -2 }, { 0x004D0174, -1 }, { 0x00C12018, -3 },
+    { 0x010400F5, -1 }, { 0x014200F1, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C2012B, -1 }, { 0x017C011F, 1 }, { 0x00DB0043, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00144, -1 }, { 0x004100D9, -2 },
+    { 0x015800C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD015B, -2 }, { 0x01590153, -1 },
+    { 0x00DA00E8, -1 }, { 0x011800E4, -1 }, { 0x01780151, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00762026, -2 }, { 0x007B0107, -1 }, { 0x00F2201E, -1 }, { 0x0130201A, -1 },
+    { 0x014F2018, -1 }, { 0x015400F9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D12039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0073003A, -1 }, { 0x014C002C, -2 }, { 0x016B002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D006F, -3 }, { 0x00000000, 0 },
+    { 0x00D100C0, -1 }, { 0x00520055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019201A, -4 }, { 0x201E00FB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0167005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0114, -1 },
+    { 0x00000000, 0 }, { 0x004C2019, -1 }, { 0x00CD00F2, -1 }, { 0x016800E8, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CB010B, -1 }, { 0x01280105, -1 },
+    { 0x01470103, -1 }, { 0x01660101, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010400AD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010200C6, 1 }, { 0x00C10057, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20140178, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004600EB, -1 }, { 0x00C200E3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00660175, 1 }, { 0x00440104, -1 },
+    { 0x00A100FE, -1 }, { 0x00C000FC, -1 }, { 0x00C3016F, -1 }, { 0x01562011, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0113, -2 }, { 0x0159010B, -1 }, { 0x01780109, -2 }, { 0x2026004F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01760122, -1 }, { 0x005C00C1, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202500F4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570067, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005800F3, -1 }, { 0x011200E7, -1 }, { 0x00D10078, -1 }, { 0x010F0074, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0149201B, -1 }, { 0x0056010C, -1 }, { 0x00D20104, -1 }, { 0x01100100, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00CC, -1 }, { 0x00000000, 0 }, { 0x20190059, -1 }, { 0x00000000, 0 },
+    { 0x002F0041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0158, -1 }, { 0x201A00E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014700BB, -1 }, { 0x004C0058, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CC014F, -1 }, { 0x002E00E6, -1 }, { 0x00000000, 0 }, { 0x01040065, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C22014, -1 }, { 0x002C00FF, -2 }, { 0x004B00FD, -1 },
+    { 0x01002010, -1 }, { 0x016200EB, -1 }, { 0x017E0076, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0062002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0178203A, -1 },
+    { 0x0066012D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011A003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017800C1, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB00E4, -1 },
+    { 0x005C0079, -1 }, { 0x0135006B, 1 }, { 0x01730067, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F3201A, -1 },
+    { 0x0139016A, -1 }, { 0x015500F5, -1 }, { 0x01580168, -1 }, { 0x017400F3, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260138, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0172010C, -1 }, { 0x005800AB, -1 }, { 0x00F0002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01320129, 1 }, { 0x005600C4, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570150, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0051006A, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0110, -1 }, { 0x00D10161, -1 },
+    { 0x00000000, 0 }, { 0x014A00E6, -1 }, { 0x01280075, -1 }, { 0x01470073, -1 },
+    { 0x01660071, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0050010F, -1 }, { 0x00CC0107, -1 }, { 0x0143201E, -2 },
+    { 0x0162201C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190142, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C500C6, 1 }, { 0x0100004F, -1 }, { 0x012200C0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0104014E, -1 }, { 0x002800E9, -1 }, { 0x006600E5, -1 }, { 0x011D0066, 2 },
+    { 0x012000D9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00480173, -1 }, { 0x00670171, 1 }, { 0x00C4016B, -1 },
+    { 0x00DB2015, -1 }, { 0x01020167, -1 }, { 0x01210165, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013E017C, 1 }, { 0x00BF0111, -1 },
+    { 0x01552026, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01580120, -1 }, { 0x20250064, -1 }, { 0x017400AB, -1 }, { 0x0152003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202600F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017200C4, -2 },
+    { 0x00580063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0162, -1 }, { 0x005900EF, 1 },
+    { 0x01540152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00712025, -1 },
+    { 0x00570108, -1 }, { 0x00D30100, -1 }, { 0x012B2019, 1 }, { 0x013000FA, -1 },
+    { 0x016E00F6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00C8, -1 }, { 0x00550121, -1 }, { 0x00D10119, -1 }, { 0x012E0113, -1 },
+    { 0x004F003B, -1 }, { 0x016C010F, -1 }, { 0x201A0055, -2 }, { 0x00000000, 0 },
+    { 0x201B00E1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0056, -3 }, { 0x004D0054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201900FA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F00E2, -3 }, { 0x002C006F, -1 }, { 0x004B006D, -1 }, { 0x004E00E0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00472018, -1 }, { 0x00C32010, -1 }, { 0x00000000, 0 }, { 0x01410076, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FF2025, -2 }, { 0x01040106, -1 }, { 0x00000000, 0 },
+    { 0x0044002C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40123, 1 },
+    { 0x0102011F, 1 }, { 0x0121011D, 1 }, { 0x00DD003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00650142, -1 }, { 0x01000138, -1 }, { 0x011C00C3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C00155, -1 }, { 0x004100EA, -1 }, { 0x00DC00E0, -1 },
+    { 0x013900DA, -1 }, { 0x01550065, -1 }, { 0x015800D8, -1 }, { 0x01740063, -2 },
+    { 0x00000000, 0 }, { 0x00420176, -1 }, { 0x00000000, 0 }, { 0x011800F5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00572039, -1 },
+    { 0x0154010A, -1 }, { 0x00000000, 0 }, { 0x00D2002C, -2 }, { 0x00F1002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025014D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700C0, -3 }, { 0x010E0041, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0058014C, -1 }, { 0x00F30142, 1 }, { 0x016C00C7, -1 },
+    { 0x00520066, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E010C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007200F0, -1 }, { 0x00CF00EA, -1 }, { 0x012C00E4, -1 }, { 0x016A00E0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D00176, -1 },
+    { 0x0125201C, -1 }, { 0x00CD0103, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0160002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00280059, 1 }, { 0x00470057, -1 }, { 0x00C3004F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004800E3, -1 }, { 0x00C400DB, -2 }, { 0x017B005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0041201B, -3 }, { 0x0049016F, -1 }, { 0x00C200F4, -1 }, { 0x00C50167, -1 },
+    { 0x00DC2011, -1 }, { 0x010000F0, -1 }, { 0x013B0079, -1 }, { 0x013E00EC, 1 },
+    { 0x00000000, 0 }, { 0x017D0174, -1 }, { 0x00C0010D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C00D2, -1 }, { 0x015400C2, 1 }, { 0x00D50057, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250105, -1 }, { 0x01360150, -1 }, { 0x0174014C, -1 }, { 0x00000000, 0 },
+    { 0x00570078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007A0175, 1 }, { 0x00580104, 1 },
+    { 0x00CF201B, -1 }, { 0x00EE2019, 1 }, { 0x011200F8, -1 }, { 0x016A2011, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00C4, 1 },
+    { 0x0056011D, -2 }, { 0x201B0051, -1 }, { 0x00000000, 0 }, { 0x01290029, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CD00BB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0169, -1 },
+    { 0x201A00F6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006B0067, 1 }, { 0x00C80061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2018010F, -2 }, { 0x00000000, 0 }, { 0x00500168, -1 },
+    { 0x012600E7, -1 }, { 0x014500E5, -1 }, { 0x01040076, -2 }, { 0x01230074, 1 },
+    { 0x01420072, 1 }, { 0x016400E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013E201D, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C5011F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280142, 2 },
+    { 0x0066013E, 1 }, { 0x00C000C5, 1 }, { 0x00C30138, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10151, -1 }, { 0x017800D2, -1 }, { 0x00000000, 0 }, { 0x01180065, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0079201A, -2 }, { 0x00BF016A, -1 }, { 0x00DB00F5, -1 },
+    { 0x00DE0168, -1 }, { 0x011C0164, -1 }, { 0x013B0162, -1 }, { 0x017600EB, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01502025, -2 }, { 0x01360108, -1 },
+    { 0x01740104, -3 }, { 0x0076002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260149, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0172011D, -1 }, { 0x00000000, 0 }, { 0x00D10041, -1 }, { 0x012E003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0113013C, -1 }, { 0x005600D5, -1 }, { 0x014E00C5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00570161, -1 }, { 0x01300153, -1 }, { 0x016E014F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0121, -3 }, { 0x00000000, 0 }, { 0x01262018, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800C7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190153, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B00C6, 1 },
+    { 0x01020047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20064, -1 }, { 0x013E005C, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006600F6, -1 }, { 0x00C300F0, -1 }, { 0x011D0077, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01020178, -3 }, { 0x00450111, -1 }, { 0x00C10109, -1 }, { 0x00DB2026, -2 },
+    { 0x0157201E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01362039, -1 }, { 0x00000000, 0 },
+    { 0x00DB00AD, -1 }, { 0x00D8003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250075, -1 },
+    { 0x00000000, 0 }, { 0x00D900C6, -2 }, { 0x013600C0, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260101, -1 },
+    { 0x00DA0152, -1 }, { 0x005B00E7, -1 }, { 0x017200D5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590100, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570119, -2 },
+    { 0x0130010B, -1 }, { 0x016E0107, -1 }, { 0x201C004D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00D9, -1 },
+    { 0x016C0120, -1 }, { 0x201A0066, 2 }, { 0x00000000, 0 }, { 0x0166003A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0165, -1 }, { 0x00000000, 0 },
+    { 0x201B00F2, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0067, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C017E, -1 },
+    { 0x2019010B, -3 }, { 0x00000000, 0 }, { 0x00510164, -1 }, { 0x002F00F3, -3 },
+    { 0x00CA00E9, -1 }, { 0x01680152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0120201B, -1 },
+    { 0x0128016F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C6011B, -1 }, { 0x01040117, -1 }, { 0x00000000, 0 },
+    { 0x017A0029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C100C1, 1 },
+    { 0x00420056, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2014D, -1 },
+    { 0x00BF00DA, -1 }, { 0x01000149, -1 }, { 0x00DB0065, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C00166, -2 }, { 0x004100FB, -1 }, { 0x00000000, 0 }, { 0x01550076, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01590175, 1 }, { 0x00DA010A, -1 }, { 0x01560102, 1 },
+    { 0x0058002C, -1 }, { 0x01780173, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F1003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0073005C, -1 }, { 0x00D00056, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01120151, -1 }, { 0x005500EA, -1 }, { 0x00520077, -1 },
+    { 0x00CE006F, -1 }, { 0x00D100E2, -1 }, { 0x014A0067, -1 }, { 0x016C00D8, -1 },
+    { 0x201E011D, 1 }, { 0x00000000, 0 }, { 0x014E0166, -1 }, { 0x00720101, -1 },
+    { 0x00CF00FB, -1 }, { 0x012C00F5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0136, -1 }, { 0x201900C3, -4 }, { 0x014C017F, -1 },
+    { 0x0168010A, -1 }, { 0x00000000, 0 }, { 0x0105002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A014F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01660123, -1 }, { 0x00000000, 0 }, { 0x00C50047, -1 },
+    { 0x01220041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180168, -1 },
+    { 0x00000000, 0 }, { 0x002E0150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0028006A, 4 }, { 0x0101005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0169, -1 }, { 0x004800F4, -1 },
+    { 0x00C400EC, -1 }, { 0x00C10079, -2 }, { 0x010200E8, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50178, -3 },
+    { 0x0046010D, -1 }, { 0x00C20105, -1 }, { 0x01000101, -1 }, { 0x011F00FF, 1 },
+    { 0x01220172, -1 }, { 0x0139201C, -2 }, { 0x013E00FD, 1 }, { 0x01410170, -1 },
+    { 0x0160016E, -1 }, { 0x00C0011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0155002E, -2 }, { 0x0174002C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260071, -1 }, { 0x0178012B, 1 },
+    { 0x00DA00C2, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB014E, -1 },
+    { 0x007B00E1, -1 }, { 0x015400D3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F80165, 1 }, { 0x00742019, 1 }, { 0x011400F0, -1 }, { 0x01360161, -1 },
+    { 0x0174015D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580115, -1 }, { 0x01120109, -1 },
+    { 0x012C2026, -1 }, { 0x201D0049, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00D5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00500048, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016800C2, -2 }, { 0x002F0063, -3 },
+    { 0x004E0061, -1 }, { 0x00000000, 0 }, { 0x201D017A, -1 }, { 0x20152026, -1 },
+    { 0x201A0107, -1 }, { 0x00000000, 0 }, { 0x00CB00E5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180120, -1 }, { 0x00000000, 0 }, { 0x00482025, -1 }, { 0x002E0108, -1 },
+    { 0x00C4201D, -2 }, { 0x00CC0171, -1 }, { 0x00E3201B, -1 }, { 0x01022019, -2 },
+    { 0x012600F8, -1 }, { 0x014500F6, -1 }, { 0x016400F4, -1 }, { 0x00000000, 0 },
+    { 0x002C0121, 1 }, { 0x01240111, -1 }, { 0x0143010F, -1 }, { 0x0162010D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004600C5, -2 }, { 0x00000000, 0 },
+    { 0x00BF004A, 3 }, { 0x00DE0048, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280153, -1 }, { 0x0066014F, -1 },
+    { 0x00C000D6, -1 }, { 0x00C30149, -1 }, { 0x00DC0061, -1 }, { 0x01580059, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10162, -2 },
+    { 0x015900E5, -1 }, { 0x017800E3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D62025, -2 }, { 0x00DB0106, -1 }, { 0x0171201B, -1 }, { 0x017600FC, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D9011F, -1 }, { 0x01360119, -1 },
+    { 0x00570041, -3 }, { 0x01550117, -1 }, { 0x016E002F, -2 }, { 0x01740115, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D400C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005600E6, -2 }, { 0x00720071, -1 }, { 0x012C0065, -1 },
+    { 0x016A0061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004F201E, -2 }, { 0x006E201C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0132, -1 }, { 0x00000000, 0 }, { 0x01642025, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C8002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800D8, -1 }, { 0x00000000, 0 },
+    { 0x00EB0127, -1 }, { 0x002E00C0, 1 }, { 0x0104003F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190164, -1 }, { 0x00000000, 0 },
+    { 0x002F014C, -1 }, { 0x00E90140, -1 }, { 0x002C00D9, -2 }, { 0x00480064, -1 },
+    { 0x00C4005C, -4 }, { 0x01020058, 1 }, { 0x016200C5, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004900F0, -1 },
+    { 0x00C20075, -1 }, { 0x00C500E8, -1 }, { 0x01000071, -1 }, { 0x013E006D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040170, -2 }, { 0x0028010B, -1 },
+    { 0x00660107, -1 }, { 0x00C30101, -1 }, { 0x00DD201E, -3 }, { 0x00FC201C, -1 },
+    { 0x01782014, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0156002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01540043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005B00F8, -1 }, { 0x017200E6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01540174, -2 }, { 0x00590111, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014A2039, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00EA, -3 }, { 0x010F0137, 3 },
+    { 0x201A0077, -2 }, { 0x014A00C0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0176, -2 }, { 0x00000000, 0 }, { 0x201B0103, -2 },
+    { 0x00000000, 0 }, { 0x005000E9, -1 }, { 0x00CC00E1, -1 }, { 0x00E8006C, -1 },
+    { 0x01640064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019011C, -2 }, { 0x00CD016D, -1 }, { 0x002F0104, -2 }, { 0x004E0102, -1 },
+    { 0x00C52019, -2 }, { 0x012A0167, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C80113, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2002D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004700C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0048014D, -1 }, { 0x0067014B, 1 }, { 0x00C100D2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF00EB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0044017F, -1 },
+    { 0x0041010C, -1 }, { 0x00C00177, -2 }, { 0x00DC0102, -2 }, { 0x011D0171, 1 },
+    { 0x015800FA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DA011B, -1 }, { 0x01180117, -1 }, { 0x00000000, 0 },
+    { 0x0077003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D80134, -1 }, { 0x00D500C1, -1 },
+    { 0x00000000, 0 }, { 0x0110004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2025016F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700E2, -2 }, { 0x0054006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0050201A, -3 }, { 0x006F2018, -1 }, { 0x00D100F3, -1 }, { 0x00D40166, -1 },
+    { 0x014A0078, -1 }, { 0x016C00E9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D2017F, -1 }, { 0x016A0102, -2 }, { 0x20180048, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0147, -1 }, { 0x201900D4, -2 }, { 0x00000000, 0 }, { 0x0168011B, -1 },
+    { 0x00000000, 0 }, { 0x004B0047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00EA013C, -1 }, { 0x00000000, 0 }, { 0x00C50058, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20102025, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01260151, -1 }, { 0x00C600E4, -1 }, { 0x00660077, 1 },
+    { 0x00C30071, -1 }, { 0x010400E0, -1 }, { 0x0145014F, -1 }, { 0x0164014D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE201A, -3 }, { 0x00480105, -1 },
+    { 0x00C400FD, -2 }, { 0x010200F9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB002E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C0012F, -1 }, { 0x004100C4, 1 }, { 0x00D90047, -1 },
+    { 0x01360041, 1 }, { 0x017A0123, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011B0142, -1 }, { 0x00DA00D3, -1 },
+    { 0x0115005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB015F, -1 }, { 0x00572013, -1 },
+    { 0x007B00F2, -1 }, { 0x011600E8, -1 }, { 0x0170006F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x012E201E, -1 }, { 0x01140101, -1 }, { 0x014D201C, -1 }, { 0x016C201A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D005A, -1 }, { 0x00000000, 0 }, { 0x00D100AB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E00E6, -1 }, { 0x201B0073, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00500059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016800D3, -1 }, { 0x002F0074, -1 }, { 0x00E90068, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00520171, -1 }, { 0x00CB00F6, -1 }, { 0x00CE0169, -1 }, { 0x01042011, -1 },
+    { 0x012800F0, -1 }, { 0x014A0161, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0119, -1 }, { 0x00C9010F, -1 },
+    { 0x01260109, -1 }, { 0x0066002F, -1 }, { 0x01450107, -1 }, { 0x01640105, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0059, -2 },
+    { 0x011C0055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00470162, -1 }, { 0x00C000E7, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10173, -1 }, { 0x01542015, -1 },
+    { 0x015900F6, -1 }, { 0x017800F4, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB0117, -1 }, { 0x0157010F, -1 }, { 0x0176010D, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D3004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026016B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0151, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D10063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D50162, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0166201D, 1 }, { 0x010E0104, -1 }, { 0x014C0100, -1 }, { 0x20190044, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0143, -1 },
+    { 0x00000000, 0 }, { 0x0126203A, -1 }, { 0x014A0119, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C8003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B015C, -1 }, { 0x201800E9, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F015D, -2 },
+    { 0x004E015B, -1 }, { 0x002C00EA, -1 }, { 0x00480075, -1 }, { 0x004B00E8, -1 },
+    { 0x00C4006D, -1 }, { 0x00CA0153, -1 }, { 0x01020069, -1 }, { 0x01210067, 1 },
+    { 0x002D0176, -1 }, { 0x004C0174, -2 }, { 0x00490101, -1 }, { 0x00C02018, -3 },
+    { 0x00C500F9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01782025, -3 }, { 0x0028011C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C1012B, -1 }, { 0x004200C0, -1 }, { 0x00DA0043, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017600C5, -3 }, { 0x00D8005C, -1 },
+    { 0x01540054, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410165, -1 }, { 0x00DC015B, -1 }, { 0x00D900E8, -1 },
+    { 0x01140071, -1 }, { 0x013600E2, -1 }, { 0x015500E0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260123, 1 }, { 0x00BB0176, -1 }, { 0x005B0109, -1 },
+    { 0x0156016C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590122, -1 }, { 0x201E0056, -3 }, { 0x00000000, 0 }, { 0x012C002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C006F, -2 }, { 0x00000000, 0 }, { 0x00D000C0, -1 },
+    { 0x01680043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2018201A, -3 }, { 0x201D00FB, -1 }, { 0x010F0148, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0114, -1 }, { 0x002C201B, -3 },
+    { 0x00CF0165, -1 }, { 0x00CC00F2, -1 }, { 0x016A015B, -1 }, { 0x2015002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F0115, -3 }, { 0x004E0113, -1 }, { 0x00CA010B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002800D4, -1 }, { 0x012000C4, -1 }, { 0x00A10059, -1 }, { 0x00C00057, -3 },
+    { 0x00000000, 0 }, { 0x20130178, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01020152, -1 }, { 0x004500EB, -1 }, { 0x00C100E3, -1 }, { 0x011E00DD, -1 },
+    { 0x015C00D9, -1 }, { 0x01780064, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C2016F, -1 }, { 0x0100016B, -1 }, { 0x011F0169, 1 },
+    { 0x01362013, -1 }, { 0x013E0167, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041011D, 1 },
+    { 0x00DC0113, -1 }, { 0x011A010F, -1 }, { 0x2025004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600DB, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B014B, -1 }, { 0x00000000, 0 }, { 0x00560067, -2 },
+    { 0x014E0057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700F3, -2 },
+    { 0x013000E5, -1 }, { 0x016E00E1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00AD2025, -1 },
+    { 0x0055010C, -1 }, { 0x00D10104, -1 }, { 0x0129201D, 1 }, { 0x0148201B, -1 },
+    { 0x01672019, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00CC, -1 },
+    { 0x00000000, 0 }, { 0x00720123, -1 }, { 0x012C0117, -1 }, { 0x002E0041, 1 },
+    { 0x0145002F, -2 }, { 0x016A0113, -1 }, { 0x00000000, 0 }, { 0x201C0158, -1 },
+    { 0x201900E5, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B0058, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0171, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CB014F, -1 },
+    { 0x00000000, 0 }, { 0x00490071, -1 }, { 0x00C50069, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0172, -2 },
+    { 0x004D0170, -1 }, { 0x00C12014, -1 }, { 0x00C600F5, -1 }, { 0x010400F1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0102010A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000123, 1 },
+    { 0x011F0121, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00A10142, -1 }, { 0x004100D5, -1 }, { 0x015800C3, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0159014F, -1 }, { 0x00DA00E4, -1 }, { 0x007A0077, 1 },
+    { 0x011800E0, -1 }, { 0x015600DC, -1 }, { 0x01720067, -1 }, { 0x0178014D, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F2201A, -1 }, { 0x007B0103, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250138, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700AB, -1 }, { 0x010E002C, -2 }, { 0x012D002A, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D006B, -1 }, { 0x00000000, 0 }, { 0x005500C4, -2 }, { 0x00520051, -1 },
+    { 0x014A0041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0129005C, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0110, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x012A00E8, -1 }, { 0x016800E4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CB0107, -1 }, { 0x01280101, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E60137, -1 }, { 0x00000000, 0 },
+    { 0x00C400C6, 1 }, { 0x010200C2, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50152, -1 },
+    { 0x004600E7, -1 }, { 0x010000DB, -2 }, { 0x00BF006C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C3016B, -1 }, { 0x00440100, -1 }, { 0x00DA2015, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD010F, -2 }, { 0x01590107, -1 },
+    { 0x01780105, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0176011E, -1 },
+    { 0x00000000, 0 }, { 0x015400AD, -1 }, { 0x0151003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500F0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570063, -2 },
+    { 0x016E0051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01720150, -1 }, { 0x011200E3, -1 }, { 0x015000DF, -1 },
+    { 0x010F0070, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00702025, -1 }, { 0x00560108, -1 },
+    { 0x00D20100, -1 }, { 0x01682015, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00C8, -1 },
+    { 0x00540121, -1 }, { 0x20190055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0154, -1 }, { 0x201A00E1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0054, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00500153, -1 }, { 0x002E00E2, -1 },
+    { 0x00000000, 0 }, { 0x00C60065, -1 }, { 0x01040061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C22010, -1 },
+    { 0x002C00FB, -1 }, { 0x004B00F9, -1 }, { 0x01210078, 1 }, { 0x012400EB, -1 },
+    { 0x014300E9, -1 }, { 0x016200E7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00FE2025, -1 }, { 0x00C5010A, -1 }, { 0x01220104, -1 }, { 0x0062002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00660129, 2 }, { 0x00C30123, 1 },
+    { 0x00000000, 0 }, { 0x00DC003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD00C7, -1 }, { 0x00BB0056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB00E0, -1 }, { 0x007B0073, -1 }, { 0x017600D6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410176, -3 }, { 0x0077201E, -2 }, { 0x013600F3, -1 }, { 0x01390166, -1 },
+    { 0x01580164, -2 }, { 0x017400EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260134, 2 }, { 0x00000000, 0 }, { 0x00562039, -1 }, { 0x01720108, -1 },
+    { 0x00000000, 0 }, { 0x00D1002C, -2 }, { 0x00F0002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0067, 1 },
+    { 0x01130127, -1 }, { 0x005600C0, -3 }, { 0x01700121, -1 }, { 0x016A003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0057014C, -1 }, { 0x00F20142, 1 }, { 0x00000000, 0 }, { 0x00510066, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D010C, -2 }, { 0x00D1015D, -1 }, { 0x010F0159, 1 }, { 0x00CE00EA, -1 },
+    { 0x01280071, -1 }, { 0x0147006F, -1 }, { 0x014A00E2, -1 }, { 0x016C0153, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0050010B, -1 },
+    { 0x00CC0103, -1 }, { 0x0124201C, -1 }, { 0x0143201A, -2 }, { 0x01622018, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019013E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015F002C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500C2, 1 },
+    { 0x00C2004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01230148, 1 }, { 0x002800E5, -1 },
+    { 0x006600E1, -1 }, { 0x00A1006A, 2 }, { 0x00C300DB, -2 }, { 0x01420146, 1 },
+    { 0x017A005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0048016F, -1 },
+    { 0x0067016D, 1 }, { 0x00C100F4, -1 }, { 0x00C40167, -1 }, { 0x00DB2011, -1 },
+    { 0x01020163, -1 }, { 0x01590077, 1 }, { 0x01780075, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF010D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0158011C, -1 },
+    { 0x013600AB, -1 }, { 0x0114003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013400C4, -1 }, { 0x00D40057, -1 }, { 0x017200C0, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0154014E, -1 }, { 0x005900EB, -2 }, { 0x00000000, 0 }, { 0x00560078, -1 },
+    { 0x012F006A, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CE201B, -1 }, { 0x00570104, -3 }, { 0x013000F6, -1 },
+    { 0x016E00F2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00C4, -4 }, { 0x0055011D, -1 },
+    { 0x00D10115, -1 }, { 0x012E010F, -1 }, { 0x016C010B, -1 }, { 0x201A0051, -1 },
+    { 0x00000000, 0 }, { 0x201E0150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005000C3, -2 }, { 0x00CC00BB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900F6, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01260173, -1 },
+    { 0x01040102, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C4011F, 1 }, { 0x0102011B, -1 }, { 0x00420041, -1 },
+    { 0x0159002F, -1 }, { 0x0178002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0065013E, -1 }, { 0x00C20138, -1 },
+    { 0x00DE00C3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2026201D, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00151, -1 },
+    { 0x004100E6, -1 }, { 0x011D014B, 1 }, { 0x01360063, -1 }, { 0x01550061, -1 },
+    { 0x015800D4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420172, -1 },
+    { 0x00000000, 0 }, { 0x00DA00F5, -1 }, { 0x00000000, 0 }, { 0x01720078, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014F2025, -1 }, { 0x01540106, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250149, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D00041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005500D5, -1 }, { 0x010C0056, -1 }, { 0x016C00C3, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0108, -1 },
+    { 0x00560161, -1 }, { 0x00000000, 0 }, { 0x00CF00E6, -1 }, { 0x012C00E0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0121, -2 }, { 0x00000000, 0 }, { 0x01252018, -1 }, { 0x012A00F9, -1 },
+    { 0x016800F5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0049003A, -1 }, { 0x0122002C, -1 },
+    { 0x0141002A, -1 }, { 0x00000000, 0 }, { 0x20180153, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01640127, 1 }, { 0x004A00C6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B0152, -1 }, { 0x00000000, 0 }, { 0x010200D3, -1 },
+    { 0x00C10064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0049016B, -1 }, { 0x004600F8, -1 },
+    { 0x00C200F0, -1 }, { 0x00C50163, -1 }, { 0x010000EC, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01200176, -1 },
+    { 0x00C00109, -1 }, { 0x00DA2026, -2 }, { 0x015E0172, -1 }, { 0x017A00FD, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0120, -1 }, { 0x00000000, 0 }, { 0x00DA00AD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D800C6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250101, -1 }, { 0x00D90152, -1 },
+    { 0x0136014C, -1 }, { 0x00D600DF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0072201D, 1 }, { 0x00580100, 1 }, { 0x011200F4, -1 }, { 0x01720161, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E00C0, 1 }, { 0x00560119, -2 }, { 0x01682026, -2 },
+    { 0x201B004D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00D9, -1 }, { 0x20190066, -2 },
+    { 0x00000000, 0 }, { 0x016800AD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A00F2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016600C6, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B017E, -1 }, { 0x2018010B, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E00F3, -1 }, { 0x00C900E9, -1 },
+    { 0x01040072, -1 }, { 0x01230070, 1 }, { 0x012600E3, -1 }, { 0x0142006E, 1 },
+    { 0x014500E1, -1 }, { 0x00000000, 0 }, { 0x0100201D, -2 }, { 0x002C010C, -1 },
+    { 0x004B010A, -1 }, { 0x011F201B, 1 }, { 0x012400FC, -1 }, { 0x013E2019, 3 },
+    { 0x016200F8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C5011B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0062003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0028013E, 2 }, { 0x0066013A, 1 }, { 0x00410056, -3 },
+    { 0x00C000C1, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1014D, -1 }, { 0x00DD00D8, -1 },
+    { 0x00000000, 0 }, { 0x00DA0065, -1 }, { 0x01180061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0164, -1 },
+    { 0x015700E9, -1 }, { 0x017600E7, -2 }, { 0x01540076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01390177, -1 }, { 0x00D9010A, -1 }, { 0x01360104, 1 }, { 0x0057002C, -3 },
+    { 0x01580175, -1 }, { 0x01740100, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01720119, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00F0003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011000C5, -1 }, { 0x0072005C, -1 }, { 0x014E00C1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057015D, -1 },
+    { 0x0130014F, -1 }, { 0x005400EA, -1 }, { 0x00CD006F, -1 }, { 0x01680065, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D011D, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CE00FB, -1 }, { 0x014A00F3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B0136, -1 }, { 0x201800C3, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0104002A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019014F, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C00C4, 1 }, { 0x004B00C2, 1 }, { 0x00C40047, -1 },
+    { 0x01020043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500D3, -1 }, { 0x0100005C, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01230159, 1 }, { 0x002800F6, -1 }, { 0x006600F2, -1 },
+    { 0x00C00079, -2 }, { 0x00C300EC, -1 }, { 0x01420157, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40178, -3 }, { 0x0045010D, -1 },
+    { 0x00C10105, -1 }, { 0x01020174, -3 }, { 0x0157201A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250071, -1 }, { 0x00000000, 0 }, { 0x00D900C2, -2 },
+    { 0x005A0057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202600FD, -2 }, { 0x00DA014E, -1 }, { 0x005B00E3, -1 },
+    { 0x00000000, 0 }, { 0x01120064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054201B, 1 },
+    { 0x005900FC, -1 }, { 0x013200EE, 1 }, { 0x017000EA, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00570115, -2 }, { 0x01300107, -1 }, { 0x016E0103, -1 },
+    { 0x0051002F, -1 }, { 0x201C0049, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00D5, -2 }, { 0x00000000, 0 }, { 0x016C011C, -1 },
+    { 0x014A00AB, -1 }, { 0x0128003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0063, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C017A, -1 }, { 0x20142026, -1 }, { 0x20190107, -3 },
+    { 0x0168014E, -1 }, { 0x00CA00E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00472025, -1 }, { 0x00C3201D, -2 }, { 0x00E2201B, -1 },
+    { 0x0128016B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C60117, -1 },
+    { 0x01040113, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00460151, -1 }, { 0x00C20149, -1 }, { 0x00000000, 0 },
+    { 0x00DB0061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00162, -2 }, { 0x011A00E9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D52025, -2 },
+    { 0x00DA0106, -1 }, { 0x0178016F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0116011B, -1 }, { 0x00000000, 0 }, { 0x00560041, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D300C5, -1 },
+    { 0x00000000, 0 }, { 0x014C004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0112014D, -1 },
+    { 0x005500E6, -1 }, { 0x016C00D4, -1 }, { 0x014A0063, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0119, -1 }, { 0x00000000, 0 },
+    { 0x004E201E, -2 }, { 0x006D201C, -1 }, { 0x007200FD, 1 }, { 0x01100166, -1 },
+    { 0x014E0162, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0132, -1 },
+    { 0x00000000, 0 }, { 0x010E017F, -1 }, { 0x01680106, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A014B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EA0127, -1 },
+    { 0x01470121, -1 }, { 0x00C50043, -1 }, { 0x0166011F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E014C, -1 },
+    { 0x00E80140, -1 }, { 0x00000000, 0 }, { 0x00280066, 4 }, { 0x00660062, 1 },
+    { 0x00C3005C, -4 }, { 0x01200056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0165, -1 }, { 0x01430153, -1 }, { 0x004800F0, -1 }, { 0x00C10075, -1 },
+    { 0x00C400E8, -1 }, { 0x010200E4, -1 }, { 0x01620151, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50174, -3 }, { 0x00460109, -1 }, { 0x00C20101, -1 },
+    { 0x00DC201E, -2 }, { 0x00FB201C, -1 }, { 0x010000FD, -2 }, { 0x011F00FB, 1 },
+    { 0x0122016E, -1 }, { 0x01392018, -2 }, { 0x013E00F9, 1 }, { 0x0141016C, -1 },
+    { 0x0160016A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2026006D, -1 }, { 0x01780127, 1 }, { 0x00000000, 0 }, { 0x01720041, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0151005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0136015D, -1 }, { 0x00000000, 0 },
+    { 0x015200E8, -1 }, { 0x016E0073, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580111, -1 }, { 0x01120105, -1 }, { 0x016A201E, -2 }, { 0x00710029, 1 },
+    { 0x201D0045, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00500044, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00EA, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00AB0057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0176, -1 }, { 0x00000000, 0 }, { 0x201A0103, -1 }, { 0x00000000, 0 },
+    { 0x00CB00E1, -1 }, { 0x00000000, 0 }, { 0x004C0076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018011C, -1 },
+    { 0x00CC016D, -1 }, { 0x002E0104, 1 }, { 0x00C42019, -2 }, { 0x01022015, -1 },
+    { 0x012600F4, -1 }, { 0x014500F2, -1 }, { 0x016400F0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C011D, 1 }, { 0x004B011B, -1 },
+    { 0x0124010D, -1 }, { 0x00C1002D, -1 }, { 0x0143010B, -1 }, { 0x01620109, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004600C1, -2 }, { 0x00000000, 0 }, { 0x00DE0044, -1 }, { 0x0179003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0028014F, -1 }, { 0x0066014B, -1 }, { 0x00410067, 1 }, { 0x00C000D2, -1 },
+    { 0x01390057, -2 }, { 0x01580055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00E9, -2 }, { 0x015900E1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0102, -2 },
+    { 0x011900FE, -1 }, { 0x017600F8, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D9011B, -1 }, { 0x01360115, -1 }, { 0x01550113, -1 }, { 0x0076003B, -1 },
+    { 0x01740111, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D400C1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005600E2, -2 },
+    { 0x00000000, 0 }, { 0x012C0061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F201A, -2 },
+    { 0x006E2018, -1 }, { 0x00D30166, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D012E, -1 }, { 0x00000000, 0 },
+    { 0x01262025, -1 }, { 0x014A0104, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0147, -1 },
+    { 0x201800D4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190160, -1 }, { 0x00000000, 0 }, { 0x002F0148, -1 }, { 0x00E9013C, -1 },
+    { 0x002C00D5, -1 }, { 0x004B00D3, -1 }, { 0x00C40058, 1 }, { 0x01020054, -2 },
+    { 0x014300C3, -1 }, { 0x016200C1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C500E4, -1 }, { 0x00C20071, -1 }, { 0x0100006D, -1 },
+    { 0x013E0069, 1 }, { 0x014100DC, -1 }, { 0x016000DA, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD201A, -3 }, { 0x00280107, -1 }, { 0x00660103, -1 },
+    { 0x00C300FD, -2 }, { 0x00FC2018, -1 }, { 0x0104016C, -2 }, { 0x01782010, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DA002E, -2 }, { 0x0118002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410150, -1 }, { 0x00000000, 0 }, { 0x00D900D3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DA015F, -1 }, { 0x00562013, -1 }, { 0x005B00F4, -1 },
+    { 0x017200E2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D80178, -1 }, { 0x0059010D, -2 },
+    { 0x01540170, -1 }, { 0x201E0041, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0168002E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00E6, -3 }, { 0x010F0133, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004F0059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0172, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005000E5, -1 },
+    { 0x00000000, 0 }, { 0x002E0074, -1 }, { 0x00E80068, -1 }, { 0x01260064, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190118, -1 }, { 0x0068201B, -1 },
+    { 0x002F0100, -2 }, { 0x00C52015, -1 }, { 0x00CA00F6, -1 }, { 0x00CD0169, -1 },
+    { 0x012A0163, -1 }, { 0x0168015F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C8010F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0044004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0059, 1 }, { 0x0178004F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF00E7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C00173, -1 }, { 0x00410108, -1 }, { 0x00F6201B, -1 },
+    { 0x011D016D, 1 }, { 0x01722013, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600C6, 1 }, { 0x00DA0117, -1 },
+    { 0x01180113, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005900C5, -3 }, { 0x00000000, 0 }, { 0x00D2004A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025016B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D40162, -1 }, { 0x012E00E9, -1 },
+    { 0x016C00E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180044, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0143, -1 }, { 0x201900D0, -1 },
+    { 0x00000000, 0 }, { 0x012A011B, -1 }, { 0x01680117, -1 }, { 0x004B0043, -1 },
+    { 0x00C7003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50054, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C90153, -1 },
+    { 0x00C600E0, -1 }, { 0x00C3006D, -1 }, { 0x010400DC, -2 }, { 0x0126014D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0176, -2 },
+    { 0x0062201E, -1 }, { 0x00480101, -1 }, { 0x006700FF, 1 }, { 0x00C400F9, -1 },
+    { 0x010200F5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00412039, -1 }, { 0x01772025, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C0012B, -1 },
+    { 0x004100C0, 1 }, { 0x00D90043, -1 }, { 0x017A011F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011B013E, -1 }, { 0x015600C7, -1 }, { 0x005B0064, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB015B, -1 }, { 0x01570153, -1 }, { 0x011600E4, -1 }, { 0x01760151, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250123, 1 }, { 0x00000000, 0 }, { 0x00F0201E, -1 }, { 0x010F201C, 2 },
+    { 0x012E201A, -1 }, { 0x014D2018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580122, -1 },
+    { 0x00CF2039, -1 }, { 0x201D0056, -1 }, { 0x014A002C, -2 }, { 0x0169002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00E2, -1 },
+    { 0x201B006F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00500055, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F0070, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0052016D, -1 }, { 0x00CE0165, -1 },
+    { 0x00CB00F2, -1 }, { 0x014700EA, -1 }, { 0x014A015D, -1 }, { 0x016600E8, -1 },
+    { 0x2014002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0115, -1 }, { 0x00C9010B, -1 }, { 0x01260105, -1 }, { 0x01450103, -1 },
+    { 0x01640101, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010200AD, -1 },
+    { 0x00FF003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010000C6, 1 }, { 0x00BF0057, -1 }, { 0x00DE0055, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C000E3, -1 }, { 0x00000000, 0 }, { 0x01580066, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C1016F, -1 }, { 0x00420104, -1 }, { 0x00DD00FA, -1 }, { 0x01542011, -1 },
+    { 0x015900F2, -1 }, { 0x017800F0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0113, -1 }, { 0x0157010B, -1 },
+    { 0x01760109, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500DB, -2 }, { 0x01740122, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260167, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005B014D, -1 }, { 0x00000000, 0 }, { 0x00550067, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005600F3, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01300171, -1 }, { 0x00D00104, -1 },
+    { 0x010E0100, -1 }, { 0x012D00FE, 2 }, { 0x01662019, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D013F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00710123, 1 }, { 0x014A0115, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0158, -1 }, { 0x201800E5, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014500BB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190171, -1 },
+    { 0x00000000, 0 }, { 0x002F0159, -1 }, { 0x00CA014F, -1 }, { 0x002C00E6, -1 },
+    { 0x00480071, -1 }, { 0x004B00E4, -1 }, { 0x00C40069, -1 }, { 0x01020065, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0170, -1 }, { 0x00C02014, -1 },
+    { 0x00C500F5, -1 }, { 0x013E007A, 1 }, { 0x017C0076, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0176203A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0118003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0140, -1 },
+    { 0x017600C1, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011A0153, -1 }, { 0x00D900E4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026011F, 1 },
+    { 0x00000000, 0 }, { 0x01560168, -1 }, { 0x005B0105, -1 }, { 0x017200F3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059011E, -1 }, { 0x0170010C, -1 },
+    { 0x005600AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005400C4, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00550150, -1 }, { 0x010F0144, 1 }, { 0x005200DD, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B0110, -1 }, { 0x00000000, 0 }, { 0x004B2015, -1 }, { 0x005000F6, -1 },
+    { 0x01260075, -1 }, { 0x01450073, -1 }, { 0x01640071, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0111, -3 },
+    { 0x004E010F, -1 }, { 0x00CA0107, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500AD, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01420131, 1 }, { 0x00000000, 0 }, { 0x00C300C6, 1 },
+    { 0x012000C0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40152, -1 }, { 0x004500E7, -1 },
+    { 0x0102014E, -1 }, { 0x011E00D9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2016B, -1 },
+    { 0x00BF00F8, -1 }, { 0x00D92015, -1 }, { 0x01000167, -1 }, { 0x011F0165, 1 },
+    { 0x013E0163, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410119, -1 }, { 0x00DC010F, -1 }, { 0x011A010B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01560120, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0150003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005900D6, -1 }, { 0x017000C4, -2 }, { 0x00560063, -2 }, { 0x01100057, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700EF, 1 }, { 0x013000E1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006F2025, -1 }, { 0x00550108, -1 }, { 0x00D10100, -1 },
+    { 0x010F00FC, 1 }, { 0x01292019, 1 }, { 0x012E00FA, -1 }, { 0x016C00F6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00C8, -1 }, { 0x0072011F, -1 },
+    { 0x00CF0119, -1 }, { 0x012C0113, -1 }, { 0x016A010F, -1 }, { 0x20180055, -1 },
+    { 0x00000000, 0 }, { 0x201C0154, -1 }, { 0x201900E1, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0056, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A016D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E016E, -2 }, { 0x004D016C, -1 }, { 0x00C12010, -1 },
+    { 0x010400ED, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FD2025, -2 },
+    { 0x00C4010A, -1 }, { 0x01020106, -1 }, { 0x0042002C, -1 }, { 0x0061002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0046012B, 1 }, { 0x00C20123, 1 }, { 0x0100011F, 1 },
+    { 0x00DB003B, -1 }, { 0x011F011D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00A1013E, -1 }, { 0x00DC00C7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0153, -2 },
+    { 0x00DA00E0, -1 }, { 0x015600D8, -1 }, { 0x01720063, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0076201E, -2 }, { 0x011600F5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250134, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D0002C, -2 }, { 0x00EF002A, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0067, -3 }, { 0x00000000, 0 },
+    { 0x005500C0, -2 }, { 0x0052004D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00F3, -1 }, { 0x0056014C, -1 },
+    { 0x00000000, 0 }, { 0x005300D9, -1 }, { 0x00EB005C, -2 }, { 0x016A00C7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C010C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CD00EA, -1 }, { 0x012A00E4, -1 },
+    { 0x016800E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0123201C, 1 }, { 0x00CB0103, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015E002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C400C2, 1 }, { 0x00C1004F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C5014E, -1 }, { 0x004600E3, -1 }, { 0x00C200DB, -2 },
+    { 0x00BF0068, -1 }, { 0x0179005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30167, -1 }, { 0x00C000F4, -1 },
+    { 0x00DA2011, -1 }, { 0x01390079, -1 }, { 0x01580077, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017B0174, -1 },
+    { 0x00DD010B, -2 }, { 0x01590103, -1 }, { 0x01780101, -2 }, { 0x20260047, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D30057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260178, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0172014C, -1 },
+    { 0x005800EB, -1 }, { 0x00000000, 0 }, { 0x00550078, -1 }, { 0x010F006C, 3 },
+    { 0x012E006A, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CD201B, -1 }, { 0x00560104, -3 }, { 0x01682011, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00C4, -3 }, { 0x0054011D, -1 }, { 0x20190051, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0150, -2 }, { 0x00000000, 0 }, { 0x201A00DD, -2 }, { 0x00000000, 0 },
+    { 0x004F00C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800F6, -2 }, { 0x00000000, 0 },
+    { 0x0050014F, -1 }, { 0x004D00DC, -1 }, { 0x00000000, 0 }, { 0x00C60061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B00F5, -1 }, { 0x012400E7, -1 },
+    { 0x01020076, -2 }, { 0x01210074, 1 }, { 0x014300E5, -1 }, { 0x016200E3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50106, -1 },
+    { 0x01220100, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00660125, 1 }, { 0x00C3011F, 1 }, { 0x00410041, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10138, -1 }, { 0x00DD00C3, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025201D, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0151, -1 }, { 0x017600D2, -1 },
+    { 0x007B006F, -1 }, { 0x01160065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410172, -2 }, { 0x0077201A, -2 },
+    { 0x00D900F5, -1 }, { 0x01390162, -1 }, { 0x017400EB, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014E2025, -2 }, { 0x01720104, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0170011D, -1 }, { 0x201E0063, -1 },
+    { 0x00000000, 0 }, { 0x012C003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014C00C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0108, -2 }, { 0x00550161, -1 },
+    { 0x010F0155, 1 }, { 0x00CE00E6, -1 }, { 0x012E0153, -1 }, { 0x016C014F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0121, -2 },
+    { 0x00000000, 0 }, { 0x01242018, -1 }, { 0x00500107, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019013A, -1 }, { 0x00000000, 0 }, { 0x002F0122, -1 }, { 0x00000000, 0 },
+    { 0x004B00AD, -1 }, { 0x0048003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000047, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01040146, -1 }, { 0x002800E1, -1 }, { 0x01230144, 1 }, { 0x00A10066, 1 },
+    { 0x00C00064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0048016B, -1 }, { 0x004500F8, -1 }, { 0x00670169, 1 },
+    { 0x00C100F0, -1 }, { 0x00C40163, -1 }, { 0x01780071, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000178, -3 }, { 0x00BF0109, -1 },
+    { 0x00D92026, -2 }, { 0x0155201E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DC0120, -1 }, { 0x00000000, 0 }, { 0x00D900AD, -1 }, { 0x00D6003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202600E8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013400C0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900E7, -2 },
+    { 0x00D500DF, -1 }, { 0x012F0066, 3 }, { 0x017000D5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570100, -3 }, { 0x013000F2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00C0, -4 }, { 0x00550119, -1 }, { 0x00D10111, -1 }, { 0x010F010D, 1 },
+    { 0x012E010B, -1 }, { 0x016C0107, -1 }, { 0x00000000, 0 }, { 0x201E014C, -1 },
+    { 0x00000000, 0 }, { 0x201B00D9, -1 }, { 0x016A0120, -1 }, { 0x20180066, -1 },
+    { 0x00000000, 0 }, { 0x0164003A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900F2, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0067, 1 }, { 0x004B0065, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004F0164, -1 }, { 0x00C800E9, -1 }, { 0x00000000, 0 }, { 0x00C50076, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011E201B, -1 }, { 0x012300FC, 1 }, { 0x0126016F, -1 },
+    { 0x014200FA, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670121, 1 },
+    { 0x00C4011B, -1 }, { 0x01020117, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0065013A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20262019, -3 },
+    { 0x00000000, 0 }, { 0x00C0014D, -1 }, { 0x004100E2, -1 }, { 0x00DC00D8, -1 },
+    { 0x00D90065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0042016E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01570175, 1 },
+    { 0x01540102, 1 }, { 0x01760173, -1 }, { 0x0056002C, -3 }, { 0x0075002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0152011B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01500134, -1 }, { 0x201D0078, -1 },
+    { 0x0071005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0104, 1 }, { 0x0056015D, -1 }, { 0x00000000, 0 },
+    { 0x007200E8, -1 }, { 0x00CC006F, -1 }, { 0x00CF00E2, -1 }, { 0x016A00D8, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C011D, -2 }, { 0x00000000, 0 },
+    { 0x014C0166, -1 }, { 0x00CD00FB, -1 }, { 0x012A00F5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0103002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2018014F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01640123, -1 },
+    { 0x004A00C2, -1 }, { 0x00280051, -1 }, { 0x00C30047, -1 }, { 0x01200041, -1 },
+    { 0x017D003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0150, -1 },
+    { 0x004B014E, -1 }, { 0x00C400D3, -1 }, { 0x00FF005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00490167, -1 }, { 0x00412013, -1 }, { 0x004600F4, -1 }, { 0x00C200EC, -1 },
+    { 0x010000E8, -1 }, { 0x013E00E4, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C30178, -3 }, { 0x01200172, -1 }, { 0x00C00105, -1 },
+    { 0x011D00FF, 1 }, { 0x015E016E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260058, 1 },
+    { 0x00DD011C, -1 }, { 0x00000000, 0 }, { 0x0172002C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0176012B, 1 }, { 0x00D800C2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202500FD, -2 }, { 0x00D9014E, -1 }, { 0x01360148, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0172015D, -1 }, { 0x005800FC, -1 },
+    { 0x00722019, 1 }, { 0x010F007D, 1 }, { 0x011200F0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560115, -2 }, { 0x012A2026, -1 }, { 0x201B0049, -1 }, { 0x0050002F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00D5, -1 }, { 0x20190062, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0127003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0161, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014700C4, -1 }, { 0x016600C2, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B017A, -1 }, { 0x20132026, -1 }, { 0x20180107, -2 }, { 0x203A0178, -1 },
+    { 0x00C900E5, -1 }, { 0x00000000, 0 }, { 0x0104006E, -1 }, { 0x0142006A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00462025, -2 }, { 0x002C0108, -1 }, { 0x004B0106, -1 }, { 0x00C2201D, -2 },
+    { 0x00E1201B, -1 }, { 0x01002019, -2 }, { 0x012400F8, -1 }, { 0x014300F6, -1 },
+    { 0x016200F4, -1 }, { 0x00000000, 0 }, { 0x00C50117, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0028013A, 2 },
+    { 0x004400C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00450151, -1 }, { 0x00C10149, -1 }, { 0x00DD00D4, -1 }, { 0x00DA0061, -1 },
+    { 0x01560059, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015700E5, -1 }, { 0x017600E3, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D42025, -2 }, { 0x00D90106, -1 },
+    { 0x01360100, 1 }, { 0x01580171, -1 }, { 0x016F201B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01720115, -1 }, { 0x00000000, 0 }, { 0x00550041, -2 }, { 0x016C002F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0074, -1 }, { 0x00D200C5, -1 }, { 0x011000C1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005400E6, -1 },
+    { 0x00000000, 0 }, { 0x012A0065, -1 }, { 0x01680061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0119, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005200FF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0132, -1 }, { 0x201800BF, -3 },
+    { 0x01622025, -3 }, { 0x00500118, -1 }, { 0x00000000, 0 }, { 0x00C6002A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019014B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E90127, -1 }, { 0x002C00C0, 1 },
+    { 0x00C40043, -1 }, { 0x0102003F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00460064, -1 }, { 0x00650062, -1 }, { 0x00C2005C, -4 },
+    { 0x01000058, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01040157, -1 }, { 0x002800F2, -1 }, { 0x006600EE, 1 }, { 0x00C00075, -1 },
+    { 0x00C300E8, -1 }, { 0x01230155, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C40174, -3 }, { 0x00450109, -1 }, { 0x00C10101, -1 }, { 0x00DB201E, -2 },
+    { 0x00FA201C, -1 }, { 0x01020170, -2 }, { 0x01762014, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0118, -1 },
+    { 0x00000000, 0 }, { 0x0154002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025006D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600F9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0150005C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900F8, -2 }, { 0x017000E6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570111, -2 },
+    { 0x01300103, -1 }, { 0x201C0045, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00D1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B00EA, -2 }, { 0x00000000, 0 }, { 0x005000D0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190103, -3 }, { 0x00000000, 0 }, { 0x002F00EB, -3 },
+    { 0x004E00E9, -1 }, { 0x004B0076, -1 }, { 0x00CA00E1, -1 }, { 0x00E6006C, -1 },
+    { 0x0105006A, 4 }, { 0x01620064, -1 }, { 0x00000000, 0 }, { 0x01280167, -1 },
+    { 0x00C32019, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C60113, -1 }, { 0x0104010F, -1 }, { 0x00000000, 0 },
+    { 0x00C0002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0178003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046014D, -1 },
+    { 0x00DE00D0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00440166, -1 }, { 0x004100F3, -1 }, { 0x00DC00E9, -1 }, { 0x00F80074, 1 },
+    { 0x011A00E5, -1 }, { 0x01360070, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0178016B, -1 }, { 0x00DA0102, -2 }, { 0x015600FA, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0123, 2 },
+    { 0x01160117, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D60134, -1 }, { 0x00D300C1, -1 }, { 0x013000BB, -1 }, { 0x010E004A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005500E2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0115, -1 }, { 0x00000000, 0 }, { 0x004E201A, -2 }, { 0x006D2018, -1 },
+    { 0x00CF00F3, -1 }, { 0x00D20166, -1 }, { 0x01100162, -1 }, { 0x016A00E9, -1 },
+    { 0x00000000, 0 }, { 0x201C012E, -1 }, { 0x00000000, 0 }, { 0x00D0017F, -1 },
+    { 0x01680102, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0147011D, -1 }, { 0x0166011B, -1 }, { 0x00C5003F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180160, -1 },
+    { 0x00000000, 0 }, { 0x002E0148, -1 }, { 0x00E8013C, -1 }, { 0x010400C7, -1 },
+    { 0x00280062, 2 }, { 0x00C30058, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B015F, -1 }, { 0x01240151, -1 },
+    { 0x00C400E4, -1 }, { 0x00C10071, -1 }, { 0x010200E0, -1 }, { 0x0143014F, -1 },
+    { 0x0162014D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50170, -2 },
+    { 0x00DC201A, -2 }, { 0x00460105, -1 }, { 0x00C200FD, -2 }, { 0x00FB2018, -1 },
+    { 0x010000F9, -1 }, { 0x0122016A, -1 }, { 0x01410168, -1 }, { 0x01600166, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004100AB, -1 },
+    { 0x00D9002E, -2 }, { 0x00F8002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD012D, 1 },
+    { 0x01780123, -1 }, { 0x01340041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01190142, -1 }, { 0x005C00DB, -1 }, { 0x0113005C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D9015F, -1 }, { 0x00552013, -1 }, { 0x011400E8, -1 }, { 0x01360159, -1 },
+    { 0x015200E4, -1 }, { 0x016E006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058010D, -1 }, { 0x01120101, -1 },
+    { 0x012C201E, -1 }, { 0x016A201A, -2 }, { 0x201D0041, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CF00AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00E6, -2 },
+    { 0x20190073, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0172, -1 }, { 0x2015201E, -1 },
+    { 0x201A00FF, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20180118, -1 }, { 0x0067201B, 1 }, { 0x002E0100, 1 },
+    { 0x00C42015, -1 }, { 0x00C900F6, -1 }, { 0x00CC0169, -1 }, { 0x01022011, -1 },
+    { 0x0123007D, 1 }, { 0x012600F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0119, -1 }, { 0x004B0117, -1 }, { 0x01240109, -1 }, { 0x01430107, -1 },
+    { 0x01620105, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410063, -1 }, { 0x01580051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD00E5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F5201B, -1 }, { 0x015700F6, -1 }, { 0x017600F4, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500C6, 1 }, { 0x00D90117, -1 }, { 0x01360111, -1 },
+    { 0x0155010F, -1 }, { 0x0174010D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005800C5, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590151, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CF0063, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D30162, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D012A, -1 }, { 0x00000000, 0 }, { 0x010F0177, 1 }, { 0x014A0100, -1 },
+    { 0x0164201D, 1 }, { 0x002D002C, -1 }, { 0x004C002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B0143, -1 }, { 0x201800D0, -1 }, { 0x0124203A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C6003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019015C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F0144, -1 }, { 0x00000000, 0 }, { 0x00C40054, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C80153, -1 }, { 0x004900E8, -1 },
+    { 0x00C2006D, -1 }, { 0x00C500E0, -1 }, { 0x01000069, -1 }, { 0x011F0067, 1 },
+    { 0x012200DA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040168, -2 },
+    { 0x00280103, -1 }, { 0x006600FF, 1 }, { 0x00C300F9, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01762025, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BB002C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041014C, -1 }, { 0x00000000, 0 },
+    { 0x017400C5, -3 }, { 0x00D6005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026010A, -1 }, { 0x00DA015B, -1 },
+    { 0x00000000, 0 }, { 0x005B00F0, -1 }, { 0x01120071, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C017C, 1 }, { 0x00590109, -2 }, { 0x00732026, -1 }, { 0x00D80174, -1 },
+    { 0x0154016C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570122, -1 }, { 0x00CE2039, -1 },
+    { 0x201C0056, -1 }, { 0x0070003A, -1 }, { 0x012A002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00E2, -3 }, { 0x201A006F, -1 },
+    { 0x010F012F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E016E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005000E1, -1 }, { 0x00000000, 0 }, { 0x002E0070, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190114, -1 }, { 0x00CD0165, -1 }, { 0x002F00FC, -1 }, { 0x00C52011, -1 },
+    { 0x00CA00F2, -1 }, { 0x0168015B, -1 }, { 0x2013002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C8010B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01040120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FE003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011E00C4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20110178, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000152, -1 }, { 0x00BF00E3, -1 },
+    { 0x011C00DD, -1 }, { 0x0119006A, 2 }, { 0x013B00DB, -1 }, { 0x015A00D9, -1 },
+    { 0x01760064, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C0016F, -1 },
+    { 0x00410104, 1 }, { 0x011A00F6, -1 }, { 0x011D0169, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0059203A, -1 }, { 0x00DA0113, -1 }, { 0x0118010F, -1 }, { 0x0178017C, -1 },
+    { 0x202600C2, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900C1, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250167, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540067, -1 }, { 0x014C0057, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005500F3, -1 }, { 0x00D100EB, -1 }, { 0x012E00E5, -1 },
+    { 0x016C00E1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0146201B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C013F, -1 }, { 0x201900CC, -1 }, { 0x00000000, 0 }, { 0x012A0117, -1 },
+    { 0x01680113, -1 }, { 0x002C0041, 1 }, { 0x0143002F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0159, -1 }, { 0x00C9014F, -1 }, { 0x010400D8, -1 }, { 0x0066006F, -1 },
+    { 0x00C30069, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0172, -2 }, { 0x0062201A, -1 }, { 0x006700FB, 1 },
+    { 0x00C400F5, -1 }, { 0x010200F1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0100010A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011D0121, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011B013A, -1 }, { 0x015600C3, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0157014F, -1 },
+    { 0x007B00EA, -1 }, { 0x011600E0, -1 }, { 0x015400DC, -1 }, { 0x01700067, -1 },
+    { 0x0176014D, -2 }, { 0x00000000, 0 }, { 0x2025011F, 1 }, { 0x00000000, 0 },
+    { 0x00F0201A, -1 }, { 0x010F2018, 2 }, { 0x015200F5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0058011E, -1 }, { 0x0172017F, -1 }, { 0x201D0052, -1 },
+    { 0x012B002A, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x012D0142, 2 }, { 0x005100DD, -1 }, { 0x0127005C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00520169, -1 }, { 0x00000000, 0 }, { 0x012800E8, -1 }, { 0x014700E6, -1 },
+    { 0x016600E4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0111, -1 }, { 0x00C90107, -1 },
+    { 0x01260101, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C400AD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C200C6, 1 }, { 0x010000C2, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C30152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1016B, -1 }, { 0x00420100, -1 },
+    { 0x00DD00F6, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB010F, -1 }, { 0x01570107, -1 }, { 0x01760105, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01360122, -1 }, { 0x0174011E, -1 }, { 0x00000000, 0 },
+    { 0x014F003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260163, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800D6, -1 },
+    { 0x015000C6, -1 }, { 0x00550063, -1 }, { 0x016C0051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01700150, -1 },
+    { 0x005600EF, 1 }, { 0x014E00DF, -1 }, { 0x00CF0074, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0130016D, -1 }, { 0x00D00100, -1 }, { 0x00EF00FE, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D013B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0071011F, 1 }, { 0x00CE0119, -1 },
+    { 0x014A0111, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B0154, -1 }, { 0x201800E1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019016D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F0155, -1 }, { 0x002C00E2, -1 }, { 0x004B00E0, -1 }, { 0x004E0153, -1 },
+    { 0x00C40065, -1 }, { 0x01020061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004C016C, -1 }, { 0x004900F9, -1 }, { 0x00C02010, -1 },
+    { 0x00C500F1, -1 }, { 0x011F0078, 1 }, { 0x013E0076, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01230177, 1 }, { 0x00C3010A, -1 },
+    { 0x01200104, -1 }, { 0x01420175, 1 }, { 0x0178201D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10123, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00620142, 1 }, { 0x00BF013C, -1 }, { 0x00D80054, -1 },
+    { 0x00DB00C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC0153, -1 }, { 0x00D900E0, -1 },
+    { 0x011A014F, -1 }, { 0x01520065, -1 }, { 0x017400D6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2026011B, -1 }, { 0x00000000, 0 }, { 0x01560164, -2 },
+    { 0x005B0101, -1 }, { 0x007A00FF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00542039, -1 }, { 0x01700108, -1 }, { 0x00000000, 0 }, { 0x00CF002C, -1 },
+    { 0x00EE002A, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0067, -2 }, { 0x016E0121, -1 }, { 0x005400C0, -2 },
+    { 0x00000000, 0 }, { 0x0168003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00F3, -3 }, { 0x0055014C, -1 }, { 0x00F00142, 1 },
+    { 0x005200D9, -1 }, { 0x00EA005C, -2 }, { 0x010F0140, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B010C, -1 }, { 0x00000000, 0 },
+    { 0x004B2011, -1 }, { 0x005000F2, -1 }, { 0x00CC00EA, -1 }, { 0x01260071, -1 },
+    { 0x0145006F, -1 }, { 0x016A0153, -1 }, { 0x00000000, 0 }, { 0x20190125, -1 },
+    { 0x00000000, 0 }, { 0x002F010D, -3 }, { 0x004E010B, -1 }, { 0x00CA0103, -1 },
+    { 0x0122201C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015D002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040131, -1 },
+    { 0x00000000, 0 }, { 0x00C300C2, 1 }, { 0x00440057, -1 }, { 0x00C0004F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C4014E, -1 }, { 0x004500E3, -1 }, { 0x00C100DB, -2 }, { 0x00DD0066, -1 },
+    { 0x011B0062, -1 }, { 0x01210148, 1 }, { 0x0178005C, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20167, -1 }, { 0x00BF00F4, -1 }, { 0x00D92011, -1 },
+    { 0x01000163, -1 }, { 0x01570077, 1 }, { 0x01760075, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410115, -1 },
+    { 0x00DC010B, -1 }, { 0x011A0107, -1 }, { 0x20250047, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600D3, -1 },
+    { 0x00000000, 0 }, { 0x0156011C, -1 }, { 0x00000000, 0 }, { 0x0112003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01350137, 1 }, { 0x005900D2, -1 }, { 0x013200C4, -1 },
+    { 0x00D20057, -1 }, { 0x017000C0, -2 }, { 0x00000000, 0 }, { 0x20250178, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700EB, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580177, -1 },
+    { 0x00550104, -2 }, { 0x00CC201B, -1 }, { 0x012E00F6, -1 }, { 0x016C00F2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B00C4, -3 }, { 0x0072011B, -1 }, { 0x00CF0115, -1 }, { 0x012C010F, -1 },
+    { 0x016A010B, -1 }, { 0x20180051, -1 }, { 0x00000000, 0 }, { 0x201C0150, -1 },
+    { 0x00000000, 0 }, { 0x201900DD, -1 }, { 0x00000000, 0 }, { 0x002F00C5, -2 },
+    { 0x004E00C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0169, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C00DC, -1 }, { 0x00000000, 0 }, { 0x00C50061, -1 }, { 0x01410059, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E016A, -2 }, { 0x004D0168, -1 }, { 0x010400E9, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01240173, -1 }, { 0x00C40106, -1 }, { 0x01020102, 1 },
+    { 0x013B201D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00650125, -1 },
+    { 0x00C2011F, 1 }, { 0x0100011B, -1 }, { 0x0157002F, -1 }, { 0x0176002D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00A1013A, -1 }, { 0x00C00138, -1 }, { 0x00DC00C3, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD014F, -2 }, { 0x015600D4, -1 }, { 0x005B0071, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0076201A, -2 }, { 0x005C00FD, -1 },
+    { 0x00000000, 0 }, { 0x01700078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014D2025, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0073002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0063, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016A00C3, -2 },
+    { 0x010A0056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0108, -1 }, { 0x00540161, -1 }, { 0x00000000, 0 },
+    { 0x00CD00E6, -1 }, { 0x012A00E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0121, 1 }, { 0x00000000, 0 },
+    { 0x004A2026, -2 }, { 0x00E5201C, -1 }, { 0x01232018, 1 }, { 0x012800F9, -1 },
+    { 0x016600F5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0122, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0120002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01620127, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010000D3, -1 }, { 0x00BF0064, -1 }, { 0x013B005C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C30163, -1 }, { 0x00000000, 0 }, { 0x00C000F0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011E0176, -1 }, { 0x00D82026, -2 }, { 0x00DD0107, -2 },
+    { 0x015900FF, 1 }, { 0x015C0172, -1 }, { 0x0173201C, -1 }, { 0x20260043, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0120, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D5003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500E8, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D600C6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260174, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800E7, -1 }, { 0x00D400DF, -1 },
+    { 0x010F0068, 3 }, { 0x012E0066, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590173, -1 }, { 0x00560100, -3 },
+    { 0x01700161, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00C0, -3 },
+    { 0x00540119, -1 }, { 0x01662026, -3 }, { 0x2019004D, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D014C, -2 }, { 0x00000000, 0 },
+    { 0x201A00D9, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201800F2, -2 }, { 0x00000000, 0 }, { 0x002E00DA, -2 },
+    { 0x016400C6, -2 }, { 0x01040059, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019017E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C00F3, -1 }, { 0x004B00F1, -1 }, { 0x00C40076, -2 }, { 0x01020072, -1 },
+    { 0x01210070, 1 }, { 0x012400E3, -1 }, { 0x014300E1, -1 }, { 0x00000000, 0 },
+    { 0x011D201B, 1 }, { 0x00C50102, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280125, 2 }, { 0x00660121, -1 },
+    { 0x00C3011B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20252019, -3 }, { 0x00000000, 0 },
+    { 0x00BF014D, -1 }, { 0x00DB00D8, -1 }, { 0x00000000, 0 }, { 0x01160061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0041016E, -2 }, { 0x00000000, 0 }, { 0x013600EB, -1 }, { 0x015500E9, -1 },
+    { 0x017400E7, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01102025, -2 }, { 0x01340104, -1 },
+    { 0x01560175, -1 }, { 0x0055002C, -2 }, { 0x01720100, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0059012B, 1 }, { 0x01700119, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0078, -1 }, { 0x010E00C5, -1 }, { 0x0070005C, -2 },
+    { 0x014C00C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0104, -4 }, { 0x0055015D, -1 }, { 0x012E014F, -1 }, { 0x00CE00E2, -1 },
+    { 0x00CB006F, -1 }, { 0x01470067, -1 }, { 0x01660065, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B011D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00500103, -1 }, { 0x00CC00FB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190136, -1 }, { 0x00000000, 0 },
+    { 0x002F011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0102002A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A00C4, -3 },
+    { 0x00C20047, -1 }, { 0x01000043, -1 }, { 0x013E003F, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002800DD, 1 }, { 0x004700DB, -1 }, { 0x00A10062, -1 }, { 0x00C300D3, -1 },
+    { 0x00FE005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480167, -1 },
+    { 0x004500F4, -1 }, { 0x00670165, 1 }, { 0x00C100EC, -1 }, { 0x01210159, 1 },
+    { 0x0159006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C20178, -3 }, { 0x01000174, -3 }, { 0x00BF0105, -1 }, { 0x013B00FD, -1 },
+    { 0x0155201A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250058, 1 }, { 0x00DC011C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600E4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005900E3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0052201B, -1 }, { 0x00000000, 0 }, { 0x016E00EA, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01500178, -1 }, { 0x00550115, -1 },
+    { 0x00D1010D, -1 }, { 0x012E0107, -1 }, { 0x004F002F, -1 }, { 0x016C0103, -1 },
+    { 0x00000000, 0 }, { 0x201E0148, -1 }, { 0x00000000, 0 }, { 0x201B00D5, -1 },
+    { 0x00000000, 0 }, { 0x016A011C, -1 }, { 0x00000000, 0 }, { 0x002E004A, 2 },
+    { 0x0126003A, -1 }, { 0x00000000, 0 }, { 0x201C0161, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F00D6, -1 }, { 0x00000000, 0 },
+    { 0x002C0063, -1 }, { 0x004B0061, -1 }, { 0x00000000, 0 }, { 0x20390178, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C800E5, -1 },
+    { 0x00000000, 0 }, { 0x00C50072, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1201D, -2 },
+    { 0x00E0201B, -1 }, { 0x010400FA, -1 }, { 0x0126016B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0067011D, 1 }, { 0x00C40117, -1 }, { 0x01020113, -1 },
+    { 0x00DD002F, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00149, -1 },
+    { 0x00DC00D4, -1 }, { 0x00000000, 0 }, { 0x00D90061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0042016A, -1 }, { 0x00592014, -1 }, { 0x011800E9, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D32025, -2 }, { 0x0176016F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0114011B, -1 },
+    { 0x01520117, -1 }, { 0x00540041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D100C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0100, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007200E4, -1 }, { 0x00500073, -1 },
+    { 0x016A00D4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0119, -2 }, { 0x00000000, 0 }, { 0x010E0166, -1 }, { 0x014C0162, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01612025, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C5002A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00E80127, -1 }, { 0x01450121, -1 }, { 0x00C30043, -1 },
+    { 0x0164011F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C014C, -1 }, { 0x00E60140, -1 }, { 0x00000000, 0 },
+    { 0x00450064, -1 }, { 0x00C1005C, -4 }, { 0x011E0056, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490163, -1 }, { 0x00000000, 0 },
+    { 0x004600F0, -1 }, { 0x00C200E8, -1 }, { 0x010000E4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30174, -3 },
+    { 0x00DA201E, -2 }, { 0x00C00101, -1 }, { 0x00F9201C, -1 }, { 0x011D00FB, 1 },
+    { 0x0120016E, -1 }, { 0x015E016A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0134002C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760127, 1 },
+    { 0x005C00C6, 1 }, { 0x01700041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500F9, -1 }, { 0x00000000, 0 },
+    { 0x01360144, -1 }, { 0x00000000, 0 }, { 0x014F005C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D002C, -4 }, { 0x00000000, 0 }, { 0x010F0079, 1 },
+    { 0x016C0073, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560111, -2 }, { 0x0168201E, -2 },
+    { 0x201B0045, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00D1, -1 }, { 0x01472039, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D015D, -2 }, { 0x00000000, 0 }, { 0x201A00EA, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014700C0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A0174, -1 }, { 0x00000000, 0 },
+    { 0x20180103, -2 }, { 0x00000000, 0 }, { 0x002E00EB, -1 }, { 0x00C900E1, -1 },
+    { 0x0104006A, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0104, 1 },
+    { 0x004B0102, 1 }, { 0x00C22019, -2 }, { 0x01002015, -1 }, { 0x012400F4, -1 },
+    { 0x014300F2, -1 }, { 0x016200F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0049011B, -1 }, { 0x00C50113, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004400C1, -1 }, { 0x00000000, 0 },
+    { 0x0177003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0045014D, -1 }, { 0x004200DA, -1 },
+    { 0x017800C6, -3 }, { 0x01560055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB00E9, -1 }, { 0x015700E1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0131201B, -1 }, { 0x00D90102, -2 }, { 0x011700FE, -1 }, { 0x013600FC, -1 },
+    { 0x0158016D, -1 }, { 0x017400F8, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007A0121, 1 }, { 0x01720111, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D50134, -1 },
+    { 0x00D200C1, -1 }, { 0x201E0070, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A201B, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005400E2, -1 }, { 0x00000000, 0 }, { 0x012A0061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0115, -3 },
+    { 0x00000000, 0 }, { 0x002E201C, -3 }, { 0x005200FB, -1 }, { 0x00CE00F3, -1 },
+    { 0x01470078, -1 }, { 0x014A00EB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B012E, -1 }, { 0x00000000, 0 }, { 0x01242025, -1 }, { 0x00500114, -1 },
+    { 0x00000000, 0 }, { 0x004A002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190147, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C4003F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012200C5, -1 }, { 0x00C20058, 1 },
+    { 0x01000054, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040153, -1 }, { 0x006600EA, -1 },
+    { 0x00C00071, -1 }, { 0x00C300E4, -1 }, { 0x015E00DA, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40170, -2 }, { 0x00DB201A, -2 },
+    { 0x00450105, -1 }, { 0x00C100FD, -2 }, { 0x00FA2018, -1 }, { 0x0102016C, -2 },
+    { 0x01762010, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE0114, -1 }, { 0x00000000, 0 }, { 0x00D8002E, -2 },
+    { 0x0116002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202600F5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005900F4, -2 }, { 0x017000E2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D60178, -1 }, { 0x0057010D, -2 }, { 0x201C0041, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00CD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CE00AB, -1 }, { 0x0166002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0159, -1 }, { 0x00000000, 0 }, { 0x201B00E6, -2 }, { 0x20180073, -2 },
+    { 0x005000CC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0172, -1 }, { 0x2014201E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F00E7, -3 }, { 0x004E00E5, -1 }, { 0x002C0074, -1 },
+    { 0x004B0072, -1 }, { 0x00E60068, -1 }, { 0x01050066, 3 }, { 0x01240064, -1 },
+    { 0x00000000, 0 }, { 0x0066201B, 1 }, { 0x00C32015, -1 }, { 0x00C800F6, -1 },
+    { 0x01280163, -1 }, { 0x01470161, -1 }, { 0x0166015F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C6010F, -1 },
+    { 0x0104010B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE00CC, -1 }, { 0x00000000, 0 },
+    { 0x0176004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440162, -1 }, { 0x004100EF, -1 },
+    { 0x00DC00E5, -1 }, { 0x011A00E1, -1 }, { 0x015800DD, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00592025, -3 },
+    { 0x00DD0171, -1 }, { 0x00F4201B, -1 }, { 0x013700F8, 1 }, { 0x01702013, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C011F, 2 }, { 0x01160113, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250152, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700C5, -3 },
+    { 0x00000000, 0 }, { 0x00D0004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580151, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CE0063, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0111, -1 }, { 0x00000000, 0 },
+    { 0x00D20162, -1 }, { 0x007200F5, -1 }, { 0x012C00E9, -1 }, { 0x016A00E5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C012A, -1 },
+    { 0x00000000, 0 }, { 0x0163201D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0128011B, -1 },
+    { 0x01470119, -1 }, { 0x01660117, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2018015C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0144, -1 }, { 0x010400C3, 1 }, { 0x0047005C, -1 }, { 0x00C30054, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B015B, -1 }, { 0x0124014D, -1 }, { 0x004800E8, -1 }, { 0x00C1006D, -1 },
+    { 0x00C400E0, -1 }, { 0x010200DC, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C5016C, -2 }, { 0x00460101, -1 },
+    { 0x00C200F9, -1 }, { 0x010000F5, -1 }, { 0x01220166, -1 }, { 0x013E00F1, 1 },
+    { 0x01410164, -1 }, { 0x01600162, -1 }, { 0x00000000, 0 }, { 0x01752025, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0129, 1 }, { 0x011B0125, -1 }, { 0x01590121, -1 },
+    { 0x0178011F, -1 }, { 0x20260065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0119013E, -1 }, { 0x015400C7, -1 },
+    { 0x00590064, -2 }, { 0x00D5005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2025010A, -1 }, { 0x00D9015B, -1 }, { 0x01360155, -1 },
+    { 0x011400E4, -1 }, { 0x0130006F, -1 }, { 0x015200E0, -1 }, { 0x01550153, -1 },
+    { 0x01740151, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580109, -1 }, { 0x00722026, -2 }, { 0x012C201A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560122, -1 }, { 0x00CD2039, -1 }, { 0x201B0056, -1 },
+    { 0x006F003A, -1 }, { 0x203A0054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00E2, -2 }, { 0x2019006F, -3 }, { 0x012D012D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D016E, -1 }, { 0x2015201A, -1 }, { 0x201A00FB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0163005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180114, -1 },
+    { 0x00CC0165, -1 }, { 0x002E00FC, -1 }, { 0x00C42011, -1 }, { 0x00C900F2, -1 },
+    { 0x01230079, 1 }, { 0x01420077, 1 }, { 0x014500EA, -1 }, { 0x016400E8, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0115, -1 }, { 0x004B0113, -1 },
+    { 0x01240105, -1 }, { 0x01430103, -1 }, { 0x01620101, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010000AD, -1 }, { 0x00FD003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0158004D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20100178, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00E1, -2 }, { 0x00000000, 0 },
+    { 0x0118006A, 2 }, { 0x01560066, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015700F2, -1 }, { 0x017600F0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500C2, 1 },
+    { 0x00D90113, -1 }, { 0x0136010D, -1 }, { 0x0155010B, -1 }, { 0x01740109, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026014E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005B0134, 1 }, { 0x005800C1, 1 }, { 0x01720122, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059014D, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00720065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005400F3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0126, -1 }, { 0x00000000, 0 },
+    { 0x0055017F, -1 }, { 0x0052010C, -1 }, { 0x010F0173, 1 }, { 0x012B00FE, 2 },
+    { 0x012E0171, -1 }, { 0x01642019, 1 }, { 0x00000000, 0 }, { 0x201B013F, -1 },
+    { 0x201800CC, -1 }, { 0x00000000, 0 }, { 0x20150059, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190158, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014300BB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C8014F, -1 }, { 0x004900E4, -1 }, { 0x00460071, -1 }, { 0x00C20069, -1 },
+    { 0x00C500DC, -2 }, { 0x01000065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01040164, -2 }, { 0x00C300F5, -1 }, { 0x00000000, 0 },
+    { 0x017A0076, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017E0175, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0174203A, -1 },
+    { 0x00BF0127, -1 }, { 0x00000000, 0 }, { 0x005C0047, -1 }, { 0x0116003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410148, -1 }, { 0x00000000, 0 }, { 0x013600C5, 1 }, { 0x017400C1, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260106, -1 }, { 0x00000000, 0 }, { 0x01180153, -1 }, { 0x00000000, 0 },
+    { 0x00580079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0178, -2 }, { 0x01540168, -1 },
+    { 0x00590105, -2 }, { 0x017000F3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0057011E, -1 }, { 0x016E010C, -1 }, { 0x005400AB, -1 }, { 0x201C0052, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00DE, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005200C4, 1 },
+    { 0x01470041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E016A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005000DD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190110, -1 }, { 0x00000000, 0 },
+    { 0x002F00F8, -3 }, { 0x004E00F6, -1 }, { 0x01240075, -1 }, { 0x01430073, -1 },
+    { 0x01620071, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C80107, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0104011C, -1 },
+    { 0x00C300AD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C100C6, 1 }, { 0x00DD0051, -1 }, { 0x011E00C0, -1 },
+    { 0x01780047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C20152, -1 }, { 0x0100014E, -1 }, { 0x00DE00DD, -2 }, { 0x01190066, 2 },
+    { 0x011C00D9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C0016B, -1 }, { 0x00410100, 1 }, { 0x00DC00F6, -1 },
+    { 0x011A00F2, -1 }, { 0x011D0165, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01780178, 1 }, { 0x00DA010F, -1 },
+    { 0x0118010B, -1 }, { 0x01512026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01540120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014E003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250163, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700D6, -1 }, { 0x016E00C4, -2 },
+    { 0x00540063, -1 }, { 0x010E0057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A2026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D100E7, -1 },
+    { 0x012E00E1, -1 }, { 0x00CE0074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0122, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00EE00FE, 2 }, { 0x012C00FA, -1 }, { 0x016A00F6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C013B, -1 }, { 0x00000000, 0 },
+    { 0x201900C8, -1 }, { 0x00510121, 2 }, { 0x00CD0119, -1 }, { 0x012A0113, -1 },
+    { 0x004B003B, -1 }, { 0x0168010F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0155, -1 },
+    { 0x010400D4, -1 }, { 0x0028006F, -1 }, { 0x0066006B, 1 }, { 0x00C30065, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C016E, -2 },
+    { 0x00000000, 0 }, { 0x004800F9, -1 }, { 0x00C400F1, -1 }, { 0x010200ED, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01410175, -1 }, { 0x00C2010A, -1 }, { 0x01000106, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00A10125, -1 },
+    { 0x00C00123, 1 }, { 0x011D011D, 1 }, { 0x00D9003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260076, -2 }, { 0x00DA00C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB0153, -1 }, { 0x007B00E6, -1 }, { 0x00590075, -1 },
+    { 0x015400D8, -1 }, { 0x01700063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2025011B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011400F5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D004E, -1 }, { 0x00000000, 0 }, { 0x00CE002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00DA, -2 },
+    { 0x201B0067, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0050004D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00F3, -2 }, { 0x00000000, 0 }, { 0x00EF0142, 2 }, { 0x012D013E, 2 },
+    { 0x00E9005C, -2 }, { 0x016800C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A010C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CB00EA, -1 }, { 0x012800E4, -1 }, { 0x014700E2, -1 }, { 0x016600E0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00AD0178, -1 },
+    { 0x002E010D, -1 }, { 0x00C90103, -1 }, { 0x0121201C, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015C002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C200C2, 1 }, { 0x00430057, -1 }, { 0x00DE004D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C3014E, -1 },
+    { 0x00000000, 0 }, { 0x00A100DD, -1 }, { 0x00410070, -1 }, { 0x00C000DB, -2 },
+    { 0x0177005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10167, -1 }, { 0x00000000, 0 }, { 0x00DD00F2, -2 }, { 0x01560077, -1 },
+    { 0x015900EA, -1 }, { 0x017800E8, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013B0178, -2 }, { 0x00DB010B, -1 }, { 0x01570103, -1 },
+    { 0x01760101, -2 }, { 0x0059002D, -1 }, { 0x01790174, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500D3, -1 }, { 0x0136011E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005800D2, -1 }, { 0x015000C2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0170014C, -1 }, { 0x005600EB, -2 }, { 0x011000DF, -1 },
+    { 0x00720076, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01300169, -1 }, { 0x00540104, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0137, -1 }, { 0x00000000, 0 }, { 0x201A00C4, 1 },
+    { 0x00CE0115, -1 }, { 0x014A010D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0150, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00500136, -1 }, { 0x002E00C5, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190169, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0151, -3 }, { 0x004E014F, -1 },
+    { 0x00670067, 1 }, { 0x00C40061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0168, -1 },
+    { 0x004900F5, -1 }, { 0x00C500ED, -1 }, { 0x01000076, -2 }, { 0x011F0074, 1 },
+    { 0x013E0072, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01040175, -2 }, { 0x00C30106, -1 }, { 0x01200100, -1 }, { 0x01230173, 1 },
+    { 0x01420171, 1 }, { 0x01782019, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1011F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0136, -1 },
+    { 0x00DB00C3, -2 }, { 0x005C0058, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410159, -1 },
+    { 0x00DC014F, -1 }, { 0x013600D6, -1 }, { 0x017400D2, -1 }, { 0x01140065, -1 },
+    { 0x01520061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260117, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013400EF, 1 }, { 0x017200EB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014C2025, -2 }, { 0x01700104, -2 },
+    { 0x201E004A, 2 }, { 0x0072002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016E011D, -1 }, { 0x201C0063, -2 }, { 0x00000000, 0 }, { 0x012A003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010F013C, 3 }, { 0x005200D5, -1 }, { 0x014A00C5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B0108, -1 }, { 0x00000000, 0 }, { 0x012C0153, -1 }, { 0x00CC00E6, -1 },
+    { 0x016A014F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190121, -3 }, { 0x00000000, 0 }, { 0x002F0109, -3 },
+    { 0x00492026, -1 }, { 0x004E0107, -1 }, { 0x00E4201C, -1 }, { 0x01222018, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046003A, -2 },
+    { 0x013E002A, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0104012D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01020146, -1 }, { 0x01210144, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20163, -1 },
+    { 0x00000000, 0 }, { 0x00BF00F0, -1 }, { 0x01760071, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410111, -1 }, { 0x00DC0107, -1 }, { 0x011A0103, -1 },
+    { 0x015800FF, -1 }, { 0x20250043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA0120, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D4003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D500C6, -1 }, { 0x013200C0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250174, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700E7, -2 }, { 0x00D300DF, -1 }, { 0x016E00D5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00580173, -1 }, { 0x00550100, -2 }, { 0x00D100F8, -1 },
+    { 0x012E00F2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00C0, -3 }, { 0x00720117, -1 },
+    { 0x00CF0111, -1 }, { 0x012C010B, -1 }, { 0x016A0107, -1 }, { 0x2018004D, -1 },
+    { 0x00000000, 0 }, { 0x201C014C, -1 }, { 0x00000000, 0 }, { 0x201900D9, -1 },
+    { 0x01680120, -1 }, { 0x002F00C1, -2 }, { 0x00000000, 0 }, { 0x0162003A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0165, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00490065, -1 }, { 0x01220057, -1 }, { 0x01410055, -1 }, { 0x2018017E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0166, -1 }, { 0x004D0164, -1 },
+    { 0x00C600E9, -1 }, { 0x00C30076, -2 }, { 0x010400E5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011C201B, -1 },
+    { 0x00C40102, 1 }, { 0x012100FC, 1 }, { 0x0124016F, -1 }, { 0x013B2019, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00460123, -1 }, { 0x00C2011B, -1 }, { 0x01000117, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DA00D8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01360177, -1 }, { 0x01550175, 1 }, { 0x00000000, 0 },
+    { 0x0054002C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00EB, -1 }, { 0x00000000, 0 },
+    { 0x014E0134, -1 }, { 0x201B0078, -1 }, { 0x006F005C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0104, -3 },
+    { 0x0054015D, -1 }, { 0x00000000, 0 }, { 0x00CD00E2, -1 }, { 0x00CA006F, -1 },
+    { 0x016800D8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A011D, 1 }, { 0x00520176, -2 }, { 0x00E52018, -1 }, { 0x012800F5, -1 },
+    { 0x014700F3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20180136, -1 }, { 0x00000000, 0 }, { 0x002E011E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0101002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01620123, -1 }, { 0x00000000, 0 }, { 0x00C10047, -1 },
+    { 0x011E0041, -1 }, { 0x017B003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50146, -1 }, { 0x00000000, 0 }, { 0x00C200D3, -1 },
+    { 0x00FD005C, -1 }, { 0x013B0058, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C000EC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10178, -3 },
+    { 0x011E0172, -1 }, { 0x00DD0103, -2 }, { 0x015C016E, -1 }, { 0x01732018, -1 },
+    { 0x017800F9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB011C, -1 }, { 0x00000000, 0 },
+    { 0x0151002E, -1 }, { 0x0170002C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500E4, -1 }, { 0x00000000, 0 }, { 0x0174012B, 1 },
+    { 0x00D600C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260170, -2 }, { 0x201E201C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005800E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0059016F, -1 }, { 0x0170015D, -1 }, { 0x203A002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540115, -1 }, { 0x01282026, -1 },
+    { 0x20190049, -1 }, { 0x004E002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0148, -1 }, { 0x00000000, 0 }, { 0x201A00D5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014700AB, -1 }, { 0x0125003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B0161, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00500147, -1 }, { 0x002E00D6, -1 }, { 0x014500C4, -1 }, { 0x01040055, -2 },
+    { 0x016400C2, -2 }, { 0x00000000, 0 }, { 0x2019017A, -1 }, { 0x20112026, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00670078, 1 }, { 0x00C40072, -1 }, { 0x0102006E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00442025, -2 }, { 0x00C0201D, -2 },
+    { 0x00DF201B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00280121, 2 }, { 0x0066011D, -1 }, { 0x00C30117, -1 }, { 0x00DC002F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004200C5, -1 }, { 0x00DD00BB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0147, -1 }, { 0x00DB00D4, -1 },
+    { 0x00000000, 0 }, { 0x01540059, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041016A, -2 },
+    { 0x00582014, -1 }, { 0x013600E7, -1 }, { 0x015500E5, -1 }, { 0x017400E3, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D22025, -2 }, { 0x01340100, -1 }, { 0x015300FE, -1 }, { 0x01560171, -1 },
+    { 0x016D201B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590127, 1 }, { 0x01700115, -1 },
+    { 0x00000000, 0 }, { 0x016A002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D000C5, -1 }, { 0x010E00C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0100, -4 }, { 0x00000000, 0 },
+    { 0x00D10151, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01280065, -1 },
+    { 0x01470063, -1 }, { 0x01660061, -1 }, { 0x00000000, 0 }, { 0x201B0119, -2 },
+    { 0x00530172, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190132, -1 }, { 0x00000000, 0 }, { 0x01602025, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C4002A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002A00C0, -3 }, { 0x00C20043, -1 }, { 0x0100003F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C0005C, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00480163, -1 }, { 0x01020157, -1 }, { 0x004500F0, -1 },
+    { 0x00C100E8, -1 }, { 0x00DD0073, -2 }, { 0x01210155, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20174, -3 }, { 0x00D9201E, -2 },
+    { 0x00BF0101, -1 }, { 0x00F8201C, -1 }, { 0x01000170, -2 }, { 0x01742014, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410122, -1 }, { 0x20250054, -1 }, { 0x00000000, 0 }, { 0x005A003A, -1 },
+    { 0x0152002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202600E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0152, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014E005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700F8, -2 }, { 0x013000EA, -1 }, { 0x016E00E6, -1 }, { 0x201C002C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01500174, -1 }, { 0x00550111, -1 }, { 0x00D10109, -1 }, { 0x012E0103, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0144, -1 }, { 0x201B00D1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C015D, -2 }, { 0x00000000, 0 }, { 0x201900EA, -3 }, { 0x00000000, 0 },
+    { 0x002F00D2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0176, -2 }, { 0x20390174, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C800E1, -1 }, { 0x00000000, 0 }, { 0x00C5006E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0177, -2 }, { 0x004A0102, -1 }, { 0x00C12019, -2 },
+    { 0x010400F6, -1 }, { 0x01260167, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0048011B, -1 },
+    { 0x00C40113, -1 }, { 0x0102010F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0176003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004100DA, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420166, -1 }, { 0x00592010, -1 },
+    { 0x00DA00E9, -1 }, { 0x011800E5, -1 }, { 0x01780152, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0130201B, -1 },
+    { 0x005C010A, -1 }, { 0x00D80102, -1 }, { 0x015400FA, -1 }, { 0x0176016B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D1203A, -1 }, { 0x01140117, -1 }, { 0x01520113, -1 }, { 0x00000000, 0 },
+    { 0x0073003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D40134, -1 }, { 0x00D100C1, -1 },
+    { 0x00520056, -2 }, { 0x012E00BB, -1 }, { 0x201D0070, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E00FC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007200E0, -1 }, { 0x0050006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0115, -2 }, { 0x00000000, 0 },
+    { 0x00D00166, -1 }, { 0x00CD00F3, -1 }, { 0x010E0162, -1 }, { 0x016800E9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01232025, -1 }, { 0x01470104, -1 }, { 0x01660102, -2 },
+    { 0x0049002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180147, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0145011D, -1 },
+    { 0x0164011B, -1 }, { 0x00C3003F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0148, -1 },
+    { 0x004B0146, -1 }, { 0x00E6013C, -1 }, { 0x00C10058, 1 }, { 0x010200C7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50157, -1 }, { 0x00C200E4, -1 }, { 0x00BF0071, -1 },
+    { 0x010000E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00470178, -1 }, { 0x00C30170, -2 }, { 0x00C000FD, -2 },
+    { 0x00DA201A, -2 }, { 0x00F92018, -1 }, { 0x0120016A, -1 }, { 0x015E0166, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0178010A, -1 }, { 0x00000000, 0 }, { 0x00F6002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01760123, -1 }, { 0x005C00C2, 1 }, { 0x0059004F, -1 },
+    { 0x01320041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202500F5, -1 }, { 0x00000000, 0 }, { 0x01170142, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800F4, -1 },
+    { 0x011200E8, -1 }, { 0x010F0075, 1 }, { 0x016C006F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D50178, -1 },
+    { 0x0056010D, -2 }, { 0x012A201E, -1 }, { 0x0149201C, -1 }, { 0x0168201A, -2 },
+    { 0x201B0041, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00CD, -1 }, { 0x2019005A, -1 }, { 0x00000000, 0 }, { 0x00CD00AB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0159, -1 },
+    { 0x00000000, 0 }, { 0x201A00E6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004C0059, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B0172, -1 }, { 0x2013201E, -1 }, { 0x00000000, 0 }, { 0x00500158, -1 },
+    { 0x002E00E7, -1 }, { 0x00000000, 0 }, { 0x01040066, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F0173, -1 }, { 0x002C0100, 1 }, { 0x0046201D, 1 }, { 0x00C22015, -1 },
+    { 0x01002011, -1 }, { 0x0121007D, 1 }, { 0x012400F0, -1 }, { 0x017E0077, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490117, -1 }, { 0x00C5010F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017800C2, -3 }, { 0x01560051, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE0158, -1 }, { 0x00DB00E5, -1 }, { 0x005C007A, 1 },
+    { 0x0135006C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00582025, -1 }, { 0x00F3201B, -1 },
+    { 0x013600F8, -1 }, { 0x015500F6, -1 }, { 0x01580169, -1 }, { 0x017400F4, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007A011D, 1 }, { 0x0172010D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005600C5, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570151, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CD0063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0111, -3 }, { 0x00000000, 0 }, { 0x002E2018, -3 },
+    { 0x014A00E7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B012A, -1 }, { 0x00000000, 0 },
+    { 0x0162201D, 1 }, { 0x00500110, -1 }, { 0x00000000, 0 }, { 0x004A002A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190143, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C500C7, -1 }, { 0x00C20054, -2 }, { 0x012200C1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C60153, -1 }, { 0x002800EA, -1 }, { 0x006600E6, -1 }, { 0x00C0006D, -1 },
+    { 0x00C300E0, -1 }, { 0x0104014F, -1 }, { 0x011D0067, 1 }, { 0x012000DA, -1 },
+    { 0x0142014B, 1 }, { 0x00C4016C, -2 }, { 0x00450101, -1 }, { 0x00C100F9, -1 },
+    { 0x01020168, -2 }, { 0x0178007A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01742025, -3 }, { 0x00DE0110, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410133, -1 },
+    { 0x20250065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0152003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600F1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017200C5, -2 }, { 0x00580064, -1 },
+    { 0x00D4005C, -1 }, { 0x01500054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B0161, -1 }, { 0x00000000, 0 }, { 0x005900F0, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D60174, -1 }, { 0x00570109, -2 },
+    { 0x00712026, -1 }, { 0x013000FB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00C9, -1 },
+    { 0x00550122, -1 }, { 0x00CC2039, -1 }, { 0x201A0056, -3 }, { 0x006E003A, -1 },
+    { 0x0128002E, -1 }, { 0x0147002C, -2 }, { 0x0166002A, 2 }, { 0x201E0155, -1 },
+    { 0x201B00E2, -2 }, { 0x2018006F, -2 }, { 0x00000000, 0 }, { 0x005000C8, -1 },
+    { 0x002E0057, -3 }, { 0x004D0055, -1 }, { 0x00000000, 0 }, { 0x201C016E, -1 },
+    { 0x2014201A, -1 }, { 0x201900FB, -1 }, { 0x00000000, 0 }, { 0x002F00E3, -3 },
+    { 0x004E00E1, -1 }, { 0x002C0070, -1 }, { 0x004B006E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0147015D, -1 },
+    { 0x006B00F8, 1 }, { 0x00C32011, -1 }, { 0x00C800F2, -1 }, { 0x01410077, -1 },
+    { 0x0166015B, -1 }, { 0x2011002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C6010B, -1 }, { 0x00FF2026, -2 }, { 0x01040107, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01020120, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE00C8, -1 }, { 0x011C00C4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004100EB, -1 }, { 0x00DC00E1, -1 }, { 0x013900DB, -1 },
+    { 0x015800D9, -1 }, { 0x01740064, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD016D, -1 }, { 0x011800F6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057203A, -1 }, { 0x007B0119, -1 },
+    { 0x0116010F, -1 }, { 0x0176017C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2025014E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700C1, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0058014D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E010D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CF00EB, -1 },
+    { 0x012C00E5, -1 }, { 0x016A00E1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0126, -1 }, { 0x00000000, 0 }, { 0x0144201B, -1 },
+    { 0x01632019, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01280117, -1 }, { 0x01470115, -1 }, { 0x002A0041, -3 },
+    { 0x01660113, -1 }, { 0x20140059, -1 }, { 0x00000000, 0 }, { 0x20180158, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0159, -1 }, { 0x004B0157, -1 },
+    { 0x004800E4, -1 }, { 0x00450071, -1 }, { 0x00C10069, -1 }, { 0x00C400DC, -2 },
+    { 0x010200D8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0041201C, -3 }, { 0x00C200F5, -1 }, { 0x00C50168, -2 }, { 0x010000F1, -1 },
+    { 0x01220162, -1 }, { 0x013E00ED, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0159011D, -1 },
+    { 0x0178011B, -2 }, { 0x20260061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0119013A, -1 }, { 0x005C00D3, -1 }, { 0x015400C3, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250106, -1 },
+    { 0x00000000, 0 }, { 0x01360151, -1 }, { 0x011400E0, -1 }, { 0x0155014F, -1 },
+    { 0x016E0067, -1 }, { 0x0174014D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CF201C, -1 }, { 0x00580105, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00C5, 1 }, { 0x0056011E, -1 },
+    { 0x0170017F, -1 }, { 0x201B0052, -1 }, { 0x0129002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00DE, -1 },
+    { 0x2019006B, -1 }, { 0x00EF012D, 1 }, { 0x012D0129, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D016A, -1 },
+    { 0x00000000, 0 }, { 0x00520150, -1 }, { 0x012B0142, 2 }, { 0x004F00DD, -1 },
+    { 0x0125005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20180110, -1 }, { 0x00000000, 0 }, { 0x002E00F8, -1 },
+    { 0x012600E8, -1 }, { 0x01040077, -2 }, { 0x01230075, 1 }, { 0x014500E6, -1 },
+    { 0x016400E4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0111, -1 }, { 0x004B010F, -1 }, { 0x01240101, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50120, -1 }, { 0x00000000, 0 }, { 0x00C200AD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C000C6, 1 }, { 0x00DC0051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10152, -1 },
+    { 0x00000000, 0 }, { 0x00DD00DD, 1 }, { 0x01180066, 2 }, { 0x017800D3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB00F6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D9010F, -1 }, { 0x01360109, -1 },
+    { 0x01502026, -2 }, { 0x01550107, -1 }, { 0x01740105, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0172011E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014D003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005600D6, -1 }, { 0x014E00C6, -1 }, { 0x00720061, -1 },
+    { 0x016A0051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016E0150, -1 }, { 0x00000000, 0 }, { 0x014C00DF, -1 },
+    { 0x00CD0074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0122, -2 }, { 0x00000000, 0 }, { 0x010F016F, 1 }, { 0x00520108, -1 },
+    { 0x012E016D, -1 }, { 0x014A00F8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B013B, -1 }, { 0x00000000, 0 }, { 0x201800C8, -1 },
+    { 0x00500121, -1 }, { 0x00CC0119, -1 }, { 0x00000000, 0 }, { 0x004A003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190154, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B00C7, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004900E0, -1 },
+    { 0x0065006B, -1 }, { 0x00C20065, -1 }, { 0x00C500D8, -1 }, { 0x01000061, -1 },
+    { 0x013E005D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C300F1, -1 }, { 0x00000000, 0 }, { 0x011D0078, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01210177, 1 }, { 0x00C1010A, -1 }, { 0x011E0104, -1 }, { 0x0176201D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0123, 1 }, { 0x00000000, 0 },
+    { 0x005C0043, -1 }, { 0x00D8003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410144, -1 },
+    { 0x00D900C7, -1 }, { 0x005A005C, -1 }, { 0x00D60054, -1 }, { 0x013600C1, 1 },
+    { 0x20250076, -2 }, { 0x00000000, 0 }, { 0x20260102, 1 }, { 0x00000000, 0 },
+    { 0x00DA0153, -1 }, { 0x005B00E8, -1 }, { 0x00580075, -1 }, { 0x0118014F, -1 },
+    { 0x017200D6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0174, -3 }, { 0x0073201E, -1 }, { 0x00590101, -2 }, { 0x01540164, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00522039, -1 }, { 0x016E0108, -1 },
+    { 0x201C004E, -1 }, { 0x00CD002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00DA, -1 }, { 0x201A0067, 1 },
+    { 0x010F0127, 3 }, { 0x005200C0, 1 }, { 0x016C0121, -1 }, { 0x0166003B, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0166, -1 }, { 0x201B00F3, -2 },
+    { 0x00000000, 0 }, { 0x00EE0142, 2 }, { 0x005000D9, -1 }, { 0x00E8005C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019010C, -2 }, { 0x00000000, 0 }, { 0x002F00F4, -3 }, { 0x004E00F2, -1 },
+    { 0x00CA00EA, -1 }, { 0x01240071, -1 }, { 0x0143006F, -1 }, { 0x01680153, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0120201C, -1 },
+    { 0x00C80103, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015B002C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01020131, -1 }, { 0x00000000, 0 }, { 0x00C100C2, 1 },
+    { 0x00420057, -2 }, { 0x01780043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2014E, -1 }, { 0x011F0148, 1 },
+    { 0x00BF00DB, -1 }, { 0x00DE00D9, -1 }, { 0x01190062, -1 }, { 0x013E0146, 1 },
+    { 0x0176005C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00167, -1 },
+    { 0x004100FC, -1 }, { 0x00DC00F2, -1 }, { 0x01360079, -1 }, { 0x01550077, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD017E, -1 }, { 0x00DA010B, -1 }, { 0x01180107, -1 }, { 0x00000000, 0 },
+    { 0x0058002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0154011C, -1 },
+    { 0x00000000, 0 }, { 0x0110003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700D2, -1 }, { 0x016E00C0, -2 }, { 0x00D00057, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005500EB, -1 }, { 0x00D100E3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E011E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CF00FC, -1 }, { 0x012C00F6, -1 },
+    { 0x016A00F2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900C4, -4 }, { 0x0051011D, 2 },
+    { 0x00CD0115, -1 }, { 0x012A010F, -1 }, { 0x0168010B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0151, -1 }, { 0x00000000, 0 }, { 0x0028006B, 2 },
+    { 0x00660067, -1 }, { 0x00C30061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C016A, -2 }, { 0x004800F5, -1 },
+    { 0x00C400ED, -1 }, { 0x010200E9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0139201D, -1 },
+    { 0x00C20106, -1 }, { 0x01000102, 1 }, { 0x013E00FE, 3 }, { 0x0158201B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C0011F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0155002F, -1 }, { 0x0174002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260072, -1 }, { 0x00DA00C3, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB014F, -1 },
+    { 0x007B00E2, -1 }, { 0x00590071, -2 }, { 0x015400D4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250117, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E0078, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D004A, -1 }, { 0x00000000, 0 },
+    { 0x0071002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E00D6, -1 }, { 0x00000000, 0 }, { 0x012F0121, 1 },
+    { 0x201B0063, -2 }, { 0x00500049, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00EF013E, 2 }, { 0x012D013A, 2 }, { 0x002F0064, -3 }, { 0x01080056, -1 },
+    { 0x016800C3, -2 }, { 0x00000000, 0 }, { 0x201D017B, -1 }, { 0x201A0108, -1 },
+    { 0x00000000, 0 }, { 0x014A0151, -1 }, { 0x00CB00E6, -1 }, { 0x012800E0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180121, -2 }, { 0x00000000, 0 }, { 0x002E0109, -1 }, { 0x00482026, -1 },
+    { 0x00E3201C, -1 }, { 0x01212018, 1 }, { 0x012600F9, -1 }, { 0x016400F5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0122, -1 },
+    { 0x004B0120, -1 }, { 0x00000000, 0 }, { 0x0045003A, -1 }, { 0x00FF002E, -2 },
+    { 0x011E002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50131, -1 }, { 0x00000000, 0 }, { 0x004600C6, -2 }, { 0x00DE0049, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004400DF, -1 },
+    { 0x0139005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10163, -1 }, { 0x00000000, 0 },
+    { 0x00DD00EE, 1 }, { 0x015900E6, -1 }, { 0x017800E4, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011C0176, -1 },
+    { 0x00D62026, -2 }, { 0x00DB0107, -1 }, { 0x013B0174, -2 }, { 0x015700FF, 1 },
+    { 0x015A0172, -1 }, { 0x0171201C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D90120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D3003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D400C6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005600E7, -2 }, { 0x00D200DF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01300165, -1 }, { 0x00540100, -2 }, { 0x016E0161, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0133, -1 },
+    { 0x00000000, 0 }, { 0x201A00C0, 1 }, { 0x00CE0111, -1 }, { 0x014A0109, -1 },
+    { 0x01642026, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B014C, -1 }, { 0x00000000, 0 }, { 0x201800D9, -1 }, { 0x00500132, -1 },
+    { 0x002E00C1, 1 }, { 0x00000000, 0 }, { 0x0161003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F014D, -3 }, { 0x002C00DA, -2 }, { 0x004B00D8, -1 }, { 0x00480065, -1 },
+    { 0x01020059, -3 }, { 0x016200C6, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004C0164, -1 }, { 0x00C500E9, -1 }, { 0x00000000, 0 },
+    { 0x00C20076, -2 }, { 0x01000072, -1 }, { 0x011F0070, 1 }, { 0x013E006E, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040171, -1 }, { 0x0028010C, -1 },
+    { 0x00C30102, 1 }, { 0x0123016F, 1 }, { 0x0142016D, 1 }, { 0x01782015, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C1011B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0134, 3 }, { 0x00DE0132, -1 }, { 0x005C0054, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410155, -1 }, { 0x00D900D8, -1 },
+    { 0x013600D2, -1 }, { 0x01140061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260113, -1 }, { 0x00000000, 0 }, { 0x00BB0166, -1 },
+    { 0x017200E7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010E2025, -2 }, { 0x01320104, -1 }, { 0x01540175, -1 }, { 0x0053002C, -1 },
+    { 0x01700100, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014A203A, -1 }, { 0x0057012B, 1 }, { 0x016E0119, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00EB, -3 }, { 0x00000000, 0 }, { 0x010F0138, 1 },
+    { 0x014A00C1, -1 }, { 0x006E005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0177, -2 }, { 0x201B0104, -3 }, { 0x00000000, 0 },
+    { 0x012C014F, -1 }, { 0x005000EA, -1 }, { 0x002E0079, -2 }, { 0x00C9006F, -1 },
+    { 0x00CC00E2, -1 }, { 0x01450067, -1 }, { 0x01640065, -1 }, { 0x2019011D, -3 },
+    { 0x00510176, -1 }, { 0x00E42018, -1 }, { 0x002F0105, -3 }, { 0x004E0103, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0100002A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01040129, -1 }, { 0x004700C2, -1 }, { 0x00C00047, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C40146, -1 }, { 0x00000000, 0 }, { 0x00C100D3, -1 }, { 0x00FC005C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011F0159, 1 }, { 0x013E0157, 1 }, { 0x00000000, 0 },
+    { 0x0157006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00178, -3 }, { 0x0041010D, -1 },
+    { 0x00DC0103, -1 }, { 0x013900FD, -1 }, { 0x015800FB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DA011C, -1 }, { 0x00000000, 0 }, { 0x0150002E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D500C2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250170, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700E3, -2 },
+    { 0x00000000, 0 }, { 0x012D0062, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058016F, -1 },
+    { 0x00D100F4, -1 }, { 0x016C00EA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014E0178, -1 }, { 0x00720113, -1 }, { 0x00CF010D, -1 }, { 0x012C0107, -1 },
+    { 0x016A0103, -1 }, { 0x20180049, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201900D5, -2 }, { 0x00000000, 0 }, { 0x004E00BB, -1 },
+    { 0x0168011C, -1 }, { 0x002C004A, 2 }, { 0x0124003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490061, -1 }, { 0x00C50059, -3 },
+    { 0x00000000, 0 }, { 0x2018017A, -1 }, { 0x20102026, -1 }, { 0x00000000, 0 },
+    { 0x002E0162, -1 }, { 0x00C600E5, -1 }, { 0x010400E1, -1 }, { 0x00C30072, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0124016B, -1 }, { 0x010200FA, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046011F, -1 },
+    { 0x00C20117, -1 }, { 0x01000113, -1 }, { 0x00DB002F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004100C5, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA00D4, -1 }, { 0x007A0067, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00572014, -1 }, { 0x007B00F3, -1 },
+    { 0x011600E9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D12025, -2 },
+    { 0x00F80177, 1 }, { 0x01360173, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0112011B, -1 }, { 0x00000000, 0 }, { 0x00520041, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E00E7, -1 }, { 0x00000000, 0 }, { 0x01100134, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0100, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016800D4, -1 }, { 0x002F0075, -1 }, { 0x004E0073, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0119, -1 }, { 0x00520172, -1 },
+    { 0x004A201E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180132, -1 },
+    { 0x00000000, 0 }, { 0x015F2025, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C3002A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0131, -1 }, { 0x00E60127, -1 },
+    { 0x01430121, -1 }, { 0x00C10043, -1 }, { 0x0162011F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011C0056, -1 }, { 0x013B0054, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C000E8, -1 }, { 0x00DC0073, -1 },
+    { 0x011A006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10174, -3 }, { 0x00D8201E, -2 }, { 0x011E016E, -1 },
+    { 0x015C016A, -1 }, { 0x017800F5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059003A, -1 }, { 0x0132002C, -2 },
+    { 0x0151002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500E0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E0041, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E2018, -3 },
+    { 0x2026016C, -2 }, { 0x00000000, 0 }, { 0x01530142, -1 }, { 0x00000000, 0 },
+    { 0x00D10064, -1 }, { 0x014D005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059016B, -1 }, { 0x005600F8, -2 },
+    { 0x201B002C, -3 }, { 0x016A0073, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540111, -1 }, { 0x0166201E, -3 }, { 0x20190045, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0144, -1 },
+    { 0x00000000, 0 }, { 0x01452039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B015D, -2 },
+    { 0x00000000, 0 }, { 0x201800EA, -2 }, { 0x00500143, -1 }, { 0x002E00D2, -1 },
+    { 0x014500C0, -1 }, { 0x01040051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190176, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C00EB, -1 }, { 0x004B00E9, -1 }, { 0x00670074, 1 }, { 0x00C4006E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C0175, -1 }, { 0x002A0104, -3 }, { 0x00C02019, -2 }, { 0x00C500FA, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0028011D, 2 }, { 0x00660119, -1 },
+    { 0x00C30113, -1 }, { 0x01782026, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004200C1, -1 }, { 0x017800AD, -1 }, { 0x0175003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE0143, -1 }, { 0x00000000, 0 }, { 0x017600C6, -3 }, { 0x007B0063, -1 },
+    { 0x01540055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410166, -2 }, { 0x00582010, -1 }, { 0x00D900E9, -1 },
+    { 0x013600E3, -1 }, { 0x015500E1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0156016D, -1 }, { 0x011500FE, -1 },
+    { 0x017200F8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590123, -1 }, { 0x01700111, -1 }, { 0x201E0057, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D30134, -1 }, { 0x00D000C1, -1 }, { 0x00510056, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00FC, -1 }, { 0x00000000, 0 }, { 0x00D1014D, -1 }, { 0x010F0149, 1 },
+    { 0x00000000, 0 }, { 0x01280061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B0115, -2 }, { 0x0053016E, -1 }, { 0x002C201C, -3 },
+    { 0x00CC00F3, -1 }, { 0x00000000, 0 }, { 0x01450078, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019012E, -1 }, { 0x00000000, 0 },
+    { 0x01222025, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0048002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C2003F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01230138, 1 },
+    { 0x002800D5, -1 }, { 0x00C00058, 1 }, { 0x012000C5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C40157, -1 }, { 0x00C100E4, -1 }, { 0x00DD006F, -2 }, { 0x01020153, -1 },
+    { 0x011B006B, -1 }, { 0x01590067, -1 }, { 0x015C00DA, -1 }, { 0x01780065, -2 },
+    { 0x00C20170, -2 }, { 0x00D9201A, -2 }, { 0x00F82018, -1 }, { 0x0100016C, -2 },
+    { 0x01362014, -1 }, { 0x01742010, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041011E, -1 }, { 0x0158010C, -1 },
+    { 0x00000000, 0 }, { 0x00D6002E, -2 }, { 0x00F5002C, -1 }, { 0x0114002A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600DC, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C014E, -1 }, { 0x01350140, 1 }, { 0x00000000, 0 }, { 0x0110005C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00522013, -1 }, { 0x005700F4, -2 },
+    { 0x013000E6, -1 }, { 0x016E00E2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D40178, -1 }, { 0x0055010D, -1 },
+    { 0x00AD2026, -1 }, { 0x00D10105, -1 }, { 0x0148201C, -1 }, { 0x201A0041, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00CD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CC00AB, -1 }, { 0x0164002E, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201900E6, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0172, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0173, -1 },
+    { 0x00C12015, -1 }, { 0x00C600F6, -1 }, { 0x010400F2, -1 }, { 0x01260163, -1 },
+    { 0x01450161, -1 }, { 0x0164015F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00480117, -1 }, { 0x00C4010F, -1 }, { 0x0102010B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004100D6, -1 }, { 0x015800C4, 1 }, { 0x0174004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00420162, -1 }, { 0x00DA00E5, -1 }, { 0x011800E1, -1 }, { 0x015600DD, -2 },
+    { 0x0178014E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00572025, -3 }, { 0x005C0106, -1 }, { 0x00F2201B, -1 },
+    { 0x016E2013, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01140113, -1 },
+    { 0x0152010F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D006C, -1 }, { 0x005500C5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00F8, -1 },
+    { 0x00000000, 0 }, { 0x00560151, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CC0063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0111, -2 }, { 0x00000000, 0 }, { 0x00D00162, -1 }, { 0x012A00E9, -1 },
+    { 0x016800E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01470100, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180143, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0126011B, -1 }, { 0x01450119, -1 }, { 0x01640117, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0144, -1 }, { 0x00C400C7, -1 },
+    { 0x00C10054, -2 }, { 0x010200C3, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50153, -1 },
+    { 0x004600E8, -1 }, { 0x00C200E0, -1 }, { 0x010000DC, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280176, 1 },
+    { 0x00470174, -1 }, { 0x00C000F9, -1 }, { 0x00C3016C, -2 }, { 0x01200166, -1 },
+    { 0x015E0162, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01780106, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01190125, -1 },
+    { 0x01570121, -1 }, { 0x0176011F, -1 }, { 0x0151003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500F1, -1 }, { 0x00000000, 0 },
+    { 0x0117013E, -1 }, { 0x00000000, 0 }, { 0x00570064, -2 }, { 0x00D3005C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01720151, -1 }, { 0x005800F0, -1 }, { 0x011200E4, -1 },
+    { 0x012E006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0059017C, -1 }, { 0x00560109, -2 }, { 0x00702026, -1 },
+    { 0x00D50174, -1 }, { 0x012A201A, -1 }, { 0x01492018, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00C9, -1 }, { 0x20190056, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006D003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0155, -1 }, { 0x201A00E2, -1 },
+    { 0x00000000, 0 }, { 0x012B012D, 1 }, { 0x00000000, 0 }, { 0x004C0055, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B016E, -1 }, { 0x2013201A, -1 },
+    { 0x00000000, 0 }, { 0x00500154, -1 }, { 0x002E00E3, -1 }, { 0x00000000, 0 },
+    { 0x0161005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F016F, -1 }, { 0x002C00FC, -1 },
+    { 0x00462019, 1 }, { 0x004B00FA, -1 }, { 0x00C22011, -1 }, { 0x01210079, 1 },
+    { 0x014300EA, -1 }, { 0x016200E8, -1 }, { 0x2010002E, -1 }, { 0x00000000, 0 },
+    { 0x00490113, -1 }, { 0x00C5010B, -1 }, { 0x00FE2026, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BB0057, -1 }, { 0x0156004D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0154, -1 },
+    { 0x00DB00E1, -1 }, { 0x00000000, 0 }, { 0x005C0076, -1 }, { 0x01350068, 1 },
+    { 0x01540066, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410177, -2 }, { 0x013600F4, -1 }, { 0x015500F2, -1 }, { 0x017400F0, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0056203A, -1 }, { 0x005B011B, -1 }, { 0x01720109, -1 },
+    { 0x00000000, 0 }, { 0x010F0029, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01700122, -1 },
+    { 0x005600C1, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0057014D, -2 }, { 0x00000000, 0 }, { 0x00510067, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D010D, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CE00EB, -1 }, { 0x014A00E3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B0126, -1 }, { 0x00000000, 0 }, { 0x012C0171, -1 }, { 0x012900FE, 1 },
+    { 0x01622019, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019013F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20130059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500C3, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C6014F, -1 }, { 0x002800E6, -1 },
+    { 0x006600E2, -1 }, { 0x00A1006B, -1 }, { 0x00C00069, -1 }, { 0x00C300DC, -2 },
+    { 0x0104014B, -1 }, { 0x01230149, 1 }, { 0x00000000, 0 }, { 0x00C40168, -2 },
+    { 0x00C100F5, -1 }, { 0x01020164, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x017C0175, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041012F, -1 }, { 0x20250061, -1 },
+    { 0x00000000, 0 }, { 0x0114003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013400C5, -1 }, { 0x017200C1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B015D, -1 },
+    { 0x01160153, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CE201C, -1 }, { 0x00570105, -2 }, { 0x016E00F3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00C5, -4 }, { 0x0055011E, -1 }, { 0x016C010C, -1 },
+    { 0x005200AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0151, -1 }, { 0x201B00DE, -1 }, { 0x00000000, 0 },
+    { 0x00EE012D, 1 }, { 0x005000C4, -2 }, { 0x01450041, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C016A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C60107, -1 }, { 0x01040103, -1 }, { 0x014200FF, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C40120, -1 }, { 0x0102011C, -1 }, { 0x00C100AD, -1 }, { 0x0178002E, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013E0131, 1 }, { 0x00000000, 0 }, { 0x00DE00C4, -2 },
+    { 0x00DB0051, -1 }, { 0x011C00C0, -1 }, { 0x01760047, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00152, -1 }, { 0x004100E7, -1 },
+    { 0x015800D5, -1 }, { 0x01360064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059201D, 1 },
+    { 0x00DA00F6, -1 }, { 0x00DD0169, -1 }, { 0x011800F2, -1 }, { 0x0178015F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01760178, 1 }, { 0x007B0115, -1 }, { 0x0116010B, -1 }, { 0x014F2026, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014C003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005500D6, -1 }, { 0x016C00C4, -2 }, { 0x010C0057, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0109, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CF00E7, -1 }, { 0x012C00E1, -1 }, { 0x00CC0074, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0122, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012A00FA, -1 }, { 0x016800F6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CB0119, -1 },
+    { 0x01280113, -1 }, { 0x01470111, -1 }, { 0x0049003B, -1 }, { 0x0166010F, -1 },
+    { 0x00000000, 0 }, { 0x20180154, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00470054, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0155, -1 }, { 0x004800E0, -1 }, { 0x004B0153, -1 },
+    { 0x00C10065, -1 }, { 0x00C400D8, -1 }, { 0x010200D4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00412018, -3 }, { 0x00C200F1, -1 },
+    { 0x00C50164, -2 }, { 0x010000ED, -1 }, { 0x013B0076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C0010A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0121, -1 }, { 0x01590119, -1 }, { 0x01780117, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0059005C, 1 }, { 0x00D50054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250102, 1 }, { 0x00000000, 0 }, { 0x00D90153, -1 },
+    { 0x0136014D, -1 }, { 0x00000000, 0 }, { 0x016E0063, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0072201E, -2 }, { 0x00580101, -1 }, { 0x00CF2018, -1 }, { 0x011200F5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E00C1, 1 }, { 0x00000000, 0 }, { 0x201B004E, -1 }, { 0x00000000, 0 },
+    { 0x00AD002E, -1 }, { 0x00CC002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00DA, -1 }, { 0x20190067, -3 }, { 0x00EF0129, 1 },
+    { 0x012D0125, 2 }, { 0x002F004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0166, -1 }, { 0x201A00F3, -1 }, { 0x0052014C, -1 },
+    { 0x012B013E, 2 }, { 0x00000000, 0 }, { 0x00E7005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018010C, -1 },
+    { 0x00000000, 0 }, { 0x002E00F4, -1 }, { 0x00C900EA, -1 }, { 0x012600E4, -1 },
+    { 0x014500E2, -1 }, { 0x016400E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00AB0178, -1 }, { 0x002C010D, -1 }, { 0x004B010B, -1 },
+    { 0x011F201C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C5011C, -1 }, { 0x00000000, 0 }, { 0x015A002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C000C2, 1 }, { 0x00410057, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C1014E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0175005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB00F2, -1 }, { 0x01540077, -1 }, { 0x015700EA, -1 }, { 0x017600E8, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01390178, -2 },
+    { 0x00D9010B, -1 }, { 0x01360105, -1 }, { 0x01550103, -1 }, { 0x0057002D, -1 },
+    { 0x01580176, -2 }, { 0x01740101, -2 }, { 0x20260146, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0079, -2 }, { 0x005600D2, -1 },
+    { 0x011000C6, -1 }, { 0x014E00C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E014C, -1 },
+    { 0x005400EB, -1 }, { 0x010E00DF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D011E, -2 }, { 0x00000000, 0 },
+    { 0x010F016B, 1 }, { 0x00520104, 1 }, { 0x00CE00FC, -1 }, { 0x012E0169, -1 },
+    { 0x014A00F4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201800C4, -3 }, { 0x0050011D, -1 }, { 0x00CC0115, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190150, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0138, -1 },
+    { 0x002C00C5, 1 }, { 0x004B00C3, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C500D4, -1 }, { 0x00000000, 0 }, { 0x00C20061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006600F3, -1 }, { 0x00C300ED, -1 },
+    { 0x011D0074, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01020175, -2 }, { 0x00C10106, -1 },
+    { 0x011E0100, -1 }, { 0x01210173, 1 }, { 0x01762019, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF011F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250072, -1 }, { 0x00D900C3, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA014F, -1 }, { 0x005B00E4, -1 },
+    { 0x00580071, -1 }, { 0x01120065, -1 }, { 0x017200D2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0170, -1 }, { 0x0054201C, 1 },
+    { 0x0073201A, -1 }, { 0x013200EF, 1 }, { 0x017000EB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014A2025, -2 }, { 0x016E0104, -2 }, { 0x00000000, 0 }, { 0x0070002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00D6, -2 }, { 0x00000000, 0 }, { 0x016C011D, -1 }, { 0x201A0063, -1 },
+    { 0x00000000, 0 }, { 0x0128003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0162, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EE013E, 2 },
+    { 0x00000000, 0 }, { 0x002E0064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190108, -2 }, { 0x00000000, 0 },
+    { 0x012A0153, -1 }, { 0x002F00F0, -3 }, { 0x00CA00E6, -1 }, { 0x0168014F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00472026, -1 }, { 0x00E2201C, -1 }, { 0x01202018, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0044003A, -1 }, { 0x00FE002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40131, -1 },
+    { 0x0102012D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01000146, -1 }, { 0x011F0144, 1 }, { 0x013E0142, 3 }, { 0x0138005C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C00163, -1 }, { 0x00000000, 0 }, { 0x011A00EA, -1 },
+    { 0x00F80079, 1 }, { 0x01360075, -1 }, { 0x01740071, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD017A, -1 }, { 0x00D52026, -2 },
+    { 0x00DA0107, -1 }, { 0x01180103, -1 }, { 0x0151201E, -1 }, { 0x015600FF, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01302039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D2003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D300C6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005500E7, -1 },
+    { 0x016C00D5, -1 }, { 0x014A0064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CF00F8, -1 }, { 0x012C00F2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201900C0, -4 }, { 0x00CD0111, -1 }, { 0x012A010B, -1 }, { 0x01680107, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A014C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0160003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E014D, -1 },
+    { 0x00000000, 0 }, { 0x00280067, 2 }, { 0x00660063, -1 }, { 0x01200057, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0166, -1 }, { 0x00C400E9, -1 }, { 0x010200E5, -1 }, { 0x00C10076, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50175, -2 }, { 0x00C20102, 1 }, { 0x011F00FC, 1 },
+    { 0x01392019, -1 }, { 0x013E00FA, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C0011B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0136002D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2026006E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250113, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015200E9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01500102, -1 }, { 0x201D0046, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00D2, -1 },
+    { 0x00000000, 0 }, { 0x0056012B, 1 }, { 0x012F011D, 1 }, { 0x00500045, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00EB, -2 }, { 0x00000000, 0 }, { 0x00EF013A, 2 }, { 0x014C0134, -1 },
+    { 0x006D005C, -2 }, { 0x20190078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0104, 1 }, { 0x00000000, 0 }, { 0x014A014D, -1 },
+    { 0x00CB00E2, -1 }, { 0x004C0077, -1 }, { 0x00C8006F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018011D, -2 }, { 0x00500176, -1 },
+    { 0x00E32018, -1 }, { 0x002E0105, -1 }, { 0x012600F5, -1 }, { 0x014500F3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C011E, -1 }, { 0x004B011C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C5012D, -1 },
+    { 0x004600C2, -2 }, { 0x00DE0045, -1 }, { 0x011C0041, -1 }, { 0x0179003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280150, -1 },
+    { 0x00C30146, -1 }, { 0x00C000D3, -1 }, { 0x00FB005C, -2 }, { 0x01390058, 1 },
+    { 0x01580056, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00EA, -2 }, { 0x015900E2, -1 },
+    { 0x017800E0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0178, -1 }, { 0x00DE0176, -2 }, { 0x00DB0103, -1 },
+    { 0x011C0172, -1 }, { 0x013B0170, -1 }, { 0x015A016E, -1 }, { 0x01712018, -1 },
+    { 0x017600F9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D9011C, -1 }, { 0x00000000, 0 }, { 0x014F002E, -1 }, { 0x016E002C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260157, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D400C2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005600E3, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E015D, -1 }, { 0x00000000, 0 },
+    { 0x012D00EE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D012F, -1 }, { 0x010F017C, 1 },
+    { 0x00CE010D, -1 }, { 0x01262026, -1 }, { 0x014A0105, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201800D5, -1 }, { 0x0050012E, -1 }, { 0x00000000, 0 }, { 0x014500AB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190161, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0149, -1 }, { 0x002C00D6, -1 },
+    { 0x004B00D4, -1 }, { 0x00480061, -1 }, { 0x00C40059, -3 }, { 0x01020055, -2 },
+    { 0x014300C4, -1 }, { 0x016200C2, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C500E5, -1 }, { 0x014100DD, -2 }, { 0x00C20072, -1 }, { 0x0100006E, -1 },
+    { 0x013E006A, 1 }, { 0x016000DB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00422025, -1 }, { 0x00280108, -1 }, { 0x0104016D, -1 }, { 0x0123016B, 1 },
+    { 0x01420169, 1 }, { 0x01782011, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10117, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DA002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE012E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410151, -1 }, { 0x00D900D4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026010F, -1 },
+    { 0x00000000, 0 }, { 0x00562014, -1 }, { 0x005B00F5, -1 }, { 0x00BB0162, -1 },
+    { 0x017200E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D02025, -2 }, { 0x01320100, -1 },
+    { 0x01540171, -1 }, { 0x016B201B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01300119, -1 }, { 0x016E0115, -1 }, { 0x00000000, 0 }, { 0x0168002F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00E7, -3 },
+    { 0x00000000, 0 }, { 0x201A0074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0173, -1 },
+    { 0x201B0100, -3 }, { 0x00000000, 0 }, { 0x00CF0151, -1 }, { 0x005000E6, -1 },
+    { 0x002E0075, -1 }, { 0x01260065, -1 }, { 0x01450063, -1 }, { 0x01640061, -1 },
+    { 0x00000000, 0 }, { 0x20190119, -3 }, { 0x00000000, 0 }, { 0x0049201E, -1 },
+    { 0x002F0101, -3 }, { 0x0068201C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015E2025, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2002A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01230123, 1 }, { 0x00000000, 0 },
+    { 0x00C00043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670148, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01000157, -1 }, { 0x00BF00E8, -1 }, { 0x00DB0073, -1 }, { 0x011F0155, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00A10176, -1 }, { 0x00410109, -1 }, { 0x00C00174, -3 }, { 0x00F6201C, -1 },
+    { 0x01722014, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202600C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0058003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005900C6, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025016C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EF0062, 2 },
+    { 0x014C005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0058016B, -1 }, { 0x005500F8, -1 }, { 0x00D100F0, -1 },
+    { 0x010F00EC, 1 }, { 0x012E00EA, -1 }, { 0x016C00E6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01100178, -1 }, { 0x0072010F, -1 },
+    { 0x00CF0109, -1 }, { 0x012C0103, -1 }, { 0x014E0174, -1 }, { 0x20180045, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900D1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50055, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C600E1, -1 },
+    { 0x010400DD, -3 }, { 0x00C3006E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0177, -2 },
+    { 0x004B0175, -1 }, { 0x00C400FA, -1 }, { 0x010200F6, -1 }, { 0x01240167, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0046011B, -1 }, { 0x00C20113, -1 }, { 0x0100010F, -1 },
+    { 0x01772026, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440134, -1 }, { 0x004100C1, 1 },
+    { 0x00000000, 0 }, { 0x0174003A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0065, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00572010, -1 }, { 0x011600E5, -1 }, { 0x01760152, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010F201D, 3 }, { 0x00D60102, -1 }, { 0x012E201B, -1 },
+    { 0x0136016F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CF203A, -1 }, { 0x01120117, -1 },
+    { 0x201D0057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00E3, -1 }, { 0x00000000, 0 },
+    { 0x00D20134, -1 }, { 0x012C00BB, -1 }, { 0x00500056, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0071, -3 },
+    { 0x004E006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0115, -1 }, { 0x0052016E, -1 }, { 0x004A201A, -2 }, { 0x00CB00F3, -1 },
+    { 0x014700EB, -1 }, { 0x016600E9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2018012E, -1 }, { 0x00000000, 0 }, { 0x01212025, -1 },
+    { 0x01450104, -1 }, { 0x01640102, -2 }, { 0x0047002E, -1 }, { 0x0066002C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01050121, 1 }, { 0x0143011D, -1 }, { 0x00C1003F, -1 },
+    { 0x00FF003B, -1 }, { 0x0162011B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010000C7, -1 },
+    { 0x00DE0056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30157, -1 },
+    { 0x00C000E4, -1 }, { 0x00410079, -2 }, { 0x00DC006F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10170, -2 },
+    { 0x00D8201A, -2 }, { 0x00DD00FB, -1 }, { 0x011E016A, -1 }, { 0x015900F3, -1 },
+    { 0x015C0166, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0176010A, -1 }, { 0x00000000, 0 },
+    { 0x00D5002E, -2 }, { 0x00F4002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500DC, -2 }, { 0x00000000, 0 }, { 0x01740123, -2 },
+    { 0x00000000, 0 }, { 0x0057004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260168, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01150142, -1 }, { 0x0153013E, -1 }, { 0x010F005C, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005600F4, -2 }, { 0x00000000, 0 }, { 0x016A006F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D30178, -1 }, { 0x0054010D, -1 }, { 0x0128201E, -1 },
+    { 0x0166201A, -3 }, { 0x20190041, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0140, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800E6, -2 },
+    { 0x0050013F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190172, -1 }, { 0x2011201E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C00E7, -1 }, { 0x004B00E5, -1 },
+    { 0x00670070, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A0100, -3 },
+    { 0x00C02015, -1 }, { 0x00C500F6, -1 }, { 0x011F007D, 1 }, { 0x017C0077, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00280119, -1 }, { 0x00660115, -1 }, { 0x00C3010F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE013F, -1 }, { 0x00000000, 0 },
+    { 0x017600C2, -3 }, { 0x00D80059, -1 }, { 0x01540051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410162, -2 },
+    { 0x00D900E5, -1 }, { 0x01580150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260120, -1 }, { 0x00000000, 0 },
+    { 0x00562025, -3 }, { 0x00F1201B, -1 }, { 0x01560169, -1 }, { 0x017200F4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059011F, -1 }, { 0x0170010D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005400C5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00F8, -3 }, { 0x00000000, 0 },
+    { 0x00550151, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CB0063, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0111, -2 },
+    { 0x00000000, 0 }, { 0x002C2018, -3 }, { 0x0053016A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019012A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C300C7, -1 }, { 0x0044005C, -1 },
+    { 0x00A10056, -1 }, { 0x00C00054, -2 }, { 0x012000C1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00670159, 1 }, { 0x00C40153, -1 }, { 0x004500E8, -1 },
+    { 0x00C100E0, -1 }, { 0x0102014F, -1 }, { 0x011E00DA, -1 }, { 0x01590063, -1 },
+    { 0x01780061, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2016C, -2 },
+    { 0x01000168, -2 }, { 0x01362010, -1 }, { 0x0176007A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01722025, -2 }, { 0x01580108, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202600D8, -1 }, { 0x00000000, 0 }, { 0x01370123, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0150003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0148, -1 }, { 0x0135013C, 1 },
+    { 0x017000C5, -2 }, { 0x00560064, -2 }, { 0x00D2005C, -1 }, { 0x014E0054, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01520153, -1 }, { 0x005700F0, -2 }, { 0x013000E2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D40174, -1 }, { 0x00550109, -1 }, { 0x006F2026, -1 }, { 0x00D10101, -1 },
+    { 0x010F00FD, 1 }, { 0x012E00FB, -1 }, { 0x01482018, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B00C9, -1 }, { 0x20180056, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0126002E, -1 }, { 0x0145002C, -2 }, { 0x0164002A, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900E2, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0057, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A016E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0160005C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E016F, -1 }, { 0x00C12011, -1 }, { 0x00C600F2, -1 },
+    { 0x010400EE, -1 }, { 0x0145015D, -1 }, { 0x0164015B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480113, -1 },
+    { 0x00C4010B, -1 }, { 0x00FD2026, -2 }, { 0x01020107, -1 }, { 0x017E00FF, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01000120, -1 }, { 0x01582039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004100D2, -1 }, { 0x015800C0, 1 },
+    { 0x0136004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA00E1, -1 },
+    { 0x015600D9, -1 }, { 0x01720064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0102, 1 }, { 0x011600F6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0114010F, -1 }, { 0x0152010B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0068, -1 }, { 0x005500C1, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E00F4, -1 }, { 0x00000000, 0 }, { 0x0056014D, -2 },
+    { 0x005300DA, -1 }, { 0x00500067, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C010D, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CD00EB, -1 }, { 0x012A00E5, -1 }, { 0x016800E1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0123201D, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2018013F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01260117, -1 },
+    { 0x01450115, -1 }, { 0x01640113, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C400C3, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C5014F, -1 }, { 0x004600E4, -1 }, { 0x00C200DC, -2 },
+    { 0x010000D8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00470170, -1 }, { 0x00C30168, -2 }, { 0x00C000F5, -1 },
+    { 0x01200162, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD010C, -1 }, { 0x01780102, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0157011D, -1 }, { 0x0176011B, -2 }, { 0x00590047, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0117013A, -1 }, { 0x01360138, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0172014D, -1 },
+    { 0x011200E0, -1 }, { 0x00D10071, -1 }, { 0x010F006D, 1 }, { 0x016C0067, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590178, 1 },
+    { 0x00CD201C, -1 }, { 0x00560105, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00C5, -3 }, { 0x016E017F, -1 }, { 0x20190052, -1 }, { 0x00000000, 0 },
+    { 0x0127002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0151, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012B0129, 1 },
+    { 0x004F00C4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B016A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01290142, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F016B, -1 }, { 0x002C00F8, -1 }, { 0x004B00F6, -1 }, { 0x01020077, -2 },
+    { 0x01210075, 1 }, { 0x012400E8, -1 }, { 0x014300E6, -1 }, { 0x016200E4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0049010F, -1 }, { 0x00C50107, -1 },
+    { 0x014100FF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30120, -1 },
+    { 0x00000000, 0 }, { 0x00C000AD, -1 }, { 0x0177002E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00C4, -3 }, { 0x00DA0051, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017600D3, -1 },
+    { 0x007B0070, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410173, -1 }, { 0x00D900F6, -1 },
+    { 0x013600F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260131, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005B0117, -1 }, { 0x014E2026, -2 }, { 0x01720105, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0170011E, -1 }, { 0x201E0064, -1 }, { 0x00000000, 0 },
+    { 0x014B003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014C00C6, -1 }, { 0x01680051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0109, -3 }, { 0x00000000, 0 }, { 0x016C0150, -1 },
+    { 0x00CE00E7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0122, -1 }, { 0x00000000, 0 },
+    { 0x00CF0173, -1 }, { 0x00EB00FE, -1 }, { 0x0105201B, -1 }, { 0x012C016D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019013B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0123, -3 }, { 0x004E0121, -1 },
+    { 0x00CA0119, -1 }, { 0x0048003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002800E2, -1 }, { 0x00C300D8, -1 }, { 0x00C00065, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C40164, -2 }, { 0x00C100F1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F82025, -1 }, { 0x011C0104, -1 },
+    { 0x011F0177, 1 }, { 0x013E0175, 1 }, { 0x0174201D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0041012B, -1 }, { 0x00DC0121, -1 }, { 0x00000000, 0 }, { 0x00D6003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600E9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013400C1, -1 }, { 0x00D40054, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B0159, -1 }, { 0x0116014F, -1 }, { 0x005900E8, -2 },
+    { 0x012F0067, 1 }, { 0x017000D6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A0174, -1 }, { 0x0071201E, -1 },
+    { 0x00570101, -2 }, { 0x00CE2018, -1 }, { 0x013000F3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00C1, -4 },
+    { 0x00000000, 0 }, { 0x016C0108, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E014D, -1 },
+    { 0x201B00DA, -1 }, { 0x20180067, -2 }, { 0x00EE0129, 1 }, { 0x005000C0, -2 },
+    { 0x002E004F, -1 }, { 0x0164003B, -2 }, { 0x016A0121, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201900F3, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00E6005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01660153, -1 }, { 0x00C800EA, -1 }, { 0x00C50077, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FF201E, -2 }, { 0x00C60103, -1 }, { 0x010400FF, -2 },
+    { 0x011E201C, -1 }, { 0x012300FD, 1 }, { 0x014200FB, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C4011C, -1 },
+    { 0x00000000, 0 }, { 0x0159002C, -2 }, { 0x0178002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000131, -1 },
+    { 0x00000000, 0 }, { 0x00DE00C0, -2 }, { 0x01760043, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C0014E, -1 }, { 0x004100E3, -1 }, { 0x011D0148, 1 }, { 0x01170062, -1 },
+    { 0x0174005C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0178015B, -2 }, { 0x00592019, 1 }, { 0x00DA00F2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0111, -1 },
+    { 0x01160107, -1 }, { 0x00000000, 0 }, { 0x0056002D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250146, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013000AB, -1 }, { 0x010E003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005500D2, -1 }, { 0x016C00C0, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0105, -1 }, { 0x00000000, 0 }, { 0x007200E9, -1 },
+    { 0x00CF00E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C011E, -1 }, { 0x00000000, 0 }, { 0x002D2025, -1 },
+    { 0x00CD00FC, -1 }, { 0x012A00F6, -1 }, { 0x016800F2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CB0115, -1 }, { 0x0128010F, -1 }, { 0x0147010D, -1 },
+    { 0x0166010B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180150, -1 },
+    { 0x00000000, 0 }, { 0x201500DD, -1 }, { 0x002E0138, -1 }, { 0x004A00C3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0151, -1 },
+    { 0x004B014F, -1 }, { 0x00C400D4, -1 }, { 0x00C10061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00412014, -1 }, { 0x004600F5, -1 }, { 0x00C200ED, -1 }, { 0x010000E9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BB2025, -1 }, { 0x00C00106, -1 }, { 0x0156201B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD011D, -1 },
+    { 0x01590115, -1 }, { 0x01780113, -2 }, { 0x0172002D, -1 }, { 0x20260059, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D800C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D9014F, -1 }, { 0x01360149, -1 }, { 0x00570071, -2 },
+    { 0x01300063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0072201A, -2 }, { 0x005800FD, -1 },
+    { 0x00000000, 0 }, { 0x016C0078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006F002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00D6, -1 },
+    { 0x00000000, 0 }, { 0x00EF0125, 2 }, { 0x20190063, -3 }, { 0x00000000, 0 },
+    { 0x0127003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0162, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012B013A, 2 }, { 0x014700C5, -1 },
+    { 0x01060056, -1 }, { 0x016600C3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20180108, -1 }, { 0x00500161, -1 }, { 0x00000000, 0 },
+    { 0x002E00F0, -1 }, { 0x00C900E6, -1 }, { 0x0104006F, -1 }, { 0x0123006D, 1 },
+    { 0x012600E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F017C, -2 },
+    { 0x002C0109, -1 }, { 0x00462026, -2 }, { 0x004B0107, -1 }, { 0x00AB0174, -1 },
+    { 0x00E1201C, -1 }, { 0x011F2018, 1 }, { 0x012400F9, -1 }, { 0x016200F5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0043003A, -1 }, { 0x00FD002E, -2 }, { 0x011C002C, -1 }, { 0x013B002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00660137, 1 }, { 0x00C30131, -1 },
+    { 0x004400C6, -1 }, { 0x01580041, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD00D5, -1 }, { 0x0137005C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015700E6, -1 }, { 0x017600E4, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01390174, -2 }, { 0x00D42026, -2 }, { 0x00D90107, -1 },
+    { 0x01360101, -1 }, { 0x0150201E, -2 }, { 0x015500FF, 1 }, { 0x01580172, -1 },
+    { 0x016F201C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0075, -1 }, { 0x00000000, 0 }, { 0x00D200C6, -1 }, { 0x011000C2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005400E7, -1 }, { 0x00D000DF, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D011A, -1 }, { 0x010F0167, 1 }, { 0x00520100, 1 },
+    { 0x00CE00F8, -1 }, { 0x012E0165, -1 }, { 0x014A00F0, -1 }, { 0x016C0161, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800C0, -3 },
+    { 0x00500119, -1 }, { 0x00CC0111, -1 }, { 0x01622026, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019014C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C00C1, 1 }, { 0x00000000, 0 },
+    { 0x015F003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00460065, -1 }, { 0x01000059, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002800F3, -1 }, { 0x006600EF, 1 }, { 0x00C00076, -2 }, { 0x00C300E9, -1 },
+    { 0x011D0070, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C40175, -2 }, { 0x00C10102, 1 }, { 0x01020171, -1 }, { 0x0121016F, 1 },
+    { 0x01762015, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF011B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025006E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600FA, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005B00E0, -1 }, { 0x00000000, 0 }, { 0x01120061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00542018, 1 }, { 0x005900F9, -1 }, { 0x005C016C, -1 },
+    { 0x00D80164, -1 }, { 0x017000E7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E0100, -2 },
+    { 0x201C0046, -1 }, { 0x0051002C, 5 }, { 0x0070002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00D2, -2 }, { 0x00000000, 0 },
+    { 0x00D10123, -1 }, { 0x016C0119, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00EB, -2 },
+    { 0x00000000, 0 }, { 0x00EE013A, 2 }, { 0x005000D1, -1 }, { 0x20180078, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190104, -4 }, { 0x00000000, 0 }, { 0x012A014F, -1 }, { 0x004E00EA, -1 },
+    { 0x002C0079, -2 }, { 0x004B0077, -1 }, { 0x00CA00E2, -1 }, { 0x01430067, -1 },
+    { 0x01620065, -1 }, { 0x00000000, 0 }, { 0x004F0176, -1 }, { 0x00E22018, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FE002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C4012D, -1 }, { 0x01020129, -1 },
+    { 0x017E0121, 1 }, { 0x0178003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20146, -1 }, { 0x013E013E, 3 },
+    { 0x00DE00D1, -1 }, { 0x00FA005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011D0159, 1 },
+    { 0x004100F4, -1 }, { 0x00DC00EA, -1 }, { 0x011A00E6, -1 }, { 0x01360071, -1 },
+    { 0x0155006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0176, 1 }, { 0x0151201A, -1 }, { 0x00DA0103, -1 }, { 0x015600FB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014E002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250157, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D300C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A201A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005500E3, -1 }, { 0x00000000, 0 }, { 0x012B0062, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CF00F4, -1 }, { 0x016A00EA, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014C0178, -1 }, { 0x00CD010D, -1 },
+    { 0x012A0107, -1 }, { 0x01680103, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0148, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180161, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0149, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00280063, -1 }, { 0x00C30059, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0162, -1 }, { 0x00C400E5, -1 },
+    { 0x010200E1, -1 }, { 0x00C10072, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50171, -1 },
+    { 0x010000FA, -1 }, { 0x01582013, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C00117, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D9002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026006A, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C00DC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025010F, -1 }, { 0x00000000, 0 },
+    { 0x00552014, -1 }, { 0x011400E9, -1 }, { 0x015200E5, -1 }, { 0x01300074, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CF2025, -1 }, { 0x201D0042, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A0059, -1 },
+    { 0x00000000, 0 }, { 0x00500041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00E7, -2 }, { 0x00000000, 0 },
+    { 0x010E0134, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0173, -1 }, { 0x201A0100, 1 },
+    { 0x00000000, 0 }, { 0x00CE0151, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180119, -2 }, { 0x00500172, -1 }, { 0x0048201E, -1 }, { 0x002E0101, -1 },
+    { 0x0067201C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015D2025, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1002A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50129, -1 }, { 0x00000000, 0 }, { 0x00DE0041, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0028014C, -1 }, { 0x00660148, -1 }, { 0x00000000, 0 },
+    { 0x00410064, -1 }, { 0x01390054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD00E6, -2 }, { 0x00DA0073, -1 }, { 0x0118006F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0174, -1 },
+    { 0x00D6201E, -2 }, { 0x00DE0172, -1 }, { 0x00F5201C, -1 }, { 0x011C016E, -1 },
+    { 0x013B016C, -1 }, { 0x015A016A, -1 }, { 0x017600F5, -2 }, { 0x00000000, 0 },
+    { 0x202500C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0057003A, -2 }, { 0x0130002C, -1 }, { 0x014F002A, -1 }, { 0x00000000, 0 },
+    { 0x20260153, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0134012B, 1 },
+    { 0x005800C6, 1 }, { 0x016C0041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590152, -1 },
+    { 0x01510142, 1 }, { 0x00000000, 0 }, { 0x00CF0064, -1 }, { 0x00EE0062, 2 },
+    { 0x014B005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005400F8, -1 }, { 0x00EF00EE, 1 }, { 0x01680073, -1 },
+    { 0x2019002C, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CE0109, -1 }, { 0x014A0101, -1 },
+    { 0x0164201E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800D1, -1 }, { 0x0050012A, -1 },
+    { 0x01432039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019015D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C00D2, -1 }, { 0x014300C0, -1 }, { 0x00C40055, -2 },
+    { 0x01020051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004900E9, -1 }, { 0x00C500E1, -1 },
+    { 0x00C2006E, -1 }, { 0x012200DB, -1 }, { 0x013E0066, 1 }, { 0x014100D9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040169, -1 }, { 0x00470102, -1 },
+    { 0x00C300FA, -1 }, { 0x01230167, 1 }, { 0x01420165, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0045011B, -1 }, { 0x00C10113, -1 }, { 0x01762026, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE012A, -1 }, { 0x00000000, 0 }, { 0x017600AD, -1 },
+    { 0x007B004A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041014D, -1 }, { 0x00000000, 0 },
+    { 0x017400C6, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2026010B, -1 }, { 0x00000000, 0 }, { 0x00562010, -1 },
+    { 0x00000000, 0 }, { 0x017200DF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0154016D, -1 }, { 0x0059010A, -1 }, { 0x00D50102, -1 }, { 0x011300FE, -1 },
+    { 0x017000F8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CE203A, -1 }, { 0x00570123, -2 }, { 0x01300115, -1 },
+    { 0x016E0111, -1 }, { 0x0070003B, -1 }, { 0x201C0057, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00E3, -3 }, { 0x00000000, 0 }, { 0x201A0070, -1 },
+    { 0x00000000, 0 }, { 0x004F0056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E016F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00720153, -1 }, { 0x005000E2, -1 }, { 0x002E0071, -1 }, { 0x00CF014D, -1 },
+    { 0x01260061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190115, -3 },
+    { 0x00000000, 0 }, { 0x0049201A, -1 }, { 0x00682018, -1 }, { 0x00CA00F3, -1 },
+    { 0x01430078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01202025, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0046002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004A012D, 1 }, { 0x01040121, 1 }, { 0x00C0003F, -1 }, { 0x00FE003B, -1 },
+    { 0x0123011F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00670144, 1 }, { 0x011E00C5, -1 }, { 0x01210138, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0046015F, -1 }, { 0x00C20157, -1 }, { 0x00BF00E4, -1 },
+    { 0x00DB006F, -1 }, { 0x01000153, -1 }, { 0x0119006B, -1 }, { 0x013B00DC, -1 },
+    { 0x01570067, -1 }, { 0x015A00DA, -1 }, { 0x00440178, -1 }, { 0x00C00170, -2 },
+    { 0x00410105, -1 }, { 0x00F62018, -1 }, { 0x01722010, -1 }, { 0x01760065, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600C3, 1 },
+    { 0x00000000, 0 }, { 0x0156010C, -1 }, { 0x00000000, 0 }, { 0x00D4002E, -2 },
+    { 0x00F3002C, -1 }, { 0x0112002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01350127, 1 }, { 0x005900C2, -3 },
+    { 0x0056004F, -1 }, { 0x01730123, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250168, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010E005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005500F4, -1 }, { 0x012E00E6, -1 }, { 0x014A0071, -1 }, { 0x016C00E2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D20178, -1 }, { 0x0072010B, -1 }, { 0x00CF0105, -1 }, { 0x01100174, -1 },
+    { 0x0146201C, -1 }, { 0x20180041, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201900CD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0162002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0159, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20180172, -1 }, { 0x2010201E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010400D9, -2 }, { 0x00660070, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0173, -1 }, { 0x004B0171, -1 }, { 0x0062201B, -1 },
+    { 0x006700FC, 1 }, { 0x00C400F6, -1 }, { 0x010200F2, -1 }, { 0x01240163, -1 },
+    { 0x01430161, -1 }, { 0x0162015F, -1 }, { 0x00000000, 0 }, { 0x00460117, -1 },
+    { 0x00C2010F, -1 }, { 0x0100010B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015800AB, -1 }, { 0x0136003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015600C4, 1 },
+    { 0x005B0061, -1 }, { 0x0172004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0176014E, -1 }, { 0x007B00EB, -1 },
+    { 0x0059007A, -1 }, { 0x011600E1, -1 }, { 0x015400DD, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250120, -1 }, { 0x00000000, 0 }, { 0x00552025, -2 },
+    { 0x00F0201B, -1 }, { 0x010F2019, 3 }, { 0x0136016B, -1 }, { 0x015200F6, -1 },
+    { 0x016C2013, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01120113, -1 }, { 0x201D0053, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00500052, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00F8, -2 }, { 0x00000000, 0 }, { 0x00540151, -1 },
+    { 0x00000000, 0 }, { 0x002F006D, -1 }, { 0x00CA0063, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0111, -1 }, { 0x00000000, 0 },
+    { 0x0052016A, -1 }, { 0x012800E9, -1 }, { 0x014700E7, -1 }, { 0x016600E5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018012A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01450100, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0105011D, 1 },
+    { 0x0124011B, -1 }, { 0x01430119, -1 }, { 0x01620117, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C200C7, -1 }, { 0x00DE0052, -1 }, { 0x010000C3, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00660159, -1 }, { 0x00C30153, -1 }, { 0x00C000E0, -1 }, { 0x00410075, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1016C, -2 }, { 0x011E0166, -1 },
+    { 0x015C0162, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01760106, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500D8, -1 },
+    { 0x00000000, 0 }, { 0x01170125, -1 }, { 0x01550121, -1 }, { 0x0174011F, -2 },
+    { 0x014F003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260164, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0115013E, -1 }, { 0x0153013A, -1 },
+    { 0x00550064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01700151, -1 },
+    { 0x005600F0, -2 }, { 0x00CF0075, -1 }, { 0x012C006F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D30174, -1 },
+    { 0x00540109, -1 }, { 0x0128201A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D013C, -1 },
+    { 0x00000000, 0 }, { 0x00520122, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201800E2, -2 }, { 0x0050013B, -1 }, { 0x0129012D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019016E, -1 }, { 0x2011201A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C00E3, -1 }, { 0x004B00E1, -1 }, { 0x015F005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004900FA, -1 }, { 0x00C02011, -1 }, { 0x00C500F2, -1 },
+    { 0x011F0079, 1 }, { 0x013E0077, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280115, -1 }, { 0x00660111, -1 },
+    { 0x00C3010B, -1 }, { 0x0041002D, -1 }, { 0x0178201E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE013B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0154004D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0158014C, -1 }, { 0x00D900E1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2026011C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x017200F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0059011B, -2 }, { 0x01700109, -1 }, { 0x201E004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016E0122, -1 }, { 0x005400C1, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00F4, -3 }, { 0x00000000, 0 }, { 0x0055014D, -1 }, { 0x005200DA, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B010D, -2 }, { 0x00000000, 0 }, { 0x00530166, -1 },
+    { 0x005000F3, -1 }, { 0x00CC00EB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190126, -1 }, { 0x00000000, 0 },
+    { 0x0051017F, -1 }, { 0x012A0171, -1 }, { 0x0141201B, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B0123, 1 }, { 0x20110059, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C300C3, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00670155, 1 }, { 0x004500E4, -1 }, { 0x00C100DC, -2 }, { 0x00C4014F, -1 },
+    { 0x00DD0067, -1 }, { 0x0102014B, -1 }, { 0x01210149, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20168, -2 }, { 0x00BF00F5, -1 }, { 0x01000164, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01342025, -2 }, { 0x00DC010C, -1 },
+    { 0x01580104, 1 }, { 0x0079002C, -2 }, { 0x017A0175, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600D4, -1 }, { 0x00000000, 0 },
+    { 0x0137011F, 1 }, { 0x00000000, 0 }, { 0x00580047, -1 }, { 0x0112003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B0144, -1 }, { 0x005900D3, -1 }, { 0x01100054, -1 },
+    { 0x013200C5, -1 }, { 0x017000C1, -2 }, { 0x00000000, 0 }, { 0x201D2025, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01140153, -1 }, { 0x0152014F, -1 },
+    { 0x012D006B, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00AD201E, -1 },
+    { 0x00550105, -1 }, { 0x00CC201C, -1 }, { 0x010F00F9, 1 }, { 0x016C00F3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0138, -1 }, { 0x201B00C5, -3 },
+    { 0x20180052, -1 }, { 0x016A010C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0151, -2 },
+    { 0x201900DE, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F00C6, -3 },
+    { 0x004B0051, -1 }, { 0x004E00C4, -1 }, { 0x01430041, -1 }, { 0x00000000, 0 },
+    { 0x201A016A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C00DD, -2 }, { 0x0122005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E016B, -1 },
+    { 0x00000000, 0 }, { 0x010400EA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0048010F, -1 }, { 0x00C40107, -1 }, { 0x01020103, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20120, -1 }, { 0x0100011C, -1 },
+    { 0x00000000, 0 }, { 0x0176002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DC00C4, -2 }, { 0x00D90051, -1 }, { 0x01740047, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0150, -1 }, { 0x00000000, 0 }, { 0x015600D5, -1 }, { 0x01530062, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0057201D, 1 }, { 0x0176015F, -2 }, { 0x011600F2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250131, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0114010B, -1 },
+    { 0x014D2026, -1 }, { 0x01520107, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0064, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E00F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016A00C4, -2 },
+    { 0x00500063, -1 }, { 0x010A0057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0109, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CD00E7, -1 },
+    { 0x012A00E1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0122, -1 }, { 0x00000000, 0 }, { 0x00CE0173, -1 },
+    { 0x00EA00FE, -1 }, { 0x0104201B, -3 }, { 0x01232019, 2 }, { 0x012800FA, -1 },
+    { 0x014700F8, -1 }, { 0x016600F6, -1 }, { 0x2018013B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0123, 1 }, { 0x00C90119, -1 }, { 0x01260113, -1 },
+    { 0x01450111, -1 }, { 0x0164010F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490153, -1 },
+    { 0x004600E0, -1 }, { 0x00C200D8, -1 }, { 0x00BF0065, -1 }, { 0x00C5014B, -1 },
+    { 0x010000D4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0047016C, -1 }, { 0x00C000F1, -1 }, { 0x00C30164, -2 }, { 0x01390076, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0108, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0121, -1 },
+    { 0x01570119, -1 }, { 0x00590043, -1 }, { 0x00D5003B, -1 }, { 0x01760117, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500E9, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057005C, 1 }, { 0x00D30054, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260175, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800E8, -1 }, { 0x010F0069, 1 },
+    { 0x016C0063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0070201E, -1 }, { 0x00560101, -2 },
+    { 0x00CD2018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00C1, -3 }, { 0x00000000, 0 },
+    { 0x2019004E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D014D, -3 }, { 0x201A00DA, -2 },
+    { 0x00000000, 0 }, { 0x012B0125, 2 }, { 0x004F00C0, -1 }, { 0x014A0123, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A0164, -1 },
+    { 0x201800F3, -2 }, { 0x00000000, 0 }, { 0x00EB0142, -1 }, { 0x002E00DB, -2 },
+    { 0x004D00D9, -1 }, { 0x00E5005C, -2 }, { 0x0129013E, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0167, -1 }, { 0x002C00F4, -1 },
+    { 0x004B00F2, -1 }, { 0x0067007D, 1 }, { 0x00C40077, -2 }, { 0x012400E4, -1 },
+    { 0x014300E2, -1 }, { 0x016200E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0049010B, -1 }, { 0x00C50103, -1 }, { 0x00FE201E, -1 }, { 0x011D201C, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD2039, -1 }, { 0x00C3011C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD00C0, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0173005C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0041016F, -1 }, { 0x00000000, 0 }, { 0x00D900F2, -1 }, { 0x015500EA, -1 },
+    { 0x017400E8, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01560176, -2 }, { 0x005B0113, -1 }, { 0x01102026, -2 },
+    { 0x01720101, -1 }, { 0x0055002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010E00C6, -1 }, { 0x014C00C2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0105, -3 }, { 0x016C014C, -1 }, { 0x00CE00E3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B011E, -1 }, { 0x00000000, 0 }, { 0x00720175, 1 }, { 0x00500104, -2 },
+    { 0x00CC00FC, -1 }, { 0x00CF016F, -1 }, { 0x012C0169, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190137, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F011F, -3 }, { 0x004E011D, -1 }, { 0x00CA0115, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201400DD, -1 }, { 0x00000000, 0 }, { 0x002A00C5, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004700DC, -1 },
+    { 0x00C300D4, -1 }, { 0x00C00061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004500F5, -1 }, { 0x00C100ED, -1 }, { 0x00DD0078, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01000175, -2 }, { 0x00DE0104, -2 }, { 0x011C0100, -1 }, { 0x011F0173, 1 },
+    { 0x013E0171, 1 }, { 0x01742019, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC011D, -1 }, { 0x011A0119, -1 },
+    { 0x20250059, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202600E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00580058, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007B0155, -1 }, { 0x005900E4, -2 }, { 0x00560071, -2 }, { 0x017000D2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0052201C, -1 }, { 0x0071201A, -1 }, { 0x016E00EB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016C0104, -2 },
+    { 0x201A004A, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0149, -1 }, { 0x201B00D6, -1 }, { 0x00000000, 0 },
+    { 0x00EE0125, 2 }, { 0x016A011D, -1 }, { 0x20180063, -2 }, { 0x0126003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0064, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01280153, -1 }, { 0x00C800E6, -1 },
+    { 0x01470151, -1 }, { 0x0166014F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E0201C, -1 },
+    { 0x00FF201A, -2 }, { 0x010400FB, -1 }, { 0x011E2018, -1 }, { 0x012300F9, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0042003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00650137, -1 }, { 0x00C20131, -1 }, { 0x0100012D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011D0144, 1 },
+    { 0x00DC00D5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0161, -2 },
+    { 0x00592015, -1 }, { 0x011800EA, -1 }, { 0x01720071, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B010D, -1 }, { 0x00D32026, -2 }, { 0x01160103, -1 },
+    { 0x014F201E, -1 }, { 0x015400FF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012E2039, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D0003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0075, -1 },
+    { 0x00000000, 0 }, { 0x00D100C6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0101, -1 },
+    { 0x00000000, 0 }, { 0x007200E5, -1 }, { 0x016A00D5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C011A, -1 }, { 0x00000000, 0 }, { 0x00CD00F8, -1 }, { 0x012A00F2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CB0111, -1 },
+    { 0x0128010B, -1 }, { 0x01470109, -1 }, { 0x01612026, -1 }, { 0x01660107, -1 },
+    { 0x00000000, 0 }, { 0x2018014C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0134, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015E003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C014D, -1 }, { 0x004B014B, -1 }, { 0x00000000, 0 },
+    { 0x00450065, -1 }, { 0x011E0057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00412010, -1 }, { 0x00C200E9, -1 },
+    { 0x010000E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30175, -2 },
+    { 0x00C00102, 1 }, { 0x011D00FC, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0119, -2 }, { 0x01590111, -1 }, { 0x0178010F, -2 },
+    { 0x20260055, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C00C7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500FA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005800F9, -1 }, { 0x010F007A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014E0102, -1 }, { 0x201B0046, -1 },
+    { 0x0050002C, -3 }, { 0x006F002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00D2, -1 }, { 0x0147203A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F0047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D015E, -1 }, { 0x201A00EB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014700C1, -1 }, { 0x006B005C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180104, -3 },
+    { 0x0050015D, -1 }, { 0x00000000, 0 }, { 0x00C900E2, -1 }, { 0x00C6006F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E12018, -1 }, { 0x002C0105, -1 },
+    { 0x004B0103, -1 }, { 0x012400F5, -1 }, { 0x014300F3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE002C, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00280137, 2 }, { 0x00C3012D, -1 }, { 0x004400C2, -1 }, { 0x0041004F, -1 },
+    { 0x0177003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10146, -1 }, { 0x00000000, 0 }, { 0x004200DB, -1 },
+    { 0x00F9005C, -2 }, { 0x01560056, -2 }, { 0x017800C7, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB00EA, -1 }, { 0x015700E2, -1 }, { 0x017600E0, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01390170, -1 },
+    { 0x0131201C, -1 }, { 0x00D90103, -1 }, { 0x013600FD, -1 }, { 0x0150201A, -2 },
+    { 0x0158016E, -1 }, { 0x016F2018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014D002E, -1 }, { 0x016C002C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0071, -1 }, { 0x00000000, 0 },
+    { 0x00D200C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A201C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005400E3, -1 }, { 0x00000000, 0 }, { 0x00510070, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0116, -1 },
+    { 0x002E201D, -3 }, { 0x004D201B, -1 }, { 0x005200FC, -1 }, { 0x00CE00F4, -1 },
+    { 0x010F0163, 1 }, { 0x012B00EE, 1 }, { 0x016C015D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00500115, -1 }, { 0x00CC010D, -1 },
+    { 0x01242026, -1 }, { 0x004A002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190148, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014300AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460061, -1 },
+    { 0x00C20059, -3 }, { 0x01000055, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006600EB, -1 }, { 0x00C300E5, -1 },
+    { 0x00C00072, -1 }, { 0x013C006A, 1 }, { 0x015E00DB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670177, 1 }, { 0x00C40171, -1 },
+    { 0x0102016D, -1 }, { 0x0121016B, 1 }, { 0x01762011, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF0117, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D8002F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410138, -1 }, { 0x2025006A, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202600F6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01500059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0168, -1 },
+    { 0x005900F5, -2 }, { 0x017000E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CE2025, -1 }, { 0x0169201B, -1 }, { 0x201C0042, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00CE, -1 }, { 0x00000000, 0 }, { 0x00D1011F, -1 }, { 0x012E0119, -1 },
+    { 0x004F0041, -1 }, { 0x0166002F, -2 }, { 0x016C0115, -1 }, { 0x20390059, -1 },
+    { 0x00000000, 0 }, { 0x201B00E7, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005000CD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190100, -4 }, { 0x00000000, 0 },
+    { 0x00CD0151, -1 }, { 0x002F00E8, -3 }, { 0x002C0075, -1 }, { 0x004B0073, -1 },
+    { 0x004E00E6, -1 }, { 0x01050067, 1 }, { 0x01240065, -1 }, { 0x01430063, -1 },
+    { 0x01620061, -1 }, { 0x0047201E, -1 }, { 0x004C00FF, -1 }, { 0x0066201C, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015C2025, -1 }, { 0x0104010C, -1 },
+    { 0x00000000, 0 }, { 0x00C0002A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C40129, -1 }, { 0x01210123, 1 }, { 0x00DD0041, -3 }, { 0x017E011D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013E013A, 3 }, { 0x00DE00CD, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011D0155, 1 }, { 0x004100F0, -1 },
+    { 0x00D90073, -1 }, { 0x00DC00E6, -1 }, { 0x011A00E2, -1 }, { 0x0136006D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00592026, -3 },
+    { 0x00D5201E, -2 }, { 0x00F4201C, -1 }, { 0x01702014, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0120, -1 }, { 0x00000000, 0 }, { 0x005900AD, -1 }, { 0x0056003A, -2 },
+    { 0x0110002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250153, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700C6, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580152, -1 }, { 0x00000000, 0 },
+    { 0x005500DF, -1 }, { 0x0071006A, 2 }, { 0x00CE0064, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007200F6, -1 }, { 0x00CF00F0, -1 }, { 0x00EE00EE, 1 }, { 0x012C00EA, -1 },
+    { 0x016A00E6, -1 }, { 0x2018002C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010E0178, -1 }, { 0x00CD0109, -1 }, { 0x012A0103, -1 }, { 0x014C0174, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0144, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2018015D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010400C4, 1 }, { 0x00C30055, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004800E9, -1 }, { 0x00C400E1, -1 }, { 0x00C1006E, -1 },
+    { 0x010200DD, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C5016D, -1 }, { 0x00460102, -2 }, { 0x00C200FA, -1 },
+    { 0x010000F6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00113, -1 },
+    { 0x01752026, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01780120, -1 }, { 0x20260066, 1 }, { 0x00000000, 0 }, { 0x0172003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C00D8, -1 }, { 0x00000000, 0 },
+    { 0x00590065, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2025010B, -1 }, { 0x00000000, 0 }, { 0x00552010, -1 }, { 0x011400E5, -1 },
+    { 0x015200E1, -1 }, { 0x01740152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012C201B, -1 },
+    { 0x0058010A, -1 }, { 0x00D40102, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CD203A, -1 }, { 0x00560123, -2 }, { 0x201B0057, -1 }, { 0x00000000, 0 },
+    { 0x006F003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00E3, -2 }, { 0x00000000, 0 }, { 0x00D00134, -1 }, { 0x012A00BB, -1 },
+    { 0x20190070, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D016F, -1 }, { 0x201A00FC, -1 }, { 0x00000000, 0 }, { 0x00CE014D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180115, -2 }, { 0x0050016E, -1 },
+    { 0x0048201A, -1 }, { 0x002E00FD, -2 }, { 0x00672018, 1 }, { 0x00C900F3, -1 },
+    { 0x014500EB, -1 }, { 0x016400E9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011F2025, -1 }, { 0x01430104, -1 }, { 0x01620102, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FD003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00660144, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10157, -1 }, { 0x00DD00E2, -2 }, { 0x00DA006F, -1 },
+    { 0x017800D8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0170, -1 }, { 0x00D6201A, -2 }, { 0x00DE016E, -1 },
+    { 0x00F52018, -1 }, { 0x011C016A, -1 }, { 0x013B0168, -1 }, { 0x015700F3, -1 },
+    { 0x015A0166, -1 }, { 0x00000000, 0 }, { 0x202500C3, 1 }, { 0x00000000, 0 },
+    { 0x0174010A, -1 }, { 0x00000000, 0 }, { 0x00D3002E, -2 }, { 0x00F2002C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026014F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01530125, -1 }, { 0x005800C2, 1 }, { 0x0055004F, -1 },
+    { 0x01720123, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0059014E, -1 }, { 0x01130142, -1 }, { 0x00000000, 0 },
+    { 0x010D005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005400F4, -1 },
+    { 0x00000000, 0 }, { 0x0168006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0127, -1 }, { 0x00000000, 0 },
+    { 0x0126201E, -1 }, { 0x00CE0105, -1 }, { 0x0164201A, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201800CD, -1 }, { 0x00500126, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0161002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190159, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C40051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004900E5, -1 }, { 0x00C500DD, -3 }, { 0x013E0062, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0061201B, -1 }, { 0x00C300F6, -1 }, { 0x00DD2013, -1 }, { 0x01040165, -1 },
+    { 0x011D007D, 1 }, { 0x01230163, 1 }, { 0x017A0077, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450117, -1 }, { 0x00C1010F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0126, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410149, -1 }, { 0x00000000, 0 }, { 0x013600C6, 1 }, { 0x00D60059, -1 },
+    { 0x017400C2, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260107, -1 }, { 0x01560150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00542025, -3 }, { 0x00590106, -1 },
+    { 0x01540169, -1 }, { 0x017000F4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0057011F, -2 }, { 0x01300111, -1 }, { 0x016E010D, -1 }, { 0x201C0053, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005200C5, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E016B, -1 },
+    { 0x201B00F8, -2 }, { 0x00000000, 0 }, { 0x0072014F, -1 }, { 0x005000DE, -1 },
+    { 0x002E006D, -1 }, { 0x00C90063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190111, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F00F9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A0129, 1 }, { 0x0104011D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C100C7, -1 }, { 0x0042005C, -1 }, { 0x011E00C1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046015B, -1 },
+    { 0x00C20153, -1 }, { 0x00BF00E0, -1 }, { 0x00DE00DE, -1 }, { 0x0100014F, -1 },
+    { 0x011C00DA, -1 }, { 0x013E014B, 1 }, { 0x01570063, -1 }, { 0x01760061, -2 },
+    { 0x00440174, -1 }, { 0x00C0016C, -2 }, { 0x00410101, -1 }, { 0x011A00F3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01702025, -2 }, { 0x01560108, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0173011F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014E003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250164, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E00C5, -2 }, { 0x00540064, -1 },
+    { 0x00D0005C, -1 }, { 0x014C0054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005500F0, -1 },
+    { 0x00CE0075, -1 }, { 0x00D100E8, -1 }, { 0x010F00E4, 1 }, { 0x012E00E2, -1 },
+    { 0x00000000, 0 }, { 0x201E0123, 1 }, { 0x00D20174, -1 }, { 0x01462018, -1 },
+    { 0x00720107, -1 }, { 0x00CF0101, -1 }, { 0x012C00FB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900C9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006A003A, -1 },
+    { 0x0124002E, -1 }, { 0x0143002C, -2 }, { 0x0162002A, 2 }, { 0x201A0155, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018016E, -1 },
+    { 0x2010201A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010400D5, -1 }, { 0x0066006C, 1 }, { 0x015E005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C016F, -1 },
+    { 0x004800FA, -1 }, { 0x004B016D, -1 }, { 0x00C400F2, -1 }, { 0x010200EE, -1 },
+    { 0x0143015D, -1 }, { 0x0162015B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01220178, -1 }, { 0x00460113, -1 }, { 0x00C2010B, -1 }, { 0x01000107, -1 },
+    { 0x01410176, -2 }, { 0x0177201E, -2 }, { 0x017C00FF, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01562039, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00F8003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011B0137, -1 },
+    { 0x20260077, -2 }, { 0x015600C0, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B00E7, -1 }, { 0x015400D9, -1 }, { 0x01700064, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2025011C, -1 }, { 0x00000000, 0 }, { 0x011400F6, -1 }, { 0x015200F2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058011B, -1 },
+    { 0x0112010F, -1 }, { 0x201D004F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00DB, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0050004E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00F4, -2 },
+    { 0x00000000, 0 }, { 0x0054014D, -1 }, { 0x00000000, 0 }, { 0x004E0067, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A010D, -1 }, { 0x00000000, 0 }, { 0x00520166, -2 }, { 0x00CB00EB, -1 },
+    { 0x012800E5, -1 }, { 0x014700E3, -1 }, { 0x016600E1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20180126, -1 }, { 0x00000000, 0 }, { 0x0121201D, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01240117, -1 }, { 0x01430115, -1 }, { 0x01620113, -1 },
+    { 0x20100059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C200C3, 1 },
+    { 0x00000000, 0 }, { 0x00DE004E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00660155, -1 },
+    { 0x00C000DC, -2 }, { 0x00410071, -1 }, { 0x00C3014F, -1 }, { 0x00DC0067, -1 },
+    { 0x011A0063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10168, -2 }, { 0x00DD00F3, -2 }, { 0x011E0162, -1 }, { 0x015900EB, -1 },
+    { 0x017800E9, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB010C, -1 }, { 0x01760102, -3 },
+    { 0x0059002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500D4, -1 }, { 0x00000000, 0 }, { 0x0155011D, -1 },
+    { 0x0174011B, -2 }, { 0x00570047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0115013A, -1 }, { 0x005800D3, -1 }, { 0x015000C3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C2025, -3 }, { 0x00000000, 0 },
+    { 0x0059015F, -2 }, { 0x0170014D, -1 }, { 0x00000000, 0 }, { 0x00720077, 1 },
+    { 0x00CF0071, -1 }, { 0x016A0067, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540105, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0138, -1 }, { 0x201A00C5, 1 }, { 0x0052011E, -1 },
+    { 0x016C017F, -1 }, { 0x00000000, 0 }, { 0x0125002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0151, -2 }, { 0x201800DE, -1 },
+    { 0x00000000, 0 }, { 0x01290129, 1 }, { 0x002E00C6, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019016A, -1 },
+    { 0x00000000, 0 }, { 0x002F0152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004900F6, -1 },
+    { 0x00C500EE, -1 }, { 0x01000077, -2 }, { 0x011F0075, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040176, -3 },
+    { 0x00280111, -1 }, { 0x0066010D, -1 }, { 0x00C30107, -1 }, { 0x0178201A, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10120, -1 }, { 0x00000000, 0 }, { 0x00DD00AB, -1 },
+    { 0x0175002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB00C4, -2 }, { 0x005C0059, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC0150, -1 },
+    { 0x00000000, 0 }, { 0x017400D3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0056201D, 1 }, { 0x0075201B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590117, -2 }, { 0x014C2026, -2 },
+    { 0x01700105, -1 }, { 0x0072002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E011E, -1 },
+    { 0x201C0064, -2 }, { 0x00000000, 0 }, { 0x0051004A, 3 }, { 0x0149003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00F0, -3 },
+    { 0x00000000, 0 }, { 0x005200D6, -1 }, { 0x014A00C6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0109, -2 },
+    { 0x00000000, 0 }, { 0x00530162, -1 }, { 0x00CC00E7, -1 }, { 0x016A0150, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190122, -2 }, { 0x00000000, 0 }, { 0x00CD0173, -1 }, { 0x002F010A, -1 },
+    { 0x00E900FE, -1 }, { 0x0103201B, -1 }, { 0x012A016D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006B011F, 1 }, { 0x00C80119, -1 }, { 0x00000000, 0 }, { 0x0046003B, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440054, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480153, -1 }, { 0x004500E0, -1 },
+    { 0x00C100D8, -1 }, { 0x00C4014B, -1 }, { 0x00DD0063, -2 }, { 0x01780059, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20164, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F62025, -1 }, { 0x00DC0108, -1 }, { 0x011D0177, 1 }, { 0x01580100, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA0121, -1 }, { 0x00000000, 0 },
+    { 0x00580043, -1 }, { 0x00D4003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013200C1, -1 }, { 0x0056005C, 1 }, { 0x00D20054, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250175, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0114014F, -1 }, { 0x005700E8, -2 }, { 0x00EF006B, 2 }, { 0x016E00D6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006F201E, -1 }, { 0x00550101, -1 }, { 0x00AD201A, -1 },
+    { 0x00CC2018, -1 }, { 0x012E00F3, -1 }, { 0x01500164, -1 }, { 0x00000000, 0 },
+    { 0x201E0134, 2 }, { 0x201B00C1, -3 }, { 0x004E2039, -1 }, { 0x016A0108, -1 },
+    { 0x2018004E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C014D, -2 }, { 0x201900DA, -1 }, { 0x00000000, 0 },
+    { 0x01680121, -1 }, { 0x002F00C2, -2 }, { 0x002C004F, -1 }, { 0x004E00C0, -1 },
+    { 0x0162003B, -2 }, { 0x00000000, 0 }, { 0x201A0166, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00EA0142, -1 }, { 0x004C00D9, -1 }, { 0x00E4005C, -2 },
+    { 0x01410056, -2 }, { 0x01600054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0167, -1 }, { 0x01640153, -1 }, { 0x00C600EA, -1 },
+    { 0x00C30077, -2 }, { 0x010400E6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0048010B, -1 },
+    { 0x00C40103, -1 }, { 0x00FD201E, -2 }, { 0x010200FF, -2 }, { 0x011C201C, -1 },
+    { 0x012100FD, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C2011C, -1 }, { 0x00000000, 0 }, { 0x0157002C, -2 },
+    { 0x0176002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00A10137, -1 }, { 0x00000000, 0 }, { 0x00DC00C0, -2 },
+    { 0x01360047, -1 }, { 0x01740043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD014C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01150062, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0176015B, -2 },
+    { 0x00572019, 1 }, { 0x007B00F8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01140107, -1 }, { 0x01520103, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x012E00AB, -1 }, { 0x010C003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016A00C0, -2 }, { 0x00AD0059, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0105, -2 },
+    { 0x00000000, 0 }, { 0x00CD00E3, -1 }, { 0x002F007A, -2 }, { 0x004E0078, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A011E, -1 },
+    { 0x00000000, 0 }, { 0x00520177, -1 }, { 0x004F0104, -1 }, { 0x00CE016F, -1 },
+    { 0x012800F6, -1 }, { 0x014700F4, -1 }, { 0x016600F2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E011F, 1 },
+    { 0x00C90115, -1 }, { 0x0126010F, -1 }, { 0x0145010D, -1 }, { 0x0164010B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201300DD, -1 },
+    { 0x002C0138, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0049014F, -1 }, { 0x00C200D4, -1 }, { 0x00000000, 0 },
+    { 0x00BF0061, -1 }, { 0x013B0059, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00470168, -1 }, { 0x00C000ED, -1 },
+    { 0x00000000, 0 }, { 0x00DC0078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0135201D, 1 },
+    { 0x00DD0104, -3 }, { 0x0154201B, -1 }, { 0x017800FA, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB011D, -1 }, { 0x01570115, -1 }, { 0x01760113, -2 },
+    { 0x0170002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202500E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D600C3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E201D, -3 }, { 0x20260171, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005800E4, -1 }, { 0x00550071, -1 }, { 0x012E0063, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0070201A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016A0078, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01472025, -2 }, { 0x2019004A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0149, -1 }, { 0x201A00D6, -1 }, { 0x00000000, 0 }, { 0x014A011F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0125003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00EB013E, -1 }, { 0x0129013A, 1 }, { 0x01040056, -3 }, { 0x014500C5, -1 },
+    { 0x016400C3, -2 }, { 0x00000000, 0 }, { 0x2019017B, -1 }, { 0x00000000, 0 },
+    { 0x002F0163, -1 }, { 0x004E0161, -1 }, { 0x002C00F0, -1 }, { 0x00670079, 1 },
+    { 0x0102006F, -1 }, { 0x0121006D, 1 }, { 0x012400E0, -1 }, { 0x017E0067, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00442026, -2 }, { 0x00490107, -1 },
+    { 0x00C500FF, -2 }, { 0x00DF201C, -1 }, { 0x00FE201A, -1 }, { 0x011D2018, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280122, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0139002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10131, -1 }, { 0x00000000, 0 }, { 0x004200C6, -1 }, { 0x01560041, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB00D5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041016B, -1 }, { 0x00582015, -1 },
+    { 0x00DC0161, -1 }, { 0x013600E8, -1 }, { 0x015500E6, -1 }, { 0x017400E4, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01560172, -1 },
+    { 0x005B010F, -1 }, { 0x00D22026, -2 }, { 0x014E201E, -2 }, { 0x016D201C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CF003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D000C6, -1 }, { 0x010E00C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0101, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01470064, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B011A, -1 },
+    { 0x00CF016B, -1 }, { 0x00500100, -2 }, { 0x00CC00F8, -1 }, { 0x012C0165, -1 },
+    { 0x016A0161, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190133, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F011B, -3 }, { 0x004E0119, -1 },
+    { 0x00CA0111, -1 }, { 0x01602026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002A00C1, -3 }, { 0x00000000, 0 }, { 0x015D003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C100E9, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20175, -2 }, { 0x00DE0100, -2 },
+    { 0x01000171, -1 }, { 0x011F016F, 1 }, { 0x013E016D, 1 }, { 0x01742015, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410123, 1 }, { 0x00DC0119, -1 }, { 0x011A0115, -1 }, { 0x005A003B, -1 },
+    { 0x20250055, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600E1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0151, -1 }, { 0x005900E0, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00522018, -1 },
+    { 0x00D60164, -1 }, { 0x013000EB, -1 }, { 0x016E00E7, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016C0100, -2 }, { 0x00000000, 0 }, { 0x004F002C, -2 },
+    { 0x006E002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B00D2, -1 }, { 0x00000000, 0 }, { 0x016A0119, -1 }, { 0x00000000, 0 },
+    { 0x002E0047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C015E, -1 }, { 0x201900EB, -3 }, { 0x00000000, 0 }, { 0x00700142, 1 },
+    { 0x002F00D3, -1 }, { 0x00C70056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0177, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0128014F, -1 }, { 0x00C800E2, -1 }, { 0x00C5006F, -1 }, { 0x0147014D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0178, -2 }, { 0x00E02018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD002C, -3 }, { 0x00FC002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C2012D, -1 }, { 0x01000129, -1 }, { 0x013E0125, 3 }, { 0x0176003B, -1 },
+    { 0x017C0121, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C00146, -1 }, { 0x00FE0142, 1 }, { 0x004100DB, -2 }, { 0x00F8005C, -2 },
+    { 0x01360058, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD015D, -2 }, { 0x00592011, -1 }, { 0x00DA00EA, -1 },
+    { 0x011800E6, -1 }, { 0x01780153, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0109, -1 },
+    { 0x0130201C, -1 }, { 0x014F201A, -1 }, { 0x015400FB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014C002E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0071, -3 }, { 0x00000000, 0 }, { 0x00D100C2, -1 },
+    { 0x00520057, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E00FD, -2 }, { 0x00000000, 0 }, { 0x007200E1, -1 },
+    { 0x00000000, 0 }, { 0x01290062, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0116, -1 }, { 0x004C201B, -2 },
+    { 0x00CD00F4, -1 }, { 0x016800EA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CB010D, -1 }, { 0x01232026, -1 }, { 0x01280107, -1 },
+    { 0x01470105, -1 }, { 0x01660103, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0028004A, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0149, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450061, -1 }, { 0x00C10059, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C200E5, -1 }, { 0x010000E1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00660177, 1 }, { 0x00C30171, -1 }, { 0x01562013, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0115, -2 },
+    { 0x0159010D, -1 }, { 0x0178010B, -2 }, { 0x20260051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C00C3, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500F6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800F5, -1 },
+    { 0x011200E9, -1 }, { 0x010F0076, 1 }, { 0x012E0074, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CD2025, -1 },
+    { 0x01100102, -1 }, { 0x201B0042, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00CE, -1 },
+    { 0x00000000, 0 }, { 0x00540127, 1 }, { 0x00000000, 0 }, { 0x002F0043, -1 },
+    { 0x004E0041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D015A, -1 },
+    { 0x201A00E7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20180100, -3 }, { 0x00000000, 0 }, { 0x00CC0151, -1 },
+    { 0x002E00E8, -1 }, { 0x01040067, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0046201E, -2 }, { 0x002C0101, -1 }, { 0x004B00FF, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015B2025, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30129, -1 },
+    { 0x00000000, 0 }, { 0x00DC0041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x017800C3, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB00E6, -1 }, { 0x0116006F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00582026, -1 }, { 0x00D4201E, -2 },
+    { 0x00F3201C, -1 }, { 0x00F800FD, 1 }, { 0x01312018, -1 }, { 0x013600F9, -1 },
+    { 0x0139016C, -1 }, { 0x0158016A, -1 }, { 0x017400F5, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005800AD, -1 }, { 0x0055003A, -1 }, { 0x012E002C, -1 },
+    { 0x014D002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E006D, -1 }, { 0x0132012B, 1 }, { 0x005600C6, -3 }, { 0x016A0041, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A2018, -3 },
+    { 0x00000000, 0 }, { 0x00570152, -1 }, { 0x014F0142, 1 }, { 0x00000000, 0 },
+    { 0x00CD0064, -1 }, { 0x0149005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0112, -1 }, { 0x00000000, 0 }, { 0x002E2019, -3 },
+    { 0x00CE00F0, -1 }, { 0x014A00E8, -1 }, { 0x01660073, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00500111, -1 }, { 0x00CC0109, -1 }, { 0x0162201E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190144, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x012200C2, -1 }, { 0x00C20055, -2 }, { 0x01000051, -1 }, { 0x00000000, 0 },
+    { 0x20150176, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040150, -1 },
+    { 0x002800EB, -1 }, { 0x006600E7, -1 }, { 0x00C0006E, -1 }, { 0x00C300E1, -1 },
+    { 0x012000DB, -1 }, { 0x013C0066, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00670173, 1 }, { 0x00C100FA, -1 }, { 0x00C4016D, -1 }, { 0x01020169, -1 },
+    { 0x01210167, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013E017E, 1 }, { 0x00BF0113, -1 }, { 0x01742026, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01580122, -1 },
+    { 0x20250066, 1 }, { 0x017400AD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600F2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017200C6, -2 }, { 0x00580065, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C0164, -1 }, { 0x00000000, 0 }, { 0x017000DF, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057010A, -1 },
+    { 0x00D30102, -1 }, { 0x013000FC, -1 }, { 0x016E00F8, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CC203A, -1 },
+    { 0x00550123, -1 }, { 0x00D1011B, -1 }, { 0x012E0115, -1 }, { 0x006E003B, -1 },
+    { 0x016C0111, -1 }, { 0x201A0057, -3 }, { 0x201D00CA, -1 }, { 0x201B00E3, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005000C9, -1 }, { 0x002E0058, 1 },
+    { 0x004D0056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201900FC, -1 }, { 0x00000000, 0 }, { 0x00CD014D, -1 }, { 0x002F00E4, -3 },
+    { 0x002C0071, -1 }, { 0x004B006F, -1 }, { 0x004E00E2, -1 }, { 0x01240061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0047201A, -1 },
+    { 0x00662018, 1 }, { 0x00C800F3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011E2025, -1 }, { 0x01040108, -1 }, { 0x00000000, 0 }, { 0x0044002E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01020121, 1 }, { 0x0121011F, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011F0138, 1 },
+    { 0x00DE00C9, -1 }, { 0x011C00C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C00157, -1 }, { 0x004100EC, -1 }, { 0x00D9006F, -1 }, { 0x00DC00E2, -1 },
+    { 0x0117006B, -1 }, { 0x013900DC, -1 }, { 0x01550067, -1 }, { 0x015800DA, -1 },
+    { 0x00420178, -1 }, { 0x00D5201A, -2 }, { 0x00F42018, -1 }, { 0x01702010, -1 },
+    { 0x01740065, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C011C, -1 },
+    { 0x0154010C, -1 }, { 0x00D2002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2025014F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700C2, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0058014E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00710066, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007200F2, -1 },
+    { 0x012C00E6, -1 }, { 0x016A00E2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D00178, -1 }, { 0x010E0174, -1 },
+    { 0x00CD0105, -1 }, { 0x0144201C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01042039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0160002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010400C0, 1 },
+    { 0x00470059, -1 }, { 0x00C30051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004800E5, -1 },
+    { 0x00C400DD, -3 }, { 0x010200D9, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041201D, -2 },
+    { 0x00490171, -1 }, { 0x00C200F6, -1 }, { 0x00C50169, -1 }, { 0x00DC2013, -1 },
+    { 0x010000F2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C0010F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0178011C, -1 },
+    { 0x015600AB, -1 }, { 0x0134003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C00D4, -1 }, { 0x015400C4, 1 }, { 0x00590061, -2 }, { 0x00D50059, -1 },
+    { 0x0170004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250107, -1 },
+    { 0x01360152, -1 }, { 0x011400E1, -1 }, { 0x0174014E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00532025, -1 }, { 0x00580106, -1 }, { 0x007A0177, 1 },
+    { 0x016A2013, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00C6, 1 }, { 0x0056011F, -2 },
+    { 0x201B0053, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019006C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D016B, -1 }, { 0x201A00F8, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C80063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180111, -2 }, { 0x00000000, 0 }, { 0x0050016A, -1 }, { 0x002E00F9, -1 },
+    { 0x012600E9, -1 }, { 0x01230076, 1 }, { 0x01420074, 1 }, { 0x014500E7, -1 },
+    { 0x016400E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01430100, -1 }, { 0x00000000, 0 }, { 0x0045002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50121, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00660140, 1 }, { 0x00C000C7, -1 },
+    { 0x0041005C, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10153, -1 },
+    { 0x017800D4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00430174, -1 },
+    { 0x00BF016C, -1 }, { 0x00DE016A, -1 }, { 0x011C0166, -1 }, { 0x013B0164, -1 },
+    { 0x015A0162, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0136010A, -1 }, { 0x01740106, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2026014B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01150125, -1 },
+    { 0x0172011F, -1 }, { 0x010F003F, 2 }, { 0x014D003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0113013E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016E0151, -1 }, { 0x005400F0, -1 }, { 0x0051007D, 6 },
+    { 0x00CD0075, -1 }, { 0x012A006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0123, -3 }, { 0x00000000, 0 }, { 0x0126201A, -1 }, { 0x00CE0101, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800C9, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0123002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190155, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004900E1, -1 }, { 0x00C500D9, -2 },
+    { 0x0065006C, -1 }, { 0x015D005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006600F8, -1 },
+    { 0x00C300F2, -1 }, { 0x011D0079, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00450113, -1 }, { 0x00C1010B, -1 }, { 0x0176201E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250077, -2 }, { 0x00000000, 0 },
+    { 0x013600C2, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260103, -1 }, { 0x0156014C, -1 },
+    { 0x005B00E9, -1 }, { 0x00000000, 0 }, { 0x00580076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0175, -1 }, { 0x00590102, -3 }, { 0x017000F0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057011B, -2 }, { 0x0130010D, -1 },
+    { 0x016E0109, -1 }, { 0x201C004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00DB, -1 }, { 0x016C0122, -1 },
+    { 0x005200C1, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0167, -1 }, { 0x201B00F4, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005000DA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019010D, -3 },
+    { 0x00000000, 0 }, { 0x00510166, -1 }, { 0x002F00F5, -3 }, { 0x004E00F3, -1 },
+    { 0x00CA00EB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F017F, -1 }, { 0x01280171, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01040119, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C100C3, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2014F, -1 }, { 0x00BF00DC, -1 },
+    { 0x00DB0067, -1 }, { 0x00DE00DA, -1 }, { 0x0100014B, -1 }, { 0x011F0149, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00168, -2 },
+    { 0x004100FD, -2 }, { 0x00DC00F3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01322025, -2 }, { 0x00DA010C, -1 }, { 0x01560104, 1 }, { 0x0058002E, -1 },
+    { 0x0077002C, -2 }, { 0x01590177, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560047, -1 }, { 0x0110003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700D3, -1 }, { 0x010E0054, -1 }, { 0x016E00C1, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B2025, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01120153, -1 }, { 0x00D100E4, -1 }, { 0x00520079, -1 }, { 0x00CE0071, -1 },
+    { 0x012B006B, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E011F, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00720103, -1 }, { 0x016A00F3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201900C5, -4 }, { 0x00000000, 0 }, { 0x0168010C, -1 },
+    { 0x004E00AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0151, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018016A, -1 }, { 0x00000000, 0 },
+    { 0x002E0152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0028006C, 2 },
+    { 0x00660068, 1 }, { 0x0120005C, -1 }, { 0x017D0056, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C016B, -1 }, { 0x004800F6, -1 }, { 0x004B0169, -1 },
+    { 0x00C400EE, -1 }, { 0x010200EA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01220174, -1 }, { 0x0046010F, -1 },
+    { 0x00C20107, -1 }, { 0x01000103, -1 }, { 0x013E00FF, 1 }, { 0x01410172, -1 },
+    { 0x0158201C, -1 }, { 0x01600170, -1 }, { 0x0177201A, -2 }, { 0x00000000, 0 },
+    { 0x00C00120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0174002E, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0178012D, 1 }, { 0x00DA00C4, -2 },
+    { 0x01720047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0150, -1 }, { 0x007B00E3, -1 },
+    { 0x00D800DD, -1 }, { 0x015400D5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F80167, 1 },
+    { 0x0174015F, -1 }, { 0x011400F2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00580117, -1 }, { 0x0112010B, -1 }, { 0x201D004B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0064, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0050004A, -1 }, { 0x0148003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00F0, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016800C4, -2 }, { 0x002F0065, -3 }, { 0x004E0063, -1 },
+    { 0x01080057, -1 }, { 0x201D017C, -1 }, { 0x201A0109, -1 }, { 0x00000000, 0 },
+    { 0x00520162, -2 }, { 0x00CB00E7, -1 }, { 0x012800E1, -1 }, { 0x0163006A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180122, -1 },
+    { 0x00000000, 0 }, { 0x00672025, -1 }, { 0x002E010A, -1 }, { 0x00CC0173, -1 },
+    { 0x00E800FE, -1 }, { 0x0102201B, -3 }, { 0x01212019, 2 }, { 0x012600FA, -1 },
+    { 0x014500F8, -1 }, { 0x016400F6, -1 }, { 0x00000000, 0 }, { 0x002C0123, 1 },
+    { 0x01240113, -1 }, { 0x01430111, -1 }, { 0x0045003B, -1 }, { 0x0162010F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE004A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00660151, -1 }, { 0x00C000D8, -1 }, { 0x0041006D, -1 },
+    { 0x00C3014B, -1 }, { 0x00DC0063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10164, -2 }, { 0x00DD00EF, 1 },
+    { 0x015900E7, -1 }, { 0x017800E5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F52025, -1 },
+    { 0x00DB0108, -1 }, { 0x013B0175, -1 }, { 0x0059002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D90121, -1 }, { 0x0136011B, -1 }, { 0x00570043, -1 },
+    { 0x00D3003B, -1 }, { 0x01550119, -1 }, { 0x01740117, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059015B, -2 }, { 0x00000000, 0 },
+    { 0x005600E8, -2 }, { 0x00EE006B, 2 }, { 0x016A0063, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540101, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0134, -1 },
+    { 0x201A00C1, 1 }, { 0x004D2039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B014D, -2 }, { 0x201800DA, -1 }, { 0x00000000, 0 }, { 0x01290125, 1 },
+    { 0x002E00C2, 1 }, { 0x01040041, 1 }, { 0x0161003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190166, -1 }, { 0x00000000, 0 }, { 0x002F014E, -1 },
+    { 0x00E90142, -1 }, { 0x002C00DB, -2 }, { 0x00E3005C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004900F2, -1 }, { 0x00C20077, -2 },
+    { 0x00C500EA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01040172, -2 }, { 0x0028010D, -1 }, { 0x00660109, -1 },
+    { 0x00C30103, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C1011C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB00C0, -2 }, { 0x005C0055, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DC014C, -1 }, { 0x00000000, 0 }, { 0x013600D3, -1 },
+    { 0x0171005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00562019, 1 },
+    { 0x007A00F8, 1 }, { 0x017200E8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01540176, -2 },
+    { 0x00590113, -2 }, { 0x010E2026, -2 }, { 0x01700101, -1 }, { 0x201E0047, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00EC, -1 }, { 0x00000000, 0 }, { 0x005200D2, -1 },
+    { 0x014A00C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0178, -2 }, { 0x00000000, 0 }, { 0x201B0105, -2 }, { 0x016A014C, -1 },
+    { 0x005000EB, -1 }, { 0x00CC00E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019011E, -2 }, { 0x00000000, 0 },
+    { 0x00C5201B, -3 }, { 0x002F0106, -1 }, { 0x004E0104, -1 }, { 0x00CD016F, -1 },
+    { 0x012A0169, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C80115, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004700C3, -1 }, { 0x00000000, 0 }, { 0x00A1004A, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0048014F, -1 }, { 0x00C100D4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB0078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011D0173, 1 }, { 0x00DC0104, -2 },
+    { 0x015800FC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DA011D, -1 }, { 0x01180119, -1 }, { 0x00000000, 0 }, { 0x0150002F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D500C3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250171, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700E4, -2 },
+    { 0x00540071, -1 }, { 0x016E00D2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006F201A, -1 },
+    { 0x00D100F5, -1 }, { 0x010F00F1, 1 }, { 0x016C00EB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016A0104, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201900D6, -2 }, { 0x00000000, 0 }, { 0x0168011D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0124003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0162, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EA013E, -1 },
+    { 0x00000000, 0 }, { 0x01220054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0163, -1 },
+    { 0x01260153, -1 }, { 0x004A00EE, 1 }, { 0x00660079, 1 }, { 0x00C600E6, -1 },
+    { 0x010400E2, -1 }, { 0x01450151, -1 }, { 0x0164014F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FD201A, -2 }, { 0x00480107, -1 }, { 0x00C400FF, -2 },
+    { 0x010200FB, -1 }, { 0x011C2018, -1 }, { 0x012100F9, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00131, -1 },
+    { 0x00000000, 0 }, { 0x004100C6, 1 }, { 0x01360043, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA00D5, -1 }, { 0x005B006A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB0161, -1 }, { 0x00572015, -1 }, { 0x007B00F4, -1 },
+    { 0x011600EA, -1 }, { 0x01700071, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D12026, -2 },
+    { 0x01140103, -1 }, { 0x014D201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x012C2039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CE003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E00E8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0101, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016800D5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520173, -1 },
+    { 0x004F0100, -1 }, { 0x00CB00F8, -1 }, { 0x00CE016B, -1 }, { 0x01042013, -1 },
+    { 0x012800F2, -1 }, { 0x014700F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E011B, -1 }, { 0x00C90111, -1 }, { 0x0126010B, -1 },
+    { 0x01450109, -1 }, { 0x015F2026, -1 }, { 0x01640107, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0134, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015C003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011C0057, -1 }, { 0x013B0055, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00470164, -1 }, { 0x00C000E9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10175, -2 }, { 0x00DD0100, -3 }, { 0x01352019, 1 },
+    { 0x015900F8, -1 }, { 0x017800F6, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0119, -1 },
+    { 0x01570111, -1 }, { 0x0176010F, -2 }, { 0x0059003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500E1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026016D, -1 }, { 0x201E2019, -3 },
+    { 0x00000000, 0 }, { 0x005B0153, -1 }, { 0x005800E0, -1 }, { 0x00000000, 0 },
+    { 0x00D10065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D50164, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014C0102, -1 }, { 0x20190046, -1 }, { 0x004E002C, -2 }, { 0x006D002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0145, -1 }, { 0x201A00D2, -1 },
+    { 0x0145203A, -1 }, { 0x014A011B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B015E, -1 },
+    { 0x201800EB, -2 }, { 0x00000000, 0 }, { 0x006F0142, 1 }, { 0x002E00D3, -1 },
+    { 0x00EB013A, -1 }, { 0x014500C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F015F, -2 }, { 0x004E015D, -1 },
+    { 0x004B00EA, -1 }, { 0x00670075, 1 }, { 0x00C4006F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002D0178, -1 },
+    { 0x004C0176, -2 }, { 0x00490103, -1 }, { 0x00C500FB, -1 }, { 0x00DF2018, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0028011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DC002C, -2 }, { 0x00FB002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1012D, -1 },
+    { 0x004200C2, -1 }, { 0x00000000, 0 }, { 0x0175003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x017600C7, -1 }, { 0x007B0064, -1 }, { 0x01540056, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410167, -1 }, { 0x00582011, -1 }, { 0x00D900EA, -1 }, { 0x00DC015D, -1 },
+    { 0x013600E4, -1 }, { 0x0152006F, -1 }, { 0x015500E2, -1 }, { 0x017400E0, -2 },
+    { 0x00000000, 0 }, { 0x00BB0178, -1 }, { 0x005B010B, -1 }, { 0x0110201E, -2 },
+    { 0x014E201A, -2 }, { 0x0156016E, -1 }, { 0x016D2018, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0058, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016A002C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0071, -2 }, { 0x00000000, 0 }, { 0x00D000C2, -1 }, { 0x00510057, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B0116, -1 }, { 0x002C201D, -3 }, { 0x00CC00F4, -1 },
+    { 0x00CF0167, -1 }, { 0x012900EE, 1 }, { 0x016A015D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019012F, -1 }, { 0x00000000, 0 },
+    { 0x002F0117, -3 }, { 0x004E0115, -1 }, { 0x00CA010D, -1 }, { 0x01222026, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004900BB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002800D6, -1 },
+    { 0x00000000, 0 }, { 0x00C00059, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C100E5, -1 }, { 0x015C00DB, -1 }, { 0x011B006C, -1 }, { 0x01780066, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C20171, -1 }, { 0x00BF00FE, -1 }, { 0x0100016D, -1 }, { 0x011F016B, 1 },
+    { 0x01362015, -1 }, { 0x013E0169, 1 }, { 0x01742011, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041011F, 1 }, { 0x00DC0115, -1 },
+    { 0x011A0111, -1 }, { 0x00D6002F, -1 }, { 0x20250051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600DD, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007B014D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014E0059, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00522014, -1 }, { 0x005700F5, -2 }, { 0x013000E7, -1 },
+    { 0x016E00E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CC2025, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00CE, -1 }, { 0x00000000, 0 },
+    { 0x012C0119, -1 }, { 0x016A0115, -1 }, { 0x002E0043, -1 }, { 0x0164002F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C015A, -1 }, { 0x201900E7, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0173, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CB0151, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0174, -3 }, { 0x004D0172, -1 },
+    { 0x010400F3, -1 }, { 0x012300F1, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015A2025, -1 }, { 0x0102010C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20129, -1 }, { 0x011F0123, 1 },
+    { 0x00DB0041, -2 }, { 0x017C011D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015800C5, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01590151, -1 }, { 0x00DA00E6, -1 }, { 0x007A0079, 1 }, { 0x011800E2, -1 },
+    { 0x0153006B, -1 }, { 0x0178014F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00572026, -3 }, { 0x007B0105, -1 }, { 0x00D3201E, -2 },
+    { 0x00F2201C, -1 }, { 0x01302018, -1 }, { 0x016E2014, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700AD, -1 }, { 0x0054003A, -2 }, { 0x010E002E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D006D, -1 },
+    { 0x00000000, 0 }, { 0x005500C6, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00F9, -1 },
+    { 0x00560152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CC0064, -1 },
+    { 0x00EB0062, -1 }, { 0x0148005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0112, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CD00F0, -1 },
+    { 0x012A00EA, -1 }, { 0x016800E6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CB0109, -1 },
+    { 0x01280103, -1 }, { 0x01470101, -1 }, { 0x0161201E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010400AB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010200C4, 1 },
+    { 0x00C10055, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20140176, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004600E9, -1 },
+    { 0x00C200E1, -1 }, { 0x010000DD, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C3016D, -1 },
+    { 0x00440102, -1 }, { 0x00C000FA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0111, -2 }, { 0x01590109, -1 }, { 0x01780107, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760120, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0170003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500F2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570065, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01720152, -1 }, { 0x011200E5, -1 }, { 0x00000000, 0 }, { 0x010F0072, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012A201B, -1 }, { 0x0056010A, -1 }, { 0x00D20102, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00CA, -1 }, { 0x00540123, -1 },
+    { 0x20190057, -1 }, { 0x00000000, 0 }, { 0x006D003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0156, -1 }, { 0x201A00E3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012800BB, -1 }, { 0x004C0056, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CC014D, -1 }, { 0x002E00E4, -1 }, { 0x00000000, 0 },
+    { 0x01040063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046201A, -2 }, { 0x002C00FD, -2 },
+    { 0x004B00FB, -1 }, { 0x014300EB, -1 }, { 0x016200E9, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011D2025, -1 },
+    { 0x00C5010C, -1 }, { 0x00000000, 0 }, { 0x0062002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0066012B, 1 }, { 0x00000000, 0 }, { 0x00410047, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB00E2, -1 }, { 0x005C0077, -1 }, { 0x017600D8, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410178, -3 },
+    { 0x00D4201A, -2 }, { 0x00F32018, -1 }, { 0x013600F5, -1 }, { 0x01390168, -1 },
+    { 0x015500F3, -1 }, { 0x01580166, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0172010A, -1 }, { 0x00000000, 0 },
+    { 0x00D1002E, -2 }, { 0x00F0002C, -1 }, { 0x010F002A, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01700123, -1 },
+    { 0x005600C2, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057014E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010B005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D010E, -1 },
+    { 0x00D1015F, -1 }, { 0x00000000, 0 }, { 0x014A00E4, -1 }, { 0x01470071, -1 },
+    { 0x0166006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0050010D, -1 }, { 0x00CC0105, -1 },
+    { 0x0124201E, -1 }, { 0x0162201A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190140, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015F002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500C4, 1 }, { 0x00C20051, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0104014C, -1 }, { 0x002800E7, -1 }, { 0x006600E3, -1 },
+    { 0x00A1006C, -1 }, { 0x00C300DD, -3 }, { 0x01420148, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480171, -1 }, { 0x0067016F, 1 },
+    { 0x00C100F6, -1 }, { 0x00C40169, -1 }, { 0x00DB2013, -1 }, { 0x01020165, -1 },
+    { 0x01210163, 1 }, { 0x01590079, 1 }, { 0x00000000, 0 }, { 0x013E017A, 1 },
+    { 0x00BF010F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0158011E, -1 }, { 0x00000000, 0 }, { 0x013600AD, -1 },
+    { 0x0133003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013400C6, -1 }, { 0x00580061, -1 }, { 0x00D40059, -1 }, { 0x017200C2, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01540150, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00570106, -1 }, { 0x013000F8, -1 }, { 0x016E00F4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00C6, -4 }, { 0x0055011F, -1 }, { 0x00D10117, -1 },
+    { 0x012E0111, -1 }, { 0x016C010D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0152, -1 }, { 0x00000000, 0 }, { 0x203A00DD, -1 }, { 0x00000000, 0 },
+    { 0x005000C5, -2 }, { 0x002E0054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900F8, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F00E0, -3 }, { 0x002C006D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040104, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C40121, 1 }, { 0x0102011D, 1 }, { 0x00000000, 0 }, { 0x0178002F, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00650140, -1 }, { 0x00DE00C5, -2 }, { 0x011C00C1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00153, -1 }, { 0x004100E8, -1 },
+    { 0x015800D6, -1 }, { 0x01360065, -1 }, { 0x01550063, -1 }, { 0x01740061, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420174, -2 }, { 0x0059201E, -3 },
+    { 0x011800F3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016E2025, -2 }, { 0x01540108, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025014B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014C003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016C00C5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E010A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CF00E8, -1 }, { 0x00CC0075, -1 }, { 0x012C00E2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0123, -2 },
+    { 0x00D00174, -1 }, { 0x01442018, -1 }, { 0x00CD0101, -1 }, { 0x012A00FB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0068003A, -1 }, { 0x0122002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00470055, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004800E1, -1 }, { 0x00C400D9, -2 }, { 0x010200D5, -1 },
+    { 0x015C005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0049016D, -1 }, { 0x00412019, -2 }, { 0x00C200F2, -1 },
+    { 0x00C50165, -1 }, { 0x010000EE, -1 }, { 0x013B0077, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01200178, -1 }, { 0x00C0010B, -1 },
+    { 0x0175201E, -2 }, { 0x017A00FF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0122, -1 }, { 0x01542039, -1 }, { 0x00000000, 0 }, { 0x00F6003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01190137, -1 }, { 0x00000000, 0 }, { 0x015400C0, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250103, -1 }, { 0x0136014E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016E0064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580102, 1 }, { 0x011200F6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E00C2, 1 }, { 0x0056011B, -2 }, { 0x201B004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00DB, -1 }, { 0x20190068, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A00F4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018010D, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E00F5, -1 }, { 0x00C900EB, -1 }, { 0x01040074, -1 },
+    { 0x01230072, 1 }, { 0x012600E5, -1 }, { 0x01420070, 1 }, { 0x014500E3, -1 },
+    { 0x016400E1, -1 }, { 0x011F201D, 2 }, { 0x004B010C, -1 }, { 0x013E201B, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C5011D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00280140, 2 }, { 0x0066013C, 1 }, { 0x00410058, 1 }, { 0x00C000C3, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C1014F, -1 }, { 0x00000000, 0 }, { 0x00DA0067, -1 },
+    { 0x01180063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0168, -1 }, { 0x00DB00F3, -1 },
+    { 0x00DE0166, -1 }, { 0x011C0162, -1 }, { 0x015700EB, -1 }, { 0x017600E9, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC017F, -1 },
+    { 0x00D9010C, -1 }, { 0x01360106, -1 }, { 0x0057002E, -3 }, { 0x0076002C, -2 },
+    { 0x01580177, -1 }, { 0x01740102, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0172011B, -1 }, { 0x00000000, 0 }, { 0x00550047, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0113013A, -1 }, { 0x005600D3, -1 },
+    { 0x014E00C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057015F, -1 }, { 0x01300151, -1 },
+    { 0x016E014D, -1 }, { 0x00CD0071, -1 }, { 0x01680067, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D011F, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014A00F5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201800C5, -3 }, { 0x016A017F, -1 }, { 0x00000000, 0 }, { 0x004D00AB, -1 },
+    { 0x0123002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190151, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C00C6, 1 }, { 0x004B00C4, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C500D5, -1 }, { 0x00650068, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01420159, 1 }, { 0x002800F8, -1 }, { 0x006600F4, -1 }, { 0x00C300EE, -1 },
+    { 0x011D0075, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01020176, -3 }, { 0x0045010F, -1 }, { 0x00C10107, -1 },
+    { 0x0176201A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D900C4, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202600FF, -2 }, { 0x00DA0150, -1 }, { 0x005B00E5, -1 }, { 0x017200D3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054201D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570117, -2 }, { 0x01300109, -1 }, { 0x014A2026, -2 }, { 0x016E0105, -1 },
+    { 0x201C004B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016C011E, -1 }, { 0x201A0064, -1 }, { 0x00000000, 0 },
+    { 0x004F004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0163, -1 },
+    { 0x00000000, 0 }, { 0x201B00F0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C017C, -1 }, { 0x20190109, -3 }, { 0x00000000, 0 }, { 0x00510162, -1 },
+    { 0x002F00F1, -1 }, { 0x00CA00E7, -1 }, { 0x01680150, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00662025, -2 }, { 0x0101201B, -1 }, { 0x0128016D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C60119, -1 }, { 0x01040115, -1 },
+    { 0x00000000, 0 }, { 0x0044003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670138, 1 },
+    { 0x00000000, 0 }, { 0x00420054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00460153, -1 }, { 0x00C2014B, -1 }, { 0x00000000, 0 }, { 0x00DB0063, -1 },
+    { 0x01760059, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C00164, -2 }, { 0x004100F9, -1 }, { 0x011A00EB, -1 },
+    { 0x01360076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F42025, -1 }, { 0x00DA0108, -1 },
+    { 0x01560100, 1 }, { 0x01780171, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0130203A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560043, -1 }, { 0x00D2003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D00054, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0112014F, -1 }, { 0x005500E8, -1 },
+    { 0x00520075, -1 }, { 0x00D100E0, -1 }, { 0x014A0065, -1 }, { 0x016C00D6, -1 },
+    { 0x00000000, 0 }, { 0x201E011B, -1 }, { 0x00000000, 0 }, { 0x014E0164, -1 },
+    { 0x007200FF, 1 }, { 0x00CF00F9, -1 }, { 0x012C00F3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900C1, -4 },
+    { 0x00000000, 0 }, { 0x01680108, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A014D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01470123, -1 }, { 0x01660121, -1 },
+    { 0x00000000, 0 }, { 0x0160003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E014E, -1 }, { 0x00E80142, -1 },
+    { 0x00000000, 0 }, { 0x00280068, 2 }, { 0x00660064, -1 }, { 0x00E2005C, -2 },
+    { 0x015E0054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0167, -1 },
+    { 0x01620153, -1 }, { 0x004800F2, -1 }, { 0x00C10077, -2 }, { 0x00C400EA, -1 },
+    { 0x010200E6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50176, -3 }, { 0x0046010B, -1 }, { 0x00C20103, -1 }, { 0x010000FF, -2 },
+    { 0x011F00FD, 1 }, { 0x01220170, -1 }, { 0x013E00FB, 1 }, { 0x0141016E, -1 },
+    { 0x01582018, -1 }, { 0x0160016C, -1 }, { 0x00000000, 0 }, { 0x00C0011C, -1 },
+    { 0x00000000, 0 }, { 0x0155002C, -2 }, { 0x0174002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026006F, -1 },
+    { 0x01780129, 1 }, { 0x00DA00C0, -2 }, { 0x01720043, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB014C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01130062, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00F80163, 1 }, { 0x0136015F, -1 }, { 0x015200EA, -1 },
+    { 0x0174015B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580113, -1 },
+    { 0x01120107, -1 }, { 0x201D0047, -2 }, { 0x0052002D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00D3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012C00AB, -1 }, { 0x00500046, -1 },
+    { 0x010A003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012D0137, 2 }, { 0x00000000, 0 }, { 0x016800C0, -2 },
+    { 0x002F0061, -3 }, { 0x00AB0059, -1 }, { 0x00000000, 0 }, { 0x201D0178, -1 },
+    { 0x00000000, 0 }, { 0x201A0105, -1 }, { 0x00000000, 0 }, { 0x00CB00E3, -1 },
+    { 0x00000000, 0 }, { 0x01630066, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2018011E, -1 }, { 0x00000000, 0 }, { 0x00C4201B, -3 },
+    { 0x002E0106, -1 }, { 0x00CC016F, -1 }, { 0x012600F6, -1 }, { 0x014500F4, -1 },
+    { 0x016400F2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C011F, 1 }, { 0x0124010F, -1 }, { 0x0143010D, -1 },
+    { 0x0162010B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201100DD, -1 }, { 0x00000000, 0 }, { 0x004600C3, -2 },
+    { 0x00000000, 0 }, { 0x00DE0046, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280151, -1 },
+    { 0x0066014D, -1 }, { 0x00410069, -1 }, { 0x00C000D4, -1 }, { 0x01390059, -2 },
+    { 0x01580057, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD00EB, -2 }, { 0x015900E3, -1 }, { 0x00DA0078, -1 },
+    { 0x017800E1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0104, -2 }, { 0x017600FA, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D9011D, -1 },
+    { 0x01360117, -1 }, { 0x01550115, -1 }, { 0x016E002D, -1 }, { 0x01740113, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D400C3, -1 }, { 0x00000000, 0 }, { 0x012E004A, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005600E4, -2 }, { 0x0072006F, -1 },
+    { 0x012C0063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012D00EF, 1 },
+    { 0x00000000, 0 }, { 0x01680078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0130, -1 }, { 0x00000000, 0 }, { 0x01452025, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800D6, -1 },
+    { 0x00000000, 0 }, { 0x00EB0125, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190162, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E9013E, -1 }, { 0x004B00D5, -1 },
+    { 0x01020056, -3 }, { 0x014300C5, -1 }, { 0x016200C3, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C500E6, -1 }, { 0x0100006F, -1 }, { 0x011F006D, 1 }, { 0x013E006B, 3 },
+    { 0x016000DC, -1 }, { 0x017C0067, 1 }, { 0x00000000, 0 }, { 0x0104016E, -2 },
+    { 0x00280109, -1 }, { 0x00422026, -1 }, { 0x00660105, -1 }, { 0x00C300FF, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C0051, -1 }, { 0x01540041, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410152, -1 },
+    { 0x00000000, 0 }, { 0x00D900D5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DA0161, -1 }, { 0x00562015, -1 }, { 0x005B00F6, -1 }, { 0x017200E4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01540172, -1 }, { 0x0059010F, -2 }, { 0x00D02026, -2 },
+    { 0x014C201E, -2 }, { 0x016B201C, -1 }, { 0x201E0043, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CD003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00E8, -3 },
+    { 0x201A0075, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0174, -3 }, { 0x00000000, 0 },
+    { 0x201B0101, -2 }, { 0x00000000, 0 }, { 0x005000E7, -1 }, { 0x00000000, 0 },
+    { 0x002E0076, -2 }, { 0x01450064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019011A, -1 }, { 0x00CD016B, -1 }, { 0x002F0102, -2 },
+    { 0x004E0100, -1 }, { 0x00CA00F8, -1 }, { 0x012A0165, -1 }, { 0x01680161, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C80111, -1 }, { 0x015E2026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015B003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670149, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01780051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF00E9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C00175, -2 }, { 0x0041010A, -1 }, { 0x00DC0100, -2 }, { 0x011D016F, 1 },
+    { 0x01722015, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA0119, -1 }, { 0x01180115, -1 },
+    { 0x00000000, 0 }, { 0x0058003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0138, -1 },
+    { 0x005900C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2025016D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700E0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D40164, -1 }, { 0x010F00ED, 1 }, { 0x012E00EB, -1 },
+    { 0x016C00E7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016A0100, -2 },
+    { 0x20180046, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0145, -1 }, { 0x201900D2, -2 }, { 0x00000000, 0 },
+    { 0x01680119, -1 }, { 0x00000000, 0 }, { 0x002C0047, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00EA013A, -1 }, { 0x00000000, 0 }, { 0x0068005C, -2 },
+    { 0x00C50056, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0126014F, -1 }, { 0x00C600E2, -1 },
+    { 0x00280079, 2 }, { 0x00C3006F, -1 }, { 0x0145014D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0178, -2 }, { 0x00000000, 0 },
+    { 0x00480103, -1 }, { 0x00C400FB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB002C, -2 },
+    { 0x00FA002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C0012D, -1 }, { 0x004100C2, 1 },
+    { 0x017A0121, 1 }, { 0x0174003B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011B0140, -1 },
+    { 0x00000000, 0 }, { 0x005B0066, 2 }, { 0x00F6005C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB015D, -1 },
+    { 0x00572011, -1 }, { 0x007B00F0, -1 }, { 0x011600E6, -1 }, { 0x01760153, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012E201C, -1 }, { 0x014D201A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0058, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014A002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00E4, -1 }, { 0x201B0071, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00500057, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0072, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0052016F, -1 }, { 0x00CB00F4, -1 }, { 0x00CE0167, -1 },
+    { 0x014A015F, -1 }, { 0x016600EA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0117, -1 },
+    { 0x00C9010D, -1 }, { 0x01212026, -1 }, { 0x01260107, -1 }, { 0x01450105, -1 },
+    { 0x01640103, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004800BB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF0059, -1 }, { 0x00DE0057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C000E5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10171, -1 },
+    { 0x00DD00FC, -1 }, { 0x01542013, -1 }, { 0x015900F4, -1 }, { 0x017800F2, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB0115, -1 }, { 0x0157010D, -1 }, { 0x0176010B, -2 },
+    { 0x00D5002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500DD, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260169, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B014F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D10061, -1 }, { 0x010F005D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005600F5, -2 }, { 0x00000000, 0 }, { 0x012C0074, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01300173, -1 }, { 0x010E0102, -1 }, { 0x0166201B, 1 },
+    { 0x20190042, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0141, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014A0117, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B015A, -1 }, { 0x201800E7, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190173, -1 }, { 0x00000000, 0 },
+    { 0x002F015B, -2 }, { 0x00CA0151, -1 }, { 0x002C00E8, -1 }, { 0x004B00E6, -1 },
+    { 0x01020067, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004C0172, -1 }, { 0x0044201E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01592025, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10129, -1 }, { 0x00000000, 0 }, { 0x00DA0041, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0142, -1 }, { 0x017600C3, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410163, -1 }, { 0x00000000, 0 },
+    { 0x00D900E6, -1 }, { 0x0114006F, -1 }, { 0x013600E0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260121, 1 }, { 0x00BB0174, -1 },
+    { 0x00562026, -3 }, { 0x005B0107, -1 }, { 0x00D2201E, -2 }, { 0x00F1201C, -1 },
+    { 0x0110201A, -2 }, { 0x0156016A, -1 }, { 0x017200F5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590120, -1 }, { 0x201E0054, -1 }, { 0x005600AD, -1 },
+    { 0x0053003A, -1 }, { 0x012C002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005400C6, -2 }, { 0x01680041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00F9, -1 }, { 0x00550152, -1 },
+    { 0x010F0146, 1 }, { 0x014D0142, 1 }, { 0x00CB0064, -1 }, { 0x00EA0062, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0112, -1 },
+    { 0x00CF0163, -1 }, { 0x002C2019, -3 }, { 0x005000F8, -1 }, { 0x00CC00F0, -1 },
+    { 0x01640073, -1 }, { 0x2015002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0113, -3 }, { 0x004E0111, -1 },
+    { 0x00CA0109, -1 }, { 0x0160201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002800D2, -1 }, { 0x012000C2, -1 }, { 0x00A10057, -1 },
+    { 0x00C00055, -2 }, { 0x00000000, 0 }, { 0x20130176, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01020150, -1 }, { 0x004500E9, -1 }, { 0x00C100E1, -1 },
+    { 0x011B0068, -1 }, { 0x011E00DB, -1 }, { 0x01590064, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2016D, -1 }, { 0x01000169, -1 },
+    { 0x011F0167, 1 }, { 0x01362011, -1 }, { 0x013E0165, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0041011B, -1 }, { 0x00DC0111, -1 }, { 0x011A010D, -1 }, { 0x01722026, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202600D9, -2 }, { 0x01560122, -1 }, { 0x00000000, 0 }, { 0x017200AD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0149, -1 }, { 0x005900D8, -1 },
+    { 0x017000C6, -2 }, { 0x00560065, -2 }, { 0x01100059, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00522010, -1 },
+    { 0x013000E3, -1 }, { 0x016E00DF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0055010A, -1 }, { 0x00D10102, -1 }, { 0x010F00FE, 3 },
+    { 0x012E00FC, -1 }, { 0x016C00F8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B00CA, -1 }, { 0x00720121, -1 }, { 0x00CF011B, -1 },
+    { 0x012C0115, -1 }, { 0x016A0111, -1 }, { 0x20180057, -1 }, { 0x00000000, 0 },
+    { 0x201C0156, -1 }, { 0x201900E3, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0058, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A016F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CB014D, -1 }, { 0x00000000, 0 }, { 0x0049006F, -1 }, { 0x00C50067, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0170, -2 }, { 0x004D016E, -1 }, { 0x00C600F3, -1 }, { 0x010400EF, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011C2025, -1 }, { 0x00C4010C, -1 },
+    { 0x01020108, -1 }, { 0x0042002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0046012D, 1 }, { 0x01000121, 1 }, { 0x011F011F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00A10140, -1 }, { 0x004100D3, -1 }, { 0x011D0138, 1 },
+    { 0x015800C1, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0159014D, -1 }, { 0x00DA00E2, -1 },
+    { 0x0115006B, -1 }, { 0x015600DA, -1 }, { 0x01720065, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D3201A, -2 },
+    { 0x007B0101, -1 }, { 0x00F22018, -1 }, { 0x016E2010, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D0002E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0069, -1 }, { 0x00000000, 0 }, { 0x005500C2, -2 },
+    { 0x0052004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E00F5, -1 }, { 0x0056014E, -1 }, { 0x00000000, 0 },
+    { 0x005300DB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C010E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012A00E6, -1 }, { 0x016800E2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010C0174, -1 }, { 0x0123201E, -1 }, { 0x00CB0105, -1 }, { 0x0161201A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01022039, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015E002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C400C4, 1 }, { 0x00C10051, -1 }, { 0x010200C0, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50150, -1 }, { 0x004600E5, -1 }, { 0x00C200DD, -3 }, { 0x00BF006A, 2 },
+    { 0x010000D9, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C30169, -1 }, { 0x00C000F6, -1 }, { 0x00DA2013, -1 },
+    { 0x01580079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD010D, -2 },
+    { 0x01590105, -1 }, { 0x01780103, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0176011C, -1 }, { 0x015400AB, -1 }, { 0x0132003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570061, -2 }, { 0x00D30059, -1 }, { 0x016E004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0172014E, -1 }, { 0x011200E1, -1 },
+    { 0x015000DD, -1 }, { 0x010F006E, 1 }, { 0x201D0021, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00512025, -2 },
+    { 0x00560106, -1 }, { 0x01682013, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00C6, -3 }, { 0x0054011F, -1 }, { 0x20190053, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0152, -2 },
+    { 0x00000000, 0 }, { 0x203900DD, -1 }, { 0x00000000, 0 }, { 0x004F00C5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201800F8, -2 }, { 0x00000000, 0 }, { 0x00500151, -1 },
+    { 0x002E00E0, -1 }, { 0x00000000, 0 }, { 0x00C60063, -1 }, { 0x0123005D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C00F9, -1 }, { 0x012400E9, -1 }, { 0x01210076, 1 },
+    { 0x014300E7, -1 }, { 0x016200E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50108, -1 }, { 0x01220102, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00660127, 1 },
+    { 0x00C30121, 1 }, { 0x00410043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD00C5, -3 }, { 0x00BB0054, -1 }, { 0x017800BB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0153, -1 }, { 0x017600D4, -1 }, { 0x007B0071, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410174, -3 }, { 0x0058201E, -1 }, { 0x013600F1, -1 },
+    { 0x01390164, -1 }, { 0x01580162, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01720106, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01130125, -1 }, { 0x0170011F, -1 }, { 0x201E0065, -1 },
+    { 0x014B003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D010A, -2 }, { 0x00D1015B, -1 }, { 0x010F0157, 1 },
+    { 0x00CE00E8, -1 }, { 0x0128006F, -1 }, { 0x014A00E0, -1 }, { 0x016C0151, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0123, -2 }, { 0x00000000, 0 },
+    { 0x00500109, -1 }, { 0x00CC0101, -1 }, { 0x0105201C, -1 }, { 0x0124201A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019013C, -1 },
+    { 0x00000000, 0 }, { 0x00C52039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0121002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C500C0, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040148, -1 },
+    { 0x002800E3, -1 }, { 0x00C300D9, -2 }, { 0x00A10068, -1 }, { 0x01230146, 1 },
+    { 0x01420144, 1 }, { 0x015B005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0048016D, -1 }, { 0x0067016B, 1 }, { 0x00C100F2, -1 }, { 0x00C40165, -1 },
+    { 0x01780073, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF010B, -1 }, { 0x00F82026, -1 },
+    { 0x0174201E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC0122, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F5003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600EA, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013400C2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0154014C, -1 }, { 0x005900E9, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570102, -3 },
+    { 0x013000F4, -1 }, { 0x016E00F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00C2, -4 },
+    { 0x0055011B, -1 }, { 0x00D10113, -1 }, { 0x012E010D, -1 }, { 0x016C0109, -1 },
+    { 0x201A004F, -1 }, { 0x00000000, 0 }, { 0x201E014E, -1 }, { 0x00000000, 0 },
+    { 0x201B00DB, -1 }, { 0x016A0122, -1 }, { 0x005000C1, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201900F4, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F0166, -1 },
+    { 0x00C800EB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01260171, -1 }, { 0x01040100, 1 }, { 0x014200FC, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670123, 1 }, { 0x00C4011D, 1 },
+    { 0x0042003F, -1 }, { 0x01020119, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0065013C, -1 },
+    { 0x00DE00C1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2026201B, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C0014F, -1 }, { 0x004100E4, -1 }, { 0x00D90067, -1 }, { 0x011D0149, 1 },
+    { 0x01360061, -1 }, { 0x015800D2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00420170, -1 }, { 0x0059201A, -3 }, { 0x00DA00F3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB017F, -1 }, { 0x01302025, -1 },
+    { 0x01540104, 1 }, { 0x0056002E, -3 }, { 0x01570177, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010E003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D007A, -1 }, { 0x00000000, 0 }, { 0x005500D3, -1 }, { 0x016C00C1, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20192025, -4 },
+    { 0x201E0106, -1 }, { 0x0056015F, -1 }, { 0x00000000, 0 }, { 0x007200EA, -1 },
+    { 0x00CC0071, -1 }, { 0x00CF00E4, -1 }, { 0x0129006B, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C011F, -2 }, { 0x00000000, 0 }, { 0x002D2026, -1 },
+    { 0x016800F3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0138, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180151, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A00C4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0152, -1 }, { 0x004B0150, -1 },
+    { 0x00C400D5, -1 }, { 0x011E005C, -1 }, { 0x017B0056, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490169, -1 },
+    { 0x00412015, -1 }, { 0x004600F6, -1 }, { 0x00C200EE, -1 }, { 0x010000EA, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01200174, -1 }, { 0x00BB2026, -1 }, { 0x00C00107, -1 }, { 0x0156201C, -1 },
+    { 0x015E0170, -1 }, { 0x0175201A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD011E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0172002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0176012D, 1 }, { 0x00D800C4, -1 }, { 0x00590059, 1 }, { 0x01700047, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500FF, -2 },
+    { 0x00D90150, -1 }, { 0x00000000, 0 }, { 0x00D600DD, -1 }, { 0x01300064, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0172015F, -1 }, { 0x00000000, 0 }, { 0x011200F2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560117, -2 },
+    { 0x201B004B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190064, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0146003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A00F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014700C6, -1 },
+    { 0x01060057, -1 }, { 0x016600C4, -2 }, { 0x00000000, 0 }, { 0x201B017C, -1 },
+    { 0x20180109, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E00F1, -1 },
+    { 0x00C900E7, -1 }, { 0x01040070, -1 }, { 0x0123006E, 1 }, { 0x012600E1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0100201B, -3 },
+    { 0x002C010A, -1 }, { 0x004B0108, -1 }, { 0x00E600FE, -1 }, { 0x011F2019, 2 },
+    { 0x012400FA, -1 }, { 0x014300F8, -1 }, { 0x016200F6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50119, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0043003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0028013C, 2 }, { 0x00660138, -1 },
+    { 0x00410054, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450153, -1 },
+    { 0x00C1014B, -1 }, { 0x00DD00D6, -1 }, { 0x00DA0063, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE0162, -1 }, { 0x015700E7, -1 }, { 0x017600E5, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00F32025, -1 }, { 0x00D90108, -1 }, { 0x01360102, 1 },
+    { 0x0057002A, 1 }, { 0x01390175, -1 }, { 0x01580173, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01720117, -1 },
+    { 0x00000000, 0 }, { 0x00550043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0076, -2 }, { 0x011000C3, -1 }, { 0x0053005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0057015B, -1 }, { 0x0130014D, -1 }, { 0x005400E8, -1 }, { 0x00000000, 0 },
+    { 0x01680063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D011B, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CE00F9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800C1, -3 }, { 0x004B2039, -1 },
+    { 0x0050011A, -1 }, { 0x00000000, 0 }, { 0x00E5002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019014D, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C00C2, 1 }, { 0x004B00C0, 1 },
+    { 0x01020041, 1 }, { 0x015F003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00E1005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040159, -1 }, { 0x002800F4, -1 },
+    { 0x006600F0, -1 }, { 0x00C00077, -2 }, { 0x00C300EA, -1 }, { 0x01230157, 1 },
+    { 0x01420155, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40176, -3 },
+    { 0x0045010B, -1 }, { 0x00C10103, -1 }, { 0x01020172, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE011A, -1 }, { 0x00000000, 0 },
+    { 0x0173002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025006F, -1 }, { 0x00000000, 0 },
+    { 0x00D900C0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600FB, -1 }, { 0x00DA014C, -1 },
+    { 0x005B00E1, -1 }, { 0x00000000, 0 }, { 0x016F005C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00542019, 1 }, { 0x005900FA, -1 }, { 0x007800F8, 1 },
+    { 0x017000E8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570113, -2 }, { 0x01300105, -1 },
+    { 0x016E0101, -1 }, { 0x201C0047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00D3, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190105, -3 }, { 0x0168014C, -1 }, { 0x004E00EB, -1 }, { 0x00CA00E3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C3201B, -3 }, { 0x01280169, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C60115, -1 }, { 0x01040111, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201000DD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046014F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004100F5, -1 }, { 0x00DC00EB, -1 }, { 0x00D90078, -1 }, { 0x00F80076, 1 },
+    { 0x011A00E7, -1 }, { 0x01360072, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0151201B, -1 }, { 0x00DA0104, -2 }, { 0x015600FC, -1 }, { 0x0178016D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01160119, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014E002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D300C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005500E4, -1 }, { 0x016C00D2, -1 }, { 0x014A0061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0117, -1 },
+    { 0x00000000, 0 }, { 0x01100164, -1 }, { 0x00CF00F5, -1 }, { 0x016A00EB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0130, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01680104, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0149, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00EA0125, -1 }, { 0x0147011F, -1 }, { 0x00C50041, 1 }, { 0x0166011D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00E8013E, -1 }, { 0x00000000, 0 }, { 0x00280064, -1 },
+    { 0x01200054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0163, -1 }, { 0x004B0161, -1 }, { 0x00C400E6, -1 },
+    { 0x010200E2, -1 }, { 0x01240153, -1 }, { 0x01430151, -1 }, { 0x0162014F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50172, -2 }, { 0x0122016C, -1 },
+    { 0x00460107, -1 }, { 0x00C200FF, -2 }, { 0x010000FB, -1 }, { 0x011F00F9, 1 },
+    { 0x0141016A, -1 }, { 0x01582014, -1 }, { 0x01600168, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004100AD, -1 }, { 0x00F8002E, -1 },
+    { 0x0136002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C00DD, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D90161, -1 },
+    { 0x00552015, -1 }, { 0x011400EA, -1 }, { 0x01300075, -1 }, { 0x0136015B, -1 },
+    { 0x015200E6, -1 }, { 0x016E0071, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0058010F, -1 }, { 0x00CF2026, -1 }, { 0x01120103, -1 },
+    { 0x201D0043, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012A2039, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00500042, -1 }, { 0x00CC003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00E8, -2 }, { 0x00EF0137, 2 },
+    { 0x20190075, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0174, -1 }, { 0x00000000, 0 }, { 0x201A0101, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E7006A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2018011A, -1 }, { 0x0067201D, 2 }, { 0x002E0102, 1 }, { 0x00C900F8, -1 },
+    { 0x00CC016B, -1 }, { 0x01022013, -1 }, { 0x012600F2, -1 }, { 0x014500F0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C011B, -1 },
+    { 0x004B0119, -1 }, { 0x0124010B, -1 }, { 0x01430109, -1 }, { 0x015D2026, -1 },
+    { 0x01620107, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0042, -1 },
+    { 0x015A003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0028014D, -1 }, { 0x00660149, -1 }, { 0x00000000, 0 },
+    { 0x00410065, -1 }, { 0x01390055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00E7, -2 },
+    { 0x017800DD, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00792025, -2 },
+    { 0x00DB0100, -2 }, { 0x015700F8, -1 }, { 0x017600F6, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D90119, -1 }, { 0x01360113, -1 }, { 0x01550111, -1 },
+    { 0x0057003B, -2 }, { 0x0174010F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800C7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590153, -2 },
+    { 0x005600E0, -2 }, { 0x00000000, 0 }, { 0x00CF0065, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D30164, -1 }, { 0x00EF00EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D012C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014A0102, -1 }, { 0x00000000, 0 },
+    { 0x002D002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B0145, -1 }, { 0x201800D2, -1 }, { 0x0143203A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019015E, -1 }, { 0x00000000, 0 }, { 0x002F0146, -1 },
+    { 0x00E9013A, -1 }, { 0x002C00D3, -1 }, { 0x00C40056, -3 }, { 0x014300C1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004900EA, -1 }, { 0x00C2006F, -1 },
+    { 0x00C500E2, -1 }, { 0x012200DC, -1 }, { 0x014100DA, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0104016A, -2 }, { 0x00280105, -1 },
+    { 0x00660101, -1 }, { 0x00C300FB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BB002E, -1 }, { 0x00DA002C, -2 },
+    { 0x00F9002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C004D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0041014E, -1 }, { 0x00000000, 0 }, { 0x017400C7, -1 },
+    { 0x00F5005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2026010C, -1 }, { 0x00DA015D, -1 }, { 0x00562011, -1 },
+    { 0x005B00F2, -1 }, { 0x017200E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C017E, 1 },
+    { 0x0059010B, -2 }, { 0x00D80176, -1 }, { 0x010E201E, -2 }, { 0x014C201A, -2 },
+    { 0x0154016E, -1 }, { 0x016B2018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0168002C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00E4, -3 }, { 0x010F0131, 1 }, { 0x201A0071, -1 },
+    { 0x00000000, 0 }, { 0x004F0057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0170, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005000E3, -1 }, { 0x00AD00DD, -1 }, { 0x002E0072, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190116, -1 },
+    { 0x0049201B, -1 }, { 0x00C52013, -1 }, { 0x00CA00F4, -1 }, { 0x00CD0167, -1 },
+    { 0x0168015D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C8010D, -1 }, { 0x01202026, -1 },
+    { 0x00000000, 0 }, { 0x0046002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040122, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF00E5, -1 }, { 0x013B00DD, -2 },
+    { 0x0119006C, -1 }, { 0x015A00DB, -1 }, { 0x01760066, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00171, -1 }, { 0x00410106, -1 },
+    { 0x011A00F8, -1 }, { 0x011D016B, 1 }, { 0x01722011, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0178017E, -1 },
+    { 0x00DA0115, -1 }, { 0x01180111, -1 }, { 0x202600C4, 1 }, { 0x00D4002F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B0134, 1 }, { 0x005900C3, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250169, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014C0059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005500F5, -1 }, { 0x012E00E7, -1 }, { 0x016C00E3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20180042, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0141, -1 },
+    { 0x201900CE, -1 }, { 0x00000000, 0 }, { 0x012A0119, -1 }, { 0x01680115, -1 },
+    { 0x002C0043, -1 }, { 0x004B0041, 1 }, { 0x0162002F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C90151, -1 }, { 0x010400DA, -2 }, { 0x00660071, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0174, -3 }, { 0x0062201C, -1 }, { 0x006700FD, 1 }, { 0x010200F3, -1 },
+    { 0x012100F1, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0100010C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C00129, -1 }, { 0x011D0123, 1 }, { 0x00D90041, -2 }, { 0x0136003B, -1 },
+    { 0x017A011D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011B013C, -1 }, { 0x015600C5, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01570151, -1 }, { 0x011600E2, -1 },
+    { 0x0176014F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250121, 1 }, { 0x00000000, 0 }, { 0x00552026, -2 },
+    { 0x00D1201E, -2 }, { 0x00F0201C, -1 }, { 0x012E2018, -1 }, { 0x016C2014, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580120, -1 }, { 0x201D0054, -1 }, { 0x005500AD, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E00E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005100DF, -1 }, { 0x002F006E, -1 }, { 0x00CA0064, -1 }, { 0x00E90062, -1 },
+    { 0x0146005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0052016B, -1 },
+    { 0x00CE0163, -1 }, { 0x00CB00F0, -1 }, { 0x012800EA, -1 }, { 0x014700E8, -1 },
+    { 0x014A015B, -1 }, { 0x016600E6, -1 }, { 0x2014002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0113, -1 }, { 0x00C90109, -1 }, { 0x01260103, -1 },
+    { 0x00660029, 1 }, { 0x01450101, -1 }, { 0x015F201E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010200AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010000C4, 1 }, { 0x00BF0055, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C000E1, -1 }, { 0x00000000, 0 }, { 0x00410076, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C1016D, -1 }, { 0x00420102, -1 }, { 0x00DD00F8, -2 },
+    { 0x015900F0, -1 }, { 0x017800EE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0111, -1 },
+    { 0x01570109, -1 }, { 0x01760107, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500D9, -2 },
+    { 0x01740120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260165, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800D8, -1 }, { 0x00000000, 0 },
+    { 0x00550065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01700152, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0128201B, -1 },
+    { 0x00D00102, -1 }, { 0x0130016F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D013D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00710121, 1 }, { 0x00CE011B, -1 }, { 0x014A0113, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0156, -1 },
+    { 0x201800E3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012600BB, -1 },
+    { 0x00000000, 0 }, { 0x0104004A, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019016F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0157, -1 },
+    { 0x002C00E4, -1 }, { 0x0048006F, -1 }, { 0x004B00E2, -1 }, { 0x0067006D, 1 },
+    { 0x00C40067, 1 }, { 0x00CA014D, -1 }, { 0x01020063, -1 }, { 0x004C016E, -1 },
+    { 0x0044201A, -2 }, { 0x004900FB, -1 }, { 0x00C500F3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01420177, 1 }, { 0x00C3010C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF013E, -1 }, { 0x00000000, 0 }, { 0x00D80056, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011A0151, -1 }, { 0x00D900E2, -1 }, { 0x017400D8, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2026011D, 1 }, { 0x00000000, 0 }, { 0x00D2201A, -2 }, { 0x005B0103, -1 },
+    { 0x00F12018, -1 }, { 0x01560166, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0059011C, -1 }, { 0x0170010A, -1 }, { 0x00CF002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016E0123, -1 }, { 0x005400C2, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00F5, -3 }, { 0x0055014E, -1 }, { 0x010F0142, 3 }, { 0x005200DB, -1 },
+    { 0x0109005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B010E, -1 }, { 0x00000000, 0 }, { 0x004B2013, -1 },
+    { 0x005000F4, -1 }, { 0x01450071, -1 }, { 0x0164006F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190127, -1 }, { 0x00000000, 0 },
+    { 0x002F010F, -3 }, { 0x004E010D, -1 }, { 0x00CA0105, -1 }, { 0x0122201E, -1 },
+    { 0x0141201C, -2 }, { 0x0160201A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500AB, -1 },
+    { 0x015D002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040133, -1 }, { 0x01230131, 1 },
+    { 0x00C300C4, 1 }, { 0x00440059, -1 }, { 0x00C00051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40150, -1 },
+    { 0x004500E5, -1 }, { 0x00C100DD, -3 }, { 0x0102014C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C20169, -1 }, { 0x00BF00F6, -1 }, { 0x00D92013, -1 }, { 0x01000165, -1 },
+    { 0x011F0163, 1 }, { 0x013E0161, 1 }, { 0x01570079, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410117, -1 }, { 0x00DC010D, -1 },
+    { 0x011A0109, -1 }, { 0x01342026, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600D5, -1 }, { 0x0156011E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005900D4, -1 }, { 0x013200C6, -1 }, { 0x00560061, -2 },
+    { 0x00D20059, -1 }, { 0x017000C2, -2 }, { 0x00000000, 0 }, { 0x201D2026, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0021, -1 }, { 0x00000000, 0 },
+    { 0x012D006C, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00502025, -3 }, { 0x00550106, -1 },
+    { 0x010F00FA, 1 }, { 0x012E00F8, -1 }, { 0x016C00F4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00C6, -3 },
+    { 0x0072011D, -1 }, { 0x00CF0117, -1 }, { 0x012C0111, -1 }, { 0x016A010D, -1 },
+    { 0x20180053, -1 }, { 0x00000000, 0 }, { 0x201C0152, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F00C7, -1 }, { 0x002C0054, -1 },
+    { 0x004E00C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A016B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E016C, -2 },
+    { 0x004D016A, -1 }, { 0x010400EB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE2025, -3 }, { 0x00C40108, -1 }, { 0x01020104, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460129, 1 }, { 0x00650127, -1 },
+    { 0x00C20121, 1 }, { 0x0100011D, 1 }, { 0x0176002F, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00A1013C, -1 },
+    { 0x00DC00C5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0151, -2 }, { 0x015600D6, -1 }, { 0x00000000, 0 }, { 0x01720061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0057201E, -3 }, { 0x005C00FF, -1 }, { 0x011600F3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016C2025, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0065, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00F1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016A00C5, -2 }, { 0x00500064, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C010A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CD00E8, -1 },
+    { 0x012A00E2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0123, 1 }, { 0x00000000, 0 }, { 0x0104201C, -3 },
+    { 0x00CB0101, -1 }, { 0x0123201A, -1 }, { 0x012800FB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C42039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0120002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C400C0, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C5014C, -1 }, { 0x004600E1, -1 },
+    { 0x00C200D9, -2 }, { 0x00BF0066, 2 }, { 0x010000D5, -1 }, { 0x015A005C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30165, -1 },
+    { 0x00000000, 0 }, { 0x00C000F2, -1 }, { 0x01390077, -1 }, { 0x01580075, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011E0178, -1 }, { 0x00DD0109, -2 }, { 0x01590101, -1 }, { 0x00000000, 0 },
+    { 0x007A0029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0122, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00F4003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500EA, -1 }, { 0x01170137, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260176, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005800E9, -1 }, { 0x00000000, 0 }, { 0x010F006A, 1 },
+    { 0x016C0064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560102, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00C2, -3 }, { 0x0054011B, -1 },
+    { 0x2019004F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D014E, -2 }, { 0x00000000, 0 }, { 0x201A00DB, -2 },
+    { 0x00000000, 0 }, { 0x004F00C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800F4, -2 },
+    { 0x00000000, 0 }, { 0x0050014D, -1 }, { 0x002E00DC, -2 }, { 0x004D00DA, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C00F5, -1 },
+    { 0x004B00F3, -1 }, { 0x01020074, -1 }, { 0x01210072, 1 }, { 0x012400E5, -1 },
+    { 0x014300E3, -1 }, { 0x016200E1, -1 }, { 0x00000000, 0 }, { 0x011D201D, 2 },
+    { 0x00C50104, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD203A, -1 }, { 0x00280127, 2 }, { 0x00660123, -1 }, { 0x0041003F, -1 },
+    { 0x00C3011D, 1 }, { 0x0158002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00C1, -3 },
+    { 0x00000000, 0 }, { 0x0118004A, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2025201B, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF014F, -1 },
+    { 0x00000000, 0 }, { 0x007B006D, -1 }, { 0x01160063, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410170, -2 },
+    { 0x0058201A, -1 }, { 0x00D900F3, -1 }, { 0x015500EB, -1 }, { 0x017400E9, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DA017F, -1 }, { 0x01560177, -1 }, { 0x01720102, -2 },
+    { 0x0055002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059012D, 1 },
+    { 0x0170011B, -1 }, { 0x201E0061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C007A, -1 },
+    { 0x00000000, 0 }, { 0x014C00C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20182025, -3 }, { 0x201D0106, -2 },
+    { 0x0055015F, -1 }, { 0x012E0151, -1 }, { 0x00CE00E4, -1 }, { 0x00CB0071, -1 },
+    { 0x01660067, -1 }, { 0x016C014D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B011F, -2 }, { 0x00000000, 0 }, { 0x01052018, -1 }, { 0x00500105, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190138, -1 }, { 0x00000000, 0 }, { 0x002F0120, -1 },
+    { 0x0168017F, -1 }, { 0x004B00AB, -1 }, { 0x0121002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A00C6, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040144, -1 }, { 0x004700DD, -1 },
+    { 0x00C300D5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480169, -1 }, { 0x004500F6, -1 },
+    { 0x00670167, 1 }, { 0x00C100EE, -1 }, { 0x01590071, -1 }, { 0x0178006F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000176, -3 },
+    { 0x0174201A, -3 }, { 0x00BF0107, -1 }, { 0x013B00FF, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DC011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202600E6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005900E5, -2 }, { 0x00D500DD, -1 }, { 0x017000D3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0052201D, -1 }, { 0x00000000, 0 }, { 0x013000F0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550117, -1 }, { 0x00D1010F, -1 },
+    { 0x012E0109, -1 }, { 0x016C0105, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016A011E, -1 },
+    { 0x20180064, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900F0, -3 },
+    { 0x00000000, 0 }, { 0x002F00D8, -1 }, { 0x00000000, 0 }, { 0x002C0065, -1 },
+    { 0x004B0063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004F0162, -1 }, { 0x00C800E7, -1 }, { 0x00000000, 0 },
+    { 0x00C50074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0126016D, -1 }, { 0x010400FC, -1 },
+    { 0x012300FA, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0067011F, 1 }, { 0x00C40119, -1 }, { 0x01020115, -1 }, { 0x0042003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C0014B, -1 }, { 0x004100E0, -1 },
+    { 0x00DC00D6, -1 }, { 0x00D90063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0042016C, -1 },
+    { 0x011800EB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F22025, -1 }, { 0x01540100, 1 }, { 0x01760171, -1 }, { 0x0056002A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012E203A, -1 }, { 0x01520119, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D0003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0052005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0102, 1 }, { 0x0056015B, -1 },
+    { 0x00000000, 0 }, { 0x007200E6, -1 }, { 0x00CF00E0, -1 }, { 0x00EB006B, -1 },
+    { 0x016A00D6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C011B, -2 },
+    { 0x00000000, 0 }, { 0x014C0164, -1 }, { 0x00CD00F9, -1 }, { 0x012A00F3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0134, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00E4002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2018014D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01450123, -1 }, { 0x004A00C0, -1 }, { 0x0028004F, -1 }, { 0x015E003B, -1 },
+    { 0x01640121, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C014E, -1 }, { 0x004B014C, -1 }, { 0x00E60142, -1 }, { 0x00E0005C, -2 },
+    { 0x015C0054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00490165, -1 }, { 0x00412011, -1 }, { 0x004600F2, -1 },
+    { 0x00C200EA, -1 }, { 0x010000E6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30176, -3 }, { 0x01200170, -1 },
+    { 0x00C00103, -1 }, { 0x011D00FD, 1 }, { 0x01562018, -1 }, { 0x015E016C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260056, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0134002E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760129, 1 }, { 0x007B00C6, -1 },
+    { 0x00D800C0, -1 }, { 0x01700043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500FB, -1 }, { 0x00D9014C, -1 }, { 0x01360146, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0172015B, -1 },
+    { 0x005800FA, -1 }, { 0x201D002E, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560113, -2 }, { 0x201B0047, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00D3, -1 }, { 0x01662039, -1 }, { 0x00000000, 0 },
+    { 0x012A00AB, -1 }, { 0x0108003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D015F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012B0137, 2 },
+    { 0x00000000, 0 }, { 0x014700C2, -1 }, { 0x016600C0, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x203A0176, -1 }, { 0x00000000, 0 }, { 0x20180105, -2 },
+    { 0x00000000, 0 }, { 0x00C900E3, -1 }, { 0x00000000, 0 }, { 0x0123006A, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C2201B, -3 }, { 0x002C0106, -1 }, { 0x004B0104, 1 },
+    { 0x012400F6, -1 }, { 0x014300F4, -1 }, { 0x016200F2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50115, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004400C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0045014F, -1 }, { 0x004200DC, -1 }, { 0x00DD00D2, -1 },
+    { 0x01560057, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB00EB, -1 },
+    { 0x015700E3, -1 }, { 0x017600E1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0158016F, -1 },
+    { 0x00D90104, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007A0123, 1 }, { 0x01720113, -1 }, { 0x00000000, 0 },
+    { 0x016C002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0072, -1 }, { 0x00D200C3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A201D, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005400E4, -1 }, { 0x00000000, 0 }, { 0x012A0063, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0117, -3 }, { 0x00000000, 0 },
+    { 0x004D201C, -1 }, { 0x005200FD, -1 }, { 0x00CE00F5, -1 }, { 0x012B00EF, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0130, -1 },
+    { 0x00000000, 0 }, { 0x01432025, -2 }, { 0x00500116, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190149, -1 }, { 0x00000000, 0 }, { 0x002F0131, -1 }, { 0x00E90125, -1 },
+    { 0x00000000, 0 }, { 0x00C40041, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000056, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01040155, -1 }, { 0x002800F0, -1 }, { 0x006600EC, 1 },
+    { 0x00C300E6, -1 }, { 0x011D006D, 1 }, { 0x015E00DC, -1 }, { 0x017A0067, 1 },
+    { 0x00000000, 0 }, { 0x00C40172, -2 }, { 0x0102016E, -2 }, { 0x00450107, -1 },
+    { 0x00C100FF, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE0116, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0131005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900F6, -2 },
+    { 0x017000E4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0057010F, -2 }, { 0x00CE2026, -1 }, { 0x01300101, -1 }, { 0x00510029, 6 },
+    { 0x014A201E, -2 }, { 0x0169201C, -1 }, { 0x201C0043, -1 }, { 0x00000000, 0 },
+    { 0x201D00CF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CB003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B00E8, -2 }, { 0x00EE0137, 2 }, { 0x005000CE, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0174, -1 }, { 0x00000000, 0 }, { 0x20190101, -3 }, { 0x00000000, 0 },
+    { 0x002F00E9, -3 }, { 0x004E00E7, -1 }, { 0x002C0076, -2 }, { 0x01430064, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0066201D, 2 }, { 0x00C800F8, -1 }, { 0x01280165, -1 }, { 0x01660161, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C60111, -1 }, { 0x0104010D, -1 },
+    { 0x015C2026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE00CE, -1 }, { 0x00000000, 0 }, { 0x01760051, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00440164, -1 }, { 0x004100F1, -1 }, { 0x00DC00E7, -1 },
+    { 0x011A00E3, -1 }, { 0x0136006E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0173, -1 }, { 0x00DA0100, -2 },
+    { 0x01702015, -1 }, { 0x01780169, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0121, 2 }, { 0x01160115, -1 }, { 0x00000000, 0 }, { 0x0056003B, -2 },
+    { 0x0110002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700C7, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580153, -1 }, { 0x005500E0, -1 },
+    { 0x00000000, 0 }, { 0x00CE0065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0113, -1 }, { 0x00000000, 0 }, { 0x00D20164, -1 },
+    { 0x00EE00EF, 1 }, { 0x012C00EB, -1 }, { 0x016A00E7, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C012C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01680100, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0147011B, -1 }, { 0x01660119, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2018015E, -1 }, { 0x00000000, 0 }, { 0x002E0146, -1 }, { 0x00E8013A, -1 },
+    { 0x010400C5, 1 }, { 0x0066005C, 2 }, { 0x00C30056, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B015D, -1 },
+    { 0x0124014F, -1 }, { 0x004800EA, -1 }, { 0x00C1006F, -1 }, { 0x00C400E2, -1 },
+    { 0x0143014D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C5016E, -2 }, { 0x01220168, -1 }, { 0x00460103, -1 }, { 0x00C200FB, -1 },
+    { 0x01410166, -1 }, { 0x01582010, -1 }, { 0x01600164, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D9002C, -2 }, { 0x00F8002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260067, 1 },
+    { 0x00DD012B, 1 }, { 0x011B0127, -1 }, { 0x01590123, -1 }, { 0x0172003B, -1 },
+    { 0x01780121, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01190140, -1 }, { 0x005C00D9, -1 }, { 0x00590066, -1 },
+    { 0x00F4005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2025010C, -1 }, { 0x00D9015D, -1 }, { 0x00552011, -1 }, { 0x011400E6, -1 },
+    { 0x01300071, -1 }, { 0x01360157, -1 }, { 0x015200E2, -1 }, { 0x01740153, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058010B, -1 },
+    { 0x012C201C, -1 }, { 0x201D003F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A0056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00E4, -2 }, { 0x20190071, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0170, -1 },
+    { 0x00000000, 0 }, { 0x201A00FD, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00E70066, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180116, -1 }, { 0x0048201B, -1 },
+    { 0x00672019, 2 }, { 0x00C42013, -1 }, { 0x00C900F4, -1 }, { 0x00CC0167, -1 },
+    { 0x01420079, 1 }, { 0x016400EA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0117, -1 }, { 0x004B0115, -1 }, { 0x011F2026, -1 },
+    { 0x01240107, -1 }, { 0x01430105, -1 }, { 0x01620103, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410061, -1 }, { 0x0158004F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD00E3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015700F4, -1 }, { 0x017600F2, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500C4, 1 }, { 0x00D90115, -1 },
+    { 0x0136010F, -1 }, { 0x0155010D, -1 }, { 0x00D3002F, -1 }, { 0x0174010B, -2 },
+    { 0x00000000, 0 }, { 0x20260150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005800C3, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0059014F, -2 }, { 0x00000000, 0 }, { 0x00720067, -1 },
+    { 0x00CF0061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005400F5, -1 },
+    { 0x00000000, 0 }, { 0x012A0074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0128, -1 }, { 0x00000000, 0 }, { 0x010F0175, 1 },
+    { 0x012E0173, -1 }, { 0x0164201B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0141, -1 }, { 0x201800CE, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A0041, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019015A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C80151, -1 },
+    { 0x004900E6, -1 }, { 0x00460073, -1 }, { 0x01000067, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0042201E, -1 }, { 0x00280101, -1 }, { 0x0061201C, -1 }, { 0x006600FD, 1 },
+    { 0x00DD2014, -1 }, { 0x01040166, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01572025, -2 }, { 0x017E0177, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D80041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013600C7, -1 }, { 0x017400C3, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260108, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0112006F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C017A, 1 }, { 0x00542026, -3 }, { 0x00590107, -2 },
+    { 0x00D0201E, -2 }, { 0x010E201A, -2 }, { 0x0154016A, -1 }, { 0x017000F5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570120, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0051003A, -1 }, { 0x012A002C, -1 },
+    { 0x0149002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00E0, -3 },
+    { 0x201A006D, -1 }, { 0x00000000, 0 }, { 0x005200C6, 1 }, { 0x01660041, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E016C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E006E, -1 }, { 0x00C90064, -1 }, { 0x00E80062, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190112, -1 }, { 0x00CD0163, -1 }, { 0x002F00FA, -1 },
+    { 0x004E00F8, -1 }, { 0x00CA00F0, -1 }, { 0x01620073, -1 }, { 0x2013002C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C80109, -1 }, { 0x015E201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0104011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011E00C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20110176, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000150, -1 },
+    { 0x00BF00E1, -1 }, { 0x011C00DB, -1 }, { 0x01190068, -1 }, { 0x013B00D9, -1 },
+    { 0x01570064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C0016D, -1 }, { 0x00410102, 1 }, { 0x00DC00F8, -1 }, { 0x011A00F4, -1 },
+    { 0x011D0167, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0178017A, -1 }, { 0x00DA0111, -1 }, { 0x0118010D, -1 },
+    { 0x01702026, -2 }, { 0x202600C0, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01540122, -1 },
+    { 0x00000000, 0 }, { 0x017000AD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250165, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700D8, -1 }, { 0x016E00C6, -2 }, { 0x00540065, -1 },
+    { 0x010E0059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D100E9, -1 }, { 0x012E00E3, -1 },
+    { 0x016C00DF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0127201B, -1 }, { 0x012C00FC, -1 },
+    { 0x016A00F8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C013D, -1 }, { 0x00000000, 0 }, { 0x201900CA, -1 },
+    { 0x00510123, 2 }, { 0x00CD011B, -1 }, { 0x012A0115, -1 }, { 0x006A003B, -1 },
+    { 0x01680111, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0157, -1 }, { 0x00C9014D, -1 },
+    { 0x00280071, -1 }, { 0x0066006D, -1 }, { 0x00C30067, 1 }, { 0x010400D6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0170, -2 }, { 0x00622018, -1 },
+    { 0x004800FB, -1 }, { 0x006700F9, 1 }, { 0x00C400F3, -1 }, { 0x010200EF, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01410177, -1 }, { 0x00C2010C, -1 }, { 0x01000108, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00A10127, -1 }, { 0x011D011F, 1 },
+    { 0x00000000, 0 }, { 0x00F8003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015600C1, 1 }, { 0x007A005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0157014D, -1 }, { 0x007B00E8, -1 }, { 0x0113006B, -1 }, { 0x015400DA, -1 },
+    { 0x01700065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025011D, 1 },
+    { 0x00000000, 0 }, { 0x00D1201A, -2 }, { 0x00F02018, -1 }, { 0x015200F3, -1 },
+    { 0x016C2010, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058011C, -1 },
+    { 0x201D0050, -1 }, { 0x00CE002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00DC, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00F5, -2 },
+    { 0x00000000, 0 }, { 0x012D0140, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012800E6, -1 },
+    { 0x014700E4, -1 }, { 0x016600E2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010A0174, -1 }, { 0x002E010F, -1 },
+    { 0x00C90105, -1 }, { 0x0121201E, -1 }, { 0x015F201A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01002039, -1 }, { 0x00000000, 0 }, { 0x00C400AB, -1 }, { 0x015C002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C200C4, 1 },
+    { 0x010000C0, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30150, -1 }, { 0x00000000, 0 },
+    { 0x00C000DD, -3 }, { 0x00410072, -1 }, { 0x011A0064, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10169, -1 },
+    { 0x00DD00F4, -2 }, { 0x017800EA, -2 }, { 0x01560079, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB010D, -1 }, { 0x01570105, -1 }, { 0x01760103, -2 },
+    { 0x0059002F, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500D5, -1 }, { 0x01360120, -1 }, { 0x0174011C, -1 },
+    { 0x00000000, 0 }, { 0x0130003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01530137, -1 },
+    { 0x005800D4, -1 }, { 0x015000C4, -1 }, { 0x00550061, -1 }, { 0x016C004F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C2026, -3 }, { 0x00000000, 0 },
+    { 0x0170014E, -1 }, { 0x201B0021, -1 }, { 0x014E00DD, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004F2025, -2 }, { 0x0130016B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0139, -1 }, { 0x00000000, 0 }, { 0x201A00C6, 1 }, { 0x0071011D, 1 },
+    { 0x00CE0117, -1 }, { 0x014A010F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B0152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E00C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019016B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F0153, -3 }, { 0x002C00E0, -1 }, { 0x004E0151, -1 },
+    { 0x00C40063, -1 }, { 0x0121005D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C016A, -1 }, { 0x00C500EF, -1 },
+    { 0x00000000, 0 }, { 0x011F0076, 1 }, { 0x013E0074, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD2025, -3 },
+    { 0x00C30108, -1 }, { 0x01040177, -2 }, { 0x0041002A, -2 }, { 0x01200102, -1 },
+    { 0x01230175, 1 }, { 0x01420173, 1 }, { 0x0159201D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10121, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF013A, -1 }, { 0x00DB00C5, -2 },
+    { 0x017600BB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC0151, -1 },
+    { 0x011A014D, -1 }, { 0x013600D8, -1 }, { 0x01520063, -1 }, { 0x017400D4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260119, -1 }, { 0x00000000, 0 },
+    { 0x0056201E, -3 }, { 0x0075201C, -1 }, { 0x007A00FD, 1 }, { 0x01560162, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01700106, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E011F, -1 },
+    { 0x201C0065, -2 }, { 0x00000000, 0 }, { 0x0149003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00F1, -1 }, { 0x00000000, 0 },
+    { 0x010F013E, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B010A, -1 },
+    { 0x00000000, 0 }, { 0x016A0151, -1 }, { 0x005000F0, -1 }, { 0x00CC00E8, -1 },
+    { 0x0126006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190123, -3 }, { 0x00000000, 0 }, { 0x002F010B, -3 }, { 0x004E0109, -1 },
+    { 0x00CA0101, -1 }, { 0x0103201C, -1 }, { 0x0122201A, -1 }, { 0x01412018, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C32039, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011F002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0104012F, -1 }, { 0x00C300C0, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C4014C, -1 }, { 0x004500E1, -1 }, { 0x00C100D9, -2 },
+    { 0x00DD0064, -2 }, { 0x01020148, -1 }, { 0x01210146, 1 }, { 0x0159005C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20165, -1 }, { 0x00000000, 0 },
+    { 0x00BF00F2, -1 }, { 0x01760073, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410113, -1 }, { 0x00DC0109, -1 }, { 0x00F62026, -1 }, { 0x011A0105, -1 },
+    { 0x0172201E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DA0122, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F3003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013200C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250176, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700E9, -2 }, { 0x00000000, 0 }, { 0x00EF006C, 2 }, { 0x012D0068, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580175, -1 }, { 0x00550102, -2 }, { 0x012E00F4, -1 }, { 0x016C00F0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004E203A, -1 }, { 0x00720119, -1 }, { 0x00CF0113, -1 },
+    { 0x012C010D, -1 }, { 0x016A0109, -1 }, { 0x2018004F, -1 }, { 0x201B00C2, -3 },
+    { 0x201C014E, -1 }, { 0x00000000, 0 }, { 0x201900DB, -1 }, { 0x00510134, 3 },
+    { 0x002F00C3, -2 }, { 0x004E00C1, -1 }, { 0x01680122, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0167, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004C00DA, -1 }, { 0x00000000, 0 }, { 0x01220059, -1 },
+    { 0x01410057, -2 }, { 0x01600055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0168, -2 }, { 0x004D0166, -1 }, { 0x00C600EB, -1 },
+    { 0x010400E7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01240171, -1 }, { 0x00C40104, 1 },
+    { 0x01020100, 1 }, { 0x013B201B, -2 }, { 0x017E00F8, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C2011D, 1 }, { 0x01000119, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC00C1, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD014D, -2 }, { 0x015600D2, -1 },
+    { 0x005B006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057201A, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D9017F, -1 }, { 0x012E2025, -1 }, { 0x01550177, 1 }, { 0x0054002E, -3 },
+    { 0x0073002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0061, -3 }, { 0x00000000, 0 },
+    { 0x00520047, -1 }, { 0x010C003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B007A, -1 }, { 0x00000000, 0 },
+    { 0x016A00C1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0106, -1 }, { 0x0054015F, -1 },
+    { 0x00000000, 0 }, { 0x00CD00E4, -1 }, { 0x00CA0071, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A011F, 1 },
+    { 0x00520178, -2 }, { 0x01042018, -3 }, { 0x014700F5, -1 }, { 0x016600F3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0120, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50148, -1 }, { 0x00000000, 0 }, { 0x00C200D5, -1 }, { 0x00BF0062, -1 },
+    { 0x011C005C, -1 }, { 0x01790056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C000EE, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011E0174, -1 }, { 0x0154201C, -1 },
+    { 0x00DD0105, -2 }, { 0x015900FD, 1 }, { 0x015C0170, -1 }, { 0x017800FB, -1 },
+    { 0x20260041, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0170002E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202500E6, -1 }, { 0x01360131, -1 }, { 0x0174012D, 1 }, { 0x00D600C4, -1 },
+    { 0x016E0047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260172, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800E5, -1 },
+    { 0x00D400DD, -1 }, { 0x010F0066, 1 }, { 0x012E0064, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590171, -1 },
+    { 0x0070201B, -1 }, { 0x0170015F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540117, -1 }, { 0x01472026, -2 }, { 0x2019004B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D014A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016600AB, -1 }, { 0x0144003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800F0, -2 }, { 0x00000000, 0 },
+    { 0x002E00D8, -1 }, { 0x014500C6, -1 }, { 0x01040057, -3 }, { 0x016400C4, -2 },
+    { 0x00000000, 0 }, { 0x2019017C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C00F1, -1 }, { 0x012400E1, -1 }, { 0x00C40074, -1 },
+    { 0x01020070, -1 }, { 0x0121006E, 1 }, { 0x015F006A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FE201B, -1 }, { 0x00C50100, 1 }, { 0x011D2019, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280123, 2 },
+    { 0x0066011F, -1 }, { 0x00C30119, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB00D6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041016C, -2 }, { 0x013600E9, -1 },
+    { 0x015500E7, -1 }, { 0x017400E5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01560173, -1 },
+    { 0x01340102, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590129, 1 }, { 0x01700117, -1 }, { 0x00000000, 0 },
+    { 0x00CF003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010E00C3, -1 },
+    { 0x0051005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0102, -4 }, { 0x0055015B, -1 }, { 0x00D10153, -1 },
+    { 0x00CE00E0, -1 }, { 0x00EA006B, -1 }, { 0x012E014D, -1 }, { 0x01470065, -1 },
+    { 0x01660063, -1 }, { 0x00000000, 0 }, { 0x201B011B, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00500101, -1 }, { 0x00CC00F9, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190134, -1 },
+    { 0x00000000, 0 }, { 0x00492039, -1 }, { 0x002F011C, -1 }, { 0x00000000, 0 },
+    { 0x00E3002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002A00C2, -3 }, { 0x01000041, 1 }, { 0x015D003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004700D9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00480165, -1 }, { 0x00670163, 1 }, { 0x004500F2, -1 }, { 0x00C100EA, -1 },
+    { 0x00DD0075, -1 }, { 0x01020159, -1 }, { 0x01210157, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20176, -3 }, { 0x00F8201E, -1 }, { 0x00BF0103, -1 },
+    { 0x01000172, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250056, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0079003A, -1 }, { 0x0171002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600E2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900E1, -2 }, { 0x00000000, 0 },
+    { 0x016D005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00522019, -1 },
+    { 0x016E00E8, -1 }, { 0x201C002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01500176, -1 },
+    { 0x00550113, -1 }, { 0x00D1010B, -1 }, { 0x012E0105, -1 }, { 0x016C0101, -1 },
+    { 0x201A0047, -1 }, { 0x00000000, 0 }, { 0x201E0146, -1 }, { 0x00000000, 0 },
+    { 0x201B00D3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C015F, -2 },
+    { 0x00000000, 0 }, { 0x201900EC, -1 }, { 0x00000000, 0 }, { 0x002F00D4, -1 },
+    { 0x00000000, 0 }, { 0x002C0061, -1 }, { 0x00C70057, -1 }, { 0x00000000, 0 },
+    { 0x201A0178, -2 }, { 0x20390176, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C800E3, -1 }, { 0x00000000, 0 }, { 0x00C50070, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C1201B, -3 }, { 0x004A0104, -1 }, { 0x01260169, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40115, -1 }, { 0x01020111, -1 },
+    { 0x00000000, 0 }, { 0x00DD002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004100DC, -2 }, { 0x00DC00D2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00420168, -1 }, { 0x00DA00EB, -1 }, { 0x011800E7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014F201B, -1 }, { 0x005C010C, -1 },
+    { 0x00D80104, -1 }, { 0x013500FE, 1 }, { 0x015400FC, -1 }, { 0x0176016D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01140119, -1 }, { 0x01520115, -1 }, { 0x00000000, 0 }, { 0x014C002F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0072, -1 }, { 0x00D100C3, -1 }, { 0x00520058, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007200E2, -1 },
+    { 0x00500071, -1 }, { 0x016A00D2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0117, -2 }, { 0x00000000, 0 }, { 0x002D201E, -1 },
+    { 0x004C201C, -2 }, { 0x00CD00F5, -1 }, { 0x010E0164, -1 }, { 0x016800EB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01660104, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0131, -1 }, { 0x00E80125, -1 }, { 0x0145011F, -1 },
+    { 0x00C30041, 1 }, { 0x0164011D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0148, -1 }, { 0x00E6013E, -1 },
+    { 0x00000000, 0 }, { 0x011E0054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50159, -1 },
+    { 0x00000000, 0 }, { 0x004600EE, 1 }, { 0x00C200E6, -1 }, { 0x010000E2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C30172, -2 }, { 0x00BB201E, -1 }, { 0x00C000FF, -2 }, { 0x011D00F9, 1 },
+    { 0x0120016C, -1 }, { 0x01562014, -1 }, { 0x015E0168, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0178010C, -1 },
+    { 0x00000000, 0 }, { 0x00F6002E, -1 }, { 0x0134002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C00C4, 1 }, { 0x00590051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800F6, -1 }, { 0x011200EA, -1 },
+    { 0x010F0077, 1 }, { 0x012E0075, -1 }, { 0x016C0071, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056010F, -2 },
+    { 0x00CD2026, -1 }, { 0x201B0043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00CF, -1 },
+    { 0x01282039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CA003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D015B, -2 }, { 0x00000000, 0 },
+    { 0x201A00E8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0174, -1 },
+    { 0x00000000, 0 }, { 0x20180101, -2 }, { 0x00000000, 0 }, { 0x002E00E9, -1 },
+    { 0x00000000, 0 }, { 0x01230066, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0102, 1 }, { 0x004B0100, 1 }, { 0x01002013, -1 }, { 0x012400F2, -1 },
+    { 0x014300F0, -1 }, { 0x017E0079, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00490119, -1 }, { 0x00C50111, -1 }, { 0x015B2026, -1 },
+    { 0x00DE0029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280134, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x017800C4, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB00E7, -1 }, { 0x017600DD, 1 }, { 0x0173006A, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00772025, -2 }, { 0x00D90100, -2 }, { 0x013600FA, -1 },
+    { 0x015500F8, -1 }, { 0x0158016B, -1 }, { 0x017400F6, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007A011F, 1 },
+    { 0x0172010F, -1 }, { 0x00000000, 0 }, { 0x0055003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E006E, -1 }, { 0x005600C7, -1 }, { 0x00530054, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A2019, -3 },
+    { 0x00000000, 0 }, { 0x00570153, -2 }, { 0x005400E0, -1 }, { 0x00000000, 0 },
+    { 0x00CD0065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0113, -3 }, { 0x00000000, 0 }, { 0x004D2018, -1 }, { 0x005200F9, -1 },
+    { 0x014A00E9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B012C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00500112, -1 }, { 0x00000000, 0 }, { 0x004A002C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190145, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012200C3, -1 },
+    { 0x0065005C, -2 }, { 0x00C20056, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040151, -1 },
+    { 0x006600E8, -1 }, { 0x00C0006F, -1 }, { 0x00C300E2, -1 }, { 0x012000DC, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C4016E, -2 },
+    { 0x0102016A, -2 }, { 0x00450103, -1 }, { 0x00C100FB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0112, -1 }, { 0x00000000, 0 },
+    { 0x00D8002C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250067, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600F3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x017200C7, -1 }, { 0x00F3005C, -2 }, { 0x01500056, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900F2, -2 }, { 0x017000E0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D60176, -1 }, { 0x0057010B, -2 }, { 0x014A201A, -2 },
+    { 0x01692018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00CB, -1 }, { 0x201A0058, 1 },
+    { 0x20390056, -1 }, { 0x00000000, 0 }, { 0x0147002E, -2 }, { 0x0166002C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0157, -1 }, { 0x201B00E4, -2 },
+    { 0x20180071, -2 }, { 0x00000000, 0 }, { 0x005000CA, -1 }, { 0x002E0059, -2 },
+    { 0x004D0057, -1 }, { 0x00000000, 0 }, { 0x201C0170, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F00E5, -3 }, { 0x004E00E3, -1 },
+    { 0x002C0072, -1 }, { 0x004B0070, -1 }, { 0x00AB00DD, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0047201B, -1 }, { 0x00662019, 2 },
+    { 0x00C32013, -1 }, { 0x00C800F4, -1 }, { 0x01410079, -1 }, { 0x0147015F, -1 },
+    { 0x0166015D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C6010D, -1 }, { 0x01040109, -1 }, { 0x011E2026, -1 }, { 0x0044002F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01020122, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013E0137, 3 }, { 0x00000000, 0 },
+    { 0x00DE00CA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004100ED, -1 }, { 0x00DC00E3, -1 }, { 0x0117006C, -1 }, { 0x013900DD, -2 },
+    { 0x015800DB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD016F, -1 }, { 0x011800F8, -1 }, { 0x01702011, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0176017E, -1 }, { 0x005C011D, 2 }, { 0x007B011B, -1 },
+    { 0x01160111, -1 }, { 0x00D2002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700C3, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0058014F, -1 }, { 0x00000000, 0 }, { 0x00710067, 1 }, { 0x00CE0061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E010F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007200F3, -1 }, { 0x012C00E7, -1 },
+    { 0x016A00E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0128, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01280119, -1 }, { 0x01470117, -1 }, { 0x01660115, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018015A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010400C1, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B0159, -1 }, { 0x00000000, 0 }, { 0x004800E6, -1 },
+    { 0x010200DA, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C5016A, -2 },
+    { 0x00DC2014, -1 }, { 0x010000F3, -1 }, { 0x011F00F1, 1 }, { 0x01220164, -1 },
+    { 0x01410162, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0127, 1 }, { 0x0159011F, -1 },
+    { 0x0178011D, -1 }, { 0x0134003B, -1 }, { 0x20260063, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0119013C, -1 },
+    { 0x005C00D5, -1 }, { 0x015400C5, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250108, -1 }, { 0x00000000, 0 },
+    { 0x01360153, -1 }, { 0x011400E2, -1 }, { 0x01550151, -1 }, { 0x0174014F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00532026, -1 }, { 0x00580107, -1 }, { 0x00CF201E, -1 },
+    { 0x012C2018, -1 }, { 0x016A2014, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E00C7, -1 }, { 0x00560120, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0050003A, -2 }, { 0x0148002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00E0, -2 }, { 0x2019006D, -1 },
+    { 0x012D012B, 1 }, { 0x005100C6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D016C, -1 }, { 0x201A00F9, -1 },
+    { 0x00520152, -1 }, { 0x00000000, 0 }, { 0x004F00DF, -1 }, { 0x00C80064, -1 },
+    { 0x0144005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180112, -1 }, { 0x00CC0163, -1 }, { 0x002E00FA, -1 }, { 0x00C900F0, -1 },
+    { 0x01040079, -2 }, { 0x01230077, 1 }, { 0x012600EA, -1 }, { 0x01420075, 1 },
+    { 0x014500E8, -1 }, { 0x016400E6, -1 }, { 0x00000000, 0 }, { 0x002C0113, -1 },
+    { 0x004B0111, -1 }, { 0x01240103, -1 }, { 0x01430101, -1 }, { 0x015D201E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50122, -1 }, { 0x00000000, 0 }, { 0x010000AB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20100176, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x017800D5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB00F8, -1 }, { 0x015700F0, -1 }, { 0x017600EE, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202500C0, 1 }, { 0x00D90111, -1 }, { 0x0136010B, -1 }, { 0x01550109, -1 },
+    { 0x01740107, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026014C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01720120, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016C003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005600D8, -1 }, { 0x00000000, 0 }, { 0x00720063, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016E0152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0124, -1 },
+    { 0x00000000, 0 }, { 0x010F0171, 1 }, { 0x0052010A, -1 }, { 0x0126201B, -1 },
+    { 0x012E016F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B013D, -1 }, { 0x00000000, 0 }, { 0x201800CA, -1 }, { 0x00500123, -1 },
+    { 0x00CC011B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190156, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012400BB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C8014D, -1 }, { 0x004900E2, -1 }, { 0x0046006F, -1 },
+    { 0x00C20067, 1 }, { 0x00C500DA, -2 }, { 0x01000063, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0042201A, -1 }, { 0x00612018, -1 },
+    { 0x00C300F3, -1 }, { 0x00DD2010, -1 }, { 0x01040162, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C1010C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0125, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410146, -1 }, { 0x00000000, 0 }, { 0x013600C3, 1 },
+    { 0x0079005C, -1 }, { 0x00D60056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260104, 1 }, { 0x00000000, 0 }, { 0x01180151, -1 },
+    { 0x005B00EA, -1 }, { 0x00580077, -1 }, { 0x017200D8, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0176, -2 },
+    { 0x00D0201A, -2 }, { 0x00590103, -2 }, { 0x01540166, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057011C, -1 }, { 0x016E010A, -1 },
+    { 0x00CD002E, -1 }, { 0x201C0050, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00DC, -1 }, { 0x00000000, 0 }, { 0x016C0123, -1 },
+    { 0x005200C2, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0168, -2 }, { 0x201B00F5, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005000DB, -1 }, { 0x002E006A, 2 }, { 0x0107005C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019010E, -1 },
+    { 0x00000000, 0 }, { 0x002F00F6, -3 }, { 0x004E00F4, -1 }, { 0x01430071, -1 },
+    { 0x0162006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0120201E, -1 }, { 0x00C80105, -1 },
+    { 0x015E201A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C300AB, -1 }, { 0x015B002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01020133, -1 }, { 0x01210131, 1 }, { 0x00C100C4, 1 }, { 0x00420059, -1 },
+    { 0x00DD004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20150, -1 }, { 0x0100014C, -1 }, { 0x00BF00DD, -1 },
+    { 0x00DE00DB, -1 }, { 0x013E0148, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00169, -1 }, { 0x00DC00F4, -1 },
+    { 0x011A00F0, -1 }, { 0x011D0163, 1 }, { 0x01550079, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01780176, 1 },
+    { 0x00DA010D, -1 }, { 0x01180109, -1 }, { 0x01322026, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0154011E, -1 }, { 0x005900BB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700D4, -1 },
+    { 0x016E00C2, -2 }, { 0x00540061, -1 }, { 0x00D00059, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B2026, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D100E5, -1 }, { 0x00000000, 0 }, { 0x012B006C, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0120, -1 }, { 0x00000000, 0 },
+    { 0x004E2025, -2 }, { 0x012C00F8, -1 }, { 0x016A00F4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0139, -1 },
+    { 0x00000000, 0 }, { 0x201900C6, -4 }, { 0x0051011F, 2 }, { 0x00CD0117, -1 },
+    { 0x012A0111, -1 }, { 0x0168010D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0153, -1 }, { 0x010400D2, -1 }, { 0x00000000, 0 }, { 0x00C30063, -1 },
+    { 0x017D0057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C016C, -2 }, { 0x00C400EF, -1 }, { 0x010200EB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC2025, -2 }, { 0x00C20108, -1 },
+    { 0x01000104, 1 }, { 0x0158201D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C00121, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0174002F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260074, -1 }, { 0x00DA00C5, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0151, -1 }, { 0x007B00E4, -1 },
+    { 0x00590073, -2 }, { 0x015400D6, -1 }, { 0x01700061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250119, -1 }, { 0x00000000, 0 }, { 0x0055201E, -2 },
+    { 0x011400F3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016A2025, -2 }, { 0x201D004C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E00D8, -1 }, { 0x00000000, 0 }, { 0x012F0123, 1 }, { 0x201B0065, -2 },
+    { 0x0050004B, -1 }, { 0x0148003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EF0140, 2 },
+    { 0x012D013C, 2 }, { 0x002F0066, -1 }, { 0x004E0064, -1 }, { 0x016800C5, -2 },
+    { 0x00000000, 0 }, { 0x201D017D, -1 }, { 0x201A010A, -1 }, { 0x00000000, 0 },
+    { 0x014A0153, -1 }, { 0x00CB00E8, -1 }, { 0x012800E2, -1 }, { 0x014700E0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180123, -2 },
+    { 0x00AD0176, -1 }, { 0x002E010B, -1 }, { 0x00672026, -1 }, { 0x00C90101, -1 },
+    { 0x0102201C, -3 }, { 0x0121201A, -1 }, { 0x012600FB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0122, -1 }, { 0x00C22039, -1 },
+    { 0x00000000, 0 }, { 0x011E002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50133, -1 },
+    { 0x00000000, 0 }, { 0x00C200C0, 1 }, { 0x00DE004B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C3014C, -1 }, { 0x00000000, 0 }, { 0x00C000D9, -2 }, { 0x0041006E, -1 },
+    { 0x00DC0064, -1 }, { 0x0158005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10165, -1 }, { 0x00000000, 0 }, { 0x00DD00F0, -2 },
+    { 0x01560075, -1 }, { 0x015900E8, -1 }, { 0x017800E6, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011C0178, -1 }, { 0x00DB0109, -1 },
+    { 0x00F52026, -1 }, { 0x013B0176, -2 }, { 0x01570101, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D90122, -1 }, { 0x0136011C, -1 }, { 0x00000000, 0 }, { 0x00F2003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01150137, -1 }, { 0x00000000, 0 }, { 0x015000C0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005600E9, -2 },
+    { 0x011000DD, -1 }, { 0x00EE006C, 2 }, { 0x016A0064, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01300167, -1 },
+    { 0x00540102, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A00C2, 1 }, { 0x00CE0113, -1 }, { 0x014A010B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B014E, -1 },
+    { 0x00000000, 0 }, { 0x201800DB, -1 }, { 0x00500134, -1 }, { 0x002E00C3, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F014F, -3 },
+    { 0x002C00DC, -2 }, { 0x004E014D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C0166, -1 }, { 0x004900F3, -1 }, { 0x00C500EB, -1 }, { 0x01000074, -1 },
+    { 0x011F0072, 1 }, { 0x013E0070, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01040173, -1 }, { 0x00C30104, 1 }, { 0x01230171, 1 },
+    { 0x0142016F, 1 }, { 0x01592019, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1011D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0156002D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE0134, -1 }, { 0x00DB00C1, -2 }, { 0x005C0056, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410157, -1 }, { 0x00DC014D, -1 }, { 0x013600D4, -1 },
+    { 0x01140063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260115, -1 }, { 0x00000000, 0 }, { 0x0056201A, -3 }, { 0x00752018, -1 },
+    { 0x017200E9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D8017F, -1 },
+    { 0x01540177, -1 }, { 0x01700102, -2 }, { 0x0053002E, -1 }, { 0x0072002C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0057012D, 1 }, { 0x016E011B, -1 }, { 0x201C0061, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00ED, -1 }, { 0x00000000, 0 }, { 0x010F013A, 3 }, { 0x005200D3, -1 },
+    { 0x014A00C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B0106, -1 }, { 0x00000000, 0 }, { 0x012C0151, -1 },
+    { 0x00CC00E4, -1 }, { 0x00C90071, -1 }, { 0x01640067, -1 }, { 0x016A014D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019011F, -3 }, { 0x00510178, -1 },
+    { 0x00C5201C, -3 }, { 0x002F0107, -3 }, { 0x004E0105, -1 }, { 0x01032018, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004900AB, -1 },
+    { 0x011F002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0104012B, -1 },
+    { 0x004700C4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40148, -1 },
+    { 0x01020144, -1 }, { 0x00C100D5, -1 }, { 0x011B005C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013E0159, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01570071, -1 },
+    { 0x0176006F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041010F, -1 }, { 0x00DC0105, -1 },
+    { 0x011A0101, -1 }, { 0x0134201E, -2 }, { 0x013900FF, -1 }, { 0x015800FD, -1 },
+    { 0x0172201A, -2 }, { 0x20250041, 1 }, { 0x00000000, 0 }, { 0x00DA011E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D500C4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250172, -2 }, { 0x201D201E, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700E5, -2 }, { 0x00D300DD, -1 },
+    { 0x00EF0068, 2 }, { 0x016E00D3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580171, -1 }, { 0x006F201B, -1 },
+    { 0x00D100F6, -1 }, { 0x012E00F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0131, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00720115, -1 }, { 0x00CF010F, -1 }, { 0x012C0109, -1 }, { 0x016A0105, -1 },
+    { 0x2018004B, -1 }, { 0x00000000, 0 }, { 0x201C014A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0168011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0163, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00490063, -1 }, { 0x01220055, -1 }, { 0x00000000, 0 },
+    { 0x2018017C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0164, -1 },
+    { 0x004A00EF, 1 }, { 0x004D0162, -1 }, { 0x00C30074, -1 }, { 0x00C600E7, -1 },
+    { 0x010400E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00622025, -1 }, { 0x00C40100, 1 }, { 0x010200FC, -1 }, { 0x012100FA, 1 },
+    { 0x0124016D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460121, -1 }, { 0x00C20119, -1 },
+    { 0x01000115, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00A10134, 2 },
+    { 0x004100C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DA00D6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B00F5, -1 }, { 0x011600EB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F02025, -1 }, { 0x01360175, -1 },
+    { 0x00000000, 0 }, { 0x0054002A, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012C203A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520043, -1 }, { 0x00CE003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00E9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0050005C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0102, -3 }, { 0x0054015B, -1 }, { 0x00000000, 0 }, { 0x00CD00E0, -1 },
+    { 0x00E9006B, -1 }, { 0x016800D6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A011B, -1 }, { 0x00520174, -2 }, { 0x01042014, -1 },
+    { 0x012800F3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00482039, -1 }, { 0x002E011C, -1 }, { 0x00000000, 0 }, { 0x00E2002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01430123, -1 }, { 0x01620121, -1 },
+    { 0x00000000, 0 }, { 0x015C003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50144, -1 },
+    { 0x00000000, 0 }, { 0x00DE005C, -2 }, { 0x013B0056, -2 }, { 0x015A0054, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C000EA, -1 }, { 0x011A0071, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10176, -3 }, { 0x011E0170, -1 }, { 0x00DD0101, -2 }, { 0x01542018, -1 },
+    { 0x015C016C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0132002E, -2 }, { 0x0151002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500E2, -1 }, { 0x00000000, 0 },
+    { 0x01740129, 1 }, { 0x00D600C0, -1 }, { 0x016E0043, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2026016E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005800E1, -1 }, { 0x00000000, 0 }, { 0x010F0062, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0059016D, -1 }, { 0x0170015B, -1 }, { 0x201B002E, -3 },
+    { 0x203A002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540113, -1 },
+    { 0x20190047, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0146, -1 }, { 0x00000000, 0 }, { 0x201A00D3, -1 },
+    { 0x01642039, -1 }, { 0x00000000, 0 }, { 0x012800AB, -1 }, { 0x0106003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B015F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00500145, -1 }, { 0x002E00D4, -1 }, { 0x01290137, 1 },
+    { 0x014500C2, -1 }, { 0x016400C0, -2 }, { 0x00000000, 0 }, { 0x20190178, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B00EB, -1 },
+    { 0x00000000, 0 }, { 0x00670076, 1 }, { 0x00C40070, -1 }, { 0x0121006A, 3 },
+    { 0x015F0066, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0177, -1 },
+    { 0x00C0201B, -3 }, { 0x00C500FC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0028011F, 2 }, { 0x0066011B, -1 }, { 0x00C30115, -1 },
+    { 0x00DC002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004200C3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0145, -1 },
+    { 0x00DB00D2, -1 }, { 0x005C0067, 2 }, { 0x007B0065, -1 }, { 0x01540057, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410168, -2 }, { 0x00D900EB, -1 }, { 0x013600E5, -1 }, { 0x015500E3, -1 },
+    { 0x017400E1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0156016F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01700113, -1 },
+    { 0x201E0059, -2 }, { 0x00000000, 0 }, { 0x016A002D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D000C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00FE, -1 },
+    { 0x00000000, 0 }, { 0x00D1014F, -1 }, { 0x010F014B, 1 }, { 0x00000000, 0 },
+    { 0x01280063, -1 }, { 0x01470061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B0117, -2 }, { 0x00530170, -1 }, { 0x00000000, 0 }, { 0x00CC00F5, -1 },
+    { 0x012900EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190130, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0067002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20041, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01420138, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40159, -1 }, { 0x01020155, -1 },
+    { 0x00C100E6, -1 }, { 0x00DD0071, -2 }, { 0x015C00DC, -1 }, { 0x01780067, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20172, -2 },
+    { 0x00F8201A, -1 }, { 0x0100016E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F5002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00580051, -1 }, { 0x01500041, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0150, -1 },
+    { 0x01350142, 1 }, { 0x005900DD, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00522015, -1 }, { 0x005700F6, -2 }, { 0x013000E8, -1 },
+    { 0x016E00E4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0055010F, -1 }, { 0x00CC2026, -1 },
+    { 0x00D10107, -1 }, { 0x012E0101, -1 }, { 0x201A0043, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00CF, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C9003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C015B, -2 }, { 0x00000000, 0 }, { 0x201900E8, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0174, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00490074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0175, -2 }, { 0x004A0100, -1 },
+    { 0x00C600F8, -1 }, { 0x010400F4, -1 }, { 0x01260165, -1 }, { 0x01640161, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00480119, -1 }, { 0x00C40111, -1 }, { 0x0102010D, -1 }, { 0x015A2026, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004100D8, -1 },
+    { 0x015800C6, 1 }, { 0x01740051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420164, -1 },
+    { 0x00DA00E7, -1 }, { 0x011800E3, -1 }, { 0x0153006C, -1 }, { 0x01780150, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00762025, -2 }, { 0x005C0108, -1 }, { 0x00D80100, -1 }, { 0x016E2015, -1 },
+    { 0x01760169, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01140115, -1 }, { 0x01520111, -1 },
+    { 0x00000000, 0 }, { 0x0054003B, -2 }, { 0x010E002F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D006E, -1 },
+    { 0x005500C7, -1 }, { 0x00520054, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00FA, -1 }, { 0x00000000, 0 },
+    { 0x00560153, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CC0065, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0113, -2 },
+    { 0x00000000, 0 }, { 0x002D201A, -1 }, { 0x004C2018, -2 }, { 0x00D00164, -1 },
+    { 0x012A00EB, -1 }, { 0x016800E7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01470102, -1 },
+    { 0x01660100, -2 }, { 0x0049002C, -1 }, { 0x0068002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20180145, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0145011B, -1 }, { 0x01640119, -1 }, { 0x00280047, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0146, -1 }, { 0x004B0144, -1 }, { 0x00E6013A, -1 }, { 0x00C10056, -3 },
+    { 0x010200C5, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50155, -1 }, { 0x004600EA, -1 },
+    { 0x00BF006F, -1 }, { 0x00C200E2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280178, 1 }, { 0x00470176, -1 },
+    { 0x00BB201A, -1 }, { 0x00C000FB, -1 }, { 0x00C3016E, -2 }, { 0x01200168, -1 },
+    { 0x01562010, -1 }, { 0x015E0164, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01780108, -1 }, { 0x00000000, 0 }, { 0x00F6002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01190127, -1 }, { 0x005C00C0, 1 },
+    { 0x01570123, -1 }, { 0x0170003B, -1 }, { 0x01760121, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500F3, -1 }, { 0x00000000, 0 }, { 0x00F80142, 1 },
+    { 0x01170140, -1 }, { 0x00F2005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01720153, -1 }, { 0x005800F2, -1 }, { 0x011200E6, -1 }, { 0x012E0071, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0059017E, -1 }, { 0x0056010B, -2 }, { 0x00D50176, -1 }, { 0x012A201C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00CB, -1 }, { 0x20190058, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0157, -1 }, { 0x201A00E4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002D0059, -1 }, { 0x004C0057, -2 },
+    { 0x00000000, 0 }, { 0x201B0170, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00500156, -1 }, { 0x002E00E5, -1 }, { 0x00000000, 0 }, { 0x01040064, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F0171, -1 }, { 0x004B00FC, -1 }, { 0x00C22013, -1 },
+    { 0x016200EA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490115, -1 },
+    { 0x00C5010D, -1 }, { 0x011D2026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01782039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011A003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017800C0, -3 },
+    { 0x00BB0059, -1 }, { 0x0156004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0156, -1 }, { 0x00DB00E3, -1 },
+    { 0x00000000, 0 }, { 0x005C0078, 1 }, { 0x01730066, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013600F6, -1 }, { 0x015500F4, -1 }, { 0x017400F2, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0172010B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D1002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E006A, 2 }, { 0x005600C3, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057014F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CD0061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D010F, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014A00E5, -1 }, { 0x00000000, 0 }, { 0x01280074, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0128, -1 },
+    { 0x00000000, 0 }, { 0x012C0173, -1 }, { 0x0050010E, -1 }, { 0x0162201B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190141, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C500C5, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C60151, -1 }, { 0x002800E8, -1 }, { 0x006600E4, -1 },
+    { 0x0104014D, -1 }, { 0x0123014B, 1 }, { 0x01420149, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C4016A, -2 }, { 0x00DB2014, -1 },
+    { 0x01020166, -2 }, { 0x01780078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01552025, -2 },
+    { 0x00DE010E, -1 }, { 0x017C0177, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410131, -1 }, { 0x20250063, -1 }, { 0x00000000, 0 }, { 0x00D60041, -1 },
+    { 0x0133003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017200C3, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B015F, -1 }, { 0x00000000, 0 },
+    { 0x005900EE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CE201E, -1 }, { 0x00570107, -2 }, { 0x013000F9, -1 }, { 0x016E00F5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00C7, -2 }, { 0x00550120, -1 }, { 0x201A0054, -1 }, { 0x005200AD, -1 },
+    { 0x004F003A, -1 }, { 0x0128002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0153, -1 }, { 0x201B00E0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005000C6, -3 }, { 0x002E0055, -2 }, { 0x01640041, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C016C, -1 }, { 0x201900F9, -1 }, { 0x00000000, 0 },
+    { 0x002F00E1, -3 }, { 0x00000000, 0 }, { 0x002C006E, -1 }, { 0x00E60062, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0147015B, -1 }, { 0x2011002C, -1 }, { 0x00C800F0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C60109, -1 }, { 0x01040105, -1 },
+    { 0x015C201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40122, -1 },
+    { 0x0102011E, -1 }, { 0x00000000, 0 }, { 0x00DD003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013E0133, 1 }, { 0x00000000, 0 }, { 0x00DE00C6, -2 }, { 0x011C00C2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004100E9, -1 }, { 0x00DC00DF, -1 },
+    { 0x01170068, -1 }, { 0x013900D9, -1 }, { 0x01550064, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0078201D, 1 }, { 0x00DA00F8, -1 },
+    { 0x00DD016B, -1 }, { 0x011800F4, -1 }, { 0x01780161, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0176017A, -1 },
+    { 0x007B0117, -1 }, { 0x0116010D, -1 }, { 0x016E2026, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025014C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E00AD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005500D8, -1 },
+    { 0x016C00C6, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E010B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CF00E9, -1 }, { 0x012C00E3, -1 }, { 0x016A00DF, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0124, -1 }, { 0x00000000, 0 },
+    { 0x0125201B, -1 }, { 0x012A00FC, -1 }, { 0x016800F8, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CB011B, -1 }, { 0x01280115, -1 },
+    { 0x01470113, -1 }, { 0x0068003B, -1 }, { 0x01660111, -1 }, { 0x00000000, 0 },
+    { 0x20180156, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00470056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0157, -1 }, { 0x004800E2, -1 }, { 0x0045006F, -1 }, { 0x004B0155, -1 },
+    { 0x00C10067, 1 }, { 0x00C400DA, -2 }, { 0x010200D6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50166, -2 }, { 0x00C200F3, -1 }, { 0x00DC2010, -1 },
+    { 0x010000EF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C0010C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0123, -1 }, { 0x0159011B, -1 }, { 0x01780119, -2 }, { 0x00F6003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015400C1, 1 }, { 0x0078005C, -2 },
+    { 0x00D50056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250104, 1 }, { 0x00000000, 0 }, { 0x0136014F, -1 }, { 0x0155014D, -1 },
+    { 0x00000000, 0 }, { 0x016E0065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CF201A, -1 },
+    { 0x00580103, -1 }, { 0x016A2010, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00C3, 1 },
+    { 0x00000000, 0 }, { 0x0056011C, -1 }, { 0x201B0050, -1 }, { 0x00CC002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00DC, -1 }, { 0x20190069, -1 }, { 0x00EF012B, 1 }, { 0x012D0127, 2 },
+    { 0x002F0051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0168, -1 }, { 0x201A00F5, -1 }, { 0x0052014E, -1 }, { 0x012B0140, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018010E, -1 }, { 0x00000000, 0 },
+    { 0x002E00F6, -1 }, { 0x012600E6, -1 }, { 0x01040075, -1 }, { 0x014500E4, -1 },
+    { 0x016400E2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01080174, -1 }, { 0x002C010F, -1 }, { 0x004B010D, -1 }, { 0x011F201E, -1 },
+    { 0x013E201C, 2 }, { 0x015D201A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C5011E, -1 }, { 0x00000000, 0 },
+    { 0x00C200AB, -1 }, { 0x015A002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C000C4, 1 }, { 0x00410059, -3 }, { 0x00DC004F, -1 },
+    { 0x01580047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01180064, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB00F4, -1 }, { 0x017600EA, -2 },
+    { 0x01540079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01580178, -2 }, { 0x00D9010D, -1 },
+    { 0x01360107, -1 }, { 0x01550105, -1 }, { 0x0057002F, -2 }, { 0x01740103, -2 },
+    { 0x00000000, 0 }, { 0x20260148, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0172011C, -1 }, { 0x00000000, 0 }, { 0x012E003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005600D4, -1 }, { 0x014E00C4, -1 },
+    { 0x016A004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E014E, -1 }, { 0x20190021, -2 },
+    { 0x014C00DD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0120, -2 }, { 0x00000000, 0 }, { 0x010F016D, 1 },
+    { 0x00520106, -1 }, { 0x012E016B, -1 }, { 0x014A00F6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0139, -1 }, { 0x00000000, 0 },
+    { 0x201800C6, -3 }, { 0x0050011F, -1 }, { 0x00CC0117, -1 }, { 0x00000000, 0 },
+    { 0x0104002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190152, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C00C7, -1 },
+    { 0x004B00C5, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C500D6, -1 }, { 0x00000000, 0 }, { 0x00C20063, -1 }, { 0x011F005D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006600F5, -1 }, { 0x00C300EF, -1 }, { 0x011D0076, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB2025, -2 }, { 0x00C10108, -1 }, { 0x01020177, -2 },
+    { 0x011E0102, -1 }, { 0x01210175, 1 }, { 0x0157201D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0121, 1 },
+    { 0x00000000, 0 }, { 0x005C0041, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250074, -1 }, { 0x00D900C5, -2 }, { 0x017400BB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260100, 1 },
+    { 0x00000000, 0 }, { 0x00DA0151, -1 }, { 0x005B00E6, -1 }, { 0x0118014D, -1 },
+    { 0x017200D4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C0172, -1 }, { 0x0054201E, -3 }, { 0x01540162, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016E0106, -1 }, { 0x201C004C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00D8, -2 },
+    { 0x00000000, 0 }, { 0x010F0125, 3 }, { 0x016C011F, -1 }, { 0x201A0065, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0164, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EE0140, 2 }, { 0x00000000, 0 },
+    { 0x002E0066, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019010A, -2 }, { 0x00000000, 0 }, { 0x01680151, -1 },
+    { 0x002F00F2, -3 }, { 0x004E00F0, -1 }, { 0x00CA00E8, -1 }, { 0x0124006F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00662026, -2 }, { 0x00C80101, -1 }, { 0x0101201C, -1 }, { 0x0120201A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C12039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011D002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40133, -1 }, { 0x0102012F, -1 },
+    { 0x00C100C0, 1 }, { 0x00420055, -1 }, { 0x01780041, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2014C, -1 },
+    { 0x01000148, -1 }, { 0x00BF00D9, -1 }, { 0x00DB0064, -1 }, { 0x011F0146, 1 },
+    { 0x013E0144, 1 }, { 0x0157005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C00165, -1 }, { 0x004100FA, -1 }, { 0x00DC00F0, -1 }, { 0x01360077, -1 },
+    { 0x01740073, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD017C, -1 }, { 0x00DA0109, -1 }, { 0x00F42026, -1 },
+    { 0x01180105, -1 }, { 0x0170201E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F1003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005500E9, -1 }, { 0x00D100E1, -1 },
+    { 0x00520076, -1 }, { 0x012B0068, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E011C, -1 }, { 0x00000000, 0 }, { 0x00CF00FA, -1 },
+    { 0x012C00F4, -1 }, { 0x016A00F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900C2, -4 },
+    { 0x00CD0113, -1 }, { 0x012A010D, -1 }, { 0x01680109, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A014E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004F0134, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E014F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00660065, -1 }, { 0x01200059, -1 }, { 0x015E0055, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0168, -2 },
+    { 0x004800F3, -1 }, { 0x006700F1, 1 }, { 0x00C400EB, -1 }, { 0x010200E7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50177, -2 }, { 0x00C20104, 1 }, { 0x01000100, 1 }, { 0x0139201B, -2 },
+    { 0x013E00FC, 1 }, { 0x01582019, -1 }, { 0x017C00F8, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C0011D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260070, -1 },
+    { 0x00DA00C1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB014D, -1 }, { 0x007B00E0, -1 }, { 0x0059006F, -2 }, { 0x015400D2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250115, -1 },
+    { 0x00000000, 0 }, { 0x0055201A, -2 }, { 0x015200EB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012C2025, -1 }, { 0x01500104, -1 },
+    { 0x201D0048, -1 }, { 0x0071002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00D4, -1 }, { 0x00000000, 0 },
+    { 0x0056012D, 1 }, { 0x012F011F, 1 }, { 0x201B0061, -2 }, { 0x010A003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019007A, -1 }, { 0x00EF013C, 2 }, { 0x016800C1, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20152025, -1 },
+    { 0x201A0106, -1 }, { 0x201D0179, -1 }, { 0x014A014F, -1 }, { 0x00CB00E4, -1 },
+    { 0x004C0079, -1 }, { 0x00C80071, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2018011F, -2 }, { 0x00500178, -1 }, { 0x00C4201C, -3 },
+    { 0x002E0107, -1 }, { 0x01022018, -3 }, { 0x014500F5, -1 }, { 0x016400F3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0120, -1 }, { 0x004B011E, -1 }, { 0x004800AB, -1 }, { 0x00FF002C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C5012F, -1 }, { 0x004600C4, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280152, -1 }, { 0x00C30148, -1 },
+    { 0x004400DD, -1 }, { 0x00C000D5, -1 }, { 0x01580058, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015900E4, -1 }, { 0x017800E2, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE0178, -2 }, { 0x011C0174, -1 }, { 0x00DB0105, -1 }, { 0x013B0172, -1 },
+    { 0x015700FD, 1 }, { 0x015A0170, -1 }, { 0x017600FB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D9011E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016E002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260159, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D400C4, -1 }, { 0x016C0047, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C201E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005600E5, -2 }, { 0x00D200DD, -1 }, { 0x00EE0068, 2 },
+    { 0x012C0064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006E201B, -1 }, { 0x01300163, -1 }, { 0x016E015F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0131, -1 }, { 0x00000000, 0 }, { 0x010F017E, 1 }, { 0x00CE010F, -1 },
+    { 0x01452026, -2 }, { 0x014A0107, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B014A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00500130, -1 }, { 0x00000000, 0 }, { 0x016400AB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F014B, -1 }, { 0x002C00D8, -1 }, { 0x004B00D6, -1 },
+    { 0x00480063, -1 }, { 0x01020057, -3 }, { 0x014300C6, -1 }, { 0x016200C4, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0162, -1 }, { 0x00C500E7, -1 },
+    { 0x00000000, 0 }, { 0x00C20074, -1 }, { 0x01000070, -1 }, { 0x011F006E, 1 },
+    { 0x013E006C, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD201D, 1 },
+    { 0x0028010A, -1 }, { 0x00C30100, 1 }, { 0x00FC201B, -1 }, { 0x0104016F, -1 },
+    { 0x0123016D, 1 }, { 0x0142016B, 1 }, { 0x01782013, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10119, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0130, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D8004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410153, -1 },
+    { 0x00D900D6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260111, -1 }, { 0x00000000, 0 },
+    { 0x00BB0164, -1 }, { 0x017200E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01540173, -1 }, { 0x01320102, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570129, 1 },
+    { 0x0130011B, -1 }, { 0x016E0117, -1 }, { 0x00CD003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00E9, -3 }, { 0x00000000, 0 },
+    { 0x012E0134, 2 }, { 0x201A0076, -2 }, { 0x004F005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0175, -2 }, { 0x201B0102, -3 },
+    { 0x00000000, 0 }, { 0x00CF0153, -1 }, { 0x005000E8, -1 }, { 0x002E0077, -2 },
+    { 0x00CC00E0, -1 }, { 0x00E8006B, -1 }, { 0x012C014D, -1 }, { 0x01450065, -1 },
+    { 0x01640063, -1 }, { 0x00510174, -1 }, { 0x00C52018, -3 }, { 0x002F0103, -3 },
+    { 0x004E0101, -1 }, { 0x2019011B, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E1002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004700C0, -1 }, { 0x00000000, 0 },
+    { 0x015B003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40144, -1 }, { 0x00000000, 0 },
+    { 0x00DD005C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000159, -1 }, { 0x011F0157, 1 },
+    { 0x00BF00EA, -1 }, { 0x013E0155, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00A10178, -1 },
+    { 0x0041010B, -1 }, { 0x00C00176, -3 }, { 0x00DC0101, -1 }, { 0x00F6201E, -1 },
+    { 0x0134201A, -2 }, { 0x015800F9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0077003A, -1 }, { 0x0150002C, -2 }, { 0x016F002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D500C0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2025016E, -2 }, { 0x201D201A, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700E1, -2 }, { 0x00000000, 0 }, { 0x016B005C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0058016D, -1 }, { 0x00000000, 0 }, { 0x00D100F2, -1 }, { 0x016C00E8, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014E0176, -1 }, { 0x00720111, -1 }, { 0x00CF010B, -1 },
+    { 0x012C0105, -1 }, { 0x016A0101, -1 }, { 0x20180047, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900D3, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50057, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C600E3, -1 }, { 0x00000000, 0 },
+    { 0x00660076, 1 }, { 0x00C30070, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0177, -1 }, { 0x00C400FC, -1 },
+    { 0x01240169, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0046011D, -1 }, { 0x00C20115, -1 }, { 0x01000111, -1 }, { 0x00DB002D, -1 },
+    { 0x013E010D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004100C3, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA00D2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007B00F1, -1 }, { 0x011600E7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F80175, 1 }, { 0x00D60104, -1 }, { 0x01360171, -1 }, { 0x014D201B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01120119, -1 }, { 0x201D0059, -1 },
+    { 0x00000000, 0 }, { 0x014A002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E00E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00500058, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016800D2, -1 }, { 0x002F0073, -2 }, { 0x004E0071, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0117, -1 },
+    { 0x00520170, -1 }, { 0x01042010, -1 }, { 0x00CB00F5, -1 }, { 0x016600EB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180130, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01640104, -2 },
+    { 0x00000000, 0 }, { 0x0066002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0131, -1 },
+    { 0x00E60125, -1 }, { 0x01050123, 1 }, { 0x00C10041, 1 }, { 0x0143011F, -1 },
+    { 0x0162011D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0058, -1 },
+    { 0x011C0054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C30159, -1 }, { 0x00000000, 0 }, { 0x00C000E6, -1 },
+    { 0x00DC0071, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10172, -2 }, { 0x011E016C, -1 },
+    { 0x01542014, -1 }, { 0x015900F5, -1 }, { 0x015C0168, -1 }, { 0x017800F3, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0176010C, -1 }, { 0x00000000, 0 }, { 0x00F4002E, -1 },
+    { 0x0132002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2026016A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01530140, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590169, -1 },
+    { 0x005600F6, -2 }, { 0x00000000, 0 }, { 0x012C0075, -1 }, { 0x016A0071, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0054010F, -1 }, { 0x0147201E, -2 }, { 0x0166201C, 1 },
+    { 0x20190043, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0142, -1 }, { 0x00000000, 0 }, { 0x01262039, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C8003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B015B, -2 }, { 0x00000000, 0 }, { 0x201800E8, -2 }, { 0x00500141, -1 },
+    { 0x00EB0137, -1 }, { 0x00000000, 0 }, { 0x0104004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190174, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C00E9, -1 }, { 0x004B00E7, -1 }, { 0x00480074, -1 },
+    { 0x00670072, 1 }, { 0x01210066, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A0102, -3 }, { 0x00000000, 0 },
+    { 0x013E007D, 1 }, { 0x017C0079, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0028011B, -1 },
+    { 0x00660117, -1 }, { 0x00C30111, -1 }, { 0x01592026, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017800AB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE0141, -1 }, { 0x00000000, 0 }, { 0x017600C4, -3 },
+    { 0x007B0061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410164, -2 }, { 0x00D900E7, -1 },
+    { 0x013600E1, -1 }, { 0x01580152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260122, -1 }, { 0x00000000, 0 }, { 0x0156016B, -1 },
+    { 0x017200F6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590121, -1 }, { 0x0170010F, -1 }, { 0x201E0055, -2 },
+    { 0x0053003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00510054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00FA, -1 }, { 0x00000000, 0 }, { 0x00550153, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CB0065, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0113, -2 }, { 0x00000000, 0 },
+    { 0x0053016C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019012C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0048002C, -1 }, { 0x0067002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01040138, -1 }, { 0x002800D3, -1 }, { 0x0063005C, -1 }, { 0x00C00056, -3 },
+    { 0x012000C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C40155, -1 }, { 0x004500EA, -1 }, { 0x00C100E2, -1 },
+    { 0x01020151, -1 }, { 0x011E00DC, -1 }, { 0x01590065, -1 }, { 0x01780063, -2 },
+    { 0x00000000, 0 }, { 0x00C2016E, -2 }, { 0x0100016A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0041011C, -1 }, { 0x0158010A, -1 }, { 0x00D6002C, -2 }, { 0x00F5002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600DA, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058004D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C014C, -1 }, { 0x0135013E, 1 }, { 0x017000C7, -1 },
+    { 0x00F1005C, -2 }, { 0x014E0056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00522011, -1 },
+    { 0x005700F2, -2 }, { 0x013000E4, -1 }, { 0x016E00E0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D40176, -1 },
+    { 0x0055010B, -1 }, { 0x00D10103, -1 }, { 0x010F00FF, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B00CB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0145002E, -2 }, { 0x0164002C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201900E4, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0059, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0170, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0171, -1 }, { 0x00C12013, -1 }, { 0x00C600F4, -1 }, { 0x010400F0, -1 },
+    { 0x0145015F, -1 }, { 0x0164015D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480115, -1 }, { 0x00C4010D, -1 },
+    { 0x01020109, -1 }, { 0x011C2026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000122, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004100D4, -1 }, { 0x015800C2, 1 }, { 0x01360051, -1 },
+    { 0x0174004D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0178014C, -1 }, { 0x00DA00E3, -1 }, { 0x015600DB, -1 },
+    { 0x007A0076, 1 }, { 0x0115006C, -1 }, { 0x01530068, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0104, 1 },
+    { 0x011600F8, -1 }, { 0x016E2011, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01140111, -1 }, { 0x0152010D, -1 }, { 0x00000000, 0 }, { 0x00D0002F, -1 },
+    { 0x012D0029, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005500C3, -2 }, { 0x00D100BB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E00F6, -1 }, { 0x00000000, 0 }, { 0x0056014F, -2 }, { 0x005300DC, -1 },
+    { 0x00000000, 0 }, { 0x00CC0061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C010F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x012A00E7, -1 }, { 0x016800E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180141, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01260119, -1 }, { 0x01450117, -1 },
+    { 0x00280043, -1 }, { 0x00470041, -1 }, { 0x0066003F, 1 }, { 0x01640115, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C400C5, 1 }, { 0x010200C1, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50151, -1 }, { 0x004600E6, -1 }, { 0x00BF006B, -1 }, { 0x010000DA, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00470172, -1 }, { 0x00C3016A, -2 }, { 0x00DA2014, -1 }, { 0x011D00F1, 1 },
+    { 0x01200164, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01780104, -3 },
+    { 0x2026004A, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0157011F, -1 }, { 0x0176011D, -1 }, { 0x00D50041, -1 }, { 0x0132003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0117013C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0172014F, -1 }, { 0x011200E2, -1 },
+    { 0x00D10073, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059017A, -1 }, { 0x00512026, -2 },
+    { 0x00560107, -2 }, { 0x00CD201E, -1 }, { 0x012A2018, -1 }, { 0x01682014, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00C7, -1 },
+    { 0x20190054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0146002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0153, -3 },
+    { 0x201A00E0, -1 }, { 0x00000000, 0 }, { 0x012B012B, 1 }, { 0x004F00C6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B016C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E00E1, -1 },
+    { 0x00000000, 0 }, { 0x00C60064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F016D, -1 },
+    { 0x002C00FA, -1 }, { 0x004B00F8, -1 }, { 0x01020079, -2 }, { 0x01210077, 1 },
+    { 0x012400EA, -1 }, { 0x014300E8, -1 }, { 0x016200E6, -1 }, { 0x2010002C, -1 },
+    { 0x00000000, 0 }, { 0x00490111, -1 }, { 0x00C50109, -1 }, { 0x015B201E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30122, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DC003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD00C6, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB00DF, -1 }, { 0x007B0072, -1 },
+    { 0x017600D5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410175, -2 }, { 0x00D900F8, -1 }, { 0x013600F2, -1 },
+    { 0x015500F0, -1 }, { 0x017400EE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0119, -1 },
+    { 0x01720107, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01700120, -1 }, { 0x201E0066, 1 }, { 0x00000000, 0 }, { 0x016A003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D010B, -3 }, { 0x00000000, 0 }, { 0x016C0152, -1 }, { 0x00CE00E9, -1 },
+    { 0x014A00E1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B0124, -1 }, { 0x00000000, 0 }, { 0x0124201B, -1 },
+    { 0x012C016F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019013D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004E0123, -1 }, { 0x00CA011B, -1 }, { 0x00000000, 0 },
+    { 0x017E0029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500C1, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C6014D, -1 },
+    { 0x002800E4, -1 }, { 0x006600E0, -1 }, { 0x00C00067, 1 }, { 0x00C300DA, -2 },
+    { 0x01040149, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C40166, -2 }, { 0x00C100F3, -1 }, { 0x00DB2010, -1 }, { 0x01020162, -2 },
+    { 0x01590076, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013E0177, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041012D, -1 },
+    { 0x00DC0123, -1 }, { 0x00000000, 0 }, { 0x00F5003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600EB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013400C3, -1 }, { 0x0077005C, -1 }, { 0x00D40056, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007B015B, -1 }, { 0x01160151, -1 }, { 0x005900EA, -2 }, { 0x017000D8, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CE201A, -1 }, { 0x00570103, -2 },
+    { 0x013000F5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00C3, -4 }, { 0x0150017F, -1 },
+    { 0x0055011C, -1 }, { 0x016C010A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E014F, -1 }, { 0x201B00DC, -1 },
+    { 0x00000000, 0 }, { 0x00EE012B, 1 }, { 0x005000C2, -2 }, { 0x002E0051, -1 },
+    { 0x016A0123, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0168, -1 },
+    { 0x201900F5, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C006A, 2 }, { 0x0105005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50079, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011E201E, -1 }, { 0x00C60105, -1 }, { 0x01040101, -1 }, { 0x012300FF, 1 },
+    { 0x014200FD, 1 }, { 0x015C201A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C4011E, -1 }, { 0x00000000, 0 }, { 0x00C100AB, -1 },
+    { 0x0159002E, -2 }, { 0x0178002C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000133, -1 }, { 0x011F0131, 1 },
+    { 0x00DE00C2, -2 }, { 0x00DB004F, -1 }, { 0x013E012F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2026201C, -3 }, { 0x00000000, 0 }, { 0x00C00150, -1 },
+    { 0x004100E5, -1 }, { 0x015800D3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0178015D, -2 }, { 0x00782019, 1 }, { 0x00DA00F4, -1 }, { 0x011800F0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01760176, 1 }, { 0x007B0113, -1 }, { 0x01160109, -1 },
+    { 0x01302026, -1 }, { 0x0056002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250148, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700BB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005500D4, -1 }, { 0x016C00C2, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20192026, -4 },
+    { 0x201E0107, -1 }, { 0x00000000, 0 }, { 0x007200EB, -1 }, { 0x00CF00E5, -1 },
+    { 0x0129006C, 1 }, { 0x20180021, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012A00F8, -1 },
+    { 0x016800F4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CB0117, -1 }, { 0x01280111, -1 }, { 0x0147010F, -1 }, { 0x0166010D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180152, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A00C5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0153, -1 }, { 0x004B0151, -1 },
+    { 0x00C400D6, -1 }, { 0x00C10063, -1 }, { 0x010200D2, -1 }, { 0x017B0057, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50162, -2 },
+    { 0x00C200EF, -1 }, { 0x010000EB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DA2025, -2 }, { 0x00C00108, -1 }, { 0x0156201D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD011F, -1 }, { 0x01590117, -1 },
+    { 0x01780115, -2 }, { 0x0172002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D800C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250100, 1 }, { 0x00000000, 0 },
+    { 0x00D90151, -1 }, { 0x0136014B, -1 }, { 0x00570073, -1 }, { 0x01300065, -1 },
+    { 0x016E0061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0053201E, -1 }, { 0x005800FF, -1 }, { 0x011200F3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01682025, -2 }, { 0x201B004C, -1 },
+    { 0x00000000, 0 }, { 0x00AD002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00D8, -1 }, { 0x00000000, 0 },
+    { 0x00EF0127, 2 }, { 0x20190065, -3 }, { 0x002F004D, -1 }, { 0x0146003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0164, -1 }, { 0x201A00F1, -1 },
+    { 0x00000000, 0 }, { 0x012B013C, 2 }, { 0x016600C5, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2018010A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E00F2, -1 },
+    { 0x00C900E8, -1 }, { 0x01040071, -1 }, { 0x012600E2, -1 }, { 0x0142006D, 1 },
+    { 0x014500E0, -1 }, { 0x00000000, 0 }, { 0x002F017E, -2 }, { 0x002C010B, -1 },
+    { 0x004B0109, -1 }, { 0x00AB0176, -1 }, { 0x0100201C, -3 }, { 0x011F201A, -1 },
+    { 0x012400FB, -1 }, { 0x013E2018, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C02039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0062003A, -1 },
+    { 0x011C002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C30133, -1 }, { 0x00000000, 0 }, { 0x00C000C0, 1 },
+    { 0x00410055, -2 }, { 0x01580043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1014C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DA0064, -1 }, { 0x0156005C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB00F0, -1 }, { 0x01540075, -1 }, { 0x015700E8, -1 },
+    { 0x017600E6, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01390176, -2 }, { 0x00D90109, -1 }, { 0x00F32026, -1 }, { 0x01360103, -1 },
+    { 0x01550101, -1 }, { 0x01580174, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260144, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00F0003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01130137, -1 },
+    { 0x201E0077, -2 }, { 0x011000C4, -1 }, { 0x014E00C0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005400E9, -1 }, { 0x010E00DD, -1 }, { 0x01680064, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D011C, -2 }, { 0x010F0169, 1 }, { 0x00520102, 1 }, { 0x00CE00FA, -1 },
+    { 0x012E0167, -1 }, { 0x014A00F2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800C2, -3 }, { 0x0050011B, -1 },
+    { 0x00CC0113, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019014E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C00C3, 1 }, { 0x004B00C1, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500D2, -1 }, { 0x00460067, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002800F5, -1 },
+    { 0x006600F1, -1 }, { 0x00C300EB, -1 }, { 0x011D0072, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40177, -2 },
+    { 0x00C10104, 1 }, { 0x01020173, -1 }, { 0x01210171, 1 }, { 0x01572019, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF011D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0154002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250070, -1 }, { 0x00D900C1, -2 },
+    { 0x005A0056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202600FC, -1 }, { 0x00000000, 0 }, { 0x00DA014D, -1 },
+    { 0x005B00E2, -1 }, { 0x0058006F, -1 }, { 0x01120063, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C016E, -1 },
+    { 0x0054201A, -3 }, { 0x005900FB, -1 }, { 0x00D80166, -1 }, { 0x017000E9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D6017F, -1 }, { 0x016E0102, -2 }, { 0x201C0048, -1 },
+    { 0x0051002E, -2 }, { 0x0070002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00D4, -2 }, { 0x00000000, 0 }, { 0x016C011B, -1 },
+    { 0x201A0061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018007A, -1 },
+    { 0x00EE013C, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20142025, -1 }, { 0x20190106, -2 },
+    { 0x00000000, 0 }, { 0x012A0151, -1 }, { 0x00CA00E4, -1 }, { 0x004B0079, -1 },
+    { 0x01620067, -1 }, { 0x0168014D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004F0178, -1 }, { 0x00C3201C, -3 }, { 0x01012018, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FE002C, -1 }, { 0x011D002A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C4012F, -1 }, { 0x0102012B, -1 }, { 0x00DD0047, -1 },
+    { 0x017E0123, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20148, -1 }, { 0x01000144, -1 }, { 0x013E0140, 3 },
+    { 0x0119005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004100F6, -1 },
+    { 0x011A00E8, -1 }, { 0x00F80077, 1 }, { 0x01360073, -1 }, { 0x01550071, -1 },
+    { 0x0174006F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0178, 1 },
+    { 0x0132201E, -2 }, { 0x00DA0105, -1 }, { 0x01180101, -1 }, { 0x0151201C, -1 },
+    { 0x015600FD, -1 }, { 0x0170201A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250159, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D300C4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B201E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005500E5, -1 }, { 0x016C00D3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006D201B, -1 }, { 0x00CF00F6, -1 }, { 0x012C00F0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CD010F, -1 }, { 0x012A0109, -1 },
+    { 0x01680105, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E014B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280065, -1 },
+    { 0x00660061, -1 }, { 0x01200055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0164, -1 }, { 0x00C400E7, -1 }, { 0x010200E3, -1 },
+    { 0x00C10074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50173, -1 }, { 0x00C20100, 1 },
+    { 0x00FB201B, -1 }, { 0x010000FC, -1 }, { 0x011F00FA, 1 }, { 0x01582015, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C00119, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250111, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011400EB, -1 }, { 0x015200E7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01500100, -1 }, { 0x201D0044, -1 }, { 0x0052002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012A203A, -1 }, { 0x00560129, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CC003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00E9, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00AB0056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0102, 1 }, { 0x00000000, 0 },
+    { 0x00CE0153, -1 }, { 0x00CB00E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018011B, -2 },
+    { 0x00500174, -1 }, { 0x0067201E, -1 }, { 0x002E0103, -1 }, { 0x00C42018, -3 },
+    { 0x01022014, -1 }, { 0x012600F3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00462039, -1 }, { 0x002C011C, -1 },
+    { 0x00000000, 0 }, { 0x00E0002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C5012B, -1 }, { 0x004600C0, -2 }, { 0x00000000, 0 }, { 0x015A003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0028014E, -1 }, { 0x00C30144, -1 }, { 0x00000000, 0 }, { 0x01390056, -2 },
+    { 0x01580054, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00E8, -2 },
+    { 0x01180071, -1 }, { 0x015900E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0176, -1 }, { 0x00792026, -2 },
+    { 0x00DB0101, -1 }, { 0x00DE0174, -1 }, { 0x00F5201E, -1 }, { 0x011C0170, -1 },
+    { 0x013B016E, -1 }, { 0x015A016C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0076003A, -1 },
+    { 0x0130002E, -1 }, { 0x014F002C, -1 }, { 0x00000000, 0 }, { 0x20260155, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0134012D, 1 }, { 0x00D400C0, -1 },
+    { 0x016C0043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C201A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005600E1, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E015B, -1 },
+    { 0x2019002E, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010F017A, 1 }, { 0x00CE010B, -1 }, { 0x014A0103, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201800D3, -1 }, { 0x0050012C, -1 }, { 0x01622039, -1 },
+    { 0x012600AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019015F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C00D4, -1 }, { 0x004B00D2, -1 }, { 0x0067005D, 1 }, { 0x00C40057, -3 },
+    { 0x014300C2, -1 }, { 0x016200C0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004900EB, -1 }, { 0x00C500E3, -1 }, { 0x00C20070, -1 },
+    { 0x011F006A, 3 }, { 0x012200DD, -1 }, { 0x013E0068, 3 }, { 0x014100DB, -1 },
+    { 0x016000D9, -1 }, { 0x0104016B, -1 }, { 0x00280106, -1 }, { 0x00470104, -1 },
+    { 0x00C300FC, -1 }, { 0x00DD2019, 1 }, { 0x01230169, 1 }, { 0x01420167, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10115, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA002D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE012C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0041014F, -1 }, { 0x00D900D2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2026010D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B00F3, -1 },
+    { 0x017200E1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012D201D, 1 },
+    { 0x0059010C, -1 }, { 0x00D50104, -1 }, { 0x0154016F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01300117, -1 }, { 0x016E0113, -1 }, { 0x00000000, 0 },
+    { 0x0168002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00E5, -3 }, { 0x00000000, 0 }, { 0x201A0072, -1 }, { 0x014A00BB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0171, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CF014F, -1 },
+    { 0x005000E4, -1 }, { 0x00000000, 0 }, { 0x01260063, -1 }, { 0x01450061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190117, -3 }, { 0x00000000, 0 },
+    { 0x0049201C, -1 }, { 0x00C52014, -1 }, { 0x00CA00F5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040123, 1 },
+    { 0x01230121, 1 }, { 0x00C00041, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670146, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00460161, -1 }, { 0x00C20159, -1 }, { 0x00BF00E6, -1 }, { 0x00DB0071, -1 },
+    { 0x01000155, -1 }, { 0x015A00DC, -1 }, { 0x01760067, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00A10174, -1 }, { 0x00C00172, -2 }, { 0x00410107, -1 },
+    { 0x00F6201A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600C5, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F3002E, -1 }, { 0x0131002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900C4, -3 }, { 0x00560051, -1 },
+    { 0x014E0041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025016A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x012D005C, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580169, -1 }, { 0x005500F6, -1 },
+    { 0x012E00E8, -1 }, { 0x014A0073, -1 }, { 0x016C00E4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01100176, -1 },
+    { 0x0072010D, -1 }, { 0x00CF0107, -1 }, { 0x012C0101, -1 }, { 0x20180043, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201900CF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C7003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EA0137, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180174, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010400DB, -2 }, { 0x00660072, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0175, -2 }, { 0x004B0173, -1 }, { 0x010200F4, -1 }, { 0x01240165, -1 },
+    { 0x01620161, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460119, -1 }, { 0x00C20111, -1 },
+    { 0x0100010D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015800AD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015600C6, 1 }, { 0x005B0063, -1 },
+    { 0x01720051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01760150, -1 }, { 0x011600E3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250122, -1 }, { 0x00000000, 0 }, { 0x010F201B, 2 }, { 0x00D60100, -1 },
+    { 0x0136016D, -1 }, { 0x015200F8, -1 }, { 0x016C2015, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01120115, -1 }, { 0x201D0055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00E1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540153, -1 }, { 0x00000000, 0 },
+    { 0x002F006F, -3 }, { 0x00CA0065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0113, -1 }, { 0x00000000, 0 }, { 0x0052016C, -1 },
+    { 0x012800EB, -1 }, { 0x014700E9, -1 }, { 0x016600E7, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018012C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01450102, -1 }, { 0x01640100, -2 }, { 0x0047002C, -1 },
+    { 0x0066002A, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0105011F, 1 }, { 0x0143011B, -1 },
+    { 0x01620119, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010000C5, 1 }, { 0x0062005C, -2 }, { 0x00BF0056, -1 }, { 0x00DE0054, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C30155, -1 }, { 0x00C000E2, -1 }, { 0x00410077, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C1016E, -2 }, { 0x011E0168, -1 }, { 0x00DD00F9, -1 }, { 0x01542010, -1 },
+    { 0x015C0164, -1 }, { 0x017800EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760108, -1 },
+    { 0x00000000, 0 }, { 0x00D5002C, -2 }, { 0x00F4002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500DA, -2 }, { 0x00000000, 0 },
+    { 0x01170127, -1 }, { 0x01550123, -1 }, { 0x0057004D, -1 }, { 0x016E003B, -1 },
+    { 0x01740121, -2 }, { 0x00000000, 0 }, { 0x20260166, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00F60142, 1 }, { 0x01150140, -1 }, { 0x00F0005C, -2 },
+    { 0x0153013C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01700153, -1 }, { 0x005600F2, -2 },
+    { 0x012C0071, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D30176, -1 }, { 0x0054010B, -1 },
+    { 0x0128201C, -1 }, { 0x0147201A, -2 }, { 0x01662018, 1 }, { 0x2019003F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D013E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201800E4, -2 }, { 0x0050013D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190170, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C00E5, -1 },
+    { 0x004B00E3, -1 }, { 0x0067006E, 1 }, { 0x01020064, -1 }, { 0x017E005C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004900FC, -1 }, { 0x00C02013, -1 }, { 0x00C500F4, -1 }, { 0x013E0079, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00280117, -1 }, { 0x00660113, -1 }, { 0x00C3010D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01762039, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0118003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE013D, -1 },
+    { 0x00000000, 0 }, { 0x017600C0, -3 }, { 0x00D80057, -1 }, { 0x0154004F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0158014E, -1 }, { 0x00D900E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026011E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017200F2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059011D, -1 },
+    { 0x0170010B, -1 }, { 0x201E0051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005400C3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00F6, -3 },
+    { 0x00000000, 0 }, { 0x0055014F, -1 }, { 0x005200DC, -1 }, { 0x00000000, 0 },
+    { 0x00CB0061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B010F, -2 }, { 0x00000000, 0 }, { 0x004B2014, -1 }, { 0x005000F5, -1 },
+    { 0x00530168, -1 }, { 0x01260074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190128, -1 }, { 0x00000000, 0 }, { 0x012A0173, -1 },
+    { 0x0141201D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460041, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040134, 3 }, { 0x00C300C5, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670157, 1 },
+    { 0x004500E6, -1 }, { 0x00C40151, -1 }, { 0x0102014D, -1 }, { 0x0121014B, 1 },
+    { 0x01590061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C2016A, -2 }, { 0x00D92014, -1 }, { 0x01000166, -2 }, { 0x01760078, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x017A0177, 1 }, { 0x01580106, -1 }, { 0x2025004A, 2 },
+    { 0x0079002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202600D6, -1 }, { 0x00000000, 0 }, { 0x01370121, 1 },
+    { 0x00000000, 0 }, { 0x00D40041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0146, -1 },
+    { 0x0135013A, 1 }, { 0x005900D5, -1 }, { 0x01100056, -1 }, { 0x017000C3, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01520151, -1 }, { 0x005700EE, 1 }, { 0x013000E0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00502026, -3 }, { 0x00550107, -1 },
+    { 0x00CC201E, -1 }, { 0x010F00FB, 1 }, { 0x012E00F9, -1 }, { 0x016C00F5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00C7, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0126002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0153, -2 }, { 0x201900E0, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E00C6, -1 }, { 0x002C0055, -2 },
+    { 0x01620041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A016C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50064, -1 }, { 0x0141005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E016D, -1 }, { 0x0145015B, -1 },
+    { 0x00C600F0, -1 }, { 0x010400EC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00480111, -1 }, { 0x00C40109, -1 }, { 0x00DE2026, -3 }, { 0x01020105, -1 },
+    { 0x015A201E, -1 }, { 0x017E00FD, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20122, -1 }, { 0x0100011E, -1 }, { 0x00000000, 0 },
+    { 0x00DB003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DC00C6, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0152, -1 },
+    { 0x00000000, 0 }, { 0x00DA00DF, -1 }, { 0x01150068, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01760161, -2 }, { 0x005C0100, 1 }, { 0x011600F4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0114010D, -1 }, { 0x01520109, -1 },
+    { 0x016C2026, -2 }, { 0x00EF0029, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0066, -2 },
+    { 0x00000000, 0 }, { 0x016C00AD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00F2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016A00C6, -2 }, { 0x00500065, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C010B, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CD00E9, -1 }, { 0x012A00E3, -1 },
+    { 0x016800DF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0104201D, -2 }, { 0x0123201B, 1 },
+    { 0x012800FC, -1 }, { 0x016600F8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2018013D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C9011B, -1 }, { 0x01260115, -1 }, { 0x01450113, -1 }, { 0x01640111, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C400C1, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C5014D, -1 }, { 0x004600E2, -1 },
+    { 0x00BF0067, 1 }, { 0x00C200DA, -2 }, { 0x010000D6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0047016E, -1 }, { 0x00C30166, -2 },
+    { 0x00C000F3, -1 }, { 0x00DA2010, -1 }, { 0x01580076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD010A, -1 }, { 0x01780100, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0123, -1 }, { 0x0157011B, -1 },
+    { 0x01760119, -2 }, { 0x00F4003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500EB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0076005C, -1 }, { 0x00D30056, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260177, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005800EA, -1 }, { 0x00D1006F, -1 }, { 0x010F006B, 3 },
+    { 0x016C0065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590176, 1 }, { 0x00CD201A, -1 }, { 0x00560103, -2 }, { 0x01682010, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00C3, -3 }, { 0x00000000, 0 }, { 0x20190050, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D014F, -3 }, { 0x201A00DC, -2 }, { 0x00000000, 0 },
+    { 0x012B0127, 2 }, { 0x004F00C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0168, -1 }, { 0x201800F5, -2 },
+    { 0x203A0166, -1 }, { 0x01290140, 1 }, { 0x002E00DD, -2 }, { 0x004D00DB, -1 },
+    { 0x0104005C, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F0169, -1 }, { 0x002C00F6, -1 }, { 0x004B00F4, -1 },
+    { 0x00C40079, -2 }, { 0x01020075, -1 }, { 0x012400E6, -1 }, { 0x014300E4, -1 },
+    { 0x016200E2, -1 }, { 0x00000000, 0 }, { 0x01060174, -1 }, { 0x0049010D, -1 },
+    { 0x00C50105, -1 }, { 0x011D201E, -1 }, { 0x014100FD, -1 }, { 0x015B201A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C3011E, -1 }, { 0x00000000, 0 }, { 0x00C000AB, -1 }, { 0x0177002C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00C2, -3 },
+    { 0x00DA004F, -1 }, { 0x01560047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2025201C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B006E, -1 }, { 0x01160064, -1 }, { 0x01350062, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410171, -1 },
+    { 0x00D900F4, -1 }, { 0x017400EA, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01560178, -2 }, { 0x005B0115, -1 }, { 0x01720103, -1 }, { 0x00000000, 0 },
+    { 0x0055002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005600BB, -1 },
+    { 0x0170011C, -1 }, { 0x012C003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014C00C4, -1 }, { 0x0168004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20182026, -3 }, { 0x201D0107, -3 },
+    { 0x016C014E, -1 }, { 0x00CE00E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0120, -1 },
+    { 0x00000000, 0 }, { 0x00720177, 1 }, { 0x00CF0171, -1 }, { 0x012C016B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190139, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0121, -3 },
+    { 0x004E011F, -1 }, { 0x00CA0117, -1 }, { 0x0102002D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002800E0, -1 }, { 0x00C300D6, -1 },
+    { 0x00C00063, -1 }, { 0x011D005D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40162, -2 }, { 0x00C100EF, -1 },
+    { 0x00DD007A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D92025, -2 },
+    { 0x01000177, -2 }, { 0x011C0102, -1 }, { 0x011F0175, 1 }, { 0x013E0173, 1 },
+    { 0x0155201D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410129, -1 }, { 0x00DC011F, -1 }, { 0x011A011B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202600E7, -1 }, { 0x00000000, 0 }, { 0x01180134, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0150004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0157, -1 },
+    { 0x005900E6, -2 }, { 0x00560073, -1 }, { 0x0116014D, -1 }, { 0x017000D4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016C0106, -1 }, { 0x00000000, 0 },
+    { 0x00CB002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E014B, -1 }, { 0x201B00D8, -1 }, { 0x00000000, 0 }, { 0x00EE0127, 2 },
+    { 0x016A011F, -1 }, { 0x20180065, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900F1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0066, 1 }, { 0x004B0064, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01470153, -1 }, { 0x00C800E8, -1 }, { 0x00C50075, -1 },
+    { 0x01660151, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011E201A, -1 }, { 0x00C60101, -1 },
+    { 0x010400FD, -2 }, { 0x012300FB, 1 }, { 0x014200F9, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C20133, -1 }, { 0x0100012F, -1 }, { 0x00000000, 0 }, { 0x01760041, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20262018, -3 },
+    { 0x00000000, 0 }, { 0x00C0014C, -1 }, { 0x004100E1, -1 }, { 0x011D0146, 1 },
+    { 0x00D90064, -1 }, { 0x0155005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DA00F0, -1 }, { 0x01720073, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007B010F, -1 }, { 0x00F22026, -1 }, { 0x01160105, -1 }, { 0x016E201E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250144, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0103, -1 }, { 0x00000000, 0 },
+    { 0x007200E7, -1 }, { 0x00CF00E1, -1 }, { 0x00EB006C, -1 }, { 0x01290068, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C011C, -1 },
+    { 0x00000000, 0 }, { 0x00CD00FA, -1 }, { 0x012A00F4, -1 }, { 0x016800F0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CB0113, -1 }, { 0x0128010D, -1 },
+    { 0x0147010B, -1 }, { 0x00C5002D, -1 }, { 0x01660109, -1 }, { 0x00000000, 0 },
+    { 0x2018014E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004A00C1, -1 }, { 0x00000000, 0 }, { 0x017D003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C014F, -1 }, { 0x004B014D, -1 }, { 0x00C400D2, -1 }, { 0x011E0059, -1 },
+    { 0x015C0055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004600F3, -1 }, { 0x00C200EB, -1 },
+    { 0x010000E7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30177, -2 }, { 0x00C00104, 1 },
+    { 0x01562019, -1 }, { 0x017A00F8, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD011B, -2 }, { 0x01590113, -1 }, { 0x01780111, -2 }, { 0x0134002F, -1 },
+    { 0x20260057, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D800C1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202500FC, -1 }, { 0x00000000, 0 }, { 0x00D9014D, -1 }, { 0x00000000, 0 },
+    { 0x0057006F, -2 }, { 0x01300061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0053201A, -1 },
+    { 0x005800FB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D5017F, -1 }, { 0x012A2025, -1 }, { 0x014E0104, -1 }, { 0x0050002E, -3 },
+    { 0x006F002C, -1 }, { 0x201B0048, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00D4, -1 }, { 0x00000000, 0 }, { 0x20190061, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0108003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0160, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014700C3, -1 }, { 0x016600C1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20132025, -1 }, { 0x20180106, -1 }, { 0x0050015F, -1 },
+    { 0x00000000, 0 }, { 0x00C900E4, -1 }, { 0x00C60071, -1 }, { 0x0104006D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F017A, -2 }, { 0x00C2201C, -3 }, { 0x002C0107, -1 }, { 0x004B0105, -1 },
+    { 0x01002018, -3 }, { 0x014300F5, -1 }, { 0x016200F3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004600AB, -1 }, { 0x00DE002E, -3 }, { 0x00FD002C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00660135, 1 },
+    { 0x00C3012F, -1 }, { 0x004400C4, -1 }, { 0x00410051, -1 }, { 0x00DC0047, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10148, -1 }, { 0x00000000, 0 }, { 0x004200DD, -1 }, { 0x00DD00D3, -1 },
+    { 0x01560058, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015700E4, -1 },
+    { 0x017600E2, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01390172, -1 }, { 0x01580170, -1 },
+    { 0x00D90105, -1 }, { 0x013600FF, -1 }, { 0x015500FD, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016C002E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D200C4, -1 },
+    { 0x011000C0, -1 }, { 0x016A0047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005400E5, -1 },
+    { 0x00D000DD, -1 }, { 0x012A0064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0118, -1 }, { 0x010F0165, 1 },
+    { 0x00CE00F6, -1 }, { 0x012E0163, -1 }, { 0x016C015F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00500117, -1 }, { 0x00CC010F, -1 }, { 0x01432026, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019014A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016200AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460063, -1 }, { 0x01000057, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C300E7, -1 }, { 0x00000000, 0 }, { 0x00C00074, -1 },
+    { 0x011D006E, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C40173, -1 }, { 0x00C10100, 1 }, { 0x00FA201B, -1 },
+    { 0x0102016F, -1 }, { 0x0121016D, 1 }, { 0x01762013, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0119, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D6004A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600F8, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C016A, -1 }, { 0x00D80162, -1 },
+    { 0x017000E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0044, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00D0, -1 },
+    { 0x00000000, 0 }, { 0x00D10121, -1 }, { 0x012E011B, -1 }, { 0x016C0117, -1 },
+    { 0x00CB003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B00E9, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005000CF, -1 },
+    { 0x004D005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190102, -4 }, { 0x00000000, 0 }, { 0x00CD0153, -1 },
+    { 0x002F00EA, -3 }, { 0x002C0077, -2 }, { 0x004B0075, -1 }, { 0x004E00E8, -1 },
+    { 0x00CA00E0, -1 }, { 0x00E6006B, -1 }, { 0x012A014D, -1 }, { 0x004F0174, -1 },
+    { 0x0066201E, -2 }, { 0x00C32018, -3 }, { 0x01430065, -1 }, { 0x01620063, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670131, 1 }, { 0x00C4012B, -1 },
+    { 0x017E011F, 1 }, { 0x00DD0043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C20144, -1 }, { 0x00DE00CF, -1 }, { 0x013E013C, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011D0157, 1 }, { 0x004100F2, -1 }, { 0x00DC00E8, -1 },
+    { 0x011A00E4, -1 }, { 0x0136006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F4201E, -1 }, { 0x00DA0101, -1 },
+    { 0x0132201A, -2 }, { 0x01512018, -1 }, { 0x015600F9, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0122, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014E002C, -2 }, { 0x016D002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250155, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D300C0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B201A, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005500E1, -1 }, { 0x00000000, 0 },
+    { 0x0169005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007200F8, -1 },
+    { 0x00CF00F2, -1 }, { 0x016A00E8, -1 }, { 0x2018002E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014C0176, -1 },
+    { 0x00CD010B, -1 }, { 0x012A0105, -1 }, { 0x01680101, -1 }, { 0x004B002D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0146, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018015F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010400C6, 1 }, { 0x00280061, -1 }, { 0x00C30057, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004800EB, -1 }, { 0x00C400E3, -1 }, { 0x00C10070, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C5016F, -1 }, { 0x00460104, -2 }, { 0x00C200FC, -1 }, { 0x01582011, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00115, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D9002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01780122, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C00DA, -1 }, { 0x00590067, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025010D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011400E7, -1 }, { 0x015200E3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058010C, -1 },
+    { 0x00D40104, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A0057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00E5, -2 },
+    { 0x00000000, 0 }, { 0x20190072, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0171, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CE014F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20180117, -2 }, { 0x00500170, -1 }, { 0x0048201C, -1 },
+    { 0x002E00FF, -2 }, { 0x0067201A, -1 }, { 0x00C42014, -1 }, { 0x00C900F5, -1 },
+    { 0x01022010, -1 }, { 0x016400EB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01620104, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00660146, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10159, -1 },
+    { 0x00000000, 0 }, { 0x00DD00E4, -2 }, { 0x00DA0071, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF0172, -1 }, { 0x00DE0170, -1 }, { 0x00F5201A, -1 }, { 0x011C016C, -1 },
+    { 0x013B016A, -1 }, { 0x015700F5, -1 }, { 0x015A0168, -1 }, { 0x017600F3, -2 },
+    { 0x00000000, 0 }, { 0x202500C5, 1 }, { 0x00000000, 0 }, { 0x0174010C, -1 },
+    { 0x00000000, 0 }, { 0x00F2002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260151, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01340129, 1 }, { 0x005800C4, 1 }, { 0x00550051, -1 }, { 0x01530127, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005400F6, -1 }, { 0x00000000, 0 },
+    { 0x012A0075, -1 }, { 0x01680071, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0145201E, -2 },
+    { 0x00CE0107, -1 }, { 0x0164201C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800CF, -1 },
+    { 0x00500128, -1 }, { 0x01242039, -1 }, { 0x00000000, 0 }, { 0x00C6003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019015B, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00E90137, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0102004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004900E7, -1 },
+    { 0x012200D9, -1 }, { 0x011F0066, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040167, -1 },
+    { 0x00470100, -1 }, { 0x006600FE, 1 }, { 0x00DD2015, -1 }, { 0x01230165, 1 },
+    { 0x01420163, 1 }, { 0x017A0079, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00450119, -1 }, { 0x00C10111, -1 }, { 0x01572026, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0128, -1 }, { 0x00000000, 0 },
+    { 0x017600AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041014B, -1 },
+    { 0x00000000, 0 }, { 0x017400C4, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260109, -1 }, { 0x00000000, 0 },
+    { 0x01560152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00732025, -1 }, { 0x00590108, -1 }, { 0x00D50100, -1 },
+    { 0x00EF201D, 1 }, { 0x012D2019, 1 }, { 0x0154016B, -1 }, { 0x017000F6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570121, -2 },
+    { 0x01300113, -1 }, { 0x016E010F, -1 }, { 0x0051003B, 5 }, { 0x201C0055, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00E1, -3 }, { 0x00000000, 0 },
+    { 0x201A006E, -1 }, { 0x005200C7, -1 }, { 0x004F0054, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E016D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00720151, -1 }, { 0x005000E0, -1 }, { 0x002E006F, -1 },
+    { 0x00C90065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190113, -3 }, { 0x00000000, 0 }, { 0x00492018, -1 }, { 0x002F00FB, -1 },
+    { 0x00C52010, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046002C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004A012B, 1 }, { 0x0104011F, 1 }, { 0x0123011D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01020138, -1 }, { 0x011E00C3, -1 },
+    { 0x0061005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046015D, -1 }, { 0x00C20155, -1 },
+    { 0x00BF00E2, -1 }, { 0x01000151, -1 }, { 0x011C00DC, -1 }, { 0x013B00DA, -1 },
+    { 0x01570065, -1 }, { 0x01760063, -2 }, { 0x00000000, 0 }, { 0x00440176, -1 },
+    { 0x00C0016E, -2 }, { 0x00410103, -1 }, { 0x011A00F5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202600C1, 1 }, { 0x00592039, -1 }, { 0x0156010A, -1 }, { 0x00000000, 0 },
+    { 0x00D4002C, -2 }, { 0x00F3002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0131, -1 }, { 0x01350125, 1 },
+    { 0x005900C0, -3 }, { 0x0056004D, -1 }, { 0x01100041, -1 }, { 0x01730121, 1 },
+    { 0x00000000, 0 }, { 0x20250166, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F50142, 1 }, { 0x016E00C7, -1 }, { 0x00EF005C, 2 }, { 0x014C0056, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005500F2, -1 }, { 0x00D100EA, -1 },
+    { 0x012E00E4, -1 }, { 0x014A006F, -1 }, { 0x016C00E0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D20176, -1 }, { 0x00720109, -1 }, { 0x00CF0103, -1 },
+    { 0x0127201C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900CB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0143002E, -2 }, { 0x0162002C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0157, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C5004F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180170, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0066006E, -1 }, { 0x017D005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0171, -1 }, { 0x004800FC, -1 },
+    { 0x004B016F, -1 }, { 0x006700FA, 1 }, { 0x00C400F4, -1 }, { 0x010200F0, -1 },
+    { 0x0143015F, -1 }, { 0x0162015D, -1 }, { 0x00000000, 0 }, { 0x01410178, -2 },
+    { 0x00460115, -1 }, { 0x00C2010D, -1 }, { 0x01000109, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260079, -2 }, { 0x00000000, 0 },
+    { 0x015600C2, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0176014C, -1 },
+    { 0x007B00E9, -1 }, { 0x015400DB, -1 }, { 0x00590078, -1 }, { 0x0113006C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025011E, -1 }, { 0x00000000, 0 },
+    { 0x01360169, -1 }, { 0x011400F8, -1 }, { 0x015200F4, -1 }, { 0x016C2011, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01120111, -1 }, { 0x201D0051, -2 },
+    { 0x00000000, 0 }, { 0x012B0029, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00DD, -2 }, { 0x00000000, 0 },
+    { 0x00CF00BB, -1 }, { 0x00000000, 0 }, { 0x00500050, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00F6, -2 }, { 0x00000000, 0 },
+    { 0x0054014F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CA0061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A010F, -1 },
+    { 0x00000000, 0 }, { 0x00520168, -1 }, { 0x012800E7, -1 }, { 0x014700E5, -1 },
+    { 0x016600E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180128, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01240119, -1 }, { 0x01430117, -1 }, { 0x01620115, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50138, -1 }, { 0x00C200C5, 1 }, { 0x010000C1, 1 },
+    { 0x00DE0050, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00660157, -1 }, { 0x00C30151, -1 },
+    { 0x00000000, 0 }, { 0x011A0065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1016A, -2 },
+    { 0x00DD00F5, -2 }, { 0x011E0164, -1 }, { 0x017800EB, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01760104, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202500D6, -1 }, { 0x00000000, 0 }, { 0x0155011F, -1 }, { 0x0174011D, -2 },
+    { 0x00D30041, -1 }, { 0x0130003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260162, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0115013C, -1 },
+    { 0x005800D5, -1 }, { 0x015000C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590161, -2 },
+    { 0x0170014F, -1 }, { 0x005600EE, 1 }, { 0x00720079, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004F2026, -2 }, { 0x00540107, -1 }, { 0x01282018, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D013A, -1 }, { 0x201A00C7, -1 }, { 0x00520120, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0144002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B0153, -2 }, { 0x201800E0, -2 }, { 0x00500139, -1 },
+    { 0x0129012B, 1 }, { 0x00000000, 0 }, { 0x01040047, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019016C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C00E1, -1 }, { 0x00000000, 0 }, { 0x0067006A, 3 },
+    { 0x00C40064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004900F8, -1 }, { 0x00C500F0, -1 },
+    { 0x01000079, -2 }, { 0x011F0077, 1 }, { 0x013E0075, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040178, -3 }, { 0x00280113, -1 },
+    { 0x0066010F, -1 }, { 0x00C30109, -1 }, { 0x00DD2026, -3 }, { 0x0159201E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10122, -1 }, { 0x00000000, 0 }, { 0x00DD00AD, -1 }, { 0x00DA003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE0139, -1 }, { 0x00000000, 0 }, { 0x00DB00C6, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC0152, -1 }, { 0x00000000, 0 },
+    { 0x00D900DF, -1 }, { 0x01520064, -1 }, { 0x017400D5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590119, -2 }, { 0x01700107, -1 }, { 0x00000000, 0 },
+    { 0x00EE0029, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E0120, -1 }, { 0x201C0066, -1 },
+    { 0x00000000, 0 }, { 0x0168003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00F2, -3 }, { 0x00000000, 0 },
+    { 0x005200D8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B010B, -2 }, { 0x00000000, 0 },
+    { 0x004B2010, -1 }, { 0x00530164, -1 }, { 0x00CC00E9, -1 }, { 0x016A0152, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190124, -1 },
+    { 0x00000000, 0 }, { 0x0122201B, -1 }, { 0x002F010C, -1 }, { 0x012A016F, -1 },
+    { 0x01412019, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B0121, 1 },
+    { 0x00C8011B, -1 }, { 0x00000000, 0 }, { 0x017C0029, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C300C1, 1 }, { 0x00440056, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C4014D, -1 }, { 0x004500E2, -1 }, { 0x00C100DA, -2 },
+    { 0x00DD0065, -2 }, { 0x01020149, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20166, -2 }, { 0x00BF00F3, -1 },
+    { 0x00D92010, -1 }, { 0x01000162, -2 }, { 0x01570076, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DC010A, -1 }, { 0x01580102, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600D2, -1 },
+    { 0x00000000, 0 }, { 0x00DA0123, -1 }, { 0x0137011D, 1 }, { 0x00000000, 0 },
+    { 0x00F3003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013200C3, -1 },
+    { 0x0075005C, -2 }, { 0x00D20056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250177, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01140151, -1 },
+    { 0x005700EA, -2 }, { 0x0152014D, -1 }, { 0x016E00D8, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CC201A, -1 }, { 0x00550103, -1 }, { 0x012E00F5, -1 }, { 0x01500166, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B00C3, -3 }, { 0x014E017F, -1 }, { 0x016A010A, -1 }, { 0x20180050, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C014F, -2 }, { 0x201900DC, -1 }, { 0x00000000, 0 }, { 0x01680123, -1 },
+    { 0x002F00C4, -2 }, { 0x002C0051, -1 }, { 0x004B004F, -1 }, { 0x004E00C2, -1 },
+    { 0x00000000, 0 }, { 0x201A0168, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002D00DD, -1 }, { 0x004C00DB, -1 }, { 0x0103005C, -2 },
+    { 0x01410058, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0169, -1 }, { 0x00000000, 0 }, { 0x010400E8, -1 }, { 0x00C30079, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0048010D, -1 }, { 0x00C40105, -1 },
+    { 0x01020101, -1 }, { 0x011C201E, -1 }, { 0x012100FF, 1 }, { 0x013B201C, -2 },
+    { 0x015A201A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2011E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0157002E, -2 }, { 0x0176002C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011D0131, 1 }, { 0x00000000, 0 }, { 0x00DC00C2, -2 }, { 0x00D9004F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD014E, -1 }, { 0x00000000, 0 }, { 0x00BB00DD, -1 },
+    { 0x015600D3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0176015D, -2 }, { 0x00000000, 0 },
+    { 0x011600F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01140109, -1 }, { 0x012E2026, -1 }, { 0x01520105, -1 }, { 0x0054002F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0062, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016A00C2, -2 }, { 0x00500061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0107, -2 }, { 0x00000000, 0 },
+    { 0x00CD00E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0120, -1 }, { 0x00000000, 0 },
+    { 0x004A2025, -2 }, { 0x00CE0171, -1 }, { 0x00E5201B, -1 }, { 0x01042019, -2 },
+    { 0x012800F8, -1 }, { 0x014700F6, -1 }, { 0x016600F4, -1 }, { 0x20180139, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0121, 1 }, { 0x00C90117, -1 },
+    { 0x01260111, -1 }, { 0x0145010F, -1 }, { 0x0164010D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0138, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00490151, -1 }, { 0x00C200D6, -1 }, { 0x00C50149, -1 }, { 0x00BF0063, -1 },
+    { 0x010000D2, -1 }, { 0x01790057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0047016A, -1 }, { 0x00C000EF, -1 }, { 0x00C30162, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D82025, -2 }, { 0x00DD0106, -1 },
+    { 0x0154201D, -1 }, { 0x0173201B, -1 }, { 0x017800FC, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB011F, -1 }, { 0x01570117, -1 }, { 0x00590041, -3 }, { 0x0170002F, -2 },
+    { 0x01760115, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500E7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D600C5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260173, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800E6, -1 },
+    { 0x00550073, -1 }, { 0x012E0065, -1 }, { 0x016C0061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0051201E, -2 },
+    { 0x0070201C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00BF, -3 },
+    { 0x01662025, -3 }, { 0x2019004C, -1 }, { 0x00000000, 0 }, { 0x00CA002A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D014B, -1 },
+    { 0x201A00D8, -1 }, { 0x00000000, 0 }, { 0x014A0121, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0144003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A0162, -1 }, { 0x00000000, 0 }, { 0x0050014A, -1 }, { 0x00EB0140, -1 },
+    { 0x002E00D9, -2 }, { 0x01040058, 1 }, { 0x0129013C, 1 }, { 0x016400C5, -2 },
+    { 0x00000000, 0 }, { 0x2019017D, -1 }, { 0x00000000, 0 }, { 0x002F0165, -1 },
+    { 0x00000000, 0 }, { 0x002C00F2, -1 }, { 0x004B00F0, -1 }, { 0x00C40075, -1 },
+    { 0x01020071, -1 }, { 0x012400E2, -1 }, { 0x014300E0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00490109, -1 }, { 0x00C50101, -1 }, { 0x00FE201C, -1 },
+    { 0x011D201A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0158002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10133, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01560043, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20252018, -3 }, { 0x00000000, 0 },
+    { 0x00DE014A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B006A, 2 },
+    { 0x0154005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0041016D, -1 }, { 0x00000000, 0 }, { 0x00D900F0, -1 },
+    { 0x013600EA, -1 }, { 0x015500E8, -1 }, { 0x017400E6, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01560174, -2 }, { 0x005B0111, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010E00C4, -1 },
+    { 0x0051005D, 6 }, { 0x014C00C0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0103, -3 }, { 0x00000000, 0 }, { 0x00CE00E1, -1 },
+    { 0x00000000, 0 }, { 0x00EA006C, -1 }, { 0x01660064, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B011C, -1 }, { 0x00CF016D, -1 },
+    { 0x00500102, -2 }, { 0x00CC00FA, -1 }, { 0x012C0167, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0049203A, -1 }, { 0x002F011D, -3 }, { 0x004E011B, -1 }, { 0x00CA0113, -1 },
+    { 0x00C4002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A00C3, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004700DA, -1 }, { 0x00C300D2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004500F3, -1 }, { 0x00C100EB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20177, -2 }, { 0x00DE0102, -2 }, { 0x01000173, -1 },
+    { 0x011F0171, 1 }, { 0x013E016F, 1 }, { 0x01552019, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC011B, -1 },
+    { 0x011A0117, -1 }, { 0x20250057, -3 }, { 0x0079003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600E3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B0153, -1 }, { 0x005900E2, -2 }, { 0x0056006F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D60166, -1 }, { 0x016E00E9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D4017F, -1 },
+    { 0x016C0102, -2 }, { 0x00000000, 0 }, { 0x004F002E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00D4, -1 },
+    { 0x00000000, 0 }, { 0x016A011B, -1 }, { 0x20180061, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0160, -1 },
+    { 0x201900ED, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F00D5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01280151, -1 },
+    { 0x00C800E4, -1 }, { 0x00C50071, -1 }, { 0x0147014F, -1 }, { 0x0166014D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C1201C, -3 }, { 0x010400F9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2012F, -1 },
+    { 0x0100012B, -1 }, { 0x00DB0047, -1 }, { 0x013E0127, 3 }, { 0x017C0123, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00148, -1 },
+    { 0x00000000, 0 }, { 0x004100DD, -3 }, { 0x00DC00D3, -1 }, { 0x0117005C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD015F, -2 }, { 0x00592013, -1 }, { 0x011800E8, -1 }, { 0x0172006F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B010B, -1 }, { 0x01160101, -1 },
+    { 0x0130201E, -1 }, { 0x014F201C, -1 }, { 0x015400FD, -1 }, { 0x016E201A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0073, -2 }, { 0x00000000, 0 }, { 0x00D100C4, -1 }, { 0x00520059, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019201E, -4 },
+    { 0x201E00FF, -2 }, { 0x00000000, 0 }, { 0x007200E3, -1 }, { 0x016A00D3, -1 },
+    { 0x00EB0068, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0118, -1 }, { 0x004C201D, -1 }, { 0x005100FE, 1 },
+    { 0x00CD00F6, -1 }, { 0x012A00F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0131, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CB010F, -1 }, { 0x01280109, -1 }, { 0x01470107, -1 }, { 0x01660105, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018014A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C014B, -1 }, { 0x004B0149, -1 },
+    { 0x00000000, 0 }, { 0x00450063, -1 }, { 0x011E0055, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004600EF, 1 }, { 0x00C200E7, -1 }, { 0x010000E3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C30173, -1 }, { 0x00C00100, 1 }, { 0x00F9201B, -1 }, { 0x011D00FA, 1 },
+    { 0x01562015, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0117, -2 }, { 0x0159010F, -1 },
+    { 0x0178010D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C00C5, 1 }, { 0x00000000, 0 }, { 0x00D5004A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500F8, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011200EB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01100104, -1 },
+    { 0x014E0100, -1 }, { 0x201B0044, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00D0, -1 }, { 0x0128203A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CA003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D015C, -1 }, { 0x201A00E9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C005C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180102, -3 }, { 0x0050015B, -1 }, { 0x00CC0153, -1 }, { 0x002E00EA, -1 },
+    { 0x00C900E0, -1 }, { 0x01040069, -1 }, { 0x01230067, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C22018, -3 },
+    { 0x002C0103, -1 }, { 0x004B0101, -1 }, { 0x01002014, -1 }, { 0x012400F3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00660131, -1 }, { 0x00C3012B, -1 }, { 0x004400C0, -1 },
+    { 0x00DC0043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10144, -1 },
+    { 0x004200D9, -1 }, { 0x01560054, -2 }, { 0x017800C5, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB00E8, -1 }, { 0x01160071, -1 }, { 0x015700E0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0139016E, -1 }, { 0x00772026, -2 }, { 0x00D90101, -1 }, { 0x00F3201E, -1 },
+    { 0x00F800FF, 1 }, { 0x013600FB, -1 }, { 0x0158016C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012E002E, -1 }, { 0x014D002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E006F, -1 },
+    { 0x0132012D, 1 }, { 0x00D200C0, -1 }, { 0x00530055, -1 }, { 0x016A0043, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005400E1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0114, -1 }, { 0x002E201B, -3 }, { 0x005200FA, -1 }, { 0x00CE00F2, -1 },
+    { 0x010F0161, 1 }, { 0x014A00EA, -1 }, { 0x016C015B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00500113, -1 },
+    { 0x00CC010B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190146, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012400AB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012200C4, -1 },
+    { 0x00C20057, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20150178, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040152, -1 }, { 0x006600E9, -1 },
+    { 0x00C300E3, -1 }, { 0x00C00070, -1 }, { 0x011D006A, 3 }, { 0x012000DD, -1 },
+    { 0x015E00D9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670175, 1 },
+    { 0x00C100FC, -1 }, { 0x00C4016F, -1 }, { 0x0102016B, -1 }, { 0x01210169, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0115, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202600F4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01500057, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0166, -1 }, { 0x005900F3, -2 }, { 0x017000E1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012B201D, 1 }, { 0x0057010C, -1 }, { 0x00D30104, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00CC, -1 }, { 0x00000000, 0 }, { 0x00D1011D, -1 },
+    { 0x012E0117, -1 }, { 0x016C0113, -1 }, { 0x0147002F, -2 }, { 0x201A0059, -2 },
+    { 0x20390057, -1 }, { 0x00000000, 0 }, { 0x201B00E5, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005000CB, -1 }, { 0x004D0058, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900FE, -1 },
+    { 0x00000000, 0 }, { 0x00CD014F, -1 }, { 0x002F00E6, -3 }, { 0x004B0071, -1 },
+    { 0x004E00E4, -1 }, { 0x01240063, -1 }, { 0x01430061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0047201C, -1 }, { 0x004C00FD, -1 },
+    { 0x0066201A, -2 }, { 0x00C32014, -1 }, { 0x00C800F5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0104010A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01020123, 1 }, { 0x01210121, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013E0138, 1 }, { 0x00DE00CB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00159, -1 }, { 0x00000000, 0 },
+    { 0x004100EE, -1 }, { 0x00D90071, -1 }, { 0x00DC00E4, -1 }, { 0x011A00E0, -1 },
+    { 0x015800DC, -1 }, { 0x01740067, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F4201A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C011E, -1 }, { 0x00000000, 0 }, { 0x005900AB, -1 },
+    { 0x0110002C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250151, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700C4, -3 }, { 0x014C0041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580150, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012B005C, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007200F4, -1 }, { 0x012C00E8, -1 }, { 0x016A00E4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010E0176, -1 }, { 0x00000000, 0 }, { 0x00CD0107, -1 },
+    { 0x012A0101, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2018015B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00E80137, -1 }, { 0x00000000, 0 }, { 0x010400C2, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004800E7, -1 }, { 0x010200DB, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490173, -1 }, { 0x00460100, -2 },
+    { 0x006500FE, -1 }, { 0x00C5016B, -1 }, { 0x00DC2015, -1 }, { 0x010000F4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C00111, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0178011E, -1 }, { 0x20260064, -1 }, { 0x015600AD, -1 },
+    { 0x005B004A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C00D6, -1 },
+    { 0x015400C6, 1 }, { 0x00590063, -2 }, { 0x01700051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250109, -1 }, { 0x00000000, 0 }, { 0x01740150, -1 },
+    { 0x011400E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00722025, -2 }, { 0x00580108, -1 }, { 0x00D40100, -1 }, { 0x00EE201D, 1 },
+    { 0x016A2015, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560121, -2 }, { 0x201B0055, -1 },
+    { 0x00000000, 0 }, { 0x0050003B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00E1, -2 }, { 0x00000000, 0 }, { 0x2019006E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D016D, -1 }, { 0x201A00FA, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C80065, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180113, -2 },
+    { 0x00000000, 0 }, { 0x00482018, -1 }, { 0x002E00FB, -1 }, { 0x0050016C, -1 },
+    { 0x00C42010, -1 }, { 0x01230078, 1 }, { 0x012600EB, -1 }, { 0x01420076, 1 },
+    { 0x014500E9, -1 }, { 0x016400E7, -1 }, { 0x00000000, 0 }, { 0x01430102, -1 },
+    { 0x01620100, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50123, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00660142, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10155, -1 }, { 0x00DD00E0, -2 },
+    { 0x01370067, 1 }, { 0x017800D6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF016E, -1 }, { 0x0079201E, -2 },
+    { 0x00DE016C, -1 }, { 0x011C0168, -1 }, { 0x013B0166, -1 }, { 0x015A0164, -1 },
+    { 0x017600EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500C1, 1 },
+    { 0x00582039, -1 }, { 0x0136010C, -1 }, { 0x01740108, -1 }, { 0x00D3002C, -2 },
+    { 0x00F2002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026014D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01150127, -1 }, { 0x005800C0, 1 },
+    { 0x01720121, -1 }, { 0x016C003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059014C, -1 }, { 0x00F40142, 1 },
+    { 0x01130140, -1 }, { 0x00720064, -1 }, { 0x00EE005C, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016E0153, -1 }, { 0x005400F2, -1 }, { 0x012A0071, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0125, -1 },
+    { 0x00000000, 0 }, { 0x0126201C, -1 }, { 0x00CE0103, -1 }, { 0x0145201A, -2 },
+    { 0x01642018, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201800CB, -1 }, { 0x00500124, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0161002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190157, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C4004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004900E3, -1 }, { 0x00C500DB, -2 }, { 0x01000064, -1 },
+    { 0x017C005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01040163, -1 }, { 0x002800FE, 2 }, { 0x00C300F4, -1 },
+    { 0x00DD2011, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450115, -1 },
+    { 0x00C1010D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE0124, -1 }, { 0x01742039, -1 }, { 0x00000000, 0 }, { 0x0116003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250079, -2 }, { 0x00000000, 0 }, { 0x013600C4, 1 },
+    { 0x00D60057, -1 }, { 0x017400C0, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260105, -1 }, { 0x0156014E, -1 }, { 0x005B00EB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0177, -1 },
+    { 0x00590104, -3 }, { 0x00EF2019, 1 }, { 0x017000F2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0057011D, -2 }, { 0x0130010F, -1 }, { 0x016E010B, -1 },
+    { 0x201C0051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00DD, -1 }, { 0x201A006A, 2 }, { 0x005200C3, 1 },
+    { 0x00CE00BB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0169, -1 }, { 0x201B00F6, -2 }, { 0x00000000, 0 }, { 0x0072014D, -1 },
+    { 0x005000DC, -1 }, { 0x00000000, 0 }, { 0x00C90061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019010F, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004E00F5, -1 }, { 0x00000000, 0 }, { 0x01240074, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01280173, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0104011B, -1 },
+    { 0x00000000, 0 }, { 0x00440041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C40138, -1 }, { 0x00C100C5, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20151, -1 }, { 0x00DE00DC, -1 }, { 0x0100014D, -1 },
+    { 0x011F014B, 1 }, { 0x013E0149, 1 }, { 0x01570061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C0016A, -2 }, { 0x004100FF, -2 },
+    { 0x00DC00F5, -1 }, { 0x01740078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01512025, -1 },
+    { 0x01560106, -1 }, { 0x00000000, 0 }, { 0x0077002E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0173011D, 1 }, { 0x00000000, 0 }, { 0x00D20041, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250162, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700D5, -1 },
+    { 0x010E0056, -1 }, { 0x016E00C3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A2025, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D100E6, -1 }, { 0x012E00E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0121, 1 }, { 0x00000000, 0 },
+    { 0x004E2026, -2 }, { 0x00720105, -1 }, { 0x01272018, -1 }, { 0x012C00F9, -1 },
+    { 0x016A00F5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201900C7, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B003A, -1 }, { 0x0124002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0153, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660127, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2018016C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010400D3, -1 }, { 0x00C30064, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C016D, -1 }, { 0x004800F8, -1 }, { 0x004B016B, -1 }, { 0x00C400F0, -1 },
+    { 0x010200EC, -1 }, { 0x0143015B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01220176, -1 }, { 0x00460111, -1 }, { 0x00C20109, -1 },
+    { 0x00DC2026, -2 }, { 0x01000105, -1 }, { 0x01410174, -2 }, { 0x01600172, -1 },
+    { 0x017C00FD, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00122, -1 },
+    { 0x00000000, 0 }, { 0x00DC00AD, -1 }, { 0x00D9003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260075, -1 }, { 0x00000000, 0 }, { 0x00DA00C6, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB0152, -1 }, { 0x007B00E5, -1 }, { 0x00D800DF, -1 },
+    { 0x01130068, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0074201D, 1 }, { 0x011400F4, -1 },
+    { 0x015200F0, -1 }, { 0x01740161, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580119, -1 }, { 0x0112010D, -1 }, { 0x016A2026, -2 }, { 0x201D004D, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E00D9, -2 }, { 0x201B0066, -1 }, { 0x00000000, 0 }, { 0x016A00AD, -1 },
+    { 0x0050004C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00F2, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F0067, -3 }, { 0x004E0065, -1 }, { 0x016800C6, -2 }, { 0x00000000, 0 },
+    { 0x201D017E, -1 }, { 0x201A010B, -1 }, { 0x00000000, 0 }, { 0x00520164, -2 },
+    { 0x00CB00E9, -1 }, { 0x012800E3, -1 }, { 0x014700E1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180124, -1 }, { 0x00000000, 0 },
+    { 0x0102201D, -2 }, { 0x002E010C, -1 }, { 0x0121201B, 1 }, { 0x012600FC, -1 },
+    { 0x016400F8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01240115, -1 }, { 0x01430113, -1 },
+    { 0x01620111, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C200C1, 1 }, { 0x00430056, -1 }, { 0x00DE004C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00660153, -1 }, { 0x00C000DA, -2 }, { 0x0041006F, -1 }, { 0x00C3014D, -1 },
+};
+
 static const EpdFontData bookerly_12_italic = {
     bookerly_12_italicBitmaps,
     bookerly_12_italicGlyphs,
@@ -3930,4 +12138,8 @@ static const EpdFontData bookerly_12_italic = {
     27,
     -7,
     true,
+    nullptr,
+    &bookerly_12_italicMetrics,
+    bookerly_12_italicKernPairs,
+    32768,
 };
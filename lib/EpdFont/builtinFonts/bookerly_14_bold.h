@@ -3,7 +3,7 @@
  * name: bookerly_14_bold
  * size: 14
  * mode: 2-bit
- * Command used: fontconvert.py bookerly_14_bold 14 ../builtinFonts/source/Bookerly/Bookerly-Bold.ttf --2bit
+ * Command used: fontconvert.py bookerly_14_bold 14 ../builtinFonts/source/Bookerly/Bookerly-Bold.ttf --2bit --kern-manifest font-manifest.txt
  */
 #pragma once
 #include "EpdFontData.h"
@@ -5075,6 +5075,8214 @@ static const EpdUnicodeInterval bookerly_14_boldIntervals[] = {
     { 0xFFFD, 0xFFFD, 0x2EA },
 };
 
+static const EpdFontMetrics bookerly_14_boldMetrics = {
+    16, 40, 6,
+    -7, 40, 30, -9,
+    {
+        6, 8, 12, 18, 18, 28, 23, 7, 11, 11, 11, 18, 8, 11, 8, 15,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 8, 8, 18, 18, 18, 14,
+        29, 22, 19, 19, 23, 19, 17, 21, 25, 12, 11, 22, 18, 28, 23, 23,
+        18, 23, 21, 17, 21, 23, 23, 32, 22, 21, 18, 10, 15, 10, 18, 15,
+        20, 16, 18, 15, 18, 16, 13, 18, 19, 10, 9, 18, 10, 29, 20, 18,
+        18, 17, 14, 15, 12, 19, 19, 26, 18, 19, 15, 12, 9, 12, 18,
+    },
+};
+
+static const EpdKernPair bookerly_14_boldKernPairs[32768] = {
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10166, -3 }, { 0x00DD00F1, -1 }, { 0x015900E9, -1 },
+    { 0x01560076, -1 }, { 0x01750074, 1 }, { 0x017800E7, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF017F, -1 }, { 0x013B0177, -1 },
+    { 0x015A0175, -1 }, { 0x0059002C, -3 }, { 0x0078002A, 1 }, { 0x0171201F, -1 },
+    { 0x01760100, -3 }, { 0x00000000, 0 }, { 0x202500D2, -1 }, { 0x00000000, 0 },
+    { 0x00D90123, -1 }, { 0x0155011B, -1 }, { 0x01740119, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015000C1, -1 }, { 0x0074005C, -1 },
+    { 0x00D10056, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0059015D, -2 }, { 0x0132014F, -1 }, { 0x005600EA, -2 },
+    { 0x00530077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201F011D, -1 }, { 0x00570176, 1 }, { 0x00EA2018, -1 },
+    { 0x00540103, -2 }, { 0x01662010, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A00C3, 1 },
+    { 0x00000000, 0 }, { 0x0052011C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B014F, -1 },
+    { 0x00000000, 0 }, { 0x00500135, 1 }, { 0x00CC012D, 1 }, { 0x002E00C4, 1 },
+    { 0x01290127, 2 }, { 0x0142003F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0150, -1 }, { 0x00000000, 0 },
+    { 0x002C00DD, -3 }, { 0x00C700D3, -1 }, { 0x0102005C, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002A00F6, -1 }, { 0x00000000, 0 }, { 0x00C20079, -2 }, { 0x00E10077, -1 },
+    { 0x01000075, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01040174, -3 }, { 0x0028010F, -1 }, { 0x013A201C, -1 }, { 0x0159201A, -2 },
+    { 0x00410027, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0175002C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0137, -1 },
+    { 0x0179012B, 1 }, { 0x00DB00C2, -2 }, { 0x005C0057, -3 }, { 0x01540047, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013600D5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0175015D, -1 }, { 0x00000000, 0 }, { 0x013400EE, 1 },
+    { 0x016F0077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01540178, -2 }, { 0x00590115, -2 },
+    { 0x00780113, -1 }, { 0x01320107, -1 }, { 0x0053002F, -1 }, { 0x0072002D, -1 },
+    { 0x01700103, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0062, 1 }, { 0x005400BB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00EE, 1 }, { 0x016C0135, 1 }, { 0x005200D4, -1 }, { 0x014A00C4, -1 },
+    { 0x0166004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B0107, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190120, -1 }, { 0x00000000, 0 }, { 0x00700177, -1 },
+    { 0x002F0108, -1 }, { 0x00C5201D, -2 }, { 0x00E4201B, -1 }, { 0x01032019, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201400C6, -1 }, { 0x006B011D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0100002D, -1 }, { 0x013E0029, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002800C7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0067014F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0061, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C20162, -3 }, { 0x00FD00EB, -1 }, { 0x00DB007A, -1 }, { 0x00FA0078, 1 },
+    { 0x01190076, -1 }, { 0x01760070, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FE0177, -1 }, { 0x01390100, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA011F, -1 },
+    { 0x01370119, -1 }, { 0x01750115, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D500C5, -1 }, { 0x017000BB, -1 }, { 0x014E004A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250173, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700E6, -2 }, { 0x00540073, -2 },
+    { 0x007600E4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0050201E, -3 }, { 0x005500FF, -1 },
+    { 0x006F201C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00BF, -3 }, { 0x0110017F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900D8, -1 },
+    { 0x00000000, 0 }, { 0x00CD0129, 1 }, { 0x002F00C0, -3 }, { 0x00C70043, -1 },
+    { 0x0105003F, -1 }, { 0x0168011F, -1 }, { 0x00000000, 0 }, { 0x201A0164, -2 },
+    { 0x20390162, -1 }, { 0x00000000, 0 }, { 0x0147013A, 1 }, { 0x00000000, 0 },
+    { 0x00C5005C, -3 }, { 0x01220056, -1 }, { 0x01410054, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0165, -1 }, { 0x01640151, -2 },
+    { 0x004A00F0, -1 }, { 0x00C30075, -1 }, { 0x012300E2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00622026, -1 }, { 0x00670107, -1 }, { 0x00DE201E, -2 }, { 0x00E300FF, -1 },
+    { 0x00FD201C, 1 }, { 0x010200FD, -2 }, { 0x013B2018, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0157002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01740041, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01590142, -1 }, { 0x01780140, 1 }, { 0x0153005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0157015B, -1 }, { 0x005C00F8, -1 }, { 0x01760159, -1 }, { 0x01130079, -1 },
+    { 0x01700073, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D9017C, -1 }, { 0x0079010F, -1 }, { 0x00F02026, -1 },
+    { 0x016C201E, -1 }, { 0x017100FF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x012F0135, 3 }, { 0x201B0077, 1 }, { 0x00000000, 0 }, { 0x00AD0057, -1 },
+    { 0x010A0051, -1 }, { 0x00000000, 0 }, { 0x201F0176, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F0078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A011C, -1 }, { 0x00520175, -1 }, { 0x004F0102, -1 },
+    { 0x0069201F, -1 }, { 0x00C62019, 1 }, { 0x01042015, -1 }, { 0x016600F0, -2 },
+    { 0x00000000, 0 }, { 0x20180135, 1 }, { 0x00000000, 0 }, { 0x201500C2, -1 },
+    { 0x01640109, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C3002D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01620122, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A014F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE005D, -1 }, { 0x011C0059, -1 }, { 0x013B0057, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00470166, -1 },
+    { 0x011D00E5, -1 }, { 0x00000000, 0 }, { 0x00DC0076, -1 }, { 0x0177006C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10177, -2 }, { 0x00DD0102, -3 }, { 0x00E00175, -1 }, { 0x0116201D, 1 },
+    { 0x01542019, -1 }, { 0x017800F8, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01380115, -1 }, { 0x01570113, -1 },
+    { 0x01760111, -2 }, { 0x0132002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D600C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E201B, -2 }, { 0x2026016F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007700E0, -1 }, { 0x00D10067, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0051201A, -1 }, { 0x005600FB, -1 }, { 0x00702018, -1 },
+    { 0x016A0076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D3017F, -1 }, { 0x014C0104, -1 },
+    { 0x014F0177, -1 }, { 0x004E002E, -1 }, { 0x016E0175, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A00D4, -1 }, { 0x0164203A, -1 },
+    { 0x014A011D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E00D5, -1 }, { 0x01040054, -3 },
+    { 0x014500C3, -1 }, { 0x016400C1, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F0161, -3 }, { 0x004E015F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0178, -2 }, { 0x00C0201C, -3 },
+    { 0x002A0107, -1 }, { 0x00C500FD, -2 }, { 0x00FE2018, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00280120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004200C4, -1 },
+    { 0x00BB0049, -1 }, { 0x0156003F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00430150, -1 }, { 0x00BF0148, -1 },
+    { 0x004000DD, -1 }, { 0x01540058, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410169, -1 },
+    { 0x00582013, -1 }, { 0x00DC015F, -1 }, { 0x00F50077, -1 }, { 0x015500E4, -1 },
+    { 0x017400E2, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01560170, -1 }, { 0x00000000, 0 }, { 0x015300FD, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016A002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0073, -1 },
+    { 0x016E012D, 1 }, { 0x00D000C4, -1 }, { 0x00510059, -1 }, { 0x010E00C0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018201E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01470062, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A0116, -1 }, { 0x002C201F, -2 }, { 0x00C72015, -1 }, { 0x016A015F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0119, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002800D8, -1 }, { 0x015E00C4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FF00E3, -1 },
+    { 0x00000000, 0 }, { 0x00DD0072, -1 }, { 0x01780068, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20173, -1 },
+    { 0x00430108, -1 }, { 0x00DE00FE, -1 }, { 0x00F8201B, -1 }, { 0x0100016F, -1 },
+    { 0x01552015, -1 }, { 0x01742013, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00220123, -1 }, { 0x0177010D, -1 }, { 0x00000000, 0 },
+    { 0x00F5002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BB0132, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D4004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0151, -1 },
+    { 0x00000000, 0 }, { 0x0056006B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007600F5, -1 }, { 0x016E00E5, -1 }, { 0x014C0074, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01310175, -1 }, { 0x0148201F, -1 }, { 0x0167201D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x203A00CE, -1 }, { 0x00000000, 0 }, { 0x00720127, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900E9, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0175, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B00E6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0176, -3 }, { 0x004D0174, -1 }, { 0x004A0101, -1 },
+    { 0x006900FF, -1 }, { 0x00C12018, -3 }, { 0x012300F3, -1 }, { 0x014200F1, 1 },
+    { 0x00000000, 0 }, { 0x20130134, -1 }, { 0x201000C1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0119003F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004100D9, -2 },
+    { 0x015800C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD015B, -2 }, { 0x01590153, -1 },
+    { 0x013700E2, -1 }, { 0x0134006F, -1 }, { 0x01780151, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0109, -1 }, { 0x00762026, -3 }, { 0x00F2201E, -1 }, { 0x014F2018, -1 },
+    { 0x015400F9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201F0056, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014C002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D006F, -2 }, { 0x00000000, 0 },
+    { 0x00D100C0, -1 }, { 0x00520055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019201A, -2 }, { 0x201E00FB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0167005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D00165, 1 }, { 0x004C2019, -1 }, { 0x00000000, 0 }, { 0x01270079, -2 },
+    { 0x01460077, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01470103, -1 },
+    { 0x01660101, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010400AD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01430135, 2 }, { 0x00000000, 0 }, { 0x010200C6, 1 }, { 0x00C10057, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20140178, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004600EB, -1 }, { 0x00000000, 0 },
+    { 0x00620076, -1 }, { 0x00FD006C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C3016F, -1 }, { 0x00440104, -1 },
+    { 0x00C000FC, -1 }, { 0x00DF00FA, -1 }, { 0x011D00F6, -1 }, { 0x01562011, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0113, -2 }, { 0x0159010B, -1 }, { 0x01780109, -2 }, { 0x2026004F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01760122, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570067, -2 }, { 0x00760065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00722010, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F00076, -1 }, { 0x010F0074, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F40175, -1 }, { 0x0056010C, -1 }, { 0x00D20104, -1 }, { 0x01100100, -1 },
+    { 0x0149201B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190059, 1 }, { 0x00000000, 0 },
+    { 0x002F0041, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004C0058, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800FE, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016400D2, -1 }, { 0x004A0071, -1 }, { 0x01230063, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0046201C, 1 }, { 0x002C00FF, -3 }, { 0x004B00FD, -2 },
+    { 0x00AB016A, -1 }, { 0x00C22014, -1 }, { 0x01002010, -1 }, { 0x012400EF, 1 },
+    { 0x016200EB, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01600104, -1 },
+    { 0x00000000, 0 }, { 0x0062002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0178203A, -1 },
+    { 0x0066012D, 4 }, { 0x015E011D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20100162, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FF013C, -1 }, { 0x017800C1, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0159, -1 }, { 0x00000000, 0 }, { 0x00DB00E4, -1 },
+    { 0x005C0079, -1 }, { 0x007B0077, 1 }, { 0x0135006B, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F3201A, -1 },
+    { 0x00D900FD, -1 }, { 0x0139016A, -1 }, { 0x015500F5, -1 }, { 0x01580168, -1 },
+    { 0x017400F3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F0002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590137, 1 }, { 0x01320129, 1 }, { 0x005600C4, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570150, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0051006A, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D10161, -1 },
+    { 0x00000000, 0 }, { 0x00CE00EE, 1 }, { 0x00EA0079, -1 }, { 0x01470073, -1 },
+    { 0x014A00E6, -1 }, { 0x01660071, -2 }, { 0x00000000, 0 }, { 0x201B0129, 1 },
+    { 0x00000000, 0 }, { 0x0143201E, -1 }, { 0x014800FF, -2 }, { 0x0162201C, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190142, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0108011C, -1 },
+    { 0x00C700AD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C500C6, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20150174, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002800E9, -1 }, { 0x00000000, 0 }, { 0x00440074, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C4016B, -1 }, { 0x00FF00F4, -1 }, { 0x01210165, 1 },
+    { 0x01780079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0111, -1 },
+    { 0x00FD010D, -1 }, { 0x01552026, -2 }, { 0x00D80029, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01580120, -1 }, { 0x00000000, 0 }, { 0x015500AD, -1 }, { 0x017400AB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BB0143, -1 }, { 0x01750137, -1 }, { 0x017200C4, -2 },
+    { 0x00770061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0162, -2 }, { 0x005900EF, 2 },
+    { 0x013200E1, -1 }, { 0x00D20074, 1 }, { 0x01540152, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570108, -1 }, { 0x00D30100, -1 }, { 0x012B2019, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00550121, -1 }, { 0x201A0055, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00AD00C1, -1 },
+    { 0x002E0056, -4 }, { 0x004D0054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F00E2, -3 }, { 0x004E00E0, -1 }, { 0x00AB00DA, -1 }, { 0x010800D4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C32010, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01410076, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FF2025, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0044002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0048012B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00650142, 1 }, { 0x00BF00C9, -1 }, { 0x013B00C1, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011D014F, -1 }, { 0x00DC00E0, -1 }, { 0x013900DA, -1 },
+    { 0x01550065, -1 }, { 0x015800D8, -1 }, { 0x01740063, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00420176, -1 }, { 0x00000000, 0 }, { 0x013700F3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00572039, -1 },
+    { 0x0154010A, -1 }, { 0x00000000, 0 }, { 0x00D2002C, -1 }, { 0x00F1002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201F0067, -1 }, { 0x00000000, 0 }, { 0x005700C0, -4 }, { 0x0054004D, -1 },
+    { 0x010E0041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0058014C, -1 }, { 0x00F30142, 1 }, { 0x00000000, 0 },
+    { 0x014A0056, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E010C, -1 }, { 0x00000000, 0 }, { 0x004E2011, -1 },
+    { 0x007200F0, -1 }, { 0x016A00E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0125, 1 }, { 0x0054017E, -1 },
+    { 0x00D00176, -1 }, { 0x0125201C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20140058, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0160002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0145012D, 2 },
+    { 0x0164012B, 1 }, { 0x00470057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C7014E, -1 },
+    { 0x006700E1, -1 }, { 0x00C400DB, -2 }, { 0x00FF0064, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0041201B, -3 }, { 0x00000000, 0 }, { 0x013E00EC, 1 }, { 0x013B0079, -1 },
+    { 0x015A0077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011D0107, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C00D2, -1 }, { 0x015400C2, 1 }, { 0x00D50057, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01360150, -1 }, { 0x007900E9, -1 }, { 0x0174014C, -1 },
+    { 0x00570078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0177, 1 }, { 0x00EE2019, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0170017E, -1 },
+    { 0x0056011D, -2 }, { 0x201E00C4, 1 }, { 0x00000000, 0 }, { 0x01290029, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00DD, 1 }, { 0x00000000, 0 }, { 0x005100C3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006B0067, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2018010F, -1 }, { 0x00000000, 0 }, { 0x00AD0162, -1 },
+    { 0x014500E5, -1 }, { 0x016400E3, -2 }, { 0x01040076, -2 }, { 0x01230074, 1 },
+    { 0x01420072, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00E90177, -1 }, { 0x00C70106, -1 }, { 0x011F201F, 1 }, { 0x013E201D, 2 },
+    { 0x014300FE, 1 }, { 0x015D201B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015A002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C000C5, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00FF014D, -1 }, { 0x017800D2, -2 }, { 0x00000000, 0 }, { 0x01370063, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0079201A, -3 }, { 0x00BF016A, -1 }, { 0x00DE0168, -1 },
+    { 0x011C0164, -1 }, { 0x013B0162, -2 }, { 0x01730078, 1 }, { 0x017600EB, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01502025, -1 }, { 0x01360108, -1 },
+    { 0x01740104, -4 }, { 0x0076002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01340121, -1 }, { 0x0172011D, -1 }, { 0x00D10041, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590148, -1 }, { 0x00000000, 0 }, { 0x005600D5, -1 }, { 0x014E00C5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00570161, -2 }, { 0x0076015F, -1 }, { 0x005400EE, 1 },
+    { 0x00700079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0121, -2 }, { 0x0055017A, -1 }, { 0x00E8201C, -1 },
+    { 0x00ED00FD, -1 }, { 0x01642014, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B013A, 1 }, { 0x00000000, 0 },
+    { 0x20150054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190153, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013E005C, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FE0079, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01020178, -3 }, { 0x00DB2026, -1 }, { 0x00FF0105, -1 }, { 0x0157201E, -2 },
+    { 0x015C00FF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0122, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250075, -1 },
+    { 0x00000000, 0 }, { 0x00D900C6, -2 }, { 0x013600C0, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BB0154, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0054201F, 1 }, { 0x00590100, -3 }, { 0x005C0173, -1 },
+    { 0x013200F2, -1 }, { 0x01540163, -1 }, { 0x017000EE, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F00C0, -2 }, { 0x00570119, -2 },
+    { 0x00760117, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0166003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0165, -1 }, { 0x00000000, 0 },
+    { 0x201B00F2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019010B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F00F3, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E2201F, -1 },
+    { 0x0101201D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004A0123, -1 }, { 0x01230115, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C100C1, 1 },
+    { 0x00420056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF00DA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C00166, -3 }, { 0x004100FB, -1 }, { 0x017700E7, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013A0177, -1 }, { 0x01560102, 1 }, { 0x01780173, -1 },
+    { 0x0077002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0129, 1 },
+    { 0x0135011D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00790142, -1 }, { 0x201F0078, 1 }, { 0x0073005C, -1 }, { 0x00D00056, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0077015B, -1 }, { 0x00000000, 0 }, { 0x00D100E2, -1 }, { 0x00520077, -1 },
+    { 0x014A0067, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560176, 1 }, { 0x00E92018, -1 }, { 0x00720101, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900C3, -4 }, { 0x014C017F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0105002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01470125, 1 }, { 0x002D00C4, -1 }, { 0x004C00C2, 1 },
+    { 0x01660123, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0150, -1 }, { 0x0145013E, 1 }, { 0x00000000, 0 },
+    { 0x0028006A, 1 }, { 0x0101005C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0169, -1 }, { 0x00432013, -1 },
+    { 0x004B0167, -1 }, { 0x006700F2, -1 }, { 0x00C10079, -2 }, { 0x00E00077, -1 },
+    { 0x012100E6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50178, -3 },
+    { 0x0046010D, -1 }, { 0x0139201C, -1 }, { 0x013E00FD, 1 }, { 0x01410170, -1 },
+    { 0x01772018, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0155002E, -2 }, { 0x0174002C, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0135, 1 }, { 0x0178012B, 2 },
+    { 0x00BB00C4, -1 }, { 0x00DA00C2, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01760144, -1 }, { 0x015400D3, -1 }, { 0x00590070, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0155015F, -1 }, { 0x00742019, 1 }, { 0x00D12013, -1 }, { 0x014F0079, -1 },
+    { 0x016E0077, -1 }, { 0x0174015D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00770113, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00D5, -1 }, { 0x201B0062, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201F0161, -1 }, { 0x00000000, 0 }, { 0x201C00EE, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016800C2, -2 }, { 0x002F0063, -3 },
+    { 0x004E0061, -1 }, { 0x00000000, 0 }, { 0x201D017A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006F0177, -1 }, { 0x002E0108, -1 },
+    { 0x00C4201D, -2 }, { 0x00E3201B, -1 }, { 0x01022019, -2 }, { 0x016400F4, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201300C6, -1 },
+    { 0x006A011D, -1 }, { 0x0162010D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004600C5, -3 }, { 0x00000000, 0 },
+    { 0x00BF004A, 1 }, { 0x00DE0048, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280153, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DC0061, -1 }, { 0x01580059, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10162, -3 },
+    { 0x015900E5, -1 }, { 0x00DA007A, -1 }, { 0x00F90078, 1 }, { 0x01750070, 1 },
+    { 0x017800E3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D62025, -1 }, { 0x0152201D, 1 }, { 0x015700FE, -1 }, { 0x0171201B, -1 },
+    { 0x017600FC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D9011F, -1 }, { 0x01360119, -1 },
+    { 0x00570041, -4 }, { 0x01550117, -1 }, { 0x016E002F, -2 }, { 0x01740115, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D400C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590159, -1 },
+    { 0x00000000, 0 }, { 0x005600E6, -2 }, { 0x00720071, -1 }, { 0x016A0061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F0119, -1 },
+    { 0x00000000, 0 }, { 0x004F201E, -1 }, { 0x006E201C, -1 }, { 0x0168007A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01642025, -3 }, { 0x010C010C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CC0129, 1 }, { 0x002E00C0, 1 }, { 0x0104003F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F014C, -1 }, { 0x00000000, 0 }, { 0x002C00D9, -1 }, { 0x00C4005C, -3 },
+    { 0x016200C5, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A00F2, -1 },
+    { 0x00C20075, -1 }, { 0x011F006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040170, -2 }, { 0x0028010B, -1 },
+    { 0x00DD201E, -3 }, { 0x00E200FF, -1 }, { 0x00FC201C, -1 }, { 0x010100FD, -1 },
+    { 0x013A2018, -1 }, { 0x01782014, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0156002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01540043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01770140, -1 },
+    { 0x00000000, 0 }, { 0x0079006A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013400EA, -1 }, { 0x01310077, -1 }, { 0x017200E6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01540174, -2 }, { 0x00590111, -2 }, { 0x0078010F, -1 }, { 0x01320103, -1 },
+    { 0x017000FF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00EA, -2 }, { 0x010F0137, 3 },
+    { 0x201A0077, -3 }, { 0x014A00C0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0176, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01640064, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019011C, -1 }, { 0x0068201F, -1 }, { 0x002F0104, -3 }, { 0x004E0102, -1 },
+    { 0x00C52019, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0166017C, -1 }, { 0x006B0119, -1 },
+    { 0x201400C2, -1 }, { 0x00000000, 0 }, { 0x00C2002D, -1 }, { 0x011F0027, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01780053, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF00EB, -1 },
+    { 0x00FD00E7, -1 }, { 0x00DB0076, -1 }, { 0x0176006C, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0044017F, -1 },
+    { 0x00C00177, -2 }, { 0x00DC0102, -2 }, { 0x00DF0175, -1 }, { 0x00F6201F, -1 },
+    { 0x015800FA, -1 }, { 0x017700F8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01370115, -1 }, { 0x01750111, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D80134, -1 }, { 0x00D500C1, -1 },
+    { 0x00000000, 0 }, { 0x0110004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2025016F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00790153, -1 },
+    { 0x005700E2, -2 }, { 0x0054006F, -2 }, { 0x007600E0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0050201A, -3 }, { 0x006F2018, -1 }, { 0x00000000, 0 }, { 0x01690076, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D2017F, -1 }, { 0x016A0102, -2 }, { 0x016D0175, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201900D4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B0047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010600C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0164014D, -2 }, { 0x00000000, 0 }, { 0x015E0067, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE201A, -2 }, { 0x00670103, -1 },
+    { 0x00C400FD, -2 }, { 0x00FD2018, 1 }, { 0x010200F9, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004100C4, 1 }, { 0x01360041, 1 },
+    { 0x0155003F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0146, -1 }, { 0x011B0142, 1 }, { 0x0159013E, -1 },
+    { 0x0115005C, -1 }, { 0x0178013C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB015F, -1 }, { 0x00572013, -1 },
+    { 0x005C00F4, -1 }, { 0x00F40077, -1 }, { 0x01760155, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0079010B, -1 }, { 0x013300FF, -1 }, { 0x014D201C, -1 }, { 0x016C201A, -1 },
+    { 0x201F0041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0073, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00FF, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00520171, -1 }, { 0x0069201B, -1 }, { 0x01042011, -1 }, { 0x014700EE, 2 },
+    { 0x014A0161, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01640105, -2 },
+    { 0x00000000, 0 }, { 0x0066002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0162011E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0059, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00470162, -1 }, { 0x011D00E1, -1 }, { 0x00000000, 0 },
+    { 0x01770068, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10173, -1 }, { 0x00DD00FE, 1 },
+    { 0x01162019, 1 }, { 0x01542015, -1 }, { 0x015900F6, -1 }, { 0x017800F4, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01380111, -1 }, { 0x0157010F, -1 }, { 0x0176010D, -2 }, { 0x00F4002F, -1 },
+    { 0x01510029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D3004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026016B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01110177, -1 }, { 0x010E0104, -1 }, { 0x014C0100, -1 }, { 0x004E002A, 1 },
+    { 0x0166201D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201800E9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F015D, -3 },
+    { 0x004E015B, -1 }, { 0x004B00E8, -1 }, { 0x016200D6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002D0176, -1 }, { 0x004C0174, -2 }, { 0x006800FF, -2 }, { 0x00C02018, -3 },
+    { 0x00C500F9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01782025, -3 }, { 0x0028011C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00FF0127, -1 }, { 0x004200C0, -1 }, { 0x00BB0045, -1 }, { 0x015C0121, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0043014C, -1 }, { 0x00BF0144, -1 }, { 0x00DE0142, -1 }, { 0x005C0064, -1 },
+    { 0x00D8005C, -1 }, { 0x00FD0140, -1 }, { 0x01540054, -2 }, { 0x017600C5, -3 },
+    { 0x00000000, 0 }, { 0x00220167, 1 }, { 0x00DC015B, -1 }, { 0x015500E0, -1 },
+    { 0x01770151, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BB0176, -1 }, { 0x0156016C, -1 },
+    { 0x00F600FF, -1 }, { 0x011500FD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590122, -2 }, { 0x201E0056, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C006F, -1 }, { 0x0130012D, 1 }, { 0x00D000C0, -1 },
+    { 0x016E0129, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2018201A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010C00D5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A0112, -1 }, { 0x002C201B, -2 },
+    { 0x005000FA, 1 }, { 0x00C72011, -1 }, { 0x016A015B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019012D, 1 },
+    { 0x00000000, 0 }, { 0x002F0115, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01060120, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002800D4, -1 }, { 0x015E00C0, -1 }, { 0x00A10059, -1 }, { 0x00C00057, -3 },
+    { 0x00000000, 0 }, { 0x20130178, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011E00DD, -1 }, { 0x00610076, -1 },
+    { 0x00DD006E, -1 }, { 0x01780064, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00650175, -1 }, { 0x00BF00FC, -1 }, { 0x00C2016F, -1 },
+    { 0x00FD00F8, -1 }, { 0x0100016B, -1 }, { 0x01362013, -1 }, { 0x013E0167, 1 },
+    { 0x01552011, -1 }, { 0x0176007D, 1 }, { 0x00000000, 0 }, { 0x0022011F, -1 },
+    { 0x01770109, -1 }, { 0x2025004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600DB, -1 },
+    { 0x00BB012E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C014D, -1 }, { 0x00000000, 0 }, { 0x00560067, -2 },
+    { 0x014E0057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700F3, -2 },
+    { 0x016E00E1, -1 }, { 0x010E0074, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F30175, -1 },
+    { 0x00D10104, -1 }, { 0x0129201D, 1 }, { 0x0148201B, -1 }, { 0x01672019, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A00CA, -1 }, { 0x00720123, -1 }, { 0x20180059, 1 }, { 0x002E0041, 1 },
+    { 0x0164002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201900E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0171, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006B00E2, -1 }, { 0x010600D8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0172, -1 },
+    { 0x00C12014, -1 }, { 0x014200ED, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013900C5, 1 }, { 0x015800C3, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0157, -1 }, { 0x00DA00E4, -1 }, { 0x005B0079, 1 },
+    { 0x015600DC, -1 }, { 0x0159014F, -1 }, { 0x01720067, -1 }, { 0x0178014D, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F2201A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700AB, -1 }, { 0x010E002C, -1 }, { 0x012D002A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580137, 1 }, { 0x00770135, 1 }, { 0x005500C4, -2 }, { 0x00520051, -1 },
+    { 0x014A0041, -1 }, { 0x201D006B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0050006A, 1 }, { 0x0129005C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CD00EE, 1 }, { 0x00E90079, -1 }, { 0x016800E4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0161201C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180142, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01050135, 3 }, { 0x00000000, 0 },
+    { 0x00C400C6, 1 }, { 0x010200C2, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20140174, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004600E7, -1 }, { 0x010000DB, -2 }, { 0x00BF006C, -1 }, { 0x00FD0068, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00280175, 1 }, { 0x00440100, -1 }, { 0x00C3016B, -1 }, { 0x011D00F2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD010F, -2 }, { 0x01590107, -1 },
+    { 0x01780105, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0176011E, -2 },
+    { 0x00000000, 0 }, { 0x015400AD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01740137, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570063, -2 },
+    { 0x00760061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800EF, 1 }, { 0x015000DF, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00702025, -1 }, { 0x00560108, -1 },
+    { 0x00D20100, -1 }, { 0x00000000, 0 }, { 0x00500022, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540121, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002D0056, -1 },
+    { 0x004C0054, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00462018, 1 },
+    { 0x002C00FB, -1 }, { 0x004B00F9, -1 }, { 0x00AB0166, -1 }, { 0x00C22010, -1 },
+    { 0x016200E7, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00FE2025, -1 }, { 0x01250177, -2 }, { 0x01410102, 1 }, { 0x0062002A, -1 },
+    { 0x01440175, -2 }, { 0x015B201F, -1 }, { 0x01600100, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0028012D, 1 }, { 0x00660129, 4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD00C7, -2 }, { 0x00BB0056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF0155, -1 }, { 0x00DB00E0, -1 }, { 0x005C0075, -1 }, { 0x00FD0151, -1 },
+    { 0x01350067, -1 }, { 0x017600D6, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410176, -3 }, { 0x0077201E, -3 }, { 0x013600F3, -1 }, { 0x01390166, -2 },
+    { 0x01580164, -2 }, { 0x017400EF, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260134, 1 }, { 0x00000000, 0 }, { 0x00562039, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D1002C, -1 }, { 0x00F0002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01700121, -1 }, { 0x005600C0, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F00F3, -1 },
+    { 0x0057014C, -1 }, { 0x00F20142, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D010C, -1 }, { 0x00D1015D, -1 }, { 0x010F0159, 1 }, { 0x014A00E2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B0125, 1 }, { 0x00000000, 0 }, { 0x0143201A, -1 },
+    { 0x01622018, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019013E, 1 }, { 0x00000000, 0 },
+    { 0x20130058, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500C2, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01420146, 1 }, { 0x002800E5, -1 },
+    { 0x00C300DB, -2 }, { 0x00A1006A, 1 }, { 0x017A005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FF00F0, -1 }, { 0x013A0079, -1 }, { 0x01780075, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF010D, -1 }, { 0x00FD0109, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0158011C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BB013F, -1 },
+    { 0x00000000, 0 }, { 0x013400C4, -1 }, { 0x00D40057, -1 }, { 0x017200C0, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0154014E, -1 }, { 0x005900EB, -2 }, { 0x007800E9, -1 }, { 0x00560078, -1 },
+    { 0x00750076, -1 }, { 0x012F006A, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570104, -4 }, { 0x014A2013, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00C4, -4 }, { 0x0055011D, -1 },
+    { 0x201A0051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0150, -1 }, { 0x00000000, 0 }, { 0x201B00DD, 1 },
+    { 0x00000000, 0 }, { 0x005000C3, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900F6, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006A0067, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B00F3, -1 },
+    { 0x00000000, 0 }, { 0x01030076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E80177, -1 },
+    { 0x01040102, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01210119, -1 }, { 0x00000000, 0 }, { 0x00420041, -1 },
+    { 0x0061003F, -1 }, { 0x0159002F, -2 }, { 0x0178002D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE00C3, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2026201D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015800D4, -1 }, { 0x00000000, 0 }, { 0x01360063, -1 }, { 0x01550061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0178015E, -1 }, { 0x017500EB, -1 }, { 0x00000000, 0 }, { 0x01720078, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014F2025, -1 }, { 0x01540106, -1 }, { 0x01760177, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01330121, -1 },
+    { 0x201F0063, -1 }, { 0x00D00041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016C00C3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0108, -1 },
+    { 0x00560161, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006F0079, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0121, -1 }, { 0x0054017A, -1 }, { 0x01252018, -1 }, { 0x00EC00FD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20140054, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0141002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180153, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0126012B, 1 }, { 0x004A00C6, -1 }, { 0x01450129, 2 },
+    { 0x015E0041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B0152, -1 }, { 0x01430142, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004600F8, -1 },
+    { 0x011F00EA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01200176, -1 },
+    { 0x00DA2026, -1 }, { 0x011D0103, -1 }, { 0x0175201C, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0120, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01190135, 1 }, { 0x00000000, 0 },
+    { 0x00D800C6, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0136014C, -1 },
+    { 0x007900E5, -1 }, { 0x00D600DF, -1 }, { 0x01740148, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0072201D, 1 }, { 0x007700FE, -1 }, { 0x01720161, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0170017A, -1 }, { 0x00560119, -2 }, { 0x01682026, -1 },
+    { 0x201E00C0, 1 }, { 0x203A004B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016600C6, -3 }, { 0x006B0063, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018010B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014500E1, -1 }, { 0x00000000, 0 },
+    { 0x0142006E, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E1201F, -1 }, { 0x002C010C, -1 },
+    { 0x004B010A, -1 }, { 0x0100201D, -2 }, { 0x011F201B, 1 }, { 0x013E2019, 2 },
+    { 0x016200F8, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C000C1, 1 }, { 0x00410056, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00D8, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0166, -1 },
+    { 0x00DE0164, -1 }, { 0x013800EB, -1 }, { 0x01540076, -1 }, { 0x015700E9, -1 },
+    { 0x017600E7, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01390177, -1 }, { 0x01360104, 1 }, { 0x01580175, -1 }, { 0x0057002C, -4 },
+    { 0x0076002A, 1 }, { 0x016F201F, -1 }, { 0x01740100, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B012B, 1 }, { 0x0134011D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590144, -1 },
+    { 0x011000C5, -1 }, { 0x014E00C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F0104, -2 }, { 0x0057015D, -2 },
+    { 0x0076015B, -1 }, { 0x005400EA, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D011D, -2 },
+    { 0x00000000, 0 }, { 0x00E82018, -1 }, { 0x01642010, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201800C3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0104002A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019014F, -2 }, { 0x00000000, 0 }, { 0x004E0135, 2 },
+    { 0x00000000, 0 }, { 0x002C00C4, 1 }, { 0x004B00C2, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A00DD, 1 }, { 0x0100005C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002800F6, -1 }, { 0x01420157, 1 },
+    { 0x00C00079, -2 }, { 0x00DF0077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40178, -3 }, { 0x01020174, -3 },
+    { 0x00FF0101, -1 }, { 0x0157201A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DC0135, 1 }, { 0x00000000, 0 }, { 0x00D900C2, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202600FD, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054201B, 1 },
+    { 0x005900FC, -1 }, { 0x005C016F, -1 }, { 0x00D80167, 1 }, { 0x013200EE, 1 },
+    { 0x016D0077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00570115, -2 }, { 0x00760113, -1 }, { 0x016E0103, -1 },
+    { 0x0051002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00D5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00EE, 1 }, { 0x016A0135, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0164004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190107, -2 },
+    { 0x00000000, 0 }, { 0x002F00EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006E0177, -2 }, { 0x00C3201D, -2 }, { 0x00E2201B, -1 },
+    { 0x01012019, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A011F, -1 },
+    { 0x01230111, -1 }, { 0x00000000, 0 }, { 0x00DF002F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00460151, -1 }, { 0x00BF00D6, -1 }, { 0x00000000, 0 },
+    { 0x00DB0061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00162, -3 }, { 0x017700E3, -1 },
+    { 0x00D9007A, -1 }, { 0x00F80078, -1 }, { 0x01170076, -1 }, { 0x01360074, -1 },
+    { 0x01740070, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D52025, -1 },
+    { 0x00FC0177, -1 }, { 0x011B0175, -1 }, { 0x0151201D, -1 }, { 0x0178016F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560041, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0079013E, -1 }, { 0x00D300C5, -1 },
+    { 0x016E00BB, -1 }, { 0x014C004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005500E6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E201E, -1 }, { 0x005300FF, -1 }, { 0x006D201C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010E017F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01470121, -1 },
+    { 0x002D00C0, -1 }, { 0x0103003F, -1 }, { 0x0166011F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20180164, 1 }, { 0x00000000, 0 }, { 0x002E014C, -1 },
+    { 0x0145013A, 1 }, { 0x00000000, 0 }, { 0x00C3005C, -3 }, { 0x01200056, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0165, -1 }, { 0x004B0163, -1 }, { 0x012100E2, -1 }, { 0x00C10075, -1 },
+    { 0x00FF0071, -1 }, { 0x01620151, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50174, -3 }, { 0x00460109, -1 }, { 0x00DC201E, -1 },
+    { 0x00E100FF, -1 }, { 0x00FB201C, -1 }, { 0x010000FD, -2 }, { 0x01392018, -1 },
+    { 0x0141016C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0155002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01780127, 1 }, { 0x00BB00C0, -1 }, { 0x01720041, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01570142, -1 }, { 0x007B00DD, 1 },
+    { 0x0059006C, 1 }, { 0x0151005C, -2 }, { 0x01760140, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0155015B, -1 }, { 0x007900F6, -1 },
+    { 0x01740159, -1 }, { 0x01110079, -1 }, { 0x016E0073, -1 }, { 0x201F002C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0077010F, -1 }, { 0x016A201E, -1 }, { 0x016F00FF, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F015D, -1 },
+    { 0x00000000, 0 }, { 0x201C00EA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00AB0057, -1 }, { 0x01080051, -1 }, { 0x00000000, 0 },
+    { 0x201D0176, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010C0150, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00500175, 1 }, { 0x002E0104, 1 }, { 0x0067201F, 1 }, { 0x00C42019, -2 },
+    { 0x01022015, -1 }, { 0x016400F0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201300C2, -1 }, { 0x004B011B, -1 }, { 0x01620109, -2 },
+    { 0x00000000, 0 }, { 0x00C1002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002700C3, -1 }, { 0x004600C1, -3 }, { 0x00BF0046, -1 }, { 0x00DE0044, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0028014F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01390057, -2 },
+    { 0x01580055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00E9, -2 }, { 0x015900E1, -1 },
+    { 0x00DA0076, -1 }, { 0x0175006C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F5201F, -1 }, { 0x00DB0102, -2 },
+    { 0x0114201D, 1 }, { 0x01522019, 1 }, { 0x017600F8, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01360115, -1 }, { 0x01550113, -1 }, { 0x01740111, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D400C1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590155, -1 }, { 0x005600E2, -2 },
+    { 0x00780153, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201F0115, -1 }, { 0x00000000, 0 }, { 0x004F201A, -1 },
+    { 0x006E2018, -1 }, { 0x00000000, 0 }, { 0x01680076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014D0177, -1 }, { 0x010C0108, -1 }, { 0x014A0104, -1 }, { 0x016C0175, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A0145, -1 },
+    { 0x00000000, 0 }, { 0x0162203A, -1 }, { 0x0050012D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190160, -1 }, { 0x00000000, 0 }, { 0x002F0148, -1 }, { 0x00000000, 0 },
+    { 0x002C00D5, -1 }, { 0x004B00D3, -1 }, { 0x01020054, -3 }, { 0x014300C3, -1 },
+    { 0x016200C1, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014100DC, -1 }, { 0x00650077, -1 }, { 0x013E0069, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD201A, -3 }, { 0x00280107, -1 }, { 0x00660103, 1 },
+    { 0x00C300FD, -2 }, { 0x00FC2018, -1 }, { 0x0104016C, -2 }, { 0x01782010, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DA002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C004F, -1 }, { 0x0154003F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0177013C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DA015F, -1 }, { 0x00562013, -1 }, { 0x013400E6, -1 },
+    { 0x00F30077, -1 }, { 0x017200E2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D80178, -1 }, { 0x0059010D, -2 },
+    { 0x0078010B, -1 }, { 0x015100FD, -1 }, { 0x01540170, -1 }, { 0x201E0041, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0168002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00E6, -1 }, { 0x00D10137, 1 }, { 0x010F0133, 1 }, { 0x016C012D, 1 },
+    { 0x004F0059, -1 }, { 0x01660047, -1 }, { 0x00000000, 0 }, { 0x201E0172, -1 },
+    { 0x00000000, 0 }, { 0x201B00FF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0074, -1 }, { 0x01450062, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0068201B, -1 },
+    { 0x002F0100, -3 }, { 0x004E00FE, 1 }, { 0x00C52015, -1 }, { 0x0168015F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006B0115, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0044004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015C00C4, -1 }, { 0x00DD0059, 1 }, { 0x0178004F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF00E7, -1 }, { 0x00FD00E3, -1 }, { 0x01760068, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C00173, -1 }, { 0x00DF0171, -1 }, { 0x00F6201B, -1 },
+    { 0x017700F4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01370111, -1 },
+    { 0x0175010D, -1 }, { 0x00000000, 0 }, { 0x00F3002F, -1 }, { 0x01500029, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005900C5, -3 }, { 0x00000000, 0 }, { 0x00D2004A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025016B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0079014F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x012D005D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D100EF, 2 },
+    { 0x016C00E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012F0175, -1 },
+    { 0x0146201F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0043, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50054, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180175, 1 }, { 0x20150102, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004A00E8, -1 }, { 0x00280077, 1 }, { 0x010400DC, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0176, -3 },
+    { 0x0062201E, -1 }, { 0x00C400F9, -1 }, { 0x012100F3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20110134, -1 },
+    { 0x00000000, 0 }, { 0x00412039, -1 }, { 0x01772025, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002200C2, -1 }, { 0x004100C0, 1 }, { 0x0117003F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0142, 1 }, { 0x00BB00D1, -1 }, { 0x015600C7, -1 }, { 0x0159013A, -1 },
+    { 0x01780138, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB015B, -1 }, { 0x01570153, -1 }, { 0x005C00F0, -1 }, { 0x0059007D, 1 },
+    { 0x007B00EE, 1 }, { 0x0132006F, -1 }, { 0x01760151, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F0201E, -1 }, { 0x00790107, -1 },
+    { 0x00F500FF, -1 }, { 0x010F201C, 2 }, { 0x014D2018, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580122, -1 },
+    { 0x00CF2039, -1 }, { 0x201D0056, 1 }, { 0x014A002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F0070, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0052016D, -1 }, { 0x014A015D, -1 },
+    { 0x016600E8, -2 }, { 0x01250079, -2 }, { 0x01440077, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018012D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01450103, -1 }, { 0x01640101, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010200AD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010000C6, 1 }, { 0x00BF0057, -2 }, { 0x00DE0055, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410078, 1 }, { 0x01770064, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00640175, -1 }, { 0x00420104, -1 }, { 0x00C1016F, -1 }, { 0x00DD00FA, -1 },
+    { 0x01542011, -1 }, { 0x015900F2, -1 }, { 0x017800F0, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0138010D, -1 }, { 0x0157010B, -1 },
+    { 0x01760109, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500DB, -1 }, { 0x01740122, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260167, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550067, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005600F3, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F20175, -1 }, { 0x0054010C, -1 },
+    { 0x00D00104, -1 }, { 0x010E0100, -1 }, { 0x012D00FE, 2 }, { 0x01662019, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002D0041, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A0156, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F0159, -1 }, { 0x00000000, 0 }, { 0x016200D2, -1 },
+    { 0x0067006F, -1 }, { 0x01210063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0170, -1 }, { 0x00C02014, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015E0104, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0176203A, -1 }, { 0x00FF0123, -1 }, { 0x015C011D, -1 },
+    { 0x00BB0041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0140, -1 },
+    { 0x00DE013E, -1 }, { 0x00FD013C, -1 }, { 0x017600C1, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00220163, 1 },
+    { 0x0177014D, -1 }, { 0x00D900E4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01560168, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059011E, -2 }, { 0x00000000, 0 },
+    { 0x005600AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570137, 1 },
+    { 0x00760135, 1 }, { 0x005400C4, -4 }, { 0x01300129, 1 }, { 0x201C006B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005200DD, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A010E, -1 }, { 0x00000000, 0 }, { 0x004B2015, -1 }, { 0x00CC00EE, 1 },
+    { 0x00E80079, -1 }, { 0x01450073, -1 }, { 0x01640071, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190129, 1 }, { 0x00000000, 0 }, { 0x002F0111, -3 },
+    { 0x014600FF, -2 }, { 0x00000000, 0 }, { 0x00670027, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0106011C, -1 }, { 0x00C500AD, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01040135, 1 }, { 0x01420131, 1 }, { 0x00C300C6, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20130174, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01590062, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2016B, -1 },
+    { 0x00BF00F8, -1 }, { 0x00FD00F4, -1 }, { 0x011F0165, 1 }, { 0x013E0163, 1 },
+    { 0x01760079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01770105, -1 }, { 0x00000000, 0 },
+    { 0x0079002F, -2 }, { 0x00D60029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BB012A, -1 }, { 0x01560120, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005900D6, -2 }, { 0x017000C4, -2 }, { 0x00560063, -2 }, { 0x01100057, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700EF, 2 }, { 0x00000000, 0 }, { 0x00D00074, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006F2025, -1 }, { 0x00D10100, -1 }, { 0x01292019, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A00C6, -1 }, { 0x00530121, -1 },
+    { 0x0072011F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900E1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0056, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A016D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010600D4, -1 }, { 0x002A006F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E016E, -1 }, { 0x00C12010, -1 }, { 0x012300EB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FD2025, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0042002C, -1 }, { 0x0061002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0046012B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013900C1, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0153, -2 },
+    { 0x00DA00E0, -1 }, { 0x01340067, -1 }, { 0x015600D8, -1 }, { 0x01780149, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00400176, -1 },
+    { 0x0076201E, -3 }, { 0x007B00FF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250134, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D0002C, -1 }, { 0x00EF002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0067, -2 }, { 0x00000000, 0 },
+    { 0x005500C0, -2 }, { 0x0052004D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056014C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EB005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016800E0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0123201C, 1 }, { 0x01612018, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2018013E, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015E002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0143012D, 2 }, { 0x00C400C2, 1 }, { 0x0162012B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004600E3, -1 }, { 0x00C200DB, -2 },
+    { 0x00BF0068, -1 }, { 0x00FD0064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01390079, -1 }, { 0x01580077, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD010B, -2 }, { 0x01590103, -1 }, { 0x01780101, -1 }, { 0x20260047, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D30057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260178, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007700E9, -1 }, { 0x00000000, 0 }, { 0x00550078, -1 }, { 0x010F006C, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590177, -1 }, { 0x00560104, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F0137, 1 },
+    { 0x00000000, 0 }, { 0x016E017E, -1 }, { 0x0054011D, -2 }, { 0x20190051, -1 },
+    { 0x201C00C4, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0150, -1 }, { 0x00000000, 0 }, { 0x201A00DD, -3 }, { 0x203900DB, -1 },
+    { 0x004F00C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800F6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00AB0162, -1 }, { 0x004B00F5, -1 }, { 0x014300E5, -1 },
+    { 0x01020076, -2 }, { 0x01210074, 1 }, { 0x016200E3, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011D201F, 1 }, { 0x013C201D, -1 },
+    { 0x015B201B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00280129, 1 }, { 0x00000000, 0 }, { 0x00410041, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00C3, -3 }, { 0x00BB0052, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025201D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0151, -1 }, { 0x00FD014D, -1 },
+    { 0x005C0071, -1 }, { 0x017600D2, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410172, -2 }, { 0x0077201A, -3 },
+    { 0x013600EF, 1 }, { 0x01390162, -2 }, { 0x01710078, 1 }, { 0x017400EB, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014E2025, -1 }, { 0x01720104, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01320121, -1 }, { 0x0170011D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201F00EF, 1 }, { 0x00570148, -1 }, { 0x00000000, 0 },
+    { 0x005400D5, -1 }, { 0x014C00C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0108, -1 }, { 0x00550161, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006E0079, -2 }, { 0x0147006B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0121, -1 },
+    { 0x00000000, 0 }, { 0x00E6201C, -1 }, { 0x00EB00FD, -1 }, { 0x01622014, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019013A, 1 }, { 0x00000000, 0 }, { 0x002F0122, -1 }, { 0x20130054, -1 },
+    { 0x004B00AD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002800E1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00FC0079, -1 }, { 0x011B0077, -1 }, { 0x01590073, -1 }, { 0x01780071, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000178, -3 }, { 0x00BF0109, -1 },
+    { 0x00D92026, -1 }, { 0x00FD0105, -1 }, { 0x0155201E, -2 }, { 0x015A00FF, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BB013B, -1 }, { 0x00000000, 0 }, { 0x013400C0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900E7, -2 },
+    { 0x00D500DF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0052201F, -2 },
+    { 0x00570100, -4 }, { 0x007600FE, -1 }, { 0x010C2013, -1 }, { 0x016E00EE, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00C0, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E014C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0164003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900F2, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0065, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01660152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50076, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00E0201F, -1 }, { 0x00FF201D, 1 }, { 0x014200FA, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01210115, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20262019, -1 },
+    { 0x00000000, 0 }, { 0x00DF014B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0178015A, -1 }, { 0x013700EB, -1 },
+    { 0x017500E7, -1 }, { 0x01340078, -1 }, { 0x01530076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01380177, -1 },
+    { 0x01540102, 1 }, { 0x01760173, -1 }, { 0x0056002C, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005A012B, 1 }, { 0x0133011D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00770142, -1 }, { 0x01500134, -1 },
+    { 0x0071005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0104, 1 }, { 0x0056015D, -2 }, { 0x00000000, 0 },
+    { 0x007200E8, -1 }, { 0x00500077, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C011D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0166010A, -1 }, { 0x00000000, 0 },
+    { 0x0103002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2018014F, -1 }, { 0x00000000, 0 }, { 0x004D0135, 1 }, { 0x01450125, 1 },
+    { 0x004A00C2, -1 }, { 0x00280051, -1 }, { 0x01640123, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0150, -1 },
+    { 0x004B014E, -1 }, { 0x0143013E, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00412013, -1 }, { 0x004600F4, -1 }, { 0x011F00E6, -1 },
+    { 0x013E00E4, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0066017E, 1 }, { 0x00C30178, -3 }, { 0x013C00FD, -1 },
+    { 0x01752018, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD011C, -2 }, { 0x00000000, 0 }, { 0x0172002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB0135, 1 }, { 0x0176012B, 2 }, { 0x00D800C2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202500FD, -3 }, { 0x00000000, 0 }, { 0x007900E1, -1 }, { 0x01740144, -1 },
+    { 0x00570070, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0172015D, -1 }, { 0x005800FC, -1 },
+    { 0x00722019, 1 }, { 0x010F007D, 2 }, { 0x014D0079, -1 }, { 0x016C0077, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560115, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0050002F, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190062, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0161, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014A0137, 1 }, { 0x00000000, 0 },
+    { 0x014700C4, -1 }, { 0x016600C2, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A0178, -1 }, { 0x00000000, 0 }, { 0x20180107, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0142006A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F017B, -1 }, { 0x002C0108, -1 }, { 0x00462025, -2 }, { 0x004B0106, -1 },
+    { 0x006D0177, -2 }, { 0x00C2201D, -2 }, { 0x00E1201B, -1 }, { 0x01002019, -2 },
+    { 0x016200F4, -2 }, { 0x201100C6, -1 }, { 0x002A0121, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE002F, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004400C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD00D4, -2 }, { 0x00000000, 0 }, { 0x00DA0061, -1 },
+    { 0x01560059, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0162, -1 }, { 0x00DE0160, -1 }, { 0x013800E7, -1 },
+    { 0x015700E5, -1 }, { 0x017600E3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D42025, -1 }, { 0x00FB0177, -1 },
+    { 0x0131201F, -1 }, { 0x01360100, 1 }, { 0x015500FE, -1 }, { 0x01580171, -1 },
+    { 0x016F201B, -1 }, { 0x017400FC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01340119, -1 }, { 0x00000000, 0 }, { 0x00550041, -2 }, { 0x016C002F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590140, 1 }, { 0x00D200C5, -1 }, { 0x011000C1, -1 },
+    { 0x201E0074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A201F, -2 },
+    { 0x201F0100, -2 }, { 0x00570159, -1 }, { 0x00000000, 0 }, { 0x005400E6, -2 },
+    { 0x00000000, 0 }, { 0x01680061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0119, -2 }, { 0x00000000, 0 }, { 0x006C201C, -1 },
+    { 0x005200FF, -1 }, { 0x007100FD, 1 }, { 0x014A00EF, 2 }, { 0x0166007A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A0130, -1 }, { 0x201800BF, -3 },
+    { 0x01622025, -3 }, { 0x010A010C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C00C0, 1 },
+    { 0x0102003F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016000C5, -1 }, { 0x00460064, -1 }, { 0x00C2005C, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002800F2, -1 }, { 0x006600EE, 3 }, { 0x00C00075, -1 },
+    { 0x011D006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C40174, -3 }, { 0x00DB201E, -1 }, { 0x00E000FF, -1 }, { 0x00FA201C, -1 },
+    { 0x01020170, -2 }, { 0x01762014, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00430122, -1 }, { 0x00BF011A, -1 },
+    { 0x00DE0118, -1 }, { 0x0154002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01770127, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600F9, -1 },
+    { 0x00000000, 0 }, { 0x01750140, -1 }, { 0x00000000, 0 }, { 0x0058006C, 1 },
+    { 0x0077006A, 1 }, { 0x0150005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C016B, -1 }, { 0x005900F8, -2 }, { 0x007800F6, -1 },
+    { 0x00D80163, 1 }, { 0x012F0077, -1 }, { 0x013200EA, -1 }, { 0x017000E6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570111, -2 },
+    { 0x0076010F, -1 }, { 0x016E00FF, -1 }, { 0x00700029, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B00EA, -1 }, { 0x20180077, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0176, 1 },
+    { 0x00000000, 0 }, { 0x20190103, -1 }, { 0x00000000, 0 }, { 0x002F00EB, -3 },
+    { 0x00000000, 0 }, { 0x004B0076, -2 }, { 0x0105006A, 3 }, { 0x01620064, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0066201F, 2 },
+    { 0x002D0104, -1 }, { 0x004C0102, 1 }, { 0x00C32019, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0164017C, -1 }, { 0x004A011B, -1 }, { 0x0123010D, -1 }, { 0x00000000, 0 },
+    { 0x00C0002D, -1 }, { 0x00FE0029, -1 }, { 0x011D0027, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0178003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046014D, -1 },
+    { 0x00BF00D2, -1 }, { 0x00DE00D0, -1 }, { 0x01760053, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D90076, -1 },
+    { 0x0174006C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0175, -1 }, { 0x00BB0104, -1 }, { 0x00DA0102, -2 },
+    { 0x00F4201F, -1 }, { 0x01512019, -1 }, { 0x015600FA, -1 }, { 0x017500F8, -1 },
+    { 0x0178016B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0123, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0079013A, -1 }, { 0x00D300C1, -1 }, { 0x00D60134, -1 }, { 0x010E004A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00770153, -1 }, { 0x005500E2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E201A, -1 }, { 0x006D2018, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D0017F, -1 },
+    { 0x01680102, -2 }, { 0x016B0175, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0147011D, -1 }, { 0x0166011B, -2 }, { 0x00C5003F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0162014D, -2 },
+    { 0x006700EA, -1 }, { 0x00640077, -1 }, { 0x015C0067, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50170, -2 },
+    { 0x00DC201A, -1 }, { 0x00460105, -1 }, { 0x00C200FD, -2 }, { 0x00FB2018, -1 },
+    { 0x010000F9, -1 }, { 0x01410168, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004100AB, -1 },
+    { 0x00D9002E, -1 }, { 0x00F8002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD012D, 2 },
+    { 0x01590125, -1 }, { 0x01340041, -1 }, { 0x0153003F, -1 }, { 0x01780123, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01190142, 1 }, { 0x005C00DB, -1 }, { 0x00590068, 1 }, { 0x0113005C, -1 },
+    { 0x0157013E, -1 }, { 0x0176013C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D9015F, -1 }, { 0x01740155, -1 }, { 0x007900F2, -1 }, { 0x00F20077, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0077010B, -1 }, { 0x013100FF, -1 },
+    { 0x014B201C, -1 }, { 0x016A201A, -1 }, { 0x201D0041, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CF00AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190073, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A00FF, -1 }, { 0x010C014C, -1 }, { 0x00000000, 0 }, { 0x016600D3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00500171, 1 }, { 0x002E0100, 1 },
+    { 0x0067201B, 1 }, { 0x00C42015, -1 }, { 0x01022011, -1 }, { 0x014500EE, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B0117, -1 }, { 0x01620105, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF0042, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017D0135, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01580051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD00E5, -2 }, { 0x00000000, 0 }, { 0x01750068, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF0173, -1 }, { 0x00F5201B, -1 }, { 0x01142019, 1 }, { 0x015700F6, -1 },
+    { 0x017600F4, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01360111, -1 }, { 0x0155010F, -1 },
+    { 0x0174010D, -2 }, { 0x00F2002F, -1 }, { 0x014F0029, -1 }, { 0x00000000, 0 },
+    { 0x20260152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590151, -2 }, { 0x0078014F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F0111, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010F0177, 1 }, { 0x014A0100, -1 },
+    { 0x0164201D, 1 }, { 0x004C002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x203A0141, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00500129, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019015C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F0144, -1 }, { 0x004E0142, 1 }, { 0x00C40054, -3 },
+    { 0x00C700C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20140102, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A00EA, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040168, -2 },
+    { 0x00280103, -1 }, { 0x00C300F9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20100134, -1 }, { 0x00000000, 0 },
+    { 0x01762025, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BB002C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FD0127, -1 }, { 0x015A0121, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x017400C5, -4 }, { 0x00790062, -1 }, { 0x00D6005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026010A, -1 }, { 0x00DA015B, -1 },
+    { 0x01750151, -1 }, { 0x013400E2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D80174, -1 }, { 0x00590109, -2 }, { 0x00780107, -1 }, { 0x00F400FF, -1 },
+    { 0x011300FD, -1 }, { 0x0154016C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570122, -1 }, { 0x00CE2039, -1 },
+    { 0x201C0056, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00E2, -1 }, { 0x00000000, 0 },
+    { 0x010F012F, 1 }, { 0x012E012D, 1 }, { 0x01660043, -1 }, { 0x016C0129, 1 },
+    { 0x00000000, 0 }, { 0x201E016E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010A00D5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0168015B, -1 }, { 0x002F00FC, -1 }, { 0x00C52011, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B0111, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015C00C0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20110178, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF00E3, -1 },
+    { 0x011C00DD, -1 }, { 0x0119006A, 1 }, { 0x013B00DB, -1 }, { 0x01760064, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C0016F, -1 },
+    { 0x00410104, 1 }, { 0x00DF016D, -1 }, { 0x01342013, -1 }, { 0x0174007D, 1 },
+    { 0x017700F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0059203A, -1 }, { 0x0137010D, -1 }, { 0x01750109, -1 }, { 0x0178017C, -1 },
+    { 0x202600C2, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900C1, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250167, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540067, -2 }, { 0x00EF005D, 1 }, { 0x014C0057, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016C00E1, -1 }, { 0x00000000, 0 }, { 0x00ED0076, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00F10175, -2 }, { 0x0127201D, -1 }, { 0x0146201B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0041, 1 }, { 0x0162002D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A00E4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0172, -1 }, { 0x0062201A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01600177, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD013E, 1 }, { 0x00BB00CD, -1 },
+    { 0x015600C3, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01380151, -1 },
+    { 0x015400DC, -1 }, { 0x00590079, -1 }, { 0x0157014F, -1 }, { 0x01700067, -1 },
+    { 0x0176014D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F0201A, -1 }, { 0x00790103, -1 }, { 0x010F2018, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0058011E, -1 }, { 0x0172017F, -1 }, { 0x00000000, 0 },
+    { 0x012B002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560137, 1 }, { 0x201B006B, 1 },
+    { 0x005300C4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540150, -1 },
+    { 0x012D0142, 2 }, { 0x005100DD, -1 }, { 0x0127005C, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00520169, -1 }, { 0x004A2015, -1 }, { 0x014700E6, -1 }, { 0x016600E4, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180129, 1 }, { 0x00000000, 0 }, { 0x015F201C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00660027, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C70120, -1 },
+    { 0x00000000, 0 }, { 0x00C400AD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C200C6, 1 }, { 0x010000C2, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1016B, -1 }, { 0x00420100, -1 },
+    { 0x00DD00F6, -2 }, { 0x00FF0167, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01380109, -1 }, { 0x01570107, -1 }, { 0x01760105, -2 }, { 0x00D50029, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01360122, -1 }, { 0x0174011E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260163, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800D6, -1 },
+    { 0x015000C6, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005600EF, 2 }, { 0x014E00DF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540108, -1 }, { 0x00D00100, -1 }, { 0x00EF00FE, 2 },
+    { 0x01662015, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00AD0134, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F0155, -1 }, { 0x00C700D8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004C016C, -1 }, { 0x00C02010, -1 }, { 0x00000000, 0 },
+    { 0x013E0076, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01420175, 1 }, { 0x0159201F, 1 },
+    { 0x015E0100, -1 }, { 0x0178201D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00FF011F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00620142, 1 }, { 0x00BF013C, -1 }, { 0x00DE013A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D900E0, -1 },
+    { 0x00790073, -1 }, { 0x01330067, -1 }, { 0x017400D6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01560164, -2 },
+    { 0x013400F3, -1 }, { 0x017200EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00542039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EE002A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0067, -1 }, { 0x016E0121, -1 }, { 0x005400C0, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00F3, -2 }, { 0x00000000, 0 }, { 0x00F00142, 1 },
+    { 0x005200D9, -1 }, { 0x00EA005C, -1 }, { 0x010F0140, 3 }, { 0x01470056, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B2011, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190125, 1 },
+    { 0x00000000, 0 }, { 0x002F010D, -3 }, { 0x012700FD, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20110058, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C300C2, 1 }, { 0x00440057, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C100DB, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF00F4, -1 }, { 0x00FD00F0, -1 },
+    { 0x01380079, -1 }, { 0x01760075, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250047, -1 },
+    { 0x01770101, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600D3, -1 },
+    { 0x00BB0126, -1 }, { 0x0156011C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01350137, 1 }, { 0x005900D2, -2 }, { 0x013200C4, -1 },
+    { 0x00D20057, -1 }, { 0x017000C0, -2 }, { 0x00000000, 0 }, { 0x20250178, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700EB, -2 },
+    { 0x007600E9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580177, -1 },
+    { 0x00550104, -2 }, { 0x01500167, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B00C4, -2 }, { 0x0053011D, -1 }, { 0x0072011B, -1 }, { 0x203A00C2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201900DD, 1 }, { 0x00000000, 0 }, { 0x002F00C5, -3 },
+    { 0x004E00C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0169, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C00DC, -1 }, { 0x00000000, 0 }, { 0x01410059, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E016A, -1 }, { 0x004A00F5, -1 }, { 0x012300E7, -1 }, { 0x01010076, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00E60177, -1 }, { 0x01020102, 1 }, { 0x01050175, -1 },
+    { 0x013B201D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011F0119, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0157002F, -2 }, { 0x0176002D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DC00C3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD014F, -2 }, { 0x00BB00DE, -1 }, { 0x015600D4, -1 },
+    { 0x01340063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0076201A, -3 }, { 0x005C00FD, -1 },
+    { 0x0176015E, -1 }, { 0x01700078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014D2025, -1 },
+    { 0x01740177, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0063, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560148, -1 }, { 0x00000000, 0 }, { 0x016A00C3, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540161, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006D0079, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004A2026, -1 }, { 0x00E5201C, -1 }, { 0x00EA00FD, -1 }, { 0x01232018, 1 },
+    { 0x016600F5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018013A, 1 },
+    { 0x00000000, 0 }, { 0x002E0122, -1 }, { 0x00000000, 0 }, { 0x004A00AD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0124012B, 1 },
+    { 0x01430129, 2 }, { 0x015C0041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0064, -1 }, { 0x00DE0062, -1 },
+    { 0x013B005C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011D00EA, -1 }, { 0x00FB0079, -1 },
+    { 0x01770071, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011E0176, -1 }, { 0x00D82026, -1 }, { 0x00DD0107, -2 },
+    { 0x0173201C, -1 }, { 0x017800FD, -1 }, { 0x20260043, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D600C6, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260174, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007700E5, -1 }, { 0x00D400DF, -1 },
+    { 0x00D1006C, 1 }, { 0x010F0068, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590173, -1 }, { 0x00560100, -4 },
+    { 0x0070201D, -1 }, { 0x01700161, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E017A, -1 },
+    { 0x00540119, -2 }, { 0x01662026, -3 }, { 0x201C00C0, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D014C, -1 }, { 0x00000000, 0 },
+    { 0x201A00D9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016600AD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201800F2, -1 }, { 0x00000000, 0 }, { 0x002E00DA, -1 },
+    { 0x016400C6, -3 }, { 0x004A0065, -1 }, { 0x01040059, -3 }, { 0x00000000, 0 },
+    { 0x2019017E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014300E1, -1 }, { 0x00000000, 0 }, { 0x00C40076, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DF201F, -1 }, { 0x00C50102, 1 }, { 0x00FE201D, -1 }, { 0x011D201B, 1 },
+    { 0x013C2019, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00660121, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BB004E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20252019, -1 }, { 0x00000000, 0 },
+    { 0x00BF014D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0041016E, -2 }, { 0x00000000, 0 }, { 0x013600EB, -1 }, { 0x015500E9, -1 },
+    { 0x017400E7, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01102025, -1 }, { 0x01340104, -1 },
+    { 0x01370177, -1 }, { 0x0055002C, -1 }, { 0x01560175, -1 }, { 0x016D201F, -1 },
+    { 0x01720100, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0059012B, 2 }, { 0x0132011D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F00EB, -1 },
+    { 0x00000000, 0 }, { 0x00570144, -1 }, { 0x00760142, -1 }, { 0x0070005C, -2 },
+    { 0x010E00C5, -1 }, { 0x014C00C1, -1 }, { 0x201C0078, 1 }, { 0x00000000, 0 },
+    { 0x201D0104, -4 }, { 0x0055015D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01470067, -1 }, { 0x01660065, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B011D, -1 }, { 0x00000000, 0 }, { 0x00E62018, -1 },
+    { 0x01622010, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0102002A, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A00C4, -2 },
+    { 0x013E003F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FE005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670165, 1 },
+    { 0x00000000, 0 }, { 0x00FF00E8, -1 }, { 0x00DD0077, -1 }, { 0x0159006F, -1 },
+    { 0x0178006D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C20178, -3 }, { 0x01000174, -3 }, { 0x00BF0105, -1 }, { 0x00FD0101, -1 },
+    { 0x013B00FD, -1 }, { 0x0155201A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA0135, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005900E3, -2 }, { 0x00000000, 0 }, { 0x00560070, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0052201B, -2 }, { 0x005700FC, -1 }, { 0x00D60167, 1 },
+    { 0x013000EE, 1 }, { 0x016B0077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01500178, -1 }, { 0x00000000, 0 },
+    { 0x016C0103, -1 }, { 0x00000000, 0 }, { 0x004F002F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180062, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E004A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0161, -1 }, { 0x00000000, 0 },
+    { 0x201900EE, 1 }, { 0x01680135, 1 }, { 0x002F00D6, -1 }, { 0x00000000, 0 },
+    { 0x0162004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20390178, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0166014E, -1 }, { 0x006B00EB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006C0177, -1 },
+    { 0x00C1201D, -2 }, { 0x00E0201B, -1 }, { 0x00FF2019, 1 }, { 0x010400FA, -1 },
+    { 0x012300F8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201000C6, -1 }, { 0x01210111, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD002F, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D90061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00592014, -1 }, { 0x00DD0160, -1 }, { 0x013700E7, -1 }, { 0x00F60078, -1 },
+    { 0x01150076, -1 }, { 0x017500E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D32025, -1 }, { 0x00FA0177, -1 }, { 0x01190175, -1 },
+    { 0x014F201D, -1 }, { 0x0176016F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00790125, -1 },
+    { 0x00000000, 0 }, { 0x00540041, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580140, 1 }, { 0x0077013E, -1 }, { 0x00D100C5, -1 }, { 0x016C00BB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0100, 1 },
+    { 0x00560159, -1 }, { 0x00000000, 0 }, { 0x007200E4, -1 }, { 0x00500073, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0119, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005100FF, 1 },
+    { 0x007000FD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01660106, -1 }, { 0x00000000, 0 }, { 0x00C5002A, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01450121, -1 }, { 0x0164011F, -2 }, { 0x0101003F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C014C, -1 }, { 0x0143013A, 1 }, { 0x00000000, 0 },
+    { 0x00C1005C, -3 }, { 0x011E0056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004600F0, -1 }, { 0x00BF0075, -1 }, { 0x00FD0071, -1 }, { 0x011F00E2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30174, -3 },
+    { 0x00DA201E, -1 }, { 0x00DF00FF, -1 }, { 0x00F9201C, -1 }, { 0x00FE00FD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260054, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0134002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760127, 1 },
+    { 0x00000000, 0 }, { 0x00590053, -1 }, { 0x01700041, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500F9, -1 }, { 0x00000000, 0 },
+    { 0x01550142, -1 }, { 0x01740140, 1 }, { 0x0057006C, 1 }, { 0x0076006A, 1 },
+    { 0x014F005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00722015, -1 }, { 0x007700F6, -1 }, { 0x010F0079, 1 },
+    { 0x016C0073, -1 }, { 0x201D002C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560111, -2 }, { 0x0168201E, -1 },
+    { 0x016D00FF, -1 }, { 0x006F0029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D015D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014700C0, -1 }, { 0x01060051, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0176, 1 }, { 0x203A0174, -1 },
+    { 0x00000000, 0 }, { 0x010A0150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0104006A, 1 }, { 0x01420066, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0177, -1 }, { 0x002C0104, 1 },
+    { 0x004B0102, 1 }, { 0x0065201F, -1 }, { 0x00C22019, -2 }, { 0x01002015, -1 },
+    { 0x016200F0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201100C2, -1 },
+    { 0x002A011D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004400C1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x017800C6, -3 }, { 0x01560055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE015C, -1 },
+    { 0x013800E3, -1 }, { 0x015700E1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DC0175, -1 }, { 0x00D90102, -2 }, { 0x00F3201F, -1 }, { 0x0112201D, 1 },
+    { 0x0131201B, -1 }, { 0x013600FC, -1 }, { 0x0158016D, -1 }, { 0x017400F8, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01340115, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059013C, 1 },
+    { 0x00D200C1, -1 }, { 0x00D50134, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A201B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570155, -1 }, { 0x005400E2, -2 }, { 0x00760153, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0115, -2 },
+    { 0x00000000, 0 }, { 0x002E201C, -2 }, { 0x005200FB, -1 }, { 0x006C2018, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A012C, -1 }, { 0x00000000, 0 }, { 0x014B0177, -2 }, { 0x010A0108, -1 },
+    { 0x016A0175, -1 }, { 0x004A002E, -1 }, { 0x01040022, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E012D, 2 }, { 0x00000000, 0 }, { 0x00C4003F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014100C3, 1 }, { 0x01000054, -3 },
+    { 0x016000C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01230151, -1 }, { 0x002800EE, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40170, -2 }, { 0x00DB201A, -1 },
+    { 0x00C100FD, -2 }, { 0x00FA2018, -1 }, { 0x0102016C, -2 }, { 0x01762010, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0043011E, -1 }, { 0x00BF0116, -1 }, { 0x00DE0114, -1 }, { 0x00D8002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC012D, 1 }, { 0x01770123, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0175013C, -1 },
+    { 0x00000000, 0 }, { 0x00580068, 1 }, { 0x01500058, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0167, -1 },
+    { 0x00542013, -1 }, { 0x005900F4, -2 }, { 0x007800F2, -1 }, { 0x00F10077, -2 },
+    { 0x013200E6, -1 }, { 0x017000E2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D60178, -1 }, { 0x0057010D, -2 }, { 0x0076010B, -1 }, { 0x014F00FD, -1 },
+    { 0x201C0041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CE00AB, -1 }, { 0x0166002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180073, -1 },
+    { 0x016A012D, 1 }, { 0x00AD00C6, -1 }, { 0x004D0059, -1 }, { 0x01640047, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F00E7, -3 }, { 0x004E00E5, -1 }, { 0x002C0074, -1 },
+    { 0x01430062, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0066201B, 2 }, { 0x002D0100, -1 }, { 0x00C32015, -1 },
+    { 0x01470161, -1 }, { 0x01600079, -1 }, { 0x0166015F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A0117, -1 },
+    { 0x01230109, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004300D6, -1 }, { 0x00BF00CE, -1 },
+    { 0x00DE00CC, -1 }, { 0x015A00C4, -1 }, { 0x0176004F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC00E5, -1 },
+    { 0x015800DD, -2 }, { 0x01740068, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00592025, -3 },
+    { 0x00BB0100, -1 }, { 0x00DD0171, -1 }, { 0x00F4201B, -1 }, { 0x017500F4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C011F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014E0029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250152, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F006C, 1 }, { 0x005700C5, -4 },
+    { 0x00000000, 0 }, { 0x00D0004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0077014F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012B005D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007200F5, -1 }, { 0x00CF00EF, 1 }, { 0x016A00E5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0144201F, -1 }, { 0x0163201D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660117, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010400C3, 1 }, { 0x00C30054, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20130102, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006700E6, -1 }, { 0x010200DC, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002A0176, 1 }, { 0x00C5016C, -2 }, { 0x00460101, -1 },
+    { 0x006500FF, -1 }, { 0x00C200F9, -1 }, { 0x011F00F3, -1 }, { 0x01220166, -1 },
+    { 0x01410164, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01752025, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0129, 2 }, { 0x01590121, -1 }, { 0x0115003F, -1 },
+    { 0x0178011F, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0157013A, -1 }, { 0x015400C7, -1 },
+    { 0x00590064, -2 }, { 0x00D5005C, -1 }, { 0x01760138, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2025010A, -1 }, { 0x00D9015B, -1 }, { 0x01550153, -1 },
+    { 0x01740151, -2 }, { 0x0057007D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00722026, -2 }, { 0x00770107, -1 }, { 0x00F300FF, -1 }, { 0x014B2018, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560122, -1 }, { 0x00CD2039, -1 }, { 0x007200AD, -1 },
+    { 0x201B0056, 1 }, { 0x203A0054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019006F, -2 }, { 0x012D012D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A00FB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0163005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0050016D, 1 }, { 0x002E00FC, -1 }, { 0x00C42011, -1 }, { 0x01420077, 1 },
+    { 0x016400E8, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0113, -1 }, { 0x01430103, -1 },
+    { 0x01620101, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010000AD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0158004D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20100178, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00E1, -2 }, { 0x00000000, 0 },
+    { 0x0118006A, 1 }, { 0x01750064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00620175, -1 }, { 0x0079201F, 1 },
+    { 0x00BF016F, -1 }, { 0x013800F4, -1 }, { 0x015700F2, -1 }, { 0x017600F0, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500C2, 1 },
+    { 0x0136010D, -1 }, { 0x0155010B, -1 }, { 0x01740109, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026014E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005B0134, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059014D, -2 }, { 0x00000000, 0 },
+    { 0x00530067, -1 }, { 0x00720065, -1 }, { 0x00EE005D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201F010D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005400F3, -2 }, { 0x00000000, 0 }, { 0x00EC0076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0055017F, -1 }, { 0x0052010C, -1 }, { 0x00F00175, -1 }, { 0x012B00FE, 2 },
+    { 0x01642019, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A013D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20150059, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E013E, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C500DC, -2 }, { 0x00460071, -1 }, { 0x011F0063, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01040164, -3 }, { 0x002800FF, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015C0104, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0174203A, -1 },
+    { 0x00BF0127, -1 }, { 0x00DE0125, -1 }, { 0x005C0047, -1 }, { 0x00FD0123, -1 },
+    { 0x015A011D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013600C5, 1 }, { 0x00D60058, -1 },
+    { 0x017400C1, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260106, -1 }, { 0x00000000, 0 }, { 0x01370151, -1 }, { 0x0175014D, -1 },
+    { 0x00580079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0178, -2 }, { 0x007B0176, 1 },
+    { 0x00590105, -2 }, { 0x01540168, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F00C5, -2 },
+    { 0x0057011E, -1 }, { 0x00000000, 0 }, { 0x005400AB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012E0129, 1 }, { 0x005200C4, 1 },
+    { 0x01470041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E016A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F00F8, -3 }, { 0x00000000, 0 }, { 0x00E60079, -1 }, { 0x01050077, -1 },
+    { 0x01430073, -1 }, { 0x01620071, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006B010D, -1 }, { 0x014400FF, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C300AD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C100C6, 1 }, { 0x00DD0051, -2 }, { 0x01780047, -2 },
+    { 0x00000000, 0 }, { 0x20110174, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF00DF, -1 }, { 0x00DE00DD, -2 },
+    { 0x01380064, -1 }, { 0x01570062, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C0016B, -1 }, { 0x00220102, -1 }, { 0x00410100, 1 },
+    { 0x00DF0169, -1 }, { 0x011D0165, 1 }, { 0x01740079, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01780178, 1 }, { 0x01370109, -1 },
+    { 0x01512026, -1 }, { 0x01750105, -1 }, { 0x0077002F, -2 }, { 0x00D40029, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01540120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250163, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700D6, -1 }, { 0x016E00C4, -2 },
+    { 0x00540063, -2 }, { 0x010E0057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A2026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005500EF, 1 },
+    { 0x00000000, 0 }, { 0x014A006C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0122, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00EE00FE, 2 }, { 0x01272019, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002A0056, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004A00E0, -1 }, { 0x0028006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C016E, -1 },
+    { 0x00000000, 0 }, { 0x012100EB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01410175, -1 }, { 0x0158201F, -2 }, { 0x0177201D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD013A, 1 }, { 0x00BB00C9, -1 }, { 0x20260076, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0138014D, -1 }, { 0x005C00E8, -1 }, { 0x00590075, -1 },
+    { 0x01320067, -1 }, { 0x015400D8, -1 }, { 0x01760149, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00DA, -1 },
+    { 0x201B0067, -1 }, { 0x00000000, 0 }, { 0x005300C0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F0166, 1 },
+    { 0x201C00F3, -1 }, { 0x0054014C, -1 }, { 0x00EF0142, 2 }, { 0x012D013E, 2 },
+    { 0x00E9005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A010C, -1 }, { 0x00520165, -1 }, { 0x004A2011, -1 },
+    { 0x014700E2, -1 }, { 0x016600E0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180125, 1 }, { 0x00AD0178, -1 },
+    { 0x0121201C, 1 }, { 0x015F2018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20100058, -1 }, { 0x00C7011C, -1 }, { 0x00000000, 0 },
+    { 0x015C002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C200C2, 1 }, { 0x00BF004F, -1 }, { 0x00DE004D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00A100DD, -1 }, { 0x00C000DB, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00FF0163, 1 }, { 0x00000000, 0 }, { 0x00DD00F2, -2 }, { 0x01370079, -1 },
+    { 0x01560077, -1 }, { 0x015900EA, -1 }, { 0x017800E8, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013B0178, -2 }, { 0x00000000, 0 }, { 0x01380105, -1 },
+    { 0x01570103, -1 }, { 0x0059002D, -1 }, { 0x01760101, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500D3, -1 }, { 0x0136011E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005800D2, -1 }, { 0x015000C2, -1 }, { 0x00D10057, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0059015E, -1 }, { 0x005600EB, -2 }, { 0x011000DF, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570177, -1 }, { 0x00540104, -4 },
+    { 0x01472013, -1 }, { 0x01662011, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0137, 1 }, { 0x00000000, 0 }, { 0x016C017E, -1 },
+    { 0x201A00C4, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201800DD, 1 }, { 0x00000000, 0 }, { 0x002E00C5, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0151, -3 }, { 0x00C700D4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0168, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000076, -2 }, { 0x011F0074, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00E50177, -1 }, { 0x01040175, -2 }, { 0x011B201F, -1 }, { 0x013A201D, -1 },
+    { 0x01420171, 1 }, { 0x0159201B, 1 }, { 0x01782019, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FF011B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0138, -1 },
+    { 0x00DB00C3, -2 }, { 0x007B0056, 1 }, { 0x00DE0136, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013600D6, -1 }, { 0x0079006F, -1 }, { 0x017400D2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B00FD, 1 }, { 0x013400EF, 1 },
+    { 0x016F0078, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014C2025, -1 }, { 0x01700104, -2 },
+    { 0x01730177, -1 }, { 0x0072002E, -2 }, { 0x201E004A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016E011D, -1 }, { 0x201C0063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00EF, 1 },
+    { 0x00000000, 0 }, { 0x00D10140, 1 }, { 0x005200D5, -1 }, { 0x010F013C, 3 },
+    { 0x014A00C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0072015F, -1 }, { 0x00000000, 0 }, { 0x005000EE, 1 },
+    { 0x006C0079, -1 }, { 0x0145006B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190121, -2 }, { 0x00000000, 0 }, { 0x002F0109, -3 },
+    { 0x00E4201C, -1 }, { 0x00E900FD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20110054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013E002A, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004700C6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0062, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF00F0, -1 }, { 0x00FA0079, -1 }, { 0x01190077, -1 },
+    { 0x01570073, -1 }, { 0x01760071, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250043, -1 }, { 0x015800FF, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D500C6, -2 }, { 0x013200C0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250174, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700E7, -2 }, { 0x007600E5, -1 }, { 0x00D300DF, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0050201F, 1 }, { 0x00550100, -2 }, { 0x00580173, -1 },
+    { 0x006F201D, -1 }, { 0x010A2013, -1 }, { 0x01500163, 1 }, { 0x016C00EE, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00C0, -2 }, { 0x00720117, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F00C1, -3 }, { 0x00000000, 0 }, { 0x0162003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0165, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A0067, -1 },
+    { 0x01220057, -1 }, { 0x01410055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0166, -2 }, { 0x004D0164, -1 },
+    { 0x012300E3, -1 }, { 0x00C30076, -2 }, { 0x01640152, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FD201D, 1 },
+    { 0x00C40102, 1 }, { 0x013B2019, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00460123, -1 }, { 0x011F0115, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD014B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0176015A, -1 }, { 0x005C00F9, -1 }, { 0x00000000, 0 }, { 0x01320078, -1 },
+    { 0x01510076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01360177, -2 }, { 0x01740173, -1 }, { 0x00000000, 0 },
+    { 0x0054002C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058012B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560144, -1 }, { 0x014E0134, -1 }, { 0x006F005C, -2 }, { 0x00AD0058, -1 },
+    { 0x201B0078, 1 }, { 0x00000000, 0 }, { 0x201F0177, 1 }, { 0x201C0104, -2 },
+    { 0x0054015D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0079, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00520176, -2 }, { 0x00E52018, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201500C3, -1 }, { 0x002E011E, -1 },
+    { 0x0164010A, -1 }, { 0x00000000, 0 }, { 0x0101002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B0135, 1 }, { 0x01430125, 1 }, { 0x01620123, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013B0058, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011D00E6, -1 }, { 0x00DC0077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10178, -3 },
+    { 0x01732018, -1 }, { 0x00DD0103, -1 }, { 0x011B00FF, -1 }, { 0x013A00FD, -1 },
+    { 0x017800F9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0151002E, -1 }, { 0x0170002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D90135, 1 }, { 0x0174012B, 2 },
+    { 0x00D600C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260170, -1 }, { 0x201E201C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007700E1, -1 }, { 0x00000000, 0 }, { 0x00D10068, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0059016F, -1 }, { 0x005600FC, -1 }, { 0x00702019, -1 }, { 0x00D50167, 1 },
+    { 0x014B0079, -2 }, { 0x016A0077, -1 }, { 0x0170015D, -1 }, { 0x203A002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540115, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A00D5, -1 }, { 0x010C0122, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002D004A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B0161, -1 }, { 0x00000000, 0 }, { 0x201800EE, 1 },
+    { 0x00000000, 0 }, { 0x002E00D6, -1 }, { 0x014500C4, -1 }, { 0x004A0061, -1 },
+    { 0x01040055, -2 }, { 0x016400C2, -4 }, { 0x2019017A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00442025, -1 }, { 0x006B0177, -1 },
+    { 0x00C0201D, -2 }, { 0x00DF201B, -1 }, { 0x00FE2019, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0066011D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC002F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004200C5, -1 }, { 0x00DD00BB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0149, -1 }, { 0x00DE0147, -1 },
+    { 0x00000000, 0 }, { 0x01540059, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041016A, -2 },
+    { 0x00582014, -1 }, { 0x013600E7, -1 }, { 0x00F50078, -1 }, { 0x015500E5, -1 },
+    { 0x017400E3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D22025, -1 }, { 0x00F90177, -1 }, { 0x012F201F, -1 }, { 0x01340100, -1 },
+    { 0x01560171, -1 }, { 0x016D201B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590127, 1 }, { 0x01320119, -1 },
+    { 0x00530041, -1 }, { 0x0072003F, -1 }, { 0x016A002F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201F00E7, -1 }, { 0x00000000, 0 }, { 0x00570140, 1 },
+    { 0x0076013E, -1 }, { 0x00D000C5, -1 }, { 0x010E00C1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0100, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660061, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0119, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005000FF, 1 }, { 0x006F00FD, -1 },
+    { 0x0164007A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01602025, -1 }, { 0x0108010C, -1 },
+    { 0x00000000, 0 }, { 0x00C4002A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002A00C0, -2 }, { 0x0100003F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20150164, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015E00C5, -1 }, { 0x00C0005C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FF00E4, -1 },
+    { 0x00DD0073, -2 }, { 0x0159006B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046017C, -1 }, { 0x00C20174, -3 },
+    { 0x00BF0101, -1 }, { 0x00D9201E, -1 }, { 0x00F8201C, -1 }, { 0x01000170, -2 },
+    { 0x01742014, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250054, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01750127, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0152, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0056006C, 1 }, { 0x014E005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D60163, 1 },
+    { 0x005700F8, -2 }, { 0x007600F6, -1 }, { 0x016E00E6, -1 }, { 0x201C002C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01500174, -1 }, { 0x00000000, 0 }, { 0x016C00FF, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x203A00CF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C015D, -1 }, { 0x00000000, 0 }, { 0x201900EA, -2 }, { 0x00000000, 0 },
+    { 0x002F00D2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0176, -3 }, { 0x20390174, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006B00E7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0177, -3 }, { 0x004A0102, -1 }, { 0x0064201F, -1 },
+    { 0x00C12019, -2 }, { 0x012300F4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0162017C, -1 }, { 0x00670119, -1 },
+    { 0x0121010D, -1 }, { 0x201000C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0176003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004100DA, -2 }, { 0x00000000, 0 },
+    { 0x01740053, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00592010, -1 }, { 0x00DD015C, -1 },
+    { 0x013700E3, -1 }, { 0x01780152, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0175, -1 },
+    { 0x005C010A, -1 }, { 0x00D80102, -1 }, { 0x00F2201F, -1 }, { 0x014F2019, -1 },
+    { 0x015400FA, -1 }, { 0x0176016B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00790121, -1 }, { 0x201F0057, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058013C, 1 }, { 0x0077013A, -1 },
+    { 0x00520056, -2 }, { 0x00D100C1, -1 }, { 0x00D40134, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E00FC, -1 }, { 0x00000000, 0 }, { 0x00560155, -1 },
+    { 0x007200E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0115, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01690175, -1 }, { 0x01470104, -1 }, { 0x01660102, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D012D, 1 },
+    { 0x0145011D, -1 }, { 0x00C3003F, -2 }, { 0x0164011B, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00620077, -1 },
+    { 0x00BF0071, -1 }, { 0x015A0067, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00470178, -1 }, { 0x00C30170, -2 }, { 0x00C000FD, -2 },
+    { 0x00DA201A, -1 }, { 0x00DF00FB, -1 }, { 0x00F92018, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0178010A, -2 }, { 0x00000000, 0 }, { 0x00F6002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB012D, 1 }, { 0x01570125, -1 }, { 0x0059004F, -2 },
+    { 0x01320041, -1 }, { 0x01760123, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01170142, 1 }, { 0x0155013E, -1 },
+    { 0x00570068, 1 }, { 0x0174013C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00722011, -1 },
+    { 0x007700F2, -1 }, { 0x00F00077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D50178, -1 },
+    { 0x0056010D, -2 }, { 0x012F00FF, -1 }, { 0x0149201C, -1 }, { 0x00500027, 1 },
+    { 0x0168201A, -1 }, { 0x201B0041, -2 }, { 0x00000000, 0 }, { 0x201F0140, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CD00AB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004C0059, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800FF, 1 }, { 0x010A014C, -1 },
+    { 0x00000000, 0 }, { 0x016400D3, -1 }, { 0x01230064, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F0173, -1 }, { 0x002C0100, 1 }, { 0x0046201D, 1 }, { 0x0065201B, -1 },
+    { 0x00C22015, -1 }, { 0x01002011, -1 }, { 0x014300EE, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A0119, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0062002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x017B0135, 1 }, { 0x00000000, 0 }, { 0x017800C2, -3 }, { 0x01560051, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE0158, -1 }, { 0x00DB00E5, -1 }, { 0x00000000, 0 },
+    { 0x0135006C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F3201B, -1 }, { 0x01122019, 1 },
+    { 0x013600F8, -1 }, { 0x015500F6, -1 }, { 0x01580169, -1 }, { 0x017400F4, -2 },
+    { 0x01770167, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01340111, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F0002F, -1 },
+    { 0x014D0029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590138, -1 }, { 0x005600C5, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201F00F8, -1 }, { 0x00000000, 0 }, { 0x00570151, -2 }, { 0x0076014F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0111, -2 }, { 0x00000000, 0 }, { 0x002E2018, -2 },
+    { 0x00CE00EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A0128, -1 }, { 0x00000000, 0 },
+    { 0x0162201D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F012B, 1 }, { 0x004E0129, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20054, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0123014D, -1 }, { 0x002800EA, -1 }, { 0x0142014B, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C4016C, -2 }, { 0x006400FF, -1 }, { 0x00C100F9, -1 },
+    { 0x00FF00F5, -1 }, { 0x01020168, -2 }, { 0x0178007A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01742025, -4 }, { 0x00BF0112, -1 },
+    { 0x00DE0110, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DC0129, 1 }, { 0x0177011F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017200C5, -2 }, { 0x00770062, -1 },
+    { 0x00D4005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C0163, -1 }, { 0x00000000, 0 }, { 0x005900F0, -2 },
+    { 0x0056007D, 1 }, { 0x013200E2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D60174, -1 }, { 0x00570109, -2 },
+    { 0x00760107, -1 }, { 0x00F200FF, -1 }, { 0x011100FD, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CC2039, -1 }, { 0x201A0056, -4 }, { 0x20390054, -1 }, { 0x0147002C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2018006F, -1 }, { 0x012C012D, 1 }, { 0x00AD00C2, -1 },
+    { 0x002E0057, -4 }, { 0x01640043, -1 }, { 0x016A0129, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F00E3, -3 },
+    { 0x004E00E1, -1 }, { 0x00AB00DB, -1 }, { 0x010800D5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0147015D, -1 },
+    { 0x00C32011, -1 }, { 0x0166015B, -2 }, { 0x01410077, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004A0113, -1 }, { 0x00FF2026, -3 }, { 0x01230105, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013E0135, 3 },
+    { 0x004300D2, -1 }, { 0x00BF00CA, -1 }, { 0x00DE00C8, -1 }, { 0x013B00C2, 1 },
+    { 0x015A00C0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DC00E1, -1 }, { 0x013900DB, -1 }, { 0x015800D9, -1 },
+    { 0x01740064, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00610175, -1 }, { 0x0078201F, 1 }, { 0x00DD016D, -1 },
+    { 0x01322013, -1 }, { 0x013700F4, -1 }, { 0x017500F0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057203A, -1 }, { 0x005C011B, -1 },
+    { 0x0176017C, -1 }, { 0x00000000, 0 }, { 0x01100029, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2025014E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201F0068, 1 }, { 0x005700C1, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014A0057, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016A00E1, -1 },
+    { 0x00000000, 0 }, { 0x00EB0076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0125201D, -1 },
+    { 0x0144201B, -1 }, { 0x01632019, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01660113, -2 }, { 0x20140059, -1 }, { 0x002A0041, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006700E2, -1 }, { 0x00C400DC, -2 }, { 0x00FF0065, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0041201C, -3 }, { 0x00C50168, -2 }, { 0x01220162, -1 }, { 0x013E00ED, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015E0177, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0125, 1 },
+    { 0x0159011D, -1 }, { 0x0178011B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C00D3, -1 }, { 0x00D50058, -1 }, { 0x015400C3, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250106, -1 },
+    { 0x00000000, 0 }, { 0x01360151, -1 }, { 0x007900EA, -1 }, { 0x00570079, -1 },
+    { 0x0155014F, -1 }, { 0x016E0067, -1 }, { 0x0174014D, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00770103, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00C5, 1 }, { 0x0056011E, -1 },
+    { 0x0170017F, -1 }, { 0x203A0050, -1 }, { 0x0129002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F0151, -1 }, { 0x00000000, 0 },
+    { 0x2019006B, 1 }, { 0x00EF012D, 1 }, { 0x005100C4, -1 }, { 0x002F0053, -1 },
+    { 0x012D0129, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00520150, -1 }, { 0x012B0142, 2 }, { 0x004F00DD, -1 },
+    { 0x0125005C, -3 }, { 0x014A0140, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00500169, 1 }, { 0x00000000, 0 },
+    { 0x014500E6, -1 }, { 0x00E50079, -1 }, { 0x01040077, -2 }, { 0x016400E4, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B010F, -1 }, { 0x015D201C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C200AD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017D012D, 1 },
+    { 0x00C000C6, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20100174, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD00DD, 1 }, { 0x01370064, -1 }, { 0x017800D3, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0079201B, 1 }, { 0x00BF016B, -1 }, { 0x00FD0167, 1 }, { 0x013800F0, -1 },
+    { 0x01730079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01360109, -1 }, { 0x01502026, -1 },
+    { 0x01550107, -1 }, { 0x0076002F, -2 }, { 0x00D30029, -1 }, { 0x01740105, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590149, -1 }, { 0x005600D6, -1 }, { 0x014E00C6, -2 }, { 0x00720061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F0109, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005400EF, 1 }, { 0x014C00DF, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0122, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520108, -1 },
+    { 0x01642015, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x203A0139, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00500121, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A003B, -1 },
+    { 0x0104002F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004E013A, 1 }, { 0x004B00C7, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B0151, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013E005D, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013C0076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0157201F, 1 }, { 0x015C0100, -1 }, { 0x0176201D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0121, -1 }, { 0x00FD011F, -1 },
+    { 0x005C0043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250076, -3 },
+    { 0x013600C1, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260102, 1 }, { 0x00000000, 0 },
+    { 0x0137014D, -1 }, { 0x00000000, 0 }, { 0x00580075, -1 }, { 0x00770073, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0174, -3 }, { 0x01540164, -2 }, { 0x00590101, -1 }, { 0x013200F3, -1 },
+    { 0x017000EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201F00C1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D1012B, 2 }, { 0x005200C0, 1 }, { 0x010F0127, 3 }, { 0x0166003B, -1 },
+    { 0x016C0121, -1 }, { 0x00000000, 0 }, { 0x201E0166, -2 }, { 0x201B00F3, -1 },
+    { 0x00000000, 0 }, { 0x00EE0142, 2 }, { 0x00000000, 0 }, { 0x00E8005C, -1 },
+    { 0x01450056, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019010C, -1 }, { 0x00510165, 1 }, { 0x002F00F4, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B0109, -1 },
+    { 0x012500FD, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C100C2, 1 },
+    { 0x00420057, -1 }, { 0x01780043, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF00DB, -1 }, { 0x00DE00D9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004100FC, -1 }, { 0x017700E8, -1 }, { 0x01360079, -2 }, { 0x01740075, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD017E, -1 }, { 0x00000000, 0 }, { 0x01370105, -1 }, { 0x01750101, -1 },
+    { 0x0058002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0154011C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F0079, 1 },
+    { 0x005700D2, -1 }, { 0x016E00C0, -2 }, { 0x00D00057, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D100E3, -1 }, { 0x00000000, 0 }, { 0x00520078, 1 },
+    { 0x014A0068, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E011E, -1 },
+    { 0x00000000, 0 }, { 0x00560177, -1 }, { 0x00530104, -1 }, { 0x00750175, -1 },
+    { 0x014E0167, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0137, 1 }, { 0x00000000, 0 }, { 0x201900C4, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002D00C5, -1 }, { 0x004C00C3, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00660067, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C016A, -1 }, { 0x00432014, -1 },
+    { 0x006700F3, -1 }, { 0x012100E7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E40177, -1 },
+    { 0x01000102, 1 }, { 0x01030175, -1 }, { 0x0139201D, -1 }, { 0x013E00FE, 3 },
+    { 0x0158201B, -2 }, { 0x01772019, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011D0119, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0155002F, -2 }, { 0x0174002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BB00C5, -1 },
+    { 0x00DA00C3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015400D4, -1 }, { 0x00590071, -2 }, { 0x0078006F, -1 }, { 0x01320063, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D12014, -1 }, { 0x0174015E, -1 }, { 0x00000000, 0 }, { 0x016E0078, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01720177, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E00D6, -1 }, { 0x00000000, 0 }, { 0x201B0063, -1 },
+    { 0x00000000, 0 }, { 0x00EB003F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201F0162, 1 }, { 0x201C00EF, 1 }, { 0x00000000, 0 },
+    { 0x00EF013E, 2 }, { 0x012D013A, 2 }, { 0x002F0064, -3 }, { 0x004E0062, 1 },
+    { 0x016800C3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0108, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B0079, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180121, -1 }, { 0x00AD0174, -1 }, { 0x00E3201C, -1 }, { 0x00E800FD, -1 },
+    { 0x01212018, 1 }, { 0x016400F5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0122, -1 },
+    { 0x004B0120, -1 }, { 0x20100054, -1 }, { 0x00FF002E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004600C6, -3 }, { 0x00BF004B, -1 },
+    { 0x00DE0049, -1 }, { 0x015A0041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004400DF, -1 },
+    { 0x0139005C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FF015F, -1 }, { 0x00000000, 0 },
+    { 0x00DD00EE, 2 }, { 0x00F90079, -1 }, { 0x015900E6, -1 }, { 0x01750071, -1 },
+    { 0x017800E4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF017C, -1 },
+    { 0x00D62026, -1 }, { 0x011C0176, -1 }, { 0x01380101, -1 }, { 0x013B0174, -2 },
+    { 0x0171201C, -1 }, { 0x017600FD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D400C6, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059015A, -1 },
+    { 0x005600E7, -2 }, { 0x00D200DF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570173, -1 }, { 0x00540100, -4 }, { 0x006E201D, -1 }, { 0x016E0161, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016C017A, -1 }, { 0x01642026, -3 }, { 0x201A00C0, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A014A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E00C1, 1 }, { 0x016400AD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F014D, -3 }, { 0x002C00DA, -1 }, { 0x004B00D8, -1 }, { 0x00670063, -1 },
+    { 0x01020059, -3 }, { 0x016200C6, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002D0166, -1 }, { 0x002A00F3, -1 }, { 0x004C0164, -2 },
+    { 0x00C20076, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040171, -1 }, { 0x0028010C, -1 },
+    { 0x00C30102, 1 }, { 0x011B201B, -1 }, { 0x013A2019, -1 }, { 0x0142016D, 1 },
+    { 0x01782015, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00FF0117, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0134, 1 }, { 0x00DE0132, -1 }, { 0x005C0054, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013600D2, -1 },
+    { 0x0079006B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BB0166, -1 },
+    { 0x013400EB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010E2025, -1 }, { 0x01320104, -1 }, { 0x01540175, -1 }, { 0x0053002C, -1 },
+    { 0x0072002A, 1 }, { 0x016B201F, -1 }, { 0x01700100, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057012B, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00EB, -2 }, { 0x00000000, 0 }, { 0x00D1013C, 1 },
+    { 0x014A00C1, -1 }, { 0x006E005C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0177, -3 }, { 0x201B0104, -2 }, { 0x0072015B, -1 },
+    { 0x203A0102, -1 }, { 0x00000000, 0 }, { 0x002E0079, -3 }, { 0x01450067, -1 },
+    { 0x01640065, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019011D, -2 },
+    { 0x00510176, -1 }, { 0x00E42018, -1 }, { 0x002F0105, -3 }, { 0x004E0103, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201400C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0100002A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013C003F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FC005C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FD00E8, -1 },
+    { 0x00DB0077, -1 }, { 0x01380071, -1 }, { 0x0157006F, -1 }, { 0x0176006D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00178, -3 }, { 0x00000000, 0 },
+    { 0x00DC0103, -1 }, { 0x013900FD, -1 }, { 0x015800FB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0150002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D500C2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250170, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700E3, -2 },
+    { 0x007600E1, -1 }, { 0x012D0062, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0050201B, 1 },
+    { 0x0058016F, -1 }, { 0x006F2019, -1 }, { 0x00D40167, 1 }, { 0x012E00EE, 1 },
+    { 0x01690077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014E0178, -1 }, { 0x00720113, -1 }, { 0x016A0103, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201900D5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C004A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01470137, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A0063, -1 }, { 0x00C50059, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0162, -2 }, { 0x0164014E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006A0177, -1 }, { 0x00FD2019, 1 }, { 0x010200FA, -1 },
+    { 0x012100F8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00270121, -1 },
+    { 0x0046011F, -1 }, { 0x011F0111, -1 }, { 0x00DB002F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004100C5, 1 }, { 0x00DC00BB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00572014, -1 }, { 0x005C00F5, -1 },
+    { 0x00000000, 0 }, { 0x00F40078, -1 }, { 0x01130076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D12025, -1 },
+    { 0x00F80177, -1 }, { 0x01170175, -1 }, { 0x01360173, -1 }, { 0x014D201D, -1 },
+    { 0x0174016F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00580127, 1 }, { 0x00770125, -1 }, { 0x00520041, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560140, 1 }, { 0x01100134, -1 },
+    { 0x00AD0054, -1 }, { 0x016A00BB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0100, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F0075, -1 }, { 0x004E0073, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520172, -1 },
+    { 0x004A201E, -1 }, { 0x0069201C, -1 }, { 0x006E00FD, -2 }, { 0x014700EF, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01640106, -1 }, { 0x00000000, 0 },
+    { 0x00C3002A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01430121, -1 },
+    { 0x0162011F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20140164, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011C0056, -1 }, { 0x013B0054, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00660161, 1 }, { 0x00000000, 0 }, { 0x011D00E2, -1 }, { 0x00DC0073, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10174, -3 }, { 0x00D8201E, -1 }, { 0x00DD00FF, -1 },
+    { 0x00FC00FD, -1 }, { 0x017800F5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059003A, -1 }, { 0x0132002C, -1 },
+    { 0x0151002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0136012B, 1 }, { 0x01740127, 1 }, { 0x00570053, -1 },
+    { 0x016E0041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E2018, -2 },
+    { 0x2026016C, -1 }, { 0x00000000, 0 }, { 0x01530142, 1 }, { 0x00000000, 0 },
+    { 0x0074006A, 1 }, { 0x014D005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059016B, -1 }, { 0x005600F8, -2 },
+    { 0x00D50163, 1 }, { 0x016A0073, -1 }, { 0x201B002C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F012B, 1 }, { 0x00000000, 0 },
+    { 0x00540111, -2 }, { 0x0166201E, -3 }, { 0x016B00FF, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010C011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B015D, -1 },
+    { 0x00000000, 0 }, { 0x201800EA, -1 }, { 0x00000000, 0 }, { 0x002E00D2, -1 },
+    { 0x014500C0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190176, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F015E, -1 },
+    { 0x004B00E9, -1 }, { 0x01080150, -1 }, { 0x00670074, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C0175, -1 }, { 0x002A0104, -2 }, { 0x00C02019, -2 }, { 0x00C500FA, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01782026, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004200C1, -1 }, { 0x017800AD, -1 }, { 0x00BB0046, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF0145, -1 }, { 0x00DE0143, -1 }, { 0x017600C6, -3 }, { 0x005C0065, -1 },
+    { 0x01540055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410166, -3 }, { 0x00582010, -1 }, { 0x015500E1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA0175, -1 }, { 0x00F1201F, -1 },
+    { 0x012F201B, -1 }, { 0x0156016D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590123, -3 }, { 0x01320115, -1 }, { 0x201E0057, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0057013C, 1 }, { 0x0076013A, -1 }, { 0x00510056, -1 },
+    { 0x00D000C1, -1 }, { 0x00D30134, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010C00D6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B0115, -1 }, { 0x00000000, 0 }, { 0x002C201C, -2 },
+    { 0x005000FB, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01490177, -2 }, { 0x01080108, -1 }, { 0x01680175, -1 }, { 0x00000000, 0 },
+    { 0x01020022, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C2003F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002800D5, -1 }, { 0x015E00C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01210151, -1 }, { 0x00FF00E0, -1 }, { 0x00610077, -1 }, { 0x00DD006F, -2 },
+    { 0x01590067, -1 }, { 0x01780065, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C20170, -2 }, { 0x00D9201A, -1 }, { 0x00F82018, -1 }, { 0x0100016C, -2 },
+    { 0x01362014, -1 }, { 0x01742010, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0158010C, -1 },
+    { 0x00000000, 0 }, { 0x00D6002E, -1 }, { 0x00F5002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600DC, -1 }, { 0x00000000, 0 },
+    { 0x00DA012D, 1 }, { 0x01750123, -1 }, { 0x0058004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C014E, -1 }, { 0x01350140, 1 }, { 0x00000000, 0 }, { 0x00560068, 1 },
+    { 0x0110005C, -1 }, { 0x014E0058, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00790165, 1 }, { 0x00522013, -1 }, { 0x005700F4, -2 },
+    { 0x007600F2, -1 }, { 0x016E00E2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D40178, -1 }, { 0x0148201C, -1 },
+    { 0x00D10105, -1 }, { 0x014D00FD, -1 }, { 0x201A0041, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A00CB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CC00AB, -1 }, { 0x0164002E, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201900E6, -1 }, { 0x00000000, 0 }, { 0x0168012D, 1 }, { 0x00000000, 0 },
+    { 0x00C70051, -1 }, { 0x01620047, -1 }, { 0x00000000, 0 }, { 0x201A0172, -1 },
+    { 0x20390170, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B00E3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0173, -1 },
+    { 0x0045201D, 1 }, { 0x0064201B, -1 }, { 0x00C12015, -1 }, { 0x012300F0, -1 },
+    { 0x01450161, -1 }, { 0x015E0079, -1 }, { 0x0164015F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00670115, -1 }, { 0x01210109, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015800C4, 1 }, { 0x0174004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0178014E, -2 }, { 0x00DA00E5, -1 }, { 0x015600DD, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00572025, -4 }, { 0x005C0106, -1 }, { 0x00F2201B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0079011D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014C0029, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D006C, 1 }, { 0x005500C5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560151, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0129005D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0111, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CD00EF, 1 },
+    { 0x016800E5, -1 }, { 0x01270076, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0142201F, -1 },
+    { 0x01470100, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50022, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004D0129, 1 }, { 0x01640117, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010200C3, 1 },
+    { 0x00C10054, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20110102, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004600E8, -1 }, { 0x00BF006D, -1 }, { 0x00DE006B, -1 }, { 0x010000DC, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00470174, -1 },
+    { 0x00C3016C, -2 }, { 0x00C000F9, -1 }, { 0x011D00F3, -1 }, { 0x01200166, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01780106, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0129, 1 },
+    { 0x01380123, -1 }, { 0x0113003F, -1 }, { 0x01570121, -1 }, { 0x0176011F, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0155013A, -1 }, { 0x01740138, -1 }, { 0x00570064, -2 }, { 0x00760062, -1 },
+    { 0x00D3005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0059017C, -1 }, { 0x00560109, -2 }, { 0x00702026, -1 },
+    { 0x00D50174, -1 }, { 0x00F100FF, -2 }, { 0x01492018, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201F013C, 1 }, { 0x00000000, 0 }, { 0x00540122, -1 },
+    { 0x20190056, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012B012D, 1 }, { 0x014A012B, 2 }, { 0x002D0057, -1 },
+    { 0x004C0055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0161005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F016F, -1 }, { 0x002C00FC, -1 },
+    { 0x00462019, 1 }, { 0x004B00FA, -1 }, { 0x00C22011, -1 }, { 0x016200E8, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002A0115, -1 }, { 0x00FE2026, -1 }, { 0x00000000, 0 }, { 0x0043002D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BB0057, -1 }, { 0x0156004D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0156, -1 },
+    { 0x00DB00E1, -1 }, { 0x00DE0154, -1 }, { 0x005C0076, -1 }, { 0x01350068, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410177, -2 }, { 0x0077201F, 1 }, { 0x013600F4, -1 }, { 0x015500F2, -1 },
+    { 0x01580165, -1 }, { 0x017400F0, -2 }, { 0x01770163, 1 }, { 0x20260135, -1 },
+    { 0x00000000, 0 }, { 0x0056203A, -1 }, { 0x0134010D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D1002D, -1 }, { 0x010F0029, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005600C1, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F00F4, -1 }, { 0x00000000, 0 },
+    { 0x0057014D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D010D, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014A00E3, -1 }, { 0x00000000, 0 },
+    { 0x00EA0076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A0124, -1 }, { 0x00000000, 0 }, { 0x0105201F, -1 }, { 0x012900FE, 2 },
+    { 0x01622019, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E0125, 1 }, { 0x20130059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500C3, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002800E6, -1 },
+    { 0x00C300DC, -2 }, { 0x011D0063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40168, -2 },
+    { 0x01020164, -3 }, { 0x00000000, 0 }, { 0x01780076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF010E, -1 }, { 0x015A0104, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0172203A, -1 }, { 0x0177011B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013400C5, -1 }, { 0x00D40058, -1 }, { 0x017200C1, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201F2025, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007800EA, -1 }, { 0x00560079, -1 }, { 0x00750077, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014A2014, -1 }, { 0x00570105, -2 }, { 0x00760103, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00C5, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018006B, 1 },
+    { 0x00EE012D, 1 }, { 0x005000C4, -3 }, { 0x012C0129, 1 }, { 0x01450041, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B00F4, -1 }, { 0x00000000, 0 },
+    { 0x00E40079, -1 }, { 0x01030077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A010F, -1 },
+    { 0x01230101, -1 }, { 0x014200FF, 1 }, { 0x00440029, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C100AD, -1 }, { 0x0178002E, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013E0131, 1 }, { 0x00000000, 0 }, { 0x00DE00C4, -2 },
+    { 0x01760047, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015800D5, -1 }, { 0x01360064, -1 }, { 0x01550062, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059201D, 1 },
+    { 0x0078201B, 1 }, { 0x00DD0169, -1 }, { 0x013700F0, -1 }, { 0x01590161, -1 },
+    { 0x01720079, -1 }, { 0x0178015F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01760178, 1 }, { 0x005C0117, -1 }, { 0x014F2026, -1 }, { 0x00000000, 0 },
+    { 0x00D20029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F0064, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016C00C4, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0167006A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00E7201D, 1 }, { 0x01252019, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0166010F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00470054, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B0153, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00FF0061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00412018, -3 }, { 0x00C50164, -3 },
+    { 0x011F00EB, -1 }, { 0x013B0076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0156201F, -2 },
+    { 0x0175201D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0121, -3 }, { 0x01590119, -1 }, { 0x01780117, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250102, 1 }, { 0x00000000, 0 }, { 0x0136014D, -1 },
+    { 0x007900E6, -1 }, { 0x00570075, -1 }, { 0x00760073, -1 }, { 0x01740149, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0072201E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E00C1, 1 }, { 0x00000000, 0 }, { 0x203A004C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201F014D, -1 }, { 0x00000000, 0 }, { 0x20190067, -2 }, { 0x00EF0129, 1 },
+    { 0x005100C0, -1 }, { 0x002F004F, -1 }, { 0x012D0125, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0052014C, -1 },
+    { 0x012B013E, 2 }, { 0x014A013C, 1 }, { 0x006B0064, -1 }, { 0x00E7005C, -2 },
+    { 0x016600C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00500165, 1 }, { 0x00000000, 0 }, { 0x014500E2, -1 }, { 0x01230071, -1 },
+    { 0x016400E0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00AB0178, -1 }, { 0x004B010B, -1 }, { 0x010500FF, -1 },
+    { 0x011F201C, 1 }, { 0x015D2018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015A002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x017D0129, 1 }, { 0x00C000C2, 1 }, { 0x00410057, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0167, -1 }, { 0x00FD0163, 1 },
+    { 0x015700EA, -1 }, { 0x01540077, -1 }, { 0x017600E8, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC017E, -1 },
+    { 0x01390178, -2 }, { 0x01550103, -1 }, { 0x01580176, -2 }, { 0x0057002D, -1 },
+    { 0x01740101, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0079, -3 }, { 0x005600D2, -1 },
+    { 0x011000C6, -2 }, { 0x014E00C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057015E, -1 },
+    { 0x005400EB, -2 }, { 0x010E00DF, -1 }, { 0x00700076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D011E, -1 }, { 0x00000000, 0 },
+    { 0x00550177, -1 }, { 0x00520104, 1 }, { 0x01452013, -1 }, { 0x01642011, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0137, 1 },
+    { 0x00000000, 0 }, { 0x016A017E, -1 }, { 0x0050011D, -1 }, { 0x201800C4, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0138, -1 },
+    { 0x002C00C5, 1 }, { 0x004B00C3, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006B014D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00FE0076, -1 }, { 0x011D0074, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E30177, -1 }, { 0x01020175, -2 },
+    { 0x0119201F, -1 }, { 0x0157201B, 1 }, { 0x01762019, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE011D, -1 }, { 0x00FD011B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D900C3, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0077006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0170, -1 }, { 0x0054201C, 1 },
+    { 0x005900FD, -1 }, { 0x013200EF, 1 }, { 0x016D0078, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014A2025, -1 }, { 0x016E0104, -2 }, { 0x01710177, -1 }, { 0x0070002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00D6, -1 }, { 0x00000000, 0 }, { 0x00D10127, 1 }, { 0x016C011D, -1 },
+    { 0x00EA003F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0162, -2 }, { 0x201B00EF, 1 }, { 0x00000000, 0 }, { 0x00EE013E, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190108, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F00F0, -3 }, { 0x004E00EE, 2 }, { 0x006A0079, -1 },
+    { 0x0143006B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00E2201C, -1 }, { 0x006B0105, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FE002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013E0142, 3 }, { 0x00000000, 0 }, { 0x0138005C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC00EE, 1 },
+    { 0x00F80079, -1 }, { 0x01170077, -1 }, { 0x01360075, -1 }, { 0x01550073, -1 },
+    { 0x01740071, -2 }, { 0x017700E4, -1 }, { 0x00DD017A, -1 }, { 0x00D52026, -1 },
+    { 0x01370101, -1 }, { 0x0151201E, -1 }, { 0x015600FF, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01302039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D300C6, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00520074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560173, -1 },
+    { 0x00530100, -1 }, { 0x006D201D, -1 }, { 0x007200FE, -1 }, { 0x01082013, -1 },
+    { 0x01100167, 1 }, { 0x014E0163, 1 }, { 0x016A00EE, 1 }, { 0x00000000, 0 },
+    { 0x201900C0, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A014C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660120, -1 }, { 0x002D00C1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01200057, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0166, -2 }, { 0x00432010, -1 }, { 0x012100E3, -1 }, { 0x00C10076, -2 },
+    { 0x01620152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50175, -2 }, { 0x00C20102, 1 }, { 0x01392019, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011D0115, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0136002D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BB00C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059006D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D12010, -1 }, { 0x0174015A, -1 },
+    { 0x00000000, 0 }, { 0x014F0076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01530175, -1 },
+    { 0x01500102, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00D2, -1 },
+    { 0x00000000, 0 }, { 0x0056012B, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00EB, -1 }, { 0x00000000, 0 }, { 0x00EF013A, 2 }, { 0x014C0134, -1 },
+    { 0x006D005C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0104, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016600D8, -1 }, { 0x004C0077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018011D, -1 }, { 0x00000000, 0 },
+    { 0x00E32018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201300C3, -1 }, { 0x002C011E, -1 }, { 0x004B011C, -1 }, { 0x0162010A, -1 },
+    { 0x00FF002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01600123, -1 },
+    { 0x002700C4, -1 }, { 0x0043004F, -1 }, { 0x004600C2, -3 }, { 0x00BF0047, -1 },
+    { 0x00DE0045, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280150, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FB005C, -1 }, { 0x01390058, 1 },
+    { 0x01580056, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00FF015B, -1 }, { 0x00000000, 0 }, { 0x00DD00EA, -2 }, { 0x00DA0077, -1 },
+    { 0x01370071, -1 }, { 0x015900E2, -1 }, { 0x017800E0, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0178, -2 }, { 0x00DE0176, -2 }, { 0x00DB0103, -1 },
+    { 0x011900FF, -1 }, { 0x013800FD, -1 }, { 0x013B0170, -1 }, { 0x01712018, -1 },
+    { 0x017600F9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014F002E, -1 }, { 0x016E002C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0172012B, 1 }, { 0x00D400C2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005600E3, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057016F, -1 }, { 0x006E2019, -1 },
+    { 0x00D30167, 1 }, { 0x012D00EE, 1 }, { 0x01490079, -2 }, { 0x01680077, -1 },
+    { 0x016E015D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014A0105, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010A0122, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190161, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0149, -1 }, { 0x002C00D6, -1 },
+    { 0x004B00D4, -1 }, { 0x00C40059, -3 }, { 0x01020055, -2 }, { 0x014300C4, -1 },
+    { 0x016200C2, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002D0162, -1 },
+    { 0x00000000, 0 }, { 0x0046007A, -1 }, { 0x013E006A, 1 }, { 0x014100DD, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00422025, -1 }, { 0x00280108, -1 }, { 0x00690177, -1 }, { 0x0104016D, -1 },
+    { 0x01420169, 1 }, { 0x01592013, -1 }, { 0x01782011, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FF0113, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DA002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0130, -1 },
+    { 0x00DB00BB, -1 }, { 0x00DE012E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00790067, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00562014, -1 }, { 0x00BB0162, -1 }, { 0x013400E7, -1 },
+    { 0x00F30078, -1 }, { 0x017200E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D02025, -1 }, { 0x012D201F, 1 },
+    { 0x01320100, -1 }, { 0x01540171, -1 }, { 0x016B201B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570127, 1 }, { 0x00760125, -1 }, { 0x00510041, -1 }, { 0x0168002F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00E7, -2 },
+    { 0x00000000, 0 }, { 0x201A0074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0173, -1 },
+    { 0x201B0100, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0075, -1 }, { 0x01640061, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190119, -2 }, { 0x00000000, 0 }, { 0x0068201C, -1 },
+    { 0x002F0101, -3 }, { 0x006D00FD, -2 }, { 0x0162007A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015E2025, -1 }, { 0x0106010C, -1 }, { 0x00000000, 0 }, { 0x00C2002A, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20130164, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015C00C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00270165, 1 },
+    { 0x00000000, 0 }, { 0x00BF00E8, -1 }, { 0x00DB0073, -1 }, { 0x00FD00E4, -1 },
+    { 0x0157006B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00A10176, -1 }, { 0x00C00174, -3 }, { 0x00DC00FF, -1 }, { 0x00F6201C, -1 },
+    { 0x00FB00FD, -1 }, { 0x017700F5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202600C7, -1 }, { 0x00000000, 0 }, { 0x00BB011A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005900C6, -3 }, { 0x00560053, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025016C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EF0062, 2 },
+    { 0x014C005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0058016B, -1 }, { 0x00D40163, 1 }, { 0x010F00EC, 1 },
+    { 0x016C00E6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01100178, -1 }, { 0x0072010F, -1 },
+    { 0x014E0174, -1 }, { 0x016A00FF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50055, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180176, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A00E9, -1 },
+    { 0x010400DD, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0177, -3 },
+    { 0x004B0175, -2 }, { 0x0062201F, -1 }, { 0x00C400FA, -1 }, { 0x012100F4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0027011D, -1 }, { 0x0046011B, -1 }, { 0x011F010D, -1 },
+    { 0x01772026, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440134, -1 }, { 0x002200C3, -1 },
+    { 0x004100C1, 1 }, { 0x0174003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00572010, -1 }, { 0x007B00EF, 1 }, { 0x01760152, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D90175, -1 }, { 0x00D60102, -1 }, { 0x00F0201F, -1 },
+    { 0x010F201D, 2 }, { 0x0136016F, -1 }, { 0x014D2019, -1 }, { 0x0174016B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00770121, -1 },
+    { 0x201D0057, 1 }, { 0x00000000, 0 }, { 0x014A002D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0056013C, 1 }, { 0x00D20134, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0071, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0052016E, -1 }, { 0x004A201A, -1 }, { 0x00692018, -1 },
+    { 0x016600E9, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01480177, -2 },
+    { 0x01450104, -1 }, { 0x01640102, -4 }, { 0x0066002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B012D, 1 }, { 0x0143011D, -1 }, { 0x00C1003F, -2 },
+    { 0x0162011B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE0056, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0066015D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410079, -2 }, { 0x01770065, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10170, -2 },
+    { 0x00D8201A, -1 }, { 0x00DD00FB, -1 }, { 0x015900F3, -1 }, { 0x017800F1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0176010A, -2 }, { 0x00000000, 0 },
+    { 0x00D5002E, -1 }, { 0x00F4002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500DC, -1 }, { 0x00000000, 0 }, { 0x00D9012D, 1 },
+    { 0x01550125, -1 }, { 0x0057004F, -1 }, { 0x01740123, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260168, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01150142, 1 }, { 0x00000000, 0 }, { 0x010F005C, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00780165, 1 }, { 0x005600F4, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201F0127, 1 }, { 0x00D30178, -1 }, { 0x0054010D, -2 }, { 0x0166201A, -3 },
+    { 0x20190041, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0140, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F015A, -1 }, { 0x0108014C, -1 }, { 0x016200D3, -1 },
+    { 0x01210064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A0100, -2 },
+    { 0x00C02015, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00280119, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BB0042, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0141, -1 }, { 0x00DE013F, -1 },
+    { 0x017600C2, -3 }, { 0x00D80059, -1 }, { 0x01540051, -1 }, { 0x01790135, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410162, -3 },
+    { 0x00D900E5, -1 }, { 0x01580150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260120, -1 }, { 0x00000000, 0 },
+    { 0x00562025, -4 }, { 0x00F1201B, -1 }, { 0x013400F8, -1 }, { 0x01560169, -1 },
+    { 0x01750167, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059011F, -3 }, { 0x01320111, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570138, -1 },
+    { 0x005400C5, -4 }, { 0x201C006C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00F8, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010C00D2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0111, -1 },
+    { 0x00000000, 0 }, { 0x002C2018, -2 }, { 0x00CC00EF, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0141201F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40022, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0044005C, -1 },
+    { 0x00A10056, -1 }, { 0x00C00054, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20100102, -1 }, { 0x00000000, 0 }, { 0x0121014D, -1 }, { 0x00000000, 0 },
+    { 0x00DD006B, 1 }, { 0x01590063, -1 }, { 0x01780061, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2016C, -2 },
+    { 0x006200FF, -1 }, { 0x00BF00F9, -1 }, { 0x00FD00F5, -1 }, { 0x01000168, -2 },
+    { 0x01362010, -1 }, { 0x0176007A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01722025, -1 }, { 0x01580108, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202600D8, -1 }, { 0x00000000, 0 }, { 0x00DA0129, 1 }, { 0x01370123, -1 },
+    { 0x0175011F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0135013C, 1 },
+    { 0x017000C5, -2 }, { 0x00560064, -2 }, { 0x00D2005C, -1 }, { 0x01100058, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00790161, -1 },
+    { 0x00000000, 0 }, { 0x005700F0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D40174, -1 }, { 0x006F2026, -1 }, { 0x00D10101, -1 }, { 0x00F000FF, -1 },
+    { 0x010F00FD, 1 }, { 0x01482018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180056, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0145002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900E2, -1 }, { 0x00000000, 0 },
+    { 0x012A012D, 1 }, { 0x01680129, 1 }, { 0x002C0057, -4 }, { 0x01620043, -1 },
+    { 0x00000000, 0 }, { 0x201A016E, -1 }, { 0x2039016C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010600D5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E016F, -1 }, { 0x00452019, 1 }, { 0x00C12011, -1 },
+    { 0x0145015D, -1 }, { 0x0164015B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670111, -1 },
+    { 0x00FD2026, -3 }, { 0x01210105, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013900C2, 1 },
+    { 0x0136004F, -1 }, { 0x015800C0, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA00E1, -1 },
+    { 0x015600D9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0076201F, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250135, -1 }, { 0x00000000, 0 },
+    { 0x0055203A, -1 }, { 0x00790119, -1 }, { 0x0174017C, -1 }, { 0x00000000, 0 },
+    { 0x010E0029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0068, 1 }, { 0x005500C1, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056014D, -2 },
+    { 0x00000000, 0 }, { 0x00500067, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C010D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016800E1, -1 }, { 0x00000000, 0 }, { 0x00E90076, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00ED0175, -1 }, { 0x0104201F, -3 }, { 0x0123201D, 1 },
+    { 0x0142201B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01640113, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C400C3, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004600E4, -1 }, { 0x00C200DC, -2 },
+    { 0x00DE0067, -1 }, { 0x00FD0065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30168, -2 }, { 0x01200162, -1 },
+    { 0x00000000, 0 }, { 0x01580078, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015C0177, -1 },
+    { 0x00DD010C, -2 }, { 0x01780102, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0138011F, -1 }, { 0x0157011D, -1 }, { 0x00590047, -2 },
+    { 0x0176011B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D30058, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01340151, -1 },
+    { 0x007700EA, -1 }, { 0x00550079, -1 }, { 0x016C0067, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590178, 1 },
+    { 0x00000000, 0 }, { 0x00560105, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00C5, -2 }, { 0x0054011E, -1 }, { 0x016E017F, -1 }, { 0x00000000, 0 },
+    { 0x0127002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0151, -2 }, { 0x203900DC, -1 }, { 0x00710135, 2 }, { 0x012B0129, 1 },
+    { 0x004F00C4, -1 }, { 0x014A0127, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01290142, 2 }, { 0x004D00DD, -1 }, { 0x0123005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F016B, -1 }, { 0x004B00F6, -1 }, { 0x014300E6, -1 }, { 0x00E30079, -1 },
+    { 0x01020077, -2 }, { 0x016200E4, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A0111, -1 }, { 0x014100FF, -1 },
+    { 0x015B201C, -1 }, { 0x016000FD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C000AD, -1 }, { 0x0177002E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00FF0135, 1 }, { 0x017B012D, 1 }, { 0x00DD00C4, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0152, -1 }, { 0x00000000, 0 }, { 0x017600D3, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410173, -1 }, { 0x0077201B, 1 },
+    { 0x013600F0, -1 }, { 0x01710079, -1 }, { 0x0177015F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01340109, -1 }, { 0x014E2026, -1 }, { 0x01720105, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201F00F0, -1 }, { 0x00570149, -1 }, { 0x005400D6, -1 },
+    { 0x014C00C6, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0109, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0147006C, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0105201B, -1 }, { 0x00AD0102, -1 }, { 0x01622015, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0123, -3 }, { 0x004E0121, -1 },
+    { 0x00000000, 0 }, { 0x0102002F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004A0153, -1 }, { 0x002800E2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C40164, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013A0076, -1 }, { 0x01780072, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F82025, -1 }, { 0x00BF010A, -1 },
+    { 0x013B0102, 1 }, { 0x013E0175, 1 }, { 0x0155201F, 1 }, { 0x015A0100, -1 },
+    { 0x0174201D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DC0121, -1 }, { 0x01770117, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013400C1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900E8, -2 },
+    { 0x00560075, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010C2014, -1 },
+    { 0x00570101, -1 }, { 0x014A2010, -1 }, { 0x016E00EF, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00C1, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20180067, -1 }, { 0x00CF012B, 1 }, { 0x005000C0, -3 },
+    { 0x002E004F, -1 }, { 0x00EE0129, 1 }, { 0x0164003B, -1 }, { 0x016A0121, -1 },
+    { 0x201C0166, 1 }, { 0x201900F3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00E6005C, -1 }, { 0x01430056, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F0165, 1 },
+    { 0x01660153, -2 }, { 0x006B00F0, -1 }, { 0x00C50077, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004A010B, -1 }, { 0x00FF201E, -3 }, { 0x010400FF, -2 },
+    { 0x014200FB, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0159002C, -2 }, { 0x0178002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE00C0, -2 }, { 0x01760043, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0159015D, -1 }, { 0x00592019, 1 }, { 0x017500E8, -1 },
+    { 0x01530077, -1 }, { 0x0178015B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB017E, -1 }, { 0x005C0113, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056002D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013000AB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016C00C0, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056015E, -1 }, { 0x007200E9, -1 },
+    { 0x00000000, 0 }, { 0x006F0076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014C0167, 1 },
+    { 0x00510104, -1 }, { 0x00E72019, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0166010B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C5002F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201500DD, -1 }, { 0x00000000, 0 }, { 0x004A00C3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B014F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00412014, -1 }, { 0x004600F5, -1 }, { 0x00BF007A, -1 }, { 0x011F00E7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BB2025, -1 }, { 0x00E20177, -1 }, { 0x01010175, -1 },
+    { 0x0156201B, -2 }, { 0x01752019, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD011D, -3 },
+    { 0x01590115, -1 }, { 0x01780113, -2 }, { 0x20260059, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D800C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007900E2, -1 }, { 0x00570071, -2 },
+    { 0x0076006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0072201A, -2 }, { 0x005800FD, -1 },
+    { 0x00000000, 0 }, { 0x016C0078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01700177, -1 },
+    { 0x203A0048, -1 }, { 0x00000000, 0 }, { 0x006F002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00EF0125, 2 }, { 0x20190063, -2 }, { 0x00E9003F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012B013A, 2 }, { 0x014700C5, -1 },
+    { 0x016600C3, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00500161, -1 }, { 0x00000000, 0 },
+    { 0x004D00EE, 1 }, { 0x00690079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F017C, -1 },
+    { 0x00462026, -2 }, { 0x004B0107, -1 }, { 0x00AB0174, -1 }, { 0x00E1201C, -1 },
+    { 0x00E600FD, -1 }, { 0x011F2018, 1 }, { 0x016200F5, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00FD002E, -3 }, { 0x013B002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004400C6, -2 }, { 0x01580041, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD00D5, -2 }, { 0x0137005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF0163, -1 }, { 0x00FD015F, -1 }, { 0x00DB00EE, 1 }, { 0x013800E8, -1 },
+    { 0x015700E6, -1 }, { 0x017600E4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DC017A, -1 }, { 0x00D42026, -1 }, { 0x01390174, -2 },
+    { 0x0150201E, -1 }, { 0x01580172, -1 }, { 0x016F201C, -1 }, { 0x017400FD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0075, -1 }, { 0x00000000, 0 }, { 0x00D200C6, -2 }, { 0x011000C2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0057015A, -1 }, { 0x005400E7, -2 }, { 0x00D000DF, -1 },
+    { 0x00510074, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D201F, -1 }, { 0x00520100, 1 },
+    { 0x006C201D, -1 }, { 0x010F0167, 1 }, { 0x016C0161, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016A017A, -1 },
+    { 0x01622026, -3 }, { 0x201800C0, -2 }, { 0x00000000, 0 }, { 0x01040027, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019014C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C00C1, 1 }, { 0x016200AD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00270067, -1 }, { 0x00460065, -1 }, { 0x01000059, -3 }, { 0x016000C6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002800F3, -1 }, { 0x006600EF, 4 }, { 0x00C00076, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C40175, -2 }, { 0x00C10102, 1 }, { 0x00FF00FE, -1 }, { 0x01020171, -1 },
+    { 0x0119201B, -1 }, { 0x01762015, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF011B, -1 }, { 0x00FD0117, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600FA, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0077006B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00542018, 1 }, { 0x005900F9, -1 }, { 0x005C016C, -1 },
+    { 0x013200EB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01330177, -1 }, { 0x0169201F, -1 },
+    { 0x016E0100, -2 }, { 0x0051002C, 1 }, { 0x0070002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00D2, -1 }, { 0x00000000, 0 },
+    { 0x0055012B, 1 }, { 0x00D10123, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00EB, -1 },
+    { 0x00000000, 0 }, { 0x00720142, -1 }, { 0x00EE013A, 2 }, { 0x20180078, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0177, 1 },
+    { 0x20190104, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0079, -3 }, { 0x004B0077, -2 }, { 0x01430067, -1 }, { 0x01620065, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F0176, -1 }, { 0x00E22018, -1 },
+    { 0x006B0101, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FE002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013A003F, -1 }, { 0x0178003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013E013E, 3 },
+    { 0x00BF00D3, -1 }, { 0x00DE00D1, -1 }, { 0x00FA005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440167, 1 },
+    { 0x00000000, 0 }, { 0x017700E0, -1 }, { 0x00D90077, -1 }, { 0x01360071, -1 },
+    { 0x0155006F, -1 }, { 0x0174006D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0176, 1 }, { 0x0151201A, -1 }, { 0x00DA0103, -1 }, { 0x013700FD, -1 },
+    { 0x015600FB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014E002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F0071, -1 },
+    { 0x00000000, 0 }, { 0x00D300C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A201A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005500E3, -1 }, { 0x00000000, 0 }, { 0x012B0062, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0056016F, -1 }, { 0x006D2019, -1 }, { 0x00D20167, 1 },
+    { 0x01100163, 1 }, { 0x012C00EE, 1 }, { 0x01480079, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014C0178, -1 }, { 0x00000000, 0 },
+    { 0x01680103, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0166011C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180161, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01450137, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00280063, -1 }, { 0x00C30059, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0162, -2 }, { 0x006700EB, -1 },
+    { 0x0162014E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00680177, -2 },
+    { 0x00C50171, -1 }, { 0x010000FA, -1 }, { 0x011F00F8, -1 }, { 0x01582013, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011D0111, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D9002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA00BB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C00DC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007900F3, -1 }, { 0x00000000, 0 }, { 0x00F20078, -1 },
+    { 0x01110076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00F60177, -1 }, { 0x01150175, -1 }, { 0x014B201D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560127, 1 },
+    { 0x203A0059, -1 }, { 0x00500041, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00E7, -1 }, { 0x00000000, 0 },
+    { 0x010E0134, -1 }, { 0x016800BB, -1 }, { 0x00AB0054, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0100, 1 },
+    { 0x203900FE, -1 }, { 0x00000000, 0 }, { 0x016600D4, -1 }, { 0x006B0071, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180119, -1 }, { 0x00000000, 0 }, { 0x0067201C, 1 }, { 0x006C00FD, -1 },
+    { 0x014500EF, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01620106, -1 }, { 0x00000000, 0 }, { 0x00C1002A, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0160011F, -1 }, { 0x002700C0, -1 }, { 0x00BF0043, -1 },
+    { 0x00DE0041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0028014C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01390054, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD00E6, -2 }, { 0x00DA0073, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0174, -2 },
+    { 0x00D6201E, -1 }, { 0x00DB00FF, -1 }, { 0x00DE0172, -1 }, { 0x00F5201C, -1 },
+    { 0x00FA00FD, -1 }, { 0x013B016C, -1 }, { 0x017600F5, -2 }, { 0x00000000, 0 },
+    { 0x202500C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0057003A, -1 }, { 0x014F002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0134012B, 1 },
+    { 0x005800C6, 1 }, { 0x016C0041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590152, -2 },
+    { 0x01510142, 1 }, { 0x00000000, 0 }, { 0x00EE0062, 2 }, { 0x014B005C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0057016B, -1 }, { 0x005400F8, -2 }, { 0x00D30163, 1 }, { 0x00EF00EE, 1 },
+    { 0x01680073, -1 }, { 0x2019002C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D012B, 1 }, { 0x00000000, 0 }, { 0x0164201E, -3 }, { 0x014A0101, -1 },
+    { 0x016900FF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010A011E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019015D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C00D2, -1 }, { 0x014300C0, -1 }, { 0x00C40055, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01060150, -1 }, { 0x002A00EB, -1 }, { 0x014100D9, -1 },
+    { 0x013E0066, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0061201F, -1 }, { 0x00C300FA, -1 },
+    { 0x01040169, -1 }, { 0x01230167, 1 }, { 0x01420165, 1 }, { 0x017D00EE, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00FF010F, -1 }, { 0x01762026, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF012C, -1 }, { 0x00DE012A, -1 }, { 0x017600AD, -1 },
+    { 0x007B004A, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x017400C6, -4 }, { 0x00790063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00562010, -1 },
+    { 0x013400E3, -1 }, { 0x017200DF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00EF201F, 1 }, { 0x0059010A, -2 }, { 0x00D50102, -1 }, { 0x012D201B, 1 },
+    { 0x0154016D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570123, -2 }, { 0x00760121, -1 },
+    { 0x201C0057, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004F0056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E016F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00720153, -1 }, { 0x010A00D6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190115, -2 },
+    { 0x00000000, 0 }, { 0x00682018, -1 }, { 0x002F00FD, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01060108, -1 },
+    { 0x00000000, 0 }, { 0x0046002E, -2 }, { 0x01000022, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004A012D, 1 }, { 0x00000000, 0 }, { 0x00C0003F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015C00C1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0046015F, -1 }, { 0x011F0151, -1 }, { 0x00BF00E4, -1 },
+    { 0x00FD00E0, -1 }, { 0x013B00DC, -1 }, { 0x01570067, -1 }, { 0x01760065, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440178, -1 }, { 0x00C00170, -2 },
+    { 0x00F62018, -1 }, { 0x01342014, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600C3, 1 },
+    { 0x00000000, 0 }, { 0x00BB0116, -1 }, { 0x0156010C, -1 }, { 0x00D4002E, -1 },
+    { 0x00F3002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01350127, 1 }, { 0x005900C2, -3 },
+    { 0x0056004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250168, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010E005C, -1 }, { 0x014C0058, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00770165, 1 },
+    { 0x00000000, 0 }, { 0x016C00E2, -1 }, { 0x00ED0077, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D20178, -1 }, { 0x0072010B, -1 }, { 0x01100174, -1 }, { 0x0146201C, -1 },
+    { 0x014B00FD, -2 }, { 0x20180041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0140, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0162002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0166012D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004A00E5, -1 }, { 0x010400D9, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0173, -1 }, { 0x004B0171, -1 }, { 0x0062201B, -1 },
+    { 0x012100F0, -1 }, { 0x01430161, -1 }, { 0x015C0079, -1 }, { 0x0162015F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460117, -1 },
+    { 0x011F0109, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01590137, -1 }, { 0x00BB00CE, -1 }, { 0x015600C4, 1 },
+    { 0x01780135, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0176014E, -2 }, { 0x00000000, 0 },
+    { 0x0059007A, -1 }, { 0x015400DD, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250120, -1 }, { 0x00000000, 0 }, { 0x00552025, -1 },
+    { 0x00F0201B, -1 }, { 0x010F2019, 2 }, { 0x0136016B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0077011D, -1 }, { 0x201D0053, -1 }, { 0x00000000, 0 },
+    { 0x010C002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560138, -1 }, { 0x005300C5, -1 },
+    { 0x201B006C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00F8, -1 }, { 0x00000000, 0 }, { 0x00540151, -2 },
+    { 0x00000000, 0 }, { 0x002F006D, -1 }, { 0x004E006B, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0052016A, -1 }, { 0x016600E5, -2 }, { 0x00000000, 0 }, { 0x01250076, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01450100, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C30022, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0129, 1 },
+    { 0x01620117, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010000C3, 1 }, { 0x00BF0054, -1 }, { 0x00DE0052, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00660159, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410075, -1 },
+    { 0x01770061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1016C, -2 }, { 0x006100FF, -1 },
+    { 0x011E0166, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01760106, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500D8, -1 },
+    { 0x00000000, 0 }, { 0x00D90129, 1 }, { 0x01550121, -1 }, { 0x0174011F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260164, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005600F0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F0123, -1 }, { 0x0057017C, -1 },
+    { 0x00540109, -2 }, { 0x00D30174, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D013C, 1 },
+    { 0x00000000, 0 }, { 0x00520122, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0129012D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015F005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C02011, -1 }, { 0x00000000, 0 }, { 0x013E0077, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280115, -1 }, { 0x0178201E, -3 },
+    { 0x00000000, 0 }, { 0x0041002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF013D, -1 }, { 0x00DE013B, -1 }, { 0x00000000, 0 }, { 0x0154004D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0158014C, -1 }, { 0x00D900E1, -1 }, { 0x00000000, 0 },
+    { 0x00790074, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2026011C, -1 }, { 0x0075201F, -1 }, { 0x013400F4, -1 },
+    { 0x01560165, -1 }, { 0x01750163, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054203A, -1 },
+    { 0x0059011B, -2 }, { 0x00780119, -1 }, { 0x0132010D, -1 }, { 0x201E004F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0068, 1 }, { 0x005400C1, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00F4, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005200DA, -1 },
+    { 0x00000000, 0 }, { 0x01470057, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B010D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E80076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0051017F, -1 }, { 0x00EC0175, -1 }, { 0x0103201F, -1 }, { 0x0141201B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B0123, -1 }, { 0x20110059, -1 },
+    { 0x00270041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C300C3, 1 }, { 0x00440058, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C100DC, -2 }, { 0x00DD0067, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20168, -2 }, { 0x00BF00F5, -1 }, { 0x01000164, -3 },
+    { 0x01760076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01342025, -1 }, { 0x01580104, 1 },
+    { 0x00000000, 0 }, { 0x0079002C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600D4, -1 }, { 0x0170203A, -1 },
+    { 0x0137011F, -1 }, { 0x0175011B, -1 }, { 0x00580047, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900D3, -2 }, { 0x00D20058, -1 },
+    { 0x013200C5, -1 }, { 0x017000C1, -2 }, { 0x00000000, 0 }, { 0x201D2025, -2 },
+    { 0x00000000, 0 }, { 0x0079015D, -1 }, { 0x00000000, 0 }, { 0x007600EA, -1 },
+    { 0x012D006B, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00550105, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00C5, -2 },
+    { 0x203A00C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0151, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012A0129, 1 }, { 0x002F00C6, -4 },
+    { 0x004B0051, -1 }, { 0x004E00C4, -1 }, { 0x01430041, -1 }, { 0x00000000, 0 },
+    { 0x201A016A, -1 }, { 0x20390168, -1 }, { 0x00000000, 0 }, { 0x01470140, 1 },
+    { 0x004C00DD, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E016B, -1 },
+    { 0x004A00F6, -1 }, { 0x012300E8, -1 }, { 0x00E20079, -1 }, { 0x01010077, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0067010D, -1 }, { 0x01210101, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0176002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DC00C4, -2 }, { 0x01740047, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0150, -2 }, { 0x01780146, -1 }, { 0x015600D5, -1 }, { 0x01340064, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0057201D, 1 }, { 0x0076201B, 1 }, { 0x01570161, -1 },
+    { 0x01700079, -1 }, { 0x0176015F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01740178, 1 }, { 0x00790115, -1 },
+    { 0x014D2026, -1 }, { 0x00000000, 0 }, { 0x0073002F, -1 }, { 0x00D00029, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0064, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560149, -1 }, { 0x00000000, 0 }, { 0x016A00C4, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0109, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0122, -1 }, { 0x00000000, 0 }, { 0x00E5201D, -1 },
+    { 0x0104201B, -3 }, { 0x01232019, 1 }, { 0x016600F6, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0164010F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004600E0, -1 }, { 0x00000000, 0 }, { 0x00BF0065, -1 }, { 0x00FD0061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C30164, -3 }, { 0x011D00EB, -1 }, { 0x00000000, 0 }, { 0x01390076, -1 },
+    { 0x01580074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0154201F, -2 }, { 0x00DD0108, -2 }, { 0x017800FE, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0121, -1 },
+    { 0x0138011B, -1 }, { 0x00590043, -2 }, { 0x01570119, -1 }, { 0x01760117, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260175, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0134014D, -1 }, { 0x007700E6, -1 }, { 0x010F0069, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0070201E, -1 }, { 0x00560101, -1 },
+    { 0x007500FF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00C1, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D014D, -2 }, { 0x201A00DA, -1 },
+    { 0x00000000, 0 }, { 0x00CE012B, 1 }, { 0x004F00C0, -1 }, { 0x012B0125, 2 },
+    { 0x014A0123, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0166, 1 },
+    { 0x201800F3, -1 }, { 0x203A0164, -1 }, { 0x00EB0142, 1 }, { 0x002E00DB, -1 },
+    { 0x00E5005C, -3 }, { 0x0129013E, 2 }, { 0x016400C7, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B00F2, -1 }, { 0x00C40077, -2 }, { 0x01210071, -1 }, { 0x014300E2, -1 },
+    { 0x016200E0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002A010D, -1 }, { 0x00FE201E, -1 }, { 0x010300FF, -1 }, { 0x011D201C, 1 },
+    { 0x015B2018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD2039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0177002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017B0129, 1 },
+    { 0x00DD00C0, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF014E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0173005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0041016F, -1 }, { 0x0177015B, -1 }, { 0x015500EA, -1 }, { 0x01330079, -1 },
+    { 0x017400E8, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DA017E, -1 }, { 0x01102026, -1 }, { 0x01340105, -1 },
+    { 0x01560176, -2 }, { 0x01720101, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0079, 1 }, { 0x005400D2, -1 }, { 0x010E00C6, -2 }, { 0x014C00C2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0105, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006E0076, -2 }, { 0x01470068, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00530177, -1 }, { 0x00500104, -3 },
+    { 0x01432013, -1 }, { 0x01622011, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190137, 1 }, { 0x00000000, 0 }, { 0x0168017E, -1 },
+    { 0x002F011F, -3 }, { 0x004E011D, -1 }, { 0x00000000, 0 }, { 0x00C4002F, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201400DD, -1 }, { 0x00000000, 0 }, { 0x002A00C5, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A014F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00FF00E9, -1 }, { 0x00000000, 0 }, { 0x00DD0078, -1 }, { 0x00FC0076, -1 },
+    { 0x0178006E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00E10177, -1 }, { 0x00BF0106, -1 }, { 0x00DE0104, -2 }, { 0x01000175, -2 },
+    { 0x0117201F, -1 }, { 0x0155201B, 1 }, { 0x01742019, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC011D, -1 }, { 0x01770113, -1 },
+    { 0x20250059, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005900E4, -1 }, { 0x00560071, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0052201C, -2 }, { 0x005700FD, -1 }, { 0x010C2010, -1 },
+    { 0x013000EF, 1 }, { 0x016B0078, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016F0177, -1 }, { 0x016C0104, -2 },
+    { 0x201A004A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00EE0125, 2 }, { 0x016A011D, -1 }, { 0x00E8003F, -1 }, { 0x20180063, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0162, 1 }, { 0x201900EF, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0166014F, -2 }, { 0x00000000, 0 },
+    { 0x00680079, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E0201C, -1 },
+    { 0x004A0107, -1 }, { 0x00E500FD, -1 }, { 0x00FF201A, -3 }, { 0x010400FB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DF0148, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0161, -2 },
+    { 0x00592015, -1 }, { 0x00DA00EE, 1 }, { 0x00F60079, -1 }, { 0x01150077, -1 },
+    { 0x013700E8, -1 }, { 0x017500E4, -1 }, { 0x01780157, -1 }, { 0x00000000, 0 },
+    { 0x00DB017A, -1 }, { 0x005C010F, -1 }, { 0x00D32026, -1 }, { 0x014F201E, -1 },
+    { 0x015400FF, -1 }, { 0x017300FD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012E2039, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D100C6, -1 }, { 0x010C004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0056015A, -1 }, { 0x007200E5, -1 }, { 0x00000000, 0 }, { 0x00500074, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004C201F, -1 }, { 0x00510100, -1 }, { 0x01062013, -1 },
+    { 0x010E0167, 1 }, { 0x014C0163, 1 }, { 0x016800EE, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01660107, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0134, 1 }, { 0x01640120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011E0057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00412010, -1 }, { 0x011F00E3, -1 },
+    { 0x00000000, 0 }, { 0x00BF0076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30175, -2 },
+    { 0x00C00102, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0119, -2 }, { 0x01590111, -1 }, { 0x0178010F, -2 },
+    { 0x0134002D, -1 }, { 0x20260055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C00C7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500FA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0057006D, -1 }, { 0x0076006B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005800F9, -1 }, { 0x00000000, 0 }, { 0x014D0076, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01510175, -1 }, { 0x014E0102, -1 }, { 0x203A0044, -1 },
+    { 0x0050002C, -3 }, { 0x006F002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054012B, 1 },
+    { 0x00000000, 0 }, { 0x002F0047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D015E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014700C1, -1 }, { 0x006B005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0177, 1 }, { 0x20180104, -2 },
+    { 0x0050015D, -1 }, { 0x00000000, 0 }, { 0x016400D8, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00AB0170, -1 }, { 0x00E12018, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201100C3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE002C, -2 }, { 0x00FD002A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00660133, 1 }, { 0x015E0123, -1 }, { 0x004400C2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FF0142, -1 }, { 0x017800C7, -2 },
+    { 0x00F9005C, -1 }, { 0x01560056, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF015F, -1 }, { 0x00FD015B, -1 },
+    { 0x013800E4, -1 }, { 0x015700E2, -1 }, { 0x017600E0, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01390170, -1 },
+    { 0x0131201C, -1 }, { 0x00D90103, -1 }, { 0x011700FF, -1 }, { 0x013600FD, -2 },
+    { 0x0150201A, -1 }, { 0x0158016E, -1 }, { 0x016F2018, -1 }, { 0x017400F9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014D002E, -1 }, { 0x016C002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0170012B, 1 },
+    { 0x00D200C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A201C, -2 }, { 0x201F00FD, 1 }, { 0x00000000, 0 },
+    { 0x005400E3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E201D, -1 }, { 0x004D201B, -1 }, { 0x005200FC, -1 }, { 0x006C2019, -1 },
+    { 0x010F0163, 1 }, { 0x012B00EE, 1 }, { 0x016C015D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004A002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01080122, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012200C6, -1 }, { 0x00460061, -1 },
+    { 0x00C20059, -3 }, { 0x01000055, -2 }, { 0x014100C4, 1 }, { 0x016000C2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002800EF, 1 }, { 0x006600EB, 1 },
+    { 0x00DF0070, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40171, -1 }, { 0x0102016D, -1 },
+    { 0x01572013, -1 }, { 0x01762011, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF0117, -1 }, { 0x00FD0113, -1 }, { 0x00000000, 0 }, { 0x00D8002F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D900BB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00770067, -1 }, { 0x01500059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00542014, -1 },
+    { 0x005900F5, -2 }, { 0x005C0168, -1 }, { 0x007800F3, -1 }, { 0x013200E7, -1 },
+    { 0x017000E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F50177, -1 }, { 0x012B201F, 1 }, { 0x0169201B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D1011F, -1 }, { 0x20390059, -1 },
+    { 0x004F0041, -1 }, { 0x0166002F, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B00E7, -1 }, { 0x00000000, 0 }, { 0x0072013E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190100, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F00E8, -3 }, { 0x002C0075, -1 }, { 0x004E00E6, -1 },
+    { 0x01620061, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0066201C, 2 }, { 0x004C00FF, -1 }, { 0x006B00FD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015C2025, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C0002A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0041, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20110164, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013E013A, 3 }, { 0x00BF00CF, -1 }, { 0x00DE00CD, -1 },
+    { 0x015A00C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00440163, 1 }, { 0x00DF0159, -1 }, { 0x00DC00E6, -1 },
+    { 0x00D90073, -1 }, { 0x0155006B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00592026, -3 },
+    { 0x00D5201E, -1 }, { 0x00DA00FF, -1 }, { 0x00F4201C, -1 }, { 0x00F900FD, -1 },
+    { 0x017500F5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0120, -1 }, { 0x00000000, 0 }, { 0x005900AD, -1 }, { 0x0056003A, -1 },
+    { 0x0110002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00790137, -1 }, { 0x00000000, 0 }, { 0x005700C6, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580152, -1 }, { 0x00000000, 0 },
+    { 0x005500DF, -1 }, { 0x0071006A, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056016B, -1 },
+    { 0x007200F6, -1 }, { 0x00D20163, 1 }, { 0x00EE00EE, 1 }, { 0x016A00E6, -1 },
+    { 0x2018002C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C012B, 1 },
+    { 0x010E0178, -1 }, { 0x014C0174, -1 }, { 0x016800FF, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2018015D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010400C4, 1 }, { 0x00C30055, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006700E7, -1 }, { 0x010200DD, -3 }, { 0x00FF006A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C5016D, -1 }, { 0x00270104, -1 }, { 0x00460102, -3 },
+    { 0x00C200FA, -1 }, { 0x011F00F4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011D010D, -1 },
+    { 0x01752026, -3 }, { 0x00000000, 0 }, { 0x00F80029, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01780120, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C00D8, -1 }, { 0x00000000, 0 },
+    { 0x00590065, -2 }, { 0x00780063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01740152, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EE201F, 1 },
+    { 0x0058010A, -1 }, { 0x00D40102, -1 }, { 0x010D201D, 1 }, { 0x014B2019, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560123, -2 }, { 0x201B0057, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D00134, -1 }, { 0x00000000, 0 },
+    { 0x004E0056, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A00FC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180115, -1 }, { 0x00000000, 0 },
+    { 0x00672018, 1 }, { 0x002E00FD, -3 }, { 0x016400E9, -2 }, { 0x01420078, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01460177, -2 }, { 0x00C7010C, -1 }, { 0x01430104, -1 },
+    { 0x01620102, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0049012D, 1 },
+    { 0x00000000, 0 }, { 0x00430047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FF0153, -1 }, { 0x00DD00E2, -2 }, { 0x017800D8, -2 },
+    { 0x01750065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0170, -1 }, { 0x00D6201A, -1 }, { 0x00DE016E, -1 },
+    { 0x00F52018, -1 }, { 0x013800F5, -1 }, { 0x013B0168, -1 }, { 0x015700F3, -1 },
+    { 0x017600F1, -1 }, { 0x00000000, 0 }, { 0x202500C3, 1 }, { 0x00000000, 0 },
+    { 0x0174010A, -1 }, { 0x00000000, 0 }, { 0x00D3002E, -1 }, { 0x00F2002C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005B0135, 1 }, { 0x01720123, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0059014E, -2 }, { 0x01130142, 1 }, { 0x00000000, 0 },
+    { 0x010D005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00760165, 1 }, { 0x005400F4, -2 },
+    { 0x00000000, 0 }, { 0x00EC0077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0127, 1 }, { 0x00000000, 0 },
+    { 0x0164201A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0140, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0106014C, -1 },
+    { 0x002A00E7, -1 }, { 0x00C500DD, -3 }, { 0x00270074, 1 }, { 0x011F0064, -1 },
+    { 0x013E0062, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0061201B, -1 }, { 0x00DD2013, -1 }, { 0x01230163, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FF010B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0128, -1 },
+    { 0x00DE0126, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01770135, 1 }, { 0x00000000, 0 }, { 0x017400C2, -4 }, { 0x00D60059, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01560150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00542025, -3 }, { 0x00590106, -2 },
+    { 0x007B0177, 1 }, { 0x00EF201B, 1 }, { 0x013200F8, -1 }, { 0x01540169, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F00C6, -4 },
+    { 0x0057011F, -2 }, { 0x0076011D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005200C5, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E016B, -1 },
+    { 0x201B00F8, -1 }, { 0x00000000, 0 }, { 0x0072014F, -1 }, { 0x010A00D2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190111, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F00F9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046002A, 1 },
+    { 0x00C20022, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A0129, 1 }, { 0x0123011B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0042005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046015B, -1 },
+    { 0x011F014D, -1 }, { 0x00BF00E0, -1 }, { 0x00DE00DE, -1 }, { 0x01380065, -1 },
+    { 0x01570063, -1 }, { 0x01760061, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00440174, -1 }, { 0x00C0016C, -2 }, { 0x01342010, -1 }, { 0x0174007A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01702025, -1 }, { 0x00BB0112, -1 },
+    { 0x01560108, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01350123, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250164, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E00C5, -2 }, { 0x00540064, -2 },
+    { 0x00D0005C, -1 }, { 0x010E0058, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00770161, -1 }, { 0x00000000, 0 }, { 0x010F00E4, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056017C, -1 }, { 0x00D20174, -1 },
+    { 0x00720107, -1 }, { 0x01462018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C013C, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0143002C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0128012D, 1 }, { 0x0147012B, 2 },
+    { 0x002A0057, 1 }, { 0x01660129, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A00E1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C016F, -1 },
+    { 0x004B016D, -1 }, { 0x006700F8, -1 }, { 0x0143015D, -1 }, { 0x0162015B, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01220178, -1 }, { 0x00460113, -1 }, { 0x011F0105, -1 }, { 0x01410176, -2 },
+    { 0x0177201E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260077, -3 },
+    { 0x00000000, 0 }, { 0x00BB00CA, -1 }, { 0x015600C0, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C00E9, -1 }, { 0x015400D9, -1 }, { 0x00590076, -1 },
+    { 0x00780074, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2025011C, -1 }, { 0x01360167, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0172017C, -1 }, { 0x00770119, -1 },
+    { 0x201D004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00DB, -1 },
+    { 0x201B0068, 1 }, { 0x005300C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00F4, -1 },
+    { 0x00000000, 0 }, { 0x0054014D, -2 }, { 0x00000000, 0 }, { 0x004E0067, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520166, -2 }, { 0x014700E3, -1 },
+    { 0x016600E1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EB0175, -1 },
+    { 0x0102201F, -3 }, { 0x0121201D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006A0123, -1 }, { 0x01620113, -2 }, { 0x20100059, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C200C3, 1 },
+    { 0x00000000, 0 }, { 0x00BF0050, -1 }, { 0x00DE004E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C000DC, -2 }, { 0x00DC0067, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10168, -2 }, { 0x00DD00F3, -2 }, { 0x011E0162, -1 }, { 0x01560078, 1 },
+    { 0x015900EB, -1 }, { 0x017800E9, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015A0177, -1 }, { 0x01760102, -3 }, { 0x00000000, 0 },
+    { 0x0059002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500D4, -1 }, { 0x00000000, 0 }, { 0x0155011D, -1 },
+    { 0x0174011B, -2 }, { 0x00570047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005800D3, -1 }, { 0x015000C3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C2025, -2 }, { 0x00000000, 0 },
+    { 0x0059015F, -2 }, { 0x01320151, -1 }, { 0x00000000, 0 }, { 0x00530079, -1 },
+    { 0x016A0067, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201F011F, -1 }, { 0x00570178, 1 }, { 0x01472014, -1 }, { 0x00540105, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A00C5, 1 }, { 0x0052011E, -1 },
+    { 0x016C017F, -1 }, { 0x00000000, 0 }, { 0x0125002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0151, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01290129, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F0152, -1 }, { 0x00000000, 0 }, { 0x00C700D5, -1 },
+    { 0x0121005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A00F8, -1 },
+    { 0x00000000, 0 }, { 0x00E10079, -1 }, { 0x01000077, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040176, -3 },
+    { 0x00280111, -1 }, { 0x0159201C, 1 }, { 0x015E00FD, -1 }, { 0x0178201A, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00AB, -1 },
+    { 0x0175002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0139, -1 }, { 0x00DE0137, -1 },
+    { 0x00DB00C4, -2 }, { 0x005C0059, -2 }, { 0x007B0057, 1 }, { 0x00FD0135, 1 },
+    { 0x0179012D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x017400D3, -1 }, { 0x00790070, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0056201D, 1 }, { 0x0075201B, -1 }, { 0x013400F0, -1 }, { 0x016F0079, -1 },
+    { 0x0175015F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590117, -2 }, { 0x00780115, -1 },
+    { 0x01320109, -1 }, { 0x0072002F, -2 }, { 0x014C2026, -1 }, { 0x01700105, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0064, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0051004A, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00F0, -2 },
+    { 0x00000000, 0 }, { 0x005200D6, -1 }, { 0x014A00C6, -1 }, { 0x01660051, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0109, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005000EF, 1 }, { 0x00000000, 0 },
+    { 0x0145006C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190122, -1 }, { 0x00000000, 0 }, { 0x00C5201F, -3 }, { 0x002F010A, -1 },
+    { 0x00E4201D, -1 }, { 0x0103201B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006B011F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0100002F, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670151, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0063, -2 }, { 0x01780059, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20164, -3 },
+    { 0x00BF00F1, -1 }, { 0x00000000, 0 }, { 0x01380076, -1 }, { 0x01760072, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F62025, -1 }, { 0x01390102, 1 }, { 0x013C0175, -1 }, { 0x0153201F, -1 },
+    { 0x01580100, 1 }, { 0x017700FE, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA0121, -1 }, { 0x0137011B, -1 },
+    { 0x00580043, -1 }, { 0x01750117, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013200C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250175, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700E8, -2 }, { 0x007600E6, -1 }, { 0x00EF006B, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006F201E, -1 }, { 0x00550101, -1 }, { 0x010A2014, -1 },
+    { 0x016C00EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0134, 1 }, { 0x201B00C1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C014D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CD012B, 1 }, { 0x002F00C2, -3 }, { 0x002C004F, -1 }, { 0x004B004D, 1 },
+    { 0x004E00C0, -1 }, { 0x0162003B, -1 }, { 0x01680121, -1 }, { 0x201A0166, -2 },
+    { 0x20390164, -1 }, { 0x00EA0142, 1 }, { 0x004C00D9, -1 }, { 0x00E4005C, -3 },
+    { 0x01410056, -2 }, { 0x0147013C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0167, -1 }, { 0x01640153, -2 }, { 0x004A00F2, -1 },
+    { 0x0066007D, 3 }, { 0x00C30077, -2 }, { 0x012300E4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670109, -1 },
+    { 0x00FD201E, -3 }, { 0x010200FF, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0157002C, -2 },
+    { 0x0176002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC00C0, -2 },
+    { 0x01360047, -1 }, { 0x01740043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD014C, -2 }, { 0x01780142, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0157015D, -1 },
+    { 0x00572019, 1 }, { 0x005C00FA, -1 }, { 0x01510077, -1 }, { 0x0176015B, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D9017E, -1 }, { 0x00790111, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0054002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x012E00AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0079, 1 },
+    { 0x00000000, 0 }, { 0x016A00C0, -2 }, { 0x00AD0059, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201F0178, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F007A, -1 }, { 0x006D0076, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A011E, -1 },
+    { 0x00000000, 0 }, { 0x00520177, -1 }, { 0x004F0104, -1 }, { 0x00E52019, -1 },
+    { 0x016600F2, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180137, 1 }, { 0x00000000, 0 }, { 0x201500C4, -1 }, { 0x0164010B, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C3002F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201300DD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002A0151, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF0061, -1 }, { 0x013B0059, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011D00E7, -1 },
+    { 0x00000000, 0 }, { 0x00DC0078, -1 }, { 0x00FB0076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E00177, -1 },
+    { 0x00DD0104, -3 }, { 0x0154201B, -2 }, { 0x017800FA, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB011D, -1 }, { 0x01380117, -1 }, { 0x01570115, -1 },
+    { 0x0151002F, -1 }, { 0x01760113, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D600C3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E201D, -1 }, { 0x20260171, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007700E2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0070201A, -1 }, { 0x005600FD, -1 }, { 0x00000000, 0 }, { 0x016A0078, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01472025, -1 }, { 0x016E0177, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A00D6, -1 }, { 0x00000000, 0 }, { 0x014A011F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B0162, 1 }, { 0x201800EF, 1 }, { 0x00000000, 0 },
+    { 0x0129013A, 2 }, { 0x014500C5, -1 }, { 0x01040056, -3 }, { 0x016400C3, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E0161, -1 }, { 0x00000000, 0 }, { 0x004B00EE, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A0109, -1 }, { 0x00442026, -1 },
+    { 0x00C500FF, -2 }, { 0x00DF201C, -1 }, { 0x00E400FD, -1 }, { 0x00FE201A, -1 },
+    { 0x011D2018, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280122, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0139002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004200C6, -1 }, { 0x00BB004B, -1 },
+    { 0x01560041, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00430152, -1 }, { 0x00BF014A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041016B, -1 }, { 0x00582015, -1 },
+    { 0x00D900EE, 1 }, { 0x00DC0161, -1 }, { 0x00F50079, -1 }, { 0x013600E8, -1 },
+    { 0x015500E6, -1 }, { 0x017400E4, -1 }, { 0x00000000, 0 }, { 0x00DA017A, -1 },
+    { 0x00D22026, -1 }, { 0x01340101, -1 }, { 0x014E201E, -1 }, { 0x015300FF, -1 },
+    { 0x01560172, -1 }, { 0x016D201C, -1 }, { 0x017200FD, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201F00E8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D000C6, -2 }, { 0x010E00C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0101, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F0074, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A0118, -1 },
+    { 0x016A0161, -1 }, { 0x00500100, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0168017A, -1 }, { 0x002F011B, -3 }, { 0x01602026, -1 },
+    { 0x00000000, 0 }, { 0x01020027, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002D0134, -1 },
+    { 0x002A00C1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015E00C6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FF00E5, -1 }, { 0x00000000, 0 },
+    { 0x0159006C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20175, -2 }, { 0x0043010A, -1 },
+    { 0x00DE0100, -2 }, { 0x00F8201D, -1 }, { 0x00FD00FE, -1 }, { 0x01000171, -1 },
+    { 0x0117201B, -1 }, { 0x01742015, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0177010F, -1 }, { 0x20250055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0153, -1 }, { 0x005900E0, -2 },
+    { 0x0056006D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00522018, -2 },
+    { 0x005700F9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01310177, -1 }, { 0x016C0100, -2 }, { 0x00000000, 0 }, { 0x004F002C, -1 },
+    { 0x006E002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A00D0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201900EB, -2 }, { 0x00000000, 0 }, { 0x00700142, 1 },
+    { 0x002F00D3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0177, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006B00E8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0178, -3 }, { 0x004D0176, -1 }, { 0x004A0103, -1 }, { 0x00E02018, -1 },
+    { 0x012300F5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201000C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD002C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460135, 1 },
+    { 0x013E0125, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0176003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DF0144, -1 }, { 0x004100DB, -2 }, { 0x00F8005C, -2 },
+    { 0x00FE0142, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD015D, -2 }, { 0x00592011, -1 }, { 0x013700E4, -1 },
+    { 0x01340071, -1 }, { 0x017500E0, -1 }, { 0x01780153, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C010B, -1 },
+    { 0x014F201A, -1 }, { 0x015400FB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014C002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0071, -2 }, { 0x00000000, 0 }, { 0x00D100C2, -1 },
+    { 0x00520057, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E00FD, -3 }, { 0x00000000, 0 }, { 0x007200E1, -1 },
+    { 0x00000000, 0 }, { 0x01290062, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C201B, -1 },
+    { 0x00D00167, 1 }, { 0x010E0163, 1 }, { 0x012A00EE, 1 }, { 0x01460079, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01470105, -1 }, { 0x01660103, -2 },
+    { 0x00C50027, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0164011C, -1 },
+    { 0x00000000, 0 }, { 0x0028004A, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01430137, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10059, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00620078, -1 },
+    { 0x00BF0072, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C30171, -1 }, { 0x00DF00FC, -1 }, { 0x011D00F8, -1 },
+    { 0x01562013, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0115, -2 },
+    { 0x0159010D, -1 }, { 0x0178010B, -2 }, { 0x20260051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00760067, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007700F3, -1 },
+    { 0x00000000, 0 }, { 0x00F00078, -1 }, { 0x010F0076, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F40177, -1 },
+    { 0x01100102, -1 }, { 0x01130175, -1 }, { 0x0149201D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0043, -1 },
+    { 0x004E0041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D015A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016600BB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20180100, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016400D4, -1 }, { 0x00000000, 0 }, { 0x01230065, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0046201E, -2 }, { 0x004B00FF, -2 }, { 0x0065201C, -1 }, { 0x006A00FD, -1 },
+    { 0x00AB016C, -1 }, { 0x014300EF, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0066012F, 1 },
+    { 0x015E011F, -1 }, { 0x00DC0041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20100164, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00FF013E, -1 }, { 0x017800C3, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF015B, -1 }, { 0x00000000, 0 }, { 0x00DB00E6, -1 }, { 0x007B0079, 1 },
+    { 0x013800E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D4201E, -1 }, { 0x00D900FF, -1 },
+    { 0x00F3201C, -1 }, { 0x00F800FD, -1 }, { 0x01312018, -1 }, { 0x013600F9, -1 },
+    { 0x0139016C, -1 }, { 0x0158016A, -1 }, { 0x017400F5, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005800AD, -1 }, { 0x014D002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0132012B, 1 }, { 0x005600C6, -4 }, { 0x016A0041, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A2018, -2 },
+    { 0x00000000, 0 }, { 0x00570152, -1 }, { 0x014F0142, 1 }, { 0x00000000, 0 },
+    { 0x0149005C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E2019, -1 },
+    { 0x00000000, 0 }, { 0x01660073, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B012B, 1 }, { 0x00000000, 0 },
+    { 0x0162201E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0108011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014100C0, 1 }, { 0x00C20055, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20150176, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002800EB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C4016D, -1 }, { 0x00C100FA, -1 }, { 0x00FF00F6, -1 }, { 0x01020169, -1 },
+    { 0x01210167, 1 }, { 0x017B00EE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013E017E, 1 }, { 0x00BF0113, -1 }, { 0x00FD010F, -1 },
+    { 0x01742026, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01580122, -1 },
+    { 0x00000000, 0 }, { 0x017400AD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BB0145, -1 }, { 0x00000000, 0 }, { 0x017200C6, -2 }, { 0x00770063, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00542010, -1 }, { 0x005900F1, -1 }, { 0x005C0164, -2 },
+    { 0x013200E3, -1 }, { 0x017000DF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00ED201F, -1 }, { 0x0057010A, -1 },
+    { 0x00D30102, -1 }, { 0x012B201B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00550123, -1 }, { 0x201A0057, -4 }, { 0x20390055, -1 }, { 0x0147002D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0072013A, -1 }, { 0x00AD00C3, -1 }, { 0x004D0056, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F00E4, -3 },
+    { 0x004B006F, -1 }, { 0x004E00E2, -1 }, { 0x00AB00DC, -1 }, { 0x010800D6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00662018, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01600076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0044002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0048012D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004300D3, -1 }, { 0x00BF00CB, -1 }, { 0x00DE00C9, -1 }, { 0x013B00C3, 1 },
+    { 0x015A00C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DF0155, -1 }, { 0x00DC00E2, -1 }, { 0x011D0151, -1 }, { 0x013900DC, -1 },
+    { 0x01550067, -1 }, { 0x015800DA, -1 }, { 0x01740065, -2 }, { 0x00000000, 0 },
+    { 0x00420178, -1 }, { 0x00D5201A, -1 }, { 0x00F42018, -1 }, { 0x01322014, -1 },
+    { 0x013700F5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C011C, -1 },
+    { 0x0154010C, -1 }, { 0x00D2002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A0135, 1 },
+    { 0x00000000, 0 }, { 0x005700C2, -4 }, { 0x0054004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0058014E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E2013, -1 }, { 0x007200F2, -1 },
+    { 0x00EB0077, -1 }, { 0x016A00E2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0127, 1 }, { 0x00D00178, -1 }, { 0x010E0174, -1 },
+    { 0x0144201C, -1 }, { 0x014900FD, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01042039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0160002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0164012D, 1 }, { 0x010400C0, 1 },
+    { 0x00470059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C70150, -1 }, { 0x006700E3, -1 },
+    { 0x00C400DD, -3 }, { 0x010200D9, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041201D, -2 },
+    { 0x00270100, -1 }, { 0x00C50169, -1 }, { 0x011F00F0, -1 }, { 0x015A0079, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011D0109, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0178011C, -2 },
+    { 0x00000000, 0 }, { 0x0134003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01570137, -1 },
+    { 0x005C00D4, -1 }, { 0x015400C4, 1 }, { 0x00590061, -2 }, { 0x00D50059, -1 },
+    { 0x01760135, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01360152, -1 }, { 0x007900EB, -1 }, { 0x0057007A, -1 }, { 0x0174014E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00532025, -1 }, { 0x00580106, -1 }, { 0x00EE201B, 1 },
+    { 0x010D2019, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056011F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010A002D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019006C, 1 }, { 0x005100C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180111, -1 }, { 0x00000000, 0 }, { 0x00AD0164, -1 }, { 0x002E00F9, -1 },
+    { 0x016400E5, -2 }, { 0x01040078, 1 }, { 0x01420074, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01270175, -2 },
+    { 0x00C70108, -1 }, { 0x013E201F, 2 }, { 0x01430100, -1 }, { 0x00C10022, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00490129, 1 }, { 0x00000000, 0 }, { 0x00430043, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0041005C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FF014F, -1 },
+    { 0x017800D4, -2 }, { 0x00000000, 0 }, { 0x01370065, -1 }, { 0x01750061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0079201C, 1 }, { 0x00BF016C, -1 }, { 0x00DE016A, -1 }, { 0x011C0166, -1 },
+    { 0x013B0164, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0136010A, -1 }, { 0x01740106, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01340123, -1 },
+    { 0x0172011F, -1 }, { 0x010F003F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00720062, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00760161, -1 }, { 0x00000000, 0 }, { 0x005400F0, -2 }, { 0x0051007D, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0123, -2 }, { 0x0055017C, -1 }, { 0x00D10174, 1 }, { 0x00ED00FF, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B013C, 1 }, { 0x00000000, 0 }, { 0x20150056, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500D9, -2 },
+    { 0x015D005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013C0077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0176201E, -3 }, { 0x00FF0107, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0124, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250077, -3 }, { 0x00000000, 0 },
+    { 0x013600C2, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BB0156, -1 },
+    { 0x0156014C, -1 }, { 0x00000000, 0 }, { 0x00580076, -1 }, { 0x00770074, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0175, -1 }, { 0x00590102, -3 }, { 0x0073201F, -1 }, { 0x013200F4, -1 },
+    { 0x01540165, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201F00C2, -2 }, { 0x0057011B, -2 }, { 0x00760119, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005200C1, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0167, -1 }, { 0x201B00F4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01450057, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019010D, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F00F5, -3 }, { 0x00000000, 0 },
+    { 0x00E60076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F017F, -1 }, { 0x00EA0175, -1 },
+    { 0x0101201F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01230117, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C100C3, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF00DC, -1 },
+    { 0x00DB0067, -1 }, { 0x00DE00DA, -1 }, { 0x01380061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00168, -2 },
+    { 0x004100FD, -2 }, { 0x017700E9, -1 }, { 0x01740076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01322025, -1 }, { 0x00BB010E, -1 }, { 0x01560104, 1 }, { 0x0077002C, -3 },
+    { 0x01780175, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016E203A, -1 }, { 0x007B012B, 1 }, { 0x0135011F, -1 },
+    { 0x00560047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700D3, -1 }, { 0x00D00058, -1 }, { 0x016E00C1, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B2025, -2 }, { 0x00000000, 0 }, { 0x0077015D, -1 },
+    { 0x00000000, 0 }, { 0x00D100E4, -1 }, { 0x00520079, -1 }, { 0x012B006B, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560178, 1 }, { 0x00000000, 0 }, { 0x00720103, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201900C5, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01280129, 1 }, { 0x002D00C6, -1 }, { 0x004C00C4, 1 }, { 0x01410041, 1 },
+    { 0x01470127, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0152, -1 }, { 0x01450140, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C016B, -1 }, { 0x00432015, -1 }, { 0x004B0169, -1 },
+    { 0x006700F4, -1 }, { 0x00E00079, -1 }, { 0x012100E8, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01220174, -1 }, { 0x0046010F, -1 },
+    { 0x011F0101, -1 }, { 0x013E00FF, 1 }, { 0x01410172, -1 }, { 0x0158201C, -2 },
+    { 0x0177201A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0174002E, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0137, 1 }, { 0x0178012D, 2 }, { 0x00BB00C6, -1 },
+    { 0x00DA00C4, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760146, -1 }, { 0x00000000, 0 },
+    { 0x00D800DD, -1 }, { 0x00590072, -1 }, { 0x01320064, -1 }, { 0x015400D5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01360163, -1 },
+    { 0x00D12015, -1 }, { 0x01550161, -1 }, { 0x016E0079, -1 }, { 0x0174015F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00770115, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0064, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00F0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016800C4, -2 }, { 0x002F0065, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D017C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00520162, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0163006A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C4201F, -3 }, { 0x002E010A, -1 }, { 0x00E3201D, -1 },
+    { 0x0102201B, -3 }, { 0x01212019, 1 }, { 0x016400F6, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006A011F, -1 },
+    { 0x0162010F, -2 }, { 0x00000000, 0 }, { 0x00FF002F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF004C, -1 },
+    { 0x00DE004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10164, -3 }, { 0x00DD00EF, 2 },
+    { 0x015900E7, -1 }, { 0x01370076, -1 }, { 0x01560074, -1 }, { 0x017800E5, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F52025, -1 },
+    { 0x013B0175, -1 }, { 0x017600FE, 1 }, { 0x0059002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D90121, -1 }, { 0x0136011B, -1 }, { 0x00570043, -1 },
+    { 0x01550119, -1 }, { 0x01740117, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059015B, -2 }, { 0x0132014D, -1 },
+    { 0x005600E8, -2 }, { 0x00720073, -1 }, { 0x00EE006B, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F011B, -1 }, { 0x00000000, 0 },
+    { 0x01472010, -1 }, { 0x00540101, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A00C1, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B014D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CC012B, 1 },
+    { 0x002E00C2, 1 }, { 0x01040041, 1 }, { 0x01290125, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F014E, -1 },
+    { 0x00E90142, 1 }, { 0x002C00DB, -1 }, { 0x00670064, -1 }, { 0x00E3005C, -3 },
+    { 0x016200C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002A00F4, -1 }, { 0x00000000, 0 }, { 0x00C20077, -2 },
+    { 0x011F0071, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01040172, -2 }, { 0x0028010D, -1 }, { 0x010100FF, -1 },
+    { 0x011B201C, -1 }, { 0x01592018, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0175002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01790129, 1 }, { 0x00DB00C0, -2 }, { 0x005C0055, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01770142, -1 }, { 0x013600D3, -1 },
+    { 0x0079006C, -1 }, { 0x0171005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0175015B, -1 }, { 0x00562019, 1 },
+    { 0x00000000, 0 }, { 0x01310079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01540176, -2 },
+    { 0x00590113, -2 }, { 0x00780111, -1 }, { 0x010E2026, -1 }, { 0x01320105, -1 },
+    { 0x01700101, -1 }, { 0x201E0047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0079, -1 }, { 0x005200D2, -1 },
+    { 0x014A00C2, -1 }, { 0x0166004D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0178, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006C0076, -1 }, { 0x01450068, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019011E, -1 }, { 0x00000000, 0 },
+    { 0x00510177, 1 }, { 0x002F0106, -1 }, { 0x004E0104, -1 }, { 0x00700175, -1 },
+    { 0x00AB00FE, -1 }, { 0x00C5201B, -3 }, { 0x00E42019, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0166017E, -1 }, { 0x006B011B, -1 }, { 0x201400C4, -1 },
+    { 0x00000000, 0 }, { 0x00C2002F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00A1004A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0067014D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FD00E9, -1 }, { 0x00000000, 0 },
+    { 0x00DB0078, -1 }, { 0x00FA0076, -1 }, { 0x0176006E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DF0177, -1 }, { 0x00DC0104, -2 },
+    { 0x00FE0175, -1 }, { 0x0115201F, -1 }, { 0x0153201B, -1 }, { 0x015800FC, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DA011D, -1 }, { 0x01370117, -1 }, { 0x01750113, -1 }, { 0x0150002F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D500C3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250171, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700E4, -1 },
+    { 0x00540071, -2 }, { 0x007600E2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0050201C, 1 },
+    { 0x005500FD, -1 }, { 0x006F201A, -1 }, { 0x010A2010, -1 }, { 0x012E00EF, 1 },
+    { 0x01690078, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016D0177, -1 }, { 0x016A0104, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201900D6, -1 }, { 0x00000000, 0 }, { 0x0168011D, -1 }, { 0x00000000, 0 },
+    { 0x00E6003F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0162, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002A0064, -1 }, { 0x01220054, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0163, -1 },
+    { 0x0164014F, -2 }, { 0x004A00EE, 1 }, { 0x012300E0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FD201A, -3 }, { 0x00670105, -1 }, { 0x00C400FF, -2 },
+    { 0x00E300FD, -1 }, { 0x010200FB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004300AD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004100C6, 1 }, { 0x01360043, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0148, -1 }, { 0x01590140, -1 }, { 0x0178013E, 1 }, { 0x005B006A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB0161, -1 }, { 0x00572015, -1 }, { 0x005C00F6, -1 },
+    { 0x00F40079, -1 }, { 0x01130077, -1 }, { 0x01760157, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D9017A, -1 }, { 0x0079010D, -1 },
+    { 0x00D12026, -1 }, { 0x014D201E, -1 }, { 0x017100FD, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x012C2039, -1 }, { 0x00000000, 0 }, { 0x00D100AD, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010A004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F0174, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F0076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520173, -1 },
+    { 0x004F0100, -1 }, { 0x01042013, -1 }, { 0x016600EE, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201500C0, -1 }, { 0x00000000, 0 }, { 0x01640107, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0134, 1 }, { 0x01620120, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A014D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011C0057, -1 }, { 0x013B0055, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00470164, -1 }, { 0x011D00E3, -1 }, { 0x00000000, 0 }, { 0x0177006A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10175, -2 }, { 0x00DD0100, -3 }, { 0x015900F8, -1 },
+    { 0x017800F6, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01380113, -1 },
+    { 0x01570111, -1 }, { 0x0176010F, -2 }, { 0x0059003B, -1 }, { 0x0132002D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026016D, -1 }, { 0x201E2019, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005600F9, -1 },
+    { 0x00000000, 0 }, { 0x014B0076, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014F0175, -1 },
+    { 0x014C0102, -1 }, { 0x0166201F, 1 }, { 0x004E002C, -1 }, { 0x006D002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A00D2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201800EB, -1 }, { 0x00000000, 0 }, { 0x006F0142, 1 }, { 0x002E00D3, -1 },
+    { 0x014500C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F015F, -3 }, { 0x004E015D, -1 },
+    { 0x004B00EA, -1 }, { 0x016200D8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002D0178, -1 },
+    { 0x004C0176, -2 }, { 0x00C500FB, -1 }, { 0x00DF2018, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0028011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DC002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015C0123, -1 },
+    { 0x004200C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0043014E, -1 },
+    { 0x00BF0146, -1 }, { 0x00FD0142, -1 }, { 0x01540056, -2 }, { 0x017600C7, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DC015D, -1 }, { 0x00582011, -1 }, { 0x015500E2, -1 }, { 0x017400E0, -2 },
+    { 0x01770153, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BB0178, -1 }, { 0x0110201E, -1 }, { 0x011500FF, -1 },
+    { 0x012F201C, -1 }, { 0x014E201A, -1 }, { 0x0156016E, -1 }, { 0x016D2018, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016A002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0071, -1 }, { 0x016E012B, 1 }, { 0x00D000C2, -1 }, { 0x00510057, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x203A0114, -1 }, { 0x002C201D, -1 }, { 0x005000FC, 1 },
+    { 0x00C72013, -1 }, { 0x012900EE, 1 }, { 0x016A015D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F0117, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40027, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01060122, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002800D6, -1 },
+    { 0x012000C6, -1 }, { 0x00C00059, -3 }, { 0x015E00C2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00FF00E1, -1 }, { 0x00000000, 0 }, { 0x00DD0070, -1 }, { 0x01590068, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00650177, -1 }, { 0x00430106, -1 }, { 0x00BF00FE, -1 }, { 0x00C20171, -1 },
+    { 0x00F82019, -1 }, { 0x0100016D, -1 }, { 0x01362015, -1 }, { 0x01552013, -1 },
+    { 0x01742011, -1 }, { 0x00000000, 0 }, { 0x00220121, -1 }, { 0x0177010B, -1 },
+    { 0x20250051, -1 }, { 0x00D6002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600DD, -3 }, { 0x00BB0130, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C014F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014E0059, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00522014, -1 }, { 0x005700F5, -2 }, { 0x007600F3, -1 },
+    { 0x016E00E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F30177, -1 }, { 0x0129201F, 1 },
+    { 0x0148201D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A00CC, -1 }, { 0x00000000, 0 },
+    { 0x00720125, -1 }, { 0x00000000, 0 }, { 0x002E0043, -1 }, { 0x006C003F, -1 },
+    { 0x0164002F, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900E7, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0173, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B00E4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0174, -4 }, { 0x0064201C, -1 },
+    { 0x006900FD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015A2025, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB0041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015800C5, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0159, -1 },
+    { 0x01590151, -1 }, { 0x00DA00E6, -1 }, { 0x013700E0, -1 }, { 0x0178014F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00572026, -4 }, { 0x005C0107, -1 }, { 0x00D3201E, -1 },
+    { 0x00F2201C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F0054, 1 }, { 0x00000000, 0 },
+    { 0x005700AD, -1 }, { 0x0054003A, -1 }, { 0x010E002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00770137, -1 },
+    { 0x00000000, 0 }, { 0x005500C6, -2 }, { 0x010C0047, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00F9, -1 },
+    { 0x00560152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0148005C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D00163, 1 }, { 0x00000000, 0 }, { 0x016800E6, -1 },
+    { 0x01270077, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014A0174, 1 }, { 0x00000000, 0 },
+    { 0x01470101, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010400AB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010200C4, 1 },
+    { 0x00C10055, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20140176, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004600E9, -1 },
+    { 0x010000DD, -3 }, { 0x00BF006E, -1 }, { 0x00DE006C, -1 }, { 0x00FD006A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280177, 1 },
+    { 0x00440102, -1 }, { 0x00C000FA, -1 }, { 0x00C3016D, -1 }, { 0x011D00F4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0111, -2 }, { 0x01590109, -1 }, { 0x01780107, -2 },
+    { 0x00F60029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760120, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570065, -2 }, { 0x00760063, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00EC201F, -1 }, { 0x0056010A, -1 }, { 0x00D20102, -1 },
+    { 0x010B201D, 1 }, { 0x01492019, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540123, -2 },
+    { 0x20190057, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002D0058, -1 }, { 0x004C0056, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A006F, -1 },
+    { 0x01230061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046201A, -2 }, { 0x002C00FD, -3 },
+    { 0x004B00FB, -1 }, { 0x00652018, -1 }, { 0x00AB0168, -1 }, { 0x016200E9, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01440177, -2 },
+    { 0x01410104, 1 }, { 0x01600102, -1 }, { 0x0062002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0066012B, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FF013A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0157, -1 },
+    { 0x00DB00E2, -1 }, { 0x005C0077, -1 }, { 0x00FD0153, -1 }, { 0x017600D8, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410178, -3 },
+    { 0x00D4201A, -1 }, { 0x00F32018, -1 }, { 0x013600F5, -1 }, { 0x01390168, -1 },
+    { 0x015500F3, -1 }, { 0x01580166, -2 }, { 0x017400F1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D1002E, -1 }, { 0x00F0002C, -1 }, { 0x010F002A, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590135, 1 }, { 0x01700123, -1 },
+    { 0x005600C2, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F00F5, -1 }, { 0x0057014E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010B005C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D1015F, -1 }, { 0x00000000, 0 }, { 0x014A00E4, -1 }, { 0x00EA0077, -1 },
+    { 0x0166006F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B0127, 1 }, { 0x00000000, 0 }, { 0x0162201A, -3 }, { 0x014800FD, -2 },
+    { 0x20150041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190140, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500C4, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01420148, 1 }, { 0x002800E7, -1 }, { 0x006600E3, 1 },
+    { 0x00C300DD, -3 }, { 0x011D0064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40169, -1 }, { 0x01210163, 1 },
+    { 0x00FF00F2, -1 }, { 0x01780077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF010F, -1 }, { 0x00FD010B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0158011E, -1 }, { 0x00000000, 0 }, { 0x013600AD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BB0141, -1 }, { 0x01750135, 1 },
+    { 0x013400C6, -1 }, { 0x00D40059, -1 }, { 0x017200C2, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201F2026, -2 }, { 0x00000000, 0 }, { 0x01540150, -1 },
+    { 0x007800EB, -1 }, { 0x0056007A, -1 }, { 0x00750078, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00ED201B, -1 }, { 0x00570106, -1 }, { 0x014A2015, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00C6, -5 }, { 0x0055011F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0152, -1 }, { 0x00000000, 0 }, { 0x203A00DD, -1 }, { 0x2018006C, 1 },
+    { 0x005000C5, -3 }, { 0x002E0054, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900F8, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F00E0, -3 }, { 0x010800D2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B00F5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040104, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00022, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00480129, 1 }, { 0x0121011B, -1 }, { 0x00000000, 0 }, { 0x0178002F, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF00C7, -1 }, { 0x00DE00C5, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026201F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011D014D, -1 }, { 0x015800D6, -1 },
+    { 0x00000000, 0 }, { 0x01360065, -1 }, { 0x01550063, -1 }, { 0x01740061, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420174, -1 }, { 0x0059201E, -3 },
+    { 0x0078201C, 1 }, { 0x01322010, -1 }, { 0x0172007A, -1 }, { 0x01780160, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016E2025, -1 }, { 0x01540108, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01330123, -1 }, { 0x201F0065, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016C00C5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E010A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0123, -1 },
+    { 0x0054017C, -1 }, { 0x00D00174, -1 }, { 0x00EC00FF, -1 }, { 0x01442018, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20140056, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0126012D, 1 }, { 0x0145012B, 2 }, { 0x01640129, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C7014C, -1 }, { 0x00000000, 0 }, { 0x00C400D9, -2 }, { 0x00FF0062, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00412019, -2 }, { 0x00000000, 0 },
+    { 0x013B0077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01200178, -1 }, { 0x0175201E, -3 },
+    { 0x011D0105, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0122, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015400C0, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0136014E, -1 }, { 0x007900E7, -1 },
+    { 0x00000000, 0 }, { 0x00570076, -1 }, { 0x00760074, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0072201F, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0170017C, -1 }, { 0x0056011B, -2 }, { 0x201E00C2, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190068, 1 }, { 0x005100C1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B0065, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018010D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014500E3, -1 }, { 0x016400E1, -2 }, { 0x00E50076, -1 },
+    { 0x01420070, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00E90175, -1 }, { 0x004B010C, -1 }, { 0x0100201F, -3 },
+    { 0x011F201D, 1 }, { 0x013E201B, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C000C3, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA0067, -1 },
+    { 0x01370061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00792018, 1 }, { 0x00BF0168, -1 },
+    { 0x00DE0166, -1 }, { 0x011C0162, -1 }, { 0x01540078, 1 }, { 0x015700EB, -1 },
+    { 0x01730076, -1 }, { 0x017600E9, -2 }, { 0x00000000, 0 }, { 0x00DC017F, -1 },
+    { 0x01360106, -1 }, { 0x01580177, -1 }, { 0x0057002E, -4 }, { 0x0076002C, -3 },
+    { 0x01740102, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005B012D, 1 }, { 0x0134011F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590146, -1 }, { 0x00000000, 0 }, { 0x005600D3, -1 },
+    { 0x014E00C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057015F, -2 }, { 0x0076015D, -1 },
+    { 0x00000000, 0 }, { 0x00510079, 1 }, { 0x00700077, -1 }, { 0x01680067, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D011F, -2 }, { 0x00000000, 0 },
+    { 0x01452014, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A0136, -1 },
+    { 0x201800C5, -2 }, { 0x016A017F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0123002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190151, -2 }, { 0x00000000, 0 }, { 0x004E0137, 1 }, { 0x00000000, 0 },
+    { 0x004B00C4, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011F005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01420159, 1 }, { 0x002800F8, -1 }, { 0x00000000, 0 }, { 0x00DF0079, -1 },
+    { 0x00FE0077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01020176, -3 }, { 0x0157201C, 1 }, { 0x00FF0103, -1 },
+    { 0x015C00FD, -1 }, { 0x0176201A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0120, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D900C4, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202600FF, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00770070, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054201D, 1 }, { 0x005900FE, 1 },
+    { 0x005C0171, -1 }, { 0x0073201B, -1 }, { 0x013200F0, -1 }, { 0x016D0079, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570117, -2 }, { 0x00760115, -1 }, { 0x014A2026, -1 }, { 0x0070002F, -1 },
+    { 0x016E0105, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014A00AD, -1 },
+    { 0x004F004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0163, -1 },
+    { 0x00000000, 0 }, { 0x201B00F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01640051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190109, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F00F1, -1 }, { 0x004E00EF, 2 }, { 0x0143006C, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00662025, -1 }, { 0x00C3201F, -3 }, { 0x00E2201D, -1 }, { 0x0101201B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A0121, -1 }, { 0x01230113, -1 },
+    { 0x00000000, 0 }, { 0x00FE002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00460153, -1 }, { 0x00BF00D8, -1 }, { 0x00000000, 0 }, { 0x01760059, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C00164, -3 }, { 0x004100F9, -1 }, { 0x00DC00EF, 1 },
+    { 0x01360076, -2 }, { 0x01740072, -1 }, { 0x017700E5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F42025, -1 }, { 0x011B0177, -1 },
+    { 0x013A0175, -1 }, { 0x0058002A, 1 }, { 0x0151201F, -1 }, { 0x01560100, 1 },
+    { 0x017500FE, -1 }, { 0x01780171, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560043, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00790140, -1 }, { 0x201F0076, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D100E0, -1 },
+    { 0x00520075, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01082014, -1 },
+    { 0x016A00EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900C1, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01470123, -1 }, { 0x002D00C2, -1 },
+    { 0x004C00C0, 1 }, { 0x01660121, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180166, 1 }, { 0x00000000, 0 }, { 0x002E014E, -1 }, { 0x00E80142, 1 },
+    { 0x0145013C, 1 }, { 0x00E2005C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0167, -1 },
+    { 0x00432011, -1 }, { 0x004B0165, -1 }, { 0x006700F0, -1 }, { 0x00C10077, -2 },
+    { 0x00FF0073, -1 }, { 0x012100E4, -1 }, { 0x01620153, -2 }, { 0x00000000, 0 },
+    { 0x00C50176, -3 }, { 0x0046010B, -1 }, { 0x010000FF, -2 }, { 0x0141016E, -1 },
+    { 0x01582018, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0155002C, -2 }, { 0x0174002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01780129, 2 }, { 0x00BB00C2, -1 }, { 0x00DA00C0, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01760142, 1 }, { 0x00000000, 0 }, { 0x0059006E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0155015D, -1 }, { 0x007900F8, -1 }, { 0x00D12011, -1 },
+    { 0x014F0077, -1 }, { 0x0174015B, -2 }, { 0x201F002E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00770111, -1 },
+    { 0x201D0047, -1 }, { 0x00000000, 0 }, { 0x0052002D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00D3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012C00AB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F015F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012D0137, 2 }, { 0x00000000, 0 }, { 0x016800C0, -2 },
+    { 0x002F0061, -3 }, { 0x00AB0059, -1 }, { 0x00000000, 0 }, { 0x201D0178, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010C0152, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006B0076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00500177, 1 },
+    { 0x002E0106, -1 }, { 0x006F0175, -1 }, { 0x00C4201B, -3 }, { 0x00E32019, -1 },
+    { 0x016400F2, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201300C4, -1 }, { 0x0162010B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C1002F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201100DD, -1 }, { 0x00000000, 0 }, { 0x002700C5, -1 },
+    { 0x004600C3, -3 }, { 0x00BF0048, -1 }, { 0x00DE0046, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280151, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01390059, -2 }, { 0x01580057, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD00EB, -2 }, { 0x015900E3, -1 }, { 0x00DA0078, -1 },
+    { 0x00F90076, -1 }, { 0x017800E1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0104, -2 }, { 0x017600FA, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D9011D, -1 },
+    { 0x01360117, -1 }, { 0x01550115, -1 }, { 0x014F002F, -1 }, { 0x01740113, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D400C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590157, -1 }, { 0x005600E4, -1 }, { 0x0072006F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201F0117, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012D00EF, 1 },
+    { 0x00000000, 0 }, { 0x01680078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01452025, -1 },
+    { 0x010C010A, -1 }, { 0x016C0177, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A0147, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E5003F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B00D5, -1 },
+    { 0x01020056, -3 }, { 0x014300C5, -1 }, { 0x016200C3, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002A00F0, -1 }, { 0x004900EE, 1 }, { 0x00650079, -1 }, { 0x013E006B, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0104016E, -2 },
+    { 0x00280109, -1 }, { 0x00422026, -1 }, { 0x00C300FF, -2 }, { 0x00E200FD, -1 },
+    { 0x011B2018, -1 }, { 0x01592014, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C0051, -1 }, { 0x01540041, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0177013E, -1 }, { 0x00000000, 0 }, { 0x00790068, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DA0161, -1 }, { 0x00562015, -1 }, { 0x013400E8, -1 }, { 0x00F30079, -1 },
+    { 0x017200E4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01540172, -1 }, { 0x0059010F, -2 }, { 0x0078010D, -1 },
+    { 0x00D02026, -1 }, { 0x01320101, -1 }, { 0x014C201E, -1 }, { 0x015100FF, -1 },
+    { 0x016B201C, -1 }, { 0x017000FD, -1 }, { 0x201E0043, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00E8, -2 },
+    { 0x010F0135, 3 }, { 0x201A0075, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0174, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0076, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0068201D, -1 }, { 0x002F0102, -3 },
+    { 0x004E0100, -1 }, { 0x01680161, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0166017A, -1 },
+    { 0x006B0117, -1 }, { 0x015E2026, -1 }, { 0x201400C0, -1 }, { 0x01000027, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015C00C6, -1 }, { 0x01780051, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF00E9, -1 }, { 0x00FD00E5, -1 }, { 0x0157006C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C00175, -2 }, { 0x00DC0100, -2 }, { 0x00DF0173, -1 }, { 0x00F6201D, -1 },
+    { 0x0115201B, -1 }, { 0x017700F6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01370113, -1 }, { 0x0175010F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005900C7, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2025016D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00790151, -1 }, { 0x005700E0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00502018, 1 }, { 0x010F00ED, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012F0177, -1 }, { 0x0165201F, 1 },
+    { 0x016A0100, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900D2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0047, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0068005C, -3 },
+    { 0x00C50056, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180177, 1 },
+    { 0x20150104, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A00EA, -1 },
+    { 0x00280079, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0178, -3 }, { 0x00000000, 0 },
+    { 0x00670101, -1 }, { 0x00C400FB, -1 }, { 0x012100F5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB002C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002200C4, -1 },
+    { 0x004100C2, 1 }, { 0x0174003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0144, -1 },
+    { 0x0159013C, -1 }, { 0x00F6005C, -2 }, { 0x0178013A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB015D, -1 },
+    { 0x00572011, -1 }, { 0x005C00F2, -1 }, { 0x01320071, -1 }, { 0x01760153, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00790109, -1 }, { 0x013300FD, -1 }, { 0x014D201A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014A002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0071, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00FD, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0072, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0052016F, -1 }, { 0x014A015F, -1 }, { 0x012800EE, 1 },
+    { 0x01440079, -2 }, { 0x016600EA, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01450105, -1 }, { 0x01640103, -2 }, { 0x00C30027, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0162011C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF0059, -2 }, { 0x00DE0057, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00640177, -1 },
+    { 0x00C10171, -1 }, { 0x00DD00FC, -1 }, { 0x01542013, -1 }, { 0x015900F4, -1 },
+    { 0x017800F2, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0138010F, -1 }, { 0x0157010D, -1 }, { 0x0176010B, -2 },
+    { 0x00D5002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500DD, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260169, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D10061, -1 }, { 0x010F005D, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005600F5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00F20177, -1 }, { 0x010E0102, -1 }, { 0x01110175, -1 },
+    { 0x0166201B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004C0041, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x203A0158, -1 }, { 0x201800E7, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016400BB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F015B, -3 }, { 0x00000000, 0 }, { 0x016200D4, -1 }, { 0x00670071, -1 },
+    { 0x01210065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002D0174, -1 }, { 0x0044201E, -1 }, { 0x004C0172, -1 },
+    { 0x006800FD, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01592025, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FF0125, -1 }, { 0x015C011F, -1 }, { 0x00DA0041, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0142, -1 }, { 0x00DE0140, -1 },
+    { 0x00FD013E, -1 }, { 0x017600C3, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00220165, 1 }, { 0x0177014F, -1 },
+    { 0x00D900E6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BB0174, -1 },
+    { 0x00562026, -4 }, { 0x00D2201E, -1 }, { 0x00F1201C, -1 }, { 0x00F600FD, -1 },
+    { 0x0110201A, -1 }, { 0x012F2018, -1 }, { 0x0156016A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590120, -2 }, { 0x201E0054, -2 }, { 0x005600AD, -1 },
+    { 0x014B002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00760137, -1 }, { 0x0130012B, 1 },
+    { 0x005400C6, -3 }, { 0x01680041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014D0142, 1 }, { 0x010C00D3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A0110, -1 },
+    { 0x00000000, 0 }, { 0x002C2019, -1 }, { 0x00000000, 0 }, { 0x01640073, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019012B, 1 }, { 0x00000000, 0 }, { 0x002F0113, -3 }, { 0x0160201E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0106011E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01230135, 1 }, { 0x002800D2, -1 }, { 0x01420133, 1 }, { 0x00A10057, -1 },
+    { 0x00C00055, -2 }, { 0x00000000, 0 }, { 0x20130176, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD006C, 1 }, { 0x01590064, -1 }, { 0x01780062, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2016D, -1 }, { 0x00BF00FA, -1 },
+    { 0x00FD00F6, -1 }, { 0x01000169, -1 }, { 0x011F0167, 1 }, { 0x01362011, -1 },
+    { 0x013E0165, 1 }, { 0x017900EE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0022011D, -1 }, { 0x01722026, -1 }, { 0x01770107, -1 }, { 0x00F50029, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202600D9, -1 }, { 0x00BB012C, -1 }, { 0x01560122, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900D8, -2 },
+    { 0x017000C6, -2 }, { 0x00560065, -2 }, { 0x01100059, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00522010, -1 },
+    { 0x005700F1, -1 }, { 0x016E00DF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00EB201F, -1 }, { 0x00D10102, -1 }, { 0x010F00FE, 3 }, { 0x0129201B, 1 },
+    { 0x01482019, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x203A00C8, -1 }, { 0x00530123, -1 }, { 0x00720121, -1 },
+    { 0x20180057, 1 }, { 0x0145002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201900E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A016F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006B00E0, -1 }, { 0x002A0071, -1 }, { 0x010600D6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0170, -1 }, { 0x00642018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015E0076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0042002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0046012D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013900C3, 1 }, { 0x015800C1, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0155, -1 }, { 0x00DA00E2, -1 },
+    { 0x015600DA, -1 }, { 0x0159014D, -1 }, { 0x0178014B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00400178, -1 }, { 0x00D3201A, -1 },
+    { 0x00F22018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D0002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00580135, 1 }, { 0x00000000, 0 }, { 0x005500C2, -2 },
+    { 0x0052004F, -1 }, { 0x010C0043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056014E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016800E2, -1 }, { 0x00E90077, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0142201C, -1 }, { 0x20140041, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180140, 1 }, { 0x00000000, 0 }, { 0x01022039, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015E002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0162012D, 1 }, { 0x00C400C4, 1 }, { 0x010200C0, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004600E5, -1 }, { 0x00C200DD, -3 }, { 0x00BF006A, 1 },
+    { 0x00DE0068, -1 }, { 0x010000D9, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C30169, -1 }, { 0x00000000, 0 }, { 0x011D00F0, -1 },
+    { 0x01580079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD010D, -2 },
+    { 0x01590105, -1 }, { 0x01780103, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0176011C, -2 }, { 0x00000000, 0 }, { 0x0132003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01550137, -1 }, { 0x01740135, 2 }, { 0x00000000, 0 },
+    { 0x00570061, -2 }, { 0x00D30059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007700EB, -1 },
+    { 0x0055007A, -1 }, { 0x015000DD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00512025, -1 },
+    { 0x00560106, -1 }, { 0x00EC201B, -1 }, { 0x010B2019, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00C6, -4 }, { 0x0054011F, -2 }, { 0x20190053, -1 }, { 0x00000000, 0 },
+    { 0x0108002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0152, -1 },
+    { 0x00000000, 0 }, { 0x203900DD, -1 }, { 0x00000000, 0 }, { 0x004F00C5, -1 },
+    { 0x002D0054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201800F8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00AB0164, -1 }, { 0x002C00F9, -1 }, { 0x016200E5, -2 }, { 0x01020078, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01250175, -2 }, { 0x013C201F, -1 }, { 0x01410100, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0028012B, 1 },
+    { 0x00660127, 3 }, { 0x00000000, 0 }, { 0x0177002F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD00C5, -3 }, { 0x00BB0054, -1 }, { 0x017800BB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025201F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0153, -1 }, { 0x00FD014F, -1 }, { 0x017600D4, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410174, -3 }, { 0x0077201C, 1 }, { 0x01390164, -2 },
+    { 0x01580162, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D1002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01320123, -1 }, { 0x0170011F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D010A, -1 }, { 0x00D1015B, -1 }, { 0x00000000, 0 },
+    { 0x014A00E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0123, -1 }, { 0x00000000, 0 },
+    { 0x0105201C, -1 }, { 0x00EB00FF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019013C, 1 },
+    { 0x00000000, 0 }, { 0x00C52039, -1 }, { 0x20130056, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C500C0, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002800E3, -1 }, { 0x00C300D9, -2 }, { 0x01420144, 1 }, { 0x015B005C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD007D, 1 },
+    { 0x011B0079, -1 }, { 0x013A0077, -1 }, { 0x01780073, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF010B, -1 }, { 0x00F82026, -1 },
+    { 0x00FD0107, -1 }, { 0x0174201E, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BB013D, -1 }, { 0x00000000, 0 }, { 0x013400C2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0154014C, -1 }, { 0x005900E9, -2 }, { 0x007800E7, -1 },
+    { 0x00560076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0071201F, -1 }, { 0x00570102, -4 },
+    { 0x010C2015, -1 }, { 0x014A2011, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00C2, -4 },
+    { 0x201A004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E014E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20180068, 1 }, { 0x005000C1, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201900F4, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01430057, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50078, 1 }, { 0x00E40076, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00E80175, -1 }, { 0x00FF201F, 1 }, { 0x01040100, 1 }, { 0x014200FC, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01210117, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0159002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE00C1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2026201B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015800D2, -1 }, { 0x00D90067, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0059201A, -3 }, { 0x00782018, 1 }, { 0x017500E9, -1 },
+    { 0x01720076, -1 }, { 0x0178015C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB017F, -1 }, { 0x01540104, 1 },
+    { 0x01760175, -1 }, { 0x0056002E, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016C203A, -1 },
+    { 0x005A012D, 1 }, { 0x0133011F, -1 }, { 0x00540047, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D007A, -1 }, { 0x00000000, 0 }, { 0x016C00C1, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20192025, -2 },
+    { 0x201E0106, -1 }, { 0x0056015F, -2 }, { 0x00000000, 0 }, { 0x007200EA, -1 },
+    { 0x00500079, 1 }, { 0x006F0077, -1 }, { 0x0129006B, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C011F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0166010C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180151, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01260129, 1 }, { 0x004A00C4, -1 },
+    { 0x01450127, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0152, -1 }, { 0x004B0150, -1 },
+    { 0x01430140, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00412015, -1 }, { 0x004600F6, -1 }, { 0x011F00E8, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01200174, -1 }, { 0x00BB2026, -1 }, { 0x011D0101, -1 }, { 0x013C00FF, -1 },
+    { 0x0156201C, -2 }, { 0x0175201A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD011E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0172002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0176012D, 2 }, { 0x00D800C4, -1 }, { 0x00590059, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500FF, -3 },
+    { 0x01740146, -1 }, { 0x007900E3, -1 }, { 0x00D600DD, -1 }, { 0x00570072, -1 },
+    { 0x00760070, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0072201B, 1 }, { 0x005800FE, 1 }, { 0x0172015F, -1 },
+    { 0x016C0079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560117, -2 },
+    { 0x203A0049, -1 }, { 0x00000000, 0 }, { 0x006F002F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190064, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014700C6, -1 },
+    { 0x006B0061, -1 }, { 0x016600C4, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180109, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D00EF, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F017D, -1 },
+    { 0x002C010A, -1 }, { 0x004B0108, -1 }, { 0x00C2201F, -3 }, { 0x00E1201D, -1 },
+    { 0x0100201B, -3 }, { 0x011F2019, 1 }, { 0x016200F6, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002A0123, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00FD002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410054, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD00D6, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF0164, -1 }, { 0x00DB00EF, 1 }, { 0x00DE0162, -1 }, { 0x013800E9, -1 },
+    { 0x01540074, -1 }, { 0x015700E7, -1 }, { 0x017600E5, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00F32025, -1 }, { 0x01360102, 1 }, { 0x01390175, -1 },
+    { 0x0057002A, 1 }, { 0x01580173, -1 }, { 0x017400FE, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0129, 1 },
+    { 0x0134011B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590142, 1 }, { 0x011000C3, -1 }, { 0x201E0076, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F0102, -2 },
+    { 0x0057015B, -2 }, { 0x00000000, 0 }, { 0x005400E8, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D011B, -2 }, { 0x00000000, 0 }, { 0x01452010, -1 }, { 0x007100FF, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x203A0132, -1 }, { 0x201800C1, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E5002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019014D, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C00C2, 1 }, { 0x004B00C0, 1 },
+    { 0x01020041, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00E1005C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002800F4, -1 },
+    { 0x01420155, 1 }, { 0x00C00077, -2 }, { 0x00DF0075, -1 }, { 0x011D0071, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40176, -3 },
+    { 0x01020172, -2 }, { 0x0119201C, -1 }, { 0x01572018, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF011C, -1 }, { 0x00DE011A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D900C0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600FB, -1 }, { 0x00000000, 0 },
+    { 0x01750142, -1 }, { 0x00000000, 0 }, { 0x0077006C, -1 }, { 0x016F005C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C016D, -1 }, { 0x00542019, 1 }, { 0x005900FA, -1 }, { 0x007800F8, -1 },
+    { 0x00D80165, 1 }, { 0x012F0079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570113, -2 }, { 0x00760111, -1 },
+    { 0x016E0101, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00D3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010C00AD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180079, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0164004D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0178, 1 }, { 0x00000000, 0 },
+    { 0x20190105, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006A0076, -1 }, { 0x01430068, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006E0175, -2 }, { 0x004C0104, 1 },
+    { 0x00C3201B, -3 }, { 0x00E22019, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0164017E, -1 },
+    { 0x004A011D, -1 }, { 0x0123010F, -1 }, { 0x00000000, 0 }, { 0x00C0002F, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201000DD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046014F, -1 }, { 0x00BF00D4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x017700E1, -1 }, { 0x00000000, 0 }, { 0x00D90078, -1 }, { 0x00F80076, -1 },
+    { 0x0174006E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0177, -1 }, { 0x00DA0104, -2 }, { 0x00FC0175, -1 }, { 0x0113201F, -1 },
+    { 0x0151201B, -1 }, { 0x015600FC, -1 }, { 0x0178016D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014E002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0079013C, -1 },
+    { 0x00D300C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005500E4, -1 }, { 0x00000000, 0 }, { 0x014A0061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01082010, -1 }, { 0x005300FD, -1 }, { 0x012C00EF, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016B0177, -1 }, { 0x01680104, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0147011F, -1 }, { 0x0166011D, -2 }, { 0x00C50041, 1 }, { 0x00E4003F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180162, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280064, -1 },
+    { 0x01200054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0163, -1 }, { 0x0162014F, -2 }, { 0x004800EE, 1 },
+    { 0x00640079, -1 }, { 0x00FF006F, -1 }, { 0x012100E0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50172, -2 }, { 0x0141016A, -1 },
+    { 0x00460107, -1 }, { 0x00C200FF, -2 }, { 0x00E100FD, -1 }, { 0x010000FB, -1 },
+    { 0x01582014, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004100AD, -1 }, { 0x00F8002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01590127, -1 }, { 0x01780125, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01570140, -1 },
+    { 0x005C00DD, -2 }, { 0x0176013E, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D90161, -1 },
+    { 0x007900F4, -1 }, { 0x01740157, -1 }, { 0x00F20079, -1 }, { 0x01110077, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0077010D, -1 }, { 0x016F00FD, -1 }, { 0x201D0043, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012A2039, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201F015B, -1 }, { 0x00000000, 0 }, { 0x201C00E8, -1 }, { 0x00EF0137, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00AB0055, -1 }, { 0x0108004F, -1 },
+    { 0x00000000, 0 }, { 0x201D0174, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010C014E, -1 }, { 0x00000000, 0 }, { 0x016600D5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00500173, 1 }, { 0x002E0102, 1 }, { 0x0067201D, 1 },
+    { 0x01022013, -1 }, { 0x016400EE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201300C0, -1 }, { 0x004B0119, -1 },
+    { 0x01620107, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002700C1, -1 }, { 0x00000000, 0 }, { 0x00BF0044, -1 },
+    { 0x00DE0042, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0028014D, -1 }, { 0x00000000, 0 }, { 0x00220067, -1 },
+    { 0x01390055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00E7, -2 },
+    { 0x017800DD, 1 }, { 0x0175006A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00792025, -3 },
+    { 0x00BF0175, -1 }, { 0x00DB0100, -2 }, { 0x00F5201D, -1 }, { 0x015700F8, -1 },
+    { 0x017600F6, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01360113, -1 }, { 0x01550111, -1 }, { 0x0174010F, -2 },
+    { 0x0057003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800C7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590153, -2 },
+    { 0x005600E0, -2 }, { 0x0072006B, -1 }, { 0x00780151, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F0113, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00EF00EF, 1 }, { 0x00000000, 0 }, { 0x01490076, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014D0175, -1 }, { 0x010C0106, -1 }, { 0x014A0102, -1 },
+    { 0x0164201F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A0143, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0050012B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019015E, -1 }, { 0x00000000, 0 }, { 0x002F0146, -1 },
+    { 0x00000000, 0 }, { 0x002C00D3, -1 }, { 0x0067005C, -1 }, { 0x00C40056, -3 },
+    { 0x014300C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20140104, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014100DA, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0104016A, -2 }, { 0x00280105, -1 },
+    { 0x00660101, 1 }, { 0x00C300FB, -1 }, { 0x01592010, -1 }, { 0x017D00EF, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BB002E, -1 }, { 0x00DA002C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015A0123, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0177013A, -1 }, { 0x017400C7, -1 },
+    { 0x00790064, -1 }, { 0x00F5005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2026010C, -1 }, { 0x00DA015D, -1 }, { 0x00562011, -1 },
+    { 0x013400E4, -1 }, { 0x017200E0, -1 }, { 0x01750153, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D80176, -1 },
+    { 0x0059010B, -2 }, { 0x00780109, -1 }, { 0x010E201E, -1 }, { 0x011300FF, -1 },
+    { 0x012D201C, 1 }, { 0x014C201A, -1 }, { 0x0154016E, -1 }, { 0x016B2018, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0168002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00E4, -1 }, { 0x00D10135, 2 }, { 0x010F0131, 1 },
+    { 0x016C012B, 1 }, { 0x004F0057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0170, -1 }, { 0x00000000, 0 }, { 0x201B00FD, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00AD00DD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0168015D, -1 }, { 0x00682019, -1 }, { 0x00C52013, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B0113, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0046002F, -2 }, { 0x00C20027, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011E00C6, -1 }, { 0x015C00C2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF00E5, -1 }, { 0x00FD00E1, -1 },
+    { 0x013B00DD, -2 }, { 0x01570068, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00171, -1 }, { 0x00DF016F, -1 },
+    { 0x00F62019, -1 }, { 0x01342015, -1 }, { 0x017700F2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0178017E, -1 },
+    { 0x0137010F, -1 }, { 0x0175010B, -1 }, { 0x202600C4, 1 }, { 0x00D4002F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B0134, 2 }, { 0x005900C3, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250169, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0079014D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014C0059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016C00E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F10177, -2 }, { 0x0127201F, -1 }, { 0x0146201D, -1 }, { 0x0165201B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0043, -1 }, { 0x004B0041, 1 }, { 0x0162002F, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20150100, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004A00E6, -1 }, { 0x010400DA, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0174, -4 }, { 0x0062201C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002200C0, -1 }, { 0x00D90041, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0140, 1 }, { 0x00BB00CF, -1 }, { 0x015600C5, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01380153, -1 }, { 0x01570151, -1 },
+    { 0x0176014F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00552026, -1 },
+    { 0x00790105, -1 }, { 0x00D1201E, -1 }, { 0x00F0201C, -1 }, { 0x00F500FD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014A002A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005300C6, -1 },
+    { 0x010A0047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540152, -1 }, { 0x00000000, 0 },
+    { 0x005100DF, -1 }, { 0x002F006E, -1 }, { 0x004E006C, 1 }, { 0x0146005C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0052016B, -1 },
+    { 0x014A015B, -1 }, { 0x016600E6, -2 }, { 0x01250077, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018012B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01450101, -1 }, { 0x00000000, 0 },
+    { 0x00660029, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C70122, -1 }, { 0x00000000, 0 },
+    { 0x010200AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010000C4, 1 }, { 0x00BF0055, -1 }, { 0x00DE0053, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410076, -2 },
+    { 0x01770062, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C1016D, -1 }, { 0x00420102, -1 }, { 0x00DD00F8, -2 },
+    { 0x015900F0, -1 }, { 0x017800EE, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0138010B, -1 },
+    { 0x01570109, -1 }, { 0x01760107, -2 }, { 0x00F40029, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500D9, -1 },
+    { 0x01740120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260165, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800D8, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005600F1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EA201F, -1 },
+    { 0x0054010A, -1 }, { 0x00D00102, -1 }, { 0x0109201D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A0154, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0104004A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0157, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01210061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C016E, -1 },
+    { 0x0044201A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013E0078, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01420177, 1 }, { 0x015E0102, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FF0121, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF013E, -1 }, { 0x00DE013C, -1 }, { 0x00D80056, -1 }, { 0x00FD013A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D900E2, -1 }, { 0x017400D8, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D2201A, -1 }, { 0x00F12018, -1 },
+    { 0x013400F5, -1 }, { 0x01560166, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0059011C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570135, 2 }, { 0x016E0123, -1 }, { 0x005400C2, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00F5, -2 }, { 0x00000000, 0 }, { 0x010F0142, 3 }, { 0x005200DB, -1 },
+    { 0x0109005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B2013, -1 },
+    { 0x00000000, 0 }, { 0x00E80077, -1 }, { 0x0164006F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190127, 1 }, { 0x00000000, 0 },
+    { 0x002F010F, -3 }, { 0x012700FF, -2 }, { 0x0141201C, -1 }, { 0x014600FD, -2 },
+    { 0x0160201A, -1 }, { 0x20130041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500AB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0142012F, 1 },
+    { 0x00C300C4, 1 }, { 0x00440059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C100DD, -3 }, { 0x00DD0068, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C20169, -1 }, { 0x00BF00F6, -1 }, { 0x00FD00F2, -1 }, { 0x011F0163, 1 },
+    { 0x013E0161, 1 }, { 0x01760077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01342026, -1 }, { 0x01770103, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600D5, -1 }, { 0x00BB0128, -1 },
+    { 0x0156011E, -1 }, { 0x013400AD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01730135, 2 }, { 0x005900D4, -2 }, { 0x013200C6, -1 }, { 0x00560061, -2 },
+    { 0x00D20059, -1 }, { 0x017000C2, -2 }, { 0x00000000, 0 }, { 0x201D2026, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007600EB, -1 }, { 0x0054007A, -1 },
+    { 0x012D006C, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00502025, -3 }, { 0x00D100FE, 1 },
+    { 0x00EB201B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00C6, -4 },
+    { 0x0053011F, -1 }, { 0x0072011D, -1 }, { 0x203A00C4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F00C7, -1 }, { 0x002C0054, -2 },
+    { 0x004E00C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A016B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010600D2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E016C, -1 },
+    { 0x012300E9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE2025, -2 }, { 0x01020104, 1 }, { 0x01050177, -1 }, { 0x013B201F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460129, 1 }, { 0x011F011B, -1 },
+    { 0x00000000, 0 }, { 0x0176002F, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DF0138, -1 },
+    { 0x00DC00C5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0151, -2 }, { 0x015600D6, -1 }, { 0x00000000, 0 }, { 0x01340065, -1 },
+    { 0x01720061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0057201E, -4 }, { 0x005C00FF, -1 }, { 0x0076201C, 1 },
+    { 0x007B00FD, 1 }, { 0x0170007A, -1 }, { 0x01760160, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016C2025, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0065, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016A00C5, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0104201C, -3 },
+    { 0x00EA00FF, -1 }, { 0x01422018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018013C, 1 }, { 0x00000000, 0 },
+    { 0x00C42039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0124012D, 1 }, { 0x00C400C0, 1 },
+    { 0x0143012B, 2 }, { 0x01620129, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004600E1, -1 },
+    { 0x00C200D9, -2 }, { 0x00BF0066, -1 }, { 0x00FD0062, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01390077, -1 }, { 0x01580075, -1 },
+    { 0x01770073, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011E0178, -1 }, { 0x00DD0109, -2 }, { 0x01590101, -1 }, { 0x017800FF, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01360135, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260176, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007700E7, -1 }, { 0x00000000, 0 }, { 0x00550076, -1 },
+    { 0x010F006A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590175, -1 }, { 0x00560102, -4 }, { 0x0070201F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201F0135, 1 }, { 0x00000000, 0 }, { 0x016E017C, -1 }, { 0x0054011B, -2 },
+    { 0x2019004F, -1 }, { 0x201C00C2, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D014E, -1 }, { 0x00000000, 0 }, { 0x201A00DB, -1 },
+    { 0x203900D9, -1 }, { 0x004F00C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800F4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E00DC, -1 }, { 0x004A0067, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B00F3, -1 },
+    { 0x014300E3, -1 }, { 0x00C40078, 1 }, { 0x00E30076, -1 }, { 0x016200E1, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FE201F, -1 },
+    { 0x00C50104, 1 }, { 0x011D201D, 1 }, { 0x013C201B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD203A, -1 }, { 0x00660123, -1 }, { 0x00000000, 0 }, { 0x00220041, -1 },
+    { 0x0041003F, -2 }, { 0x0158002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00C1, -3 },
+    { 0x00000000, 0 }, { 0x00BB0050, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2025201B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF014F, -1 },
+    { 0x00000000, 0 }, { 0x005C006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410170, -2 },
+    { 0x00772018, 1 }, { 0x015500EB, -1 }, { 0x017400E9, -2 }, { 0x01710076, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DA017F, -1 }, { 0x01560177, -1 }, { 0x01720102, -2 },
+    { 0x0055002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059012D, 2 },
+    { 0x0132011F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570146, -1 },
+    { 0x00000000, 0 }, { 0x005400D3, -1 }, { 0x014C00C3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20182025, -2 }, { 0x201D0106, -1 },
+    { 0x0055015F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006E0077, -2 },
+    { 0x01660067, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B011F, -1 }, { 0x00000000, 0 }, { 0x01052018, -1 }, { 0x01432014, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0120, -1 },
+    { 0x0168017F, -1 }, { 0x00000000, 0 }, { 0x0121002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A00C6, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004700DD, -1 },
+    { 0x011D005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670167, 1 }, { 0x00000000, 0 },
+    { 0x00FF00EA, -1 }, { 0x00DD0079, -1 }, { 0x00FC0077, -1 }, { 0x01590071, -1 },
+    { 0x0178006F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000176, -3 },
+    { 0x0155201C, 1 }, { 0x00BF0107, -1 }, { 0x00FD0103, -1 }, { 0x013B00FF, -1 },
+    { 0x015A00FD, -1 }, { 0x0174201A, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BB0139, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201F201E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005900E5, -2 }, { 0x00D500DD, -1 }, { 0x00560072, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0052201D, -1 }, { 0x005700FE, 1 }, { 0x0071201B, -1 }, { 0x010C2011, -1 },
+    { 0x012D007D, 1 }, { 0x016B0079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016C0105, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180064, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900F0, -2 },
+    { 0x00000000, 0 }, { 0x002F00D8, -1 }, { 0x00000000, 0 }, { 0x004B0063, -1 },
+    { 0x01620051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01660150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1201F, -3 }, { 0x00E0201D, -1 },
+    { 0x00FF201B, 1 }, { 0x010400FC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01210113, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004300C7, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DF0149, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01740059, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DA00EF, 1 }, { 0x013700E9, -1 }, { 0x017500E5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F22025, -1 }, { 0x01190177, -1 }, { 0x01380175, -1 }, { 0x0056002A, 1 },
+    { 0x014F201F, -1 }, { 0x01540100, 1 }, { 0x01760171, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A0129, 1 }, { 0x00790127, -1 },
+    { 0x00540043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580142, 1 },
+    { 0x00770140, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0102, 1 }, { 0x0056015B, -2 },
+    { 0x00000000, 0 }, { 0x007200E6, -1 }, { 0x00500075, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C011B, -1 },
+    { 0x00000000, 0 }, { 0x01062014, -1 }, { 0x007000FF, -1 }, { 0x016800EF, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0134, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660108, -1 },
+    { 0x00000000, 0 }, { 0x00E4002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2018014D, -1 }, { 0x00000000, 0 }, { 0x002E0135, -1 },
+    { 0x01450123, -1 }, { 0x004A00C0, -1 }, { 0x0028004F, -1 }, { 0x01640121, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C014E, -1 }, { 0x004B014C, -1 }, { 0x00E60142, 1 }, { 0x00E0005C, -3 },
+    { 0x0143013C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00412011, -1 }, { 0x004600F2, -1 },
+    { 0x00BF0077, -1 }, { 0x00FD0073, -1 }, { 0x011F00E4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30176, -3 }, { 0x01562018, -2 },
+    { 0x00FE00FF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260056, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0134002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760129, 2 }, { 0x00D800C0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500FB, -1 }, { 0x00000000, 0 }, { 0x01740142, 1 },
+    { 0x00000000, 0 }, { 0x0057006E, -1 }, { 0x0076006C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0172015B, -1 },
+    { 0x005800FA, -1 }, { 0x007700F8, -1 }, { 0x014D0077, -1 }, { 0x201D002E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560113, -2 }, { 0x203A0045, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01662039, -1 }, { 0x00000000, 0 },
+    { 0x012A00AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D015F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012B0137, 2 },
+    { 0x014A0135, 2 }, { 0x014700C2, -1 }, { 0x016600C0, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B0178, 1 }, { 0x203A0176, -1 }, { 0x00000000, 0 },
+    { 0x010A0152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A0078, -1 },
+    { 0x00690076, -1 }, { 0x0123006A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F0179, -1 }, { 0x002C0106, -1 }, { 0x004B0104, 1 },
+    { 0x006D0175, -2 }, { 0x00C2201B, -3 }, { 0x00E12019, -1 }, { 0x016200F2, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201100C4, -1 }, { 0x002A011F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004400C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00D2, -2 }, { 0x00000000, 0 },
+    { 0x01560057, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE015E, -1 }, { 0x013800E5, -1 },
+    { 0x015700E3, -1 }, { 0x017600E1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC0177, -1 },
+    { 0x00D90104, -2 }, { 0x00FB0175, -1 }, { 0x0158016F, -1 }, { 0x017400FA, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01340117, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014D002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059013E, 1 }, { 0x00D200C3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A201D, -1 }, { 0x201F00FE, 1 }, { 0x00000000, 0 }, { 0x00570157, -1 },
+    { 0x005400E4, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0117, -2 }, { 0x00000000, 0 },
+    { 0x004D201C, -1 }, { 0x005200FD, -1 }, { 0x012B00EF, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A012E, -1 },
+    { 0x00000000, 0 }, { 0x01432025, -1 }, { 0x010A010A, -1 }, { 0x016A0177, -1 },
+    { 0x2015004A, -1 }, { 0x01230022, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C40041, 1 }, { 0x00E3003F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014100C5, 1 }, { 0x01000056, -3 }, { 0x016000C3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01230153, -1 }, { 0x002800F0, -1 }, { 0x006600EC, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C40172, -2 }, { 0x0102016E, -2 }, { 0x00C100FF, -2 },
+    { 0x00E000FD, -1 }, { 0x01192018, -1 }, { 0x01572014, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00430120, -1 },
+    { 0x00BF0118, -1 }, { 0x00DE0116, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01770125, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BB014A, -1 }, { 0x0175013E, -1 }, { 0x00000000, 0 },
+    { 0x00770068, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0169, -1 }, { 0x00542015, -1 },
+    { 0x005900F6, -2 }, { 0x007800F4, -1 }, { 0x00F10079, -2 }, { 0x013200E8, -1 },
+    { 0x017000E4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0057010F, -2 }, { 0x0076010D, -1 }, { 0x014A201E, -1 }, { 0x00510029, 1 },
+    { 0x014F00FF, -1 }, { 0x0169201C, -1 }, { 0x016E00FD, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B00E8, -1 }, { 0x00EE0137, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0174, 1 }, { 0x00000000, 0 }, { 0x20190101, -1 }, { 0x00000000, 0 },
+    { 0x002F00E9, -3 }, { 0x00000000, 0 }, { 0x002C0076, -3 }, { 0x004B0074, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0066201D, 3 }, { 0x002D0102, -1 }, { 0x004C0100, 1 }, { 0x01660161, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0164017A, -1 }, { 0x004A0119, -1 }, { 0x0123010B, -1 },
+    { 0x015C2026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004300D8, -1 }, { 0x00BF00D0, -1 }, { 0x00DE00CE, -1 },
+    { 0x015A00C6, -1 }, { 0x01760051, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0155006C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0173, -1 }, { 0x00BB0102, -1 },
+    { 0x00DA0100, -2 }, { 0x00F4201D, -1 }, { 0x0113201B, -1 }, { 0x017500F6, -1 },
+    { 0x01780169, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0121, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056003B, -1 },
+    { 0x0110002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700C7, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00770151, -1 }, { 0x005500E0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00EE00EF, 1 }, { 0x00000000, 0 }, { 0x01480076, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01680100, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660119, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010400C5, 1 }, { 0x0066005C, 3 }, { 0x00C30056, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20130104, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006700E8, -1 }, { 0x00FF006B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002A0178, 1 }, { 0x00C5016E, -2 }, { 0x00460103, -1 }, { 0x00C200FB, -1 },
+    { 0x011F00F5, -1 }, { 0x01410166, -2 }, { 0x01582010, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D9002C, -1 }, { 0x00F8002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD012B, 2 }, { 0x01590123, -1 }, { 0x01780121, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0157013C, -1 }, { 0x005C00D9, -1 }, { 0x00780064, -1 },
+    { 0x00F4005C, -2 }, { 0x0176013A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2025010C, -1 }, { 0x00D9015D, -1 }, { 0x01740153, -2 }, { 0x007900F0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00770109, -1 },
+    { 0x013100FD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A0056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190071, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E0057, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A00FD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0050016F, 1 },
+    { 0x00672019, 1 }, { 0x00C42013, -1 }, { 0x012600EE, 1 }, { 0x01420079, 1 },
+    { 0x016400EA, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B0115, -1 }, { 0x01430105, -1 }, { 0x01620103, -2 },
+    { 0x00C10027, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0158004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD00E3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00620177, -1 }, { 0x00BF0171, -1 }, { 0x00F52019, -1 },
+    { 0x013800F6, -1 }, { 0x015700F4, -1 }, { 0x017600F2, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500C4, 1 }, { 0x0136010F, -1 },
+    { 0x0155010D, -1 }, { 0x0174010B, -2 }, { 0x00D3002F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0059014F, -2 }, { 0x0078014D, -1 }, { 0x00720067, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201F010F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005400F5, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F00177, -1 },
+    { 0x010F0175, 1 }, { 0x014A00FE, 1 }, { 0x0164201B, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A013F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A0041, -1 },
+    { 0x0161002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019015A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0140, 1 }, { 0x016200BB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20140100, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002A00E8, -1 }, { 0x00460073, -1 }, { 0x011F0065, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0042201E, -1 }, { 0x00280101, -1 }, { 0x0061201C, -1 }, { 0x00DD2014, -1 },
+    { 0x01040166, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01572025, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0127, -1 },
+    { 0x00FD0125, -1 }, { 0x00D80041, -1 }, { 0x015A011F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013600C7, -1 }, { 0x017400C3, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260108, -1 },
+    { 0x00000000, 0 }, { 0x01370153, -1 }, { 0x005B00EE, 1 }, { 0x013400E0, -1 },
+    { 0x0175014F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B0178, 1 }, { 0x00542026, -3 }, { 0x00590107, -2 },
+    { 0x00D0201E, -1 }, { 0x00EF201C, 1 }, { 0x00F400FD, -1 }, { 0x010E201A, -1 },
+    { 0x012D2018, 1 }, { 0x0154016A, -1 }, { 0x00000000, 0 }, { 0x00570120, -1 },
+    { 0x201C0054, 1 }, { 0x005400AD, -1 }, { 0x0149002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00E0, -1 },
+    { 0x00000000, 0 }, { 0x012E012B, 1 }, { 0x005200C6, 1 }, { 0x01660041, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E016C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010A00D3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F00FA, -1 },
+    { 0x00000000, 0 }, { 0x01050079, -1 }, { 0x01620073, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01470174, 1 },
+    { 0x006B010F, -1 }, { 0x015E201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01210135, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0053, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20110176, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF00E1, -1 }, { 0x013B00D9, -1 }, { 0x01570064, -1 }, { 0x01760062, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C0016D, -1 }, { 0x00220104, -1 }, { 0x00410102, 1 }, { 0x00DF016B, -1 },
+    { 0x011D0167, 1 }, { 0x01342011, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0178017A, -1 }, { 0x0137010B, -1 }, { 0x01702026, -1 },
+    { 0x01750107, -1 }, { 0x00F30029, -1 }, { 0x202600C0, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01540122, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250165, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700D8, -1 }, { 0x016E00C6, -2 }, { 0x00540065, -2 },
+    { 0x010E0059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016C00DF, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E9201F, -1 }, { 0x0127201B, -1 },
+    { 0x01462019, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0143002D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A0058, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A00E2, -1 },
+    { 0x00280071, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0170, -1 }, { 0x00622018, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015C0076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01410177, -1 }, { 0x01600175, -1 }, { 0x0177201F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD013C, 1 },
+    { 0x00BB00CB, -1 }, { 0x007A005C, -1 }, { 0x015600C1, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0138014F, -1 }, { 0x005C00EA, -1 }, { 0x00590077, -1 }, { 0x015400DA, -1 },
+    { 0x0157014D, -1 }, { 0x0176014B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D1201A, -1 }, { 0x00790101, -1 }, { 0x00F02018, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058011C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00DC, -1 }, { 0x00560135, 2 },
+    { 0x00000000, 0 }, { 0x005300C2, -1 }, { 0x010A0043, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00F5, -1 },
+    { 0x0054014E, -1 }, { 0x012D0140, 2 }, { 0x00000000, 0 }, { 0x004E0068, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00520167, -1 }, { 0x004A2013, -1 }, { 0x014700E4, -1 },
+    { 0x016600E2, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20180127, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C7011E, -1 }, { 0x01002039, -1 }, { 0x00C400AB, -1 }, { 0x015C002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C200C4, 1 },
+    { 0x00BF0051, -1 }, { 0x010000C0, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C000DD, -3 }, { 0x00220074, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10169, -1 },
+    { 0x00DD00F4, -2 }, { 0x00FF0165, 1 }, { 0x01560079, -1 }, { 0x017800EA, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01380107, -1 }, { 0x01570105, -1 },
+    { 0x0059002F, -3 }, { 0x01760103, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500D5, -1 }, { 0x01360120, -1 }, { 0x0174011C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01720135, 1 },
+    { 0x005800D4, -1 }, { 0x015000C4, -1 }, { 0x00550061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C2026, -2 }, { 0x00000000, 0 },
+    { 0x00590160, -1 }, { 0x00000000, 0 }, { 0x014E00DD, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004F2025, -1 }, { 0x00540106, -1 }, { 0x00CB201D, 1 },
+    { 0x00EA201B, -1 }, { 0x01092019, 1 }, { 0x01472015, -1 }, { 0x01662013, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0106002D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E00C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F0153, -3 }, { 0x00C700D6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C016A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01000078, 1 }, { 0x013E0074, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD2025, -3 },
+    { 0x01040177, -2 }, { 0x013A201F, -1 }, { 0x0041002A, -3 }, { 0x01420173, 1 },
+    { 0x0159201D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FF011D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0175002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF013A, -1 }, { 0x00DB00C5, -2 },
+    { 0x017600BB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013600D8, -1 }, { 0x00790071, -1 }, { 0x017400D4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0056201E, -4 }, { 0x005B00FF, 1 }, { 0x0075201C, -1 }, { 0x01560162, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E011F, -1 },
+    { 0x201C0065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D10142, 1 }, { 0x010F013E, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00720161, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190123, -2 }, { 0x00000000, 0 }, { 0x002F010B, -3 }, { 0x00E900FF, -1 },
+    { 0x0103201C, -1 }, { 0x01412018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C32039, -1 },
+    { 0x20110056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C300C0, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C100D9, -2 },
+    { 0x00DD0064, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF00F2, -1 }, { 0x01190079, -1 }, { 0x01380077, -1 }, { 0x01760073, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F62026, -1 }, { 0x0172201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BB0124, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013200C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250176, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700E9, -2 }, { 0x007600E7, -1 }, { 0x00EF006C, 2 }, { 0x012D0068, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580175, -1 }, { 0x00550102, -2 }, { 0x006F201F, -1 }, { 0x010A2015, -1 },
+    { 0x01500165, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0135, -1 },
+    { 0x00000000, 0 }, { 0x201B00C2, -2 }, { 0x00720119, -1 }, { 0x203A00C0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00510134, 3 },
+    { 0x002F00C3, -3 }, { 0x004E00C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0167, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004C00DA, -1 }, { 0x00000000, 0 }, { 0x01220059, -1 },
+    { 0x01410057, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0168, -1 }, { 0x004A00F3, -1 }, { 0x004D0166, -1 },
+    { 0x00C30078, 1 }, { 0x00E20076, -1 }, { 0x012300E5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E60175, -1 }, { 0x00C40104, 1 },
+    { 0x00FD201F, 1 }, { 0x01020100, 1 }, { 0x013B201B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC203A, -1 },
+    { 0x011F0117, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0157002D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC00C1, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD014D, -2 }, { 0x015600D2, -1 },
+    { 0x00000000, 0 }, { 0x01340061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057201A, -4 },
+    { 0x005C00FB, -1 }, { 0x00762018, 1 }, { 0x01510078, -1 }, { 0x01700076, -1 },
+    { 0x0176015C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D9017F, -1 }, { 0x01740175, -1 }, { 0x00000000, 0 }, { 0x0054002E, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016A203A, -1 }, { 0x0058012D, 1 }, { 0x201D0061, -1 },
+    { 0x00520047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560146, -1 }, { 0x00000000, 0 },
+    { 0x016A00C1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054015F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006D0077, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00520178, -2 }, { 0x01042018, -3 }, { 0x016600F3, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201500C5, -1 }, { 0x002E0120, -1 }, { 0x0164010C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01240129, 1 }, { 0x01430127, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0062, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011D00E8, -1 },
+    { 0x00DC0079, -1 }, { 0x00FB0077, -1 }, { 0x0177006F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011E0174, -1 }, { 0x0154201C, -2 },
+    { 0x00DD0105, -2 }, { 0x013A00FF, -1 }, { 0x017800FB, -1 }, { 0x20260041, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0170002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0174012D, 2 }, { 0x00D600C4, -1 },
+    { 0x00570059, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260172, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007700E3, -1 },
+    { 0x00D400DD, -1 }, { 0x010F0066, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590171, -1 },
+    { 0x005600FE, 1 }, { 0x0070201B, -1 }, { 0x016A0079, -1 }, { 0x0170015F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540117, -2 }, { 0x01472026, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014700AD, -1 }, { 0x016600AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800F0, -1 }, { 0x00000000, 0 },
+    { 0x002E00D8, -1 }, { 0x014500C6, -1 }, { 0x004A0063, -1 }, { 0x01040057, -3 },
+    { 0x016400C4, -4 }, { 0x2019017C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B00EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C0201F, -3 }, { 0x00C50100, 1 }, { 0x00DF201D, -1 },
+    { 0x00FE201B, -1 }, { 0x011D2019, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BB004C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF014B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041016C, -2 }, { 0x00D900EF, 1 },
+    { 0x013600E9, -1 }, { 0x01330076, -1 }, { 0x015500E7, -1 }, { 0x017400E5, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01370175, -1 },
+    { 0x01340102, -1 }, { 0x01560173, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590129, 2 }, { 0x0132011B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201F00E9, -1 }, { 0x00000000, 0 }, { 0x00570142, 1 }, { 0x00760140, -1 },
+    { 0x0051005C, -1 }, { 0x010E00C3, -1 }, { 0x201C0076, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0102, -4 }, { 0x0055015B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660063, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B011B, -1 }, { 0x00000000, 0 },
+    { 0x01432010, -1 }, { 0x006F00FF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00492039, -1 }, { 0x002F011C, -1 }, { 0x00000000, 0 },
+    { 0x00E3002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002A00C2, -2 }, { 0x0046004D, -1 }, { 0x01000041, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20150166, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DF005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00670163, 1 }, { 0x00000000, 0 }, { 0x00FF00E6, -1 }, { 0x00DD0075, -1 },
+    { 0x0178006B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0046017E, -1 }, { 0x00C20176, -3 }, { 0x00BF0103, -1 },
+    { 0x00F8201E, -1 }, { 0x01000172, -2 }, { 0x0117201C, -1 }, { 0x01552018, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250056, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F201A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900E1, -2 }, { 0x00000000, 0 },
+    { 0x0056006E, -1 }, { 0x016D005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D60165, 1 }, { 0x00522019, -1 },
+    { 0x005700FA, -1 }, { 0x007600F8, -1 }, { 0x00EF007D, 1 }, { 0x201C002E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01500176, -1 },
+    { 0x201A0047, -1 }, { 0x016C0101, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A00D1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010A00AD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C015F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F00D4, -1 },
+    { 0x00000000, 0 }, { 0x0162004D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0178, -3 }, { 0x20390176, -1 }, { 0x00000000, 0 }, { 0x0166014C, -1 },
+    { 0x006B00E9, -1 }, { 0x00000000, 0 }, { 0x00680076, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006C0175, -1 }, { 0x004A0104, -1 }, { 0x00C1201B, -3 }, { 0x00E02019, -1 },
+    { 0x012300F6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0162017E, -1 }, { 0x0067011B, -1 }, { 0x0121010F, -1 },
+    { 0x201000C4, -1 }, { 0x00DD002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004100DC, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD015E, -1 }, { 0x013700E5, -1 }, { 0x017500E1, -1 },
+    { 0x00F60076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0177, -1 }, { 0x005C010C, -1 },
+    { 0x00D80104, -1 }, { 0x00FA0175, -1 }, { 0x013500FE, 1 }, { 0x014F201B, -1 },
+    { 0x015400FC, -1 }, { 0x0176016D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00790123, -1 }, { 0x201F0059, 1 }, { 0x00000000, 0 }, { 0x014C002F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0058013E, 1 }, { 0x0077013C, -1 }, { 0x00520058, 1 },
+    { 0x00D100C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560157, -1 }, { 0x007200E2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0117, -1 }, { 0x00000000, 0 }, { 0x004C201C, -1 },
+    { 0x005100FD, 1 }, { 0x01062010, -1 }, { 0x012A00EF, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01690177, -1 }, { 0x01660104, -4 }, { 0x2014004A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0145011F, -1 }, { 0x0164011D, -2 },
+    { 0x00C30041, 1 }, { 0x00E2003F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011E0054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004600EE, 1 }, { 0x00620079, -1 }, { 0x00BF0073, -1 },
+    { 0x00FD006F, -1 }, { 0x011F00E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C30172, -2 }, { 0x00BB201E, -1 }, { 0x00C000FF, -2 }, { 0x00DF00FD, -1 },
+    { 0x01562014, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0178010C, -2 },
+    { 0x00000000, 0 }, { 0x00F6002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01570127, -1 }, { 0x01760125, 1 }, { 0x00590051, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01550140, -1 }, { 0x0174013E, 1 }, { 0x00760068, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00722013, -1 }, { 0x007700F4, -1 },
+    { 0x00F00079, -1 }, { 0x010F0077, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056010F, -2 },
+    { 0x016D00FD, -1 }, { 0x203A0041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F0142, 1 }, { 0x00000000, 0 },
+    { 0x01282039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D015B, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0106004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0174, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010A014E, -1 }, { 0x00000000, 0 },
+    { 0x016400D5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0175, -1 },
+    { 0x002C0102, 1 }, { 0x0046201F, 1 }, { 0x004B0100, 1 }, { 0x01002013, -1 },
+    { 0x016200EE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201100C0, -1 }, { 0x002A011B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE0029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280134, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x017800C4, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE015A, -1 }, { 0x013800E1, -1 }, { 0x017600DD, 1 }, { 0x00D80074, 1 },
+    { 0x0173006A, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00772025, -3 }, { 0x00D90100, -2 }, { 0x00F3201D, -1 },
+    { 0x013600FA, -1 }, { 0x015500F8, -1 }, { 0x0158016B, -1 }, { 0x017400F6, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01340113, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0059013A, 1 }, { 0x005600C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A2019, -1 },
+    { 0x00000000, 0 }, { 0x00570153, -2 }, { 0x005400E0, -2 }, { 0x00760151, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0113, -2 }, { 0x00000000, 0 }, { 0x004D2018, -1 }, { 0x005200F9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x203A012A, -1 }, { 0x00000000, 0 }, { 0x014B0175, -2 },
+    { 0x010A0106, -1 }, { 0x0162201F, 1 }, { 0x004A002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F012D, 1 }, { 0x004E012B, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014100C1, 1 },
+    { 0x0065005C, -1 }, { 0x00C20056, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0123014F, -1 },
+    { 0x00000000, 0 }, { 0x00DF006D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C4016E, -2 },
+    { 0x0102016A, -2 }, { 0x00C100FB, -1 }, { 0x01572010, -1 }, { 0x017B00EF, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0043011C, -1 }, { 0x00BF0114, -1 },
+    { 0x00D8002C, -1 }, { 0x00DE0112, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC012B, 1 },
+    { 0x01770121, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0175013A, -1 }, { 0x00000000, 0 }, { 0x00770064, -1 }, { 0x00F3005C, -2 },
+    { 0x01500056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0165, -1 }, { 0x00542011, -1 }, { 0x005900F2, -2 }, { 0x007800F0, -1 },
+    { 0x013200E4, -1 }, { 0x017000E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D60176, -1 }, { 0x0057010B, -2 }, { 0x00760109, -1 },
+    { 0x011100FF, -1 }, { 0x012B201C, 1 }, { 0x014A201A, -1 }, { 0x01692018, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20390056, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0147002E, -1 }, { 0x0166002C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180071, -1 }, { 0x016A012B, 1 }, { 0x00AD00C4, -1 }, { 0x002E0059, -3 },
+    { 0x004D0057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F00E5, -3 }, { 0x004E00E3, -1 },
+    { 0x00AB00DD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0147015F, -1 }, { 0x00662019, 3 },
+    { 0x00C32013, -1 }, { 0x01410079, -1 }, { 0x01600077, -1 }, { 0x0166015D, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004A0115, -1 }, { 0x01230107, -1 }, { 0x00000000, 0 }, { 0x0044002F, -1 },
+    { 0x00C00027, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013E0137, 3 }, { 0x004300D4, -1 },
+    { 0x00BF00CC, -1 }, { 0x00DE00CA, -1 }, { 0x011C00C6, -1 }, { 0x013B00C4, 1 },
+    { 0x015A00C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DC00E3, -1 }, { 0x013900DD, -2 }, { 0x01550068, -1 }, { 0x015800DB, -1 },
+    { 0x01740066, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00610177, -1 }, { 0x00DD016F, -1 }, { 0x00F42019, -1 }, { 0x01322015, -1 },
+    { 0x013700F6, -1 }, { 0x017500F2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0176017E, -1 }, { 0x005C011D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D2002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700C3, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0077014D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004E2014, -1 }, { 0x007200F3, -1 }, { 0x016A00E3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0125201F, -1 }, { 0x0144201D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01660115, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0160002F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010400C1, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20130100, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006700E4, -1 },
+    { 0x00FF0067, -1 }, { 0x010200DA, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A0174, 1 }, { 0x00C5016A, -2 },
+    { 0x006500FD, -1 }, { 0x01220164, -1 }, { 0x01410162, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0127, 1 }, { 0x0159011F, -1 },
+    { 0x0178011D, -3 }, { 0x0134003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C00D5, -1 }, { 0x00590062, 1 }, { 0x015400C5, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250108, -1 }, { 0x00000000, 0 },
+    { 0x01360153, -1 }, { 0x005A00EE, 1 }, { 0x01550151, -1 }, { 0x0174014F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00532026, -1 }, { 0x00770105, -1 }, { 0x00EE201C, 1 },
+    { 0x00F300FD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E00C7, -1 }, { 0x00560120, -1 }, { 0x201B0054, 1 },
+    { 0x203A0052, -1 }, { 0x0148002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201F0153, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x012D012B, 1 }, { 0x005100C6, -2 }, { 0x01080047, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A00F9, -1 },
+    { 0x00520152, -1 }, { 0x014A0142, 1 }, { 0x004F00DF, -1 }, { 0x0144005C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0050016B, 1 }, { 0x002E00FA, -1 }, { 0x016400E6, -2 },
+    { 0x01040079, -2 }, { 0x01420075, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0111, -1 },
+    { 0x01430101, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010000AB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20100176, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x017800D5, -2 }, { 0x01750062, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0079201D, 1 },
+    { 0x00BF016D, -1 }, { 0x013800F2, -1 }, { 0x015700F0, -1 }, { 0x017600EE, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202500C0, 1 }, { 0x0136010B, -1 }, { 0x01550109, -1 }, { 0x01740107, -2 },
+    { 0x00F20029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026014C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059014B, -1 },
+    { 0x005600D8, -1 }, { 0x00000000, 0 }, { 0x00720063, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F010B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00E8201F, -1 }, { 0x0052010A, -1 }, { 0x0107201D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A013B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00500123, -1 },
+    { 0x20150057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E013C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006B0153, -1 }, { 0x00C500DA, -2 }, { 0x0046006F, -1 },
+    { 0x011F0061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0042201A, -1 }, { 0x002800FD, 1 },
+    { 0x00612018, -1 }, { 0x00DD2010, -1 }, { 0x01040162, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015C0102, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0125, -1 }, { 0x00DE0123, -1 }, { 0x00FD0121, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013600C3, 1 },
+    { 0x00D60056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260104, 1 }, { 0x00000000, 0 }, { 0x0137014F, -1 },
+    { 0x00000000, 0 }, { 0x00580077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0176, -2 },
+    { 0x007B0174, 1 }, { 0x00590103, -1 }, { 0x00D0201A, -1 }, { 0x00EF2018, 1 },
+    { 0x013200F5, -1 }, { 0x01540166, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201F00C3, -2 }, { 0x00000000, 0 }, { 0x0057011C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550135, 1 }, { 0x00D1012D, 2 },
+    { 0x005200C2, 1 }, { 0x016C0123, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0168, -1 }, { 0x201B00F5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0107005C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00510167, 1 }, { 0x002F00F6, -3 }, { 0x00000000, 0 }, { 0x00E60077, -1 },
+    { 0x0162006F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B010B, -1 }, { 0x012500FF, -2 },
+    { 0x014400FD, -2 }, { 0x015E201A, -1 }, { 0x20110041, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C300AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C100C4, 1 }, { 0x00420059, -1 },
+    { 0x00DD004F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF00DD, -2 },
+    { 0x00DE00DB, -1 }, { 0x01380062, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00169, -1 }, { 0x00220100, -1 },
+    { 0x011D0163, 1 }, { 0x01740077, -1 }, { 0x017700EA, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01780176, 1 },
+    { 0x01322026, -1 }, { 0x01370107, -1 }, { 0x01750103, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0154011E, -1 }, { 0x005900BB, -1 }, { 0x013200AD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700D4, -1 },
+    { 0x016E00C2, -2 }, { 0x00540061, -2 }, { 0x00D00059, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B2026, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D100E5, -1 }, { 0x00000000, 0 }, { 0x012B006C, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0120, -1 }, { 0x00000000, 0 },
+    { 0x004E2025, -1 }, { 0x00750177, -1 }, { 0x00CA201D, 1 }, { 0x00E9201B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201900C6, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C00C5, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00660069, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C016C, -1 }, { 0x006700F5, -1 }, { 0x012100E9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC2025, -1 }, { 0x01000104, 1 },
+    { 0x01030177, -1 }, { 0x0139201F, -1 }, { 0x0158201D, -1 }, { 0x0177201B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011D011B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0174002F, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0138, -1 }, { 0x00DA00C5, -2 }, { 0x20260074, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015400D6, -1 },
+    { 0x00590073, -2 }, { 0x00780071, -1 }, { 0x01320065, -1 }, { 0x01700061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0055201E, -1 },
+    { 0x01740160, -1 }, { 0x016E007A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016A2025, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E00D8, -1 }, { 0x00000000, 0 }, { 0x201B0065, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201F0164, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EF0140, 2 },
+    { 0x012D013C, 2 }, { 0x002F0066, -1 }, { 0x016800C5, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A010A, -1 }, { 0x00520163, -1 },
+    { 0x00000000, 0 }, { 0x014700E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180123, -1 },
+    { 0x00AD0176, -1 }, { 0x0102201C, -3 }, { 0x00E800FF, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0122, -1 }, { 0x00C22039, -1 },
+    { 0x20100056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C200C0, 1 }, { 0x00DE004B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C000D9, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FF0161, -1 }, { 0x00000000, 0 }, { 0x00DD00F0, -2 },
+    { 0x01370077, -1 }, { 0x01560075, -1 }, { 0x015900E8, -1 }, { 0x01750073, -1 },
+    { 0x017800E6, -2 }, { 0x00000000, 0 }, { 0x00BF017E, -1 }, { 0x00F52026, -1 },
+    { 0x011C0178, -1 }, { 0x01380103, -1 }, { 0x013B0176, -2 }, { 0x01570101, -1 },
+    { 0x017600FF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0136011C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015000C0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059015C, -1 }, { 0x005600E9, -2 },
+    { 0x011000DD, -1 }, { 0x00530076, -1 }, { 0x00EE006C, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570175, -1 },
+    { 0x00540102, -4 }, { 0x006E201F, -1 }, { 0x00CB2019, 1 }, { 0x01472011, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0135, 1 }, { 0x00000000, 0 },
+    { 0x016C017C, -1 }, { 0x201A00C2, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E00C3, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F014F, -3 },
+    { 0x002C00DC, -1 }, { 0x00C700D2, -1 }, { 0x00670065, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C0166, -2 }, { 0x002A00F5, -1 }, { 0x00000000, 0 }, { 0x00C20078, 1 },
+    { 0x00E10076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00E50175, -1 }, { 0x00C30104, 1 }, { 0x00FC201F, -1 },
+    { 0x01040173, -1 }, { 0x013A201B, -1 }, { 0x0142016F, 1 }, { 0x01592019, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB203A, -1 }, { 0x00FF0119, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0156002D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF0136, -1 }, { 0x00DB00C1, -2 }, { 0x005C0056, -3 }, { 0x00DE0134, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013600D4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056201A, -4 }, { 0x00752018, -1 },
+    { 0x00000000, 0 }, { 0x016F0076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D8017F, -1 },
+    { 0x01540177, -1 }, { 0x01700102, -2 }, { 0x0053002E, -1 }, { 0x0072002C, -2 },
+    { 0x01730175, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0057012D, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D1013E, 1 }, { 0x005200D3, -1 },
+    { 0x010C00C7, -1 }, { 0x010F013A, 3 }, { 0x014A00C3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x203A0104, -1 }, { 0x0072015D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006C0077, -1 }, { 0x01640067, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019011F, -2 }, { 0x00510178, -1 },
+    { 0x00C5201C, -3 }, { 0x002F0107, -3 }, { 0x004E0105, -1 }, { 0x01032018, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201400C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004900AB, -1 },
+    { 0x011F002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011B005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013E0159, 1 }, { 0x00000000, 0 }, { 0x00FD00EA, -1 }, { 0x00DB0079, -1 },
+    { 0x00FA0077, -1 }, { 0x01570071, -1 }, { 0x0176006F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0134201E, -1 }, { 0x00DC0105, -1 },
+    { 0x013900FF, -1 }, { 0x0153201C, -1 }, { 0x015800FD, -1 }, { 0x0172201A, -1 },
+    { 0x20250041, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D500C4, -1 }, { 0x00560059, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250172, -1 }, { 0x201D201E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700E5, -2 }, { 0x007600E3, -1 },
+    { 0x00D300DD, -1 }, { 0x00EF0068, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0050201D, 1 }, { 0x00580171, -1 },
+    { 0x006F201B, -1 }, { 0x010A2011, -1 }, { 0x012B007D, 1 }, { 0x01690079, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00720115, -1 }, { 0x016A0105, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0163, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002A0065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0164, -2 },
+    { 0x004A00EF, 1 }, { 0x004D0162, -1 }, { 0x012300E1, -1 }, { 0x01640150, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00622025, -1 }, { 0x00C40100, 1 }, { 0x00FD201B, 1 }, { 0x010200FC, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00270123, -1 }, { 0x00460121, -1 },
+    { 0x011F0113, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00A10134, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0149, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F02025, -1 }, { 0x01170177, -1 },
+    { 0x01360175, -2 }, { 0x014D201F, -1 }, { 0x01740171, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580129, 1 }, { 0x00770127, -1 }, { 0x00520043, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560142, 1 }, { 0x201B0076, 1 }, { 0x00AD0056, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F0175, 1 },
+    { 0x201C0102, -2 }, { 0x0054015B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F0077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520174, -2 }, { 0x01042014, -1 },
+    { 0x006E00FF, -2 }, { 0x016600EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201500C1, -1 },
+    { 0x00482039, -1 }, { 0x002E011C, -1 }, { 0x01640108, -1 }, { 0x00E2002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0135, -1 }, { 0x01430123, -1 }, { 0x01620121, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20140166, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE005C, -2 }, { 0x013B0056, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011D00E4, -1 }, { 0x0177006B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10176, -3 }, { 0x01542018, -2 }, { 0x00DD0101, -1 }, { 0x00FC00FF, -1 },
+    { 0x011B00FD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0132002E, -1 }, { 0x0151002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0136012D, 1 }, { 0x00D600C0, -1 }, { 0x01740129, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2026016E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010F0062, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0059016D, -1 }, { 0x005600FA, -1 }, { 0x00D50165, 1 },
+    { 0x00EE007D, 1 }, { 0x014B0077, -2 }, { 0x0170015B, -1 }, { 0x201B002E, -2 },
+    { 0x203A002C, -1 }, { 0x201F012D, 1 }, { 0x00000000, 0 }, { 0x00540113, -2 },
+    { 0x20190047, -1 }, { 0x00000000, 0 }, { 0x004E002D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A00D3, -1 },
+    { 0x010C0120, -1 }, { 0x01642039, -1 }, { 0x012800AB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B015F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01290137, 2 }, { 0x002E00D4, -1 }, { 0x014500C2, -1 },
+    { 0x016400C0, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190178, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0160, -1 }, { 0x004B00EB, -1 },
+    { 0x01080152, -1 }, { 0x0121006A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0177, -1 },
+    { 0x006B0175, -1 }, { 0x00C0201B, -3 }, { 0x00C500FC, -1 }, { 0x00DF2019, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004200C3, -1 },
+    { 0x00000000, 0 }, { 0x00BB0048, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0147, -1 },
+    { 0x00DE0145, -1 }, { 0x005C0067, 1 }, { 0x01540057, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410168, -2 }, { 0x015500E3, -1 }, { 0x017400E1, -2 }, { 0x00F50076, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DA0177, -1 }, { 0x00F90175, -1 }, { 0x0156016F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590125, 1 },
+    { 0x01320117, -1 }, { 0x201E0059, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0057013E, 1 }, { 0x0076013C, -1 }, { 0x00510058, -1 }, { 0x00D000C3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00FE, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010C00D8, -1 }, { 0x00000000, 0 },
+    { 0x01470061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B0117, -1 }, { 0x00000000, 0 }, { 0x00C72014, -1 }, { 0x005000FD, 1 },
+    { 0x012900EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01680177, -1 },
+    { 0x0108010A, -1 }, { 0x2013004A, -1 }, { 0x00000000, 0 }, { 0x01210022, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20041, 1 },
+    { 0x00E1003F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20150162, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01420138, 1 }, { 0x015E00C3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01210153, -1 },
+    { 0x00FF00E2, -1 }, { 0x00610079, -1 }, { 0x00DD0071, -2 }, { 0x01780067, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046017A, -1 },
+    { 0x00C20172, -2 }, { 0x00F8201A, -1 }, { 0x0100016E, -2 }, { 0x01172018, -1 },
+    { 0x01552014, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F5002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01750125, -1 },
+    { 0x00000000, 0 }, { 0x00580051, -1 }, { 0x01500041, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0150, -1 },
+    { 0x01350142, 1 }, { 0x005900DD, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00790167, 1 }, { 0x00522015, -1 }, { 0x005700F6, -2 }, { 0x007600F4, -1 },
+    { 0x016E00E4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0043, -1 }, { 0x014D00FF, -1 },
+    { 0x016C00FD, -1 }, { 0x004F0029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A00CD, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C015B, -1 }, { 0x00000000, 0 }, { 0x201900E8, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0174, -4 }, { 0x20390172, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B00E5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0175, -3 }, { 0x004A0100, -1 },
+    { 0x012300F2, -1 }, { 0x01640161, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0162017A, -1 },
+    { 0x00670117, -1 }, { 0x0121010B, -1 }, { 0x015A2026, -1 }, { 0x201000C0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015800C6, 1 }, { 0x01740051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD015A, -1 },
+    { 0x013700E1, -1 }, { 0x01780150, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00762025, -3 }, { 0x005C0108, -1 }, { 0x00D80100, -1 }, { 0x00F2201D, -1 },
+    { 0x01760169, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0079011F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0054003B, -1 }, { 0x010E002F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058013A, 1 },
+    { 0x00000000, 0 }, { 0x00520054, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00FA, -1 }, { 0x00000000, 0 },
+    { 0x00560153, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0113, -1 },
+    { 0x00000000, 0 }, { 0x004C2018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01460076, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0161201F, -1 }, { 0x01470102, -1 },
+    { 0x01660100, -4 }, { 0x0068002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004D012B, 1 }, { 0x01640119, -2 }, { 0x00280047, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010200C5, 1 }, { 0x00C10056, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20110104, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004600EA, -1 },
+    { 0x00BF006F, -1 }, { 0x00FD006B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00470176, -1 }, { 0x00BB201A, -1 },
+    { 0x00C000FB, -1 }, { 0x00C3016E, -2 }, { 0x00DF00F9, -1 }, { 0x011D00F5, -1 },
+    { 0x01562010, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01780108, -2 }, { 0x00000000, 0 }, { 0x00F6002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB012B, 1 }, { 0x01570123, -1 },
+    { 0x01760121, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F80142, 1 },
+    { 0x0155013C, -1 }, { 0x00570066, -1 }, { 0x00760064, -1 }, { 0x00F2005C, -2 },
+    { 0x0174013A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007700F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0059017E, -1 }, { 0x0056010B, -2 }, { 0x00D50176, -1 }, { 0x012F00FD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201F013E, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014A012D, 2 }, { 0x00000000, 0 }, { 0x002D0059, -1 }, { 0x004C0057, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800FD, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F0171, -1 }, { 0x0046201B, 1 }, { 0x004B00FC, -1 },
+    { 0x00C22013, -1 }, { 0x012400EE, 1 }, { 0x016200EA, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A0117, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01782039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017800C0, -3 },
+    { 0x00BB0059, -1 }, { 0x0156004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0158, -1 }, { 0x00DB00E3, -1 },
+    { 0x00DE0156, -1 }, { 0x007B0076, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01580167, -1 },
+    { 0x00F32019, -1 }, { 0x013600F6, -1 }, { 0x015500F4, -1 }, { 0x017400F2, -2 },
+    { 0x01770165, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0134010F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005600C3, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201F00F6, -1 }, { 0x00000000, 0 }, { 0x0057014F, -2 },
+    { 0x0076014D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D010F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014A00E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A0126, -1 },
+    { 0x00000000, 0 }, { 0x0162201B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0129, 1 },
+    { 0x004E0127, 1 }, { 0x00000000, 0 }, { 0x015F002F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C500C5, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01420149, 1 }, { 0x002800E8, -1 }, { 0x006600E4, 1 },
+    { 0x011D0065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C4016A, -2 }, { 0x006400FD, -1 },
+    { 0x00FF00F3, -1 }, { 0x01020166, -3 }, { 0x01780078, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01552025, -2 },
+    { 0x00BF0110, -1 }, { 0x00DE010E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0177011D, -1 }, { 0x00000000, 0 }, { 0x00D60041, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017200C3, -2 },
+    { 0x00580062, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005900EE, 2 }, { 0x00750079, -1 }, { 0x013200E0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00ED201C, -1 }, { 0x00570107, -2 }, { 0x00760105, -1 }, { 0x00F200FD, -1 },
+    { 0x012B2018, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00C7, -1 }, { 0x201A0054, -2 }, { 0x00000000, 0 }, { 0x005200AD, -1 },
+    { 0x0147002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x203A00DE, -1 }, { 0x00720137, -1 }, { 0x012C012B, 1 },
+    { 0x005000C6, -4 }, { 0x002E0055, -1 }, { 0x00AD00C0, -1 }, { 0x01640041, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F00E1, -3 }, { 0x00AB00D9, -1 }, { 0x010800D3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0147015B, -1 }, { 0x006B00F6, -1 }, { 0x00000000, 0 }, { 0x01030079, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01450174, 1 }, { 0x004A0111, -1 }, { 0x01230103, -1 },
+    { 0x015C201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011F0135, 1 }, { 0x013E0133, 1 }, { 0x00BF00C8, -1 }, { 0x00DE00C6, -3 },
+    { 0x013B00C0, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC00DF, -1 },
+    { 0x013900D9, -1 }, { 0x01550064, -1 }, { 0x01740062, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0078201D, 1 }, { 0x00DD016B, -1 },
+    { 0x01322011, -1 }, { 0x013700F2, -1 }, { 0x01780161, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0176017A, -1 },
+    { 0x005C0119, -1 }, { 0x016E2026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025014C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016C00C6, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E2010, -1 },
+    { 0x00000000, 0 }, { 0x016A00DF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0125201B, -1 }, { 0x01442019, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660111, -2 }, { 0x20140057, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00470056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006700E0, -1 }, { 0x00C400DA, -2 }, { 0x00FF0063, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50166, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015A0076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015E0175, -1 }, { 0x0175201F, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0123, -3 }, { 0x0159011B, -1 }, { 0x01780119, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015400C1, 1 }, { 0x00D50056, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250104, 1 }, { 0x00000000, 0 }, { 0x0136014F, -1 }, { 0x007900E8, -1 },
+    { 0x00570077, -1 }, { 0x0155014D, -1 }, { 0x0174014B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EE2018, 1 },
+    { 0x00770101, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00C3, 1 },
+    { 0x00000000, 0 }, { 0x0056011C, -1 }, { 0x203A004E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F014F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EF012B, 1 }, { 0x005100C2, -1 },
+    { 0x002F0051, -1 }, { 0x01080043, -1 }, { 0x012D0127, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0052014E, -1 }, { 0x012B0140, 2 },
+    { 0x014A013E, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00500167, 1 },
+    { 0x00000000, 0 }, { 0x014500E4, -1 }, { 0x00E50077, -1 }, { 0x01040075, -1 },
+    { 0x016400E2, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B010D, -1 }, { 0x013E201C, 2 }, { 0x20100041, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C200AB, -1 }, { 0x015A002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x017D012B, 1 }, { 0x00C000C4, 1 }, { 0x00410059, -3 }, { 0x01580047, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01370062, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0169, -1 }, { 0x00792019, 1 }, { 0x00FD0165, 1 },
+    { 0x01540079, -1 }, { 0x01730077, -1 }, { 0x017600EA, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01580178, -2 }, { 0x00000000, 0 },
+    { 0x01360107, -1 }, { 0x01550105, -1 }, { 0x0057002F, -4 }, { 0x01740103, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01700135, 1 }, { 0x005600D4, -1 }, { 0x014E00C4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201F0107, -1 }, { 0x00570160, -1 }, { 0x00000000, 0 },
+    { 0x014C00DD, -1 }, { 0x00700078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0120, -1 }, { 0x00000000, 0 }, { 0x00C9201D, 1 },
+    { 0x00520106, -1 }, { 0x00E8201B, -1 }, { 0x01072019, 1 }, { 0x01452015, -1 },
+    { 0x01642013, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201800C6, -4 }, { 0x0050011F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0104002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190152, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C00C7, -1 },
+    { 0x004B00C5, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B014F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FE0078, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB2025, -1 }, { 0x01020177, -2 }, { 0x0157201D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE011F, -1 },
+    { 0x00FD011D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250074, -1 }, { 0x00D900C5, -2 }, { 0x017400BB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260100, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00770071, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C0172, -1 }, { 0x0054201E, -3 }, { 0x005900FF, -1 },
+    { 0x0073201C, -1 }, { 0x01540162, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F00BF, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00D8, -1 },
+    { 0x00000000, 0 }, { 0x00D10129, 2 }, { 0x010F0125, 3 }, { 0x016C011F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0164, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EE0140, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019010A, -1 }, { 0x00510163, 1 }, { 0x00000000, 0 },
+    { 0x002F00F2, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00662026, -1 }, { 0x006B0107, -1 }, { 0x0101201C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C12039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C100C0, 1 }, { 0x01780041, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF00D9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004100FA, -1 }, { 0x017700E6, -1 }, { 0x01170079, -1 },
+    { 0x01360077, -2 }, { 0x01740073, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD017C, -1 }, { 0x00F42026, -1 }, { 0x01370103, -1 },
+    { 0x0170201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201F0077, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D100E1, -1 }, { 0x00000000, 0 },
+    { 0x00520076, -1 }, { 0x012B0068, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E011C, -1 }, { 0x00560175, -1 }, { 0x00530102, -1 },
+    { 0x006D201F, -1 }, { 0x00CA2019, 1 }, { 0x01082015, -1 }, { 0x014E0165, 1 },
+    { 0x00000000, 0 }, { 0x201C0135, 1 }, { 0x00000000, 0 }, { 0x201900C2, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C7002D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A014E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004F0134, -1 }, { 0x002D00C3, -1 }, { 0x004C00C1, 1 },
+    { 0x01660122, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01200059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0168, -1 },
+    { 0x012100E5, -1 }, { 0x00000000, 0 }, { 0x00C10078, 1 }, { 0x00E00076, -1 },
+    { 0x00FF0074, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50177, -2 }, { 0x00C20104, 1 }, { 0x00E40175, -1 }, { 0x00FB201F, -1 },
+    { 0x01000100, 1 }, { 0x011A201D, 1 }, { 0x0139201B, -1 }, { 0x01582019, -1 },
+    { 0x00000000, 0 }, { 0x00DA203A, -1 }, { 0x011D0117, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0155002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BB00C3, -1 }, { 0x00DA00C1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015400D2, -1 }, { 0x0059006F, -2 }, { 0x01320061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0055201A, -1 }, { 0x0174015C, -1 }, { 0x00000000, 0 },
+    { 0x014F0078, -1 }, { 0x016E0076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01530177, -1 }, { 0x01500104, -1 },
+    { 0x01720175, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00D4, -1 }, { 0x0168203A, -1 },
+    { 0x0056012D, 2 }, { 0x00000000, 0 }, { 0x00AD0041, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019007A, -1 }, { 0x00EF013C, 2 }, { 0x016800C1, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0106, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C0079, -1 }, { 0x006B0077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2018011F, -1 }, { 0x00000000, 0 }, { 0x00C4201C, -3 },
+    { 0x01022018, -3 }, { 0x016400F3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201300C5, -1 },
+    { 0x002C0120, -1 }, { 0x004B011E, -1 }, { 0x004800AB, -1 }, { 0x00FF002C, -3 },
+    { 0x0162010C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004600C4, -3 },
+    { 0x00430051, -1 }, { 0x00BF0049, -1 }, { 0x013B0041, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280152, -1 }, { 0x00000000, 0 },
+    { 0x004400DD, -1 }, { 0x01580058, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FF015D, -1 },
+    { 0x00000000, 0 }, { 0x015900E4, -1 }, { 0x00DA0079, -1 }, { 0x00F90077, -1 },
+    { 0x0175006F, -1 }, { 0x017800E2, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF017A, -1 }, { 0x00DE0178, -2 }, { 0x00DB0105, -1 }, { 0x011C0174, -1 },
+    { 0x013800FF, -1 }, { 0x013B0172, -1 }, { 0x017600FB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016E002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0172012D, 1 }, { 0x00D400C4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C201E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005600E5, -2 }, { 0x00D200DD, -1 }, { 0x00EE0068, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00570171, -1 }, { 0x006E201B, -1 }, { 0x016E015F, -1 },
+    { 0x01680079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010F017E, 1 }, { 0x01452026, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014500AD, -1 }, { 0x016400AB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F014B, -1 }, { 0x002C00D8, -1 }, { 0x004B00D6, -1 },
+    { 0x00670061, -1 }, { 0x01020057, -3 }, { 0x014300C6, -1 }, { 0x016200C4, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002D0164, -1 }, { 0x004900EF, 1 },
+    { 0x004C0162, -2 }, { 0x013E006C, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD201D, 1 },
+    { 0x0028010A, -1 }, { 0x00C30100, 1 }, { 0x00FC201B, -1 }, { 0x00410022, -1 },
+    { 0x0104016F, -1 }, { 0x0142016B, 1 }, { 0x01592015, -1 }, { 0x01782013, -1 },
+    { 0x00000000, 0 }, { 0x00FF0115, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0132, -1 }, { 0x00DE0130, -1 },
+    { 0x00000000, 0 }, { 0x00D8004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BB0164, -1 }, { 0x013400E9, -1 }, { 0x017200E5, -1 }, { 0x01310076, -1 },
+    { 0x01500074, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01540173, -1 }, { 0x01320102, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570129, 2 },
+    { 0x00760127, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00E9, -2 }, { 0x00000000, 0 },
+    { 0x00D1013A, 1 }, { 0x201A0076, -3 }, { 0x004F005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0175, -3 }, { 0x201B0102, -2 },
+    { 0x203A0100, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0077, -3 },
+    { 0x01640063, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019011B, -2 }, { 0x00510174, -1 }, { 0x00C52018, -3 }, { 0x002F0103, -3 },
+    { 0x004E0101, -1 }, { 0x006D00FF, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201400C1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E1002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20130166, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00270167, 1 }, { 0x00000000, 0 },
+    { 0x00BF00EA, -1 }, { 0x00FD00E6, -1 }, { 0x0138006F, -1 }, { 0x0176006B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00A10178, -1 },
+    { 0x00C00176, -3 }, { 0x00DC0101, -1 }, { 0x00F6201E, -1 }, { 0x00FB00FF, -1 },
+    { 0x0115201C, -1 }, { 0x0134201A, -1 }, { 0x01532018, -1 }, { 0x015800F9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0150002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D500C0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2025016E, -1 }, { 0x201D201A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700E1, -2 }, { 0x00000000, 0 }, { 0x016B005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0058016D, -1 }, { 0x00502019, 1 }, { 0x00D40165, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014E0176, -1 }, { 0x00720111, -1 }, { 0x016A0101, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900D3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010800AD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01470135, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50057, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180178, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0164014C, -1 }, { 0x004A00EB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0177, -2 }, { 0x006A0175, -1 },
+    { 0x00C400FC, -1 }, { 0x012100F6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0027011F, -1 }, { 0x0046011D, -1 }, { 0x011F010F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002200C5, -1 }, { 0x004100C3, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C00F3, -1 }, { 0x00000000, 0 }, { 0x00F40076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D90177, -1 }, { 0x00D60104, -1 }, { 0x00F80175, -1 }, { 0x010F201F, 2 },
+    { 0x01360171, -1 }, { 0x014D201B, -1 }, { 0x0174016D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580125, 1 }, { 0x00770123, -1 },
+    { 0x0052003F, -1 }, { 0x201D0059, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056013E, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00FE, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0073, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00520170, -1 }, { 0x01042010, -1 }, { 0x012800EF, 1 }, { 0x016600EB, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01640104, -4 },
+    { 0x00000000, 0 }, { 0x0066002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0143011F, -1 }, { 0x0162011D, -2 }, { 0x00C10041, 1 }, { 0x00E0003F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20140162, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0058, -2 },
+    { 0x011C0054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011D00E0, -1 },
+    { 0x01770067, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10172, -2 }, { 0x01542014, -1 },
+    { 0x00DD00FD, -1 }, { 0x015900F5, -1 }, { 0x017800F3, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0176010C, -2 }, { 0x00000000, 0 }, { 0x00F4002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01360129, 1 }, { 0x01550127, -1 },
+    { 0x00570051, -1 }, { 0x01740125, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2026016A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D10062, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590169, -1 },
+    { 0x005600F6, -2 }, { 0x00780167, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F0129, 1 },
+    { 0x00000000, 0 }, { 0x0054010F, -2 }, { 0x0147201E, -1 }, { 0x0166201C, 1 },
+    { 0x016B00FD, -1 }, { 0x20190043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0142, 1 }, { 0x00000000, 0 }, { 0x01262039, -1 }, { 0x010C011C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B015B, -1 }, { 0x00000000, 0 }, { 0x201800E8, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190174, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F015C, -1 }, { 0x004B00E7, -1 }, { 0x0108014E, -1 }, { 0x016200D5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0063201D, 1 }, { 0x002A0102, -2 }, { 0x00000000, 0 },
+    { 0x013E007D, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0028011B, -1 },
+    { 0x01592026, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015900AD, -1 }, { 0x00BB0044, -1 },
+    { 0x017800AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0143, -1 }, { 0x00DE0141, -1 }, { 0x017600C4, -3 },
+    { 0x005C0063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410164, -3 }, { 0x01580152, -1 },
+    { 0x017400DD, 1 }, { 0x00D60074, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260122, -1 }, { 0x00000000, 0 }, { 0x00F1201D, -1 },
+    { 0x0156016B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590121, -3 }, { 0x01320113, -1 }, { 0x201E0055, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057013A, 1 }, { 0x005400C7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010C00D4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0113, -1 }, { 0x00000000, 0 },
+    { 0x00C72010, -1 }, { 0x005000F9, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01490175, -2 }, { 0x01080106, -1 }, { 0x00000000, 0 },
+    { 0x0067002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002800D3, -1 }, { 0x0063005C, -2 }, { 0x00C00056, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20100104, -1 },
+    { 0x00000000, 0 }, { 0x0121014F, -1 }, { 0x00000000, 0 }, { 0x00DD006D, -1 },
+    { 0x01590065, -1 }, { 0x01780063, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C2016E, -2 }, { 0x0100016A, -2 }, { 0x00BF00FB, -1 },
+    { 0x01552010, -1 }, { 0x017900EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0158010A, -1 }, { 0x00000000, 0 }, { 0x00D6002C, -1 }, { 0x00F5002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600DA, -1 },
+    { 0x00000000, 0 }, { 0x00DA012B, 1 }, { 0x01750121, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C014C, -1 }, { 0x0135013E, 1 }, { 0x00000000, 0 },
+    { 0x00560066, -1 }, { 0x00F1005C, -3 }, { 0x014E0056, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00790163, 1 }, { 0x00522011, -1 },
+    { 0x005700F2, -2 }, { 0x007600F0, -1 }, { 0x016E00E0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D40176, -1 },
+    { 0x0129201C, 1 }, { 0x00D10103, -1 }, { 0x010F00FF, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A00C9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0145002E, -1 }, { 0x0164002C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201900E4, -1 }, { 0x00000000, 0 }, { 0x0168012B, 1 },
+    { 0x00000000, 0 }, { 0x002C0059, -3 }, { 0x00C7004F, -1 }, { 0x00000000, 0 },
+    { 0x201A0170, -1 }, { 0x2039016E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006B00E1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0171, -1 }, { 0x00C12013, -1 }, { 0x014200EC, 1 }, { 0x0145015F, -1 },
+    { 0x015E0077, -1 }, { 0x0164015D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670113, -1 }, { 0x01210107, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013900C4, 1 }, { 0x01360051, -1 },
+    { 0x015800C2, 1 }, { 0x0174004D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0178014C, -2 }, { 0x00DA00E3, -1 }, { 0x015600DB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F22019, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0174017E, -1 },
+    { 0x0079011B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D0002F, -1 },
+    { 0x012D0029, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005500C3, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056014F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C010F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016800E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00ED0177, -1 }, { 0x0123201F, 1 }, { 0x0142201D, -1 }, { 0x014700FE, 1 },
+    { 0x0161201B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01640115, -2 }, { 0x00000000, 0 },
+    { 0x00280043, -1 }, { 0x0066003F, 2 }, { 0x015E002F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C400C5, 1 }, { 0x010200C1, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20110100, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004600E6, -1 }, { 0x00BF006B, -1 }, { 0x00FD0067, -1 },
+    { 0x010000DA, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C3016A, -2 }, { 0x01200164, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01780104, -3 },
+    { 0x2026004A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01380121, -1 }, { 0x0157011F, -1 }, { 0x00D50041, -1 }, { 0x0132003B, -1 },
+    { 0x0176011D, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570062, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01340153, -1 }, { 0x005800EE, 1 },
+    { 0x00D10073, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059017A, -1 }, { 0x00512026, -1 },
+    { 0x00560107, -2 }, { 0x00EC201C, -1 }, { 0x00F100FD, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F013A, 1 }, { 0x00000000, 0 },
+    { 0x00540120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0146002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0153, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012B012B, 1 }, { 0x004F00C6, -2 },
+    { 0x01060047, -1 }, { 0x014A0129, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F016D, -1 },
+    { 0x002C00FA, -1 }, { 0x004B00F8, -1 }, { 0x01020079, -2 }, { 0x016200E6, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002A0113, -1 }, { 0x016000FF, -1 }, { 0x00000000, 0 },
+    { 0x00620029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FF0137, -1 },
+    { 0x00000000, 0 }, { 0x00DD00C6, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF0154, -1 }, { 0x00000000, 0 }, { 0x00DB00DF, -1 }, { 0x005C0074, -1 },
+    { 0x017600D5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410175, -2 }, { 0x0077201D, 1 }, { 0x013600F2, -1 },
+    { 0x015500F0, -1 }, { 0x01580163, -1 }, { 0x017400EE, 2 }, { 0x01770161, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0134010B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F00029, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201F00F2, -1 }, { 0x0057014B, -1 }, { 0x005400D8, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D010B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014A00E1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E6201F, -1 },
+    { 0x00AD0104, -1 }, { 0x0105201D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004E0123, -1 }, { 0x20130057, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500C1, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002800E4, -1 }, { 0x00C300DA, -2 }, { 0x011D0061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C40166, -3 }, { 0x01020162, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013E0177, 1 }, { 0x00BF010C, -1 }, { 0x013B0104, 1 },
+    { 0x015A0102, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC0123, -1 },
+    { 0x01770119, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013400C3, -1 }, { 0x00D40056, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900EA, -2 }, { 0x00560077, -1 },
+    { 0x007800E8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00ED2018, -1 }, { 0x00570103, -2 },
+    { 0x00760101, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00C3, -4 }, { 0x0150017F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CF012D, 1 }, { 0x005000C2, -3 }, { 0x002E0051, -1 },
+    { 0x00EE012B, 1 }, { 0x016A0123, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201900F5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0105005C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F0167, 1 }, { 0x00000000, 0 },
+    { 0x006B00F2, -1 }, { 0x00C50079, -2 }, { 0x00E40077, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004A010D, -1 }, { 0x014200FD, 1 }, { 0x015C201A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C100AB, -1 },
+    { 0x0159002E, -2 }, { 0x0178002C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013E012F, 1 },
+    { 0x00DE00C2, -2 }, { 0x00400059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2026201C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015800D3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0159015F, -1 }, { 0x00782019, 1 }, { 0x017500EA, -1 }, { 0x01530079, -1 },
+    { 0x01720077, -1 }, { 0x0178015D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01760176, 1 }, { 0x005C0115, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0056002F, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F0062, 1 },
+    { 0x005700BB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016C00C2, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20192026, -2 },
+    { 0x00000000, 0 }, { 0x00560160, -1 }, { 0x007200EB, -1 }, { 0x00000000, 0 },
+    { 0x006F0078, -1 }, { 0x0129006C, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C8201D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0166010D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A00C5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0151, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50162, -3 },
+    { 0x011F00E9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DA2025, -1 }, { 0x01010177, -1 }, { 0x0156201D, -1 }, { 0x0175201B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD011F, -3 }, { 0x01590117, -1 },
+    { 0x01780115, -2 }, { 0x0172002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D800C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250100, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007900E4, -1 }, { 0x00570073, -2 }, { 0x00760071, -1 },
+    { 0x016E0061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0053201E, -1 }, { 0x005800FF, -1 }, { 0x0072201C, 1 },
+    { 0x016C007A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01682025, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00EF0127, 2 }, { 0x20190065, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012B013C, 2 }, { 0x014A013A, 1 }, { 0x006B0062, -1 },
+    { 0x016600C5, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00500163, 1 }, { 0x00000000, 0 }, { 0x014500E0, -1 },
+    { 0x0123006F, -1 }, { 0x0142006D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F017E, -1 }, { 0x004B0109, -1 },
+    { 0x00AB0176, -1 }, { 0x00E600FF, -1 }, { 0x0100201C, -3 }, { 0x010500FD, -1 },
+    { 0x013E2018, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C02039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C000C0, 1 },
+    { 0x00410055, -2 }, { 0x01580043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0165, -1 },
+    { 0x00FD0161, -1 }, { 0x013800EA, -1 }, { 0x01540075, -1 }, { 0x015700E8, -1 },
+    { 0x017600E6, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DC017C, -1 }, { 0x00F32026, -1 }, { 0x01390176, -2 }, { 0x01550101, -1 },
+    { 0x01580174, -2 }, { 0x017400FF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0077, -3 },
+    { 0x00000000, 0 }, { 0x011000C4, -1 }, { 0x014E00C0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0057015C, -1 }, { 0x005400E9, -2 }, { 0x010E00DD, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D011C, -1 }, { 0x00550175, -1 }, { 0x00520102, 1 }, { 0x006C201F, -1 },
+    { 0x00C92019, 1 }, { 0x01452011, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B0135, 1 }, { 0x00000000, 0 }, { 0x016A017C, -1 }, { 0x201800C2, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01230027, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019014E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C00C3, 1 }, { 0x004B00C1, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460067, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002800F5, -1 },
+    { 0x00000000, 0 }, { 0x00C00078, 1 }, { 0x00DF0076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40177, -2 },
+    { 0x00C10104, 1 }, { 0x00E30175, -1 }, { 0x00FA201F, -1 }, { 0x01020173, -1 },
+    { 0x01572019, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D9203A, -1 }, { 0x00FD0119, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0154002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D900C1, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202600FC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C016E, -1 },
+    { 0x0054201A, -3 }, { 0x005900FB, -1 }, { 0x00732018, -1 }, { 0x016D0076, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D6017F, -1 }, { 0x016E0102, -2 }, { 0x01710175, -1 },
+    { 0x0051002E, -1 }, { 0x0070002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00D4, -1 }, { 0x00000000, 0 }, { 0x0055012D, 1 },
+    { 0x00D10125, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00EE013C, 2 }, { 0x010A00C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190106, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F00EE, 1 }, { 0x004B0079, -2 },
+    { 0x006A0077, -1 }, { 0x01620067, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004F0178, -1 }, { 0x00C3201C, -3 }, { 0x006B0103, -1 },
+    { 0x01012018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FE002C, -1 }, { 0x011D002A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00670135, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0047, -2 },
+    { 0x0159003F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013E0140, 3 }, { 0x00BF00D5, -1 },
+    { 0x0119005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x017700E2, -1 }, { 0x00D90079, -1 }, { 0x00F80077, -1 }, { 0x01550071, -1 },
+    { 0x0174006F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0178, 1 },
+    { 0x0132201E, -1 }, { 0x00DA0105, -1 }, { 0x013700FF, -1 }, { 0x0151201C, -1 },
+    { 0x015600FD, -1 }, { 0x0170201A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F0073, -1 }, { 0x00000000, 0 },
+    { 0x00D300C4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B201E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005500E5, -1 }, { 0x00000000, 0 }, { 0x014A0062, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560171, -1 }, { 0x006D201B, -1 }, { 0x01082011, -1 }, { 0x01100165, 1 },
+    { 0x0129007D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01680105, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0166011E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280065, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0164, -2 }, { 0x004800EF, 1 }, { 0x012100E1, -1 },
+    { 0x00FF0070, 1 }, { 0x01620150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50173, -1 }, { 0x00C20100, 1 },
+    { 0x00FB201B, -1 }, { 0x010000FC, -1 }, { 0x011A2019, 1 }, { 0x01582015, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011D0113, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F8002F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0059006B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007900F5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01150177, -1 }, { 0x014B201F, -1 }, { 0x01500100, -1 }, { 0x0052002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560129, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00E9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00AB0056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0102, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016600D6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018011B, -1 },
+    { 0x00000000, 0 }, { 0x00C42018, -3 }, { 0x006C00FF, -1 }, { 0x01022014, -1 },
+    { 0x016400EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201300C1, -1 }, { 0x00000000, 0 }, { 0x002C011C, -1 },
+    { 0x01620108, -1 }, { 0x00E0002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01600121, -1 }, { 0x002700C2, -1 }, { 0x004600C0, -3 }, { 0x00BF0045, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0028014E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01390056, -2 },
+    { 0x01580054, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00E8, -2 },
+    { 0x0137006F, -1 }, { 0x015900E0, -1 }, { 0x0175006B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0176, -2 }, { 0x00792026, -3 },
+    { 0x00DB0101, -1 }, { 0x00DE0174, -2 }, { 0x00F5201E, -1 }, { 0x00FA00FF, -1 },
+    { 0x011900FD, -1 }, { 0x013B016E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014F002C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0134012D, 1 }, { 0x00D400C0, -1 },
+    { 0x01720129, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C201A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005600E1, -2 },
+    { 0x00000000, 0 }, { 0x0072006C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057016D, -1 },
+    { 0x00D30165, 1 }, { 0x016E015B, -1 }, { 0x01490077, -2 }, { 0x2019002E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D012D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014A0103, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010A0120, -1 }, { 0x01622039, -1 },
+    { 0x012600AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019015F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C00D4, -1 }, { 0x004B00D2, -1 }, { 0x00C40057, -3 }, { 0x014300C2, -1 },
+    { 0x016200C0, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01060152, -1 }, { 0x00000000, 0 }, { 0x012200DD, -1 }, { 0x00650076, -1 },
+    { 0x011F006A, 1 }, { 0x013E0068, 3 }, { 0x014100DB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00690175, -1 }, { 0x00280106, -1 }, { 0x00C300FC, -1 },
+    { 0x00DD2019, 1 }, { 0x0104016B, -1 }, { 0x01420167, 1 }, { 0x01592011, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FF0111, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF012E, -1 }, { 0x00DE012C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00790065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013400E5, -1 },
+    { 0x017200E1, -1 }, { 0x00F30076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012D201D, 1 },
+    { 0x0059010C, -2 }, { 0x00D50104, -1 }, { 0x0154016F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00570125, 1 }, { 0x00760123, -1 }, { 0x201C0059, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004F0058, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0171, -1 }, { 0x201B00FE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010A00D8, -1 }, { 0x00000000, 0 }, { 0x01450061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190117, -2 }, { 0x00000000, 0 },
+    { 0x00C52014, -1 }, { 0x002F00FF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0106010A, -1 }, { 0x2011004A, -1 },
+    { 0x00000000, 0 }, { 0x011F0022, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C00041, 1 }, { 0x00DF003F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20130162, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015C00C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00270163, 1 }, { 0x00460161, -1 }, { 0x00BF00E6, -1 }, { 0x00FD00E2, -1 },
+    { 0x011F0153, -1 }, { 0x01760067, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00A10174, -1 }, { 0x00C00172, -2 }, { 0x00DC00FD, -1 },
+    { 0x00F6201A, -1 }, { 0x01152018, -1 }, { 0x017700F3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600C5, 1 }, { 0x00000000, 0 },
+    { 0x00BB0118, -1 }, { 0x00000000, 0 }, { 0x00F3002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007B0135, 2 }, { 0x00000000, 0 }, { 0x005900C4, -3 }, { 0x00560051, -1 },
+    { 0x014E0041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025016A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700DD, 1 },
+    { 0x012D005C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580169, -1 }, { 0x00770167, 1 },
+    { 0x00D100EE, 2 }, { 0x00ED0079, -1 }, { 0x014A0073, -1 }, { 0x016C00E4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01100176, -1 },
+    { 0x0072010D, -1 }, { 0x014B00FF, -2 }, { 0x0165201C, 1 }, { 0x016A00FD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0142, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180174, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004A00E7, -1 }, { 0x010400DB, -2 }, { 0x00280076, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0175, -3 }, { 0x004B0173, -1 }, { 0x0062201D, -1 }, { 0x012100F2, -1 },
+    { 0x01620161, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460119, -1 }, { 0x011F010B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002200C1, -1 }, { 0x015800AD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01780137, 1 }, { 0x00BB00D0, -1 }, { 0x015600C6, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01760150, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D50074, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250122, -1 }, { 0x00000000, 0 }, { 0x00F0201D, -1 }, { 0x00D60100, -1 },
+    { 0x010F201B, 2 }, { 0x0136016D, -1 }, { 0x01740169, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0077011F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0056013A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540153, -2 }, { 0x00000000, 0 },
+    { 0x002F006F, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0052016C, -1 },
+    { 0x016600E7, -2 }, { 0x00000000, 0 }, { 0x01440076, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01480175, -2 }, { 0x01450102, -1 }, { 0x015F201F, -1 }, { 0x0066002A, 3 },
+    { 0x01640100, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B012B, 1 }, { 0x01620119, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010000C5, 1 }, { 0x0062005C, -2 }, { 0x00BF0056, -2 }, { 0x00DE0054, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410077, -2 }, { 0x01770063, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C1016E, -2 }, { 0x01542010, -1 }, { 0x00DD00F9, -1 }, { 0x017800EF, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760108, -2 },
+    { 0x00000000, 0 }, { 0x00D5002C, -1 }, { 0x00F4002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500DA, -1 }, { 0x00000000, 0 },
+    { 0x00D9012B, 1 }, { 0x01550123, -1 }, { 0x0057004D, -1 }, { 0x01740121, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260166, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00F60142, 1 }, { 0x00000000, 0 }, { 0x00F0005C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00780163, 1 }, { 0x00000000, 0 }, { 0x005600F2, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201F0125, 1 }, { 0x0057017E, -1 }, { 0x0054010B, -2 },
+    { 0x00D30176, -1 }, { 0x0147201A, -1 }, { 0x01662018, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D013E, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x017E005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00632019, 1 }, { 0x00C02013, -1 }, { 0x013E0079, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00280117, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0041002F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01762039, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF013F, -1 },
+    { 0x00DE013D, -1 }, { 0x017600C0, -3 }, { 0x00D80057, -1 }, { 0x0154004F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0158014E, -1 }, { 0x00D900E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026011E, -1 },
+    { 0x00000000, 0 }, { 0x01560167, -1 }, { 0x00F12019, -1 }, { 0x013400F6, -1 },
+    { 0x01750165, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059011D, -3 },
+    { 0x0078011B, -1 }, { 0x0132010F, -1 }, { 0x201E0051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F00DD, 1 },
+    { 0x00000000, 0 }, { 0x005400C3, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00F6, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005200DC, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B010F, -1 }, { 0x00000000, 0 }, { 0x004B2014, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EC0177, -1 },
+    { 0x0141201D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460041, -3 },
+    { 0x0065003F, -1 }, { 0x015D002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040134, 1 }, { 0x00C300C5, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20100100, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01590061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C2016A, -2 }, { 0x006200FD, -1 }, { 0x00FD00F3, -1 }, { 0x01000166, -3 },
+    { 0x01760078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01580106, -1 }, { 0x2025004A, 1 },
+    { 0x0079002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202600D6, -1 }, { 0x00000000, 0 }, { 0x01370121, -1 },
+    { 0x0175011D, -1 }, { 0x00D40041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0135013A, 1 }, { 0x005900D5, -2 }, { 0x00560062, 1 }, { 0x01100056, -1 },
+    { 0x017000C3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0079015F, -1 }, { 0x00000000, 0 }, { 0x005700EE, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00502026, -3 }, { 0x00EB201C, -1 },
+    { 0x00F000FD, -1 }, { 0x01292018, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A00C5, -1 }, { 0x20180054, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0145002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0153, -1 }, { 0x201900E0, -1 },
+    { 0x00000000, 0 }, { 0x012A012B, 1 }, { 0x004E00C6, -1 }, { 0x002C0055, -1 },
+    { 0x01620041, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A016C, -1 },
+    { 0x2039016A, -1 }, { 0x00000000, 0 }, { 0x01470142, 1 }, { 0x010600D3, -1 },
+    { 0x0141005C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E016D, -1 }, { 0x004A00F8, -1 },
+    { 0x012300EA, -1 }, { 0x01010079, -1 }, { 0x0145015B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01430174, 1 },
+    { 0x0067010F, -1 }, { 0x00DE2026, -2 }, { 0x01210103, -1 }, { 0x015A201E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011D0135, 1 }, { 0x00000000, 0 },
+    { 0x00DC00C6, -2 }, { 0x0136004D, 1 }, { 0x013900C0, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0152, -2 },
+    { 0x01780148, -1 }, { 0x00DA00DF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0076201D, 1 }, { 0x01760161, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0174017A, -1 }, { 0x00790117, -1 }, { 0x016C2026, -1 },
+    { 0x00000000, 0 }, { 0x00EF0029, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0056014B, -1 }, { 0x00000000, 0 }, { 0x016A00C6, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C010B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016800DF, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E5201F, -1 }, { 0x0104201D, -2 },
+    { 0x0123201B, 1 }, { 0x01422019, -1 }, { 0x016600F8, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01640111, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C400C1, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004600E2, -1 },
+    { 0x00C200DA, -2 }, { 0x00FD0063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30166, -3 },
+    { 0x00DF00F1, -1 }, { 0x00000000, 0 }, { 0x01580076, -1 }, { 0x01770074, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015C0175, -1 }, { 0x00DD010A, -2 }, { 0x0173201F, -1 }, { 0x01780100, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0123, -1 }, { 0x0138011D, -1 },
+    { 0x0157011B, -1 }, { 0x01760119, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D30056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260177, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0134014F, -1 }, { 0x007700E8, -1 }, { 0x00550077, -1 }, { 0x010F006B, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590176, 1 }, { 0x00EC2018, -1 }, { 0x00560103, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00C3, -2 }, { 0x00000000, 0 }, { 0x0054011C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D014F, -2 }, { 0x201A00DC, -1 }, { 0x203900DA, -1 },
+    { 0x00CE012D, 1 }, { 0x004F00C2, -1 }, { 0x01060043, -1 }, { 0x012B0127, 2 },
+    { 0x014A0125, 1 }, { 0x00000000, 0 }, { 0x203A0166, -1 }, { 0x201800F5, -1 },
+    { 0x00000000, 0 }, { 0x01290140, 2 }, { 0x002E00DD, -3 }, { 0x0104005C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F0169, -1 }, { 0x004B00F4, -1 }, { 0x014300E4, -1 },
+    { 0x00C40079, -2 }, { 0x00E30077, -1 }, { 0x01020075, -1 }, { 0x016200E2, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A010F, -1 },
+    { 0x013C201C, -1 }, { 0x014100FD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C000AB, -1 }, { 0x0177002C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017B012B, 1 }, { 0x00DD00C2, -3 },
+    { 0x01560047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2025201C, -2 }, { 0x00000000, 0 }, { 0x00BF0150, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01350062, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410171, -1 },
+    { 0x00772019, 1 }, { 0x013600EE, 1 }, { 0x01710077, -1 }, { 0x017400EA, -2 },
+    { 0x0177015D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01560178, -2 }, { 0x00000000, 0 }, { 0x01340107, -1 }, { 0x01720103, -1 },
+    { 0x0055002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005600BB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F00EE, 1 }, { 0x016E0135, 1 },
+    { 0x005400D4, -1 }, { 0x014C00C4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20182026, -2 }, { 0x201D0107, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00E6201B, -1 }, { 0x00AD0100, -1 }, { 0x01052019, -1 },
+    { 0x01432015, -1 }, { 0x01622013, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0121, -3 },
+    { 0x004E011F, -1 }, { 0x00000000, 0 }, { 0x0102002D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004A0151, -1 }, { 0x002800E0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40162, -3 }, { 0x00FF00EB, -1 },
+    { 0x00DD007A, -1 }, { 0x00FC0078, 1 }, { 0x011B0076, -1 }, { 0x01780070, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D92025, -1 },
+    { 0x00BF0108, -1 }, { 0x01000177, -2 }, { 0x013B0100, 1 }, { 0x0155201D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DC011F, -1 }, { 0x01770115, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017200BB, -1 },
+    { 0x00000000, 0 }, { 0x0150004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005900E6, -2 }, { 0x00560073, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0071201C, -1 }, { 0x005700FF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CF0129, 1 },
+    { 0x00EE0127, 2 }, { 0x016A011F, -1 }, { 0x20180065, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0164, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0064, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004F0163, 1 }, { 0x01660151, -2 }, { 0x00000000, 0 }, { 0x00C50075, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A0109, -1 }, { 0x00E500FF, -1 },
+    { 0x00FF201C, 1 }, { 0x010400FD, -2 }, { 0x014200F9, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0159002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760041, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20262018, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0159015B, -1 }, { 0x01780159, -1 },
+    { 0x013700EA, -1 }, { 0x01150079, -1 }, { 0x01720073, -1 }, { 0x017500E6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB017C, -1 },
+    { 0x005C0111, -1 }, { 0x00F22026, -1 }, { 0x016E201E, -1 }, { 0x017300FF, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010C0051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056015C, -1 },
+    { 0x007200E7, -1 }, { 0x00000000, 0 }, { 0x00500076, 1 }, { 0x01290068, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014C0165, 1 }, { 0x00510102, -1 }, { 0x00C82019, 1 }, { 0x01062015, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0135, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660109, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C5002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01640122, -1 },
+    { 0x004A00C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B014D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011E0059, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004600F3, -1 }, { 0x011F00E5, -1 },
+    { 0x00BF0078, -1 }, { 0x00FD0074, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30177, -2 }, { 0x00C00104, 1 },
+    { 0x00E20175, -1 }, { 0x00F9201F, -1 }, { 0x0118201D, 1 }, { 0x01562019, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD011B, -2 }, { 0x01590113, -1 }, { 0x01780111, -2 }, { 0x0134002F, -1 },
+    { 0x20260057, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D800C1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202500FC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007900E0, -1 },
+    { 0x0057006F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0053201A, -1 },
+    { 0x005800FB, -1 }, { 0x00722018, 1 }, { 0x014D0078, -1 }, { 0x016C0076, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D5017F, -1 }, { 0x014E0104, -1 }, { 0x01510177, -1 }, { 0x0050002E, -3 },
+    { 0x006F002C, -1 }, { 0x01700175, -1 }, { 0x203A0046, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0166203A, -1 }, { 0x0054012D, 1 }, { 0x20190061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0160, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014700C3, -1 }, { 0x016600C1, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0050015F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00690077, -1 }, { 0x01420069, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F017A, -1 }, { 0x00AB0172, -1 }, { 0x00C2201C, -3 }, { 0x01002018, -3 },
+    { 0x016200F3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201100C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE002E, -2 }, { 0x00FD002C, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00660135, 3 },
+    { 0x00000000, 0 }, { 0x004400C4, -1 }, { 0x01390041, 1 }, { 0x0158003F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004200DD, -1 }, { 0x00DD00D3, -2 },
+    { 0x01560058, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0161, -1 }, { 0x00FD015D, -1 }, { 0x013800E6, -1 },
+    { 0x015700E4, -1 }, { 0x017600E2, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01390172, -1 }, { 0x01580170, -1 },
+    { 0x00D90105, -1 }, { 0x013600FF, -2 }, { 0x017400FB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016C002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0170012D, 1 }, { 0x00D200C4, -1 },
+    { 0x011000C0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201F00FF, 1 }, { 0x00000000, 0 }, { 0x005400E5, -2 },
+    { 0x00D000DD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E201F, -2 },
+    { 0x006C201B, -1 }, { 0x010F0165, 1 }, { 0x014A00EE, 2 }, { 0x016C015F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01432026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014300AD, -1 }, { 0x016200AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016000C4, -1 }, { 0x00460063, -1 }, { 0x01000057, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006600ED, 1 }, { 0x00000000, 0 }, { 0x00DF0072, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C40173, -1 }, { 0x00C10100, 1 }, { 0x00FA201B, -1 },
+    { 0x0102016F, -1 }, { 0x01572015, -1 }, { 0x01762013, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0119, -1 },
+    { 0x00FD0115, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D6004A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058006B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C016A, -1 }, { 0x007800F5, -1 },
+    { 0x013200E9, -1 }, { 0x012F0076, -1 }, { 0x014E0074, 1 }, { 0x017000E5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01330175, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00550129, 1 }, { 0x00D10121, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B00E9, -1 }, { 0x00000000, 0 }, { 0x00720140, -1 }, { 0x20180076, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0175, 1 }, { 0x20190102, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F00EA, -3 }, { 0x002C0077, -3 }, { 0x004B0075, -1 }, { 0x01620063, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F0174, -1 },
+    { 0x0066201E, -1 }, { 0x006B00FF, -1 }, { 0x00C32018, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20150134, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DF002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0043, -2 }, { 0x011B003F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20110166, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013E013C, 3 }, { 0x00BF00D1, -1 }, { 0x00DE00CF, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00440165, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0136006F, -1 },
+    { 0x0174006B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F4201E, -1 }, { 0x00DA0101, -1 },
+    { 0x00F900FF, -1 }, { 0x0113201C, -1 }, { 0x0132201A, -1 }, { 0x01512018, -1 },
+    { 0x015600F9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0122, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014E002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201F006F, -1 }, { 0x00000000, 0 }, { 0x00D300C0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B201A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005500E1, -1 }, { 0x00000000, 0 },
+    { 0x0169005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056016D, -1 }, { 0x007200F8, -1 },
+    { 0x00D20165, 1 }, { 0x01480077, -2 }, { 0x2018002E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C012D, 1 }, { 0x014C0176, -1 },
+    { 0x00000000, 0 }, { 0x01680101, -1 }, { 0x00000000, 0 }, { 0x004B002D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010600AD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018015F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01450135, 2 }, { 0x00000000, 0 },
+    { 0x010400C6, 1 }, { 0x00280061, -1 }, { 0x0066005D, 2 }, { 0x00C30057, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0162014C, -1 },
+    { 0x006700E9, -1 }, { 0x00000000, 0 }, { 0x00640076, -1 }, { 0x00FF006C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00680175, -2 }, { 0x00460104, -3 }, { 0x00C200FC, -1 }, { 0x00C5016F, -1 },
+    { 0x011F00F6, -1 }, { 0x01582011, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011D010F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01780122, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C00DA, -1 }, { 0x00590067, -3 }, { 0x00780065, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F20076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F60175, -1 }, { 0x0058010C, -1 },
+    { 0x00D40104, -1 }, { 0x014B201B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560125, 1 }, { 0x201B0059, 1 }, { 0x203A0057, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F005A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016600D2, -1 },
+    { 0x006B006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20180117, -1 }, { 0x00000000, 0 }, { 0x00C42014, -1 },
+    { 0x002E00FF, -3 }, { 0x01022010, -1 }, { 0x012600EF, 1 }, { 0x016400EB, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01620104, -4 }, { 0x2010004A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0160011D, -1 }, { 0x00000000, 0 },
+    { 0x00DE003F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD00E4, -1 }, { 0x01750067, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF0172, -1 }, { 0x00DE0170, -1 }, { 0x00DB00FD, -1 }, { 0x00F5201A, -1 },
+    { 0x013B016A, -1 }, { 0x015700F5, -1 }, { 0x017600F3, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500C5, 1 }, { 0x00000000, 0 }, { 0x0174010C, -1 },
+    { 0x00000000, 0 }, { 0x00F2002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01340129, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590150, -2 }, { 0x00000000, 0 }, { 0x005600DD, 1 }, { 0x00720068, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00570169, -1 }, { 0x005400F6, -2 }, { 0x00760167, 1 },
+    { 0x00EC0079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0129, 1 }, { 0x00000000, 0 }, { 0x0145201E, -1 },
+    { 0x0164201C, 1 }, { 0x016900FD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0142, 1 }, { 0x00000000, 0 },
+    { 0x01242039, -1 }, { 0x010A011C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019015B, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0106014E, -1 }, { 0x002A00E9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0061201D, -1 },
+    { 0x00DD2015, -1 }, { 0x01230165, 1 }, { 0x01420163, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FF010D, -1 }, { 0x01572026, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF012A, -1 }, { 0x00DE0128, -1 },
+    { 0x015700AD, -1 }, { 0x017600AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01770137, -1 },
+    { 0x00000000, 0 }, { 0x017400C4, -4 }, { 0x00790061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01560152, -1 }, { 0x005B00EF, 1 }, { 0x013400E1, -1 }, { 0x00D40074, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00EF201D, 1 }, { 0x00590108, -2 }, { 0x00D50100, -1 },
+    { 0x012D2019, 1 }, { 0x0154016B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570121, -2 },
+    { 0x0076011F, -1 }, { 0x00000000, 0 }, { 0x0051003B, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00E1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005200C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E016D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00720151, -1 }, { 0x010A00D4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190113, -2 }, { 0x00000000, 0 }, { 0x00C52010, -1 }, { 0x002F00FB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01060106, -1 }, { 0x00000000, 0 }, { 0x0046002C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004A012B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0061005C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046015D, -1 }, { 0x011F014F, -1 },
+    { 0x00BF00E2, -1 }, { 0x01380067, -1 }, { 0x013B00DA, -1 }, { 0x01570065, -1 },
+    { 0x01760063, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440176, -1 },
+    { 0x00C0016E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202600C1, 1 }, { 0x00592039, -1 }, { 0x00BB0114, -1 }, { 0x0156010A, -1 },
+    { 0x00D4002C, -1 }, { 0x00F3002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01350125, 1 },
+    { 0x005900C0, -3 }, { 0x0056004D, -1 }, { 0x01100041, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250166, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F50142, 1 }, { 0x00000000, 0 }, { 0x00EF005C, 1 }, { 0x014C0056, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00770163, 1 }, { 0x00000000, 0 }, { 0x016C00E0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0056017E, -1 }, { 0x00720109, -1 }, { 0x00D20176, -1 },
+    { 0x0127201C, -1 }, { 0x01652018, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C013E, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0143002E, -1 }, { 0x0162002C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0147012D, 2 }, { 0x0166012B, 1 }, { 0x002A0059, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A00E3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0171, -1 }, { 0x004B016F, -1 },
+    { 0x00622019, -1 }, { 0x0143015F, -1 }, { 0x015C0077, -1 }, { 0x0162015D, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01410178, -2 },
+    { 0x00460115, -1 }, { 0x011F0107, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260079, -3 }, { 0x00BB00CC, -1 },
+    { 0x015600C2, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0176014C, -2 },
+    { 0x005C00EB, -1 }, { 0x015400DB, -1 }, { 0x00590078, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025011E, -1 }, { 0x00000000, 0 },
+    { 0x01360169, -1 }, { 0x00F02019, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0172017E, -1 }, { 0x0077011B, -1 }, { 0x201D0051, -1 },
+    { 0x00000000, 0 }, { 0x012B0029, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00DD, -3 }, { 0x00000000, 0 },
+    { 0x005300C3, -1 }, { 0x00000000, 0 }, { 0x00AD004A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00F6, -1 }, { 0x00000000, 0 },
+    { 0x0054014F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004A2014, -1 }, { 0x00520168, -1 }, { 0x014700E5, -1 },
+    { 0x016600E3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EB0177, -1 }, { 0x0121201F, 1 },
+    { 0x014500FE, 1 }, { 0x015F201B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01620115, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015C002F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C200C5, 1 }, { 0x00BF0052, -1 },
+    { 0x00DE0050, -1 }, { 0x010000C1, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1016A, -2 },
+    { 0x006100FD, -1 }, { 0x00DD00F5, -2 }, { 0x011E0164, -1 }, { 0x017800EB, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01760104, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202500D6, -1 }, { 0x00000000, 0 }, { 0x0155011F, -1 }, { 0x0174011D, -2 },
+    { 0x00D30041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260162, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005800D5, -1 }, { 0x015000C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590161, -2 },
+    { 0x01320153, -1 }, { 0x005600EE, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201F0121, -1 },
+    { 0x0057017A, -1 }, { 0x004F2026, -1 }, { 0x00540107, -2 }, { 0x00EA201C, -1 },
+    { 0x01662014, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D013A, 1 }, { 0x201A00C7, -1 }, { 0x00520120, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0144002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B0153, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0129012B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0067006A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01000079, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040178, -3 }, { 0x00280113, -1 },
+    { 0x00DD2026, -3 }, { 0x0159201E, -2 }, { 0x015E00FF, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00AD, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF013B, -1 }, { 0x00DE0139, -1 }, { 0x00DB00C6, -2 },
+    { 0x007B0059, 1 }, { 0x00FD0137, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D900DF, -1 }, { 0x017400D5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01560163, -1 },
+    { 0x01750161, -1 }, { 0x013400F2, -1 }, { 0x017200EE, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590119, -2 }, { 0x00780117, -1 }, { 0x0132010B, -1 },
+    { 0x00EE0029, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00F2, -2 }, { 0x00000000, 0 },
+    { 0x005200D8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B010B, -1 }, { 0x00000000, 0 },
+    { 0x004B2010, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00E4201F, -1 }, { 0x002F010C, -1 }, { 0x0103201D, -1 },
+    { 0x01412019, -1 }, { 0x00670022, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B0121, -1 },
+    { 0x20110057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C300C1, 1 }, { 0x00440056, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00670153, -1 }, { 0x00C100DA, -2 }, { 0x00000000, 0 },
+    { 0x00DD0065, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20166, -3 }, { 0x00BF00F3, -1 },
+    { 0x01000162, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013C0177, -1 },
+    { 0x01390104, 1 }, { 0x01580102, 1 }, { 0x0079002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600D2, -1 },
+    { 0x00000000, 0 }, { 0x00DA0123, -1 }, { 0x0137011D, -1 }, { 0x01750119, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013200C3, -1 },
+    { 0x0075005C, -1 }, { 0x00D20056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250177, -3 }, { 0x00000000, 0 }, { 0x0079015B, -1 }, { 0x00000000, 0 },
+    { 0x005700EA, -2 }, { 0x007600E8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00EB2018, -1 }, { 0x00550103, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B00C3, -2 }, { 0x014E017F, -1 }, { 0x203A00C1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C014F, -1 }, { 0x00000000, 0 }, { 0x00510135, 3 }, { 0x00CD012D, 1 },
+    { 0x002F00C4, -3 }, { 0x002C0051, -1 }, { 0x004B004F, -1 }, { 0x004E00C2, -1 },
+    { 0x00C70047, -1 }, { 0x01680123, -1 }, { 0x201A0168, -1 }, { 0x20390166, -1 },
+    { 0x0147013E, 1 }, { 0x002D00DD, -1 }, { 0x004C00DB, -1 }, { 0x0103005C, -3 },
+    { 0x01410058, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0169, -1 }, { 0x004A00F4, -1 }, { 0x012300E6, -1 }, { 0x00C30079, -2 },
+    { 0x00E20077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0067010B, -1 }, { 0x013B201C, -1 },
+    { 0x015A201A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0157002E, -2 }, { 0x0176002C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC00C2, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD014E, -2 }, { 0x01780144, -1 }, { 0x00BB00DD, -1 },
+    { 0x015600D3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0157015F, -1 }, { 0x005C00FC, -1 },
+    { 0x00762019, 1 }, { 0x01510079, -1 }, { 0x01700077, -1 }, { 0x0176015D, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01740176, 1 },
+    { 0x00790113, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054002F, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0062, 1 }, { 0x005500BB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016A00C2, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0107, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0120, -1 }, { 0x00000000, 0 },
+    { 0x004A2025, -1 }, { 0x00710177, 1 }, { 0x00C6201D, 1 }, { 0x00E5201B, -1 },
+    { 0x01042019, -2 }, { 0x016600F4, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201500C6, -1 }, { 0x0164010D, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002A0153, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0063, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C30162, -3 }, { 0x011D00E9, -1 }, { 0x00DC007A, -1 },
+    { 0x00FB0078, 1 }, { 0x01770070, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D82025, -1 }, { 0x00DD0106, -2 },
+    { 0x0154201D, -1 }, { 0x015900FE, -1 }, { 0x0173201B, -1 }, { 0x017800FC, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB011F, -1 }, { 0x01380119, -1 }, { 0x00590041, -3 }, { 0x01570117, -1 },
+    { 0x0170002F, -2 }, { 0x01760115, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D600C5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E201F, -2 },
+    { 0x20260173, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007700E4, -1 },
+    { 0x00550073, -1 }, { 0x00D1006B, 1 }, { 0x016C0061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0051201E, -1 },
+    { 0x005600FF, -1 }, { 0x0070201C, -1 }, { 0x007500FD, -1 }, { 0x016A007A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00BF, -3 },
+    { 0x01662025, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A00D8, -1 }, { 0x00000000, 0 }, { 0x00CE0129, 1 }, { 0x014A0121, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B0164, 1 }, { 0x203A0162, -1 }, { 0x00000000, 0 }, { 0x0129013C, 2 },
+    { 0x002E00D9, -1 }, { 0x004A0064, -1 }, { 0x016400C5, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B00F0, -1 }, { 0x00C40075, -1 }, { 0x0121006F, -1 },
+    { 0x014300E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002A010B, -1 }, { 0x00E400FF, -1 }, { 0x00FE201C, -1 },
+    { 0x010300FD, -1 }, { 0x013C2018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0158002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01560043, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20252018, -2 }, { 0x00000000, 0 },
+    { 0x00BF014C, -1 }, { 0x00DE014A, -1 }, { 0x00000000, 0 }, { 0x007B006A, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0041016D, -1 }, { 0x00000000, 0 }, { 0x013600EA, -1 },
+    { 0x01330077, -1 }, { 0x015500E8, -1 }, { 0x017400E6, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA017C, -1 }, { 0x01560174, -2 },
+    { 0x01340103, -1 }, { 0x017200FF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201F00EA, -1 }, { 0x201C0077, 1 }, { 0x00000000, 0 }, { 0x010E00C4, -1 },
+    { 0x0051005D, 1 }, { 0x014C00C0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0103, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01660064, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A011A, -1 }, { 0x00530175, -1 },
+    { 0x00500102, -3 }, { 0x01432011, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190135, 1 }, { 0x00000000, 0 },
+    { 0x0168017C, -1 }, { 0x002F011D, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C4002D, -1 }, { 0x01210027, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A00C3, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A014D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FF00E7, -1 }, { 0x00000000, 0 }, { 0x00DD0076, -1 },
+    { 0x0178006C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20177, -2 }, { 0x0043010C, -1 }, { 0x00DE0102, -2 },
+    { 0x00E10175, -1 }, { 0x00F8201F, -1 }, { 0x01000173, -1 }, { 0x01552019, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01770111, -1 },
+    { 0x20250057, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BB0136, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900E2, -2 }, { 0x0056006F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00712018, -1 }, { 0x005700FB, -1 },
+    { 0x00000000, 0 }, { 0x016B0076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D4017F, -1 },
+    { 0x016C0102, -2 }, { 0x016F0175, -1 }, { 0x004F002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F00D5, -1 },
+    { 0x010800C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0166014D, -2 },
+    { 0x006B00EA, -1 }, { 0x00680077, -2 }, { 0x01600067, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D0178, -1 },
+    { 0x00C1201C, -3 }, { 0x004A0105, -1 }, { 0x00FF2018, 1 }, { 0x010400F9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201000C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013E0127, 3 },
+    { 0x00000000, 0 }, { 0x0157003F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DF0146, -1 },
+    { 0x00000000, 0 }, { 0x004100DD, -3 }, { 0x0117005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD015F, -2 }, { 0x00592013, -1 }, { 0x013700E6, -1 }, { 0x00F60077, -1 },
+    { 0x017500E2, -1 }, { 0x01780155, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C010D, -1 }, { 0x014F201C, -1 },
+    { 0x015400FD, -1 }, { 0x016E201A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0073, -2 }, { 0x00000000, 0 }, { 0x00D100C4, -1 }, { 0x00520059, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019201E, -2 },
+    { 0x201E00FF, -3 }, { 0x00000000, 0 }, { 0x007200E3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C201D, -1 }, { 0x01062011, -1 },
+    { 0x010E0165, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01660105, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0164011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004600EF, 1 }, { 0x011F00E1, -1 }, { 0x00BF0074, -1 }, { 0x00FD0070, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C30173, -1 }, { 0x00C00100, 1 }, { 0x00F9201B, -1 }, { 0x01182019, 1 },
+    { 0x01562015, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0117, -2 }, { 0x0159010F, -1 },
+    { 0x0178010D, -2 }, { 0x00F6002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D5004A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057006B, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00722014, -1 }, { 0x007700F5, -1 }, { 0x00000000, 0 },
+    { 0x010F0078, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01130177, -1 }, { 0x01100104, -1 },
+    { 0x0149201F, -1 }, { 0x0050002A, 2 }, { 0x014E0100, -1 }, { 0x203A0042, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540129, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D015C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C005C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0175, 1 },
+    { 0x20180102, -2 }, { 0x0050015B, -1 }, { 0x00000000, 0 }, { 0x016400D6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0174, 1 }, { 0x00AB016E, -1 },
+    { 0x006A00FF, -1 }, { 0x00C22018, -3 }, { 0x01002014, -1 }, { 0x016200EF, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20140134, -1 }, { 0x201100C1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00280135, 1 }, { 0x00660131, 1 }, { 0x004400C0, -1 },
+    { 0x015E0121, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20100166, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FF0140, -1 },
+    { 0x017800C5, -3 }, { 0x01560054, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF015D, -1 },
+    { 0x00000000, 0 }, { 0x013800E2, -1 }, { 0x015700E0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0139016E, -1 }, { 0x00772026, -3 }, { 0x00D90101, -1 }, { 0x00F3201E, -1 },
+    { 0x00F800FF, -1 }, { 0x011700FD, -1 }, { 0x013600FB, -1 }, { 0x0158016C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014D002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0132012D, 1 }, { 0x00D200C0, -1 }, { 0x01700129, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005400E1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E201B, -2 }, { 0x005200FA, -1 }, { 0x010F0161, 1 },
+    { 0x016C015B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B012D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A002D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01080120, -1 }, { 0x00000000, 0 }, { 0x012400AB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014100C2, 1 },
+    { 0x00C20057, -3 }, { 0x016000C0, -1 }, { 0x00000000, 0 }, { 0x20150178, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x012000DD, -1 }, { 0x00DF006E, -1 }, { 0x011D006A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C4016F, -1 },
+    { 0x00C100FC, -1 }, { 0x00FF00F8, -1 }, { 0x0102016B, -1 }, { 0x01572011, -1 },
+    { 0x0178007D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0115, -1 }, { 0x00FD0111, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BB0147, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00770065, -1 }, { 0x01500057, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0166, -2 }, { 0x005900F3, -2 }, { 0x013200E5, -1 }, { 0x00F10076, -2 },
+    { 0x01100074, 1 }, { 0x017000E1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00F50175, -1 }, { 0x0057010C, -1 }, { 0x00D30104, -1 },
+    { 0x012B201D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D1011D, -1 },
+    { 0x201A0059, -3 }, { 0x20390057, -1 }, { 0x0166002D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0072013C, -1 }, { 0x00AD00C5, -1 }, { 0x004D0058, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900FE, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F00E6, -3 }, { 0x004B0071, -1 },
+    { 0x004E00E4, -1 }, { 0x010800D8, -1 }, { 0x01430061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0066201A, -1 }, { 0x004C00FD, -1 },
+    { 0x00C32014, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011D0022, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20110162, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004300D5, -1 },
+    { 0x00BF00CD, -1 }, { 0x00DE00CB, -1 }, { 0x013B00C5, 1 }, { 0x015A00C3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DF0157, -1 },
+    { 0x00DC00E4, -1 }, { 0x011D0153, -1 }, { 0x015800DC, -1 }, { 0x01740067, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F4201A, -1 }, { 0x00DA00FD, -1 }, { 0x01132018, -1 }, { 0x017500F3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C011E, -1 }, { 0x00000000, 0 }, { 0x005900AB, -1 },
+    { 0x0110002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00790135, 1 }, { 0x201F006B, 1 },
+    { 0x005700C4, -4 }, { 0x00540051, -1 }, { 0x014C0041, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580150, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012B005C, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560169, -1 }, { 0x004E2015, -1 }, { 0x007200F4, -1 }, { 0x00CF00EE, 1 },
+    { 0x00EB0079, -1 }, { 0x016A00E4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0129, 1 }, { 0x010E0176, -1 }, { 0x00000000, 0 }, { 0x014900FF, -2 },
+    { 0x016800FD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2018015B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010400C2, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C70152, -1 }, { 0x006700E5, -1 }, { 0x010200DB, -2 },
+    { 0x00FF0068, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041201F, -3 }, { 0x00270102, -1 },
+    { 0x00460100, -3 }, { 0x00C5016B, -1 }, { 0x011F00F2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011D010B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0178011E, -2 }, { 0x00000000, 0 }, { 0x015600AD, -1 },
+    { 0x005B004A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760137, 1 }, { 0x005C00D6, -1 },
+    { 0x015400C6, 1 }, { 0x00590063, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01740150, -1 },
+    { 0x005A00EF, 1 }, { 0x00000000, 0 }, { 0x00D30074, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00722025, -2 }, { 0x00580108, -1 }, { 0x00D40100, -1 }, { 0x00EE201D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560121, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A00FA, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180113, -1 },
+    { 0x00000000, 0 }, { 0x00AD0166, -1 }, { 0x002E00FB, -1 }, { 0x00C42010, -1 },
+    { 0x01420076, 1 }, { 0x016400E7, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01270177, -2 }, { 0x00C7010A, -1 },
+    { 0x01430102, -1 }, { 0x01460175, -2 }, { 0x015D201F, -1 }, { 0x01620100, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0049012B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FF0151, -1 }, { 0x00DD00E0, -2 },
+    { 0x01370067, -1 }, { 0x01750063, -1 }, { 0x017800D6, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF016E, -1 }, { 0x0079201E, -3 },
+    { 0x00DE016C, -1 }, { 0x013800F3, -1 }, { 0x013B0166, -2 }, { 0x017600EF, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500C1, 1 },
+    { 0x00000000, 0 }, { 0x0136010C, -1 }, { 0x01740108, -1 }, { 0x00D3002C, -1 },
+    { 0x00F2002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01720121, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059014C, -2 }, { 0x00F40142, 1 },
+    { 0x00000000, 0 }, { 0x00720064, -1 }, { 0x00EE005C, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00760163, 1 },
+    { 0x00000000, 0 }, { 0x005400F2, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0125, 1 },
+    { 0x0055017E, -1 }, { 0x0145201A, -1 }, { 0x01642018, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B013E, 1 }, { 0x00000000, 0 }, { 0x20150058, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500DB, -2 }, { 0x017C005C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00612019, -1 }, { 0x00DD2011, -1 },
+    { 0x013C0079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FF0109, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF0126, -1 }, { 0x00DE0124, -1 }, { 0x01742039, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250079, -3 }, { 0x00000000, 0 }, { 0x013600C4, 1 },
+    { 0x00D60057, -1 }, { 0x017400C0, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BB0158, -1 }, { 0x0156014E, -1 },
+    { 0x00000000, 0 }, { 0x00580078, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0177, -1 },
+    { 0x00590104, -3 }, { 0x007B0175, 1 }, { 0x00EF2019, 1 }, { 0x013200F6, -1 },
+    { 0x01540167, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201F00C4, -2 }, { 0x0057011D, -2 }, { 0x0076011B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00DD, 1 }, { 0x00000000, 0 }, { 0x005200C3, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0169, -1 }, { 0x201B00F6, -1 }, { 0x00000000, 0 }, { 0x0072014D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019010F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01050076, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00EA0177, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01230119, -1 },
+    { 0x00000000, 0 }, { 0x00440041, -1 }, { 0x015B002F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C100C5, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF00DE, -1 }, { 0x00DE00DC, -1 },
+    { 0x01380063, -1 }, { 0x01570061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C0016A, -2 }, { 0x004100FF, -2 },
+    { 0x017700EB, -1 }, { 0x01740078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01512025, -1 },
+    { 0x00BB0110, -1 }, { 0x01560106, -1 }, { 0x0077002E, -3 }, { 0x01780177, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B012D, 1 }, { 0x01350121, -1 }, { 0x00D20041, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250162, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700D5, -1 },
+    { 0x010E0056, -1 }, { 0x016E00C3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A2025, -1 }, { 0x00000000, 0 }, { 0x0077015F, -1 }, { 0x00000000, 0 },
+    { 0x005500EE, 1 }, { 0x00710079, 1 }, { 0x00D100E6, -1 }, { 0x014A006B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056017A, -1 },
+    { 0x004E2026, -1 }, { 0x00720105, -1 }, { 0x00E9201C, -1 }, { 0x01272018, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C013A, 1 },
+    { 0x201900C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E00AD, -1 },
+    { 0x0143002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0128012B, 1 },
+    { 0x01470129, 2 }, { 0x01600041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01450142, 1 }, { 0x00000000, 0 }, { 0x0066006A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C016D, -1 }, { 0x004B016B, -1 }, { 0x006700F6, -1 }, { 0x012100EA, -1 },
+    { 0x0143015B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01220176, -1 }, { 0x00460111, -1 }, { 0x00DC2026, -1 },
+    { 0x011F0103, -1 }, { 0x01410174, -2 }, { 0x0177201C, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260075, -1 }, { 0x00000000, 0 }, { 0x00BB00C8, -1 }, { 0x00DA00C6, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01760148, -1 }, { 0x005C00E7, -1 }, { 0x00D800DF, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0074201D, 1 }, { 0x007900FE, -1 },
+    { 0x01360165, -1 }, { 0x01740161, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0172017A, -1 },
+    { 0x00770117, -1 }, { 0x016A2026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E00D9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00F2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F0067, -3 }, { 0x016800C6, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D017E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A2010, -1 },
+    { 0x00520164, -2 }, { 0x014700E1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00E3201F, -1 }, { 0x002E010C, -1 }, { 0x0102201D, -2 }, { 0x0121201B, 1 },
+    { 0x00660022, 3 }, { 0x016400F8, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006A0121, -1 }, { 0x01620111, -2 },
+    { 0x20100057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C200C1, 1 }, { 0x00000000, 0 }, { 0x00BF004E, -1 }, { 0x00DE004C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C000DA, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+};
+
 static const EpdFontData bookerly_14_bold = {
     bookerly_14_boldBitmaps,
     bookerly_14_boldGlyphs,
@@ -5084,4 +13292,8 @@ static const EpdFontData bookerly_14_bold = {
     31,
     -8,
     true,
+    nullptr,
+    &bookerly_14_boldMetrics,
+    bookerly_14_boldKernPairs,
+    32768,
 };
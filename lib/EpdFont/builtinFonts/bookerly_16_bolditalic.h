@@ -3,7 +3,7 @@
  * name: bookerly_16_bolditalic
  * size: 16
  * mode: 2-bit
- * Command used: fontconvert.py bookerly_16_bolditalic 16 ../builtinFonts/source/Bookerly/Bookerly-BoldItalic.ttf --2bit
+ * Command used: fontconvert.py bookerly_16_bolditalic 16 ../builtinFonts/source/Bookerly/Bookerly-BoldItalic.ttf --2bit --kern-manifest font-manifest.txt
  */
 #pragma once
 #include "EpdFontData.h"
@@ -6436,6 +6436,8214 @@ static const EpdUnicodeInterval bookerly_16_bolditalicIntervals[] = {
     { 0xFFFD, 0xFFFD, 0x2EA },
 };
 
+static const EpdFontMetrics bookerly_16_bolditalicMetrics = {
+    17, 46, 7,
+    -7, 45, 34, -10,
+    {
+        7, 11, 13, 21, 21, 32, 29, 7, 14, 14, 13, 21, 10, 13, 10, 17,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 10, 10, 21, 21, 21, 13,
+        33, 24, 21, 22, 24, 21, 19, 24, 26, 13, 13, 24, 19, 30, 26, 24,
+        20, 25, 22, 18, 22, 26, 24, 33, 22, 22, 20, 11, 17, 11, 21, 17,
+        20, 20, 18, 15, 20, 16, 14, 17, 20, 11, 10, 18, 11, 29, 20, 18,
+        19, 19, 16, 14, 14, 20, 17, 25, 19, 17, 16, 14, 10, 14, 21,
+    },
+};
+
+static const EpdKernPair bookerly_16_bolditalicKernPairs[32768] = {
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10166, -2 }, { 0x00DD00F1, -1 }, { 0x015900E9, -1 },
+    { 0x01560076, -1 }, { 0x017800E7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF017F, 4 }, { 0x00DB010A, -1 },
+    { 0x013B0177, -1 }, { 0x0059002C, -3 }, { 0x01760100, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500D2, -1 }, { 0x00000000, 0 },
+    { 0x00D90123, -1 }, { 0x0117011F, -1 }, { 0x0155011B, -1 }, { 0x00F2003B, -1 },
+    { 0x01740119, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015000C1, -1 }, { 0x0074005C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0059015D, -2 }, { 0x00000000, 0 }, { 0x005600EA, -2 },
+    { 0x00CF006F, -1 }, { 0x014E00DA, -1 }, { 0x016A0065, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570176, 1 }, { 0x00D3016E, -1 },
+    { 0x00540103, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0136, -2 }, { 0x201A00C3, 1 },
+    { 0x00000000, 0 }, { 0x0052011C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B014F, -3 },
+    { 0x201800DC, -1 }, { 0x00000000, 0 }, { 0x01290127, 3 }, { 0x002E00C4, 1 },
+    { 0x004D00C2, 1 }, { 0x01040043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190168, -2 }, { 0x00000000, 0 }, { 0x002F0150, -1 }, { 0x00000000, 0 },
+    { 0x002C00DD, -2 }, { 0x00480068, 1 }, { 0x00670066, 3 }, { 0x0102005C, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004900F4, -1 }, { 0x00C500EC, -1 }, { 0x00C20079, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01040174, -4 }, { 0x0028010F, -1 }, { 0x0066010B, -1 }, { 0x0159201A, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1011E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0175002C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0137, -1 },
+    { 0x00000000, 0 }, { 0x00DB00C2, -2 }, { 0x005C0057, -3 }, { 0x01540047, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DC014E, -1 }, { 0x00000000, 0 }, { 0x013600D5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260116, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013400EE, 1 },
+    { 0x017200EA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01540178, -2 }, { 0x00590115, -1 },
+    { 0x01700103, -1 }, { 0x201E0049, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016E011C, -1 }, { 0x00000000, 0 }, { 0x012A003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005200D4, -1 }, { 0x014A00C4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B0107, -3 }, { 0x016A014E, -1 }, { 0x00CC00E5, -1 },
+    { 0x00000000, 0 }, { 0x0126006C, 1 }, { 0x01640068, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190120, -2 }, { 0x00000000, 0 }, { 0x00492025, -1 },
+    { 0x002F0108, -1 }, { 0x00C5201D, -3 }, { 0x00E4201B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006B011D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00E1002F, 1 }, { 0x013E0029, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0104012C, 1 }, { 0x002800C7, -1 },
+    { 0x004700C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480151, -1 },
+    { 0x00C100D6, -1 }, { 0x00C40149, -1 }, { 0x00DD0061, -1 }, { 0x01020145, 1 },
+    { 0x01780057, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C20162, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01570072, 1 },
+    { 0x01760070, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011D0175, 2 }, { 0x00DC0106, -1 }, { 0x20250042, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202600CE, 1 }, { 0x00000000, 0 }, { 0x00DA011F, -1 },
+    { 0x00000000, 0 }, { 0x00580041, 1 }, { 0x016F002F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0140, 1 }, { 0x007B013E, 2 }, { 0x00D500C5, -1 }, { 0x014E004A, -1 },
+    { 0x01540130, 1 }, { 0x00000000, 0 }, { 0x20250173, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700E6, -2 }, { 0x00540073, -1 },
+    { 0x016E00D4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0050201E, -3 }, { 0x006F201C, -1 },
+    { 0x00D4016A, -1 }, { 0x01500162, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0132, 1 }, { 0x201B00BF, -3 }, { 0x0110017F, -1 },
+    { 0x016A0106, -1 }, { 0x2018004C, -1 }, { 0x00C9002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900D8, -2 },
+    { 0x00000000, 0 }, { 0x0168011F, -1 }, { 0x002F00C0, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0164, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0128013C, 1 }, { 0x0147013A, 1 },
+    { 0x00490064, -1 }, { 0x00C5005C, -5 }, { 0x01220056, -1 }, { 0x01410054, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0165, -1 }, { 0x006C0161, 1 },
+    { 0x01260155, 1 }, { 0x01450153, -1 }, { 0x01640151, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00480109, -1 }, { 0x00622026, -2 }, { 0x00DE201E, -3 }, { 0x010200FD, -2 },
+    { 0x011C201A, -1 }, { 0x012100FB, 2 }, { 0x013B2018, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2011A, 1 }, { 0x01000116, 1 },
+    { 0x0138002C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00133, -1 }, { 0x011D012D, 1 },
+    { 0x004100C8, 1 }, { 0x01740041, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01780140, 2 }, { 0x015600CF, 1 }, { 0x005B006C, 2 }, { 0x0153005C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01760159, -1 }, { 0x007B00F6, -1 }, { 0x00000000, 0 }, { 0x01700073, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F02026, -2 }, { 0x016C201E, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520044, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0103, -3 }, { 0x00000000, 0 }, { 0x00CD00E1, -1 }, { 0x00000000, 0 },
+    { 0x002F0078, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A011C, -1 }, { 0x00520175, -1 }, { 0x004F0102, -1 },
+    { 0x012800F4, -1 }, { 0x014700F2, -1 }, { 0x016600F0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0048203A, -1 },
+    { 0x002E011D, 1 }, { 0x0126010D, -1 }, { 0x0145010B, -1 }, { 0x01640109, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0136, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10046, 1 }, { 0x017B003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0049014D, -1 }, { 0x00C200D2, -1 },
+    { 0x00C50145, 1 }, { 0x010000CE, 1 }, { 0x011C0059, -1 }, { 0x013B0057, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00470166, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10177, -2 }, { 0x00DD0102, -3 }, { 0x01542019, -1 }, { 0x017800F8, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB011B, -1 }, { 0x01570113, -1 },
+    { 0x01760111, -1 }, { 0x0132002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D600C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E201B, -3 }, { 0x2026016F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005800E2, -1 }, { 0x0055006F, -1 }, { 0x00D10067, -1 },
+    { 0x00D400DA, -1 }, { 0x012E0061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0051201A, -2 }, { 0x00702018, -1 }, { 0x00D50166, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D3017F, -1 }, { 0x01282025, -1 },
+    { 0x014C0104, -1 }, { 0x004E002E, -2 }, { 0x20190048, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0147, -2 }, { 0x201A00D4, -1 }, { 0x00000000, 0 },
+    { 0x00CE0125, 1 }, { 0x014A011D, -1 }, { 0x00000000, 0 }, { 0x0106003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0160, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CC013E, 1 }, { 0x002E00D5, -1 }, { 0x01040054, -2 },
+    { 0x014500C3, -1 }, { 0x016400C1, -3 }, { 0x00000000, 0 }, { 0x20190179, -1 },
+    { 0x00000000, 0 }, { 0x002F0161, -3 }, { 0x004E015F, -1 }, { 0x006D015D, 1 },
+    { 0x00670077, 2 }, { 0x0102006D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0178, -2 }, { 0x00C0201C, -3 },
+    { 0x00490105, -1 }, { 0x00C500FD, -2 }, { 0x00FE2018, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00280120, -1 }, { 0x00C30116, 1 }, { 0x00000000, 0 }, { 0x00DC002E, -3 },
+    { 0x011A002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1012F, -1 }, { 0x004200C4, -1 },
+    { 0x00DA0047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB00D3, -1 }, { 0x005C0068, 1 }, { 0x007B0066, 2 }, { 0x01540058, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC015F, -1 },
+    { 0x00000000, 0 }, { 0x013600E6, -1 }, { 0x015500E4, -1 }, { 0x017400E2, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01560170, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016A002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0073, -2 },
+    { 0x00000000, 0 }, { 0x00D000C4, -1 }, { 0x00510059, -1 }, { 0x010E00C0, -1 },
+    { 0x01680047, -1 }, { 0x00000000, 0 }, { 0x2018201E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01280064, -1 },
+    { 0x01470062, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B0118, -1 }, { 0x012C0163, -1 }, { 0x00CC00F6, -1 }, { 0x016A015F, -1 },
+    { 0x01640079, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190131, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0119, -3 },
+    { 0x004E0117, -1 }, { 0x00000000, 0 }, { 0x0067002F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0104013D, 1 }, { 0x002800D8, -1 }, { 0x00C300CE, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x017B00DB, -1 }, { 0x00DD0072, -1 }, { 0x01780068, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F8201B, -1 },
+    { 0x011F016D, 2 }, { 0x013E016B, 1 }, { 0x01742013, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410121, 1 }, { 0x00DC0117, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01560128, 1 }, { 0x00000000, 0 },
+    { 0x00580052, 1 }, { 0x00D4004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B014F, -1 },
+    { 0x013200D0, 1 }, { 0x0056006B, 2 }, { 0x01540141, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005A016A, -1 }, { 0x00D60162, -1 }, { 0x013000E9, -1 }, { 0x016E00E5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0167201D, 1 }, { 0x016C00FE, 1 }, { 0x201A0044, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0143, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012C011B, -1 },
+    { 0x016A0117, -1 }, { 0x002E0045, 1 }, { 0x00C9003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C015C, -1 }, { 0x201900E9, -3 }, { 0x00000000, 0 },
+    { 0x00CD013A, 1 }, { 0x00000000, 0 }, { 0x004B005C, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0175, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0128014D, -1 }, { 0x00000000, 0 }, { 0x00680073, 1 },
+    { 0x00C5006D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0176, -2 }, { 0x004D0174, -1 }, { 0x00C12018, -3 },
+    { 0x014200F1, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C40112, 1 }, { 0x00000000, 0 }, { 0x00DD002A, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C2012B, -1 }, { 0x013E0123, 1 }, { 0x00DB0043, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00144, -1 }, { 0x004100D9, -2 },
+    { 0x00D9005C, 1 }, { 0x015800C7, -1 }, { 0x01740052, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD015B, -2 }, { 0x01590153, -1 },
+    { 0x00DA00E8, -1 }, { 0x0172006B, 1 }, { 0x01780151, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00762026, -2 }, { 0x007B0107, -1 }, { 0x00F2201E, -2 }, { 0x0130201A, -1 },
+    { 0x014F2018, -1 }, { 0x015400F9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D12039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0073003A, -1 }, { 0x014C002C, -2 }, { 0x016B002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D006F, -3 }, { 0x00000000, 0 },
+    { 0x00D100C0, -1 }, { 0x00520055, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019201A, -6 }, { 0x201E00FB, -1 }, { 0x00560154, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0167005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0114, -1 },
+    { 0x00000000, 0 }, { 0x004C2019, -1 }, { 0x00CD00F2, -1 }, { 0x01270079, -1 },
+    { 0x01460077, -1 }, { 0x016800E8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01280105, -1 },
+    { 0x01470103, -1 }, { 0x01660101, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E012E, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0147, 1 }, { 0x01240137, 1 }, { 0x00C400CA, 1 }, { 0x00C10057, -4 },
+    { 0x010200C6, 2 }, { 0x00000000, 0 }, { 0x20140178, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004600EB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00660175, 1 }, { 0x00440104, -1 },
+    { 0x00A100FE, -1 }, { 0x01562011, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0042011D, -1 }, { 0x00DD0113, -1 }, { 0x0159010B, -1 }, { 0x01780109, -1 },
+    { 0x2026004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01760122, -1 }, { 0x005C00C1, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A00DA, -1 },
+    { 0x00570067, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01340158, 1 },
+    { 0x005800F3, -1 }, { 0x00000000, 0 }, { 0x00D10078, -1 }, { 0x010F0074, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0149201B, -1 }, { 0x0056010C, -1 }, { 0x00D20104, -1 }, { 0x01100100, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00CC, -1 }, { 0x00000000, 0 }, { 0x00540125, 1 }, { 0x20190059, -1 },
+    { 0x002F0041, -3 }, { 0x0146002F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014700BB, -1 }, { 0x004C0058, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CC014F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C00FF, -2 }, { 0x004B00FD, -1 },
+    { 0x016200EB, -1 }, { 0x017E0076, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0062002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0178203A, -1 },
+    { 0x0066012D, 3 }, { 0x00000000, 0 }, { 0x00410049, 1 }, { 0x011A003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017800C1, -3 }, { 0x00000000, 0 },
+    { 0x01560050, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB00E4, -1 },
+    { 0x005C0079, -2 }, { 0x0135006B, 2 }, { 0x01730067, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F3201A, -2 },
+    { 0x00F800FB, 1 }, { 0x0139016A, -1 }, { 0x015500F5, -1 }, { 0x01580168, -2 },
+    { 0x017400F3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01340110, 1 }, { 0x005800AB, -1 }, { 0x00F0002E, -2 },
+    { 0x0172010C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590137, 2 }, { 0x01320129, 1 }, { 0x005600C4, -4 },
+    { 0x01700125, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570150, -1 }, { 0x01300142, 1 },
+    { 0x005400DD, 1 }, { 0x0051006A, 2 }, { 0x00CD0062, 1 }, { 0x016E013E, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D10161, -1 },
+    { 0x00000000, 0 }, { 0x014A00E6, -1 }, { 0x01090077, 1 }, { 0x01470073, -1 },
+    { 0x01660071, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0050010F, -1 }, { 0x00CC0107, -1 }, { 0x0143201E, -2 },
+    { 0x014800FF, -1 }, { 0x0162201C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190142, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C500C6, 2 }, { 0x0100004F, -1 }, { 0x012200C0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0104014E, -1 }, { 0x002800E9, -1 }, { 0x006600E5, -1 }, { 0x011D0066, 3 },
+    { 0x012000D9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00670171, 2 }, { 0x00C100F8, 1 }, { 0x01020167, -1 },
+    { 0x01210165, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011F017E, 1 }, { 0x00BF0111, -1 },
+    { 0x013E017C, 1 }, { 0x01552026, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410132, 1 }, { 0x01580120, -1 }, { 0x017400AB, -1 }, { 0x0152003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01560139, 1 }, { 0x00000000, 0 }, { 0x017200C4, -2 },
+    { 0x00580063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0162, -2 }, { 0x005900EF, 2 },
+    { 0x01540152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00712025, -1 },
+    { 0x00570108, -1 }, { 0x00D30100, -1 }, { 0x012B2019, 1 }, { 0x016E00F6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00C8, -2 }, { 0x00550121, -1 }, { 0x00D10119, -1 }, { 0x012E0113, -1 },
+    { 0x004F003B, -1 }, { 0x016C010F, -1 }, { 0x201A0055, -1 }, { 0x201E0154, 1 },
+    { 0x201B00E1, -3 }, { 0x00000000, 0 }, { 0x00720138, 1 }, { 0x00000000, 0 },
+    { 0x002E0056, -3 }, { 0x01640042, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201900FA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F00E2, -3 }, { 0x004B006D, -1 }, { 0x004E00E0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00472018, -1 }, { 0x004F016C, -1 }, { 0x00000000, 0 }, { 0x01410076, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FF2025, -2 }, { 0x01040106, -1 }, { 0x01260177, 2 },
+    { 0x0044002C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670129, 1 },
+    { 0x00C40123, 1 }, { 0x0102011F, 1 }, { 0x00DD003B, -2 }, { 0x0121011D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01000138, -1 }, { 0x011C00C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C00155, -1 }, { 0x00DC00E0, -1 }, { 0x013900DA, -1 },
+    { 0x01550065, -1 }, { 0x015800D8, -1 }, { 0x01740063, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00420176, -1 }, { 0x01780162, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00572039, -1 },
+    { 0x005C011A, 1 }, { 0x0154010A, -1 }, { 0x00D2002C, -2 }, { 0x00F1002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700C0, -4 }, { 0x010E0041, -1 },
+    { 0x012D003F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0058014C, -1 }, { 0x00F30142, 1 }, { 0x016C00C7, -1 },
+    { 0x00520066, -1 }, { 0x00ED005C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E010C, -1 }, { 0x00F1015B, 1 }, { 0x00000000, 0 },
+    { 0x007200F0, -1 }, { 0x00CF00EA, -1 }, { 0x012C00E4, -1 }, { 0x016A00E0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D00176, -1 },
+    { 0x010E0172, -1 }, { 0x00CD0103, -1 }, { 0x010B00FF, 1 }, { 0x0125201C, -1 },
+    { 0x014C016E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0160002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E013F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00470057, -1 }, { 0x00C3004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0158, 1 },
+    { 0x004800E3, -1 }, { 0x00C400DB, -2 }, { 0x017B005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0041201B, -3 }, { 0x00C50167, -1 }, { 0x011F00EE, 1 }, { 0x013B0079, -1 },
+    { 0x013E00EC, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x017D0174, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C00D2, -1 }, { 0x015400C2, 2 }, { 0x00D50057, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01360150, -1 }, { 0x0174014C, -1 }, { 0x00000000, 0 },
+    { 0x00570078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007A0175, 1 }, { 0x00580104, 1 },
+    { 0x00EE2019, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00C4, 1 },
+    { 0x0056011D, -2 }, { 0x201B0051, -1 }, { 0x00000000, 0 }, { 0x01290029, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005100C3, -1 }, { 0x00CD00BB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0169, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F00DC, -1 },
+    { 0x006B0067, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2018010F, -3 }, { 0x00000000, 0 }, { 0x00500168, -1 },
+    { 0x012600E7, -1 }, { 0x014500E5, -1 }, { 0x01040076, -2 }, { 0x01230074, 1 },
+    { 0x01420072, 1 }, { 0x016400E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013E201D, 3 }, { 0x002C0110, 1 }, { 0x014300FE, 1 }, { 0x017C2019, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490127, 1 }, { 0x00C5011F, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280142, 2 },
+    { 0x0066013E, 3 }, { 0x00C000C5, 1 }, { 0x00C30138, -1 }, { 0x01580048, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x017800D2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0079201A, -2 }, { 0x00BF016A, -1 }, { 0x00DB00F5, -1 },
+    { 0x00DE0168, -1 }, { 0x011C0164, -1 }, { 0x013B0162, -1 }, { 0x017600EB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01502025, -2 }, { 0x01360108, -1 },
+    { 0x01740104, -4 }, { 0x0076002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01150123, -1 }, { 0x0153011F, -1 }, { 0x00D10041, -1 }, { 0x012E003B, -1 },
+    { 0x0172011D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590148, -1 }, { 0x00780146, 1 }, { 0x005600D5, -1 }, { 0x0132013A, 1 },
+    { 0x014E00C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00570161, -2 }, { 0x01300153, -1 }, { 0x016E014F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0121, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800C7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A003A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190153, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C00C8, 1 },
+    { 0x004B00C6, 1 }, { 0x00C4004B, 1 }, { 0x01020047, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0046006C, 1 }, { 0x013E005C, 4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006600F6, -1 }, { 0x00000000, 0 }, { 0x011D0077, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01020178, -2 }, { 0x00DB2026, -3 }, { 0x0157201E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01362039, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C0042, 1 }, { 0x00D8003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410143, 1 },
+    { 0x20250075, -1 }, { 0x00D900C6, -3 }, { 0x013600C0, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DA0152, -1 }, { 0x0156014A, 1 }, { 0x017200D5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590100, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570119, -2 },
+    { 0x0130010B, -1 }, { 0x016E0107, -1 }, { 0x201C004D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00D9, -2 },
+    { 0x016C0120, -1 }, { 0x201A0066, 2 }, { 0x00000000, 0 }, { 0x0166003A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0165, -1 }, { 0x00000000, 0 },
+    { 0x201B00F2, -3 }, { 0x00720149, 1 }, { 0x00000000, 0 }, { 0x002E0067, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C017E, -1 },
+    { 0x2019010B, -3 }, { 0x00000000, 0 }, { 0x00510164, -1 }, { 0x002F00F3, -3 },
+    { 0x01680152, -1 }, { 0x0162006C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0120201B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011D002F, 1 }, { 0x017A0029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0048013C, 1 }, { 0x00C100C1, 1 },
+    { 0x00420056, -2 }, { 0x01020130, 1 }, { 0x01780042, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000149, -1 },
+    { 0x00BF00DA, -1 }, { 0x00000000, 0 }, { 0x00DB0065, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0044016E, -1 },
+    { 0x00C00166, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01550076, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01590175, 1 }, { 0x00DA010A, -1 }, { 0x01560102, 2 },
+    { 0x0058002C, -1 }, { 0x01780173, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0073005C, -1 }, { 0x00D00056, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005500EA, -1 }, { 0x00520077, -1 },
+    { 0x00CE006F, -1 }, { 0x00D100E2, -1 }, { 0x014A0067, -1 }, { 0x016C00D8, -1 },
+    { 0x201E011D, 1 }, { 0x00560176, 1 }, { 0x00D2016E, -1 }, { 0x00720101, -1 },
+    { 0x0110016A, -1 }, { 0x012C00F5, -1 }, { 0x014E0166, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0136, -1 }, { 0x201900C3, -5 }, { 0x014C017F, -1 },
+    { 0x0168010A, -1 }, { 0x00000000, 0 }, { 0x0105002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01280127, 1 }, { 0x01470125, 1 }, { 0x00C50047, -1 },
+    { 0x01220041, -1 }, { 0x01660123, -1 }, { 0x00000000, 0 }, { 0x20180168, -1 },
+    { 0x00000000, 0 }, { 0x002E0150, -1 }, { 0x01260140, 1 }, { 0x010400CF, 1 },
+    { 0x0028006A, 5 }, { 0x0101005C, -2 }, { 0x0145013E, 1 }, { 0x0164013C, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0169, -1 }, { 0x004800F4, -1 },
+    { 0x00C400EC, -1 }, { 0x00C10079, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50178, -2 },
+    { 0x0046010D, -1 }, { 0x011F00FF, 2 }, { 0x01220172, -1 }, { 0x0139201C, -2 },
+    { 0x013E00FD, 2 }, { 0x01410170, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C0011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0155002E, -3 }, { 0x0174002C, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0178012B, 2 },
+    { 0x00DA00C2, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB014E, -1 },
+    { 0x007B00E1, -1 }, { 0x00D800DB, -1 }, { 0x00590070, -1 }, { 0x0078006E, 1 },
+    { 0x01320062, 1 }, { 0x015400D3, -1 }, { 0x01570146, 1 }, { 0x01760144, -1 },
+    { 0x00F80165, 1 }, { 0x00742019, 1 }, { 0x01360161, -1 }, { 0x0174015D, -2 },
+    { 0x20250116, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580115, -1 }, { 0x012C2026, -1 },
+    { 0x201D0049, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00D5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00500048, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016800C2, -2 }, { 0x002F0063, -3 },
+    { 0x004E0061, -1 }, { 0x00000000, 0 }, { 0x201D017A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180120, -1 }, { 0x00000000, 0 }, { 0x00482025, -1 }, { 0x002E0108, -1 },
+    { 0x00C4201D, -3 }, { 0x00E3201B, -1 }, { 0x01022019, -3 }, { 0x012600F8, -1 },
+    { 0x014500F6, -1 }, { 0x016400F4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0121, 1 }, { 0x01240111, -1 }, { 0x0143010F, -1 }, { 0x00E0002F, 1 },
+    { 0x0162010D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50130, 1 }, { 0x004600C5, -3 }, { 0x00000000, 0 },
+    { 0x00BF004A, 4 }, { 0x00DE0048, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280153, -1 }, { 0x0066014F, -1 },
+    { 0x00C000D6, -1 }, { 0x00C30149, -1 }, { 0x00DC0061, -1 }, { 0x01580059, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10162, -2 },
+    { 0x015900E5, -1 }, { 0x017800E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D62025, -2 }, { 0x00DB0106, -1 }, { 0x0171201B, -1 }, { 0x017600FC, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202500CE, 1 }, { 0x00000000, 0 }, { 0x00D9011F, -1 }, { 0x01360119, -1 },
+    { 0x00570041, -4 }, { 0x01550117, -1 }, { 0x016E002F, -2 }, { 0x01740115, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0140, 2 },
+    { 0x00D400C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590159, -1 },
+    { 0x00780157, 1 }, { 0x005600E6, -2 }, { 0x00720071, -1 }, { 0x00CF006B, 1 },
+    { 0x011000DA, -1 }, { 0x012C0065, -1 }, { 0x016A0061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004F201E, -2 }, { 0x005400FF, 1 }, { 0x006E201C, -1 },
+    { 0x00D3016A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0132, -2 }, { 0x00000000, 0 }, { 0x002E2039, -1 }, { 0x00520118, 1 },
+    { 0x01642025, -3 }, { 0x00C8002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800D8, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E00C0, 1 }, { 0x0104003F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190164, -1 }, { 0x00000000, 0 },
+    { 0x002F014C, -1 }, { 0x00000000, 0 }, { 0x002C00D9, -1 }, { 0x00480064, -1 },
+    { 0x00C4005C, -5 }, { 0x01020058, 2 }, { 0x016200C5, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004900F0, -1 },
+    { 0x013E006D, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040170, -2 }, { 0x0028010B, -1 },
+    { 0x00660107, -1 }, { 0x00DD201E, -3 }, { 0x00FC201C, -1 }, { 0x01782014, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C1011A, 1 }, { 0x00000000, 0 }, { 0x0156002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01540043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260112, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x017200E6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01540174, -2 }, { 0x00590111, -1 }, { 0x201E0045, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014A2039, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00EA, -3 }, { 0x010F0137, 4 },
+    { 0x005200D0, 1 }, { 0x014A00C0, -1 }, { 0x201A0077, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0176, -2 }, { 0x00000000, 0 }, { 0x201B0103, -3 },
+    { 0x00000000, 0 }, { 0x005000E9, -1 }, { 0x00CC00E1, -1 }, { 0x01260068, 1 },
+    { 0x01640064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019011C, -2 }, { 0x012A0167, -1 }, { 0x002F0104, -3 }, { 0x004E0102, -1 },
+    { 0x00C52019, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011F0027, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01040128, 1 }, { 0x004700C1, -1 }, { 0x00000000, 0 }, { 0x00C00046, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0048014D, -1 }, { 0x0067014B, 1 }, { 0x00420067, -1 },
+    { 0x00C100D2, -1 }, { 0x00C40145, 1 }, { 0x01020141, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF00EB, -1 },
+    { 0x00000000, 0 }, { 0x0157006E, 1 }, { 0x0176006C, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0044017F, -1 },
+    { 0x0041010C, -1 }, { 0x00C00177, -2 }, { 0x00DC0102, -2 }, { 0x011D0171, 2 },
+    { 0x015800FA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202600CA, 1 }, { 0x00DA011B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0077003B, -1 }, { 0x0131002F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C013C, 1 }, { 0x007B013A, 2 },
+    { 0x00D500C1, -1 }, { 0x00D80134, -1 }, { 0x0110004A, -1 }, { 0x0154012C, 1 },
+    { 0x2025016F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700E2, -2 }, { 0x0054006F, -1 }, { 0x00D300DA, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0050201A, -3 }, { 0x006F2018, -1 }, { 0x00D100F3, -1 }, { 0x00D40166, -1 },
+    { 0x014A0078, -1 }, { 0x016C00E9, -1 }, { 0x00000000, 0 }, { 0x201E012E, 1 },
+    { 0x00000000, 0 }, { 0x00D2017F, -1 }, { 0x016A0102, -2 }, { 0x20180048, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0147, -1 }, { 0x201900D4, -2 }, { 0x00000000, 0 }, { 0x00CD0125, 1 },
+    { 0x0168011B, -1 }, { 0x002C0049, 1 }, { 0x004B0047, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50058, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006C015D, 1 }, { 0x01260151, -1 }, { 0x0145014F, -1 }, { 0x00660077, 1 },
+    { 0x0164014D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE201A, -3 }, { 0x00480105, -1 },
+    { 0x00C400FD, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C20116, 1 }, { 0x01000112, 1 }, { 0x00DB002E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C0012F, -1 }, { 0x004100C4, 1 }, { 0x00D90047, -1 },
+    { 0x011D0129, 1 }, { 0x01360041, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0146, -1 }, { 0x0178013C, 2 }, { 0x00DA00D3, -1 },
+    { 0x005B0068, 2 }, { 0x0115005C, -2 }, { 0x015600CB, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB015F, -1 }, { 0x00572013, -1 },
+    { 0x007B00F2, -1 }, { 0x01570157, 1 }, { 0x0170006F, -1 }, { 0x01760155, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x012E201E, -1 }, { 0x014D201C, -1 }, { 0x016C201A, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D005A, -1 }, { 0x00000000, 0 }, { 0x00D100AB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0073, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00500059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540158, 1 },
+    { 0x00000000, 0 }, { 0x016800D3, -1 }, { 0x002F0074, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0118, 1 },
+    { 0x00520171, -1 }, { 0x014A0161, -1 }, { 0x012800F0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01260109, -1 }, { 0x01450107, -1 },
+    { 0x01640105, -1 }, { 0x0066002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0132, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50141, 1 }, { 0x00C200CE, 1 }, { 0x010000CA, 1 }, { 0x00DE0059, -2 },
+    { 0x011C0055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00470162, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00FE, 2 },
+    { 0x01542015, -1 }, { 0x015900F6, -1 }, { 0x017800F4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB0117, -1 }, { 0x0157010F, -1 }, { 0x0176010D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570052, 1 },
+    { 0x00D3004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026016B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0055006B, 1 }, { 0x00D10063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D50162, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0166201D, 1 }, { 0x00540110, 1 }, { 0x010E0104, -1 }, { 0x014C0100, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0143, -2 },
+    { 0x201A00D0, 1 }, { 0x0126203A, -1 }, { 0x014A0119, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C8003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B015C, -1 }, { 0x201800E9, -3 }, { 0x00000000, 0 }, { 0x00CC013A, 1 },
+    { 0x002E00D1, 1 }, { 0x004A005C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F015D, -3 },
+    { 0x004E015B, -1 }, { 0x004B00E8, -1 }, { 0x00C4006D, -1 }, { 0x01020069, -1 },
+    { 0x01210067, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002D0176, -1 }, { 0x004C0174, -2 }, { 0x00490101, -1 }, { 0x006800FF, -1 },
+    { 0x00C02018, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01782025, -3 }, { 0x0028011C, -1 },
+    { 0x00C30112, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C1012B, -1 }, { 0x004200C0, -1 }, { 0x00DA0043, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017600C5, -3 }, { 0x007B0062, 2 },
+    { 0x00D8005C, -2 }, { 0x01540054, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410165, -1 }, { 0x00DC015B, -1 }, { 0x00D900E8, -1 },
+    { 0x013600E2, -1 }, { 0x015500E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260123, 1 }, { 0x00BB0176, -1 }, { 0x0156016C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590122, -1 }, { 0x201E0056, -3 }, { 0x00000000, 0 }, { 0x012C002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C006F, -3 }, { 0x00000000, 0 }, { 0x00D000C0, -1 },
+    { 0x00510055, -1 }, { 0x01680043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2018201A, -3 }, { 0x201D00FB, -1 }, { 0x010F0148, 2 }, { 0x016C0142, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0114, -1 }, { 0x002C201B, -3 },
+    { 0x00CF0165, -1 }, { 0x00CC00F2, -1 }, { 0x01260079, 2 }, { 0x016A015B, -1 },
+    { 0x201800A1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F0115, -3 }, { 0x004E0113, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040139, 1 },
+    { 0x002800D4, -1 }, { 0x00C300CA, 1 }, { 0x00A10059, -1 }, { 0x00C00057, -4 },
+    { 0x012000C4, -1 }, { 0x20130178, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01020152, -1 }, { 0x00000000, 0 }, { 0x011E00DD, -1 }, { 0x00DD006E, -1 },
+    { 0x01780064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011F0169, 2 }, { 0x01362013, -1 }, { 0x013E0167, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041011D, 1 },
+    { 0x00DC0113, -1 }, { 0x2025004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600DB, -1 },
+    { 0x01560124, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0154013D, 1 }, { 0x00000000, 0 }, { 0x00560067, -2 },
+    { 0x014E0057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700F3, -2 },
+    { 0x013000E5, -1 }, { 0x016E00E1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0129201D, 1 },
+    { 0x0055010C, -1 }, { 0x00D10104, -1 }, { 0x012E00FE, 1 }, { 0x0148201B, -1 },
+    { 0x01672019, 1 }, { 0x00000000, 0 }, { 0x201E013F, 1 }, { 0x201B00CC, -1 },
+    { 0x00000000, 0 }, { 0x00720123, -1 }, { 0x012C0117, -1 }, { 0x002E0041, 1 },
+    { 0x0145002F, -2 }, { 0x016A0113, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201900E5, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B0058, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0171, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00490071, -1 }, { 0x00C50069, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0172, -1 },
+    { 0x004D0170, -1 }, { 0x010400F1, -1 }, { 0x012300EF, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01620177, 1 }, { 0x0102010A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000123, 1 },
+    { 0x011F0121, 1 }, { 0x013E011F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00A10142, -1 }, { 0x004100D5, -1 }, { 0x015800C3, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0157, -1 }, { 0x00DA00E4, -1 }, { 0x005B0079, 2 },
+    { 0x007A0077, 1 }, { 0x0134006B, 1 }, { 0x015600DC, -2 }, { 0x0159014F, -1 },
+    { 0x01720067, -1 }, { 0x0178014D, -1 }, { 0x00F2201A, -2 }, { 0x007B0103, -1 },
+    { 0x01760166, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700AB, -1 }, { 0x010E002C, -2 }, { 0x012D002A, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580137, 1 }, { 0x201D006B, -1 }, { 0x005500C4, -2 }, { 0x00520051, -1 },
+    { 0x014A0041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CC0062, 1 }, { 0x0129005C, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x012A00E8, -1 }, { 0x01460073, 1 }, { 0x016800E4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01280101, -1 }, { 0x016600FD, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E012A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0143, 1 }, { 0x00000000, 0 },
+    { 0x00C400C6, 2 }, { 0x010200C2, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50152, -1 },
+    { 0x004600E7, -1 }, { 0x010000DB, -2 }, { 0x00BF006C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00440100, -1 }, { 0x00C000F8, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x017B0178, -1 }, { 0x00DD010F, -1 }, { 0x01590107, -1 },
+    { 0x01780105, -1 }, { 0x2026004B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0176011E, -1 },
+    { 0x00000000, 0 }, { 0x015400AD, -1 }, { 0x0151003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01740137, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570063, -2 },
+    { 0x016E0051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01340154, 1 }, { 0x005800EF, 1 }, { 0x015000DF, -1 },
+    { 0x010F0070, 2 }, { 0x01720150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00702025, -2 }, { 0x00560108, -1 },
+    { 0x00D20100, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00C8, -1 },
+    { 0x00540121, -1 }, { 0x20190055, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0054, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00500153, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C00FB, -1 }, { 0x004B00F9, -1 }, { 0x01210078, 1 }, { 0x012400EB, -1 },
+    { 0x014300E9, -1 }, { 0x016200E7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00FE2025, -2 }, { 0x00C5010A, -1 }, { 0x01220104, -1 }, { 0x0062002A, -1 },
+    { 0x01250177, -1 }, { 0x01440175, -1 }, { 0x017A201D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00660129, 3 }, { 0x00C30123, 1 },
+    { 0x00410045, 1 }, { 0x00DC003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD00C7, -1 }, { 0x00BB0056, -1 }, { 0x0156004C, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB00E0, -1 }, { 0x007B0073, -1 }, { 0x017600D6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410176, -2 }, { 0x0077201E, -2 }, { 0x013600F3, -1 }, { 0x01390166, -1 },
+    { 0x015500F1, 1 }, { 0x01580164, -2 }, { 0x017400EF, 1 }, { 0x00000000, 0 },
+    { 0x20260134, 4 }, { 0x00000000, 0 }, { 0x00562039, -1 }, { 0x01720108, -1 },
+    { 0x00000000, 0 }, { 0x00D1002C, -2 }, { 0x00F0002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00780131, 1 },
+    { 0x01320125, 1 }, { 0x005600C0, -4 }, { 0x01700121, -1 }, { 0x016A003B, -1 },
+    { 0x201E0067, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0057014C, -1 }, { 0x00F20142, 1 }, { 0x0130013E, 1 }, { 0x00EC005C, 1 },
+    { 0x016E013A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D010C, -2 }, { 0x00D1015D, -1 }, { 0x010F0159, 2 }, { 0x00CE00EA, -1 },
+    { 0x01280071, -1 }, { 0x0147006F, -1 }, { 0x014A00E2, -1 }, { 0x016C0153, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0050010B, -1 },
+    { 0x00CC0103, -1 }, { 0x0143201A, -2 }, { 0x01622018, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019013E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015F002C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500C2, 1 },
+    { 0x00C2004F, -1 }, { 0x0100004B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A0156, 1 }, { 0x002800E5, -1 },
+    { 0x006600E1, -1 }, { 0x00A1006A, 2 }, { 0x00C300DB, -2 }, { 0x0104014A, 1 },
+    { 0x01230148, 1 }, { 0x01420146, 1 }, { 0x017A005C, -2 }, { 0x0067016D, 2 },
+    { 0x00C40167, -1 }, { 0x01020163, -1 }, { 0x01590077, 1 }, { 0x01780075, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011F017A, 1 }, { 0x00BF010D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041012E, 1 }, { 0x0158011C, -1 },
+    { 0x013600AB, -1 }, { 0x0114003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600EC, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013400C4, -1 }, { 0x00D40057, -1 }, { 0x017200C0, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0154014E, -1 }, { 0x005900EB, -1 }, { 0x013200DD, 1 }, { 0x00560078, -1 },
+    { 0x012F006A, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570104, -4 }, { 0x013000F6, -1 },
+    { 0x016E00F2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00C4, -5 }, { 0x0055011D, -1 },
+    { 0x00D10115, -1 }, { 0x012E010F, -1 }, { 0x016C010B, -1 }, { 0x201A0051, -1 },
+    { 0x00000000, 0 }, { 0x201E0150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005000C3, -3 }, { 0x002E0052, 1 }, { 0x00CC00BB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900F6, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F0168, -1 }, { 0x01660156, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01070175, 1 },
+    { 0x004A010E, 1 }, { 0x01040102, 1 }, { 0x01260173, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00480127, 1 }, { 0x00C4011F, 1 }, { 0x00420041, -1 },
+    { 0x0159002F, -2 }, { 0x0178002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460140, 1 }, { 0x00C20138, -1 },
+    { 0x00DE00C3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2026201D, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011D014B, 1 },
+    { 0x015800D4, -1 }, { 0x00000000, 0 }, { 0x01360063, -1 }, { 0x01550061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420172, -1 },
+    { 0x00000000, 0 }, { 0x00DA00F5, -1 }, { 0x00000000, 0 }, { 0x01720078, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014F2025, -2 }, { 0x005C0116, 1 }, { 0x01540106, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D00041, -1 }, { 0x00EF003F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005500D5, -1 }, { 0x016C00C3, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0108, -1 },
+    { 0x00560161, -2 }, { 0x00000000, 0 }, { 0x00CF00E6, -1 }, { 0x012C00E0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0121, -3 }, { 0x00D00172, -1 }, { 0x010E016E, -1 }, { 0x01252018, -1 },
+    { 0x014C016A, -1 }, { 0x016800F5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0166010E, 1 }, { 0x00000000, 0 }, { 0x0049003A, -1 }, { 0x0122002C, -1 },
+    { 0x0141002A, -2 }, { 0x00000000, 0 }, { 0x20180153, -3 }, { 0x00000000, 0 },
+    { 0x002E013B, 1 }, { 0x01640127, 1 }, { 0x004A00C6, -1 }, { 0x00C3004B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0154, 1 }, { 0x004B0152, -1 }, { 0x010200D3, -1 },
+    { 0x01430142, 1 }, { 0x01620140, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50163, -1 }, { 0x004600F8, -1 },
+    { 0x010000EC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01200176, -1 },
+    { 0x00DA2026, -3 }, { 0x017A00FD, 1 }, { 0x017D0170, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01570131, 1 }, { 0x005C00CE, 1 },
+    { 0x00D800C6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D90152, -1 },
+    { 0x0136014C, -1 }, { 0x00D600DF, -1 }, { 0x016E0062, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E2039, -1 }, { 0x00000000, 0 },
+    { 0x0072201D, 2 }, { 0x00580100, 1 }, { 0x01720161, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E00C0, 1 }, { 0x00560119, -2 }, { 0x01682026, -3 },
+    { 0x201B004D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00D9, -1 }, { 0x20190066, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016600C6, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B017E, -1 }, { 0x2018010B, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012600E3, -1 }, { 0x014500E1, -1 },
+    { 0x01040072, -1 }, { 0x01230070, 1 }, { 0x0142006E, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0100201D, -3 }, { 0x002C010C, -1 },
+    { 0x004B010A, -1 }, { 0x011F201B, 2 }, { 0x013E2019, 3 }, { 0x016200F8, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0062003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0028013E, 2 }, { 0x0066013A, 3 }, { 0x00410056, -4 },
+    { 0x00C000C1, 1 }, { 0x01580044, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00D8, -1 },
+    { 0x00000000, 0 }, { 0x00DA0065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0164, -1 },
+    { 0x015700E9, -1 }, { 0x017600E7, -1 }, { 0x01540076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01390177, -1 }, { 0x00D9010A, -1 }, { 0x01360104, 1 }, { 0x0057002C, -4 },
+    { 0x01580175, -1 }, { 0x01740100, -4 }, { 0x00000000, 0 }, { 0x20260145, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0115011F, -1 }, { 0x01720119, -1 },
+    { 0x00000000, 0 }, { 0x00F0003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590144, -1 },
+    { 0x011000C5, -1 }, { 0x0072005C, -1 }, { 0x014E00C1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057015D, -2 },
+    { 0x0130014F, -1 }, { 0x005400EA, -1 }, { 0x00CD006F, -1 }, { 0x014C00DA, -1 },
+    { 0x01680065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D011D, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014A00F3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B0136, -1 }, { 0x201800C3, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E00AB, -1 }, { 0x0104002A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019014F, -3 }, { 0x00000000, 0 }, { 0x002F0137, 1 },
+    { 0x00000000, 0 }, { 0x002C00C4, 1 }, { 0x004B00C2, 1 }, { 0x00C40047, -1 },
+    { 0x01020043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500D3, -1 }, { 0x00460068, 1 },
+    { 0x0100005C, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01230159, 1 }, { 0x002800F6, -1 }, { 0x006600F2, -1 },
+    { 0x00C00079, -2 }, { 0x00C300EC, -1 }, { 0x01420157, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0067017E, 1 }, { 0x00C40178, -2 },
+    { 0x01020174, -4 }, { 0x0157201A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0041013F, 1 }, { 0x00000000, 0 }, { 0x00D900C2, -2 },
+    { 0x005A0057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202600FD, -2 }, { 0x00DA014E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054201B, 1 },
+    { 0x005900FC, -1 }, { 0x007800FA, 1 }, { 0x013200EE, 1 }, { 0x017000EA, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00570115, -2 }, { 0x01300107, -1 }, { 0x016E0103, -1 },
+    { 0x0051002F, -1 }, { 0x201C0049, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00D5, -2 }, { 0x00000000, 0 }, { 0x016C011C, -1 },
+    { 0x014A00AB, -1 }, { 0x0128003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C017A, -1 }, { 0x00000000, 0 }, { 0x20190107, -3 },
+    { 0x0168014E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0124006C, 1 },
+    { 0x01620068, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00472025, -1 }, { 0x006E0177, -1 }, { 0x00C3201D, -3 },
+    { 0x00E2201B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C40130, 1 }, { 0x0102012C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00460151, -1 }, { 0x00C20149, -1 }, { 0x01000145, 1 },
+    { 0x00DB0061, -1 }, { 0x01760057, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0044016A, -1 }, { 0x00C00162, -2 },
+    { 0x00000000, 0 }, { 0x01550072, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D52025, -2 },
+    { 0x00DA0106, -1 }, { 0x0178016F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C0127, 1 }, { 0x007B0125, 2 }, { 0x00560041, -4 },
+    { 0x016D002F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D300C5, -1 },
+    { 0x00000000, 0 }, { 0x014C004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005500E6, -1 }, { 0x00CE006B, 1 }, { 0x014A0063, -1 }, { 0x016C00D4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E201E, -2 }, { 0x006D201C, -1 }, { 0x007200FD, 1 }, { 0x00D2016A, -1 },
+    { 0x01100166, -1 }, { 0x014E0162, -1 }, { 0x00000000, 0 }, { 0x201C0132, -1 },
+    { 0x00000000, 0 }, { 0x010E017F, -1 }, { 0x01680106, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01470121, -1 },
+    { 0x0166011F, -1 }, { 0x00C50043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E014C, -1 },
+    { 0x0126013C, 1 }, { 0x010400CB, 1 }, { 0x00280066, 5 }, { 0x00660062, 3 },
+    { 0x00C3005C, -5 }, { 0x01200056, -1 }, { 0x0145013A, 1 }, { 0x00000000, 0 },
+    { 0x002C0165, -1 }, { 0x01430153, -1 }, { 0x004800F0, -1 }, { 0x006700EE, 1 },
+    { 0x01620151, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50174, -4 }, { 0x00460109, -1 }, { 0x00DC201E, -3 },
+    { 0x00FB201C, -1 }, { 0x010000FD, -2 }, { 0x011F00FB, 2 }, { 0x0122016E, -1 },
+    { 0x01392018, -2 }, { 0x013E00F9, 1 }, { 0x0141016C, -1 }, { 0x00000000, 0 },
+    { 0x00C0011A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0131, -1 }, { 0x01780127, 2 }, { 0x00000000, 0 }, { 0x01720041, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760140, 2 }, { 0x015400CF, 1 },
+    { 0x0059006C, 2 }, { 0x0151005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250112, 1 }, { 0x0136015D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016E0073, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01340176, 1 },
+    { 0x00580111, -1 }, { 0x016A201E, -3 }, { 0x201D0045, -2 }, { 0x00710029, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E00D1, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00EA, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0176, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018011C, -1 },
+    { 0x00500175, 1 }, { 0x002E0104, 1 }, { 0x004D0102, 1 }, { 0x00C42019, -3 },
+    { 0x012600F4, -1 }, { 0x014500F2, -1 }, { 0x016400F0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C011D, 1 }, { 0x004B011B, -1 },
+    { 0x0124010D, -1 }, { 0x0143010B, -1 }, { 0x01620109, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C5012C, 1 },
+    { 0x004600C1, -3 }, { 0x00000000, 0 }, { 0x00DE0044, -1 }, { 0x0179003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0028014F, -1 }, { 0x004400DA, -1 }, { 0x00410067, 1 }, { 0x00C000D2, -1 },
+    { 0x00C30145, 1 }, { 0x01390057, -2 }, { 0x01580055, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00E9, -1 }, { 0x015900E1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0102, -2 },
+    { 0x017600F8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500CA, 1 },
+    { 0x00D9011B, -1 }, { 0x01360115, -1 }, { 0x01550113, -1 }, { 0x0076003B, -1 },
+    { 0x01740111, -2 }, { 0x00000000, 0 }, { 0x20260156, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005B013C, 2 }, { 0x00D400C1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590155, -1 }, { 0x005600E2, -2 },
+    { 0x0072006D, 1 }, { 0x00D200DA, -1 }, { 0x012C0061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F201A, -2 },
+    { 0x006E2018, -1 }, { 0x00D30166, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D012E, -2 }, { 0x00000000, 0 },
+    { 0x01262025, -1 }, { 0x00520114, 1 }, { 0x014A0104, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0147, -1 },
+    { 0x201800D4, -1 }, { 0x00000000, 0 }, { 0x00CC0125, 1 }, { 0x00EB0123, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190160, -1 }, { 0x00000000, 0 }, { 0x002F0148, -1 }, { 0x00000000, 0 },
+    { 0x002C00D5, -1 }, { 0x004B00D3, -1 }, { 0x00C40058, 2 }, { 0x01020054, -2 },
+    { 0x014300C3, -1 }, { 0x016200C1, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014100DC, -1 }, { 0x0100006D, -1 }, { 0x013E0069, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004A0178, 1 }, { 0x00DD201A, -3 }, { 0x00280107, -1 }, { 0x00660103, -1 },
+    { 0x00C300FD, -2 }, { 0x00FC2018, -1 }, { 0x0104016C, -2 }, { 0x01782010, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10116, 1 },
+    { 0x00000000, 0 }, { 0x00DA002E, -3 }, { 0x0118002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410150, -1 }, { 0x00000000, 0 }, { 0x00D900D3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2026010E, 1 }, { 0x00DA015F, -1 }, { 0x00562013, -1 }, { 0x017200E2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D80178, -1 }, { 0x0059010D, -1 },
+    { 0x01540170, -2 }, { 0x201E0041, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0168002E, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00E6, -3 }, { 0x00D10137, 1 }, { 0x005200CC, 1 }, { 0x010F0133, 2 },
+    { 0x004F0059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0172, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005000E5, -1 },
+    { 0x00000000, 0 }, { 0x002E0074, -1 }, { 0x01260064, -1 }, { 0x01450062, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190118, -2 }, { 0x0068201B, -1 },
+    { 0x002F0100, -3 }, { 0x004E00FE, 1 }, { 0x012A0163, -1 }, { 0x01490161, 1 },
+    { 0x01620079, 1 }, { 0x0168015F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01660178, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040124, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0044004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40141, 1 },
+    { 0x00C100CE, 1 }, { 0x0102013D, 1 }, { 0x00DD0059, 1 }, { 0x0178004F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF00E7, -1 }, { 0x017900DB, -1 }, { 0x01760068, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00F6201B, -1 }, { 0x00410108, -1 }, { 0x00DC00FE, 1 },
+    { 0x011D016D, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600C6, 1 }, { 0x00DA0117, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01540128, 1 }, { 0x005900C5, -3 }, { 0x00560052, 1 }, { 0x00D2004A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025016B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054006B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D40162, -1 }, { 0x012E00E9, -1 },
+    { 0x016C00E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E012A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016A00FE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0143, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012A011B, -1 }, { 0x01680117, -1 }, { 0x002C0045, 1 },
+    { 0x004B0043, -1 }, { 0x00C7003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50054, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0126014D, -1 },
+    { 0x010400DC, -2 }, { 0x00C3006D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0176, -2 },
+    { 0x0062201E, -2 }, { 0x00480101, -1 }, { 0x006700FF, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00412039, -1 }, { 0x00C20112, 1 }, { 0x01772025, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C0012B, -1 },
+    { 0x004100C0, 1 }, { 0x00D90043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0142, 2 }, { 0x015600C7, -1 }, { 0x01780138, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB015B, -1 }, { 0x01570153, -1 }, { 0x01760151, -1 }, { 0x0170006B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250123, 1 }, { 0x00000000, 0 }, { 0x00F0201E, -2 }, { 0x010F201C, 2 },
+    { 0x012E201A, -1 }, { 0x014D2018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580122, -1 },
+    { 0x00CF2039, -1 }, { 0x201D0056, -1 }, { 0x014A002C, -2 }, { 0x0169002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B006F, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00500055, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540154, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F0070, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0114, 1 }, { 0x0052016D, -1 }, { 0x00CE0165, -1 },
+    { 0x014700EA, -1 }, { 0x01250079, -1 }, { 0x01440077, -1 }, { 0x014A015D, -1 },
+    { 0x016600E8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01260105, -1 }, { 0x01450103, -1 }, { 0x01640101, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C012E, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00FF003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C5013D, 1 }, { 0x00000000, 0 },
+    { 0x00C200CA, 1 }, { 0x00BF0057, -1 }, { 0x00DE0055, -1 }, { 0x010000C6, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01580066, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00420104, -1 }, { 0x00DD00FA, -1 }, { 0x01542011, -1 },
+    { 0x015900F2, -1 }, { 0x017800F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0113, -1 }, { 0x0157010B, -1 },
+    { 0x01760109, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500DB, -1 }, { 0x01740122, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260167, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550067, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590166, 1 }, { 0x005600F3, -2 }, { 0x01320158, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D00104, -1 },
+    { 0x010E0100, -1 }, { 0x012D00FE, 3 }, { 0x01662019, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D013F, -2 }, { 0x201A00CC, 1 }, { 0x00000000, 0 },
+    { 0x00710123, 1 }, { 0x014A0115, -1 }, { 0x00000000, 0 }, { 0x0144002F, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800E5, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E00CD, 1 }, { 0x004A0058, 1 },
+    { 0x0104004C, 1 }, { 0x014500BB, -1 }, { 0x00000000, 0 }, { 0x20190171, -1 },
+    { 0x00000000, 0 }, { 0x002F0159, -1 }, { 0x00000000, 0 }, { 0x004B00E4, -1 },
+    { 0x00480071, -1 }, { 0x00C40069, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0170, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013E007A, 1 }, { 0x017C0076, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0176203A, -1 }, { 0x00FF0123, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0118003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0140, -1 },
+    { 0x017600C1, -3 }, { 0x00000000, 0 }, { 0x01540050, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D900E4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026011F, 1 },
+    { 0x00000000, 0 }, { 0x01560168, -2 }, { 0x017200F3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059011E, -1 }, { 0x01320110, 1 },
+    { 0x005600AB, -1 }, { 0x0170010C, -1 }, { 0x201E0052, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570137, 2 },
+    { 0x016E0125, 1 }, { 0x005400C4, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00550150, -1 }, { 0x010F0144, 2 }, { 0x005200DD, -2 }, { 0x012E0142, 1 },
+    { 0x01660058, 1 }, { 0x016C013E, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B2015, -1 }, { 0x005000F6, -1 },
+    { 0x01070077, 1 }, { 0x01260075, 1 }, { 0x01450073, -1 }, { 0x01640071, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0111, -3 },
+    { 0x004E010F, -1 }, { 0x014600FF, -1 }, { 0x00670027, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01230133, 1 }, { 0x01420131, 1 }, { 0x00C300C6, 2 },
+    { 0x012000C0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40152, -1 }, { 0x0102014E, -1 },
+    { 0x011E00D9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000167, -1 },
+    { 0x00BF00F8, -1 }, { 0x011F0165, 1 }, { 0x013E0163, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011D017E, 1 }, { 0x00DC010F, -1 }, { 0x2025004B, 1 }, { 0x00000000, 0 },
+    { 0x0079002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01560120, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0150003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01540139, 1 },
+    { 0x005900D6, -1 }, { 0x017000C4, -2 }, { 0x00560063, -2 }, { 0x01100057, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700EF, 1 }, { 0x013000E1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006F2025, -2 }, { 0x00550108, -1 }, { 0x00D10100, -1 },
+    { 0x010F00FC, 1 }, { 0x01292019, 1 }, { 0x016C00F6, -1 }, { 0x00000000, 0 },
+    { 0x201E013B, 1 }, { 0x00000000, 0 }, { 0x201B00C8, -1 }, { 0x0072011F, -1 },
+    { 0x00CF0119, -1 }, { 0x012C0113, -1 }, { 0x016A010F, -1 }, { 0x20180055, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900E1, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0056, -3 }, { 0x01620042, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A016D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E016E, -1 }, { 0x004D016C, -1 }, { 0x010400ED, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FD2025, -2 },
+    { 0x00C4010A, -1 }, { 0x01020106, -1 }, { 0x0042002C, -1 }, { 0x0061002A, -1 },
+    { 0x00DD0022, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0046012B, 1 }, { 0x00C20123, 1 }, { 0x0100011F, 1 },
+    { 0x00DB003B, -1 }, { 0x011F011D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00A1013E, -1 }, { 0x004100D1, 1 },
+    { 0x00DC00C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0153, -1 },
+    { 0x00DA00E0, -1 }, { 0x015600D8, -1 }, { 0x0159014B, 1 }, { 0x01720063, -1 },
+    { 0x01780149, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0076201E, -2 }, { 0x01760162, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250134, 4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D0002C, -2 }, { 0x00EF002A, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0067, -4 }, { 0x00000000, 0 },
+    { 0x005500C0, -2 }, { 0x0052004D, 1 }, { 0x012B003F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056014C, -1 },
+    { 0x00000000, 0 }, { 0x016A00C7, -1 }, { 0x00EB005C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C010C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CD00EA, -1 }, { 0x012A00E4, -1 },
+    { 0x016800E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0123201C, 2 }, { 0x010900FF, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0126, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015E002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C013F, 1 }, { 0x00000000, 0 }, { 0x00C400C2, 1 }, { 0x00C1004F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C5014E, -1 }, { 0x004600E3, -1 }, { 0x00C200DB, -2 },
+    { 0x00BF0068, -1 }, { 0x0179005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30167, -1 }, { 0x00000000, 0 },
+    { 0x011D00EE, 1 }, { 0x01390079, -1 }, { 0x01580077, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017B0174, -1 },
+    { 0x00DD010B, -1 }, { 0x01590103, -1 }, { 0x01780101, -1 }, { 0x20260047, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500EC, -1 }, { 0x01360137, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D30057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260178, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0172014C, -1 },
+    { 0x005800EB, -1 }, { 0x015000DB, -1 }, { 0x00550078, -1 }, { 0x010F006C, 4 },
+    { 0x012E006A, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00780175, 1 }, { 0x00560104, -4 }, { 0x201E00AB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00C4, -4 }, { 0x0054011D, -1 }, { 0x20190051, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0150, -2 }, { 0x00000000, 0 }, { 0x201A00DD, -2 }, { 0x00520136, 1 },
+    { 0x004F00C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800F6, -3 }, { 0x00000000, 0 },
+    { 0x0050014F, -1 }, { 0x002E00DE, 1 }, { 0x004D00DC, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B00F5, -1 }, { 0x012400E7, -1 },
+    { 0x01020076, -2 }, { 0x01210074, 1 }, { 0x014300E5, -1 }, { 0x016200E3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E70177, 1 }, { 0x00C50106, -1 },
+    { 0x01220100, -1 }, { 0x017A2019, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00660125, 3 }, { 0x00C3011F, 1 }, { 0x00410041, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10138, -1 }, { 0x00DD00C3, -3 }, { 0x00000000, 0 },
+    { 0x01560048, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025201D, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0151, -1 }, { 0x017600D2, -1 },
+    { 0x007B006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410172, -2 }, { 0x0077201A, -2 },
+    { 0x00D900F5, -1 }, { 0x01390162, -1 }, { 0x017400EB, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260130, 1 }, { 0x00000000, 0 },
+    { 0x014E2025, -2 }, { 0x01720104, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01130123, -1 }, { 0x0170011D, -1 },
+    { 0x00EE003F, 1 }, { 0x012C003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0130013A, 1 },
+    { 0x014C00C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0108, -2 }, { 0x00550161, -1 },
+    { 0x010F0155, 2 }, { 0x00CE00E6, -1 }, { 0x006E0079, -1 }, { 0x012E0153, -1 },
+    { 0x0147006B, 1 }, { 0x016C014F, -1 }, { 0x00000000, 0 }, { 0x201B0121, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00500107, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019013A, -1 }, { 0x00000000, 0 }, { 0x002F0122, -1 }, { 0x00000000, 0 },
+    { 0x004B00AD, -1 }, { 0x0048003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2004B, 1 }, { 0x01000047, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01040146, -1 }, { 0x002800E1, -1 }, { 0x01230144, 1 }, { 0x00A10066, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00670169, 2 }, { 0x00C40163, -1 }, { 0x00000000, 0 },
+    { 0x01780071, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000178, -2 }, { 0x00BF0109, -1 },
+    { 0x00D92026, -3 }, { 0x0155201E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0041012A, 1 }, { 0x00DC0120, -1 }, { 0x01580118, 1 }, { 0x00D6003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013400C0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0154014A, 1 }, { 0x005900E7, -1 },
+    { 0x00D500DF, -1 }, { 0x012F0066, 4 }, { 0x017000D5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x003B0175, 1 },
+    { 0x00570100, -4 }, { 0x013000F2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00C0, -5 }, { 0x00550119, -1 }, { 0x00D10111, -1 }, { 0x010F010D, 1 },
+    { 0x012E010B, -1 }, { 0x016C0107, -1 }, { 0x00000000, 0 }, { 0x201E014C, -1 },
+    { 0x00000000, 0 }, { 0x201B00D9, -1 }, { 0x016A0120, -1 }, { 0x20180066, -1 },
+    { 0x00000000, 0 }, { 0x002E004E, 1 }, { 0x0164003A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900F2, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0067, 1 }, { 0x004B0065, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004F0164, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50076, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011E201B, -1 }, { 0x012300FC, 2 }, { 0x0126016F, 1 },
+    { 0x014200FA, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670121, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0046013C, 1 }, { 0x01000130, 1 }, { 0x00000000, 0 }, { 0x01760042, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20262019, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC00D8, -1 }, { 0x015800D0, 1 },
+    { 0x00D90065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0042016E, -1 }, { 0x00DD0164, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01380177, 1 },
+    { 0x005C0112, 1 }, { 0x01540102, 2 }, { 0x0056002C, -4 }, { 0x0075002A, -1 },
+    { 0x01570175, 1 }, { 0x01760173, -1 }, { 0x20250145, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01500134, -1 }, { 0x201D0078, -1 },
+    { 0x0071005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0104, 1 }, { 0x0056015D, -2 }, { 0x00000000, 0 },
+    { 0x007200E8, -1 }, { 0x00500077, 1 }, { 0x00CC006F, -1 }, { 0x00CF00E2, -1 },
+    { 0x016A00D8, -1 }, { 0x00000000, 0 }, { 0x201C011D, -3 }, { 0x00540176, 1 },
+    { 0x00D0016E, -1 }, { 0x010E016A, -1 }, { 0x012A00F5, -1 }, { 0x014C0166, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0136, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0103002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2018014F, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01260127, 1 },
+    { 0x004A00C2, -1 }, { 0x00280051, -1 }, { 0x00C30047, -1 }, { 0x01200041, -1 },
+    { 0x01450125, 1 }, { 0x01640123, -1 }, { 0x017D003B, -1 }, { 0x002C0150, -1 },
+    { 0x004B014E, -1 }, { 0x00C400D3, -1 }, { 0x00FF005C, -1 }, { 0x010200CF, 1 },
+    { 0x01240140, 1 }, { 0x0143013E, 1 }, { 0x0162013C, 1 }, { 0x00000000, 0 },
+    { 0x00490167, -1 }, { 0x004600F4, -1 }, { 0x00C200EC, -1 }, { 0x013E00E4, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C30178, -2 }, { 0x01200172, -1 }, { 0x011D00FF, 2 },
+    { 0x017D016C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260058, 1 },
+    { 0x00DD011C, -1 }, { 0x00000000, 0 }, { 0x0172002C, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0176012B, 2 }, { 0x005C00CA, 1 }, { 0x00590057, 1 },
+    { 0x00D800C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202500FD, -2 }, { 0x00D9014E, -1 }, { 0x01360148, -1 }, { 0x00D600DB, -1 },
+    { 0x01300062, 1 }, { 0x01550146, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0172015D, -1 }, { 0x005800FC, -1 },
+    { 0x00722019, 2 }, { 0x010F007D, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560115, -2 }, { 0x012A2026, -1 }, { 0x201B0049, -1 }, { 0x0050002F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00D5, -1 }, { 0x20190062, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0161, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520147, 1 }, { 0x014A0137, 1 },
+    { 0x014700C4, -1 }, { 0x016600C2, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B017A, -1 }, { 0x203A0178, -1 }, { 0x20180107, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0104006E, -1 }, { 0x0142006A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00462025, -3 }, { 0x002C0108, -1 }, { 0x004B0106, -1 }, { 0x006D0177, -1 },
+    { 0x00C2201D, -3 }, { 0x00E1201B, -1 }, { 0x01002019, -3 }, { 0x012400F8, -1 },
+    { 0x014300F6, -1 }, { 0x016200F4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0028013A, 2 },
+    { 0x004400C5, -1 }, { 0x00C30130, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10149, -1 }, { 0x00DD00D4, -1 }, { 0x00000000, 0 }, { 0x00DA0061, -1 },
+    { 0x01560059, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015700E5, -1 }, { 0x017600E3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D42025, -2 }, { 0x00D90106, -1 },
+    { 0x01360100, 1 }, { 0x01580171, -1 }, { 0x016F201B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260141, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005B0127, 2 }, { 0x01720115, -1 }, { 0x00550041, -2 }, { 0x016C002F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590140, 2 }, { 0x00D200C5, -1 }, { 0x011000C1, -1 },
+    { 0x201E0074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005400E6, -1 },
+    { 0x00CD006B, 1 }, { 0x010E00DA, -1 }, { 0x012A0065, -1 }, { 0x01680061, -1 },
+    { 0x00000000, 0 }, { 0x201D0119, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005200FF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0132, -1 }, { 0x201800BF, -3 },
+    { 0x002C2039, -1 }, { 0x00500118, -1 }, { 0x01622025, -3 }, { 0x00C6002A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019014B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C00C0, 1 },
+    { 0x00C40043, -1 }, { 0x0102003F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C500CF, 1 }, { 0x00460064, -1 }, { 0x00C2005C, -5 }, { 0x01000058, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00690161, 1 },
+    { 0x01040157, -1 }, { 0x002800F2, -1 }, { 0x006600EE, 3 }, { 0x01230155, 1 },
+    { 0x017D00DC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0067017A, 1 }, { 0x00C40174, -4 }, { 0x00DB201E, -3 }, { 0x00FA201C, -1 },
+    { 0x01020170, -2 }, { 0x01762014, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0118, -1 },
+    { 0x00000000, 0 }, { 0x0154002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041013B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600F9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058006C, 1 },
+    { 0x0150005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900F8, -1 }, { 0x017000E6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570111, -2 },
+    { 0x01300103, -1 }, { 0x201C0045, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00D1, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B00EA, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190103, -3 }, { 0x00000000, 0 }, { 0x002F00EB, -3 },
+    { 0x004E00E9, -1 }, { 0x004B0076, -1 }, { 0x0105006A, 5 }, { 0x01240068, 1 },
+    { 0x01620064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01280167, -1 },
+    { 0x00C32019, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011D0027, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C4012C, 1 }, { 0x01020128, 1 },
+    { 0x00000000, 0 }, { 0x00DD0044, 1 }, { 0x0178003A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046014D, -1 },
+    { 0x00C20145, 1 }, { 0x00DE00D0, -1 }, { 0x01000141, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00440166, -1 }, { 0x00DC00E9, -1 }, { 0x00000000, 0 }, { 0x00F80074, 1 },
+    { 0x01360070, -1 }, { 0x0155006E, 1 }, { 0x0174006C, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0178016B, -1 }, { 0x00DA0102, -2 }, { 0x015600FA, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0123, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012F002F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250156, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D60134, -1 }, { 0x00D300C1, -1 }, { 0x013000BB, -1 }, { 0x010E004A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005500E2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E201A, -2 }, { 0x006D2018, -1 },
+    { 0x00CF00F3, -1 }, { 0x00D20166, -1 }, { 0x01100162, -1 }, { 0x016A00E9, -1 },
+    { 0x00000000, 0 }, { 0x201C012E, -1 }, { 0x00000000, 0 }, { 0x00D0017F, -1 },
+    { 0x01680102, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0147, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00EA0123, -1 }, { 0x0147011D, -1 }, { 0x00C5003F, -1 },
+    { 0x0166011B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180160, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01260138, 1 }, { 0x010400C7, -1 },
+    { 0x00280062, 2 }, { 0x00C30058, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B015F, -1 }, { 0x01240151, -1 },
+    { 0x0143014F, -1 }, { 0x0162014D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50170, -2 },
+    { 0x00DC201A, -3 }, { 0x00460105, -1 }, { 0x00C200FD, -2 }, { 0x00FB2018, -1 },
+    { 0x0122016A, -1 }, { 0x01410168, -1 }, { 0x01600166, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00116, 1 }, { 0x004100AB, -1 },
+    { 0x00D9002E, -3 }, { 0x00F8002C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260069, -1 }, { 0x00DD012D, 2 },
+    { 0x01780123, -2 }, { 0x01340041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0176013C, 2 }, { 0x005C00DB, -2 }, { 0x00590068, 2 }, { 0x0113005C, -2 },
+    { 0x015400CB, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025010E, 1 },
+    { 0x00D9015F, -1 }, { 0x01360159, -1 }, { 0x01550157, 1 }, { 0x016E006F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058010D, -1 }, { 0x012C201E, -1 },
+    { 0x016A201A, -3 }, { 0x201D0041, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00CD, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CF00AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00E6, -3 },
+    { 0x20190073, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0172, -2 }, { 0x00000000, 0 },
+    { 0x201A00FF, -2 }, { 0x00520158, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20180118, -1 }, { 0x0067201B, 2 }, { 0x002E0100, 1 },
+    { 0x012600F0, -1 }, { 0x0123007D, 1 }, { 0x01480161, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B0117, -1 }, { 0x01240109, -1 }, { 0x01430107, -1 }, { 0x0064002F, 1 },
+    { 0x01620105, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50128, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30141, 1 }, { 0x00C000CE, 1 },
+    { 0x00000000, 0 }, { 0x01580051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD00E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F5201B, -1 }, { 0x00DB00FE, 1 }, { 0x015700F6, -1 }, { 0x017600F4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500C6, 1 }, { 0x00D90117, -1 }, { 0x01360111, -1 },
+    { 0x0155010F, -1 }, { 0x0174010D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005800C5, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590151, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CF0063, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D30162, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D012A, -2 }, { 0x00000000, 0 }, { 0x010F0177, 2 }, { 0x00520110, 1 },
+    { 0x014A0100, -1 }, { 0x004C002A, -2 }, { 0x0164201D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B0143, -1 }, { 0x00000000, 0 }, { 0x0124203A, -1 },
+    { 0x00EB011F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C6003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019015C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F0144, -1 }, { 0x002C00D1, 1 }, { 0x004E0142, 1 },
+    { 0x00C40054, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004900E8, -1 },
+    { 0x00C2006D, -1 }, { 0x01000069, -1 }, { 0x011F0067, 1 }, { 0x012200DA, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040168, -2 },
+    { 0x00280103, -1 }, { 0x006600FF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01762025, -3 }, { 0x00C10112, 1 }, { 0x00000000, 0 }, { 0x00BB002C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C004B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041014C, -1 }, { 0x00DC0142, 1 },
+    { 0x017400C5, -4 }, { 0x00D6005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026010A, -1 }, { 0x00DA015B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C017C, 1 }, { 0x00590109, -1 }, { 0x00732026, -1 }, { 0x00D80174, -1 },
+    { 0x0154016C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570122, -1 }, { 0x00CE2039, -1 },
+    { 0x201C0056, -1 }, { 0x0070003A, -1 }, { 0x012A002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00E2, -3 }, { 0x00000000, 0 },
+    { 0x010F012F, 2 }, { 0x005200C8, 1 }, { 0x004F0055, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E016E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005000E1, -1 }, { 0x016A0142, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190114, -2 }, { 0x00CD0165, -1 }, { 0x002F00FC, -1 }, { 0x0149015D, 1 },
+    { 0x0168015B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01040120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FE003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C4013D, 1 }, { 0x01020139, 1 }, { 0x00C100CA, 1 },
+    { 0x011E00C4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20110178, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000152, -1 }, { 0x00BF00E3, -1 },
+    { 0x011C00DD, -1 }, { 0x0119006A, 3 }, { 0x013B00DB, -1 }, { 0x01760064, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00630175, 1 },
+    { 0x00410104, 1 }, { 0x011D0169, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0059203A, -1 }, { 0x00DA0113, -1 }, { 0x202600C2, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0134, 4 }, { 0x005900C1, -3 },
+    { 0x01540124, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250167, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540067, -1 }, { 0x014C0057, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005500F3, -1 }, { 0x00D100EB, -1 }, { 0x012E00E5, -1 },
+    { 0x016C00E1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0126, 1 },
+    { 0x00000000, 0 }, { 0x00F10175, -1 }, { 0x012C00FE, 1 }, { 0x0146201B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C013F, -1 }, { 0x201900CC, -2 }, { 0x00000000, 0 }, { 0x012A0117, -1 },
+    { 0x01680113, -1 }, { 0x002C0041, 1 }, { 0x0143002F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0158, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01260149, 1 }, { 0x010400D8, -1 }, { 0x0066006F, -1 },
+    { 0x00C30069, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0172, -1 }, { 0x0062201A, -2 }, { 0x006700FB, 2 },
+    { 0x010200F1, -1 }, { 0x012100EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0100010A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011D0121, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD013E, 2 }, { 0x015600C3, 2 },
+    { 0x01340052, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0157014F, -1 },
+    { 0x007B00EA, -1 }, { 0x00780077, 1 }, { 0x0132006B, 1 }, { 0x015400DC, -2 },
+    { 0x01700067, -1 }, { 0x0176014D, -1 }, { 0x2025011F, 1 }, { 0x00000000, 0 },
+    { 0x00F0201A, -2 }, { 0x010F2018, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0058011E, -1 }, { 0x0172017F, -2 }, { 0x00000000, 0 },
+    { 0x012B002A, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E00DE, 1 }, { 0x00560137, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x012D0142, 3 }, { 0x005100DD, -1 }, { 0x002F006C, 1 }, { 0x0127005C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0110, 1 },
+    { 0x00520169, -1 }, { 0x00ED015F, 1 }, { 0x012800E8, -1 }, { 0x00E70079, 1 },
+    { 0x01440073, 1 }, { 0x014700E6, -1 }, { 0x016600E4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01260101, -1 },
+    { 0x016400FD, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C012A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50139, 1 }, { 0x00000000, 0 }, { 0x00C200C6, 2 }, { 0x010000C2, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C30152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420100, -1 },
+    { 0x00DD00F6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01790178, -1 },
+    { 0x00DB010F, -1 }, { 0x01570107, -1 }, { 0x01760105, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01360122, -1 }, { 0x0174011E, -1 }, { 0x00000000, 0 },
+    { 0x014F003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260163, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01720137, 1 }, { 0x005800D6, -1 },
+    { 0x015000C6, -1 }, { 0x00550063, -1 }, { 0x016C0051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590162, 1 },
+    { 0x005600EF, 1 }, { 0x01320154, 1 }, { 0x00CF0074, -1 }, { 0x014E00DF, -1 },
+    { 0x01700150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D00100, -1 }, { 0x00EF00FE, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D013B, -2 },
+    { 0x00000000, 0 }, { 0x201A00C8, 1 }, { 0x0071011F, 1 }, { 0x00CE0119, -1 },
+    { 0x014A0111, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201800E1, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E00C9, 1 }, { 0x00000000, 0 }, { 0x01040048, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019016D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F0155, -1 }, { 0x004B00E0, -1 }, { 0x004E0153, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004C016C, -1 }, { 0x00C500F1, -1 }, { 0x00000000, 0 },
+    { 0x011F0078, 1 }, { 0x013E0076, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01230177, 2 }, { 0x00C3010A, -1 },
+    { 0x01200104, -1 }, { 0x01420175, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10123, 1 }, { 0x00FF011F, -1 }, { 0x00000000, 0 }, { 0x00DA003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00620142, 1 }, { 0x00BF013C, -1 }, { 0x00D80054, -1 },
+    { 0x00DB00C7, -1 }, { 0x0154004C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC0153, -1 }, { 0x00D900E0, -1 },
+    { 0x003B0077, 1 }, { 0x017400D6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01560164, -2 },
+    { 0x007A00FF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00542039, -1 }, { 0x01700108, -1 }, { 0x201E004E, 1 }, { 0x00CF002C, -1 },
+    { 0x00EE002A, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0067, -3 }, { 0x01300125, 1 }, { 0x005400C0, -3 },
+    { 0x016E0121, -1 }, { 0x0168003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00F3, -3 }, { 0x0055014C, -1 }, { 0x00F00142, 1 },
+    { 0x005200D9, -2 }, { 0x00EA005C, -2 }, { 0x010F0140, 4 }, { 0x012E013E, 1 },
+    { 0x016C013A, 1 }, { 0x00000000, 0 }, { 0x201B010C, -1 }, { 0x00000000, 0 },
+    { 0x004B2011, -1 }, { 0x005000F2, -1 }, { 0x00CC00EA, -1 }, { 0x01260071, -1 },
+    { 0x0145006F, -1 }, { 0x016A0153, -1 }, { 0x00000000, 0 }, { 0x20190125, -1 },
+    { 0x00000000, 0 }, { 0x002F010D, -3 }, { 0x004E010B, -1 }, { 0x0122201C, -1 },
+    { 0x012700FD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015D002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040131, -1 },
+    { 0x0123012F, 1 }, { 0x00C300C2, 1 }, { 0x00440057, -1 }, { 0x00C0004F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C4014E, -1 }, { 0x0102014A, 1 }, { 0x00C100DB, -2 }, { 0x00DD0066, -1 },
+    { 0x01210148, 1 }, { 0x0178005C, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20167, -1 }, { 0x00BF00F4, -1 }, { 0x01000163, -1 },
+    { 0x01380079, 1 }, { 0x01570077, 1 }, { 0x01760075, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011D017A, 1 }, { 0x00DC010B, -1 },
+    { 0x20250047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600D3, -1 },
+    { 0x00000000, 0 }, { 0x0156011C, -1 }, { 0x00000000, 0 }, { 0x0112003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C0145, 1 }, { 0x005900D2, -1 }, { 0x013200C4, -1 },
+    { 0x00D20057, -1 }, { 0x01350137, 2 }, { 0x017000C0, -2 }, { 0x20250178, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700EB, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00550104, -2 }, { 0x012E00F6, -1 }, { 0x016C00F2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B00C4, -4 }, { 0x0072011B, -1 }, { 0x00CF0115, -1 }, { 0x012C010F, -1 },
+    { 0x016A010B, -1 }, { 0x20180051, -1 }, { 0x00000000, 0 }, { 0x201C0150, -1 },
+    { 0x00000000, 0 }, { 0x201900DD, -1 }, { 0x00000000, 0 }, { 0x002F00C5, -3 },
+    { 0x002C0052, 1 }, { 0x004E00C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0169, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C00DC, -1 }, { 0x00000000, 0 }, { 0x01410059, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E016A, -1 }, { 0x004D0168, -1 }, { 0x01640156, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013B201D, -1 }, { 0x00C40106, -1 }, { 0x01020102, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460127, 1 },
+    { 0x00C2011F, 1 }, { 0x00000000, 0 }, { 0x0157002F, -2 }, { 0x0176002D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00A1013A, -1 }, { 0x004100CD, 1 }, { 0x00C00138, -1 }, { 0x00DC00C3, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD014F, -1 }, { 0x015600D4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0076201A, -2 }, { 0x005C00FD, -2 },
+    { 0x00000000, 0 }, { 0x01700078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250130, 1 }, { 0x00000000, 0 }, { 0x014D2025, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0073002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0063, -3 }, { 0x00000000, 0 }, { 0x00520049, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016A00C3, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0108, -1 }, { 0x00540161, -1 }, { 0x00000000, 0 },
+    { 0x00CD00E6, -1 }, { 0x006D0079, -1 }, { 0x012A00E0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0121, 1 }, { 0x00000000, 0 },
+    { 0x004A2026, -2 }, { 0x00E5201C, -1 }, { 0x01232018, 2 }, { 0x016600F5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0122, -1 }, { 0x0164010E, 1 }, { 0x00000000, 0 },
+    { 0x0120002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C013B, 1 }, { 0x01620127, 1 },
+    { 0x00000000, 0 }, { 0x00C1004B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C5014A, 1 },
+    { 0x00000000, 0 }, { 0x010000D3, -1 }, { 0x00BF0064, -1 }, { 0x013B005C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C30163, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011E0176, -1 }, { 0x00D82026, -2 }, { 0x00DD0107, -1 },
+    { 0x015900FF, 1 }, { 0x0173201C, -1 }, { 0x017B0170, -1 }, { 0x20260043, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0120, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590042, 1 }, { 0x00D5003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01550131, 1 }, { 0x00000000, 0 }, { 0x00D600C6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260174, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800E7, -1 }, { 0x00D400DF, -1 },
+    { 0x00D1006C, 1 }, { 0x010F0068, 4 }, { 0x012E0066, 4 }, { 0x016C0062, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x003A0175, 1 }, { 0x00560100, -4 },
+    { 0x00590173, -1 }, { 0x00780171, 1 }, { 0x01700161, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00C0, -4 },
+    { 0x00540119, -1 }, { 0x01662026, -3 }, { 0x2019004D, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D014C, -2 }, { 0x00000000, 0 },
+    { 0x201A00D9, -1 }, { 0x00520132, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0163003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201800F2, -3 }, { 0x00000000, 0 }, { 0x002E00DA, -1 },
+    { 0x016400C6, -3 }, { 0x01040059, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019017E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B00F1, -1 }, { 0x012400E3, -1 }, { 0x00C40076, -2 }, { 0x01020072, -1 },
+    { 0x01210070, 1 }, { 0x014300E1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011D201B, 2 }, { 0x00C50102, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280125, 2 }, { 0x00660121, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01560044, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20252019, -3 }, { 0x00000000, 0 },
+    { 0x00BF014D, -1 }, { 0x00DB00D8, -1 }, { 0x007B006B, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0041016E, -2 }, { 0x00000000, 0 }, { 0x013600EB, -1 }, { 0x015500E9, -1 },
+    { 0x017400E7, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2026012C, 1 }, { 0x00000000, 0 }, { 0x01102025, -2 }, { 0x01340104, -1 },
+    { 0x01560175, -1 }, { 0x0055002C, -3 }, { 0x01720100, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0059012B, 2 }, { 0x0113011F, -1 }, { 0x01700119, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0078, -1 }, { 0x010E00C5, -1 }, { 0x0070005C, -2 },
+    { 0x014C00C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0104, -5 }, { 0x0055015D, -1 }, { 0x012E014F, -1 }, { 0x00CE00E2, -1 },
+    { 0x01470067, -1 }, { 0x01660065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B011D, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00500103, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190136, -2 }, { 0x00000000, 0 },
+    { 0x002F011E, -1 }, { 0x00000000, 0 }, { 0x002C00AB, -1 }, { 0x0102002A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A00C4, -1 },
+    { 0x00C20047, -1 }, { 0x01000043, -1 }, { 0x013E003F, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004700DB, -1 }, { 0x00A10062, -1 }, { 0x00C300D3, -1 }, { 0x00FE005C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480167, -1 },
+    { 0x00670165, 1 }, { 0x00C100EC, -1 }, { 0x01210159, 1 }, { 0x0159006F, -1 },
+    { 0x0178006D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C20178, -2 }, { 0x01000174, -4 }, { 0x00BF0105, -1 }, { 0x013B00FD, -1 },
+    { 0x0155201A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410126, 1 }, { 0x00DC011C, -1 },
+    { 0x01580114, 1 }, { 0x20250058, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0156, 1 }, { 0x005900E3, -1 }, { 0x00D500DB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0052201B, -2 }, { 0x00000000, 0 }, { 0x016E00EA, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01500178, -1 }, { 0x00550115, -1 },
+    { 0x00D1010D, -1 }, { 0x012E0107, -1 }, { 0x004F002F, -1 }, { 0x016C0103, -1 },
+    { 0x201A0049, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00D5, -1 },
+    { 0x00000000, 0 }, { 0x016A011C, -1 }, { 0x00000000, 0 }, { 0x002E004A, 4 },
+    { 0x0126003A, -1 }, { 0x00000000, 0 }, { 0x201C0161, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F00D6, -1 }, { 0x00000000, 0 },
+    { 0x004B0061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50072, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1201D, -3 },
+    { 0x00E0201B, -1 }, { 0x0126016B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0067011D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20130, 1 }, { 0x0100012C, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00149, -1 },
+    { 0x004100DE, 1 }, { 0x00DC00D4, -1 }, { 0x00D90061, -1 }, { 0x015800CC, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0042016A, -1 }, { 0x00592014, -1 }, { 0x01780156, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D32025, -2 }, { 0x005C010E, 1 }, { 0x0176016F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250141, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540041, -3 }, { 0x016B002F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580140, 1 }, { 0x00D100C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0100, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007200E4, -1 }, { 0x00500073, -1 },
+    { 0x00CC006B, 1 }, { 0x016A00D4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0119, -3 }, { 0x00000000, 0 }, { 0x00D0016A, -1 }, { 0x010E0166, -1 },
+    { 0x014C0162, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0132, 1 }, { 0x00000000, 0 }, { 0x01612025, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C5002A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0133, -1 }, { 0x01450121, -1 }, { 0x0164011F, -1 }, { 0x00C30043, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C014C, -1 }, { 0x0124013C, 1 }, { 0x00C400CF, 1 },
+    { 0x00C1005C, -5 }, { 0x010200CB, 1 }, { 0x011E0056, -1 }, { 0x0143013A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490163, -1 }, { 0x00680161, 1 },
+    { 0x004600F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30174, -4 },
+    { 0x00DA201E, -3 }, { 0x00F9201C, -1 }, { 0x011D00FB, 2 }, { 0x0120016E, -1 },
+    { 0x017D0168, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260054, -2 }, { 0x0178010E, 1 }, { 0x00000000, 0 },
+    { 0x0134002C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760127, 2 },
+    { 0x005C00C6, 1 }, { 0x01700041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500F9, -1 }, { 0x00F80148, 1 },
+    { 0x01360144, -1 }, { 0x01740140, 2 }, { 0x0057006C, 2 }, { 0x014F005C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005800F8, 1 }, { 0x201D002C, -6 }, { 0x010F0079, 2 },
+    { 0x016C0073, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01320176, 1 }, { 0x00560111, -2 }, { 0x0168201E, -3 },
+    { 0x201B0045, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00D1, -1 }, { 0x01472039, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D015D, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00520143, 1 }, { 0x00000000, 0 }, { 0x014700C0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A0174, -1 }, { 0x00000000, 0 },
+    { 0x20180103, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0104006A, 5 }, { 0x01420066, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0104, 1 },
+    { 0x004B0102, 1 }, { 0x00C22019, -3 }, { 0x012400F4, -1 }, { 0x014300F2, -1 },
+    { 0x016200F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0049011B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C3012C, 1 }, { 0x004400C1, -1 }, { 0x00000000, 0 },
+    { 0x0041004E, 1 }, { 0x0177003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10145, 1 }, { 0x004200DA, -1 },
+    { 0x00DD00D0, 1 }, { 0x01560055, -2 }, { 0x017800C6, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB00E9, -1 }, { 0x015700E1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0131201B, -1 }, { 0x00D90102, -2 }, { 0x013600FC, -1 }, { 0x0158016D, -1 },
+    { 0x017400F8, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026013D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01720111, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0074003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059013C, 2 },
+    { 0x00D200C1, -1 }, { 0x00D50134, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A201B, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005400E2, -1 }, { 0x00D000DA, -1 }, { 0x012A0061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0115, -3 },
+    { 0x00000000, 0 }, { 0x002E201C, -3 }, { 0x005200FB, -1 }, { 0x00CE00F3, -1 },
+    { 0x01470078, -1 }, { 0x014A00EB, -1 }, { 0x01660076, 1 }, { 0x00000000, 0 },
+    { 0x201B012E, -1 }, { 0x00000000, 0 }, { 0x01242025, -1 }, { 0x00500114, -1 },
+    { 0x00000000, 0 }, { 0x004A002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190147, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00E90123, -1 }, { 0x00000000, 0 }, { 0x00C4003F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500CB, 1 }, { 0x00C20058, 2 },
+    { 0x01000054, -2 }, { 0x012200C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0069015D, 1 }, { 0x00000000, 0 }, { 0x006600EA, -1 },
+    { 0x00630077, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40170, -2 }, { 0x00DB201A, -3 },
+    { 0x00C100FD, -2 }, { 0x00FA2018, -1 }, { 0x0102016C, -2 }, { 0x01762010, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE0114, -1 }, { 0x00000000, 0 }, { 0x00D8002E, -2 },
+    { 0x0116002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250069, -1 }, { 0x01770123, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00580068, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005900F4, -1 }, { 0x017000E2, -1 }, { 0x00F10077, -1 }, { 0x012F0073, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D60178, -1 }, { 0x0057010D, -2 }, { 0x201C0041, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00CD, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CE00AB, -1 }, { 0x0166002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00E6, -3 }, { 0x00CF0137, 1 },
+    { 0x005000CC, -1 }, { 0x20180073, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0172, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F00E7, -3 }, { 0x004E00E5, -1 }, { 0x002C0074, -1 },
+    { 0x004B0072, -1 }, { 0x01050066, 5 }, { 0x01240064, -1 }, { 0x01430062, 1 },
+    { 0x00000000, 0 }, { 0x0066201B, 1 }, { 0x01280163, -1 }, { 0x01470161, -1 },
+    { 0x0166015F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01640178, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C40128, 1 }, { 0x01020124, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20141, 1 }, { 0x00DE00CC, -1 }, { 0x0100013D, 1 },
+    { 0x0176004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440162, -1 }, { 0x004100EF, -1 },
+    { 0x00DC00E5, -1 }, { 0x00F80070, 1 }, { 0x0136006C, 1 }, { 0x015800DD, -2 },
+    { 0x01740068, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00592025, -3 },
+    { 0x00DA00FE, 1 }, { 0x00DD0171, -1 }, { 0x00F4201B, -1 }, { 0x013700F8, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C011F, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F1002F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250152, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700C5, -4 },
+    { 0x00540052, 1 }, { 0x00D0004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580151, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CE0063, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D20162, -1 }, { 0x007200F5, -1 }, { 0x012C00E9, -1 }, { 0x016A00E5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C012A, -1 },
+    { 0x00000000, 0 }, { 0x0163201D, 1 }, { 0x016800FE, 1 }, { 0x00000000, 0 },
+    { 0x004B002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0143, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EA011F, -1 },
+    { 0x0128011B, -1 }, { 0x01470119, -1 }, { 0x01660117, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2018015C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010400C3, 1 }, { 0x0047005C, -1 }, { 0x00C30054, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B015B, -1 }, { 0x0124014D, -1 }, { 0x004800E8, -1 }, { 0x00640073, 1 },
+    { 0x00C1006D, -1 }, { 0x010200DC, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C5016C, -2 }, { 0x00460101, -1 },
+    { 0x01220166, -1 }, { 0x013E00F1, 2 }, { 0x01410164, -1 }, { 0x01600162, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01752025, -2 },
+    { 0x00C00112, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0129, 2 }, { 0x01590121, -1 }, { 0x0178011F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0142, 1 }, { 0x015400C7, -1 },
+    { 0x00590064, -1 }, { 0x00D5005C, -2 }, { 0x01760138, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2025010A, -1 }, { 0x00D9015B, -1 }, { 0x00F80159, 1 },
+    { 0x01360155, -1 }, { 0x0130006F, -1 }, { 0x01550153, -1 }, { 0x016E006B, 1 },
+    { 0x01740151, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580109, -1 }, { 0x00722026, -3 }, { 0x012C201A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E00C9, 1 }, { 0x00560122, -1 }, { 0x00CD2039, -1 }, { 0x201B0056, -1 },
+    { 0x006F003A, -1 }, { 0x203A0054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00E2, -3 }, { 0x2019006F, -3 }, { 0x012D012D, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D016E, -2 }, { 0x00000000, 0 }, { 0x201A00FB, -1 }, { 0x00520154, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0163005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180114, -1 },
+    { 0x00CC0165, -1 }, { 0x002E00FC, -1 }, { 0x014500EA, -1 }, { 0x01230079, 2 },
+    { 0x01420077, 2 }, { 0x0148015D, 1 }, { 0x016400E8, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0113, -1 }, { 0x01240105, -1 },
+    { 0x01430103, -1 }, { 0x01620101, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50124, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FD003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C3013D, 1 }, { 0x00000000, 0 }, { 0x00C000CA, 1 }, { 0x0158004D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20100178, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00E1, -1 }, { 0x00000000, 0 },
+    { 0x0118006A, 4 }, { 0x01560066, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015700F2, -1 }, { 0x017600F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500C2, 1 },
+    { 0x00D90113, -1 }, { 0x0136010D, -1 }, { 0x0155010B, -1 }, { 0x01740109, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026014E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005B0134, 2 }, { 0x005800C1, 1 }, { 0x01720122, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059014D, -1 }, { 0x0078014B, 1 },
+    { 0x00000000, 0 }, { 0x00720065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005400F3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0126, -2 }, { 0x00000000, 0 },
+    { 0x0055017F, -2 }, { 0x0052010C, -1 }, { 0x010F0173, 1 }, { 0x012B00FE, 3 },
+    { 0x01642019, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B013F, -1 },
+    { 0x201800CC, -1 }, { 0x00000000, 0 }, { 0x20150059, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0140, 1 },
+    { 0x002C00CD, 1 }, { 0x004E013E, 1 }, { 0x0102004C, 1 }, { 0x014300BB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004900E4, -1 }, { 0x00460071, -1 }, { 0x00C20069, -1 },
+    { 0x00C500DC, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01040164, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x017A0076, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01382025, 1 }, { 0x017E0175, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0174203A, -1 },
+    { 0x00BF0127, -1 }, { 0x00FD0123, -1 }, { 0x005C0047, -1 }, { 0x0116003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410148, -1 }, { 0x00DC013E, 1 }, { 0x013600C5, 1 }, { 0x01580136, 1 },
+    { 0x017400C1, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260106, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0178, -3 }, { 0x00D80170, -1 },
+    { 0x00590105, -1 }, { 0x01540168, -2 }, { 0x017000F3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0057011E, -1 }, { 0x016E010C, -1 }, { 0x005400AB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00DE, -2 }, { 0x00550137, 1 }, { 0x016C0125, 1 }, { 0x005200C4, 2 },
+    { 0x01470041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E016A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012C0142, 1 },
+    { 0x005000DD, -1 }, { 0x01640058, 1 }, { 0x016A013E, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EC015F, 1 },
+    { 0x002F00F8, -3 }, { 0x004E00F6, -1 }, { 0x01430073, -1 }, { 0x01620071, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014400FF, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0104011C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40139, 1 },
+    { 0x01210133, 1 }, { 0x00C100C6, 2 }, { 0x00DD0051, -1 }, { 0x011E00C0, -1 },
+    { 0x01780047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C20152, -1 }, { 0x0100014E, -1 }, { 0x00BF00DF, 4 }, { 0x00DE00DD, -2 },
+    { 0x01190066, 3 }, { 0x011C00D9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011D0165, 1 }, { 0x00410100, 1 }, { 0x00DC00F6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01780178, 1 }, { 0x00DA010F, -1 },
+    { 0x01512026, -2 }, { 0x00000000, 0 }, { 0x0077002F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0130, 1 }, { 0x01540120, -1 }, { 0x00000000, 0 }, { 0x014E003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250163, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700D6, -1 }, { 0x016E00C4, -2 },
+    { 0x00540063, -1 }, { 0x010E0057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A2026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D100E7, -1 },
+    { 0x012E00E1, -1 }, { 0x00CE0074, -1 }, { 0x014A006C, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0122, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00EE00FE, 3 }, { 0x016A00F6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C013B, -1 }, { 0x00000000, 0 },
+    { 0x201900C8, -2 }, { 0x00510121, 1 }, { 0x00CD0119, -1 }, { 0x012A0113, -1 },
+    { 0x0105002F, 1 }, { 0x0168010F, -1 }, { 0x00000000, 0 }, { 0x201A0154, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C5004C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010400D4, -1 }, { 0x0028006F, -1 }, { 0x0066006B, 3 }, { 0x017D0059, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C016E, -1 },
+    { 0x00000000, 0 }, { 0x00C400F1, -1 }, { 0x010200ED, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01410175, -1 }, { 0x00C2010A, -1 }, { 0x01000106, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00A10125, -1 },
+    { 0x00C00123, 1 }, { 0x011D011D, 1 }, { 0x00D9003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD013A, 2 }, { 0x00DA00C7, -1 }, { 0x20260076, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB0153, -1 }, { 0x007B00E6, -1 }, { 0x003A0077, 1 },
+    { 0x00590075, -1 }, { 0x015400D8, -1 }, { 0x0157014B, 1 }, { 0x01700063, -1 },
+    { 0x01760149, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D004E, -2 }, { 0x00000000, 0 }, { 0x00CE002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00DA, -1 },
+    { 0x201B0067, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0050004D, -1 },
+    { 0x0129003F, 1 }, { 0x0167003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00F3, -3 }, { 0x00000000, 0 }, { 0x00EF0142, 3 }, { 0x005100D9, -1 },
+    { 0x002F0068, 1 }, { 0x00E9005C, -2 }, { 0x012D013E, 3 }, { 0x016800C7, -1 },
+    { 0x00000000, 0 }, { 0x201A010C, -1 }, { 0x00ED015B, 1 }, { 0x00000000, 0 },
+    { 0x012800E4, -1 }, { 0x014700E2, -1 }, { 0x016600E0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00AD0178, -1 },
+    { 0x0121201C, 2 }, { 0x010700FF, 1 }, { 0x012600FD, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0126, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015C002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C200C2, 1 }, { 0x00DE004D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C3014E, -1 },
+    { 0x00000000, 0 }, { 0x00A100DD, -1 }, { 0x00410070, -1 }, { 0x00C000DB, -2 },
+    { 0x0177005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10167, -1 }, { 0x00000000, 0 }, { 0x00DD00F2, -1 }, { 0x01560077, -1 },
+    { 0x015900EA, -1 }, { 0x017800E8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013B0178, -2 }, { 0x00DB010B, -1 }, { 0x01570103, -1 },
+    { 0x01760101, -1 }, { 0x0059002D, -1 }, { 0x01790174, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500D3, -1 }, { 0x0136011E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01340137, 1 }, { 0x005800D2, -1 }, { 0x015000C2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0170014C, -1 }, { 0x005600EB, -2 }, { 0x011000DF, -1 },
+    { 0x00720076, 1 }, { 0x014E00DB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540104, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0137, -1 }, { 0x00000000, 0 }, { 0x201A00C4, 1 },
+    { 0x00CE0115, -1 }, { 0x014A010D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0150, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00500136, -1 }, { 0x002E00C5, 1 }, { 0x004D00C3, 1 },
+    { 0x004A0050, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190169, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0151, -3 }, { 0x002C00DE, 1 },
+    { 0x004E014F, -1 }, { 0x00670067, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0168, -1 },
+    { 0x004900F5, -1 }, { 0x00C500ED, -1 }, { 0x01000076, -2 }, { 0x011F0074, 1 },
+    { 0x013E0072, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01040175, -2 }, { 0x00C30106, -1 }, { 0x01200100, -1 }, { 0x01230173, 2 },
+    { 0x01420171, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1011F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0136, -1 },
+    { 0x00DB00C3, -2 }, { 0x005C0058, 2 }, { 0x01540048, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410159, -1 },
+    { 0x00DC014F, -1 }, { 0x013600D6, -1 }, { 0x01580147, 1 }, { 0x017400D2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013400EF, 1 }, { 0x017200EB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014C2025, -2 }, { 0x01700104, -2 },
+    { 0x201E004A, 4 }, { 0x0072002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016E011D, -1 }, { 0x201C0063, -3 }, { 0x00000000, 0 }, { 0x012A003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D10140, 1 }, { 0x005200D5, -1 }, { 0x010F013C, 4 },
+    { 0x012E013A, 1 }, { 0x014A00C5, -1 }, { 0x01660050, 1 }, { 0x00000000, 0 },
+    { 0x201B0108, -1 }, { 0x00000000, 0 }, { 0x012C0153, -1 }, { 0x00CC00E6, -1 },
+    { 0x0126006D, 1 }, { 0x0145006B, 1 }, { 0x016A014F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190121, -4 }, { 0x00000000, 0 }, { 0x002F0109, -3 },
+    { 0x00492026, -1 }, { 0x004E0107, -1 }, { 0x00E4201C, -1 }, { 0x01222018, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046003A, -2 },
+    { 0x013E002A, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0104012D, -1 }, { 0x0123012B, 1 },
+    { 0x00C0004B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C4014A, 1 }, { 0x01020146, -1 },
+    { 0x01210144, 1 }, { 0x00DD0062, 2 }, { 0x01780058, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20163, -1 },
+    { 0x00000000, 0 }, { 0x00BF00F0, -1 }, { 0x01760071, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250043, -1 }, { 0x00DC0107, -1 }, { 0x015800FF, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202600CF, 1 }, { 0x00DA0120, -1 }, { 0x01560118, 1 },
+    { 0x00000000, 0 }, { 0x00580042, 1 }, { 0x00D4003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0141, 1 },
+    { 0x00000000, 0 }, { 0x00D500C6, -1 }, { 0x013200C0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250174, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700E7, -2 }, { 0x00D300DF, -1 }, { 0x016E00D5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00580173, -1 }, { 0x00550100, -2 }, { 0x00D100F8, -1 },
+    { 0x012E00F2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0133, -1 }, { 0x00000000, 0 }, { 0x201B00C0, -4 }, { 0x00720117, -1 },
+    { 0x00CF0111, -1 }, { 0x012C010B, -1 }, { 0x016A0107, -1 }, { 0x2018004D, -1 },
+    { 0x00000000, 0 }, { 0x201C014C, -1 }, { 0x00000000, 0 }, { 0x201900D9, -2 },
+    { 0x01680120, -1 }, { 0x002F00C1, -3 }, { 0x00000000, 0 }, { 0x002C004E, 1 },
+    { 0x0162003A, -2 }, { 0x00000000, 0 }, { 0x201A0165, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00490065, -1 }, { 0x01220057, -1 }, { 0x01410055, -1 }, { 0x2018017E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0166, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C30076, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011C201B, -1 },
+    { 0x00C40102, 1 }, { 0x012100FC, 2 }, { 0x013B2019, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00460123, -1 }, { 0x00650121, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004100C9, 1 },
+    { 0x00000000, 0 }, { 0x01740042, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD014B, -1 },
+    { 0x00DA00D8, -1 }, { 0x015600D0, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025012C, 1 },
+    { 0x00000000, 0 }, { 0x01360177, -1 }, { 0x01550175, 1 }, { 0x00000000, 0 },
+    { 0x0054002C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058012B, 1 },
+    { 0x00000000, 0 }, { 0x00520045, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014E0134, -1 }, { 0x201B0078, -1 }, { 0x006F005C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0104, -4 },
+    { 0x0054015D, -1 }, { 0x00000000, 0 }, { 0x00CD00E2, -1 }, { 0x016800D8, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A011D, 1 }, { 0x00520176, -2 }, { 0x00E52018, -1 }, { 0x012800F5, -1 },
+    { 0x014700F3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20180136, -1 }, { 0x00000000, 0 }, { 0x002E011E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0101002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01240127, 1 }, { 0x01430125, 1 }, { 0x00C10047, -1 },
+    { 0x011E0041, -1 }, { 0x01620123, -1 }, { 0x017B003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50146, -1 }, { 0x00000000, 0 }, { 0x00C200D3, -1 },
+    { 0x00FD005C, -1 }, { 0x010000CF, 1 }, { 0x013B0058, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C000EC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10178, -2 },
+    { 0x011E0172, -1 }, { 0x00DD0103, -1 }, { 0x01732018, -1 }, { 0x017800F9, -1 },
+    { 0x017B016C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB011C, -1 }, { 0x00000000, 0 },
+    { 0x0151002E, -2 }, { 0x0170002C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0174012B, 1 },
+    { 0x00D600C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260170, -1 }, { 0x201E201C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005800E3, -1 }, { 0x00D400DB, -1 }, { 0x00D10068, 1 }, { 0x012E0062, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0059016F, -1 }, { 0x0078016D, 1 }, { 0x0170015D, -1 }, { 0x203A002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540115, -1 }, { 0x01282026, -1 },
+    { 0x20190049, -2 }, { 0x004E002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0148, -1 }, { 0x00000000, 0 }, { 0x201A00D5, -1 }, { 0x0052012E, 1 },
+    { 0x00000000, 0 }, { 0x014700AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B0161, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00500147, -1 }, { 0x002E00D6, -1 }, { 0x014500C4, -1 }, { 0x01040055, -2 },
+    { 0x016400C2, -3 }, { 0x00000000, 0 }, { 0x2019017A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00670078, 1 }, { 0x00C40072, -1 }, { 0x0102006E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00442025, -2 }, { 0x00C0201D, -3 },
+    { 0x00DF201B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0066011D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC002F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10130, 1 }, { 0x004200C5, -1 }, { 0x00DD00BB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0147, -1 }, { 0x00DB00D4, -1 },
+    { 0x00000000, 0 }, { 0x01540059, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041016A, -2 },
+    { 0x013600E7, -1 }, { 0x015500E5, -1 }, { 0x01580158, 1 }, { 0x017400E3, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260128, 1 }, { 0x00000000, 0 },
+    { 0x00D22025, -2 }, { 0x01340100, -1 }, { 0x01560171, -1 }, { 0x016D201B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590127, 2 }, { 0x01700115, -1 },
+    { 0x00000000, 0 }, { 0x016A002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570140, 2 },
+    { 0x00D000C5, -1 }, { 0x010E00C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0100, -5 }, { 0x00000000, 0 },
+    { 0x00D10151, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01280065, -1 },
+    { 0x01470063, -1 }, { 0x01660061, -1 }, { 0x00000000, 0 }, { 0x201B0119, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005000FF, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190132, -2 }, { 0x00000000, 0 }, { 0x01602025, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C4002A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002A00C0, -1 }, { 0x00C20043, -1 }, { 0x0100003F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C300CF, 1 }, { 0x00C0005C, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00480163, -1 }, { 0x01020157, -1 }, { 0x01210155, 1 },
+    { 0x00DD0073, -2 }, { 0x017B00DC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20174, -4 }, { 0x00D9201E, -3 },
+    { 0x00BF0101, -1 }, { 0x00F8201C, -1 }, { 0x01000170, -2 }, { 0x01742014, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410122, -1 }, { 0x01580110, 1 }, { 0x20250054, -2 }, { 0x005A003A, -1 },
+    { 0x0152002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0152, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0056006C, 2 }, { 0x014E005C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700F8, -2 }, { 0x013000EA, -1 }, { 0x016E00E6, -1 }, { 0x201C002C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01500174, -1 }, { 0x00550111, -1 }, { 0x00D10109, -1 }, { 0x012E0103, -1 },
+    { 0x201A0045, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B00D1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0046, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C015D, -2 }, { 0x00000000, 0 }, { 0x201900EA, -3 }, { 0x00000000, 0 },
+    { 0x002F00D2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0176, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C5006E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0177, -2 }, { 0x004A0102, -1 }, { 0x00C12019, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0048011B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C2012C, 1 }, { 0x01000128, 1 }, { 0x00000000, 0 }, { 0x0176003A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C00145, 1 }, { 0x004100DA, -2 }, { 0x015800C8, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420166, -1 }, { 0x00592010, -1 },
+    { 0x00DA00E9, -1 }, { 0x0172006C, 1 }, { 0x01780152, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0176016B, -1 },
+    { 0x005C010A, -1 }, { 0x00D80102, -1 }, { 0x015400FA, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025013D, 1 }, { 0x00000000, 0 },
+    { 0x00D1203A, -1 }, { 0x00790121, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0073003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058013C, 1 }, { 0x00D100C1, -1 },
+    { 0x00520056, -2 }, { 0x00D40134, -1 }, { 0x012E00BB, -1 }, { 0x201D0070, -1 },
+    { 0x00000000, 0 }, { 0x201E00FC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007200E0, -1 }, { 0x0050006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0115, -3 }, { 0x00000000, 0 },
+    { 0x00D00166, -1 }, { 0x00CD00F3, -1 }, { 0x010E0162, -1 }, { 0x016800E9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A012E, 1 },
+    { 0x00000000, 0 }, { 0x01232025, -1 }, { 0x01470104, -1 }, { 0x01660102, -3 },
+    { 0x0049002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180147, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E012F, -1 },
+    { 0x00E80123, -1 }, { 0x00C3003F, -1 }, { 0x0145011D, -1 }, { 0x0164011B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0146, -1 },
+    { 0x00000000, 0 }, { 0x00C400CB, 1 }, { 0x00C10058, 2 }, { 0x010200C7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0068015D, 1 }, { 0x00C50157, -1 }, { 0x00000000, 0 }, { 0x00BF0071, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00470178, -1 }, { 0x00C30170, -2 }, { 0x00C000FD, -2 },
+    { 0x00DA201A, -3 }, { 0x00F92018, -1 }, { 0x0120016A, -1 }, { 0x015E0166, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0178010A, -1 }, { 0x20260050, 1 }, { 0x00F6002C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01760123, -2 }, { 0x005C00C2, 2 }, { 0x0059004F, -1 },
+    { 0x01320041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F80144, 1 }, { 0x005A00DB, -1 },
+    { 0x00570068, 2 }, { 0x0111005C, 1 }, { 0x01360140, 1 }, { 0x0174013C, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800F4, -1 },
+    { 0x00000000, 0 }, { 0x010F0075, 1 }, { 0x016C006F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D50178, -1 },
+    { 0x0056010D, -2 }, { 0x012A201E, -1 }, { 0x0149201C, -1 }, { 0x0168201A, -3 },
+    { 0x201B0041, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00CD, -1 }, { 0x2019005A, -1 }, { 0x00000000, 0 }, { 0x00CD00AB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0159, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0052013F, 1 }, { 0x00CE0137, 1 },
+    { 0x00000000, 0 }, { 0x004C0059, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B0172, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040066, 4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F0173, -1 }, { 0x002C0100, 1 }, { 0x0046201D, 1 }, { 0x004B00FE, 1 },
+    { 0x0121007D, 1 }, { 0x012400F0, -1 }, { 0x01460161, 1 }, { 0x017E0077, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490117, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30128, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10141, 1 }, { 0x00000000, 0 }, { 0x017800C2, -3 }, { 0x01560051, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE0158, -1 }, { 0x00DB00E5, -1 }, { 0x005C007A, 1 },
+    { 0x0135006C, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00582025, -1 }, { 0x00D900FE, 1 },
+    { 0x00F3201B, -1 }, { 0x00F800FC, 1 }, { 0x013600F8, -1 }, { 0x015500F6, -1 },
+    { 0x01580169, -1 }, { 0x017400F4, -2 }, { 0x20260139, 1 }, { 0x00000000, 0 },
+    { 0x0172010D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590138, -1 }, { 0x005600C5, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570151, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CD0063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0111, -3 }, { 0x00000000, 0 }, { 0x002E2018, -3 },
+    { 0x014A00E7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B012A, -1 }, { 0x00000000, 0 },
+    { 0x010D0177, 1 }, { 0x0162201D, 1 }, { 0x00000000, 0 }, { 0x004A002A, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190143, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E9011F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C500C7, -1 }, { 0x00C20054, -2 }, { 0x012200C1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0142014B, 1 }, { 0x002800EA, -1 }, { 0x006600E6, -1 }, { 0x00C0006D, -1 },
+    { 0x011D0067, 1 }, { 0x012000DA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C4016C, -2 }, { 0x01020168, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01742025, -4 }, { 0x00DE0110, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410133, -1 },
+    { 0x0177011F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0152003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DA0142, 1 }, { 0x017200C5, -2 }, { 0x00580064, -1 },
+    { 0x00D4005C, -2 }, { 0x01500054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B0161, -1 }, { 0x00000000, 0 }, { 0x005900F0, -1 },
+    { 0x00F10073, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D60174, -1 }, { 0x00570109, -2 },
+    { 0x00712026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00C9, -2 },
+    { 0x00550122, -1 }, { 0x00CC2039, -1 }, { 0x201A0056, -3 }, { 0x0128002E, -1 },
+    { 0x0147002C, -2 }, { 0x0166002A, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B00E2, -3 }, { 0x2018006F, -3 }, { 0x00000000, 0 }, { 0x005000C8, -1 },
+    { 0x002E0057, -3 }, { 0x004D0055, -1 }, { 0x00000000, 0 }, { 0x201C016E, -1 },
+    { 0x00000000, 0 }, { 0x201900FB, -1 }, { 0x00000000, 0 }, { 0x002F00E3, -3 },
+    { 0x004E00E1, -1 }, { 0x004B006E, -1 }, { 0x01680142, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0147015D, -1 },
+    { 0x006B00F8, 1 }, { 0x0166015B, -1 }, { 0x01410077, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FF2026, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40124, 1 }, { 0x01020120, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2013D, 1 },
+    { 0x01000139, 1 }, { 0x00DE00C8, -1 }, { 0x011C00C4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DC00E1, -1 }, { 0x013900DB, -1 }, { 0x01360068, 1 },
+    { 0x015800D9, -2 }, { 0x01740064, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD016D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057203A, -1 }, { 0x007B0119, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2025014E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700C1, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0058014D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007200F1, 1 },
+    { 0x00CF00EB, -1 }, { 0x012C00E5, -1 }, { 0x016A00E1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0126, -1 }, { 0x00000000, 0 }, { 0x0144201B, -1 },
+    { 0x012A00FE, 1 }, { 0x01632019, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A013F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01280117, -1 }, { 0x01470115, -1 }, { 0x002A0041, -1 },
+    { 0x01660113, -1 }, { 0x20140059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0157, -1 },
+    { 0x004800E4, -1 }, { 0x00C10069, -1 }, { 0x00C400DC, -2 }, { 0x010200D8, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0041201C, -3 }, { 0x00C50168, -2 }, { 0x010000F1, -1 }, { 0x011F00EF, 1 },
+    { 0x01220162, -1 }, { 0x013E00ED, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0125, 2 },
+    { 0x011B0121, -1 }, { 0x0159011D, -1 }, { 0x0178011B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB013E, 1 }, { 0x005C00D3, -1 }, { 0x01320052, 1 }, { 0x015400C3, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250106, -1 },
+    { 0x00000000, 0 }, { 0x00F80155, 1 }, { 0x01360151, -1 }, { 0x0130006B, 1 },
+    { 0x0155014F, -1 }, { 0x016E0067, -1 }, { 0x0174014D, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580105, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00C5, 1 }, { 0x0056011E, -1 },
+    { 0x0170017F, -2 }, { 0x00000000, 0 }, { 0x0129002A, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00DE, -1 },
+    { 0x00540137, 1 }, { 0x00EF012D, 2 }, { 0x005100C4, -1 }, { 0x012D0129, 2 },
+    { 0x2019006B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D016A, -2 },
+    { 0x00000000, 0 }, { 0x00520150, -1 }, { 0x012B0142, 3 }, { 0x004F00DD, -1 },
+    { 0x0125005C, -3 }, { 0x014A0140, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x012600E8, -1 }, { 0x01040077, -2 }, { 0x01230075, 2 }, { 0x014500E6, -1 },
+    { 0x016400E4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B010F, -1 }, { 0x01240101, -1 }, { 0x016200FD, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30139, 1 }, { 0x00000000, 0 },
+    { 0x00C000C6, 2 }, { 0x00DC0051, -1 }, { 0x01580049, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10152, -1 },
+    { 0x00000000, 0 }, { 0x00DD00DD, 1 }, { 0x01180066, 3 }, { 0x017800D3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB00F6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D9010F, -1 }, { 0x01360109, -1 },
+    { 0x01502026, -2 }, { 0x0076002F, -1 }, { 0x01550107, -1 }, { 0x01740105, -2 },
+    { 0x2026014A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0172011E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014D003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590149, -1 }, { 0x005600D6, -1 }, { 0x014E00C6, -1 }, { 0x00720061, -1 },
+    { 0x016A0051, -1 }, { 0x01700137, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016E0150, -1 }, { 0x00000000, 0 }, { 0x014C00DF, -1 },
+    { 0x00CD0074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0122, -2 }, { 0x00000000, 0 }, { 0x010F016F, 1 }, { 0x00520108, -1 },
+    { 0x00ED00FE, 1 }, { 0x014A00F8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B013B, -1 }, { 0x00000000, 0 }, { 0x201800C8, -1 },
+    { 0x00500121, -1 }, { 0x00CC0119, -1 }, { 0x00000000, 0 }, { 0x004A003B, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F013C, 1 }, { 0x002C00C9, 1 }, { 0x004B00C7, -1 },
+    { 0x004E013A, 1 }, { 0x00C4004C, 1 }, { 0x01020048, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004900E0, -1 },
+    { 0x00C500D8, -1 }, { 0x013E005D, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C300F1, -1 }, { 0x00000000, 0 }, { 0x011D0078, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01210177, 2 }, { 0x00C1010A, -1 }, { 0x011E0104, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0123, 1 }, { 0x00FD011F, -1 },
+    { 0x005C0043, -1 }, { 0x00D8003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410144, -1 },
+    { 0x00D900C7, -1 }, { 0x005A005C, -1 }, { 0x00D60054, -1 }, { 0x00DC013A, 1 },
+    { 0x013600C1, 1 }, { 0x01580132, 1 }, { 0x20250076, -2 }, { 0x20260102, 1 },
+    { 0x00DA0153, -1 }, { 0x017200D6, -1 }, { 0x00580075, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0174, -3 }, { 0x0073201E, -1 }, { 0x00590101, -1 }, { 0x007800FF, 1 },
+    { 0x00D8016C, -1 }, { 0x01540164, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00522039, -1 }, { 0x016E0108, -1 },
+    { 0x201C004E, -1 }, { 0x00CD002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00DA, -2 }, { 0x201A0067, 1 },
+    { 0x010F0127, 4 }, { 0x005200C0, 2 }, { 0x012E0125, 1 }, { 0x0166003B, -2 },
+    { 0x016C0121, -1 }, { 0x00000000, 0 }, { 0x201E0166, -2 }, { 0x201B00F3, -3 },
+    { 0x00000000, 0 }, { 0x00EE0142, 3 }, { 0x005000D9, -1 }, { 0x00E8005C, -2 },
+    { 0x012C013E, 1 }, { 0x016A013A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019010C, -2 }, { 0x00EC015B, 1 }, { 0x002F00F4, -3 }, { 0x004E00F2, -1 },
+    { 0x01240071, -1 }, { 0x0143006F, -1 }, { 0x01680153, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0120201C, -1 },
+    { 0x012500FD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01040118, 1 }, { 0x00000000, 0 }, { 0x015B002C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01020131, -1 }, { 0x0121012F, 1 }, { 0x00C100C2, 1 },
+    { 0x00420057, -2 }, { 0x01780043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2014E, -1 }, { 0x0100014A, 1 },
+    { 0x00BF00DB, -1 }, { 0x00DE00D9, -1 }, { 0x011F0148, 1 }, { 0x013E0146, 2 },
+    { 0x0176005C, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00167, -1 },
+    { 0x013C015F, 1 }, { 0x00DC00F2, -1 }, { 0x01360079, -1 }, { 0x01550077, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01780174, 1 }, { 0x00DA010B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C012C, 1 }, { 0x0154011C, -1 },
+    { 0x00000000, 0 }, { 0x0110003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700D2, -1 }, { 0x016E00C0, -2 }, { 0x00D00057, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005500EB, -1 }, { 0x00D100E3, -1 }, { 0x014A0068, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E011E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012C00F6, -1 }, { 0x016A00F2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900C4, -5 }, { 0x0051011D, 1 },
+    { 0x00CD0115, -1 }, { 0x012A010F, -1 }, { 0x0168010B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50048, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0028006B, 2 },
+    { 0x00660067, -1 }, { 0x017D0055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C016A, -1 }, { 0x004800F5, -1 },
+    { 0x00C400ED, -1 }, { 0x01620156, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0139201D, -1 },
+    { 0x00C20106, -1 }, { 0x01000102, 1 }, { 0x013E00FE, 4 }, { 0x0158201B, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C0011F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0155002F, -2 }, { 0x0174002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA00C3, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB014F, -1 },
+    { 0x007B00E2, -1 }, { 0x00590071, -1 }, { 0x00D800DC, -1 }, { 0x015400D4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x003B00FF, 1 }, { 0x00000000, 0 }, { 0x016E0078, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D004A, -1 }, { 0x00000000, 0 },
+    { 0x0071002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E00D6, -1 }, { 0x00000000, 0 }, { 0x012F0121, 1 },
+    { 0x201B0063, -3 }, { 0x00500049, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00EF013E, 3 }, { 0x012D013A, 3 }, { 0x002F0064, -3 }, { 0x004E0062, 1 },
+    { 0x016800C3, -2 }, { 0x00000000, 0 }, { 0x201D017B, -1 }, { 0x201A0108, -1 },
+    { 0x00000000, 0 }, { 0x014A0151, -1 }, { 0x012800E0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180121, -3 }, { 0x00000000, 0 }, { 0x00482026, -1 }, { 0x00E3201C, -1 },
+    { 0x01212018, 2 }, { 0x012600F9, 1 }, { 0x016400F5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0122, -1 },
+    { 0x004B0120, -1 }, { 0x0162010E, 1 }, { 0x0045003A, -1 }, { 0x00FF002E, -2 },
+    { 0x011E002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50131, -1 }, { 0x00000000, 0 }, { 0x004600C6, -3 }, { 0x00DE0049, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C3014A, 1 }, { 0x00000000, 0 }, { 0x004400DF, -1 },
+    { 0x00DC0062, 1 }, { 0x0139005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10163, -1 }, { 0x00000000, 0 },
+    { 0x00DD00EE, 2 }, { 0x015900E6, -1 }, { 0x017800E4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011C0176, -1 },
+    { 0x00D62026, -2 }, { 0x00DB0107, -1 }, { 0x013B0174, -2 }, { 0x015700FF, 1 },
+    { 0x0171201C, -1 }, { 0x01790170, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202500CF, 1 }, { 0x00D90120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570042, 1 }, { 0x00D3003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D400C6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005600E7, -2 }, { 0x00D200DF, -1 }, { 0x00720072, 1 }, { 0x00CF006C, 1 },
+    { 0x011000DB, -1 }, { 0x016A0062, 1 }, { 0x201A2039, -1 }, { 0x00000000, 0 },
+    { 0x01300165, -1 }, { 0x00540100, -3 }, { 0x016E0161, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0133, -1 },
+    { 0x00000000, 0 }, { 0x201A00C0, 1 }, { 0x00CE0111, -1 }, { 0x014A0109, -1 },
+    { 0x01642026, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B014C, -1 }, { 0x00000000, 0 }, { 0x201800D9, -1 }, { 0x00500132, -1 },
+    { 0x002E00C1, 1 }, { 0x00000000, 0 }, { 0x0161003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F014D, -3 }, { 0x002C00DA, -1 }, { 0x004B00D8, -1 }, { 0x00480065, -1 },
+    { 0x01020059, -2 }, { 0x016200C6, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004C0164, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C20076, -2 }, { 0x01000072, -1 }, { 0x011F0070, 1 }, { 0x013E006E, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0123016F, 2 }, { 0x0028010C, -1 },
+    { 0x00C30102, 1 }, { 0x0142016D, 1 }, { 0x01782015, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0134, 4 }, { 0x00DE0132, -1 }, { 0x005C0054, -2 },
+    { 0x01540044, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410155, -1 }, { 0x00D900D8, -1 },
+    { 0x013600D2, -1 }, { 0x01580143, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BB0166, -1 },
+    { 0x017200E7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010E2025, -2 }, { 0x01320104, -1 }, { 0x01540175, -1 }, { 0x0053002C, -1 },
+    { 0x01700100, -2 }, { 0x201E0046, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014A203A, -1 }, { 0x0057012B, 1 }, { 0x016E0119, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00EB, -3 }, { 0x00000000, 0 }, { 0x00D1013C, 1 },
+    { 0x005200D1, 1 }, { 0x006E005C, -3 }, { 0x010F0138, 2 }, { 0x014A00C1, -1 },
+    { 0x00000000, 0 }, { 0x201E0177, -2 }, { 0x201B0104, -4 }, { 0x00000000, 0 },
+    { 0x012C014F, -1 }, { 0x005000EA, -1 }, { 0x002E0079, -2 }, { 0x00CC00E2, -1 },
+    { 0x01450067, -1 }, { 0x01640065, -1 }, { 0x00000000, 0 }, { 0x2019011D, -4 },
+    { 0x00510176, -1 }, { 0x00E42018, -1 }, { 0x002F0105, -3 }, { 0x004E0103, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0100002A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01040129, -1 }, { 0x004700C2, -1 }, { 0x00C00047, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C40146, -1 }, { 0x00000000, 0 }, { 0x00C100D3, -1 }, { 0x00FC005C, -2 },
+    { 0x01780054, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011F0159, 1 }, { 0x013E0157, 2 }, { 0x00000000, 0 },
+    { 0x0157006F, -1 }, { 0x0176006D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00178, -2 }, { 0x00000000, 0 },
+    { 0x00DC0103, -1 }, { 0x013900FD, -1 }, { 0x015800FB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600CB, 1 },
+    { 0x00000000, 0 }, { 0x00DA011C, -1 }, { 0x01560114, 1 }, { 0x0150002E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C013D, 1 }, { 0x00000000, 0 }, { 0x00D500C2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250170, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700E3, -2 },
+    { 0x00D300DB, -1 }, { 0x012D0062, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058016F, -1 },
+    { 0x00D100F4, -1 }, { 0x016C00EA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E012F, -1 },
+    { 0x014E0178, -1 }, { 0x00720113, -1 }, { 0x00CF010D, -1 }, { 0x012C0107, -1 },
+    { 0x016A0103, -1 }, { 0x20180049, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201900D5, -2 }, { 0x00000000, 0 }, { 0x004E00BB, -1 },
+    { 0x0168011C, -1 }, { 0x002C004A, 4 }, { 0x0124003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01470137, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490061, -1 }, { 0x00C50059, -2 },
+    { 0x00000000, 0 }, { 0x2018017A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0162, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30072, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046011F, -1 },
+    { 0x0065011D, -1 }, { 0x00000000, 0 }, { 0x00DB002F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C00130, 1 }, { 0x004100C5, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA00D4, -1 }, { 0x015600CC, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00572014, -1 }, { 0x007B00F3, -1 },
+    { 0x01760156, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250128, 1 }, { 0x00000000, 0 }, { 0x00D12025, -2 },
+    { 0x00F80177, 1 }, { 0x01360173, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00580127, 1 }, { 0x00000000, 0 }, { 0x00520041, 2 },
+    { 0x0169002F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560140, 2 }, { 0x01100134, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0100, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016800D4, -1 }, { 0x002F0075, -1 }, { 0x004E0073, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520172, -2 },
+    { 0x004A201E, -2 }, { 0x006E00FD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180132, -1 },
+    { 0x00000000, 0 }, { 0x015F2025, -1 }, { 0x002E011A, 1 }, { 0x00000000, 0 },
+    { 0x00C3002A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0133, -1 }, { 0x004B0131, -1 },
+    { 0x01430121, -1 }, { 0x00C10043, -1 }, { 0x0162011F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C200CF, 1 }, { 0x010000CB, 1 }, { 0x011C0056, -1 },
+    { 0x013B0054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC0073, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10174, -4 }, { 0x00D8201E, -2 }, { 0x011E016E, -1 },
+    { 0x017800F5, -1 }, { 0x017B0168, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0176010E, 1 }, { 0x00000000, 0 }, { 0x0059003A, -2 }, { 0x0132002C, -2 },
+    { 0x0151002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01740127, 2 }, { 0x00000000, 0 }, { 0x016E0041, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E2018, -3 },
+    { 0x2026016C, -1 }, { 0x00000000, 0 }, { 0x01720140, 1 }, { 0x00000000, 0 },
+    { 0x0055006C, 1 }, { 0x00D10064, -1 }, { 0x014D005C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059016B, -1 }, { 0x005600F8, -2 },
+    { 0x00780169, 1 }, { 0x010D0079, 1 }, { 0x016A0073, -1 }, { 0x201B002C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540111, -1 }, { 0x0166201E, -3 }, { 0x20190045, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0144, -1 },
+    { 0x201A00D1, 1 }, { 0x0052012A, 1 }, { 0x01452039, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B015D, -2 },
+    { 0x00000000, 0 }, { 0x201800EA, -3 }, { 0x00500143, -1 }, { 0x002E00D2, -1 },
+    { 0x014500C0, -1 }, { 0x01040051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190176, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B00E9, -1 }, { 0x00000000, 0 }, { 0x00670074, 1 }, { 0x00C4006E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C0175, -1 }, { 0x002A0104, -1 }, { 0x00C02019, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00660119, -1 }, { 0x01782026, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1012C, 1 },
+    { 0x004200C1, -1 }, { 0x017800AD, -1 }, { 0x0175003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE0143, -1 }, { 0x00000000, 0 }, { 0x017600C6, -3 }, { 0x007B0063, -1 },
+    { 0x01540055, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410166, -2 }, { 0x00D900E9, -1 }, { 0x013600E3, -1 },
+    { 0x015500E1, -1 }, { 0x01580154, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260124, 1 }, { 0x00000000, 0 }, { 0x0156016D, -1 }, { 0x017200F8, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590123, -2 }, { 0x01700111, -1 }, { 0x201E0057, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0057013C, 2 }, { 0x00D000C1, -1 }, { 0x00510056, -1 },
+    { 0x00D30134, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00FC, -1 }, { 0x00000000, 0 }, { 0x00D1014D, -1 }, { 0x010F0149, 2 },
+    { 0x00000000, 0 }, { 0x01280061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B0115, -3 }, { 0x00000000, 0 }, { 0x002C201C, -3 },
+    { 0x00CC00F3, -1 }, { 0x00000000, 0 }, { 0x01450078, -1 }, { 0x01640076, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019012E, -2 }, { 0x00000000, 0 },
+    { 0x01222025, -1 }, { 0x01490177, -1 }, { 0x00000000, 0 }, { 0x0048002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C2003F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01230138, 1 },
+    { 0x002800D5, -1 }, { 0x00C00058, 2 }, { 0x00C300CB, 1 }, { 0x012000C5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C40157, -1 }, { 0x00000000, 0 }, { 0x00DD006F, -1 }, { 0x01590067, -1 },
+    { 0x01780065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C20170, -2 }, { 0x00D9201A, -3 }, { 0x00F82018, -1 }, { 0x0100016C, -2 },
+    { 0x01362014, -1 }, { 0x01742010, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041011E, -1 }, { 0x0158010C, -1 },
+    { 0x20250050, 1 }, { 0x00D6002E, -2 }, { 0x00F5002C, -2 }, { 0x0114002A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600DC, -1 }, { 0x00000000, 0 },
+    { 0x01750123, -1 }, { 0x00000000, 0 }, { 0x0058004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C014E, -1 }, { 0x01350140, 2 }, { 0x00000000, 0 }, { 0x00560068, 2 },
+    { 0x0110005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00522013, -1 }, { 0x005700F4, -2 },
+    { 0x013000E6, -1 }, { 0x016E00E2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D40178, -1 }, { 0x0055010D, -1 },
+    { 0x00D10105, -1 }, { 0x0148201C, -1 }, { 0x01500170, -1 }, { 0x201A0041, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00CD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CC00AB, -1 }, { 0x002E0042, 1 },
+    { 0x0164002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201900E6, -3 }, { 0x00CD0137, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0172, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0173, -1 },
+    { 0x004A00FE, 1 }, { 0x01450161, -1 }, { 0x0164015F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01620178, 1 }, { 0x00480117, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0061002F, 1 }, { 0x00DD0027, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20128, 1 }, { 0x01000124, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00141, 1 },
+    { 0x004100D6, -1 }, { 0x015800C4, 2 }, { 0x0174004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00420162, -1 }, { 0x00DA00E5, -1 }, { 0x00DD0158, 1 }, { 0x0134006C, 1 },
+    { 0x015600DD, -2 }, { 0x01720068, 1 }, { 0x0178014E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00572025, -4 }, { 0x005C0106, -1 }, { 0x00F2201B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250139, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0079011D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D006C, -1 }, { 0x005500C5, -2 }, { 0x00520052, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560151, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CC0063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0111, -3 }, { 0x00000000, 0 }, { 0x00D00162, -1 }, { 0x012A00E9, -1 },
+    { 0x016800E5, -1 }, { 0x01270076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A012A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01470100, -1 }, { 0x016600FE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180143, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00E8011F, -1 }, { 0x0126011B, -1 }, { 0x01450119, -1 },
+    { 0x01640117, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0142, 1 }, { 0x00C400C7, -1 },
+    { 0x00C10054, -2 }, { 0x010200C3, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004600E8, -1 }, { 0x010000DC, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00470174, -1 },
+    { 0x00C3016C, -2 }, { 0x006300FF, 1 }, { 0x01200166, -1 }, { 0x015E0162, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0110, 1 }, { 0x01780106, -1 },
+    { 0x2026004C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01570121, -1 },
+    { 0x0176011F, -2 }, { 0x00000000, 0 }, { 0x0151003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D90142, 1 }, { 0x0136013C, 1 }, { 0x00570064, -2 }, { 0x00D3005C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01720151, -1 }, { 0x005800F0, -1 }, { 0x012E006F, -1 },
+    { 0x016C006B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D50174, -1 }, { 0x00560109, -2 }, { 0x00702026, -2 },
+    { 0x00F100FF, -1 }, { 0x012A201A, -1 }, { 0x01492018, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00C9, -1 }, { 0x20190056, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0155, -1 }, { 0x00000000, 0 },
+    { 0x0052013B, 1 }, { 0x012B012D, 2 }, { 0x00000000, 0 }, { 0x004C0055, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B016E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0161005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F016F, -1 }, { 0x002C00FC, -1 },
+    { 0x00462019, 1 }, { 0x004B00FA, -1 }, { 0x01210079, 2 }, { 0x0127015F, 1 },
+    { 0x014300EA, -1 }, { 0x0146015D, 1 }, { 0x016200E8, -1 }, { 0x00000000, 0 },
+    { 0x00490113, -1 }, { 0x00FE2026, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C30124, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410046, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1013D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BB0057, -1 }, { 0x0156004D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0154, -1 },
+    { 0x00DB00E1, -1 }, { 0x00000000, 0 }, { 0x005C0076, -2 }, { 0x01350068, 2 },
+    { 0x01540066, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410177, -2 }, { 0x013600F4, -1 }, { 0x015500F2, -1 }, { 0x017400F0, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0056203A, -1 }, { 0x01720109, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010F0029, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01700122, -1 },
+    { 0x005600C1, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0057014D, -2 }, { 0x00000000, 0 }, { 0x00510067, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D010D, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CE00EB, -1 }, { 0x014A00E3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B0126, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012900FE, 3 },
+    { 0x01622019, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019013F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F0127, 1 }, { 0x004E0125, 1 }, { 0x20130059, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500C3, 1 }, { 0x00000000, 0 },
+    { 0x0100004C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0104014B, -1 }, { 0x002800E6, -1 },
+    { 0x006600E2, -1 }, { 0x00A1006B, -1 }, { 0x00C00069, -1 }, { 0x00C300DC, -2 },
+    { 0x01230149, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40168, -2 },
+    { 0x01020164, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x017C0175, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041012F, -1 }, { 0x00DC0125, 1 },
+    { 0x00000000, 0 }, { 0x0114003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202600ED, -1 }, { 0x00000000, 0 }, { 0x00DA013E, 1 },
+    { 0x013400C5, -1 }, { 0x01560136, 1 }, { 0x017200C1, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B015D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005A0178, -1 }, { 0x00D60170, -1 }, { 0x00570105, -2 }, { 0x016E00F3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00C5, -5 }, { 0x0055011E, -1 }, { 0x016C010C, -1 },
+    { 0x005200AB, -1 }, { 0x201A0052, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00DE, -1 }, { 0x00000000, 0 },
+    { 0x00EE012D, 2 }, { 0x005000C4, -3 }, { 0x01450041, -1 }, { 0x016A0125, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C016A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012A0142, 1 }, { 0x0168013E, 1 }, { 0x01620058, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014200FF, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C40120, -1 }, { 0x0102011C, -1 }, { 0x00000000, 0 }, { 0x0178002E, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20139, 1 }, { 0x011F0133, 1 }, { 0x00DE00C4, -2 },
+    { 0x00DB0051, -1 }, { 0x011C00C0, -1 }, { 0x013E0131, 2 }, { 0x01760047, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00152, -1 }, { 0x00000000, 0 },
+    { 0x015800D5, -1 }, { 0x01360064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0169, -1 },
+    { 0x00DA00F6, -1 }, { 0x0178015F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01760178, 1 }, { 0x007B0115, -1 }, { 0x014F2026, -2 }, { 0x00000000, 0 },
+    { 0x0075002F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025014A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014C003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005500D6, -1 }, { 0x016C00C4, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CF00E7, -1 }, { 0x012C00E1, -1 }, { 0x00CC0074, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0122, -1 },
+    { 0x00000000, 0 }, { 0x00E7201D, 1 }, { 0x016800F6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A013B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01280113, -1 },
+    { 0x01470111, -1 }, { 0x0166010F, -1 }, { 0x0049003B, -1 }, { 0x0103002F, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00470054, -1 }, { 0x00C3004C, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B0153, -1 }, { 0x004800E0, -1 }, { 0x00C400D8, -1 },
+    { 0x010200D4, -1 }, { 0x017B0059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00412018, -3 }, { 0x00C200F1, -1 },
+    { 0x00C50164, -2 }, { 0x010000ED, -1 }, { 0x013B0076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C0010A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0121, -2 }, { 0x011B011D, -1 }, { 0x01590119, -1 },
+    { 0x01780117, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB013A, 1 }, { 0x005C00CF, 1 },
+    { 0x0059005C, 2 }, { 0x00D50054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250102, 1 }, { 0x00000000, 0 }, { 0x00D90153, -1 },
+    { 0x0136014D, -1 }, { 0x0155014B, 1 }, { 0x016E0063, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0072201E, -3 }, { 0x00580101, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E00C1, 1 }, { 0x00000000, 0 }, { 0x201B004E, -1 }, { 0x00000000, 0 },
+    { 0x00CC002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00DA, -1 }, { 0x20190067, -4 }, { 0x00EF0129, 2 },
+    { 0x005100C0, -1 }, { 0x002F004F, -1 }, { 0x012D0125, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0166, -1 }, { 0x00000000, 0 }, { 0x0052014C, -1 },
+    { 0x00ED0142, 1 }, { 0x004F00D9, -1 }, { 0x00E7005C, -1 }, { 0x012B013E, 3 },
+    { 0x014A013C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018010C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012600E4, -1 }, { 0x014500E2, -1 },
+    { 0x016400E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B010B, -1 }, { 0x011F201C, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C5011C, -1 }, { 0x00000000, 0 }, { 0x015A002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C000C2, 1 }, { 0x00410057, -4 },
+    { 0x01580045, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C1014E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0175005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB00F2, -1 }, { 0x01540077, -1 }, { 0x015700EA, -1 }, { 0x017600E8, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01390178, -2 },
+    { 0x00D9010B, -1 }, { 0x01360105, -1 }, { 0x01550103, -1 }, { 0x0057002D, -1 },
+    { 0x01580176, -2 }, { 0x01740101, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01320137, 1 }, { 0x005600D2, -1 },
+    { 0x011000C6, -1 }, { 0x014E00C2, -1 }, { 0x201E0079, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E014C, -1 },
+    { 0x005400EB, -1 }, { 0x010E00DF, -1 }, { 0x014C00DB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D011E, -2 }, { 0x00000000, 0 },
+    { 0x010F016B, 1 }, { 0x00520104, 2 }, { 0x014A00F4, -1 }, { 0x201A00AB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201800C4, -4 }, { 0x0050011D, -1 }, { 0x00CC0115, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190150, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0138, -1 },
+    { 0x002C00C5, 1 }, { 0x004B00C3, 1 }, { 0x00C40048, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C500D4, -1 }, { 0x00650067, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006600F3, -1 }, { 0x00C300ED, -1 },
+    { 0x011D0074, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01020175, -2 }, { 0x00C10106, -1 },
+    { 0x011E0100, -1 }, { 0x01210173, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF011F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0158012E, 1 }, { 0x00D900C3, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA014F, -1 }, { 0x01560147, 1 },
+    { 0x00580071, -1 }, { 0x017200D2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0170, -2 }, { 0x0054201C, 1 },
+    { 0x003A00FF, 1 }, { 0x0073201A, -1 }, { 0x007800FB, 1 }, { 0x00D80168, -1 },
+    { 0x013200EF, 1 }, { 0x017000EB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014A2025, -2 }, { 0x016E0104, -2 }, { 0x00000000, 0 }, { 0x0070002E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00D6, -2 }, { 0x00000000, 0 }, { 0x00D10127, 1 }, { 0x010F0123, 1 },
+    { 0x016C011D, -1 }, { 0x0128003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0162, -2 }, { 0x00000000, 0 }, { 0x00720146, 1 }, { 0x00CF0140, 1 },
+    { 0x00EE013E, 3 }, { 0x012C013A, 1 }, { 0x01640050, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190108, -2 }, { 0x00000000, 0 },
+    { 0x012A0153, -1 }, { 0x002F00F0, -3 }, { 0x0143006B, 1 }, { 0x0168014F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00472026, -1 }, { 0x00E2201C, -1 }, { 0x00E700FD, 1 },
+    { 0x01202018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040114, 1 },
+    { 0x00000000, 0 }, { 0x0044003A, -1 }, { 0x00FE002E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40131, -1 },
+    { 0x0102012D, -1 }, { 0x0121012B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C2014A, 1 }, { 0x01000146, -1 }, { 0x011F0144, 1 }, { 0x00DB0062, 1 },
+    { 0x0138005C, -2 }, { 0x013E0142, 4 }, { 0x01760058, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C00163, -1 }, { 0x004100F8, 1 }, { 0x013C015B, 1 },
+    { 0x00F80079, 1 }, { 0x01360075, -1 }, { 0x01740071, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D52026, -2 },
+    { 0x00DA0107, -1 }, { 0x0151201E, -2 }, { 0x015600FF, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0128, 1 }, { 0x01302039, -1 }, { 0x01540118, 1 }, { 0x00560042, 1 },
+    { 0x00D2003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D300C6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005500E7, -1 },
+    { 0x016C00D5, -1 }, { 0x00CE006C, 1 }, { 0x014A0064, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E011A, 1 }, { 0x00000000, 0 },
+    { 0x00CF00F8, -1 }, { 0x012C00F2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201900C0, -5 }, { 0x00CD0111, -1 }, { 0x012A010B, -1 }, { 0x01680107, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A014C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0160003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010400CC, 1 }, { 0x00000000, 0 }, { 0x00660063, -1 }, { 0x01200057, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0166, -2 }, { 0x006700EF, 1 }, { 0x00000000, 0 }, { 0x00C10076, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50175, -2 }, { 0x00C20102, 1 }, { 0x011F00FC, 2 },
+    { 0x01392019, -1 }, { 0x013E00FA, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0136002D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015400D0, 1 }, { 0x0059006D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01500102, -1 }, { 0x201D0046, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00D2, -1 },
+    { 0x00000000, 0 }, { 0x0056012B, 1 }, { 0x012F011D, 1 }, { 0x00500045, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00EB, -3 }, { 0x00000000, 0 }, { 0x00EF013A, 3 }, { 0x014C0134, -1 },
+    { 0x006D005C, -3 }, { 0x20190078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0104, 1 }, { 0x00000000, 0 }, { 0x014A014D, -1 },
+    { 0x00000000, 0 }, { 0x004C0077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018011D, -3 }, { 0x00500176, -1 },
+    { 0x00E32018, -1 }, { 0x012600F5, -1 }, { 0x014500F3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C011E, -1 }, { 0x004B011C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C5012D, -1 },
+    { 0x004600C2, -3 }, { 0x00DE0045, -1 }, { 0x011C0041, -1 }, { 0x0179003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280150, -1 },
+    { 0x00C30146, -1 }, { 0x004400DB, -1 }, { 0x00C000D3, -1 }, { 0x00FB005C, -2 },
+    { 0x01390058, 1 }, { 0x01580056, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00EA, -1 }, { 0x015900E2, -1 },
+    { 0x017800E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0178, -1 }, { 0x00DE0176, -2 }, { 0x00DB0103, -1 },
+    { 0x011C0172, -1 }, { 0x013800FD, 1 }, { 0x013B0170, -1 }, { 0x01712018, -1 },
+    { 0x017600F9, -1 }, { 0x0179016C, -1 }, { 0x202500CB, 1 }, { 0x00000000, 0 },
+    { 0x00D9011C, -1 }, { 0x00000000, 0 }, { 0x014F002E, -2 }, { 0x016E002C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D400C2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590156, 1 }, { 0x005600E3, -2 }, { 0x00D200DB, -1 },
+    { 0x0072006E, 1 }, { 0x00CF0068, 1 }, { 0x012C0062, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E015D, -1 }, { 0x00000000, 0 },
+    { 0x012D00EE, 2 }, { 0x01490079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D012F, -1 }, { 0x010F017C, 1 },
+    { 0x00CE010D, -1 }, { 0x01262026, -1 }, { 0x014A0105, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201800D5, -1 }, { 0x0050012E, -1 }, { 0x00000000, 0 }, { 0x014500AB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190161, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0149, -1 }, { 0x002C00D6, -1 },
+    { 0x004B00D4, -1 }, { 0x00480061, -1 }, { 0x00C40059, -2 }, { 0x01020055, -2 },
+    { 0x014300C4, -1 }, { 0x016200C2, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014100DD, -2 }, { 0x00C20072, -1 }, { 0x0100006E, -1 },
+    { 0x013E006A, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00422025, -1 }, { 0x00280108, -1 }, { 0x0123016B, 2 }, { 0x01420169, 1 },
+    { 0x01782011, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DA002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE012E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0050, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0158013F, 1 }, { 0x00D900D4, -1 }, { 0x00790067, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00562014, -1 }, { 0x00BB0162, -1 }, { 0x01560158, 1 },
+    { 0x017200E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D02025, -2 }, { 0x0059010E, 1 },
+    { 0x01320100, -1 }, { 0x01540171, -1 }, { 0x016B201B, -1 }, { 0x201E0042, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570127, 2 }, { 0x01300119, -1 }, { 0x00510041, -1 }, { 0x0168002F, -2 },
+    { 0x016E0115, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00E7, -3 },
+    { 0x00000000, 0 }, { 0x00550140, 1 }, { 0x005200CD, 1 }, { 0x201A0074, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0173, -1 },
+    { 0x201B0100, -4 }, { 0x00000000, 0 }, { 0x00720157, 1 }, { 0x005000E6, -1 },
+    { 0x002E0075, -1 }, { 0x00CF0151, -1 }, { 0x01260065, -1 }, { 0x01450063, -1 },
+    { 0x01640061, -1 }, { 0x20190119, -3 }, { 0x00510172, -1 }, { 0x0049201E, -1 },
+    { 0x002F0101, -3 }, { 0x0068201C, -1 }, { 0x006D00FD, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015E2025, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2002A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01230123, 1 }, { 0x00000000, 0 },
+    { 0x00C00043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670148, 1 }, { 0x00000000, 0 },
+    { 0x00C100CF, 1 }, { 0x00000000, 0 }, { 0x01780050, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01000157, -1 }, { 0x00BF00E8, -1 }, { 0x00DB0073, -1 }, { 0x011F0155, 1 },
+    { 0x017900DC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00A10176, -1 }, { 0x00C00174, -4 }, { 0x00F6201C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202600C7, -1 }, { 0x00000000, 0 }, { 0x01560110, 1 },
+    { 0x00000000, 0 }, { 0x0058003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0139, 1 },
+    { 0x007B0137, 2 }, { 0x005900C6, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025016C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054006C, 1 },
+    { 0x00EF0062, 3 }, { 0x014C005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0058016B, -1 }, { 0x005500F8, -1 }, { 0x00D100F0, -1 },
+    { 0x010F00EC, 2 }, { 0x012E00EA, -1 }, { 0x016C00E6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01100178, -1 }, { 0x0072010F, -1 },
+    { 0x00CF0109, -1 }, { 0x012C0103, -1 }, { 0x014E0174, -1 }, { 0x20180045, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900D1, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0046, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50055, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010400DD, -2 }, { 0x00C3006E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0177, -2 },
+    { 0x004B0175, -1 }, { 0x01240167, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0046011B, -1 }, { 0x01772026, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440134, -1 }, { 0x004100C1, 1 },
+    { 0x00C0012C, 1 }, { 0x0174003A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015600C8, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00572010, -1 }, { 0x01760152, -1 }, { 0x00000000, 0 }, { 0x0170006C, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250124, 1 },
+    { 0x00000000, 0 }, { 0x00F80173, 1 }, { 0x00D60102, -1 }, { 0x010F201D, 3 },
+    { 0x0136016F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CF203A, -1 }, { 0x00770121, -1 },
+    { 0x201D0057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0056013C, 2 }, { 0x00D20134, -1 }, { 0x00500056, -1 }, { 0x012C00BB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0071, -3 },
+    { 0x004E006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0052016E, -2 }, { 0x004A201A, -2 }, { 0x014700EB, -1 },
+    { 0x016600E9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2018012E, -1 }, { 0x00000000, 0 }, { 0x01212025, -1 },
+    { 0x002E0116, 1 }, { 0x01450104, -1 }, { 0x0047002E, -1 }, { 0x0066002C, -2 },
+    { 0x01480177, -1 }, { 0x01640102, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C012F, -1 }, { 0x00E60123, -1 }, { 0x00C1003F, -1 },
+    { 0x00FF003B, -1 }, { 0x01050121, 1 }, { 0x0143011D, -1 }, { 0x0162011B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C200CB, 1 },
+    { 0x00DE0056, -1 }, { 0x010000C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30157, -1 },
+    { 0x00000000, 0 }, { 0x00410079, -2 }, { 0x00DC006F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10170, -2 },
+    { 0x00D8201A, -2 }, { 0x00DD00FB, -1 }, { 0x011E016A, -1 }, { 0x015900F3, -1 },
+    { 0x015C0166, -1 }, { 0x017800F1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0176010A, -1 }, { 0x00000000, 0 },
+    { 0x00D5002E, -2 }, { 0x00F4002C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500DC, -1 }, { 0x00000000, 0 }, { 0x01360127, 1 },
+    { 0x01740123, -2 }, { 0x0057004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260168, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01340140, 1 }, { 0x0172013C, 1 }, { 0x00550068, 1 }, { 0x010F005C, 4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005600F4, -2 }, { 0x00000000, 0 }, { 0x016A006F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D30178, -1 }, { 0x0054010D, -1 }, { 0x0128201E, -1 },
+    { 0x0166201A, -3 }, { 0x20190041, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0140, -1 }, { 0x201A00CD, 1 }, { 0x00520126, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800E6, -3 },
+    { 0x0050013F, -1 }, { 0x002E00CE, 1 }, { 0x00CC0137, 1 }, { 0x004A0059, 1 },
+    { 0x0104004D, 1 }, { 0x00000000, 0 }, { 0x20190172, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B00E5, -1 }, { 0x00000000, 0 },
+    { 0x00670070, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01440161, 1 }, { 0x002A0100, -1 },
+    { 0x004900FE, 1 }, { 0x011F007D, 1 }, { 0x017C0077, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0123017C, 1 },
+    { 0x00280119, -1 }, { 0x00660115, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10128, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE013F, -1 }, { 0x00000000, 0 },
+    { 0x017600C2, -3 }, { 0x00D80059, -1 }, { 0x01540051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410162, -2 },
+    { 0x00D900E5, -1 }, { 0x01580150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260120, -1 }, { 0x00000000, 0 },
+    { 0x00562025, -4 }, { 0x00F1201B, -1 }, { 0x01560169, -1 }, { 0x017200F4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059011F, -2 }, { 0x0170010D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005400C5, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00F8, -3 }, { 0x00000000, 0 },
+    { 0x00550151, -1 }, { 0x005200DE, 1 }, { 0x00000000, 0 }, { 0x01660059, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0111, -3 },
+    { 0x00000000, 0 }, { 0x002C2018, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01260076, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019012A, -2 }, { 0x00000000, 0 }, { 0x010B0177, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004A0142, 1 }, { 0x00C300C7, -1 }, { 0x0044005C, -2 },
+    { 0x00A10056, -1 }, { 0x00C00054, -2 }, { 0x01040136, 1 }, { 0x012000C1, -1 },
+    { 0x00000000, 0 }, { 0x00670159, 1 }, { 0x00000000, 0 }, { 0x011E00DA, -1 },
+    { 0x00DD006B, 2 }, { 0x011B0067, -1 }, { 0x01590063, -1 }, { 0x01780061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2016C, -2 },
+    { 0x01000168, -2 }, { 0x01362010, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01722025, -3 }, { 0x0041011A, 1 }, { 0x01580108, -1 }, { 0x2025004C, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202600D8, -1 }, { 0x00000000, 0 }, { 0x01370123, 1 }, { 0x0175011F, -1 },
+    { 0x00000000, 0 }, { 0x0150003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C014A, 1 }, { 0x0135013C, 2 },
+    { 0x017000C5, -2 }, { 0x00560064, -2 }, { 0x00D2005C, -2 }, { 0x014E0054, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700F0, -2 }, { 0x013000E2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D40174, -1 }, { 0x00550109, -1 }, { 0x006F2026, -2 }, { 0x00D10101, -1 },
+    { 0x010F00FD, 2 }, { 0x01482018, -1 }, { 0x0150016C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B00C9, -1 }, { 0x20180056, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0126002E, -1 }, { 0x0145002C, -2 }, { 0x0164002A, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900E2, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0057, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A016E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01660142, 1 }, { 0x00000000, 0 }, { 0x0160005C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E016F, -1 }, { 0x0145015D, -1 }, { 0x010400EE, -1 },
+    { 0x012300EC, 1 }, { 0x0164015B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480113, -1 },
+    { 0x00FD2026, -2 }, { 0x017E00FF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C20124, 1 }, { 0x01000120, -1 }, { 0x01582039, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C0013D, 1 }, { 0x004100D2, -1 }, { 0x015800C0, 2 },
+    { 0x0136004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0154, 1 }, { 0x00DA00E1, -1 },
+    { 0x015600D9, -2 }, { 0x01340068, 1 }, { 0x01720064, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0102, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0068, -1 }, { 0x005500C1, -2 },
+    { 0x00000000, 0 }, { 0x0052004E, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056014D, -2 },
+    { 0x00000000, 0 }, { 0x00500067, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C010D, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CD00EB, -1 }, { 0x012A00E5, -1 }, { 0x016800E1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0126, 1 },
+    { 0x00000000, 0 }, { 0x0123201D, 2 }, { 0x012800FE, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2018013F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01260117, -1 },
+    { 0x01450115, -1 }, { 0x01640113, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B013E, 1 }, { 0x00C400C3, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004600E4, -1 }, { 0x00C200DC, -2 },
+    { 0x010000D8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00470170, -1 }, { 0x00C30168, -2 }, { 0x011D00EF, 1 },
+    { 0x01200162, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD010C, -1 }, { 0x01780102, -3 }, { 0x20260048, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB0125, 1 }, { 0x01190121, -1 }, { 0x00590047, -1 },
+    { 0x0157011D, -1 }, { 0x0176011B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202500ED, -1 }, { 0x00000000, 0 }, { 0x00D9013E, 1 }, { 0x01360138, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0172014D, -1 },
+    { 0x015000DC, -1 }, { 0x00D10071, -1 }, { 0x010F006D, 2 }, { 0x012E006B, 1 },
+    { 0x016C0067, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590178, 1 },
+    { 0x00D50170, -1 }, { 0x00560105, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00C5, -4 }, { 0x016E017F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0127002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0151, -3 }, { 0x201A00DE, 1 }, { 0x00000000, 0 }, { 0x012B0129, 2 },
+    { 0x004F00C4, -1 }, { 0x014A0127, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B016A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01290142, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F016B, -1 }, { 0x004B00F6, -1 }, { 0x012400E8, -1 }, { 0x01020077, -2 },
+    { 0x01210075, 2 }, { 0x0127015B, 1 }, { 0x014300E6, -1 }, { 0x016200E4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0049010F, -1 }, { 0x014100FF, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30120, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0177002E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10139, 1 }, { 0x00000000, 0 }, { 0x00DD00C4, -3 }, { 0x00DA0051, -1 },
+    { 0x01560049, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017600D3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D900F6, -1 },
+    { 0x013600F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014E2026, -2 }, { 0x01720105, -1 }, { 0x00000000, 0 }, { 0x0074002F, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0170011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014B003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E0137, 1 }, { 0x00000000, 0 },
+    { 0x014C00C6, -1 }, { 0x01680051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0109, -3 }, { 0x00000000, 0 }, { 0x016C0150, -1 },
+    { 0x00CE00E7, -1 }, { 0x00000000, 0 }, { 0x0147006C, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0122, -1 }, { 0x00000000, 0 },
+    { 0x0105201B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019013B, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0123, -3 }, { 0x004E0121, -1 },
+    { 0x00000000, 0 }, { 0x0048003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2004C, 1 }, { 0x01000048, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01040147, 1 }, { 0x002800E2, -1 }, { 0x00C300D8, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C40164, -2 }, { 0x00C100F1, -1 }, { 0x00000000, 0 },
+    { 0x01780072, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F82025, -2 }, { 0x011C0104, -1 },
+    { 0x011F0177, 2 }, { 0x013E0175, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0041012B, -1 }, { 0x00DC0121, -1 }, { 0x00000000, 0 }, { 0x00D6003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DA013A, 1 }, { 0x013400C1, -1 }, { 0x0058005C, 1 },
+    { 0x00D40054, -1 }, { 0x01560132, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900E8, -1 },
+    { 0x012F0067, 1 }, { 0x017000D6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A0174, -1 }, { 0x0071201E, -1 },
+    { 0x00570101, -2 }, { 0x00D6016C, -1 }, { 0x013000F3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00C1, -5 },
+    { 0x00000000, 0 }, { 0x016C0108, -1 }, { 0x201A004E, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B00DA, -1 }, { 0x00720131, 1 }, { 0x00EE0129, 2 }, { 0x005000C0, -3 },
+    { 0x002E004F, -1 }, { 0x004D004D, 1 }, { 0x012C0125, 1 }, { 0x0164003B, -2 },
+    { 0x016A0121, -1 }, { 0x20180067, -3 }, { 0x201900F3, -3 }, { 0x012A013E, 1 },
+    { 0x0168013A, 1 }, { 0x00E6005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01660153, -1 }, { 0x00000000, 0 }, { 0x00C50077, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FF201E, -2 }, { 0x010400FF, -2 }, { 0x011E201C, -1 },
+    { 0x012300FD, 2 }, { 0x014200FB, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C4011C, -1 },
+    { 0x01020118, 1 }, { 0x0159002C, -3 }, { 0x0178002A, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000131, -1 },
+    { 0x011F012F, 1 }, { 0x00DE00C0, -2 }, { 0x01760043, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C0014E, -1 }, { 0x011D0148, 1 }, { 0x015800D1, 1 }, { 0x0174005C, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013A015F, 1 }, { 0x0178015B, -2 }, { 0x00DA00F2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760174, 1 }, { 0x007B0111, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056002D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013000AB, -1 }, { 0x010E003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005500D2, -1 }, { 0x016C00C0, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007200E9, -1 },
+    { 0x00CF00E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C011E, -1 }, { 0x00000000, 0 }, { 0x00540177, 1 },
+    { 0x00510104, -1 }, { 0x00E72019, 1 }, { 0x012A00F6, -1 }, { 0x016800F2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0128010F, -1 }, { 0x0147010D, -1 }, { 0x0166010B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180150, -1 },
+    { 0x00000000, 0 }, { 0x201500DD, -1 }, { 0x00000000, 0 }, { 0x004A00C3, -1 },
+    { 0x00000000, 0 }, { 0x00C30048, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B014F, -1 },
+    { 0x00C400D4, -1 }, { 0x00000000, 0 }, { 0x017B0055, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004600F5, -1 }, { 0x00C200ED, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BB2025, -1 }, { 0x00C00106, -1 }, { 0x0156201B, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD011D, -2 },
+    { 0x01590115, -1 }, { 0x01780113, -1 }, { 0x20260059, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C00CB, 1 }, { 0x00590058, 2 }, { 0x00D800C3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D9014F, -1 }, { 0x00D600DC, -1 }, { 0x00570071, -2 },
+    { 0x01300063, -1 }, { 0x01360149, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0072201A, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016C0078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006F002E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00D6, -1 },
+    { 0x00000000, 0 }, { 0x00EF0125, 3 }, { 0x20190063, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0162, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CE0140, 1 }, { 0x00ED013E, 1 },
+    { 0x012B013A, 3 }, { 0x014700C5, -1 }, { 0x016600C3, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20180108, -1 }, { 0x00500161, -1 }, { 0x00000000, 0 },
+    { 0x012600E0, -1 }, { 0x0123006D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F017C, -2 },
+    { 0x00462026, -3 }, { 0x004B0107, -1 }, { 0x00E1201C, -1 }, { 0x011F2018, 2 },
+    { 0x016200F5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50118, 1 }, { 0x00000000, 0 },
+    { 0x0043003A, -1 }, { 0x00FD002E, -2 }, { 0x011C002C, -1 }, { 0x013B002A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00660137, 3 }, { 0x00C30131, -1 },
+    { 0x004400C6, -1 }, { 0x01580041, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1014A, 1 },
+    { 0x00000000, 0 }, { 0x00DD00D5, -1 }, { 0x00DA0062, 1 }, { 0x0137005C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015700E6, -1 }, { 0x017600E4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01390174, -2 }, { 0x00D42026, -2 }, { 0x00D90107, -1 },
+    { 0x01360101, -1 }, { 0x0150201E, -2 }, { 0x015500FF, 1 }, { 0x01580172, -2 },
+    { 0x016F201C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0075, -1 }, { 0x00000000, 0 }, { 0x00D200C6, -1 }, { 0x011000C2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005400E7, -1 }, { 0x00D000DF, -1 },
+    { 0x00CD006C, 1 }, { 0x010E00DB, -1 }, { 0x01680062, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D011A, -2 }, { 0x010F0167, 1 }, { 0x00520100, 2 },
+    { 0x00CE00F8, -1 }, { 0x012E0165, -1 }, { 0x014A00F0, -1 }, { 0x016C0161, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800C0, -4 },
+    { 0x00500119, -1 }, { 0x00CC0111, -1 }, { 0x01622026, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019014C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C00C1, 1 }, { 0x00000000, 0 },
+    { 0x015F003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00460065, -1 }, { 0x01000059, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002800F3, -1 }, { 0x006600EF, 3 }, { 0x00C00076, -2 }, { 0x011D0070, 1 },
+    { 0x017D00DD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C40175, -2 }, { 0x00C10102, 1 }, { 0x0121016F, 2 }, { 0x01762015, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF011B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0158012A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600FA, -1 }, { 0x00000000, 0 },
+    { 0x01560143, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00542018, 1 }, { 0x005900F9, -1 }, { 0x005C016C, -2 },
+    { 0x00D80164, -1 }, { 0x017000E7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E0100, -2 },
+    { 0x201C0046, -1 }, { 0x0051002C, 6 }, { 0x0070002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00D2, -2 }, { 0x00000000, 0 },
+    { 0x00D10123, -1 }, { 0x010F011F, 1 }, { 0x016C0119, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00EB, -3 },
+    { 0x00000000, 0 }, { 0x00CF013C, 1 }, { 0x005000D1, -1 }, { 0x00EE013A, 3 },
+    { 0x20180078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190104, -5 }, { 0x00000000, 0 }, { 0x012A014F, -1 }, { 0x004E00EA, -1 },
+    { 0x002C0079, -2 }, { 0x004B0077, -1 }, { 0x01430067, -1 }, { 0x01620065, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F0176, -1 }, { 0x00E22018, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FE002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00670133, 1 }, { 0x00C4012D, -1 }, { 0x01020129, -1 },
+    { 0x00000000, 0 }, { 0x0178003B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20146, -1 }, { 0x013E013E, 4 },
+    { 0x00DE00D1, -1 }, { 0x00FA005C, -2 }, { 0x01760054, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011D0159, 1 },
+    { 0x00000000, 0 }, { 0x00DC00EA, -1 }, { 0x00F80075, 1 }, { 0x01360071, -1 },
+    { 0x0155006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0176, 1 }, { 0x0151201A, -2 }, { 0x00DA0103, -1 }, { 0x015600FB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0124, 1 }, { 0x01540114, 1 },
+    { 0x00000000, 0 }, { 0x014E002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D300C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A201A, -1 }, { 0x00000000, 0 },
+    { 0x00580156, 1 }, { 0x005500E3, -1 }, { 0x00000000, 0 }, { 0x00CE0068, 1 },
+    { 0x012B0062, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0116, 1 }, { 0x012F0161, 1 }, { 0x00CF00F4, -1 }, { 0x016A00EA, -1 },
+    { 0x01480079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014C0178, -1 }, { 0x00CD010D, -1 },
+    { 0x012A0107, -1 }, { 0x01680103, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180161, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01450137, 1 }, { 0x00000000, 0 }, { 0x010400C8, 1 },
+    { 0x00280063, -1 }, { 0x00C30059, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0162, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10072, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00680177, -1 },
+    { 0x01582013, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D9002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026006A, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01340042, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C00DC, -2 }, { 0x015400CC, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01740156, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01300074, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CF2025, -1 }, { 0x0058010E, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E00CE, 1 }, { 0x00000000, 0 }, { 0x00560127, 2 },
+    { 0x203A0059, -1 }, { 0x00500041, -3 }, { 0x0167002F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00E7, -3 }, { 0x00000000, 0 },
+    { 0x00540140, 1 }, { 0x010E0134, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0173, -1 }, { 0x201A0100, 1 },
+    { 0x00000000, 0 }, { 0x00CE0151, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180119, -3 }, { 0x00500172, -1 }, { 0x0048201E, -1 }, { 0x0067201C, 2 },
+    { 0x012600F1, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015D2025, -1 },
+    { 0x002C011A, 1 }, { 0x00000000, 0 }, { 0x00C1002A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50129, -1 }, { 0x00000000, 0 }, { 0x00DE0041, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0028014C, -1 }, { 0x00000000, 0 }, { 0x00C000CF, 1 },
+    { 0x01390054, -1 }, { 0x01580052, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00640161, 1 }, { 0x00000000, 0 },
+    { 0x00DD00E6, -1 }, { 0x00DA0073, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0174, -1 },
+    { 0x00D6201E, -2 }, { 0x00DE0172, -1 }, { 0x00F5201C, -1 }, { 0x011C016E, -1 },
+    { 0x013B016C, -1 }, { 0x017600F5, -1 }, { 0x01790168, -1 }, { 0x00000000, 0 },
+    { 0x202500C7, -1 }, { 0x00000000, 0 }, { 0x0174010E, 1 }, { 0x00000000, 0 },
+    { 0x0057003A, -2 }, { 0x0130002C, -1 }, { 0x014F002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0134012B, 1 },
+    { 0x005800C6, 1 }, { 0x016C0041, -2 }, { 0x01720127, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590152, -1 },
+    { 0x01510142, 1 }, { 0x01700140, 1 }, { 0x00CF0064, -1 }, { 0x00EE0062, 3 },
+    { 0x014B005C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0111015F, 1 }, { 0x005400F8, -1 }, { 0x00EF00EE, 2 }, { 0x010B0079, 1 },
+    { 0x01680073, -1 }, { 0x2019002C, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CE0109, -1 }, { 0x014A0101, -1 },
+    { 0x0164201E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800D1, -1 }, { 0x0050012A, -1 },
+    { 0x01432039, -1 }, { 0x00000000, 0 }, { 0x004A0044, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019015D, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C00D2, -1 }, { 0x014300C0, -1 }, { 0x00C40055, -2 },
+    { 0x01020051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004900E9, -1 }, { 0x012200DB, -1 },
+    { 0x00C2006E, -1 }, { 0x013E0066, 1 }, { 0x014100D9, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01230167, 1 }, { 0x00470102, -1 },
+    { 0x01420165, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01762026, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE012A, -1 }, { 0x00000000, 0 }, { 0x017600AD, -1 },
+    { 0x005C004C, 1 }, { 0x007B004A, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0158013B, 1 }, { 0x00000000, 0 },
+    { 0x017400C6, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00562010, -1 },
+    { 0x01560154, 1 }, { 0x017200DF, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0154016D, -1 }, { 0x0059010A, -1 }, { 0x00D50102, -1 }, { 0x017000F8, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CE203A, -1 }, { 0x00570123, -2 }, { 0x00760121, -1 },
+    { 0x01300115, -1 }, { 0x0070003B, -1 }, { 0x016E0111, -1 }, { 0x201C0057, -1 },
+    { 0x00000000, 0 }, { 0x201D00E3, -3 }, { 0x00000000, 0 }, { 0x0055013C, 1 },
+    { 0x005200C9, 1 }, { 0x004F0056, -1 }, { 0x01660044, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E016F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00720153, -1 }, { 0x005000E2, -1 }, { 0x00CF014D, -1 }, { 0x01260061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190115, -3 },
+    { 0x0051016E, -1 }, { 0x0049201A, -1 }, { 0x00682018, -1 }, { 0x00000000, 0 },
+    { 0x01430078, -1 }, { 0x01620076, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01202025, -1 }, { 0x01660175, 1 },
+    { 0x00000000, 0 }, { 0x0046002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004A012D, 1 }, { 0x01040121, 2 }, { 0x00C0003F, -1 }, { 0x00FE003B, -1 },
+    { 0x0123011F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00670144, 1 }, { 0x00C100CB, 1 }, { 0x00DD0056, 1 },
+    { 0x011E00C5, -1 }, { 0x01210138, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0046015F, -1 }, { 0x00C20157, -1 }, { 0x00BF00E4, -1 },
+    { 0x00DB006F, -1 }, { 0x013B00DC, -1 }, { 0x01570067, -1 }, { 0x01760065, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440178, -1 }, { 0x00C00170, -2 },
+    { 0x00F62018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600C3, 1 },
+    { 0x00000000, 0 }, { 0x0156010C, -1 }, { 0x00000000, 0 }, { 0x00D4002E, -2 },
+    { 0x00F3002C, -2 }, { 0x0112002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01350127, 2 }, { 0x005900C2, -3 },
+    { 0x0056004F, -1 }, { 0x01730123, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250168, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540068, 1 }, { 0x010E005C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005500F4, -1 }, { 0x012E00E6, -1 }, { 0x014A0071, -1 }, { 0x016C00E2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D20178, -1 }, { 0x0072010B, -1 }, { 0x00CF0105, -1 }, { 0x01100174, -1 },
+    { 0x0146201C, -1 }, { 0x014E0170, -1 }, { 0x20180041, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201900CD, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0042, 1 }, { 0x0162002E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20180172, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010400D9, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0173, -1 }, { 0x004800FE, 1 }, { 0x004B0171, -1 },
+    { 0x0062201B, -1 }, { 0x006700FC, 2 }, { 0x01240163, -1 }, { 0x01430161, -1 },
+    { 0x0162015F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460117, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C00128, 1 }, { 0x00000000, 0 }, { 0x015800AB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015600C4, 2 },
+    { 0x0172004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0176014E, -1 }, { 0x007B00EB, -1 },
+    { 0x015400DD, -2 }, { 0x0132006C, 1 }, { 0x01700068, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250120, -1 }, { 0x00000000, 0 }, { 0x00552025, -3 },
+    { 0x00F0201B, -1 }, { 0x00F8016F, 1 }, { 0x010F2019, 3 }, { 0x0136016B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0077011D, -1 }, { 0x201D0053, -1 }, { 0x00000000, 0 },
+    { 0x00ED002F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00F8, -3 }, { 0x00000000, 0 }, { 0x00540151, -1 },
+    { 0x00000000, 0 }, { 0x002F006D, -1 }, { 0x004E006B, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0052016A, -2 }, { 0x012800E9, -1 }, { 0x014700E7, -1 }, { 0x01250076, -1 },
+    { 0x016600E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018012A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0112, 1 }, { 0x01450100, -1 },
+    { 0x016400FE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E6011F, -1 },
+    { 0x0105011D, 1 }, { 0x0124011B, -1 }, { 0x01430119, -1 }, { 0x01620117, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00490142, 1 }, { 0x00C200C7, -1 }, { 0x00DE0052, -1 }, { 0x010000C3, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC006B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1016C, -2 }, { 0x011E0166, -1 },
+    { 0x015C0162, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01760106, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500D8, -1 },
+    { 0x00000000, 0 }, { 0x01550121, -1 }, { 0x0174011F, -2 }, { 0x00000000, 0 },
+    { 0x014F003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260164, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0134013C, 1 }, { 0x00000000, 0 },
+    { 0x00550064, -1 }, { 0x00D1005C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01700151, -1 },
+    { 0x005600F0, -2 }, { 0x012C006F, -1 }, { 0x016A006B, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D30174, -1 },
+    { 0x00540109, -1 }, { 0x0128201A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D013C, -1 },
+    { 0x201A00C9, 1 }, { 0x00520122, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201800E2, -3 }, { 0x0050013B, -1 }, { 0x0129012D, 2 },
+    { 0x002E00CA, 1 }, { 0x01040049, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019016E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B00E1, -1 }, { 0x00000000, 0 }, { 0x015F005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0125015F, 1 }, { 0x0144015D, 1 }, { 0x00000000, 0 }, { 0x011F0079, 2 },
+    { 0x013E0077, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280115, -1 }, { 0x00660111, -1 },
+    { 0x0178201E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10124, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE013B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D80055, -1 },
+    { 0x0154004D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0158014C, -1 }, { 0x00D900E1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2026011C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x017200F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0059011B, -1 }, { 0x01700109, -1 }, { 0x201E004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016E0122, -1 }, { 0x005400C1, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00F4, -3 }, { 0x00000000, 0 }, { 0x0055014D, -1 }, { 0x005200DA, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B010D, -3 }, { 0x00000000, 0 }, { 0x00530166, -1 },
+    { 0x005000F3, -1 }, { 0x00CC00EB, -1 }, { 0x01260072, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190126, -2 }, { 0x00000000, 0 },
+    { 0x0051017F, -1 }, { 0x0141201B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B0123, 1 }, { 0x20110059, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A013E, 1 },
+    { 0x00C300C3, 1 }, { 0x01040132, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00670155, 1 }, { 0x00C100DC, -2 }, { 0x00DD0067, -2 }, { 0x0102014B, -1 },
+    { 0x01210149, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20168, -2 }, { 0x00BF00F5, -1 }, { 0x01000164, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01342025, -2 }, { 0x00410116, 1 },
+    { 0x00DC010C, -1 }, { 0x0079002C, -2 }, { 0x01580104, 2 }, { 0x017A0175, 1 },
+    { 0x20250048, 1 }, { 0x00000000, 0 }, { 0x202600D4, -1 }, { 0x00000000, 0 },
+    { 0x00DA0125, 1 }, { 0x0137011F, 1 }, { 0x00580047, -1 }, { 0x0112003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01540136, 1 }, { 0x005900D3, -1 }, { 0x01100054, -1 },
+    { 0x013200C5, -1 }, { 0x017000C1, -2 }, { 0x00000000, 0 }, { 0x201D2025, -6 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540079, 1 }, { 0x012D006B, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580178, 1 }, { 0x00D40170, -1 },
+    { 0x00550105, -1 }, { 0x010F00F9, 1 }, { 0x01500168, -1 }, { 0x016C00F3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00C5, -4 },
+    { 0x00000000, 0 }, { 0x016A010C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0151, -3 },
+    { 0x201900DE, -2 }, { 0x00000000, 0 }, { 0x01680125, 1 }, { 0x002F00C6, -4 },
+    { 0x004B0051, -1 }, { 0x004E00C4, -1 }, { 0x01430041, -1 }, { 0x00000000, 0 },
+    { 0x201A016A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01280142, 1 },
+    { 0x004C00DD, -2 }, { 0x0122005C, -1 }, { 0x01470140, 1 }, { 0x0166013E, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E016B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0048010F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20120, -1 }, { 0x0100011C, -1 },
+    { 0x00000000, 0 }, { 0x0176002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00139, 1 },
+    { 0x004100CE, 1 }, { 0x00DC00C4, -2 }, { 0x00D90051, -1 }, { 0x011D0133, 1 },
+    { 0x01740047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0150, -1 }, { 0x01590148, 1 }, { 0x015600D5, -1 }, { 0x01780146, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0176015F, -2 }, { 0x005C00FE, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01740178, 1 }, { 0x014D2026, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0073002F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0064, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016A00C4, -2 },
+    { 0x00500063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0109, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CD00E7, -1 },
+    { 0x012A00E1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0122, -1 }, { 0x00000000, 0 }, { 0x0104201B, -3 },
+    { 0x01232019, 2 }, { 0x014700F8, -1 }, { 0x016600F6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018013B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0123, 1 }, { 0x01260113, -1 }, { 0x01450111, -1 },
+    { 0x0101002F, 1 }, { 0x0164010F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B013A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C1004C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490153, -1 },
+    { 0x004600E0, -1 }, { 0x00C200D8, -1 }, { 0x00BF0065, -1 }, { 0x00C5014B, -1 },
+    { 0x010000D4, -1 }, { 0x01790059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0047016C, -1 }, { 0x00C000F1, -1 }, { 0x00C30164, -2 }, { 0x01390076, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0108, -1 }, { 0x017800FE, 2 },
+    { 0x20260044, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0121, -1 },
+    { 0x0119011D, -1 }, { 0x00590043, -1 }, { 0x00D5003B, -1 }, { 0x01570119, -1 },
+    { 0x01760117, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D9013A, 1 }, { 0x00F80138, 1 }, { 0x0057005C, 2 }, { 0x00D30054, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260175, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800E8, -1 }, { 0x010F0069, 2 },
+    { 0x016C0063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590174, 1 }, { 0x0070201E, -2 }, { 0x00560101, -2 },
+    { 0x00D5016C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00C1, -4 }, { 0x00000000, 0 },
+    { 0x2019004E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D014D, -3 }, { 0x201A00DA, -1 },
+    { 0x00000000, 0 }, { 0x012B0125, 3 }, { 0x004F00C0, -1 }, { 0x014A0123, -1 },
+    { 0x0163003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x203A0164, -1 },
+    { 0x201800F3, -3 }, { 0x00000000, 0 }, { 0x0129013E, 3 }, { 0x002E00DB, -1 },
+    { 0x004D00D9, -1 }, { 0x00E5005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0167, -1 }, { 0x00000000, 0 },
+    { 0x004B00F2, -1 }, { 0x0067007D, 1 }, { 0x00C40077, -2 }, { 0x012400E4, -1 },
+    { 0x014300E2, -1 }, { 0x016200E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0049010B, -1 }, { 0x00FE201E, -2 }, { 0x011D201C, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD2039, -1 }, { 0x00C3011C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD00C0, -3 }, { 0x01560045, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B006C, 2 }, { 0x0173005C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D900F2, -1 }, { 0x015500EA, -1 },
+    { 0x017400E8, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01560176, -2 }, { 0x01102026, -2 }, { 0x01720101, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01300137, 1 }, { 0x00000000, 0 }, { 0x010E00C6, -1 }, { 0x014C00C2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0105, -3 }, { 0x016C014C, -1 }, { 0x00CE00E3, -1 }, { 0x00000000, 0 },
+    { 0x006E0076, -1 }, { 0x01470068, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B011E, -1 }, { 0x00000000, 0 }, { 0x00720175, 1 }, { 0x00500104, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190137, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F011F, -3 }, { 0x004E011D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201400DD, -1 }, { 0x00000000, 0 }, { 0x002A00C5, -1 }, { 0x00000000, 0 },
+    { 0x00C20048, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040143, 1 }, { 0x004700DC, -1 },
+    { 0x00C300D4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C100ED, -1 }, { 0x00000000, 0 }, { 0x00DD0078, -1 }, { 0x01590070, 1 },
+    { 0x0178006E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01000175, -2 }, { 0x00DE0104, -2 }, { 0x011C0100, -1 }, { 0x011F0173, 2 },
+    { 0x013E0171, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC011D, -1 }, { 0x20250059, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0156012E, 1 },
+    { 0x00000000, 0 }, { 0x00580058, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01540147, 1 }, { 0x005900E4, -1 }, { 0x00560071, -2 }, { 0x00D500DC, -1 },
+    { 0x017000D2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005A0170, -1 }, { 0x0052201C, -2 }, { 0x0071201A, -1 }, { 0x00D60168, -1 },
+    { 0x016E00EB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016C0104, -2 },
+    { 0x201A004A, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00D6, -1 }, { 0x00000000, 0 },
+    { 0x00CF0127, 1 }, { 0x00EE0125, 3 }, { 0x002E004B, 1 }, { 0x0126003B, -1 },
+    { 0x016A011D, -1 }, { 0x20180063, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CD0140, 1 }, { 0x012A013A, 1 }, { 0x004B0062, 1 },
+    { 0x01620050, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006E015F, 1 }, { 0x01280153, -1 }, { 0x01470151, -1 },
+    { 0x00680079, -1 }, { 0x0166014F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E0201C, -1 },
+    { 0x00FF201A, -2 }, { 0x011E2018, -1 }, { 0x012300F9, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C40118, 1 }, { 0x01020114, 1 }, { 0x0042003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20131, -1 }, { 0x0100012D, -1 }, { 0x011F012B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C0014A, 1 }, { 0x011D0144, 1 },
+    { 0x00DC00D5, -1 }, { 0x00D90062, 1 }, { 0x0136005C, 1 }, { 0x015800CD, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0161, -2 },
+    { 0x00592015, -1 }, { 0x013A015B, 1 }, { 0x01590159, 1 }, { 0x01720071, -1 },
+    { 0x01780157, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B010D, -1 }, { 0x00D32026, -2 }, { 0x014F201E, -2 },
+    { 0x015400FF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012E2039, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540042, 1 }, { 0x00D0003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0075, -1 },
+    { 0x00000000, 0 }, { 0x00D100C6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007200E5, -1 }, { 0x016A00D5, -1 }, { 0x00CC006C, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C011A, -1 }, { 0x00000000, 0 }, { 0x00510100, -1 }, { 0x00CD00F8, -1 },
+    { 0x012A00F2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0133, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0128010B, -1 },
+    { 0x01470109, -1 }, { 0x01612026, -1 }, { 0x01660107, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2018014C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0134, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015E003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B014B, -1 }, { 0x010200CC, 1 }, { 0x00000000, 0 },
+    { 0x011E0057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30175, -2 },
+    { 0x00C00102, 1 }, { 0x011D00FC, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00420123, -1 }, { 0x00DD0119, -1 }, { 0x01590111, -1 },
+    { 0x0178010F, -1 }, { 0x20260055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C00C7, -1 },
+    { 0x00590054, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500FA, -1 }, { 0x00000000, 0 }, { 0x00F80149, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005800F9, -1 }, { 0x010F007A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014E0102, -1 }, { 0x201B0046, -1 },
+    { 0x0050002C, -3 }, { 0x006F002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00D2, -1 }, { 0x0147203A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F0047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D015E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CE013C, 1 }, { 0x00ED013A, 1 }, { 0x006B005C, -1 }, { 0x014700C1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180104, -4 },
+    { 0x0050015D, -1 }, { 0x00000000, 0 }, { 0x002E00EC, -1 }, { 0x01230069, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E12018, -1 }, { 0x004B0103, -1 },
+    { 0x012400F5, -1 }, { 0x014300F3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50114, 1 }, { 0x00000000, 0 }, { 0x00DE002C, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00280137, 2 }, { 0x00C3012D, -1 }, { 0x004400C2, -1 }, { 0x0041004F, -1 },
+    { 0x0177003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10146, -1 }, { 0x00000000, 0 }, { 0x004200DB, -1 },
+    { 0x00F9005C, -2 }, { 0x01560056, -2 }, { 0x017800C7, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB00EA, -1 }, { 0x015700E2, -1 }, { 0x017600E0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01390170, -1 },
+    { 0x0131201C, -1 }, { 0x00D90103, -1 }, { 0x013600FD, -1 }, { 0x0150201A, -2 },
+    { 0x0158016E, -2 }, { 0x016F2018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014D002E, -2 }, { 0x016C002C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D200C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A201C, -3 }, { 0x00000000, 0 }, { 0x00570156, 1 },
+    { 0x005400E3, -1 }, { 0x00D000DB, -1 }, { 0x00CD0068, 1 }, { 0x012A0062, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0116, -2 },
+    { 0x002E201D, -3 }, { 0x004D201B, -1 }, { 0x005200FC, -1 }, { 0x00CE00F4, -1 },
+    { 0x010F0163, 1 }, { 0x012B00EE, 2 }, { 0x01660077, 1 }, { 0x016C015D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00500115, -1 }, { 0x00CC010D, -1 },
+    { 0x01242026, -1 }, { 0x004A002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190148, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014300AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C500CC, 1 }, { 0x00000000, 0 }, { 0x00460061, -1 },
+    { 0x00C20059, -2 }, { 0x01000055, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006600EB, -1 }, { 0x017D00D9, -1 },
+    { 0x00C00072, -1 }, { 0x013C006A, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670177, 2 }, { 0x0121016B, 2 },
+    { 0x01762011, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF0117, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D8002F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410138, -1 }, { 0x01580126, 1 }, { 0x2025006A, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0156013F, 1 }, { 0x00000000, 0 },
+    { 0x00770067, -1 }, { 0x01500059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0168, -2 },
+    { 0x005900F5, -1 }, { 0x01540158, 1 }, { 0x017000E3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CE2025, -1 }, { 0x0057010E, 1 }, { 0x0169201B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00CE, -2 }, { 0x00000000, 0 }, { 0x00550127, 1 }, { 0x00D1011F, -1 },
+    { 0x004F0041, -1 }, { 0x012E0119, -1 }, { 0x0166002F, -2 }, { 0x016C0115, -1 },
+    { 0x00000000, 0 }, { 0x201B00E7, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005000CD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190100, -5 }, { 0x00000000, 0 },
+    { 0x00CD0151, -1 }, { 0x002F00E8, -3 }, { 0x002C0075, -1 }, { 0x004B0073, -1 },
+    { 0x004E00E6, -1 }, { 0x01050067, 1 }, { 0x01240065, -1 }, { 0x01430063, -1 },
+    { 0x004F0172, -1 }, { 0x0047201E, -1 }, { 0x004C00FF, -1 }, { 0x0066201C, 1 },
+    { 0x01620061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015C2025, -1 }, { 0x0104010C, -1 },
+    { 0x00000000, 0 }, { 0x00C0002A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0067012F, 1 }, { 0x00C40129, -1 }, { 0x00DD0041, -3 }, { 0x01210123, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013E013A, 4 }, { 0x00DE00CD, -1 }, { 0x00000000, 0 },
+    { 0x01760050, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011D0155, 1 }, { 0x00DC00E6, -1 },
+    { 0x00D90073, -1 }, { 0x0136006D, -1 }, { 0x015800DE, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00592026, -3 },
+    { 0x00D5201E, -2 }, { 0x00F4201C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0120, -1 }, { 0x01540110, 1 }, { 0x005900AD, -1 }, { 0x0056003A, -2 },
+    { 0x0110002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700C6, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580152, -1 }, { 0x00000000, 0 },
+    { 0x005500DF, -2 }, { 0x0071006A, 4 }, { 0x00CE0064, -1 }, { 0x00ED0062, 1 },
+    { 0x014A005C, 1 }, { 0x00000000, 0 }, { 0x201E0112, 1 }, { 0x00F10161, 1 },
+    { 0x007200F6, -1 }, { 0x00CF00F0, -1 }, { 0x00EE00EE, 2 }, { 0x012C00EA, -1 },
+    { 0x012F015D, 1 }, { 0x016A00E6, -1 }, { 0x2018002C, -3 }, { 0x00000000, 0 },
+    { 0x010E0178, -1 }, { 0x00CD0109, -1 }, { 0x012A0103, -1 }, { 0x014C0174, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2018015D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0145, 1 },
+    { 0x004A00D0, 1 }, { 0x010400C4, 1 }, { 0x00C30055, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004800E9, -1 }, { 0x010200DD, -2 }, { 0x00C1006E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460102, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01752026, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01780120, -1 }, { 0x20260066, 1 }, { 0x00000000, 0 }, { 0x0172003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C00D8, -1 }, { 0x015400C8, 1 },
+    { 0x00590065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01740152, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016E006C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010D201D, 1 },
+    { 0x0058010A, -1 }, { 0x00D40102, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CD203A, -1 }, { 0x00560123, -2 }, { 0x201B0057, -1 }, { 0x201E00CA, 1 },
+    { 0x006F003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00E3, -3 }, { 0x00000000, 0 }, { 0x0054013C, 1 }, { 0x00D00134, -1 },
+    { 0x012A00BB, -1 }, { 0x20190070, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D016F, -1 }, { 0x201A00FC, -1 }, { 0x00000000, 0 }, { 0x00CE014D, -1 },
+    { 0x016600D0, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180115, -3 }, { 0x0050016E, -1 },
+    { 0x0048201A, -1 }, { 0x002E00FD, -2 }, { 0x00672018, 2 }, { 0x0123007A, 1 },
+    { 0x01420078, 1 }, { 0x014500EB, -1 }, { 0x016400E9, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011F2025, -1 }, { 0x002C0116, 1 }, { 0x01430104, -1 },
+    { 0x01460177, -1 }, { 0x01620102, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FD003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C000CB, 1 }, { 0x00000000, 0 }, { 0x0158004E, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0064015D, 1 }, { 0x00C10157, -1 }, { 0x00DD00E2, -1 }, { 0x00DA006F, -1 },
+    { 0x017800D8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0170, -1 }, { 0x00D6201A, -2 }, { 0x00DE016E, -1 },
+    { 0x00F52018, -1 }, { 0x011C016A, -1 }, { 0x013B0168, -1 }, { 0x015700F3, -1 },
+    { 0x015A0166, -1 }, { 0x017600F1, -1 }, { 0x202500C3, 1 }, { 0x00000000, 0 },
+    { 0x0174010A, -1 }, { 0x00000000, 0 }, { 0x00D3002E, -2 }, { 0x00F2002C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01340127, 1 }, { 0x005800C2, 1 }, { 0x0055004F, -1 },
+    { 0x01720123, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0059014E, -1 }, { 0x01320140, 1 }, { 0x0170013C, 1 },
+    { 0x010D005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0111015B, 1 }, { 0x005400F4, -1 },
+    { 0x00000000, 0 }, { 0x0168006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0127, -1 }, { 0x00000000, 0 },
+    { 0x0126201E, -1 }, { 0x00CE0105, -1 }, { 0x0164201A, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201800CD, -1 }, { 0x00500126, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0161002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190159, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C00CE, 1 },
+    { 0x00000000, 0 }, { 0x00C40051, -1 }, { 0x0102004D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004900E5, -1 }, { 0x00C500DD, -2 }, { 0x013E0062, 4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0061201B, -1 }, { 0x00DD2013, -1 }, { 0x01040165, -1 }, { 0x011D007D, 1 },
+    { 0x01230163, 1 }, { 0x017A0077, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0121017C, 1 }, { 0x01382026, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0126, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0048, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410149, -1 }, { 0x00000000, 0 }, { 0x013600C6, 1 }, { 0x00D60059, -1 },
+    { 0x017400C2, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01560150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00542025, -3 }, { 0x00590106, -1 },
+    { 0x01540169, -1 }, { 0x017000F4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0057011F, -2 }, { 0x0076011D, -1 }, { 0x01300111, -1 }, { 0x00EC002F, 1 },
+    { 0x016E010D, -1 }, { 0x201C0053, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005200C5, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E016B, -1 },
+    { 0x201B00F8, -3 }, { 0x00000000, 0 }, { 0x0072014F, -1 }, { 0x005000DE, -1 },
+    { 0x00000000, 0 }, { 0x01640059, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190111, -3 }, { 0x00000000, 0 }, { 0x0051016A, -1 },
+    { 0x002F00F9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01090177, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A0129, 1 }, { 0x0104011D, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480142, 1 },
+    { 0x00C100C7, -1 }, { 0x0042005C, -1 }, { 0x00DD0052, 1 }, { 0x01020136, 1 },
+    { 0x011E00C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046015B, -1 },
+    { 0x013E014B, 2 }, { 0x00BF00E0, -1 }, { 0x00DB006B, 1 }, { 0x00DE00DE, -1 },
+    { 0x01190067, -1 }, { 0x011C00DA, -1 }, { 0x01570063, -1 }, { 0x01760061, -1 },
+    { 0x00440174, -1 }, { 0x00C0016C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01702025, -3 }, { 0x01560108, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0173011F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014E003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250164, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E00C5, -2 }, { 0x00540064, -1 },
+    { 0x00D0005C, -2 }, { 0x014C0054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005500F0, -1 },
+    { 0x00D100E8, -1 }, { 0x00ED0073, 1 }, { 0x010F00E4, 1 }, { 0x012E00E2, -1 },
+    { 0x00000000, 0 }, { 0x201E0123, 1 }, { 0x00D20174, -1 }, { 0x01100170, -1 },
+    { 0x00720107, -1 }, { 0x00CF0101, -1 }, { 0x010D00FD, 1 }, { 0x01462018, -1 },
+    { 0x014E016C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900C9, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006A003A, -1 },
+    { 0x0124002E, -1 }, { 0x0143002C, -2 }, { 0x0162002A, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C5004D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018016E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0156, 1 }, { 0x01260146, 1 },
+    { 0x010400D5, -1 }, { 0x0066006C, 3 }, { 0x015E005C, -1 }, { 0x01640142, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C016F, -1 },
+    { 0x004B016D, -1 }, { 0x010200EE, -1 }, { 0x012100EC, 1 }, { 0x0143015D, -1 },
+    { 0x0162015B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01220178, -1 }, { 0x00460113, -1 }, { 0x01410176, -2 }, { 0x0177201E, -2 },
+    { 0x017C00FF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00124, 1 }, { 0x01562039, -1 },
+    { 0x00000000, 0 }, { 0x00F8003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01780131, -1 },
+    { 0x20260077, -2 }, { 0x015600C0, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B00E7, -1 }, { 0x015400D9, -2 }, { 0x01320068, 1 },
+    { 0x01700064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2025011C, -1 }, { 0x00F8016B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058011B, -1 },
+    { 0x201D004F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00DB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0050004E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00F4, -3 },
+    { 0x00000000, 0 }, { 0x0054014D, -1 }, { 0x005100DA, -1 }, { 0x004E0067, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520166, -2 }, { 0x012800E5, -1 },
+    { 0x014700E3, -1 }, { 0x00E70076, 1 }, { 0x016600E1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20180126, -1 }, { 0x00000000, 0 }, { 0x0121201D, 2 },
+    { 0x002E010E, 1 }, { 0x012600FE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B0125, 1 }, { 0x01240117, -1 }, { 0x01430115, -1 },
+    { 0x01620113, -1 }, { 0x20100059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0049013E, 1 }, { 0x00C200C3, 1 },
+    { 0x00C50136, 1 }, { 0x00DE004E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C000DC, -2 }, { 0x00DC0067, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10168, -2 }, { 0x00DD00F3, -1 }, { 0x011E0162, -1 }, { 0x015900EB, -1 },
+    { 0x017800E9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB010C, -1 }, { 0x01760102, -3 },
+    { 0x0059002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500D4, -1 }, { 0x00000000, 0 }, { 0x00D90125, 1 },
+    { 0x01170121, -1 }, { 0x00570047, -1 }, { 0x0155011D, -1 }, { 0x0174011B, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005800D3, -1 }, { 0x00D10058, 1 }, { 0x015000C3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C2025, -3 }, { 0x00000000, 0 },
+    { 0x0059015F, -2 }, { 0x0170014D, -1 }, { 0x014E00DC, -1 }, { 0x00720077, 1 },
+    { 0x00CF0071, -1 }, { 0x012C006B, 1 }, { 0x016A0067, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00570178, 1 }, { 0x00D30170, -1 }, { 0x00540105, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0138, -1 }, { 0x201A00C5, 1 }, { 0x0052011E, -1 },
+    { 0x016C017F, -2 }, { 0x00000000, 0 }, { 0x0125002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0151, -3 }, { 0x201800DE, -1 },
+    { 0x00000000, 0 }, { 0x01290129, 2 }, { 0x002E00C6, 1 }, { 0x004D00C4, 1 },
+    { 0x01040045, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019016A, -2 },
+    { 0x00000000, 0 }, { 0x002F0152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0125015B, 1 }, { 0x004900F6, -1 },
+    { 0x00C500EE, -1 }, { 0x01000077, -2 }, { 0x011F0075, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040176, -2 },
+    { 0x00280111, -1 }, { 0x0066010D, -1 }, { 0x0178201A, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10120, -1 }, { 0x00000000, 0 }, { 0x00DD00AB, -1 },
+    { 0x0175002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB00C4, -2 }, { 0x005C0059, -3 }, { 0x01540049, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC0150, -1 },
+    { 0x00000000, 0 }, { 0x017400D3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260118, 1 },
+    { 0x0075201B, -1 }, { 0x005B00FE, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590117, -1 }, { 0x014C2026, -2 },
+    { 0x01700105, -1 }, { 0x0072002F, -2 }, { 0x201E004B, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E011E, -1 },
+    { 0x201C0064, -3 }, { 0x00000000, 0 }, { 0x0051004A, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00F0, -3 },
+    { 0x016C0137, 1 }, { 0x005200D6, -1 }, { 0x014A00C6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0109, -3 },
+    { 0x00000000, 0 }, { 0x00530162, -1 }, { 0x00CC00E7, -1 }, { 0x016A0150, -1 },
+    { 0x0126006E, 1 }, { 0x0145006C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190122, -2 }, { 0x00000000, 0 }, { 0x0103201B, -1 }, { 0x002F010A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006B011F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046003B, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004A013A, 1 }, { 0x0104012E, 1 }, { 0x00440054, -1 },
+    { 0x00C0004C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480153, -1 }, { 0x00C100D8, -1 },
+    { 0x00C4014B, -1 }, { 0x00DD0063, -1 }, { 0x01020147, 1 }, { 0x01780059, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20164, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01380076, 1 }, { 0x01760072, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00A1017F, 2 }, { 0x00410112, 1 }, { 0x00DC0108, -1 }, { 0x00F62025, -2 },
+    { 0x011D0177, 2 }, { 0x01580100, 2 }, { 0x20250044, 1 }, { 0x00000000, 0 },
+    { 0x202600D0, 1 }, { 0x00000000, 0 }, { 0x00DA0121, -1 }, { 0x00000000, 0 },
+    { 0x00580043, -1 }, { 0x00D4003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0142, 1 },
+    { 0x007B0140, 2 }, { 0x0056005C, 2 }, { 0x00D20054, -1 }, { 0x013200C1, -1 },
+    { 0x01540132, 1 }, { 0x20250175, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700E8, -2 }, { 0x00EF006B, 3 }, { 0x016E00D6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006F201E, -2 }, { 0x00550101, -1 }, { 0x00D4016C, -1 },
+    { 0x012E00F3, -1 }, { 0x01500164, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0134, 4 }, { 0x201B00C1, -4 }, { 0x004E2039, -1 }, { 0x016A0108, -1 },
+    { 0x2018004E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C014D, -3 }, { 0x201900DA, -2 }, { 0x00000000, 0 },
+    { 0x012A0125, 1 }, { 0x002F00C2, -3 }, { 0x002C004F, -1 }, { 0x004B004D, 1 },
+    { 0x004E00C0, -1 }, { 0x0162003B, -2 }, { 0x01680121, -1 }, { 0x201A0166, -2 },
+    { 0x00000000, 0 }, { 0x0128013E, 1 }, { 0x004C00D9, -1 }, { 0x00E4005C, -2 },
+    { 0x01410056, -2 }, { 0x0147013C, 1 }, { 0x01600054, -1 }, { 0x0166013A, 1 },
+    { 0x00000000, 0 }, { 0x002E0167, -1 }, { 0x01260157, 1 }, { 0x01640153, -1 },
+    { 0x0066007D, 2 }, { 0x00C30077, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0048010B, -1 },
+    { 0x00FD201E, -2 }, { 0x010200FF, -2 }, { 0x011C201C, -1 }, { 0x012100FD, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C2011C, -1 }, { 0x01000118, 1 }, { 0x0138002E, 1 },
+    { 0x0157002C, -3 }, { 0x0176002A, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00A10137, -1 }, { 0x011D012F, 1 }, { 0x004100CA, 1 },
+    { 0x00DC00C0, -2 }, { 0x01360047, -1 }, { 0x01740043, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD014C, -1 }, { 0x01590144, 1 },
+    { 0x015600D1, 1 }, { 0x0172005C, 1 }, { 0x01780142, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0176015B, -2 },
+    { 0x007B00F8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x012E00AB, -1 }, { 0x00520046, 1 }, { 0x010C003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00EC, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016A00C0, -2 }, { 0x00AD0059, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0105, -3 },
+    { 0x00000000, 0 }, { 0x00CD00E3, -1 }, { 0x002F007A, -2 }, { 0x004E0078, -1 },
+    { 0x006D0076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A011E, -1 },
+    { 0x00000000, 0 }, { 0x00520177, -1 }, { 0x004F0104, -1 }, { 0x012800F6, -1 },
+    { 0x014700F4, -1 }, { 0x016600F2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E011F, 1 },
+    { 0x0126010F, -1 }, { 0x0145010D, -1 }, { 0x0164010B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201300DD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10048, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0049014F, -1 }, { 0x00C200D4, -1 }, { 0x00C50147, 1 },
+    { 0x00BF0061, -1 }, { 0x013B0059, -2 }, { 0x01790055, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00470168, -1 }, { 0x00C000ED, -1 },
+    { 0x00000000, 0 }, { 0x00DC0078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0135201D, 2 },
+    { 0x00DD0104, -3 }, { 0x0154201B, -2 }, { 0x017800FA, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB011D, -1 }, { 0x01570115, -1 }, { 0x01760113, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D600C3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E201D, -3 }, { 0x20260171, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005800E4, -1 }, { 0x00550071, -1 }, { 0x00D400DC, -1 }, { 0x012E0063, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0070201A, -2 }, { 0x00D50168, -1 }, { 0x00000000, 0 }, { 0x016A0078, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01472025, -2 }, { 0x2019004A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0149, -1 }, { 0x201A00D6, -1 }, { 0x00000000, 0 }, { 0x00CE0127, 1 },
+    { 0x00ED0125, 1 }, { 0x014A011F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CC0140, 1 }, { 0x0129013A, 3 }, { 0x004A0062, 1 }, { 0x01040056, -4 },
+    { 0x014500C5, -1 }, { 0x016400C3, -3 }, { 0x2019017B, -1 }, { 0x00000000, 0 },
+    { 0x002F0163, -1 }, { 0x004E0161, -1 }, { 0x006D015F, 1 }, { 0x00670079, 2 },
+    { 0x0121006D, 1 }, { 0x012400E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00442026, -2 }, { 0x00490107, -1 },
+    { 0x00C500FF, -2 }, { 0x00DF201C, -1 }, { 0x00FE201A, -2 }, { 0x011D2018, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280122, -1 },
+    { 0x00C30118, 1 }, { 0x00000000, 0 }, { 0x0139002A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10131, -1 }, { 0x00000000, 0 }, { 0x004200C6, -1 }, { 0x01560041, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB00D5, -1 },
+    { 0x005C006A, 1 }, { 0x007B0068, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC0161, -1 }, { 0x00000000, 0 },
+    { 0x013600E8, -1 }, { 0x015500E6, -1 }, { 0x017400E4, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01560172, -2 },
+    { 0x00D22026, -2 }, { 0x014E201E, -2 }, { 0x016D201C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CF003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D000C6, -1 }, { 0x010E00C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0101, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01470064, -1 }, { 0x01660062, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B011A, -1 },
+    { 0x012C0165, -1 }, { 0x00500100, -3 }, { 0x00CC00F8, -1 }, { 0x016A0161, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190133, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F011B, -3 }, { 0x004E0119, -1 },
+    { 0x01602026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002A00C1, -1 }, { 0x00000000, 0 }, { 0x015D003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0104013F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017B00DD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20175, -2 }, { 0x00DE0100, -2 },
+    { 0x011F016F, 2 }, { 0x013E016D, 1 }, { 0x01742015, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410123, 1 }, { 0x00DC0119, -1 }, { 0x20250055, -1 }, { 0x005A003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0156012A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0151, -1 }, { 0x005900E0, -1 },
+    { 0x01540143, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00522018, -2 },
+    { 0x005A016C, -1 }, { 0x00D60164, -1 }, { 0x013000EB, -1 }, { 0x016E00E7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016C0100, -2 }, { 0x201A0046, 1 }, { 0x004F002C, -2 },
+    { 0x006E002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0145, 1 },
+    { 0x201B00D2, -1 }, { 0x00000000, 0 }, { 0x016A0119, -1 }, { 0x00000000, 0 },
+    { 0x002E0047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C015E, -1 }, { 0x201900EB, -3 }, { 0x00000000, 0 }, { 0x00700142, 1 },
+    { 0x002F00D3, -1 }, { 0x006A005C, 1 }, { 0x00CD013C, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0177, -2 }, { 0x00000000, 0 }, { 0x006E015B, 1 },
+    { 0x0128014F, -1 }, { 0x0147014D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0178, -2 }, { 0x00E02018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40114, 1 },
+    { 0x00000000, 0 }, { 0x00DD002C, -3 }, { 0x00FC002A, -1 }, { 0x01780022, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C2012D, -1 }, { 0x01000129, -1 }, { 0x013E0125, 4 }, { 0x0176003B, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C00146, -1 }, { 0x00FE0142, 1 }, { 0x004100DB, -2 }, { 0x00F8005C, -2 },
+    { 0x01360058, 1 }, { 0x015800C9, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD015D, -2 }, { 0x00592011, -1 }, { 0x00DA00EA, -1 },
+    { 0x01590155, 1 }, { 0x01780153, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0109, -1 },
+    { 0x014F201A, -2 }, { 0x015400FB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014C002E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0071, -3 }, { 0x00000000, 0 }, { 0x00D100C2, -1 },
+    { 0x00520057, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E00FD, -2 }, { 0x00560156, 1 }, { 0x007200E1, -1 },
+    { 0x00000000, 0 }, { 0x00CC0068, 1 }, { 0x01290062, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0116, -1 }, { 0x004C201B, -2 },
+    { 0x00CD00F4, -1 }, { 0x016800EA, -1 }, { 0x01460079, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A012F, -1 },
+    { 0x00000000, 0 }, { 0x01232026, -1 }, { 0x01280107, -1 }, { 0x01470105, -1 },
+    { 0x01660103, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0130, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0028004A, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01430137, 1 },
+    { 0x00C400CC, 1 }, { 0x010200C8, 1 }, { 0x00C10059, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00660177, 1 }, { 0x01562013, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0042011F, -1 },
+    { 0x00DD0115, -1 }, { 0x0159010D, -1 }, { 0x0178010B, -1 }, { 0x20260051, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C00C3, 2 }, { 0x00000000, 0 }, { 0x00590050, 1 },
+    { 0x01320042, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A00DC, -1 }, { 0x00760067, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800F5, -1 },
+    { 0x00000000, 0 }, { 0x010F0076, 2 }, { 0x012E0074, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CD2025, -1 },
+    { 0x0056010E, 1 }, { 0x01100102, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00CE, -1 },
+    { 0x00000000, 0 }, { 0x00540127, 1 }, { 0x00000000, 0 }, { 0x002F0043, -1 },
+    { 0x004E0041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D015A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20180100, -4 }, { 0x00000000, 0 }, { 0x00CC0151, -1 },
+    { 0x00000000, 0 }, { 0x01040067, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0046201E, -3 }, { 0x004B00FF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015B2025, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30129, -1 },
+    { 0x00000000, 0 }, { 0x0041004B, 1 }, { 0x00DC0041, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x017800C3, -3 }, { 0x01560052, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB00E6, -1 }, { 0x007B0079, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00582026, -1 }, { 0x00D4201E, -2 },
+    { 0x00F3201C, -1 }, { 0x00F800FD, 1 }, { 0x01312018, -1 }, { 0x013600F9, -1 },
+    { 0x0139016C, -1 }, { 0x0158016A, -2 }, { 0x017400F5, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0055003A, -1 }, { 0x012E002C, -1 },
+    { 0x014D002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0132012B, 1 }, { 0x005600C6, -5 }, { 0x016A0041, -2 },
+    { 0x01700127, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A2018, -3 },
+    { 0x00000000, 0 }, { 0x00570152, -1 }, { 0x014F0142, 1 }, { 0x016E0140, 1 },
+    { 0x00CD0064, -1 }, { 0x0149005C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0112, -2 }, { 0x00000000, 0 }, { 0x002E2019, -3 },
+    { 0x00CE00F0, -1 }, { 0x01090079, 1 }, { 0x014A00E8, -1 }, { 0x01660073, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00500111, -1 }, { 0x00CC0109, -1 }, { 0x0162201E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190144, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C500C8, 1 }, { 0x00C20055, -2 }, { 0x01000051, -1 }, { 0x012200C2, -1 },
+    { 0x20150176, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040150, -1 },
+    { 0x002800EB, -1 }, { 0x006600E7, -1 }, { 0x00C0006E, -1 }, { 0x012000DB, -1 },
+    { 0x013C0066, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00670173, 2 }, { 0x01210167, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013E017E, 2 }, { 0x00BF0113, -1 }, { 0x01742026, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01580122, -1 },
+    { 0x20250066, 1 }, { 0x017400AD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0156013B, 1 }, { 0x00000000, 0 }, { 0x017200C6, -3 }, { 0x00580065, -1 },
+    { 0x01500055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C0164, -2 }, { 0x005900F1, -1 }, { 0x01540154, 1 },
+    { 0x017000DF, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057010A, -1 },
+    { 0x00D30102, -1 }, { 0x016E00F8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CC203A, -1 },
+    { 0x00550123, -1 }, { 0x00D1011B, -1 }, { 0x012E0115, -1 }, { 0x016C0111, -1 },
+    { 0x201A0057, -3 }, { 0x201D00CA, -2 }, { 0x201E0156, 1 }, { 0x201B00E3, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005000C9, -1 }, { 0x002E0058, 1 },
+    { 0x004D0056, -1 }, { 0x01640044, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201900FC, -1 }, { 0x00000000, 0 }, { 0x00CD014D, -1 }, { 0x002F00E4, -3 },
+    { 0x004B006F, -1 }, { 0x004E00E2, -1 }, { 0x01240061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F016E, -1 }, { 0x0047201A, -1 },
+    { 0x00662018, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011E2025, -1 }, { 0x01040108, -1 }, { 0x01640175, 1 }, { 0x0044002E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0067012B, 1 }, { 0x01020121, 1 },
+    { 0x0121011F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011F0138, 1 },
+    { 0x00DE00C9, -1 }, { 0x011C00C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C00157, -1 }, { 0x004100EC, -1 }, { 0x00D9006F, -1 }, { 0x00DC00E2, -1 },
+    { 0x00F8006D, 1 }, { 0x013900DC, -1 }, { 0x01550067, -1 }, { 0x015800DA, -2 },
+    { 0x00420178, -1 }, { 0x00D5201A, -2 }, { 0x00F42018, -1 }, { 0x01740065, -2 },
+    { 0x01780164, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C011C, -1 },
+    { 0x0154010C, -1 }, { 0x00D2002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700C2, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0058014E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00710066, 3 },
+    { 0x014A0058, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E010E, 1 }, { 0x00F1015D, 1 }, { 0x00000000, 0 }, { 0x007200F2, -1 },
+    { 0x012C00E6, -1 }, { 0x016A00E2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D00178, -1 }, { 0x010E0174, -1 },
+    { 0x00CD0105, -1 }, { 0x0144201C, -1 }, { 0x014900FD, -1 }, { 0x014C0170, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01042039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0160002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0141, 1 }, { 0x01260131, 1 }, { 0x010400C0, 1 },
+    { 0x00470059, -1 }, { 0x00C30051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004800E5, -1 },
+    { 0x00C400DD, -2 }, { 0x010200D9, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041201D, -3 },
+    { 0x004600FE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x017D0176, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0178011C, -1 },
+    { 0x015600AB, -1 }, { 0x0134003A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C00D4, -1 }, { 0x015400C4, 2 }, { 0x00590061, -1 }, { 0x00D50059, -1 },
+    { 0x0170004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01360152, -1 }, { 0x0174014E, -1 }, { 0x00000000, 0 }, { 0x0130006C, 1 },
+    { 0x016E0068, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00532025, -1 }, { 0x00580106, -1 }, { 0x007A0177, 1 },
+    { 0x010D2019, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00C6, 1 }, { 0x0056011F, -2 },
+    { 0x201B0053, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019006C, -1 }, { 0x005100C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D016B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180111, -3 }, { 0x00000000, 0 }, { 0x0050016A, -1 }, { 0x002E00F9, -1 },
+    { 0x012600E9, -1 }, { 0x01230076, 2 }, { 0x01420074, 1 }, { 0x014500E7, -1 },
+    { 0x016400E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01270175, -1 },
+    { 0x002C0112, 1 }, { 0x01430100, -1 }, { 0x0045002A, 1 }, { 0x016200FE, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50121, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00660140, 3 }, { 0x00C000C7, -1 },
+    { 0x0041005C, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x017800D4, -1 }, { 0x00DA006B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF016C, -1 }, { 0x00DE016A, -1 }, { 0x011C0166, -1 }, { 0x013B0164, -1 },
+    { 0x015A0162, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0136010A, -1 }, { 0x01740106, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01530121, -1 },
+    { 0x0172011F, -1 }, { 0x010F003F, 3 }, { 0x014D003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00780148, 1 },
+    { 0x0132013C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016E0151, -1 }, { 0x005400F0, -1 }, { 0x0051007D, 6 },
+    { 0x00EC0073, 1 }, { 0x012A006F, -1 }, { 0x0168006B, 1 }, { 0x00000000, 0 },
+    { 0x201D0123, -4 }, { 0x00000000, 0 }, { 0x0126201A, -1 }, { 0x00CE0101, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800C9, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0123002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190155, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C00CA, 1 }, { 0x00C4004D, 1 },
+    { 0x01020049, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004900E1, -1 }, { 0x00C500D9, -2 },
+    { 0x015D005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006600F8, -1 },
+    { 0x00000000, 0 }, { 0x011D0079, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0176201E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0044, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410145, 1 }, { 0x20250077, -2 },
+    { 0x013600C2, 1 }, { 0x00D60055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0156014C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0175, -2 }, { 0x00590102, -3 }, { 0x017000F0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057011B, -2 }, { 0x0130010D, -1 },
+    { 0x016E0109, -1 }, { 0x201C004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00DB, -2 }, { 0x016C0122, -1 },
+    { 0x005200C1, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0167, -1 }, { 0x201B00F4, -3 }, { 0x00000000, 0 },
+    { 0x0072014B, 1 }, { 0x005000DA, -1 }, { 0x002E0069, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019010D, -3 },
+    { 0x00000000, 0 }, { 0x00510166, -1 }, { 0x002F00F5, -3 }, { 0x004E00F3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F017F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004A0125, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013C002F, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0048013E, 1 }, { 0x00C100C3, 1 }, { 0x00C40136, 1 },
+    { 0x01020132, 1 }, { 0x01780044, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0100014B, -1 }, { 0x00BF00DC, -1 },
+    { 0x00DB0067, -1 }, { 0x00DE00DA, -1 }, { 0x011F0149, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440170, -1 }, { 0x00C00168, -2 },
+    { 0x004100FD, -2 }, { 0x00DC00F3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01322025, -2 }, { 0x00DA010C, -1 }, { 0x01560104, 2 }, { 0x0058002E, -1 },
+    { 0x0077002C, -2 }, { 0x01590177, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560047, -1 }, { 0x0110003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700D3, -1 }, { 0x010E0054, -1 }, { 0x016E00C1, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B2025, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D100E4, -1 }, { 0x00520079, -1 }, { 0x00CE0071, -1 },
+    { 0x012B006B, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E011F, 1 },
+    { 0x00560178, 1 }, { 0x00D20170, -1 }, { 0x00720103, -1 }, { 0x0110016C, -1 },
+    { 0x014E0168, -1 }, { 0x016A00F3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201900C5, -5 }, { 0x00000000, 0 }, { 0x0168010C, -1 },
+    { 0x004E00AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01470127, 1 }, { 0x01660125, 1 }, { 0x00C50049, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018016A, -1 }, { 0x00000000, 0 },
+    { 0x002E0152, -1 }, { 0x01260142, 1 }, { 0x004A00DD, 1 }, { 0x0028006C, 2 },
+    { 0x00660068, 3 }, { 0x010400D1, 1 }, { 0x0120005C, -1 }, { 0x01450140, 1 },
+    { 0x0164013E, 1 }, { 0x002C016B, -1 }, { 0x004800F6, -1 }, { 0x004B0169, -1 },
+    { 0x00C400EE, -1 }, { 0x017D0056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01220174, -1 }, { 0x0046010F, -1 },
+    { 0x013E00FF, 2 }, { 0x01410172, -1 }, { 0x0158201C, -2 }, { 0x0177201A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C00120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0174002E, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0137, 2 }, { 0x0178012D, 2 }, { 0x00DA00C4, -2 },
+    { 0x01720047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0150, -1 }, { 0x007B00E3, -1 },
+    { 0x00D800DD, -1 }, { 0x00590072, -1 }, { 0x00780070, 1 }, { 0x015400D5, -1 },
+    { 0x01570148, 1 }, { 0x01760146, -1 }, { 0x20250118, 1 }, { 0x00F80167, 1 },
+    { 0x0174015F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00580117, -1 }, { 0x201D004B, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0064, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00F0, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016800C4, -2 }, { 0x002F0065, -3 }, { 0x004E0063, -1 },
+    { 0x00000000, 0 }, { 0x201D017C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00520162, -2 }, { 0x012800E1, -1 }, { 0x016600DD, 1 }, { 0x0163006A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180122, -1 },
+    { 0x00000000, 0 }, { 0x00672025, -1 }, { 0x002E010A, -1 }, { 0x0102201B, -3 },
+    { 0x01212019, 2 }, { 0x012600FA, 1 }, { 0x014500F8, -1 }, { 0x016400F6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0123, 1 },
+    { 0x01240113, -1 }, { 0x01430111, -1 }, { 0x0045003B, -1 }, { 0x00FF002F, -1 },
+    { 0x0162010F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0049013A, 1 }, { 0x00C50132, 1 }, { 0x00000000, 0 }, { 0x00DE004A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00660151, -1 }, { 0x00C000D8, -1 }, { 0x0041006D, -1 },
+    { 0x00C3014B, -1 }, { 0x00DC0063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10164, -2 }, { 0x00DD00EF, 2 },
+    { 0x015900E7, -1 }, { 0x017800E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F52025, -2 },
+    { 0x00DB0108, -1 }, { 0x013B0175, -1 }, { 0x0059002A, 2 }, { 0x017600FE, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500D0, 1 },
+    { 0x00000000, 0 }, { 0x00D90121, -1 }, { 0x0117011D, -1 }, { 0x00570043, -1 },
+    { 0x00D3003B, -1 }, { 0x0136011B, -1 }, { 0x01550119, -1 }, { 0x01740117, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0142, 2 }, { 0x00000000, 0 },
+    { 0x0055005C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059015B, -2 }, { 0x00780159, 1 },
+    { 0x005600E8, -2 }, { 0x00EE006B, 3 }, { 0x011000DC, -1 }, { 0x016A0063, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D3016C, -1 }, { 0x00540101, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0134, -1 },
+    { 0x201A00C1, 1 }, { 0x004D2039, -1 }, { 0x0052011A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B014D, -3 }, { 0x201800DA, -1 }, { 0x00000000, 0 }, { 0x01290125, 3 },
+    { 0x002E00C2, 1 }, { 0x004D00C0, 1 }, { 0x01040041, 1 }, { 0x0161003B, -1 },
+    { 0x00000000, 0 }, { 0x20190166, -1 }, { 0x00000000, 0 }, { 0x002F014E, -1 },
+    { 0x00000000, 0 }, { 0x002C00DB, -1 }, { 0x00E3005C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004900F2, -1 }, { 0x00C20077, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01040172, -2 }, { 0x0028010D, -1 }, { 0x00660109, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C1011C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB00C0, -2 }, { 0x005C0055, -2 },
+    { 0x01540045, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DC014C, -1 }, { 0x00000000, 0 }, { 0x013600D3, -1 },
+    { 0x0171005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260114, 1 }, { 0x00000000, 0 }, { 0x007A00F8, 1 },
+    { 0x017200E8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01540176, -2 },
+    { 0x00590113, -1 }, { 0x010E2026, -2 }, { 0x01700101, -1 }, { 0x201E0047, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00EC, -1 }, { 0x012E0137, 1 }, { 0x005200D2, -1 },
+    { 0x014A00C2, -1 }, { 0x201A0079, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0178, -2 }, { 0x00000000, 0 }, { 0x201B0105, -3 }, { 0x016A014C, -1 },
+    { 0x005000EB, -1 }, { 0x00CC00E3, -1 }, { 0x01450068, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019011E, -2 }, { 0x00000000, 0 },
+    { 0x00C5201B, -3 }, { 0x002F0106, -1 }, { 0x004E0104, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0104012A, 1 },
+    { 0x004700C3, -1 }, { 0x00000000, 0 }, { 0x00A1004A, 3 }, { 0x00C00048, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0048014F, -1 }, { 0x00C100D4, -1 }, { 0x00C40147, 1 }, { 0x01020143, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB0078, -1 }, { 0x01570070, 1 }, { 0x0176006E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011D0173, 2 }, { 0x00DC0104, -2 },
+    { 0x015800FC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600CC, 1 }, { 0x00000000, 0 },
+    { 0x00DA011D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0150002F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C013E, 1 }, { 0x007B013C, 2 }, { 0x00D500C3, -1 },
+    { 0x0154012E, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250171, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700E4, -2 },
+    { 0x00540071, -1 }, { 0x00D300DC, -1 }, { 0x016E00D2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006F201A, -2 },
+    { 0x00D100F5, -1 }, { 0x00D40168, -1 }, { 0x010F00F1, 2 }, { 0x016C00EB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0130, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016A0104, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201900D6, -2 }, { 0x00000000, 0 }, { 0x00CD0127, 1 }, { 0x0168011D, -1 },
+    { 0x002C004B, 1 }, { 0x0124003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0162, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0128013A, 1 },
+    { 0x00000000, 0 }, { 0x00490062, 1 }, { 0x01220054, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0163, -1 },
+    { 0x006C015F, 1 }, { 0x004A00EE, 1 }, { 0x00660079, 1 }, { 0x01260153, -1 },
+    { 0x01450151, -1 }, { 0x0164014F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FD201A, -2 }, { 0x00480107, -1 }, { 0x00C400FF, -2 },
+    { 0x011C2018, -1 }, { 0x012100F9, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20118, 1 },
+    { 0x01000114, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00131, -1 },
+    { 0x011D012B, 1 }, { 0x004100C6, 2 }, { 0x01360043, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0148, -1 }, { 0x0178013E, 2 }, { 0x00DA00D5, -1 }, { 0x005B006A, 3 },
+    { 0x0134005C, 1 }, { 0x015600CD, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB0161, -1 }, { 0x00572015, -1 }, { 0x007B00F4, -1 },
+    { 0x01570159, 1 }, { 0x01700071, -1 }, { 0x01760157, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D12026, -2 },
+    { 0x014D201E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x012C2039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520042, 1 },
+    { 0x00CE003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0101, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016800D5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A011A, 1 }, { 0x00520173, -1 },
+    { 0x004F0100, -1 }, { 0x012800F2, -1 }, { 0x014700F0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0126010B, -1 }, { 0x01450109, -1 }, { 0x015F2026, -1 },
+    { 0x01640107, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0134, 4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015C003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50143, 1 },
+    { 0x010000CC, 1 }, { 0x00000000, 0 }, { 0x011C0057, -1 }, { 0x013B0055, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00470164, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10175, -2 }, { 0x00DD0100, -3 }, { 0x01352019, 2 },
+    { 0x015900F8, -1 }, { 0x017800F6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0119, -1 },
+    { 0x01570111, -1 }, { 0x0176010F, -1 }, { 0x0059003B, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026016D, -1 }, { 0x201E2019, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800E0, -1 }, { 0x00000000, 0 },
+    { 0x00D10065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D50164, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014C0102, -1 }, { 0x20190046, -2 }, { 0x004E002C, -2 }, { 0x006D002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0145, -2 }, { 0x201A00D2, -1 },
+    { 0x0145203A, -1 }, { 0x014A011B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B015E, -1 },
+    { 0x201800EB, -3 }, { 0x00000000, 0 }, { 0x006F0142, 1 }, { 0x002E00D3, -1 },
+    { 0x0069005C, 1 }, { 0x00CC013C, 1 }, { 0x014500C1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F015F, -3 }, { 0x004E015D, -1 },
+    { 0x002C00EC, -1 }, { 0x004B00EA, -1 }, { 0x00670075, 2 }, { 0x006D015B, 1 },
+    { 0x01210069, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002D0178, -1 },
+    { 0x004C0176, -2 }, { 0x00490103, -1 }, { 0x00DF2018, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0028011E, -1 }, { 0x00C30114, 1 }, { 0x00000000, 0 },
+    { 0x00DC002C, -3 }, { 0x00FB002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1012D, -1 },
+    { 0x004200C2, -1 }, { 0x00000000, 0 }, { 0x0175003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x017600C7, -1 }, { 0x005C0066, 2 }, { 0x007B0064, -1 },
+    { 0x01540056, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410167, -1 }, { 0x00DC015D, -1 }, { 0x00D900EA, -1 }, { 0x013600E4, -1 },
+    { 0x015500E2, -1 }, { 0x017400E0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BB0178, -1 }, { 0x0110201E, -2 }, { 0x014E201A, -2 },
+    { 0x0156016E, -2 }, { 0x016D2018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0058, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016A002C, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0071, -3 }, { 0x00000000, 0 }, { 0x00D000C2, -1 }, { 0x00510057, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01280062, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B0116, -1 }, { 0x002C201D, -3 }, { 0x00CC00F4, -1 },
+    { 0x00CF0167, -1 }, { 0x012900EE, 2 }, { 0x01640077, 1 }, { 0x016A015D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019012F, -1 }, { 0x00000000, 0 },
+    { 0x002F0117, -3 }, { 0x004E0115, -1 }, { 0x01222026, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004900BB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0104013B, 1 }, { 0x002800D6, -1 },
+    { 0x00C300CC, 1 }, { 0x00C00059, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x017B00D9, -1 }, { 0x00DD0070, -1 }, { 0x01780066, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011F016B, 2 }, { 0x00BF00FE, -1 }, { 0x01362015, -1 }, { 0x013E0169, 1 },
+    { 0x01742011, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041011F, 1 }, { 0x00DC0115, -1 },
+    { 0x20250051, -1 }, { 0x00D6002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600DD, -2 }, { 0x01560126, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580050, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007B014D, -1 }, { 0x0154013F, 1 }, { 0x00000000, 0 }, { 0x014E0059, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00522014, -1 }, { 0x005700F5, -2 }, { 0x005A0168, -1 },
+    { 0x013000E7, -1 }, { 0x016E00E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CC2025, -1 }, { 0x201A0042, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0141, 1 }, { 0x201B00CE, -1 }, { 0x00000000, 0 },
+    { 0x012C0119, -1 }, { 0x016A0115, -1 }, { 0x002E0043, -1 }, { 0x004D0041, 1 },
+    { 0x0164002F, -2 }, { 0x00000000, 0 }, { 0x201C015A, -1 }, { 0x201900E7, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0173, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0174, -3 }, { 0x004D0172, -1 },
+    { 0x012300F1, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015A2025, -1 }, { 0x0102010C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20129, -1 }, { 0x011F0123, 1 },
+    { 0x00DB0041, -2 }, { 0x013E0121, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015800C5, 2 }, { 0x00000000, 0 }, { 0x01740050, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0159, -1 },
+    { 0x01590151, -1 }, { 0x00DA00E6, -1 }, { 0x007A0079, 1 }, { 0x015600DE, 1 },
+    { 0x0178014F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00572026, -4 }, { 0x007B0105, -1 }, { 0x00D3201E, -2 },
+    { 0x00F2201C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700AD, -1 }, { 0x0054003A, -2 }, { 0x010E002E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D006D, -1 },
+    { 0x00000000, 0 }, { 0x005500C6, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00F9, -1 },
+    { 0x00560152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CC0064, -1 },
+    { 0x0148005C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0112, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CD00F0, -1 },
+    { 0x01270077, -1 }, { 0x012A00EA, -1 }, { 0x016800E6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0161201E, -1 },
+    { 0x01280103, -1 }, { 0x01470101, -1 }, { 0x016600FF, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E012C, 1 }, { 0x00000000, 0 }, { 0x010400AB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0145, 1 }, { 0x00000000, 0 }, { 0x00C400C8, 1 },
+    { 0x00C10055, -2 }, { 0x010200C4, 1 }, { 0x00000000, 0 }, { 0x20140176, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004600E9, -1 },
+    { 0x010000DD, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00440102, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0111, -1 }, { 0x01590109, -1 }, { 0x01780107, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760120, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0170003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570065, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01340156, 1 }, { 0x01720152, -1 }, { 0x00000000, 0 }, { 0x010F0072, 2 },
+    { 0x016C006C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010B201D, 1 }, { 0x0056010A, -1 }, { 0x00D20102, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00CA, -1 }, { 0x00540123, -1 },
+    { 0x20190057, -1 }, { 0x00000000, 0 }, { 0x0127002F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012800BB, -1 }, { 0x004C0056, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CC014D, -1 }, { 0x016400D0, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046201A, -3 }, { 0x002C00FD, -2 },
+    { 0x004B00FB, -1 }, { 0x0121007A, 1 }, { 0x014300EB, -1 }, { 0x016200E9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011D2025, -1 },
+    { 0x00C5010C, -1 }, { 0x01440177, -1 }, { 0x0062002C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0066012B, 3 }, { 0x00000000, 0 }, { 0x00410047, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0156004E, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB00E2, -1 }, { 0x005C0077, -2 }, { 0x017600D8, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410178, -2 },
+    { 0x00D4201A, -2 }, { 0x00F32018, -1 }, { 0x00F800F9, 1 }, { 0x013600F5, -1 },
+    { 0x01390168, -1 }, { 0x015500F3, -1 }, { 0x01580166, -2 }, { 0x20260136, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0134010E, 1 }, { 0x0172010A, -1 },
+    { 0x00D1002E, -2 }, { 0x00F0002C, -2 }, { 0x010F002A, 4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0069, -1 }, { 0x01320127, 1 },
+    { 0x005600C2, -4 }, { 0x01700123, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057014E, -1 },
+    { 0x01300140, 1 }, { 0x016E013C, 1 }, { 0x010B005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D1015F, -1 }, { 0x00000000, 0 }, { 0x014A00E4, -1 }, { 0x01470071, -1 },
+    { 0x0166006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0050010D, -1 }, { 0x00CC0105, -1 },
+    { 0x0124201E, -1 }, { 0x014800FD, -1 }, { 0x0162201A, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190140, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015F002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500C4, 1 }, { 0x00C20051, -1 },
+    { 0x0100004D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004A0158, 1 }, { 0x002800E7, -1 }, { 0x006600E3, -1 },
+    { 0x00A1006C, -1 }, { 0x00C300DD, -2 }, { 0x0104014C, -1 }, { 0x01420148, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0067016F, 2 }, { 0x01020165, -1 },
+    { 0x01210163, 1 }, { 0x01590079, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011F017C, 1 },
+    { 0x00BF010F, -1 }, { 0x013E017A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410130, 1 }, { 0x0158011E, -1 }, { 0x013600AD, -1 },
+    { 0x0133003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013400C6, -1 }, { 0x00580061, -1 }, { 0x00D40059, -1 }, { 0x017200C2, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01540150, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00570106, -1 }, { 0x013000F8, -1 }, { 0x016E00F4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00C6, -5 }, { 0x0055011F, -1 }, { 0x00D10117, -1 },
+    { 0x012E0111, -1 }, { 0x016C010D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0152, -1 }, { 0x00000000, 0 }, { 0x203A00DD, -1 }, { 0x00000000, 0 },
+    { 0x005000C5, -3 }, { 0x002E0054, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900F8, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F00E0, -3 }, { 0x004B006B, 1 }, { 0x01620059, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004F016A, -1 }, { 0x01660158, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01070177, 1 }, { 0x004A0110, 1 },
+    { 0x01040104, 1 }, { 0x01260175, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C40121, 1 }, { 0x0102011D, 1 }, { 0x00000000, 0 }, { 0x0178002F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00460142, 1 }, { 0x00DE00C5, -2 }, { 0x01000136, 1 },
+    { 0x011C00C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015800D6, -1 },
+    { 0x00D9006B, 1 }, { 0x01170067, -1 }, { 0x01360065, -1 }, { 0x01550063, -1 },
+    { 0x01740061, -2 }, { 0x00000000, 0 }, { 0x00420174, -2 }, { 0x0059201E, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016E2025, -3 }, { 0x005C0118, 1 }, { 0x01540108, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014C003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016C00C5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E010A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CF00E8, -1 }, { 0x012C00E2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0123, -3 },
+    { 0x00D00174, -1 }, { 0x010E0170, -1 }, { 0x00CD0101, -1 }, { 0x010B00FD, 1 },
+    { 0x01442018, -1 }, { 0x014C016C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660110, 1 },
+    { 0x00000000, 0 }, { 0x0122002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E013D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00470055, -1 }, { 0x00C3004D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0156, 1 }, { 0x004800E1, -1 }, { 0x00C400D9, -2 }, { 0x010200D5, -1 },
+    { 0x015C005C, -1 }, { 0x01620142, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50165, -1 }, { 0x00412019, -3 }, { 0x010000EE, -1 },
+    { 0x011F00EC, 1 }, { 0x013B0077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01200178, -1 }, { 0x0175201E, -2 },
+    { 0x017A00FF, 1 }, { 0x017D0172, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0122, -1 }, { 0x01542039, -1 }, { 0x00000000, 0 }, { 0x00F6003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01760131, -1 }, { 0x005C00D0, 1 }, { 0x015400C0, 2 },
+    { 0x00D50055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0136014E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01300068, 1 }, { 0x016E0064, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580102, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E00C2, 1 }, { 0x0056011B, -2 }, { 0x201B004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00DB, -1 }, { 0x20190068, -1 }, { 0x005100C1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004F00DA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018010D, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012600E5, -1 }, { 0x014500E3, -1 }, { 0x01040074, -1 },
+    { 0x01230072, 1 }, { 0x01420070, 1 }, { 0x016400E1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011F201D, 2 }, { 0x002C010E, 1 }, { 0x004B010C, -1 },
+    { 0x012400FE, 1 }, { 0x013E201B, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490125, 1 },
+    { 0x00C5011D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00280140, 2 }, { 0x0066013C, 3 }, { 0x00410058, 2 }, { 0x00C000C3, 1 },
+    { 0x00C30136, 1 }, { 0x01580046, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017800D0, 1 }, { 0x00DA0067, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0168, -1 }, { 0x00DB00F3, -1 },
+    { 0x00DE0166, -1 }, { 0x011C0162, -1 }, { 0x015700EB, -1 }, { 0x017600E9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC017F, -2 },
+    { 0x00D9010C, -1 }, { 0x01360106, -1 }, { 0x0057002E, -4 }, { 0x0076002C, -2 },
+    { 0x01580177, -1 }, { 0x01740102, -4 }, { 0x20260147, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01150121, -1 }, { 0x0153011D, -1 }, { 0x00550047, -1 },
+    { 0x0172011B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590146, -1 }, { 0x00780144, 1 }, { 0x005600D3, -1 },
+    { 0x014E00C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057015F, -2 }, { 0x01300151, -1 },
+    { 0x014C00DC, -1 }, { 0x00CD0071, -1 }, { 0x012A006B, 1 }, { 0x01680067, -1 },
+    { 0x016E014D, -1 }, { 0x00000000, 0 }, { 0x201D011F, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014A00F5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201800C5, -4 }, { 0x016A017F, -2 }, { 0x00000000, 0 }, { 0x004D00AB, -1 },
+    { 0x0123002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190151, -3 }, { 0x00000000, 0 }, { 0x004E0137, 1 }, { 0x00000000, 0 },
+    { 0x002C00C6, 1 }, { 0x004B00C4, 1 }, { 0x00C40049, 1 }, { 0x01020045, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C500D5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01420159, 1 }, { 0x002800F8, -1 }, { 0x006600F4, -1 }, { 0x00C300EE, -1 },
+    { 0x011D0075, 2 }, { 0x013C0073, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01020176, -2 }, { 0x0138201E, 1 }, { 0x0176201A, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410141, 1 }, { 0x00DC0137, 1 }, { 0x00D900C4, -2 }, { 0x005A0059, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202600FF, -2 }, { 0x00DA0150, -1 }, { 0x00000000, 0 }, { 0x017200D3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054201D, 1 }, { 0x005900FE, 2 },
+    { 0x007800FC, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570117, -2 }, { 0x01300109, -1 }, { 0x014A2026, -2 }, { 0x016E0105, -1 },
+    { 0x201C004B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016C011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004F004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0163, -1 },
+    { 0x00000000, 0 }, { 0x201B00F0, -3 }, { 0x016A0137, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C017C, -1 }, { 0x20190109, -3 }, { 0x00000000, 0 }, { 0x00510162, -1 },
+    { 0x002F00F1, -1 }, { 0x01680150, -1 }, { 0x0143006C, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00662025, -2 }, { 0x0101201B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0044003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0048013A, 1 },
+    { 0x00670138, 1 }, { 0x00420054, -1 }, { 0x00C40132, 1 }, { 0x0102012E, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00460153, -1 }, { 0x00C2014B, -1 }, { 0x01000147, 1 }, { 0x00DB0063, -1 },
+    { 0x01760059, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0044016C, -1 }, { 0x00C00164, -2 }, { 0x00000000, 0 },
+    { 0x01360076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F42025, -2 }, { 0x00DA0108, -1 },
+    { 0x01560100, 2 }, { 0x0058002A, 1 }, { 0x01780171, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0130203A, -1 },
+    { 0x007B0127, 2 }, { 0x00000000, 0 }, { 0x00560043, -1 }, { 0x00D2003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D00054, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005500E8, -1 },
+    { 0x00520075, -1 }, { 0x00D100E0, -1 }, { 0x00ED006B, 1 }, { 0x014A0065, -1 },
+    { 0x016C00D6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D2016C, -1 },
+    { 0x007200FF, 1 }, { 0x01100168, -1 }, { 0x012C00F3, -1 }, { 0x014E0164, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900C1, -5 },
+    { 0x00000000, 0 }, { 0x01680108, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01280125, 1 }, { 0x01470123, -1 },
+    { 0x00C50045, 1 }, { 0x0160003B, -1 }, { 0x01660121, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E014E, -1 }, { 0x0126013E, 1 },
+    { 0x010400CD, 1 }, { 0x00280068, 2 }, { 0x00660064, -1 }, { 0x00E2005C, -2 },
+    { 0x0145013C, 1 }, { 0x015E0054, -1 }, { 0x0164013A, 1 }, { 0x002C0167, -1 },
+    { 0x01620153, -1 }, { 0x004800F2, -1 }, { 0x00C10077, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50176, -2 }, { 0x0046010B, -1 }, { 0x010000FF, -2 }, { 0x011F00FD, 2 },
+    { 0x01220170, -1 }, { 0x013E00FB, 1 }, { 0x0141016E, -1 }, { 0x01582018, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C0011C, -1 },
+    { 0x00000000, 0 }, { 0x0155002C, -3 }, { 0x0174002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01780129, 2 }, { 0x00DA00C0, -2 }, { 0x01720043, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB014C, -1 }, { 0x01570144, 1 }, { 0x00D800D9, -1 }, { 0x0059006E, -1 },
+    { 0x015400D1, 1 }, { 0x0170005C, 1 }, { 0x01760142, 2 }, { 0x00000000, 0 },
+    { 0x20250114, 1 }, { 0x00F80163, 1 }, { 0x0136015F, -1 }, { 0x0174015B, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01340178, 1 }, { 0x00580113, -1 },
+    { 0x201D0047, -2 }, { 0x00000000, 0 }, { 0x0052002D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00D3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012C00AB, -1 }, { 0x00500046, -1 },
+    { 0x010A003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012D0137, 3 }, { 0x00000000, 0 }, { 0x016800C0, -2 },
+    { 0x002F0061, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0178, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01630066, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2018011E, -1 }, { 0x00000000, 0 }, { 0x00500177, 1 },
+    { 0x002E0106, -1 }, { 0x004D0104, 1 }, { 0x00C4201B, -3 }, { 0x012600F6, -1 },
+    { 0x014500F4, -1 }, { 0x016400F2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C011F, 1 }, { 0x0124010F, -1 }, { 0x0143010D, -1 },
+    { 0x0162010B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201100DD, -1 }, { 0x00C5012E, 1 }, { 0x004600C3, -3 },
+    { 0x00000000, 0 }, { 0x00DE0046, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280151, -1 },
+    { 0x004400DC, -1 }, { 0x00410069, -1 }, { 0x0066014D, -1 }, { 0x00C000D4, -1 },
+    { 0x00C30147, 1 }, { 0x01390059, -2 }, { 0x01580057, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD00EB, -1 }, { 0x015900E3, -1 }, { 0x00DA0078, -1 },
+    { 0x017800E1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0104, -2 }, { 0x017600FA, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500CC, 1 }, { 0x00000000, 0 }, { 0x00D9011D, -1 },
+    { 0x01360117, -1 }, { 0x01550115, -1 }, { 0x01740113, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260158, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005B013E, 2 }, { 0x00D400C3, -1 }, { 0x00000000, 0 }, { 0x012E004A, 4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590157, -1 }, { 0x005600E4, -2 }, { 0x0072006F, -1 },
+    { 0x00780155, 1 }, { 0x00D200DC, -1 }, { 0x012C0063, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D30168, -1 }, { 0x005400FD, 1 },
+    { 0x012D00EF, 2 }, { 0x01680078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0130, -2 }, { 0x00000000, 0 }, { 0x01452025, -2 },
+    { 0x00520116, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800D6, -1 },
+    { 0x00000000, 0 }, { 0x00CC0127, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190162, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B00D5, -1 },
+    { 0x00480062, 1 }, { 0x01020056, -4 }, { 0x014300C5, -1 }, { 0x016200C3, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011F006D, 1 }, { 0x013E006B, 4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0104016E, -2 },
+    { 0x00280109, -1 }, { 0x00422026, -1 }, { 0x00660105, -1 }, { 0x00C300FF, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10118, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C0051, -1 }, { 0x01540041, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410152, -1 },
+    { 0x00000000, 0 }, { 0x00D900D5, -1 }, { 0x0133005C, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260110, 1 },
+    { 0x00DA0161, -1 }, { 0x00562015, -1 }, { 0x017200E4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01540172, -2 }, { 0x0059010F, -1 }, { 0x00D02026, -2 },
+    { 0x014C201E, -2 }, { 0x016B201C, -1 }, { 0x201E0043, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CD003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00E8, -3 },
+    { 0x201A0075, -1 }, { 0x005200CE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0174, -3 }, { 0x00000000, 0 },
+    { 0x201B0101, -3 }, { 0x00000000, 0 }, { 0x005000E7, -1 }, { 0x00000000, 0 },
+    { 0x002E0076, -2 }, { 0x01450064, -1 }, { 0x01640062, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019011A, -2 }, { 0x012A0165, -1 }, { 0x002F0102, -3 },
+    { 0x004E0100, -1 }, { 0x01680161, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015E2026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01040126, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015B003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670149, 1 }, { 0x00C40143, 1 },
+    { 0x0102013F, 1 }, { 0x01780051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF00E9, -1 }, { 0x017900DD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C00175, -2 }, { 0x0041010A, -1 }, { 0x00DC0100, -2 }, { 0x011D016F, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202600C8, 1 }, { 0x00DA0119, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0058003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C013A, 1 },
+    { 0x005900C7, -1 }, { 0x0154012A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2025016D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700E0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D40164, -1 }, { 0x010F00ED, 2 }, { 0x012E00EB, -1 },
+    { 0x016C00E7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E012C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016A0100, -2 },
+    { 0x20180046, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0145, -1 }, { 0x201900D2, -2 }, { 0x00000000, 0 },
+    { 0x01680119, -1 }, { 0x00000000, 0 }, { 0x002C0047, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0068005C, -3 },
+    { 0x00C50056, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006C015B, 1 }, { 0x0126014F, -1 }, { 0x010400DE, 1 },
+    { 0x00280079, 3 }, { 0x0145014D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0178, -2 }, { 0x00000000, 0 },
+    { 0x00480103, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20114, 1 }, { 0x00000000, 0 }, { 0x00DB002C, -3 },
+    { 0x00FA002A, -1 }, { 0x01760022, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C0012D, -1 }, { 0x004100C2, 1 },
+    { 0x00000000, 0 }, { 0x0174003B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0144, -1 },
+    { 0x015600C9, 1 }, { 0x005B0066, 2 }, { 0x00F6005C, -2 }, { 0x01340058, 1 },
+    { 0x0178013A, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB015D, -1 },
+    { 0x00572011, -1 }, { 0x007B00F0, -1 }, { 0x01570155, 1 }, { 0x01760153, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014D201A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0058, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014A002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0071, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00500057, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540156, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0072, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0116, 1 }, { 0x0052016F, -1 }, { 0x00CE0167, -1 }, { 0x014A015F, -1 },
+    { 0x01440079, -1 }, { 0x016600EA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01212026, -1 },
+    { 0x01260107, -1 }, { 0x01450105, -1 }, { 0x01640103, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0130, 1 }, { 0x004800BB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C5013F, 1 }, { 0x00C200CC, 1 }, { 0x010000C8, 1 },
+    { 0x00BF0059, -1 }, { 0x00DE0057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD00FC, -1 }, { 0x01542013, -1 }, { 0x015900F4, -1 }, { 0x017800F2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB0115, -1 }, { 0x0157010D, -1 }, { 0x0176010B, -1 },
+    { 0x00D5002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500DD, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00570050, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260169, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D10061, -1 }, { 0x010F005D, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005600F5, -2 }, { 0x00000000, 0 }, { 0x010D0076, 1 },
+    { 0x012C0074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0166201B, 1 }, { 0x0054010E, 1 }, { 0x010E0102, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0141, -2 }, { 0x201A00CE, 1 }, { 0x00000000, 0 }, { 0x014A0117, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0163002F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B015A, -1 }, { 0x201800E7, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E00CF, 1 }, { 0x00000000, 0 }, { 0x0104004E, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190173, -1 }, { 0x00000000, 0 },
+    { 0x002F015B, -3 }, { 0x00000000, 0 }, { 0x004B00E6, -1 }, { 0x01020067, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004C0172, -1 }, { 0x0044201E, -2 }, { 0x006800FD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01592025, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10129, -1 }, { 0x00000000, 0 }, { 0x00DA0041, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0142, -1 }, { 0x017600C3, -3 },
+    { 0x005C0062, 1 }, { 0x01540052, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410163, -1 }, { 0x00000000, 0 },
+    { 0x00D900E6, -1 }, { 0x013600E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260121, 1 }, { 0x00BB0174, -1 },
+    { 0x00562026, -4 }, { 0x00D2201E, -2 }, { 0x00F1201C, -1 }, { 0x0110201A, -2 },
+    { 0x0156016A, -2 }, { 0x017200F5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590120, -1 }, { 0x201E0054, -2 }, { 0x005600AD, -1 },
+    { 0x0053003A, -1 }, { 0x012C002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E0127, 1 },
+    { 0x005400C6, -3 }, { 0x01680041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00F9, -1 }, { 0x00550152, -1 },
+    { 0x010F0146, 2 }, { 0x014D0142, 1 }, { 0x0147005C, 1 }, { 0x016C0140, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0112, -1 },
+    { 0x00CF0163, -1 }, { 0x002C2019, -3 }, { 0x005000F8, -1 }, { 0x00CC00F0, -1 },
+    { 0x01070079, 1 }, { 0x01260077, 2 }, { 0x01640073, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0113, -3 }, { 0x004E0111, -1 },
+    { 0x0160201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002800D2, -1 }, { 0x00C300C8, 1 }, { 0x00A10057, -1 },
+    { 0x00C00055, -2 }, { 0x012000C2, -1 }, { 0x20130176, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01020150, -1 }, { 0x00000000, 0 }, { 0x011E00DB, -1 },
+    { 0x00DD006C, 2 }, { 0x01590064, -1 }, { 0x01780062, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011F0167, 1 }, { 0x01362011, -1 },
+    { 0x013E0165, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DC0111, -1 }, { 0x01722026, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202600D9, -1 }, { 0x01560122, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0154013B, 1 }, { 0x005900D8, -1 },
+    { 0x017000C6, -3 }, { 0x00560065, -2 }, { 0x01100059, -1 }, { 0x014E0055, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00522010, -1 },
+    { 0x013000E3, -1 }, { 0x016E00DF, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0055010A, -1 }, { 0x00D10102, -1 }, { 0x010F00FE, 4 },
+    { 0x016C00F8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E013D, 1 },
+    { 0x00000000, 0 }, { 0x201B00CA, -1 }, { 0x00720121, -1 }, { 0x00CF011B, -1 },
+    { 0x012C0115, -1 }, { 0x016A0111, -1 }, { 0x20180057, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201900E3, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0058, 1 }, { 0x01620044, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A016F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0049006F, -1 }, { 0x00C50067, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0170, -1 }, { 0x004D016E, -1 }, { 0x010400EF, -1 }, { 0x012300ED, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011C2025, -1 }, { 0x00C4010C, -1 },
+    { 0x01020108, -1 }, { 0x0042002E, -1 }, { 0x01620175, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0046012D, 1 }, { 0x01000121, 1 }, { 0x011F011F, 1 }, { 0x013E011D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00A10140, -1 }, { 0x004100D3, -1 }, { 0x011D0138, 1 },
+    { 0x015800C1, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0155, -1 }, { 0x00DA00E2, -1 },
+    { 0x01530067, -1 }, { 0x015600DA, -2 }, { 0x0159014D, -1 }, { 0x01720065, -1 },
+    { 0x0178014B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D3201A, -2 },
+    { 0x007B0101, -1 }, { 0x00F22018, -1 }, { 0x01760164, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250136, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D0002E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00580135, 1 }, { 0x201D0069, -1 }, { 0x005500C2, -2 },
+    { 0x0052004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056014E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012A00E6, -1 }, { 0x01270073, 1 }, { 0x016800E2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0123201E, -1 }, { 0x0161201A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0128, 1 }, { 0x01022039, -1 },
+    { 0x00000000, 0 }, { 0x015E002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0141, 1 },
+    { 0x00000000, 0 }, { 0x00C400C4, 1 }, { 0x00C10051, -1 }, { 0x010200C0, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50150, -1 }, { 0x004600E5, -1 }, { 0x00C200DD, -2 }, { 0x00BF006A, 4 },
+    { 0x010000D9, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01580079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017B0176, -1 }, { 0x00DD010D, -1 },
+    { 0x01590105, -1 }, { 0x01780103, -1 }, { 0x20260049, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0176011C, -1 }, { 0x015400AB, -1 }, { 0x0132003A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01740135, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570061, -2 }, { 0x00D30059, -1 }, { 0x016E004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0172014E, -1 }, { 0x201D0021, -1 },
+    { 0x015000DD, -1 }, { 0x010F006E, 2 }, { 0x012E006C, 1 }, { 0x016C0068, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00512025, -2 },
+    { 0x00560106, -1 }, { 0x00780177, 1 }, { 0x010B2019, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00C6, -4 }, { 0x0054011F, -1 }, { 0x20190053, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0152, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F00C5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201800F8, -3 }, { 0x00000000, 0 }, { 0x00500151, -1 },
+    { 0x00000000, 0 }, { 0x004A006B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C00F9, -1 }, { 0x012400E9, -1 }, { 0x01210076, 2 },
+    { 0x014300E7, -1 }, { 0x016200E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01250175, -1 }, { 0x00C50108, -1 }, { 0x01220102, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00660127, 3 },
+    { 0x00C30121, 1 }, { 0x00410043, -1 }, { 0x0177002F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD00C5, -3 }, { 0x00BB0054, -1 }, { 0x017800BB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0153, -1 }, { 0x017600D4, -1 }, { 0x007B0071, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410174, -4 }, { 0x0058201E, -1 }, { 0x013600F1, -1 },
+    { 0x01390164, -1 }, { 0x01580162, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260132, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01720106, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590131, -1 }, { 0x0170011F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014B003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0130013C, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D010A, -2 }, { 0x00D1015B, -1 }, { 0x010F0157, 2 },
+    { 0x00CE00E8, -1 }, { 0x0128006F, -1 }, { 0x014A00E0, -1 }, { 0x0166006B, 1 },
+    { 0x016C0151, -1 }, { 0x00000000, 0 }, { 0x201B0123, -3 }, { 0x00000000, 0 },
+    { 0x00500109, -1 }, { 0x00CC0101, -1 }, { 0x0105201C, -1 }, { 0x0124201A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019013C, -1 },
+    { 0x00000000, 0 }, { 0x00C52039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0121002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C500C0, 1 }, { 0x00C2004D, 1 }, { 0x01000049, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A0154, 1 },
+    { 0x002800E3, -1 }, { 0x00C300D9, -2 }, { 0x00A10068, -1 }, { 0x01040148, -1 },
+    { 0x01230146, 1 }, { 0x01420144, 1 }, { 0x015B005C, -1 }, { 0x00000000, 0 },
+    { 0x0067016B, 2 }, { 0x00C40165, -1 }, { 0x00000000, 0 }, { 0x01780073, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF010B, -1 }, { 0x00F82026, -2 },
+    { 0x0174201E, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041012C, 1 },
+    { 0x00DC0122, -1 }, { 0x0158011A, 1 }, { 0x00F5003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013400C2, -1 }, { 0x00D40055, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0154014C, -1 }, { 0x005900E9, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x003B0177, 1 }, { 0x00570102, -4 },
+    { 0x013000F4, -1 }, { 0x016E00F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00C2, -5 },
+    { 0x0055011B, -1 }, { 0x00D10113, -1 }, { 0x012E010D, -1 }, { 0x016C0109, -1 },
+    { 0x201A004F, -1 }, { 0x00000000, 0 }, { 0x201E014E, -1 }, { 0x00000000, 0 },
+    { 0x201B00DB, -1 }, { 0x016A0122, -1 }, { 0x005000C1, -3 }, { 0x00000000, 0 },
+    { 0x002E0050, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201900F4, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0069, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F0166, -1 },
+    { 0x01660154, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01260171, 1 }, { 0x01040100, 1 }, { 0x012300FE, 1 }, { 0x014200FC, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480125, 1 }, { 0x00670123, 1 },
+    { 0x00C4011D, 1 }, { 0x013A002F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046013E, 1 },
+    { 0x00C20136, 1 }, { 0x00DE00C1, -2 }, { 0x01000132, 1 }, { 0x01760044, 1 },
+    { 0x00000000, 0 }, { 0x2026201B, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011D0149, 1 }, { 0x015800D2, -1 }, { 0x00D90067, -1 }, { 0x01360061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00420170, -1 }, { 0x0059201A, -3 }, { 0x00DA00F3, -1 }, { 0x00DD0166, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB017F, -2 }, { 0x005C0114, 1 },
+    { 0x01302025, -1 }, { 0x0056002E, -4 }, { 0x01540104, 2 }, { 0x01570177, 1 },
+    { 0x00000000, 0 }, { 0x20250147, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010E003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D007A, -1 }, { 0x00000000, 0 }, { 0x005500D3, -1 }, { 0x016C00C1, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20192025, -6 },
+    { 0x201E0106, -1 }, { 0x0056015F, -2 }, { 0x00000000, 0 }, { 0x007200EA, -1 },
+    { 0x00500079, 1 }, { 0x00CC0071, -1 }, { 0x00CF00E4, -1 }, { 0x0129006B, 3 },
+    { 0x00000000, 0 }, { 0x201C011F, -3 }, { 0x00540178, 1 }, { 0x00D00170, -1 },
+    { 0x010E016C, -1 }, { 0x014C0168, -1 }, { 0x016800F3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180151, -3 },
+    { 0x00000000, 0 }, { 0x002E0139, 1 }, { 0x01450127, 1 }, { 0x004A00C4, -1 },
+    { 0x00C30049, 1 }, { 0x01640125, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0152, -1 }, { 0x004B0150, -1 },
+    { 0x00C400D5, -1 }, { 0x010200D1, 1 }, { 0x011E005C, -1 }, { 0x01240142, 1 },
+    { 0x01430140, 1 }, { 0x0162013E, 1 }, { 0x017B0056, -1 }, { 0x00000000, 0 },
+    { 0x004600F6, -1 }, { 0x00C200EE, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01200174, -1 }, { 0x00BB2026, -1 }, { 0x0156201C, -2 }, { 0x0175201A, -2 },
+    { 0x017D016E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD011E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0172002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0137, 1 },
+    { 0x005C00CC, 1 }, { 0x00D800C4, -1 }, { 0x00590059, 1 }, { 0x01700047, -1 },
+    { 0x0176012D, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500FF, -2 },
+    { 0x00D90150, -1 }, { 0x01550148, 1 }, { 0x00D600DD, -1 }, { 0x01300064, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0172015F, -1 }, { 0x005800FE, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560117, -2 },
+    { 0x201B004B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190064, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014700C6, -1 },
+    { 0x016600C4, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B017C, -1 },
+    { 0x20180109, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012600E1, -1 },
+    { 0x016400DD, 1 }, { 0x01040070, -1 }, { 0x0123006E, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0100201B, -3 },
+    { 0x002C010A, -1 }, { 0x004B0108, -1 }, { 0x011F2019, 2 }, { 0x014300F8, -1 },
+    { 0x016200F6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0043003B, -1 }, { 0x00FD002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0028013C, 2 }, { 0x00C30132, 1 },
+    { 0x00410054, -2 }, { 0x01580042, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1014B, -1 },
+    { 0x00DD00D6, -1 }, { 0x00000000, 0 }, { 0x00DA0063, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE0162, -1 }, { 0x015700E7, -1 }, { 0x017600E5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00F32025, -2 }, { 0x00D90108, -1 }, { 0x01360102, 1 },
+    { 0x0057002A, 1 }, { 0x01390175, -1 }, { 0x01580173, -1 }, { 0x017400FE, 2 },
+    { 0x20260143, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0115011D, -1 },
+    { 0x01720117, -1 }, { 0x00550043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590142, 2 }, { 0x011000C3, -1 }, { 0x0053005C, -1 }, { 0x201E0076, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0057015B, -2 }, { 0x0130014D, -1 }, { 0x005400E8, -1 }, { 0x010E00DC, -1 },
+    { 0x01680063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D011B, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800C1, -4 }, { 0x004B2039, -1 },
+    { 0x0050011A, -1 }, { 0x00000000, 0 }, { 0x00E5002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019014D, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C00C2, 1 }, { 0x004B00C0, 1 },
+    { 0x00C40045, 1 }, { 0x01020041, 1 }, { 0x015F003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500D1, 1 },
+    { 0x00E1005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040159, -1 }, { 0x002800F4, -1 },
+    { 0x006600F0, -1 }, { 0x00C00077, -2 }, { 0x01230157, 1 }, { 0x01420155, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0067017C, 1 },
+    { 0x00C40176, -2 }, { 0x01020172, -2 }, { 0x0138201A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE011A, -1 }, { 0x00000000, 0 },
+    { 0x0173002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041013D, 1 }, { 0x00000000, 0 },
+    { 0x00D900C0, -2 }, { 0x005A0055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600FB, -1 }, { 0x00DA014C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016F005C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00542019, 1 }, { 0x005900FA, -1 }, { 0x007800F8, 1 },
+    { 0x017000E8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570113, -2 }, { 0x01300105, -1 },
+    { 0x016E0101, -1 }, { 0x201C0047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00D3, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x012C0137, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190105, -3 }, { 0x0168014C, -1 }, { 0x004E00EB, -1 }, { 0x00000000, 0 },
+    { 0x01430068, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006E0175, -1 }, { 0x00C3201B, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201000DD, -1 }, { 0x00C4012E, 1 }, { 0x0102012A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046014F, -1 }, { 0x00C20147, 1 },
+    { 0x01000143, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440168, -1 },
+    { 0x00DC00EB, -1 }, { 0x00000000, 0 }, { 0x00D90078, -1 }, { 0x00F80076, 1 },
+    { 0x01360072, -1 }, { 0x01550070, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0151201B, -1 }, { 0x00DA0104, -2 }, { 0x015600FC, -1 }, { 0x0178016D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0125, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014E002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250158, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D300C3, -1 }, { 0x00540058, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005500E4, -1 }, { 0x016C00D2, -1 }, { 0x014A0061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D20168, -1 }, { 0x00CF00F5, -1 }, { 0x01100164, -1 },
+    { 0x016A00EB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0130, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01680104, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0147011F, -1 }, { 0x0166011D, -1 }, { 0x00C50041, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E014A, 1 }, { 0x0126013A, 1 }, { 0x010400C9, 1 }, { 0x00280064, -1 },
+    { 0x01200054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0163, -1 }, { 0x004B0161, -1 }, { 0x006700EC, 1 },
+    { 0x01240153, -1 }, { 0x01430151, -1 }, { 0x0162014F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50172, -2 }, { 0x0122016C, -1 },
+    { 0x00460107, -1 }, { 0x00C200FF, -2 }, { 0x011F00F9, 2 }, { 0x0141016A, -1 },
+    { 0x01582014, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C00118, 1 }, { 0x00000000, 0 }, { 0x00F8002E, -2 },
+    { 0x0136002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01780125, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0176013E, 2 },
+    { 0x005C00DD, -3 }, { 0x0132005C, 1 }, { 0x015400CD, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250110, 1 }, { 0x00D90161, -1 },
+    { 0x0136015B, -1 }, { 0x01550159, 1 }, { 0x016E0071, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0058010F, -1 }, { 0x00CF2026, -1 }, { 0x201D0043, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E00CF, 1 }, { 0x012A2039, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CC003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00E8, -3 }, { 0x00EF0137, 3 },
+    { 0x20190075, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0174, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E7006A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2018011A, -1 }, { 0x0067201D, 2 }, { 0x002E0102, 1 }, { 0x004D0100, 1 },
+    { 0x012600F2, -1 }, { 0x014500F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0119, -1 },
+    { 0x0124010B, -1 }, { 0x01430109, -1 }, { 0x015D2026, -1 }, { 0x01620107, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C5012A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0042, -1 },
+    { 0x015A003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0028014D, -1 }, { 0x00C30143, 1 }, { 0x00000000, 0 },
+    { 0x01390055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00E7, -1 },
+    { 0x017800DD, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00792025, -2 },
+    { 0x00DB0100, -2 }, { 0x015700F8, -1 }, { 0x017600F6, -1 }, { 0x00590022, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202500C8, 1 }, { 0x00D90119, -1 }, { 0x01360113, -1 }, { 0x01550111, -1 },
+    { 0x0057003B, -2 }, { 0x0111002F, 1 }, { 0x0174010F, -2 }, { 0x20260154, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B013A, 2 }, { 0x005800C7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590153, -1 },
+    { 0x005600E0, -2 }, { 0x00000000, 0 }, { 0x00CF0065, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D30164, -1 }, { 0x00EF00EF, 2 }, { 0x00000000, 0 }, { 0x01490076, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D012C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520112, 1 }, { 0x014A0102, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B0145, -1 }, { 0x201800D2, -1 }, { 0x0143203A, -1 }, { 0x00EB0121, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019015E, -1 }, { 0x00000000, 0 }, { 0x002F0146, -1 },
+    { 0x00000000, 0 }, { 0x002C00D3, -1 }, { 0x00C40056, -4 }, { 0x014300C1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004900EA, -1 }, { 0x011F0069, 1 },
+    { 0x012200DC, -1 }, { 0x013E0067, 1 }, { 0x014100DA, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004A0176, 1 }, { 0x0104016A, -2 }, { 0x00280105, -1 },
+    { 0x00660101, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10114, 1 }, { 0x00000000, 0 }, { 0x00BB002E, -1 }, { 0x00DA002C, -3 },
+    { 0x00F9002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C004D, 1 },
+    { 0x0135003F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0041014E, -1 }, { 0x00000000, 0 }, { 0x017400C7, -1 },
+    { 0x00F5005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2026010C, -1 }, { 0x00DA015D, -1 }, { 0x00562011, -1 },
+    { 0x017200E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C017E, 1 },
+    { 0x0059010B, -1 }, { 0x00D80176, -1 }, { 0x010E201E, -2 }, { 0x014C201A, -2 },
+    { 0x0154016E, -2 }, { 0x016B2018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0168002C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00E4, -3 }, { 0x010F0131, 2 }, { 0x00000000, 0 },
+    { 0x005200CA, 1 }, { 0x004F0057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0170, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005000E3, -1 }, { 0x00AD00DD, -1 }, { 0x01260062, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190116, -2 },
+    { 0x00CD0167, -1 }, { 0x002F00FE, 1 }, { 0x0149015F, 1 }, { 0x01620077, 1 },
+    { 0x0168015D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01660176, 1 }, { 0x01202026, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0046002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040122, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C4013F, 1 }, { 0x00C100CC, 1 }, { 0x0102013B, 1 }, { 0x00DD0057, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF00E5, -1 }, { 0x013B00DD, -2 },
+    { 0x01760066, -1 }, { 0x017900D9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00630177, 1 }, { 0x00410106, -1 },
+    { 0x011D016B, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600C4, 1 },
+    { 0x00DA0115, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D4002F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C0136, 1 }, { 0x005900C3, -3 }, { 0x007B0134, 2 },
+    { 0x00560050, 1 }, { 0x01540126, 1 }, { 0x00000000, 0 }, { 0x20250169, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014C0059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005500F5, -1 }, { 0x012E00E7, -1 }, { 0x016C00E3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0128, 1 }, { 0x00000000, 0 },
+    { 0x00F10177, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0141, -1 },
+    { 0x201900CE, -2 }, { 0x00000000, 0 }, { 0x012A0119, -1 }, { 0x01680115, -1 },
+    { 0x002C0043, -1 }, { 0x004B0041, 1 }, { 0x0162002F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0126014B, 1 }, { 0x010400DA, -2 }, { 0x00660071, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0174, -3 }, { 0x0062201C, -1 }, { 0x006700FD, 2 }, { 0x012100F1, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0100010C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C00129, -1 }, { 0x011D0123, 1 }, { 0x00D90041, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0140, 2 }, { 0x015600C5, 2 }, { 0x005B0062, 2 },
+    { 0x01590138, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01570151, -1 }, { 0x015400DE, 1 },
+    { 0x00780079, 1 }, { 0x0176014F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250121, 1 }, { 0x00000000, 0 }, { 0x00552026, -3 },
+    { 0x00D1201E, -2 }, { 0x00F0201C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580120, -1 }, { 0x201D0054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005100DF, -1 }, { 0x002F006E, -1 }, { 0x004E006C, 1 }, { 0x0146005C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0112, 1 }, { 0x0052016B, -1 },
+    { 0x00CE0163, -1 }, { 0x00ED0161, 1 }, { 0x01250077, -1 }, { 0x012800EA, -1 },
+    { 0x014700E8, -1 }, { 0x014A015B, -1 }, { 0x016600E6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015F201E, -1 }, { 0x01260103, -1 }, { 0x01450101, -1 },
+    { 0x00660029, 1 }, { 0x016400FF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C012C, 1 }, { 0x00000000, 0 },
+    { 0x010200AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C5013B, 1 },
+    { 0x00000000, 0 }, { 0x00C200C8, 1 }, { 0x00BF0055, -1 }, { 0x010000C4, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410076, -2 },
+    { 0x00DC006C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420102, -1 }, { 0x00DD00F8, -1 },
+    { 0x015900F0, -1 }, { 0x017800EE, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0111, -1 },
+    { 0x01570109, -1 }, { 0x01760107, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500D9, -1 },
+    { 0x01740120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260165, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800D8, -1 }, { 0x00000000, 0 },
+    { 0x00550065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590164, 1 }, { 0x01320156, 1 },
+    { 0x01700152, -1 }, { 0x016A006C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0109201D, 1 },
+    { 0x00D00102, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D013D, -2 }, { 0x00000000, 0 },
+    { 0x201A00CA, 1 }, { 0x00710121, 1 }, { 0x00CE011B, -1 }, { 0x014A0113, -1 },
+    { 0x0125002F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201800E3, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E00CB, 1 },
+    { 0x012600BB, -1 }, { 0x0104004A, 5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019016F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0157, -1 },
+    { 0x004B00E2, -1 }, { 0x0048006F, -1 }, { 0x0067006D, 1 }, { 0x00C40067, 1 },
+    { 0x016200D0, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C016E, -1 },
+    { 0x0044201A, -2 }, { 0x00000000, 0 }, { 0x011F007A, 1 }, { 0x013E0078, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01420177, 2 }, { 0x00C3010C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FF0121, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF013E, -1 }, { 0x00000000, 0 }, { 0x00D80056, -1 }, { 0x0154004E, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D900E2, -1 }, { 0x003B0079, 1 },
+    { 0x017400D8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2026011D, 1 }, { 0x00000000, 0 }, { 0x00D2201A, -2 }, { 0x00F12018, -1 },
+    { 0x01560166, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0059011C, -1 }, { 0x0132010E, 1 }, { 0x00CF002E, -1 }, { 0x0170010A, -1 },
+    { 0x201E0050, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570135, 1 }, { 0x01300127, 1 }, { 0x005400C2, -3 }, { 0x016E0123, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00F5, -3 }, { 0x0055014E, -1 }, { 0x010F0142, 4 }, { 0x005200DB, -2 },
+    { 0x0109005C, -1 }, { 0x012E0140, 1 }, { 0x01470058, 1 }, { 0x016C013C, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B2013, -1 },
+    { 0x005000F4, -1 }, { 0x01450071, -1 }, { 0x0164006F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190127, -1 }, { 0x00000000, 0 },
+    { 0x002F010F, -3 }, { 0x004E010D, -1 }, { 0x0122201E, -1 }, { 0x012700FF, -1 },
+    { 0x0141201C, -2 }, { 0x014600FD, -1 }, { 0x0160201A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500AB, -1 },
+    { 0x015D002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040133, -1 }, { 0x01230131, 1 },
+    { 0x00C300C4, 1 }, { 0x00440059, -1 }, { 0x00C00051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40150, -1 },
+    { 0x0102014C, -1 }, { 0x00C100DD, -2 }, { 0x00DD0068, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01000165, -1 }, { 0x00BF00F6, -1 }, { 0x011F0163, 1 }, { 0x013E0161, 1 },
+    { 0x01570079, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011D017C, 1 }, { 0x00DC010D, -1 }, { 0x01342026, -2 },
+    { 0x20250049, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600D5, -1 }, { 0x0156011E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0147, 1 }, { 0x005900D4, -1 }, { 0x013200C6, -1 }, { 0x00560061, -2 },
+    { 0x00D20059, -1 }, { 0x01100055, -1 }, { 0x017000C2, -2 }, { 0x201D2026, -6 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0021, -1 }, { 0x00000000, 0 },
+    { 0x012D006C, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00502025, -3 }, { 0x00550106, -1 },
+    { 0x00D100FE, 1 }, { 0x010F00FA, 1 }, { 0x012E00F8, -1 }, { 0x016C00F4, -1 },
+    { 0x00000000, 0 }, { 0x201E0139, 1 }, { 0x00000000, 0 }, { 0x201B00C6, -4 },
+    { 0x0072011D, -1 }, { 0x00CF0117, -1 }, { 0x012C0111, -1 }, { 0x016A010D, -1 },
+    { 0x20180053, -1 }, { 0x00000000, 0 }, { 0x201C0152, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F00C7, -1 }, { 0x002C0054, -2 },
+    { 0x004E00C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A016B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0049006B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E016C, -1 },
+    { 0x004D016A, -1 }, { 0x01640158, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE2025, -3 }, { 0x00C40108, -1 }, { 0x01020104, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460129, 1 }, { 0x00C20121, 1 },
+    { 0x0100011D, 1 }, { 0x0176002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00A1013C, -1 },
+    { 0x004100CF, 1 }, { 0x00DC00C5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0151, -1 }, { 0x015600D6, -1 }, { 0x01150067, -1 }, { 0x01590149, 1 },
+    { 0x01720061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0057201E, -4 }, { 0x005C00FF, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250132, 1 }, { 0x00000000, 0 }, { 0x016C2025, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0065, -3 }, { 0x00000000, 0 }, { 0x0052004B, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016A00C5, -2 }, { 0x00500064, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C010A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CD00E8, -1 },
+    { 0x012A00E2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0123, 1 }, { 0x00000000, 0 }, { 0x0104201C, -3 },
+    { 0x010900FD, 1 }, { 0x0123201A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0124, 1 }, { 0x00C42039, -1 }, { 0x01640110, 1 }, { 0x0120002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C013D, 1 }, { 0x00000000, 0 }, { 0x00C400C0, 1 },
+    { 0x00C1004D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C5014C, -1 }, { 0x004600E1, -1 },
+    { 0x00C200D9, -2 }, { 0x00BF0066, 4 }, { 0x010000D5, -1 }, { 0x015A005C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30165, -1 },
+    { 0x00000000, 0 }, { 0x011D00EC, 1 }, { 0x01390077, -1 }, { 0x01580075, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011E0178, -1 }, { 0x00DD0109, -1 }, { 0x01590101, -1 }, { 0x017B0172, -1 },
+    { 0x007A0029, -1 }, { 0x20260045, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0122, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590044, 1 }, { 0x00F4003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D30055, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260176, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005800E9, -1 }, { 0x015000D9, -1 }, { 0x010F006A, 2 },
+    { 0x012E0068, 1 }, { 0x016C0064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x003A0177, 1 }, { 0x00560102, -4 }, { 0x00780173, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00C2, -4 }, { 0x0054011B, -1 },
+    { 0x2019004F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D014E, -2 }, { 0x00000000, 0 }, { 0x201A00DB, -1 },
+    { 0x00000000, 0 }, { 0x004F00C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800F4, -3 },
+    { 0x00000000, 0 }, { 0x0050014D, -1 }, { 0x002E00DC, -1 }, { 0x004D00DA, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B00F3, -1 },
+    { 0x012400E5, -1 }, { 0x01020074, -1 }, { 0x01210072, 1 }, { 0x014300E3, -1 },
+    { 0x016200E1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E70175, 1 },
+    { 0x00C50104, 1 }, { 0x011D201D, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD203A, -1 }, { 0x00280127, 2 }, { 0x00660123, -1 }, { 0x0041003F, -1 },
+    { 0x00C3011D, 1 }, { 0x0158002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10136, 1 }, { 0x00DD00C1, -3 },
+    { 0x00000000, 0 }, { 0x0118004A, 3 }, { 0x01560046, 1 }, { 0x00000000, 0 },
+    { 0x2025201B, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF014F, -1 },
+    { 0x017600D0, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410170, -2 },
+    { 0x0058201A, -1 }, { 0x00D900F3, -1 }, { 0x00F800F1, 1 }, { 0x015500EB, -1 },
+    { 0x017400E9, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026012E, 1 },
+    { 0x00000000, 0 }, { 0x00DA017F, -2 }, { 0x01560177, -1 }, { 0x01720102, -2 },
+    { 0x0055002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059012D, 2 },
+    { 0x01130121, -1 }, { 0x0170011B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C007A, -1 },
+    { 0x00000000, 0 }, { 0x014C00C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20182025, -3 }, { 0x201D0106, -2 },
+    { 0x0055015F, -1 }, { 0x012E0151, -1 }, { 0x00CE00E4, -1 }, { 0x006E0077, -1 },
+    { 0x0128006B, 1 }, { 0x01660067, -1 }, { 0x016C014D, -1 }, { 0x00000000, 0 },
+    { 0x201B011F, -3 }, { 0x00000000, 0 }, { 0x01052018, -1 }, { 0x00500105, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190138, -1 }, { 0x00000000, 0 }, { 0x002F0120, -1 },
+    { 0x0168017F, -2 }, { 0x004B00AB, -1 }, { 0x0121002A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A00C6, -3 }, { 0x00C20049, 1 },
+    { 0x01000045, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040144, -1 }, { 0x004700DD, -1 },
+    { 0x00C300D5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670167, 1 }, { 0x00000000, 0 },
+    { 0x00C100EE, -1 }, { 0x013A0073, 1 }, { 0x01590071, -1 }, { 0x0178006F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000176, -2 },
+    { 0x0174201A, -4 }, { 0x00BF0107, -1 }, { 0x013B00FF, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410128, 1 }, { 0x00DC011E, -1 }, { 0x01580116, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA0137, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00580059, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0158, 1 },
+    { 0x005900E5, -1 }, { 0x00D500DD, -1 }, { 0x017000D3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0052201D, -1 }, { 0x005700FE, 2 }, { 0x013000F0, -1 }, { 0x012D007D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550117, -1 }, { 0x00D1010F, -1 },
+    { 0x012E0109, -1 }, { 0x006E002F, 1 }, { 0x016C0105, -1 }, { 0x201A004B, 1 },
+    { 0x201E014A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016A011E, -1 },
+    { 0x20180064, -3 }, { 0x00000000, 0 }, { 0x002E004C, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900F0, -3 },
+    { 0x01680137, 1 }, { 0x002F00D8, -1 }, { 0x00000000, 0 }, { 0x004B0063, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004F0162, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0126016D, 1 }, { 0x012300FA, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0067011F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0042003B, -1 },
+    { 0x00FC002F, 1 }, { 0x01780027, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0046013A, 1 }, { 0x00C20132, 1 }, { 0x0100012E, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C0014B, -1 }, { 0x00DC00D6, -1 },
+    { 0x015800CE, 1 }, { 0x00D90063, -1 }, { 0x01740059, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0042016C, -1 },
+    { 0x00DD0162, 1 }, { 0x01780158, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F22025, -2 }, { 0x005C0110, 1 }, { 0x01380175, 1 }, { 0x0056002A, 1 },
+    { 0x01540100, 2 }, { 0x01760171, -1 }, { 0x00000000, 0 }, { 0x20250143, 1 },
+    { 0x00000000, 0 }, { 0x012E203A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D0003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580142, 1 },
+    { 0x00000000, 0 }, { 0x0052005C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0102, 1 }, { 0x0056015B, -2 },
+    { 0x00000000, 0 }, { 0x007200E6, -1 }, { 0x00CF00E0, -1 }, { 0x016A00D6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C011B, -3 },
+    { 0x00000000, 0 }, { 0x00D0016C, -1 }, { 0x010E0168, -1 }, { 0x012A00F3, -1 },
+    { 0x014C0164, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0134, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00E4002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2018014D, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01260125, 1 }, { 0x004A00C0, -1 }, { 0x0028004F, -1 }, { 0x00C30045, 1 },
+    { 0x01450123, -1 }, { 0x015E003B, -1 }, { 0x01640121, -1 }, { 0x00000000, 0 },
+    { 0x002C014E, -1 }, { 0x004B014C, -1 }, { 0x00C400D1, 1 }, { 0x00E0005C, -2 },
+    { 0x010200CD, 1 }, { 0x0124013E, 1 }, { 0x0143013C, 1 }, { 0x015C0054, -1 },
+    { 0x0162013A, 1 }, { 0x00490165, -1 }, { 0x00000000, 0 }, { 0x004600F2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30176, -2 }, { 0x01200170, -1 },
+    { 0x011D00FD, 2 }, { 0x01562018, -2 }, { 0x017D016A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260056, -3 }, { 0x01780110, 1 }, { 0x00000000, 0 }, { 0x0134002E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760129, 2 }, { 0x005C00C8, 1 },
+    { 0x00D800C0, -1 }, { 0x01700043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500FB, -1 }, { 0x00D9014C, -1 }, { 0x01360146, -1 },
+    { 0x00D600D9, -1 }, { 0x01550144, 1 }, { 0x016E005C, 1 }, { 0x01740142, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0172015B, -1 },
+    { 0x005800FA, -1 }, { 0x201D002E, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01320178, 1 }, { 0x00560113, -2 }, { 0x201B0047, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00D3, -1 }, { 0x01662039, -1 }, { 0x00000000, 0 },
+    { 0x012A00AB, -1 }, { 0x0108003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D015F, -3 }, { 0x00000000, 0 }, { 0x201A00EC, -1 }, { 0x00520145, 1 },
+    { 0x012B0137, 3 }, { 0x014700C2, -1 }, { 0x016600C0, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x203A0176, -1 }, { 0x00000000, 0 }, { 0x20180105, -3 },
+    { 0x00000000, 0 }, { 0x002E00ED, -1 }, { 0x00000000, 0 }, { 0x0123006A, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006D0175, -1 }, { 0x002C0106, -1 }, { 0x004B0104, 1 },
+    { 0x00C2201B, -3 }, { 0x012400F6, -1 }, { 0x014300F4, -1 }, { 0x016200F2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C3012E, 1 }, { 0x004400C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10147, 1 }, { 0x004200DC, -1 }, { 0x00DD00D2, -1 },
+    { 0x01560057, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB00EB, -1 },
+    { 0x015700E3, -1 }, { 0x017600E1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0158016F, -1 },
+    { 0x00D90104, -2 }, { 0x013600FE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026013F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005B0125, 2 }, { 0x01720113, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059013E, 2 }, { 0x00D200C3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A201D, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005400E4, -1 }, { 0x00D000DC, -1 }, { 0x012A0063, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0117, -3 }, { 0x00000000, 0 },
+    { 0x004D201C, -1 }, { 0x005200FD, -1 }, { 0x00CE00F5, -1 }, { 0x012B00EF, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0130, -1 },
+    { 0x00000000, 0 }, { 0x01432025, -2 }, { 0x00500116, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01230022, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190149, -1 }, { 0x00000000, 0 }, { 0x002F0131, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C40041, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C500CD, 1 }, { 0x00460062, 1 }, { 0x01000056, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0069015F, 1 }, { 0x01040155, -1 }, { 0x002800F0, -1 }, { 0x00630079, 1 },
+    { 0x006600EC, 2 }, { 0x011D006D, 1 }, { 0x017D00DA, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C40172, -2 }, { 0x0102016E, -2 }, { 0x00C100FF, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE0116, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410139, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0131005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900F6, -1 },
+    { 0x017000E4, -1 }, { 0x00F10079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0057010F, -2 }, { 0x00CE2026, -1 }, { 0x01300101, -1 }, { 0x00510029, 6 },
+    { 0x014A201E, -2 }, { 0x0169201C, -1 }, { 0x201C0043, -1 }, { 0x00000000, 0 },
+    { 0x201D00CF, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CB003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B00E8, -3 }, { 0x00EE0137, 3 }, { 0x005000CE, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0174, -1 }, { 0x00000000, 0 }, { 0x20190101, -3 }, { 0x00000000, 0 },
+    { 0x002F00E9, -3 }, { 0x004E00E7, -1 }, { 0x002C0076, -2 }, { 0x01430064, -1 },
+    { 0x01620062, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0066201D, 2 }, { 0x01280165, -1 }, { 0x01660161, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015C2026, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C4012A, 1 },
+    { 0x01020126, 1 }, { 0x00000000, 0 }, { 0x00DD0042, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C20143, 1 }, { 0x00DE00CE, -1 }, { 0x0100013F, 1 }, { 0x01760051, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00440164, -1 }, { 0x004100F1, -1 }, { 0x00DC00E7, -1 },
+    { 0x00F80072, 1 }, { 0x0136006E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0173, -1 }, { 0x00DA0100, -2 },
+    { 0x01780169, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0121, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056003B, -2 },
+    { 0x0110002F, -1 }, { 0x00000000, 0 }, { 0x20250154, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700C7, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580153, -1 }, { 0x005500E0, -1 },
+    { 0x00000000, 0 }, { 0x00CE0065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D20164, -1 },
+    { 0x00EE00EF, 2 }, { 0x012C00EB, -1 }, { 0x01480076, -1 }, { 0x016A00E7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C012C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01680100, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0145, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EA0121, -1 }, { 0x0147011B, -1 },
+    { 0x01660119, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2018015E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010400C5, 1 }, { 0x0066005C, 4 }, { 0x00C30056, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B015D, -1 },
+    { 0x0124014F, -1 }, { 0x004800EA, -1 }, { 0x010200DE, 1 }, { 0x0143014D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C5016E, -2 }, { 0x01220168, -1 }, { 0x00460103, -1 }, { 0x01410166, -1 },
+    { 0x01582010, -1 }, { 0x01600164, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00114, 1 },
+    { 0x00000000, 0 }, { 0x00D9002C, -3 }, { 0x00F8002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260067, 1 },
+    { 0x00DD012B, 2 }, { 0x01590123, -1 }, { 0x01780121, -2 }, { 0x0172003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0176013A, 2 }, { 0x005C00D9, -2 }, { 0x00590066, -1 },
+    { 0x00F4005C, -2 }, { 0x01320058, 1 }, { 0x015400C9, 1 }, { 0x00000000, 0 },
+    { 0x2025010C, -1 }, { 0x00D9015D, -1 }, { 0x01360157, -1 }, { 0x01550155, 1 },
+    { 0x01110073, 1 }, { 0x01300071, -1 }, { 0x01740153, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058010B, -1 },
+    { 0x201D003F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00CB, 1 },
+    { 0x203A0056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00E4, -3 }, { 0x20190071, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0170, -2 },
+    { 0x00000000, 0 }, { 0x201A00FD, -2 }, { 0x00520156, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00E70066, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180116, -1 }, { 0x00CC0167, -1 },
+    { 0x00672019, 2 }, { 0x0148015F, 1 }, { 0x01420079, 2 }, { 0x016400EA, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B0115, -1 }, { 0x011F2026, -1 }, { 0x01240107, -1 },
+    { 0x01430105, -1 }, { 0x01620103, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50126, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C3013F, 1 },
+    { 0x00C000CC, 1 }, { 0x00000000, 0 }, { 0x0158004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD00E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015700F4, -1 }, { 0x017600F2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500C4, 1 }, { 0x00D90115, -1 },
+    { 0x0136010F, -1 }, { 0x0155010D, -1 }, { 0x00D3002F, -1 }, { 0x0174010B, -2 },
+    { 0x00000000, 0 }, { 0x20260150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005800C3, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0059014F, -1 }, { 0x00000000, 0 }, { 0x00720067, -1 },
+    { 0x00CF0061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005400F5, -1 },
+    { 0x00000000, 0 }, { 0x010B0076, 1 }, { 0x012A0074, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0128, -2 }, { 0x00000000, 0 }, { 0x010F0175, 2 },
+    { 0x0052010E, 1 }, { 0x014A00FE, 1 }, { 0x0164201B, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0141, -1 }, { 0x201800CE, -1 },
+    { 0x00000000, 0 }, { 0x00EB011D, -1 }, { 0x00000000, 0 }, { 0x004A0041, -1 },
+    { 0x0161002F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019015A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0142, 1 }, { 0x002C00CF, 1 },
+    { 0x004E0140, 1 }, { 0x0102004E, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004900E6, -1 }, { 0x00460073, -1 }, { 0x00C500DE, 1 }, { 0x01000067, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0042201E, -1 }, { 0x00280101, -1 }, { 0x0061201C, -1 }, { 0x006600FD, 1 },
+    { 0x00DD2014, -1 }, { 0x01040166, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01572025, -3 }, { 0x017E0177, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C0049, 1 }, { 0x00D80041, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041014A, 1 },
+    { 0x00DC0140, 1 }, { 0x013600C7, -1 }, { 0x017400C3, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260108, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C017A, 1 }, { 0x00542026, -3 }, { 0x00590107, -1 },
+    { 0x00D0201E, -2 }, { 0x00D80172, -1 }, { 0x010E201A, -2 }, { 0x0154016A, -2 },
+    { 0x017000F5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570120, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0051003A, -1 }, { 0x012A002C, -1 },
+    { 0x0149002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00E0, -3 },
+    { 0x00000000, 0 }, { 0x016C0127, 1 }, { 0x005200C6, 2 }, { 0x01660041, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E016C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016A0140, 1 }, { 0x00000000, 0 },
+    { 0x0145005C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190112, -2 }, { 0x00CD0163, -1 }, { 0x002F00FA, -1 },
+    { 0x004E00F8, -1 }, { 0x00EC0161, 1 }, { 0x0149015B, 1 }, { 0x01620073, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015E201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0104011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C4013B, 1 }, { 0x00000000, 0 },
+    { 0x00C100C8, 1 }, { 0x011E00C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20110176, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000150, -1 },
+    { 0x00BF00E1, -1 }, { 0x011C00DB, -1 }, { 0x00DB006C, 1 }, { 0x013B00D9, -1 },
+    { 0x01570064, -1 }, { 0x01760062, 2 }, { 0x20262039, -1 }, { 0x00000000, 0 },
+    { 0x007A201D, 1 }, { 0x00410102, 1 }, { 0x00DC00F8, -1 }, { 0x011D0167, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202600C0, 1 }, { 0x00DA0111, -1 }, { 0x01702026, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0132, 1 },
+    { 0x01540122, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20250165, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700D8, -1 }, { 0x016E00C6, -3 }, { 0x00540065, -1 },
+    { 0x010E0059, -1 }, { 0x014C0055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D100E9, -1 }, { 0x012E00E3, -1 },
+    { 0x016C00DF, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0124, 1 }, { 0x00000000, 0 }, { 0x0127201B, -1 }, { 0x016A00F8, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C013D, -1 }, { 0x00000000, 0 }, { 0x201900CA, -2 },
+    { 0x00510123, 1 }, { 0x00CD011B, -1 }, { 0x012A0115, -1 }, { 0x006A003B, -1 },
+    { 0x01680111, -1 }, { 0x00000000, 0 }, { 0x201A0156, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C5004E, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010400D6, -1 },
+    { 0x00280071, -1 }, { 0x00C30067, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0170, -1 }, { 0x00622018, -1 },
+    { 0x006700F9, 2 }, { 0x010200EF, -1 }, { 0x012100ED, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01410177, -1 }, { 0x00C2010C, -1 }, { 0x01000108, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00A10127, -1 }, { 0x011D011F, 1 },
+    { 0x00000000, 0 }, { 0x00F8003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD013C, 2 },
+    { 0x015600C1, 2 }, { 0x007A005C, -2 }, { 0x01340050, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0157014D, -1 }, { 0x007B00E8, -1 }, { 0x003A0079, 1 }, { 0x00780075, 1 },
+    { 0x015400DA, -2 }, { 0x01700065, -1 }, { 0x0176014B, -1 }, { 0x2025011D, 1 },
+    { 0x00000000, 0 }, { 0x00D1201A, -2 }, { 0x00F02018, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058011C, -1 },
+    { 0x00000000, 0 }, { 0x00CE002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00DC, -1 }, { 0x00560135, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00F5, -3 },
+    { 0x00000000, 0 }, { 0x012D0140, 3 }, { 0x005100DB, -1 }, { 0x004E0068, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A010E, 1 }, { 0x00ED015D, 1 }, { 0x00000000, 0 }, { 0x012800E6, -1 },
+    { 0x00E70077, 1 }, { 0x01250073, 1 }, { 0x014700E4, -1 }, { 0x016600E2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0121201E, -1 },
+    { 0x012600FF, 2 }, { 0x015F201A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0128, 1 }, { 0x01002039, -1 }, { 0x00C400AB, -1 }, { 0x015C002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C200C4, 1 },
+    { 0x010000C0, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30150, -1 }, { 0x00000000, 0 },
+    { 0x00A100DF, 2 }, { 0x00410072, -1 }, { 0x00C000DD, -2 }, { 0x00DC0068, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD00F4, -1 }, { 0x017800EA, -1 }, { 0x01560079, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01790176, -1 }, { 0x00DB010D, -1 }, { 0x01570105, -1 }, { 0x01760103, -1 },
+    { 0x0059002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500D5, -1 }, { 0x01360120, -1 }, { 0x0174011C, -1 },
+    { 0x00000000, 0 }, { 0x0130003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005800D4, -1 }, { 0x015000C4, -1 }, { 0x00550061, -1 }, { 0x016C004F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C2026, -3 }, { 0x00000000, 0 },
+    { 0x0170014E, -1 }, { 0x201B0021, -1 }, { 0x014E00DD, -1 }, { 0x012C006C, 1 },
+    { 0x014B006A, 1 }, { 0x016A0068, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004F2025, -2 }, { 0x01092019, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0139, -2 }, { 0x00000000, 0 }, { 0x201A00C6, 1 }, { 0x0071011D, 1 },
+    { 0x00CE0117, -1 }, { 0x014A010F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B0152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E00C7, -1 }, { 0x004A0052, 1 }, { 0x004D00C5, 1 },
+    { 0x01040046, 1 }, { 0x00000000, 0 }, { 0x2019016B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F0153, -3 }, { 0x004E0151, -1 }, { 0x0048006B, 1 },
+    { 0x00670069, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C016A, -1 }, { 0x00C500EF, -1 },
+    { 0x00000000, 0 }, { 0x011F0076, 2 }, { 0x013E0074, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD2025, -3 },
+    { 0x00C30108, -1 }, { 0x01040177, -2 }, { 0x0041002A, -2 }, { 0x01200102, -1 },
+    { 0x01230175, 2 }, { 0x01420173, 1 }, { 0x0159201D, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10121, 1 }, { 0x00FF011D, -1 }, { 0x00000000, 0 },
+    { 0x0175002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF013A, -1 }, { 0x00DB00C5, -2 },
+    { 0x017600BB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC0151, -1 },
+    { 0x013600D8, -1 }, { 0x017400D4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0056201E, -4 }, { 0x0075201C, -1 }, { 0x007A00FD, 1 }, { 0x01560162, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01700106, -1 }, { 0x201E004C, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E011F, -1 },
+    { 0x201C0065, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00F1, -1 }, { 0x00000000, 0 },
+    { 0x00D10142, 1 }, { 0x010F013E, 4 }, { 0x012E013C, 1 }, { 0x01660052, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B010A, -1 },
+    { 0x00000000, 0 }, { 0x016A0151, -1 }, { 0x005000F0, -1 }, { 0x00CC00E8, -1 },
+    { 0x0126006F, -1 }, { 0x0164006B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190123, -4 }, { 0x00000000, 0 }, { 0x002F010B, -3 }, { 0x004E0109, -1 },
+    { 0x0103201C, -1 }, { 0x0122201A, -1 }, { 0x01412018, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C32039, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011F002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0104012F, -1 }, { 0x00C300C0, 1 }, { 0x00440055, -1 },
+    { 0x00C0004D, 1 }, { 0x0123012D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C4014C, -1 }, { 0x01020148, -1 }, { 0x00C100D9, -2 },
+    { 0x00DD0064, -1 }, { 0x01210146, 1 }, { 0x0159005C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20165, -1 }, { 0x00000000, 0 },
+    { 0x00BF00F2, -1 }, { 0x01380077, 1 }, { 0x01760073, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DC0109, -1 }, { 0x00F62026, -2 }, { 0x0172201E, -3 }, { 0x20250045, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202600D1, 1 }, { 0x00DA0122, -1 }, { 0x0156011A, 1 }, { 0x00000000, 0 },
+    { 0x00580044, 1 }, { 0x00F3003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0143, 1 }, { 0x005900D0, 1 },
+    { 0x013200C2, -1 }, { 0x00D20055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250176, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700E9, -2 }, { 0x00000000, 0 }, { 0x00540076, 1 }, { 0x00EF006C, 3 },
+    { 0x012D0068, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00550102, -2 }, { 0x012E00F4, -1 }, { 0x016C00F0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004E203A, -1 }, { 0x00720119, -1 }, { 0x00CF0113, -1 },
+    { 0x012C010D, -1 }, { 0x016A0109, -1 }, { 0x2018004F, -1 }, { 0x201B00C2, -4 },
+    { 0x201C014E, -1 }, { 0x00000000, 0 }, { 0x201900DB, -2 }, { 0x00510134, 3 },
+    { 0x002F00C3, -3 }, { 0x004E00C1, -1 }, { 0x002C0050, 1 }, { 0x01680122, -1 },
+    { 0x00000000, 0 }, { 0x201A0167, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004C00DA, -1 }, { 0x00000000, 0 }, { 0x01220059, -1 },
+    { 0x01410057, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0168, -1 }, { 0x01640154, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013B201B, -2 }, { 0x00C40104, 1 },
+    { 0x01020100, 1 }, { 0x012100FE, 1 }, { 0x017E00F8, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00460125, 1 }, { 0x00650123, -1 }, { 0x00C2011D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C00136, 1 }, { 0x004100CB, 1 }, { 0x00DC00C1, -2 },
+    { 0x01740044, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD014D, -1 }, { 0x015600D2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057201A, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025012E, 1 }, { 0x00000000, 0 },
+    { 0x00D9017F, -2 }, { 0x012E2025, -1 }, { 0x01550177, 1 }, { 0x0054002E, -3 },
+    { 0x0073002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058012D, 1 }, { 0x201D0061, -3 },
+    { 0x00520047, -1 }, { 0x010C003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E00ED, -1 }, { 0x201B007A, -1 }, { 0x00000000, 0 },
+    { 0x016A00C1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0106, -1 }, { 0x0054015F, -1 },
+    { 0x00000000, 0 }, { 0x00CD00E4, -1 }, { 0x006D0077, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A011F, 1 },
+    { 0x00520178, -2 }, { 0x01042018, -3 }, { 0x014700F5, -1 }, { 0x016600F3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0120, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0139, 1 },
+    { 0x004B0137, 1 }, { 0x01430127, 1 }, { 0x00C10049, 1 }, { 0x01620125, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50148, -1 }, { 0x00000000, 0 }, { 0x00C200D5, -1 }, { 0x00BF0062, -1 },
+    { 0x010000D1, 1 }, { 0x011C005C, -1 }, { 0x01790056, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C000EE, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011E0174, -1 }, { 0x0154201C, -2 },
+    { 0x00DD0105, -1 }, { 0x015900FD, 1 }, { 0x017800FB, -1 }, { 0x017B016E, -1 },
+    { 0x20260041, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0170002E, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D90137, 1 }, { 0x01360131, -1 }, { 0x00D600C4, -1 },
+    { 0x00570059, 1 }, { 0x016E0047, -1 }, { 0x0174012D, 1 }, { 0x20260172, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800E5, -1 },
+    { 0x00D400DD, -1 }, { 0x010F0066, 1 }, { 0x012E0064, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590171, -1 },
+    { 0x005600FE, 2 }, { 0x0070201B, -1 }, { 0x0078016F, 1 }, { 0x0170015F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540117, -1 }, { 0x01472026, -2 }, { 0x2019004B, -2 },
+    { 0x006D002F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D014A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520130, 1 }, { 0x00000000, 0 },
+    { 0x016600AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800F0, -3 }, { 0x00000000, 0 },
+    { 0x002E00D8, -1 }, { 0x014500C6, -1 }, { 0x01040057, -4 }, { 0x016400C4, -3 },
+    { 0x00000000, 0 }, { 0x2019017C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012400E1, -1 }, { 0x0067007A, 1 }, { 0x00C40074, -1 },
+    { 0x01020070, -1 }, { 0x0121006E, 1 }, { 0x015F006A, 1 }, { 0x016200DD, 1 },
+    { 0x00000000, 0 }, { 0x00FE201B, -1 }, { 0x00C50100, 1 }, { 0x011D2019, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0066011F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FB002F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10132, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01560042, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB00D6, -1 }, { 0x005C006B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041016C, -2 }, { 0x013600E9, -1 },
+    { 0x015500E7, -1 }, { 0x017400E5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2026012A, 1 }, { 0x00000000, 0 }, { 0x01560173, -1 },
+    { 0x01340102, -1 }, { 0x017200FE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590129, 2 }, { 0x0113011D, -1 }, { 0x01700117, -1 },
+    { 0x00CF003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570142, 2 }, { 0x010E00C3, -1 },
+    { 0x0051005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0102, -5 }, { 0x0055015B, -1 }, { 0x00D10153, -1 },
+    { 0x00CE00E0, -1 }, { 0x006E0073, 1 }, { 0x012E014D, -1 }, { 0x01470065, -1 },
+    { 0x01660063, -1 }, { 0x00000000, 0 }, { 0x201B011B, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00500101, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190134, -1 },
+    { 0x00000000, 0 }, { 0x00492039, -1 }, { 0x002F011C, -1 }, { 0x00000000, 0 },
+    { 0x00E3002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002A00C2, -1 }, { 0x00C20045, 1 }, { 0x01000041, 1 }, { 0x015D003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004700D9, -1 }, { 0x00C300D1, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00480165, -1 }, { 0x00670163, 1 }, { 0x01020159, -1 }, { 0x00DD0075, -1 },
+    { 0x01210157, 1 }, { 0x0159006D, 1 }, { 0x0178006B, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20176, -2 }, { 0x00F8201E, -2 }, { 0x00BF0103, -1 },
+    { 0x01000172, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410124, 1 },
+    { 0x01580112, 1 }, { 0x20250056, -3 }, { 0x0079003A, -1 }, { 0x0171002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C0154, 1 }, { 0x005900E1, -1 }, { 0x00D500D9, -1 },
+    { 0x016D005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00522019, -1 },
+    { 0x016E00E8, -1 }, { 0x00EF007D, 1 }, { 0x201C002E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01500176, -1 },
+    { 0x00550113, -1 }, { 0x00D1010B, -1 }, { 0x012E0105, -1 }, { 0x016C0101, -1 },
+    { 0x201A0047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B00D3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0048, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C015F, -2 },
+    { 0x00000000, 0 }, { 0x201900EC, -1 }, { 0x012A0137, 1 }, { 0x002F00D4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0178, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00680076, -1 }, { 0x00C50070, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C1201B, -3 }, { 0x004A0104, -1 }, { 0x010400F8, 1 }, { 0x01260169, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2012E, 1 },
+    { 0x0100012A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C00147, 1 }, { 0x004100DC, -2 }, { 0x00DC00D2, -1 }, { 0x015800CA, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00420168, -1 }, { 0x00DA00EB, -1 }, { 0x01780154, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014F201B, -1 }, { 0x005C010C, -1 },
+    { 0x00D80104, -1 }, { 0x013500FE, 2 }, { 0x015400FC, -1 }, { 0x0176016D, -1 },
+    { 0x00000000, 0 }, { 0x2025013F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00790123, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014C002F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0058013E, 1 }, { 0x00D100C3, -1 }, { 0x00520058, 2 },
+    { 0x201D0072, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007200E2, -1 },
+    { 0x00500071, -1 }, { 0x00EB0067, -1 }, { 0x016A00D2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0117, -3 }, { 0x00000000, 0 }, { 0x004C201C, -2 },
+    { 0x00CD00F5, -1 }, { 0x00D00168, -1 }, { 0x010E0164, -1 }, { 0x016800EB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0130, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01660104, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0145011F, -1 }, { 0x0164011D, -1 },
+    { 0x00C30041, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C014A, 1 }, { 0x004B0148, -1 },
+    { 0x00C400CD, 1 }, { 0x010200C9, 1 }, { 0x011E0054, -1 }, { 0x0124013A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0068015F, 1 },
+    { 0x00C50159, -1 }, { 0x004600EE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C30172, -2 }, { 0x00BB201E, -1 }, { 0x00C000FF, -2 }, { 0x011D00F9, 2 },
+    { 0x0120016C, -1 }, { 0x01562014, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260052, 1 }, { 0x0178010C, -1 },
+    { 0x00000000, 0 }, { 0x00F6002E, -2 }, { 0x0134002A, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01760125, 2 }, { 0x005C00C4, 2 }, { 0x00590051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F80146, 1 }, { 0x01360142, 1 }, { 0x005A00DD, -1 }, { 0x0174013E, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800F6, -1 }, { 0x00000000, 0 },
+    { 0x010F0077, 2 }, { 0x016C0071, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056010F, -2 },
+    { 0x00CD2026, -1 }, { 0x201B0043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00CF, -1 },
+    { 0x01282039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CA003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D015B, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00520141, 1 }, { 0x00ED0137, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0174, -1 },
+    { 0x00000000, 0 }, { 0x20180101, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01230066, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0102, 1 }, { 0x004B0100, 1 }, { 0x012400F2, -1 }, { 0x014300F0, -1 },
+    { 0x017E0079, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00490119, -1 }, { 0x015B2026, -1 }, { 0x00000000, 0 },
+    { 0x00DE0029, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280134, 3 }, { 0x00C3012A, 1 },
+    { 0x00000000, 0 }, { 0x0041004C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10143, 1 },
+    { 0x00000000, 0 }, { 0x017800C4, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB00E7, -1 }, { 0x017600DD, 1 }, { 0x0173006A, 5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00772025, -2 }, { 0x00D90100, -2 }, { 0x013600FA, -1 },
+    { 0x015500F8, -1 }, { 0x0158016B, -1 }, { 0x017400F6, -2 }, { 0x00000000, 0 },
+    { 0x2026013B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0172010F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0055003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0059013A, 2 }, { 0x005600C7, -1 }, { 0x00530054, -1 }, { 0x00780138, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A2019, -3 },
+    { 0x00000000, 0 }, { 0x00570153, -2 }, { 0x005400E0, -1 }, { 0x00000000, 0 },
+    { 0x00CD0065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0113, -3 }, { 0x00000000, 0 }, { 0x004D2018, -1 }, { 0x005200F9, -1 },
+    { 0x014A00E9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B012C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00500112, -1 }, { 0x00000000, 0 }, { 0x004A002C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190145, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00E90121, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500C9, 1 },
+    { 0x0065005C, -2 }, { 0x00C20056, -4 }, { 0x012200C3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0069015B, 1 }, { 0x00000000, 0 },
+    { 0x006600E8, -1 }, { 0x011D0069, 1 }, { 0x012000DC, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C4016E, -2 },
+    { 0x0102016A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0112, -1 }, { 0x00000000, 0 },
+    { 0x00D8002C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250067, 1 }, { 0x01770121, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x017200C7, -1 }, { 0x00F3005C, -2 }, { 0x01500056, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900F2, -1 }, { 0x017000E0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D60176, -1 }, { 0x0057010B, -2 }, { 0x014A201A, -2 },
+    { 0x01692018, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00CB, -2 }, { 0x201A0058, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0147002E, -2 }, { 0x0166002C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00E4, -3 },
+    { 0x20180071, -3 }, { 0x00000000, 0 }, { 0x005000CA, -1 }, { 0x002E0059, -2 },
+    { 0x004D0057, -1 }, { 0x00000000, 0 }, { 0x201C0170, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F00E5, -3 }, { 0x004E00E3, -1 },
+    { 0x004B0070, -1 }, { 0x01240062, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0047201B, -1 }, { 0x00662019, 2 },
+    { 0x0147015F, -1 }, { 0x01410079, -1 }, { 0x0166015D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01640176, 1 },
+    { 0x011E2026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0044002F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C40126, 1 }, { 0x01020122, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2013F, 1 }, { 0x0100013B, 1 },
+    { 0x00DE00CA, -1 }, { 0x013E0137, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004100ED, -1 }, { 0x00DC00E3, -1 }, { 0x00F8006E, 1 }, { 0x013900DD, -2 },
+    { 0x015800DB, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD016F, -1 }, { 0x202600AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C011D, 3 }, { 0x007B011B, -1 },
+    { 0x00000000, 0 }, { 0x00D2002F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700C3, -4 }, { 0x00000000, 0 }, { 0x00540050, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0058014F, -1 }, { 0x00000000, 0 }, { 0x00710067, 1 }, { 0x00CE0061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007200F3, -1 }, { 0x012C00E7, -1 },
+    { 0x016A00E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0128, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0141, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00EA011D, -1 }, { 0x01280119, -1 }, { 0x01470117, -1 }, { 0x01660115, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018015A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010400C1, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B0159, -1 }, { 0x00000000, 0 }, { 0x004800E6, -1 },
+    { 0x00C400DE, 1 }, { 0x00FF0067, -1 }, { 0x010200DA, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C5016A, -2 },
+    { 0x011F00F1, 1 }, { 0x01220164, -1 }, { 0x01410162, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0127, 2 }, { 0x011B0123, -1 },
+    { 0x0159011F, -1 }, { 0x0134003B, -2 }, { 0x0178011D, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0140, 1 },
+    { 0x005C00D5, -1 }, { 0x00590062, 2 }, { 0x015400C5, 2 }, { 0x01570138, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250108, -1 }, { 0x00000000, 0 },
+    { 0x00F80157, 1 }, { 0x01360153, -1 }, { 0x01550151, -1 }, { 0x0174014F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00532026, -1 }, { 0x00580107, -1 }, { 0x00CF201E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E00C7, -1 }, { 0x00560120, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0050003A, -2 }, { 0x0148002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00E0, -3 }, { 0x2019006D, -1 },
+    { 0x012D012B, 2 }, { 0x005100C6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D016C, -2 }, { 0x201A00F9, -1 },
+    { 0x00520152, -1 }, { 0x014A0142, 1 }, { 0x004F00DF, -1 }, { 0x0144005C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180112, -1 }, { 0x00CC0163, -1 }, { 0x002E00FA, -1 }, { 0x012600EA, -1 },
+    { 0x01040079, -2 }, { 0x01230077, 2 }, { 0x01420075, 1 }, { 0x014500E8, -1 },
+    { 0x0148015B, 1 }, { 0x016400E6, -1 }, { 0x00000000, 0 }, { 0x004B0111, -1 },
+    { 0x01240103, -1 }, { 0x01430101, -1 }, { 0x015D201E, -1 }, { 0x016200FF, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50122, -1 }, { 0x00000000, 0 }, { 0x010000AB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C3013B, 1 }, { 0x00000000, 0 }, { 0x00C000C8, 1 },
+    { 0x0158004B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20100176, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x017800D5, -1 }, { 0x00DA006C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20252039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB00F8, -1 }, { 0x015700F0, -1 }, { 0x017600EE, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202500C0, 1 }, { 0x00D90111, -1 }, { 0x0136010B, -1 }, { 0x01550109, -1 },
+    { 0x01740107, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026014C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01720120, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016C003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059014B, -1 },
+    { 0x005600D8, -1 }, { 0x00780149, 1 }, { 0x00720063, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016E0152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0168006C, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0124, -2 },
+    { 0x00000000, 0 }, { 0x0107201D, 1 }, { 0x0052010A, -1 }, { 0x010F0171, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B013D, -1 }, { 0x00000000, 0 }, { 0x201800CA, -1 }, { 0x00500123, -1 },
+    { 0x00CC011B, -1 }, { 0x00000000, 0 }, { 0x0123002F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F013E, 1 }, { 0x002C00CB, 1 }, { 0x004E013C, 1 }, { 0x00C4004E, 1 },
+    { 0x012400BB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004900E2, -1 }, { 0x0046006F, -1 },
+    { 0x00C20067, 1 }, { 0x00C500DA, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0042201A, -1 }, { 0x00612018, -1 },
+    { 0x00DD2010, -1 }, { 0x01040162, -2 }, { 0x011D007A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C1010C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0125, -1 }, { 0x00FD0121, -1 }, { 0x005C0045, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410146, -1 }, { 0x00DC013C, 1 }, { 0x013600C3, 1 },
+    { 0x0079005C, -1 }, { 0x00D60056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260104, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x017200D8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0176, -3 },
+    { 0x00D0201A, -2 }, { 0x00590103, -1 }, { 0x00D8016E, -1 }, { 0x01540166, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057011C, -1 }, { 0x016E010A, -1 },
+    { 0x00CD002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00DC, -2 }, { 0x201A0069, -1 }, { 0x012E0127, 1 },
+    { 0x005200C2, 2 }, { 0x016C0123, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0168, -1 }, { 0x201B00F5, -3 }, { 0x00000000, 0 },
+    { 0x012C0140, 1 }, { 0x005000DB, -1 }, { 0x002E006A, 3 }, { 0x0107005C, -1 },
+    { 0x01450058, 1 }, { 0x016A013C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00EC015D, 1 }, { 0x002F00F6, -3 }, { 0x004E00F4, -1 }, { 0x01430071, -1 },
+    { 0x0162006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0120201E, -1 }, { 0x012500FF, -1 },
+    { 0x014400FD, -1 }, { 0x015E201A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0104011A, 1 }, { 0x00C300AB, -1 }, { 0x015B002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01020133, -1 }, { 0x01210131, 1 }, { 0x00C100C4, 1 }, { 0x00420059, -1 },
+    { 0x00DD004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20150, -1 }, { 0x0100014C, -1 }, { 0x00BF00DD, -1 },
+    { 0x00DB0068, 1 }, { 0x00DE00DB, -1 }, { 0x013E0148, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011D0163, 1 }, { 0x007A2019, 1 },
+    { 0x00DC00F4, -1 }, { 0x013C0161, 1 }, { 0x01550079, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01780176, 1 },
+    { 0x00DA010D, -1 }, { 0x01322026, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C012E, 1 }, { 0x005900BB, -1 }, { 0x0154011E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700D4, -1 },
+    { 0x016E00C2, -2 }, { 0x00540061, -1 }, { 0x00D00059, -1 }, { 0x010E0055, -1 },
+    { 0x00000000, 0 }, { 0x201B2026, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D100E5, -1 }, { 0x00000000, 0 }, { 0x012B006C, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0120, -1 }, { 0x00000000, 0 },
+    { 0x004E2025, -2 }, { 0x00CF00FE, 1 }, { 0x012C00F8, -1 }, { 0x016A00F4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0139, -1 },
+    { 0x00000000, 0 }, { 0x201900C6, -5 }, { 0x0051011F, 1 }, { 0x00CD0117, -1 },
+    { 0x012A0111, -1 }, { 0x0168010D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010400D2, -1 }, { 0x00000000, 0 }, { 0x017D0057, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C016C, -1 }, { 0x00C400EF, -1 }, { 0x01620158, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC2025, -3 }, { 0x00C20108, -1 },
+    { 0x01000104, 1 }, { 0x0158201D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C00121, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0174002F, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0138, -1 }, { 0x00DA00C5, -2 }, { 0x20260074, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0151, -1 }, { 0x007B00E4, -1 },
+    { 0x00590073, -2 }, { 0x01130067, -1 }, { 0x015400D6, -1 }, { 0x01570149, 1 },
+    { 0x01700061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0055201E, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016A2025, -3 }, { 0x201D004C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E00D8, -1 }, { 0x00000000, 0 }, { 0x012F0123, 1 }, { 0x201B0065, -3 },
+    { 0x0050004B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EF0140, 3 },
+    { 0x012D013C, 3 }, { 0x002F0066, -2 }, { 0x004E0064, -1 }, { 0x016800C5, -2 },
+    { 0x00000000, 0 }, { 0x201D017D, -1 }, { 0x201A010A, -1 }, { 0x00000000, 0 },
+    { 0x014A0153, -1 }, { 0x012800E2, -1 }, { 0x014700E0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180123, -3 },
+    { 0x00AD0176, -1 }, { 0x00672026, -1 }, { 0x0102201C, -3 }, { 0x010700FD, 1 },
+    { 0x0121201A, -1 }, { 0x012600FB, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0124, 1 }, { 0x004B0122, -1 },
+    { 0x00C22039, -1 }, { 0x011E002E, -1 }, { 0x01620110, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50133, -1 },
+    { 0x00000000, 0 }, { 0x00C200C0, 1 }, { 0x00DE004B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C3014C, -1 }, { 0x00000000, 0 }, { 0x00C000D9, -2 }, { 0x0041006E, -1 },
+    { 0x00DC0064, -1 }, { 0x0158005C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10165, -1 }, { 0x00000000, 0 }, { 0x00DD00F0, -1 },
+    { 0x01560075, -1 }, { 0x015900E8, -1 }, { 0x017800E6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011C0178, -1 }, { 0x00DB0109, -1 },
+    { 0x00F52026, -2 }, { 0x013B0176, -2 }, { 0x01570101, -1 }, { 0x01790172, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500D1, 1 },
+    { 0x00D90122, -1 }, { 0x0136011C, -1 }, { 0x00000000, 0 }, { 0x00570044, 1 },
+    { 0x00F2003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800D0, 1 }, { 0x015000C0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005600E9, -2 },
+    { 0x011000DD, -1 }, { 0x00EE006C, 3 }, { 0x012C0068, 1 }, { 0x014E00D9, -1 },
+    { 0x016A0064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01300167, -1 },
+    { 0x00540102, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A00C2, 1 }, { 0x00CE0113, -1 }, { 0x014A010B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B014E, -1 },
+    { 0x00000000, 0 }, { 0x201800DB, -1 }, { 0x00000000, 0 }, { 0x002E00C3, 1 },
+    { 0x004D00C1, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F014F, -3 },
+    { 0x002C00DC, -1 }, { 0x004E014D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C0166, -1 }, { 0x004900F3, -1 }, { 0x00000000, 0 }, { 0x01000074, -1 },
+    { 0x011F0072, 1 }, { 0x013E0070, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01230171, 2 }, { 0x00C30104, 1 }, { 0x0142016F, 1 },
+    { 0x01592019, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1011D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0137002F, 1 }, { 0x0156002D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE0134, -1 }, { 0x00DB00C1, -2 }, { 0x005C0056, -3 }, { 0x01540046, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410157, -1 }, { 0x00DC014D, -1 }, { 0x013600D4, -1 },
+    { 0x01580145, 1 }, { 0x017400D0, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056201A, -4 }, { 0x00752018, -1 },
+    { 0x017200E9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D8017F, -1 },
+    { 0x01540177, -1 }, { 0x01700102, -2 }, { 0x0053002E, -1 }, { 0x0072002C, -3 },
+    { 0x201E0048, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0057012D, 1 }, { 0x016E011B, -1 }, { 0x201C0061, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00ED, -1 }, { 0x00000000, 0 }, { 0x00D1013E, 1 }, { 0x005200D3, -1 },
+    { 0x010F013A, 4 }, { 0x014A00C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B0106, -1 }, { 0x00000000, 0 }, { 0x012C0151, -1 },
+    { 0x00CC00E4, -1 }, { 0x0126006B, 1 }, { 0x01640067, -1 }, { 0x016A014D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019011F, -4 }, { 0x00510178, -1 },
+    { 0x00C5201C, -3 }, { 0x002F0107, -3 }, { 0x004E0105, -1 }, { 0x01032018, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004900AB, -1 },
+    { 0x011F002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A0137, 1 }, { 0x0104012B, -1 },
+    { 0x004700C4, -1 }, { 0x00C00049, 1 }, { 0x01230129, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40148, -1 },
+    { 0x01020144, -1 }, { 0x00C100D5, -1 }, { 0x011B005C, -2 }, { 0x01780056, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013E0159, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01570071, -1 },
+    { 0x0176006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0134201E, -2 }, { 0x00DC0105, -1 },
+    { 0x013900FF, -1 }, { 0x015800FD, -1 }, { 0x0172201A, -3 }, { 0x20250041, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600CD, 1 }, { 0x00DA011E, -1 },
+    { 0x01560116, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C013F, 1 }, { 0x00000000, 0 }, { 0x00D500C4, -1 }, { 0x00560059, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250172, -1 }, { 0x201D201E, -6 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700E5, -2 }, { 0x00D300DD, -1 },
+    { 0x00EF0068, 3 }, { 0x016E00D3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580171, -1 }, { 0x005500FE, 1 },
+    { 0x006F201B, -1 }, { 0x00D100F6, -1 }, { 0x012B007D, 1 }, { 0x012E00F0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00720115, -1 }, { 0x00CF010F, -1 }, { 0x012C0109, -1 }, { 0x006C002F, 1 },
+    { 0x016A0105, -1 }, { 0x2018004B, -1 }, { 0x201C014A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0168011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C004C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0163, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660137, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00490063, -1 }, { 0x01220055, -1 }, { 0x00000000, 0 },
+    { 0x2018017C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0164, -2 },
+    { 0x004A00EF, 1 }, { 0x00000000, 0 }, { 0x00C30074, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00622025, -2 }, { 0x00C40100, 1 }, { 0x012100FA, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460121, -1 }, { 0x0065011F, -1 },
+    { 0x00000000, 0 }, { 0x00FA002F, 1 }, { 0x01760027, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00A10134, 3 },
+    { 0x004100C7, -1 }, { 0x00C00132, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0149, -1 }, { 0x00DA00D6, -1 }, { 0x005B006B, 2 }, { 0x015600CE, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01760158, 1 }, { 0x007B00F5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2025012A, 1 }, { 0x00000000, 0 }, { 0x00F02025, -2 }, { 0x01360175, -1 },
+    { 0x00000000, 0 }, { 0x0054002A, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012C203A, -1 },
+    { 0x00580129, 1 }, { 0x00000000, 0 }, { 0x00520043, -1 }, { 0x00CE003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560142, 2 }, { 0x00000000, 0 }, { 0x0050005C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0102, -4 }, { 0x0054015B, -1 }, { 0x00000000, 0 }, { 0x00CD00E0, -1 },
+    { 0x006D0073, 1 }, { 0x016800D6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520174, -2 }, { 0x00000000, 0 },
+    { 0x006E00FF, -1 }, { 0x012800F3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00482039, -1 }, { 0x002E011C, -1 }, { 0x00000000, 0 }, { 0x00E2002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01240125, 1 }, { 0x01430123, -1 },
+    { 0x00C10045, 1 }, { 0x015C003B, -1 }, { 0x01620121, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50144, -1 },
+    { 0x00C200D1, 1 }, { 0x00DE005C, -3 }, { 0x010000CD, 1 }, { 0x013B0056, -2 },
+    { 0x015A0054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10176, -2 }, { 0x011E0170, -1 }, { 0x00DD0101, -1 }, { 0x01542018, -2 },
+    { 0x017B016A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760110, 1 },
+    { 0x00000000, 0 }, { 0x0132002E, -2 }, { 0x0151002C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F80131, 1 },
+    { 0x01740129, 1 }, { 0x00D600C0, -1 }, { 0x016E0043, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2026016E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005800E1, -1 }, { 0x00D400D9, -1 }, { 0x010F0062, 4 },
+    { 0x016C005C, 1 }, { 0x01720142, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0059016D, -1 }, { 0x0078016B, 1 }, { 0x0170015B, -1 },
+    { 0x00EE007D, 1 }, { 0x201B002E, -3 }, { 0x203A002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540113, -1 },
+    { 0x20190047, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0146, -1 }, { 0x00000000, 0 }, { 0x201A00D3, -1 },
+    { 0x0052012C, 1 }, { 0x01642039, -1 }, { 0x012800AB, -1 }, { 0x0106003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B015F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00500145, -1 }, { 0x002E00D4, -1 }, { 0x01290137, 3 },
+    { 0x014500C2, -1 }, { 0x016400C0, -3 }, { 0x00000000, 0 }, { 0x20190178, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C00ED, -1 },
+    { 0x004B00EB, -1 }, { 0x00670076, 2 }, { 0x00C40070, -1 }, { 0x0121006A, 3 },
+    { 0x015F0066, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0177, -1 },
+    { 0x00C0201B, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0066011B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1012E, 1 }, { 0x004200C3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0145, -1 },
+    { 0x00DB00D2, -1 }, { 0x005C0067, 3 }, { 0x007B0065, -1 }, { 0x01540057, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410168, -2 }, { 0x00D900EB, -1 }, { 0x013600E5, -1 }, { 0x015500E3, -1 },
+    { 0x01580156, 1 }, { 0x017400E1, -2 }, { 0x00000000, 0 }, { 0x20260126, 1 },
+    { 0x00000000, 0 }, { 0x0156016F, -1 }, { 0x013400FE, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590125, 2 },
+    { 0x01700113, -1 }, { 0x201E0059, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0057013E, 2 }, { 0x00D000C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00FE, -1 },
+    { 0x00000000, 0 }, { 0x00D1014F, -1 }, { 0x010F014B, 2 }, { 0x00EA0067, -1 },
+    { 0x01280063, -1 }, { 0x01470061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B0117, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005000FD, 1 },
+    { 0x00CC00F5, -1 }, { 0x012900EF, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190130, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0067002E, -1 }, { 0x01210022, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20041, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01420138, 1 }, { 0x00C300CD, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40159, -1 }, { 0x01020155, -1 },
+    { 0x017B00DA, -1 }, { 0x00DD0071, -1 }, { 0x01780067, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20172, -2 },
+    { 0x00F8201A, -2 }, { 0x0100016E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410120, -1 }, { 0x0158010E, 1 }, { 0x20250052, 1 },
+    { 0x00F5002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202600DE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00580051, -1 }, { 0x01500041, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0150, -1 },
+    { 0x01350142, 2 }, { 0x005900DD, 1 }, { 0x012F005C, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00522015, -1 }, { 0x005700F6, -2 }, { 0x013000E8, -1 },
+    { 0x016E00E4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01500172, -1 }, { 0x0055010F, -1 }, { 0x00CC2026, -1 },
+    { 0x00D10107, -1 }, { 0x012E0101, -1 }, { 0x201A0043, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00CF, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0044, 1 }, { 0x00C9003A, -1 },
+    { 0x00000000, 0 }, { 0x201C015B, -2 }, { 0x00000000, 0 }, { 0x201900E8, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0174, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00490074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0175, -2 }, { 0x004A0100, -1 },
+    { 0x01640161, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00480119, -1 }, { 0x015A2026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C2012A, 1 }, { 0x01000126, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00143, 1 }, { 0x004100D8, -1 },
+    { 0x015800C6, 2 }, { 0x01740051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420164, -1 },
+    { 0x00DA00E7, -1 }, { 0x01780150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00762025, -2 }, { 0x005C0108, -1 }, { 0x00D80100, -1 }, { 0x01760169, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025013B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0079011F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0054003B, -2 }, { 0x010E002F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058013A, 1 },
+    { 0x005500C7, -1 }, { 0x00520054, -2 }, { 0x201D006E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00FA, -1 }, { 0x00000000, 0 },
+    { 0x00560153, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CC0065, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0113, -3 },
+    { 0x00000000, 0 }, { 0x004C2018, -2 }, { 0x00D00164, -1 }, { 0x012A00EB, -1 },
+    { 0x01460076, -1 }, { 0x016800E7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A012C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01470102, -1 },
+    { 0x01660100, -3 }, { 0x0049002C, -1 }, { 0x0068002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20180145, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00E80121, -1 }, { 0x0145011B, -1 }, { 0x00280047, -1 }, { 0x01640119, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B0144, -1 }, { 0x00C400C9, 1 }, { 0x0064005C, 1 },
+    { 0x00C10056, -4 }, { 0x010200C5, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0068015B, 1 }, { 0x00C50155, -1 }, { 0x004600EA, -1 },
+    { 0x00BF006F, -1 }, { 0x010000DE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00470176, -1 }, { 0x00BB201A, -1 },
+    { 0x00C3016E, -2 }, { 0x01200168, -1 }, { 0x01562010, -1 }, { 0x015E0164, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01780108, -1 }, { 0x2026004E, 1 }, { 0x00F6002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01570123, -1 }, { 0x005C00C0, 2 },
+    { 0x01760121, -2 }, { 0x0170003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F80142, 1 },
+    { 0x005A00D9, -1 }, { 0x00F2005C, -2 }, { 0x0136013E, 1 }, { 0x0174013A, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01720153, -1 }, { 0x005800F2, -1 }, { 0x012E0071, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D50176, -1 }, { 0x0056010B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00CB, -1 }, { 0x20190058, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0157, -1 }, { 0x00000000, 0 }, { 0x0052013D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002D0059, -1 }, { 0x004C0057, -2 },
+    { 0x00000000, 0 }, { 0x201B0170, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F0171, -1 }, { 0x004B00FC, -1 }, { 0x01270161, 1 },
+    { 0x0146015F, 1 }, { 0x016200EA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490115, -1 },
+    { 0x011D2026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C30126, 1 }, { 0x01782039, -1 }, { 0x00000000, 0 }, { 0x00410048, 1 },
+    { 0x011A003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C1013F, 1 }, { 0x00000000, 0 }, { 0x017800C0, -3 },
+    { 0x00BB0059, -1 }, { 0x0156004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0156, -1 }, { 0x00DB00E3, -1 },
+    { 0x00000000, 0 }, { 0x005C0078, 1 }, { 0x01730066, 5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500AB, -1 },
+    { 0x00F800FA, 1 }, { 0x013600F6, -1 }, { 0x015500F4, -1 }, { 0x017400F2, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0172010B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D1002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E006A, 3 }, { 0x005600C3, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057014F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CD0061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D010F, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014A00E5, -1 }, { 0x00000000, 0 }, { 0x01090076, 1 },
+    { 0x01280074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0128, -1 },
+    { 0x00000000, 0 }, { 0x010D0175, 1 }, { 0x0162201B, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190141, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0127, 1 },
+    { 0x00E9011D, -1 }, { 0x00000000, 0 }, { 0x015F002F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C500C5, 1 }, { 0x00000000, 0 }, { 0x0100004E, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0123014B, 1 }, { 0x002800E8, -1 }, { 0x006600E4, -1 },
+    { 0x00C300DE, 1 }, { 0x01420149, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C4016A, -2 }, { 0x01020166, -2 },
+    { 0x00000000, 0 }, { 0x01780078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01552025, -3 },
+    { 0x00DE010E, -1 }, { 0x017C0177, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410131, -1 }, { 0x00DC0127, 1 }, { 0x0177011D, -1 }, { 0x00D60041, -1 },
+    { 0x0133003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA0140, 1 }, { 0x017200C3, -2 },
+    { 0x00580062, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B015F, -1 }, { 0x00000000, 0 },
+    { 0x005900EE, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D60172, -1 },
+    { 0x00CE201E, -1 }, { 0x00570107, -2 }, { 0x016E00F5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00C7, -2 }, { 0x00550120, -1 }, { 0x201A0054, -2 }, { 0x005200AD, -1 },
+    { 0x004F003A, -1 }, { 0x0128002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B00E0, -3 }, { 0x00000000, 0 }, { 0x016A0127, 1 },
+    { 0x005000C6, -5 }, { 0x002E0055, -1 }, { 0x01640041, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C016C, -1 }, { 0x201900F9, -1 }, { 0x00000000, 0 },
+    { 0x002F00E1, -3 }, { 0x01680140, 1 }, { 0x004B006C, 1 }, { 0x006A006A, 1 },
+    { 0x0143005C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0147015B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015C201E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40122, -1 },
+    { 0x0102011E, -1 }, { 0x00000000, 0 }, { 0x00DD003A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C2013B, 1 }, { 0x013E0133, 2 }, { 0x00DE00C6, -2 }, { 0x011C00C2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC00DF, -2 },
+    { 0x00D9006C, 1 }, { 0x013900D9, -1 }, { 0x01550064, -1 }, { 0x01740062, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0078201D, 1 }, { 0x00DA00F8, -1 },
+    { 0x00DD016B, -1 }, { 0x01780161, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007B0117, -1 }, { 0x016E2026, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025014C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005500D8, -1 },
+    { 0x016C00C6, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00CF00E9, -1 }, { 0x012C00E3, -1 }, { 0x016A00DF, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0124, -1 }, { 0x00000000, 0 },
+    { 0x0125201B, -1 }, { 0x016800F8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A013D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01280115, -1 }, { 0x01470113, -1 },
+    { 0x01660111, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00470056, -1 }, { 0x00C3004E, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B0155, -1 }, { 0x004800E2, -1 }, { 0x00C10067, 1 }, { 0x00C400DA, -2 },
+    { 0x010200D6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50166, -2 }, { 0x010000EF, -1 }, { 0x011F00ED, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C0010C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0123, -2 }, { 0x011B011F, -1 }, { 0x0159011B, -1 }, { 0x00F6003B, -1 },
+    { 0x01780119, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB013C, 1 }, { 0x005C00D1, 1 }, { 0x0078005C, -2 },
+    { 0x00D50056, -1 }, { 0x01320050, 1 }, { 0x015400C1, 2 }, { 0x00000000, 0 },
+    { 0x20250104, 1 }, { 0x00000000, 0 }, { 0x0136014F, -1 }, { 0x0155014D, -1 },
+    { 0x00000000, 0 }, { 0x016E0065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CF201A, -1 },
+    { 0x00580103, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00C3, 1 },
+    { 0x00000000, 0 }, { 0x0056011C, -1 }, { 0x00000000, 0 }, { 0x00CC002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00DC, -1 }, { 0x20190069, -1 }, { 0x00EF012B, 2 }, { 0x005100C2, -1 },
+    { 0x002F0051, -1 }, { 0x012D0127, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0168, -2 }, { 0x00000000, 0 }, { 0x0052014E, -1 }, { 0x012B0140, 3 },
+    { 0x004F00DB, -1 }, { 0x014A013E, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012600E6, -1 }, { 0x014500E4, -1 }, { 0x016400E2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B010D, -1 }, { 0x011F201E, -1 }, { 0x013E201C, 2 },
+    { 0x015D201A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C5011E, -1 }, { 0x00000000, 0 },
+    { 0x00C200AB, -1 }, { 0x015A002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C000C4, 1 }, { 0x00410059, -2 }, { 0x00DC004F, -1 },
+    { 0x01580047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA0068, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB00F4, -1 }, { 0x017600EA, -1 },
+    { 0x01540079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01580178, -2 }, { 0x00D9010D, -1 },
+    { 0x01360107, -1 }, { 0x01550105, -1 }, { 0x0057002F, -3 }, { 0x01740103, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0172011C, -1 }, { 0x00000000, 0 }, { 0x012E003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005600D4, -1 }, { 0x014E00C4, -1 },
+    { 0x016A004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E014E, -1 }, { 0x20190021, -1 },
+    { 0x014C00DD, -1 }, { 0x012A006C, 1 }, { 0x01680068, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0120, -2 }, { 0x00000000, 0 }, { 0x010F016D, 1 },
+    { 0x00520106, -1 }, { 0x00CE00FE, 1 }, { 0x01072019, 1 }, { 0x014A00F6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0139, -1 }, { 0x00000000, 0 },
+    { 0x201800C6, -4 }, { 0x0050011F, -1 }, { 0x00CC0117, -1 }, { 0x00000000, 0 },
+    { 0x00E5002F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190152, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F013A, 1 }, { 0x002C00C7, -1 },
+    { 0x004B00C5, 1 }, { 0x01020046, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C500D6, -1 }, { 0x0046006B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006600F5, -1 }, { 0x00C300EF, -1 }, { 0x011D0076, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB2025, -3 }, { 0x00C10108, -1 }, { 0x01020177, -2 },
+    { 0x011E0102, -1 }, { 0x01210175, 2 }, { 0x0157201D, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0121, 1 },
+    { 0x00FD011D, -1 }, { 0x005C0041, 2 }, { 0x0173002F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01580130, 1 }, { 0x00D900C5, -2 }, { 0x017400BB, -1 }, { 0x20250074, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260100, 1 },
+    { 0x00000000, 0 }, { 0x00DA0151, -1 }, { 0x017200D4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C0172, -2 }, { 0x0054201E, -3 }, { 0x007800FD, 1 },
+    { 0x00D8016A, -1 }, { 0x01540162, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016E0106, -1 }, { 0x201C004C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00D8, -2 },
+    { 0x00000000, 0 }, { 0x010F0125, 4 }, { 0x016C011F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0164, -2 },
+    { 0x00000000, 0 }, { 0x00720148, 1 }, { 0x00CF0142, 1 }, { 0x00EE0140, 3 },
+    { 0x002E0066, 1 }, { 0x012C013C, 1 }, { 0x01640052, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019010A, -2 }, { 0x00000000, 0 }, { 0x01680151, -1 },
+    { 0x002F00F2, -3 }, { 0x004E00F0, -1 }, { 0x0124006F, -1 }, { 0x0162006B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00662026, -2 }, { 0x00E700FF, 1 }, { 0x0101201C, -1 }, { 0x0120201A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C12039, -1 }, { 0x01040116, 1 }, { 0x00000000, 0 },
+    { 0x011D002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40133, -1 }, { 0x0102012F, -1 },
+    { 0x00C100C0, 1 }, { 0x00420055, -1 }, { 0x0121012D, 1 }, { 0x01780041, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2014C, -1 },
+    { 0x01000148, -1 }, { 0x00BF00D9, -1 }, { 0x00DB0064, -1 }, { 0x011F0146, 1 },
+    { 0x013E0144, 2 }, { 0x0157005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C00165, -1 }, { 0x013C015D, 1 }, { 0x00DC00F0, -1 }, { 0x01360077, -1 },
+    { 0x01740073, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA0109, -1 }, { 0x00F42026, -2 },
+    { 0x0170201E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C012A, 1 },
+    { 0x0154011A, 1 }, { 0x00000000, 0 }, { 0x00560044, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700D0, 1 }, { 0x00000000, 0 }, { 0x00D00055, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005500E9, -1 }, { 0x00D100E1, -1 },
+    { 0x00520076, -1 }, { 0x00ED006C, 1 }, { 0x012B0068, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E011C, -1 }, { 0x00000000, 0 }, { 0x012C00F4, -1 },
+    { 0x016A00F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900C2, -5 },
+    { 0x00CD0113, -1 }, { 0x012A010D, -1 }, { 0x01680109, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A014E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004F0134, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50046, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010400CE, 1 },
+    { 0x00000000, 0 }, { 0x00660065, -1 }, { 0x01200059, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0168, -1 },
+    { 0x004800F3, -1 }, { 0x006700F1, 1 }, { 0x01620154, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50177, -2 }, { 0x00C20104, 1 }, { 0x01000100, 1 }, { 0x011F00FE, 1 },
+    { 0x0139201B, -2 }, { 0x013E00FC, 1 }, { 0x01582019, -1 }, { 0x017C00F8, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C0011D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DA00C1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB014D, -1 }, { 0x007B00E0, -1 }, { 0x0059006F, -1 }, { 0x0078006D, 1 },
+    { 0x00D800DA, -1 }, { 0x015400D2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0055201A, -3 }, { 0x003B00FD, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012C2025, -1 }, { 0x01500104, -1 },
+    { 0x201D0048, -2 }, { 0x0071002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00D4, -1 }, { 0x00000000, 0 },
+    { 0x0056012D, 1 }, { 0x012F011F, 1 }, { 0x201B0061, -3 }, { 0x010A003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019007A, -1 }, { 0x00EF013C, 3 }, { 0x016800C1, -2 }, { 0x002F0062, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0179, -1 },
+    { 0x201A0106, -1 }, { 0x00000000, 0 }, { 0x014A014F, -1 }, { 0x00000000, 0 },
+    { 0x004C0079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2018011F, -3 }, { 0x00500178, -1 }, { 0x00C4201C, -3 },
+    { 0x01022018, -3 }, { 0x014500F5, -1 }, { 0x016400F3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0120, -1 }, { 0x004B011E, -1 }, { 0x004800AB, -1 }, { 0x00FF002C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00490137, 1 }, { 0x00C5012F, -1 }, { 0x004600C4, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280152, -1 }, { 0x00C30148, -1 },
+    { 0x004400DD, -1 }, { 0x00C000D5, -1 }, { 0x01580058, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015900E4, -1 }, { 0x017800E2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE0178, -2 }, { 0x011C0174, -1 }, { 0x00DB0105, -1 }, { 0x013800FF, 1 },
+    { 0x00590027, 1 }, { 0x013B0172, -1 }, { 0x015700FD, 1 }, { 0x017600FB, -1 },
+    { 0x0179016E, -1 }, { 0x202500CD, 1 }, { 0x00D9011E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016E002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D400C4, -1 }, { 0x016C0047, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C201E, -3 }, { 0x00000000, 0 },
+    { 0x00590158, 1 }, { 0x005600E5, -2 }, { 0x00D200DD, -1 }, { 0x00720070, 1 },
+    { 0x00EE0068, 3 }, { 0x011000D9, -1 }, { 0x012C0064, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006E201B, -1 }, { 0x005400FE, 1 }, { 0x01300163, -1 },
+    { 0x016E015F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0131, -1 }, { 0x00000000, 0 }, { 0x010F017E, 2 }, { 0x00CE010F, -1 },
+    { 0x01452026, -2 }, { 0x014A0107, -1 }, { 0x006B002F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B014A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00500130, -1 }, { 0x00000000, 0 }, { 0x016400AB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F014B, -1 }, { 0x002C00D8, -1 }, { 0x004B00D6, -1 },
+    { 0x00480063, -1 }, { 0x01020057, -4 }, { 0x014300C6, -1 }, { 0x016200C4, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0162, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20074, -1 }, { 0x01000070, -1 }, { 0x011F006E, 1 },
+    { 0x013E006C, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FC201B, -1 },
+    { 0x0028010A, -1 }, { 0x00C30100, 1 }, { 0x0123016D, 2 }, { 0x0142016B, 1 },
+    { 0x01782013, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F9002F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0130, -1 }, { 0x00000000, 0 },
+    { 0x005C0052, 1 }, { 0x00D8004A, -1 }, { 0x01540042, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01580141, 1 },
+    { 0x00D900D6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BB0164, -1 }, { 0x017200E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01540173, -1 }, { 0x00590110, 1 }, { 0x01320102, -1 },
+    { 0x017000FE, 1 }, { 0x201E0044, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570129, 1 },
+    { 0x0130011B, -1 }, { 0x016E0117, -1 }, { 0x00CD003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00E9, -3 }, { 0x00000000, 0 },
+    { 0x00550142, 1 }, { 0x005200CF, 1 }, { 0x004F005C, -2 }, { 0x00D1013A, 1 },
+    { 0x012E0134, 4 }, { 0x201A0076, -2 }, { 0x201E0175, -2 }, { 0x201B0102, -4 },
+    { 0x00720159, 1 }, { 0x00CF0153, -1 }, { 0x005000E8, -1 }, { 0x002E0077, -2 },
+    { 0x006C0073, 1 }, { 0x00CC00E0, -1 }, { 0x012C014D, -1 }, { 0x01450065, -1 },
+    { 0x01640063, -1 }, { 0x00510174, -1 }, { 0x00C52018, -3 }, { 0x002F0103, -3 },
+    { 0x004E0101, -1 }, { 0x006D00FF, -1 }, { 0x2019011B, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E1002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004700C0, -1 }, { 0x00C00045, 1 },
+    { 0x015B003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40144, -1 }, { 0x00C100D1, 1 },
+    { 0x00DD005C, 2 }, { 0x01780052, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000159, -1 }, { 0x011F0157, 1 },
+    { 0x00BF00EA, -1 }, { 0x013E0155, 2 }, { 0x0157006D, 1 }, { 0x0176006B, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00A10178, -1 },
+    { 0x00C00176, -2 }, { 0x00DC0101, -1 }, { 0x00F6201E, -2 }, { 0x0134201A, -2 },
+    { 0x015800F9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202600C9, 1 }, { 0x00000000, 0 }, { 0x01560112, 1 }, { 0x00000000, 0 },
+    { 0x0077003A, -1 }, { 0x0150002C, -2 }, { 0x016F002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C013B, 1 }, { 0x00000000, 0 },
+    { 0x00D500C0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2025016E, -1 }, { 0x201D201A, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700E1, -2 }, { 0x00D300D9, -1 }, { 0x016B005C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0058016D, -1 }, { 0x00000000, 0 }, { 0x00D100F2, -1 }, { 0x016C00E8, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014E0176, -1 }, { 0x00720111, -1 }, { 0x00CF010B, -1 },
+    { 0x012C0105, -1 }, { 0x016A0101, -1 }, { 0x20180047, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900D3, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0048, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01280137, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50057, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00660076, 1 }, { 0x00C30070, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0177, -1 }, { 0x010200F8, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0046011D, -1 }, { 0x013E010D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C0012E, 1 }, { 0x004100C3, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DA00D2, -1 },
+    { 0x015600CA, 1 }, { 0x01340059, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760154, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250126, 1 }, { 0x00000000, 0 },
+    { 0x00F80175, 1 }, { 0x00D60104, -1 }, { 0x01360171, -1 }, { 0x014D201B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580125, 1 }, { 0x00770123, -1 },
+    { 0x201D0059, -1 }, { 0x014A002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056013E, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016800D2, -1 }, { 0x002F0073, -3 }, { 0x004E0071, -1 },
+    { 0x00E90067, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00520170, -2 }, { 0x00000000, 0 }, { 0x016600EB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180130, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0118, 1 },
+    { 0x01640104, -3 }, { 0x0066002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01050123, 1 }, { 0x0143011F, -1 }, { 0x00C10041, 1 }, { 0x0162011D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C200CD, 1 }, { 0x00DE0058, -1 },
+    { 0x010000C9, 1 }, { 0x011C0054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C30159, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DC0071, -1 }, { 0x01770067, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10172, -2 }, { 0x011E016C, -1 },
+    { 0x01542014, -1 }, { 0x015900F5, -1 }, { 0x017800F3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0176010C, -1 }, { 0x00000000, 0 }, { 0x00F4002E, -2 },
+    { 0x0132002A, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202500DE, 1 }, { 0x00000000, 0 }, { 0x01740125, 2 }, { 0x00000000, 0 },
+    { 0x00570051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2026016A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01340142, 1 },
+    { 0x005800DD, 1 }, { 0x00D10062, 1 }, { 0x0172013E, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590169, -1 },
+    { 0x005600F6, -2 }, { 0x00000000, 0 }, { 0x010D0077, 1 }, { 0x016A0071, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0054010F, -1 }, { 0x0147201E, -2 }, { 0x0166201C, 1 },
+    { 0x20190043, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0142, -1 }, { 0x201A00CF, 1 }, { 0x00520128, 1 }, { 0x01262039, -1 },
+    { 0x00000000, 0 }, { 0x00C8003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B015B, -2 }, { 0x00000000, 0 }, { 0x201800E8, -3 }, { 0x00500141, -1 },
+    { 0x002E00D0, 1 }, { 0x00000000, 0 }, { 0x0104004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190174, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B00E7, -1 }, { 0x00000000, 0 }, { 0x00480074, -1 },
+    { 0x00670072, 1 }, { 0x01210066, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0063201D, 1 }, { 0x002A0102, -1 }, { 0x00C500F8, 1 },
+    { 0x013E007D, 3 }, { 0x017C0079, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0123017E, 1 }, { 0x0028011B, -1 },
+    { 0x00660117, -1 }, { 0x01592026, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C1012A, 1 }, { 0x00000000, 0 }, { 0x017800AB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE0141, -1 }, { 0x00000000, 0 }, { 0x017600C4, -3 },
+    { 0x007B0061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410164, -2 }, { 0x00D900E7, -1 },
+    { 0x013600E1, -1 }, { 0x01580152, -1 }, { 0x017400DD, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260122, -1 }, { 0x00000000, 0 }, { 0x0156016B, -1 },
+    { 0x017200F6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590121, -2 }, { 0x0170010F, -1 }, { 0x201E0055, -1 },
+    { 0x0053003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057013A, 2 }, { 0x00000000, 0 },
+    { 0x00510054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00FA, -1 }, { 0x00000000, 0 }, { 0x00550153, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0113, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019012C, -2 },
+    { 0x00000000, 0 }, { 0x01490175, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0048002C, -1 }, { 0x0067002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01040138, -1 }, { 0x002800D3, -1 }, { 0x0063005C, -1 }, { 0x00C00056, -4 },
+    { 0x00C300C9, 1 }, { 0x012000C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C40155, -1 }, { 0x011E00DC, -1 }, { 0x00DD006D, -1 },
+    { 0x01590065, -1 }, { 0x01780063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C2016E, -2 }, { 0x0100016A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0041011C, -1 }, { 0x0158010A, -1 }, { 0x00D6002C, -2 }, { 0x00F5002A, -1 },
+    { 0x2025004E, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600DA, -1 },
+    { 0x00000000, 0 }, { 0x01750121, -1 }, { 0x00000000, 0 }, { 0x0058004D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C014C, -1 }, { 0x0135013E, 2 }, { 0x017000C7, -1 },
+    { 0x00F1005C, -3 }, { 0x014E0056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00522011, -1 },
+    { 0x005700F2, -2 }, { 0x013000E4, -1 }, { 0x016E00E0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D40176, -1 },
+    { 0x0055010B, -1 }, { 0x00D10103, -1 }, { 0x010F00FF, 2 }, { 0x0150016E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B00CB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0145002E, -2 }, { 0x0164002C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201900E4, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0059, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0170, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0171, -1 }, { 0x0145015F, -1 }, { 0x012300EE, 1 }, { 0x0164015D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01620176, 1 }, { 0x00480115, -1 }, { 0x011C2026, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20126, 1 },
+    { 0x01000122, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C0013F, 1 }, { 0x004100D4, -1 }, { 0x015800C2, 2 }, { 0x01360051, -1 },
+    { 0x0174004D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0156, 1 }, { 0x00DA00E3, -1 }, { 0x015600DB, -2 },
+    { 0x007A0076, 1 }, { 0x0178014C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0104, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D0002F, -1 },
+    { 0x012D0029, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005500C3, -2 }, { 0x00D100BB, -1 },
+    { 0x00520050, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056014F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CC0061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C010F, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x012A00E7, -1 }, { 0x016800E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0128, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014700FE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180141, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E8011D, -1 }, { 0x01260119, -1 },
+    { 0x00280043, -1 }, { 0x00470041, -1 }, { 0x0066003F, 1 }, { 0x01450117, -1 },
+    { 0x01640115, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0140, 1 },
+    { 0x00C400C5, 1 }, { 0x010200C1, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004600E6, -1 }, { 0x00BF006B, -1 }, { 0x00C200DE, 1 },
+    { 0x00FD0067, -1 }, { 0x010000DA, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00470172, -1 }, { 0x00C3016A, -2 }, { 0x006300FD, 1 }, { 0x011D00F1, 1 },
+    { 0x01200164, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD010E, 1 },
+    { 0x01780104, -3 }, { 0x2026004A, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB0127, 1 }, { 0x01190123, -1 }, { 0x00D50041, -1 }, { 0x0132003B, -2 },
+    { 0x0157011F, -1 }, { 0x0176011D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D90140, 1 }, { 0x0136013A, 1 }, { 0x00570062, 2 },
+    { 0x01550138, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0172014F, -1 }, { 0x005800EE, 1 },
+    { 0x00D10073, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D50172, -1 }, { 0x00512026, -2 },
+    { 0x00560107, -2 }, { 0x00CD201E, -1 }, { 0x00F100FD, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00C7, -1 },
+    { 0x20190054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0146002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0153, -3 },
+    { 0x00000000, 0 }, { 0x00520139, 1 }, { 0x012B012B, 2 }, { 0x004F00C6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B016C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004A006C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F016D, -1 },
+    { 0x002C00FA, -1 }, { 0x004B00F8, -1 }, { 0x01020079, -2 }, { 0x01210077, 2 },
+    { 0x012400EA, -1 }, { 0x0127015D, 1 }, { 0x014300E8, -1 }, { 0x0146015B, 1 },
+    { 0x016200E6, -1 }, { 0x00490111, -1 }, { 0x015B201E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30122, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DC003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1013B, 1 },
+    { 0x00000000, 0 }, { 0x00DD00C6, -3 }, { 0x0156004B, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB00DF, -2 }, { 0x017600D5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410175, -2 }, { 0x00D900F8, -1 }, { 0x013600F2, -1 },
+    { 0x015500F0, -1 }, { 0x017400EE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20260133, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01720107, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01700120, -1 }, { 0x201E0066, 1 }, { 0x00000000, 0 }, { 0x016A003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D010B, -3 }, { 0x00000000, 0 }, { 0x016C0152, -1 }, { 0x00CE00E9, -1 },
+    { 0x014A00E1, -1 }, { 0x0166006C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B0124, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019013D, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F0125, 1 }, { 0x004E0123, -1 }, { 0x00000000, 0 },
+    { 0x0121002F, 1 }, { 0x017E0029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500C1, 1 },
+    { 0x00000000, 0 }, { 0x00C2004E, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040149, -1 },
+    { 0x002800E4, -1 }, { 0x006600E0, -1 }, { 0x00C00067, 1 }, { 0x00C300DA, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C40166, -2 }, { 0x01020162, -2 }, { 0x00000000, 0 }, { 0x01590076, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013E0177, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041012D, -1 },
+    { 0x00DC0123, -1 }, { 0x00000000, 0 }, { 0x00F5003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DA013C, 1 }, { 0x013400C3, -1 }, { 0x0077005C, -1 }, { 0x00D40056, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007B015B, -1 }, { 0x00000000, 0 }, { 0x005900EA, -1 }, { 0x017000D8, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005A0176, -1 }, { 0x00CE201A, -1 }, { 0x00570103, -2 },
+    { 0x00D6016E, -1 }, { 0x013000F5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00C3, -5 }, { 0x0150017F, -1 },
+    { 0x0055011C, -1 }, { 0x016C010A, -1 }, { 0x201A0050, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00DC, -1 },
+    { 0x00000000, 0 }, { 0x00EE012B, 2 }, { 0x005000C2, -3 }, { 0x002E0051, -1 },
+    { 0x012C0127, 1 }, { 0x016A0123, -1 }, { 0x00000000, 0 }, { 0x201C0168, -1 },
+    { 0x201900F5, -3 }, { 0x00000000, 0 }, { 0x012A0140, 1 }, { 0x0168013C, 1 },
+    { 0x002C006A, 3 }, { 0x004B0068, 1 }, { 0x0105005C, -2 }, { 0x01430058, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50079, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011E201E, -1 }, { 0x012300FF, 2 }, { 0x014200FD, 2 }, { 0x015C201A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C4011E, -1 }, { 0x0102011A, 1 }, { 0x00C100AB, -1 },
+    { 0x0159002E, -3 }, { 0x0178002C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000133, -1 }, { 0x011F0131, 1 },
+    { 0x00DE00C2, -2 }, { 0x00DB004F, -1 }, { 0x013E012F, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2026201C, -3 }, { 0x00000000, 0 }, { 0x00C00150, -1 },
+    { 0x00000000, 0 }, { 0x015800D3, -1 }, { 0x00D90068, 1 }, { 0x01360062, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013A0161, 1 }, { 0x00782019, 1 }, { 0x00DA00F4, -1 }, { 0x0178015D, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01760176, 1 }, { 0x007B0113, -1 }, { 0x01302026, -1 },
+    { 0x00000000, 0 }, { 0x0056002F, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700BB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005500D4, -1 }, { 0x016C00C2, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20192026, -6 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007200EB, -1 }, { 0x00CF00E5, -1 },
+    { 0x0129006C, 3 }, { 0x20180021, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CD00FE, 1 },
+    { 0x012A00F8, -1 }, { 0x016800F4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0139, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01280111, -1 }, { 0x0147010F, -1 }, { 0x0166010D, -1 }, { 0x00E4002F, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180152, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A00C5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0151, -1 }, { 0x00C400D6, -1 },
+    { 0x010200D2, -1 }, { 0x017B0057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50162, -2 },
+    { 0x00C200EF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DA2025, -3 }, { 0x00C00108, -1 }, { 0x0156201D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD011F, -2 }, { 0x01590117, -1 },
+    { 0x01780115, -1 }, { 0x0172002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C00CD, 1 }, { 0x00D800C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250100, 1 }, { 0x00000000, 0 },
+    { 0x00D90151, -1 }, { 0x0136014B, -1 }, { 0x00570073, -2 }, { 0x01300065, -1 },
+    { 0x01550149, 1 }, { 0x016E0061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0053201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01682025, -3 }, { 0x201B004C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00D8, -1 }, { 0x00000000, 0 },
+    { 0x00EF0127, 3 }, { 0x20190065, -3 }, { 0x002F004D, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0164, -1 }, { 0x00000000, 0 },
+    { 0x0052014A, 1 }, { 0x00CE0142, 1 }, { 0x00ED0140, 1 }, { 0x012B013C, 3 },
+    { 0x014A013A, 1 }, { 0x016600C5, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2018010A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012600E2, -1 },
+    { 0x0142006D, 1 }, { 0x014500E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F017E, -2 }, { 0x004B0109, -1 },
+    { 0x0100201C, -3 }, { 0x011F201A, -1 }, { 0x013E2018, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C02039, -1 }, { 0x00C5011A, 1 }, { 0x00000000, 0 }, { 0x0062003A, -1 },
+    { 0x011C002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C30133, -1 }, { 0x00000000, 0 }, { 0x00C000C0, 1 },
+    { 0x00410055, -2 }, { 0x01580043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1014C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DA0064, -1 }, { 0x0156005C, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB00F0, -1 }, { 0x01540075, -1 }, { 0x015700E8, -1 },
+    { 0x017600E6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01390176, -2 }, { 0x00D90109, -1 }, { 0x00F32026, -2 }, { 0x01360103, -1 },
+    { 0x01550101, -1 }, { 0x01580174, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00F0003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0077, -2 },
+    { 0x005600D0, 1 }, { 0x011000C4, -1 }, { 0x014E00C0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005400E9, -1 }, { 0x010E00DD, -1 }, { 0x012A0068, 1 },
+    { 0x014C00D9, -1 }, { 0x01680064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D011C, -2 }, { 0x010F0169, 1 }, { 0x00520102, 2 }, { 0x012E0167, -1 },
+    { 0x014A00F2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800C2, -4 }, { 0x0050011B, -1 },
+    { 0x00CC0113, -1 }, { 0x00000000, 0 }, { 0x01230027, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019014E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C00C3, 1 }, { 0x004B00C1, 1 }, { 0x00C40046, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500D2, -1 }, { 0x00460067, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002800F5, -1 },
+    { 0x00000000, 0 }, { 0x011D0072, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40177, -2 },
+    { 0x00C10104, 1 }, { 0x01210171, 2 }, { 0x01572019, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF011D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0154002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0158012C, 1 }, { 0x00D900C1, -2 },
+    { 0x005A0056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202600FC, -1 }, { 0x00000000, 0 }, { 0x00DA014D, -1 },
+    { 0x01560145, 1 }, { 0x0058006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C016E, -2 },
+    { 0x0054201A, -3 }, { 0x003A00FD, 1 }, { 0x005900FB, -1 }, { 0x007800F9, 1 },
+    { 0x00D80166, -1 }, { 0x017000E9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D6017F, -1 }, { 0x016E0102, -2 }, { 0x201C0048, -1 },
+    { 0x0051002E, -2 }, { 0x0070002C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00D4, -2 }, { 0x00000000, 0 }, { 0x00D10125, 1 },
+    { 0x010F0121, 1 }, { 0x016C011B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018007A, -1 },
+    { 0x00720144, 1 }, { 0x00CF013E, 1 }, { 0x00EE013C, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190106, -2 },
+    { 0x00000000, 0 }, { 0x012A0151, -1 }, { 0x0168014D, -1 }, { 0x004B0079, -1 },
+    { 0x0124006B, 1 }, { 0x01620067, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004F0178, -1 }, { 0x00C3201C, -3 }, { 0x01012018, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01040112, 1 }, { 0x00000000, 0 }, { 0x00FE002C, -2 }, { 0x011D002A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00480137, 1 }, { 0x00C4012F, -1 }, { 0x0102012B, -1 }, { 0x00DD0047, -1 },
+    { 0x01210129, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20148, -1 }, { 0x01000144, -1 }, { 0x013E0140, 4 },
+    { 0x0119005C, -2 }, { 0x01760056, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00F80077, 1 }, { 0x01360073, -1 }, { 0x01550071, -1 },
+    { 0x0174006F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0178, 1 },
+    { 0x0132201E, -2 }, { 0x00DA0105, -1 }, { 0x0151201C, -1 }, { 0x015600FD, -1 },
+    { 0x0170201A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C0126, 1 }, { 0x01540116, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D300C4, -1 }, { 0x00540059, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B201E, -3 }, { 0x00000000, 0 }, { 0x00580158, 1 },
+    { 0x005500E5, -1 }, { 0x016C00D3, -1 }, { 0x00ED0068, 1 }, { 0x014A0062, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0118, 1 },
+    { 0x006D201B, -1 }, { 0x00CF00F6, -1 }, { 0x012C00F0, -1 }, { 0x0129007D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CD010F, -1 }, { 0x012A0109, -1 },
+    { 0x01680105, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A014A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01640137, 1 }, { 0x00000000, 0 }, { 0x010400CA, 1 }, { 0x00280065, -1 },
+    { 0x00660061, -1 }, { 0x01200055, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0164, -2 }, { 0x006700ED, 1 }, { 0x00000000, 0 },
+    { 0x00C10074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FB201B, -1 }, { 0x00C20100, 1 },
+    { 0x011F00FA, 2 }, { 0x01582015, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01340044, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C00DE, 1 },
+    { 0x0059006B, 2 }, { 0x015400CE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01740158, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00580110, 1 }, { 0x01500100, -1 }, { 0x0052002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E00D0, 1 }, { 0x012A203A, -1 }, { 0x00560129, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CC003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00E9, -3 }, { 0x00000000, 0 }, { 0x00540142, 1 },
+    { 0x00000000, 0 }, { 0x004E005C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0102, 1 }, { 0x00000000, 0 },
+    { 0x00CE0153, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018011B, -3 },
+    { 0x00500174, -1 }, { 0x0067201E, -1 }, { 0x00C42018, -3 }, { 0x012600F3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00462039, -1 }, { 0x002C011C, -1 },
+    { 0x00000000, 0 }, { 0x00E0002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C5012B, -1 }, { 0x004600C0, -3 }, { 0x00000000, 0 }, { 0x015A003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0028014E, -1 }, { 0x00C30144, -1 }, { 0x004400D9, -1 }, { 0x00C000D1, 1 },
+    { 0x00DC005C, 1 }, { 0x01390056, -2 }, { 0x01580054, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00E8, -1 },
+    { 0x015900E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0176, -1 }, { 0x00792026, -2 },
+    { 0x00DB0101, -1 }, { 0x00DE0174, -1 }, { 0x00F5201E, -2 }, { 0x011C0170, -1 },
+    { 0x013B016E, -1 }, { 0x0179016A, -1 }, { 0x00000000, 0 }, { 0x202500C9, 1 },
+    { 0x00000000, 0 }, { 0x01740110, 1 }, { 0x00000000, 0 }, { 0x0076003A, -1 },
+    { 0x0130002E, -1 }, { 0x014F002C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0134012D, 1 }, { 0x00D400C0, -1 },
+    { 0x016C0043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C201A, -3 }, { 0x00000000, 0 }, { 0x00590154, 1 }, { 0x005600E1, -2 },
+    { 0x00D200D9, -1 }, { 0x016A005C, 1 }, { 0x01700142, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01110161, 1 },
+    { 0x016E015B, -1 }, { 0x2019002E, -6 }, { 0x01490077, -1 }, { 0x201C00A1, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010F017A, 1 }, { 0x00CE010B, -1 }, { 0x014A0103, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201800D3, -1 }, { 0x0050012C, -1 }, { 0x01622039, -1 },
+    { 0x012600AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019015F, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C00D4, -1 }, { 0x004B00D2, -1 }, { 0x00C40057, -4 }, { 0x014300C2, -1 },
+    { 0x016200C0, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004900EB, -1 }, { 0x012200DD, -1 }, { 0x00C20070, -1 },
+    { 0x011F006A, 3 }, { 0x013E0068, 4 }, { 0x014100DB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01230169, 2 }, { 0x00280106, -1 }, { 0x00470104, -1 },
+    { 0x01420167, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE012C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C004E, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0158013D, 1 }, { 0x00D900D2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01560156, 1 }, { 0x017200E1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012D201D, 1 },
+    { 0x0059010C, -1 }, { 0x00D50104, -1 }, { 0x013200FE, 1 }, { 0x0154016F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00570125, 2 }, { 0x00760123, -1 }, { 0x01300117, -1 },
+    { 0x0149002F, 1 }, { 0x016E0113, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00E5, -3 }, { 0x00000000, 0 }, { 0x0055013E, 1 }, { 0x005200CB, 1 },
+    { 0x014A00BB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0171, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00720155, 1 },
+    { 0x005000E4, -1 }, { 0x00CF014F, -1 }, { 0x00E80067, -1 }, { 0x01260063, -1 },
+    { 0x01450061, -1 }, { 0x00000000, 0 }, { 0x20190117, -3 }, { 0x00510170, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01660177, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011F0022, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040123, 2 },
+    { 0x01230121, 1 }, { 0x00C00041, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670146, 1 },
+    { 0x00000000, 0 }, { 0x00C100CD, 1 }, { 0x00DD0058, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00460161, -1 }, { 0x00C20159, -1 }, { 0x00BF00E6, -1 }, { 0x00DB0071, -1 },
+    { 0x01000155, -1 }, { 0x01760067, -2 }, { 0x017900DA, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00A10174, -1 }, { 0x00C00172, -2 }, { 0x00F6201A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600C5, 1 }, { 0x00000000, 0 },
+    { 0x0156010E, 1 }, { 0x00000000, 0 }, { 0x00F3002E, -2 }, { 0x0131002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0137, 1 }, { 0x00000000, 0 }, { 0x005900C4, -3 }, { 0x00560051, -1 },
+    { 0x014E0041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025016A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700DD, 1 },
+    { 0x012D005C, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580169, -1 }, { 0x005500F6, -1 },
+    { 0x012E00E8, -1 }, { 0x014A0073, -1 }, { 0x016C00E4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01100176, -1 },
+    { 0x0072010D, -1 }, { 0x00CF0107, -1 }, { 0x012C0101, -1 }, { 0x014E0172, -1 },
+    { 0x20180043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201900CF, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0044, 1 }, { 0x00C7003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180174, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010400DB, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0175, -2 }, { 0x004B0173, -1 }, { 0x006700FE, 1 }, { 0x00C400F8, 1 },
+    { 0x01240165, -1 }, { 0x01620161, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460119, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C0012A, 1 },
+    { 0x00000000, 0 }, { 0x015800AD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01780137, 2 }, { 0x00000000, 0 }, { 0x015600C6, 2 }, { 0x01720051, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01760150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250122, -1 }, { 0x00000000, 0 }, { 0x00F80171, 1 }, { 0x00D60100, -1 },
+    { 0x010F201B, 2 }, { 0x0136016D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0077011F, -1 }, { 0x201D0055, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0056013A, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540153, -1 }, { 0x00000000, 0 },
+    { 0x002F006F, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0052016C, -2 },
+    { 0x012800EB, -1 }, { 0x014700E9, -1 }, { 0x01440076, -1 }, { 0x016600E7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018012C, -1 }, { 0x00000000, 0 },
+    { 0x01480175, -1 }, { 0x002E0114, 1 }, { 0x01450102, -1 }, { 0x0047002C, -1 },
+    { 0x0066002A, 3 }, { 0x01640100, -3 }, { 0x017E201D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E60121, -1 }, { 0x0105011F, 1 },
+    { 0x0143011B, -1 }, { 0x01620119, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C200C9, 1 }, { 0x0062005C, -2 }, { 0x00BF0056, -1 }, { 0x00DE0054, -1 },
+    { 0x010000C5, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C30155, -1 }, { 0x00000000, 0 }, { 0x00410077, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C1016E, -2 }, { 0x011E0168, -1 }, { 0x00DD00F9, -1 }, { 0x01542010, -1 },
+    { 0x015900F1, 1 }, { 0x015C0164, -1 }, { 0x017800EF, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760108, -1 },
+    { 0x00000000, 0 }, { 0x00D5002C, -2 }, { 0x00F4002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202500DA, -1 }, { 0x00000000, 0 },
+    { 0x01360125, 1 }, { 0x01550123, -1 }, { 0x0057004D, -1 }, { 0x016E003B, -1 },
+    { 0x01740121, -2 }, { 0x00000000, 0 }, { 0x20260166, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00F60142, 1 }, { 0x0134013E, 1 }, { 0x00F0005C, -2 },
+    { 0x0172013A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01700153, -1 }, { 0x005600F2, -2 },
+    { 0x012C0071, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D30176, -1 }, { 0x0054010B, -1 },
+    { 0x0147201A, -2 }, { 0x01662018, 1 }, { 0x2019003F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D013E, -1 }, { 0x201A00CB, 1 },
+    { 0x00520124, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201800E4, -3 }, { 0x0050013D, -1 }, { 0x002E00CC, 1 }, { 0x00000000, 0 },
+    { 0x0104004B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190170, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B00E3, -1 },
+    { 0x00000000, 0 }, { 0x0067006E, 1 }, { 0x017E005C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01250161, 1 },
+    { 0x00632019, 1 }, { 0x0144015F, 1 }, { 0x013E0079, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0123017A, 1 }, { 0x00280117, -1 }, { 0x00660113, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10126, 1 }, { 0x01762039, -1 },
+    { 0x00000000, 0 }, { 0x0118003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE013D, -1 },
+    { 0x00000000, 0 }, { 0x017600C0, -3 }, { 0x00D80057, -1 }, { 0x0154004F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0158014E, -1 }, { 0x00D900E3, -1 }, { 0x00000000, 0 }, { 0x0133006A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026011E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017200F2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059011D, -2 },
+    { 0x0170010B, -1 }, { 0x201E0051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005400C3, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00F6, -3 },
+    { 0x00000000, 0 }, { 0x0055014F, -1 }, { 0x005200DC, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B010F, -3 }, { 0x00000000, 0 }, { 0x004B2014, -1 }, { 0x005000F5, -1 },
+    { 0x00000000, 0 }, { 0x01070076, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190128, -2 }, { 0x00000000, 0 }, { 0x010B0175, 1 },
+    { 0x0141201D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460041, -3 },
+    { 0x015D002F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A0140, 1 }, { 0x00C300C5, 1 },
+    { 0x01040134, 5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670157, 1 },
+    { 0x00C100DE, 1 }, { 0x0121014B, 1 }, { 0x01590061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C2016A, -2 }, { 0x01000166, -2 }, { 0x00000000, 0 }, { 0x01760078, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x017A0177, 1 }, { 0x00410118, 1 }, { 0x01580106, -1 },
+    { 0x0079002E, -2 }, { 0x2025004A, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202600D6, -1 }, { 0x00000000, 0 }, { 0x00DA0127, 1 },
+    { 0x01370121, 1 }, { 0x00D40041, -1 }, { 0x0175011D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0135013A, 2 }, { 0x005900D5, -1 }, { 0x00560062, 2 }, { 0x01100056, -1 },
+    { 0x017000C3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700EE, 1 }, { 0x013000E0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D40172, -1 }, { 0x00502026, -3 }, { 0x00550107, -1 },
+    { 0x00CC201E, -1 }, { 0x010F00FB, 1 }, { 0x0150016A, -1 }, { 0x016C00F5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B00C7, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0126002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0153, -3 }, { 0x201900E0, -3 },
+    { 0x00000000, 0 }, { 0x01680127, 1 }, { 0x004E00C6, -1 }, { 0x002C0055, -1 },
+    { 0x01620041, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A016C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01470142, 1 }, { 0x01660140, 1 },
+    { 0x0049006C, 1 }, { 0x0141005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E016D, -1 }, { 0x0145015B, -1 },
+    { 0x010400EC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00480111, -1 }, { 0x00DE2026, -3 }, { 0x015A201E, -1 }, { 0x017E00FD, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20122, -1 }, { 0x0100011E, -1 }, { 0x00000000, 0 },
+    { 0x00DB003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C0013B, 1 }, { 0x00000000, 0 },
+    { 0x00DC00C6, -3 }, { 0x0136004D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0152, -1 },
+    { 0x01780148, -1 }, { 0x00DA00DF, -2 }, { 0x01720062, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01760161, -2 }, { 0x005C0100, 2 }, { 0x007B00FE, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250133, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016C2026, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00EF0029, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0066, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0052004C, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016A00C6, -3 }, { 0x00500065, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C010B, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CD00E9, -1 }, { 0x012A00E3, -1 },
+    { 0x016800DF, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0124, 1 }, { 0x00000000, 0 }, { 0x0104201D, -3 }, { 0x0123201B, 2 },
+    { 0x016600F8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2018013D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01260115, -1 }, { 0x01450113, -1 }, { 0x01640111, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B013C, 1 }, { 0x00C400C1, 1 }, { 0x00000000, 0 },
+    { 0x00C1004E, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004600E2, -1 },
+    { 0x00BF0067, 1 }, { 0x00C200DA, -2 }, { 0x010000D6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0047016E, -1 }, { 0x00C30166, -2 },
+    { 0x011D00ED, 1 }, { 0x00000000, 0 }, { 0x01580076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD010A, -1 }, { 0x01780100, -3 }, { 0x20260046, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB0123, -1 }, { 0x0119011F, -1 },
+    { 0x0157011B, -1 }, { 0x00F4003B, -1 }, { 0x01760119, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D9013C, 1 },
+    { 0x00000000, 0 }, { 0x0076005C, -1 }, { 0x00D30056, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260177, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005800EA, -1 }, { 0x00D1006F, -1 }, { 0x010F006B, 4 },
+    { 0x015000DA, -1 }, { 0x016C0065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590176, 1 }, { 0x00CD201A, -1 }, { 0x00560103, -2 }, { 0x00D5016E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00C3, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D014F, -3 }, { 0x201A00DC, -1 }, { 0x00000000, 0 },
+    { 0x012B0127, 3 }, { 0x004F00C2, -1 }, { 0x014A0125, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0168, -1 }, { 0x201800F5, -3 },
+    { 0x203A0166, -1 }, { 0x01290140, 3 }, { 0x002E00DD, -2 }, { 0x004A0068, 1 },
+    { 0x004D00DB, -1 }, { 0x0104005C, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002F0169, -1 }, { 0x004B00F4, -1 }, { 0x012400E6, -1 },
+    { 0x00C40079, -2 }, { 0x014300E4, -1 }, { 0x016200E2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0049010D, -1 },
+    { 0x011D201E, -1 }, { 0x014100FD, -1 }, { 0x015B201A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C3011E, -1 }, { 0x00000000, 0 }, { 0x00C000AB, -1 }, { 0x0177002C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00C2, -3 },
+    { 0x00DA004F, -1 }, { 0x01560047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2025201C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01350062, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D900F4, -1 }, { 0x017400EA, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026012F, -1 },
+    { 0x01560178, -2 }, { 0x00000000, 0 }, { 0x01720103, -1 }, { 0x00000000, 0 },
+    { 0x0055002F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005600BB, -1 },
+    { 0x0170011C, -1 }, { 0x012C003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014C00C4, -1 }, { 0x0168004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20182026, -3 }, { 0x201D0107, -3 },
+    { 0x016C014E, -1 }, { 0x00CE00E5, -1 }, { 0x00000000, 0 }, { 0x0128006C, 1 },
+    { 0x01660068, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0120, -1 },
+    { 0x00000000, 0 }, { 0x00720177, 1 }, { 0x00CC00FE, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190139, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0121, -3 },
+    { 0x004E011F, -1 }, { 0x00000000, 0 }, { 0x00E3002F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000046, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01040145, 1 }, { 0x002800E0, -1 }, { 0x00C300D6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40162, -2 }, { 0x00C100EF, -1 },
+    { 0x00000000, 0 }, { 0x01590072, 1 }, { 0x01780070, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D92025, -3 },
+    { 0x01000177, -2 }, { 0x011C0102, -1 }, { 0x011F0175, 2 }, { 0x013E0173, 1 },
+    { 0x0155201D, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410129, -1 }, { 0x00DC011F, -1 }, { 0x00000000, 0 },
+    { 0x0171002F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01180134, 3 }, { 0x01560130, 1 },
+    { 0x00000000, 0 }, { 0x0150004A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005900E6, -1 }, { 0x00560073, -2 }, { 0x017000D4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A0172, -1 },
+    { 0x00D6016A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016C0106, -1 }, { 0x201A004C, 1 },
+    { 0x00CB002A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B00D8, -1 }, { 0x00000000, 0 }, { 0x00EE0127, 3 },
+    { 0x016A011F, -1 }, { 0x20180065, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900F1, -1 }, { 0x00000000, 0 },
+    { 0x00CD0142, 1 }, { 0x012A013C, 1 }, { 0x002C0066, 1 }, { 0x004B0064, -1 },
+    { 0x01620052, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006E0161, 1 }, { 0x01470153, -1 }, { 0x01660151, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011E201A, -1 }, { 0x010400FD, -2 },
+    { 0x012300FB, 2 }, { 0x014200F9, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C4011A, 1 }, { 0x01020116, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C20133, -1 }, { 0x0100012F, -1 }, { 0x011F012D, 1 }, { 0x01760041, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20262018, -3 },
+    { 0x00000000, 0 }, { 0x00C0014C, -1 }, { 0x011D0146, 1 }, { 0x015800CF, 1 },
+    { 0x00D90064, -1 }, { 0x0155005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013A015D, 1 }, { 0x01780159, -1 },
+    { 0x00DA00F0, -1 }, { 0x01720073, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007B010F, -1 }, { 0x00F22026, -2 }, { 0x016E201E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540044, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007200E7, -1 }, { 0x00CF00E1, -1 }, { 0x00500076, 1 }, { 0x01290068, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C011C, -1 },
+    { 0x00540175, 1 }, { 0x00510102, -1 }, { 0x012A00F4, -1 }, { 0x016800F0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0128010D, -1 }, { 0x0147010B, -1 },
+    { 0x01660109, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2018014E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0136, 1 },
+    { 0x004A00C1, -1 }, { 0x00000000, 0 }, { 0x00C30046, 1 }, { 0x017D003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B014D, -1 }, { 0x00C400D2, -1 }, { 0x010200CE, 1 }, { 0x011E0059, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004600F3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30177, -2 }, { 0x00C00104, 1 },
+    { 0x011D00FE, 1 }, { 0x01562019, -1 }, { 0x017A00F8, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD011B, -1 }, { 0x01590113, -1 }, { 0x01780111, -1 }, { 0x0134002F, -1 },
+    { 0x20260057, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C00C9, 1 }, { 0x00590056, 1 },
+    { 0x00D800C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202500FC, -1 }, { 0x00000000, 0 }, { 0x00D9014D, -1 }, { 0x00D600DA, -1 },
+    { 0x0057006F, -2 }, { 0x00F8014B, 1 }, { 0x01300061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0053201A, -1 },
+    { 0x005800FB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D5017F, -1 }, { 0x012A2025, -1 }, { 0x014E0104, -1 }, { 0x0050002E, -3 },
+    { 0x006F002C, -2 }, { 0x201B0048, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00D4, -1 }, { 0x00000000, 0 }, { 0x20190061, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0108003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0160, -1 }, { 0x201A00ED, -1 }, { 0x00000000, 0 }, { 0x00CE013E, 1 },
+    { 0x00ED013C, 1 }, { 0x014700C3, -1 }, { 0x016600C1, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180106, -1 }, { 0x0050015F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0104006D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F017A, -2 }, { 0x00C2201C, -3 }, { 0x004B0105, -1 }, { 0x01002018, -3 },
+    { 0x014300F5, -1 }, { 0x016200F3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50116, 1 },
+    { 0x004600AB, -1 }, { 0x00DE002E, -3 }, { 0x00FD002C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00660135, 1 },
+    { 0x00C3012F, -1 }, { 0x004400C4, -1 }, { 0x00410051, -1 }, { 0x00DC0047, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10148, -1 }, { 0x00000000, 0 }, { 0x004200DD, -1 }, { 0x00DD00D3, -1 },
+    { 0x01560058, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015700E4, -1 },
+    { 0x017600E2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01390172, -1 }, { 0x01580170, -2 },
+    { 0x00D90105, -1 }, { 0x013600FF, -1 }, { 0x015500FD, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016C002E, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D200C4, -1 },
+    { 0x011000C0, -1 }, { 0x016A0047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570158, 1 }, { 0x005400E5, -1 },
+    { 0x00D000DD, -1 }, { 0x010E00D9, -1 }, { 0x012A0064, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0118, -2 }, { 0x010F0165, 1 },
+    { 0x00CE00F6, -1 }, { 0x012E0163, -1 }, { 0x01660079, 1 }, { 0x016C015F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00500117, -1 }, { 0x00CC010F, -1 }, { 0x01432026, -2 },
+    { 0x0069002F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019014A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016200AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C500CE, 1 }, { 0x00000000, 0 }, { 0x00460063, -1 }, { 0x01000057, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017D00DB, -1 }, { 0x00C00074, -1 },
+    { 0x011D006E, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FA201B, -1 }, { 0x00C10100, 1 }, { 0x0121016D, 2 },
+    { 0x01762013, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0119, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01580128, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D6004A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01560141, 1 }, { 0x013400D0, 1 }, { 0x0058006B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C016A, -2 }, { 0x00D80162, -1 },
+    { 0x017000E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570110, 1 }, { 0x016E00FE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D10121, -1 }, { 0x010F011D, 1 }, { 0x012E011B, -1 },
+    { 0x00CB003B, -1 }, { 0x016C0117, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201B00E9, -3 }, { 0x00000000, 0 }, { 0x00CF013A, 1 }, { 0x005000CF, -1 },
+    { 0x004D005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190102, -5 }, { 0x00000000, 0 }, { 0x00CD0153, -1 },
+    { 0x002F00EA, -3 }, { 0x002C0077, -2 }, { 0x004B0075, -1 }, { 0x004E00E8, -1 },
+    { 0x012A014D, -1 }, { 0x01430065, -1 }, { 0x01620063, -1 }, { 0x004F0174, -1 },
+    { 0x0066201E, -2 }, { 0x00C32018, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670131, 1 }, { 0x00C4012B, -1 },
+    { 0x00000000, 0 }, { 0x00DD0043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C20144, -1 }, { 0x00DE00CF, -1 }, { 0x00DB005C, 1 }, { 0x013E013C, 4 },
+    { 0x01760052, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011D0157, 1 }, { 0x00DC00E8, -1 }, { 0x0136006F, -1 },
+    { 0x0155006D, 1 }, { 0x0174006B, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0174, 1 }, { 0x00F4201E, -2 }, { 0x00DA0101, -1 },
+    { 0x0132201A, -2 }, { 0x01512018, -1 }, { 0x015600F9, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0122, -1 },
+    { 0x01540112, 1 }, { 0x00000000, 0 }, { 0x014E002C, -2 }, { 0x016D002A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D300C0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B201A, -3 },
+    { 0x00000000, 0 }, { 0x00580154, 1 }, { 0x005500E1, -1 }, { 0x00000000, 0 },
+    { 0x0169005C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0114, 1 }, { 0x012F015F, 1 }, { 0x007200F8, -1 },
+    { 0x00CF00F2, -1 }, { 0x01480077, -1 }, { 0x016A00E8, -1 }, { 0x2018002E, -3 },
+    { 0x201B00A1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014C0176, -1 },
+    { 0x00CD010B, -1 }, { 0x012A0105, -1 }, { 0x01680101, -1 }, { 0x004B002D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018015F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0147, 1 }, { 0x01260137, 1 },
+    { 0x010400C6, 2 }, { 0x00280061, -1 }, { 0x0066005D, 2 }, { 0x00C30057, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004800EB, -1 }, { 0x00000000, 0 }, { 0x00C10070, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00680175, -1 }, { 0x00460104, -3 }, { 0x010000F8, 1 }, { 0x01582011, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01780122, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C00DA, -2 }, { 0x00590067, -2 }, { 0x01320059, 1 },
+    { 0x015400CA, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01740154, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058010C, -1 },
+    { 0x00D40104, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00CC, 1 }, { 0x00000000, 0 },
+    { 0x00560125, 2 }, { 0x203A0057, -1 }, { 0x00000000, 0 }, { 0x0148002F, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00E5, -3 },
+    { 0x00000000, 0 }, { 0x0054013E, 1 }, { 0x20190072, -1 }, { 0x004E0058, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0171, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CE014F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20180117, -3 }, { 0x00500170, -1 }, { 0x0067201A, -1 },
+    { 0x002E00FF, -2 }, { 0x016400EB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0118, 1 }, { 0x01620104, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C000CD, 1 }, { 0x00000000, 0 }, { 0x01580050, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0064015F, 1 },
+    { 0x00C10159, -1 }, { 0x00DD00E4, -1 }, { 0x00DA0071, -1 }, { 0x01750067, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF0172, -1 }, { 0x00DE0170, -1 }, { 0x00F5201A, -2 }, { 0x011C016C, -1 },
+    { 0x013B016A, -1 }, { 0x015700F5, -1 }, { 0x017600F3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x202500C5, 1 }, { 0x00000000, 0 }, { 0x0174010C, -1 },
+    { 0x00000000, 0 }, { 0x00F2002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0137, 2 },
+    { 0x01340129, 1 }, { 0x005800C4, 1 }, { 0x00550051, -1 }, { 0x01720125, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590150, -1 }, { 0x01320142, 1 }, { 0x005600DD, 1 }, { 0x00CF0062, 1 },
+    { 0x0170013E, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0111015D, 1 }, { 0x005400F6, -1 }, { 0x00000000, 0 },
+    { 0x010B0077, 1 }, { 0x01490073, 1 }, { 0x01680071, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0145201E, -2 },
+    { 0x00CE0107, -1 }, { 0x0164201C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201800CF, -1 },
+    { 0x00500128, -1 }, { 0x01242039, -1 }, { 0x00000000, 0 }, { 0x004A0042, 1 },
+    { 0x00C6003A, -1 }, { 0x00000000, 0 }, { 0x2019015B, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C00D0, 1 }, { 0x00000000, 0 },
+    { 0x0102004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004900E7, -1 },
+    { 0x012200D9, -1 }, { 0x011F0066, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040167, -1 },
+    { 0x00470100, -1 }, { 0x006600FE, 3 }, { 0x00C300F8, 1 }, { 0x00DD2015, -1 },
+    { 0x01230165, 1 }, { 0x01420163, 1 }, { 0x017A0079, 1 }, { 0x00000000, 0 },
+    { 0x0121017E, 1 }, { 0x01572026, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0128, -1 }, { 0x00000000, 0 },
+    { 0x017600AB, -1 }, { 0x005C004A, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041014B, -1 },
+    { 0x01580139, 1 }, { 0x017400C4, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01560152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00732025, -1 }, { 0x00590108, -1 }, { 0x00D50100, -1 },
+    { 0x00EF201D, 1 }, { 0x012D2019, 1 }, { 0x0154016B, -1 }, { 0x017000F6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570121, -2 },
+    { 0x0076011F, -1 }, { 0x01300113, -1 }, { 0x0051003B, 6 }, { 0x016E010F, -1 },
+    { 0x201C0055, -1 }, { 0x00000000, 0 }, { 0x201D00E1, -3 }, { 0x00000000, 0 },
+    { 0x0055013A, 1 }, { 0x005200C7, -1 }, { 0x004F0054, -1 }, { 0x01660042, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E016D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00720151, -1 }, { 0x005000E0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190113, -3 }, { 0x00000000, 0 }, { 0x0051016C, -1 }, { 0x002F00FB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046002C, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004A012B, 1 }, { 0x0104011F, 2 }, { 0x0123011D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01020138, -1 }, { 0x00C100C9, 1 },
+    { 0x0061005C, -2 }, { 0x00DD0054, 1 }, { 0x011E00C3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046015D, -1 }, { 0x00C20155, -1 },
+    { 0x00BF00E2, -1 }, { 0x011C00DC, -1 }, { 0x013B00DA, -1 }, { 0x01570065, -1 },
+    { 0x01760063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440176, -1 },
+    { 0x00C0016E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202600C1, 1 }, { 0x00592039, -1 }, { 0x0156010A, -1 }, { 0x00000000, 0 },
+    { 0x00D4002C, -2 }, { 0x00F3002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01350125, 2 },
+    { 0x005900C0, -3 }, { 0x0056004D, -1 }, { 0x01100041, -1 }, { 0x01730121, 1 },
+    { 0x00000000, 0 }, { 0x20250166, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F50142, 1 }, { 0x016E00C7, -1 }, { 0x00EF005C, 3 }, { 0x014C0056, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005500F2, -1 }, { 0x00D100EA, -1 },
+    { 0x012E00E4, -1 }, { 0x014A006F, -1 }, { 0x016C00E0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D20176, -1 }, { 0x00720109, -1 }, { 0x00CF0103, -1 },
+    { 0x010D00FF, 1 }, { 0x01100172, -1 }, { 0x0127201C, -1 }, { 0x014E016E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900CB, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0143002E, -2 }, { 0x0162002C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C5004F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180170, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0158, 1 }, { 0x01260148, 1 }, { 0x00000000, 0 },
+    { 0x017D005C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0171, -1 }, { 0x004B016F, -1 },
+    { 0x006700FA, 2 }, { 0x012100EE, 1 }, { 0x0143015F, -1 }, { 0x0162015D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01410178, -2 },
+    { 0x00460115, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C00126, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260079, -2 }, { 0x00000000, 0 },
+    { 0x015600C2, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0176014C, -1 },
+    { 0x007B00E9, -1 }, { 0x015400DB, -2 }, { 0x00590078, -1 }, { 0x00780076, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025011E, -1 }, { 0x00000000, 0 },
+    { 0x00F8016D, 1 }, { 0x01360169, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0051, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012B0029, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00DD, -2 }, { 0x00000000, 0 },
+    { 0x00CF00BB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00F6, -3 }, { 0x00000000, 0 },
+    { 0x0054014F, -1 }, { 0x005100DC, -1 }, { 0x002F006B, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00520168, -2 }, { 0x012800E7, -1 }, { 0x014700E5, -1 },
+    { 0x016600E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180128, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0110, 1 },
+    { 0x014500FE, 1 }, { 0x017E2019, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B0127, 1 }, { 0x00E6011D, -1 }, { 0x01240119, -1 }, { 0x01430117, -1 },
+    { 0x01620115, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00490140, 1 }, { 0x00C200C5, 1 }, { 0x00C50138, -1 },
+    { 0x00DE0050, -1 }, { 0x010000C1, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C000DE, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1016A, -2 },
+    { 0x00DD00F5, -1 }, { 0x011E0164, -1 }, { 0x017800EB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01760104, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x202500D6, -1 }, { 0x00000000, 0 }, { 0x00D90127, 1 }, { 0x01170123, -1 },
+    { 0x00D30041, -1 }, { 0x0130003B, -1 }, { 0x0155011F, -1 }, { 0x0174011D, -2 },
+    { 0x20260162, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0134013A, 1 },
+    { 0x005800D5, -1 }, { 0x00550062, 1 }, { 0x015000C5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590161, -2 },
+    { 0x0170014F, -1 }, { 0x005600EE, 1 }, { 0x00720079, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D30172, -1 }, { 0x004F2026, -2 }, { 0x00540107, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D013A, -1 }, { 0x201A00C7, -1 }, { 0x00520120, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0144002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201B0153, -3 }, { 0x201800E0, -3 }, { 0x00500139, -1 },
+    { 0x0129012B, 2 }, { 0x002E00C8, 1 }, { 0x004D00C6, 1 }, { 0x01040047, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019016C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0048006C, 1 },
+    { 0x0067006A, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0125015D, 1 }, { 0x004900F8, -1 }, { 0x0144015B, 1 },
+    { 0x01000079, -2 }, { 0x011F0077, 2 }, { 0x013E0075, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040178, -2 }, { 0x00280113, -1 },
+    { 0x0066010F, -1 }, { 0x00DD2026, -3 }, { 0x0159201E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C10122, -1 }, { 0x00000000, 0 }, { 0x00DD00AD, -1 }, { 0x00DA003A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE0139, -1 }, { 0x00000000, 0 }, { 0x00DB00C6, -3 },
+    { 0x0154004B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC0152, -1 }, { 0x0158014A, 1 },
+    { 0x00D900DF, -2 }, { 0x003B0076, 1 }, { 0x017400D5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2026011A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590119, -1 }, { 0x01700107, -1 }, { 0x00000000, 0 },
+    { 0x00EE0029, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E0120, -1 }, { 0x201C0066, -1 },
+    { 0x00000000, 0 }, { 0x0168003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00F2, -3 }, { 0x00000000, 0 },
+    { 0x005200D8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B010B, -3 }, { 0x00000000, 0 },
+    { 0x004B2010, -1 }, { 0x00530164, -1 }, { 0x00CC00E9, -1 }, { 0x01260070, 1 },
+    { 0x0164006C, 1 }, { 0x016A0152, -1 }, { 0x00000000, 0 }, { 0x20190124, -2 },
+    { 0x00000000, 0 }, { 0x0122201B, -1 }, { 0x002F010C, -1 }, { 0x01412019, -1 },
+    { 0x00000000, 0 }, { 0x00670022, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B0121, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011F002F, 1 }, { 0x017C0029, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004A013C, 1 }, { 0x00C300C1, 1 }, { 0x00440056, -1 }, { 0x00C0004E, 1 },
+    { 0x01040130, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01020149, -1 }, { 0x00C100DA, -2 }, { 0x00000000, 0 },
+    { 0x00DD0065, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20166, -2 }, { 0x00BF00F3, -1 },
+    { 0x01000162, -2 }, { 0x01570076, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410114, 1 }, { 0x00DC010A, -1 }, { 0x01580102, 2 }, { 0x20250046, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x202600D2, -1 },
+    { 0x00000000, 0 }, { 0x00DA0123, -1 }, { 0x0137011D, 1 }, { 0x00000000, 0 },
+    { 0x00F3003B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0142, 2 }, { 0x013200C3, -1 },
+    { 0x0075005C, -2 }, { 0x00D20056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250177, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700EA, -2 }, { 0x00540077, 1 }, { 0x016E00D8, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580176, 1 },
+    { 0x00CC201A, -1 }, { 0x00550103, -1 }, { 0x00D4016E, -1 }, { 0x012E00F5, -1 },
+    { 0x01500166, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0136, 1 },
+    { 0x201B00C3, -4 }, { 0x014E017F, -1 }, { 0x016A010A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C014F, -3 }, { 0x201900DC, -2 }, { 0x00000000, 0 }, { 0x012A0127, 1 },
+    { 0x002F00C4, -3 }, { 0x002C0051, -1 }, { 0x004B004F, -1 }, { 0x004E00C2, -1 },
+    { 0x01680123, -1 }, { 0x201A0168, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01280140, 1 }, { 0x002D00DD, -1 }, { 0x00490068, 1 }, { 0x004C00DB, -1 },
+    { 0x0103005C, -2 }, { 0x01410058, 1 }, { 0x0147013E, 1 }, { 0x0166013C, 1 },
+    { 0x002E0169, -1 }, { 0x01260159, 1 }, { 0x00000000, 0 }, { 0x00C30079, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0048010D, -1 }, { 0x011C201E, -1 },
+    { 0x012100FF, 2 }, { 0x013B201C, -2 }, { 0x015A201A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2011E, -1 },
+    { 0x0100011A, 1 }, { 0x00000000, 0 }, { 0x0157002E, -3 }, { 0x0176002C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011D0131, 1 }, { 0x004100CC, 1 }, { 0x00DC00C2, -2 }, { 0x00D9004F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD014E, -1 }, { 0x01590146, 1 }, { 0x00BB00DD, -1 },
+    { 0x01340062, 1 }, { 0x015600D3, -1 }, { 0x01780144, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0176015D, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2025012F, -1 }, { 0x01740176, 1 },
+    { 0x012E2026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054002F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0062, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00520048, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016A00C2, -2 }, { 0x00500061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0107, -3 }, { 0x00000000, 0 },
+    { 0x00CD00E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0120, -1 }, { 0x00000000, 0 },
+    { 0x004A2025, -2 }, { 0x00E5201B, -1 }, { 0x01042019, -3 }, { 0x012800F8, -1 },
+    { 0x014700F6, -1 }, { 0x016600F4, -1 }, { 0x00000000, 0 }, { 0x20180139, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0121, 1 }, { 0x01260111, -1 },
+    { 0x0145010F, -1 }, { 0x00E2002F, 1 }, { 0x0164010D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0138, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00490151, -1 }, { 0x00C200D6, -1 }, { 0x00C50149, -1 }, { 0x00BF0063, -1 },
+    { 0x010000D2, -1 }, { 0x01790057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0047016A, -1 }, { 0x00C000EF, -1 }, { 0x00C30162, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D82025, -2 }, { 0x00DD0106, -1 },
+    { 0x0154201D, -1 }, { 0x0173201B, -1 }, { 0x017800FC, -1 }, { 0x20260042, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DB011F, -1 }, { 0x01570117, -1 }, { 0x00590041, -3 }, { 0x0170002F, -2 },
+    { 0x01760115, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D600C5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20260173, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800E6, -1 },
+    { 0x00550073, -1 }, { 0x00D1006B, 1 }, { 0x010F0067, 1 }, { 0x012E0065, -1 },
+    { 0x016C0061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0051201E, -2 },
+    { 0x0070201C, -1 }, { 0x00D5016A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00BF, -3 },
+    { 0x01662025, -3 }, { 0x2019004C, -2 }, { 0x00000000, 0 }, { 0x00CA002A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D014B, -1 },
+    { 0x201A00D8, -1 }, { 0x00000000, 0 }, { 0x00ED0127, 1 }, { 0x014A0121, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A0162, -1 }, { 0x00000000, 0 }, { 0x0050014A, -1 }, { 0x00CC0142, 1 },
+    { 0x002E00D9, -1 }, { 0x01040058, 2 }, { 0x0129013C, 3 }, { 0x016400C5, -3 },
+    { 0x00000000, 0 }, { 0x2019017D, -1 }, { 0x00000000, 0 }, { 0x002F0165, -1 },
+    { 0x006D0161, 1 }, { 0x004B00F0, -1 }, { 0x012400E2, -1 }, { 0x014300E0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00490109, -1 }, { 0x00FE201C, -1 }, { 0x011D201A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C3011A, 1 },
+    { 0x00000000, 0 }, { 0x0158002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10133, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01560043, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20252018, -3 }, { 0x00000000, 0 },
+    { 0x00DE014A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C006C, 1 },
+    { 0x007B006A, 3 }, { 0x0154005C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D900F0, -1 },
+    { 0x013600EA, -1 }, { 0x015500E8, -1 }, { 0x017400E6, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01560174, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005400D0, 1 }, { 0x010E00C4, -1 },
+    { 0x0051005D, 7 }, { 0x014C00C0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0103, -3 }, { 0x00000000, 0 }, { 0x00CE00E1, -1 },
+    { 0x00000000, 0 }, { 0x01280068, 1 }, { 0x01660064, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B011C, -1 }, { 0x012C0167, -1 },
+    { 0x00500102, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0049203A, -1 }, { 0x002F011D, -3 }, { 0x004E011B, -1 }, { 0x00000000, 0 },
+    { 0x01210027, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A00C3, -1 },
+    { 0x00000000, 0 }, { 0x00C20046, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040141, 1 },
+    { 0x004700DA, -1 }, { 0x00C300D2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0159006E, 1 },
+    { 0x0178006C, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20177, -2 }, { 0x00DE0102, -2 }, { 0x011F0171, 2 },
+    { 0x013E016F, 1 }, { 0x01552019, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC011B, -1 },
+    { 0x20250057, -3 }, { 0x00000000, 0 }, { 0x0079003B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0156012C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B0153, -1 }, { 0x005900E2, -1 }, { 0x0056006F, -2 },
+    { 0x00D500DA, -1 }, { 0x01540145, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005A016E, -1 }, { 0x00D60166, -1 }, { 0x016E00E9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D4017F, -1 },
+    { 0x016C0102, -2 }, { 0x201A0048, 1 }, { 0x004F002E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0147, 1 }, { 0x201B00D4, -1 },
+    { 0x00000000, 0 }, { 0x00CF0125, 1 }, { 0x016A011B, -1 }, { 0x002E0049, 1 },
+    { 0x20180061, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0160, -1 },
+    { 0x201900ED, -1 }, { 0x00000000, 0 }, { 0x00CD013E, 1 }, { 0x002F00D5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006E015D, 1 }, { 0x01280151, -1 },
+    { 0x0147014F, -1 }, { 0x00680077, -1 }, { 0x0166014D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C1201C, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40116, 1 }, { 0x01020112, 1 },
+    { 0x00DD002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460137, 1 }, { 0x00C2012F, -1 },
+    { 0x0100012B, -1 }, { 0x00DB0047, -1 }, { 0x011F0129, 1 }, { 0x013E0127, 4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00148, -1 },
+    { 0x00000000, 0 }, { 0x004100DD, -2 }, { 0x00DC00D3, -1 }, { 0x0117005C, -2 },
+    { 0x015800CB, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD015F, -2 }, { 0x00592013, -1 }, { 0x01590157, 1 }, { 0x0172006F, -1 },
+    { 0x01780155, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B010B, -1 }, { 0x0130201E, -1 },
+    { 0x014F201C, -1 }, { 0x015400FD, -1 }, { 0x016E201A, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0073, -3 }, { 0x00000000, 0 }, { 0x00D100C4, -1 }, { 0x00520059, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019201E, -6 },
+    { 0x201E00FF, -2 }, { 0x00560158, 1 }, { 0x007200E3, -1 }, { 0x016A00D3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0118, -1 }, { 0x004C201D, -1 }, { 0x00CD00F6, -1 },
+    { 0x012A00F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01280109, -1 }, { 0x01470107, -1 }, { 0x01660105, -1 }, { 0x0068002F, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2018014A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0132, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0149, -1 }, { 0x00C400CE, 1 },
+    { 0x010200CA, 1 }, { 0x011E0055, -1 }, { 0x01620137, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004600EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F9201B, -1 }, { 0x00C00100, 1 }, { 0x011D00FA, 2 }, { 0x01562015, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420121, -1 }, { 0x00DD0117, -1 },
+    { 0x0159010F, -1 }, { 0x0178010D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C00C5, 2 }, { 0x00590052, 1 }, { 0x00D5004A, -1 }, { 0x01320044, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057006B, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010F0078, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560110, 1 },
+    { 0x01100104, -1 }, { 0x014E0100, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0128203A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CA003B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D015C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00CE013A, 1 }, { 0x00000000, 0 }, { 0x004C005C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180102, -4 }, { 0x0050015B, -1 }, { 0x00CC0153, -1 }, { 0x00000000, 0 },
+    { 0x00690073, 1 }, { 0x01040069, -1 }, { 0x01230067, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C22018, -3 },
+    { 0x004B0101, -1 }, { 0x012400F3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C50112, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C3012B, -1 }, { 0x004400C0, -1 },
+    { 0x0041004D, 1 }, { 0x00DC0043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10144, -1 },
+    { 0x004200D9, -1 }, { 0x00DA005C, 1 }, { 0x01560054, -2 }, { 0x017800C5, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB00E8, -1 }, { 0x015700E0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0139016E, -1 }, { 0x00772026, -2 }, { 0x00D90101, -1 }, { 0x00F3201E, -2 },
+    { 0x00F800FF, 1 }, { 0x013600FB, -1 }, { 0x0158016C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0074003A, -1 }, { 0x012E002E, -1 }, { 0x014D002C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0132012D, 1 }, { 0x00D200C0, -1 }, { 0x016A0043, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570154, 1 }, { 0x005400E1, -1 }, { 0x00D000D9, -1 }, { 0x0168005C, 1 },
+    { 0x016E0142, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0114, -2 }, { 0x002E201B, -3 }, { 0x005200FA, -1 }, { 0x00CE00F2, -1 },
+    { 0x010F0161, 1 }, { 0x014A00EA, -1 }, { 0x016C015B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00500113, -1 },
+    { 0x00CC010B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190146, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012400AB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500CA, 1 },
+    { 0x00C20057, -4 }, { 0x012200C4, -1 }, { 0x00000000, 0 }, { 0x20150178, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040152, -1 }, { 0x006600E9, -1 },
+    { 0x012000DD, -1 }, { 0x00630076, 1 }, { 0x00C00070, -1 }, { 0x011D006A, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670175, 2 },
+    { 0x01210169, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0115, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410136, 1 }, { 0x01580124, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0156013D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01500057, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005C0166, -2 }, { 0x005900F3, -1 }, { 0x007800F1, 1 }, { 0x00F10076, -1 },
+    { 0x01540156, 1 }, { 0x017000E1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012B201D, 1 }, { 0x0057010C, -1 }, { 0x00D30104, -1 },
+    { 0x013000FE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00CC, -2 }, { 0x00000000, 0 }, { 0x00550125, 1 },
+    { 0x00D1011D, -1 }, { 0x012E0117, -1 }, { 0x0147002F, -2 }, { 0x016C0113, -1 },
+    { 0x201A0059, -2 }, { 0x201E0158, 1 }, { 0x201B00E5, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005000CB, -1 }, { 0x004D0058, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900FE, -1 },
+    { 0x00000000, 0 }, { 0x00CD014F, -1 }, { 0x002F00E6, -3 }, { 0x004B0071, -1 },
+    { 0x004E00E4, -1 }, { 0x00E60067, -1 }, { 0x01240063, -1 }, { 0x01430061, -1 },
+    { 0x00000000, 0 }, { 0x004F0170, -1 }, { 0x0047201C, -1 }, { 0x004C00FD, -1 },
+    { 0x0066201A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01640177, 1 },
+    { 0x0104010A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011D0022, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0067012D, 1 }, { 0x01020123, 1 }, { 0x01210121, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013E0138, 2 }, { 0x00DE00CB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00159, -1 }, { 0x00000000, 0 },
+    { 0x004100EE, -1 }, { 0x00D90071, -1 }, { 0x00DC00E4, -1 }, { 0x0136006B, 1 },
+    { 0x015800DC, -2 }, { 0x01740067, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F4201A, -2 }, { 0x01780166, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005C011E, -1 }, { 0x0154010E, 1 }, { 0x005900AB, -1 },
+    { 0x0110002C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700C4, -4 }, { 0x014C0041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580150, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00CE0062, 1 }, { 0x012B005C, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0110, 1 },
+    { 0x00F1015F, 1 }, { 0x007200F4, -1 }, { 0x012C00E8, -1 }, { 0x012F015B, 1 },
+    { 0x01480073, 1 }, { 0x016A00E4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010E0176, -1 }, { 0x014C0172, -1 }, { 0x00CD0107, -1 },
+    { 0x012A0101, -1 }, { 0x014900FF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2018015B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0143, 1 }, { 0x00000000, 0 }, { 0x010400C2, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004800E7, -1 }, { 0x010200DB, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460100, -3 },
+    { 0x00C200F8, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017D0178, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0178011E, -1 }, { 0x00000000, 0 }, { 0x015600AD, -1 },
+    { 0x005B004A, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760137, 2 }, { 0x005C00D6, -1 },
+    { 0x015400C6, 2 }, { 0x00590063, -1 }, { 0x01700051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01740150, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00722025, -3 }, { 0x00580108, -1 }, { 0x00D40100, -1 }, { 0x00EE201D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E00C8, 1 }, { 0x00560121, -2 }, { 0x201B0055, -1 },
+    { 0x00000000, 0 }, { 0x0050003B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00E1, -3 }, { 0x00000000, 0 }, { 0x0054013A, 1 },
+    { 0x2019006E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D016D, -1 }, { 0x201A00FA, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180113, -3 },
+    { 0x00000000, 0 }, { 0x0050016C, -1 }, { 0x002E00FB, -1 }, { 0x012600EB, -1 },
+    { 0x01230078, 1 }, { 0x01420076, 2 }, { 0x014500E9, -1 }, { 0x016400E7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01270177, -1 }, { 0x002C0114, 1 },
+    { 0x01430102, -1 }, { 0x01460175, -1 }, { 0x01620100, -3 }, { 0x017C201D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50123, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00660142, 3 }, { 0x00C000C9, 1 }, { 0x00000000, 0 },
+    { 0x0158004C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0064015B, 1 }, { 0x00C10155, -1 }, { 0x00DD00E0, -1 },
+    { 0x01370067, 1 }, { 0x017800D6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF016E, -1 }, { 0x0079201E, -2 },
+    { 0x00DE016C, -1 }, { 0x011C0168, -1 }, { 0x013B0166, -1 }, { 0x015700F1, 1 },
+    { 0x015A0164, -1 }, { 0x017600EF, 2 }, { 0x00000000, 0 }, { 0x202500C1, 1 },
+    { 0x00582039, -1 }, { 0x0136010C, -1 }, { 0x01740108, -1 }, { 0x00D3002C, -2 },
+    { 0x00F2002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01340125, 1 }, { 0x005800C0, 1 },
+    { 0x01530123, -1 }, { 0x016C003B, -1 }, { 0x01720121, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059014C, -1 }, { 0x00F40142, 1 },
+    { 0x0132013E, 1 }, { 0x00720064, -1 }, { 0x00EE005C, 3 }, { 0x0170013A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016E0153, -1 }, { 0x005400F2, -1 }, { 0x012A0071, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0125, -1 },
+    { 0x00000000, 0 }, { 0x0145201A, -2 }, { 0x00CE0103, -1 }, { 0x01642018, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201800CB, -1 }, { 0x00500124, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0161002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190157, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C00CC, 1 }, { 0x00000000, 0 }, { 0x00C4004F, -1 }, { 0x0102004B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004900E3, -1 }, { 0x00C500DB, -2 }, { 0x017C005C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01040163, -1 }, { 0x002800FE, 2 }, { 0x00DD2011, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0121017A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE0124, -1 }, { 0x01742039, -1 }, { 0x00000000, 0 }, { 0x005C0046, 1 },
+    { 0x0116003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410147, 1 }, { 0x20250079, -2 }, { 0x013600C4, 1 },
+    { 0x00D60057, -1 }, { 0x017400C0, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0156014E, -1 }, { 0x00000000, 0 },
+    { 0x013400DD, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005C0177, -2 },
+    { 0x00590104, -3 }, { 0x00EF2019, 1 }, { 0x017000F2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0057011D, -2 }, { 0x0130010F, -1 }, { 0x016E010B, -1 },
+    { 0x201C0051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00DD, -1 }, { 0x201A006A, 3 }, { 0x005200C3, 2 },
+    { 0x00CE00BB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0169, -1 }, { 0x201B00F6, -3 }, { 0x00000000, 0 }, { 0x0072014D, -1 },
+    { 0x005000DC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019010F, -3 }, { 0x00000000, 0 },
+    { 0x00510168, -1 }, { 0x004E00F5, -1 }, { 0x00000000, 0 }, { 0x01240074, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01090175, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A0127, 1 },
+    { 0x00000000, 0 }, { 0x00440041, -1 }, { 0x015B002F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00480140, 1 }, { 0x00C100C5, 1 }, { 0x00C40138, -1 }, { 0x00DD0050, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011F014B, 1 }, { 0x00DE00DC, -1 }, { 0x013E0149, 2 },
+    { 0x01570061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00440172, -1 }, { 0x00C0016A, -2 }, { 0x004100FF, -2 },
+    { 0x00DC00F5, -1 }, { 0x01740078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01512025, -2 },
+    { 0x01560106, -1 }, { 0x00000000, 0 }, { 0x0077002E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0173011D, 1 }, { 0x00000000, 0 }, { 0x00D20041, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20250162, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700D5, -1 },
+    { 0x00540062, 1 }, { 0x010E0056, -1 }, { 0x016E00C3, -2 }, { 0x00000000, 0 },
+    { 0x203A2025, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D100E6, -1 }, { 0x00710079, 2 }, { 0x012E00E0, -1 }, { 0x014A006B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0121, 1 }, { 0x00D20172, -1 },
+    { 0x004E2026, -2 }, { 0x00720105, -1 }, { 0x0110016E, -1 }, { 0x01272018, -1 },
+    { 0x014E016A, -1 }, { 0x016A00F5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201900C7, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0124002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660127, 1 },
+    { 0x00000000, 0 }, { 0x00C5004B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2018016C, -1 }, { 0x00000000, 0 }, { 0x002E0154, 1 },
+    { 0x01260144, 1 }, { 0x010400D3, -1 }, { 0x01450142, 1 }, { 0x01640140, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C016D, -1 }, { 0x004800F8, -1 }, { 0x004B016B, -1 }, { 0x010200EC, -1 },
+    { 0x0143015B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01220176, -1 }, { 0x00460111, -1 }, { 0x00DC2026, -3 },
+    { 0x01410174, -2 }, { 0x017C00FD, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00122, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D9003A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01590131, 1 }, { 0x20260075, -1 }, { 0x00DA00C6, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DB0152, -1 }, { 0x007B00E5, -1 }, { 0x00D800DF, -1 },
+    { 0x003A0076, 1 }, { 0x00780072, 1 }, { 0x01700062, 1 }, { 0x01760148, -1 },
+    { 0x00000000, 0 }, { 0x2025011A, 1 }, { 0x0074201D, 1 }, { 0x00F80169, 1 },
+    { 0x01740161, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580119, -1 }, { 0x016A2026, -3 }, { 0x201D004D, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E00D9, -1 }, { 0x201B0066, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0050004C, -1 }, { 0x0167003A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00F2, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002F0067, -3 }, { 0x004E0065, -1 }, { 0x016800C6, -3 }, { 0x00000000, 0 },
+    { 0x201D017E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520164, -2 },
+    { 0x012800E3, -1 }, { 0x014700E1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180124, -1 }, { 0x00000000, 0 },
+    { 0x0102201D, -3 }, { 0x002E010C, -1 }, { 0x0121201B, 2 }, { 0x012600FC, 1 },
+    { 0x016400F8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01240115, -1 }, { 0x01430113, -1 },
+    { 0x01620111, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0049013C, 1 },
+    { 0x00C200C1, 1 }, { 0x00000000, 0 }, { 0x00DE004C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00660153, -1 }, { 0x00C000DA, -2 }, { 0x00000000, 0 }, { 0x00DC0065, -1 },
+};
+
 static const EpdFontData bookerly_16_bolditalic = {
     bookerly_16_bolditalicBitmaps,
     bookerly_16_bolditalicGlyphs,
@@ -6445,4 +14653,8 @@ static const EpdFontData bookerly_16_bolditalic = {
     36,
     -9,
     true,
+    nullptr,
+    &bookerly_16_bolditalicMetrics,
+    bookerly_16_bolditalicKernPairs,
+    32768,
 };
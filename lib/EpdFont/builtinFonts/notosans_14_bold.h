@@ -3,7 +3,7 @@
  * name: notosans_14_bold
  * size: 14
  * mode: 2-bit
- * Command used: fontconvert.py notosans_14_bold 14 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit
+ * Command used: fontconvert.py notosans_14_bold 14 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit --kern-manifest font-manifest.txt
  */
 #pragma once
 #include "EpdFontData.h"
@@ -5200,6 +5200,2070 @@ static const EpdUnicodeInterval notosans_14_boldIntervals[] = {
     { 0xFFFD, 0xFFFD, 0x36C },
 };
 
+static const EpdFontMetrics notosans_14_boldMetrics = {
+    16, 49, 8,
+    -17, 48, 32, -9,
+    {
+        8, 8, 14, 19, 17, 26, 22, 8, 10, 10, 16, 17, 8, 9, 8, 12,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 8, 8, 17, 17, 17, 14,
+        26, 20, 19, 19, 21, 16, 16, 21, 22, 11, 10, 19, 16, 28, 24, 23,
+        18, 23, 19, 16, 17, 22, 19, 28, 20, 18, 17, 10, 12, 10, 17, 12,
+        11, 17, 18, 15, 18, 17, 11, 18, 19, 9, 9, 18, 9, 28, 19, 18,
+        18, 18, 13, 15, 13, 19, 17, 25, 17, 17, 14, 12, 16, 12, 17,
+    },
+};
+
+static const EpdKernPair notosans_14_boldKernPairs[8192] = {
+    { 0x00D600C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016200FF, -1 }, { 0x00C10166, -2 }, { 0x015900E9, -1 }, { 0x017800E7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016600BB, -1 },
+    { 0x00C50122, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760100, -2 },
+    { 0x0059016F, -1 }, { 0x0059002C, -2 }, { 0x20180100, -2 }, { 0x00000000, 0 },
+    { 0x016400D4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0155011B, -1 }, { 0x01740119, -1 }, { 0x00540115, -2 }, { 0x00000000, 0 },
+    { 0x0046201E, -2 }, { 0x00000000, 0 }, { 0x013D014C, -1 }, { 0x00000000, 0 },
+    { 0x017800D5, -1 }, { 0x00000000, 0 }, { 0x015000C1, -1 }, { 0x010C0122, -1 },
+    { 0x201A00D5, -1 }, { 0x00000000, 0 }, { 0x01410108, -1 }, { 0x0079201D, 1 },
+    { 0x00000000, 0 }, { 0x013800F2, -1 }, { 0x013B0022, -2 }, { 0x005600EA, -1 },
+    { 0x00000000, 0 }, { 0x002E00D6, -1 }, { 0x016400C2, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01550109, -1 }, { 0x01740107, -1 }, { 0x00000000, 0 },
+    { 0x00540103, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x017800C3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C0201D, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013800E0, -1 }, { 0x0059014B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00720063, -1 }, { 0x00000000, 0 },
+    { 0x01040043, -1 }, { 0x00000000, 0 }, { 0x00D4201E, -1 }, { 0x00F800FD, -1 },
+    { 0x017400F5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C00DD, -2 }, { 0x00C700D3, -1 }, { 0x00DD00BB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01040174, -1 }, { 0x0159201A, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410027, -2 }, { 0x015500E5, -1 }, { 0x00F50078, -1 }, { 0x017400E3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1011E, -1 }, { 0x0102004A, 1 },
+    { 0x00000000, 0 }, { 0x0175002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01660073, -2 }, { 0x014100D2, -1 }, { 0x00270071, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0162201E, -2 }, { 0x00000000, 0 }, { 0x01040162, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013600D5, -1 }, { 0x20190144, -1 },
+    { 0x00D000C5, -1 }, { 0x0108011E, -1 }, { 0x010E00C1, -1 }, { 0x00000000, 0 },
+    { 0x00C1010C, -1 }, { 0x00000000, 0 }, { 0x201D0100, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660061, -2 },
+    { 0x00000000, 0 }, { 0x0046005D, 1 }, { 0x01000051, -1 }, { 0x00590115, -1 },
+    { 0x00780113, -1 }, { 0x00000000, 0 }, { 0x006F00FD, -1 }, { 0x01040150, -1 },
+    { 0x0164007A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005400BB, -1 }, { 0x00000000, 0 }, { 0x0108010C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0166004F, -1 }, { 0x00000000, 0 }, { 0x00C20043, -1 }, { 0x01742026, -1 },
+    { 0x00D0201A, -1 }, { 0x00590103, -1 }, { 0x20150164, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013F00C7, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00700177, -1 },
+    { 0x00C5201D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0073, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20174, -1 }, { 0x00D9201E, -1 },
+    { 0x013E0029, 4 }, { 0x201E0168, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410122, -1 }, { 0x00C0004A, 1 }, { 0x00000000, 0 }, { 0x00D30102, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E60077, -1 },
+    { 0x00C100D6, -1 }, { 0x0162006F, -2 }, { 0x00DD0061, -1 }, { 0x00000000, 0 },
+    { 0x201A0057, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C20162, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01190076, -1 },
+    { 0x01760070, -1 }, { 0x20180070, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FE0177, -1 }, { 0x00000000, 0 }, { 0x201C016F, -1 },
+    { 0x005700F8, -1 }, { 0x201900FC, -1 }, { 0x00000000, 0 }, { 0x010800D6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD004F, -1 },
+    { 0x00000000, 0 }, { 0x0077003F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20150, -1 }, { 0x0100014C, -1 }, { 0x00BF00DD, -1 },
+    { 0x013B00D5, -1 }, { 0x00D500C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010A00AB, -1 }, { 0x01040108, -1 }, { 0x01640175, -1 }, { 0x00220100, -2 },
+    { 0x0044002E, -1 }, { 0x00000000, 0 }, { 0x005700E6, -1 }, { 0x00540073, -2 },
+    { 0x201900EA, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201A0176, -2 }, { 0x0050201E, -4 }, { 0x01500162, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004300D3, -1 }, { 0x00000000, 0 }, { 0x005900BB, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C12019, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C014B, -1 }, { 0x01740065, -1 },
+    { 0x00000000, 0 }, { 0x00540061, -2 }, { 0x0162017C, -1 }, { 0x00C70043, -1 },
+    { 0x00000000, 0 }, { 0x00D5201A, -1 }, { 0x00000000, 0 }, { 0x201A0164, -2 },
+    { 0x20390162, -1 }, { 0x00000000, 0 }, { 0x01660138, -1 }, { 0x00000000, 0 },
+    { 0x01410054, -1 }, { 0x00000000, 0 }, { 0x201E0120, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D2002E, -1 }, { 0x00000000, 0 }, { 0x01640151, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700C2, -1 }, { 0x0054004F, -1 }, { 0x201900C6, -2 },
+    { 0x00DE201E, -4 }, { 0x00000000, 0 }, { 0x01780152, -1 }, { 0x00000000, 0 },
+    { 0x0058014E, -1 }, { 0x201A0152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C5004A, 1 }, { 0x0176016B, -1 },
+    { 0x00D80102, -1 }, { 0x2018016B, -1 }, { 0x00000000, 0 }, { 0x007200F2, -1 },
+    { 0x00EB0077, -1 }, { 0x010400D2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01740041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C016C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0070, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20108, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01130079, -1 },
+    { 0x007200E0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C30051, -1 }, { 0x00000000, 0 }, { 0x016C201E, -1 }, { 0x201C0115, -2 },
+    { 0x00D00166, -1 }, { 0x010E0162, -1 }, { 0x00C70150, -1 }, { 0x01620146, -1 },
+    { 0x00C400DD, -2 }, { 0x00DD0138, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660102, -2 }, { 0x0041201D, -2 },
+    { 0x00270100, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590073, -1 }, { 0x00780071, -1 }, { 0x00000000, 0 }, { 0x010A0051, -1 },
+    { 0x0164011B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0055201E, -1 },
+    { 0x201C0103, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010200C7, -1 }, { 0x00000000, 0 }, { 0x0178011C, -1 },
+    { 0x00000000, 0 }, { 0x201A011C, -1 }, { 0x00000000, 0 }, { 0x004F0102, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00620077, -1 },
+    { 0x201E00D8, -1 }, { 0x00000000, 0 }, { 0x00590061, -1 }, { 0x00000000, 0 },
+    { 0x01640109, -2 }, { 0x00000000, 0 }, { 0x00DA201A, -1 }, { 0x00000000, 0 },
+    { 0x01360152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01620122, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0178010A, -1 }, { 0x00000000, 0 }, { 0x00580106, -1 }, { 0x201A010A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C200D2, -1 },
+    { 0x00000000, 0 }, { 0x013B0057, -1 }, { 0x01760123, -1 }, { 0x0059004F, -1 },
+    { 0x20180123, -1 }, { 0x00000000, 0 }, { 0x00E800FF, -1 }, { 0x01670027, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540138, -1 }, { 0x005100C5, -1 }, { 0x004B0122, -1 }, { 0x00CA004A, 2 },
+    { 0x00000000, 0 }, { 0x00DD0102, -2 }, { 0x017800F8, -1 }, { 0x201D016B, -1 },
+    { 0x00000000, 0 }, { 0x00F00077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01380115, -1 }, { 0x01570113, -1 },
+    { 0x0056010D, -1 }, { 0x0168201A, -1 }, { 0x01760111, -1 }, { 0x016400E5, -2 },
+    { 0x00C3014C, -1 }, { 0x20180111, -2 }, { 0x00000000, 0 }, { 0x00220070, -1 },
+    { 0x00D600C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C70108, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10022, -2 },
+    { 0x015900E8, -1 }, { 0x017800E6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004C0059, -1 }, { 0x013B0176, -1 }, { 0x00430043, -1 },
+    { 0x01570101, -1 }, { 0x0051201A, -1 }, { 0x00D50166, -1 }, { 0x010A014C, -1 },
+    { 0x00000000, 0 }, { 0x016400D3, -1 }, { 0x00000000, 0 }, { 0x00C000C7, -1 },
+    { 0x00000000, 0 }, { 0x0136011C, -1 }, { 0x014F0177, -1 }, { 0x014C0104, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x017800D4, -1 }, { 0x00000000, 0 }, { 0x201A00D4, -1 }, { 0x015000C0, -1 },
+    { 0x0164203A, -1 }, { 0x00000000, 0 }, { 0x004C0047, -1 }, { 0x00000000, 0 },
+    { 0x013B0164, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005600E9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E00D5, -1 }, { 0x01040054, -2 },
+    { 0x013F0120, -1 }, { 0x016400C1, -2 }, { 0x0041004A, 1 }, { 0x0136010A, -1 },
+    { 0x00540102, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017800C2, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010F003F, 4 }, { 0x004C0178, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013B0152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DC002E, -1 },
+    { 0x015500F6, -1 }, { 0x017400F4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C00DC, -1 }, { 0x00C700D2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0123, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C0166, -1 }, { 0x00000000, 0 }, { 0x00430150, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590138, -1 }, { 0x005600C5, -1 }, { 0x00C72039, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01592019, 1 }, { 0x0022016B, -1 },
+    { 0x00000000, 0 }, { 0x015500E4, -1 }, { 0x00570151, -1 }, { 0x00F50077, -1 },
+    { 0x017400E2, -1 }, { 0x20190155, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0111, -2 }, { 0x015300FD, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660072, -1 }, { 0x00000000, 0 },
+    { 0x00270070, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0116004A, 2 },
+    { 0x00000000, 0 }, { 0x016A002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013600D4, -1 }, { 0x201C0073, -1 },
+    { 0x00000000, 0 }, { 0x00D000C4, -1 }, { 0x010E00C0, -1 }, { 0x00000000, 0 },
+    { 0x0176201E, -2 }, { 0x00000000, 0 }, { 0x0056201A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C500C7, -1 }, { 0x00C20054, -2 }, { 0x013B011C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0072002C, -5 }, { 0x00000000, 0 },
+    { 0x01640079, -1 }, { 0x013F00D8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0178007A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010F013A, 1 }, { 0x010C00C7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013B010A, -1 },
+    { 0x00000000, 0 }, { 0x00590102, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01640067, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057011B, -1 }, { 0x2019011F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0072, -1 }, { 0x00000000, 0 }, { 0x01500054, -1 },
+    { 0x00000000, 0 }, { 0x004C011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00430108, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00220123, -1 }, { 0x00000000, 0 }, { 0x00570109, -1 },
+    { 0x00F200FF, -1 }, { 0x00510166, -1 }, { 0x2019010D, -2 }, { 0x00000000, 0 },
+    { 0x00E60076, -1 }, { 0x00C100D5, -1 }, { 0x0162006E, -1 }, { 0x00000000, 0 },
+    { 0x201A0056, -2 }, { 0x20390054, -1 }, { 0x00EA0175, -1 }, { 0x004C010C, -1 },
+    { 0x0027016B, -1 }, { 0x0166016D, -1 }, { 0x00000000, 0 }, { 0x01570071, -1 },
+    { 0x0176006F, -1 }, { 0x2018006F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0057, -2 }, { 0x01640043, -1 }, { 0x00220111, -2 }, { 0x0172201A, -1 },
+    { 0x00D60162, -1 }, { 0x201900FB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010800D5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0167201D, 1 }, { 0x00000000, 0 }, { 0x0166015B, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013B00D4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D500C4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FF2026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700E5, -1 }, { 0x201900E9, -2 },
+    { 0x00540072, -1 }, { 0x00000000, 0 }, { 0x01020120, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0077002C, -1 },
+    { 0x00000000, 0 }, { 0x012B007D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004300D2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00720115, -1 }, { 0x002E0176, -2 }, { 0x01640162, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01740064, -1 },
+    { 0x00000000, 0 }, { 0x00D00058, -1 }, { 0x010E0054, -1 }, { 0x00432039, -1 },
+    { 0x00000000, 0 }, { 0x00DD016D, -1 }, { 0x00000000, 0 }, { 0x01590022, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C00D6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0176017C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00720103, -1 }, { 0x002E0164, -2 },
+    { 0x01640150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0138, -1 }, { 0x005700C1, -1 }, { 0x201900C5, -2 }, { 0x00000000, 0 },
+    { 0x01620169, -1 }, { 0x00000000, 0 }, { 0x00DD015B, -1 }, { 0x01590153, -1 },
+    { 0x01620026, -1 }, { 0x01780151, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00270123, -1 }, { 0x00000000, 0 },
+    { 0x00762026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0152, -1 }, { 0x00EB0076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004100C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014C002C, -1 }, { 0x01632019, 1 }, { 0x01620157, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D006F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01660113, -2 }, { 0x00000000, 0 }, { 0x00270111, -2 },
+    { 0x0177201A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01130078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C00120, -1 }, { 0x00000000, 0 }, { 0x01170177, -1 }, { 0x0174002E, -1 },
+    { 0x0054016D, -1 }, { 0x004C2019, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010200D8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660101, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760146, -1 }, { 0x00000000, 0 },
+    { 0x20180146, -1 }, { 0x00590072, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0102, -2 }, { 0x0054015B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10057, -1 },
+    { 0x013D004F, -1 }, { 0x0178011B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0141014E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00620076, -1 }, { 0x00000000, 0 }, { 0x00D50058, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E011C, -1 }, { 0x01640108, -1 }, { 0x00440104, -1 },
+    { 0x00000000, 0 }, { 0x0155014F, -1 }, { 0x0174014D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01620121, -2 }, { 0x00000000, 0 },
+    { 0x00DD0113, -1 }, { 0x0159010B, -1 }, { 0x01780109, -1 }, { 0x00000000, 0 },
+    { 0x20140166, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013B0056, -1 }, { 0x01760122, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E010A, -1 }, { 0x016400F6, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005100C4, -1 }, { 0x0162010F, -2 },
+    { 0x00C10176, -2 }, { 0x0165003F, 4 }, { 0x00DD0101, -1 }, { 0x011B00FD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F00076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F40175, -1 }, { 0x00D20104, -1 }, { 0x01100100, -1 }, { 0x00000000, 0 },
+    { 0x016400E4, -2 }, { 0x00000000, 0 }, { 0x00C000D8, -1 }, { 0x0022006F, -2 },
+    { 0x00000000, 0 }, { 0x00D600C0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016200FD, -1 }, { 0x00C10164, -2 }, { 0x015900E7, -1 },
+    { 0x017800E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010F0062, 1 },
+    { 0x00000000, 0 }, { 0x00C50120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0059016D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00EE007D, 1 }, { 0x016400D2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01550119, -1 }, { 0x01740117, -1 }, { 0x00540113, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016200EB, -2 }, { 0x00C10152, -1 },
+    { 0x00000000, 0 }, { 0x017800D3, -1 }, { 0x201D0146, -1 }, { 0x201A00D3, -1 },
+    { 0x010C0120, -1 }, { 0x01642039, -2 }, { 0x00000000, 0 }, { 0x01410106, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059015B, -1 }, { 0x00000000, 0 },
+    { 0x005600E8, -1 }, { 0x00000000, 0 }, { 0x002E00D4, -1 }, { 0x016400C0, -2 },
+    { 0x0178203A, -1 }, { 0x00000000, 0 }, { 0x01502026, -1 }, { 0x01550107, -1 },
+    { 0x01740105, -1 }, { 0x00540101, -2 }, { 0x01080152, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017800C1, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01630022, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00720061, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01390027, -2 }, { 0x015500F5, -1 }, { 0x017400F3, -1 }, { 0x20190166, 1 },
+    { 0x00000000, 0 }, { 0x002C00DB, -1 }, { 0x016200C7, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800AB, -1 }, { 0x01642015, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0022, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005600C4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015500E3, -1 }, { 0x017400E1, -1 }, { 0x00F50076, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B00C7, -1 }, { 0x00000000, 0 },
+    { 0x00C1011C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EA0079, -1 }, { 0x00C500D8, -1 },
+    { 0x0027006F, -2 }, { 0x013E005D, 4 }, { 0x01660071, -2 }, { 0x201E0059, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013600D3, -1 },
+    { 0x201C0072, -1 }, { 0x00D000C3, -1 }, { 0x00510058, -1 }, { 0x0108011C, -1 },
+    { 0x00000000, 0 }, { 0x00C1010A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010C00D8, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0100004F, -1 }, { 0x00000000, 0 },
+    { 0x00590113, -1 }, { 0x00780111, -1 }, { 0x010E2026, -1 }, { 0x201E0047, -1 },
+    { 0x0104014E, -1 }, { 0x01640078, -1 }, { 0x00220146, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D60054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0108010A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01552026, -5 },
+    { 0x201E0178, -2 }, { 0x00000000, 0 }, { 0x00590101, -1 }, { 0x20150162, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01390122, -1 }, { 0x00000000, 0 }, { 0x017400AB, -1 }, { 0x00000000, 0 },
+    { 0x00700175, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0071, -1 }, { 0x01780067, -1 }, { 0x00000000, 0 },
+    { 0x010F0127, 2 }, { 0x0166017E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013E0027, 3 }, { 0x201E0166, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01640054, 1 },
+    { 0x00000000, 0 }, { 0x00410120, -1 }, { 0x00A1004A, 1 }, { 0x00000000, 0 },
+    { 0x00D30100, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0162006D, -1 }, { 0x00C100D4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00580051, -1 }, { 0x01500041, -1 }, { 0x201A0055, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0176006E, -1 }, { 0x00000000, 0 }, { 0x2018006E, -1 }, { 0x00000000, 0 },
+    { 0x002E0056, -2 }, { 0x00000000, 0 }, { 0x00FE0175, -1 }, { 0x00000000, 0 },
+    { 0x201C016D, -1 }, { 0x005700F6, -1 }, { 0x201900FA, -1 }, { 0x00000000, 0 },
+    { 0x010800D4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01780043, -1 }, { 0x00000000, 0 }, { 0x201A0043, -1 }, { 0x014D00FF, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2014E, -1 }, { 0x00000000, 0 },
+    { 0x013B00D3, -1 }, { 0x00000000, 0 }, { 0x00D500C3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01640173, -1 }, { 0x01040106, -1 }, { 0x00000000, 0 },
+    { 0x0044002C, -1 }, { 0x201C015B, -1 }, { 0x00000000, 0 }, { 0x005700E4, -1 },
+    { 0x00540071, -2 }, { 0x201900E8, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD017E, -1 }, { 0x00000000, 0 }, { 0x201A0174, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00270146, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01550065, -1 }, { 0x01740063, -1 }, { 0x00000000, 0 }, { 0x0162017A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A0162, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C00D5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00572039, -1 },
+    { 0x005F004A, 3 }, { 0x017900AB, -1 }, { 0x00D2002C, -1 }, { 0x201E011E, -1 },
+    { 0x0164014F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004100D8, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700C0, -1 }, { 0x010E0041, -1 },
+    { 0x201900C4, -2 }, { 0x00FD201A, -1 }, { 0x00000000, 0 }, { 0x01780150, -1 },
+    { 0x00000000, 0 }, { 0x0058014C, -1 }, { 0x201A0150, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01760169, -1 }, { 0x00D80100, -1 }, { 0x01760026, -1 }, { 0x20180169, -1 },
+    { 0x201E010C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013F0059, -1 }, { 0x00000000, 0 }, { 0x01360043, -1 }, { 0x0054017E, -1 },
+    { 0x0174003F, 1 }, { 0x00000000, 0 }, { 0x002C016A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B006A, 1 },
+    { 0x201D006E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0139201D, -2 },
+    { 0x00C20106, -1 }, { 0x013E00FE, 1 }, { 0x01760157, -1 }, { 0x01772019, 1 },
+    { 0x00560153, -1 }, { 0x00F40079, -1 }, { 0x01130077, -1 }, { 0x20180157, -1 },
+    { 0x00000000, 0 }, { 0x00C3004F, -1 }, { 0x013F0047, -1 }, { 0x201C0113, -2 },
+    { 0x00000000, 0 }, { 0x00D00164, -1 }, { 0x00000000, 0 }, { 0x00C7014E, -1 },
+    { 0x01620144, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660100, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590071, -1 }, { 0x0078006F, -1 }, { 0x00000000, 0 },
+    { 0x010A004F, -1 }, { 0x013F0178, -1 }, { 0x01640119, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0101, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10056, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004F0100, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E00D6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01640107, -2 }, { 0x013F0166, -1 },
+    { 0x00000000, 0 }, { 0x01360150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01620120, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01780108, -1 }, { 0x00000000, 0 }, { 0x201A0108, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760121, -1 }, { 0x00000000, 0 },
+    { 0x20180121, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E800FD, -1 },
+    { 0x01290029, 1 }, { 0x016400F5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005100C3, -1 }, { 0x002C0122, -1 },
+    { 0x004B0120, -1 }, { 0x00000000, 0 }, { 0x00DD0100, -2 }, { 0x00FF002E, -1 },
+    { 0x015900F8, -1 }, { 0x017800F6, -1 }, { 0x201D0169, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01380113, -1 },
+    { 0x0059017E, -1 }, { 0x0056010B, -1 }, { 0x013B0043, -1 }, { 0x01570111, -1 },
+    { 0x016400E3, -2 }, { 0x0176010F, -1 }, { 0x2018010F, -2 }, { 0x00000000, 0 },
+    { 0x0022006E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00E90177, -1 }, { 0x00C70106, -1 }, { 0x013E201D, 3 }, { 0x016200FC, -1 },
+    { 0x015900E6, -1 }, { 0x017800E4, -1 }, { 0x201D0157, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0057, -1 }, { 0x013B0174, -1 },
+    { 0x00D62026, -1 }, { 0x00000000, 0 }, { 0x00D50164, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014F0175, -1 },
+    { 0x014C0102, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016200EA, -2 },
+    { 0x00000000, 0 }, { 0x017800D2, -1 }, { 0x00000000, 0 }, { 0x201A00D2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0079201A, -1 }, { 0x013B0162, -1 }, { 0x017600EB, -1 },
+    { 0x005600E7, -1 }, { 0x201800EB, -2 }, { 0x00000000, 0 }, { 0x002E00D3, -1 },
+    { 0x013F011E, -1 }, { 0x01782039, -2 }, { 0x00000000, 0 }, { 0x01360108, -1 },
+    { 0x01740104, -1 }, { 0x00540100, -2 }, { 0x0076002E, -1 }, { 0x00000000, 0 },
+    { 0x016200D8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017800C0, -2 },
+    { 0x00BB0059, -2 }, { 0x00000000, 0 }, { 0x01642026, -2 }, { 0x004C0176, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013B0150, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014E00C5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013F010C, -1 }, { 0x00000000, 0 },
+    { 0x00DC002C, -1 }, { 0x015500F4, -1 }, { 0x017400F2, -1 }, { 0x01770022, 1 },
+    { 0x00700079, -1 }, { 0x002C00DA, -1 }, { 0x004B00D8, -1 }, { 0x01020059, -2 },
+    { 0x00000000, 0 }, { 0x201D0121, -1 }, { 0x00000000, 0 }, { 0x01642014, -1 },
+    { 0x00000000, 0 }, { 0x002D0166, -1 }, { 0x004C0164, -1 }, { 0x0043014E, -1 },
+    { 0x00000000, 0 }, { 0x017600C7, -1 }, { 0x00000000, 0 }, { 0x005600C3, -1 },
+    { 0x20150054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00220169, -1 }, { 0x00000000, 0 }, { 0x015500E2, -1 }, { 0x0057014F, -1 },
+    { 0x017400E0, -1 }, { 0x20190153, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01020047, -1 }, { 0x00BB0178, -2 }, { 0x0110201E, -1 }, { 0x011500FF, -1 },
+    { 0x014E201A, -1 }, { 0x201D010F, -2 }, { 0x004C0152, -1 }, { 0x00EA0078, -1 },
+    { 0x01660070, -1 }, { 0x0027006E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016A002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00220157, -1 }, { 0x00FE0079, -1 },
+    { 0x013600D2, -1 }, { 0x201C0071, -2 }, { 0x00D000C2, -1 }, { 0x00000000, 0 },
+    { 0x01020178, -2 }, { 0x00DB2026, -1 }, { 0x0157201E, -5 }, { 0x00BB0166, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01362039, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01640077, -1 }, { 0x013F00D6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01020166, -2 }, { 0x00C40027, -2 },
+    { 0x00000000, 0 }, { 0x201D00EB, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01060122, -1 }, { 0x017D2039, -1 }, { 0x00000000, 0 },
+    { 0x013B0108, -1 }, { 0x00000000, 0 }, { 0x00590100, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01640065, -2 },
+    { 0x00000000, 0 }, { 0x00C00059, -2 }, { 0x00000000, 0 }, { 0x00570119, -1 },
+    { 0x00D60041, -1 }, { 0x2019011D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013D00DD, -1 }, { 0x00DD0070, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C011C, -1 },
+    { 0x00650177, -1 }, { 0x00430106, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00220121, -1 }, { 0x00C00047, -1 },
+    { 0x2019010B, -2 }, { 0x00570107, -1 }, { 0x00510164, -1 }, { 0x00F200FD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002600DD, -1 }, { 0x00C100D3, -1 },
+    { 0x00000000, 0 }, { 0x201A0054, -2 }, { 0x00000000, 0 }, { 0x0166016B, -1 },
+    { 0x004C010A, -1 }, { 0x00270169, -1 }, { 0x013F2019, -2 }, { 0x00000000, 0 },
+    { 0x01380071, -1 }, { 0x0157006F, -1 }, { 0x0176006D, -1 }, { 0x2018006D, -1 },
+    { 0x005000C6, -1 }, { 0x002E0055, -1 }, { 0x00C00178, -2 }, { 0x0022010F, -2 },
+    { 0x01640041, -2 }, { 0x00000000, 0 }, { 0x005700F5, -1 }, { 0x201900F9, -1 },
+    { 0x00000000, 0 }, { 0x010800D3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F30177, -1 }, { 0x0150002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00270157, -1 },
+    { 0x013B00D2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D500C2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0043, -1 }, { 0x00000000, 0 },
+    { 0x00C00166, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700E3, -1 },
+    { 0x201900E7, -2 }, { 0x00540070, -1 }, { 0x00000000, 0 }, { 0x00C40122, -1 },
+    { 0x0102011E, -1 }, { 0x01780173, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE00C6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00720113, -1 }, { 0x002E0174, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002200EB, -2 }, { 0x00000000, 0 },
+    { 0x01550064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0102010C, -1 }, { 0x00DD016B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C00D4, -1 }, { 0x00000000, 0 }, { 0x00C50059, -2 }, { 0x01410051, -1 },
+    { 0x016E2026, -1 }, { 0x0176017A, -1 }, { 0x014E0166, -1 }, { 0x00720101, -1 },
+    { 0x002E0162, -2 }, { 0x0164014E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013900C7, -1 }, { 0x00000000, 0 }, { 0x201900C3, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FD2019, 1 }, { 0x00000000, 0 },
+    { 0x01590151, -1 }, { 0x0178014F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01660123, -2 }, { 0x00000000, 0 }, { 0x00270121, -1 },
+    { 0x00C50047, -1 }, { 0x00572026, -1 }, { 0x00D3201E, -1 }, { 0x01570027, 1 },
+    { 0x00000000, 0 }, { 0x002E0150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0028006A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010E002E, -1 }, { 0x00000000, 0 }, { 0x01620155, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D006D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010C0047, -1 }, { 0x00C50178, -2 },
+    { 0x0027010F, -2 }, { 0x01660111, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00F40078, -1 }, { 0x01130076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C0011E, -1 }, { 0x00000000, 0 }, { 0x00F80177, -1 },
+    { 0x01170175, -1 }, { 0x0054016B, -1 }, { 0x0155002E, -5 }, { 0x0174002C, -1 },
+    { 0x00000000, 0 }, { 0x010200D6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016600FF, -1 }, { 0x00C50166, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01760144, -1 }, { 0x00000000, 0 }, { 0x00590070, -1 }, { 0x20180144, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C0010C, -1 },
+    { 0x00000000, 0 }, { 0x00742019, 1 }, { 0x201C0100, -2 }, { 0x014F0079, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0123, -1 }, { 0x0159011B, -1 }, { 0x01780119, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0141014C, -1 }, { 0x002700EB, -2 },
+    { 0x010000DD, -2 }, { 0x00000000, 0 }, { 0x201E00D5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01640106, -1 }, { 0x00000000, 0 },
+    { 0x00440102, -1 }, { 0x013F0022, -2 }, { 0x0155014D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0162011F, -2 },
+    { 0x00000000, 0 }, { 0x00C10043, -1 }, { 0x00DD0111, -1 }, { 0x00FF003F, 1 },
+    { 0x01590109, -1 }, { 0x01780107, -1 }, { 0x20140164, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013B0054, -1 }, { 0x01760120, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006F0177, -1 }, { 0x002E0108, -1 },
+    { 0x00C4201D, -2 }, { 0x01022019, -2 }, { 0x016400F4, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570065, -1 }, { 0x005100C2, -1 },
+    { 0x01080043, -1 }, { 0x00C10174, -1 }, { 0x00D8201E, -1 }, { 0x0162010D, -2 },
+    { 0x017800F5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004600C5, -1 }, { 0x00000000, 0 },
+    { 0x00BF004A, 3 }, { 0x00000000, 0 }, { 0x00D20102, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016400E2, -2 }, { 0x00000000, 0 }, { 0x00C000D6, -1 },
+    { 0x0022006D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540123, -2 },
+    { 0x20190057, 1 }, { 0x013E201C, 3 }, { 0x016200FB, -1 }, { 0x00C10162, -2 },
+    { 0x015900E5, -1 }, { 0x017800E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0056, -1 }, { 0x00C5011E, -1 },
+    { 0x00000000, 0 }, { 0x017600FC, -1 }, { 0x0059016B, -1 }, { 0x005600F8, -1 },
+    { 0x201800FC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410059, -2 }, { 0x01550117, -1 },
+    { 0x00540111, -2 }, { 0x00570041, -1 }, { 0x0046201A, -2 }, { 0x0076003F, 1 },
+    { 0x00C10150, -1 }, { 0x016200E9, -2 }, { 0x0166201E, -2 }, { 0x01740115, -1 },
+    { 0x00D400C5, -1 }, { 0x010C011E, -1 }, { 0x201D0144, -1 }, { 0x00000000, 0 },
+    { 0x00C5010C, -1 }, { 0x00000000, 0 }, { 0x00792019, 1 }, { 0x00FD0022, 1 },
+    { 0x017600EA, -1 }, { 0x005600E6, -1 }, { 0x00720071, -1 }, { 0x002E00D2, -1 },
+    { 0x201800EA, -2 }, { 0x01040051, -1 }, { 0x00000000, 0 }, { 0x00410047, -1 },
+    { 0x01550105, -1 }, { 0x004F201E, -1 }, { 0x005400FF, -1 }, { 0x01080150, -1 },
+    { 0x01740103, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BB0058, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010C010C, -1 },
+    { 0x00000000, 0 }, { 0x00C02019, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x017600D8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014E00C4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01782026, -2 }, { 0x00410178, -2 },
+    { 0x00D4201A, -1 }, { 0x015500F3, -1 }, { 0x20190164, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00700078, -1 }, { 0x002C00D9, -1 }, { 0x016200C5, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01642013, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0046007D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005600C2, -1 }, { 0x201800C6, -2 }, { 0x00000000, 0 }, { 0x00DD201E, -2 },
+    { 0x00000000, 0 }, { 0x00410166, -2 }, { 0x015500E1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C00C7, -1 },
+    { 0x00000000, 0 }, { 0x00C4004A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00740022, 1 }, { 0x00EA0077, -1 },
+    { 0x00C500D6, -1 }, { 0x0027006D, -1 }, { 0x0166006F, -2 }, { 0x00000000, 0 },
+    { 0x00590123, -1 }, { 0x201E0057, -2 }, { 0x0162201A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FE0078, -1 },
+    { 0x00000000, 0 }, { 0x201C0070, -1 }, { 0x00D000C1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C700AB, -1 }, { 0x00C10108, -1 }, { 0x0157201D, 1 },
+    { 0x201D00FC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010C00D6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20051, -1 },
+    { 0x00000000, 0 }, { 0x00590111, -1 }, { 0x0078010F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0104014C, -1 }, { 0x01640076, -1 }, { 0x00C300DD, -2 },
+    { 0x00220144, -1 }, { 0x013F00D5, -1 }, { 0x00000000, 0 }, { 0x0152004A, 2 },
+    { 0x00000000, 0 }, { 0x01080108, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01020022, -2 }, { 0x00000000, 0 }, { 0x201D00EA, -2 }, { 0x010F0137, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0176, -2 }, { 0x0054201E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01640064, -2 },
+    { 0x00000000, 0 }, { 0x01390120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C52019, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD006F, -1 }, { 0x01780065, -1 },
+    { 0x00000000, 0 }, { 0x010F0125, 1 }, { 0x0166017C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D9201A, -1 }, { 0x00000000, 0 }, { 0x201E0164, -2 },
+    { 0x007800EB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041011E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D6002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C100D2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00C6, -2 }, { 0x0058004F, -1 }, { 0x00000000, 0 },
+    { 0x00662026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0152, -1 }, { 0x00000000, 0 }, { 0x203A00DD, -2 }, { 0x014E0058, -1 },
+    { 0x005000C5, -1 }, { 0x002E0054, -2 }, { 0x00C9004A, 2 }, { 0x00000000, 0 },
+    { 0x0041010C, -1 }, { 0x201C016B, -1 }, { 0x005700F4, -1 }, { 0x00790022, 1 },
+    { 0x201900F8, -2 }, { 0x010800D2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01780041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014D00FD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2014C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D500C1, -1 },
+    { 0x01082039, -1 }, { 0x00000000, 0 }, { 0x01640171, -1 }, { 0x0164002E, -2 },
+    { 0x00000000, 0 }, { 0x002200FC, -1 }, { 0x00C00022, -2 }, { 0x01170079, -1 },
+    { 0x005700E2, -1 }, { 0x0054006F, -2 }, { 0x201900E6, -1 }, { 0x00000000, 0 },
+    { 0x00C70051, -1 }, { 0x00DD017C, -1 }, { 0x01620047, -1 }, { 0x0170201E, -1 },
+    { 0x0050201A, -4 }, { 0x00D40166, -1 }, { 0x01660146, -1 }, { 0x201A0172, -1 },
+    { 0x00000000, 0 }, { 0x00270144, -1 }, { 0x00DE00C5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0164015F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002200EA, -2 },
+    { 0x013900D8, -1 }, { 0x01550063, -1 }, { 0x01740061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B0047, -1 }, { 0x00000000, 0 }, { 0x0059201E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004C00D3, -1 }, { 0x010600C7, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E011C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0164014D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004100D6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900C2, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE201A, -4 }, { 0x01620166, 1 },
+    { 0x0178014E, -1 }, { 0x00000000, 0 }, { 0x201A014E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01660122, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004300AB, -1 }, { 0x00DB002E, -1 }, { 0x201E010A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013F0057, -1 }, { 0x002200C6, -2 }, { 0x201C0123, -1 },
+    { 0x0054017C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0168, -1 },
+    { 0x00000000, 0 }, { 0x00DD0146, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760155, -1 },
+    { 0x00000000, 0 }, { 0x00560151, -1 }, { 0x00F40077, -1 }, { 0x20180155, -1 },
+    { 0x0129005D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016C201A, -1 }, { 0x201C0111, -2 }, { 0x00D00162, -1 }, { 0x00000000, 0 },
+    { 0x00C7014C, -1 }, { 0x00000000, 0 }, { 0x010200D5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002700FC, -1 }, { 0x00412019, -2 },
+    { 0x00C50022, -2 }, { 0x00000000, 0 }, { 0x0059006F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01640117, -2 }, { 0x013F0176, -1 }, { 0x0175201E, -1 },
+    { 0x00000000, 0 }, { 0x0055201A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014F0078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C400C7, -1 },
+    { 0x00C10054, -2 }, { 0x00DD0122, -1 }, { 0x01530177, -1 }, { 0x01500104, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002700EA, -2 }, { 0x00000000, 0 }, { 0x201E00D4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01640105, -2 },
+    { 0x013F0164, -1 }, { 0x00000000, 0 }, { 0x0136014E, -1 }, { 0x00000000, 0 },
+    { 0x00540146, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0162011E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0045004A, 2 }, { 0x01780106, -1 },
+    { 0x201A0106, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0176011F, -1 },
+    { 0x00000000, 0 }, { 0x0056011B, -1 }, { 0x2018011F, -1 }, { 0x00000000, 0 },
+    { 0x016400F3, -2 }, { 0x013F0152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570064, -1 }, { 0x005100C1, -1 },
+    { 0x002C0120, -1 }, { 0x004B011E, -1 }, { 0x0162010C, -1 }, { 0x00FF002C, -1 },
+    { 0x015900F6, -1 }, { 0x017800F4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002700C6, -2 },
+    { 0x00430051, -1 }, { 0x004600C4, -1 }, { 0x00560109, -1 }, { 0x0059017C, -1 },
+    { 0x01380111, -1 }, { 0x0157010F, -1 }, { 0x016400E1, -2 }, { 0x0176010D, -1 },
+    { 0x00C000D5, -1 }, { 0x2018010D, -2 }, { 0x00000000, 0 }, { 0x00540122, -1 },
+    { 0x20190056, 1 }, { 0x00E90175, -1 }, { 0x004B010C, -1 }, { 0x016200FA, -1 },
+    { 0x00000000, 0 }, { 0x015900E4, -1 }, { 0x017800E2, -1 }, { 0x201D0155, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017600FB, -1 }, { 0x00D50162, -1 },
+    { 0x201800FB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011A004A, 2 },
+    { 0x00000000, 0 }, { 0x010E0104, -1 }, { 0x014C0100, -1 }, { 0x016E002E, -1 },
+    { 0x016200E8, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D400C4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C0043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015700EB, -1 },
+    { 0x017600E9, -1 }, { 0x005600E5, -1 }, { 0x201800E9, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013F011C, -1 }, { 0x00000000, 0 },
+    { 0x01360106, -1 }, { 0x01740102, -1 }, { 0x0057002E, -1 }, { 0x0076002C, -1 },
+    { 0x00000000, 0 }, { 0x016200D6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BB0057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C0174, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013B014E, -1 },
+    { 0x00000000, 0 }, { 0x00590146, -1 }, { 0x00000000, 0 }, { 0x014E00C3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016400AB, -2 }, { 0x013F010A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015500F2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00700077, -1 }, { 0x002C00D8, -1 }, { 0x004B00D6, -1 },
+    { 0x01020057, -1 }, { 0x016200C4, -2 }, { 0x201D011F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010F0029, 4 }, { 0x002D0164, -1 }, { 0x004C0162, -1 },
+    { 0x0043014C, -1 }, { 0x013E006C, 1 }, { 0x017600C5, -2 }, { 0x00000000, 0 },
+    { 0x005600C1, -1 }, { 0x201800C5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410022, -2 },
+    { 0x0057014D, -1 }, { 0x015500E0, -1 }, { 0x20190151, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BB0176, -2 }, { 0x201D010D, -2 },
+    { 0x00F600FF, -1 }, { 0x011500FD, -1 }, { 0x01750027, 1 }, { 0x004C0150, -1 },
+    { 0x00EA0076, -1 }, { 0x00C500D5, -1 }, { 0x0166006E, -1 }, { 0x00000000, 0 },
+    { 0x00590122, -1 }, { 0x201E0056, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00220155, -1 },
+    { 0x00FE0077, -1 }, { 0x201C006F, -2 }, { 0x00000000, 0 }, { 0x00D000C0, -1 },
+    { 0x00000000, 0 }, { 0x01020176, -2 }, { 0x0176201A, -2 }, { 0x00000000, 0 },
+    { 0x00BB0164, -2 }, { 0x201D00FB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010C00D5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01640075, -1 }, { 0x013F00D4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01020164, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00E9, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01060120, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013B0106, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01640063, -2 }, { 0x00000000, 0 }, { 0x00A10059, -1 }, { 0x00C00057, -1 },
+    { 0x00570117, -1 }, { 0x2019011B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01020152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD006E, -1 },
+    { 0x01780064, -1 }, { 0x00D40058, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00650175, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007800EA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01640051, -1 }, { 0x00000000, 0 }, { 0x0022011F, -1 },
+    { 0x00000000, 0 }, { 0x20190109, -2 }, { 0x00570105, -1 }, { 0x00510162, -1 },
+    { 0x20130166, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00C5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01660169, -1 }, { 0x004C0108, -1 }, { 0x01660026, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0138006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005000C4, -1 }, { 0x0164003F, 1 }, { 0x00A10178, -1 },
+    { 0x0022010D, -2 }, { 0x00C00176, -2 }, { 0x00000000, 0 }, { 0x005700F3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F30175, -1 },
+    { 0x0150002C, -1 }, { 0x01672019, 1 }, { 0x01660157, -1 }, { 0x00000000, 0 },
+    { 0x00270155, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D500C0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0164002D, -1 }, { 0x00A10166, -1 }, { 0x002200FB, -1 }, { 0x00630027, 1 },
+    { 0x005700E1, -1 }, { 0x00C00164, -2 }, { 0x0054006E, -1 }, { 0x01170078, -1 },
+    { 0x00C40120, -1 }, { 0x0102011C, -1 }, { 0x011B0177, -1 }, { 0x0178002E, -2 },
+    { 0x01780171, -1 }, { 0x201900E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010600D8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE00C4, -1 },
+    { 0x01760047, -1 }, { 0x00000000, 0 }, { 0x00720111, -1 }, { 0x002E0172, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00152, -1 }, { 0x002200E9, -2 },
+    { 0x201C0146, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D00054, -1 },
+    { 0x00000000, 0 }, { 0x01620177, -1 }, { 0x0102010A, -1 }, { 0x00DD0169, -1 },
+    { 0x0178015F, -1 }, { 0x00DD0026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004C00D2, -1 }, { 0x00000000, 0 }, { 0x00C50057, -1 },
+    { 0x0141004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014E0164, -1 },
+    { 0x00000000, 0 }, { 0x0164014C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004100D5, -1 }, { 0x00000000, 0 }, { 0x201900C1, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0157, -1 }, { 0x0159014F, -1 }, { 0x0178014D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660121, -2 }, { 0x00000000, 0 },
+    { 0x0027011F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180166, 1 }, { 0x00000000, 0 }, { 0x002E014E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013F0056, -1 }, { 0x002200C5, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700AB, -1 }, { 0x010E002C, -1 }, { 0x00000000, 0 },
+    { 0x01620153, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0166010F, -2 },
+    { 0x00C50176, -2 }, { 0x0027010D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F40076, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C0011C, -1 },
+    { 0x00F80175, -1 }, { 0x00D60104, -1 }, { 0x00540169, -1 }, { 0x0155002C, -5 },
+    { 0x00540026, -1 }, { 0x00E90079, -1 }, { 0x00C400D8, -1 }, { 0x010200D4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016600FD, -1 }, { 0x00C50164, -2 }, { 0x002700FB, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059006E, -1 },
+    { 0x00000000, 0 }, { 0x00500058, -1 }, { 0x00000000, 0 }, { 0x0175201D, 1 },
+    { 0x00C0010A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540157, -1 }, { 0x014F0077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0121, -1 }, { 0x01590119, -1 }, { 0x01780117, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016600EB, -2 }, { 0x00C50152, -1 },
+    { 0x002700E9, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E00D3, -1 },
+    { 0x00D50054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01640104, -2 },
+    { 0x00000000, 0 }, { 0x00440100, -1 }, { 0x0066002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00AB0059, -1 }, { 0x0162011D, -2 }, { 0x00DD010F, -1 }, { 0x01590107, -1 },
+    { 0x0072201E, -5 }, { 0x01780105, -1 }, { 0x010C0152, -1 }, { 0x20140162, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0058, -1 },
+    { 0x0176011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006F0175, -1 },
+    { 0x002E0106, -1 }, { 0x016400F2, -2 }, { 0x01670022, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20190067, -1 }, { 0x00570063, -1 },
+    { 0x005100C0, -1 }, { 0x0162010B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013D0027, -2 }, { 0x015900F5, -1 }, { 0x017800F3, -1 }, { 0x201D0166, 1 },
+    { 0x00000000, 0 }, { 0x016600C7, -1 }, { 0x00000000, 0 }, { 0x002700C5, -2 },
+    { 0x004600C3, -1 }, { 0x0176010C, -1 }, { 0x00000000, 0 }, { 0x00D20100, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016400E0, -2 }, { 0x00000000, 0 },
+    { 0x00C000D4, -1 }, { 0x00000000, 0 }, { 0x01390059, -1 }, { 0x00000000, 0 },
+    { 0x00540121, -2 }, { 0x00AB0178, -1 }, { 0x00000000, 0 }, { 0x016200F9, -1 },
+    { 0x01650029, 5 }, { 0x00DD00EB, -1 }, { 0x015900E3, -1 }, { 0x017800E1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0054, -1 },
+    { 0x00C5011C, -1 }, { 0x00000000, 0 }, { 0x017600FA, -1 }, { 0x00590169, -1 },
+    { 0x005600F6, -1 }, { 0x00590026, -1 }, { 0x201800FA, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410057, -1 },
+    { 0x01390047, -1 }, { 0x0054010F, -2 }, { 0x0057003F, 1 }, { 0x00AB0166, -1 },
+    { 0x01550115, -1 }, { 0x00C1014E, -1 }, { 0x016200E7, -2 }, { 0x01740113, -1 },
+    { 0x00000000, 0 }, { 0x00D400C3, -1 }, { 0x00000000, 0 }, { 0x010C011C, -1 },
+    { 0x012E004A, 1 }, { 0x00C5010A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015700EA, -1 }, { 0x00590157, -1 }, { 0x005600E4, -1 }, { 0x0072006F, -1 },
+    { 0x017600E8, -1 }, { 0x201800E8, -2 }, { 0x0104004F, -1 }, { 0x01390178, -1 },
+    { 0x00000000, 0 }, { 0x01550103, -1 }, { 0x01740101, -1 }, { 0x005400FD, -1 },
+    { 0x0108014E, -1 }, { 0x20190174, 1 }, { 0x016200D5, -1 }, { 0x00000000, 0 },
+    { 0x00DD00C7, -1 }, { 0x00BB0056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010C010A, -1 }, { 0x0063201D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013E007D, 4 }, { 0x017600D6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014E00C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01592026, -5 },
+    { 0x00410176, -2 }, { 0x0077201E, -1 }, { 0x01390166, -1 }, { 0x20190162, 1 },
+    { 0x005400EB, -2 }, { 0x00000000, 0 }, { 0x00700076, -1 }, { 0x004B00D5, -1 },
+    { 0x01020056, -1 }, { 0x013D0122, -1 }, { 0x00562039, -1 }, { 0x016200C3, -2 },
+    { 0x017800AB, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00650079, -1 }, { 0x013E006B, 1 }, { 0x017600C4, -2 },
+    { 0x00000000, 0 }, { 0x005600C0, -1 }, { 0x201800C4, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00220166, 1 }, { 0x00410164, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0166006D, -1 }, { 0x00C500D4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590121, -1 }, { 0x201E0055, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410152, -1 },
+    { 0x00FE0076, -1 }, { 0x00000000, 0 }, { 0x201C006E, -1 }, { 0x005400C7, -1 },
+    { 0x00510054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10106, -1 },
+    { 0x00000000, 0 }, { 0x201D00FA, -1 }, { 0x00000000, 0 }, { 0x00F30079, -1 },
+    { 0x010C00D4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C2004F, -1 }, { 0x00000000, 0 }, { 0x0059010F, -1 }, { 0x0078010D, -1 },
+    { 0x00D02026, -1 }, { 0x00720027, 1 }, { 0x014C201E, -1 }, { 0x015100FF, -1 },
+    { 0x013F00D3, -1 }, { 0x201E0043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01080106, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01780075, -1 }, { 0x201D00E8, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201E0174, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00056, -1 }, { 0x0139011E, -1 },
+    { 0x013600AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD006D, -1 },
+    { 0x01590065, -1 }, { 0x01780063, -1 }, { 0x00000000, 0 }, { 0x0166017A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000027, -2 },
+    { 0x201E0162, -2 }, { 0x005900EB, -1 }, { 0x007800E9, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017D00AB, -1 },
+    { 0x0041011C, -1 }, { 0x0139010C, -1 }, { 0x00570104, -1 }, { 0x00D6002C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01780051, -1 }, { 0x201D00C4, -2 }, { 0x201A0051, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00270166, 1 },
+    { 0x00000000, 0 }, { 0x201E0150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005000C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0041010A, -1 }, { 0x201C0169, -1 }, { 0x201900F6, -2 },
+    { 0x005700F2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0178003F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005900C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E80177, -1 },
+    { 0x013D201D, -2 }, { 0x0164002C, -2 }, { 0x002200FA, -1 }, { 0x0164016F, -1 },
+    { 0x00F80079, -1 }, { 0x005700E0, -1 }, { 0x0054006D, -1 }, { 0x01170077, -1 },
+    { 0x01740071, -1 }, { 0x002C0059, -2 }, { 0x00C7004F, -1 }, { 0x00D52026, -1 },
+    { 0x00DD017A, -1 }, { 0x00D40164, -1 }, { 0x00770027, 1 }, { 0x201900E4, -1 },
+    { 0x01660144, -1 }, { 0x201A0170, -1 }, { 0x201C0157, -1 }, { 0x00DE00C3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002200E8, -2 }, { 0x013900D6, -1 }, { 0x01550061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0047, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50056, -1 },
+    { 0x01000122, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0164014B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004100D4, -1 }, { 0x00000000, 0 }, { 0x01360051, -1 },
+    { 0x201900C0, -2 }, { 0x00D00041, -1 }, { 0x002C0178, -2 }, { 0x01620164, 1 },
+    { 0x00000000, 0 }, { 0x0178014C, -1 }, { 0x00000000, 0 }, { 0x201A014C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660120, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB002C, -1 },
+    { 0x201E0108, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006F0079, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002200C4, -2 },
+    { 0x201C0121, -1 }, { 0x0054017A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0166, -2 }, { 0x01620152, -1 }, { 0x00000000, 0 }, { 0x00DD0144, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20140054, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01392019, -2 }, { 0x00000000, 0 },
+    { 0x01760153, -1 }, { 0x00000000, 0 }, { 0x0056014F, -1 }, { 0x20180153, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013F0043, -1 },
+    { 0x00000000, 0 }, { 0x201C010F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B0152, -1 }, { 0x00E90078, -1 }, { 0x010200D3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016600FC, -1 }, { 0x00000000, 0 }, { 0x002700FA, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059006D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01640115, -2 }, { 0x013F0174, -1 },
+    { 0x00DA2026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014F0076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0120, -1 }, { 0x00000000, 0 }, { 0x01530175, -1 },
+    { 0x01500102, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016600EA, -2 },
+    { 0x00000000, 0 }, { 0x002700E8, -2 }, { 0x00000000, 0 }, { 0x201E00D2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01640103, -2 }, { 0x013F0162, -1 }, { 0x00C30027, -2 }, { 0x0136014C, -1 },
+    { 0x201C00EB, -2 }, { 0x00000000, 0 }, { 0x00540144, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0162011C, -1 }, { 0x00000000, 0 }, { 0x01780104, -2 },
+    { 0x0072201D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016600D8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF0059, -1 }, { 0x013B0051, -1 }, { 0x00560119, -1 }, { 0x00D50041, -1 },
+    { 0x01682026, -1 }, { 0x0176011D, -1 }, { 0x013F0150, -1 }, { 0x2018011D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C011E, -1 }, { 0x004B011C, -1 }, { 0x0162010A, -1 },
+    { 0x00DD00FC, -1 }, { 0x015900F4, -1 }, { 0x017800F2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002700C4, -2 }, { 0x0043004F, -1 }, { 0x004600C2, -1 }, { 0x00512026, -1 },
+    { 0x00560107, -1 }, { 0x0059017A, -1 }, { 0x0138010F, -1 }, { 0x0157010D, -1 },
+    { 0x0176010B, -1 }, { 0x00C000D3, -1 }, { 0x2018010B, -2 }, { 0x00000000, 0 },
+    { 0x00540120, -1 }, { 0x20190054, 1 }, { 0x0100201D, -2 }, { 0x002C010C, -1 },
+    { 0x004B010A, -1 }, { 0x013E2019, 3 }, { 0x00DD00EA, -1 }, { 0x015900E2, -1 },
+    { 0x016200F8, -2 }, { 0x017800E0, -1 }, { 0x010F005D, 4 }, { 0x201D0153, -2 },
+    { 0x01060047, -1 }, { 0x00BF0178, -1 }, { 0x00000000, 0 }, { 0x011900FF, -1 },
+    { 0x017600F9, -1 }, { 0x005600F5, -1 }, { 0x201800F9, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410056, -1 },
+    { 0x00000000, 0 }, { 0x00F20177, -1 }, { 0x010E0102, -1 }, { 0x016E002C, -1 },
+    { 0x00000000, 0 }, { 0x016200E6, -2 }, { 0x00000000, 0 }, { 0x00DD00D8, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D400C2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00BF0166, -1 },
+    { 0x013800EB, -1 }, { 0x015700E9, -1 }, { 0x005600E3, -1 }, { 0x017600E7, -1 },
+    { 0x201800E7, -2 }, { 0x016400BB, -1 }, { 0x00C30122, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01740100, -1 }, { 0x20190173, -1 }, { 0x005400FC, -1 },
+    { 0x0057002C, -1 }, { 0x00000000, 0 }, { 0x016200D4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0044201E, -1 }, { 0x00000000, 0 },
+    { 0x013B014C, -1 }, { 0x00000000, 0 }, { 0x017600D5, -1 }, { 0x00590144, -1 },
+    { 0x011000C5, -1 }, { 0x010A0122, -1 }, { 0x014E00C1, -1 }, { 0x00000000, 0 },
+    { 0x013F0108, -1 }, { 0x0077201D, 1 }, { 0x00000000, 0 }, { 0x01390022, -2 },
+    { 0x00000000, 0 }, { 0x005400EA, -2 }, { 0x00000000, 0 }, { 0x002C00D6, -1 },
+    { 0x004B00D4, -1 }, { 0x00C40059, -2 }, { 0x016200C2, -2 }, { 0x201D011D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010F0027, 3 }, { 0x002D0162, -1 },
+    { 0x00000000, 0 }, { 0x014100DD, -1 }, { 0x00650078, -1 }, { 0x017600C3, -2 },
+    { 0x00000000, 0 }, { 0x201800C3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019014F, -2 }, { 0x005400D8, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40047, -1 }, { 0x00BB0174, -1 },
+    { 0x00562026, -1 }, { 0x00D2201E, -1 }, { 0x00F600FD, -1 }, { 0x01020043, -1 },
+    { 0x004C014E, -1 }, { 0x0110201A, -1 }, { 0x00C500D3, -1 }, { 0x201D010B, -2 },
+    { 0x00000000, 0 }, { 0x00590120, -1 }, { 0x201E0054, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00220153, -2 }, { 0x00000000, 0 }, { 0x201C006D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40178, -2 }, { 0x01020174, -1 },
+    { 0x0157201A, -5 }, { 0x00BB0162, -2 }, { 0x201D00F9, -1 }, { 0x00000000, 0 },
+    { 0x00F30078, -1 }, { 0x010C00D3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0100004A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01640073, -2 },
+    { 0x013F00D2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00510041, -1 }, { 0x00000000, 0 },
+    { 0x00C40166, -2 }, { 0x01020162, -2 }, { 0x00000000, 0 }, { 0x201D00E7, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0106011E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005900FC, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01640061, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00570115, -1 }, { 0x20190119, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01020150, -1 }, { 0x0162007A, -1 }, { 0x00000000, 0 },
+    { 0x01590064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0106010C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013E0022, 3 }, { 0x00000000, 0 }, { 0x005900EA, -1 }, { 0x007800E8, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0164004F, -1 }, { 0x00000000, 0 },
+    { 0x0022011D, -1 }, { 0x00C00043, -1 }, { 0x01722026, -1 }, { 0x00570103, -1 },
+    { 0x20130164, -1 }, { 0x20190107, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013D00C7, -1 }, { 0x00000000, 0 }, { 0x201D00C3, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C3201D, -2 }, { 0x004C0106, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900D8, -1 },
+    { 0x00000000, 0 }, { 0x00560065, -1 }, { 0x005000C2, -1 }, { 0x002E0051, -1 },
+    { 0x00A10176, -1 }, { 0x0022010B, -2 }, { 0x00C00174, -1 }, { 0x00000000, 0 },
+    { 0x201900F5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010F00FE, 1 }, { 0x00000000, 0 }, { 0x01660155, -1 },
+    { 0x00000000, 0 }, { 0x00270153, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180057, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00A10164, -1 }, { 0x002200F9, -1 },
+    { 0x00C00162, -2 }, { 0x00F80078, -1 }, { 0x01170076, -1 }, { 0x201900E3, -1 },
+    { 0x00000000, 0 }, { 0x00C4011E, -1 }, { 0x00000000, 0 }, { 0x011B0175, -1 },
+    { 0x0159002E, -5 }, { 0x0178002C, -2 }, { 0x0178016F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010600D6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE00C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560041, -1 },
+    { 0x002E0170, -1 }, { 0x0072010F, -1 }, { 0x00000000, 0 }, { 0x00C00150, -1 },
+    { 0x002200E7, -2 }, { 0x013900D5, -1 }, { 0x201C0144, -1 }, { 0x00D300C5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010800AB, -1 }, { 0x00C4010C, -1 },
+    { 0x01020108, -1 }, { 0x01620175, -1 }, { 0x00000000, 0 }, { 0x01530079, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01100166, -1 }, { 0x014E0162, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010400DD, -2 }, { 0x00000000, 0 }, { 0x004100D3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0155, -1 }, { 0x0159014D, -1 },
+    { 0x0178014B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0166011F, -2 },
+    { 0x00000000, 0 }, { 0x0027011D, -1 }, { 0x00C50043, -1 }, { 0x00D3201A, -1 },
+    { 0x01772026, -1 }, { 0x20180164, 1 }, { 0x007200EB, -1 }, { 0x002E014C, -1 },
+    { 0x006F0078, -1 }, { 0x01640138, -1 }, { 0x013F0054, -1 }, { 0x002200C3, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D0002E, -1 },
+    { 0x00000000, 0 }, { 0x01620151, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010C0043, -1 }, { 0x00C50174, -1 }, { 0x0027010B, -2 }, { 0x00DC201E, -1 },
+    { 0x0166010D, -2 }, { 0x01760152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C3004A, 1 }, { 0x010F201D, 3 }, { 0x00D60102, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E90077, -1 }, { 0x00C400D6, -1 },
+    { 0x010200D2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0057, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016600FB, -1 }, { 0x00C50162, -2 },
+    { 0x002700F9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C00108, -1 }, { 0x00000000, 0 }, { 0x201C00FC, -1 },
+    { 0x00000000, 0 }, { 0x00540155, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0165005D, 5 }, { 0x00000000, 0 }, { 0x00C10051, -1 }, { 0x00DD011F, -1 },
+    { 0x01590117, -1 }, { 0x016A201E, -1 }, { 0x01780115, -1 }, { 0x016600E9, -2 },
+    { 0x00C50150, -1 }, { 0x002700E7, -2 }, { 0x00C200DD, -2 }, { 0x00000000, 0 },
+    { 0x00D800C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01640102, -2 }, { 0x00000000, 0 }, { 0x0066002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00EA, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01080051, -1 }, { 0x0162011B, -2 }, { 0x00DD010D, -1 },
+    { 0x01590105, -1 }, { 0x01780103, -1 }, { 0x00000000, 0 }, { 0x010C0150, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010000C7, -1 },
+    { 0x00000000, 0 }, { 0x0176011C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C42019, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570061, -1 }, { 0x20190065, -2 }, { 0x01620109, -2 }, { 0x00000000, 0 },
+    { 0x00D8201A, -1 }, { 0x00DD00FB, -1 }, { 0x015900F3, -1 }, { 0x201D0164, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016600C5, -2 }, { 0x00000000, 0 },
+    { 0x002700C3, -2 }, { 0x004600C1, -1 }, { 0x0176010A, -1 }, { 0x00000000, 0 },
+    { 0x00D5002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C000D2, -1 }, { 0x00000000, 0 }, { 0x01390057, -1 },
+    { 0x201C00C6, -2 }, { 0x0054011F, -2 }, { 0x00AB0176, -1 }, { 0x013E2018, 3 },
+    { 0x00E600FF, -1 }, { 0x01650027, 3 }, { 0x00DD00E9, -1 }, { 0x015900E1, -1 },
+    { 0x00000000, 0 }, { 0x203900DD, -1 }, { 0x00000000, 0 }, { 0x004F00C5, -1 },
+    { 0x002D0054, -1 }, { 0x00C8004A, 2 }, { 0x00000000, 0 }, { 0x017600F8, -1 },
+    { 0x00000000, 0 }, { 0x005600F4, -1 }, { 0x201800F8, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00220057, 1 }, { 0x01550113, -1 }, { 0x0054010D, -2 }, { 0x0166201A, -2 },
+    { 0x00AB0164, -1 }, { 0x016200E5, -2 }, { 0x00C1014C, -1 }, { 0x01740111, -1 },
+    { 0x20190041, -2 }, { 0x00000000, 0 }, { 0x00D400C1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50108, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013800EA, -1 }, { 0x00590155, -1 }, { 0x005600E2, -1 },
+    { 0x00780153, -1 }, { 0x015700E8, -1 }, { 0x017600E6, -1 }, { 0x201800E6, -1 },
+    { 0x01390176, -1 }, { 0x00410043, -1 }, { 0x01550101, -1 }, { 0x004F201A, -1 },
+    { 0x005400FB, -1 }, { 0x00D30166, -1 }, { 0x0108014C, -1 }, { 0x016200D3, -1 },
+    { 0x00000000, 0 }, { 0x00DD00C5, -2 }, { 0x00BB0054, -2 }, { 0x017800BB, -1 },
+    { 0x014D0177, -1 }, { 0x010C0108, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017600D4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x011000C4, -1 }, { 0x014E00C0, -1 }, { 0x0162203A, -1 },
+    { 0x00000000, 0 }, { 0x00410174, -1 }, { 0x01390164, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005400E9, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C00D5, -1 }, { 0x004B00D3, -1 }, { 0x01020054, -2 }, { 0x013D0120, -1 },
+    { 0x016200C1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00650077, -1 }, { 0x00000000, 0 },
+    { 0x017600C2, -2 }, { 0x00000000, 0 }, { 0x201800C2, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD201A, -2 }, { 0x00000000, 0 }, { 0x00220164, 1 },
+    { 0x00410162, -2 }, { 0x01390152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DA002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C500D2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059011F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00EB00FF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005400C5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01572019, 1 }, { 0x00000000, 0 }, { 0x201D00F8, -2 }, { 0x00000000, 0 },
+    { 0x00F30077, -1 }, { 0x010C00D2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00270057, 1 }, { 0x00000000, 0 }, { 0x0059010D, -1 },
+    { 0x0078010B, -1 }, { 0x015100FD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01640072, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010C2039, -1 }, { 0x0114004A, 2 }, { 0x00000000, 0 }, { 0x0168002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40022, -2 }, { 0x011B0079, -1 },
+    { 0x01780073, -1 }, { 0x201D00E6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01660047, -1 }, { 0x00000000, 0 }, { 0x0174201E, -1 }, { 0x201E0172, -1 },
+    { 0x0054201A, -2 }, { 0x005900FB, -1 }, { 0x00D80166, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C300C7, -1 }, { 0x00C00054, -2 },
+    { 0x0139011C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0051002E, -1 }, { 0x00000000, 0 }, { 0x01620079, -1 }, { 0x013D00D8, -1 },
+    { 0x00000000, 0 }, { 0x01590063, -1 }, { 0x01780061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006200FF, -1 }, { 0x013E0021, 3 }, { 0x005900E9, -1 }, { 0x007800E7, -1 },
+    { 0x0176007A, -1 }, { 0x010A00C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0139010A, -1 }, { 0x00000000, 0 }, { 0x00570102, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01620067, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0178004F, -1 }, { 0x201D00C2, -2 },
+    { 0x201A004F, -1 }, { 0x00000000, 0 }, { 0x01660166, 1 }, { 0x00000000, 0 },
+    { 0x00270164, 1 }, { 0x00000000, 0 }, { 0x201E014E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560064, -1 }, { 0x005000C1, -1 }, { 0x01100058, -1 },
+    { 0x014E0054, -1 }, { 0x00000000, 0 }, { 0x00410108, -1 }, { 0x00000000, 0 },
+    { 0x201900F4, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0047, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F000FF, -1 }, { 0x004F0166, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013E0140, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005900C5, -2 }, { 0x20180056, 1 }, { 0x00000000, 0 },
+    { 0x00E80175, -1 }, { 0x0164016D, -1 }, { 0x00000000, 0 }, { 0x002200F8, -2 },
+    { 0x00000000, 0 }, { 0x00F80077, -1 }, { 0x01550071, -1 }, { 0x0174006F, -1 },
+    { 0x201900E2, -1 }, { 0x201C0155, -1 }, { 0x002C0057, -2 }, { 0x01620043, -1 },
+    { 0x0170201A, -1 }, { 0x201A016E, -1 }, { 0x00D40162, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010600D5, -1 }, { 0x00000000, 0 },
+    { 0x00DE00C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0165201D, 3 },
+    { 0x00000000, 0 }, { 0x0164015B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002200E6, -1 }, { 0x013900D4, -1 }, { 0x00000000, 0 },
+    { 0x00D300C4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0043, -1 },
+    { 0x00FD2026, -1 }, { 0x0059201A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01530078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C50054, -2 }, { 0x01000120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0056002E, -1 }, { 0x00000000, 0 }, { 0x0129007D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004100D2, -1 }, { 0x00000000, 0 },
+    { 0x0136004F, -1 }, { 0x00000000, 0 }, { 0x00540047, -1 }, { 0x002C0176, -2 },
+    { 0x01620162, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0166011E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0106, -1 }, { 0x01570022, 1 }, { 0x00000000, 0 }, { 0x007200EA, -1 },
+    { 0x006F0077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002200C2, -2 }, { 0x201C011F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0164, -2 }, { 0x01620150, -1 }, { 0x00000000, 0 },
+    { 0x01780138, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0166010C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01570153, -1 }, { 0x01760151, -1 }, { 0x0056014D, -1 },
+    { 0x20180151, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010F201C, 3 }, { 0x00F500FF, -1 },
+    { 0x00540166, 1 }, { 0x201C010D, -2 }, { 0x002C0152, -1 }, { 0x004B0150, -1 },
+    { 0x00C400D5, -1 }, { 0x00E90076, -1 }, { 0x00000000, 0 }, { 0x00580122, -1 },
+    { 0x201D0056, 1 }, { 0x00000000, 0 }, { 0x016600FA, -1 }, { 0x00000000, 0 },
+    { 0x002700F8, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01640113, -2 },
+    { 0x00000000, 0 }, { 0x0175201A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00FB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD011E, -1 }, { 0x00000000, 0 },
+    { 0x01150177, -1 }, { 0x01500100, -1 }, { 0x0172002E, -1 }, { 0x00000000, 0 },
+    { 0x016600E8, -2 }, { 0x00000000, 0 }, { 0x002700E6, -1 }, { 0x010000D8, -1 },
+    { 0x00000000, 0 }, { 0x00D800C4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01640101, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00E9, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD010C, -1 }, { 0x01780102, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016600D6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0057, -1 }, { 0x013B004F, -1 }, { 0x00560117, -1 },
+    { 0x00590047, -1 }, { 0x0176011B, -1 }, { 0x2018011B, -2 }, { 0x013F014E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D30058, -1 }, { 0x20190064, -2 }, { 0x00000000, 0 }, { 0x002C011C, -1 },
+    { 0x01620108, -1 }, { 0x00DD00FA, -1 }, { 0x015900F2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016600C4, -2 },
+    { 0x00000000, 0 }, { 0x002700C2, -2 }, { 0x004600C0, -1 }, { 0x0138010D, -1 },
+    { 0x0157010B, -1 }, { 0x00560105, -1 }, { 0x01760109, -1 }, { 0x20180109, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01390056, -1 },
+    { 0x201C00C5, -2 }, { 0x0054011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C010A, -1 }, { 0x004B0108, -1 }, { 0x016200F6, -2 }, { 0x00DD00E8, -1 },
+    { 0x015900E0, -1 }, { 0x201D0151, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004F00C4, -1 }, { 0x004C0051, -1 }, { 0x00BF0176, -1 }, { 0x00792026, -1 },
+    { 0x011900FD, -1 }, { 0x00000000, 0 }, { 0x005600F3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00220056, 1 }, { 0x00410054, -2 }, { 0x00F20175, -1 }, { 0x0054010C, -1 },
+    { 0x00D00104, -1 }, { 0x010E0100, -1 }, { 0x016200E4, -2 }, { 0x00000000, 0 },
+    { 0x00DD00D6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D400C0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00BF0164, -1 }, { 0x013800E9, -1 }, { 0x015700E7, -1 }, { 0x005600E1, -1 },
+    { 0x017600E5, -1 }, { 0x201800E5, -1 }, { 0x00000000, 0 }, { 0x00C30120, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0177002E, -1 }, { 0x20190171, -1 },
+    { 0x005400FA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016200D2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00C4, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017600D3, -1 },
+    { 0x00000000, 0 }, { 0x011000C3, -1 }, { 0x010A0120, -1 }, { 0x01622039, -2 },
+    { 0x00000000, 0 }, { 0x013F0106, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x2019015F, -1 }, { 0x00000000, 0 }, { 0x005400E8, -2 }, { 0x00000000, 0 },
+    { 0x002C00D4, -1 }, { 0x004B00D2, -1 }, { 0x00C40057, -1 }, { 0x016200C0, -2 },
+    { 0x014E2026, -1 }, { 0x0176203A, -1 }, { 0x201D011B, -2 }, { 0x00000000, 0 },
+    { 0x01060152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00650076, -1 },
+    { 0x013E0068, 1 }, { 0x00D80058, -1 }, { 0x017600C1, -2 }, { 0x004B2039, -1 },
+    { 0x201800C1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019014D, -2 }, { 0x005400D6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0109, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004C014C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059011E, -1 }, { 0x00000000, 0 },
+    { 0x005600AB, -1 }, { 0x01622015, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00220151, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005400C4, -2 }, { 0x00000000, 0 }, { 0x00C40176, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00F30076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00270056, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0059010C, -1 }, { 0x00D50104, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00E80079, -1 }, { 0x00C300D8, -1 }, { 0x01640071, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190129, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C40164, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011B0078, -1 }, { 0x01780072, -1 }, { 0x201D00E5, -1 }, { 0x00000000, 0 },
+    { 0x004F0058, -1 }, { 0x0106011C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005900FA, -1 }, { 0x007800F8, -1 }, { 0x00000000, 0 },
+    { 0x010A00D8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570113, -1 }, { 0x20190117, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40152, -1 }, { 0x0102014E, -1 },
+    { 0x01620078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D40054, -1 },
+    { 0x00000000, 0 }, { 0x01660177, -1 }, { 0x0106010A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900E8, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0022011B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570101, -1 }, { 0x20130162, -1 }, { 0x20190105, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00C1, -2 },
+    { 0x00502039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760067, -1 },
+    { 0x005900D6, -1 }, { 0x20180067, -1 }, { 0x00560063, -1 }, { 0x005000C0, -1 },
+    { 0x002E004F, -1 }, { 0x0164017E, -1 }, { 0x00220109, -2 }, { 0x00000000, 0 },
+    { 0x201C0166, 1 }, { 0x201900F3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01620054, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01660153, -2 }, { 0x00000000, 0 }, { 0x00270151, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900C4, -2 }, { 0x014E0041, -1 },
+    { 0x00000000, 0 }, { 0x00FF201E, -1 }, { 0x00000000, 0 }, { 0x00A10162, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F80076, -1 }, { 0x201900E1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0056, -2 }, { 0x00C4011C, -1 },
+    { 0x00DE2039, -1 }, { 0x0159002C, -5 }, { 0x0178016D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010600D4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE00C0, -1 }, { 0x01760043, -1 }, { 0x00000000, 0 },
+    { 0x0056003F, 1 }, { 0x002E016E, -1 }, { 0x0072010D, -1 }, { 0x0165201C, 3 },
+    { 0x00C0014E, -1 }, { 0x002200E5, -1 }, { 0x013900D3, -1 }, { 0x00000000, 0 },
+    { 0x00D300C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01620173, -1 },
+    { 0x00C4010A, -1 }, { 0x01020106, -1 }, { 0x0178015B, -1 }, { 0x00000000, 0 },
+    { 0x01530077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20180174, 1 }, { 0x01100164, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0153, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0166011D, -2 }, { 0x00000000, 0 }, { 0x0027011B, -2 }, { 0x00000000, 0 },
+    { 0x0076201E, -1 }, { 0x00000000, 0 }, { 0x20180162, 1 }, { 0x007200E9, -1 },
+    { 0x00000000, 0 }, { 0x006F0076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002200C1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540177, -1 },
+    { 0x00510104, -1 }, { 0x00D0002C, -1 }, { 0x0162014F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0067, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0166010B, -2 }, { 0x00000000, 0 }, { 0x00270109, -2 },
+    { 0x01410027, -2 }, { 0x01760150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D60100, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C400D4, -1 }, { 0x00000000, 0 }, { 0x013D0059, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016600F9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00106, -1 }, { 0x01752019, 1 },
+    { 0x201C00FA, -1 }, { 0x00000000, 0 }, { 0x00540153, -2 }, { 0x00F20079, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00260059, -1 },
+    { 0x00C1004F, -1 }, { 0x00DD011D, -1 }, { 0x013D0047, -1 }, { 0x01590115, -1 },
+    { 0x016600E7, -2 }, { 0x00C5014E, -1 }, { 0x002700E5, -1 }, { 0x01780113, -1 },
+    { 0x00000000, 0 }, { 0x00D800C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01640100, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C00E8, -2 }, { 0x00570071, -1 },
+    { 0x20190075, -1 }, { 0x00000000, 0 }, { 0x0108004F, -1 }, { 0x013D0178, -1 },
+    { 0x00DD010B, -1 }, { 0x01590103, -1 }, { 0x0072201A, -5 }, { 0x01620119, -2 },
+    { 0x010C014E, -1 }, { 0x01780101, -1 }, { 0x016600D5, -1 }, { 0x201D0174, 1 },
+    { 0x00000000, 0 }, { 0x00BF0056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190063, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00260178, -1 }, { 0x013D0166, -1 }, { 0x00DD00F9, -1 }, { 0x00FF0027, 1 },
+    { 0x01620107, -2 }, { 0x201D0162, 1 }, { 0x010F006C, 1 }, { 0x016600C3, -2 },
+    { 0x01410122, -1 }, { 0x002700C1, -2 }, { 0x005A2039, -1 }, { 0x01760108, -1 },
+    { 0x00000000, 0 }, { 0x00560104, -1 }, { 0x00D5002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00220067, -1 },
+    { 0x00000000, 0 }, { 0x201C00C4, -2 }, { 0x0054011D, -2 }, { 0x00000000, 0 },
+    { 0x00462026, -2 }, { 0x00E600FD, -1 }, { 0x00260166, -2 }, { 0x00DD00E7, -1 },
+    { 0x016200F5, -2 }, { 0x00000000, 0 }, { 0x201A00DD, -2 }, { 0x00000000, 0 },
+    { 0x004F00C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00FD002E, -1 }, { 0x015700F8, -1 }, { 0x017600F6, -1 }, { 0x005600F2, -1 },
+    { 0x201800F6, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01390043, -1 }, { 0x01550111, -1 }, { 0x0054010B, -2 },
+    { 0x0174010F, -1 }, { 0x00AB0162, -1 }, { 0x016200E3, -2 }, { 0x0177003F, 1 },
+    { 0x00000000, 0 }, { 0x00DD00D5, -1 }, { 0x00000000, 0 }, { 0x005800C7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50106, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013800E8, -1 }, { 0x00590153, -1 },
+    { 0x005600E0, -1 }, { 0x00780151, -1 }, { 0x015700E6, -1 }, { 0x017600E4, -1 },
+    { 0x201800E4, -1 }, { 0x01390174, -1 }, { 0x00D42026, -1 }, { 0x0150201E, -1 },
+    { 0x00D30164, -1 }, { 0x005400F9, -1 }, { 0x00760027, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00C3, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014D0175, -1 }, { 0x010C0106, -1 }, { 0x00000000, 0 },
+    { 0x00632019, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017600D2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x011000C2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00220174, 1 }, { 0x0077201A, -1 },
+    { 0x01390162, -1 }, { 0x017400EB, -1 }, { 0x005400E7, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C00D3, -1 }, { 0x00C40056, -1 }, { 0x013D011E, -1 },
+    { 0x01762039, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x017600C0, -2 }, { 0x00000000, 0 }, { 0x201800C0, -2 },
+    { 0x01622026, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040027, -2 },
+    { 0x00220162, 1 }, { 0x01390150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005400D5, -1 }, { 0x014C00C5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013D010C, -1 }, { 0x00000000, 0 }, { 0x00DA002C, -1 }, { 0x01750022, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00270067, -1 }, { 0x01000059, -2 }, { 0x00000000, 0 }, { 0x0059011D, -1 },
+    { 0x0078011B, -1 }, { 0x01622014, -1 }, { 0x00EB00FD, -1 }, { 0x201E0051, -1 },
+    { 0x00000000, 0 }, { 0x0041014E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005400C3, -2 }, { 0x20130054, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00F6, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000047, -1 }, { 0x00000000, 0 },
+    { 0x0059010B, -1 }, { 0x00780109, -1 }, { 0x010E201E, -1 }, { 0x011300FF, -1 },
+    { 0x014C201A, -1 }, { 0x00E80078, -1 }, { 0x01640070, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0141201D, -2 },
+    { 0x0168002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x011B0077, -1 }, { 0x01780071, -1 }, { 0x201D00E4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000178, -2 }, { 0x00460041, -1 },
+    { 0x00D92026, -1 }, { 0x00D80164, -1 }, { 0x005900F9, -1 }, { 0x0155201E, -5 },
+    { 0x201E0170, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00A10054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0051002C, -1 }, { 0x00000000, 0 }, { 0x01620077, -1 },
+    { 0x013D00D6, -1 }, { 0x00000000, 0 }, { 0x01590061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00270174, 1 },
+    { 0x01000166, -2 }, { 0x006200FD, -1 }, { 0x00C20027, -2 }, { 0x005900E7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040122, -1 },
+    { 0x017B2039, -1 }, { 0x00000000, 0 }, { 0x01390108, -1 }, { 0x00000000, 0 },
+    { 0x00570100, -1 }, { 0x0079002E, -1 }, { 0x20190104, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01620065, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00C0, -2 }, { 0x00D40041, -1 }, { 0x00000000, 0 }, { 0x01660164, 1 },
+    { 0x00000000, 0 }, { 0x00270162, 1 }, { 0x00000000, 0 }, { 0x013B00DD, -1 },
+    { 0x201E014C, -1 }, { 0x005900D5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410106, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201900F2, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0178017E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00502026, -4 }, { 0x00F000FD, -1 },
+    { 0x004F0164, -1 }, { 0x01660152, -1 }, { 0x00000000, 0 }, { 0x013E013E, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900C3, -2 }, { 0x20180054, 1 },
+    { 0x00000000, 0 }, { 0x00FF201D, 1 }, { 0x013D2019, -2 }, { 0x0164016B, -1 },
+    { 0x002200F6, -2 }, { 0x00630022, 1 }, { 0x0155006F, -1 }, { 0x201900E0, -2 },
+    { 0x201C0153, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0055, -1 },
+    { 0x01620041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A016C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010600D3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014E002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002200E4, -1 }, { 0x013900D2, -1 },
+    { 0x00000000, 0 }, { 0x00D300C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0043, -1 }, { 0x00DE2026, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01530076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C20122, -1 }, { 0x0100011E, -1 }, { 0x01760173, -1 },
+    { 0x00000000, 0 }, { 0x20180173, -1 }, { 0x0056002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002C0174, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0152, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0166011C, -1 }, { 0x00000000, 0 }, { 0x0100010C, -1 },
+    { 0x0076201D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007200E8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C30059, -2 }, { 0x002200C0, -2 }, { 0x013F0051, -1 }, { 0x016C2026, -1 },
+    { 0x014C0166, -1 }, { 0x00EF0029, 1 }, { 0x002C0162, -2 }, { 0x0162014E, -1 },
+    { 0x201C011D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0166010A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01380153, -1 }, { 0x01570151, -1 },
+    { 0x0176014F, -1 }, { 0x2018014F, -2 }, { 0x00000000, 0 }, { 0x01640123, -2 },
+    { 0x00000000, 0 }, { 0x00C30047, -1 }, { 0x00000000, 0 }, { 0x00552026, -1 },
+    { 0x00F500FD, -1 }, { 0x00540164, 1 }, { 0x01550027, 1 }, { 0x002C0150, -1 },
+    { 0x004B014E, -1 }, { 0x00C400D3, -1 }, { 0x201C010B, -2 }, { 0x00000000, 0 },
+    { 0x00580120, -1 }, { 0x201D0054, 1 }, { 0x0104201D, -2 }, { 0x016600F8, -2 },
+    { 0x00000000, 0 }, { 0x002700F6, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010A0047, -1 }, { 0x00C30178, -2 }, { 0x01640111, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00F9, -1 }, { 0x00540152, -1 }, { 0x00F20078, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD011C, -1 }, { 0x00F60177, -1 }, { 0x01150175, -1 }, { 0x0172002C, -1 },
+    { 0x00000000, 0 }, { 0x016600E6, -2 }, { 0x00000000, 0 }, { 0x002700E4, -1 },
+    { 0x010000D6, -1 }, { 0x00000000, 0 }, { 0x00D800C2, -1 }, { 0x203A0059, -2 },
+    { 0x00000000, 0 }, { 0x00500041, -1 }, { 0x016400FF, -1 }, { 0x00C30166, -2 },
+    { 0x00660029, 1 }, { 0x00000000, 0 }, { 0x201C00E7, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00AB0054, -1 }, { 0x00C70122, -1 },
+    { 0x00000000, 0 }, { 0x00DD010A, -1 }, { 0x01780100, -2 }, { 0x00722019, 1 },
+    { 0x201D0173, -1 }, { 0x010F007D, 4 }, { 0x014D0079, -1 }, { 0x016600D4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0157011B, -1 }, { 0x01760119, -1 },
+    { 0x00560115, -1 }, { 0x20180119, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x013F014C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01620106, -1 }, { 0x00000000, 0 }, { 0x00DD00F8, -1 }, { 0x013D0022, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010F006B, 1 }, { 0x00000000, 0 },
+    { 0x016600C2, -2 }, { 0x00000000, 0 }, { 0x002700C0, -2 }, { 0x00DE0041, -1 },
+    { 0x00FD003F, 1 }, { 0x0138010B, -1 }, { 0x00560103, -1 }, { 0x01570109, -1 },
+    { 0x01760107, -1 }, { 0x20180107, -2 }, { 0x203A0178, -2 }, { 0x00000000, 0 },
+    { 0x01390054, -1 }, { 0x201C00C3, -2 }, { 0x00000000, 0 }, { 0x0054011C, -1 },
+    { 0x00C2201D, -2 }, { 0x002C0108, -1 }, { 0x004B0106, -1 }, { 0x01002019, -2 },
+    { 0x00DD00E6, -1 }, { 0x016200F4, -2 }, { 0x005800D8, -1 }, { 0x201A00DC, -1 },
+    { 0x201D014F, -2 }, { 0x004F00C2, -1 }, { 0x004C004F, -1 }, { 0x00BF0174, -1 },
+    { 0x00D6201E, -1 }, { 0x01060043, -1 }, { 0x017600F5, -1 }, { 0x201800F5, -2 },
+    { 0x203A0166, -2 }, { 0x00000000, 0 }, { 0x002E00DD, -2 }, { 0x00000000, 0 },
+    { 0x004400C5, -1 }, { 0x00220054, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0054010A, -1 }, { 0x00D00102, -1 }, { 0x00000000, 0 }, { 0x016200E2, -2 },
+    { 0x00000000, 0 }, { 0x00DD00D4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00BF0162, -1 }, { 0x013800E7, -1 }, { 0x00590152, -1 },
+    { 0x015700E5, -1 }, { 0x017600E3, -1 }, { 0x201800E3, -1 }, { 0x00000000, 0 },
+    { 0x00C3011E, -1 }, { 0x0104004A, 3 }, { 0x00000000, 0 }, { 0x0177002C, -1 },
+    { 0x2019016F, -1 }, { 0x005400F8, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00C2, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0164201E, -2 }, { 0x00000000, 0 },
+    { 0x0044201A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D200C5, -1 }, { 0x010A011E, -1 },
+    { 0x011000C1, -1 }, { 0x00000000, 0 }, { 0x00C3010C, -1 }, { 0x00220173, -1 },
+    { 0x00772019, 1 }, { 0x017400EA, -1 }, { 0x00000000, 0 }, { 0x005400E6, -2 },
+    { 0x00000000, 0 }, { 0x002C00D2, -1 }, { 0x00000000, 0 }, { 0x01020051, -1 },
+    { 0x00000000, 0 }, { 0x201D0119, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01060150, -1 }, { 0x0166007A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010A010C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x2019014B, -1 },
+    { 0x005400D4, -1 }, { 0x014C00C4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C40043, -1 }, { 0x01762026, -2 }, { 0x00D2201A, -1 }, { 0x201D0107, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x014100C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0059011C, -1 }, { 0x007B004A, 3 }, { 0x01622013, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0022014F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005400C2, -2 }, { 0x00000000, 0 },
+    { 0x00C40174, -1 }, { 0x00DB201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00F5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00270054, 1 }, { 0x00430122, -1 },
+    { 0x00C2004A, 1 }, { 0x0059010A, -1 }, { 0x00D50102, -1 }, { 0x00000000, 0 },
+    { 0x00720022, 1 }, { 0x00E80077, -1 }, { 0x00C300D6, -1 }, { 0x0164006F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0057, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C40162, -2 }, { 0x00000000, 0 },
+    { 0x00DD007A, -1 }, { 0x011B0076, -1 }, { 0x01780070, -1 }, { 0x201D00E3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0155201D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900F8, -1 }, { 0x007800F6, -1 },
+    { 0x00720153, -1 }, { 0x010A00D6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C00051, -1 }, { 0x00000000, 0 }, { 0x00570111, -1 },
+    { 0x0079003F, 1 }, { 0x20190115, -2 }, { 0x00000000, 0 }, { 0x00C40150, -1 },
+    { 0x0102014C, -1 }, { 0x00C100DD, -2 }, { 0x013D00D5, -1 }, { 0x01620076, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010C00AB, -1 }, { 0x01060108, -1 },
+    { 0x00270173, -1 }, { 0x0046002E, -2 }, { 0x01000022, -2 }, { 0x01660175, -1 },
+    { 0x005900E6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00220119, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190103, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01620064, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C32019, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005900D4, -1 }, { 0x01760065, -1 }, { 0x00560061, -1 },
+    { 0x0164017C, -1 }, { 0x20180065, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00220107, -2 }, { 0x201C0164, 1 }, { 0x00000000, 0 }, { 0x0054007A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D4002E, -1 },
+    { 0x00000000, 0 }, { 0x01660151, -2 }, { 0x00000000, 0 }, { 0x0027014F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900C2, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00440166, -1 }, { 0x002200F5, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x014C0058, -1 }, { 0x00000000, 0 }, { 0x002C0054, -2 },
+    { 0x00000000, 0 }, { 0x0178016B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00770022, 1 }, { 0x00000000, 0 }, { 0x010600D2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760041, -2 },
+    { 0x00000000, 0 }, { 0x0072010B, -1 }, { 0x20180041, -2 }, { 0x002E016C, -1 },
+    { 0x00000000, 0 }, { 0x00C0014C, -1 }, { 0x002200E3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D300C1, -1 }, { 0x01062039, -1 }, { 0x00000000, 0 },
+    { 0x01620171, -1 }, { 0x00C40108, -1 }, { 0x0162002E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01150079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C50051, -1 }, { 0x00000000, 0 },
+    { 0x016E201E, -1 }, { 0x00000000, 0 }, { 0x00D20166, -1 }, { 0x01100162, -1 },
+    { 0x01640146, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0162015F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0151, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010C0051, -1 }, { 0x0166011B, -2 }, { 0x00270119, -2 },
+    { 0x00000000, 0 }, { 0x0057201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007200E7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010400C7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540175, -1 }, { 0x00510102, -1 }, { 0x00000000, 0 }, { 0x0162014D, -2 },
+    { 0x0165007D, 5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0065, -2 }, { 0x00000000, 0 }, { 0x01660109, -2 }, { 0x00000000, 0 },
+    { 0x00DC201A, -1 }, { 0x00270107, -2 }, { 0x0176014E, -1 }, { 0x00000000, 0 },
+    { 0x0059007A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01640122, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D9002E, -1 }, { 0x010F2019, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C400D2, -1 }, { 0x00000000, 0 }, { 0x013D0057, -1 },
+    { 0x01780123, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00EA00FF, -1 }, { 0x00000000, 0 }, { 0x002700F5, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00F8, -2 }, { 0x00000000, 0 }, { 0x00540151, -2 },
+    { 0x00F20077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00260057, -1 }, { 0x00DD011B, -1 }, { 0x01590113, -1 }, { 0x016A201A, -1 },
+    { 0x01780111, -1 }, { 0x016600E5, -2 }, { 0x00C5014C, -1 }, { 0x002700E3, -1 },
+    { 0x010000D5, -1 }, { 0x201D0041, -2 }, { 0x00D800C1, -1 }, { 0x203A0058, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C30022, -2 }, { 0x00000000, 0 }, { 0x201C00E6, -1 },
+    { 0x0057006F, -1 }, { 0x20190073, -1 }, { 0x00000000, 0 }, { 0x01620117, -2 },
+    { 0x013D0176, -1 }, { 0x00DD0109, -1 }, { 0x01590101, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010C014C, -1 }, { 0x014D0078, -1 }, { 0x016600D3, -1 },
+    { 0x00000000, 0 }, { 0x00C200C7, -1 }, { 0x00BF0054, -1 }, { 0x00000000, 0 },
+    { 0x01510177, -1 }, { 0x014E0104, -1 }, { 0x00000000, 0 }, { 0x0050002E, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0166203A, -1 }, { 0x20190061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00260176, -1 }, { 0x013D0164, -1 }, { 0x01620105, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016600C1, -2 }, { 0x01410120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01760106, -1 }, { 0x00000000, 0 }, { 0x00560102, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00220065, -2 }, { 0x201C00C2, -2 }, { 0x0054011B, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016200F3, -2 }, { 0x00260164, -2 },
+    { 0x00DD00E5, -1 }, { 0x013D0152, -1 }, { 0x00000000, 0 }, { 0x201A00DB, -1 },
+    { 0x00000000, 0 }, { 0x004F00C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE002E, -4 }, { 0x00FD002C, -1 }, { 0x013800F8, -1 },
+    { 0x015700F6, -1 }, { 0x017600F4, -1 }, { 0x002E00DC, -1 }, { 0x201800F4, -2 },
+    { 0x00000000, 0 }, { 0x004400C4, -1 }, { 0x00410051, -1 }, { 0x0155010F, -1 },
+    { 0x00540109, -2 }, { 0x0174010D, -1 }, { 0x00000000, 0 }, { 0x016200E1, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00D3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015700E4, -1 },
+    { 0x00590151, -1 }, { 0x0078014F, -1 }, { 0x017600E2, -1 }, { 0x201800E2, -1 },
+    { 0x00DD203A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00220041, -2 },
+    { 0x00000000, 0 }, { 0x00D30162, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00C1, -2 },
+    { 0x00000000, 0 }, { 0x0118004A, 2 }, { 0x00000000, 0 }, { 0x016C002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D200C4, -1 },
+    { 0x011000C0, -1 }, { 0x00000000, 0 }, { 0x0178201E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015500EB, -1 }, { 0x017400E9, -1 }, { 0x005400E5, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C700C7, -1 }, { 0x00C40054, -2 },
+    { 0x013D011C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0055002E, -1 }, { 0x010F0022, 3 }, { 0x01660079, -1 }, { 0x014100D8, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0139014E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005400D3, -1 }, { 0x014C00C3, -1 }, { 0x00000000, 0 },
+    { 0x016200AB, -2 }, { 0x013D010A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660067, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00270065, -2 }, { 0x0054203A, -1 },
+    { 0x0059011B, -1 }, { 0x00780119, -1 }, { 0x01000057, -1 }, { 0x201E004F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041014C, -1 }, { 0x00000000, 0 },
+    { 0x017400C5, -1 }, { 0x20190138, -1 }, { 0x005400C1, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B00AB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D00F4, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590109, -1 }, { 0x00780107, -1 }, { 0x00F400FF, -1 },
+    { 0x011300FD, -1 }, { 0x00000000, 0 }, { 0x00E80076, -1 }, { 0x00C300D5, -1 },
+    { 0x0164006E, -1 }, { 0x00000000, 0 }, { 0x201C0056, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01590071, -1 }, { 0x0178006F, -1 }, { 0x201D00E2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660043, -1 }, { 0x01000176, -2 },
+    { 0x00270041, -2 }, { 0x0046003F, 1 }, { 0x00D80162, -1 }, { 0x007800F5, -1 },
+    { 0x0174201A, -1 }, { 0x201E016E, -1 }, { 0x010A00D5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00440058, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01620075, -1 }, { 0x013D00D4, -1 }, { 0x00DD0067, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01000164, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005900E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01040120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01390106, -1 },
+    { 0x00000000, 0 }, { 0x0079002C, -1 }, { 0x20190102, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01620063, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580047, -1 }, { 0x00000000, 0 },
+    { 0x0066201E, -1 }, { 0x01660162, 1 }, { 0x01000152, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01760064, -1 }, { 0x005900D3, -1 }, { 0x00D20058, -1 },
+    { 0x01100054, -1 }, { 0x20180064, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01620051, -1 },
+    { 0x0059203A, -1 }, { 0x00DD0043, -1 }, { 0x0178017C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004F0162, -1 }, { 0x01660150, -1 }, { 0x00000000, 0 },
+    { 0x013E013C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900C1, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005000AB, -1 }, { 0x01640169, -1 },
+    { 0x01640026, -1 }, { 0x002200F4, -2 }, { 0x00000000, 0 }, { 0x201C0151, -2 },
+    { 0x00000000, 0 }, { 0x00540067, -2 }, { 0x00EF005D, 1 }, { 0x00000000, 0 },
+    { 0x004B0051, -1 }, { 0x0162003F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201A016A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C00DD, -1 }, { 0x00000000, 0 }, { 0x004300C7, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014E002C, -1 }, { 0x01652019, 3 },
+    { 0x01640157, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002200E2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D300C0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0162002D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01150078, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C20120, -1 }, { 0x0100011C, -1 },
+    { 0x00DE00AB, -1 }, { 0x01190177, -1 }, { 0x0176002E, -2 }, { 0x007200F8, -1 },
+    { 0x01760171, -1 }, { 0x20180171, -1 }, { 0x010400D8, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540043, -1 }, { 0x002C0172, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0150, -1 }, { 0x01780146, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0100010A, -1 }, { 0x0176015F, -1 }, { 0x00000000, 0 }, { 0x2018015F, -1 },
+    { 0x00000000, 0 }, { 0x007200E6, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0066005D, 1 }, { 0x00C30057, -1 }, { 0x013F004F, -1 },
+    { 0x201C011B, -2 }, { 0x014C0164, -1 }, { 0x007000FF, -1 }, { 0x0162014C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0064, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660108, -1 },
+    { 0x00000000, 0 }, { 0x00460104, -1 }, { 0x00000000, 0 }, { 0x01380151, -1 },
+    { 0x0157014F, -1 }, { 0x0176014D, -1 }, { 0x2018014D, -2 }, { 0x00000000, 0 },
+    { 0x01640121, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010F2018, 3 }, { 0x201C0109, -2 }, { 0x00540162, 1 }, { 0x00000000, 0 },
+    { 0x002C014E, -1 }, { 0x004B014C, -1 }, { 0x00000000, 0 }, { 0x013D0056, -1 },
+    { 0x01780122, -1 }, { 0x0058011E, -1 }, { 0x201A0122, -1 }, { 0x00000000, 0 },
+    { 0x016600F6, -2 }, { 0x00000000, 0 }, { 0x002700F4, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590067, -1 }, { 0x00780065, -1 },
+    { 0x00000000, 0 }, { 0x0164010F, -2 }, { 0x00C30176, -2 }, { 0x00000000, 0 },
+    { 0x00FE00FF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540150, -1 },
+    { 0x00F20076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00260056, -1 }, { 0x00000000, 0 }, { 0x00F60175, -1 }, { 0x0058010C, -1 },
+    { 0x00D40104, -1 }, { 0x00000000, 0 }, { 0x016600E4, -2 }, { 0x00000000, 0 },
+    { 0x002700E2, -1 }, { 0x00C200D8, -1 }, { 0x010000D4, -1 }, { 0x00D800C0, -1 },
+    { 0x20180129, 2 }, { 0x203A0057, -1 }, { 0x00000000, 0 }, { 0x016400FD, -1 },
+    { 0x00C30164, -2 }, { 0x00660027, 2 }, { 0x00000000, 0 }, { 0x201C00E5, -1 },
+    { 0x00000000, 0 }, { 0x20190072, -1 }, { 0x00000000, 0 }, { 0x00C70120, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0108, -1 }, { 0x201D0171, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014D0077, -1 }, { 0x016600D2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0138011B, -1 },
+    { 0x01570119, -1 }, { 0x00560113, -1 }, { 0x00590043, -1 }, { 0x01760117, -1 },
+    { 0x016400EB, -2 }, { 0x00C30152, -1 }, { 0x20180117, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D30054, -1 }, { 0x01662039, -2 },
+    { 0x00000000, 0 }, { 0x01620104, -2 }, { 0x00000000, 0 }, { 0x00DD00F6, -1 },
+    { 0x201D015F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016600C0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01380109, -1 }, { 0x01570107, -1 }, { 0x01760105, -1 }, { 0x00560101, -1 },
+    { 0x010A0152, -1 }, { 0x20180105, -1 }, { 0x203A0176, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00220064, -2 }, { 0x01360122, -1 }, { 0x201C00C1, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0106, -1 }, { 0x016200F2, -2 },
+    { 0x01650022, 3 }, { 0x00DD00E4, -1 }, { 0x201D014D, -2 }, { 0x005800D6, -1 },
+    { 0x201A00DA, -1 }, { 0x00000000, 0 }, { 0x004F00C0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013B0027, -2 }, { 0x015700F5, -1 },
+    { 0x017600F3, -1 }, { 0x201800F3, -2 }, { 0x203A0164, -2 }, { 0x002E00DB, -1 },
+    { 0x016400C7, -1 }, { 0x004400C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005A00AB, -1 }, { 0x00540108, -1 }, { 0x00D00100, -1 }, { 0x01662015, -1 },
+    { 0x016200E0, -2 }, { 0x00000000, 0 }, { 0x00DD00D2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015700E3, -1 },
+    { 0x00590150, -1 }, { 0x017600E1, -1 }, { 0x201800E1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD2039, -2 }, { 0x00C3011C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x2019016D, -1 }, { 0x005400F6, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C700D8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD00C0, -2 }, { 0x201D0129, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D200C3, -1 },
+    { 0x00000000, 0 }, { 0x010A011C, -1 }, { 0x00000000, 0 }, { 0x00C3010A, -1 },
+    { 0x00220171, -1 }, { 0x00000000, 0 }, { 0x015500EA, -1 }, { 0x017400E8, -1 },
+    { 0x005400E4, -2 }, { 0x2019015B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0102004F, -1 }, { 0x00000000, 0 }, { 0x01102026, -1 }, { 0x201D0117, -2 },
+    { 0x00000000, 0 }, { 0x010F0021, 3 }, { 0x0106014E, -1 }, { 0x01660078, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D80054, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010A010A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0022015F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005400D2, -1 }, { 0x014C00C2, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01572026, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D0105, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00270064, -2 }, { 0x01000056, -1 },
+    { 0x00542039, -2 }, { 0x013B0122, -1 }, { 0x017600AB, -2 }, { 0x00500104, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0022014D, -2 },
+    { 0x00000000, 0 }, { 0x017400C4, -1 }, { 0x201C0067, -1 }, { 0x005400C0, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D00F3, -2 }, { 0x00000000, 0 }, { 0x010F0140, 1 },
+    { 0x00000000, 0 }, { 0x01660054, 1 }, { 0x00000000, 0 }, { 0x00430120, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590108, -1 }, { 0x00D50100, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0164006D, -1 }, { 0x00C300D4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0178006E, -1 }, { 0x201D00E1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F0054, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE0104, -1 }, { 0x00000000, 0 }, { 0x00542015, -1 },
+    { 0x005900F6, -1 }, { 0x00720151, -1 }, { 0x007800F4, -1 }, { 0x010A00D4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00220129, 2 }, { 0x00C0004F, -1 },
+    { 0x0057010F, -1 }, { 0x014F00FF, -1 }, { 0x20190113, -2 }, { 0x00000000, 0 },
+    { 0x00C4014E, -1 }, { 0x00000000, 0 }, { 0x013D00D3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660173, -1 },
+    { 0x01060106, -1 }, { 0x00270171, -1 }, { 0x0046002C, -2 }, { 0x00000000, 0 },
+    { 0x01760075, -1 }, { 0x005900E4, -1 }, { 0x00560071, -1 }, { 0x20180075, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00220117, -2 },
+    { 0x201C0174, 1 }, { 0x00000000, 0 }, { 0x20190101, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0066201D, 2 }, { 0x00000000, 0 }, { 0x0027015F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900D2, -1 }, { 0x01570065, -1 },
+    { 0x01760063, -1 }, { 0x0164017A, -1 }, { 0x20180063, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00220105, -1 }, { 0x201C0162, 1 }, { 0x005700EB, -1 },
+    { 0x00000000, 0 }, { 0x00540078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00592039, -2 }, { 0x017B00AB, -1 }, { 0x00000000, 0 },
+    { 0x00D4002C, -1 }, { 0x00000000, 0 }, { 0x0166014F, -2 }, { 0x00000000, 0 },
+    { 0x0027014D, -2 }, { 0x004300D8, -1 }, { 0x00000000, 0 }, { 0x01760051, -1 },
+    { 0x005900C0, -2 }, { 0x0072011B, -1 }, { 0x01100041, -1 }, { 0x00FF201A, -1 },
+    { 0x00000000, 0 }, { 0x00440164, -1 }, { 0x002200F3, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0173, -1 }, { 0x01780169, -1 },
+    { 0x01780026, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01410059, -1 }, { 0x00000000, 0 },
+    { 0x0176003F, 1 }, { 0x00000000, 0 }, { 0x00720109, -1 }, { 0x01652018, 3 },
+    { 0x002E016A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002200E1, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540054, 1 },
+    { 0x00000000, 0 }, { 0x00E60177, -1 }, { 0x00C40106, -1 }, { 0x013B201D, -2 },
+    { 0x0162002C, -2 }, { 0x0162016F, -1 }, { 0x00F60079, -1 }, { 0x01150077, -1 },
+    { 0x01780157, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00270129, 2 },
+    { 0x00C5004F, -1 }, { 0x00D32026, -1 }, { 0x01410047, -1 }, { 0x00D20164, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01640144, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD014F, -1 }, { 0x00000000, 0 }, { 0x201D0075, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010C004F, -1 }, { 0x01410178, -1 },
+    { 0x00270117, -2 }, { 0x01660119, -2 }, { 0x0076201A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007200E5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C30056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540173, -1 }, { 0x00510100, -1 }, { 0x00000000, 0 },
+    { 0x0162014B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0063, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01660107, -2 }, { 0x01410166, -1 }, { 0x00270105, -1 }, { 0x0176014C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01640120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D9002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01780121, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00EA00FD, -1 }, { 0x012B0029, 1 }, { 0x002700F3, -2 },
+    { 0x016600F5, -2 }, { 0x00000000, 0 }, { 0x201E00DD, -2 }, { 0x00780064, -1 },
+    { 0x00000000, 0 }, { 0x002E0122, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01740153, -1 }, { 0x201C00F6, -2 },
+    { 0x0054014F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD0119, -1 }, { 0x013D0043, -1 }, { 0x01590111, -1 },
+    { 0x0178010F, -1 }, { 0x00000000, 0 }, { 0x016600E3, -2 }, { 0x00000000, 0 },
+    { 0x002700E1, -1 }, { 0x010000D3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x203A0056, -1 }, { 0x00000000, 0 }, { 0x00EB0177, -1 }, { 0x016400FC, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00E4, -1 }, { 0x20190071, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01620115, -2 }, { 0x013D0174, -1 }, { 0x00D82026, -1 }, { 0x00DD0107, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014D0076, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01510175, -1 }, { 0x014E0102, -1 }, { 0x00000000, 0 },
+    { 0x0050002C, -4 }, { 0x016400EA, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00220075, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00260174, -1 }, { 0x013D0162, -1 },
+    { 0x00C10027, -2 }, { 0x00DD00F5, -1 }, { 0x01620103, -2 }, { 0x017800EB, -1 },
+    { 0x010F0068, 1 }, { 0x00000000, 0 }, { 0x0141011E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01760104, -2 }, { 0x00590173, -1 }, { 0x00560100, -1 },
+    { 0x20180104, -2 }, { 0x00000000, 0 }, { 0x016400D8, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00220063, -2 }, { 0x01390051, -1 },
+    { 0x00540119, -2 }, { 0x00D30041, -1 }, { 0x01662026, -2 }, { 0x01650021, 4 },
+    { 0x00260162, -2 }, { 0x00DD00E3, -1 }, { 0x013D0150, -1 }, { 0x201C00C0, -2 },
+    { 0x005800D5, -1 }, { 0x015000C5, -1 }, { 0x201A00D9, -1 }, { 0x00000000, 0 },
+    { 0x0141010C, -1 }, { 0x00620177, -1 }, { 0x00DE002C, -4 }, { 0x013800F6, -1 },
+    { 0x015700F4, -1 }, { 0x017600F2, -1 }, { 0x201800F2, -2 }, { 0x002E00DA, -1 },
+    { 0x00000000, 0 }, { 0x01040059, -2 }, { 0x004400C2, -1 }, { 0x0041004F, -1 },
+    { 0x0155010D, -1 }, { 0x004F2026, -1 }, { 0x00540107, -2 }, { 0x01662014, -1 },
+    { 0x0174010B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017800C7, -1 },
+    { 0x00000000, 0 }, { 0x201A00C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x015700E2, -1 }, { 0x0059014F, -1 }, { 0x0078014D, -1 }, { 0x017600E0, -1 },
+    { 0x201800E0, -2 }, { 0x00000000, 0 }, { 0x01040047, -1 }, { 0x00000000, 0 },
+    { 0x0150201A, -1 }, { 0x011700FF, -1 }, { 0x00000000, 0 }, { 0x005400F5, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F00177, -1 },
+    { 0x016C002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00D200C2, -1 }, { 0x00000000, 0 }, { 0x01040178, -2 }, { 0x00DD2026, -2 },
+    { 0x0159201E, -5 }, { 0x00000000, 0 }, { 0x015500E9, -1 }, { 0x017400E7, -1 },
+    { 0x005400E3, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016200BB, -1 },
+    { 0x00C10122, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0055002C, -1 }, { 0x00000000, 0 }, { 0x01660077, -1 },
+    { 0x014100D6, -1 }, { 0x00270075, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01040166, -2 }, { 0x00000000, 0 }, { 0x0139014C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010E00C5, -1 }, { 0x01080122, -1 },
+    { 0x014C00C1, -1 }, { 0x00000000, 0 }, { 0x013D0108, -1 }, { 0x00000000, 0 },
+    { 0x201D0104, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01660065, -2 }, { 0x00000000, 0 }, { 0x00270063, -2 },
+    { 0x00C20059, -2 }, { 0x00590119, -1 }, { 0x00780117, -1 }, { 0x00D80041, -1 },
+    { 0x00EE0029, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013F00DD, -1 },
+    { 0x00000000, 0 }, { 0x013600C7, -1 }, { 0x017400C3, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00F2, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C20047, -1 }, { 0x01000043, -1 }, { 0x00542026, -2 }, { 0x00590107, -1 },
+    { 0x00D0201E, -1 }, { 0x00F400FD, -1 }, { 0x010E201A, -1 }, { 0x013E003F, 4 },
+    { 0x00C300D3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0054, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01412019, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0159006F, -1 }, { 0x0178006D, -1 },
+    { 0x201D00E0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660041, -2 },
+    { 0x00C20178, -2 }, { 0x01000174, -1 }, { 0x0155201A, -5 }, { 0x00542014, -1 },
+    { 0x005900F5, -1 }, { 0x007800F3, -1 }, { 0x201E016C, -1 }, { 0x010A00D3, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F50177, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01620073, -2 }, { 0x013D00D2, -1 }, { 0x00000000, 0 },
+    { 0x00DD0065, -1 }, { 0x00000000, 0 }, { 0x20390059, -1 }, { 0x00000000, 0 },
+    { 0x004F0041, -1 }, { 0x00000000, 0 }, { 0x00C20166, -2 }, { 0x01000162, -2 },
+    { 0x00000000, 0 }, { 0x005900E3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0104011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0173, -1 }, { 0x20190100, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01620061, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01000150, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01570064, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0104010C, -1 },
+    { 0x00000000, 0 }, { 0x00220104, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700EA, -1 }, { 0x00540077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0162004F, -1 }, { 0x0178017A, -1 }, { 0x00DD0041, -2 }, { 0x01702026, -1 },
+    { 0x01500166, -1 }, { 0x20390178, -1 }, { 0x0166014E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013E013A, 1 }, { 0x013B00C7, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C1201D, -2 },
+    { 0x00FF2019, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002200F2, -2 },
+    { 0x201C014F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540065, -2 },
+    { 0x00000000, 0 }, { 0x002C0051, -1 }, { 0x004B004F, -1 }, { 0x00592026, -2 },
+    { 0x00C70047, -1 }, { 0x00D5201E, -1 }, { 0x01590027, 1 }, { 0x201A0168, -1 },
+    { 0x20390166, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0110002E, -1 },
+    { 0x00000000, 0 }, { 0x01640155, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002200E0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580152, -1 }, { 0x00F60078, -1 },
+    { 0x01150076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C2011E, -1 },
+    { 0x00000000, 0 }, { 0x01190175, -1 }, { 0x0157002E, -5 }, { 0x0176002C, -2 },
+    { 0x007200F6, -1 }, { 0x0176016F, -1 }, { 0x2018016F, -1 }, { 0x010400D6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540041, -2 }, { 0x002C0170, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DD014E, -1 }, { 0x01780144, -1 }, { 0x00BB00DD, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010600AB, -1 }, { 0x00C2010C, -1 }, { 0x01000108, -1 }, { 0x00762019, 1 },
+    { 0x00000000, 0 }, { 0x01510079, -1 }, { 0x007200E4, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0119, -2 }, { 0x00000000, 0 }, { 0x010E0166, -1 }, { 0x007000FD, -1 },
+    { 0x014C0162, -1 }, { 0x00000000, 0 }, { 0x010200DD, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01660106, -1 }, { 0x00000000, 0 }, { 0x00270104, -2 }, { 0x00460102, -1 },
+    { 0x0138014F, -1 }, { 0x01410022, -2 }, { 0x0157014D, -1 }, { 0x0176014B, -1 },
+    { 0x2018014B, -1 }, { 0x0164011F, -2 }, { 0x00000000, 0 }, { 0x00C30043, -1 },
+    { 0x01752026, -1 }, { 0x00000000, 0 }, { 0x201C0107, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C014C, -1 }, { 0x01620138, -1 }, { 0x00000000, 0 },
+    { 0x013D0054, -1 }, { 0x01780120, -1 }, { 0x201A0120, -1 }, { 0x0058011C, -1 },
+    { 0x00000000, 0 }, { 0x01042019, -2 }, { 0x016600F4, -2 }, { 0x00000000, 0 },
+    { 0x002700F2, -2 }, { 0x00000000, 0 }, { 0x201E00DC, -1 }, { 0x00000000, 0 },
+    { 0x00590065, -1 }, { 0x00780063, -1 }, { 0x010A0043, -1 }, { 0x00C30174, -1 },
+    { 0x00DA201E, -1 }, { 0x00FE00FD, -1 }, { 0x0164010D, -2 }, { 0x201C00F5, -2 },
+    { 0x0054014E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00260054, -2 }, { 0x00C1004A, 1 }, { 0x00000000, 0 },
+    { 0x0058010A, -1 }, { 0x00D40102, -1 }, { 0x00000000, 0 }, { 0x016600E2, -2 },
+    { 0x00000000, 0 }, { 0x002700E0, -2 }, { 0x00C200D6, -1 }, { 0x010000D2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x016400FB, -1 }, { 0x00C30162, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C00E3, -1 }, { 0x00000000, 0 }, { 0x20190070, -1 }, { 0x00000000, 0 },
+    { 0x00C7011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0106, -1 },
+    { 0x017800FC, -1 }, { 0x201D016F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01380119, -1 }, { 0x01570117, -1 }, { 0x00560111, -1 }, { 0x00590041, -2 },
+    { 0x0168201E, -1 }, { 0x016400E9, -2 }, { 0x00C30150, -1 }, { 0x01760115, -1 },
+    { 0x00C000DD, -2 }, { 0x20180115, -2 }, { 0x00D600C5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C7010C, -1 }, { 0x01620102, -2 },
+    { 0x00DD00F4, -1 }, { 0x00FF0022, 1 }, { 0x017800EA, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01060051, -1 },
+    { 0x00000000, 0 }, { 0x00430047, -1 }, { 0x01380107, -1 }, { 0x0051201E, -1 },
+    { 0x01570105, -1 }, { 0x010A0150, -1 }, { 0x01760103, -1 }, { 0x20180103, -1 },
+    { 0x203A0174, -1 }, { 0x00000000, 0 }, { 0x01360120, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C22019, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00E2, -1 }, { 0x017800D8, -1 },
+    { 0x005800D4, -1 }, { 0x015000C4, -1 }, { 0x201A00D8, -1 }, { 0x201D014B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D6201A, -1 }, { 0x013800F5, -1 },
+    { 0x015700F3, -1 }, { 0x203A0162, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E00D9, -1 }, { 0x016400C5, -2 }, { 0x004400C1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540106, -1 }, { 0x00D3002E, -1 },
+    { 0x01662013, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01630027, 1 }, { 0x00000000, 0 },
+    { 0x015700E1, -1 }, { 0x0059014E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E00C7, -1 }, { 0x00000000, 0 }, { 0x00C6004A, 2 },
+    { 0x00000000, 0 }, { 0x017400F8, -1 }, { 0x2019016B, -1 }, { 0x005400F4, -2 },
+    { 0x00760022, 1 }, { 0x00000000, 0 }, { 0x00C700D6, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0164201A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0027, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B006A, 1 },
+    { 0x00D200C1, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0159201D, 1 },
+    { 0x00C30108, -1 }, { 0x0022016F, -1 }, { 0x00000000, 0 }, { 0x015500E8, -1 },
+    { 0x017400E6, -1 }, { 0x005400E2, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C40051, -1 }, { 0x00000000, 0 }, { 0x201D0115, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0106014C, -1 },
+    { 0x01660076, -1 }, { 0x00C500DD, -2 }, { 0x013E0062, 1 }, { 0x014100D5, -1 },
+    { 0x017600BB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010A0108, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01040022, -2 }, { 0x00000000, 0 },
+    { 0x013600D8, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x010E00C4, -1 },
+    { 0x014C00C0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0056201E, -1 }, { 0x201D0103, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01660064, -2 }, { 0x00000000, 0 }, { 0x01000054, -2 },
+    { 0x013B0120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00500102, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0022014B, -1 }, { 0x00000000, 0 }, { 0x017400C2, -1 }, { 0x201C0065, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DB201A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010F013E, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0043011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590106, -1 },
+    { 0x00D8002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C300D2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190123, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E900FF, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01500058, -1 }, { 0x00000000, 0 }, { 0x004C0122, -1 },
+    { 0x00CB004A, 2 }, { 0x00000000, 0 }, { 0x0043010C, -1 }, { 0x00DE0102, -1 },
+    { 0x00542013, -1 }, { 0x005900F4, -1 }, { 0x0072014F, -1 }, { 0x007800F2, -1 },
+    { 0x010A00D2, -1 }, { 0x01552019, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0057010D, -1 }, { 0x014F00FD, -1 }, { 0x20190111, -2 },
+    { 0x201C0041, -2 }, { 0x00C4014C, -1 }, { 0x01620072, -1 }, { 0x00000000, 0 },
+    { 0x00DD0064, -1 }, { 0x00000000, 0 }, { 0x010A2039, -1 }, { 0x0112004A, 2 },
+    { 0x01660171, -1 }, { 0x0166002E, -2 }, { 0x0027016F, -1 }, { 0x00000000, 0 },
+    { 0x00C20022, -2 }, { 0x01190079, -1 }, { 0x005900E2, -1 }, { 0x0056006F, -1 },
+    { 0x007800E0, -1 }, { 0x01760073, -1 }, { 0x01640047, -1 }, { 0x20180073, -1 },
+    { 0x00220115, -2 }, { 0x0172201E, -1 }, { 0x00D60166, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C100C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0166015F, -2 }, { 0x004F002E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013B00D8, -1 }, { 0x00000000, 0 }, { 0x01380065, -1 },
+    { 0x01570063, -1 }, { 0x01760061, -1 }, { 0x20180061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00220103, -1 }, { 0x00000000, 0 },
+    { 0x005700E9, -1 }, { 0x00000000, 0 }, { 0x00540076, -1 }, { 0x010800C7, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0166014D, -2 },
+    { 0x00000000, 0 }, { 0x0027014B, -1 }, { 0x004300D6, -1 }, { 0x00000000, 0 },
+    { 0x0176004F, -1 }, { 0x00000000, 0 }, { 0x00720119, -1 }, { 0x00000000, 0 },
+    { 0x01640166, 1 }, { 0x00000000, 0 }, { 0x00440162, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540064, -2 },
+    { 0x010E0058, -1 }, { 0x014C0054, -1 }, { 0x00000000, 0 }, { 0x00DD0171, -1 },
+    { 0x00DD002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013E0127, 2 },
+    { 0x01410057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00720107, -1 }, { 0x002E0168, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004100DD, -2 }, { 0x00000000, 0 }, { 0x005700C5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E60175, -1 }, { 0x0162016D, -1 },
+    { 0x00DD015F, -1 }, { 0x01780155, -1 }, { 0x00000000, 0 }, { 0x00F60077, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012B005D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016E201A, -1 }, { 0x00000000, 0 },
+    { 0x00D20162, -1 }, { 0x007200F5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010400D5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0163201D, 1 }, { 0x00000000, 0 }, { 0x0162015B, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD014D, -1 }, { 0x00000000, 0 },
+    { 0x201D0073, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660117, -2 },
+    { 0x01410176, -1 }, { 0x00270115, -2 }, { 0x0177201E, -1 }, { 0x0057201A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007200E3, -1 }, { 0x01510078, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C30054, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C201D, -2 }, { 0x0054002E, -2 },
+    { 0x00540171, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0061, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01660105, -2 }, { 0x01410164, -1 }, { 0x00270103, -1 },
+    { 0x006500FF, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0164011E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054015F, -2 },
+    { 0x01550022, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0178011F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x016600F3, -2 }, { 0x01410152, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01760138, -1 }, { 0x201E00DB, -1 },
+    { 0x00590064, -1 }, { 0x20180138, -1 }, { 0x002E0120, -1 }, { 0x0164010C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01550153, -1 },
+    { 0x01740151, -1 }, { 0x0054014D, -2 }, { 0x201C00F4, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0117, -1 }, { 0x0159010F, -1 },
+    { 0x00722026, -5 }, { 0x00F300FF, -1 }, { 0x0178010D, -1 }, { 0x016600E1, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C200D5, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x203A0054, -2 }, { 0x00000000, 0 }, { 0x00EB0175, -1 },
+    { 0x016400FA, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00E2, -1 }, { 0x2019006F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01620113, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD0105, -1 }, { 0x017800FB, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01130177, -1 }, { 0x01100104, -1 },
+    { 0x014E0100, -1 }, { 0x0170002E, -1 }, { 0x016400E8, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00220073, -1 }, { 0x00000000, 0 }, { 0x00D600C4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01620101, -2 },
+    { 0x00000000, 0 }, { 0x00DD00F3, -1 }, { 0x015900EB, -1 }, { 0x017800E9, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0141011C, -1 }, { 0x00000000, 0 }, { 0x01760102, -2 }, { 0x00590171, -1 },
+    { 0x0059002E, -2 }, { 0x20180102, -2 }, { 0x00000000, 0 }, { 0x016400D6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00220061, -1 },
+    { 0x0139004F, -1 }, { 0x00540117, -2 }, { 0x0174011B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013D014E, -1 }, { 0x00DD00E1, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005800D3, -1 }, { 0x015000C3, -1 }, { 0x00000000, 0 },
+    { 0x016600AB, -2 }, { 0x0141010A, -1 }, { 0x00620175, -1 }, { 0x013800F4, -1 },
+    { 0x0059015F, -1 }, { 0x015700F2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E00D8, -1 }, { 0x016400C4, -2 }, { 0x01040057, -1 }, { 0x004400C0, -1 },
+    { 0x0155010B, -1 }, { 0x01740109, -1 }, { 0x00000000, 0 }, { 0x00540105, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x017800C5, -2 }, { 0x201D0138, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x015700E0, -1 }, { 0x0059014D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00720065, -1 }, { 0x00EE005D, 1 }, { 0x01290129, 3 },
+    { 0x00000000, 0 }, { 0x00772026, -1 }, { 0x00F800FF, -1 }, { 0x011700FD, -1 },
+    { 0x005400F3, -2 }, { 0x01770027, 1 }, { 0x00000000, 0 }, { 0x00C700D5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00F00175, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00D200C0, -1 }, { 0x00000000, 0 }, { 0x01040176, -2 },
+    { 0x0178201A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015500E7, -1 },
+    { 0x017400E5, -1 }, { 0x005400E1, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C10120, -1 }, { 0x00000000, 0 }, { 0x00DD00AB, -2 },
+    { 0x0175002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01660075, -1 }, { 0x014100D4, -1 }, { 0x00270073, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01040164, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190146, -1 }, { 0x00000000, 0 }, { 0x010E00C3, -1 },
+    { 0x01080120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013D0106, -1 },
+    { 0x00000000, 0 }, { 0x201D0102, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660063, -2 }, { 0x00000000, 0 },
+    { 0x00270061, -1 }, { 0x00C20057, -1 }, { 0x00590117, -1 }, { 0x00780115, -1 },
+    { 0x014C2026, -1 }, { 0x006F00FF, -1 }, { 0x01040152, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017400C1, -1 }, { 0x00D60058, -1 },
+    { 0x201C0064, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660051, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590105, -1 }, { 0x20150166, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00220138, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005400AB, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0075, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0166003F, 1 }, { 0x00C20176, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E016A, -1 }, { 0x005900F3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440054, -1 },
+    { 0x00000000, 0 }, { 0x00F50175, -1 }, { 0x00D30104, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E60079, -1 }, { 0x00C100D8, -1 },
+    { 0x01620071, -2 }, { 0x00DD0063, -1 }, { 0x00000000, 0 }, { 0x201A0059, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0166002D, -1 }, { 0x00C20164, -2 },
+    { 0x00460029, 1 }, { 0x00000000, 0 }, { 0x005900E1, -1 }, { 0x01190078, -1 },
+    { 0x01760072, -1 }, { 0x20180072, -1 }, { 0x00000000, 0 }, { 0x0104011C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0171, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00EF007D, 1 }, { 0x010800D8, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD0051, -1 }, { 0x01780047, -1 },
+    { 0x00580043, -1 }, { 0x201A0047, -1 }, { 0x0066201A, -1 }, { 0x00000000, 0 },
+    { 0x00C20152, -1 }, { 0x0100014E, -1 }, { 0x00000000, 0 }, { 0x01380064, -1 },
+    { 0x00000000, 0 }, { 0x00D20054, -1 }, { 0x00000000, 0 }, { 0x01640177, -1 },
+    { 0x0104010A, -1 }, { 0x00000000, 0 }, { 0x00220102, -2 }, { 0x201C015F, -1 },
+    { 0x00000000, 0 }, { 0x005700E8, -1 }, { 0x00540075, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD003F, 1 },
+    { 0x201A0178, -2 }, { 0x01500164, -1 }, { 0x20390176, -1 }, { 0x0166014C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004300D5, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C014D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540063, -2 }, { 0x0162017E, -1 }, { 0x002C004F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201A0166, -2 }, { 0x20390164, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00270138, -1 },
+    { 0x01410056, -1 }, { 0x201E0122, -1 }, { 0x00000000, 0 }, { 0x005900AB, -2 },
+    { 0x0110002C, -1 }, { 0x00000000, 0 }, { 0x01640153, -2 }, { 0x00000000, 0 },
+    { 0x0066007D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700C4, -1 }, { 0x00540051, -1 }, { 0x014C0041, -1 }, { 0x00FD201E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580150, -1 },
+    { 0x00F60076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C00C7, -1 },
+    { 0x00000000, 0 }, { 0x00C2011C, -1 }, { 0x0176016D, -1 }, { 0x00D80104, -1 },
+    { 0x0157002C, -5 }, { 0x007200F4, -1 }, { 0x2018016D, -1 }, { 0x00EB0079, -1 },
+    { 0x010400D4, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01360047, -1 }, { 0x201C0129, 2 }, { 0x0054003F, 1 }, { 0x002C016E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD014C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201D0072, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0177201D, 1 }, { 0x00C2010A, -1 }, { 0x01000106, -1 },
+    { 0x0176015B, -1 }, { 0x2018015B, -1 }, { 0x01510077, -1 }, { 0x007200E2, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0117, -2 }, { 0x00000000, 0 }, { 0x010E0164, -1 },
+    { 0x0054002D, -1 }, { 0x00C70152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01660104, -2 }, { 0x00000000, 0 }, { 0x00270102, -2 },
+    { 0x00460100, -1 }, { 0x0138014D, -1 }, { 0x00000000, 0 }, { 0x00590075, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0164011D, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0105, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0178011E, -1 }, { 0x00000000, 0 }, { 0x201A011E, -1 },
+    { 0x005B004A, 3 }, { 0x00000000, 0 }, { 0x004F0104, -1 }, { 0x016600F2, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00620079, -1 }, { 0x201E00DA, -1 },
+    { 0x00000000, 0 }, { 0x00590063, -1 }, { 0x00000000, 0 }, { 0x0164010B, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x013F0027, -2 }, { 0x00000000, 0 },
+    { 0x201C00F3, -2 }, { 0x0054014C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0178010C, -1 },
+    { 0x00000000, 0 }, { 0x00580108, -1 }, { 0x00D40100, -1 }, { 0x201A010C, -1 },
+    { 0x016600E0, -2 }, { 0x00000000, 0 }, { 0x00C200D4, -1 }, { 0x00000000, 0 },
+    { 0x013B0059, -1 }, { 0x00000000, 0 }, { 0x00590051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x016400F9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C00E1, -1 }, { 0x00000000, 0 }, { 0x2019006E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C7011C, -1 }, { 0x00000000, 0 },
+    { 0x00DD0104, -2 }, { 0x017800FA, -1 }, { 0x201D016D, -1 }, { 0x00000000, 0 },
+    { 0x00F00079, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01380117, -1 }, { 0x013B0047, -1 }, { 0x0056010F, -1 },
+    { 0x0059003F, 1 }, { 0x01570115, -1 }, { 0x016400E7, -2 }, { 0x00C3014E, -1 },
+    { 0x01760113, -1 }, { 0x00A100DD, -1 }, { 0x00220072, -1 }, { 0x00D600C3, -1 },
+    { 0x20180113, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C7010A, -1 },
+    { 0x01620100, -2 }, { 0x00000000, 0 }, { 0x00DD00F2, -1 }, { 0x015900EA, -1 },
+    { 0x017800E8, -1 }, { 0x201D015B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0106004F, -1 }, { 0x013B0178, -1 }, { 0x00000000, 0 }, { 0x01570103, -1 },
+    { 0x01760101, -1 }, { 0x20180101, -1 }, { 0x010A014E, -1 }, { 0x00000000, 0 },
+    { 0x016400D5, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0136011E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD00E0, -1 },
+    { 0x017800D6, -1 }, { 0x005800D2, -1 }, { 0x015000C2, -1 }, { 0x201A00D6, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0079201E, -1 },
+    { 0x00FD0027, 1 }, { 0x013800F3, -1 }, { 0x005600EB, -1 }, { 0x013B0166, -1 },
+    { 0x00000000, 0 }, { 0x016400C3, -2 }, { 0x01040056, -1 }, { 0x013F0122, -1 },
+    { 0x00582039, -1 }, { 0x0136010C, -1 }, { 0x00000000, 0 }, { 0x00540104, -2 },
+    { 0x00D3002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x017800C4, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00442026, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059014C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00720064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015500F8, -1 }, { 0x017400F6, -1 },
+    { 0x20190169, -1 }, { 0x005400F2, -2 }, { 0x00000000, 0 }, { 0x00C700D4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0175003F, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00430152, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C30106, -1 }, { 0x0022016D, -1 }, { 0x00000000, 0 },
+    { 0x015500E6, -1 }, { 0x00570153, -1 }, { 0x005400E0, -2 }, { 0x00F50079, -1 },
+    { 0x017400E4, -1 }, { 0x20190157, -1 }, { 0x00C4004F, -1 }, { 0x00000000, 0 },
+    { 0x00D22026, -1 }, { 0x014E201E, -1 }, { 0x015300FF, -1 }, { 0x00740027, 1 },
+    { 0x201D0113, -2 }, { 0x00000000, 0 }, { 0x014100D3, -1 }, { 0x00270072, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x010A0106, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0022015B, -1 },
+    { 0x00000000, 0 }, { 0x013600D6, -1 }, { 0x201C0075, -1 }, { 0x00000000, 0 },
+    { 0x010E00C2, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0101, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C20056, -1 }, { 0x013B011E, -1 }, { 0x01742039, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00500100, -1 }, { 0x0072002E, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x017400C0, -1 },
+    { 0x201C0063, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01020027, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x010F013C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0043011C, -1 }, { 0x013B010C, -1 },
+    { 0x00590104, -2 }, { 0x00D8002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20190121, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00E900FD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C0120, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0043010A, -1 },
+    { 0x00DE0100, -1 }, { 0x00000000, 0 }, { 0x005900F2, -1 }, { 0x0072014D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057010B, -1 }, { 0x2019010F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00E60078, -1 },
+    { 0x01620070, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00EA0177, -1 }, { 0x013F201D, -2 }, { 0x0027016D, -1 },
+    { 0x0166002C, -2 }, { 0x0166016F, -1 }, { 0x01190077, -1 }, { 0x005900E0, -1 },
+    { 0x01760071, -1 }, { 0x20180071, -2 }, { 0x00000000, 0 }, { 0x002E0059, -2 },
+    { 0x00000000, 0 }, { 0x00220113, -2 }, { 0x00440041, -1 }, { 0x00D60164, -1 },
+    { 0x00790027, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00AB00DD, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F002C, -1 },
+    { 0x0027015B, -1 }, { 0x00662019, 2 }, { 0x013B00D6, -1 }, { 0x00000000, 0 },
+    { 0x01380063, -1 }, { 0x01570061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00220101, -1 },
+    { 0x00C00027, -2 }, { 0x005700E7, -1 }, { 0x201900EB, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01020122, -1 }, { 0x01792039, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0077002E, -1 }, { 0x00000000, 0 },
+    { 0x0166014B, -1 }, { 0x00000000, 0 }, { 0x013E0137, 1 }, { 0x004300D4, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00720117, -1 },
+    { 0x002E0178, -2 }, { 0x00D20041, -1 }, { 0x01640164, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x013900DD, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DD016F, -1 }, { 0x00DD002C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C00D8, -1 }, { 0x00000000, 0 },
+    { 0x013E0125, 1 }, { 0x0176017E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00720105, -1 }, { 0x002E0166, -2 }, { 0x01640152, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005700C3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FD201D, 1 },
+    { 0x013B2019, -2 }, { 0x0162016B, -1 }, { 0x01780153, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x01410043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007200F3, -1 }, { 0x00000000, 0 },
+    { 0x00EB0078, -1 }, { 0x010400D3, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x014C002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DD014B, -1 },
+    { 0x00000000, 0 }, { 0x201D0071, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01660115, -2 }, { 0x01410174, -1 }, { 0x00270113, -2 }, { 0x00DC2026, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007200E1, -1 },
+    { 0x01510076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C00122, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054016F, -1 },
+    { 0x0054002C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01660103, -2 }, { 0x01410162, -1 },
+    { 0x00270101, -1 }, { 0x006500FD, -1 }, { 0x00C50027, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0164011C, -1 },
+    { 0x00000000, 0 }, { 0x0028004A, 3 }, { 0x0074201D, 1 }, { 0x201C0104, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C10059, -2 }, { 0x013D0051, -1 },
+    { 0x016A2026, -1 }, { 0x0178011D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01410150, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00620078, -1 },
+    { 0x201E00D9, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E011E, -1 },
+    { 0x0164010A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x01550151, -1 }, { 0x0174014F, -1 }, { 0x0054014B, -1 }, { 0x201C00F2, -2 },
+    { 0x00000000, 0 }, { 0x01620123, -2 }, { 0x00000000, 0 }, { 0x00C10047, -1 },
+    { 0x00DD0115, -1 }, { 0x0159010D, -1 }, { 0x00F300FD, -1 }, { 0x0178010B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00C200D3, -1 },
+    { 0x00000000, 0 }, { 0x201E00C7, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0102201D, -2 }, { 0x002E010C, -1 }, { 0x016400F8, -2 }, { 0x00000000, 0 },
+    { 0x00660022, 2 }, { 0x00000000, 0 }, { 0x201C00E0, -2 }, { 0x2019006D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01080047, -1 }, { 0x00C10178, -2 },
+    { 0x01620111, -2 }, { 0x00DD0103, -1 }, { 0x011B00FF, -1 }, { 0x017800F9, -1 },
+    { 0x00000000, 0 }, { 0x00F00078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F40177, -1 },
+    { 0x01100102, -1 }, { 0x01130175, -1 }, { 0x0170002C, -1 }, { 0x016400E6, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00220071, -2 }, { 0x00000000, 0 },
+};
+
 static const EpdFontData notosans_14_bold = {
     notosans_14_boldBitmaps,
     notosans_14_boldGlyphs,
@@ -5209,4 +7273,8 @@ static const EpdFontData notosans_14_bold = {
     32,
     -9,
     true,
+    nullptr,
+    &notosans_14_boldMetrics,
+    notosans_14_boldKernPairs,
+    8192,
 };
@@ -3,7 +3,7 @@
  * name: notosans_8_regular
  * size: 8
  * mode: 1-bit
- * Command used: fontconvert.py notosans_8_regular 8 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf
+ * Command used: fontconvert.py notosans_8_regular 8 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --no-kerning
  */
 #pragma once
 #include "EpdFontData.h"
@@ -1610,6 +1610,19 @@ static const EpdUnicodeInterval notosans_8_regularIntervals[] = {
     { 0xFFFD, 0xFFFD, 0x36C },
 };
 
+static const EpdFontMetrics notosans_8_regularMetrics = {
+    8, 26, 4,
+    -10, 25, 18, -5,
+    {
+        4, 4, 7, 11, 10, 14, 12, 4, 5, 5, 9, 10, 4, 5, 4, 6,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 10, 10, 10, 7,
+        15, 11, 11, 11, 12, 9, 9, 12, 12, 6, 5, 10, 9, 15, 13, 13,
+        10, 13, 10, 9, 9, 12, 10, 16, 10, 9, 10, 5, 6, 5, 10, 7,
+        5, 9, 10, 8, 10, 9, 6, 10, 10, 4, 4, 9, 4, 16, 10, 10,
+        10, 10, 7, 8, 6, 10, 8, 13, 9, 9, 8, 6, 9, 6, 10,
+    },
+};
+
 static const EpdFontData notosans_8_regular = {
     notosans_8_regularBitmaps,
     notosans_8_regularGlyphs,
@@ -1619,4 +1632,6 @@ static const EpdFontData notosans_8_regular = {
     18,
     -5,
     false,
+    nullptr,
+    &notosans_8_regularMetrics,
 };
@@ -3,7 +3,7 @@
  * name: opendyslexic_10_bold
  * size: 10
  * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_10_bold 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit
+ * Command used: fontconvert.py opendyslexic_10_bold 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit --kern-manifest font-manifest.txt
  */
 #pragma once
 #include "EpdFontData.h"
@@ -3506,6 +3506,54 @@ static const EpdUnicodeInterval opendyslexic_10_boldIntervals[] = {
     { 0x2264, 0x2265, 0x2D3 },
 };
 
+static const EpdFontMetrics opendyslexic_10_boldMetrics = {
+    17, 97, 18,
+    -6, 29, 31, -11,
+    {
+        18, 7, 15, 22, 24, 23, 19, 7, 10, 9, 13, 13, 7, 11, 5, 14,
+        15, 13, 15, 15, 15, 15, 15, 15, 16, 15, 6, 7, 16, 13, 17, 14,
+        21, 20, 20, 21, 22, 19, 18, 24, 22, 11, 19, 22, 19, 24, 22, 24,
+        19, 22, 20, 22, 22, 22, 24, 30, 23, 22, 23, 10, 10, 10, 12, 14,
+        9, 18, 18, 16, 18, 18, 14, 18, 18, 10, 13, 19, 12, 26, 18, 18,
+        20, 20, 15, 18, 16, 18, 21, 23, 20, 19, 18, 12, 8, 12, 10,
+    },
+};
+
+static const EpdKernPair opendyslexic_10_boldKernPairs[128] = {
+    { 0x20100020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180020, 3 },
+    { 0x00000000, 0 }, { 0x003A0020, 3 }, { 0x203A0020, 3 }, { 0x005C0020, 3 },
+    { 0x002D0020, 3 }, { 0x00AD0020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20130020, 3 }, { 0x00000000, 0 },
+    { 0x20350020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280020, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0020, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005F0020, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00230020, 3 }, { 0x20230020, 3 },
+    { 0x00000000, 0 }, { 0x20160020, 3 }, { 0x00000000, 0 }, { 0x20380020, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00AB0020, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20110020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190020, 3 }, { 0x00000000, 0 }, { 0x003B0020, 3 }, { 0x00BB0020, 3 },
+    { 0x005D0020, 3 }, { 0x002E0020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00210020, 3 }, { 0x00A10020, 3 }, { 0x00000000, 0 }, { 0x20140020, 3 },
+    { 0x00000000, 0 }, { 0x20360020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00290020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0020, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20240020, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20170020, 3 }, { 0x00000000, 0 },
+    { 0x20390020, 3 }, { 0x00000000, 0 }, { 0x005B0020, 3 }, { 0x002C0020, 3 },
+    { 0x007D0020, 3 }, { 0x00000000, 0 }, { 0x201F0020, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20120020, 3 }, { 0x00000000, 0 }, { 0x20340020, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00270020, 3 }, { 0x20270020, 3 },
+    { 0x00000000, 0 }, { 0x201A0020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0020, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00220020, 3 }, { 0x20220020, 3 }, { 0x00000000, 0 },
+    { 0x20150020, 3 }, { 0x00000000, 0 }, { 0x00B70020, 3 }, { 0x20370020, 3 },
+    { 0x00000000, 0 }, { 0x002A0020, 3 }, { 0x007B0020, 3 }, { 0x00000000, 0 },
+    { 0x201D0020, 3 }, { 0x00000000, 0 }, { 0x003F0020, 3 }, { 0x00BF0020, 3 },
+};
+
 static const EpdFontData opendyslexic_10_bold = {
     opendyslexic_10_boldBitmaps,
     opendyslexic_10_boldGlyphs,
@@ -3515,4 +3563,8 @@ static const EpdFontData opendyslexic_10_bold = {
     28,
     -11,
     true,
+    nullptr,
+    &opendyslexic_10_boldMetrics,
+    opendyslexic_10_boldKernPairs,
+    128,
 };
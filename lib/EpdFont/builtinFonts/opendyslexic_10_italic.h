@@ -3,7 +3,7 @@
  * name: opendyslexic_10_italic
  * size: 10
  * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_10_italic 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit
+ * Command used: fontconvert.py opendyslexic_10_italic 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit --kern-manifest font-manifest.txt
  */
 #pragma once
 #include "EpdFontData.h"
@@ -3644,6 +3644,2070 @@ static const EpdUnicodeInterval opendyslexic_10_italicIntervals[] = {
     { 0x2264, 0x2265, 0x2D3 },
 };
 
+static const EpdFontMetrics opendyslexic_10_italicMetrics = {
+    15, 100, 18,
+    -10, 30, 29, -11,
+    {
+        18, 7, 11, 24, 22, 21, 20, 6, 9, 9, 13, 13, 7, 13, 5, 12,
+        14, 12, 13, 13, 14, 13, 14, 13, 14, 14, 6, 7, 17, 13, 17, 12,
+        25, 21, 17, 18, 20, 16, 15, 21, 19, 9, 13, 18, 16, 23, 20, 21,
+        17, 22, 17, 20, 20, 19, 21, 27, 21, 19, 21, 10, 10, 10, 12, 17,
+        9, 16, 17, 14, 16, 16, 12, 15, 16, 8, 13, 16, 10, 23, 16, 16,
+        17, 18, 12, 15, 14, 15, 17, 20, 17, 16, 16, 12, 5, 13, 12,
+    },
+};
+
+static const EpdKernPair opendyslexic_10_italicKernPairs[8192] = {
+    { 0x00000000, 0 }, { 0x00380059, -1 }, { 0x00570057, -4 }, { 0x004E0041, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550070, -1 }, { 0x0074006E, -1 },
+    { 0x004C005A, -4 }, { 0x006B0058, 1 }, { 0x00000000, 0 }, { 0x00430044, -4 },
+    { 0x00620042, 1 }, { 0x0059002C, -3 }, { 0x0078002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00690071, -2 }, { 0x01040067, 1 }, { 0x00000000, 0 },
+    { 0x0041005D, -4 }, { 0x00000000, 0 }, { 0x00570045, -4 }, { 0x00000000, 0 },
+    { 0x0046201E, -6 }, { 0x0065201C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F00054, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0048, -4 }, { 0x006B0046, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00340079, -2 }, { 0x00530077, -1 }, { 0x00720075, -1 }, { 0x00C60059, -4 },
+    { 0x00000000, 0 }, { 0x0041004B, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00760031, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00670078, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0055004C, -5 }, { 0x0074004A, -3 }, { 0x006B0034, -5 },
+    { 0x00F00042, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0079, -1 },
+    { 0x005600D8, -6 }, { 0x00000000, 0 }, { 0x00530065, 1 }, { 0x00720063, -2 },
+    { 0x004A004F, -4 }, { 0x0069004D, 1 }, { 0x00C60047, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007300EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0029006A, -1 }, { 0x00670066, -1 }, { 0x003F0052, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007B0067, -1 }, { 0x00000000, 0 }, { 0x005600C6, -10 }, { 0x00530053, -6 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00570152, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0070006A, -2 }, { 0x00000000, 0 }, { 0x00480056, -5 }, { 0x00670054, -8 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046006F, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D8004F, 1 }, { 0x00000000, 0 },
+    { 0x00530041, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0079006E, -2 },
+    { 0x00000000, 0 }, { 0x0051005A, -4 }, { 0x00700058, -1 }, { 0x00000000, 0 },
+    { 0x00480044, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006E0071, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0043, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00340031, -1 }, { 0x0072002D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00630074, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0032004A, -3 },
+    { 0x00510048, -3 }, { 0x00700046, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00580077, -2 }, { 0x00770075, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046004B, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B0031, -1 }, { 0x201E0037, -4 }, { 0x00000000, 0 },
+    { 0x004D007A, 1 }, { 0x006C0078, -1 }, { 0x00000000, 0 }, { 0x00440064, 1 },
+    { 0x00630062, -3 }, { 0x00000000, 0 }, { 0x005A004C, -4 }, { 0x0079004A, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00290022, 2 },
+    { 0x0042007D, -2 }, { 0x006400EE, 2 }, { 0x00000000, 0 }, { 0x00580065, -1 },
+    { 0x00770063, -2 }, { 0x004F004F, -4 }, { 0x006E004D, 1 }, { 0x00000000, 0 },
+    { 0x00650037, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D0068, 1 }, { 0x006C0066, -2 },
+    { 0x00440052, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00700022, 1 }, { 0x00000000, 0 },
+    { 0x004500DE, 1 }, { 0x00610069, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580053, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005900DF, -1 }, { 0x0037006E, -1 }, { 0x0075006A, -2 }, { 0x004D0056, -5 },
+    { 0x006C0054, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B006F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420059, -7 },
+    { 0x00610057, -1 }, { 0x00580041, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006E0029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056005A, -6 }, { 0x00750058, 1 },
+    { 0x00000000, 0 }, { 0x004D0044, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540073, -7 },
+    { 0x00730071, -1 }, { 0x00EF0069, 1 }, { 0x004B005D, -2 }, { 0x00C70055, -4 },
+    { 0x00420047, -4 }, { 0x00000000, 0 }, { 0x0050201E, -7 }, { 0x006F201C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A0078, -1 },
+    { 0x00680074, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0037004A, -3 }, { 0x00560048, -4 }, { 0x006C0030, -1 }, { 0x00750046, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540061, -8 }, { 0x00000000, 0 }, { 0x004B004B, -4 },
+    { 0x00C70043, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00710078, -4 }, { 0x012B006C, 1 },
+    { 0x00680062, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560036, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0047007D, -2 }, { 0x0066007B, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054004F, -6 }, { 0x0073004D, 1 },
+    { 0x00DE201E, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0033006A, -2 },
+    { 0x00710066, -4 }, { 0x002A0054, -2 }, { 0x00490052, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00750022, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0028006D, -2 }, { 0x0047006B, -2 },
+    { 0x00660069, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0029, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007A006A, -2 }, { 0x201D0070, -1 },
+    { 0x00330058, -1 }, { 0x00520056, -7 }, { 0x00710054, -10 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00470059, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00730029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00640070, -2 }, { 0x00000000, 0 }, { 0x005B005A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520044, -4 }, { 0x0041201D, -3 },
+    { 0x00710042, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590073, -3 }, { 0x00780071, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00470047, -4 }, { 0x00000000, 0 }, { 0x0055201E, -1 },
+    { 0x0074201C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E0076, -2 }, { 0x006D0074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007A0046, -2 }, { 0x00000000, 0 }, { 0x00710030, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00430079, -4 },
+    { 0x00620077, -2 }, { 0x00000000, 0 }, { 0x00590061, -4 }, { 0x00000000, 0 },
+    { 0x0050004B, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00660033, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057007A, -2 }, { 0x00760078, -3 },
+    { 0x00000000, 0 }, { 0x004E0064, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0045004E, -4 }, { 0x00000000, 0 }, { 0x005B0036, -1 }, { 0x007A0034, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C007D, -3 }, { 0x006B007B, -1 },
+    { 0x00000000, 0 }, { 0x00620065, -1 }, { 0x00DE005D, -3 }, { 0x0059004F, -7 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006F0037, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0038006A, -2 }, { 0x00760066, -1 }, { 0x004E0052, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F00DE, 1 }, { 0x006B0069, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00430055, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00310029, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041006E, -2 },
+    { 0x00000000, 0 }, { 0x00380058, -1 }, { 0x00570056, -4 }, { 0x00760054, -8 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F00065, -1 },
+    { 0x00000000, 0 }, { 0x004C0059, -8 }, { 0x006B0057, -2 }, { 0x00430043, -4 },
+    { 0x00620041, -4 }, { 0x00000000, 0 }, { 0x00780029, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00690070, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570044, -4 },
+    { 0x00000000, 0 }, { 0x004E002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0071012B, -1 }, { 0x00000000, 0 }, { 0x004C0047, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00340078, -1 }, { 0x00530076, -2 }, { 0x00720074, -1 },
+    { 0x00C60058, -4 }, { 0x00EE006C, 1 }, { 0x0041004A, -7 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00670077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0055004B, -5 }, { 0x00F00041, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007B0078, -3 }, { 0x00000000, 0 }, { 0x00340066, -1 }, { 0x00530064, 2 },
+    { 0x00720062, -2 }, { 0x004A004E, -5 }, { 0x00C60046, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005400F0, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670065, -1 }, { 0x00000000, 0 },
+    { 0x003F0051, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00740037, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B0066, -1 }, { 0x00000000, 0 }, { 0x00340054, -2 },
+    { 0x00530052, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005400DE, 1 },
+    { 0x00700069, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480055, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00360029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0046006E, -4 }, { 0x0065006C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A006F, -1 },
+    { 0x0079006D, -1 }, { 0x00000000, 0 }, { 0x00510059, -6 }, { 0x00700057, -1 },
+    { 0x00480043, -4 }, { 0x00670041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006E0070, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B201D, -2 }, { 0x0072002C, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00630073, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201C0061, -1 }, { 0x00000000, 0 }, { 0x00510047, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00390078, -1 }, { 0x00580076, -2 },
+    { 0x00770074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046004A, -9 },
+    { 0x00000000, 0 }, { 0x007B0030, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006C0077, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00630061, -3 }, { 0x00DF0059, -2 }, { 0x005A004B, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0061007A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580064, -1 },
+    { 0x00770062, -2 }, { 0x00000000, 0 }, { 0x004F004E, -4 }, { 0x00000000, 0 },
+    { 0x00460038, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900F0, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D0067, 1 }, { 0x006C0065, -2 },
+    { 0x00000000, 0 }, { 0x00440051, -2 }, { 0x0063004F, -1 }, { 0x00000000, 0 },
+    { 0x00790037, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0042006A, -2 }, { 0x00610068, -1 },
+    { 0x00580052, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0037006D, -1 }, { 0x00750069, -1 }, { 0x00000000, 0 },
+    { 0x004D0055, -5 }, { 0x006C0053, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420058, -6 },
+    { 0x00610056, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0037005B, -1 },
+    { 0x00560059, -4 }, { 0x004D0043, -4 }, { 0x006C0041, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00350074, -1 }, { 0x00540072, -7 }, { 0x00730070, -2 }, { 0x00C70054, -4 },
+    { 0x00EF0068, 1 }, { 0x00420046, -4 }, { 0x00000000, 0 }, { 0x0077002C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00680073, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560047, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0073005E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B004A, -7 }, { 0x00C70042, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520079, -1 }, { 0x00710077, -4 },
+    { 0x012B006B, 1 }, { 0x00680061, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0021, 1 }, { 0x0066007A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054004E, -5 },
+    { 0x00000000, 0 }, { 0x004B0038, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007A007B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00710065, -4 }, { 0x00000000, 0 }, { 0x00490051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0047006A, -2 },
+    { 0x004100C7, -6 }, { 0x00660068, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007A0069, -1 }, { 0x201D006F, -1 },
+    { 0x00000000, 0 }, { 0x00520055, -5 }, { 0x00710053, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006F006C, -1 }, { 0x00000000, 0 },
+    { 0x0028005A, -2 }, { 0x00470058, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0054002A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0064006F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520043, -5 }, { 0x00710041, -5 },
+    { 0x0041201C, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590072, -2 }, { 0x00780070, -2 }, { 0x0031005E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00470046, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E0075, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00620076, -3 }, { 0x00000000, 0 }, { 0x0078005E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0050004A, -9 }, { 0x00000000, 0 }, { 0x00280036, -2 },
+    { 0x00660032, -1 }, { 0x00000000, 0 }, { 0x201C00F0, -2 }, { 0x00760077, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0063, -2 }, { 0x00000000, 0 },
+    { 0x0045004D, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B007A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00430066, -1 }, { 0x00620064, -1 }, { 0x00000000, 0 },
+    { 0x0059004E, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006300F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570067, -1 }, { 0x00760065, -3 }, { 0x00000000, 0 }, { 0x004E0051, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C006A, -2 }, { 0x004600C7, -5 }, { 0x00430054, -4 }, { 0x00620052, 1 },
+    { 0x006B0068, -1 }, { 0x00DE004A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00380057, -1 }, { 0x00570055, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450029, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00360070, -1 },
+    { 0x0074006C, -1 }, { 0x004C0058, -4 }, { 0x006B0056, -4 }, { 0x00F00064, -1 },
+    { 0x00430042, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00780028, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0069006F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570043, -6 },
+    { 0x00760041, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007D0070, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0046, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00530075, 1 }, { 0x00720073, -2 }, { 0x00EE006B, 1 },
+    { 0x00C60057, -4 }, { 0x00000000, 0 }, { 0x00410049, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00570031, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00670076, -1 }, { 0x00000000, 0 }, { 0x003F0062, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0055004A, -9 }, { 0x00000000, 0 },
+    { 0x004C0034, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007B0077, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00530063, 1 },
+    { 0x00720061, -2 }, { 0x004A004D, -5 }, { 0x00C60045, -4 }, { 0x00CC012B, 1 },
+    { 0x00410037, -3 }, { 0x00000000, 0 }, { 0x005400EF, -2 }, { 0x0070007A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670064, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x003F0050, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0065, -3 }, { 0x00000000, 0 },
+    { 0x00530051, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0051006A, 1 }, { 0x004B00C7, -7 }, { 0x00480054, -4 },
+    { 0x00700068, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0046006D, -1 }, { 0x0065006B, -1 }, { 0x00000000, 0 }, { 0x007B0053, -2 },
+    { 0x00D8004D, 1 }, { 0x00340041, -1 }, { 0x201E0059, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FE007A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005A006E, 1 }, { 0x0079006C, -2 }, { 0x00510058, -4 }, { 0x00700056, -2 },
+    { 0x00000000, 0 }, { 0x00480042, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006E006F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00650059, -3 }, { 0x00000000, 0 },
+    { 0x007B0041, -3 }, { 0x201E0047, -1 }, { 0x004B201C, -1 }, { 0x012900EF, 2 },
+    { 0x00C60152, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440074, 1 },
+    { 0x00630072, -1 }, { 0x0079005A, -2 }, { 0x00DF006A, -2 }, { 0x00000000, 0 },
+    { 0x00510046, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580075, -1 }, { 0x00770073, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460049, -3 },
+    { 0x00650047, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D0078, 1 }, { 0x006C0076, -4 },
+    { 0x00DF0058, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A004A, -7 },
+    { 0x00000000, 0 }, { 0x00510034, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006400EC, 1 }, { 0x00610079, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580063, -1 }, { 0x00770061, -2 }, { 0x004F004D, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0075007A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006C0064, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440050, -4 }, { 0x0063004E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00610067, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00580051, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056006A, -2 }, { 0x005000C7, -5 },
+    { 0x004D0054, -5 }, { 0x00750068, -1 }, { 0x00000000, 0 }, { 0x00DF0034, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EF0079, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00420057, -6 }, { 0x00000000, 0 }, { 0x00390041, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004F0029, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0037005A, -1 },
+    { 0x00560058, -5 }, { 0x00750056, -1 }, { 0x004D0042, -4 }, { 0x00000000, 0 },
+    { 0x0063002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00350073, -1 }, { 0x00540071, -8 }, { 0x0073006F, -1 }, { 0x00C70053, -4 },
+    { 0x00000000, 0 }, { 0x00420045, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00680072, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560046, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B0049, -3 }, { 0x00C70041, -4 }, { 0x0078201E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00710076, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0021004E, -1 }, { 0x00000000, 0 }, { 0x00560034, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00660079, -1 }, { 0x004100D8, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054004D, -5 },
+    { 0x00000000, 0 }, { 0x00DE201C, -1 }, { 0x004B0037, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007A007A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00520066, -1 }, { 0x00710064, -4 }, { 0x00000000, 0 }, { 0x00490050, -2 },
+    { 0x0068004E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007200F0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00470069, -2 },
+    { 0x00660067, -2 }, { 0x004100C6, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00420152, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007A0068, -1 },
+    { 0x005500C7, -4 }, { 0x00520054, -6 }, { 0x00710052, -2 }, { 0x201D006E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006F006B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00470057, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EC00EF, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0064006E, -1 }, { 0x00000000, 0 },
+    { 0x007A0056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520042, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590071, -3 }, { 0x0078006F, -4 }, { 0x00000000, 0 },
+    { 0x0031005D, -3 }, { 0x006F0059, -3 }, { 0x00280047, -2 }, { 0x00470045, -4 },
+    { 0x0036201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004E0074, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D004A, -3 }, { 0x00000000, 0 },
+    { 0x00520030, -1 }, { 0x0071002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00430077, -2 }, { 0x00620075, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00500049, -3 }, { 0x006F0047, -2 }, { 0x00000000, 0 },
+    { 0x00280035, -1 }, { 0x00470033, -1 }, { 0x00660031, -2 }, { 0x00000000, 0 },
+    { 0x00570078, -2 }, { 0x00760076, -1 }, { 0x004E0062, -2 }, { 0x0130006A, -2 },
+    { 0x00000000, 0 }, { 0x0045004C, -4 }, { 0x0064004A, -3 }, { 0x005B0034, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B0079, -4 },
+    { 0x004600D8, -5 }, { 0x00000000, 0 }, { 0x00620063, -1 }, { 0x00000000, 0 },
+    { 0x0059004D, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00470021, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00760064, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E0050, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007700F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006B0067, -4 }, { 0x00000000, 0 }, { 0x004600C6, -10 }, { 0x00430053, -4 },
+    { 0x00620051, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00310027, -1 }, { 0x00470152, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0041006C, -2 }, { 0x005A00C7, -6 }, { 0x00380056, -1 }, { 0x00570054, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0074006B, -1 },
+    { 0x00F00063, -1 }, { 0x012B012F, 1 }, { 0x002D0059, -2 }, { 0x004C0057, -7 },
+    { 0x00430041, -4 }, { 0x006B0055, -2 }, { 0x00DE0037, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A0070, -1 },
+    { 0x0069006E, -1 }, { 0x0041005A, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570042, -4 }, { 0x00000000, 0 }, { 0x004E002C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00710129, -1 }, { 0x00740059, -2 }, { 0x004C0045, -4 },
+    { 0x006B0043, -2 }, { 0x00F00051, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00340076, -1 }, { 0x00530074, -1 },
+    { 0x00720072, -2 }, { 0x00C60056, -4 }, { 0x00EE006A, -1 }, { 0x00410048, -4 },
+    { 0x00000000, 0 }, { 0x00570030, -1 }, { 0x0076002E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00670075, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550049, -3 }, { 0x00740047, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B0076, -2 }, { 0x00000000, 0 }, { 0x00530062, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A004C, -5 }, { 0x0069004A, -3 },
+    { 0x00410036, -1 }, { 0x00C60044, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0032007D, -1 }, { 0x004B00D8, -4 }, { 0x00700079, -3 }, { 0x00670063, -1 },
+    { 0x00000000, 0 }, { 0x003F004F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0064, -2 }, { 0x201E006A, -1 },
+    { 0x00000000, 0 }, { 0x00530050, -4 }, { 0x0072004E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00700067, -1 }, { 0x00000000, 0 }, { 0x004B00C6, -4 },
+    { 0x00480053, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0152, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0046006C, -3 }, { 0x0065006A, -2 }, { 0x00000000, 0 },
+    { 0x00D8004C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FE0079, -1 }, { 0x00000000, 0 },
+    { 0x005A006D, 1 }, { 0x0079006B, -2 }, { 0x00000000, 0 }, { 0x00320059, -1 },
+    { 0x00510057, -4 }, { 0x00290043, 1 }, { 0x00480041, -4 }, { 0x00000000, 0 },
+    { 0x005E0029, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004F0070, -1 }, { 0x006E006E, -1 }, { 0x0046005A, -6 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x012900EE, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00630071, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057012B, 1 }, { 0x00790059, -1 },
+    { 0x00510045, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580074, -1 },
+    { 0x00770072, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00460048, -4 }, { 0x00650046, -2 }, { 0x0073201D, -1 }, { 0x201E0034, -6 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0079, -3 }, { 0x006C0075, -2 },
+    { 0x00000000, 0 }, { 0x00DF0057, -1 }, { 0x00000000, 0 }, { 0x005A0049, -3 },
+    { 0x00790047, -2 }, { 0x00000000, 0 }, { 0x00510033, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00610078, -1 }, { 0x00000000, 0 },
+    { 0x00580062, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F004C, -4 },
+    { 0x006E004A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00750079, -2 }, { 0x005000D8, -4 }, { 0x00000000, 0 },
+    { 0x004D0065, 1 }, { 0x006C0063, -2 }, { 0x0044004F, -4 }, { 0x0063004D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00610066, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580050, -4 }, { 0x0077004E, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00650022, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00750067, -1 }, { 0x00000000, 0 },
+    { 0x005000C6, -11 }, { 0x004D0053, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00510152, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00420056, -6 }, { 0x00610054, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560057, -4 }, { 0x00000000, 0 }, { 0x004D0041, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00630029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540070, -8 }, { 0x0073006E, -1 }, { 0x004B005A, -4 },
+    { 0x00C70052, -4 }, { 0x00EF0066, 1 }, { 0x00420044, -4 }, { 0x0031201D, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00680071, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560045, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054005E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B0048, -4 }, { 0x0078201D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520077, -1 },
+    { 0x00710075, -4 }, { 0x012B0069, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0047007A, -4 }, { 0x00660078, -3 },
+    { 0x00000000, 0 }, { 0x005D0062, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0054004C, -4 }, { 0x0073004A, -3 }, { 0x004B0036, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007A0079, -1 }, { 0x005500D8, -4 },
+    { 0x00000000, 0 }, { 0x00710063, -4 }, { 0x00000000, 0 }, { 0x0049004F, -3 },
+    { 0x0068004D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007200EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00470068, -2 }, { 0x00660066, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0054003A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006A0022, 3 }, { 0x00000000, 0 }, { 0x003F00DE, 2 }, { 0x007A0067, -2 },
+    { 0x201D006D, -1 }, { 0x005500C6, -6 }, { 0x00520053, -4 }, { 0x00710051, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560152, -6 }, { 0x00000000, 0 }, { 0x005300DF, 1 }, { 0x006F006A, -2 },
+    { 0x00000000, 0 }, { 0x00280058, -1 }, { 0x00470056, -7 }, { 0x00660054, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EC00EE, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520041, -4 },
+    { 0x0071003F, -2 }, { 0x00000000, 0 }, { 0x002A002D, -2 }, { 0x00680029, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590070, -3 }, { 0x0078006E, -1 },
+    { 0x0050005A, -7 }, { 0x006F0058, -1 }, { 0x00000000, 0 }, { 0x00280046, -1 },
+    { 0x0036201D, -1 }, { 0x00470044, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004E0073, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004A201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00430076, -3 }, { 0x00620074, -3 }, { 0x0059005E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0031004A, -3 }, { 0x00500048, -4 },
+    { 0x00280034, -4 }, { 0x00470032, -1 }, { 0x006F0046, -2 }, { 0x00000000, 0 },
+    { 0x00760075, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0061, -3 },
+    { 0x00000000, 0 }, { 0x0045004B, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006B0078, -1 }, { 0x00000000, 0 }, { 0x00620062, -2 }, { 0x00DE005A, -3 },
+    { 0x00000000, 0 }, { 0x0059004C, -5 }, { 0x0078004A, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041007D, -3 },
+    { 0x005A00D8, -4 }, { 0x00000000, 0 }, { 0x00570065, -1 }, { 0x00760063, -3 },
+    { 0x004E004F, -4 }, { 0x006D004D, 1 }, { 0x00EF012B, 4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007700EF, 1 }, { 0x00000000, 0 }, { 0x012E0070, -2 },
+    { 0x00000000, 0 }, { 0x002D006A, -1 }, { 0x006B0066, -2 }, { 0x00430052, -4 },
+    { 0x00620050, 1 }, { 0x00000000, 0 }, { 0x00780038, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006F0022, 1 }, { 0x00000000, 0 }, { 0x004400DE, 1 },
+    { 0x0041006B, -2 }, { 0x00000000, 0 }, { 0x005A00C6, -4 }, { 0x00570053, -6 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800DF, 1 },
+    { 0x0074006A, -3 }, { 0x00000000, 0 }, { 0x004C0056, -8 }, { 0x006B0054, -7 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590028, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410059, -8 }, { 0x00000000, 0 },
+    { 0x00570041, -8 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006D0029, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0055005A, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C0044, -4 }, { 0x00000000, 0 }, { 0x0062002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00720071, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C60055, -4 }, { 0x00000000, 0 }, { 0x00410047, -6 },
+    { 0x00000000, 0 }, { 0x004F201E, -1 }, { 0x006E201C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00290078, -1 }, { 0x00670074, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0036004A, -3 },
+    { 0x00550048, -4 }, { 0x006B0030, -2 }, { 0x00740046, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B0075, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00530061, 1 }, { 0x00000000, 0 }, { 0x004A004B, -5 }, { 0x00C60043, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0051007A, -1 }, { 0x00700078, -4 }, { 0x00000000, 0 }, { 0x00480064, 1 },
+    { 0x00670062, -2 }, { 0x00000000, 0 }, { 0x003F004E, 1 }, { 0x00000000, 0 },
+    { 0x00740034, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0063, -3 },
+    { 0x00000000, 0 }, { 0x0053004F, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0032006A, -2 }, { 0x00700066, -2 },
+    { 0x00480052, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00740022, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0046006B, -3 }, { 0x00650069, -1 }, { 0x00000000, 0 },
+    { 0x007B0051, -3 }, { 0x201E0057, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FE0078, -2 },
+    { 0x00000000, 0 }, { 0x005A006C, 1 }, { 0x0079006A, -3 }, { 0x00510056, -5 },
+    { 0x00700054, -8 }, { 0x201C0070, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460059, -4 },
+    { 0x00650057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00720029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00630070, -2 }, { 0x00000000, 0 }, { 0x005A005A, -4 }, { 0x00790058, -2 },
+    { 0x0152004A, -1 }, { 0x00510044, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00770071, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F005D, -1 }, { 0x00000000, 0 },
+    { 0x00460047, -5 }, { 0x00000000, 0 }, { 0x0054201E, -5 }, { 0x0073201C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006C0074, -4 },
+    { 0x00000000, 0 }, { 0x0063005E, -1 }, { 0x00DF0056, -1 }, { 0x00000000, 0 },
+    { 0x005A0048, -4 }, { 0x00790046, -2 }, { 0x00320034, -2 }, { 0x00510032, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420079, -1 }, { 0x00610077, -2 },
+    { 0x00000000, 0 }, { 0x00580061, -1 }, { 0x00000000, 0 }, { 0x004F004B, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0056007A, -2 }, { 0x00750078, -1 }, { 0x00000000, 0 },
+    { 0x004D0064, 1 }, { 0x006C0062, -2 }, { 0x00000000, 0 }, { 0x0044004E, -4 },
+    { 0x00000000, 0 }, { 0x00790034, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00320022, 2 }, { 0x004B007D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00610065, -2 }, { 0x00000000, 0 }, { 0x0058004F, -7 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006E0037, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0037006A, -2 },
+    { 0x00750066, -1 }, { 0x002E0054, -5 }, { 0x004D0052, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00790022, 2 },
+    { 0x00EF0077, 1 }, { 0x004E00DE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00420055, -4 }, { 0x00610053, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00300029, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00210070, -1 }, { 0x00000000, 0 },
+    { 0x00560056, -4 }, { 0x00750054, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0054006F, -8 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B0059, -6 }, { 0x006A0057, 1 }, { 0x00420043, -4 }, { 0x00610041, -2 },
+    { 0x0031201C, -2 }, { 0x00770029, -1 }, { 0x00C70051, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00680070, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560044, -4 }, { 0x0045201D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B0047, -7 }, { 0x00000000, 0 }, { 0x0059201E, -5 },
+    { 0x0078201C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00330078, -1 }, { 0x00520076, -1 }, { 0x00710074, -4 }, { 0x012B0068, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00370034, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00470079, -4 },
+    { 0x00660077, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0054004B, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B007A, -4 }, { 0x007A0078, -1 },
+    { 0x00000000, 0 }, { 0x00710062, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0049004E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005300F0, 1 }, { 0x0050007D, -2 }, { 0x00000000, 0 },
+    { 0x00470067, -2 }, { 0x00660065, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540039, -1 }, { 0x00730037, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007A0066, -1 }, { 0x00000000, 0 }, { 0x00520052, -4 }, { 0x00710050, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005300DE, 1 }, { 0x006F0069, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00470055, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00350029, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0064006C, -1 },
+    { 0x00000000, 0 }, { 0x007A0054, -7 }, { 0x201D005A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE007D, -3 }, { 0x00000000, 0 }, { 0x0059006F, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00500059, -5 }, { 0x006F0057, -1 }, { 0x00470043, -4 },
+    { 0x00660041, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0072, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00620073, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00500047, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00280033, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00380078, -1 }, { 0x00760074, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0045004A, -7 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C0079, -4 }, { 0x006B0077, -4 }, { 0x00000000, 0 }, { 0x00620061, -1 },
+    { 0x00DE0059, -3 }, { 0x0059004B, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00310037, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570064, -1 }, { 0x00760062, -2 },
+    { 0x00000000, 0 }, { 0x004E004E, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800F0, -1 }, { 0x0074007B, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B0065, -4 }, { 0x00000000, 0 },
+    { 0x00430051, -2 }, { 0x0062004F, 1 }, { 0x00DE0047, 1 }, { 0x00590039, -1 },
+    { 0x00780037, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0041006A, -2 }, { 0x00000000, 0 }, { 0x00570052, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800DE, 1 },
+    { 0x00740069, -1 }, { 0x00F00061, -1 }, { 0x00000000, 0 }, { 0x004C0055, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0069006C, -1 }, { 0x00000000, 0 }, { 0x00410058, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550059, -4 }, { 0x00740057, -1 },
+    { 0x004C0043, -4 }, { 0x006B0041, -2 }, { 0x00F0004F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00340074, -1 },
+    { 0x00720070, -3 }, { 0x00C60054, -4 }, { 0x00CF006A, -2 }, { 0x00EE0068, 1 },
+    { 0x00410046, -4 }, { 0x00000000, 0 }, { 0x0076002C, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670073, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550047, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0074, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A004A, -5 },
+    { 0x00C60042, -4 }, { 0x00410034, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00700077, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00670061, -1 }, { 0x00000000, 0 }, { 0x003F004D, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0065007A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0053004E, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005A007D, -2 }, { 0x0079007B, -1 }, { 0x00000000, 0 }, { 0x00700065, -1 },
+    { 0x00000000, 0 }, { 0x00480051, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007D0037, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046006A, -2 }, { 0x00650068, -2 },
+    { 0x201E0056, -3 }, { 0x00D8004A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005A006B, 1 }, { 0x00790069, -2 }, { 0x00000000, 0 },
+    { 0x00510055, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007100DF, -2 }, { 0x00300070, -1 }, { 0x006E006C, -1 }, { 0x00460058, -5 },
+    { 0x00650056, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012900EC, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00440071, 1 }, { 0x0063006F, -3 }, { 0x00000000, 0 }, { 0x005A0059, -4 },
+    { 0x01520049, 1 }, { 0x00510043, -3 }, { 0x00700041, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580072, 1 }, { 0x00770070, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00460046, -5 }, { 0x00650044, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0077, -1 },
+    { 0x006C0073, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005A0047, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00510031, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420078, -1 },
+    { 0x00610076, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004F004A, -8 }, { 0x00000000, 0 }, { 0x00460034, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560079, -1 }, { 0x00750077, -2 },
+    { 0x00000000, 0 }, { 0x004D0063, 1 }, { 0x006C0061, -2 }, { 0x0044004D, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00790033, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00610064, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058004E, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560067, -2 },
+    { 0x00750065, -1 }, { 0x00000000, 0 }, { 0x004D0051, -2 }, { 0x006C004F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00790021, -1 },
+    { 0x00000000, 0 }, { 0x00EF0076, 1 }, { 0x00000000, 0 }, { 0x004B006A, -2 },
+    { 0x004500C7, -5 }, { 0x00420054, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006200DE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560055, -4 }, { 0x00750053, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440029, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00350070, -1 }, { 0x0054006E, -7 },
+    { 0x004B0058, -4 }, { 0x0073006C, -1 }, { 0x00C70050, -4 }, { 0x00420042, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F000F0, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0068006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560043, -6 }, { 0x00750041, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0046, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00520075, -1 }, { 0x00710073, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560031, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0028007A, -2 },
+    { 0x00470078, -4 }, { 0x00660076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0054004A, -9 }, { 0x00000000, 0 }, { 0x004B0034, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0079, -1 },
+    { 0x007A0077, -1 }, { 0x00000000, 0 }, { 0x00710061, -4 }, { 0x00000000, 0 },
+    { 0x0049004D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006F007A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00470066, -4 }, { 0x00660064, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005B0067, -1 }, { 0x007A0065, -2 }, { 0x00000000, 0 }, { 0x00520051, -4 },
+    { 0x0071004F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0050006A, -3 }, { 0x004A00C7, -4 }, { 0x00470054, -6 }, { 0x006F0068, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0064006B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490029, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B00DF, -1 }, { 0x0059006E, -2 },
+    { 0x0078006C, -1 }, { 0x00500058, -7 }, { 0x006F0056, -2 }, { 0x00000000, 0 },
+    { 0x00470042, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0071, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0043, -1 },
+    { 0x007A0041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00430074, -1 }, { 0x00620072, -2 },
+    { 0x00D800C7, 1 }, { 0x00DE006A, -2 }, { 0x00000000, 0 }, { 0x00500046, -4 },
+    { 0x00000000, 0 }, { 0x00280032, -1 }, { 0x0066002E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00760073, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450049, -3 }, { 0x00640047, -2 },
+    { 0x0072201E, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006B0076, -4 }, { 0x00000000, 0 }, { 0x00DE0058, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059004A, -9 }, { 0x00000000, 0 },
+    { 0x00500034, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570063, -1 },
+    { 0x00760061, -3 }, { 0x004E004D, -5 }, { 0x00EF0129, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0074007A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0066, -1 }, { 0x006B0064, -4 },
+    { 0x00000000, 0 }, { 0x00430050, -4 }, { 0x0062004E, -2 }, { 0x00590038, -1 },
+    { 0x00780036, -1 }, { 0x00000000, 0 }, { 0x00500022, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410069, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570051, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0055006A, -2 }, { 0x004F00C7, -4 }, { 0x004C0054, -9 },
+    { 0x00740068, -1 }, { 0x00000000, 0 }, { 0x00DE0034, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0069006B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410057, -7 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E0029, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550058, -5 }, { 0x00740056, -1 },
+    { 0x00000000, 0 }, { 0x004C0042, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00340073, -1 },
+    { 0x00530071, 1 }, { 0x0072006F, -2 }, { 0x00C60053, -4 }, { 0x00000000, 0 },
+    { 0x00410045, -4 }, { 0x00000000, 0 }, { 0x0030201E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670072, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00550046, -5 }, { 0x0063201D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0073, -3 }, { 0x201E0079, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A0049, -3 },
+    { 0x00690047, -2 }, { 0x0077201E, -2 }, { 0x00C60041, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00510078, -2 }, { 0x00700076, -3 },
+    { 0x012A006A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x003F004C, 2 },
+    { 0x00000000, 0 }, { 0x00550034, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00650079, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007B0061, -3 }, { 0x00000000, 0 }, { 0x0053004D, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0079007A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00700064, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480050, -4 }, { 0x0067004E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550022, 2 },
+    { 0x007100F0, -2 }, { 0x00000000, 0 }, { 0x00460069, -3 }, { 0x00650067, -1 },
+    { 0x00000000, 0 }, { 0x007B004F, -2 }, { 0x00D80049, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410152, -6 },
+    { 0x00DF0078, -1 }, { 0x00000000, 0 }, { 0x005A006A, -2 }, { 0x005400C7, -7 },
+    { 0x00510054, -4 }, { 0x00790068, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007100DE, -1 }, { 0x006E006B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00460057, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00530029, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00440070, -1 }, { 0x0063006E, -1 }, { 0x005A0058, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00510042, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580071, -1 }, { 0x0077006F, -2 }, { 0x00000000, 0 }, { 0x006E0059, -3 },
+    { 0x00000000, 0 }, { 0x00460045, -4 }, { 0x00650043, 1 }, { 0x0035201E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0076, -2 }, { 0x004D0074, 1 }, { 0x006C0072, -1 }, { 0x00DF0054, -1 },
+    { 0x00000000, 0 }, { 0x005A0046, -4 }, { 0x201C004A, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420077, -1 },
+    { 0x00610075, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004F0049, -3 }, { 0x006E0047, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0037007A, -1 }, { 0x00560078, -2 },
+    { 0x00750076, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0044004C, -4 }, { 0x0063004A, -3 }, { 0x005A0034, -5 }, { 0x00790032, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004500D8, -4 },
+    { 0x00000000, 0 }, { 0x00610063, -2 }, { 0x00000000, 0 }, { 0x0058004D, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F0037, -1 }, { 0x00000000, 0 },
+    { 0x00460021, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00750064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D0050, -4 },
+    { 0x006C004E, -2 }, { 0x00630038, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007600F0, -1 }, { 0x00EF0075, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004500C6, -4 }, { 0x00420053, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00460152, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005900C7, -7 }, { 0x00560054, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054006D, -4 }, { 0x0073006B, -1 },
+    { 0x00000000, 0 }, { 0x002C0059, -1 }, { 0x004B0057, -6 }, { 0x00420041, -5 },
+    { 0x00C7004F, -4 }, { 0x00000000, 0 }, { 0x00F000EF, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0068006E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560042, -4 },
+    { 0x00000000, 0 }, { 0x002E002E, 1 }, { 0x006C002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00730059, -2 }, { 0x00000000, 0 }, { 0x002C0047, -1 }, { 0x004B0045, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00710072, -4 }, { 0x00ED006A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560030, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00280079, -1 }, { 0x00470077, -3 }, { 0x00660075, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540049, -3 }, { 0x00730047, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005B0078, -4 }, { 0x007A0076, -1 }, { 0x00520062, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0049004C, -2 }, { 0x0068004A, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0031007D, -3 },
+    { 0x004A00D8, -4 }, { 0x00280067, -1 }, { 0x00470065, -2 }, { 0x00660063, -2 },
+    { 0x006F0079, -3 }, { 0x00DF012B, 1 }, { 0x00000000, 0 }, { 0x00350039, -1 },
+    { 0x00000000, 0 }, { 0x006700EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005B0066, -1 }, { 0x007A0064, -3 }, { 0x201D006A, -2 },
+    { 0x00520050, -4 }, { 0x0071004E, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B00F0, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006F0067, -1 }, { 0x00000000, 0 }, { 0x004A00C6, -5 }, { 0x00470053, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B0152, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0064006A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D800D8, 1 }, { 0x0059006D, -2 },
+    { 0x0078006B, -1 }, { 0x00000000, 0 }, { 0x00310059, -3 }, { 0x00500057, -5 },
+    { 0x00280043, -3 }, { 0x00470041, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0070, -4 },
+    { 0x00000000, 0 }, { 0x0045005A, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00620071, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00780059, -2 }, { 0x00000000, 0 }, { 0x00500045, -4 },
+    { 0x006F0043, 1 }, { 0x00000000, 0 }, { 0x00280031, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00760072, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450048, -4 },
+    { 0x00640046, -2 }, { 0x201D0034, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004C0077, -1 }, { 0x006B0075, -3 }, { 0x00000000, 0 },
+    { 0x00DE0057, -1 }, { 0x00000000, 0 }, { 0x00590049, -3 }, { 0x00780047, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0041007A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570062, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E004C, -5 }, { 0x006D004A, -3 },
+    { 0x00450036, -1 }, { 0x00640034, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00740079, -2 }, { 0x004F00D8, -4 }, { 0x00000000, 0 }, { 0x006B0063, -4 },
+    { 0x00000000, 0 }, { 0x0043004F, -4 }, { 0x0062004D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410068, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00570050, -5 }, { 0x0076004E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00640022, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00740067, -2 }, { 0x012B012B, 4 }, { 0x004F00C6, -7 },
+    { 0x004C0053, -4 }, { 0x006B0051, -2 }, { 0x00000000, 0 }, { 0x00DE0033, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00500152, -4 }, { 0x00000000, 0 },
+    { 0x004D00DF, 1 }, { 0x0069006A, -2 }, { 0x00000000, 0 }, { 0x00410056, -9 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550057, -4 },
+    { 0x00F0004D, 1 }, { 0x004C0041, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00620029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0072006E, -2 }, { 0x00000000, 0 }, { 0x004A005A, -5 }, { 0x00690058, 1 },
+    { 0x00C60052, -4 }, { 0x00410044, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670071, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00550045, -4 }, { 0x00000000, 0 }, { 0x0044201E, -1 }, { 0x002D0031, -1 },
+    { 0x0063201C, -1 }, { 0x006B002D, -3 }, { 0x00000000, 0 }, { 0x007B0072, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004A0048, -4 }, { 0x00690046, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00510077, -1 }, { 0x00700075, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x003F004B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0046007A, -5 }, { 0x00650078, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0053004C, -4 },
+    { 0x0072004A, -3 }, { 0x00690034, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00220022, 2 }, { 0x00790079, -1 }, { 0x005400D8, -6 }, { 0x00000000, 0 },
+    { 0x00700063, -1 }, { 0x00000000, 0 }, { 0x0048004F, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460068, -3 },
+    { 0x00650066, -2 }, { 0x201E0054, -4 }, { 0x007B004E, -1 }, { 0x00D80048, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00690022, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A0069, 1 }, { 0x00790067, -2 },
+    { 0x005400C6, -9 }, { 0x00510053, -5 }, { 0x0130012B, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550152, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006E006A, -2 }, { 0x00000000, 0 },
+    { 0x00460056, -4 }, { 0x00650054, -8 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00530028, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0044006F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005A0057, -4 }, { 0x00000000, 0 }, { 0x00510041, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00670029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0077006E, -2 }, { 0x00000000, 0 }, { 0x004F005A, -5 },
+    { 0x006E0058, 1 }, { 0x00000000, 0 }, { 0x00460044, -4 }, { 0x0035201D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004D0073, 1 }, { 0x006C0071, -2 }, { 0x00000000, 0 }, { 0x0044005D, -1 },
+    { 0x00000000, 0 }, { 0x005A0045, -4 }, { 0x00000000, 0 }, { 0x0068201C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00420076, -1 }, { 0x00610074, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0030004A, -3 }, { 0x004F0048, -4 }, { 0x006E0046, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00750075, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D0061, 1 }, { 0x00000000, 0 },
+    { 0x0044004B, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00790031, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00420064, 1 }, { 0x00610062, -2 }, { 0x00000000, 0 },
+    { 0x0058004C, -4 }, { 0x0077004A, -3 }, { 0x006E0034, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00270022, 2 }, { 0x00000000, 0 }, { 0x005900D8, -7 },
+    { 0x00000000, 0 }, { 0x00560065, -2 }, { 0x00750063, -1 }, { 0x004D004F, -4 },
+    { 0x006C004D, 1 }, { 0x00EE012B, 3 }, { 0x00630037, -3 }, { 0x00000000, 0 },
+    { 0x007600EF, 1 }, { 0x00000000, 0 }, { 0x00EF0074, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420052, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006E0022, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005900C6, -9 }, { 0x00560053, -7 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005A0152, -6 }, { 0x00000000, 0 }, { 0x005700DF, -1 }, { 0x0054006C, -3 },
+    { 0x0073006A, -2 }, { 0x004B0056, -6 }, { 0x00C7004E, -4 }, { 0x00EF0062, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560041, -10 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0054005A, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0044, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00710071, -4 }, { 0x00CE006B, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E201E, -1 }, { 0x006D201C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00280078, -2 }, { 0x00470076, -4 }, { 0x00660074, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0035004A, -3 }, { 0x00540048, -4 },
+    { 0x00730046, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005B0077, -3 }, { 0x007A0075, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0049004B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0050007A, -1 },
+    { 0x006F0078, -4 }, { 0x00000000, 0 }, { 0x00280066, -2 }, { 0x00470064, -2 },
+    { 0x00660062, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540036, -1 },
+    { 0x00730034, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0065, -3 }, { 0x007A0063, -2 },
+    { 0x0052004F, -5 }, { 0x0071004D, -2 }, { 0x00000000, 0 }, { 0x00680037, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0031006A, -2 }, { 0x006F0066, -2 }, { 0x00470052, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00730022, 1 }, { 0x00000000, 0 }, { 0x004800DE, 1 },
+    { 0x00640069, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0053, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE007A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0078006A, -3 }, { 0x00000000, 0 }, { 0x00500056, -5 }, { 0x006F0054, -7 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E006F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450059, -4 }, { 0x00000000, 0 },
+    { 0x005B0041, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00620070, -3 },
+    { 0x00000000, 0 }, { 0x0059005A, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00500044, -4 }, { 0x00000000, 0 }, { 0x00280030, -2 }, { 0x0047002E, -1 },
+    { 0x0066002C, -2 }, { 0x00000000, 0 }, { 0x00570073, -2 }, { 0x00760071, -3 },
+    { 0x00000000, 0 }, { 0x006A012B, 2 }, { 0x00000000, 0 }, { 0x00450047, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002D0078, -2 }, { 0x004C0076, -3 },
+    { 0x006B0074, -4 }, { 0x00DE0056, -1 }, { 0x00000000, 0 }, { 0x00590048, -4 },
+    { 0x00780046, -2 }, { 0x00310034, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410079, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570061, -2 }, { 0x00000000, 0 }, { 0x004E004B, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00740078, -1 }, { 0x00000000, 0 }, { 0x006B0062, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0043004E, -4 }, { 0x0062004C, 1 },
+    { 0x00590036, -2 }, { 0x00780034, -4 }, { 0x00DE0044, 1 }, { 0x004D00F0, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410067, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0057004F, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006D0037, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0036006A, -2 }, { 0x00740066, -1 },
+    { 0x002D0054, -2 }, { 0x004C0052, -4 }, { 0x00000000, 0 }, { 0x00DE0032, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00780022, 1 }, { 0x00000000, 0 },
+    { 0x004D00DE, 1 }, { 0x00690069, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410055, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007D006A, -2 }, { 0x00000000, 0 }, { 0x00360058, -1 },
+    { 0x00550056, -4 }, { 0x00740054, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0053006F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A0059, -4 },
+    { 0x00C60051, -4 }, { 0x00410043, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00760029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00670070, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00550044, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0071, -3 },
+    { 0x201E0077, -1 }, { 0x00000000, 0 }, { 0x0053005D, -2 }, { 0x00000000, 0 },
+    { 0x004A0047, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EF00DF, 1 }, { 0x00510076, -1 },
+    { 0x00700074, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460079, -3 }, { 0x00650077, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0053004B, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005A007A, 1 }, { 0x00790078, -3 }, { 0x00000000, 0 },
+    { 0x00700062, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0048004E, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007100EE, -1 }, { 0x004F007D, -2 }, { 0x00000000, 0 }, { 0x00460067, -4 },
+    { 0x00650065, -1 }, { 0x00000000, 0 }, { 0x00D80047, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00720037, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FE0074, -1 }, { 0x00000000, 0 }, { 0x005A0068, 1 },
+    { 0x00790066, -1 }, { 0x00510052, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005200DE, 1 }, { 0x006E0069, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00460055, -4 }, { 0x00650053, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00340029, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0063006C, -1 }, { 0x00000000, 0 },
+    { 0x005A0056, -4 }, { 0x00790054, -8 }, { 0x201C005A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0058006F, -1 }, { 0x0077006D, -1 }, { 0x00000000, 0 },
+    { 0x004F0059, -6 }, { 0x006E0057, -1 }, { 0x00460043, -5 }, { 0x00650041, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0074, -1 }, { 0x004D0072, 1 }, { 0x006C0070, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A0044, -4 }, { 0x00000000, 0 },
+    { 0x0070002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00610073, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004F0047, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00460031, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00370078, -1 }, { 0x00750074, -1 }, { 0x006C005E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0044004A, -8 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0079, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00610061, -2 }, { 0x00000000, 0 },
+    { 0x0058004B, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00300037, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560064, -2 }, { 0x00750062, -2 }, { 0x00000000, 0 },
+    { 0x004D004E, -4 }, { 0x00000000, 0 }, { 0x00630036, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700F0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B0067, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420051, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00770037, -6 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560052, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700DE, 1 }, { 0x0054006B, -3 },
+    { 0x00730069, -1 }, { 0x00000000, 0 }, { 0x004B0055, -6 }, { 0x00C7004D, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00390029, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0068006C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540059, -4 }, { 0x00730057, -1 }, { 0x004B0043, -7 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00710070, -2 }, { 0x00CE006A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00280077, -2 }, { 0x00470075, -2 }, { 0x00660073, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540047, -5 }, { 0x00000000, 0 },
+    { 0x0062201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D007A, -2 }, { 0x005B0076, -3 }, { 0x007A0074, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0049004A, -6 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0031007B, -1 }, { 0x006F0077, -2 }, { 0x00000000, 0 }, { 0x00280065, -2 },
+    { 0x00470063, -2 }, { 0x00660061, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0021, 1 }, { 0x0064007A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0064, -3 }, { 0x007A0062, -2 },
+    { 0x00000000, 0 }, { 0x0052004E, -4 }, { 0x0071004C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0078007B, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006F0065, -1 }, { 0x00000000, 0 },
+    { 0x00280053, -2 }, { 0x00470051, -2 }, { 0x00F0201E, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0045006A, -2 }, { 0x00640068, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0079, -1 }, { 0x00000000, 0 },
+    { 0x00780069, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00310057, -2 },
+    { 0x00500055, -4 }, { 0x00280041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E006E, -3 }, { 0x00000000, 0 }, { 0x00450058, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0062006F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590059, -4 }, { 0x00780057, -1 },
+    { 0x00500043, -5 }, { 0x006F0041, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570072, -1 },
+    { 0x00760070, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00450046, -4 }, { 0x0053201D, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B0073, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590047, -6 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410078, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E004A, -8 },
+    { 0x00000000, 0 }, { 0x00450034, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00740077, -1 }, { 0x00F0006F, -1 }, { 0x00000000, 0 },
+    { 0x006B0061, -4 }, { 0x00000000, 0 }, { 0x0043004D, -4 }, { 0x00DE0043, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0069007A, -1 }, { 0x01040070, 2 }, { 0x00000000, 0 }, { 0x00410066, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057004E, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00740065, -2 },
+    { 0x012B0129, 3 }, { 0x002D0053, -6 }, { 0x004C0051, -3 }, { 0x006B004F, -2 },
+    { 0x00DE0031, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A006A, -1 }, { 0x004400C7, -4 },
+    { 0x00410054, -9 }, { 0x00690068, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00550055, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00340070, -1 }, { 0x0053006E, 1 }, { 0x004A0058, -5 },
+    { 0x0072006C, -1 }, { 0x00C60050, -4 }, { 0x00410042, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0067006F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005E0059, -2 },
+    { 0x00000000, 0 }, { 0x00550043, -4 }, { 0x00740041, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201E0076, -3 }, { 0x00000000, 0 }, { 0x0072005A, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004A0046, -5 }, { 0x0058201D, -1 }, { 0x00410030, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00700073, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x003F0049, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460078, -5 },
+    { 0x00650076, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0053004A, -8 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A0079, -1 }, { 0x00790077, -1 },
+    { 0x00000000, 0 }, { 0x00700061, -1 }, { 0x00000000, 0 }, { 0x0048004D, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x003F0037, 1 }, { 0x007D0033, -1 },
+    { 0x007100ED, -1 }, { 0x006E007A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00460066, -3 }, { 0x00650064, -1 }, { 0x00000000, 0 }, { 0x00D80046, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006600F0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A0067, -1 },
+    { 0x00790065, -2 }, { 0x00000000, 0 }, { 0x00510051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F006A, -2 },
+    { 0x004900C7, -3 }, { 0x00460054, -4 }, { 0x006E0068, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0063006B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005A0055, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00390070, -1 }, { 0x0058006E, 1 },
+    { 0x004F0058, -7 }, { 0x006E0056, -2 }, { 0x0077006C, -2 }, { 0x00460042, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004D0071, 1 }, { 0x006C006F, -2 }, { 0x00000000, 0 },
+    { 0x00630059, -3 }, { 0x00000000, 0 }, { 0x005A0043, -6 }, { 0x00790041, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00420074, -1 }, { 0x00610072, -1 }, { 0x0077005A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F0046, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00750073, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00440049, -3 }, { 0x00630047, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0058004A, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560063, -2 }, { 0x00750061, -1 },
+    { 0x004D004D, -4 }, { 0x00CF012B, 1 }, { 0x00EE0129, 2 }, { 0x00440037, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0073007A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B0066, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00420050, -4 }, { 0x0061004E, -2 }, { 0x00580038, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006B00F0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00370053, -1 },
+    { 0x00560051, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0054006A, -2 }, { 0x004E00C7, -4 }, { 0x004B0054, -6 }, { 0x00730068, -1 },
+    { 0x00C7004C, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0068006B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00370041, -1 }, { 0x0056003F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540058, -5 }, { 0x00730056, -2 }, { 0x00000000, 0 },
+    { 0x004B0042, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00330073, -1 }, { 0x0071006F, -4 },
+    { 0x00000000, 0 }, { 0x0046012B, 1 }, { 0x00680059, -3 }, { 0x00210047, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280076, -2 }, { 0x00470074, -4 },
+    { 0x00660072, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540046, -5 },
+    { 0x0062201D, -1 }, { 0x004B0030, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005B0075, -3 }, { 0x007A0073, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490049, -1 }, { 0x00680047, -2 },
+    { 0x0076201E, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00500078, -1 }, { 0x006F0076, -3 }, { 0x00280064, -2 },
+    { 0x00470062, -3 }, { 0x0129006A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540034, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00640079, -1 }, { 0x00000000, 0 }, { 0x201D0067, -1 }, { 0x005B0063, -3 },
+    { 0x007A0061, -3 }, { 0x0052004D, -4 }, { 0x0071004B, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0078007A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006F0064, -1 }, { 0x00000000, 0 },
+    { 0x00280052, -1 }, { 0x00470050, -4 }, { 0x0066004E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540022, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00640067, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005B0051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00710039, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0078, -3 },
+    { 0x00000000, 0 }, { 0x0059006A, -2 }, { 0x005300C7, -4 }, { 0x00310056, -2 },
+    { 0x00500054, -4 }, { 0x00780068, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450057, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00520029, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00430070, -1 }, { 0x0062006E, -2 }, { 0x00590058, -5 }, { 0x00780056, -2 },
+    { 0x00000000, 0 }, { 0x00500042, -4 }, { 0x00000000, 0 }, { 0x0047002C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570071, -1 },
+    { 0x0076006F, -3 }, { 0x00000000, 0 }, { 0x006A0129, 1 }, { 0x006D0059, -3 },
+    { 0x00450045, -4 }, { 0x00000000, 0 }, { 0x0034201E, -2 }, { 0x0053201C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0074, -1 },
+    { 0x006B0072, -1 }, { 0x00DE0054, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590046, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410077, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0049, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550078, -1 }, { 0x00740076, -1 },
+    { 0x012E006A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0043004C, -4 },
+    { 0x0062004A, -3 }, { 0x00590034, -5 }, { 0x00DE0042, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00690079, -2 }, { 0x004400D8, -4 }, { 0x00000000, 0 },
+    { 0x00410065, -4 }, { 0x00000000, 0 }, { 0x0057004D, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006100EF, 1 },
+    { 0x007D007A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00740064, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0050, -4 }, { 0x006B004E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590022, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00690067, -2 }, { 0x00000000, 0 },
+    { 0x004400C6, -7 }, { 0x00410053, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450152, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x003F006C, 1 }, { 0x005800C7, -7 },
+    { 0x00550054, -4 }, { 0x005E006A, -1 }, { 0x00F0004A, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0072006B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004A0057, -4 }, { 0x00C6004F, -5 }, { 0x00410041, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00EF00EF, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0067006E, -2 }, { 0x00000000, 0 }, { 0x003F005A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550042, -4 }, { 0x00000000, 0 },
+    { 0x006B002A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007B006F, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0034005D, -2 },
+    { 0x00720059, -1 }, { 0x004A0045, -4 }, { 0x00000000, 0 }, { 0x0039201E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00700072, -2 }, { 0x00EC006A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x003F0048, 2 }, { 0x006C201D, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460077, -3 },
+    { 0x00650075, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00530049, -3 }, { 0x00720047, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00790076, -1 },
+    { 0x00000000, 0 }, { 0x00510062, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0048004C, -4 }, { 0x00000000, 0 }, { 0x007D0032, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007100EC, -1 }, { 0x0030007D, -1 }, { 0x004900D8, -2 },
+    { 0x006E0079, -3 }, { 0x00460065, -4 }, { 0x00650063, -1 }, { 0x007B004B, -1 },
+    { 0x00D80045, 1 }, { 0x00000000, 0 }, { 0x00340039, -1 }, { 0x00530037, -1 },
+    { 0x006600EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005A0066, -1 }, { 0x00790064, -2 }, { 0x201C006A, -2 }, { 0x00510050, -3 },
+    { 0x0070004E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007A00F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006E0067, -1 },
+    { 0x00000000, 0 }, { 0x004900C6, -2 }, { 0x00460053, -7 }, { 0x00650051, 1 },
+    { 0x00000000, 0 }, { 0x007B0039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004A0152, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0063006A, -2 },
+    { 0x00000000, 0 }, { 0x005A0054, -4 }, { 0x201C0058, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058006D, 1 }, { 0x0077006B, -2 },
+    { 0x00000000, 0 }, { 0x00300059, -1 }, { 0x004F0057, -5 }, { 0x00460041, -8 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006C006E, -1 }, { 0x00000000, 0 },
+    { 0x0044005A, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A0042, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00610071, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00770059, -1 }, { 0x00000000, 0 }, { 0x004F0045, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D80152, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00750072, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440048, -4 }, { 0x00630046, -2 },
+    { 0x0071201D, -2 }, { 0x0079002E, -1 }, { 0x201C0034, -3 }, { 0x00000000, 0 },
+    { 0x002C0079, -1 }, { 0x004B0077, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00580049, -3 }, { 0x00770047, -2 }, { 0x00000000, 0 },
+    { 0x004F0033, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560062, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004D004C, -4 }, { 0x006C004A, -3 }, { 0x00630034, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00730079, -2 },
+    { 0x004E00D8, -4 }, { 0x00000000, 0 }, { 0x004B0065, -2 }, { 0x00000000, 0 },
+    { 0x0042004F, -4 }, { 0x0061004D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560050, -5 }, { 0x0075004E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00630022, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540069, -2 }, { 0x00730067, -1 }, { 0x004E00C6, -5 }, { 0x004B0053, -5 },
+    { 0x00C7004B, -4 }, { 0x012A012B, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004F0152, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0068006A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540057, -4 }, { 0x00000000, 0 },
+    { 0x004B0041, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00610029, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0071006E, -4 },
+    { 0x012B0062, 2 }, { 0x0049005A, -2 }, { 0x00680058, 1 }, { 0x00000000, 0 },
+    { 0x00210046, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280075, -2 }, { 0x00470073, -3 },
+    { 0x00660071, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540045, -4 },
+    { 0x00000000, 0 }, { 0x0062201C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0074, -1 }, { 0x007A0072, -1 },
+    { 0x201D0078, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490048, -2 },
+    { 0x00680046, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00310079, -3 }, { 0x006F0075, -1 }, { 0x00000000, 0 },
+    { 0x00280063, -3 }, { 0x00470061, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00640078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0052004C, -4 }, { 0x00000000, 0 },
+    { 0x00680034, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00780079, -2 }, { 0x005300D8, -4 }, { 0x00000000, 0 }, { 0x006F0063, -1 },
+    { 0x00000000, 0 }, { 0x00280051, -2 }, { 0x0047004F, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540021, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00640066, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007A004E, -2 }, { 0x00000000, 0 }, { 0x00710038, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00680022, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00780067, -4 }, { 0x012F012B, 1 }, { 0x005300C6, -6 },
+    { 0x00500053, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540152, -6 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004E006C, -3 }, { 0x006D006A, -2 }, { 0x00450056, -4 },
+    { 0x00640054, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590057, -4 },
+    { 0x00780055, -1 }, { 0x00500041, -8 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570070, -2 }, { 0x0076006E, -2 }, { 0x004E005A, -5 }, { 0x006D0058, 1 },
+    { 0x00000000, 0 }, { 0x00450044, -4 }, { 0x0034201D, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B0071, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0053, -1 }, { 0x00000000, 0 },
+    { 0x00590045, -5 }, { 0x00780043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410076, -6 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E0048, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00360079, -2 }, { 0x00740075, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0043004B, -4 },
+    { 0x00DE0041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00690078, -1 }, { 0x00000000, 0 },
+    { 0x00410064, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057004C, -5 },
+    { 0x0076004A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007D0079, -2 }, { 0x005800D8, -4 }, { 0x00000000, 0 },
+    { 0x00740063, -2 }, { 0x00000000, 0 }, { 0x004C004F, -5 }, { 0x006B004D, 1 },
+    { 0x00000000, 0 }, { 0x00430039, -1 }, { 0x00620037, -4 }, { 0x007500EF, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00690066, -2 },
+    { 0x00000000, 0 }, { 0x00410052, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006D0022, 1 },
+    { 0x00000000, 0 }, { 0x004200DE, 1 }, { 0x003F006B, 1 }, { 0x00000000, 0 },
+    { 0x005800C6, -4 }, { 0x00550053, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590152, -7 },
+    { 0x00000000, 0 }, { 0x005600DF, -1 }, { 0x0053006C, 1 }, { 0x0072006A, -2 },
+    { 0x004A0056, -4 }, { 0x00690054, -2 }, { 0x00C6004E, -4 }, { 0x00EE0062, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EF00EE, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x003F0059, 2 }, { 0x00000000, 0 }, { 0x00550041, -6 }, { 0x0074003F, -1 },
+    { 0x00F00037, -2 }, { 0x006B0029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B006E, -3 }, { 0x201E0074, -1 }, { 0x0053005A, -4 },
+    { 0x00720058, -2 }, { 0x00000000, 0 }, { 0x004A0044, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00510073, -1 }, { 0x00700071, -1 }, { 0x00000000, 0 }, { 0x0064012B, 2 },
+    { 0x00000000, 0 }, { 0x003F0047, 1 }, { 0x00000000, 0 }, { 0x006C201C, -1 },
+    { 0x0074002D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00460076, -3 }, { 0x00650074, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0034004A, -3 }, { 0x00530048, -4 }, { 0x00720046, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A0077, -1 },
+    { 0x00790075, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0048004B, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x003F0035, 1 },
+    { 0x007D0031, -1 }, { 0x00000000, 0 }, { 0x004F007A, -1 }, { 0x006E0078, -1 },
+    { 0x012B00DF, 1 }, { 0x00460064, -4 }, { 0x00650062, -2 }, { 0x00000000, 0 },
+    { 0x00D80044, 1 }, { 0x00000000, 0 }, { 0x00720034, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0044007D, -3 }, { 0x0063007B, -1 },
+    { 0x00000000, 0 }, { 0x005A0065, -1 }, { 0x00790063, -2 }, { 0x0051004F, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670037, -4 }, { 0x00000000, 0 },
+    { 0x007A00EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0030006A, -2 }, { 0x006E0066, -2 }, { 0x00460052, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B0038, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00720022, 2 }, { 0x00000000, 0 }, { 0x004700DE, 1 }, { 0x00630069, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A0053, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00290029, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058006C, 1 },
+    { 0x0077006A, -3 }, { 0x00300058, -1 }, { 0x004F0056, -6 }, { 0x006E0054, -7 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D006F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00440059, -7 }, { 0x00630057, -1 }, { 0x005A0041, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00700029, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00610070, -2 }, { 0x00000000, 0 },
+    { 0x0058005A, -4 }, { 0x00770058, -2 }, { 0x00000000, 0 }, { 0x004F0044, -4 },
+    { 0x00000000, 0 }, { 0x0046002E, -6 }, { 0x0065002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560073, -2 }, { 0x00750071, -1 }, { 0x00000000, 0 },
+    { 0x0069012B, 2 }, { 0x00000000, 0 }, { 0x00440047, -4 }, { 0x00000000, 0 },
+    { 0x0071201C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B0076, -4 }, { 0x006A0074, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0039004A, -3 }, { 0x00580048, -4 },
+    { 0x00770046, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560061, -2 },
+    { 0x00000000, 0 }, { 0x004D004B, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054007A, -7 },
+    { 0x00730078, -2 }, { 0x00000000, 0 }, { 0x004B0064, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0042004E, -4 }, { 0x00000000, 0 }, { 0x00580036, -1 },
+    { 0x00770034, -2 }, { 0x00000000, 0 }, { 0x00300022, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0056004F, -6 }, { 0x0075004D, 1 }, { 0x00000000, 0 }, { 0x006C0037, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0035006A, -2 }, { 0x00540068, -3 }, { 0x002C0054, -5 },
+    { 0x004B0052, -4 }, { 0x00730066, -2 }, { 0x00C7004A, -6 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00770022, 2 }, { 0x00000000, 0 }, { 0x004C00DE, 1 },
+    { 0x00680069, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0037003F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00350058, -1 }, { 0x00540056, -4 },
+    { 0x00730054, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0071006D, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490059, -3 }, { 0x00680057, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00750029, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280074, -2 },
+    { 0x00470072, -3 }, { 0x00660070, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540044, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0073, -4 }, { 0x007A0071, -2 },
+    { 0x00000000, 0 }, { 0x0052005D, -1 }, { 0x00000000, 0 }, { 0x00490047, -3 },
+    { 0x00000000, 0 }, { 0x0057201E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00EE00DF, 1 }, { 0x006F0074, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00450079, -3 }, { 0x00640077, -1 }, { 0x00000000, 0 },
+    { 0x005B0061, -3 }, { 0x201D0065, -1 }, { 0x0052004B, -4 }, { 0x00710049, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0059007A, -3 }, { 0x00780078, -1 }, { 0x00000000, 0 }, { 0x00310066, -1 },
+    { 0x006F0062, -2 }, { 0x00000000, 0 }, { 0x00280050, -1 }, { 0x0047004E, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00640065, -2 },
+    { 0x00000000, 0 }, { 0x005B004F, -1 }, { 0x007A004D, 1 }, { 0x201D0053, -1 },
+    { 0x00710037, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE0076, -1 }, { 0x00000000, 0 }, { 0x00780066, -2 }, { 0x00000000, 0 },
+    { 0x00310054, -3 }, { 0x00500052, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004E006B, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00450055, -4 }, { 0x00000000, 0 }, { 0x201D0041, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00330029, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0062006C, -1 }, { 0x00000000, 0 }, { 0x00590056, -4 },
+    { 0x00780054, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0057006F, -1 }, { 0x0076006D, -1 }, { 0x00000000, 0 }, { 0x004E0059, -4 },
+    { 0x006D0057, -1 }, { 0x00450043, -5 }, { 0x00640041, -2 }, { 0x0034201C, -2 },
+    { 0x007A0029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006B0070, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590044, -4 }, { 0x00000000, 0 }, { 0x0050002E, -5 },
+    { 0x006F002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410075, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E0047, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00360078, -2 },
+    { 0x00740074, -1 }, { 0x006B005E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0043004A, -7 }, { 0x00620048, 1 }, { 0x00780030, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00690077, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410063, -3 }, { 0x00000000, 0 }, { 0x0057004B, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007D0078, -2 }, { 0x00000000, 0 },
+    { 0x00360066, -1 }, { 0x00740062, -2 }, { 0x00F0005A, -4 }, { 0x004C004E, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x003A0022, 3 }, { 0x0053007D, -2 }, { 0x005600F0, -2 }, { 0x0072007B, -2 },
+    { 0x00690065, -2 }, { 0x00000000, 0 }, { 0x00410051, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00760037, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007D0066, -1 },
+    { 0x00000000, 0 }, { 0x00550052, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005600DE, 1 }, { 0x0053006B, 1 }, { 0x00720069, -1 },
+    { 0x00000000, 0 }, { 0x004A0055, -4 }, { 0x00690053, 1 }, { 0x00C6004D, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00380029, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00290070, -1 }, { 0x0067006C, -1 },
+    { 0x003F0058, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B006D, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00530059, -7 }, { 0x00000000, 0 }, { 0x004A0043, -4 }, { 0x00690041, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00510072, -1 }, { 0x00700070, -3 }, { 0x00C700C7, -4 },
+    { 0x00CD006A, -2 }, { 0x00000000, 0 }, { 0x003F0046, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00460075, -3 }, { 0x00650073, -2 }, { 0x00000000, 0 }, { 0x00D80055, 1 },
+    { 0x00000000, 0 }, { 0x00530047, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C007A, -1 },
+    { 0x005A0076, -1 }, { 0x00790074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0048004A, -7 }, { 0x00000000, 0 }, { 0x003F0034, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006E0077, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460063, -4 }, { 0x00650061, -1 },
+    { 0x00D80043, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00340037, -2 },
+    { 0x00720033, -2 }, { 0x00000000, 0 }, { 0x0063007A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005A0064, -1 }, { 0x00790062, -2 }, { 0x00000000, 0 },
+    { 0x0051004E, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005B00F0, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006E0065, -1 }, { 0x00000000, 0 }, { 0x00460051, -3 },
+    { 0x0065004F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002800DF, -2 },
+    { 0x0044006A, -2 }, { 0x00630068, -1 }, { 0x005A0052, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058006B, 1 },
+    { 0x00770069, -2 }, { 0x00000000, 0 }, { 0x004F0055, -4 }, { 0x006E0053, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D006E, 1 },
+    { 0x006C006C, -1 }, { 0x00440058, -7 }, { 0x00630056, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0061006F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00580059, -4 }, { 0x00000000, 0 }, { 0x004F0043, -4 },
+    { 0x006E0041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560072, -1 }, { 0x00750070, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440046, -4 },
+    { 0x0052201D, -1 }, { 0x0079002C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0077, -1 }, { 0x004B0075, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580047, -7 }, { 0x00000000, 0 },
+    { 0x0066201E, -2 }, { 0x00300033, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D004A, -7 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540079, -8 }, { 0x00730077, -2 }, { 0x00000000, 0 }, { 0x004B0063, -2 },
+    { 0x00000000, 0 }, { 0x0042004D, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00390037, -1 }, { 0x00770033, -2 }, { 0x00000000, 0 }, { 0x0068007A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0056004E, -5 }, { 0x00000000, 0 }, { 0x006C0036, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540067, -8 }, { 0x00730065, -1 }, { 0x00000000, 0 },
+    { 0x004B0051, -6 }, { 0x00C70049, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00770021, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0049006A, -2 }, { 0x004300C7, -4 }, { 0x00680068, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540055, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00420029, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00330070, -1 }, { 0x0071006C, -4 }, { 0x00490058, -2 }, { 0x00680056, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280073, -2 },
+    { 0x00470071, -2 }, { 0x0066006F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540043, -7 }, { 0x00730041, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0072, -4 },
+    { 0x007A0070, -2 }, { 0x0071005A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00490046, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00310077, -1 }, { 0x006F0073, -2 },
+    { 0x00000000, 0 }, { 0x00280061, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540031, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00640076, -1 }, { 0x00000000, 0 },
+    { 0x201D0064, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0052004A, -7 },
+    { 0x00710048, -2 }, { 0x00490034, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590079, -1 }, { 0x00780077, -2 }, { 0x00000000, 0 },
+    { 0x006F0061, -1 }, { 0x00000000, 0 }, { 0x0028004F, -2 }, { 0x0047004D, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450066, -1 },
+    { 0x00640064, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00710036, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490022, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590067, -3 }, { 0x00780065, -4 },
+    { 0x00000000, 0 }, { 0x00500051, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E006A, -2 }, { 0x004800C7, -4 },
+    { 0x00450054, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0062006B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590055, -4 }, { 0x00780053, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00470029, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00380070, -1 }, { 0x0057006E, -1 }, { 0x004E0058, -5 },
+    { 0x006D0056, -2 }, { 0x0076006C, -2 }, { 0x00450042, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012E0079, -3 }, { 0x00000000, 0 },
+    { 0x006B006F, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00620059, -3 },
+    { 0x00DE0051, 1 }, { 0x00590043, -7 }, { 0x00780041, -2 }, { 0x00000000, 0 },
+    { 0x0050002D, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410074, -5 }, { 0x00000000, 0 }, { 0x0076005A, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004E0046, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00360077, -1 },
+    { 0x00740073, -1 }, { 0x012E0067, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00430049, -3 }, { 0x00620047, -2 }, { 0x0070201E, -1 }, { 0x00590031, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00690076, -2 },
+    { 0x00000000, 0 }, { 0x00410062, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0057004A, -9 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00740061, -2 }, { 0x00CE012B, 1 }, { 0x004C004D, -4 },
+    { 0x00F00059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0072007A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00690064, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410050, -4 },
+    { 0x00000000, 0 }, { 0x00570038, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x003F0069, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550051, -2 }, { 0x00F00047, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0053006A, -2 },
+    { 0x004D00C7, -4 }, { 0x004A0054, -4 }, { 0x00720068, -2 }, { 0x00C6004C, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EF00EC, 1 },
+    { 0x00000000, 0 }, { 0x00C700D8, -4 }, { 0x0067006B, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x003F0057, 3 }, { 0x00000000, 0 }, { 0x00360041, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0029, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00530058, -6 }, { 0x00720056, -1 }, { 0x00000000, 0 }, { 0x004A0042, -4 },
+    { 0x00000000, 0 }, { 0x0041002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0070006F, -1 }, { 0x00000000, 0 }, { 0x00C700C6, -4 },
+    { 0x00640129, 1 }, { 0x00670059, -1 }, { 0x003F0045, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012B00EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00460074, -3 }, { 0x00650072, -2 }, { 0x007B005A, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00530046, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005A0075, -1 }, { 0x00790073, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00480049, -3 }, { 0x00670047, -2 }, { 0x00000000, 0 },
+    { 0x005E0031, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004F0078, -1 }, { 0x006E0076, -3 }, { 0x00460062, -2 }, { 0x0128006A, -2 },
+    { 0x00000000, 0 }, { 0x00D80042, 1 }, { 0x00000000, 0 }, { 0x00720032, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002800F0, -3 }, { 0x00630079, -3 },
+    { 0x006600EC, 1 }, { 0x00000000, 0 }, { 0x005A0063, -1 }, { 0x00790061, -2 },
+    { 0x0051004D, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0077007A, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006E0064, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00460050, -5 }, { 0x0065004E, -2 }, { 0x007B0036, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00630067, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A0051, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0058006A, -2 }, { 0x005200C7, -5 }, { 0x00300056, -1 }, { 0x004F0054, -5 },
+    { 0x00770068, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D006D, 1 },
+    { 0x006C006B, -1 }, { 0x00000000, 0 }, { 0x00440057, -6 }, { 0x00630055, -1 },
+    { 0x00DF004D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00510029, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420070, -1 },
+    { 0x0061006E, -1 }, { 0x00580058, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004F0042, -4 }, { 0x00000000, 0 }, { 0x0046002C, -7 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00370073, -1 }, { 0x00560071, -2 },
+    { 0x0075006F, -1 }, { 0x006C0059, -1 }, { 0x00000000, 0 }, { 0x00440045, -4 },
+    { 0x00630043, -1 }, { 0x0033201E, -1 }, { 0x0052201C, -1 }, { 0x201C0031, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0076, -3 }, { 0x004B0074, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580046, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D0049, -3 }, { 0x006C0047, -4 },
+    { 0x00000000, 0 }, { 0x00440033, -1 }, { 0x00DF0029, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540078, -7 }, { 0x00730076, -2 }, { 0x004B0062, -1 },
+    { 0x00C7005A, -4 }, { 0x00EF006E, 1 }, { 0x0042004C, -4 }, { 0x0061004A, -3 },
+    { 0x00580034, -3 }, { 0x00770032, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00680079, -3 }, { 0x004300D8, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0056004D, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540066, -4 }, { 0x00730064, -1 },
+    { 0x00000000, 0 }, { 0x004B0050, -4 }, { 0x00C70048, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00680067, -1 }, { 0x00000000, 0 }, { 0x004300C6, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440152, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700C7, -6 }, { 0x00540054, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0071006B, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490057, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00EE00EF, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00280072, -2 }, { 0x00470070, -4 }, { 0x0066006E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540042, -4 }, { 0x00000000, 0 }, { 0x002C002E, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0071, -3 },
+    { 0x007A006F, -2 }, { 0x00000000, 0 }, { 0x00710059, -3 }, { 0x00000000, 0 },
+    { 0x00490045, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00310076, -3 },
+    { 0x006F0072, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006B201D, -2 }, { 0x00540030, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450077, -2 }, { 0x00640075, -1 },
+    { 0x00000000, 0 }, { 0x201D0063, -1 }, { 0x00000000, 0 }, { 0x00520049, -3 },
+    { 0x00710047, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590078, -3 }, { 0x00780076, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0028004E, -1 },
+    { 0x0047004C, -4 }, { 0x005D0034, -1 }, { 0x0066004A, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006D0079, -1 }, { 0x004800D8, -4 }, { 0x00000000, 0 },
+    { 0x00640063, -2 }, { 0x00000000, 0 }, { 0x201D0051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00520037, -1 }, { 0x00710035, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590066, -1 },
+    { 0x00780064, -4 }, { 0x00000000, 0 }, { 0x00500050, -4 }, { 0x006F004E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007900F0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0069, -2 }, { 0x00000000, 0 },
+    { 0x004800C6, -4 }, { 0x00450053, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490152, -3 },
+    { 0x00000000, 0 }, { 0x004600DF, -1 }, { 0x0062006A, -2 }, { 0x00000000, 0 },
+    { 0x00590054, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0057006D, -1 }, { 0x0076006B, -2 }, { 0x00000000, 0 },
+    { 0x004E0057, -4 }, { 0x00000000, 0 }, { 0x00450041, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006B006E, -1 }, { 0x00000000, 0 }, { 0x0043005A, -4 },
+    { 0x00620058, -1 }, { 0x00000000, 0 }, { 0x00590042, -4 }, { 0x00000000, 0 },
+    { 0x0050002C, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410073, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054012B, 1 },
+    { 0x00760059, -1 }, { 0x004E0045, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00360076, -1 }, { 0x00740072, -1 }, { 0x00F0006A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00430048, -4 }, { 0x00620046, -2 }, { 0x00590030, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00690075, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410061, -3 }, { 0x00000000, 0 },
+    { 0x00570049, -3 }, { 0x00760047, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005E0078, -2 },
+    { 0x007D0076, -1 }, { 0x00550062, 1 }, { 0x00F00058, -2 }, { 0x00000000, 0 },
+    { 0x004C004C, -4 }, { 0x006B004A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x003700F0, -1 }, { 0x0034007D, -2 }, { 0x004D00D8, -4 },
+    { 0x00720079, -2 }, { 0x00690063, -2 }, { 0x00000000, 0 }, { 0x0041004F, -6 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006A00EF, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x003F0068, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550050, -5 },
+    { 0x0074004E, -2 }, { 0x006B0038, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00620022, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00530069, 1 },
+    { 0x00720067, -2 }, { 0x004D00C6, -4 }, { 0x004A0053, -5 }, { 0x00C6004B, -4 },
+    { 0x0129012B, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E0152, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0067006A, -1 },
+    { 0x00000000, 0 }, { 0x003F0056, 3 }, { 0x005E0054, -3 }, { 0x00000000, 0 },
+    { 0x00F00034, -3 }, { 0x00000000, 0 }, { 0x002D002A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00340059, -2 }, { 0x00530057, -6 }, { 0x004A0041, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0070006E, -2 }, { 0x00000000, 0 },
+    { 0x0048005A, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x003F0044, 2 },
+    { 0x00000000, 0 }, { 0x0074002A, -1 }, { 0x012B00EE, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00460073, -4 }, { 0x00650071, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00530045, -4 }, { 0x00000000, 0 },
+    { 0x0061201C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005A0074, -1 }, { 0x00790072, -2 }, { 0x201C0078, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480048, -4 }, { 0x00670046, -2 },
+    { 0x003F0032, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006E0075, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460061, -4 },
+    { 0x00000000, 0 }, { 0x007B0047, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00340035, -1 }, { 0x00720031, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00630078, -2 }, { 0x00000000, 0 }, { 0x005A0062, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0051004C, -3 }, { 0x0070004A, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0039007D, -1 },
+    { 0x005200D8, -4 }, { 0x00770079, -1 }, { 0x006E0063, -1 }, { 0x00000000, 0 },
+    { 0x0046004F, -5 }, { 0x0065004D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00630066, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005A0050, -4 }, { 0x0079004E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00670022, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580069, 1 }, { 0x00770067, -2 }, { 0x005200C6, -4 }, { 0x004F0053, -6 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00530152, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004D006C, 1 }, { 0x006C006A, -2 }, { 0x00440056, -6 }, { 0x00630054, -7 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00390059, -1 }, { 0x00580057, -4 },
+    { 0x004F0041, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00650029, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00370072, -1 },
+    { 0x00560070, -2 }, { 0x004D005A, -4 }, { 0x006C0058, 1 }, { 0x0075006E, -1 },
+    { 0x00440044, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0042005D, -1 }, { 0x00000000, 0 }, { 0x00580045, -4 },
+    { 0x00000000, 0 }, { 0x0047201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D0048, -4 },
+    { 0x006C0046, -2 }, { 0x00630030, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00350079, -2 }, { 0x00540077, -8 }, { 0x00730075, -2 },
+    { 0x004B0061, -1 }, { 0x00C70059, -4 }, { 0x0042004B, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00770031, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00680078, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056004C, -5 }, { 0x0075004A, -3 },
+    { 0x006C0034, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004100F0, -1 },
+    { 0x00000000, 0 }, { 0x005700D8, -5 }, { 0x00000000, 0 }, { 0x00540065, -8 },
+    { 0x00730063, -1 }, { 0x004B004F, -7 }, { 0x00C70047, -4 }, { 0x00EC012B, 1 },
+    { 0x00610037, -3 }, { 0x00000000, 0 }, { 0x007400EF, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A006A, -1 }, { 0x00680066, -2 },
+    { 0x00210054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004100DE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700C6, -8 },
+    { 0x00540053, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580152, -7 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490056, -3 },
+    { 0x00680054, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00EE00EE, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00280071, -2 }, { 0x0047006F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540041, -9 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007A006E, -1 }, { 0x00000000, 0 }, { 0x0052005A, -4 }, { 0x00710058, -2 },
+    { 0x00000000, 0 }, { 0x00490044, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006F0071, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0047005D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B201C, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450076, -3 },
+    { 0x00640074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0033004A, -3 }, { 0x00520048, -4 }, { 0x00710046, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590077, -1 }, { 0x00780075, -2 },
+    { 0x00000000, 0 }, { 0x00500061, -1 }, { 0x00000000, 0 }, { 0x0047004B, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004E007A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00640062, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007A004A, -3 },
+    { 0x00000000, 0 }, { 0x00520036, -1 }, { 0x00710034, -2 }, { 0x00000000, 0 },
+    { 0x002A0022, 1 }, { 0x004600F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590065, -3 }, { 0x00780063, -3 }, { 0x0050004F, -4 }, { 0x006F004D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007900EF, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0068, -3 },
+    { 0x00000000, 0 }, { 0x00450052, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00620069, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590053, -7 }, { 0x00780051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005A00DF, 1 }, { 0x0076006A, -3 }, { 0x00000000, 0 },
+    { 0x004E0056, -4 }, { 0x006D0054, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F0007B, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00430059, -4 }, { 0x00620057, -1 }, { 0x00590041, -9 }, { 0x0078003F, -1 },
+    { 0x00DE004F, 1 }, { 0x0031002D, -1 }, { 0x006F0029, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410072, -2 }, { 0x00000000, 0 }, { 0x0057005A, -6 },
+    { 0x00760058, -2 }, { 0x00000000, 0 }, { 0x004E0044, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00740071, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C005D, -4 },
+    { 0x00000000, 0 }, { 0x00430047, -4 }, { 0x00620045, 1 }, { 0x0070201C, -1 },
+    { 0x0078002D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00690074, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0038004A, -3 }, { 0x00570048, -4 }, { 0x00760046, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C004B, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00720078, -3 },
+    { 0x00000000, 0 }, { 0x00690062, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0041004E, -4 }, { 0x00000000, 0 }, { 0x00570036, -1 }, { 0x00760034, -2 },
+    { 0x00000000, 0 }, { 0x004B00F0, -2 }, { 0x006A00EE, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0055004F, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B0037, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0034006A, -2 }, { 0x00530068, 1 }, { 0x004A0052, -5 }, { 0x00720066, -1 },
+    { 0x00C6004A, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00760022, 2 }, { 0x00000000, 0 }, { 0x004B00DE, 1 }, { 0x00670069, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x003F0055, 2 }, { 0x005E0053, -1 },
+    { 0x00000000, 0 }, { 0x00F00033, -3 }, { 0x00000000, 0 }, { 0x002D0029, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00530056, -7 }, { 0x00720054, -8 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00480059, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00740029, -1 }, { 0x012B00ED, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460072, -4 }, { 0x00650070, -3 },
+    { 0x00D80052, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00530044, -4 },
+    { 0x0042201D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00790071, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480047, -4 }, { 0x00000000, 0 },
+    { 0x0056201E, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00300078, -1 }, { 0x006E0074, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00630077, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x01520051, 1 },
+    { 0x00000000, 0 }, { 0x0051004B, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00290037, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058007A, 1 },
+    { 0x00770078, -3 }, { 0x00000000, 0 }, { 0x004F0064, 1 }, { 0x006E0062, -2 },
+    { 0x00000000, 0 }, { 0x0046004E, -5 }, { 0x00000000, 0 }, { 0x007B0034, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005000F0, -1 }, { 0x006C007B, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00630065, -4 }, { 0x00000000, 0 },
+    { 0x005A004F, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00700037, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0039006A, -2 }, { 0x00580068, 1 }, { 0x004F0052, -4 },
+    { 0x00770066, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005000DE, 1 },
+    { 0x004D006B, 1 }, { 0x006C0069, -1 }, { 0x00000000, 0 }, { 0x00440055, -4 },
+    { 0x00630053, 1 }, { 0x201C0041, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00320029, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0061006C, -1 }, { 0x00000000, 0 }, { 0x00390058, -1 }, { 0x00580056, -4 },
+    { 0x00770054, -8 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056006F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D0059, -5 }, { 0x006C0057, -1 },
+    { 0x00440043, -4 }, { 0x00630041, -2 }, { 0x00000000, 0 }, { 0x00790029, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0074, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580044, -4 }, { 0x0047201D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D0047, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00350078, -2 }, { 0x00540076, -8 },
+    { 0x00730074, -2 }, { 0x00C70058, -4 }, { 0x00EF006C, 1 }, { 0x0042004A, -8 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00680077, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056004B, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00350066, -1 },
+    { 0x00540064, -8 }, { 0x00730062, -2 }, { 0x004B004E, -4 }, { 0x00C70046, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00390022, 2 },
+    { 0x0052007D, -2 }, { 0x0071007B, -1 }, { 0x00000000, 0 }, { 0x00680065, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00750037, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540052, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005500DE, 1 }, { 0x00710069, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00490055, -3 }, { 0x00680053, 1 }, { 0x00210041, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00280070, -1 }, { 0x0047006E, -2 }, { 0x0066006C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005B006F, -3 }, { 0x201D0073, -1 }, { 0x00000000, 0 }, { 0x00520059, -7 },
+    { 0x00710057, -2 }, { 0x00490043, -3 }, { 0x00680041, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00310074, -1 }, { 0x006F0070, -3 }, { 0x0066005A, -2 }, { 0x00C600C7, -5 },
+    { 0x00CC006A, -2 }, { 0x00000000, 0 }, { 0x004C201D, -7 }, { 0x0054002E, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00640073, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D0061, -2 }, { 0x00000000, 0 },
+    { 0x00520047, -5 }, { 0x00710045, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590076, -1 },
+    { 0x00780074, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0028004C, -1 }, { 0x0047004A, -8 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0079, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00640061, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00710033, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0062007A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590064, -3 }, { 0x00780062, -2 }, { 0x00000000, 0 }, { 0x0050004E, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005A00F0, -1 }, { 0x0076007B, -1 }, { 0x00000000, 0 }, { 0x004E0067, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450051, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007A0037, -3 }, { 0x00000000, 0 }, { 0x00710021, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0043006A, -3 },
+    { 0x00620068, -2 }, { 0x003A0054, -2 }, { 0x00590052, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005A00DE, 1 }, { 0x00760069, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004E0055, -4 }, { 0x006D0053, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F0007A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B006C, -1 }, { 0x00000000, 0 },
+    { 0x00430058, -4 }, { 0x00620056, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410071, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570059, -4 }, { 0x00000000, 0 }, { 0x004E0043, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00360074, -1 }, { 0x00740070, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00430046, -4 }, { 0x00620044, 1 },
+    { 0x0059002E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00690073, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00570047, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007D0074, -1 }, { 0x00000000, 0 }, { 0x0074005E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004C004A, -7 }, { 0x00000000, 0 }, { 0x00430034, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00530079, -2 },
+    { 0x00720077, -1 }, { 0x00000000, 0 }, { 0x00690061, -2 }, { 0x00000000, 0 },
+    { 0x0041004D, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00380037, -1 },
+    { 0x00760033, -3 }, { 0x00000000, 0 }, { 0x0067007A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0055004E, -5 }, { 0x00DF201D, -1 }, { 0x006B0036, -2 }, { 0x00F00044, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00530067, 1 }, { 0x00720065, -2 }, { 0x01290129, 1 }, { 0x004A0051, -2 },
+    { 0x00C60049, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00760021, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0048006A, -2 }, { 0x004200C7, -4 }, { 0x003F0054, 2 }, { 0x00670068, -2 },
+    { 0x00000000, 0 }, { 0x00F00032, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00340057, -1 }, { 0x00530055, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410029, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0070006C, -1 },
+    { 0x00000000, 0 }, { 0x00480058, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x003F0042, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012B00EC, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460071, -4 }, { 0x0065006F, -1 },
+    { 0x00000000, 0 }, { 0x00D80051, 3 }, { 0x00000000, 0 }, { 0x00530043, -4 },
+    { 0x00720041, -5 }, { 0x0042201C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A0072, 1 }, { 0x00790070, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480046, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006E0073, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00340033, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00440078, -2 }, { 0x00630076, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0051004A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00F0, -3 },
+    { 0x00580079, -2 }, { 0x00770077, -1 }, { 0x00000000, 0 }, { 0x006E0061, -1 },
+    { 0x00000000, 0 }, { 0x0046004D, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006C007A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00630064, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005A004E, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00580067, -1 }, { 0x00770065, -2 }, { 0x00000000, 0 },
+    { 0x004F0051, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004D006A, -2 }, { 0x004700C7, -4 }, { 0x00440054, -7 },
+    { 0x006C0068, -1 }, { 0x00DF004A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0061006B, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580055, -4 },
+    { 0x00000000, 0 }, { 0x00300041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00370070, -1 }, { 0x0056006E, -1 }, { 0x004D0058, -4 }, { 0x006C0056, -1 },
+    { 0x0075006C, -1 }, { 0x00440042, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0071, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00610059, -3 }, { 0x00000000, 0 },
+    { 0x00580043, -7 }, { 0x00770041, -5 }, { 0x0047201C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004D0046, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00350077, -1 }, { 0x00540075, -8 },
+    { 0x00730073, -2 }, { 0x00C70057, -4 }, { 0x00EF006B, 1 }, { 0x00420049, -3 },
+    { 0x00610047, -3 }, { 0x006F201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00680076, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056004A, -9 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540063, -8 }, { 0x00730061, -1 }, { 0x004B004D, -4 }, { 0x00C70045, -4 },
+    { 0x00CD012B, 1 }, { 0x00420037, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0071007A, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00680064, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560038, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540051, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0052006A, -2 }, { 0x004C00C7, -4 },
+    { 0x00490054, -3 }, { 0x00710068, -4 }, { 0x00CE0062, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C600D8, -4 }, { 0x0028006F, -2 }, { 0x0066006B, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00350041, -1 }, { 0x0054003F, -3 },
+    { 0x00000000, 0 }, { 0x004B0029, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005B006E, -4 }, { 0x007A006C, -1 }, { 0x00520058, -4 },
+    { 0x00710056, -3 }, { 0x201D0072, -1 }, { 0x00490042, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006F006F, -1 }, { 0x00000000, 0 }, { 0x00C600C6, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C201C, -7 },
+    { 0x0054002D, -2 }, { 0x00C70152, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00450074, -1 }, { 0x00640072, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00520046, -4 }, { 0x00710044, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590075, -1 },
+    { 0x00780073, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0028004B, -1 }, { 0x00470049, -3 }, { 0x00660047, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0078, -3 },
+    { 0x006D0076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520034, -1 }, { 0x00710032, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00620079, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590063, -3 }, { 0x00780061, -3 }, { 0x0050004D, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280039, -2 }, { 0x00470037, -1 },
+    { 0x00000000, 0 }, { 0x0076007A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E0066, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450050, -4 },
+    { 0x0064004E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00520022, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00620067, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x003A0053, 1 }, { 0x00590051, -5 },
+    { 0x0078004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057006A, -2 },
+    { 0x005100C7, -3 }, { 0x004E0054, -4 }, { 0x00760068, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B006B, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00430057, -4 }, { 0x00620055, 1 }, { 0x0059003F, -2 },
+    { 0x00DE004D, 1 }, { 0x00000000, 0 }, { 0x00500029, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410070, -3 }, { 0x00000000, 0 },
+    { 0x00570058, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0042, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00360073, -1 }, { 0x0074006F, -2 }, { 0x00000000, 0 },
+    { 0x006B0059, -4 }, { 0x00000000, 0 }, { 0x00430045, -4 }, { 0x00620043, 1 },
+    { 0x0051201C, -1 }, { 0x0059002D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00690072, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570046, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004C0049, -3 }, { 0x006B0047, -5 }, { 0x0079201E, -3 },
+    { 0x00DE0029, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0034007A, -1 },
+    { 0x00530078, -1 }, { 0x00720076, -1 }, { 0x00C6005A, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0041004C, -4 }, { 0x00000000, 0 }, { 0x00570034, -2 },
+    { 0x00760032, -3 }, { 0x00000000, 0 }, { 0x006A00EC, 1 }, { 0x00670079, -1 },
+    { 0x004200D8, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0055004D, -5 }, { 0x00F00043, 1 }, { 0x00DF201C, -1 }, { 0x004C0037, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B007A, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00530066, -1 }, { 0x00720064, -2 }, { 0x00000000, 0 },
+    { 0x004A0050, -5 }, { 0x0069004E, -2 }, { 0x00C60048, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00670067, -1 }, { 0x00000000, 0 }, { 0x004200C6, -6 }, { 0x003F0053, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F00031, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00430152, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005600C7, -6 }, { 0x00340056, -2 }, { 0x00530054, -7 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0051006D, -1 },
+    { 0x0070006B, -1 }, { 0x00000000, 0 }, { 0x00290059, -1 }, { 0x00480057, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460070, -4 },
+    { 0x0065006E, -2 }, { 0x00000000, 0 }, { 0x00D80050, 1 }, { 0x00000000, 0 },
+    { 0x00530042, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A0071, -1 }, { 0x0079006F, -2 },
+    { 0x00000000, 0 }, { 0x00700059, -3 }, { 0x00000000, 0 }, { 0x00480045, -4 },
+    { 0x00000000, 0 }, { 0x0037201E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F0074, 1 }, { 0x006E0072, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00340032, -1 }, { 0x0072002E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00630075, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00510049, -2 }, { 0x00700047, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00770076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046004C, -5 }, { 0x0065004A, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006C0079, -4 }, { 0x004700D8, -4 }, { 0x00000000, 0 }, { 0x00440065, 1 },
+    { 0x00630063, -3 }, { 0x005A004D, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00510037, -2 }, { 0x00000000, 0 }, { 0x006400EF, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580066, -1 }, { 0x00770064, -2 },
+    { 0x00000000, 0 }, { 0x004F0050, -4 }, { 0x006E004E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007800F0, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004D0069, 1 }, { 0x006C0067, -2 }, { 0x004700C6, -6 },
+    { 0x00440053, -6 }, { 0x00630051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480152, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0061006A, -2 }, { 0x00000000, 0 }, { 0x00390056, -1 },
+    { 0x00580054, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0056006D, -2 }, { 0x0075006B, -1 }, { 0x00000000, 0 }, { 0x002E0059, -1 },
+    { 0x004D0057, -5 }, { 0x00440041, -6 }, { 0x00DF0037, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0042005A, -4 }, { 0x00610058, 1 },
+    { 0x00000000, 0 }, { 0x00580042, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00750059, -1 }, { 0x00000000, 0 },
+    { 0x002E0047, -1 }, { 0x004D0045, -4 }, { 0x00000000, 0 }, { 0x0063002D, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00350076, -2 },
+    { 0x00540074, -7 }, { 0x00730072, -2 }, { 0x00C70056, -4 }, { 0x00EF006A, -2 },
+    { 0x00420048, -4 }, { 0x00610046, -2 }, { 0x00580030, -1 }, { 0x0077002E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00680075, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560049, -3 },
+    { 0x00750047, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540062, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B004C, -4 },
+    { 0x00C70044, -4 }, { 0x00610034, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0033007D, -1 }, { 0x004C00D8, -4 }, { 0x00710079, -2 },
+    { 0x00680063, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006900EF, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540050, -5 }, { 0x0073004E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00610022, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00710067, -2 }, { 0x0128012B, 1 },
+    { 0x004C00C6, -4 }, { 0x00490053, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D0152, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0028006E, -2 }, { 0x0047006C, -2 },
+    { 0x0066006A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005B006D, -4 }, { 0x007A006B, -1 }, { 0x201D0071, -1 },
+    { 0x00330059, -1 }, { 0x00520057, -6 }, { 0x00490041, -2 }, { 0x00710055, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00500070, -1 }, { 0x006F006E, -1 }, { 0x0047005A, -5 },
+    { 0x01290062, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0054002C, -6 }, { 0x0073002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00640071, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007A0059, -1 },
+    { 0x00000000, 0 }, { 0x00520045, -4 }, { 0x00710043, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590074, -1 }, { 0x00780072, -1 }, { 0x0050005E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0028004A, -1 }, { 0x00470048, -4 }, { 0x00660046, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0077, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007A0047, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00710031, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00620078, -4 },
+    { 0x00DE0070, -1 }, { 0x00590062, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0050004C, -4 }, { 0x006F004A, -3 }, { 0x00280038, -2 }, { 0x00660034, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0038007D, -1 }, { 0x005100D8, -3 },
+    { 0x00760079, -1 }, { 0x004E0065, -2 }, { 0x00000000, 0 }, { 0x0045004F, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00620066, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590050, -5 },
+    { 0x0078004E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00660022, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00760067, -3 },
+    { 0x00000000, 0 }, { 0x005100C6, -4 }, { 0x004E0053, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00520152, -5 }, { 0x00F00078, -1 }, { 0x00000000, 0 }, { 0x006B006A, -2 },
+    { 0x00000000, 0 }, { 0x00430056, -4 }, { 0x00620054, -8 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0031002A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041006F, -4 }, { 0x00000000, 0 },
+};
+
 static const EpdFontData opendyslexic_10_italic = {
     opendyslexic_10_italicBitmaps,
     opendyslexic_10_italicGlyphs,
@@ -3653,4 +5717,8 @@ static const EpdFontData opendyslexic_10_italic = {
     28,
     -11,
     true,
+    nullptr,
+    &opendyslexic_10_italicMetrics,
+    opendyslexic_10_italicKernPairs,
+    8192,
 };
@@ -3,7 +3,7 @@
  * name: opendyslexic_10_regular
  * size: 10
  * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_10_regular 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit
+ * Command used: fontconvert.py opendyslexic_10_regular 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit --kern-manifest font-manifest.txt
  */
 #pragma once
 #include "EpdFontData.h"
@@ -3176,6 +3176,54 @@ static const EpdUnicodeInterval opendyslexic_10_regularIntervals[] = {
     { 0x2264, 0x2265, 0x2D3 },
 };
 
+static const EpdFontMetrics opendyslexic_10_regularMetrics = {
+    16, 100, 18,
+    -5, 27, 29, -11,
+    {
+        18, 7, 11, 24, 25, 21, 20, 6, 9, 9, 13, 13, 7, 13, 5, 12,
+        14, 12, 13, 13, 14, 13, 14, 13, 14, 14, 6, 7, 17, 13, 17, 12,
+        25, 24, 20, 21, 23, 19, 18, 24, 22, 10, 16, 21, 19, 26, 22, 24,
+        19, 21, 20, 23, 22, 22, 24, 30, 24, 22, 24, 10, 10, 10, 12, 17,
+        9, 17, 18, 16, 18, 17, 13, 17, 17, 9, 13, 17, 11, 24, 17, 17,
+        17, 20, 14, 16, 15, 17, 19, 22, 19, 17, 17, 12, 5, 12, 10,
+    },
+};
+
+static const EpdKernPair opendyslexic_10_regularKernPairs[128] = {
+    { 0x20100020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180020, 3 },
+    { 0x00000000, 0 }, { 0x003A0020, 3 }, { 0x203A0020, 3 }, { 0x005C0020, 3 },
+    { 0x002D0020, 3 }, { 0x00AD0020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20130020, 3 }, { 0x00000000, 0 },
+    { 0x20350020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280020, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0020, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005F0020, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00230020, 3 }, { 0x20230020, 3 },
+    { 0x00000000, 0 }, { 0x20160020, 3 }, { 0x00000000, 0 }, { 0x20380020, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00AB0020, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20110020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190020, 3 }, { 0x00000000, 0 }, { 0x003B0020, 3 }, { 0x00BB0020, 3 },
+    { 0x005D0020, 3 }, { 0x002E0020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00210020, 3 }, { 0x00A10020, 3 }, { 0x00000000, 0 }, { 0x20140020, 3 },
+    { 0x00000000, 0 }, { 0x20360020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00290020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0020, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20240020, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20170020, 3 }, { 0x00000000, 0 },
+    { 0x20390020, 3 }, { 0x00000000, 0 }, { 0x005B0020, 3 }, { 0x002C0020, 3 },
+    { 0x007D0020, 3 }, { 0x00000000, 0 }, { 0x201F0020, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20120020, 3 }, { 0x00000000, 0 }, { 0x20340020, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00270020, 3 }, { 0x20270020, 3 },
+    { 0x00000000, 0 }, { 0x201A0020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0020, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00220020, 3 }, { 0x20220020, 3 }, { 0x00000000, 0 },
+    { 0x20150020, 3 }, { 0x00000000, 0 }, { 0x00B70020, 3 }, { 0x20370020, 3 },
+    { 0x00000000, 0 }, { 0x002A0020, 3 }, { 0x007B0020, 3 }, { 0x00000000, 0 },
+    { 0x201D0020, 3 }, { 0x00000000, 0 }, { 0x003F0020, 3 }, { 0x00BF0020, 3 },
+};
+
 static const EpdFontData opendyslexic_10_regular = {
     opendyslexic_10_regularBitmaps,
     opendyslexic_10_regularGlyphs,
@@ -3185,4 +3233,8 @@ static const EpdFontData opendyslexic_10_regular = {
     28,
     -11,
     true,
+    nullptr,
+    &opendyslexic_10_regularMetrics,
+    opendyslexic_10_regularKernPairs,
+    128,
 };
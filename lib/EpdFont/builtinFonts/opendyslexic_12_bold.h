@@ -3,7 +3,7 @@
  * name: opendyslexic_12_bold
  * size: 12
  * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_12_bold 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit
+ * Command used: fontconvert.py opendyslexic_12_bold 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit --kern-manifest font-manifest.txt
  */
 #pragma once
 #include "EpdFontData.h"
@@ -4673,6 +4673,54 @@ static const EpdUnicodeInterval opendyslexic_12_boldIntervals[] = {
     { 0x2264, 0x2265, 0x2D3 },
 };
 
+static const EpdFontMetrics opendyslexic_12_boldMetrics = {
+    21, 117, 22,
+    -7, 35, 37, -14,
+    {
+        22, 8, 18, 26, 29, 27, 23, 9, 12, 11, 16, 16, 8, 14, 7, 17,
+        18, 16, 18, 18, 19, 18, 18, 17, 19, 18, 7, 9, 19, 15, 20, 17,
+        26, 24, 24, 25, 26, 23, 21, 29, 26, 14, 23, 26, 22, 29, 26, 28,
+        23, 27, 24, 27, 26, 26, 28, 36, 28, 27, 27, 12, 12, 12, 14, 17,
+        11, 21, 22, 20, 22, 21, 17, 22, 22, 12, 16, 23, 15, 31, 22, 22,
+        23, 24, 18, 22, 20, 21, 25, 28, 25, 23, 22, 14, 10, 14, 12,
+    },
+};
+
+static const EpdKernPair opendyslexic_12_boldKernPairs[128] = {
+    { 0x20100020, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250020, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180020, 4 },
+    { 0x00000000, 0 }, { 0x003A0020, 4 }, { 0x203A0020, 4 }, { 0x005C0020, 4 },
+    { 0x002D0020, 4 }, { 0x00AD0020, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20130020, 4 }, { 0x00000000, 0 },
+    { 0x20350020, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280020, 4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0020, 4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005F0020, 4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00230020, 4 }, { 0x20230020, 4 },
+    { 0x00000000, 0 }, { 0x20160020, 4 }, { 0x00000000, 0 }, { 0x20380020, 4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00AB0020, 4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0020, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20110020, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260020, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190020, 4 }, { 0x00000000, 0 }, { 0x003B0020, 4 }, { 0x00BB0020, 4 },
+    { 0x005D0020, 4 }, { 0x002E0020, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00210020, 4 }, { 0x00A10020, 4 }, { 0x00000000, 0 }, { 0x20140020, 4 },
+    { 0x00000000, 0 }, { 0x20360020, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00290020, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0020, 4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20240020, 4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20170020, 4 }, { 0x00000000, 0 },
+    { 0x20390020, 4 }, { 0x00000000, 0 }, { 0x005B0020, 4 }, { 0x002C0020, 4 },
+    { 0x007D0020, 4 }, { 0x00000000, 0 }, { 0x201F0020, 4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20120020, 4 }, { 0x00000000, 0 }, { 0x20340020, 4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00270020, 4 }, { 0x20270020, 4 },
+    { 0x00000000, 0 }, { 0x201A0020, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0020, 4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00220020, 4 }, { 0x20220020, 4 }, { 0x00000000, 0 },
+    { 0x20150020, 4 }, { 0x00000000, 0 }, { 0x00B70020, 4 }, { 0x20370020, 4 },
+    { 0x00000000, 0 }, { 0x002A0020, 4 }, { 0x007B0020, 4 }, { 0x00000000, 0 },
+    { 0x201D0020, 4 }, { 0x00000000, 0 }, { 0x003F0020, 4 }, { 0x00BF0020, 4 },
+};
+
 static const EpdFontData opendyslexic_12_bold = {
     opendyslexic_12_boldBitmaps,
     opendyslexic_12_boldGlyphs,
@@ -4682,4 +4730,8 @@ static const EpdFontData opendyslexic_12_bold = {
     33,
     -13,
     true,
+    nullptr,
+    &opendyslexic_12_boldMetrics,
+    opendyslexic_12_boldKernPairs,
+    128,
 };
@@ -3,7 +3,7 @@
  * name: opendyslexic_12_italic
  * size: 12
  * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_12_italic 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit
+ * Command used: fontconvert.py opendyslexic_12_italic 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit --kern-manifest font-manifest.txt
  */
 #pragma once
 #include "EpdFontData.h"
@@ -4766,6 +4766,2070 @@ static const EpdUnicodeInterval opendyslexic_12_italicIntervals[] = {
     { 0x2264, 0x2265, 0x2D3 },
 };
 
+static const EpdFontMetrics opendyslexic_12_italicMetrics = {
+    18, 121, 21,
+    -12, 36, 34, -13,
+    {
+        21, 8, 14, 28, 26, 25, 24, 7, 11, 11, 16, 16, 8, 15, 7, 15,
+        17, 15, 16, 16, 17, 16, 17, 16, 17, 17, 7, 8, 20, 15, 20, 14,
+        30, 25, 21, 22, 24, 20, 18, 25, 23, 10, 15, 22, 19, 27, 23, 25,
+        20, 26, 21, 25, 23, 23, 25, 32, 25, 23, 25, 12, 12, 12, 14, 20,
+        10, 19, 20, 17, 19, 19, 14, 18, 19, 9, 16, 19, 12, 28, 19, 19,
+        20, 22, 15, 18, 16, 18, 21, 24, 21, 19, 19, 14, 6, 16, 15,
+    },
+};
+
+static const EpdKernPair opendyslexic_12_italicKernPairs[8192] = {
+    { 0x00000000, 0 }, { 0x00380059, -2 }, { 0x00570057, -5 }, { 0x004E0041, -6 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550070, -1 }, { 0x0074006E, -2 },
+    { 0x004C005A, -5 }, { 0x006B0058, 1 }, { 0x00000000, 0 }, { 0x00430044, -5 },
+    { 0x00620042, 1 }, { 0x0059002C, -4 }, { 0x0078002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00690071, -2 }, { 0x01040067, 1 }, { 0x00000000, 0 },
+    { 0x0041005D, -5 }, { 0x00000000, 0 }, { 0x00570045, -5 }, { 0x00000000, 0 },
+    { 0x0046201E, -7 }, { 0x0065201C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F00054, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0048, -5 }, { 0x006B0046, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00340079, -2 }, { 0x00530077, -1 }, { 0x00720075, -2 }, { 0x00C60059, -5 },
+    { 0x00000000, 0 }, { 0x0041004B, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00760031, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00670078, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0055004C, -6 }, { 0x0074004A, -4 }, { 0x006B0034, -6 },
+    { 0x00F00042, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0079, -1 },
+    { 0x005600D8, -7 }, { 0x00000000, 0 }, { 0x00530065, 2 }, { 0x00720063, -2 },
+    { 0x004A004F, -5 }, { 0x0069004D, 1 }, { 0x00C60047, -6 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007300EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0029006A, -1 }, { 0x00670066, -2 }, { 0x003F0052, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007B0067, -1 }, { 0x00000000, 0 }, { 0x005600C6, -12 }, { 0x00530053, -7 },
+    { 0x00720051, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00570152, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0070006A, -3 }, { 0x00000000, 0 }, { 0x00480056, -6 }, { 0x00670054, -10 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046006F, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D8004F, 1 }, { 0x00000000, 0 },
+    { 0x00530041, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0079006E, -3 },
+    { 0x00000000, 0 }, { 0x0051005A, -5 }, { 0x00700058, -2 }, { 0x00000000, 0 },
+    { 0x00480044, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006E0071, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0043, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00340031, -1 }, { 0x0072002D, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00630074, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0152004E, 1 }, { 0x00000000, 0 }, { 0x0032004A, -3 },
+    { 0x00510048, -4 }, { 0x00700046, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00580077, -3 }, { 0x00770075, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046004B, -6 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B0031, -1 }, { 0x201E0037, -4 }, { 0x00000000, 0 },
+    { 0x004D007A, 1 }, { 0x006C0078, -2 }, { 0x00000000, 0 }, { 0x00440064, 1 },
+    { 0x00630062, -4 }, { 0x00000000, 0 }, { 0x005A004C, -5 }, { 0x0079004A, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00290022, 2 },
+    { 0x0042007D, -3 }, { 0x006400EE, 2 }, { 0x00000000, 0 }, { 0x00580065, -2 },
+    { 0x00770063, -3 }, { 0x004F004F, -5 }, { 0x006E004D, 1 }, { 0x00000000, 0 },
+    { 0x00650037, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E006A, -1 }, { 0x004D0068, 1 },
+    { 0x00440052, -5 }, { 0x006C0066, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00700022, 1 }, { 0x00000000, 0 },
+    { 0x004500DE, 1 }, { 0x00610069, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580053, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005900DF, -2 }, { 0x0037006E, -1 }, { 0x0075006A, -3 }, { 0x004D0056, -6 },
+    { 0x006C0054, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B006F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420059, -8 },
+    { 0x00610057, -2 }, { 0x00580041, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006E0029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056005A, -7 }, { 0x00750058, 1 },
+    { 0x00000000, 0 }, { 0x004D0044, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540073, -9 },
+    { 0x00730071, -2 }, { 0x00EF0069, 1 }, { 0x004B005D, -2 }, { 0x00C70055, -5 },
+    { 0x00420047, -5 }, { 0x00000000, 0 }, { 0x0050201E, -9 }, { 0x006F201C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A0078, -2 },
+    { 0x00680074, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0037004A, -4 }, { 0x00560048, -5 }, { 0x006C0030, -1 }, { 0x00750046, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540061, -9 }, { 0x00000000, 0 }, { 0x004B004B, -5 },
+    { 0x00C70043, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00710078, -5 }, { 0x012B006C, 2 },
+    { 0x00680062, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00370038, -1 }, { 0x00560036, -1 }, { 0x00750034, -1 },
+    { 0x006900EE, 1 }, { 0x0047007D, -2 }, { 0x0066007B, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054004F, -7 }, { 0x0073004D, 1 },
+    { 0x00DE201E, -8 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0033006A, -3 },
+    { 0x00710066, -4 }, { 0x002A0054, -2 }, { 0x00490052, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00750022, 2 },
+    { 0x00000000, 0 }, { 0x004A00DE, 1 }, { 0x0028006D, -2 }, { 0x0047006B, -3 },
+    { 0x00660069, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0029, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007A006A, -3 }, { 0x201D0070, -2 },
+    { 0x00330058, -1 }, { 0x00520056, -8 }, { 0x00710054, -12 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00470059, -8 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00730029, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00640070, -3 }, { 0x00000000, 0 }, { 0x005B005A, -1 },
+    { 0x007A0058, 1 }, { 0x00000000, 0 }, { 0x00520044, -5 }, { 0x0041201D, -4 },
+    { 0x00710042, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590073, -4 }, { 0x00780071, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00280049, -1 }, { 0x00470047, -5 }, { 0x0055201E, -1 },
+    { 0x0074201C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E0076, -3 }, { 0x006D0074, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007A0046, -3 }, { 0x00000000, 0 }, { 0x00330034, -1 },
+    { 0x00710030, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00430079, -5 },
+    { 0x00620077, -3 }, { 0x00000000, 0 }, { 0x00590061, -5 }, { 0x00000000, 0 },
+    { 0x0050004B, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00470035, -1 },
+    { 0x00660033, -1 }, { 0x00000000, 0 }, { 0x0057007A, -3 }, { 0x00760078, -4 },
+    { 0x00000000, 0 }, { 0x004E0064, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0045004E, -5 }, { 0x00000000, 0 }, { 0x005B0036, -1 }, { 0x007A0034, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C007D, -4 }, { 0x006B007B, -2 },
+    { 0x00000000, 0 }, { 0x00620065, -2 }, { 0x00DE005D, -4 }, { 0x0059004F, -8 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006F0037, -5 }, { 0x00000000, 0 },
+    { 0x00660021, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0038006A, -3 }, { 0x00760066, -2 }, { 0x004E0052, -6 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F00DE, 1 }, { 0x006B0069, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00430055, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00310029, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041006E, -2 },
+    { 0x00000000, 0 }, { 0x00380058, -1 }, { 0x00570056, -5 }, { 0x00760054, -10 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F00065, -1 },
+    { 0x00000000, 0 }, { 0x004C0059, -10 }, { 0x006B0057, -3 }, { 0x00430043, -5 },
+    { 0x00620041, -5 }, { 0x00000000, 0 }, { 0x00780029, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00690070, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570044, -5 },
+    { 0x00000000, 0 }, { 0x004E002E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0071012B, -2 }, { 0x00000000, 0 }, { 0x004C0047, -5 }, { 0x00000000, 0 },
+    { 0x005A201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00340078, -1 }, { 0x00530076, -2 }, { 0x00720074, -2 },
+    { 0x00C60058, -5 }, { 0x00EE006C, 1 }, { 0x0041004A, -9 }, { 0x00000000, 0 },
+    { 0x00380034, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00670077, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0055004B, -6 }, { 0x00F00041, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007B0078, -4 }, { 0x00000000, 0 }, { 0x00340066, -1 }, { 0x00530064, 2 },
+    { 0x00720062, -2 }, { 0x004A004E, -6 }, { 0x00C60046, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005400F0, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670065, -2 }, { 0x00000000, 0 },
+    { 0x003F0051, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00740037, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B0066, -2 }, { 0x00000000, 0 }, { 0x00340054, -2 },
+    { 0x00530052, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005400DE, 1 },
+    { 0x0051006B, -1 }, { 0x00700069, -2 }, { 0x00000000, 0 }, { 0x00480055, -5 },
+    { 0x00670053, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00360029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0046006E, -5 }, { 0x0065006C, -2 }, { 0x00000000, 0 }, { 0x00D8004E, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A006F, -1 },
+    { 0x0079006D, -1 }, { 0x201C0073, -1 }, { 0x00510059, -7 }, { 0x00700057, -1 },
+    { 0x00480043, -5 }, { 0x00670041, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006E0070, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B201D, -3 }, { 0x0072002C, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00630073, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0152004D, 1 }, { 0x201C0061, -2 }, { 0x00510047, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00390078, -2 }, { 0x00580076, -3 },
+    { 0x00770074, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046004A, -10 },
+    { 0x00650048, 1 }, { 0x007B0030, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006C0077, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00440063, 1 }, { 0x00630061, -4 }, { 0x005A004B, -5 }, { 0x00DF0059, -2 },
+    { 0x00000000, 0 }, { 0x00700033, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0061007A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580064, -1 },
+    { 0x00770062, -2 }, { 0x00000000, 0 }, { 0x004F004E, -5 }, { 0x00000000, 0 },
+    { 0x00460038, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005900F0, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D0067, 1 }, { 0x006C0065, -3 },
+    { 0x00000000, 0 }, { 0x00440051, -2 }, { 0x0063004F, -1 }, { 0x00000000, 0 },
+    { 0x00790037, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0042006A, -3 }, { 0x00610068, -2 },
+    { 0x00580052, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0037006D, -1 }, { 0x00750069, -2 }, { 0x00000000, 0 },
+    { 0x004D0055, -6 }, { 0x006C0053, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420058, -7 },
+    { 0x00610056, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0037005B, -1 },
+    { 0x00560059, -5 }, { 0x004D0043, -5 }, { 0x006C0041, -2 }, { 0x00750057, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00350074, -1 }, { 0x00540072, -9 }, { 0x00730070, -3 }, { 0x00C70054, -5 },
+    { 0x00EF0068, 1 }, { 0x00420046, -5 }, { 0x00610044, 1 }, { 0x0077002C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00680073, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560047, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0073005E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B004A, -9 }, { 0x00C70042, -5 }, { 0x00420034, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520079, -1 }, { 0x00710077, -4 },
+    { 0x012B006B, 2 }, { 0x00680061, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0021, 1 }, { 0x0066007A, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054004E, -6 },
+    { 0x00000000, 0 }, { 0x004B0038, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007A007B, -2 }, { 0x00000000, 0 }, { 0x00520067, -1 },
+    { 0x00710065, -5 }, { 0x00000000, 0 }, { 0x00490051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0047006A, -3 },
+    { 0x004100C7, -7 }, { 0x00660068, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007A0069, -2 }, { 0x201D006F, -2 },
+    { 0x00000000, 0 }, { 0x00330057, -1 }, { 0x00520055, -6 }, { 0x00710053, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006F006C, -2 }, { 0x00000000, 0 },
+    { 0x0028005A, -2 }, { 0x00470058, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0054002A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0064006F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520043, -6 }, { 0x00710041, -6 },
+    { 0x0041201C, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590072, -3 }, { 0x00780070, -2 }, { 0x0031005E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00470046, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E0075, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005B0047, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00620076, -4 }, { 0x00000000, 0 }, { 0x0078005E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0050004A, -10 }, { 0x00000000, 0 }, { 0x00280036, -3 },
+    { 0x00470034, -1 }, { 0x00660032, -2 }, { 0x201C00F0, -2 }, { 0x00760077, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0063, -3 }, { 0x00000000, 0 },
+    { 0x0045004D, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B007A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00430066, -2 }, { 0x00620064, -2 }, { 0x00000000, 0 },
+    { 0x0059004E, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006300F0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570067, -2 }, { 0x00760065, -4 }, { 0x00000000, 0 }, { 0x004E0051, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C006A, -3 }, { 0x004600C7, -6 }, { 0x00430054, -5 }, { 0x00620052, 1 },
+    { 0x006B0068, -2 }, { 0x00DE004A, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00380057, -1 }, { 0x00570055, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450029, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00360070, -1 },
+    { 0x0074006C, -2 }, { 0x004C0058, -5 }, { 0x006B0056, -5 }, { 0x00F00064, -1 },
+    { 0x00430042, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00780028, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0069006F, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570043, -7 },
+    { 0x00760041, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007D0070, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0046, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00340077, -1 }, { 0x00530075, 1 }, { 0x00720073, -3 },
+    { 0x00C60057, -5 }, { 0x00EE006B, 1 }, { 0x00410049, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00570031, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00670076, -2 }, { 0x00000000, 0 }, { 0x003F0062, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0055004A, -10 }, { 0x00000000, 0 },
+    { 0x004C0034, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007B0077, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00530063, 1 },
+    { 0x00720061, -3 }, { 0x004A004D, -6 }, { 0x00C60045, -5 }, { 0x00CC012B, 1 },
+    { 0x00410037, -4 }, { 0x00000000, 0 }, { 0x005400EF, -2 }, { 0x0070007A, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670064, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x003F0050, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0065, -4 }, { 0x00000000, 0 },
+    { 0x00340053, -1 }, { 0x00530051, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0051006A, 2 }, { 0x004B00C7, -9 }, { 0x00480054, -5 },
+    { 0x00700068, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0046006D, -1 }, { 0x0065006B, -2 }, { 0x00000000, 0 }, { 0x007B0053, -2 },
+    { 0x00D8004D, 1 }, { 0x00340041, -1 }, { 0x201E0059, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00FE007A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005A006E, 1 }, { 0x0079006C, -2 }, { 0x00510058, -5 }, { 0x00700056, -2 },
+    { 0x00000000, 0 }, { 0x00480042, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F0071, 1 },
+    { 0x006E006F, -2 }, { 0x00000000, 0 }, { 0x00650059, -4 }, { 0x00000000, 0 },
+    { 0x007B0041, -4 }, { 0x201E0047, -1 }, { 0x004B201C, -2 }, { 0x0053002D, 1 },
+    { 0x00C60152, -7 }, { 0x012900EF, 3 }, { 0x00000000, 0 }, { 0x00440074, 1 },
+    { 0x00630072, -2 }, { 0x0079005A, -2 }, { 0x00DF006A, -3 }, { 0x0152004C, 1 },
+    { 0x00510046, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580075, -1 }, { 0x00770073, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460049, -4 },
+    { 0x00650047, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D0078, 1 }, { 0x006C0076, -5 },
+    { 0x00DF0058, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A004A, -9 },
+    { 0x00000000, 0 }, { 0x00510034, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006400EC, 1 }, { 0x00610079, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580063, -2 }, { 0x00770061, -3 }, { 0x004F004D, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0075007A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006C0064, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440050, -5 }, { 0x0063004E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00610067, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00580051, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056006A, -3 }, { 0x005000C7, -6 },
+    { 0x004D0054, -6 }, { 0x00750068, -2 }, { 0x00000000, 0 }, { 0x00DF0034, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EF0079, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00420057, -7 }, { 0x00000000, 0 }, { 0x00390041, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004F0029, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0037005A, -1 },
+    { 0x00560058, -6 }, { 0x00750056, -1 }, { 0x004D0042, -5 }, { 0x00000000, 0 },
+    { 0x0063002A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00350073, -1 }, { 0x00540071, -9 }, { 0x0073006F, -2 }, { 0x00C70053, -5 },
+    { 0x00000000, 0 }, { 0x00420045, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00680072, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560046, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B0049, -3 }, { 0x006A0047, 1 }, { 0x0078201E, -1 }, { 0x00C70041, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00710076, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0021004E, -1 }, { 0x00000000, 0 }, { 0x00560034, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006900EC, 1 }, { 0x00660079, -2 }, { 0x004100D8, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054004D, -6 },
+    { 0x00000000, 0 }, { 0x00DE201C, -1 }, { 0x004B0037, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007A007A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00520066, -1 }, { 0x00710064, -5 }, { 0x00000000, 0 }, { 0x00490050, -3 },
+    { 0x0068004E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007200F0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00470069, -3 },
+    { 0x00660067, -3 }, { 0x004100C6, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00420152, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007A0068, -2 },
+    { 0x005500C7, -5 }, { 0x00330056, -1 }, { 0x00520054, -7 }, { 0x00710052, -3 },
+    { 0x201D006E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0050006D, -1 }, { 0x006F006B, -2 },
+    { 0x00000000, 0 }, { 0x00470057, -8 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EC00EF, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0064006E, -2 }, { 0x00000000, 0 },
+    { 0x005B0058, -1 }, { 0x007A0056, -1 }, { 0x00000000, 0 }, { 0x00520042, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590071, -4 }, { 0x0078006F, -4 }, { 0x00000000, 0 },
+    { 0x0031005D, -3 }, { 0x006F0059, -4 }, { 0x00280047, -3 }, { 0x00470045, -5 },
+    { 0x0036201E, -1 }, { 0x00660043, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004E0074, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D004A, -4 }, { 0x00000000, 0 },
+    { 0x00520030, -1 }, { 0x0071002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00430077, -2 }, { 0x00620075, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00500049, -4 }, { 0x006F0047, -3 }, { 0x00000000, 0 },
+    { 0x00280035, -1 }, { 0x00470033, -1 }, { 0x00660031, -2 }, { 0x00000000, 0 },
+    { 0x00570078, -2 }, { 0x00760076, -2 }, { 0x004E0062, -2 }, { 0x0130006A, -3 },
+    { 0x00000000, 0 }, { 0x0045004C, -5 }, { 0x0064004A, -4 }, { 0x005B0034, -5 },
+    { 0x201D0038, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B0079, -5 },
+    { 0x004600D8, -6 }, { 0x00000000, 0 }, { 0x00620063, -2 }, { 0x00000000, 0 },
+    { 0x0059004D, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00470021, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00760064, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E0050, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007700F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006B0067, -5 }, { 0x00000000, 0 }, { 0x004600C6, -13 }, { 0x00430053, -5 },
+    { 0x00620051, 1 }, { 0x00000000, 0 }, { 0x00780039, -1 }, { 0x00000000, 0 },
+    { 0x00310027, -1 }, { 0x00470152, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0041006C, -3 }, { 0x005A00C7, -7 }, { 0x00380056, -1 }, { 0x00570054, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0074006B, -2 },
+    { 0x00F00063, -1 }, { 0x012B012F, 1 }, { 0x002D0059, -2 }, { 0x004C0057, -8 },
+    { 0x00430041, -5 }, { 0x006B0055, -2 }, { 0x00DE0037, -6 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A0070, -1 },
+    { 0x0069006E, -2 }, { 0x0041005A, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570042, -5 }, { 0x00000000, 0 }, { 0x004E002C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x003F0073, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00710129, -2 }, { 0x00740059, -3 }, { 0x004C0045, -5 },
+    { 0x006B0043, -2 }, { 0x00F00051, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00340076, -2 }, { 0x00530074, -1 },
+    { 0x00720072, -3 }, { 0x00C60056, -5 }, { 0x00EE006A, -1 }, { 0x00410048, -5 },
+    { 0x006E201D, -1 }, { 0x00570030, -1 }, { 0x0076002E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00670075, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550049, -4 }, { 0x00740047, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B0076, -3 }, { 0x00000000, 0 }, { 0x00530062, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A004C, -6 }, { 0x0069004A, -4 },
+    { 0x00410036, -1 }, { 0x00C60044, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0032007D, -1 }, { 0x004B00D8, -5 }, { 0x00700079, -4 }, { 0x00670063, -2 },
+    { 0x00000000, 0 }, { 0x003F004F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00360039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0064, -3 }, { 0x201E006A, -1 },
+    { 0x00000000, 0 }, { 0x00530050, -5 }, { 0x0072004E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00700067, -2 }, { 0x00000000, 0 }, { 0x004B00C6, -5 },
+    { 0x00480053, -5 }, { 0x00670051, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0152, -6 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0046006C, -4 }, { 0x0065006A, -3 }, { 0x00000000, 0 },
+    { 0x00D8004C, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FE0079, -1 }, { 0x00000000, 0 },
+    { 0x005A006D, 1 }, { 0x0079006B, -2 }, { 0x00000000, 0 }, { 0x00320059, -1 },
+    { 0x00510057, -5 }, { 0x00290043, 1 }, { 0x00480041, -5 }, { 0x00000000, 0 },
+    { 0x005E0029, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004F0070, -1 }, { 0x006E006E, -2 }, { 0x0046005A, -7 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x012900EE, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00630071, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057012B, 1 }, { 0x00790059, -1 },
+    { 0x00510045, -4 }, { 0x00700043, 1 }, { 0x0152004B, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580074, -2 },
+    { 0x00770072, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00460048, -5 }, { 0x00650046, -3 }, { 0x0073201D, -2 }, { 0x007800FE, -1 },
+    { 0x201E0034, -7 }, { 0x00000000, 0 }, { 0x002E0079, -4 }, { 0x006C0075, -3 },
+    { 0x00000000, 0 }, { 0x00440061, 1 }, { 0x00DF0057, -2 }, { 0x005A0049, -3 },
+    { 0x00790047, -3 }, { 0x00000000, 0 }, { 0x00510033, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00610078, -2 }, { 0x00000000, 0 },
+    { 0x00580062, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F004C, -5 },
+    { 0x006E004A, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00750079, -2 }, { 0x005000D8, -5 }, { 0x00000000, 0 },
+    { 0x004D0065, 1 }, { 0x006C0063, -3 }, { 0x0044004F, -5 }, { 0x0063004D, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00610066, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580050, -5 }, { 0x0077004E, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00650022, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00750067, -2 }, { 0x00000000, 0 },
+    { 0x005000C6, -13 }, { 0x004D0053, -5 }, { 0x006C0051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00510152, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006A006A, -1 }, { 0x00000000, 0 },
+    { 0x00420056, -8 }, { 0x00610054, -9 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560057, -5 }, { 0x00000000, 0 }, { 0x004D0041, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00630029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540070, -10 }, { 0x0073006E, -2 }, { 0x004B005A, -5 },
+    { 0x00C70052, -5 }, { 0x00EF0066, 2 }, { 0x00420044, -5 }, { 0x0031201D, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00680071, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560045, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006C002D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054005E, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B0048, -5 }, { 0x0078201D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520077, -1 },
+    { 0x00710075, -4 }, { 0x012B0069, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0047007A, -4 }, { 0x00660078, -4 },
+    { 0x00000000, 0 }, { 0x005D0062, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0054004C, -5 }, { 0x0073004A, -4 }, { 0x004B0036, -3 }, { 0x006A0034, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007A0079, -2 }, { 0x005500D8, -5 },
+    { 0x00000000, 0 }, { 0x00520065, -1 }, { 0x00710063, -5 }, { 0x0049004F, -4 },
+    { 0x0068004D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007200EF, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00470068, -3 }, { 0x00660066, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0054003A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006A0022, 3 }, { 0x00000000, 0 }, { 0x003F00DE, 3 }, { 0x007A0067, -3 },
+    { 0x201D006D, -2 }, { 0x005500C6, -8 }, { 0x00520053, -5 }, { 0x00710051, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560152, -7 }, { 0x00000000, 0 }, { 0x005300DF, 1 }, { 0x006F006A, -3 },
+    { 0x00000000, 0 }, { 0x00280058, -1 }, { 0x00470056, -8 }, { 0x00660054, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540028, -1 },
+    { 0x00EC00EE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520041, -5 },
+    { 0x0071003F, -2 }, { 0x00000000, 0 }, { 0x002A002D, -2 }, { 0x00680029, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590070, -3 }, { 0x0078006E, -2 },
+    { 0x0050005A, -8 }, { 0x006F0058, -2 }, { 0x00000000, 0 }, { 0x00280046, -1 },
+    { 0x0036201D, -1 }, { 0x00470044, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004E0073, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004A201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00430076, -4 }, { 0x00620074, -3 }, { 0x0059005E, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0031004A, -3 }, { 0x00500048, -5 },
+    { 0x00280034, -5 }, { 0x00470032, -1 }, { 0x006F0046, -3 }, { 0x00000000, 0 },
+    { 0x00760075, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0061, -3 },
+    { 0x00000000, 0 }, { 0x0045004B, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006B0078, -2 }, { 0x00000000, 0 }, { 0x00620062, -2 }, { 0x00DE005A, -3 },
+    { 0x00000000, 0 }, { 0x0059004C, -6 }, { 0x0078004A, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004400F0, 1 }, { 0x0041007D, -4 },
+    { 0x005A00D8, -5 }, { 0x00000000, 0 }, { 0x00570065, -2 }, { 0x00760063, -3 },
+    { 0x004E004F, -5 }, { 0x006D004D, 1 }, { 0x00EF012B, 5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007700EF, 2 }, { 0x00000000, 0 }, { 0x00F00074, 1 },
+    { 0x012E0070, -3 }, { 0x002D006A, -1 }, { 0x006B0066, -3 }, { 0x00430052, -5 },
+    { 0x00620050, 1 }, { 0x00DE0048, 1 }, { 0x00780038, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006F0022, 1 }, { 0x00000000, 0 }, { 0x004400DE, 1 },
+    { 0x0041006B, -2 }, { 0x00000000, 0 }, { 0x005A00C6, -5 }, { 0x00570053, -8 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800DF, 1 },
+    { 0x0074006A, -3 }, { 0x00000000, 0 }, { 0x004C0056, -10 }, { 0x006B0054, -9 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590028, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410059, -10 }, { 0x00000000, 0 },
+    { 0x00570041, -10 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006D0029, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0055005A, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C0044, -5 }, { 0x00000000, 0 }, { 0x0062002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00720071, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00C60055, -5 }, { 0x00000000, 0 }, { 0x00410047, -7 },
+    { 0x00000000, 0 }, { 0x004F201E, -1 }, { 0x006E201C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00290078, -1 }, { 0x00670074, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0036004A, -4 },
+    { 0x00550048, -5 }, { 0x006B0030, -3 }, { 0x00740046, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B0075, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00530061, 2 }, { 0x00000000, 0 }, { 0x004A004B, -6 }, { 0x00C60043, -6 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0051007A, -2 }, { 0x00700078, -4 }, { 0x00000000, 0 }, { 0x00480064, 1 },
+    { 0x00670062, -2 }, { 0x00000000, 0 }, { 0x003F004E, 2 }, { 0x00000000, 0 },
+    { 0x00740034, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0063, -4 },
+    { 0x00000000, 0 }, { 0x0053004F, -5 }, { 0x0072004D, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0032006A, -3 }, { 0x00510068, -1 },
+    { 0x00480052, -5 }, { 0x00700066, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00740022, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0046006B, -3 }, { 0x00650069, -2 }, { 0x00000000, 0 },
+    { 0x007B0051, -3 }, { 0x00D8004B, 1 }, { 0x201E0057, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00FE0078, -3 },
+    { 0x00000000, 0 }, { 0x005A006C, 1 }, { 0x0079006A, -4 }, { 0x00510056, -6 },
+    { 0x00700054, -9 }, { 0x201C0070, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460059, -5 },
+    { 0x00650057, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00720029, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00630070, -3 }, { 0x00000000, 0 }, { 0x005A005A, -5 }, { 0x00790058, -3 },
+    { 0x0152004A, -2 }, { 0x00510044, -3 }, { 0x00000000, 0 }, { 0x0067002C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00770071, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F005D, -1 }, { 0x00000000, 0 },
+    { 0x00460047, -6 }, { 0x00000000, 0 }, { 0x0054201E, -6 }, { 0x0073201C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006C0074, -4 },
+    { 0x00000000, 0 }, { 0x0063005E, -2 }, { 0x00DF0056, -2 }, { 0x00000000, 0 },
+    { 0x005A0048, -5 }, { 0x00790046, -3 }, { 0x00320034, -3 }, { 0x00510032, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420079, -1 }, { 0x00610077, -3 },
+    { 0x00000000, 0 }, { 0x00580061, -1 }, { 0x00000000, 0 }, { 0x004F004B, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0056007A, -3 }, { 0x00750078, -2 }, { 0x00000000, 0 },
+    { 0x002E0066, -1 }, { 0x004D0064, 2 }, { 0x006C0062, -3 }, { 0x0044004E, -5 },
+    { 0x00000000, 0 }, { 0x005A0036, -1 }, { 0x00790034, -2 }, { 0x00000000, 0 },
+    { 0x00320022, 2 }, { 0x004B007D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00610065, -2 }, { 0x00000000, 0 }, { 0x0058004F, -9 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006E0037, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0037006A, -3 },
+    { 0x00560068, -1 }, { 0x002E0054, -6 }, { 0x004D0052, -5 }, { 0x00750066, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00790022, 3 },
+    { 0x00EF0077, 2 }, { 0x004E00DE, 1 }, { 0x004B006B, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00420055, -5 }, { 0x00610053, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00300029, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00210070, -1 }, { 0x00000000, 0 },
+    { 0x00560056, -5 }, { 0x00750054, -9 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0054006F, -9 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004B0059, -7 }, { 0x006A0057, 1 }, { 0x00420043, -5 }, { 0x00610041, -2 },
+    { 0x0031201C, -3 }, { 0x00770029, -1 }, { 0x00C70051, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00680070, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560044, -5 }, { 0x0045201D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B0047, -9 }, { 0x00000000, 0 }, { 0x0059201E, -6 },
+    { 0x0078201C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00330078, -2 }, { 0x00520076, -1 }, { 0x00710074, -4 }, { 0x012B0068, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00370034, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00470079, -5 },
+    { 0x00660077, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0054004B, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B007A, -5 }, { 0x007A0078, -2 },
+    { 0x00000000, 0 }, { 0x00520064, -1 }, { 0x00710062, -5 }, { 0x00000000, 0 },
+    { 0x0049004E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005300F0, 1 }, { 0x0050007D, -2 }, { 0x00000000, 0 },
+    { 0x00280069, -1 }, { 0x00470067, -2 }, { 0x00660065, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540039, -1 }, { 0x00730037, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007A0066, -2 }, { 0x00000000, 0 }, { 0x00520052, -5 }, { 0x00710050, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005300DE, 2 }, { 0x006F0069, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280057, 1 }, { 0x00470055, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00350029, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0064006C, -2 },
+    { 0x00000000, 0 }, { 0x007A0054, -9 }, { 0x201D005A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE007D, -4 }, { 0x00000000, 0 }, { 0x0059006F, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00500059, -7 }, { 0x006F0057, -1 }, { 0x00280045, -1 },
+    { 0x00470043, -5 }, { 0x00660041, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0072, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00620073, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00500047, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00280033, -2 }, { 0x00470031, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00380078, -2 }, { 0x00760074, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0045004A, -9 }, { 0x00000000, 0 },
+    { 0x201D0036, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C0079, -5 }, { 0x006B0077, -5 }, { 0x00000000, 0 }, { 0x00620061, -2 },
+    { 0x00DE0059, -3 }, { 0x0059004B, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00310037, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570064, -2 }, { 0x00760062, -2 },
+    { 0x00000000, 0 }, { 0x004E004E, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800F0, -2 }, { 0x0074007B, -2 },
+    { 0x00F00073, -1 }, { 0x00000000, 0 }, { 0x006B0065, -5 }, { 0x00000000, 0 },
+    { 0x00430051, -3 }, { 0x0062004F, 1 }, { 0x00DE0047, 1 }, { 0x00590039, -1 },
+    { 0x00780037, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0041006A, -3 }, { 0x00000000, 0 }, { 0x00380054, -1 },
+    { 0x00570052, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005800DE, 2 },
+    { 0x00740069, -2 }, { 0x00F00061, -2 }, { 0x00000000, 0 }, { 0x004C0055, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0069006C, -2 }, { 0x00000000, 0 }, { 0x00410058, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550059, -5 }, { 0x00740057, -1 },
+    { 0x004C0043, -5 }, { 0x006B0041, -2 }, { 0x00F0004F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00340074, -1 },
+    { 0x00720070, -3 }, { 0x00C60054, -5 }, { 0x00CF006A, -3 }, { 0x00EE0068, 1 },
+    { 0x00410046, -5 }, { 0x00000000, 0 }, { 0x0076002C, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670073, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550047, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0074, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A004A, -6 },
+    { 0x00C60042, -5 }, { 0x00410034, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0032007B, -1 }, { 0x00700077, -3 }, { 0x00000000, 0 },
+    { 0x00670061, -2 }, { 0x00000000, 0 }, { 0x003F004D, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0065007A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0053004E, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005A007D, -2 }, { 0x0079007B, -1 }, { 0x00000000, 0 }, { 0x00700065, -2 },
+    { 0x00000000, 0 }, { 0x00480051, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007D0037, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046006A, -3 }, { 0x00650068, -2 },
+    { 0x201E0056, -4 }, { 0x00D8004A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DF0079, -1 },
+    { 0x00000000, 0 }, { 0x005A006B, 1 }, { 0x00790069, -2 }, { 0x201C006F, -1 },
+    { 0x00320057, -1 }, { 0x00510055, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007100DF, -3 }, { 0x00300070, -1 }, { 0x006E006C, -2 }, { 0x00460058, -6 },
+    { 0x00650056, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012900EC, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00440071, 1 }, { 0x0063006F, -4 }, { 0x00000000, 0 }, { 0x005A0059, -5 },
+    { 0x01520049, 2 }, { 0x00510043, -4 }, { 0x00700041, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580072, 1 }, { 0x00770070, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00460046, -6 }, { 0x00650044, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002E0077, -1 },
+    { 0x006C0073, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005A0047, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00510031, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420078, -2 },
+    { 0x00610076, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004F004A, -10 }, { 0x00000000, 0 }, { 0x00460034, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0037007B, -1 }, { 0x00560079, -1 },
+    { 0x00750077, -2 }, { 0x004D0063, 1 }, { 0x006C0061, -2 }, { 0x0044004D, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00790033, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00420066, -1 }, { 0x00610064, -2 }, { 0x00000000, 0 }, { 0x0058004E, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560067, -2 },
+    { 0x00750065, -2 }, { 0x00000000, 0 }, { 0x002E0053, 1 }, { 0x004D0051, -3 },
+    { 0x006C004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00790021, -1 },
+    { 0x00000000, 0 }, { 0x00EF0076, 2 }, { 0x00000000, 0 }, { 0x004B006A, -3 },
+    { 0x004500C7, -6 }, { 0x00420054, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006200DE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560055, -5 }, { 0x00750053, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440029, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00350070, -1 }, { 0x0054006E, -9 },
+    { 0x004B0058, -5 }, { 0x0073006C, -2 }, { 0x00C70050, -5 }, { 0x00420042, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F000F0, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0068006F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560043, -8 }, { 0x00750041, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0046, -5 }, { 0x0059201D, -1 },
+    { 0x006A0044, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F000DE, 1 },
+    { 0x00520075, -1 }, { 0x00710073, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560031, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0028007A, -2 },
+    { 0x00470078, -5 }, { 0x00660076, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0054004A, -10 }, { 0x00000000, 0 }, { 0x004B0034, -6 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0079, -1 },
+    { 0x007A0077, -2 }, { 0x00000000, 0 }, { 0x00520063, -1 }, { 0x00710061, -5 },
+    { 0x0049004D, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006F007A, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00280068, -1 }, { 0x00470066, -4 }, { 0x00660064, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540038, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005B0067, -1 }, { 0x007A0065, -3 }, { 0x00000000, 0 }, { 0x00520051, -4 },
+    { 0x0071004F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0050006A, -3 }, { 0x004A00C7, -5 }, { 0x00470054, -8 }, { 0x006F0068, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0064006B, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00330041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490029, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B00DF, -1 }, { 0x0059006E, -3 },
+    { 0x0078006C, -2 }, { 0x00500058, -8 }, { 0x006F0056, -2 }, { 0x00000000, 0 },
+    { 0x00470042, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0071, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0043, -1 },
+    { 0x007A0041, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00430074, -2 }, { 0x00620072, -3 },
+    { 0x00D800C7, 1 }, { 0x00DE006A, -3 }, { 0x00000000, 0 }, { 0x00500046, -5 },
+    { 0x006F0044, 1 }, { 0x00280032, -1 }, { 0x0066002E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00760073, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450049, -3 }, { 0x00640047, -3 },
+    { 0x0072201E, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006B0076, -5 }, { 0x00000000, 0 }, { 0x00DE0058, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0059004A, -10 }, { 0x00000000, 0 },
+    { 0x00500034, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x015200C6, 1 }, { 0x00570063, -2 },
+    { 0x00760061, -4 }, { 0x004E004D, -6 }, { 0x00EF0129, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0074007A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0066, -1 }, { 0x006B0064, -5 },
+    { 0x00000000, 0 }, { 0x00430050, -5 }, { 0x0062004E, -3 }, { 0x00590038, -2 },
+    { 0x00780036, -1 }, { 0x00000000, 0 }, { 0x00500022, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410069, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570051, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0055006A, -3 }, { 0x004F00C7, -5 }, { 0x004C0054, -11 },
+    { 0x00740068, -2 }, { 0x00000000, 0 }, { 0x00DE0034, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0069006B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410057, -9 },
+    { 0x00000000, 0 }, { 0x00380041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E0029, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550058, -6 }, { 0x00740056, -2 },
+    { 0x00000000, 0 }, { 0x004C0042, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00340073, -1 },
+    { 0x00530071, 2 }, { 0x0072006F, -2 }, { 0x00C60053, -5 }, { 0x00000000, 0 },
+    { 0x00410045, -5 }, { 0x00000000, 0 }, { 0x0030201E, -2 }, { 0x004F201C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480074, 1 },
+    { 0x00670072, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00550046, -6 }, { 0x0063201D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0073, -4 }, { 0x201E0079, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A0049, -4 },
+    { 0x00690047, -3 }, { 0x0077201E, -3 }, { 0x00C60041, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00510078, -2 }, { 0x00700076, -4 },
+    { 0x012A006A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x003F004C, 2 },
+    { 0x00000000, 0 }, { 0x00550034, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00650079, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007B0061, -4 }, { 0x00000000, 0 }, { 0x0053004D, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0079007A, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00700064, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480050, -5 }, { 0x0067004E, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550022, 3 },
+    { 0x007100F0, -3 }, { 0x00000000, 0 }, { 0x00460069, -4 }, { 0x00650067, -2 },
+    { 0x00000000, 0 }, { 0x007B004F, -3 }, { 0x00D80049, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410152, -7 },
+    { 0x00DF0078, -2 }, { 0x00FE0076, -1 }, { 0x005A006A, -3 }, { 0x005400C7, -8 },
+    { 0x00320056, -1 }, { 0x00510054, -5 }, { 0x00790068, -3 }, { 0x0152005A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007100DE, -2 }, { 0x006E006B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00460057, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00530029, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00440070, -1 }, { 0x0063006E, -2 }, { 0x005A0058, -5 },
+    { 0x00790056, -1 }, { 0x00DF0066, -1 }, { 0x00510042, -3 }, { 0x01520048, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580071, -2 }, { 0x0077006F, -3 }, { 0x00000000, 0 }, { 0x006E0059, -4 },
+    { 0x00000000, 0 }, { 0x00460045, -5 }, { 0x00650043, 1 }, { 0x0035201E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x002E0076, -3 }, { 0x004D0074, 1 }, { 0x006C0072, -2 }, { 0x00DF0054, -1 },
+    { 0x00000000, 0 }, { 0x005A0046, -5 }, { 0x201C004A, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420077, -1 },
+    { 0x00610075, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004F0049, -4 }, { 0x006E0047, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0037007A, -2 }, { 0x00560078, -3 },
+    { 0x00750076, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0044004C, -5 }, { 0x0063004A, -4 }, { 0x005A0034, -6 }, { 0x00790032, -2 },
+    { 0x201C0038, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004500D8, -5 },
+    { 0x00000000, 0 }, { 0x00610063, -2 }, { 0x00000000, 0 }, { 0x0058004D, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F0037, -1 }, { 0x00000000, 0 },
+    { 0x00460021, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560066, -1 }, { 0x00750064, -2 }, { 0x00000000, 0 }, { 0x004D0050, -5 },
+    { 0x006C004E, -2 }, { 0x00630038, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007600F0, -2 }, { 0x00EF0075, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004500C6, -5 }, { 0x00420053, -6 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00460152, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005900C7, -9 }, { 0x00560054, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440028, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054006D, -5 }, { 0x0073006B, -2 },
+    { 0x00000000, 0 }, { 0x002C0059, -2 }, { 0x004B0057, -7 }, { 0x00420041, -6 },
+    { 0x006A0055, 1 }, { 0x00C7004F, -5 }, { 0x00580029, -1 }, { 0x00F000EF, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0068006E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560042, -5 },
+    { 0x00000000, 0 }, { 0x002E002E, 1 }, { 0x006C002A, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00730059, -3 }, { 0x00000000, 0 }, { 0x002C0047, -1 }, { 0x004B0045, -5 },
+    { 0x006A0043, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00520074, -1 }, { 0x00710072, -5 }, { 0x00CE006C, 1 },
+    { 0x00ED006A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560030, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00280079, -2 }, { 0x00470077, -4 }, { 0x00660075, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540049, -4 }, { 0x00730047, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005B0078, -5 }, { 0x007A0076, -2 }, { 0x00520062, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0049004C, -3 }, { 0x0068004A, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0031007D, -3 },
+    { 0x004A00D8, -5 }, { 0x00280067, -1 }, { 0x00470065, -2 }, { 0x00660063, -2 },
+    { 0x006F0079, -4 }, { 0x00DF012B, 1 }, { 0x00000000, 0 }, { 0x00350039, -1 },
+    { 0x00000000, 0 }, { 0x006700EF, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005B0066, -1 }, { 0x007A0064, -3 }, { 0x201D006A, -3 },
+    { 0x00520050, -5 }, { 0x0071004E, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B00F0, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006F0067, -2 }, { 0x00000000, 0 }, { 0x004A00C6, -6 }, { 0x00470053, -6 },
+    { 0x00660051, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B0152, -9 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0064006A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D800D8, 1 }, { 0x0059006D, -3 },
+    { 0x0078006B, -2 }, { 0x00000000, 0 }, { 0x00310059, -4 }, { 0x00500057, -6 },
+    { 0x00280043, -3 }, { 0x00470041, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0070, -4 },
+    { 0x00000000, 0 }, { 0x0045005A, -5 }, { 0x00640058, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00620071, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0056012B, 1 }, { 0x00780059, -3 }, { 0x00500045, -5 },
+    { 0x006F0043, 1 }, { 0x00000000, 0 }, { 0x00280031, -2 }, { 0x0066002D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00760072, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450048, -5 },
+    { 0x00640046, -3 }, { 0x005B0030, -1 }, { 0x201D0034, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004C0077, -2 }, { 0x006B0075, -4 }, { 0x00000000, 0 },
+    { 0x00DE0057, -1 }, { 0x00000000, 0 }, { 0x00590049, -4 }, { 0x00780047, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0041007A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570062, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E004C, -6 }, { 0x006D004A, -4 },
+    { 0x00450036, -1 }, { 0x00640034, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00740079, -2 }, { 0x004F00D8, -5 }, { 0x00F00071, -1 }, { 0x006B0063, -5 },
+    { 0x00000000, 0 }, { 0x0043004F, -5 }, { 0x0062004D, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410068, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00570050, -6 }, { 0x0076004E, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00640022, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00740067, -3 }, { 0x012B012B, 5 }, { 0x004F00C6, -8 },
+    { 0x004C0053, -5 }, { 0x006B0051, -3 }, { 0x00000000, 0 }, { 0x00DE0033, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00500152, -5 }, { 0x00000000, 0 },
+    { 0x004D00DF, 1 }, { 0x0069006A, -3 }, { 0x00000000, 0 }, { 0x00410056, -11 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550057, -5 },
+    { 0x00F0004D, 1 }, { 0x004C0041, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00620029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00530070, -1 }, { 0x0072006E, -2 }, { 0x004A005A, -6 }, { 0x00690058, 1 },
+    { 0x00C60052, -5 }, { 0x00410044, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00670071, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00550045, -5 }, { 0x00000000, 0 }, { 0x0044201E, -1 }, { 0x002D0031, -1 },
+    { 0x0063201C, -2 }, { 0x006B002D, -4 }, { 0x00000000, 0 }, { 0x007B0072, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004A0048, -5 }, { 0x00690046, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00510077, -1 }, { 0x00700075, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x003F004B, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0046007A, -6 }, { 0x00650078, -3 }, { 0x00000000, 0 },
+    { 0x201E0066, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0053004C, -5 },
+    { 0x0072004A, -4 }, { 0x00690034, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00220022, 3 }, { 0x00790079, -2 }, { 0x005400D8, -7 }, { 0x00000000, 0 },
+    { 0x00700063, -2 }, { 0x00000000, 0 }, { 0x00290051, 1 }, { 0x0048004F, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460068, -4 },
+    { 0x00650066, -3 }, { 0x201E0054, -5 }, { 0x007B004E, -1 }, { 0x00D80048, 1 },
+    { 0x0053003A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00690022, 2 },
+    { 0x00DF0077, -1 }, { 0x00000000, 0 }, { 0x005A0069, 1 }, { 0x00790067, -3 },
+    { 0x005400C6, -11 }, { 0x00510053, -6 }, { 0x0130012B, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550152, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006E006A, -3 }, { 0x00000000, 0 },
+    { 0x00460056, -5 }, { 0x00650054, -9 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00530028, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0044006F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005A0057, -5 }, { 0x00000000, 0 }, { 0x00510041, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00670029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0077006E, -3 }, { 0x00000000, 0 }, { 0x004F005A, -6 },
+    { 0x006E0058, 1 }, { 0x00000000, 0 }, { 0x00460044, -5 }, { 0x0035201D, -1 },
+    { 0x00650042, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004D0073, 1 }, { 0x006C0071, -3 }, { 0x00000000, 0 }, { 0x0044005D, -1 },
+    { 0x00000000, 0 }, { 0x005A0045, -5 }, { 0x00000000, 0 }, { 0x0068201C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00420076, -1 }, { 0x00610074, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0030004A, -4 }, { 0x004F0048, -5 }, { 0x006E0046, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560077, -1 },
+    { 0x00750075, -2 }, { 0x00000000, 0 }, { 0x004D0061, 1 }, { 0x00000000, 0 },
+    { 0x0044004B, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00790031, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006A0078, -1 },
+    { 0x00000000, 0 }, { 0x00420064, 1 }, { 0x00610062, -3 }, { 0x00000000, 0 },
+    { 0x0058004C, -5 }, { 0x0077004A, -4 }, { 0x006E0034, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00270022, 3 }, { 0x00000000, 0 }, { 0x005900D8, -8 },
+    { 0x00370067, -1 }, { 0x00560065, -2 }, { 0x00750063, -2 }, { 0x004D004F, -5 },
+    { 0x006C004D, 1 }, { 0x00EE012B, 4 }, { 0x00630037, -4 }, { 0x00000000, 0 },
+    { 0x007600EF, 2 }, { 0x00000000, 0 }, { 0x00EF0074, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420052, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006E0022, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005900C6, -11 }, { 0x00560053, -8 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005A0152, -7 }, { 0x00000000, 0 }, { 0x005700DF, -1 }, { 0x0054006C, -3 },
+    { 0x0073006A, -3 }, { 0x004B0056, -7 }, { 0x006A0054, 1 }, { 0x00C7004E, -5 },
+    { 0x00EF0062, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560041, -12 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006C0029, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0054005A, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0044, -5 },
+    { 0x006A0042, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00710071, -5 }, { 0x00CE006B, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E201E, -1 }, { 0x00370031, -1 }, { 0x006D201C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00280078, -3 }, { 0x00470076, -5 }, { 0x00660074, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0035004A, -4 }, { 0x00540048, -5 },
+    { 0x00730046, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005B0077, -4 }, { 0x007A0075, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0049004B, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0050007A, -1 },
+    { 0x006F0078, -5 }, { 0x00000000, 0 }, { 0x00280066, -2 }, { 0x00470064, -2 },
+    { 0x00660062, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540036, -1 },
+    { 0x00730034, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0065, -4 }, { 0x007A0063, -3 },
+    { 0x0052004F, -7 }, { 0x0071004D, -2 }, { 0x00000000, 0 }, { 0x00680037, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0031006A, -3 }, { 0x006F0066, -3 }, { 0x00470052, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00730022, 2 }, { 0x00000000, 0 }, { 0x004800DE, 1 },
+    { 0x00640069, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0053, -1 },
+    { 0x007A0051, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE007A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0078006A, -4 }, { 0x00000000, 0 }, { 0x00500056, -6 }, { 0x006F0054, -9 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E006F, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450059, -5 }, { 0x00640057, 1 },
+    { 0x005B0041, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00620070, -3 },
+    { 0x00000000, 0 }, { 0x0059005A, -7 }, { 0x00780058, -1 }, { 0x00000000, 0 },
+    { 0x00500044, -5 }, { 0x00000000, 0 }, { 0x00280030, -3 }, { 0x0047002E, -1 },
+    { 0x0066002C, -3 }, { 0x00000000, 0 }, { 0x00570073, -2 }, { 0x00760071, -4 },
+    { 0x00000000, 0 }, { 0x006A012B, 3 }, { 0x00000000, 0 }, { 0x00450047, -6 },
+    { 0x00000000, 0 }, { 0x0053201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002D0078, -2 }, { 0x004C0076, -4 },
+    { 0x006B0074, -5 }, { 0x00DE0056, -2 }, { 0x00000000, 0 }, { 0x00590048, -5 },
+    { 0x00780046, -2 }, { 0x00310034, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410079, -8 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570061, -2 }, { 0x00000000, 0 }, { 0x004E004B, -6 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0055007A, -1 }, { 0x00740078, -2 }, { 0x00F00070, -1 }, { 0x004C0064, 1 },
+    { 0x006B0062, -5 }, { 0x00000000, 0 }, { 0x0043004E, -5 }, { 0x0062004C, 1 },
+    { 0x00590036, -2 }, { 0x00780034, -5 }, { 0x00DE0044, 1 }, { 0x004D00F0, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410067, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0057004F, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006D0037, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0036006A, -3 }, { 0x00740066, -2 },
+    { 0x002D0054, -3 }, { 0x004C0052, -5 }, { 0x00000000, 0 }, { 0x00DE0032, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00780022, 1 }, { 0x00000000, 0 },
+    { 0x004D00DE, 2 }, { 0x00690069, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410055, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007D006A, -3 }, { 0x00000000, 0 }, { 0x00360058, -1 },
+    { 0x00550056, -5 }, { 0x00740054, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0053006F, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A0059, -5 },
+    { 0x00C60051, -4 }, { 0x00410043, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00760029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00670070, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00550044, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B0071, -4 },
+    { 0x201E0077, -2 }, { 0x00000000, 0 }, { 0x0053005D, -2 }, { 0x00000000, 0 },
+    { 0x004A0047, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EF00DF, 1 }, { 0x00510076, -1 },
+    { 0x00700074, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460079, -4 }, { 0x00650077, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0053004B, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005A007A, 1 }, { 0x00790078, -3 }, { 0x00000000, 0 },
+    { 0x00700062, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0048004E, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007100EE, -2 }, { 0x004F007D, -3 }, { 0x00000000, 0 }, { 0x00460067, -5 },
+    { 0x00650065, -2 }, { 0x00000000, 0 }, { 0x00D80047, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00720037, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DF0076, -1 }, { 0x00FE0074, -1 }, { 0x005A0068, 1 },
+    { 0x00790066, -2 }, { 0x00510052, -4 }, { 0x01520058, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005200DE, 1 }, { 0x006E0069, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00460055, -5 }, { 0x00650053, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00340029, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0063006C, -2 }, { 0x00000000, 0 },
+    { 0x005A0056, -5 }, { 0x00790054, -10 }, { 0x01520046, 1 }, { 0x201C005A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0058006F, -2 }, { 0x0077006D, -1 }, { 0x00000000, 0 },
+    { 0x004F0059, -8 }, { 0x006E0057, -2 }, { 0x00460043, -6 }, { 0x00650041, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002E0074, -2 }, { 0x004D0072, 1 }, { 0x0063005A, 1 },
+    { 0x006C0070, -2 }, { 0x00000000, 0 }, { 0x005A0044, -5 }, { 0x00000000, 0 },
+    { 0x0070002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00610073, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004F0047, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00460031, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00370078, -2 }, { 0x00560076, -1 }, { 0x006C005E, -1 }, { 0x00750074, -2 },
+    { 0x00000000, 0 }, { 0x0044004A, -10 }, { 0x00630048, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0079, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00610061, -2 }, { 0x00000000, 0 },
+    { 0x0058004B, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00300037, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560064, -2 }, { 0x00750062, -3 }, { 0x00000000, 0 },
+    { 0x004D004E, -5 }, { 0x00000000, 0 }, { 0x00630036, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005700F0, -2 }, { 0x0073007B, -1 }, { 0x00000000, 0 },
+    { 0x004B0067, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420051, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00770037, -7 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560052, -6 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700DE, 1 }, { 0x0054006B, -3 },
+    { 0x00730069, -2 }, { 0x00000000, 0 }, { 0x004B0055, -7 }, { 0x006A0053, 1 },
+    { 0x00C7004D, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00390029, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0068006C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540059, -5 }, { 0x00730057, -2 }, { 0x004B0043, -9 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00710070, -2 }, { 0x00CE006A, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00280077, -2 }, { 0x00470075, -3 }, { 0x00660073, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540047, -6 }, { 0x00000000, 0 },
+    { 0x0062201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201D007A, -2 }, { 0x005B0076, -4 }, { 0x007A0074, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0049004A, -7 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0031007B, -2 }, { 0x006F0077, -3 }, { 0x00000000, 0 }, { 0x00280065, -3 },
+    { 0x00470063, -2 }, { 0x00660061, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0021, 1 }, { 0x0064007A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0064, -3 }, { 0x007A0062, -2 },
+    { 0x00000000, 0 }, { 0x0052004E, -5 }, { 0x0071004C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0078007B, -3 },
+    { 0x00000000, 0 }, { 0x00500067, -1 }, { 0x006F0065, -2 }, { 0x00000000, 0 },
+    { 0x00280053, -3 }, { 0x00470051, -3 }, { 0x00F0201E, -6 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0045006A, -3 }, { 0x00640068, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0079, -1 }, { 0x00000000, 0 },
+    { 0x00780069, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00310057, -2 },
+    { 0x00500055, -5 }, { 0x00280041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E006E, -4 }, { 0x00000000, 0 }, { 0x00450058, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0062006F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590059, -5 }, { 0x00780057, -2 },
+    { 0x00500043, -6 }, { 0x006F0041, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570072, -2 },
+    { 0x00760070, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00450046, -5 }, { 0x0053201D, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B0073, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE0055, 1 }, { 0x00000000, 0 }, { 0x00590047, -8 },
+    { 0x00000000, 0 }, { 0x0067201E, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410078, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E004A, -10 },
+    { 0x00000000, 0 }, { 0x00450034, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00740077, -2 }, { 0x00F0006F, -1 }, { 0x00000000, 0 },
+    { 0x006B0061, -4 }, { 0x00000000, 0 }, { 0x0043004D, -5 }, { 0x0062004B, 1 },
+    { 0x00DE0043, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0069007A, -2 }, { 0x01040070, 2 }, { 0x00000000, 0 }, { 0x00410066, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057004E, -6 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00740065, -3 },
+    { 0x012B0129, 4 }, { 0x002D0053, -7 }, { 0x004C0051, -3 }, { 0x006B004F, -3 },
+    { 0x00DE0031, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A006A, -1 }, { 0x004400C7, -5 },
+    { 0x00410054, -11 }, { 0x00690068, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00550055, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00340070, -1 }, { 0x0053006E, 1 }, { 0x004A0058, -6 },
+    { 0x0072006C, -2 }, { 0x00C60050, -5 }, { 0x00410042, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0067006F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005E0059, -3 },
+    { 0x00000000, 0 }, { 0x00550043, -5 }, { 0x00740041, -3 }, { 0x0044201C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007B0070, -1 }, { 0x201E0076, -4 }, { 0x0072005A, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004A0046, -6 }, { 0x0058201D, -1 }, { 0x00410030, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00700073, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x003F0049, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460078, -6 },
+    { 0x00650076, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0053004A, -10 }, { 0x00000000, 0 }, { 0x004A0034, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A0079, -1 }, { 0x00790077, -2 },
+    { 0x00000000, 0 }, { 0x00700061, -2 }, { 0x00000000, 0 }, { 0x0048004D, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x003F0037, 2 }, { 0x007D0033, -2 },
+    { 0x007100ED, -2 }, { 0x006E007A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00460066, -4 }, { 0x00650064, -2 }, { 0x00000000, 0 }, { 0x00D80046, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006600F0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A0067, -1 },
+    { 0x00790065, -3 }, { 0x00000000, 0 }, { 0x00510051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F006A, -3 },
+    { 0x004900C7, -4 }, { 0x00460054, -5 }, { 0x006E0068, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0063006B, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005A0055, -5 }, { 0x01520045, 1 }, { 0x201C0059, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480029, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00390070, -1 }, { 0x0058006E, 1 },
+    { 0x004F0058, -8 }, { 0x006E0056, -2 }, { 0x0077006C, -2 }, { 0x00460042, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004D0071, 1 }, { 0x006C006F, -3 }, { 0x00000000, 0 },
+    { 0x00630059, -3 }, { 0x00000000, 0 }, { 0x005A0043, -7 }, { 0x00790041, -6 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00420074, -1 }, { 0x00610072, -2 }, { 0x0077005A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F0046, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560075, -1 }, { 0x00750073, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00440049, -4 }, { 0x00630047, -4 }, { 0x00DF003F, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0058004A, -9 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560063, -2 }, { 0x00750061, -2 },
+    { 0x004D004D, -5 }, { 0x00CF012B, 1 }, { 0x00EE0129, 3 }, { 0x00440037, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0073007A, -2 }, { 0x00EF0072, 1 },
+    { 0x00000000, 0 }, { 0x004B0066, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00420050, -5 }, { 0x0061004E, -2 }, { 0x00580038, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006B00F0, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00370053, -1 },
+    { 0x00560051, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0054006A, -3 }, { 0x004E00C7, -5 }, { 0x004B0054, -7 }, { 0x00730068, -2 },
+    { 0x00C7004C, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0068006B, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00370041, -2 }, { 0x0056003F, -1 }, { 0x00000000, 0 }, { 0x004D0029, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540058, -6 }, { 0x00730056, -2 }, { 0x00000000, 0 },
+    { 0x004B0042, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00330073, -1 }, { 0x00520071, -1 },
+    { 0x0071006F, -5 }, { 0x0046012B, 1 }, { 0x00680059, -4 }, { 0x00210047, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280076, -2 }, { 0x00470074, -5 },
+    { 0x00660072, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540046, -6 },
+    { 0x0062201D, -1 }, { 0x004B0030, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005B0075, -4 }, { 0x007A0073, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490049, -2 }, { 0x00680047, -3 },
+    { 0x0076201E, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00500078, -1 }, { 0x006F0076, -4 }, { 0x00280064, -3 },
+    { 0x00470062, -3 }, { 0x0129006A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540034, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00640079, -2 }, { 0x00000000, 0 }, { 0x201D0067, -2 }, { 0x005B0063, -4 },
+    { 0x007A0061, -3 }, { 0x0052004D, -5 }, { 0x0071004B, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0078007A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006F0064, -2 }, { 0x00000000, 0 },
+    { 0x00280052, -1 }, { 0x00470050, -5 }, { 0x0066004E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540022, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00640067, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005B0051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00710039, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0078, -4 },
+    { 0x00000000, 0 }, { 0x0059006A, -3 }, { 0x005300C7, -5 }, { 0x00310056, -3 },
+    { 0x00500054, -5 }, { 0x00780068, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450057, -5 },
+    { 0x00000000, 0 }, { 0x201D0043, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00520029, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00430070, -1 }, { 0x0062006E, -2 }, { 0x00590058, -6 }, { 0x00780056, -2 },
+    { 0x00000000, 0 }, { 0x00500042, -5 }, { 0x00000000, 0 }, { 0x0047002C, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00380073, -1 },
+    { 0x00570071, -2 }, { 0x0076006F, -4 }, { 0x006A0129, 1 }, { 0x006D0059, -4 },
+    { 0x00450045, -5 }, { 0x00000000, 0 }, { 0x0034201E, -2 }, { 0x0053201C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0074, -1 },
+    { 0x006B0072, -2 }, { 0x00DE0054, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590046, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410077, -6 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0049, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550078, -1 }, { 0x00740076, -2 },
+    { 0x004C0062, -1 }, { 0x012E006A, -3 }, { 0x00000000, 0 }, { 0x0043004C, -5 },
+    { 0x0062004A, -4 }, { 0x00590034, -6 }, { 0x00DE0042, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00690079, -2 }, { 0x004400D8, -5 }, { 0x00000000, 0 },
+    { 0x00410065, -4 }, { 0x00000000, 0 }, { 0x0057004D, -6 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006100EF, 1 },
+    { 0x007D007A, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00740064, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0050, -5 }, { 0x006B004E, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590022, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00690067, -2 }, { 0x00000000, 0 },
+    { 0x004400C6, -8 }, { 0x00410053, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450152, -7 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x003F006C, 1 }, { 0x005800C7, -8 },
+    { 0x00550054, -5 }, { 0x005E006A, -2 }, { 0x00F0004A, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0053006D, 1 }, { 0x0072006B, -2 }, { 0x00000000, 0 },
+    { 0x004A0057, -5 }, { 0x00C6004F, -7 }, { 0x00410041, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00570029, 1 }, { 0x00EF00EF, 4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0067006E, -2 }, { 0x00000000, 0 }, { 0x003F005A, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550042, -5 }, { 0x00000000, 0 },
+    { 0x006B002A, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007B006F, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0034005D, -2 },
+    { 0x00720059, -2 }, { 0x004A0045, -5 }, { 0x00000000, 0 }, { 0x0039201E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00700072, -2 }, { 0x00EC006A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x003F0048, 3 }, { 0x006C201D, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460077, -4 },
+    { 0x00650075, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00530049, -4 }, { 0x00720047, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A0078, 1 },
+    { 0x00790076, -2 }, { 0x00510062, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0048004C, -5 }, { 0x00000000, 0 }, { 0x007D0032, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007100EC, -2 }, { 0x0030007D, -2 }, { 0x004900D8, -3 },
+    { 0x006E0079, -4 }, { 0x00460065, -5 }, { 0x00650063, -2 }, { 0x007B004B, -1 },
+    { 0x00D80045, 1 }, { 0x00000000, 0 }, { 0x00340039, -1 }, { 0x00530037, -1 },
+    { 0x006600EF, 2 }, { 0x00000000, 0 }, { 0x00DF0074, -1 }, { 0x00000000, 0 },
+    { 0x005A0066, -1 }, { 0x00790064, -3 }, { 0x201C006A, -3 }, { 0x00510050, -4 },
+    { 0x0070004E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007A00F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006E0067, -2 },
+    { 0x00000000, 0 }, { 0x004900C6, -3 }, { 0x00460053, -8 }, { 0x00650051, 1 },
+    { 0x00000000, 0 }, { 0x007B0039, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004A0152, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0044006C, 1 },
+    { 0x0063006A, -3 }, { 0x005A0054, -5 }, { 0x01520044, 1 }, { 0x201C0058, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058006D, 1 }, { 0x0077006B, -2 },
+    { 0x00000000, 0 }, { 0x00300059, -2 }, { 0x004F0057, -6 }, { 0x00460041, -10 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006C006E, -2 }, { 0x00000000, 0 },
+    { 0x0044005A, -6 }, { 0x00630058, 1 }, { 0x00000000, 0 }, { 0x005A0042, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00420073, -1 }, { 0x00610071, -2 }, { 0x00000000, 0 },
+    { 0x00770059, -2 }, { 0x00000000, 0 }, { 0x004F0045, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00D80152, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560074, -1 }, { 0x00750072, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440048, -5 }, { 0x00630046, -2 },
+    { 0x0071201D, -2 }, { 0x0079002E, -1 }, { 0x201C0034, -3 }, { 0x00000000, 0 },
+    { 0x002C0079, -1 }, { 0x004B0077, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00580049, -3 }, { 0x00770047, -3 }, { 0x00000000, 0 },
+    { 0x004F0033, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560062, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004D004C, -5 }, { 0x006C004A, -4 }, { 0x00630034, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0035007D, -1 },
+    { 0x004E00D8, -5 }, { 0x00730079, -3 }, { 0x004B0065, -3 }, { 0x00000000, 0 },
+    { 0x0042004F, -5 }, { 0x0061004D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560050, -6 }, { 0x0075004E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00630022, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540069, -3 }, { 0x00730067, -2 }, { 0x004E00C6, -6 }, { 0x004B0053, -6 },
+    { 0x006A0051, 1 }, { 0x00C7004B, -5 }, { 0x012A012B, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004F0152, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0068006A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004D0028, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00350059, -1 }, { 0x00540057, -5 },
+    { 0x004B0041, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00610029, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0071006E, -5 },
+    { 0x012B0062, 3 }, { 0x0049005A, -3 }, { 0x00680058, 1 }, { 0x00000000, 0 },
+    { 0x00210046, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280075, -2 }, { 0x00470073, -4 },
+    { 0x00660071, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540045, -5 },
+    { 0x00000000, 0 }, { 0x0043201E, -1 }, { 0x0062201C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0074, -2 }, { 0x007A0072, -2 },
+    { 0x201D0078, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490048, -3 },
+    { 0x00680046, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00310079, -3 }, { 0x006F0075, -2 }, { 0x00000000, 0 },
+    { 0x00280063, -3 }, { 0x00470061, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00640078, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0052004C, -5 }, { 0x00000000, 0 },
+    { 0x00680034, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00780079, -2 }, { 0x005300D8, -5 }, { 0x00000000, 0 }, { 0x00500065, -1 },
+    { 0x006F0063, -2 }, { 0x00280051, -3 }, { 0x0047004F, -5 }, { 0x00000000, 0 },
+    { 0x005D0037, -1 }, { 0x00000000, 0 }, { 0x00540021, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00640066, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007A004E, -3 }, { 0x00000000, 0 }, { 0x00710038, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00680022, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00780067, -4 }, { 0x012F012B, 1 }, { 0x005300C6, -7 },
+    { 0x00500053, -7 }, { 0x006F0051, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540152, -7 }, { 0x00000000, 0 },
+    { 0x005100DF, -1 }, { 0x004E006C, -3 }, { 0x006D006A, -3 }, { 0x00450056, -5 },
+    { 0x00640054, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590057, -5 },
+    { 0x00780055, -1 }, { 0x00500041, -10 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570070, -2 }, { 0x0076006E, -3 }, { 0x004E005A, -6 }, { 0x006D0058, 1 },
+    { 0x00000000, 0 }, { 0x00450044, -5 }, { 0x0034201D, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B0071, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DE0053, -1 }, { 0x00000000, 0 },
+    { 0x00590045, -6 }, { 0x00780043, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410076, -8 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E0048, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00360079, -2 }, { 0x00740075, -2 },
+    { 0x00F0006D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0043004B, -5 },
+    { 0x00DE0041, -2 }, { 0x00000000, 0 }, { 0x00590033, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00690078, -2 }, { 0x00000000, 0 },
+    { 0x00410064, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057004C, -6 },
+    { 0x0076004A, -4 }, { 0x006D0034, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007D0079, -2 }, { 0x005800D8, -5 }, { 0x00000000, 0 },
+    { 0x00740063, -3 }, { 0x00000000, 0 }, { 0x004C004F, -6 }, { 0x006B004D, 1 },
+    { 0x00000000, 0 }, { 0x00430039, -1 }, { 0x00620037, -5 }, { 0x007500EF, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00690066, -2 },
+    { 0x00000000, 0 }, { 0x00410052, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006D0022, 2 },
+    { 0x00000000, 0 }, { 0x004200DE, 1 }, { 0x003F006B, 1 }, { 0x00000000, 0 },
+    { 0x005800C6, -5 }, { 0x00550053, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590152, -8 },
+    { 0x00000000, 0 }, { 0x005600DF, -1 }, { 0x0053006C, 1 }, { 0x0072006A, -3 },
+    { 0x004A0056, -5 }, { 0x00690054, -3 }, { 0x00C6004E, -5 }, { 0x00EE0062, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EF00EE, 4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x003F0059, 3 }, { 0x00000000, 0 }, { 0x00550041, -7 }, { 0x0074003F, -1 },
+    { 0x00F00037, -3 }, { 0x006B0029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B006E, -4 }, { 0x201E0074, -1 }, { 0x0053005A, -5 },
+    { 0x00720058, -3 }, { 0x00000000, 0 }, { 0x004A0044, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00510073, -1 }, { 0x00700071, -2 }, { 0x00000000, 0 }, { 0x0064012B, 3 },
+    { 0x00000000, 0 }, { 0x003F0047, 2 }, { 0x00000000, 0 }, { 0x006C201C, -2 },
+    { 0x0074002D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00460076, -4 }, { 0x00650074, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0034004A, -4 }, { 0x00530048, -5 }, { 0x00720046, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A0077, -1 },
+    { 0x00790075, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0029004D, 1 }, { 0x0048004B, -5 }, { 0x00000000, 0 }, { 0x003F0035, 1 },
+    { 0x007D0031, -2 }, { 0x00000000, 0 }, { 0x004F007A, -1 }, { 0x006E0078, -2 },
+    { 0x012B00DF, 1 }, { 0x00460064, -5 }, { 0x00650062, -2 }, { 0x00000000, 0 },
+    { 0x00D80044, 1 }, { 0x00000000, 0 }, { 0x00720034, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0044007D, -3 }, { 0x0063007B, -2 },
+    { 0x00000000, 0 }, { 0x005A0065, -1 }, { 0x00790063, -3 }, { 0x0051004F, -3 },
+    { 0x0070004D, 1 }, { 0x00000000, 0 }, { 0x00670037, -4 }, { 0x00000000, 0 },
+    { 0x007A00EF, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0030006A, -3 }, { 0x006E0066, -3 }, { 0x00460052, -6 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B0038, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00720022, 3 }, { 0x00000000, 0 }, { 0x004700DE, 1 }, { 0x0044006B, 1 },
+    { 0x00630069, -2 }, { 0x00000000, 0 }, { 0x005A0053, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00290029, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058006C, 1 },
+    { 0x0077006A, -3 }, { 0x00300058, -2 }, { 0x004F0056, -7 }, { 0x006E0054, -9 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D006F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00440059, -9 }, { 0x00630057, -2 }, { 0x005A0041, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00700029, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00610070, -2 }, { 0x00000000, 0 },
+    { 0x0058005A, -5 }, { 0x00770058, -3 }, { 0x00000000, 0 }, { 0x004F0044, -5 },
+    { 0x00000000, 0 }, { 0x0046002E, -8 }, { 0x0065002C, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00560073, -3 }, { 0x00750071, -2 }, { 0x00000000, 0 },
+    { 0x0069012B, 2 }, { 0x00000000, 0 }, { 0x00440047, -5 }, { 0x00000000, 0 },
+    { 0x0071201C, -3 }, { 0x201C0033, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004B0076, -4 }, { 0x006A0074, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0039004A, -4 }, { 0x00580048, -5 },
+    { 0x00770046, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00370063, -1 },
+    { 0x00560061, -3 }, { 0x004D004B, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054007A, -9 },
+    { 0x00730078, -3 }, { 0x00000000, 0 }, { 0x002C0066, -1 }, { 0x004B0064, -2 },
+    { 0x00000000, 0 }, { 0x0042004E, -5 }, { 0x00000000, 0 }, { 0x00580036, -2 },
+    { 0x00770034, -2 }, { 0x00000000, 0 }, { 0x00300022, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0056004F, -7 }, { 0x0075004D, 1 }, { 0x00000000, 0 }, { 0x006C0037, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0035006A, -3 }, { 0x00540068, -4 }, { 0x002C0054, -6 },
+    { 0x004B0052, -5 }, { 0x00730066, -3 }, { 0x00C7004A, -7 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00770022, 3 }, { 0x00000000, 0 }, { 0x004C00DE, 1 },
+    { 0x00680069, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0037003F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00350058, -1 }, { 0x00540056, -5 },
+    { 0x00730054, -9 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0052006F, -1 },
+    { 0x0071006D, -3 }, { 0x00000000, 0 }, { 0x00490059, -4 }, { 0x00680057, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00750029, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280074, -2 },
+    { 0x00470072, -3 }, { 0x00660070, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540044, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0073, -5 }, { 0x007A0071, -3 },
+    { 0x00000000, 0 }, { 0x0052005D, -1 }, { 0x00000000, 0 }, { 0x00490047, -4 },
+    { 0x00000000, 0 }, { 0x0057201E, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00EE00DF, 1 }, { 0x006F0074, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00350034, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00450079, -4 }, { 0x00640077, -2 }, { 0x00000000, 0 },
+    { 0x005B0061, -4 }, { 0x201D0065, -2 }, { 0x0052004B, -5 }, { 0x00710049, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0059007A, -4 }, { 0x00780078, -2 }, { 0x00000000, 0 }, { 0x00310066, -1 },
+    { 0x006F0062, -2 }, { 0x00000000, 0 }, { 0x00280050, -1 }, { 0x0047004E, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00640065, -2 },
+    { 0x00000000, 0 }, { 0x005B004F, -1 }, { 0x007A004D, 1 }, { 0x201D0053, -1 },
+    { 0x00710037, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00DE0076, -1 }, { 0x00000000, 0 }, { 0x003A006A, -1 }, { 0x00590068, -1 },
+    { 0x00310054, -3 }, { 0x00500052, -6 }, { 0x00780066, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004E006B, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00450055, -5 }, { 0x00640053, 1 }, { 0x201D0041, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00330029, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0062006C, -2 }, { 0x00000000, 0 }, { 0x00590056, -5 },
+    { 0x00780054, -9 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0057006F, -2 }, { 0x0076006D, -1 }, { 0x00000000, 0 }, { 0x004E0059, -5 },
+    { 0x006D0057, -2 }, { 0x00450043, -6 }, { 0x00640041, -3 }, { 0x0034201C, -2 },
+    { 0x007A0029, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006B0070, -2 }, { 0x00000000, 0 }, { 0x0062005A, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590044, -5 }, { 0x00000000, 0 }, { 0x0050002E, -6 },
+    { 0x006F002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410075, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E0047, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00360078, -2 },
+    { 0x00740074, -2 }, { 0x006B005E, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0043004A, -9 }, { 0x00620048, 1 }, { 0x00780030, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00690077, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410063, -4 }, { 0x00000000, 0 }, { 0x0057004B, -6 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007D0078, -2 }, { 0x00000000, 0 },
+    { 0x00360066, -1 }, { 0x00740062, -2 }, { 0x00F0005A, -5 }, { 0x004C004E, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x003A0022, 4 }, { 0x0053007D, -2 }, { 0x005600F0, -3 }, { 0x0072007B, -2 },
+    { 0x00690065, -2 }, { 0x00000000, 0 }, { 0x00410051, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00760037, -8 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007D0066, -1 },
+    { 0x00000000, 0 }, { 0x00550052, -6 }, { 0x00F00048, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005600DE, 1 }, { 0x0053006B, 1 }, { 0x00720069, -2 },
+    { 0x00000000, 0 }, { 0x004A0055, -5 }, { 0x00690053, 1 }, { 0x00C6004D, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00380029, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00290070, -1 }, { 0x0067006C, -2 },
+    { 0x003F0058, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007B006D, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00530059, -8 }, { 0x00720057, -1 }, { 0x004A0043, -5 }, { 0x00690041, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00510072, -1 }, { 0x00700070, -3 }, { 0x00C700C7, -5 },
+    { 0x00CD006A, -3 }, { 0x00000000, 0 }, { 0x003F0046, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00460075, -4 }, { 0x00650073, -2 }, { 0x00000000, 0 }, { 0x00D80055, 1 },
+    { 0x00000000, 0 }, { 0x00530047, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C007A, -2 },
+    { 0x005A0076, -1 }, { 0x00790074, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0048004A, -9 }, { 0x00000000, 0 }, { 0x003F0034, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006E0077, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460063, -4 }, { 0x00650061, -2 },
+    { 0x00D80043, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00340037, -2 },
+    { 0x00720033, -2 }, { 0x00000000, 0 }, { 0x0063007A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005A0064, -1 }, { 0x00790062, -2 }, { 0x00000000, 0 },
+    { 0x0051004E, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005B00F0, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006E0065, -2 }, { 0x00000000, 0 }, { 0x00460051, -4 },
+    { 0x0065004F, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00720021, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002800DF, -2 },
+    { 0x0044006A, -3 }, { 0x00630068, -2 }, { 0x005A0052, -5 }, { 0x01520042, 1 },
+    { 0x201C0056, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058006B, 1 },
+    { 0x00770069, -2 }, { 0x00000000, 0 }, { 0x00300057, -1 }, { 0x004F0055, -5 },
+    { 0x0046003F, -1 }, { 0x006E0053, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D006E, 1 },
+    { 0x006C006C, -2 }, { 0x00440058, -9 }, { 0x00630056, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420071, 1 }, { 0x0061006F, -2 },
+    { 0x00000000, 0 }, { 0x00580059, -5 }, { 0x00000000, 0 }, { 0x004F0043, -5 },
+    { 0x006E0041, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00560072, -2 }, { 0x00750070, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440046, -5 },
+    { 0x0052201D, -1 }, { 0x00630044, 1 }, { 0x0079002C, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x002C0077, -1 }, { 0x004B0075, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580047, -8 }, { 0x00000000, 0 },
+    { 0x0066201E, -3 }, { 0x00300033, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D004A, -9 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540079, -10 }, { 0x00730077, -3 }, { 0x00000000, 0 }, { 0x004B0063, -2 },
+    { 0x00000000, 0 }, { 0x0042004D, -5 }, { 0x0061004B, 1 }, { 0x00000000, 0 },
+    { 0x00390037, -1 }, { 0x00770033, -3 }, { 0x00000000, 0 }, { 0x0068007A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0056004E, -7 }, { 0x00000000, 0 }, { 0x006C0036, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540067, -9 }, { 0x00730065, -2 }, { 0x00000000, 0 },
+    { 0x004B0051, -7 }, { 0x006A004F, 1 }, { 0x00C70049, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00770021, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0049006A, -3 }, { 0x004300C7, -5 }, { 0x00680068, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00350057, -1 },
+    { 0x00540055, -5 }, { 0x002C0041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00420029, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00330070, -1 }, { 0x0071006C, -5 }, { 0x00490058, -3 }, { 0x00680056, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280073, -3 },
+    { 0x00470071, -2 }, { 0x0066006F, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540043, -8 }, { 0x00730041, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0072, -5 },
+    { 0x007A0070, -3 }, { 0x0071005A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00490046, -3 }, { 0x0057201D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00310077, -2 }, { 0x006F0073, -3 },
+    { 0x00000000, 0 }, { 0x00280061, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540031, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00640076, -2 }, { 0x00000000, 0 },
+    { 0x201D0064, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0052004A, -9 },
+    { 0x00710048, -2 }, { 0x00490034, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590079, -2 }, { 0x00780077, -2 }, { 0x00000000, 0 },
+    { 0x006F0061, -2 }, { 0x00000000, 0 }, { 0x0028004F, -3 }, { 0x0047004D, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450066, -1 },
+    { 0x00640064, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00710036, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490022, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590067, -4 }, { 0x00780065, -5 },
+    { 0x00000000, 0 }, { 0x00500051, -3 }, { 0x006F004F, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E006A, -3 }, { 0x004800C7, -5 },
+    { 0x00450054, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006500DE, 1 }, { 0x0062006B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590055, -5 }, { 0x00780053, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00470029, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00380070, -1 }, { 0x0057006E, -1 }, { 0x004E0058, -6 },
+    { 0x006D0056, -2 }, { 0x0076006C, -2 }, { 0x00450042, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012E0079, -4 }, { 0x00000000, 0 },
+    { 0x006B006F, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00620059, -4 },
+    { 0x00DE0051, 1 }, { 0x00590043, -9 }, { 0x00780041, -2 }, { 0x00000000, 0 },
+    { 0x0050002D, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410074, -6 }, { 0x00000000, 0 }, { 0x0076005A, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004E0046, -6 }, { 0x00000000, 0 }, { 0x00450030, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00360077, -1 },
+    { 0x00740073, -2 }, { 0x012E0067, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00430049, -4 }, { 0x00620047, -3 }, { 0x0070201E, -1 }, { 0x00590031, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004A0078, -1 },
+    { 0x00690076, -2 }, { 0x00410062, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0057004A, -10 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00740061, -2 }, { 0x00CE012B, 1 }, { 0x004C004D, -5 },
+    { 0x00F00059, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0072007A, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00690064, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410050, -5 },
+    { 0x00000000, 0 }, { 0x00570038, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x003F0069, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550051, -3 }, { 0x00F00047, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0053006A, -3 },
+    { 0x004D00C7, -5 }, { 0x004A0054, -5 }, { 0x00720068, -2 }, { 0x00C6004C, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00EF00EC, 1 },
+    { 0x00000000, 0 }, { 0x00C700D8, -5 }, { 0x0067006B, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x003F0057, 4 }, { 0x00000000, 0 }, { 0x00360041, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C0029, -2 }, { 0x006B0027, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0034005A, -1 }, { 0x00530058, -8 }, { 0x00720056, -1 }, { 0x004A0042, -5 },
+    { 0x00000000, 0 }, { 0x0041002C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0070006F, -2 }, { 0x00000000, 0 }, { 0x00C700C6, -5 },
+    { 0x00640129, 1 }, { 0x00670059, -2 }, { 0x003F0045, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x012B00EF, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00460074, -4 }, { 0x00650072, -2 }, { 0x007B005A, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00530046, -5 }, { 0x0061201D, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005A0075, -1 }, { 0x00790073, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00480049, -3 }, { 0x00670047, -3 }, { 0x00000000, 0 },
+    { 0x003F0033, 1 }, { 0x005E0031, -2 }, { 0x00000000, 0 }, { 0x0030007A, -1 },
+    { 0x004F0078, -2 }, { 0x006E0076, -4 }, { 0x00460062, -2 }, { 0x0128006A, -3 },
+    { 0x00000000, 0 }, { 0x00D80042, 1 }, { 0x00000000, 0 }, { 0x00720032, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002800F0, -3 }, { 0x00630079, -4 },
+    { 0x006600EC, 1 }, { 0x00000000, 0 }, { 0x005A0063, -1 }, { 0x00790061, -3 },
+    { 0x0051004D, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0077007A, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006E0064, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00460050, -6 }, { 0x0065004E, -3 }, { 0x007B0036, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00630067, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A0051, -5 },
+    { 0x01520041, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0058006A, -3 }, { 0x005200C7, -6 }, { 0x00300056, -1 }, { 0x004F0054, -6 },
+    { 0x00770068, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D006D, 1 },
+    { 0x006C006B, -2 }, { 0x00000000, 0 }, { 0x00440057, -7 }, { 0x00630055, -1 },
+    { 0x00DF004D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00510029, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00420070, -1 },
+    { 0x0061006E, -2 }, { 0x00580058, -5 }, { 0x00770056, -1 }, { 0x00000000, 0 },
+    { 0x004F0042, -5 }, { 0x00000000, 0 }, { 0x0046002C, -9 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00370073, -1 }, { 0x00560071, -2 },
+    { 0x0075006F, -2 }, { 0x006C0059, -2 }, { 0x00000000, 0 }, { 0x00440045, -5 },
+    { 0x00630043, -1 }, { 0x0033201E, -1 }, { 0x0052201C, -2 }, { 0x201C0031, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0076, -3 }, { 0x004B0074, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580046, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00370061, -1 }, { 0x00000000, 0 }, { 0x004D0049, -3 }, { 0x006C0047, -5 },
+    { 0x00000000, 0 }, { 0x00440033, -1 }, { 0x00DF0029, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540078, -9 }, { 0x00730076, -3 }, { 0x004B0062, -2 },
+    { 0x00C7005A, -5 }, { 0x00EF006E, 1 }, { 0x0042004C, -5 }, { 0x0061004A, -4 },
+    { 0x00580034, -4 }, { 0x00770032, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00680079, -4 }, { 0x004300D8, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0056004D, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540066, -5 }, { 0x00730064, -2 },
+    { 0x00000000, 0 }, { 0x004B0050, -5 }, { 0x00C70048, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007400F0, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00680067, -2 }, { 0x00000000, 0 }, { 0x004300C6, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00440152, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700C7, -7 }, { 0x00540054, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0071006B, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490057, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00EE00EF, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00280072, -2 }, { 0x00470070, -4 }, { 0x0066006E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540042, -5 }, { 0x00000000, 0 }, { 0x002C002E, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005B0071, -4 },
+    { 0x007A006F, -3 }, { 0x00000000, 0 }, { 0x00710059, -4 }, { 0x00000000, 0 },
+    { 0x00490045, -3 }, { 0x00000000, 0 }, { 0x0038201E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00310076, -3 },
+    { 0x006F0072, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006B201D, -3 }, { 0x00540030, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450077, -3 }, { 0x00640075, -2 },
+    { 0x00000000, 0 }, { 0x201D0063, -2 }, { 0x00000000, 0 }, { 0x00520049, -3 },
+    { 0x00710047, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590078, -4 }, { 0x00780076, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0028004E, -1 },
+    { 0x0047004C, -5 }, { 0x005D0034, -1 }, { 0x0066004A, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006D0079, -2 }, { 0x004800D8, -5 }, { 0x00000000, 0 },
+    { 0x00640063, -2 }, { 0x00000000, 0 }, { 0x201D0051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00520037, -2 }, { 0x00710035, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590066, -2 },
+    { 0x00780064, -4 }, { 0x00000000, 0 }, { 0x00500050, -5 }, { 0x006F004E, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007900F0, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0069, -3 }, { 0x00000000, 0 },
+    { 0x004800C6, -5 }, { 0x00450053, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490152, -4 },
+    { 0x00000000, 0 }, { 0x004600DF, -1 }, { 0x0062006A, -3 }, { 0x00000000, 0 },
+    { 0x00590054, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00DF00EE, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0057006D, -2 }, { 0x0076006B, -2 }, { 0x00000000, 0 },
+    { 0x004E0057, -5 }, { 0x00000000, 0 }, { 0x00450041, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006B006E, -2 }, { 0x00000000, 0 }, { 0x0043005A, -5 },
+    { 0x00620058, -2 }, { 0x00000000, 0 }, { 0x00590042, -5 }, { 0x00000000, 0 },
+    { 0x0050002C, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00410073, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0054012B, 1 },
+    { 0x00760059, -2 }, { 0x004E0045, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00360076, -2 }, { 0x00550074, 1 }, { 0x00740072, -2 }, { 0x00F0006A, -3 },
+    { 0x00000000, 0 }, { 0x00430048, -5 }, { 0x00620046, -3 }, { 0x00590030, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00690075, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410061, -4 }, { 0x00000000, 0 },
+    { 0x00570049, -4 }, { 0x00760047, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005E0078, -3 },
+    { 0x007D0076, -1 }, { 0x00550062, 1 }, { 0x00F00058, -2 }, { 0x00000000, 0 },
+    { 0x004C004C, -5 }, { 0x006B004A, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x003700F0, -1 }, { 0x0034007D, -3 }, { 0x004D00D8, -5 },
+    { 0x00720079, -2 }, { 0x00690063, -2 }, { 0x00000000, 0 }, { 0x0041004F, -7 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E0021, -1 }, { 0x006A00EF, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x003F0068, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00550050, -6 },
+    { 0x0074004E, -2 }, { 0x006B0038, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00620022, 2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00530069, 1 },
+    { 0x00720067, -2 }, { 0x004D00C6, -5 }, { 0x004A0053, -6 }, { 0x00C6004B, -5 },
+    { 0x0129012B, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E0152, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0067006A, -1 },
+    { 0x00000000, 0 }, { 0x003F0056, 4 }, { 0x005E0054, -4 }, { 0x00000000, 0 },
+    { 0x00F00034, -4 }, { 0x00000000, 0 }, { 0x002D002A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00340059, -3 }, { 0x00530057, -8 }, { 0x004A0041, -6 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0070006E, -2 }, { 0x00000000, 0 },
+    { 0x0048005A, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x003F0044, 3 },
+    { 0x00000000, 0 }, { 0x0074002A, -2 }, { 0x012B00EE, 4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00460073, -5 }, { 0x00650071, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00530045, -5 }, { 0x00720043, 1 },
+    { 0x0042201E, -1 }, { 0x0061201C, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005A0074, -1 }, { 0x00790072, -3 }, { 0x201C0078, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480048, -5 }, { 0x00670046, -3 },
+    { 0x003F0032, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006E0075, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460061, -5 },
+    { 0x00000000, 0 }, { 0x007B0047, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00340035, -1 }, { 0x00720031, -3 }, { 0x00000000, 0 }, { 0x0044007A, -1 },
+    { 0x00630078, -2 }, { 0x00DF0070, -1 }, { 0x005A0062, 1 }, { 0x01520052, 1 },
+    { 0x00000000, 0 }, { 0x0051004C, -4 }, { 0x0070004A, -4 }, { 0x00670034, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0039007D, -2 },
+    { 0x005200D8, -5 }, { 0x00770079, -2 }, { 0x006E0063, -2 }, { 0x00000000, 0 },
+    { 0x0046004F, -6 }, { 0x0065004D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00630066, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005A0050, -5 }, { 0x0079004E, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00670022, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580069, 1 }, { 0x00770067, -3 }, { 0x005200C6, -5 }, { 0x004F0053, -7 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00530152, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004D006C, 1 }, { 0x006C006A, -3 }, { 0x00440056, -8 }, { 0x00630054, -9 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00390059, -2 }, { 0x00580057, -5 },
+    { 0x004F0041, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00650029, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00370072, -1 },
+    { 0x00560070, -2 }, { 0x004D005A, -5 }, { 0x006C0058, 1 }, { 0x0075006E, -2 },
+    { 0x00440044, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0042005D, -1 }, { 0x00000000, 0 }, { 0x00580045, -5 },
+    { 0x00000000, 0 }, { 0x0047201E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D0048, -5 },
+    { 0x006C0046, -2 }, { 0x00630030, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00350079, -2 }, { 0x00540077, -10 }, { 0x00730075, -2 },
+    { 0x004B0061, -2 }, { 0x00C70059, -5 }, { 0x0042004B, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00770031, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00680078, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0037004E, -1 }, { 0x0056004C, -6 },
+    { 0x006C0034, -4 }, { 0x0075004A, -4 }, { 0x00000000, 0 }, { 0x004100F0, -1 },
+    { 0x00000000, 0 }, { 0x005700D8, -7 }, { 0x00000000, 0 }, { 0x00540065, -9 },
+    { 0x00730063, -2 }, { 0x004B004F, -9 }, { 0x00C70047, -5 }, { 0x00EC012B, 1 },
+    { 0x00420039, -1 }, { 0x00610037, -4 }, { 0x007400EF, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002A006A, -2 }, { 0x00680066, -3 },
+    { 0x00210054, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004100DE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005700C6, -10 },
+    { 0x00540053, -7 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580152, -9 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00490056, -4 },
+    { 0x00680054, -9 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00EE00EE, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00280071, -3 }, { 0x0047006F, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540041, -11 }, { 0x0073003F, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005B0070, -1 }, { 0x007A006E, -2 }, { 0x0052005A, -5 }, { 0x00710058, -3 },
+    { 0x00000000, 0 }, { 0x00490044, -3 }, { 0x0038201D, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00500073, -1 },
+    { 0x006F0071, -2 }, { 0x00000000, 0 }, { 0x0047005D, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B201C, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450076, -3 },
+    { 0x00640074, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0033004A, -4 }, { 0x00520048, -5 }, { 0x00710046, -6 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590077, -2 }, { 0x00780075, -2 },
+    { 0x00000000, 0 }, { 0x00500061, -1 }, { 0x00000000, 0 }, { 0x0047004B, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004E007A, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00640062, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007A004A, -4 },
+    { 0x00000000, 0 }, { 0x00520036, -1 }, { 0x00710034, -3 }, { 0x00000000, 0 },
+    { 0x002A0022, 2 }, { 0x004600F0, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590065, -4 }, { 0x00780063, -4 }, { 0x0050004F, -5 }, { 0x006F004D, 1 },
+    { 0x00000000, 0 }, { 0x00470039, -1 }, { 0x00000000, 0 }, { 0x007900EF, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0068, -4 },
+    { 0x00000000, 0 }, { 0x00450052, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004600DE, 1 }, { 0x00620069, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590053, -9 }, { 0x00780051, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005A00DF, 1 }, { 0x0076006A, -4 }, { 0x00000000, 0 },
+    { 0x004E0056, -5 }, { 0x006D0054, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F0007B, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00430059, -5 }, { 0x00620057, -1 }, { 0x00590041, -11 }, { 0x0078003F, -1 },
+    { 0x00DE004F, 1 }, { 0x0031002D, -1 }, { 0x006F0029, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410072, -2 }, { 0x00000000, 0 }, { 0x0057005A, -7 },
+    { 0x00760058, -3 }, { 0x00000000, 0 }, { 0x004E0044, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00550073, -1 }, { 0x00740071, -3 }, { 0x00000000, 0 }, { 0x004C005D, -5 },
+    { 0x00000000, 0 }, { 0x00430047, -5 }, { 0x00620045, 1 }, { 0x0070201C, -2 },
+    { 0x0078002D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00690074, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0038004A, -4 }, { 0x00570048, -5 }, { 0x00760046, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004C004B, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00720078, -4 },
+    { 0x00000000, 0 }, { 0x00690062, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0041004E, -5 }, { 0x00000000, 0 }, { 0x00570036, -1 }, { 0x00760034, -3 },
+    { 0x00000000, 0 }, { 0x004B00F0, -2 }, { 0x006A00EE, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0055004F, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B0037, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0034006A, -3 }, { 0x00530068, 1 }, { 0x004A0052, -6 }, { 0x00720066, -2 },
+    { 0x00C6004A, -9 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00760022, 3 }, { 0x00000000, 0 }, { 0x004B00DE, 1 }, { 0x0048006B, 1 },
+    { 0x00670069, -2 }, { 0x00000000, 0 }, { 0x003F0055, 3 }, { 0x005E0053, -2 },
+    { 0x00000000, 0 }, { 0x00F00033, -3 }, { 0x00000000, 0 }, { 0x002D0029, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00340058, -1 }, { 0x00530056, -8 }, { 0x00720054, -9 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00480059, -6 }, { 0x00000000, 0 }, { 0x003F0043, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00740029, -2 }, { 0x012B00ED, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460072, -5 }, { 0x00650070, -3 },
+    { 0x00D80052, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00530044, -5 },
+    { 0x0042201D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005A0073, 1 }, { 0x00790071, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480047, -5 }, { 0x00000000, 0 },
+    { 0x0056201E, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00300078, -2 }, { 0x006E0074, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00630077, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A0061, -1 },
+    { 0x01520051, 1 }, { 0x0051004B, -4 }, { 0x201C0065, -1 }, { 0x00000000, 0 },
+    { 0x00290037, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0058007A, 1 },
+    { 0x00770078, -4 }, { 0x00000000, 0 }, { 0x004F0064, 1 }, { 0x006E0062, -3 },
+    { 0x00000000, 0 }, { 0x0046004E, -6 }, { 0x00000000, 0 }, { 0x007B0034, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005000F0, -2 }, { 0x006C007B, -2 },
+    { 0x00000000, 0 }, { 0x00440067, 1 }, { 0x00630065, -4 }, { 0x00000000, 0 },
+    { 0x005A004F, -7 }, { 0x201C0053, -1 }, { 0x00000000, 0 }, { 0x00700037, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0039006A, -3 }, { 0x00580068, 1 }, { 0x00300054, -1 },
+    { 0x004F0052, -5 }, { 0x00770066, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005000DE, 1 },
+    { 0x004D006B, 2 }, { 0x006C0069, -2 }, { 0x00000000, 0 }, { 0x00440055, -5 },
+    { 0x00630053, 1 }, { 0x201C0041, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00320029, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0061006C, -2 }, { 0x00000000, 0 }, { 0x00390058, -1 }, { 0x00580056, -5 },
+    { 0x00770054, -10 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056006F, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D0059, -6 }, { 0x006C0057, -2 },
+    { 0x00440043, -5 }, { 0x00630041, -3 }, { 0x00DF0039, -1 }, { 0x00790029, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002C0074, -1 },
+    { 0x006A0070, -1 }, { 0x0061005A, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00580044, -5 }, { 0x0047201D, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00DE00DE, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D0047, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00350078, -2 }, { 0x00540076, -10 },
+    { 0x00730074, -3 }, { 0x00C70058, -5 }, { 0x00EF006C, 1 }, { 0x0042004A, -10 },
+    { 0x00610048, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00680077, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056004B, -6 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00350066, -1 },
+    { 0x00540064, -9 }, { 0x00730062, -3 }, { 0x004B004E, -5 }, { 0x00C70046, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00390022, 2 },
+    { 0x0052007D, -3 }, { 0x0071007B, -2 }, { 0x00000000, 0 }, { 0x00680065, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560039, -1 }, { 0x00750037, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540052, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005500DE, 1 }, { 0x00710069, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00490055, -4 }, { 0x00680053, 1 }, { 0x00210041, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00280070, -1 }, { 0x0047006E, -3 }, { 0x0066006C, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005B006F, -4 }, { 0x201D0073, -2 }, { 0x00000000, 0 }, { 0x00520059, -9 },
+    { 0x00710057, -3 }, { 0x00490043, -4 }, { 0x00680041, -2 }, { 0x0038201C, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00310074, -1 }, { 0x006F0070, -3 }, { 0x0066005A, -2 }, { 0x00C600C7, -6 },
+    { 0x00CC006A, -3 }, { 0x00000000, 0 }, { 0x004C201D, -8 }, { 0x0054002E, -7 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450075, -1 },
+    { 0x00640073, -2 }, { 0x00000000, 0 }, { 0x201D0061, -3 }, { 0x00000000, 0 },
+    { 0x00520047, -7 }, { 0x00710045, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590076, -2 },
+    { 0x00780074, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0028004C, -1 }, { 0x0047004A, -10 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0079, -3 }, { 0x006D0077, -1 },
+    { 0x00000000, 0 }, { 0x00640061, -2 }, { 0x00000000, 0 }, { 0x005B004B, -1 },
+    { 0x201D004F, -1 }, { 0x00000000, 0 }, { 0x00710033, -2 }, { 0x00000000, 0 },
+    { 0x004600EF, -1 }, { 0x0062007A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590064, -4 }, { 0x00780062, -3 }, { 0x00000000, 0 }, { 0x0050004E, -6 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x005A00F0, -1 }, { 0x0076007B, -1 }, { 0x00000000, 0 }, { 0x004E0067, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450051, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x007A0037, -4 }, { 0x00000000, 0 }, { 0x00710021, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0043006A, -4 },
+    { 0x00620068, -2 }, { 0x003A0054, -2 }, { 0x00590052, -6 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005A00DE, 2 }, { 0x00760069, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004E0055, -5 }, { 0x006D0053, 1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F0007A, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B006C, -2 }, { 0x00000000, 0 },
+    { 0x00430058, -5 }, { 0x00620056, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00410071, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00570059, -5 }, { 0x00000000, 0 }, { 0x004E0043, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00360074, -1 }, { 0x00550072, -1 }, { 0x00740070, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00430046, -5 }, { 0x00620044, 1 },
+    { 0x0059002E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00690073, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00570047, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007D0074, -1 }, { 0x00000000, 0 }, { 0x0074005E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004C004A, -9 }, { 0x00000000, 0 }, { 0x00430034, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00530079, -2 },
+    { 0x00720077, -2 }, { 0x00000000, 0 }, { 0x00690061, -2 }, { 0x00000000, 0 },
+    { 0x0041004D, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00380037, -1 },
+    { 0x00760033, -4 }, { 0x00000000, 0 }, { 0x0067007A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0055004E, -6 }, { 0x00DF201D, -1 }, { 0x006B0036, -3 }, { 0x00F00044, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00530067, 1 }, { 0x00720065, -2 }, { 0x01290129, 2 }, { 0x004A0051, -3 },
+    { 0x00C60049, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00760021, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0048006A, -3 }, { 0x004200C7, -5 }, { 0x003F0054, 3 }, { 0x00670068, -2 },
+    { 0x00000000, 0 }, { 0x00F00032, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00340057, -2 }, { 0x00530055, -5 },
+    { 0x00720053, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410029, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0051006E, -1 },
+    { 0x0070006C, -2 }, { 0x00480058, -5 }, { 0x00670056, -1 }, { 0x00000000, 0 },
+    { 0x003F0042, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x012B00EC, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460071, -5 }, { 0x0065006F, -2 },
+    { 0x00000000, 0 }, { 0x00D80051, 4 }, { 0x00000000, 0 }, { 0x00530043, -5 },
+    { 0x00720041, -7 }, { 0x0042201C, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A0072, 1 }, { 0x00790070, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480046, -5 },
+    { 0x0056201D, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x006E0073, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00340033, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00440078, -2 }, { 0x00630076, -3 }, { 0x201C0064, -1 },
+    { 0x01520050, 1 }, { 0x00000000, 0 }, { 0x0051004A, -2 }, { 0x00000000, 0 },
+    { 0x00480034, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201D00F0, -4 },
+    { 0x00580079, -3 }, { 0x00770077, -2 }, { 0x00000000, 0 }, { 0x006E0061, -2 },
+    { 0x00000000, 0 }, { 0x0046004D, -6 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006C007A, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00630064, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005A004E, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00580067, -2 }, { 0x00770065, -3 }, { 0x00000000, 0 },
+    { 0x00300053, -1 }, { 0x004F0051, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004D006A, -3 }, { 0x004700C7, -5 }, { 0x00440054, -8 },
+    { 0x006C0068, -2 }, { 0x00DF004A, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0061006B, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00390057, -1 },
+    { 0x00580055, -5 }, { 0x00300041, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00370070, -1 }, { 0x0056006E, -2 }, { 0x004D0058, -5 }, { 0x006C0056, -2 },
+    { 0x0075006C, -2 }, { 0x00440042, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B0071, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00610059, -3 }, { 0x00000000, 0 },
+    { 0x00580043, -8 }, { 0x00770041, -6 }, { 0x0047201C, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004D0046, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00350077, -1 }, { 0x00540075, -10 },
+    { 0x00730073, -2 }, { 0x00C70057, -5 }, { 0x00EF006B, 1 }, { 0x00420049, -4 },
+    { 0x00610047, -3 }, { 0x006F201E, -1 }, { 0x00390033, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00680076, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0056004A, -10 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540063, -9 }, { 0x00730061, -2 }, { 0x004B004D, -5 }, { 0x00C70045, -5 },
+    { 0x00CD012B, 1 }, { 0x00420037, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0071007A, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00680064, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00560038, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00540051, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0052006A, -3 }, { 0x004C00C7, -5 },
+    { 0x00490054, -4 }, { 0x00710068, -5 }, { 0x00CE0062, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00C600D8, -5 }, { 0x0028006F, -3 }, { 0x0066006B, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00350041, -1 }, { 0x0054003F, -3 },
+    { 0x00000000, 0 }, { 0x004B0029, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005B006E, -5 }, { 0x007A006C, -2 }, { 0x00520058, -5 },
+    { 0x00710056, -3 }, { 0x201D0072, -1 }, { 0x00490042, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006F006F, -2 }, { 0x00000000, 0 }, { 0x00C600C6, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004C201C, -8 },
+    { 0x0054002D, -3 }, { 0x00C70152, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00450074, -1 }, { 0x00640072, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00520046, -5 }, { 0x00710044, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590075, -1 },
+    { 0x00780073, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0028004B, -2 }, { 0x00470049, -4 }, { 0x00660047, -2 }, { 0x0074201E, -1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0078, -4 },
+    { 0x006D0076, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00520034, -2 }, { 0x00710032, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00620079, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00590063, -4 }, { 0x00780061, -4 }, { 0x0050004D, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280039, -2 }, { 0x00470037, -2 },
+    { 0x00000000, 0 }, { 0x0076007A, -4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x004E0066, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00450050, -5 },
+    { 0x0064004E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00520022, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00620067, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x003A0053, 1 }, { 0x00590051, -6 },
+    { 0x0078004F, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0057006A, -3 },
+    { 0x005100C7, -4 }, { 0x004E0054, -5 }, { 0x00760068, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006B006B, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00430057, -5 }, { 0x00620055, 1 }, { 0x0059003F, -3 },
+    { 0x00DE004D, 1 }, { 0x00000000, 0 }, { 0x00500029, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00410070, -3 }, { 0x00000000, 0 },
+    { 0x00570058, -6 }, { 0x00760056, -1 }, { 0x00000000, 0 }, { 0x004E0042, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00360073, -1 }, { 0x0074006F, -3 }, { 0x00F00067, -1 },
+    { 0x006B0059, -5 }, { 0x00000000, 0 }, { 0x00430045, -5 }, { 0x00620043, 2 },
+    { 0x0051201C, -2 }, { 0x0059002D, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00690072, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00570046, -6 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F00055, 1 },
+    { 0x00000000, 0 }, { 0x004C0049, -3 }, { 0x006B0047, -6 }, { 0x0079201E, -4 },
+    { 0x00DE0029, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0034007A, -1 },
+    { 0x00530078, -2 }, { 0x00720076, -2 }, { 0x004A0062, 1 }, { 0x00C6005A, -5 },
+    { 0x00000000, 0 }, { 0x0041004C, -5 }, { 0x00000000, 0 }, { 0x00570034, -3 },
+    { 0x00760032, -4 }, { 0x00000000, 0 }, { 0x006A00EC, 2 }, { 0x00670079, -2 },
+    { 0x004200D8, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0055004D, -6 }, { 0x00F00043, 1 }, { 0x00DF201C, -1 }, { 0x004C0037, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007B007A, -4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00530066, -1 }, { 0x00720064, -3 }, { 0x00000000, 0 },
+    { 0x004A0050, -6 }, { 0x0069004E, -2 }, { 0x00C60048, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00670067, -2 }, { 0x00000000, 0 }, { 0x004200C6, -7 }, { 0x003F0053, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00F00031, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00430152, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005600C7, -8 }, { 0x00340056, -2 }, { 0x00530054, -8 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0051006D, -1 },
+    { 0x0070006B, -2 }, { 0x00000000, 0 }, { 0x00290059, -2 }, { 0x00480057, -6 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00460070, -5 },
+    { 0x0065006E, -2 }, { 0x00000000, 0 }, { 0x00D80050, 1 }, { 0x00000000, 0 },
+    { 0x00530042, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005A0071, -1 }, { 0x0079006F, -3 },
+    { 0x00000000, 0 }, { 0x00700059, -4 }, { 0x00000000, 0 }, { 0x00480045, -5 },
+    { 0x00670043, 1 }, { 0x0037201E, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004F0074, 1 }, { 0x006E0072, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00340032, -1 }, { 0x0072002E, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00630075, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x201C0063, -1 }, { 0x00000000, 0 }, { 0x00510049, -3 }, { 0x00700047, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00580078, 1 }, { 0x00770076, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0046004C, -6 }, { 0x0065004A, -4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x006C0079, -5 }, { 0x004700D8, -5 }, { 0x00000000, 0 }, { 0x00440065, 1 },
+    { 0x00630063, -4 }, { 0x005A004D, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00510037, -2 }, { 0x00000000, 0 }, { 0x006400EF, 2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00580066, -1 }, { 0x00770064, -3 },
+    { 0x00000000, 0 }, { 0x004F0050, -5 }, { 0x006E004E, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007800F0, -3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x004D0069, 1 }, { 0x006C0067, -3 }, { 0x004700C6, -7 },
+    { 0x00440053, -8 }, { 0x00630051, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00480152, -5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0061006A, -3 }, { 0x00000000, 0 }, { 0x00390056, -1 },
+    { 0x00580054, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0056006D, -2 }, { 0x0075006B, -2 }, { 0x00000000, 0 }, { 0x002E0059, -1 },
+    { 0x004D0057, -6 }, { 0x00440041, -7 }, { 0x00DF0037, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0042005A, -5 }, { 0x00610058, 1 },
+    { 0x00000000, 0 }, { 0x00580042, -5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00750059, -2 }, { 0x00000000, 0 },
+    { 0x002E0047, -1 }, { 0x004D0045, -5 }, { 0x00000000, 0 }, { 0x0063002D, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00350076, -2 },
+    { 0x00540074, -8 }, { 0x00730072, -2 }, { 0x00C70056, -5 }, { 0x00EF006A, -2 },
+    { 0x00420048, -5 }, { 0x00610046, -2 }, { 0x00580030, -2 }, { 0x006F201D, -1 },
+    { 0x0077002E, -1 }, { 0x00000000, 0 }, { 0x00680075, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0037004B, -1 },
+    { 0x00560049, -4 }, { 0x00750047, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00540062, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004B004C, -5 },
+    { 0x00C70044, -5 }, { 0x00610034, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0033007D, -1 }, { 0x004C00D8, -5 }, { 0x00710079, -3 },
+    { 0x00680063, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x006900EF, 1 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00540050, -6 }, { 0x0073004E, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00610022, 2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00710067, -3 }, { 0x0128012B, 1 },
+    { 0x004C00C6, -5 }, { 0x00490053, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004D0152, -5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0028006E, -2 }, { 0x0047006C, -3 },
+    { 0x0066006A, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x005B006D, -5 }, { 0x007A006B, -2 }, { 0x201D0071, -2 },
+    { 0x00330059, -1 }, { 0x00520057, -8 }, { 0x00490041, -3 }, { 0x00710055, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00500070, -1 }, { 0x006F006E, -2 }, { 0x0047005A, -6 },
+    { 0x01290062, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0054002C, -8 }, { 0x0073002A, -1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00640071, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x007A0059, -2 },
+    { 0x00000000, 0 }, { 0x00520045, -5 }, { 0x00710043, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00590074, -2 }, { 0x00780072, -2 }, { 0x0050005E, -1 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x0028004A, -1 }, { 0x00470048, -5 }, { 0x00660046, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x004E0077, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x007A0047, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00710031, -2 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00620078, -5 },
+    { 0x00DE0070, -1 }, { 0x00590062, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x0050004C, -5 }, { 0x006F004A, -4 }, { 0x00280038, -3 }, { 0x00660034, -3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0038007D, -2 }, { 0x005100D8, -3 },
+    { 0x00760079, -2 }, { 0x004E0065, -3 }, { 0x00000000, 0 }, { 0x0045004F, -7 },
+    { 0x0064004D, 1 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00620066, -3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00590050, -6 },
+    { 0x0078004E, -2 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00660022, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00760067, -4 },
+    { 0x00000000, 0 }, { 0x005100C6, -5 }, { 0x004E0053, -6 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00520152, -7 }, { 0x00F00078, -1 }, { 0x00000000, 0 }, { 0x006B006A, -3 },
+    { 0x00000000, 0 }, { 0x00430056, -5 }, { 0x00620054, -9 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0031002A, -2 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x0041006F, -4 }, { 0x00000000, 0 },
+};
+
 static const EpdFontData opendyslexic_12_italic = {
     opendyslexic_12_italicBitmaps,
     opendyslexic_12_italicGlyphs,
@@ -4775,4 +6839,8 @@ static const EpdFontData opendyslexic_12_italic = {
     33,
     -13,
     true,
+    nullptr,
+    &opendyslexic_12_italicMetrics,
+    opendyslexic_12_italicKernPairs,
+    8192,
 };
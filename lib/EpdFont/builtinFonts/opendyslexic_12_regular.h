@@ -3,7 +3,7 @@
  * name: opendyslexic_12_regular
  * size: 12
  * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_12_regular 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit
+ * Command used: fontconvert.py opendyslexic_12_regular 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit --kern-manifest font-manifest.txt
  */
 #pragma once
 #include "EpdFontData.h"
@@ -4161,6 +4161,54 @@ static const EpdUnicodeInterval opendyslexic_12_regularIntervals[] = {
     { 0x2264, 0x2265, 0x2D3 },
 };
 
+static const EpdFontMetrics opendyslexic_12_regularMetrics = {
+    20, 121, 21,
+    -6, 33, 34, -13,
+    {
+        21, 8, 14, 28, 30, 25, 24, 7, 11, 11, 16, 16, 8, 15, 7, 15,
+        17, 15, 16, 16, 17, 16, 17, 16, 17, 17, 7, 8, 20, 15, 20, 14,
+        30, 28, 24, 25, 27, 23, 21, 29, 27, 11, 19, 26, 23, 31, 27, 29,
+        23, 25, 24, 28, 27, 26, 29, 36, 28, 27, 28, 12, 12, 12, 14, 20,
+        10, 21, 21, 19, 21, 21, 16, 20, 21, 11, 16, 20, 14, 29, 20, 21,
+        20, 24, 16, 19, 18, 20, 23, 26, 22, 21, 20, 14, 6, 14, 12,
+    },
+};
+
+static const EpdKernPair opendyslexic_12_regularKernPairs[128] = {
+    { 0x20100020, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250020, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180020, 4 },
+    { 0x00000000, 0 }, { 0x003A0020, 4 }, { 0x203A0020, 4 }, { 0x005C0020, 4 },
+    { 0x002D0020, 4 }, { 0x00AD0020, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20130020, 4 }, { 0x00000000, 0 },
+    { 0x20350020, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280020, 4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0020, 4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005F0020, 4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00230020, 4 }, { 0x20230020, 4 },
+    { 0x00000000, 0 }, { 0x20160020, 4 }, { 0x00000000, 0 }, { 0x20380020, 4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00AB0020, 4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0020, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20110020, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260020, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190020, 4 }, { 0x00000000, 0 }, { 0x003B0020, 4 }, { 0x00BB0020, 4 },
+    { 0x005D0020, 4 }, { 0x002E0020, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00210020, 4 }, { 0x00A10020, 4 }, { 0x00000000, 0 }, { 0x20140020, 4 },
+    { 0x00000000, 0 }, { 0x20360020, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00290020, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0020, 4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20240020, 4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20170020, 4 }, { 0x00000000, 0 },
+    { 0x20390020, 4 }, { 0x00000000, 0 }, { 0x005B0020, 4 }, { 0x002C0020, 4 },
+    { 0x007D0020, 4 }, { 0x00000000, 0 }, { 0x201F0020, 4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20120020, 4 }, { 0x00000000, 0 }, { 0x20340020, 4 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00270020, 4 }, { 0x20270020, 4 },
+    { 0x00000000, 0 }, { 0x201A0020, 4 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0020, 4 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00220020, 4 }, { 0x20220020, 4 }, { 0x00000000, 0 },
+    { 0x20150020, 4 }, { 0x00000000, 0 }, { 0x00B70020, 4 }, { 0x20370020, 4 },
+    { 0x00000000, 0 }, { 0x002A0020, 4 }, { 0x007B0020, 4 }, { 0x00000000, 0 },
+    { 0x201D0020, 4 }, { 0x00000000, 0 }, { 0x003F0020, 4 }, { 0x00BF0020, 4 },
+};
+
 static const EpdFontData opendyslexic_12_regular = {
     opendyslexic_12_regularBitmaps,
     opendyslexic_12_regularGlyphs,
@@ -4170,4 +4218,8 @@ static const EpdFontData opendyslexic_12_regular = {
     33,
     -13,
     true,
+    nullptr,
+    &opendyslexic_12_regularMetrics,
+    opendyslexic_12_regularKernPairs,
+    128,
 };
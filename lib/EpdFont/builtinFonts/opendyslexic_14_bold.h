@@ -3,7 +3,7 @@
  * name: opendyslexic_14_bold
  * size: 14
  * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_14_bold 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit
+ * Command used: fontconvert.py opendyslexic_14_bold 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit --kern-manifest font-manifest.txt
  */
 #pragma once
 #include "EpdFontData.h"
@@ -6037,6 +6037,54 @@ static const EpdUnicodeInterval opendyslexic_14_boldIntervals[] = {
     { 0x2264, 0x2265, 0x2D3 },
 };
 
+static const EpdFontMetrics opendyslexic_14_boldMetrics = {
+    24, 136, 25,
+    -8, 41, 43, -16,
+    {
+        25, 10, 21, 30, 34, 32, 27, 10, 14, 13, 19, 18, 9, 16, 8, 20,
+        21, 19, 21, 21, 22, 20, 21, 20, 22, 21, 8, 10, 23, 18, 23, 19,
+        30, 28, 28, 29, 31, 27, 25, 34, 31, 16, 26, 31, 26, 34, 30, 33,
+        27, 31, 28, 31, 31, 30, 33, 42, 33, 31, 32, 14, 14, 14, 16, 20,
+        13, 25, 25, 23, 26, 25, 20, 25, 26, 14, 18, 26, 17, 36, 25, 25,
+        27, 28, 21, 25, 23, 25, 29, 32, 29, 27, 26, 16, 11, 16, 14,
+    },
+};
+
+static const EpdKernPair opendyslexic_14_boldKernPairs[128] = {
+    { 0x20100020, 5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250020, 5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180020, 5 },
+    { 0x00000000, 0 }, { 0x003A0020, 5 }, { 0x203A0020, 5 }, { 0x005C0020, 5 },
+    { 0x002D0020, 5 }, { 0x00AD0020, 5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20130020, 5 }, { 0x00000000, 0 },
+    { 0x20350020, 5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280020, 5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0020, 5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005F0020, 5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00230020, 5 }, { 0x20230020, 5 },
+    { 0x00000000, 0 }, { 0x20160020, 5 }, { 0x00000000, 0 }, { 0x20380020, 5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00AB0020, 5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0020, 5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20110020, 5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260020, 5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190020, 5 }, { 0x00000000, 0 }, { 0x003B0020, 5 }, { 0x00BB0020, 5 },
+    { 0x005D0020, 5 }, { 0x002E0020, 5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00210020, 5 }, { 0x00A10020, 5 }, { 0x00000000, 0 }, { 0x20140020, 5 },
+    { 0x00000000, 0 }, { 0x20360020, 5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00290020, 5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0020, 5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20240020, 5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20170020, 5 }, { 0x00000000, 0 },
+    { 0x20390020, 5 }, { 0x00000000, 0 }, { 0x005B0020, 5 }, { 0x002C0020, 5 },
+    { 0x007D0020, 5 }, { 0x00000000, 0 }, { 0x201F0020, 5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20120020, 5 }, { 0x00000000, 0 }, { 0x20340020, 5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00270020, 5 }, { 0x20270020, 5 },
+    { 0x00000000, 0 }, { 0x201A0020, 5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0020, 5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00220020, 5 }, { 0x20220020, 5 }, { 0x00000000, 0 },
+    { 0x20150020, 5 }, { 0x00000000, 0 }, { 0x00B70020, 5 }, { 0x20370020, 5 },
+    { 0x00000000, 0 }, { 0x002A0020, 5 }, { 0x007B0020, 5 }, { 0x00000000, 0 },
+    { 0x201D0020, 5 }, { 0x00000000, 0 }, { 0x003F0020, 5 }, { 0x00BF0020, 5 },
+};
+
 static const EpdFontData opendyslexic_14_bold = {
     opendyslexic_14_boldBitmaps,
     opendyslexic_14_boldGlyphs,
@@ -6046,4 +6094,8 @@ static const EpdFontData opendyslexic_14_bold = {
     38,
     -16,
     true,
+    nullptr,
+    &opendyslexic_14_boldMetrics,
+    opendyslexic_14_boldKernPairs,
+    128,
 };
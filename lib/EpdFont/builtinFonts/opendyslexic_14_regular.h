@@ -3,7 +3,7 @@
  * name: opendyslexic_14_regular
  * size: 14
  * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_14_regular 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit
+ * Command used: fontconvert.py opendyslexic_14_regular 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit --kern-manifest font-manifest.txt
  */
 #pragma once
 #include "EpdFontData.h"
@@ -5235,6 +5235,54 @@ static const EpdUnicodeInterval opendyslexic_14_regularIntervals[] = {
     { 0x2264, 0x2265, 0x2D3 },
 };
 
+static const EpdFontMetrics opendyslexic_14_regularMetrics = {
+    23, 141, 25,
+    -7, 38, 40, -15,
+    {
+        25, 10, 16, 33, 35, 29, 28, 8, 13, 13, 19, 18, 9, 18, 8, 17,
+        19, 17, 19, 19, 19, 18, 19, 18, 20, 19, 8, 9, 23, 18, 23, 17,
+        35, 33, 28, 29, 32, 27, 25, 33, 31, 13, 22, 30, 27, 36, 31, 33,
+        27, 30, 28, 33, 31, 31, 34, 42, 33, 31, 33, 14, 14, 14, 16, 23,
+        12, 24, 25, 22, 25, 24, 18, 23, 24, 13, 19, 24, 16, 34, 24, 24,
+        24, 28, 19, 23, 21, 23, 26, 30, 26, 24, 24, 16, 7, 16, 14,
+    },
+};
+
+static const EpdKernPair opendyslexic_14_regularKernPairs[128] = {
+    { 0x20100020, 5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250020, 5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180020, 5 },
+    { 0x00000000, 0 }, { 0x003A0020, 5 }, { 0x203A0020, 5 }, { 0x005C0020, 5 },
+    { 0x002D0020, 5 }, { 0x00AD0020, 5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20130020, 5 }, { 0x00000000, 0 },
+    { 0x20350020, 5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280020, 5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0020, 5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005F0020, 5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00230020, 5 }, { 0x20230020, 5 },
+    { 0x00000000, 0 }, { 0x20160020, 5 }, { 0x00000000, 0 }, { 0x20380020, 5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00AB0020, 5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0020, 5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20110020, 5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260020, 5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190020, 5 }, { 0x00000000, 0 }, { 0x003B0020, 5 }, { 0x00BB0020, 5 },
+    { 0x005D0020, 5 }, { 0x002E0020, 5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00210020, 5 }, { 0x00A10020, 5 }, { 0x00000000, 0 }, { 0x20140020, 5 },
+    { 0x00000000, 0 }, { 0x20360020, 5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00290020, 5 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0020, 5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20240020, 5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20170020, 5 }, { 0x00000000, 0 },
+    { 0x20390020, 5 }, { 0x00000000, 0 }, { 0x005B0020, 5 }, { 0x002C0020, 5 },
+    { 0x007D0020, 5 }, { 0x00000000, 0 }, { 0x201F0020, 5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20120020, 5 }, { 0x00000000, 0 }, { 0x20340020, 5 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00270020, 5 }, { 0x20270020, 5 },
+    { 0x00000000, 0 }, { 0x201A0020, 5 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0020, 5 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00220020, 5 }, { 0x20220020, 5 }, { 0x00000000, 0 },
+    { 0x20150020, 5 }, { 0x00000000, 0 }, { 0x00B70020, 5 }, { 0x20370020, 5 },
+    { 0x00000000, 0 }, { 0x002A0020, 5 }, { 0x007B0020, 5 }, { 0x00000000, 0 },
+    { 0x201D0020, 5 }, { 0x00000000, 0 }, { 0x003F0020, 5 }, { 0x00BF0020, 5 },
+};
+
 static const EpdFontData opendyslexic_14_regular = {
     opendyslexic_14_regularBitmaps,
     opendyslexic_14_regularGlyphs,
@@ -5244,4 +5292,8 @@ static const EpdFontData opendyslexic_14_regular = {
     38,
     -16,
     true,
+    nullptr,
+    &opendyslexic_14_regularMetrics,
+    opendyslexic_14_regularKernPairs,
+    128,
 };
@@ -3,7 +3,7 @@
  * name: opendyslexic_8_bold
  * size: 8
  * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_8_bold 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit
+ * Command used: fontconvert.py opendyslexic_8_bold 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit --kern-manifest font-manifest.txt
  */
 #pragma once
 #include "EpdFontData.h"
@@ -2579,6 +2579,54 @@ static const EpdUnicodeInterval opendyslexic_8_boldIntervals[] = {
     { 0x2264, 0x2265, 0x2D3 },
 };
 
+static const EpdFontMetrics opendyslexic_8_boldMetrics = {
+    14, 78, 14,
+    -5, 24, 25, -9,
+    {
+        14, 6, 12, 17, 19, 18, 16, 6, 8, 7, 11, 10, 5, 9, 4, 11,
+        12, 11, 12, 12, 12, 12, 12, 12, 12, 12, 5, 6, 13, 10, 13, 11,
+        17, 16, 16, 17, 18, 15, 14, 19, 18, 9, 15, 18, 15, 19, 17, 19,
+        15, 18, 16, 18, 18, 17, 19, 24, 19, 18, 18, 8, 8, 8, 9, 11,
+        7, 14, 15, 13, 15, 14, 11, 14, 15, 8, 10, 15, 10, 20, 15, 14,
+        16, 16, 12, 14, 13, 14, 16, 19, 16, 15, 15, 9, 7, 9, 8,
+    },
+};
+
+static const EpdKernPair opendyslexic_8_boldKernPairs[128] = {
+    { 0x20100020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180020, 3 },
+    { 0x00000000, 0 }, { 0x003A0020, 3 }, { 0x203A0020, 3 }, { 0x005C0020, 3 },
+    { 0x002D0020, 3 }, { 0x00AD0020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20130020, 3 }, { 0x00000000, 0 },
+    { 0x20350020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280020, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0020, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005F0020, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00230020, 3 }, { 0x20230020, 3 },
+    { 0x00000000, 0 }, { 0x20160020, 3 }, { 0x00000000, 0 }, { 0x20380020, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00AB0020, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20110020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190020, 3 }, { 0x00000000, 0 }, { 0x003B0020, 3 }, { 0x00BB0020, 3 },
+    { 0x005D0020, 3 }, { 0x002E0020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00210020, 3 }, { 0x00A10020, 3 }, { 0x00000000, 0 }, { 0x20140020, 3 },
+    { 0x00000000, 0 }, { 0x20360020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00290020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0020, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20240020, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20170020, 3 }, { 0x00000000, 0 },
+    { 0x20390020, 3 }, { 0x00000000, 0 }, { 0x005B0020, 3 }, { 0x002C0020, 3 },
+    { 0x007D0020, 3 }, { 0x00000000, 0 }, { 0x201F0020, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20120020, 3 }, { 0x00000000, 0 }, { 0x20340020, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00270020, 3 }, { 0x20270020, 3 },
+    { 0x00000000, 0 }, { 0x201A0020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0020, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00220020, 3 }, { 0x20220020, 3 }, { 0x00000000, 0 },
+    { 0x20150020, 3 }, { 0x00000000, 0 }, { 0x00B70020, 3 }, { 0x20370020, 3 },
+    { 0x00000000, 0 }, { 0x002A0020, 3 }, { 0x007B0020, 3 }, { 0x00000000, 0 },
+    { 0x201D0020, 3 }, { 0x00000000, 0 }, { 0x003F0020, 3 }, { 0x00BF0020, 3 },
+};
+
 static const EpdFontData opendyslexic_8_bold = {
     opendyslexic_8_boldBitmaps,
     opendyslexic_8_boldGlyphs,
@@ -2588,4 +2636,8 @@ static const EpdFontData opendyslexic_8_bold = {
     22,
     -9,
     true,
+    nullptr,
+    &opendyslexic_8_boldMetrics,
+    opendyslexic_8_boldKernPairs,
+    128,
 };
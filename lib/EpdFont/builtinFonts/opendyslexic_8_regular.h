@@ -3,7 +3,7 @@
  * name: opendyslexic_8_regular
  * size: 8
  * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_8_regular 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit
+ * Command used: fontconvert.py opendyslexic_8_regular 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit --kern-manifest font-manifest.txt
  */
 #pragma once
 #include "EpdFontData.h"
@@ -2360,6 +2360,54 @@ static const EpdUnicodeInterval opendyslexic_8_regularIntervals[] = {
     { 0x2264, 0x2265, 0x2D3 },
 };
 
+static const EpdFontMetrics opendyslexic_8_regularMetrics = {
+    13, 80, 14,
+    -4, 22, 23, -9,
+    {
+        14, 6, 9, 19, 20, 17, 16, 5, 7, 7, 11, 10, 5, 10, 4, 10,
+        11, 10, 11, 11, 11, 11, 11, 10, 11, 11, 5, 5, 13, 10, 13, 10,
+        20, 19, 16, 17, 18, 15, 14, 19, 18, 8, 13, 17, 15, 21, 18, 19,
+        15, 17, 16, 19, 18, 18, 19, 24, 19, 18, 19, 8, 8, 8, 9, 13,
+        7, 14, 14, 12, 14, 14, 11, 13, 14, 8, 11, 14, 9, 20, 14, 14,
+        14, 16, 11, 13, 12, 13, 15, 17, 15, 14, 14, 9, 4, 9, 8,
+    },
+};
+
+static const EpdKernPair opendyslexic_8_regularKernPairs[128] = {
+    { 0x20100020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20250020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20180020, 3 },
+    { 0x00000000, 0 }, { 0x003A0020, 3 }, { 0x203A0020, 3 }, { 0x005C0020, 3 },
+    { 0x002D0020, 3 }, { 0x00AD0020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20130020, 3 }, { 0x00000000, 0 },
+    { 0x20350020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00280020, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201B0020, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x005F0020, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00230020, 3 }, { 0x20230020, 3 },
+    { 0x00000000, 0 }, { 0x20160020, 3 }, { 0x00000000, 0 }, { 0x20380020, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00AB0020, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x201E0020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20110020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20260020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x20190020, 3 }, { 0x00000000, 0 }, { 0x003B0020, 3 }, { 0x00BB0020, 3 },
+    { 0x005D0020, 3 }, { 0x002E0020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00210020, 3 }, { 0x00A10020, 3 }, { 0x00000000, 0 }, { 0x20140020, 3 },
+    { 0x00000000, 0 }, { 0x20360020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00290020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x201C0020, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20240020, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x20170020, 3 }, { 0x00000000, 0 },
+    { 0x20390020, 3 }, { 0x00000000, 0 }, { 0x005B0020, 3 }, { 0x002C0020, 3 },
+    { 0x007D0020, 3 }, { 0x00000000, 0 }, { 0x201F0020, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x20120020, 3 }, { 0x00000000, 0 }, { 0x20340020, 3 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x00270020, 3 }, { 0x20270020, 3 },
+    { 0x00000000, 0 }, { 0x201A0020, 3 }, { 0x00000000, 0 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00000000, 0 }, { 0x002F0020, 3 }, { 0x00000000, 0 },
+    { 0x00000000, 0 }, { 0x00220020, 3 }, { 0x20220020, 3 }, { 0x00000000, 0 },
+    { 0x20150020, 3 }, { 0x00000000, 0 }, { 0x00B70020, 3 }, { 0x20370020, 3 },
+    { 0x00000000, 0 }, { 0x002A0020, 3 }, { 0x007B0020, 3 }, { 0x00000000, 0 },
+    { 0x201D0020, 3 }, { 0x00000000, 0 }, { 0x003F0020, 3 }, { 0x00BF0020, 3 },
+};
+
 static const EpdFontData opendyslexic_8_regular = {
     opendyslexic_8_regularBitmaps,
     opendyslexic_8_regularGlyphs,
@@ -2369,4 +2417,8 @@ static const EpdFontData opendyslexic_8_regular = {
     22,
     -9,
     true,
+    nullptr,
+    &opendyslexic_8_regularMetrics,
+    opendyslexic_8_regularKernPairs,
+    128,
 };
@@ -2,880 +2,1116 @@
  * generated by fontconvert.py
  * name: ubuntu_10_bold
  * size: 10
- * mode: 1-bit
- * Command used: fontconvert.py ubuntu_10_bold 10 ../builtinFonts/source/Ubuntu/Ubuntu-Bold.ttf
+ * mode: 1-bit, row-aligned
+ * Command used: fontconvert.py ubuntu_10_bold 10 ../builtinFonts/source/Ubuntu/Ubuntu-Bold.ttf --row-aligned --no-kerning
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t ubuntu_10_boldBitmaps[13863] = {
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0xEF, 0xEF, 0xE7, 0xE7, 0x1E, 0xF0,
-    0xF7, 0x87, 0x3C, 0x39, 0xCF, 0xFF, 0xFF, 0xFC, 0xF7, 0x87, 0x3C, 0x39, 0xC7, 0xFF, 0xFF, 0xFE,
-    0xF7, 0x87, 0xBC, 0x39, 0xE1, 0xCE, 0x00, 0x0F, 0x01, 0xE0, 0x7F, 0x9F, 0xF7, 0xFC, 0xF3, 0x9E,
-    0x03, 0xF8, 0x3F, 0xC3, 0xFC, 0x1F, 0x80, 0xF7, 0x1E, 0xFF, 0xDF, 0xFB, 0xFC, 0x0F, 0x01, 0xE0,
-    0x3C, 0x00, 0x3E, 0x0E, 0x0F, 0xE3, 0xC1, 0xDC, 0xF0, 0x7B, 0xDE, 0x0F, 0x7F, 0x80, 0xEE, 0xF0,
-    0x1F, 0xFC, 0x01, 0xF7, 0x7C, 0x01, 0xFF, 0xC0, 0x3B, 0xBC, 0x0F, 0x73, 0x81, 0xCE, 0x70, 0x79,
-    0xDE, 0x1E, 0x3F, 0x83, 0xC3, 0xE0, 0x1F, 0x80, 0x7F, 0x80, 0xFF, 0x81, 0xEF, 0x03, 0xDE, 0x07,
-    0xF8, 0x07, 0xE0, 0x1F, 0xDE, 0x7F, 0xBC, 0xE7, 0xF3, 0xC7, 0xE7, 0xC7, 0xC7, 0xFF, 0x8F, 0xFF,
-    0x8F, 0xF7, 0x80, 0xFF, 0xEE, 0xEE, 0x1C, 0x3C, 0xF1, 0xE7, 0x8F, 0x1C, 0x78, 0xF1, 0xE3, 0xC7,
-    0x8F, 0x0E, 0x1E, 0x3C, 0x3C, 0x78, 0x78, 0xE0, 0x63, 0xCF, 0x1E, 0x78, 0xF3, 0xCF, 0x3C, 0x71,
-    0xCF, 0x3C, 0xF3, 0xDE, 0x7B, 0xCF, 0x18, 0x0E, 0x03, 0x87, 0xF9, 0xFF, 0x7F, 0xCF, 0xC3, 0xF8,
-    0x6C, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0xFF, 0xFF, 0xFF, 0xFC, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x7B,
-    0xDE, 0xEF, 0x78, 0xFF, 0xFF, 0xF8, 0x77, 0xFE, 0xE0, 0x01, 0xE0, 0x3C, 0x0F, 0x01, 0xE0, 0x3C,
-    0x0F, 0x01, 0xE0, 0x38, 0x0F, 0x01, 0xE0, 0x78, 0x0F, 0x01, 0xE0, 0x78, 0x0F, 0x01, 0xE0, 0x78,
-    0x0F, 0x01, 0xE0, 0x78, 0x00, 0x1F, 0x83, 0xFC, 0x7F, 0xE7, 0xBE, 0x79, 0xEF, 0x1E, 0xF0, 0xFF,
-    0x0F, 0xF0, 0xFF, 0x1E, 0x79, 0xE7, 0xBE, 0x7F, 0xE3, 0xFC, 0x1F, 0x80, 0x0F, 0x1F, 0x3F, 0x7F,
-    0xFF, 0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x3F, 0x8F, 0xF9, 0xFF, 0xBD,
-    0xF2, 0x1E, 0x03, 0x80, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x07, 0xFE, 0xFF, 0xDF, 0xF8,
-    0x3F, 0x8F, 0xF9, 0xFF, 0x39, 0xE0, 0x3C, 0x0F, 0x87, 0xE0, 0xFE, 0x03, 0xE0, 0x3C, 0x07, 0xB1,
-    0xF7, 0xFD, 0xFF, 0x9F, 0xE0, 0x03, 0xC0, 0x7C, 0x0F, 0xC0, 0xFC, 0x1F, 0xC3, 0xFC, 0x3B, 0xC7,
-    0xBC, 0xF3, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3F, 0xE7, 0xFC, 0xFF,
-    0x9C, 0x03, 0x80, 0x7E, 0x1F, 0xF3, 0xFE, 0x0F, 0xE0, 0x3C, 0x07, 0xB1, 0xF7, 0xFC, 0xFF, 0x9F,
-    0xE0, 0x03, 0xC0, 0xFE, 0x1F, 0xE3, 0xF8, 0x78, 0x07, 0xF8, 0x7F, 0xE7, 0xFE, 0xF9, 0xEF, 0x0F,
-    0x78, 0xE7, 0xDE, 0x7F, 0xE3, 0xFC, 0x1F, 0x80, 0x7F, 0xE7, 0xFE, 0x7F, 0xE0, 0x3E, 0x03, 0xC0,
-    0x78, 0x07, 0x80, 0x70, 0x0F, 0x00, 0xF0, 0x0E, 0x01, 0xE0, 0x1E, 0x01, 0xE0, 0x1E, 0x00, 0x1F,
-    0x83, 0xFC, 0x7F, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x7F, 0xC3, 0xFC, 0x3F, 0xE7, 0xBE, 0x70, 0xE7,
-    0x9E, 0x7F, 0xE7, 0xFE, 0x3F, 0x80, 0x1F, 0x83, 0xFC, 0x7F, 0xEF, 0xBE, 0xF1, 0xEF, 0x1E, 0xF9,
-    0xE7, 0xFE, 0x7F, 0xE3, 0xFE, 0x01, 0xE0, 0xFC, 0x7F, 0xC7, 0xF0, 0x7E, 0x00, 0x77, 0xFE, 0xE0,
-    0x00, 0x0E, 0xFF, 0xDC, 0x77, 0xFE, 0xE0, 0x00, 0x00, 0x7B, 0xDE, 0xEF, 0x78, 0x01, 0xC3, 0xF3,
-    0xFF, 0xFE, 0xFE, 0x3C, 0x0F, 0xE3, 0xFE, 0x3F, 0xC3, 0xF0, 0x1C, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0x0F, 0xF1, 0xFF, 0x1F, 0xC1, 0xF1, 0xFD, 0xFF, 0xFF,
-    0x3F, 0x0E, 0x00, 0x7F, 0x3F, 0xEF, 0xF9, 0x9E, 0x07, 0x81, 0xE0, 0xF8, 0x7C, 0x1E, 0x0F, 0x03,
-    0xC0, 0x00, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x07, 0xFC, 0x03, 0xFF, 0xE0, 0xFC, 0x7E, 0x3E, 0x03,
-    0xE7, 0x3F, 0xDD, 0xEF, 0xFB, 0xB9, 0xEF, 0x7F, 0x79, 0xE7, 0xEF, 0x3C, 0xFD, 0xE7, 0xBF, 0xBC,
-    0xF7, 0x73, 0xDE, 0xEF, 0x7F, 0xF8, 0xE7, 0xFE, 0x1E, 0x00, 0x01, 0xF8, 0xC0, 0x1F, 0xFC, 0x00,
-    0xFF, 0x80, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x80, 0x7F, 0x00, 0xFE, 0x03, 0xDE, 0x07, 0xBC, 0x0E,
-    0x3C, 0x3C, 0x78, 0x7F, 0xF1, 0xFF, 0xF3, 0xFF, 0xE7, 0x83, 0xDE, 0x03, 0xFC, 0x07, 0x80, 0xFF,
-    0xC7, 0xFF, 0x3F, 0xFD, 0xE3, 0xEF, 0x1F, 0x7F, 0xF3, 0xFF, 0x9F, 0xFE, 0xF1, 0xF7, 0x87, 0xBC,
-    0x3D, 0xE3, 0xEF, 0xFF, 0x7F, 0xF3, 0xFF, 0x00, 0x0F, 0xF1, 0xFF, 0x9F, 0xFC, 0xFD, 0xEF, 0x80,
-    0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3E, 0x01, 0xF8, 0xE7, 0xFF, 0x1F, 0xF8, 0x7F,
-    0xC0, 0xFF, 0xC3, 0xFF, 0x8F, 0xFF, 0x3C, 0x7E, 0xF0, 0x7B, 0xC1, 0xFF, 0x03, 0xFC, 0x0F, 0xF0,
-    0x3F, 0xC1, 0xFF, 0x07, 0xBC, 0x7E, 0xFF, 0xF3, 0xFF, 0x8F, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x0F, 0x01, 0xE0, 0x3F, 0xF7, 0xFE, 0xFF, 0xDE, 0x03, 0xC0, 0x78, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0x01, 0xE0, 0x3F, 0xF7, 0xFE, 0xFF, 0xDE, 0x03, 0xC0,
-    0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x00, 0x0F, 0xF1, 0xFF, 0x9F, 0xFC, 0xFC, 0xEF, 0x80, 0x78, 0x03,
-    0xC0, 0x1E, 0x0F, 0xF0, 0x7F, 0x83, 0xFE, 0x1E, 0xF8, 0xF7, 0xFF, 0x9F, 0xFC, 0x7F, 0xC0, 0xF0,
-    0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFC,
-    0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3D, 0x9F, 0xFF,
-    0xFF, 0xE7, 0xF0, 0xF0, 0xFB, 0xC7, 0xCF, 0x3E, 0x3D, 0xF0, 0xFF, 0x83, 0xFC, 0x0F, 0xE0, 0x3F,
-    0xC0, 0xFF, 0x83, 0xDF, 0x0F, 0x3C, 0x3C, 0xF8, 0xF1, 0xF3, 0xC3, 0xCF, 0x0F, 0x80, 0xF0, 0x1E,
-    0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x78, 0x0F, 0x3E, 0x0F, 0x9F, 0x07, 0xCF, 0xC7, 0xE7, 0xE3, 0xF7, 0xF1, 0xFB,
-    0xFD, 0xFD, 0xEE, 0xEF, 0xF7, 0xF7, 0xFB, 0xF3, 0xFC, 0xF9, 0xFE, 0x7C, 0xFF, 0x1C, 0x7F, 0x80,
-    0x3F, 0xC0, 0x1E, 0xF0, 0x3F, 0xE0, 0xFF, 0xC3, 0xFF, 0x8F, 0xFE, 0x3F, 0xFC, 0xFF, 0x7B, 0xFD,
-    0xEF, 0xF3, 0xFF, 0xC7, 0xFF, 0x1F, 0xFC, 0x3F, 0xF0, 0x7F, 0xC1, 0xFF, 0x03, 0xC0, 0x0F, 0xE0,
-    0x7F, 0xE1, 0xFF, 0xE3, 0xE7, 0xEF, 0x83, 0xDE, 0x07, 0xFC, 0x07, 0xF8, 0x0F, 0xF0, 0x1F, 0xE0,
-    0x7F, 0xE0, 0xF3, 0xE7, 0xE7, 0xFF, 0x87, 0xFF, 0x03, 0xF8, 0x00, 0xFF, 0xCF, 0xFE, 0xFF, 0xFF,
-    0x1F, 0xF0, 0xFF, 0x0F, 0xF3, 0xFF, 0xFF, 0xFF, 0xEF, 0xFC, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00,
-    0xF0, 0x00, 0x0F, 0xE0, 0x7F, 0xE1, 0xFF, 0xE3, 0xE7, 0xEF, 0x83, 0xDE, 0x07, 0xFC, 0x07, 0xF8,
-    0x0F, 0xF0, 0x1F, 0xE0, 0x7F, 0xE0, 0xF3, 0xE7, 0xE7, 0xFF, 0x87, 0xFF, 0x07, 0xF8, 0x01, 0xF8,
-    0x01, 0xFC, 0x01, 0xF0, 0xFF, 0x87, 0xFF, 0x3F, 0xF9, 0xE7, 0xEF, 0x0F, 0x78, 0x7B, 0xCF, 0xDF,
-    0xFE, 0xFF, 0xE7, 0xFE, 0x3C, 0xF1, 0xE7, 0xCF, 0x1F, 0x78, 0x7B, 0xC3, 0xE0, 0x1F, 0xC3, 0xFE,
-    0x7F, 0xE7, 0xCC, 0x78, 0x07, 0xC0, 0x7F, 0x83, 0xFC, 0x0F, 0xE0, 0x1F, 0x00, 0xF7, 0x1F, 0x7F,
-    0xE7, 0xFE, 0x7F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01,
-    0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x00, 0xF0, 0x7F, 0x83,
-    0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x3F, 0xFB,
-    0xE7, 0xFF, 0x1F, 0xF0, 0x7F, 0x00, 0xF0, 0x1F, 0xF0, 0x3D, 0xE0, 0xFB, 0xC1, 0xE7, 0xC3, 0xC7,
-    0x8F, 0x0F, 0x1E, 0x1F, 0x3C, 0x1E, 0xF0, 0x3D, 0xE0, 0x3F, 0x80, 0x7F, 0x00, 0x7E, 0x00, 0xF8,
-    0x01, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0x80, 0x1F, 0x78, 0xF1, 0xE7, 0x8F, 0x1E, 0x78, 0xF9, 0xE7,
-    0x9F, 0x9E, 0x7D, 0xF9, 0xC3, 0xDF, 0xBC, 0x3F, 0xFF, 0xC3, 0xF9, 0xFC, 0x3F, 0x9F, 0x81, 0xF9,
-    0xF8, 0x1F, 0x0F, 0x81, 0xF0, 0xF8, 0x0F, 0x0F, 0x00, 0xF8, 0x7D, 0xF1, 0xE3, 0xCF, 0x8F, 0xFC,
-    0x1F, 0xE0, 0x3F, 0x80, 0xFC, 0x01, 0xF0, 0x0F, 0xC0, 0x7F, 0x81, 0xFF, 0x0F, 0xFC, 0x7C, 0xF9,
-    0xE1, 0xFF, 0x87, 0xC0, 0xF8, 0x3F, 0xE1, 0xE7, 0xC7, 0x8F, 0x3C, 0x3F, 0xF0, 0x7F, 0x81, 0xFE,
-    0x03, 0xF0, 0x0F, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x00, 0x7F,
-    0xF3, 0xFF, 0x9F, 0xFC, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x01, 0xE0, 0x1F, 0x01, 0xF0, 0x0F,
-    0x00, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7E, 0xFD, 0xFB, 0x87, 0x0E, 0x1C, 0x38, 0x70,
-    0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xFD, 0xFB, 0xF0, 0xF0, 0x0F, 0x01, 0xE0, 0x3C, 0x03,
-    0xC0, 0x78, 0x0F, 0x00, 0xF0, 0x1E, 0x03, 0xC0, 0x3C, 0x07, 0x80, 0xF0, 0x0F, 0x01, 0xE0, 0x1C,
-    0x03, 0xC0, 0x78, 0x07, 0x80, 0xF0, 0xFF, 0xFF, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C,
-    0x71, 0xC7, 0x1F, 0xFF, 0xFF, 0x0F, 0x01, 0xF0, 0x1F, 0x83, 0xFC, 0x3F, 0xC7, 0x9E, 0x79, 0xEF,
-    0x0F, 0x70, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x63, 0xCF, 0x8E, 0x18, 0x3F, 0x87, 0xF8, 0xFF,
-    0x19, 0xF3, 0xFE, 0xFF, 0xDE, 0x7F, 0xCF, 0x7F, 0xEF, 0xFC, 0xFF, 0x00, 0xF0, 0x1E, 0x03, 0xC0,
-    0x78, 0x0F, 0x01, 0xFF, 0x3F, 0xF7, 0xFF, 0xFB, 0xFE, 0x3F, 0xC7, 0xF8, 0xFF, 0x3F, 0xFF, 0xBF,
-    0xF7, 0xF8, 0x1F, 0xCF, 0xF7, 0xFD, 0xF2, 0x78, 0x1E, 0x07, 0x81, 0xF3, 0x7F, 0xCF, 0xF1, 0xFC,
-    0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF1, 0xFF, 0x3F, 0xF7, 0xFF, 0x7D, 0xF7, 0x8F, 0x78,
-    0xF7, 0x8F, 0x7C, 0xF7, 0xFF, 0x3F, 0xF1, 0xFE, 0x1F, 0x83, 0xFE, 0x7F, 0xE7, 0x9F, 0x7F, 0xF7,
-    0xFF, 0x78, 0x07, 0xC6, 0x7F, 0xE3, 0xFE, 0x1F, 0xE0, 0x3F, 0x3F, 0xBF, 0xDF, 0x6F, 0x07, 0xFB,
-    0xFD, 0xFE, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0x1F, 0xE7, 0xFD, 0xFF, 0xBE,
-    0xF7, 0x9E, 0xF3, 0xDE, 0x7B, 0xFF, 0x3F, 0xE3, 0xFC, 0x07, 0x99, 0xF7, 0xFE, 0xFF, 0x9F, 0xE0,
-    0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3F, 0xEF, 0xFF, 0xFF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3,
-    0xFC, 0xFF, 0x3F, 0xCF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x3C, 0x78, 0xF0,
-    0x03, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1F, 0xFF, 0xF7, 0xC0, 0xF0, 0x1E,
-    0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE7, 0xFD, 0xF7, 0xFC, 0xFF, 0x1F, 0xC3, 0xFC, 0x7F, 0x8F, 0x79,
-    0xEF, 0xBC, 0xFF, 0x8F, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xFB, 0xF7, 0x9E,
-    0xFF, 0xFC, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xDF, 0xF3, 0xCF, 0xF3, 0xCF, 0xF3, 0xCF, 0xF3, 0xCF,
-    0xF3, 0xCF, 0xF3, 0xCF, 0xF3, 0xCF, 0xFF, 0xBF, 0xEF, 0xFF, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF,
-    0xF3, 0xFC, 0xFF, 0x3C, 0x1F, 0xC3, 0xFE, 0x7F, 0xE7, 0xDF, 0x78, 0xF7, 0x8F, 0x78, 0xF7, 0xDF,
-    0x7F, 0xE3, 0xFE, 0x1F, 0xC0, 0xFF, 0x1F, 0xFB, 0xFF, 0x79, 0xFF, 0x1F, 0xE3, 0xFC, 0x7F, 0x9F,
-    0xFF, 0xDF, 0xFB, 0xFE, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x00, 0x1F, 0xE3, 0xFF, 0x7F, 0xF7, 0xCF,
-    0x78, 0xF7, 0x8F, 0x78, 0xF7, 0xDF, 0x7F, 0xF3, 0xFF, 0x1F, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00,
-    0xF0, 0xFF, 0xFF, 0xFF, 0xF2, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x3F, 0x9F, 0xE7, 0xF9,
-    0xE6, 0x7F, 0x9F, 0xE3, 0xFD, 0x8F, 0x7F, 0xDF, 0xE7, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF,
-    0xF0, 0xF0, 0xF0, 0xF0, 0xFA, 0xFF, 0x7F, 0x3F, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF,
-    0x3F, 0xEF, 0xFF, 0xDF, 0xF3, 0xFC, 0xF0, 0xFF, 0x1E, 0x79, 0xE7, 0x9E, 0x7B, 0xC3, 0xFC, 0x3F,
-    0x83, 0xF8, 0x1F, 0x81, 0xF0, 0x0F, 0x00, 0xF1, 0xC7, 0x79, 0xE7, 0x9C, 0xF3, 0xCF, 0x7D, 0xE7,
-    0xBE, 0xE1, 0xFF, 0xF0, 0xFF, 0xF8, 0x7E, 0xF8, 0x1E, 0x7C, 0x0F, 0x3E, 0x07, 0x8E, 0x00, 0xF1,
-    0xE7, 0x9E, 0x3F, 0xC3, 0xF8, 0x1F, 0x80, 0xF0, 0x1F, 0x83, 0xFC, 0x7B, 0xC7, 0x9E, 0xF1, 0xF0,
-    0xF0, 0xFF, 0x1E, 0x79, 0xE7, 0x9E, 0x7B, 0xC3, 0xFC, 0x3F, 0x81, 0xF8, 0x1F, 0x81, 0xF0, 0x0F,
-    0x01, 0xE0, 0xFE, 0x0F, 0xC0, 0xF8, 0x00, 0x7F, 0xDF, 0xF7, 0xFC, 0x1E, 0x0F, 0x07, 0x83, 0xC1,
-    0xE0, 0x7F, 0xFF, 0xFF, 0xFC, 0x0F, 0x1F, 0x3F, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7C, 0xF8, 0xF8,
-    0xFC, 0x7C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3F, 0x1F, 0x1F, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0xF0, 0xF8, 0xF8, 0x7C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x1E, 0x1E, 0x3E, 0x3C,
-    0x3C, 0x3C, 0x3C, 0x7C, 0xF8, 0xF8, 0xF0, 0x3C, 0x77, 0xFF, 0x7F, 0xEF, 0xFE, 0xE3, 0xC0, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0x03, 0xC0, 0xF0, 0x7F, 0x3F, 0xDF, 0xF7, 0xC9,
-    0xE0, 0x78, 0x1F, 0x37, 0xFC, 0xFF, 0x1F, 0xC3, 0xC0, 0xF0, 0x3C, 0x0F, 0xC3, 0xF8, 0xFF, 0x1F,
-    0x63, 0xC0, 0x78, 0x3F, 0xE7, 0xFC, 0xFF, 0x87, 0x80, 0xF0, 0x1E, 0x03, 0xFE, 0x7F, 0xDF, 0xF8,
-    0x00, 0x07, 0x0E, 0xFF, 0xF7, 0xFE, 0x3B, 0xC7, 0x9E, 0x79, 0xE3, 0xBC, 0x7F, 0xEF, 0xFF, 0x70,
-    0xC0, 0x78, 0x79, 0xF3, 0xE3, 0xCF, 0x0F, 0x3C, 0x1F, 0xE0, 0x7F, 0x80, 0xFC, 0x0F, 0xFC, 0x3F,
-    0xF0, 0x1E, 0x00, 0x78, 0x0F, 0xFC, 0x3F, 0xF0, 0x1E, 0x00, 0x78, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xC7, 0xF9, 0xFF, 0x3C, 0xC7, 0x80, 0x7E, 0x0F, 0xE3,
-    0xFE, 0x73, 0xDE, 0x39, 0xE7, 0x3F, 0xE3, 0xF8, 0x3F, 0x80, 0xF3, 0x9E, 0x7F, 0xDF, 0xF9, 0xFE,
-    0x00, 0x77, 0xFB, 0xDD, 0xE0, 0x0F, 0xE0, 0x7F, 0xE1, 0xF3, 0xE3, 0x80, 0xEE, 0x7D, 0xDD, 0xF9,
-    0xFB, 0x93, 0xFF, 0x07, 0xEE, 0x4F, 0xDF, 0x9F, 0x9F, 0x73, 0x80, 0xE7, 0xCF, 0x87, 0xFE, 0x03,
-    0xF8, 0x00, 0x7E, 0x7F, 0x0F, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x01, 0xC7, 0x3C, 0xF7, 0xDE,
-    0x7B, 0xEF, 0xBC, 0x7B, 0xE7, 0xDE, 0x3C, 0xF1, 0xC7, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x07,
-    0x01, 0xC0, 0x70, 0x1C, 0x07, 0xFF, 0xFF, 0xF8, 0x0F, 0xE0, 0x7F, 0xE1, 0xF3, 0xE3, 0x80, 0xEE,
-    0xFD, 0xDD, 0xFD, 0xFB, 0xBB, 0xF7, 0xE7, 0xEF, 0xCF, 0xDF, 0x9F, 0xBB, 0xF3, 0x80, 0xE7, 0xCF,
-    0x87, 0xFE, 0x03, 0xF8, 0x00, 0xFF, 0xFF, 0x7C, 0xFE, 0xEE, 0xEE, 0xFE, 0x7C, 0x1E, 0x07, 0x81,
-    0xE0, 0x78, 0xFF, 0xFF, 0xFF, 0xFC, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x7D, 0xFD, 0xB8, 0xF3, 0xCF, 0x1C, 0x7F, 0xFE, 0xFD, 0xFD, 0x79, 0xE3, 0xE1, 0xD3, 0xFF, 0xFC,
-    0x10, 0xE7, 0xBC, 0x60, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xEF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0xF0, 0x3C, 0x0F, 0x00, 0x0F, 0xF8, 0xFF, 0xF7, 0xFF, 0xDF, 0xEF, 0x7F, 0xBD,
-    0xFE, 0xF7, 0xFB, 0xDF, 0xEF, 0x3F, 0xBC, 0x3E, 0xF0, 0x7B, 0xC1, 0xEF, 0x07, 0xBC, 0x1E, 0xF0,
-    0x7B, 0xC1, 0xEF, 0x07, 0xBC, 0x1E, 0xF0, 0x7B, 0xC0, 0x77, 0xFE, 0xE0, 0x18, 0xE3, 0xDF, 0x7D,
-    0xE0, 0x1D, 0xF7, 0xDF, 0x1C, 0x71, 0xC7, 0x1C, 0x3E, 0x3F, 0x9D, 0xFE, 0x7F, 0x3B, 0xBD, 0xFC,
-    0x7E, 0x00, 0x03, 0x8E, 0x1E, 0xF0, 0xF3, 0xC3, 0xDF, 0x1F, 0x78, 0xF7, 0xCF, 0x3C, 0x7B, 0xC3,
-    0x8E, 0x00, 0x00, 0x3C, 0x1C, 0x0F, 0x87, 0x83, 0xF0, 0xF0, 0x3E, 0x3C, 0x01, 0xC7, 0x80, 0x39,
-    0xE0, 0x07, 0x3C, 0xF0, 0xEF, 0x3E, 0x1D, 0xEF, 0xC0, 0x7B, 0xB8, 0x0E, 0x7F, 0x03, 0xCF, 0xE0,
-    0x70, 0x1C, 0x1E, 0x03, 0x83, 0x80, 0x00, 0x3C, 0x3C, 0x1F, 0x0F, 0x0F, 0xC7, 0x81, 0xF1, 0xC0,
-    0x1C, 0xF0, 0x07, 0x38, 0x01, 0xDE, 0xF8, 0x77, 0x7E, 0x1F, 0xCF, 0xC0, 0xE0, 0xF0, 0x78, 0x78,
-    0x1C, 0x3C, 0x0F, 0x0E, 0x03, 0x87, 0xF1, 0xE1, 0xFC, 0x7C, 0x1E, 0x0F, 0xC3, 0xC1, 0xB8, 0xF0,
-    0x1E, 0x1E, 0x03, 0xE7, 0x80, 0x1C, 0xE0, 0x13, 0xBC, 0xF7, 0xF7, 0x3E, 0xFD, 0xEF, 0xC0, 0x3B,
-    0xB8, 0x0F, 0x7F, 0x01, 0xCF, 0xE0, 0x78, 0x1C, 0x0E, 0x03, 0x83, 0xC0, 0x00, 0x0E, 0x07, 0xC1,
-    0xF0, 0x38, 0x00, 0x03, 0x81, 0xE0, 0xF8, 0x7C, 0x1E, 0x0F, 0x03, 0xEE, 0xFF, 0x9F, 0xE3, 0xF8,
-    0x03, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0x00, 0x01, 0xF0, 0x03, 0xE0, 0x07,
-    0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0xF7, 0x81, 0xEF, 0x03, 0x8F, 0x0F, 0x1E, 0x1F, 0xFC, 0x7F, 0xFC,
-    0xFF, 0xF9, 0xE0, 0xF7, 0x80, 0xFF, 0x01, 0xE0, 0x01, 0x80, 0x03, 0x80, 0x0F, 0x00, 0x3C, 0x00,
-    0x70, 0x00, 0x00, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0xF7, 0x81, 0xEF,
-    0x03, 0x8F, 0x0F, 0x1E, 0x1F, 0xFC, 0x7F, 0xFC, 0xFF, 0xF9, 0xE0, 0xF7, 0x80, 0xFF, 0x01, 0xE0,
-    0x01, 0x80, 0x07, 0x00, 0x1F, 0x00, 0x7F, 0x00, 0x44, 0x00, 0x00, 0x01, 0xF0, 0x03, 0xE0, 0x07,
-    0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0xF7, 0x81, 0xEF, 0x03, 0x8F, 0x0F, 0x1E, 0x1F, 0xFC, 0x7F, 0xFC,
-    0xFF, 0xF9, 0xE0, 0xF7, 0x80, 0xFF, 0x01, 0xE0, 0x0F, 0x60, 0x1F, 0xE0, 0x37, 0x80, 0x00, 0x00,
-    0x7C, 0x00, 0xF8, 0x01, 0xF8, 0x07, 0xF0, 0x0F, 0xE0, 0x3D, 0xE0, 0x7B, 0xC0, 0xE3, 0xC3, 0xC7,
-    0x87, 0xFF, 0x1F, 0xFF, 0x3F, 0xFE, 0x78, 0x3D, 0xE0, 0x3F, 0xC0, 0x78, 0x1E, 0xE0, 0x3D, 0xE0,
-    0x7B, 0x80, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF8, 0x07, 0xF0, 0x0F, 0xE0, 0x3D, 0xE0, 0x7B,
-    0xC0, 0xE3, 0xC3, 0xC7, 0x87, 0xFF, 0x1F, 0xFF, 0x3F, 0xFE, 0x78, 0x3D, 0xE0, 0x3F, 0xC0, 0x78,
-    0x07, 0xC0, 0x0D, 0x80, 0x1B, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x03, 0xF8, 0x07, 0xF0, 0x0F,
-    0xF0, 0x3D, 0xE0, 0x7B, 0xC1, 0xE3, 0xC3, 0xC7, 0x87, 0xFF, 0x1F, 0xFF, 0x3F, 0xFE, 0x78, 0x3D,
-    0xE0, 0x3F, 0xC0, 0x78, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x7F, 0xFC, 0x03, 0xF8, 0x00, 0x3F,
-    0xC0, 0x03, 0xDE, 0x00, 0x1E, 0xFF, 0x81, 0xE7, 0xFC, 0x0F, 0x3F, 0xE0, 0xFF, 0xE0, 0x0F, 0xFF,
-    0x00, 0x7F, 0xF8, 0x07, 0xC3, 0xFF, 0xBC, 0x1F, 0xFF, 0xC0, 0xFF, 0xE0, 0x0F, 0xF1, 0xFF, 0x9F,
-    0xFC, 0xFD, 0xEF, 0x80, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3E, 0x00, 0xF8, 0xE7,
-    0xFF, 0x1F, 0xF8, 0x3F, 0xC0, 0xE0, 0x07, 0x80, 0x1C, 0x03, 0xE0, 0x1F, 0x00, 0x0C, 0x03, 0x80,
-    0x78, 0x07, 0x80, 0x70, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xC0, 0x78, 0x0F, 0xFD, 0xFF,
-    0xBF, 0xF7, 0x80, 0xF0, 0x1E, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0x00, 0xE0, 0x3C, 0x0F, 0x01,
-    0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xC0, 0x78, 0x0F, 0xFD, 0xFF, 0xBF, 0xF7, 0x80,
-    0xF0, 0x1E, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x06, 0x01, 0xE0, 0x7E, 0x1F, 0xC1, 0x98, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xC0, 0x78, 0x0F, 0xFD, 0xFF, 0xBF, 0xF7, 0x80, 0xF0, 0x1E, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x3B, 0xCF, 0x78, 0xEF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xF0,
-    0x1E, 0x03, 0xFF, 0x7F, 0xEF, 0xFD, 0xE0, 0x3C, 0x07, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x21,
-    0xC7, 0x8F, 0x1C, 0x07, 0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x78, 0x33,
-    0xDF, 0xEE, 0x03, 0xDE, 0xF7, 0xBD, 0xEF, 0x7B, 0xDE, 0xF7, 0xBD, 0xEF, 0x00, 0x30, 0xF3, 0xF7,
-    0xFC, 0xC0, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x80,
-    0xF7, 0x7B, 0xFD, 0xC0, 0x03, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0,
-    0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x00, 0x3F, 0xE0, 0x7F, 0xF0, 0xFF, 0xF1, 0xE7, 0xE3, 0xC3, 0xE7,
-    0x83, 0xFF, 0xC7, 0xFF, 0x8F, 0x3C, 0x1E, 0x78, 0x3C, 0xF0, 0xF9, 0xE7, 0xE3, 0xFF, 0x87, 0xFE,
-    0x0F, 0xF8, 0x00, 0x0F, 0x60, 0x7F, 0x81, 0xBC, 0x00, 0x00, 0xF0, 0x3F, 0xE0, 0xFF, 0xC3, 0xFF,
-    0x8F, 0xFE, 0x3F, 0xFC, 0xFF, 0x7B, 0xFD, 0xEF, 0xF3, 0xFF, 0xC7, 0xFF, 0x1F, 0xFC, 0x3F, 0xF0,
-    0x7F, 0xC1, 0xFF, 0x03, 0xC0, 0x02, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0x00,
-    0x03, 0xF8, 0x1F, 0xF8, 0x7F, 0xF8, 0xF9, 0xFB, 0xE0, 0xF7, 0x81, 0xFF, 0x01, 0xFE, 0x03, 0xFC,
-    0x07, 0xF8, 0x1F, 0xF8, 0x3C, 0xF9, 0xF9, 0xFF, 0xE1, 0xFF, 0xC0, 0xFE, 0x00, 0x01, 0x80, 0x07,
-    0x80, 0x0F, 0x00, 0x3C, 0x00, 0x60, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xF8, 0x7F, 0xF8, 0xF9, 0xFB,
-    0xE0, 0xF7, 0x81, 0xFF, 0x01, 0xFE, 0x03, 0xFC, 0x07, 0xF8, 0x1F, 0xF8, 0x3C, 0xF9, 0xF9, 0xFF,
-    0xE1, 0xFF, 0xC0, 0xFE, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0xCC, 0x00, 0x00,
-    0x03, 0xF8, 0x1F, 0xF8, 0x7F, 0xF8, 0xF9, 0xFB, 0xE0, 0xF7, 0x81, 0xFF, 0x01, 0xFE, 0x03, 0xFC,
-    0x07, 0xF8, 0x1F, 0xF8, 0x3C, 0xF9, 0xF9, 0xFF, 0xE1, 0xFF, 0xC0, 0xFE, 0x00, 0x0F, 0x60, 0x3F,
-    0xC0, 0x37, 0x80, 0x00, 0x00, 0xFE, 0x07, 0xFE, 0x1F, 0xFE, 0x3E, 0x7E, 0xF8, 0x3D, 0xE0, 0x7F,
-    0xC0, 0x7F, 0x80, 0xFF, 0x01, 0xFE, 0x07, 0xFE, 0x0F, 0x3E, 0x7E, 0x7F, 0xF8, 0x7F, 0xF0, 0x3F,
-    0x80, 0x1C, 0xE0, 0x3D, 0xC0, 0x73, 0x80, 0x00, 0x00, 0xFE, 0x07, 0xFE, 0x1F, 0xFE, 0x3E, 0x7E,
-    0xF8, 0x3D, 0xE0, 0x7F, 0xC0, 0x7F, 0x80, 0xFF, 0x01, 0xFE, 0x07, 0xFE, 0x0F, 0x3E, 0x7E, 0x7F,
-    0xF8, 0x7F, 0xF0, 0x3F, 0x80, 0x61, 0xBC, 0xFF, 0xF8, 0xFC, 0x3E, 0x0F, 0xC7, 0xFB, 0xCF, 0x61,
-    0x80, 0x00, 0x08, 0x1F, 0xF8, 0xFF, 0xF3, 0xFF, 0xC7, 0xCF, 0xDF, 0x1F, 0xBC, 0x7F, 0xF9, 0xEF,
-    0xF7, 0x9F, 0xEE, 0x3F, 0xFC, 0xFF, 0xF1, 0xE7, 0xCF, 0xCF, 0xFF, 0x1F, 0xFE, 0x7F, 0xF0, 0x20,
-    0x00, 0x0C, 0x00, 0xF0, 0x07, 0xC0, 0x0E, 0x00, 0x30, 0x00, 0x03, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F,
-    0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0xFF, 0xEF, 0x9F, 0xFC,
-    0x7F, 0xC1, 0xFC, 0x00, 0x01, 0x00, 0x1C, 0x01, 0xE0, 0x1E, 0x00, 0xE0, 0x00, 0x03, 0xC1, 0xFE,
-    0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0xFF,
-    0xEF, 0x9F, 0xFC, 0x7F, 0xC1, 0xFC, 0x00, 0x06, 0x00, 0x78, 0x07, 0xE0, 0x3F, 0x80, 0x98, 0x00,
-    0x03, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE,
-    0x0F, 0xF0, 0xFF, 0xEF, 0x9F, 0xFC, 0x7F, 0xC1, 0xFC, 0x00, 0x3D, 0xC1, 0xEF, 0x0F, 0x70, 0x00,
-    0x0F, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8,
-    0x3F, 0xC3, 0xFF, 0xBE, 0x7F, 0xF1, 0xFF, 0x07, 0xF0, 0x01, 0x80, 0x0F, 0x00, 0x3C, 0x01, 0xE0,
-    0x07, 0x00, 0x00, 0x0F, 0x83, 0xFE, 0x1E, 0x7C, 0x78, 0xF3, 0xC3, 0xFF, 0x07, 0xF8, 0x1F, 0xE0,
-    0x3F, 0x00, 0xF8, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0xF0, 0x0F,
-    0x00, 0xFF, 0xCF, 0xFE, 0xFF, 0xFF, 0x1F, 0xF0, 0xFF, 0x0F, 0xF3, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8,
-    0xF0, 0x0F, 0x00, 0xF0, 0x00, 0x3F, 0x83, 0xFE, 0x1F, 0xF1, 0xF7, 0x8F, 0x1C, 0x79, 0xE3, 0xDE,
-    0x1E, 0xF0, 0xF7, 0x87, 0xBF, 0x3C, 0xFD, 0xE1, 0xEF, 0x6F, 0x7B, 0xFB, 0xFF, 0xDF, 0xFC, 0x0C,
-    0x03, 0x80, 0x78, 0x07, 0x80, 0x70, 0x00, 0x0F, 0xE1, 0xFE, 0x3F, 0xC6, 0x7C, 0xFF, 0xBF, 0xF7,
-    0x9F, 0xF3, 0xDF, 0xFB, 0xFF, 0x3F, 0xC0, 0x02, 0x00, 0xE0, 0x3C, 0x0F, 0x00, 0xC0, 0x00, 0x0F,
-    0xE1, 0xFE, 0x3F, 0xC6, 0x7C, 0xFF, 0xBF, 0xF7, 0x9F, 0xF3, 0xDF, 0xFB, 0xFF, 0x3F, 0xC0, 0x0C,
-    0x01, 0xC0, 0x7C, 0x1F, 0xC1, 0x10, 0x00, 0x0F, 0xE1, 0xFE, 0x3F, 0xC6, 0x7C, 0xFF, 0xBF, 0xF7,
-    0x9F, 0xF3, 0xDF, 0xFB, 0xFF, 0x3F, 0xC0, 0x3D, 0x87, 0xF8, 0xDE, 0x00, 0x00, 0x00, 0x7F, 0x0F,
-    0xF1, 0xFE, 0x33, 0xE7, 0xFD, 0xFF, 0xBC, 0xFF, 0x9E, 0xFF, 0xDF, 0xF9, 0xFE, 0x3B, 0xCF, 0x78,
-    0xEF, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xF1, 0xFE, 0x33, 0xE7, 0xFD, 0xFF, 0xBC, 0xFF, 0x9E, 0xFF,
-    0xDF, 0xF9, 0xFE, 0x0F, 0x03, 0xE0, 0x6E, 0x0F, 0xC1, 0xF0, 0x1E, 0x00, 0x01, 0xFC, 0x3F, 0xC7,
-    0xF8, 0xCF, 0x9F, 0xF7, 0xFE, 0xF3, 0xFE, 0x7B, 0xFF, 0x7F, 0xE7, 0xF8, 0x3F, 0xFF, 0x0F, 0xFF,
-    0xE3, 0xFF, 0xF8, 0xCF, 0x9F, 0x3F, 0xFF, 0xDF, 0xFF, 0xF7, 0x9E, 0x03, 0xE7, 0xC6, 0x7F, 0xFF,
-    0x9F, 0xFF, 0xE3, 0xFF, 0xF8, 0x1F, 0xCF, 0xF7, 0xFD, 0xF2, 0x78, 0x1E, 0x07, 0x81, 0xF3, 0x7F,
-    0xCF, 0xF0, 0xFC, 0x3C, 0x07, 0x07, 0xC1, 0xF0, 0x0C, 0x00, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0x00,
-    0x00, 0x1F, 0x83, 0xFE, 0x7F, 0xE7, 0x9F, 0x7F, 0xF7, 0xFF, 0x78, 0x07, 0xC6, 0x7F, 0xE3, 0xFE,
-    0x1F, 0xE0, 0x03, 0x00, 0x78, 0x07, 0x80, 0xF0, 0x0C, 0x00, 0x00, 0x1F, 0x83, 0xFE, 0x7F, 0xE7,
-    0x9F, 0x7F, 0xF7, 0xFF, 0x78, 0x07, 0xC6, 0x7F, 0xE3, 0xFE, 0x1F, 0xE0, 0x06, 0x00, 0xF0, 0x1F,
-    0x81, 0xFC, 0x19, 0x80, 0x00, 0x1F, 0x83, 0xFE, 0x7F, 0xE7, 0x9F, 0x7F, 0xF7, 0xFF, 0x78, 0x07,
-    0xC6, 0x7F, 0xE3, 0xFE, 0x1F, 0xE0, 0x3D, 0xC3, 0xDE, 0x3D, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x3F,
-    0xE7, 0xFE, 0x79, 0xF7, 0xFF, 0x7F, 0xF7, 0x80, 0x7C, 0x67, 0xFE, 0x3F, 0xE1, 0xFE, 0x63, 0xC7,
-    0x8E, 0x18, 0x07, 0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x78, 0x18, 0xF3, 0xDE, 0x60, 0x07,
-    0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x78, 0x18, 0x3C, 0x7E, 0x7F, 0x66, 0x00, 0x3C, 0x3C,
-    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x73, 0xBF, 0xDC, 0xE0, 0x00, 0x00, 0xF0,
-    0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x07, 0x00, 0x3F, 0x81, 0xFC,
-    0x1F, 0xC0, 0x7E, 0x00, 0x78, 0x7F, 0xC7, 0xFE, 0x7F, 0xF3, 0xEF, 0x9E, 0x3C, 0xF1, 0xE7, 0x9F,
-    0x3F, 0xF0, 0xFF, 0x03, 0xF0, 0x3D, 0x9F, 0xE7, 0xF8, 0x00, 0x00, 0x3F, 0xEF, 0xFB, 0xFF, 0xF3,
-    0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0x04, 0x00, 0xE0, 0x0F, 0x00, 0x78, 0x03,
-    0x80, 0x00, 0x1F, 0xC3, 0xFE, 0x7F, 0xE7, 0xDF, 0x78, 0xF7, 0x8F, 0x78, 0xF7, 0xDF, 0x7F, 0xE3,
-    0xFE, 0x1F, 0xC0, 0x03, 0x00, 0x38, 0x07, 0x80, 0xF0, 0x0E, 0x00, 0x00, 0x1F, 0xC3, 0xFE, 0x7F,
-    0xE7, 0xDF, 0x78, 0xF7, 0x8F, 0x78, 0xF7, 0xDF, 0x7F, 0xE3, 0xFE, 0x1F, 0xC0, 0x06, 0x00, 0xF0,
-    0x1F, 0x81, 0xFC, 0x19, 0x80, 0x00, 0x1F, 0xC3, 0xFE, 0x7F, 0xE7, 0xDF, 0x78, 0xF7, 0x8F, 0x78,
-    0xF7, 0xDF, 0x7F, 0xE3, 0xFE, 0x1F, 0xC0, 0x1E, 0xC3, 0xFC, 0x1B, 0xC0, 0x00, 0x00, 0x01, 0xFC,
-    0x3F, 0xE7, 0xFE, 0x7D, 0xF7, 0x8F, 0x78, 0xF7, 0x8F, 0x7D, 0xF7, 0xFE, 0x3F, 0xE1, 0xFC, 0x3D,
-    0xC3, 0xDE, 0x3D, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0xE7, 0xFE, 0x7D, 0xF7, 0x8F, 0x78, 0xF7,
-    0x8F, 0x7D, 0xF7, 0xFE, 0x3F, 0xE1, 0xFC, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x00, 0x00, 0x21, 0xFF, 0x3F, 0xE7, 0xFE, 0x7F, 0xF7,
-    0xBF, 0x77, 0xF7, 0xEF, 0x7D, 0xF7, 0xFE, 0x7F, 0xE7, 0xFC, 0x20, 0x00, 0x18, 0x0F, 0x03, 0xC0,
-    0x78, 0x0E, 0x00, 0x0F, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFE, 0xFF, 0xFD, 0xFF,
-    0x3F, 0xC0, 0x06, 0x03, 0xC0, 0xF0, 0x78, 0x18, 0x00, 0x0F, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F,
-    0xCF, 0xF3, 0xFE, 0xFF, 0xFD, 0xFF, 0x3F, 0xC0, 0x0C, 0x07, 0x83, 0xF0, 0xFE, 0x33, 0x00, 0x0F,
-    0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFE, 0xFF, 0xFD, 0xFF, 0x3F, 0xC0, 0x73, 0x9E,
-    0xE7, 0x38, 0x00, 0x00, 0x3C, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xFB, 0xFF, 0xF7,
-    0xFC, 0xFF, 0x03, 0x00, 0x38, 0x07, 0x80, 0xF0, 0x0E, 0x00, 0x00, 0xF0, 0xFF, 0x1E, 0x79, 0xE7,
-    0x9E, 0x7B, 0xC3, 0xFC, 0x3F, 0x81, 0xF8, 0x1F, 0x81, 0xF0, 0x0F, 0x01, 0xE0, 0xFE, 0x0F, 0xC0,
-    0xF8, 0x00, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xFE, 0x3F, 0xF7, 0xFE, 0xF3, 0xFE, 0x3F,
-    0xC7, 0xF8, 0xFF, 0x3F, 0xFF, 0xBF, 0xF7, 0xFC, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x00, 0x39, 0xC3,
-    0xBC, 0x39, 0xC0, 0x00, 0x00, 0x0F, 0x0F, 0xF1, 0xE7, 0x9E, 0x79, 0xE7, 0xBC, 0x3F, 0xC3, 0xF8,
-    0x1F, 0x81, 0xF8, 0x1F, 0x00, 0xF0, 0x1E, 0x0F, 0xE0, 0xFC, 0x0F, 0x80, 0x0F, 0xE0, 0x1F, 0xC0,
-    0x00, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xFC, 0x03, 0xF8, 0x07, 0xF0, 0x1E, 0xF0, 0x3D, 0xE0, 0x71,
-    0xE1, 0xE3, 0xC3, 0xFF, 0x8F, 0xFF, 0x9F, 0xFF, 0x3C, 0x1E, 0xF0, 0x1F, 0xE0, 0x3C, 0x3F, 0x87,
-    0xF0, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0x8F, 0xF1, 0x9F, 0x3F, 0xEF, 0xFD, 0xE7, 0xFC, 0xF7, 0xFE,
-    0xFF, 0xCF, 0xF0, 0x0E, 0xF0, 0x1F, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF8,
-    0x07, 0xF0, 0x0F, 0xE0, 0x3D, 0xE0, 0x7B, 0xC0, 0xE3, 0xC3, 0xC7, 0x87, 0xFF, 0x1F, 0xFF, 0x3F,
-    0xFE, 0x78, 0x3D, 0xE0, 0x3F, 0xC0, 0x78, 0x3B, 0xC7, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x7F, 0x0F,
-    0xF1, 0xFE, 0x33, 0xE7, 0xFD, 0xFF, 0xBC, 0xFF, 0x9E, 0xFF, 0xDF, 0xF9, 0xFE, 0x07, 0xC0, 0x07,
-    0xC0, 0x07, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1C, 0x78, 0x3C, 0x78, 0x3F,
-    0xF8, 0x7F, 0xFC, 0x7F, 0xFC, 0x78, 0x3C, 0xF0, 0x1E, 0xF0, 0x1E, 0x00, 0x1E, 0x00, 0x1C, 0x00,
-    0x3C, 0x00, 0x3F, 0x00, 0x1F, 0x3F, 0x87, 0xF8, 0xFF, 0x19, 0xF3, 0xFE, 0xFF, 0xDE, 0x7F, 0xCF,
-    0x7F, 0xEF, 0xFC, 0xFF, 0x81, 0xE0, 0x78, 0x0F, 0xC0, 0xF8, 0x01, 0x80, 0x1E, 0x00, 0xF0, 0x0F,
-    0x00, 0x70, 0x00, 0x00, 0x3F, 0xC7, 0xFE, 0x7F, 0xF3, 0xF7, 0xBE, 0x01, 0xE0, 0x0F, 0x00, 0x78,
-    0x03, 0xC0, 0x1E, 0x00, 0xF8, 0x07, 0xE3, 0x9F, 0xFC, 0x7F, 0xE1, 0xFF, 0x00, 0x03, 0x00, 0xE0,
-    0x78, 0x3C, 0x0E, 0x00, 0x01, 0xFC, 0xFF, 0x7F, 0xDF, 0x27, 0x81, 0xE0, 0x78, 0x1F, 0x37, 0xFC,
-    0xFF, 0x1F, 0xC0, 0x03, 0x00, 0x3C, 0x03, 0xF0, 0x1F, 0xC0, 0xCC, 0x00, 0x00, 0x3F, 0xC7, 0xFE,
-    0x7F, 0xF3, 0xF7, 0xBE, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF8, 0x07, 0xE3,
-    0x9F, 0xFC, 0x7F, 0xE1, 0xFF, 0x00, 0x06, 0x03, 0xC1, 0xF8, 0x7F, 0x19, 0x80, 0x01, 0xFC, 0xFF,
-    0x7F, 0xDF, 0x27, 0x81, 0xE0, 0x78, 0x1F, 0x37, 0xFC, 0xFF, 0x1F, 0xC0, 0x03, 0x80, 0x3C, 0x00,
-    0xE0, 0x00, 0x00, 0xFF, 0x1F, 0xF9, 0xFF, 0xCF, 0xDE, 0xF8, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F,
-    0x00, 0x78, 0x03, 0xE0, 0x1F, 0x8E, 0x7F, 0xF1, 0xFF, 0x87, 0xFC, 0x07, 0x03, 0xC0, 0x70, 0x00,
-    0x00, 0x07, 0xF3, 0xFD, 0xFF, 0x7C, 0x9E, 0x07, 0x81, 0xE0, 0x7C, 0xDF, 0xF3, 0xFC, 0x7F, 0x0C,
-    0xC0, 0x7F, 0x03, 0xF0, 0x0F, 0x00, 0x30, 0x00, 0x00, 0x3F, 0xC7, 0xFE, 0x7F, 0xF3, 0xF7, 0xBE,
-    0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF8, 0x07, 0xE3, 0x9F, 0xFC, 0x7F, 0xE1,
-    0xFF, 0x00, 0x19, 0x87, 0xF1, 0xF8, 0x3C, 0x06, 0x00, 0x01, 0xFC, 0xFF, 0x7F, 0xDF, 0x27, 0x81,
-    0xE0, 0x78, 0x1F, 0x37, 0xFC, 0xFF, 0x1F, 0xC0, 0x09, 0x80, 0x7F, 0x00, 0xF8, 0x03, 0xC0, 0x06,
-    0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF8, 0xFF, 0xF3, 0xC7, 0xEF, 0x07, 0xBC, 0x1F, 0xF0, 0x3F, 0xC0,
-    0xFF, 0x03, 0xFC, 0x1F, 0xF0, 0x7B, 0xC7, 0xEF, 0xFF, 0x3F, 0xF8, 0xFF, 0xC0, 0x00, 0xFF, 0x00,
-    0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x1F, 0xF0, 0x3F, 0xF0, 0x7F, 0xF0, 0x7D, 0xF0, 0x78,
-    0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x7C, 0xF0, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xE0, 0x3F, 0xE0, 0x7F,
-    0xF0, 0xFF, 0xF1, 0xE7, 0xE3, 0xC3, 0xE7, 0x83, 0xFF, 0xC7, 0xFF, 0x8F, 0x3C, 0x1E, 0x78, 0x3C,
-    0xF0, 0xF9, 0xE7, 0xE3, 0xFF, 0x87, 0xFE, 0x0F, 0xF8, 0x00, 0x00, 0xF0, 0x3F, 0xC1, 0xFE, 0x01,
-    0xE0, 0x0F, 0x0F, 0xF8, 0xFF, 0xCF, 0xFE, 0x7D, 0xF3, 0xC7, 0x9E, 0x3C, 0xF1, 0xE7, 0xCF, 0x3F,
-    0xF8, 0xFF, 0xC3, 0xFC, 0x3F, 0x87, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0x80, 0xF0,
-    0x1F, 0xFB, 0xFF, 0x7F, 0xEF, 0x01, 0xE0, 0x3C, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xC3, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0x83, 0xFE, 0x7F, 0xE7, 0x9F, 0x7F, 0xF7, 0xFF, 0x78, 0x07, 0xC6, 0x7F,
-    0xE3, 0xFE, 0x1F, 0xE0, 0x3B, 0x87, 0xF0, 0x7C, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xF0,
-    0x1E, 0x03, 0xFF, 0x7F, 0xEF, 0xFD, 0xE0, 0x3C, 0x07, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3D,
-    0xC1, 0xFC, 0x0F, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0xE7, 0xFE, 0x79, 0xF7, 0xFF, 0x7F, 0xF7,
-    0x80, 0x7C, 0x67, 0xFE, 0x3F, 0xE1, 0xFE, 0x0E, 0x01, 0xE0, 0x38, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0xF0, 0x1E, 0x03, 0xFF, 0x7F, 0xEF, 0xFD, 0xE0, 0x3C, 0x07, 0x80, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0xE7, 0xFE, 0x79, 0xF7,
-    0xFF, 0x7F, 0xF7, 0x80, 0x7C, 0x67, 0xFE, 0x3F, 0xE1, 0xFE, 0xFF, 0xEF, 0xFE, 0xFF, 0xEF, 0x00,
-    0xF0, 0x0F, 0x00, 0xFF, 0xCF, 0xFC, 0xFF, 0xCF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0xEF, 0xFE, 0xFF,
-    0xE0, 0x1E, 0x01, 0xC0, 0x3C, 0x03, 0xF0, 0x1F, 0x1F, 0x83, 0xFE, 0x7F, 0xE7, 0x9F, 0x7F, 0xF7,
-    0xFF, 0x78, 0x07, 0xC6, 0x7F, 0xE3, 0xFE, 0x1F, 0xE0, 0x3C, 0x03, 0x80, 0x3E, 0x03, 0xE0, 0x19,
-    0x87, 0xF0, 0x7E, 0x07, 0x80, 0x60, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xC0, 0x78, 0x0F,
-    0xFD, 0xFF, 0xBF, 0xF7, 0x80, 0xF0, 0x1E, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x19, 0x81, 0xFC, 0x1F,
-    0x80, 0xF0, 0x06, 0x00, 0x00, 0x1F, 0x83, 0xFE, 0x7F, 0xE7, 0x9F, 0x7F, 0xF7, 0xFF, 0x78, 0x07,
-    0xC6, 0x7F, 0xE3, 0xFE, 0x1F, 0xE0, 0x03, 0x00, 0x3C, 0x03, 0xF0, 0x1F, 0xC0, 0xCC, 0x00, 0x00,
-    0x3F, 0xC7, 0xFE, 0x7F, 0xF3, 0xF3, 0xBE, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x3F, 0xC1, 0xFE, 0x0F,
-    0xF8, 0x7B, 0xE3, 0xDF, 0xFE, 0x7F, 0xF1, 0xFF, 0x00, 0x03, 0x00, 0xF0, 0x3F, 0x0F, 0xE0, 0xCC,
-    0x00, 0x07, 0xF9, 0xFF, 0x7F, 0xEF, 0xBD, 0xE7, 0xBC, 0xF7, 0x9E, 0xFF, 0xCF, 0xF8, 0xFF, 0x01,
-    0xE6, 0x7D, 0xFF, 0xBF, 0xE7, 0xF8, 0x1E, 0xE0, 0x7F, 0x01, 0xF0, 0x00, 0x00, 0xFF, 0x1F, 0xF9,
-    0xFF, 0xCF, 0xCE, 0xF8, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xE1, 0xEF, 0x8F,
-    0x7F, 0xF9, 0xFF, 0xC7, 0xFC, 0x1D, 0xC3, 0xF8, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0xCF, 0xFB, 0xFF,
-    0x7D, 0xEF, 0x3D, 0xE7, 0xBC, 0xF7, 0xFE, 0x7F, 0xC7, 0xF8, 0x0F, 0x33, 0xEF, 0xFD, 0xFF, 0x3F,
-    0xC0, 0x03, 0x80, 0x3C, 0x00, 0xE0, 0x00, 0x00, 0xFF, 0x1F, 0xF9, 0xFF, 0xCF, 0xCE, 0xF8, 0x07,
-    0x80, 0x3C, 0x01, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xE1, 0xEF, 0x8F, 0x7F, 0xF9, 0xFF, 0xC7, 0xFC,
-    0x07, 0x01, 0xE0, 0x1C, 0x00, 0x00, 0x00, 0x3F, 0xCF, 0xFB, 0xFF, 0x7D, 0xEF, 0x3D, 0xE7, 0xBC,
-    0xF7, 0xFE, 0x7F, 0xC7, 0xF8, 0x0F, 0x33, 0xEF, 0xFD, 0xFF, 0x3F, 0xC0, 0x0F, 0xF1, 0xFF, 0x9F,
-    0xFC, 0xFC, 0xEF, 0x80, 0x78, 0x03, 0xC0, 0x1E, 0x0F, 0xF0, 0x7F, 0x83, 0xFE, 0x1E, 0xF8, 0xF7,
-    0xFF, 0x9F, 0xFC, 0x7F, 0xC0, 0x00, 0x03, 0x80, 0x3C, 0x03, 0xE0, 0x1E, 0x00, 0x03, 0x80, 0xF0,
-    0x1C, 0x03, 0x80, 0x00, 0x00, 0x07, 0xF9, 0xFF, 0x7F, 0xEF, 0xBD, 0xE7, 0xBC, 0xF7, 0x9E, 0xFF,
-    0xCF, 0xF8, 0xFF, 0x01, 0xE6, 0x7D, 0xFF, 0xBF, 0xE7, 0xF8, 0x03, 0x00, 0x3C, 0x03, 0xF0, 0x3F,
-    0x80, 0xCC, 0x00, 0x03, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0x80, 0x38, 0x3F, 0x8E,
-    0xE0, 0x00, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3F, 0xEF, 0xFF, 0xFF, 0xF3, 0xFC, 0xFF, 0x3F,
-    0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0x3C, 0x3C, 0x3C, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x3C,
-    0x3C, 0x3C, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x3C, 0x3C, 0x3C, 0x78, 0x07, 0x80, 0xFF, 0x0F, 0xF0, 0x78, 0x07, 0xFC, 0x7F, 0xE7, 0xFE,
-    0x79, 0xE7, 0x8F, 0x78, 0xF7, 0x8F, 0x78, 0xF7, 0x8F, 0x78, 0xF7, 0x8F, 0x7B, 0x7F, 0x9B, 0xC0,
-    0x03, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E,
-    0x0F, 0x00, 0x7B, 0xFF, 0xFE, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x3C, 0x7F, 0x7F, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x3C, 0x3C, 0x3C, 0xFF, 0xFF, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x3C, 0x3C, 0xEF, 0xFD, 0xF0, 0x07, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E,
-    0x3C, 0x78, 0xF1, 0xE0, 0xF7, 0x7E, 0x7E, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x3C, 0x3C, 0x3C, 0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E,
-    0x73, 0xCF, 0xDF, 0x79, 0xE7, 0x9E, 0x01, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x7B,
-    0xCF, 0x3E, 0x78, 0x7F, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x1E, 0xF3, 0xBE, 0xF3, 0xFE, 0xF3, 0xFC, 0xF3,
-    0xF8, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0x00, 0x3C, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF,
-    0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0x03, 0xC7, 0xF1, 0xF8, 0x7C, 0x01, 0x80, 0x3C, 0x07, 0xE0, 0xFE,
-    0x06, 0x60, 0x00, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03,
-    0xC0, 0x3C, 0x03, 0xC6, 0x7C, 0xFF, 0xCF, 0xF8, 0x7F, 0x00, 0x0C, 0x0F, 0x0F, 0xC7, 0xE3, 0x30,
-    0x00, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x3F, 0x9F,
-    0x8F, 0x80, 0xF0, 0xFB, 0xC7, 0xCF, 0x3E, 0x3D, 0xF0, 0xFF, 0x83, 0xFC, 0x0F, 0xE0, 0x3F, 0xC0,
-    0xFF, 0x83, 0xDF, 0x0F, 0x3C, 0x3C, 0xF8, 0xF1, 0xF3, 0xC3, 0xCF, 0x0F, 0x80, 0x00, 0x07, 0x00,
-    0x1C, 0x00, 0xF0, 0x03, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE7, 0xFD, 0xF7, 0xFC,
-    0xFF, 0x1F, 0xC3, 0xFC, 0x7F, 0x8F, 0x79, 0xEF, 0xBC, 0xFF, 0x8F, 0x00, 0x01, 0xC0, 0x78, 0x1F,
-    0x03, 0xC0, 0xF3, 0xEF, 0x7C, 0xFF, 0x8F, 0xF0, 0xFE, 0x0F, 0xF0, 0xFF, 0x0F, 0x78, 0xF7, 0xCF,
-    0x3C, 0xF1, 0xE0, 0x18, 0x07, 0x01, 0xE0, 0x78, 0x06, 0x00, 0x00, 0x3C, 0x07, 0x80, 0xF0, 0x1E,
-    0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x19, 0xEF, 0xB8, 0x03, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xEF, 0xDE, 0x78,
-    0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0x01, 0xE0, 0x78, 0x0F, 0x00, 0xF3, 0xCF, 0x3C, 0xF3,
-    0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xFB, 0xF7, 0x9E, 0x01, 0xC7, 0x3C, 0xE0, 0xF0, 0x1E, 0x73, 0xCE,
-    0x79, 0xCF, 0x39, 0xE6, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0xF7, 0xF7, 0xF7, 0xF6, 0xF6, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xFC, 0x78,
-    0x78, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x3D, 0xE7, 0xBC, 0xF7, 0x9E, 0xF0, 0x1E, 0x03, 0xC0,
-    0x78, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0xEF, 0x7F, 0xDF,
-    0xF3, 0xBC, 0x0F, 0x03, 0xC0, 0xF8, 0x3F, 0x07, 0x81, 0xE0, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78,
-    0x03, 0xF8, 0x1F, 0xC0, 0xFE, 0x1F, 0xC0, 0xFC, 0x07, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xFF, 0x1F,
-    0xF8, 0xFF, 0xC0, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xF0, 0xFC, 0xFE, 0xFC, 0x7E, 0x0F, 0x07, 0x83,
-    0xC1, 0xE0, 0xF8, 0x7C, 0x1E, 0x01, 0x80, 0x0F, 0x00, 0x7C, 0x01, 0xC0, 0x06, 0x00, 0x00, 0x0F,
-    0x03, 0xFE, 0x0F, 0xFC, 0x3F, 0xF8, 0xFF, 0xE3, 0xFF, 0xCF, 0xF7, 0xBF, 0xDE, 0xFF, 0x3F, 0xFC,
-    0x7F, 0xF1, 0xFF, 0xC3, 0xFF, 0x07, 0xFC, 0x1F, 0xF0, 0x3C, 0x06, 0x03, 0xC1, 0xF0, 0x70, 0x18,
-    0x00, 0x0F, 0xFB, 0xFE, 0xFF, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xC0,
-    0xF0, 0x3F, 0xE0, 0xFF, 0xC3, 0xFF, 0x8F, 0xFE, 0x3F, 0xFC, 0xFF, 0x7B, 0xFD, 0xEF, 0xF3, 0xFF,
-    0xC7, 0xFF, 0x1F, 0xFC, 0x3F, 0xF0, 0x7F, 0xC1, 0xFF, 0x03, 0xC0, 0x00, 0x03, 0x80, 0x1E, 0x00,
-    0xF8, 0x03, 0xC0, 0xFF, 0xBF, 0xEF, 0xFF, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF,
-    0x3C, 0x00, 0x0E, 0x07, 0x83, 0xE0, 0xF0, 0x0C, 0xC0, 0x7F, 0x00, 0xFC, 0x01, 0xE0, 0x03, 0x00,
-    0x00, 0x0F, 0x03, 0xFE, 0x0F, 0xFC, 0x3F, 0xF8, 0xFF, 0xE3, 0xFF, 0xCF, 0xF7, 0xBF, 0xDE, 0xFF,
-    0x3F, 0xFC, 0x7F, 0xF1, 0xFF, 0xC3, 0xFF, 0x07, 0xFC, 0x1F, 0xF0, 0x3C, 0x33, 0x0F, 0xE3, 0xF0,
-    0x78, 0x0C, 0x00, 0x0F, 0xFB, 0xFE, 0xFF, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF,
-    0xF3, 0xC0, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x0E, 0x00, 0x0F, 0xF0, 0x7F, 0xC3, 0xFF, 0x1E,
-    0xF8, 0xF3, 0xC7, 0x9E, 0x3C, 0xF1, 0xE7, 0x8F, 0x3C, 0x79, 0xE3, 0xCF, 0xF0, 0x3F, 0xE0, 0xFF,
-    0xC3, 0xFF, 0x8F, 0xFE, 0x3F, 0xFC, 0xFF, 0x7B, 0xFD, 0xEF, 0xF3, 0xFF, 0xC7, 0xFF, 0x1F, 0xFC,
-    0x3F, 0xF0, 0x7F, 0xC1, 0xFF, 0x03, 0xC0, 0x1F, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x00, 0xFF, 0xBF,
-    0xEF, 0xFF, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3C, 0x0F, 0x03, 0xC3, 0xF0,
-    0xF8, 0x0F, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x03, 0xFF, 0x0F, 0xFF, 0x1F, 0x3F, 0x7C, 0x1E,
-    0xF0, 0x3F, 0xE0, 0x3F, 0xC0, 0x7F, 0x80, 0xFF, 0x03, 0xFF, 0x07, 0x9F, 0x3F, 0x3F, 0xFC, 0x3F,
-    0xF8, 0x1F, 0xC0, 0x1F, 0xC1, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xFE, 0x7F, 0xE7, 0xDF, 0x78,
-    0xF7, 0x8F, 0x78, 0xF7, 0xDF, 0x7F, 0xE3, 0xFE, 0x1F, 0xC0, 0x0E, 0xE0, 0x1F, 0xC0, 0x1F, 0x00,
-    0x00, 0x00, 0xFE, 0x07, 0xFE, 0x1F, 0xFE, 0x3E, 0x7E, 0xF8, 0x3D, 0xE0, 0x7F, 0xC0, 0x7F, 0x80,
-    0xFF, 0x01, 0xFE, 0x07, 0xFE, 0x0F, 0x3E, 0x7E, 0x7F, 0xF8, 0x7F, 0xF0, 0x3F, 0x80, 0x1D, 0xC1,
-    0xFC, 0x0F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0xE7, 0xFE, 0x7D, 0xF7, 0x8F, 0x78, 0xF7, 0x8F,
-    0x7D, 0xF7, 0xFE, 0x3F, 0xE1, 0xFC, 0x03, 0x30, 0x0E, 0xF0, 0x3D, 0xC0, 0x77, 0x00, 0xCC, 0x00,
-    0x00, 0x03, 0xF8, 0x1F, 0xF8, 0x7F, 0xF8, 0xF9, 0xFB, 0xE0, 0xF7, 0x81, 0xFF, 0x01, 0xFE, 0x03,
-    0xFC, 0x07, 0xF8, 0x1F, 0xF8, 0x3C, 0xF9, 0xF9, 0xFF, 0xE1, 0xFF, 0xC0, 0xFE, 0x00, 0x06, 0x60,
-    0xEE, 0x1C, 0xE1, 0xDC, 0x19, 0x80, 0x00, 0x1F, 0xC3, 0xFE, 0x7F, 0xE7, 0xDF, 0x78, 0xF7, 0x8F,
-    0x78, 0xF7, 0xDF, 0x7F, 0xE3, 0xFE, 0x1F, 0xC0, 0x0F, 0xFF, 0xE3, 0xFF, 0xFE, 0x7F, 0xFF, 0xE7,
-    0xE7, 0x80, 0xF8, 0x78, 0x0F, 0x07, 0x80, 0xF0, 0x7F, 0xCF, 0x07, 0xFC, 0xF0, 0x7F, 0xCF, 0x07,
-    0x80, 0xF8, 0x78, 0x07, 0xE7, 0x80, 0x7F, 0xFF, 0xF3, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x1F, 0x9F,
-    0x87, 0xFF, 0xF9, 0xFF, 0xFF, 0xBE, 0xFC, 0xF7, 0x8F, 0xFE, 0xF1, 0xFF, 0xDE, 0x3C, 0x03, 0xEF,
-    0xE6, 0x7F, 0xFF, 0xC7, 0xFF, 0xF8, 0x7E, 0x7F, 0x00, 0x02, 0x00, 0x38, 0x03, 0xC0, 0x3C, 0x00,
-    0xC0, 0x00, 0x03, 0xFE, 0x1F, 0xFC, 0xFF, 0xE7, 0x9F, 0xBC, 0x3D, 0xE1, 0xEF, 0x3F, 0x7F, 0xFB,
-    0xFF, 0x9F, 0xF8, 0xF3, 0xC7, 0x9F, 0x3C, 0x7D, 0xE1, 0xEF, 0x0F, 0x80, 0x0C, 0x1E, 0x3E, 0x38,
-    0x30, 0x00, 0xFF, 0xFF, 0xFF, 0xF2, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0x87, 0xFF,
-    0x3F, 0xF9, 0xE7, 0xEF, 0x0F, 0x78, 0x7B, 0xCF, 0xDF, 0xFE, 0xFF, 0xE7, 0xFE, 0x3C, 0xF1, 0xE7,
-    0xCF, 0x1F, 0x78, 0x7B, 0xC3, 0xE0, 0x00, 0x07, 0x00, 0x78, 0x07, 0xC0, 0x3C, 0x00, 0x7F, 0xBF,
-    0xDF, 0xEF, 0x27, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x00, 0x07, 0x83, 0xC3, 0xC1, 0xE0,
-    0x19, 0x81, 0xFC, 0x07, 0xE0, 0x1E, 0x00, 0x60, 0x7F, 0xC3, 0xFF, 0x9F, 0xFC, 0xF3, 0xF7, 0x87,
-    0xBC, 0x3D, 0xE7, 0xEF, 0xFF, 0x7F, 0xF3, 0xFF, 0x1E, 0x78, 0xF3, 0xE7, 0x8F, 0xBC, 0x3D, 0xE1,
-    0xF0, 0x66, 0x7F, 0x7E, 0x3C, 0x18, 0x00, 0xFF, 0xFF, 0xFF, 0xF2, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-    0xF0, 0xF0, 0x03, 0x00, 0x38, 0x07, 0x80, 0xF0, 0x0E, 0x00, 0x00, 0x1F, 0xC3, 0xFE, 0x7F, 0xE7,
-    0xCC, 0x78, 0x07, 0xC0, 0x7F, 0x83, 0xFC, 0x0F, 0xE0, 0x1F, 0x00, 0xF7, 0x1F, 0x7F, 0xE7, 0xFE,
-    0x7F, 0xC0, 0x06, 0x01, 0xC0, 0xF0, 0x78, 0x1C, 0x00, 0x03, 0xF9, 0xFE, 0x7F, 0x9E, 0x67, 0xF9,
-    0xFE, 0x3F, 0xD8, 0xF7, 0xFD, 0xFE, 0x7F, 0x00, 0x06, 0x00, 0xF0, 0x1F, 0x81, 0xFC, 0x19, 0x80,
-    0x00, 0x1F, 0xC3, 0xFE, 0x7F, 0xE7, 0xCC, 0x78, 0x07, 0xC0, 0x7F, 0x83, 0xFC, 0x0F, 0xE0, 0x1F,
-    0x00, 0xF7, 0x1F, 0x7F, 0xE7, 0xFE, 0x7F, 0xC0, 0x0C, 0x07, 0x83, 0xF0, 0xFE, 0x13, 0x00, 0x03,
-    0xF9, 0xFE, 0x7F, 0x9E, 0x67, 0xF9, 0xFE, 0x3F, 0xD8, 0xF7, 0xFD, 0xFE, 0x7F, 0x00, 0x1F, 0xC3,
-    0xFE, 0x7F, 0xE7, 0xCC, 0x78, 0x07, 0xC0, 0x7F, 0x83, 0xFC, 0x0F, 0xE0, 0x1F, 0x00, 0xF7, 0x1F,
-    0x7F, 0xE7, 0xFE, 0x7F, 0xC0, 0xE0, 0x0F, 0x00, 0x70, 0x1F, 0x01, 0xF0, 0x3F, 0x9F, 0xE7, 0xF9,
-    0xE6, 0x7F, 0x9F, 0xE3, 0xFD, 0x8F, 0x7F, 0x9F, 0xE7, 0xF0, 0x70, 0x1E, 0x03, 0x83, 0xE0, 0xF0,
-    0x09, 0x81, 0xFC, 0x1F, 0x80, 0xF0, 0x06, 0x00, 0x00, 0x1F, 0xC3, 0xFE, 0x7F, 0xE7, 0xCC, 0x78,
-    0x07, 0xC0, 0x7F, 0x83, 0xFC, 0x0F, 0xE0, 0x1F, 0x00, 0xF7, 0x1F, 0x7F, 0xE7, 0xFE, 0x7F, 0xC0,
-    0x13, 0x0F, 0xE1, 0xF0, 0x78, 0x0C, 0x00, 0x03, 0xF9, 0xFE, 0x7F, 0x9E, 0x67, 0xF9, 0xFE, 0x3F,
-    0xD8, 0xF7, 0xFD, 0xFE, 0x7F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1E, 0x00, 0xF0, 0x07, 0x80,
-    0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x00, 0xE0,
-    0x07, 0x00, 0xFC, 0x07, 0xC0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xFA,
-    0xFF, 0x7F, 0x3F, 0x1C, 0x0E, 0x3E, 0x3C, 0x09, 0x80, 0xFE, 0x03, 0xE0, 0x1E, 0x00, 0x60, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01,
-    0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x00, 0x0F, 0x0E, 0xFE, 0xFE, 0xF0, 0xFF,
-    0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xFA, 0xFF, 0x7F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1E,
-    0x00, 0xF0, 0x07, 0x80, 0x3C, 0x0F, 0xFC, 0x7F, 0xE0, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07,
-    0x80, 0x3C, 0x00, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFA, 0xFF, 0x7F,
-    0x3F, 0x1E, 0xC1, 0xFE, 0x06, 0xF0, 0x00, 0x0F, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F,
-    0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC3, 0xFF, 0xBE, 0x7F, 0xF1, 0xFF, 0x07, 0xF0,
-    0x3D, 0x9F, 0xE7, 0xF0, 0x00, 0x00, 0x3C, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xFB,
-    0xFF, 0xF7, 0xFC, 0xFF, 0x1F, 0xC0, 0xFE, 0x00, 0x01, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE,
-    0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x7F, 0xF7, 0xCF, 0xFE, 0x3F, 0xE0,
-    0xFE, 0x00, 0x7F, 0x9F, 0xE0, 0x00, 0x00, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F,
-    0xEF, 0xFF, 0xDF, 0xF3, 0xFC, 0x1D, 0xC0, 0xFE, 0x03, 0xE0, 0x00, 0x0F, 0x07, 0xF8, 0x3F, 0xC1,
-    0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC3, 0xFF, 0xBE, 0x7F,
-    0xF1, 0xFF, 0x07, 0xF0, 0x7B, 0x8F, 0xE1, 0xF0, 0x00, 0x00, 0x3C, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC,
-    0xFF, 0x3F, 0xCF, 0xFB, 0xFF, 0xF7, 0xFC, 0xFF, 0x07, 0x00, 0x7C, 0x03, 0x60, 0x1B, 0x00, 0xF8,
-    0x07, 0x83, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1,
-    0xFE, 0x0F, 0xF0, 0xFF, 0xEF, 0x9F, 0xFC, 0x7F, 0xC1, 0xFC, 0x00, 0x1E, 0x07, 0xC3, 0xF0, 0xFC,
-    0x1F, 0x07, 0x80, 0x03, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0xBF, 0xFF, 0x7F,
-    0xCF, 0xF0, 0x06, 0x60, 0x77, 0x83, 0xB8, 0x3B, 0x81, 0x98, 0x00, 0x03, 0xC1, 0xFE, 0x0F, 0xF0,
-    0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0xFF, 0xEF, 0x9F,
-    0xFC, 0x7F, 0xC1, 0xFC, 0x00, 0x1C, 0xC3, 0xB8, 0xEE, 0x3D, 0xC3, 0x30, 0x00, 0x3C, 0xF7, 0x9E,
-    0xF3, 0xDE, 0x7B, 0xCF, 0x79, 0xEF, 0x3D, 0xF7, 0xBF, 0xF3, 0xFE, 0x3F, 0xC0, 0xF0, 0x7F, 0x83,
-    0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x3F, 0xFB,
-    0xE7, 0xFF, 0x1F, 0xF0, 0x7F, 0x00, 0xF0, 0x07, 0x00, 0x3E, 0x01, 0xF0, 0xF3, 0xFC, 0xFF, 0x3F,
-    0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xEF, 0xFF, 0xDF, 0xF3, 0xFC, 0x0E, 0x07, 0x01, 0xF0, 0x7C, 0x00,
-    0x60, 0x00, 0x0F, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x80, 0x01, 0x98, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0xFF, 0x80, 0x1F, 0x78, 0xF1, 0xE7, 0x8F, 0x1E, 0x78, 0xF9, 0xE7, 0x9F, 0x9E, 0x7D, 0xF9, 0xC3,
-    0xDF, 0xBC, 0x3F, 0xFF, 0xC3, 0xF9, 0xFC, 0x3F, 0x9F, 0x81, 0xF9, 0xF8, 0x1F, 0x0F, 0x81, 0xF0,
-    0xF8, 0x0F, 0x0F, 0x00, 0x01, 0x80, 0x01, 0xE0, 0x01, 0xF8, 0x00, 0xFE, 0x00, 0x66, 0x00, 0x00,
-    0x03, 0xC7, 0x1D, 0xE7, 0x9E, 0x73, 0xCF, 0x3D, 0xF7, 0x9E, 0xFB, 0x87, 0xFF, 0xC3, 0xFF, 0xE1,
-    0xFB, 0xE0, 0x79, 0xF0, 0x3C, 0xF8, 0x1E, 0x38, 0x00, 0x03, 0x00, 0x1E, 0x00, 0xFC, 0x07, 0xF0,
-    0x0C, 0xC0, 0x00, 0x0F, 0x83, 0xFE, 0x1E, 0x7C, 0x78, 0xF3, 0xC3, 0xFF, 0x07, 0xF8, 0x1F, 0xE0,
-    0x3F, 0x00, 0xF8, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x06, 0x00,
-    0xF0, 0x1F, 0x83, 0xF8, 0x19, 0x80, 0x00, 0xF0, 0xFF, 0x1E, 0x79, 0xE7, 0x9E, 0x7B, 0xC3, 0xFC,
-    0x3F, 0x81, 0xF8, 0x1F, 0x81, 0xF0, 0x0F, 0x01, 0xE0, 0xFE, 0x0F, 0xC0, 0xF8, 0x00, 0x1C, 0xE0,
-    0x7F, 0x81, 0xCE, 0x00, 0x00, 0xF8, 0x3F, 0xE1, 0xE7, 0xC7, 0x8F, 0x3C, 0x3F, 0xF0, 0x7F, 0x81,
-    0xFE, 0x03, 0xF0, 0x0F, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x00,
-    0x01, 0x00, 0x1C, 0x01, 0xE0, 0x1E, 0x00, 0xE0, 0x00, 0x01, 0xFF, 0xCF, 0xFE, 0x7F, 0xF0, 0x0F,
-    0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x07, 0x80, 0x7C, 0x07, 0xC0, 0x3C, 0x03, 0xE0, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x06, 0x01, 0xC0, 0xF0, 0x78, 0x1C, 0x00, 0x07, 0xFD, 0xFF, 0x7F, 0xC1, 0xE0,
-    0xF0, 0x78, 0x3C, 0x1E, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0x00, 0x78, 0x01, 0xC0, 0x00, 0x07,
-    0xFF, 0x3F, 0xF9, 0xFF, 0xC0, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x1E, 0x01, 0xF0, 0x1F, 0x00,
-    0xF0, 0x0F, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x0E, 0x07, 0x80, 0xE0, 0x00, 0x00, 0x1F, 0xF7,
-    0xFD, 0xFF, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x1F, 0xFF, 0xFF, 0xFF, 0x08, 0x80, 0xFE, 0x03,
-    0xE0, 0x0E, 0x00, 0x30, 0x00, 0x01, 0xFF, 0xCF, 0xFE, 0x7F, 0xF0, 0x0F, 0x80, 0xF8, 0x0F, 0x80,
-    0xF8, 0x07, 0x80, 0x7C, 0x07, 0xC0, 0x3C, 0x03, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x13,
-    0x0F, 0xE3, 0xF0, 0x78, 0x0C, 0x00, 0x07, 0xFD, 0xFF, 0x7F, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E,
-    0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0x3F, 0xBF, 0xDF, 0x6F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78,
-    0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0x7E, 0x7F, 0xF7, 0x0C, 0x03, 0x80, 0x78, 0x07, 0x80,
-    0x70, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xC0, 0x78, 0x0F, 0xFD, 0xFF, 0xBF, 0xF7, 0x80,
-    0xF0, 0x1E, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x3B, 0xCF, 0x78, 0xEF, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x1E, 0x03, 0xC0, 0x7F, 0xEF, 0xFD, 0xFF, 0xBC, 0x07, 0x80, 0xF0, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xF8, 0x7F, 0xFC, 0x3F, 0xFE, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x7F, 0xE0,
-    0x3F, 0xF8, 0x1F, 0xFE, 0x0F, 0x1F, 0x07, 0x83, 0x83, 0xC1, 0xE1, 0xE1, 0xE0, 0xF7, 0xF0, 0x7B,
-    0xF0, 0x3D, 0xF0, 0x02, 0x00, 0xE0, 0x3C, 0x0F, 0x00, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x00,
-    0x0F, 0xF1, 0xFF, 0xDF, 0xFC, 0xF8, 0xEF, 0x80, 0x78, 0x03, 0xFF, 0x1F, 0xF8, 0xFF, 0xC7, 0x80,
-    0x3E, 0x00, 0xF8, 0xE7, 0xFF, 0x1F, 0xFC, 0x7F, 0xC0, 0x1F, 0xC3, 0xFE, 0x7F, 0xE7, 0xCC, 0x78,
-    0x07, 0xC0, 0x7F, 0x83, 0xFC, 0x0F, 0xE0, 0x1F, 0x00, 0xF7, 0x1F, 0x7F, 0xE7, 0xFE, 0x7F, 0xC0,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF7, 0x7B, 0xFD, 0xC0, 0x03, 0xC1, 0xE0, 0xF0,
-    0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x00, 0x03, 0xC0,
-    0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3D, 0x9F, 0xFF, 0xFF, 0xE7,
-    0xF0, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x78, 0xF0, 0x00, 0xF1, 0xE0, 0x01,
-    0xE3, 0xFF, 0x03, 0xC7, 0xFF, 0x07, 0x8F, 0xFF, 0x0F, 0x1E, 0x7E, 0x1E, 0x3C, 0x3C, 0x78, 0x78,
-    0x7B, 0xF0, 0xF1, 0xFF, 0xC1, 0xFF, 0xFF, 0x83, 0xFF, 0xBC, 0x07, 0xFC, 0x00, 0xF0, 0x78, 0x07,
-    0x83, 0xC0, 0x3C, 0x1E, 0x01, 0xE0, 0xF0, 0x0F, 0x07, 0x80, 0x7F, 0xFF, 0xE3, 0xFF, 0xFF, 0xDF,
-    0xFF, 0xFE, 0xF0, 0x79, 0xFF, 0x83, 0xC3, 0xFC, 0x1E, 0x1F, 0xE0, 0xF3, 0xFF, 0x07, 0xFF, 0x78,
-    0x3F, 0xFB, 0xC1, 0xFF, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
-    0x00, 0x0F, 0xFC, 0x0F, 0xFE, 0x0F, 0xFE, 0x0F, 0x3F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-    0x0F, 0x0F, 0x0F, 0x01, 0x80, 0x07, 0x00, 0x3C, 0x01, 0xE0, 0x07, 0x00, 0x00, 0x0F, 0x0F, 0xBC,
-    0x7C, 0xF3, 0xE3, 0xDF, 0x0F, 0xF8, 0x3F, 0xC0, 0xFE, 0x03, 0xFC, 0x0F, 0xF8, 0x3D, 0xF0, 0xF3,
-    0xC3, 0xCF, 0x8F, 0x1F, 0x3C, 0x3C, 0xF0, 0xF8, 0x06, 0x00, 0x3C, 0x00, 0xF8, 0x00, 0xE0, 0x01,
-    0x80, 0x00, 0x0F, 0x03, 0xFC, 0x1F, 0xF0, 0xFF, 0xC7, 0xFF, 0x1F, 0xFC, 0xFF, 0xF7, 0xBF, 0xDE,
-    0xFF, 0xF3, 0xFF, 0x8F, 0xFE, 0x3F, 0xF0, 0xFF, 0x83, 0xFE, 0x0F, 0xF0, 0x3C, 0x0C, 0xC0, 0x7B,
-    0x80, 0xFE, 0x01, 0xF0, 0x00, 0x03, 0xE1, 0xF7, 0x87, 0x9F, 0x1E, 0x3C, 0x78, 0xF3, 0xC1, 0xEF,
-    0x07, 0xB8, 0x0F, 0xE0, 0x3F, 0x80, 0x7C, 0x01, 0xF0, 0x4F, 0x81, 0xFE, 0x07, 0xF0, 0x1F, 0x80,
-    0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83,
-    0xFC, 0x1F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x07,
-    0xC0, 0x0F, 0x80, 0x1F, 0x80, 0x7F, 0x00, 0xFE, 0x03, 0xDE, 0x07, 0xBC, 0x0E, 0x3C, 0x3C, 0x78,
-    0x7F, 0xF1, 0xFF, 0xF3, 0xFF, 0xE7, 0x83, 0xDE, 0x03, 0xFC, 0x07, 0x80, 0xFF, 0xEF, 0xFE, 0xFF,
-    0xEF, 0x00, 0xF0, 0x0F, 0xF8, 0xFF, 0xEF, 0xFF, 0xF3, 0xFF, 0x0F, 0xF0, 0xFF, 0x3F, 0xFF, 0xEF,
-    0xFE, 0xFF, 0x80, 0xFF, 0xC7, 0xFF, 0x3F, 0xFD, 0xE3, 0xEF, 0x1F, 0x7F, 0xF3, 0xFF, 0x9F, 0xFE,
-    0xF1, 0xF7, 0x87, 0xBC, 0x3D, 0xE3, 0xEF, 0xFF, 0x7F, 0xF3, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C,
-    0x00, 0x0F, 0xFE, 0x07, 0xFF, 0x03, 0xFF, 0x81, 0xE3, 0xC0, 0xF1, 0xE0, 0x78, 0xF0, 0x3C, 0x78,
-    0x1E, 0x3C, 0x0F, 0x1E, 0x0F, 0x0F, 0x07, 0x87, 0x87, 0xC3, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xF0, 0x07, 0xF8, 0x03, 0xFC, 0x01, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F,
-    0x01, 0xE0, 0x3F, 0xF7, 0xFE, 0xFF, 0xDE, 0x03, 0xC0, 0x78, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
-    0xF0, 0xF3, 0xE7, 0x8F, 0x8F, 0x3C, 0xF8, 0x7D, 0xEF, 0x81, 0xFF, 0x7C, 0x07, 0xFF, 0xC0, 0x1F,
-    0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x7F, 0xFC, 0x07, 0xFD, 0xF0, 0x7D, 0xE7, 0xC7, 0xCF,
-    0x1E, 0x3C, 0x78, 0xFB, 0xE3, 0xC3, 0xE0, 0x3F, 0x87, 0xFE, 0x7F, 0xE3, 0x1F, 0x01, 0xF0, 0x3E,
-    0x1F, 0xE1, 0xFE, 0x1F, 0xF0, 0x1F, 0x00, 0xF7, 0x1F, 0x7F, 0xFF, 0xFE, 0x7F, 0xC0, 0xF0, 0x3F,
-    0xC1, 0xFF, 0x0F, 0xFC, 0x7F, 0xF1, 0xFF, 0xCF, 0xFF, 0x7B, 0xFD, 0xEF, 0xFF, 0x3F, 0xF8, 0xFF,
-    0xE3, 0xFF, 0x0F, 0xF8, 0x3F, 0xE0, 0xFF, 0x03, 0xC0, 0x0C, 0xC0, 0x7B, 0x80, 0xFE, 0x01, 0xF0,
-    0x00, 0x03, 0xC0, 0xFF, 0x07, 0xFC, 0x3F, 0xF1, 0xFF, 0xC7, 0xFF, 0x3F, 0xFD, 0xEF, 0xF7, 0xBF,
-    0xFC, 0xFF, 0xE3, 0xFF, 0x8F, 0xFC, 0x3F, 0xE0, 0xFF, 0x83, 0xFC, 0x0F, 0xF0, 0xFB, 0xC7, 0xCF,
-    0x3E, 0x3D, 0xF0, 0xFF, 0x83, 0xFC, 0x0F, 0xE0, 0x3F, 0xC0, 0xFF, 0x83, 0xDF, 0x0F, 0x3C, 0x3C,
-    0xF8, 0xF1, 0xF3, 0xC3, 0xCF, 0x0F, 0x80, 0x07, 0xFE, 0x0F, 0xFC, 0x1F, 0xF8, 0x78, 0xF0, 0xF1,
-    0xE1, 0xE3, 0xC3, 0xC7, 0x87, 0x8F, 0x0F, 0x1E, 0x1E, 0x3C, 0x78, 0x7B, 0xF0, 0xFF, 0xC1, 0xFF,
-    0x83, 0xFC, 0x07, 0x80, 0x78, 0x0F, 0x3E, 0x0F, 0x9F, 0x07, 0xCF, 0xC7, 0xE7, 0xE3, 0xF7, 0xF1,
-    0xFB, 0xFD, 0xFD, 0xEE, 0xEF, 0xF7, 0xF7, 0xFB, 0xF3, 0xFC, 0xF9, 0xFE, 0x7C, 0xFF, 0x1C, 0x7F,
-    0x80, 0x3F, 0xC0, 0x1E, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xE0, 0x0F, 0xE0, 0x7F,
-    0xE1, 0xFF, 0xE3, 0xE7, 0xEF, 0x83, 0xDE, 0x07, 0xFC, 0x07, 0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x7F,
-    0xE0, 0xF3, 0xE7, 0xE7, 0xFF, 0x87, 0xFF, 0x03, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8,
-    0x3F, 0xC1, 0xE0, 0xFF, 0xCF, 0xFE, 0xFF, 0xFF, 0x1F, 0xF0, 0xFF, 0x0F, 0xF3, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xFC, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x00, 0x0F, 0xF1, 0xFF, 0x9F, 0xFC, 0xFD,
-    0xEF, 0x80, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3E, 0x01, 0xF8, 0xE7, 0xFF, 0x1F,
-    0xF8, 0x7F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0,
-    0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x00, 0xF8, 0x7D, 0xE1, 0xE7,
-    0xC7, 0x8F, 0x1E, 0x3C, 0xF0, 0x7B, 0xC1, 0xEE, 0x03, 0xF8, 0x0F, 0xE0, 0x1F, 0x00, 0x7C, 0x13,
-    0xE0, 0x7F, 0x81, 0xFC, 0x07, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x78, 0x00, 0xFF, 0xC0, 0x7F, 0xFC,
-    0x3F, 0xFF, 0x1F, 0xFF, 0xE7, 0x9E, 0x79, 0xE7, 0x8F, 0x79, 0xE3, 0xDE, 0x79, 0xE7, 0xFF, 0xF8,
-    0xFF, 0xFE, 0x1F, 0xFF, 0x03, 0xFF, 0x00, 0x1E, 0x00, 0x07, 0x80, 0xF8, 0x7D, 0xF1, 0xE3, 0xCF,
-    0x8F, 0xFC, 0x1F, 0xE0, 0x3F, 0x80, 0xFC, 0x01, 0xF0, 0x0F, 0xC0, 0x7F, 0x81, 0xFF, 0x0F, 0xFC,
-    0x7C, 0xF9, 0xE1, 0xFF, 0x87, 0xC0, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78,
-    0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0xF0, 0x7F, 0x83, 0xFC,
-    0x1F, 0xE0, 0xFF, 0x87, 0xBC, 0x3D, 0xF1, 0xEF, 0xFF, 0x3F, 0xF8, 0xFF, 0xC0, 0x1E, 0x00, 0xF0,
-    0x07, 0x80, 0x3C, 0x01, 0xE0, 0xF0, 0xF1, 0xFE, 0x1E, 0x3F, 0xC3, 0xC7, 0xF8, 0x78, 0xFF, 0x0F,
-    0x1F, 0xE1, 0xE3, 0xFC, 0x3C, 0x7F, 0x87, 0x8F, 0xF0, 0xF1, 0xFE, 0x1E, 0x3F, 0xC3, 0xC7, 0xF8,
-    0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xF1, 0xE3, 0xC3, 0xC7, 0x8F, 0x0F,
-    0x1E, 0x3C, 0x3C, 0x78, 0xF0, 0xF1, 0xE3, 0xC3, 0xC7, 0x8F, 0x0F, 0x1E, 0x3C, 0x3C, 0x78, 0xF0,
-    0xF1, 0xE3, 0xC3, 0xC7, 0x8F, 0x0F, 0x1E, 0x3C, 0x3C, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0xFF, 0x00,
-    0xFF, 0x00, 0xFF, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0xF8, 0x0F, 0xFC, 0x0F, 0xFE, 0x0F, 0x3E,
-    0x0F, 0x1F, 0x0F, 0x1F, 0x0F, 0x3E, 0x0F, 0xFE, 0x0F, 0xFC, 0x0F, 0xF8, 0xF0, 0x07, 0xF8, 0x03,
-    0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0xFC, 0x3F, 0xFF, 0x9F, 0xFF, 0xCF, 0xF3, 0xF7, 0xF8,
-    0x7B, 0xFC, 0x3D, 0xFE, 0x7E, 0xFF, 0xFE, 0x7F, 0xFF, 0x3F, 0xFE, 0x1E, 0xF0, 0x0F, 0x00, 0xF0,
-    0x0F, 0x00, 0xF0, 0x0F, 0xFC, 0xFF, 0xEF, 0xFF, 0xF3, 0xFF, 0x0F, 0xF0, 0xFF, 0x3F, 0xFF, 0xFF,
-    0xFE, 0xFF, 0x80, 0x3F, 0xC1, 0xFF, 0x87, 0xFF, 0x1C, 0x7E, 0x00, 0x78, 0x01, 0xE1, 0xFF, 0xC7,
-    0xFF, 0x1F, 0xFC, 0x01, 0xE0, 0x07, 0x9C, 0x7E, 0x7F, 0xF1, 0xFF, 0x83, 0xFC, 0x00, 0xF0, 0x3F,
-    0x87, 0x83, 0xFF, 0x3C, 0x3F, 0xF9, 0xE3, 0xF3, 0xEF, 0x1E, 0x0F, 0xF9, 0xF0, 0x3F, 0xFF, 0x01,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0x7F, 0x9F, 0x03, 0xFC, 0x78, 0x3F, 0xE3, 0xF3, 0xEF, 0x0F, 0xFF,
-    0x78, 0x7F, 0xF3, 0xC0, 0xFE, 0x00, 0x0F, 0xF8, 0xFF, 0xCF, 0xFE, 0x7C, 0xF7, 0x87, 0xBC, 0x3D,
-    0xF9, 0xE7, 0xFF, 0x3F, 0xF8, 0xFF, 0xC7, 0x9E, 0x7C, 0xF3, 0xC7, 0xBE, 0x3D, 0xE1, 0xE0, 0x3F,
-    0x87, 0xF8, 0xFF, 0x19, 0xF3, 0xFE, 0xFF, 0xDE, 0x7F, 0xCF, 0x7F, 0xEF, 0xFC, 0xFF, 0x00, 0x03,
-    0xE0, 0xFE, 0x1F, 0xE3, 0xFC, 0x7C, 0x07, 0xFC, 0x7F, 0xE7, 0xFE, 0x79, 0xF7, 0x8F, 0x78, 0xF7,
-    0x8F, 0x7D, 0xF7, 0xFE, 0x3F, 0xE1, 0xF8, 0xFF, 0x9F, 0xFB, 0xFF, 0x79, 0xEF, 0xFD, 0xFF, 0xBC,
-    0x7F, 0x8F, 0xFF, 0xFF, 0xFB, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0x07, 0x83, 0xC1, 0xE0,
-    0xF0, 0x78, 0x3C, 0x00, 0x1F, 0xF0, 0x7F, 0xC1, 0xFF, 0x07, 0xBC, 0x1E, 0xF0, 0x73, 0xC3, 0xCF,
-    0x0F, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x70, 0x1F, 0x83, 0xFE,
-    0x7F, 0xE7, 0x9F, 0x7F, 0xF7, 0xFF, 0x78, 0x07, 0xC6, 0x7F, 0xE3, 0xFE, 0x1F, 0xE0, 0xF9, 0xE7,
-    0x9F, 0x7B, 0xE3, 0xDF, 0xF0, 0x7F, 0xF8, 0x1F, 0xFC, 0x03, 0xFF, 0x01, 0xFF, 0xE0, 0xFF, 0xF8,
-    0x3D, 0xEF, 0x1E, 0x79, 0xEF, 0x9E, 0x7C, 0x7F, 0x1F, 0xE7, 0xFD, 0x9F, 0x3F, 0x8F, 0xE0, 0x3D,
-    0x8F, 0x7F, 0xFF, 0xE7, 0xF0, 0xF1, 0xFE, 0x7F, 0xDF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF,
-    0xF9, 0xFF, 0x3F, 0xC7, 0x80, 0x31, 0x87, 0x70, 0xFE, 0x0F, 0x80, 0x00, 0x00, 0x3C, 0x7F, 0x9F,
-    0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFE, 0x7F, 0xCF, 0xF1, 0xE0, 0xF3, 0xEF, 0x7C,
-    0xFF, 0x8F, 0xF0, 0xFE, 0x0F, 0xE0, 0xFF, 0x0F, 0xF8, 0xF7, 0xCF, 0x3C, 0xF1, 0xE0, 0x1F, 0xF1,
-    0xFF, 0x1F, 0xF1, 0xEF, 0x1E, 0xF1, 0xEF, 0x3C, 0xF7, 0xCF, 0xFC, 0xFF, 0x8F, 0xF0, 0xF0, 0x70,
-    0x39, 0xE1, 0xEF, 0x8F, 0xFF, 0x3F, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF7, 0xBF, 0xDE,
-    0xFF, 0x03, 0xC0, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xF3, 0xFC, 0xFF,
-    0x3C, 0x1F, 0xC3, 0xFE, 0x7F, 0xE7, 0xDF, 0x78, 0xF7, 0x8F, 0x78, 0xF7, 0xDF, 0x7F, 0xE3, 0xFE,
-    0x1F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3C,
-    0xFF, 0x1F, 0xFB, 0xFF, 0x79, 0xFF, 0x1F, 0xE3, 0xFC, 0x7F, 0x9F, 0xFF, 0xDF, 0xFB, 0xFE, 0x78,
-    0x0F, 0x01, 0xE0, 0x3C, 0x00, 0x1F, 0xCF, 0xF7, 0xFD, 0xF2, 0x78, 0x1E, 0x07, 0x81, 0xF3, 0x7F,
-    0xCF, 0xF1, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01,
-    0xC0, 0x38, 0x00, 0xF0, 0xFF, 0x1E, 0x79, 0xE7, 0x9E, 0x7B, 0xC3, 0xFC, 0x3F, 0x81, 0xF8, 0x1F,
-    0x81, 0xF0, 0x0F, 0x01, 0xE0, 0xFE, 0x0F, 0xC0, 0xF8, 0x00, 0x01, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
-    0x03, 0xC0, 0x03, 0xC0, 0x0F, 0xF8, 0x3F, 0xFC, 0x7F, 0xFE, 0x7F, 0xDF, 0x7B, 0xCF, 0x7B, 0xCF,
-    0x7B, 0xCF, 0x7F, 0xDF, 0x7F, 0xFE, 0x3F, 0xFC, 0x0F, 0xF8, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
-    0x03, 0xC0, 0xF1, 0xE7, 0x9E, 0x3F, 0xC3, 0xF8, 0x1F, 0x80, 0xF0, 0x1F, 0x83, 0xFC, 0x7B, 0xC7,
-    0x9E, 0xF1, 0xF0, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x00, 0x70, 0x07, 0x71, 0xEE, 0x3D, 0xC7, 0xB8, 0xF7, 0x9E, 0xFF,
-    0xDF, 0xF9, 0xFF, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF3, 0xCF, 0xF3, 0xCF, 0xF3, 0xCF, 0xF3, 0xCF,
-    0xF3, 0xCF, 0xF3, 0xCF, 0xF3, 0xCF, 0xF3, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xCF,
-    0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0xFE, 0x07,
-    0xF0, 0x3F, 0x80, 0x3C, 0x01, 0xFE, 0x0F, 0xF8, 0x7F, 0xE3, 0xCF, 0x1F, 0xF8, 0xFF, 0xC7, 0xF8,
-    0xF0, 0x1F, 0xE0, 0x3F, 0xC0, 0x7F, 0x80, 0xFF, 0xF9, 0xFF, 0xFB, 0xFF, 0xF7, 0xF9, 0xEF, 0xFF,
-    0xDF, 0xFF, 0xBF, 0xFE, 0x78, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0xF9, 0xFF, 0xBF, 0xF7, 0x9E,
-    0xFF, 0xDF, 0xFB, 0xFE, 0x00, 0x7F, 0x0F, 0xF1, 0xFF, 0x31, 0xE3, 0xFC, 0x7F, 0xC0, 0xF3, 0x3E,
-    0x7F, 0xDF, 0xF3, 0xFC, 0x00, 0xF0, 0xFC, 0x78, 0xFF, 0x3C, 0xFF, 0xDE, 0x7D, 0xEF, 0xFC, 0x7F,
-    0xFC, 0x3F, 0xFF, 0x1F, 0xE7, 0x9E, 0xF3, 0xFF, 0x78, 0xFF, 0x3C, 0x3F, 0x00, 0x1F, 0xE7, 0xFD,
-    0xFF, 0xBC, 0xF7, 0x9E, 0xFF, 0xDF, 0xF9, 0xFF, 0x3D, 0xEF, 0x3D, 0xE7, 0x80, 0x0C, 0x00, 0xE0,
-    0x0F, 0x00, 0x78, 0x03, 0x00, 0x00, 0x1F, 0x83, 0xFE, 0x7F, 0xE7, 0x9F, 0x7F, 0xF7, 0xFF, 0x78,
-    0x07, 0xC6, 0x7F, 0xE3, 0xFE, 0x1F, 0xE0, 0x3D, 0xC3, 0xDE, 0x3D, 0xC0, 0x00, 0x00, 0x01, 0xF8,
-    0x3F, 0xE7, 0xFE, 0x79, 0xF7, 0xFF, 0x7F, 0xF7, 0x80, 0x7C, 0x67, 0xFE, 0x3F, 0xE1, 0xFE, 0x78,
-    0x07, 0x80, 0xFF, 0x0F, 0xF0, 0x78, 0x07, 0xFC, 0x7F, 0xE7, 0xFE, 0x79, 0xE7, 0x8F, 0x78, 0xF7,
-    0x8F, 0x78, 0xF7, 0x8F, 0x78, 0xF7, 0x8F, 0x01, 0xF0, 0x7E, 0x07, 0xE0, 0x7C, 0x0C, 0x07, 0x07,
-    0x87, 0x83, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0,
-    0x00, 0x1F, 0xC7, 0xF9, 0xFF, 0x3C, 0x6F, 0xF1, 0xFE, 0x3C, 0x03, 0xE6, 0x7F, 0xC7, 0xFC, 0x7F,
-    0x00, 0x3F, 0x9F, 0xE7, 0xF9, 0xE6, 0x7F, 0x9F, 0xE3, 0xFD, 0x8F, 0x7F, 0xDF, 0xE7, 0xF0, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x73, 0xBF, 0xDC, 0xE0, 0x00, 0x00, 0xF0, 0x78, 0x3C,
-    0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x3C, 0x78, 0xF0, 0x03, 0xC7, 0x8F,
-    0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1F, 0xFF, 0xF7, 0xC0, 0x1F, 0xF0, 0x03, 0xFE, 0x00,
-    0x7F, 0xC0, 0x0F, 0x78, 0x01, 0xEF, 0xF8, 0x3D, 0xFF, 0x8F, 0x3F, 0xF3, 0xE7, 0x9F, 0xFC, 0xFF,
-    0xDF, 0x1F, 0xFB, 0xC3, 0xFE, 0x00, 0xF3, 0xC0, 0x79, 0xE0, 0x3C, 0xF0, 0x1E, 0x78, 0x0F, 0xFF,
-    0xE7, 0xFF, 0xFB, 0xFF, 0xFF, 0xE7, 0x9F, 0xF3, 0xFF, 0xF9, 0xFF, 0xBC, 0x7F, 0x80, 0x78, 0x07,
-    0x80, 0xFF, 0x0F, 0xF0, 0x78, 0x07, 0xFC, 0x7F, 0xE7, 0xFE, 0x79, 0xE7, 0x8F, 0x78, 0xF7, 0x8F,
-    0x78, 0xF7, 0x8F, 0x78, 0xF7, 0x8F, 0x02, 0x00, 0x70, 0x0F, 0x01, 0xE0, 0x0C, 0x00, 0x00, 0xF3,
-    0xEF, 0x7C, 0xFF, 0x8F, 0xF0, 0xFE, 0x0F, 0xE0, 0xFF, 0x0F, 0xF8, 0xF7, 0xCF, 0x3C, 0xF1, 0xE0,
-    0x18, 0x07, 0x80, 0xF0, 0x0F, 0x00, 0xE0, 0x00, 0x3C, 0x7F, 0x9F, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFB, 0xFE, 0x7F, 0xCF, 0xF1, 0xE0, 0x19, 0x83, 0xBC, 0x3F, 0x81, 0xF0, 0x00, 0x00,
-    0x00, 0xF0, 0xFF, 0x1E, 0x79, 0xE7, 0x9E, 0x7B, 0xC3, 0xFC, 0x3F, 0x81, 0xF8, 0x1F, 0x81, 0xF0,
-    0x0F, 0x01, 0xE0, 0xFE, 0x0F, 0xC0, 0xF8, 0x00, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF,
-    0x3F, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0x78, 0x1E, 0x07, 0x80, 0x1E, 0x00, 0x3C, 0x03, 0xFF, 0x87,
-    0xFF, 0x0F, 0xFE, 0x03, 0xC0, 0x07, 0xFC, 0x0F, 0xFE, 0x1F, 0xFE, 0x3C, 0xFC, 0x78, 0x78, 0xF0,
-    0xF1, 0xE7, 0xE3, 0xFF, 0x87, 0xFF, 0x0F, 0xF8, 0x1C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0,
-    0x7F, 0xE3, 0xFF, 0x1F, 0xF8, 0x3C, 0x01, 0xE0, 0x0F, 0xF8, 0x7F, 0xE3, 0xCF, 0x9F, 0xFC, 0xFF,
-    0xC3, 0xFC, 0x0F, 0xE0, 0x7F, 0xE1, 0xFF, 0xE3, 0xE7, 0xEF, 0x03, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFB, 0xFF, 0xE0, 0x7F, 0xE0, 0xF3, 0xF7, 0xE7, 0xFF, 0x87, 0xFF, 0x03, 0xF8, 0x00, 0x1F,
-    0xC3, 0xFE, 0x7F, 0xE7, 0xDF, 0x7E, 0xF7, 0xFF, 0x7F, 0xF7, 0xDF, 0x7F, 0xE3, 0xFE, 0x1F, 0xC0,
-    0xF0, 0x0F, 0xBE, 0x07, 0xE7, 0x83, 0xF9, 0xE0, 0xF4, 0x7C, 0x3C, 0x0F, 0x1E, 0x03, 0xC7, 0x80,
-    0x7B, 0xC0, 0x1E, 0xF0, 0x07, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xC0, 0x01, 0xF0, 0x00,
-    0x7C, 0x00, 0xF0, 0xFF, 0x8F, 0xDE, 0x7E, 0xF3, 0x87, 0xBC, 0x1D, 0xE0, 0xFE, 0x03, 0xF0, 0x1F,
-    0x00, 0xF8, 0x03, 0xC0, 0x1E, 0xE0, 0x0F, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0xF0, 0x3C, 0xF0, 0x7C,
+static const uint8_t ubuntu_10_boldBitmaps[17640] = {
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF,
+    0xFF, 0xEF, 0xEF, 0xE7, 0xE7, 0x1E, 0xF0, 0x1E, 0xF0, 0x1C, 0xF0, 0x1C, 0xE0, 0xFF, 0xF8, 0xFF,
+    0xF8, 0x3D, 0xE0, 0x39, 0xE0, 0x39, 0xC0, 0xFF, 0xF8, 0xFF, 0xF8, 0x7B, 0xC0, 0x7B, 0xC0, 0x73,
+    0xC0, 0x73, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0xE0, 0x3F, 0xE0, 0x7F, 0xC0, 0x79, 0xC0, 0x78,
+    0x00, 0x7F, 0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0x07, 0xE0, 0x01, 0xE0, 0x71, 0xE0, 0x7F, 0xE0, 0x7F,
+    0xE0, 0x7F, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x3E, 0x0E, 0x00, 0x7F, 0x1E, 0x00, 0x77,
+    0x3C, 0x00, 0xF7, 0xBC, 0x00, 0xF7, 0xF8, 0x00, 0x77, 0x78, 0x00, 0x7F, 0xF0, 0x00, 0x3E, 0xEF,
+    0x80, 0x01, 0xFF, 0xC0, 0x01, 0xDD, 0xE0, 0x03, 0xDC, 0xE0, 0x03, 0x9C, 0xE0, 0x07, 0x9D, 0xE0,
+    0x0F, 0x1F, 0xC0, 0x0F, 0x0F, 0x80, 0x1F, 0x80, 0x3F, 0xC0, 0x3F, 0xE0, 0x3D, 0xE0, 0x3D, 0xE0,
+    0x3F, 0xC0, 0x1F, 0x80, 0x3F, 0xBC, 0x7F, 0xBC, 0x73, 0xF8, 0xF1, 0xF8, 0xF8, 0xF8, 0x7F, 0xF8,
+    0x7F, 0xFC, 0x3F, 0xDE, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0x1C, 0x1E, 0x3C, 0x3C, 0x78, 0x78,
+    0x70, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x70, 0x78, 0x78, 0x3C, 0x3C, 0x1E, 0x1C, 0x60, 0xF0,
+    0xF0, 0x78, 0x78, 0x3C, 0x3C, 0x3C, 0x3C, 0x1C, 0x1C, 0x3C, 0x3C, 0x3C, 0x3C, 0x78, 0x78, 0xF0,
+    0xF0, 0x60, 0x0E, 0x00, 0x0E, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x7F, 0xC0, 0x3F, 0x00, 0x3F, 0x80,
+    0x1B, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0,
+    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x78, 0x78, 0x78, 0x70, 0xF0, 0xF0, 0xFE, 0xFE,
+    0xFE, 0x70, 0xF8, 0xF8, 0x70, 0x01, 0xE0, 0x01, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x07,
+    0x80, 0x07, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x3C,
+    0x00, 0x3C, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x1F, 0x80, 0x3F,
+    0xC0, 0x7F, 0xE0, 0x7B, 0xE0, 0x79, 0xE0, 0xF1, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1,
+    0xE0, 0x79, 0xE0, 0x7B, 0xE0, 0x7F, 0xE0, 0x3F, 0xC0, 0x1F, 0x80, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF,
+    0x7F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x3F, 0x80, 0x7F, 0xC0, 0x7F, 0xE0,
+    0x7B, 0xE0, 0x21, 0xE0, 0x01, 0xC0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00,
+    0x78, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x7F, 0xE0, 0x3F, 0x80, 0x7F, 0xC0, 0x7F, 0xC0, 0x73, 0xC0,
+    0x03, 0xC0, 0x07, 0xC0, 0x1F, 0x80, 0x1F, 0xC0, 0x03, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x63, 0xE0,
+    0x7F, 0xC0, 0xFF, 0xC0, 0x7F, 0x80, 0x03, 0xC0, 0x07, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x1F, 0xC0,
+    0x3F, 0xC0, 0x3B, 0xC0, 0x7B, 0xC0, 0xF3, 0xC0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x03, 0xC0,
+    0x03, 0xC0, 0x03, 0xC0, 0x3F, 0xE0, 0x3F, 0xE0, 0x3F, 0xE0, 0x38, 0x00, 0x38, 0x00, 0x3F, 0x00,
+    0x7F, 0xC0, 0x7F, 0xC0, 0x0F, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x63, 0xE0, 0x7F, 0xC0, 0x7F, 0xC0,
+    0x7F, 0x80, 0x03, 0xC0, 0x0F, 0xE0, 0x1F, 0xE0, 0x3F, 0x80, 0x78, 0x00, 0x7F, 0x80, 0x7F, 0xE0,
+    0x7F, 0xE0, 0xF9, 0xE0, 0xF0, 0xF0, 0x78, 0xE0, 0x7D, 0xE0, 0x7F, 0xE0, 0x3F, 0xC0, 0x1F, 0x80,
+    0x7F, 0xE0, 0x7F, 0xE0, 0x7F, 0xE0, 0x03, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x07, 0x00,
+    0x0F, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1F, 0x80,
+    0x3F, 0xC0, 0x7F, 0xE0, 0x79, 0xE0, 0x79, 0xE0, 0x79, 0xE0, 0x7F, 0xC0, 0x3F, 0xC0, 0x3F, 0xE0,
+    0x7B, 0xE0, 0x70, 0xE0, 0x79, 0xE0, 0x7F, 0xE0, 0x7F, 0xE0, 0x3F, 0x80, 0x1F, 0x80, 0x3F, 0xC0,
+    0x7F, 0xE0, 0xFB, 0xE0, 0xF1, 0xE0, 0xF1, 0xE0, 0xF9, 0xE0, 0x7F, 0xE0, 0x7F, 0xE0, 0x3F, 0xE0,
+    0x01, 0xE0, 0x0F, 0xC0, 0x7F, 0xC0, 0x7F, 0x00, 0x7E, 0x00, 0x70, 0xF8, 0xF8, 0x70, 0x00, 0x00,
+    0x00, 0x70, 0xF8, 0xF8, 0x70, 0x70, 0xF8, 0xF8, 0x70, 0x00, 0x00, 0x00, 0x00, 0x78, 0x78, 0x78,
+    0x70, 0xF0, 0xF0, 0x01, 0xC0, 0x0F, 0xC0, 0x3F, 0xC0, 0xFF, 0x80, 0xFE, 0x00, 0xF0, 0x00, 0xFE,
+    0x00, 0xFF, 0x80, 0x3F, 0xC0, 0x0F, 0xC0, 0x01, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x7F,
+    0xC0, 0x1F, 0xC0, 0x07, 0xC0, 0x1F, 0xC0, 0x7F, 0xC0, 0xFF, 0x00, 0xFC, 0x00, 0xE0, 0x00, 0x7F,
+    0x00, 0xFF, 0x80, 0xFF, 0x80, 0x67, 0x80, 0x07, 0x80, 0x07, 0x80, 0x0F, 0x80, 0x1F, 0x00, 0x1E,
+    0x00, 0x3C, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x07,
+    0xFC, 0x00, 0x1F, 0xFF, 0x00, 0x3F, 0x1F, 0x80, 0x7C, 0x07, 0xC0, 0x73, 0xFD, 0xC0, 0xF7, 0xFD,
+    0xC0, 0xE7, 0xBD, 0xE0, 0xEF, 0x3C, 0xE0, 0xEF, 0x3C, 0xE0, 0xEF, 0x3D, 0xE0, 0xEF, 0x3D, 0xC0,
+    0xE7, 0xBD, 0xC0, 0xF7, 0xFF, 0x80, 0x73, 0xFF, 0x00, 0x78, 0x00, 0x00, 0x3F, 0x18, 0x00, 0x1F,
+    0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x1E,
+    0xF0, 0x1E, 0xF0, 0x1C, 0x78, 0x3C, 0x78, 0x3F, 0xF8, 0x7F, 0xFC, 0x7F, 0xFC, 0x78, 0x3C, 0xF0,
+    0x1E, 0xF0, 0x1E, 0xFF, 0xC0, 0xFF, 0xE0, 0xFF, 0xF0, 0xF1, 0xF0, 0xF1, 0xF0, 0xFF, 0xE0, 0xFF,
+    0xE0, 0xFF, 0xF0, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF0, 0xFF, 0xF0, 0xFF, 0xE0, 0xFF,
+    0xC0, 0x0F, 0xF0, 0x3F, 0xF0, 0x7F, 0xF0, 0x7E, 0xF0, 0xF8, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0xFC, 0x70, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0xFF,
+    0xC0, 0xFF, 0xE0, 0xFF, 0xF0, 0xF1, 0xF8, 0xF0, 0x78, 0xF0, 0x7C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0,
+    0x3C, 0xF0, 0x7C, 0xF0, 0x78, 0xF1, 0xF8, 0xFF, 0xF0, 0xFF, 0xE0, 0xFF, 0xC0, 0xFF, 0xE0, 0xFF,
+    0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF,
+    0xE0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x0F, 0xF0, 0x3F, 0xF0, 0x7F, 0xF0, 0x7E,
+    0x70, 0xF8, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF8, 0x78, 0x7C,
+    0x78, 0x7F, 0xF8, 0x3F, 0xF8, 0x1F, 0xF0, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0,
+    0x78, 0xF0, 0x78, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0,
+    0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+    0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x67, 0xC0, 0xFF, 0xC0, 0xFF, 0x80,
+    0x7F, 0x00, 0xF0, 0xF8, 0xF1, 0xF0, 0xF3, 0xE0, 0xF7, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xFE, 0x00,
+    0xFF, 0x00, 0xFF, 0x80, 0xF7, 0xC0, 0xF3, 0xC0, 0xF3, 0xE0, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x78, 0x0F,
+    0x00, 0x7C, 0x1F, 0x00, 0x7C, 0x1F, 0x00, 0x7E, 0x3F, 0x00, 0x7E, 0x3F, 0x00, 0xFE, 0x3F, 0x00,
+    0xFF, 0x7F, 0x00, 0xF7, 0x77, 0x80, 0xF7, 0xF7, 0x80, 0xF7, 0xE7, 0x80, 0xF3, 0xE7, 0x80, 0xF3,
+    0xE7, 0x80, 0xF1, 0xC7, 0x80, 0xF0, 0x07, 0x80, 0xF0, 0x07, 0x80, 0xF0, 0x3C, 0xF8, 0x3C, 0xFC,
+    0x3C, 0xFE, 0x3C, 0xFE, 0x3C, 0xFF, 0x3C, 0xF7, 0xBC, 0xF7, 0xBC, 0xF3, 0xFC, 0xF1, 0xFC, 0xF1,
+    0xFC, 0xF0, 0xFC, 0xF0, 0x7C, 0xF0, 0x7C, 0xF0, 0x3C, 0x0F, 0xE0, 0x3F, 0xF0, 0x7F, 0xF8, 0x7C,
+    0xFC, 0xF8, 0x3C, 0xF0, 0x3E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x3E, 0xF8, 0x3C, 0x7C,
+    0xFC, 0x7F, 0xF8, 0x3F, 0xF8, 0x0F, 0xE0, 0xFF, 0xC0, 0xFF, 0xE0, 0xFF, 0xF0, 0xF1, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF3, 0xF0, 0xFF, 0xF0, 0xFF, 0xE0, 0xFF, 0xC0, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x7F, 0xF8, 0x7C, 0xFC, 0xF8, 0x3C, 0xF0,
+    0x3E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x3E, 0xF8, 0x3C, 0x7C, 0xFC, 0x7F, 0xF8, 0x3F,
+    0xF8, 0x1F, 0xE0, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0xF8, 0xFF, 0x80, 0xFF, 0xE0, 0xFF, 0xE0, 0xF3,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF3, 0xF0, 0xFF, 0xF0, 0xFF, 0xE0, 0xFF, 0xC0, 0xF3, 0xC0, 0xF3,
+    0xE0, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xE0, 0x7C, 0xC0, 0x78,
+    0x00, 0x7C, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x0F, 0xE0, 0x01, 0xF0, 0x00, 0xF0, 0x71, 0xF0, 0x7F,
+    0xE0, 0x7F, 0xE0, 0x7F, 0xC0, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0,
+    0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0xF8, 0xFD, 0xF0, 0x7F, 0xF0, 0x3F, 0xE0, 0x1F,
+    0xC0, 0xF0, 0x1E, 0xF8, 0x1E, 0x78, 0x3E, 0x78, 0x3C, 0x7C, 0x3C, 0x3C, 0x78, 0x3C, 0x78, 0x3E,
+    0x78, 0x1E, 0xF0, 0x1E, 0xF0, 0x0F, 0xE0, 0x0F, 0xE0, 0x07, 0xE0, 0x07, 0xC0, 0x07, 0xC0, 0xF0,
+    0x00, 0xF0, 0xF8, 0x01, 0xF0, 0x78, 0xF1, 0xE0, 0x78, 0xF1, 0xE0, 0x78, 0xF9, 0xE0, 0x79, 0xF9,
+    0xE0, 0x7D, 0xF9, 0xC0, 0x3D, 0xFB, 0xC0, 0x3F, 0xFF, 0xC0, 0x3F, 0x9F, 0xC0, 0x3F, 0x9F, 0x80,
+    0x1F, 0x9F, 0x80, 0x1F, 0x0F, 0x80, 0x1F, 0x0F, 0x80, 0x0F, 0x0F, 0x00, 0xF8, 0x7C, 0x7C, 0x78,
+    0x3C, 0xF8, 0x3F, 0xF0, 0x1F, 0xE0, 0x0F, 0xE0, 0x0F, 0xC0, 0x07, 0xC0, 0x0F, 0xC0, 0x1F, 0xE0,
+    0x1F, 0xF0, 0x3F, 0xF0, 0x7C, 0xF8, 0x78, 0x7C, 0xF8, 0x7C, 0xF8, 0x3C, 0xF8, 0x78, 0x7C, 0x78,
+    0x3C, 0xF0, 0x3F, 0xF0, 0x1F, 0xE0, 0x1F, 0xE0, 0x0F, 0xC0, 0x0F, 0x80, 0x07, 0x80, 0x07, 0x80,
+    0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x7F, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x01, 0xF0,
+    0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x0F, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x3C, 0x00, 0x7C, 0x00,
+    0x7F, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x7E, 0x7E, 0x7E, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x7E, 0x7E, 0x7E, 0xF0, 0x00, 0x78, 0x00, 0x78, 0x00,
+    0x78, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x0F, 0x00,
+    0x0F, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x07, 0x80, 0x03, 0x80, 0x03, 0xC0, 0x03, 0xC0, 0x01, 0xE0,
+    0x01, 0xE0, 0xFC, 0xFC, 0xFC, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0xFC, 0xFC, 0xFC, 0x0F, 0x00, 0x1F, 0x00, 0x1F, 0x80, 0x3F, 0xC0, 0x3F, 0xC0,
+    0x79, 0xE0, 0x79, 0xE0, 0xF0, 0xF0, 0x70, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x60, 0xF0,
+    0xF8, 0x38, 0x18, 0x3F, 0x80, 0x3F, 0xC0, 0x3F, 0xC0, 0x33, 0xE0, 0x3F, 0xE0, 0x7F, 0xE0, 0x79,
+    0xE0, 0xF9, 0xE0, 0x7F, 0xE0, 0x7F, 0xE0, 0x3F, 0xC0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xE0, 0xFB, 0xE0, 0xF1, 0xE0, 0xF1, 0xE0, 0xF1,
+    0xE0, 0xF3, 0xE0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0x7C,
+    0x80, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x7C, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x1F, 0xC0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x1F, 0xF0, 0x3F, 0xF0, 0x7F, 0xF0, 0x7D,
+    0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x7C, 0xF0, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xE0, 0x1F,
+    0x80, 0x3F, 0xE0, 0x7F, 0xE0, 0x79, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x78, 0x00, 0x7C, 0x60, 0x7F,
+    0xE0, 0x3F, 0xE0, 0x1F, 0xE0, 0x3F, 0x00, 0x7F, 0x00, 0xFF, 0x00, 0xFB, 0x00, 0xF0, 0x00, 0xFF,
+    0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0x1F, 0xE0, 0x3F, 0xE0, 0x7F, 0xE0, 0x7D, 0xE0, 0x79, 0xE0, 0x79,
+    0xE0, 0x79, 0xE0, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xE0, 0x01, 0xE0, 0x33, 0xE0, 0x7F, 0xE0, 0x7F,
+    0xC0, 0x7F, 0x80, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0x80, 0xFF,
+    0xC0, 0xFF, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3,
+    0xC0, 0xF3, 0xC0, 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0x1E, 0x1E, 0x1E, 0x1E, 0x00, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+    0x1E, 0x1E, 0x1E, 0x1E, 0xFE, 0xFC, 0xF8, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF3, 0xE0, 0xF7, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF7,
+    0x80, 0xF7, 0xC0, 0xF3, 0xE0, 0xF1, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF8, 0xFC, 0x78, 0x78, 0xFF, 0xFC, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xDF, 0xF3,
+    0xCF, 0xF3, 0xCF, 0xF3, 0xCF, 0xF3, 0xCF, 0xF3, 0xCF, 0xF3, 0xCF, 0xF3, 0xCF, 0xFF, 0x80, 0xFF,
+    0x80, 0xFF, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3,
+    0xC0, 0xF3, 0xC0, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xE0, 0x7D, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78,
+    0xF0, 0x7D, 0xF0, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xC0, 0xFF, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xF3,
+    0xE0, 0xF1, 0xE0, 0xF1, 0xE0, 0xF1, 0xE0, 0xF3, 0xE0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0x80, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x1F, 0xE0, 0x3F, 0xF0, 0x7F, 0xF0, 0x7C, 0xF0, 0x78,
+    0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x7D, 0xF0, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xF2, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0x3F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x79, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x3F, 0xC0, 0x63, 0xC0,
+    0x7F, 0xC0, 0x7F, 0x80, 0x7F, 0x00, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xFA, 0xFF, 0x7F, 0x3F, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0,
+    0xF3, 0xC0, 0xFB, 0xC0, 0xFF, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0xF0, 0xF0, 0xF1, 0xE0, 0x79, 0xE0,
+    0x79, 0xE0, 0x7B, 0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x3F, 0x80, 0x1F, 0x80, 0x1F, 0x00, 0x0F, 0x00,
+    0xF1, 0xC7, 0x00, 0xF3, 0xCF, 0x00, 0x73, 0xCF, 0x00, 0x7B, 0xEF, 0x00, 0x7B, 0xEE, 0x00, 0x3F,
+    0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0x7C, 0x00, 0x1E, 0x7C, 0x00, 0x1E, 0x7C, 0x00, 0x1E, 0x38,
+    0x00, 0xF1, 0xE0, 0x79, 0xE0, 0x3F, 0xC0, 0x3F, 0x80, 0x1F, 0x80, 0x0F, 0x00, 0x1F, 0x80, 0x3F,
+    0xC0, 0x7B, 0xC0, 0x79, 0xE0, 0xF1, 0xF0, 0xF0, 0xF0, 0xF1, 0xE0, 0x79, 0xE0, 0x79, 0xE0, 0x7B,
+    0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x1F, 0x80, 0x1F, 0x80, 0x1F, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0xFE,
+    0x00, 0xFC, 0x00, 0xF8, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x7F, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E,
+    0x00, 0x3C, 0x00, 0x78, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x0F, 0x1F, 0x3F, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x3C, 0x7C, 0xF8, 0xF8, 0xFC, 0x7C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3F, 0x1F, 0x1F, 0x70,
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x70, 0x70, 0x70, 0xF0, 0xF8, 0xF8, 0x7C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x1E, 0x1E, 0x3E, 0x3C,
+    0x3C, 0x3C, 0x3C, 0x7C, 0xF8, 0xF8, 0xF0, 0x3C, 0x70, 0x7F, 0xF0, 0x7F, 0xE0, 0xFF, 0xE0, 0xE3,
+    0xC0, 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0x7C, 0x80, 0x78, 0x00,
+    0x78, 0x00, 0x7C, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x1F, 0xC0, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00,
+    0x0F, 0xC0, 0x1F, 0xC0, 0x3F, 0xC0, 0x3E, 0xC0, 0x3C, 0x00, 0x3C, 0x00, 0xFF, 0x80, 0xFF, 0x80,
+    0xFF, 0x80, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x7F, 0xE0, 0x00, 0x00,
+    0x70, 0xE0, 0xFF, 0xF0, 0x7F, 0xE0, 0x3B, 0xC0, 0x79, 0xE0, 0x79, 0xE0, 0x3B, 0xC0, 0x7F, 0xE0,
+    0xFF, 0xF0, 0x70, 0xC0, 0x78, 0x78, 0x7C, 0xF8, 0x3C, 0xF0, 0x3C, 0xF0, 0x1F, 0xE0, 0x1F, 0xE0,
+    0x0F, 0xC0, 0x3F, 0xF0, 0x3F, 0xF0, 0x07, 0x80, 0x07, 0x80, 0x3F, 0xF0, 0x3F, 0xF0, 0x07, 0x80,
+    0x07, 0x80, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x1F, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0x79, 0x80, 0x78, 0x00,
+    0x3F, 0x00, 0x3F, 0x80, 0x7F, 0xC0, 0x73, 0xC0, 0xF1, 0xC0, 0x79, 0xC0, 0x7F, 0xC0, 0x3F, 0x80,
+    0x1F, 0xC0, 0x03, 0xC0, 0x73, 0xC0, 0x7F, 0xC0, 0xFF, 0xC0, 0x7F, 0x80, 0x77, 0x80, 0xF7, 0x80,
+    0x77, 0x80, 0x0F, 0xE0, 0x3F, 0xF0, 0x7C, 0xF8, 0x70, 0x1C, 0xE7, 0xDC, 0xEF, 0xCE, 0xEE, 0x4E,
+    0xFE, 0x0E, 0xEE, 0x4E, 0xEF, 0xCE, 0xE7, 0xDC, 0x70, 0x1C, 0x7C, 0xF8, 0x3F, 0xF0, 0x0F, 0xE0,
+    0x7E, 0x7F, 0x0F, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x1C, 0x70, 0x3C, 0xF0, 0x7D, 0xE0,
+    0x7B, 0xE0, 0xFB, 0xC0, 0x7B, 0xE0, 0x7D, 0xE0, 0x3C, 0xF0, 0x1C, 0x70, 0x00, 0x00, 0xFF, 0xC0,
+    0xFF, 0xC0, 0xFF, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0xFE, 0xFE,
+    0xFE, 0x0F, 0xE0, 0x3F, 0xF0, 0x7C, 0xF8, 0x70, 0x1C, 0xEF, 0xDC, 0xEF, 0xEE, 0xEE, 0xEE, 0xEF,
+    0xCE, 0xEF, 0xCE, 0xEF, 0xCE, 0xEE, 0xFC, 0x70, 0x1C, 0x7C, 0xF8, 0x3F, 0xF0, 0x0F, 0xE0, 0xFF,
+    0xFF, 0x7C, 0xFE, 0xEE, 0xEE, 0xFE, 0x7C, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0xFF,
+    0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xFF,
+    0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x7C, 0xFE, 0x6E, 0x1E, 0x3C, 0x78, 0x70, 0xFE, 0xFE, 0xFC, 0xFE,
+    0x5E, 0x3C, 0x3E, 0x0E, 0x4E, 0xFE, 0xFC, 0x10, 0x38, 0x78, 0xF0, 0x60, 0xF3, 0xC0, 0xF3, 0xC0,
+    0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xFB, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0,
+    0xFF, 0xC0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x0F, 0xF8, 0x3F, 0xFC, 0x7F, 0xFC,
+    0x7F, 0xBC, 0x7F, 0xBC, 0x7F, 0xBC, 0x7F, 0xBC, 0x7F, 0xBC, 0x3F, 0xBC, 0x0F, 0xBC, 0x07, 0xBC,
+    0x07, 0xBC, 0x07, 0xBC, 0x07, 0xBC, 0x07, 0xBC, 0x07, 0xBC, 0x07, 0xBC, 0x07, 0xBC, 0x07, 0xBC,
+    0x70, 0xF8, 0xF8, 0x70, 0x18, 0x38, 0x3C, 0x7C, 0x7C, 0x78, 0x1C, 0x7C, 0x7C, 0x7C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x3E, 0x00, 0x7F, 0x00, 0x77, 0x80, 0xF3, 0x80, 0xF3, 0x80, 0x77, 0x80, 0x7F,
+    0x00, 0x3F, 0x00, 0x00, 0x00, 0x71, 0xC0, 0x7B, 0xC0, 0x79, 0xE0, 0x3D, 0xF0, 0x3E, 0xF0, 0x3D,
+    0xF0, 0x79, 0xE0, 0x7B, 0xC0, 0x71, 0xC0, 0x00, 0x00, 0x3C, 0x1C, 0x00, 0x7C, 0x3C, 0x00, 0xFC,
+    0x3C, 0x00, 0x7C, 0x78, 0x00, 0x1C, 0x78, 0x00, 0x1C, 0xF0, 0x00, 0x1C, 0xF3, 0xC0, 0x1D, 0xE7,
+    0xC0, 0x1D, 0xEF, 0xC0, 0x03, 0xDD, 0xC0, 0x03, 0x9F, 0xC0, 0x07, 0x9F, 0xC0, 0x07, 0x01, 0xC0,
+    0x0F, 0x01, 0xC0, 0x0E, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x7C, 0x3C, 0x00, 0xFC, 0x78, 0x00, 0x7C,
+    0x70, 0x00, 0x1C, 0xF0, 0x00, 0x1C, 0xE0, 0x00, 0x1D, 0xEF, 0x80, 0x1D, 0xDF, 0x80, 0x1F, 0xCF,
+    0xC0, 0x03, 0x83, 0xC0, 0x07, 0x87, 0x80, 0x07, 0x0F, 0x00, 0x0F, 0x0E, 0x00, 0x0E, 0x1F, 0xC0,
+    0x1E, 0x1F, 0xC0, 0x7C, 0x1E, 0x00, 0x7E, 0x1E, 0x00, 0x6E, 0x3C, 0x00, 0x3C, 0x3C, 0x00, 0x3E,
+    0x78, 0x00, 0x0E, 0x70, 0x00, 0x4E, 0xF3, 0xC0, 0xFE, 0xE7, 0xC0, 0xFD, 0xEF, 0xC0, 0x01, 0xDD,
+    0xC0, 0x03, 0xDF, 0xC0, 0x03, 0x9F, 0xC0, 0x07, 0x81, 0xC0, 0x07, 0x01, 0xC0, 0x0F, 0x00, 0x00,
+    0x0E, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x3E, 0x00,
+    0x7C, 0x00, 0x78, 0x00, 0xF0, 0x00, 0xFB, 0x80, 0xFF, 0x80, 0x7F, 0x80, 0x3F, 0x80, 0x03, 0x00,
+    0x07, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xE0,
+    0x0F, 0xE0, 0x0F, 0xE0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1C, 0x78, 0x3C, 0x78, 0x3F, 0xF8, 0x7F, 0xFC,
+    0x7F, 0xFC, 0x78, 0x3C, 0xF0, 0x1E, 0xF0, 0x1E, 0x01, 0x80, 0x01, 0xC0, 0x03, 0xC0, 0x07, 0x80,
+    0x07, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x1E, 0xF0,
+    0x1E, 0xF0, 0x1C, 0x78, 0x3C, 0x78, 0x3F, 0xF8, 0x7F, 0xFC, 0x7F, 0xFC, 0x78, 0x3C, 0xF0, 0x1E,
+    0xF0, 0x1E, 0x01, 0x80, 0x03, 0x80, 0x07, 0xC0, 0x0F, 0xE0, 0x04, 0x40, 0x00, 0x00, 0x07, 0xC0,
+    0x07, 0xC0, 0x07, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1C, 0x78, 0x3C, 0x78,
+    0x3F, 0xF8, 0x7F, 0xFC, 0x7F, 0xFC, 0x78, 0x3C, 0xF0, 0x1E, 0xF0, 0x1E, 0x0F, 0x60, 0x0F, 0xF0,
+    0x0D, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x1E, 0xF0,
+    0x1E, 0xF0, 0x1C, 0x78, 0x3C, 0x78, 0x3F, 0xF8, 0x7F, 0xFC, 0x7F, 0xFC, 0x78, 0x3C, 0xF0, 0x1E,
+    0xF0, 0x1E, 0x1E, 0xE0, 0x1E, 0xF0, 0x1E, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xE0,
+    0x0F, 0xE0, 0x0F, 0xE0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1C, 0x78, 0x3C, 0x78, 0x3F, 0xF8, 0x7F, 0xFC,
+    0x7F, 0xFC, 0x78, 0x3C, 0xF0, 0x1E, 0xF0, 0x1E, 0x07, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x07, 0xC0,
+    0x07, 0xC0, 0x07, 0xC0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x3C, 0x78,
+    0x3C, 0x78, 0x3F, 0xF8, 0x7F, 0xFC, 0x7F, 0xFC, 0x78, 0x3C, 0xF0, 0x1E, 0xF0, 0x1E, 0x00, 0xFF,
+    0xF0, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xF0, 0x01, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xBC, 0x00,
+    0x07, 0xBF, 0xE0, 0x0F, 0x3F, 0xE0, 0x0F, 0x3F, 0xE0, 0x1F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F,
+    0xFC, 0x00, 0x7C, 0x3F, 0xF8, 0x78, 0x3F, 0xF8, 0xF0, 0x3F, 0xF8, 0x0F, 0xF0, 0x3F, 0xF0, 0x7F,
+    0xF0, 0x7E, 0xF0, 0xF8, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF8,
+    0x00, 0x7C, 0x70, 0x7F, 0xF0, 0x3F, 0xF0, 0x0F, 0xF0, 0x07, 0x00, 0x07, 0x80, 0x03, 0x80, 0x0F,
+    0x80, 0x0F, 0x80, 0x0C, 0x00, 0x1C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x00, 0x00, 0xFF,
+    0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF,
+    0xC0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x02, 0x00, 0x07,
+    0x00, 0x0F, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x06, 0x00, 0x0F, 0x00, 0x1F, 0x80, 0x3F, 0x80, 0x19,
+    0x80, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF,
+    0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF,
+    0xE0, 0x3B, 0xC0, 0x7B, 0xC0, 0x3B, 0xC0, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x20, 0x70, 0x78, 0x3C, 0x1C, 0x00, 0x78, 0x78, 0x78,
+    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x30, 0x78, 0x78, 0xF0,
+    0xE0, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0x30, 0x78, 0xFC, 0xFE, 0xCC, 0x00, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
+    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0xF7, 0x00, 0xF7, 0x80, 0xF7, 0x00, 0x00, 0x00, 0x3C, 0x00,
+    0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00,
+    0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3F, 0xE0, 0x3F, 0xF8,
+    0x3F, 0xFC, 0x3C, 0xFC, 0x3C, 0x3E, 0x3C, 0x1E, 0xFF, 0x1E, 0xFF, 0x1E, 0x3C, 0x1E, 0x3C, 0x1E,
+    0x3C, 0x3E, 0x3C, 0xFC, 0x3F, 0xF8, 0x3F, 0xF0, 0x3F, 0xE0, 0x0F, 0x60, 0x1F, 0xE0, 0x1B, 0xC0,
+    0x00, 0x00, 0xF0, 0x3C, 0xF8, 0x3C, 0xFC, 0x3C, 0xFE, 0x3C, 0xFE, 0x3C, 0xFF, 0x3C, 0xF7, 0xBC,
+    0xF7, 0xBC, 0xF3, 0xFC, 0xF1, 0xFC, 0xF1, 0xFC, 0xF0, 0xFC, 0xF0, 0x7C, 0xF0, 0x7C, 0xF0, 0x3C,
+    0x02, 0x00, 0x07, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xF0,
+    0x7F, 0xF8, 0x7C, 0xFC, 0xF8, 0x3C, 0xF0, 0x3E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x3E,
+    0xF8, 0x3C, 0x7C, 0xFC, 0x7F, 0xF8, 0x3F, 0xF8, 0x0F, 0xE0, 0x01, 0x80, 0x03, 0xC0, 0x03, 0xC0,
+    0x07, 0x80, 0x06, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x7F, 0xF8, 0x7C, 0xFC, 0xF8, 0x3C,
+    0xF0, 0x3E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x3E, 0xF8, 0x3C, 0x7C, 0xFC, 0x7F, 0xF8,
+    0x3F, 0xF8, 0x0F, 0xE0, 0x03, 0x00, 0x07, 0x80, 0x0F, 0xC0, 0x0F, 0xE0, 0x0C, 0xC0, 0x00, 0x00,
+    0x0F, 0xE0, 0x3F, 0xF0, 0x7F, 0xF8, 0x7C, 0xFC, 0xF8, 0x3C, 0xF0, 0x3E, 0xF0, 0x1E, 0xF0, 0x1E,
+    0xF0, 0x1E, 0xF0, 0x3E, 0xF8, 0x3C, 0x7C, 0xFC, 0x7F, 0xF8, 0x3F, 0xF8, 0x0F, 0xE0, 0x0F, 0x60,
+    0x1F, 0xE0, 0x0D, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x7F, 0xF8, 0x7C, 0xFC, 0xF8, 0x3C,
+    0xF0, 0x3E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x3E, 0xF8, 0x3C, 0x7C, 0xFC, 0x7F, 0xF8,
+    0x3F, 0xF8, 0x0F, 0xE0, 0x1C, 0xE0, 0x1E, 0xE0, 0x1C, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xF0,
+    0x7F, 0xF8, 0x7C, 0xFC, 0xF8, 0x3C, 0xF0, 0x3E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x3E,
+    0xF8, 0x3C, 0x7C, 0xFC, 0x7F, 0xF8, 0x3F, 0xF8, 0x0F, 0xE0, 0x61, 0x80, 0xF3, 0xC0, 0xFF, 0x80,
+    0x3F, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0xF3, 0xC0, 0x61, 0x80, 0x00, 0x08, 0x0F, 0xFC,
+    0x3F, 0xFC, 0x7F, 0xF8, 0x7C, 0xFC, 0xF8, 0xFC, 0xF1, 0xFE, 0xF3, 0xDE, 0xF7, 0x9E, 0xF7, 0x1E,
+    0xFF, 0x3E, 0xFE, 0x3C, 0x7C, 0xFC, 0x7F, 0xF8, 0x7F, 0xF8, 0xFF, 0xE0, 0x20, 0x00, 0x0C, 0x00,
+    0x1E, 0x00, 0x1F, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78,
+    0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0xF8,
+    0xFD, 0xF0, 0x7F, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x01, 0x00, 0x03, 0x80, 0x07, 0x80, 0x0F, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78,
+    0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0xF8, 0xFD, 0xF0, 0x7F, 0xF0, 0x3F, 0xE0,
+    0x1F, 0xC0, 0x06, 0x00, 0x0F, 0x00, 0x1F, 0x80, 0x1F, 0xC0, 0x09, 0x80, 0x00, 0x00, 0xF0, 0x78,
+    0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78,
+    0xF0, 0x78, 0xF0, 0xF8, 0xFD, 0xF0, 0x7F, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x3D, 0xC0, 0x3D, 0xE0,
+    0x3D, 0xC0, 0x00, 0x00, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78,
+    0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0xF8, 0xFD, 0xF0, 0x7F, 0xF0, 0x3F, 0xE0,
+    0x1F, 0xC0, 0x01, 0x80, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0x80, 0x07, 0x00, 0x00, 0x00, 0xF8, 0x3C,
+    0xF8, 0x78, 0x7C, 0x78, 0x3C, 0xF0, 0x3F, 0xF0, 0x1F, 0xE0, 0x1F, 0xE0, 0x0F, 0xC0, 0x0F, 0x80,
+    0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0xF0, 0x00, 0xF0, 0x00,
+    0xFF, 0xC0, 0xFF, 0xE0, 0xFF, 0xF0, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF3, 0xF0, 0xFF, 0xF0,
+    0xFF, 0xE0, 0xFF, 0x80, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x3F, 0x80, 0x7F, 0xC0, 0x7F, 0xC0,
+    0xFB, 0xC0, 0xF1, 0xC0, 0xF3, 0xC0, 0xF7, 0x80, 0xF7, 0x80, 0xF7, 0x80, 0xF7, 0xE0, 0xF3, 0xF0,
+    0xF0, 0xF0, 0xF6, 0xF0, 0xF7, 0xF0, 0xFF, 0xF0, 0xFF, 0xE0, 0x0C, 0x00, 0x1C, 0x00, 0x1E, 0x00,
+    0x0F, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x3F, 0xC0, 0x33, 0xE0, 0x3F, 0xE0,
+    0x7F, 0xE0, 0x79, 0xE0, 0xF9, 0xE0, 0x7F, 0xE0, 0x7F, 0xE0, 0x3F, 0xC0, 0x02, 0x00, 0x07, 0x00,
+    0x0F, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x3F, 0xC0, 0x33, 0xE0,
+    0x3F, 0xE0, 0x7F, 0xE0, 0x79, 0xE0, 0xF9, 0xE0, 0x7F, 0xE0, 0x7F, 0xE0, 0x3F, 0xC0, 0x0C, 0x00,
+    0x0E, 0x00, 0x1F, 0x00, 0x3F, 0x80, 0x11, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x3F, 0xC0,
+    0x33, 0xE0, 0x3F, 0xE0, 0x7F, 0xE0, 0x79, 0xE0, 0xF9, 0xE0, 0x7F, 0xE0, 0x7F, 0xE0, 0x3F, 0xC0,
+    0x3D, 0x80, 0x3F, 0xC0, 0x37, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x3F, 0xC0,
+    0x33, 0xE0, 0x3F, 0xE0, 0x7F, 0xE0, 0x79, 0xE0, 0xF9, 0xE0, 0x7F, 0xE0, 0x7F, 0xE0, 0x3F, 0xC0,
+    0x3B, 0xC0, 0x7B, 0xC0, 0x3B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x3F, 0xC0,
+    0x33, 0xE0, 0x3F, 0xE0, 0x7F, 0xE0, 0x79, 0xE0, 0xF9, 0xE0, 0x7F, 0xE0, 0x7F, 0xE0, 0x3F, 0xC0,
+    0x0F, 0x00, 0x1F, 0x00, 0x1B, 0x80, 0x1F, 0x80, 0x1F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3F, 0x80,
+    0x3F, 0xC0, 0x3F, 0xC0, 0x33, 0xE0, 0x3F, 0xE0, 0x7F, 0xE0, 0x79, 0xE0, 0xF9, 0xE0, 0x7F, 0xE0,
+    0x7F, 0xE0, 0x3F, 0xC0, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x33, 0xE7, 0xC0,
+    0x3F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x79, 0xE0, 0x00, 0xF9, 0xF1, 0x80, 0x7F, 0xFF, 0x80, 0x7F,
+    0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x1F, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0x7C, 0x80, 0x78, 0x00, 0x78,
+    0x00, 0x78, 0x00, 0x7C, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x0F, 0xC0, 0x0F, 0x00, 0x07, 0x00, 0x1F,
+    0x00, 0x1F, 0x00, 0x0C, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0x00, 0x00, 0x00, 0x1F,
+    0x80, 0x3F, 0xE0, 0x7F, 0xE0, 0x79, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x78, 0x00, 0x7C, 0x60, 0x7F,
+    0xE0, 0x3F, 0xE0, 0x1F, 0xE0, 0x03, 0x00, 0x07, 0x80, 0x07, 0x80, 0x0F, 0x00, 0x0C, 0x00, 0x00,
+    0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x7F, 0xE0, 0x79, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x78, 0x00, 0x7C,
+    0x60, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xE0, 0x06, 0x00, 0x0F, 0x00, 0x1F, 0x80, 0x1F, 0xC0, 0x19,
+    0x80, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x7F, 0xE0, 0x79, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x78,
+    0x00, 0x7C, 0x60, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xE0, 0x3D, 0xC0, 0x3D, 0xE0, 0x3D, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x7F, 0xE0, 0x79, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x78,
+    0x00, 0x7C, 0x60, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xE0, 0x60, 0xF0, 0x78, 0x38, 0x18, 0x00, 0x78,
+    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x18, 0x3C, 0x3C, 0x78, 0x60, 0x00,
+    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x18, 0x3C, 0x7E, 0x7F, 0x66,
+    0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x73, 0x80, 0x7F, 0x80,
+    0x73, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
+    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x07, 0xF0,
+    0x07, 0xF0, 0x0F, 0xE0, 0x07, 0xE0, 0x00, 0xF0, 0x1F, 0xF0, 0x3F, 0xF0, 0x7F, 0xF0, 0x7D, 0xF0,
+    0x78, 0xF0, 0x78, 0xF0, 0x79, 0xF0, 0x7F, 0xE0, 0x3F, 0xC0, 0x1F, 0x80, 0x3D, 0x80, 0x7F, 0x80,
+    0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0,
+    0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0x04, 0x00, 0x0E, 0x00,
+    0x0F, 0x00, 0x07, 0x80, 0x03, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xE0, 0x7D, 0xF0,
+    0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x7D, 0xF0, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xC0, 0x03, 0x00,
+    0x03, 0x80, 0x07, 0x80, 0x0F, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xE0,
+    0x7D, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x7D, 0xF0, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xC0,
+    0x06, 0x00, 0x0F, 0x00, 0x1F, 0x80, 0x1F, 0xC0, 0x19, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0,
+    0x7F, 0xE0, 0x7D, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x7D, 0xF0, 0x7F, 0xE0, 0x3F, 0xE0,
+    0x1F, 0xC0, 0x1E, 0xC0, 0x3F, 0xC0, 0x1B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0,
+    0x7F, 0xE0, 0x7D, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x7D, 0xF0, 0x7F, 0xE0, 0x3F, 0xE0,
+    0x1F, 0xC0, 0x3D, 0xC0, 0x3D, 0xE0, 0x3D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0,
+    0x7F, 0xE0, 0x7D, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x7D, 0xF0, 0x7F, 0xE0, 0x3F, 0xE0,
+    0x1F, 0xC0, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0,
+    0xFF, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x00, 0x20, 0x1F, 0xF0,
+    0x3F, 0xE0, 0x7F, 0xE0, 0x7F, 0xF0, 0x7B, 0xF0, 0x77, 0xF0, 0x7E, 0xF0, 0x7D, 0xF0, 0x7F, 0xE0,
+    0x7F, 0xE0, 0x7F, 0xC0, 0x20, 0x00, 0x18, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0E, 0x00,
+    0x00, 0x00, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0,
+    0xFB, 0xC0, 0xFF, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x06, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1E, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0,
+    0xF3, 0xC0, 0xFB, 0xC0, 0xFF, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x0C, 0x00, 0x1E, 0x00, 0x3F, 0x00,
+    0x3F, 0x80, 0x33, 0x00, 0x00, 0x00, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0,
+    0xF3, 0xC0, 0xF3, 0xC0, 0xFB, 0xC0, 0xFF, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x73, 0x80, 0x7B, 0x80,
+    0x73, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0,
+    0xF3, 0xC0, 0xF3, 0xC0, 0xFB, 0xC0, 0xFF, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x03, 0x00, 0x03, 0x80,
+    0x07, 0x80, 0x0F, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF1, 0xE0, 0x79, 0xE0, 0x79, 0xE0,
+    0x7B, 0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x1F, 0x80, 0x1F, 0x80, 0x1F, 0x00, 0x0F, 0x00, 0x1E, 0x00,
+    0xFE, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xFF, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xF3, 0xE0, 0xF1, 0xE0, 0xF1, 0xE0, 0xF1, 0xE0, 0xF3, 0xE0,
+    0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0x80, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x39, 0xC0,
+    0x3B, 0xC0, 0x39, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF1, 0xE0, 0x79, 0xE0, 0x79, 0xE0,
+    0x7B, 0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x1F, 0x80, 0x1F, 0x80, 0x1F, 0x00, 0x0F, 0x00, 0x1E, 0x00,
+    0xFE, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x0F, 0xE0, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x07, 0xC0,
+    0x07, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1C, 0x78, 0x3C, 0x78, 0x3F, 0xF8,
+    0x7F, 0xFC, 0x7F, 0xFC, 0x78, 0x3C, 0xF0, 0x1E, 0xF0, 0x1E, 0x3F, 0x80, 0x3F, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x3F, 0xC0, 0x33, 0xE0, 0x3F, 0xE0, 0x7F, 0xE0, 0x79, 0xE0,
+    0xF9, 0xE0, 0x7F, 0xE0, 0x7F, 0xE0, 0x3F, 0xC0, 0x0E, 0xF0, 0x0F, 0xE0, 0x07, 0xC0, 0x00, 0x00,
+    0x07, 0xC0, 0x07, 0xC0, 0x07, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1C, 0x78,
+    0x3C, 0x78, 0x3F, 0xF8, 0x7F, 0xFC, 0x7F, 0xFC, 0x78, 0x3C, 0xF0, 0x1E, 0xF0, 0x1E, 0x3B, 0xC0,
+    0x3F, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x3F, 0xC0, 0x33, 0xE0,
+    0x3F, 0xE0, 0x7F, 0xE0, 0x79, 0xE0, 0xF9, 0xE0, 0x7F, 0xE0, 0x7F, 0xE0, 0x3F, 0xC0, 0x07, 0xC0,
+    0x07, 0xC0, 0x07, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1C, 0x78, 0x3C, 0x78,
+    0x3F, 0xF8, 0x7F, 0xFC, 0x7F, 0xFC, 0x78, 0x3C, 0xF0, 0x1E, 0xF0, 0x1E, 0x00, 0x1E, 0x00, 0x1C,
+    0x00, 0x3C, 0x00, 0x3F, 0x00, 0x1F, 0x3F, 0x80, 0x3F, 0xC0, 0x3F, 0xC0, 0x33, 0xE0, 0x3F, 0xE0,
+    0x7F, 0xE0, 0x79, 0xE0, 0xF9, 0xE0, 0x7F, 0xE0, 0x7F, 0xE0, 0x3F, 0xE0, 0x03, 0xC0, 0x07, 0x80,
+    0x07, 0xE0, 0x03, 0xE0, 0x01, 0x80, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0x80, 0x07, 0x00, 0x00, 0x00,
+    0x0F, 0xF0, 0x3F, 0xF0, 0x7F, 0xF0, 0x7E, 0xF0, 0xF8, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0xFC, 0x70, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x03, 0x00,
+    0x03, 0x80, 0x07, 0x80, 0x0F, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0,
+    0x7C, 0x80, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x7C, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x1F, 0xC0,
+    0x03, 0x00, 0x07, 0x80, 0x0F, 0xC0, 0x0F, 0xE0, 0x0C, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xF0,
+    0x7F, 0xF0, 0x7E, 0xF0, 0xF8, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xF8, 0x00, 0xFC, 0x70, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x06, 0x00, 0x0F, 0x00, 0x1F, 0x80,
+    0x1F, 0xC0, 0x19, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0x7C, 0x80, 0x78, 0x00,
+    0x78, 0x00, 0x78, 0x00, 0x7C, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x1F, 0xC0, 0x03, 0x80, 0x07, 0x80,
+    0x03, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xF0, 0x7F, 0xF0, 0x7E, 0xF0, 0xF8, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0xFC, 0x70, 0x7F, 0xF0, 0x3F, 0xF0,
+    0x1F, 0xF0, 0x07, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xC0,
+    0x7F, 0xC0, 0x7C, 0x80, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x7C, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0,
+    0x1F, 0xC0, 0x0C, 0xC0, 0x0F, 0xE0, 0x0F, 0xC0, 0x07, 0x80, 0x03, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x3F, 0xF0, 0x7F, 0xF0, 0x7E, 0xF0, 0xF8, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xF8, 0x00, 0xFC, 0x70, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x19, 0x80, 0x1F, 0xC0,
+    0x1F, 0x80, 0x0F, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0x7C, 0x80,
+    0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x7C, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x1F, 0xC0, 0x09, 0x80,
+    0x1F, 0xC0, 0x0F, 0x80, 0x0F, 0x00, 0x06, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xE0, 0xFF, 0xF0,
+    0xF1, 0xF8, 0xF0, 0x78, 0xF0, 0x7C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x7C, 0xF0, 0x78,
+    0xF1, 0xF8, 0xFF, 0xF0, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE,
+    0x00, 0xFE, 0x1F, 0xF0, 0x3F, 0xF0, 0x7F, 0xF0, 0x7D, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0,
+    0x7C, 0xF0, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xE0, 0x3F, 0xE0, 0x3F, 0xF8, 0x3F, 0xFC, 0x3C, 0xFC,
+    0x3C, 0x3E, 0x3C, 0x1E, 0xFF, 0x1E, 0xFF, 0x1E, 0x3C, 0x1E, 0x3C, 0x1E, 0x3C, 0x3E, 0x3C, 0xFC,
+    0x3F, 0xF8, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0xF0, 0x07, 0xF8, 0x07, 0xF8, 0x00, 0xF0, 0x00, 0xF0,
+    0x1F, 0xF0, 0x3F, 0xF0, 0x7F, 0xF0, 0x7D, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x7C, 0xF0,
+    0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xE0, 0x3F, 0x80, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xE0,
+    0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xF0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x7F, 0xE0, 0x79, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x78, 0x00,
+    0x7C, 0x60, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xE0, 0x3B, 0x80, 0x3F, 0x80, 0x1F, 0x00, 0x00, 0x00,
+    0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0,
+    0xFF, 0xC0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x3D, 0xC0,
+    0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x7F, 0xE0, 0x79, 0xF0,
+    0x7F, 0xF0, 0x7F, 0xF0, 0x78, 0x00, 0x7C, 0x60, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xE0, 0x0E, 0x00,
+    0x0F, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0,
+    0xFF, 0xE0, 0xFF, 0xE0, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
+    0x3F, 0xE0, 0x7F, 0xE0, 0x79, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x78, 0x00, 0x7C, 0x60, 0x7F, 0xE0,
+    0x3F, 0xE0, 0x1F, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0,
+    0xFF, 0xE0, 0x01, 0xE0, 0x01, 0xC0, 0x03, 0xC0, 0x03, 0xF0, 0x01, 0xF0, 0x1F, 0x80, 0x3F, 0xE0,
+    0x7F, 0xE0, 0x79, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x78, 0x00, 0x7C, 0x60, 0x7F, 0xE0, 0x3F, 0xE0,
+    0x1F, 0xE0, 0x03, 0xC0, 0x03, 0x80, 0x03, 0xE0, 0x03, 0xE0, 0x19, 0x80, 0x3F, 0x80, 0x1F, 0x80,
+    0x0F, 0x00, 0x06, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0,
+    0xFF, 0xE0, 0xFF, 0xE0, 0x19, 0x80, 0x1F, 0xC0, 0x1F, 0x80, 0x0F, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x1F, 0x80, 0x3F, 0xE0, 0x7F, 0xE0, 0x79, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x78, 0x00, 0x7C, 0x60,
+    0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xE0, 0x03, 0x00, 0x07, 0x80, 0x0F, 0xC0, 0x0F, 0xE0, 0x0C, 0xC0,
+    0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xF0, 0x7F, 0xF0, 0x7E, 0x70, 0xF8, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF8, 0x78, 0x7C, 0x78, 0x7F, 0xF8, 0x3F, 0xF8, 0x1F, 0xF0,
+    0x03, 0x00, 0x07, 0x80, 0x0F, 0xC0, 0x1F, 0xC0, 0x0C, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x3F, 0xE0,
+    0x7F, 0xE0, 0x7D, 0xE0, 0x79, 0xE0, 0x79, 0xE0, 0x79, 0xE0, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xE0,
+    0x01, 0xE0, 0x33, 0xE0, 0x7F, 0xE0, 0x7F, 0xC0, 0x7F, 0x80, 0x1E, 0xE0, 0x0F, 0xE0, 0x07, 0xC0,
+    0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xF0, 0x7F, 0xF0, 0x7E, 0x70, 0xF8, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF8, 0x78, 0x7C, 0x78, 0x7F, 0xF8, 0x3F, 0xF8, 0x1F, 0xF0,
+    0x1D, 0xC0, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x3F, 0xE0, 0x7F, 0xE0,
+    0x7D, 0xE0, 0x79, 0xE0, 0x79, 0xE0, 0x79, 0xE0, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xE0, 0x01, 0xE0,
+    0x33, 0xE0, 0x7F, 0xE0, 0x7F, 0xC0, 0x7F, 0x80, 0x03, 0x80, 0x07, 0x80, 0x03, 0x80, 0x00, 0x00,
+    0x0F, 0xF0, 0x3F, 0xF0, 0x7F, 0xF0, 0x7E, 0x70, 0xF8, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x78,
+    0xF0, 0x78, 0xF0, 0x78, 0xF8, 0x78, 0x7C, 0x78, 0x7F, 0xF8, 0x3F, 0xF8, 0x1F, 0xF0, 0x07, 0x00,
+    0x0F, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x3F, 0xE0, 0x7F, 0xE0, 0x7D, 0xE0,
+    0x79, 0xE0, 0x79, 0xE0, 0x79, 0xE0, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xE0, 0x01, 0xE0, 0x33, 0xE0,
+    0x7F, 0xE0, 0x7F, 0xC0, 0x7F, 0x80, 0x0F, 0xF0, 0x3F, 0xF0, 0x7F, 0xF0, 0x7E, 0x70, 0xF8, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF8, 0x78, 0x7C, 0x78, 0x7F, 0xF8,
+    0x3F, 0xF8, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0x80, 0x07, 0x80, 0x0F, 0x80, 0x0F, 0x00, 0x03, 0x80,
+    0x07, 0x80, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x3F, 0xE0, 0x7F, 0xE0,
+    0x7D, 0xE0, 0x79, 0xE0, 0x79, 0xE0, 0x79, 0xE0, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xE0, 0x01, 0xE0,
+    0x33, 0xE0, 0x7F, 0xE0, 0x7F, 0xC0, 0x7F, 0x80, 0x03, 0x00, 0x07, 0x80, 0x0F, 0xC0, 0x1F, 0xC0,
+    0x0C, 0xC0, 0x00, 0x00, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78,
+    0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78,
+    0xF0, 0x78, 0x38, 0x00, 0xFE, 0x00, 0xEE, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0,
+    0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0x3C, 0x3C, 0x3C, 0x3C, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x3C, 0x3C, 0x3C, 0x3C, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3C, 0x3C, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x78, 0x00, 0x78, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0x78, 0x00, 0x7F, 0xC0, 0x7F, 0xE0, 0x7F, 0xE0, 0x79, 0xE0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0,
+    0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x7B, 0x00, 0xFF, 0x00, 0x6F, 0x00, 0x00, 0x00,
+    0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00,
+    0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x7B, 0xFF,
+    0xFE, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7F, 0x7F,
+    0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+    0xFF, 0xFF, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0xEE,
+    0xFE, 0x7C, 0x00, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
+    0x78, 0x78, 0xF7, 0x7E, 0x7E, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
+    0x78, 0x78, 0x70, 0xF0, 0xFC, 0x7C, 0x78, 0x78, 0x78, 0x78, 0x00, 0x78, 0x78, 0x78, 0x78, 0x78,
+    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0xF0, 0xF0, 0xF8, 0x78, 0x70, 0xF0, 0x70, 0x00, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
+    0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x1E, 0xF3,
+    0xBE, 0xF3, 0xFE, 0xF3, 0xFC, 0xF3, 0xF8, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0x00,
+    0x00, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3,
+    0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0x03, 0xC0, 0x1F, 0xC0, 0x1F, 0x80, 0x1F, 0x00, 0x01,
+    0x80, 0x03, 0xC0, 0x07, 0xE0, 0x0F, 0xE0, 0x06, 0x60, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+    0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+    0xC0, 0x67, 0xC0, 0xFF, 0xC0, 0xFF, 0x80, 0x7F, 0x00, 0x0C, 0x00, 0x1E, 0x00, 0x3F, 0x00, 0x3F,
+    0x00, 0x33, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E,
+    0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0xFE, 0x00, 0xFC,
+    0x00, 0xF8, 0x00, 0xF0, 0xF8, 0xF1, 0xF0, 0xF3, 0xE0, 0xF7, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xFE,
+    0x00, 0xFF, 0x00, 0xFF, 0x80, 0xF7, 0xC0, 0xF3, 0xC0, 0xF3, 0xE0, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF8, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF3, 0xE0, 0xF7, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xFE, 0x00, 0xFF,
+    0x00, 0xFF, 0x00, 0xF7, 0x80, 0xF7, 0xC0, 0xF3, 0xE0, 0xF1, 0xE0, 0x00, 0x00, 0x0E, 0x00, 0x1E,
+    0x00, 0x3E, 0x00, 0x3C, 0x00, 0xF3, 0xE0, 0xF7, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xFE, 0x00, 0xFF,
+    0x00, 0xFF, 0x00, 0xF7, 0x80, 0xF7, 0xC0, 0xF3, 0xC0, 0xF1, 0xE0, 0x18, 0x00, 0x38, 0x00, 0x78,
+    0x00, 0xF0, 0x00, 0x60, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF,
+    0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x18, 0x78, 0xF8, 0xE0, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xFC, 0x78, 0x78, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1E, 0x00,
+    0x1E, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xFC,
+    0x78, 0x78, 0x00, 0x70, 0x70, 0xF0, 0xE0, 0xF0, 0x00, 0xF3, 0x80, 0xF3, 0x80, 0xF3, 0x80, 0xF3,
+    0x80, 0xF3, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF,
+    0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF7, 0xF7, 0xF7, 0xF6, 0xF6, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF8, 0xFC, 0x78, 0x78, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF3, 0xC0, 0xF3,
+    0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF,
+    0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF3, 0x80, 0xF7,
+    0xC0, 0xF7, 0xC0, 0xF3, 0x80, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x78,
+    0x00, 0x78, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x3F,
+    0x80, 0xFE, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F,
+    0xF0, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x1F, 0x80, 0x3F, 0x80, 0x7E,
+    0x00, 0x7E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x0F,
+    0x00, 0x01, 0x80, 0x03, 0xC0, 0x07, 0xC0, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0xF0, 0x3C, 0xF8,
+    0x3C, 0xFC, 0x3C, 0xFE, 0x3C, 0xFE, 0x3C, 0xFF, 0x3C, 0xF7, 0xBC, 0xF7, 0xBC, 0xF3, 0xFC, 0xF1,
+    0xFC, 0xF1, 0xFC, 0xF0, 0xFC, 0xF0, 0x7C, 0xF0, 0x7C, 0xF0, 0x3C, 0x06, 0x00, 0x0F, 0x00, 0x1F,
+    0x00, 0x1C, 0x00, 0x18, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0xC0, 0xF3, 0xC0, 0xF3,
+    0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF0, 0x3C, 0xF8,
+    0x3C, 0xFC, 0x3C, 0xFE, 0x3C, 0xFE, 0x3C, 0xFF, 0x3C, 0xF7, 0xBC, 0xF7, 0xBC, 0xF3, 0xFC, 0xF1,
+    0xFC, 0xF1, 0xFC, 0xF0, 0xFC, 0xF0, 0x7C, 0xF0, 0x7C, 0xF0, 0x3C, 0x00, 0x00, 0x03, 0x80, 0x07,
+    0x80, 0x0F, 0x80, 0x0F, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3,
+    0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0x00, 0x00, 0x0E, 0x00, 0x1E,
+    0x00, 0x3E, 0x00, 0x3C, 0x00, 0x0C, 0xC0, 0x1F, 0xC0, 0x0F, 0xC0, 0x07, 0x80, 0x03, 0x00, 0x00,
+    0x00, 0xF0, 0x3C, 0xF8, 0x3C, 0xFC, 0x3C, 0xFE, 0x3C, 0xFE, 0x3C, 0xFF, 0x3C, 0xF7, 0xBC, 0xF7,
+    0xBC, 0xF3, 0xFC, 0xF1, 0xFC, 0xF1, 0xFC, 0xF0, 0xFC, 0xF0, 0x7C, 0xF0, 0x7C, 0xF0, 0x3C, 0x33,
+    0x00, 0x3F, 0x80, 0x3F, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0xFF,
+    0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3,
+    0xC0, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0xE0, 0x00, 0x1F, 0xE0, 0x1F, 0xF0, 0x1F,
+    0xF8, 0x1E, 0xF8, 0x1E, 0x78, 0x1E, 0x78, 0x1E, 0x78, 0x1E, 0x78, 0x1E, 0x78, 0x1E, 0x78, 0x1E,
+    0x78, 0xF0, 0x3C, 0xF8, 0x3C, 0xFC, 0x3C, 0xFE, 0x3C, 0xFE, 0x3C, 0xFF, 0x3C, 0xF7, 0xBC, 0xF7,
+    0xBC, 0xF3, 0xFC, 0xF1, 0xFC, 0xF1, 0xFC, 0xF0, 0xFC, 0xF0, 0x7C, 0xF0, 0x7C, 0xF0, 0x3C, 0x00,
+    0x7C, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0xF0, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0xC0, 0xF3, 0xC0, 0xF3,
+    0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0x03, 0xC0, 0x03,
+    0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x0F, 0xE0, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x7F,
+    0xF8, 0x7C, 0xFC, 0xF8, 0x3C, 0xF0, 0x3E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x3E, 0xF8,
+    0x3C, 0x7C, 0xFC, 0x7F, 0xF8, 0x3F, 0xF8, 0x0F, 0xE0, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xE0, 0x7D, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x7D,
+    0xF0, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xC0, 0x0E, 0xE0, 0x0F, 0xE0, 0x07, 0xC0, 0x00, 0x00, 0x0F,
+    0xE0, 0x3F, 0xF0, 0x7F, 0xF8, 0x7C, 0xFC, 0xF8, 0x3C, 0xF0, 0x3E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0,
+    0x1E, 0xF0, 0x3E, 0xF8, 0x3C, 0x7C, 0xFC, 0x7F, 0xF8, 0x3F, 0xF8, 0x0F, 0xE0, 0x1D, 0xC0, 0x1F,
+    0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xE0, 0x7D, 0xF0, 0x78,
+    0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x7D, 0xF0, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xC0, 0x03, 0x30, 0x07,
+    0x78, 0x0F, 0x70, 0x0E, 0xE0, 0x0C, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x7F, 0xF8, 0x7C,
+    0xFC, 0xF8, 0x3C, 0xF0, 0x3E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x3E, 0xF8, 0x3C, 0x7C,
+    0xFC, 0x7F, 0xF8, 0x3F, 0xF8, 0x0F, 0xE0, 0x06, 0x60, 0x0E, 0xE0, 0x1C, 0xE0, 0x1D, 0xC0, 0x19,
+    0x80, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xE0, 0x7D, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78,
+    0xF0, 0x7D, 0xF0, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xC0, 0x0F, 0xFF, 0xE0, 0x3F, 0xFF, 0xE0, 0x7F,
+    0xFF, 0xE0, 0x7E, 0x78, 0x00, 0xF8, 0x78, 0x00, 0xF0, 0x78, 0x00, 0xF0, 0x7F, 0xC0, 0xF0, 0x7F,
+    0xC0, 0xF0, 0x7F, 0xC0, 0xF0, 0x78, 0x00, 0xF8, 0x78, 0x00, 0x7E, 0x78, 0x00, 0x7F, 0xFF, 0xF0,
+    0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x1F, 0x9F, 0x80, 0x3F, 0xFF, 0xC0, 0x7F, 0xFF, 0xE0, 0x7D,
+    0xF9, 0xE0, 0x78, 0xFF, 0xE0, 0x78, 0xFF, 0xE0, 0x78, 0xF0, 0x00, 0x7D, 0xFC, 0xC0, 0x7F, 0xFF,
+    0xC0, 0x3F, 0xFF, 0xC0, 0x1F, 0x9F, 0xC0, 0x02, 0x00, 0x07, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x0C,
+    0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0xE0, 0xFF, 0xE0, 0xF3, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF3,
+    0xF0, 0xFF, 0xF0, 0xFF, 0xE0, 0xFF, 0xC0, 0xF3, 0xC0, 0xF3, 0xE0, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF8, 0x0C, 0x1E, 0x3E, 0x38, 0x30, 0x00, 0xFF, 0xFF, 0xFF, 0xF2, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xFF, 0x80, 0xFF, 0xE0, 0xFF, 0xE0, 0xF3, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF3, 0xF0,
+    0xFF, 0xF0, 0xFF, 0xE0, 0xFF, 0xC0, 0xF3, 0xC0, 0xF3, 0xE0, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8,
+    0x00, 0x00, 0x07, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x1E, 0x00, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
+    0x79, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00,
+    0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x19, 0x80, 0x3F, 0x80, 0x1F, 0x80,
+    0x0F, 0x00, 0x06, 0x00, 0xFF, 0x80, 0xFF, 0xE0, 0xFF, 0xE0, 0xF3, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF3, 0xF0, 0xFF, 0xF0, 0xFF, 0xE0, 0xFF, 0xC0, 0xF3, 0xC0, 0xF3, 0xE0, 0xF1, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF8, 0x66, 0x7F, 0x7E, 0x3C, 0x18, 0x00, 0xFF, 0xFF, 0xFF, 0xF2, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0x03, 0x00, 0x03, 0x80, 0x07, 0x80, 0x0F, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x1F,
+    0xC0, 0x3F, 0xE0, 0x7F, 0xE0, 0x7C, 0xC0, 0x78, 0x00, 0x7C, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x0F,
+    0xE0, 0x01, 0xF0, 0x00, 0xF0, 0x71, 0xF0, 0x7F, 0xE0, 0x7F, 0xE0, 0x7F, 0xC0, 0x06, 0x00, 0x07,
+    0x00, 0x0F, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x79,
+    0x80, 0x7F, 0x80, 0x7F, 0x80, 0x3F, 0xC0, 0x63, 0xC0, 0x7F, 0xC0, 0x7F, 0x80, 0x7F, 0x00, 0x06,
+    0x00, 0x0F, 0x00, 0x1F, 0x80, 0x1F, 0xC0, 0x19, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F,
+    0xE0, 0x7C, 0xC0, 0x78, 0x00, 0x7C, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x0F, 0xE0, 0x01, 0xF0, 0x00,
+    0xF0, 0x71, 0xF0, 0x7F, 0xE0, 0x7F, 0xE0, 0x7F, 0xC0, 0x0C, 0x00, 0x1E, 0x00, 0x3F, 0x00, 0x3F,
+    0x80, 0x13, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x79, 0x80, 0x7F, 0x80, 0x7F,
+    0x80, 0x3F, 0xC0, 0x63, 0xC0, 0x7F, 0xC0, 0x7F, 0x80, 0x7F, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F,
+    0xE0, 0x7C, 0xC0, 0x78, 0x00, 0x7C, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x0F, 0xE0, 0x01, 0xF0, 0x00,
+    0xF0, 0x71, 0xF0, 0x7F, 0xE0, 0x7F, 0xE0, 0x7F, 0xC0, 0x0E, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x1F,
+    0x00, 0x1F, 0x00, 0x3F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x79, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x3F,
+    0xC0, 0x63, 0xC0, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x00, 0x1C, 0x00, 0x1E, 0x00, 0x0E, 0x00, 0x3E,
+    0x00, 0x3C, 0x00, 0x09, 0x80, 0x1F, 0xC0, 0x1F, 0x80, 0x0F, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1F,
+    0xC0, 0x3F, 0xE0, 0x7F, 0xE0, 0x7C, 0xC0, 0x78, 0x00, 0x7C, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x0F,
+    0xE0, 0x01, 0xF0, 0x00, 0xF0, 0x71, 0xF0, 0x7F, 0xE0, 0x7F, 0xE0, 0x7F, 0xC0, 0x13, 0x00, 0x3F,
+    0x80, 0x1F, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x79,
+    0x80, 0x7F, 0x80, 0x7F, 0x80, 0x3F, 0xC0, 0x63, 0xC0, 0x7F, 0xC0, 0x7F, 0x80, 0x7F, 0x00, 0xFF,
+    0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x1F, 0x80, 0x1F, 0x00, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xFA,
+    0xFF, 0x7F, 0x3F, 0x1C, 0x0E, 0x3E, 0x3C, 0x09, 0x80, 0x1F, 0xC0, 0x0F, 0x80, 0x0F, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x0E, 0xFE, 0xFE, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xFA, 0xFF, 0x7F,
+    0x3F, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x7F,
+    0xE0, 0x7F, 0xE0, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0xF0,
+    0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFA, 0xFF, 0x7F, 0x3F, 0x1E, 0xC0, 0x3F,
+    0xC0, 0x1B, 0xC0, 0x00, 0x00, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0,
+    0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0xF8, 0xFD, 0xF0, 0x7F, 0xF0, 0x3F,
+    0xE0, 0x1F, 0xC0, 0x3D, 0x80, 0x7F, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xC0, 0xF3,
+    0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xFB, 0xC0, 0xFF, 0xC0, 0x7F,
+    0xC0, 0x3F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0,
+    0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0xF8, 0xFD,
+    0xF0, 0x7F, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x7F, 0x80, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF3,
+    0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xFB, 0xC0, 0xFF,
+    0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x1D, 0xC0, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0xF0, 0x78, 0xF0,
+    0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0,
+    0x78, 0xF0, 0xF8, 0xFD, 0xF0, 0x7F, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x7B, 0x80, 0x3F, 0x80, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3,
+    0xC0, 0xF3, 0xC0, 0xFB, 0xC0, 0xFF, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x07, 0x00, 0x0F, 0x80, 0x0D,
+    0x80, 0x0D, 0x80, 0x0F, 0x80, 0x0F, 0x00, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0,
+    0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0xF8, 0xFD, 0xF0, 0x7F,
+    0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x1E, 0x00, 0x1F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0x1E,
+    0x00, 0x00, 0x00, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3,
+    0xC0, 0xFB, 0xC0, 0xFF, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x06, 0x60, 0x0E, 0xF0, 0x0E, 0xE0, 0x1D,
+    0xC0, 0x19, 0x80, 0x00, 0x00, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0,
+    0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0xF8, 0xFD, 0xF0, 0x7F, 0xF0, 0x3F,
+    0xE0, 0x1F, 0xC0, 0x1C, 0xC0, 0x1D, 0xC0, 0x3B, 0x80, 0x7B, 0x80, 0x33, 0x00, 0x00, 0x00, 0xF3,
+    0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xFB, 0xC0, 0xFF,
+    0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0,
+    0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0xF8, 0xFD, 0xF0, 0x7F, 0xF0, 0x3F,
+    0xE0, 0x1F, 0xC0, 0x07, 0x80, 0x07, 0x00, 0x07, 0xC0, 0x07, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3,
+    0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xFB, 0xC0, 0xFF, 0xC0, 0x7F, 0xC0, 0x3F,
+    0xC0, 0x03, 0x80, 0x07, 0x00, 0x07, 0xC0, 0x07, 0xC0, 0x00, 0x60, 0x00, 0x00, 0xF0, 0x00, 0x01,
+    0xF8, 0x00, 0x03, 0xF8, 0x00, 0x01, 0x98, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0xF8, 0x01,
+    0xF0, 0x78, 0xF1, 0xE0, 0x78, 0xF1, 0xE0, 0x78, 0xF9, 0xE0, 0x79, 0xF9, 0xE0, 0x7D, 0xF9, 0xC0,
+    0x3D, 0xFB, 0xC0, 0x3F, 0xFF, 0xC0, 0x3F, 0x9F, 0xC0, 0x3F, 0x9F, 0x80, 0x1F, 0x9F, 0x80, 0x1F,
+    0x0F, 0x80, 0x1F, 0x0F, 0x80, 0x0F, 0x0F, 0x00, 0x01, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xE0,
+    0x00, 0x07, 0xF0, 0x00, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xC7, 0x00, 0xF3, 0xCF, 0x00,
+    0x73, 0xCF, 0x00, 0x7B, 0xEF, 0x00, 0x7B, 0xEE, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x3F,
+    0x7C, 0x00, 0x1E, 0x7C, 0x00, 0x1E, 0x7C, 0x00, 0x1E, 0x38, 0x00, 0x03, 0x00, 0x07, 0x80, 0x0F,
+    0xC0, 0x1F, 0xC0, 0x0C, 0xC0, 0x00, 0x00, 0xF8, 0x3C, 0xF8, 0x78, 0x7C, 0x78, 0x3C, 0xF0, 0x3F,
+    0xF0, 0x1F, 0xE0, 0x1F, 0xE0, 0x0F, 0xC0, 0x0F, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07,
+    0x80, 0x07, 0x80, 0x07, 0x80, 0x06, 0x00, 0x0F, 0x00, 0x1F, 0x80, 0x3F, 0x80, 0x19, 0x80, 0x00,
+    0x00, 0xF0, 0xF0, 0xF1, 0xE0, 0x79, 0xE0, 0x79, 0xE0, 0x7B, 0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x1F,
+    0x80, 0x1F, 0x80, 0x1F, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x1C,
+    0xE0, 0x1F, 0xE0, 0x1C, 0xE0, 0x00, 0x00, 0xF8, 0x3C, 0xF8, 0x78, 0x7C, 0x78, 0x3C, 0xF0, 0x3F,
+    0xF0, 0x1F, 0xE0, 0x1F, 0xE0, 0x0F, 0xC0, 0x0F, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07,
+    0x80, 0x07, 0x80, 0x07, 0x80, 0x01, 0x00, 0x03, 0x80, 0x07, 0x80, 0x0F, 0x00, 0x0E, 0x00, 0x00,
+    0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x0F,
+    0x00, 0x1F, 0x00, 0x3E, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x7F, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x06,
+    0x00, 0x07, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x7F,
+    0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0xFF,
+    0xC0, 0x07, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x01,
+    0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x0F, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x3C, 0x00, 0x7C,
+    0x00, 0x7F, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x0E, 0x00, 0x1E, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x7F, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78,
+    0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x08, 0x80, 0x1F, 0xC0, 0x0F, 0x80, 0x07, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F,
+    0x80, 0x0F, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x7F, 0xF8, 0xFF, 0xF8, 0xFF,
+    0xF8, 0x13, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x7F,
+    0xC0, 0x7F, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x7F, 0xC0, 0xFF,
+    0xC0, 0xFF, 0xC0, 0x3F, 0x00, 0x7F, 0x00, 0xFF, 0x00, 0xFB, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0x7E, 0x7F, 0xF7, 0x0C, 0x00, 0x1C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x00,
+    0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xC0,
+    0xFF, 0xC0, 0xFF, 0xC0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0,
+    0x3B, 0xC0, 0x7B, 0xC0, 0x3B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xF8,
+    0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFF, 0x00,
+    0x0F, 0x1F, 0x00, 0x0F, 0x07, 0x00, 0x0F, 0x07, 0x80, 0x0F, 0x0F, 0x00, 0x0F, 0x7F, 0x00, 0x0F,
+    0x7E, 0x00, 0x0F, 0x7C, 0x00, 0x02, 0x00, 0x07, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0x00,
+    0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x0F,
+    0xF0, 0x3F, 0xF8, 0x7F, 0xF0, 0x7C, 0x70, 0xF8, 0x00, 0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF,
+    0xC0, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x70, 0x7F, 0xF0, 0x3F, 0xF8, 0x1F, 0xF0, 0x1F, 0xC0, 0x3F,
+    0xE0, 0x7F, 0xE0, 0x7C, 0xC0, 0x78, 0x00, 0x7C, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x0F, 0xE0, 0x01,
+    0xF0, 0x00, 0xF0, 0x71, 0xF0, 0x7F, 0xE0, 0x7F, 0xE0, 0x7F, 0xC0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF7, 0x00, 0xF7, 0x80, 0xF7, 0x00,
+    0x00, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00,
+    0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00,
+    0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+    0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x67, 0xC0, 0xFF, 0xC0, 0xFF, 0x80, 0x7F, 0x00, 0x07, 0xFE,
+    0x00, 0x07, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0x1E, 0x00, 0x0F, 0x1E, 0x00, 0x0F, 0x1F, 0xF8,
+    0x0F, 0x1F, 0xFC, 0x0F, 0x1F, 0xFE, 0x0F, 0x1E, 0x7E, 0x0F, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x7E,
+    0x1E, 0x3E, 0xFC, 0x1F, 0xFE, 0xFC, 0x1F, 0xFC, 0xF0, 0x1F, 0xF0, 0xF0, 0x78, 0x00, 0xF0, 0x78,
+    0x00, 0xF0, 0x78, 0x00, 0xF0, 0x78, 0x00, 0xF0, 0x78, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0,
+    0xFF, 0xFF, 0xF0, 0xF0, 0x79, 0xF8, 0xF0, 0x78, 0x78, 0xF0, 0x78, 0x78, 0xF0, 0x79, 0xF8, 0xF0,
+    0x7F, 0xF0, 0xF0, 0x7F, 0xF0, 0xF0, 0x7F, 0xC0, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x0F, 0x00,
+    0x0F, 0x00, 0x0F, 0x00, 0x0F, 0xFC, 0x0F, 0xFE, 0x0F, 0xFE, 0x0F, 0x3F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x80, 0x01, 0xC0, 0x03, 0xC0, 0x07, 0x80, 0x07, 0x00,
+    0x00, 0x00, 0xF0, 0xF8, 0xF1, 0xF0, 0xF3, 0xE0, 0xF7, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xFE, 0x00,
+    0xFF, 0x00, 0xFF, 0x80, 0xF7, 0xC0, 0xF3, 0xC0, 0xF3, 0xE0, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8,
+    0x06, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x03, 0x80, 0x01, 0x80, 0x00, 0x00, 0xF0, 0x3C, 0xF0, 0x7C,
     0xF0, 0xFC, 0xF1, 0xFC, 0xF1, 0xFC, 0xF3, 0xFC, 0xF7, 0xBC, 0xF7, 0xBC, 0xFF, 0x3C, 0xFE, 0x3C,
-    0xFE, 0x3C, 0xFC, 0x3C, 0xF8, 0x3F, 0xF8, 0x3F, 0xF0, 0x3F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x3C,
-    0x00, 0x1C, 0x7B, 0x83, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x78, 0xE3, 0xCF, 0x1E, 0xF8, 0xFF,
-    0xC7, 0xFE, 0x3F, 0xF1, 0xFB, 0x8F, 0x9C, 0x7C, 0xFB, 0xC7, 0xDE, 0x3E, 0x00, 0xF0, 0x0F, 0x00,
-    0x30, 0x38, 0x01, 0xC0, 0x3F, 0xC1, 0xFE, 0x03, 0x80, 0x1F, 0xF0, 0xFF, 0xC7, 0xFF, 0x38, 0xF9,
-    0xC3, 0xCE, 0x1E, 0x71, 0xF3, 0xFF, 0x9F, 0xF8, 0xFF, 0x80, 0x78, 0x0F, 0xF0, 0xFF, 0x07, 0x80,
-    0x7F, 0xC7, 0xFE, 0x79, 0xE7, 0x9F, 0x7F, 0xE7, 0xFE, 0x7F, 0xC0, 0xFF, 0xCF, 0xFE, 0xFF, 0xFF,
-    0x1F, 0xF2, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xEF, 0xFC, 0xF1, 0xEF, 0x0E, 0xF0, 0x8F, 0x00,
-    0xF0, 0x00, 0xFF, 0x9F, 0xFB, 0xFF, 0xF9, 0xFF, 0x1F, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
-    0xFF, 0x78, 0xEF, 0x1D, 0xE1, 0x3C, 0x00, 0x01, 0xE0, 0x3C, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x00,
-    0x07, 0x83, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x80,
-    0x3F, 0xF3, 0xFF, 0x3F, 0xF3, 0xC0, 0x3C, 0x03, 0xC0, 0xFF, 0x8F, 0xF8, 0xFF, 0x83, 0xC0, 0x3C,
-    0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x00, 0x7F, 0xDF, 0xF7, 0xFD, 0xE0, 0x78, 0x3F, 0xCF, 0xF1,
-    0xE0, 0x78, 0x1E, 0x07, 0x80, 0xFF, 0xE7, 0xFF, 0x3F, 0xF9, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xFF,
-    0x1F, 0xFC, 0xFF, 0xF7, 0x8F, 0xBC, 0x3D, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC3, 0xC0, 0x3E, 0x07,
-    0xF0, 0x3F, 0x01, 0xF0, 0xFF, 0x9F, 0xF3, 0xFE, 0x78, 0x0F, 0x01, 0xFE, 0x3F, 0xE7, 0xFE, 0xF3,
-    0xDE, 0x3F, 0xC7, 0x81, 0xE0, 0xFC, 0x1F, 0x83, 0xE0, 0xF8, 0xF0, 0xF1, 0xF3, 0xC7, 0xC3, 0xCF,
-    0x3E, 0x0F, 0xBD, 0xF0, 0x1F, 0xF7, 0xC0, 0x3F, 0xFE, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0x80, 0x0F,
-    0xFF, 0x00, 0x3F, 0xFE, 0x01, 0xFF, 0x7C, 0x0F, 0xBD, 0xF8, 0x7C, 0xF3, 0xF9, 0xE3, 0xC7, 0xEF,
-    0x8F, 0x0F, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80, 0xF9, 0xE7,
-    0x9F, 0x7B, 0xE3, 0xDF, 0xF0, 0x7F, 0xF8, 0x1F, 0xFC, 0x03, 0xFF, 0x01, 0xFF, 0xE0, 0xFF, 0xFC,
-    0x3D, 0xFF, 0xDE, 0x7B, 0xFF, 0x9E, 0x7C, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x3F, 0x87,
-    0xFE, 0x7F, 0xE3, 0x1F, 0x01, 0xF0, 0x3E, 0x1F, 0xE1, 0xFE, 0x1F, 0xF0, 0x1F, 0x00, 0xF7, 0x1F,
-    0x7F, 0xFF, 0xFE, 0x7F, 0xC0, 0x60, 0x0F, 0x00, 0x70, 0x1F, 0x01, 0xF0, 0x7F, 0x1F, 0xE7, 0xFD,
-    0x9F, 0x3F, 0x8F, 0xE0, 0x3D, 0x8F, 0x7F, 0xFF, 0xEF, 0xF8, 0x30, 0x0E, 0x03, 0x83, 0xE0, 0xF8,
-    0xF0, 0xF9, 0xE3, 0xE3, 0xCF, 0x87, 0xBE, 0x0F, 0xF8, 0x1F, 0xE0, 0x3F, 0x80, 0x7F, 0x80, 0xFF,
-    0x81, 0xFF, 0x83, 0xDF, 0x87, 0x9F, 0x0F, 0x1F, 0xDE, 0x1F, 0xBC, 0x1F, 0x00, 0x0E, 0x00, 0x1C,
-    0x00, 0x38, 0x00, 0x70, 0xF3, 0xEF, 0x3C, 0xF7, 0x8F, 0xF0, 0xFE, 0x0F, 0xE0, 0xFF, 0x0F, 0xF8,
-    0xF7, 0xFF, 0x3F, 0xF1, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0xF0, 0x3E, 0xF0, 0x3C, 0xF6, 0x7C, 0xF6,
-    0xF8, 0xF7, 0xF0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF7, 0xF0, 0xF6, 0xF8, 0xF6, 0xF8, 0xF0,
-    0x7C, 0xF0, 0x3C, 0xF0, 0x3E, 0xF0, 0x1E, 0xF0, 0xFB, 0xF3, 0xCF, 0xDE, 0x3F, 0xF0, 0xFF, 0x83,
-    0xFF, 0x0F, 0xFE, 0x3F, 0x78, 0xF1, 0xF3, 0xC3, 0xEF, 0x07, 0x80, 0x3C, 0x00, 0x78, 0x7F, 0xF9,
-    0xF7, 0xF7, 0xC3, 0xDF, 0x07, 0xFC, 0x0F, 0xF0, 0x1F, 0xC0, 0x3F, 0x80, 0x7F, 0x00, 0xFF, 0x81,
-    0xEF, 0x03, 0xCF, 0x07, 0x9F, 0x0F, 0x1F, 0x1E, 0x1E, 0x78, 0x07, 0xF7, 0xFF, 0xFD, 0xFF, 0xC7,
-    0xFC, 0x3F, 0xC1, 0xFC, 0x0F, 0xF0, 0x7F, 0xC3, 0xDF, 0x1E, 0x7C, 0xF1, 0xE0, 0xFF, 0x1F, 0x7F,
-    0x9F, 0x3F, 0xCF, 0x01, 0xEF, 0x00, 0xFF, 0x80, 0x7F, 0x80, 0x3F, 0x80, 0x1F, 0xE0, 0x0F, 0xF0,
-    0x07, 0xBC, 0x03, 0xDF, 0x01, 0xE7, 0xC0, 0xF1, 0xE0, 0x78, 0xF8, 0x3C, 0x3E, 0xFE, 0x7B, 0xFB,
-    0xCF, 0xFE, 0x07, 0xF0, 0x1F, 0xC0, 0x7F, 0x01, 0xFE, 0x07, 0xFC, 0x1E, 0xF8, 0x79, 0xE1, 0xE7,
-    0xC0, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xFF, 0xF8, 0xFF,
-    0xF8, 0xFF, 0xF8, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x7F, 0x00,
-    0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xFF, 0xCF, 0xFC,
-    0xFF, 0xCF, 0x3C, 0xF3, 0xFF, 0x3F, 0xF3, 0xF0, 0x07, 0x00, 0x70, 0x07, 0xF0, 0x7F, 0xF8, 0x3F,
-    0xFC, 0x1F, 0xFE, 0x0F, 0x0F, 0x07, 0x87, 0x83, 0xC3, 0xFF, 0xE1, 0xFF, 0xF0, 0xFF, 0xF8, 0x78,
-    0x3C, 0x3C, 0x1E, 0x1E, 0x0F, 0x0F, 0x07, 0x87, 0x83, 0xC3, 0xC1, 0xE0, 0xF3, 0xFF, 0x9F, 0xFC,
-    0xFF, 0xE7, 0x8F, 0xFC, 0x7F, 0xE3, 0xFF, 0x1E, 0x78, 0xF3, 0xC7, 0x9E, 0x3C, 0xF0, 0xFF, 0xF8,
-    0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0x3C, 0x1E, 0x00, 0xF0, 0x78, 0x03, 0xC1, 0xE0, 0x0F, 0x07,
-    0xFE, 0x3C, 0x1F, 0xFC, 0xF0, 0x7F, 0xFB, 0xC1, 0xE3, 0xEF, 0x07, 0x87, 0xBC, 0x1E, 0x0F, 0xF0,
-    0x78, 0x3F, 0xC1, 0xE0, 0xFF, 0x07, 0x87, 0x80, 0x00, 0x3E, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xC0,
-    0x00, 0x3E, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F, 0xF0, 0x1E, 0x78, 0x0F, 0x3F, 0xE7, 0x9F, 0xFB,
-    0xCF, 0xFD, 0xE7, 0x9F, 0xF3, 0xC7, 0xF9, 0xE3, 0xFC, 0xF1, 0xE0, 0x01, 0xF0, 0x03, 0xF0, 0x01,
-    0xF8, 0x00, 0xF8, 0x0F, 0xE0, 0x3F, 0xE0, 0x7F, 0xE0, 0x7E, 0x60, 0xF8, 0x00, 0xF1, 0xFC, 0xF3,
-    0xFE, 0xF3, 0xFE, 0xF7, 0xDE, 0xF7, 0x8E, 0xF7, 0x9E, 0xFF, 0xBE, 0x7F, 0xFE, 0x3F, 0xFC, 0x1F,
-    0xF0, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x7E, 0x00, 0x1E, 0x1F, 0xC1, 0xFE, 0x1F, 0xE0, 0xFF, 0xE7,
-    0x3F, 0xBB, 0xDD, 0xDC, 0xEF, 0xEF, 0x7F, 0xF9, 0xFF, 0x87, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7C,
-    0x0F, 0xF1, 0xFF, 0x9F, 0xFC, 0xFD, 0xEF, 0x80, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80,
-    0x3E, 0x00, 0xF8, 0xE7, 0xFF, 0x1F, 0xF8, 0x3F, 0xC0, 0xE0, 0x07, 0x80, 0x1C, 0x03, 0xE0, 0x1F,
-    0x00, 0x1F, 0xCF, 0xF7, 0xFD, 0xF2, 0x78, 0x1E, 0x07, 0x81, 0xF3, 0x7F, 0xCF, 0xF0, 0xFC, 0x3C,
-    0x07, 0x07, 0xC1, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01,
-    0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xFE, 0x07, 0xF0, 0x3F, 0x80, 0x3C, 0x01, 0xE0,
-    0x0F, 0x00, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1F, 0x83,
-    0xF0, 0x7E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xF8, 0x3F, 0xE1, 0xE7, 0xC7, 0x8F, 0x3C, 0x3F, 0xF0,
-    0x7F, 0x81, 0xFE, 0x03, 0xF0, 0x0F, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00,
-    0x78, 0x00, 0xF1, 0xFF, 0x1E, 0x79, 0xE7, 0x9E, 0x7B, 0xC3, 0xFC, 0x3F, 0x81, 0xF8, 0x1F, 0x80,
-    0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF8, 0x3F, 0xE1, 0xE7, 0x87, 0x8F, 0x3C,
-    0x3F, 0xF0, 0x7F, 0x81, 0xFE, 0x03, 0xF0, 0x0F, 0xC0, 0xFF, 0xC3, 0xFF, 0x01, 0xE0, 0x07, 0x80,
-    0x1E, 0x00, 0x78, 0x00, 0xF1, 0xFF, 0x1E, 0x79, 0xE7, 0x9E, 0x7B, 0xC3, 0xFC, 0x3F, 0x81, 0xF8,
-    0x1F, 0x87, 0xFC, 0x7F, 0xC0, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF8, 0x7C, 0xF8, 0xF0, 0xF3,
-    0xE1, 0xFF, 0x81, 0xFE, 0x01, 0xFC, 0x03, 0xF0, 0x03, 0xE0, 0x0F, 0xC0, 0x3F, 0xC0, 0x7F, 0xC1,
-    0xFF, 0x87, 0xCF, 0xEF, 0x0F, 0xFE, 0x1F, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0xF9,
-    0xE7, 0x9E, 0x3F, 0xC3, 0xF8, 0x1F, 0x80, 0xF0, 0x1F, 0x83, 0xFC, 0x7F, 0xF7, 0x9F, 0xF1, 0xF0,
-    0x07, 0x00, 0x70, 0x07, 0xFF, 0xF7, 0x8F, 0xFF, 0x78, 0xFF, 0xF7, 0x80, 0xF0, 0x78, 0x0F, 0x07,
-    0x80, 0xF0, 0x78, 0x0F, 0x07, 0x80, 0xF0, 0x78, 0x0F, 0x07, 0x80, 0xF0, 0x78, 0x0F, 0x07, 0x80,
-    0xF0, 0x78, 0x0F, 0xFF, 0xE0, 0xFF, 0xFE, 0x0F, 0xFF, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00,
-    0x0E, 0x00, 0x00, 0xE0, 0xFF, 0x79, 0xFE, 0xF3, 0xFD, 0xE1, 0xE3, 0xC3, 0xC7, 0x87, 0x8F, 0x0F,
-    0x1E, 0x1E, 0x3C, 0x3F, 0xFE, 0x7F, 0xFC, 0xFF, 0xF8, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0xF0,
-    0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xCF, 0x8F, 0x3F, 0xFC, 0x7F, 0xF0, 0xFF,
-    0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
-    0xC0, 0xF1, 0xE7, 0x8F, 0x3C, 0x79, 0xE3, 0xCF, 0x9E, 0x7F, 0xF1, 0xFF, 0x87, 0xFC, 0x01, 0xF8,
-    0x0F, 0xC0, 0x7E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF,
-    0x6F, 0xFE, 0xFF, 0xFF, 0x7F, 0xF3, 0xFF, 0x06, 0xF0, 0x6F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0xF1,
-    0xFE, 0x3F, 0xC7, 0xFB, 0xFF, 0xFF, 0xFF, 0xDF, 0xF9, 0xFF, 0x07, 0xE0, 0xFC, 0x07, 0x80, 0xF0,
-    0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x7F, 0xF3, 0xFF, 0xDF, 0xFE, 0xF1, 0xFF, 0x83, 0xFC,
-    0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xE0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3F, 0xEF,
-    0xFF, 0xFF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0x01, 0xFE, 0x00, 0xFF,
-    0xCE, 0x7F, 0xFB, 0xBF, 0x3E, 0xFF, 0x07, 0xFF, 0xFF, 0xF7, 0xFF, 0xFC, 0xFF, 0xFF, 0x0F, 0x00,
-    0x03, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x9C, 0x07, 0xFF, 0x80, 0xFF, 0xE0, 0x0F, 0xF0, 0xC3, 0xF3,
-    0x9F, 0xEE, 0xFF, 0xFF, 0xCF, 0x7F, 0xFC, 0xFF, 0xF1, 0xE0, 0x03, 0xE6, 0x0F, 0xF8, 0x1F, 0xF0,
-    0x3F, 0x80, 0x01, 0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xFB, 0x9F, 0x3E, 0xEF, 0x87, 0xBF, 0xC0, 0xFF,
-    0xFF, 0xFD, 0xFF, 0xFF, 0x3F, 0xFF, 0xC3, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x1C, 0x07, 0xFF, 0x80,
-    0xFF, 0xE0, 0x1F, 0xF0, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x03, 0xF3, 0x1F,
-    0xEE, 0xFF, 0xFB, 0xDF, 0xFE, 0x3D, 0xFF, 0xF3, 0xFF, 0xC7, 0xC6, 0x0F, 0xF8, 0x3F, 0xF0, 0x3F,
-    0x80, 0x78, 0x01, 0xE0, 0x07, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0x98,
-    0x00, 0x1E, 0xE0, 0x00, 0x7F, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x78, 0x79, 0xF3, 0xC7,
-    0xC7, 0x9E, 0x7C, 0x3E, 0xF7, 0xC0, 0xFF, 0xBE, 0x03, 0xFF, 0xE0, 0x0F, 0xFE, 0x00, 0x7F, 0xE0,
-    0x07, 0xFF, 0x80, 0x3F, 0xFE, 0x03, 0xFE, 0xF8, 0x3E, 0xF3, 0xE3, 0xE7, 0x8F, 0x1E, 0x3C, 0x7D,
-    0xF1, 0xE1, 0xF0, 0x03, 0x30, 0x01, 0xDE, 0x00, 0x7F, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x9E, 0x79, 0xF7, 0xBE, 0x3D, 0xFF, 0x07, 0xFF, 0x81, 0xFF, 0xC0, 0x3F, 0xF0, 0x1F, 0xFE,
-    0x0F, 0xFF, 0x83, 0xDE, 0xF1, 0xE7, 0x9E, 0xF9, 0xE7, 0xC0, 0xF0, 0xFF, 0x8F, 0xBC, 0xF9, 0xEF,
-    0x8F, 0x78, 0x7F, 0x83, 0xFF, 0x1F, 0xFC, 0xFF, 0xF7, 0x9F, 0xBC, 0x3F, 0xE0, 0xFF, 0x07, 0xF8,
-    0x3F, 0xC3, 0xE0, 0x3E, 0x07, 0xF0, 0x3F, 0x01, 0xF0, 0xF3, 0xFE, 0x7B, 0xDE, 0x7F, 0x8F, 0xE1,
-    0xFF, 0x3F, 0xF7, 0xBE, 0xF1, 0xFE, 0x3F, 0xC7, 0x80, 0xF0, 0x3C, 0x1F, 0x83, 0xE0, 0x0F, 0xFE,
-    0x03, 0xFF, 0x80, 0xFF, 0xE0, 0x3C, 0x78, 0x0F, 0x1E, 0x03, 0xC7, 0x80, 0xF1, 0xE0, 0x3C, 0x78,
-    0x0F, 0x1E, 0x07, 0x87, 0x81, 0xE1, 0xE1, 0xF8, 0x78, 0xFC, 0x1F, 0xBE, 0x07, 0xEF, 0x01, 0xF8,
-    0x00, 0x1E, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0x60, 0x1F, 0xF0, 0x7F, 0xC1, 0xFF, 0x07, 0xBC,
-    0x1E, 0xF0, 0x7B, 0xC3, 0xCF, 0x1F, 0x3C, 0xFC, 0xFF, 0xE3, 0xFF, 0x0F, 0xC0, 0x0E, 0x00, 0x78,
-    0x00, 0xC0, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xE0, 0x0F, 0x01, 0xF8, 0x0F, 0x80,
-    0x7C, 0xF1, 0xFE, 0x3F, 0xC7, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xF1, 0xFE, 0x3F, 0xC7,
-    0x01, 0xE0, 0xFC, 0x1F, 0x83, 0xE0, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78,
-    0xF0, 0x78, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x7E,
-    0xF0, 0x7E, 0xF0, 0x7E, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x18, 0xF3, 0xCF, 0x3C, 0xF3,
-    0xCF, 0x3C, 0xFF, 0xCF, 0xFC, 0xFF, 0xCF, 0x3C, 0xF3, 0xFF, 0x3F, 0xF3, 0xF0, 0x0E, 0x01, 0xE0,
-    0x1C, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x87, 0xBC, 0x3D, 0xF1, 0xEF, 0xFF, 0x3F, 0xF8,
-    0xFF, 0xC0, 0x1E, 0x00, 0xF0, 0x3F, 0x81, 0xFC, 0x0F, 0xE0, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0,
-    0x71, 0xEE, 0x3D, 0xC7, 0xBC, 0xF7, 0xFE, 0xFF, 0xCF, 0xF8, 0x0F, 0x01, 0xE0, 0xFC, 0x1F, 0x83,
-    0x80, 0x70, 0x0E, 0x00, 0x78, 0x0F, 0x0F, 0x83, 0xE1, 0xF0, 0x7C, 0x3F, 0x1F, 0x87, 0xE3, 0xF1,
-    0xFC, 0x7E, 0x3F, 0xDF, 0xC7, 0xBB, 0xBC, 0xF7, 0xF7, 0x9E, 0xFC, 0xF3, 0xCF, 0x9E, 0x79, 0xF3,
-    0xCF, 0x1C, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xF8, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00,
-    0x06, 0x00, 0xF0, 0x78, 0xF8, 0x78, 0xF8, 0xF8, 0xFC, 0xF8, 0xFD, 0xF8, 0xFF, 0xFC, 0xFF, 0xFC,
-    0xFF, 0xBC, 0xF7, 0xBF, 0xF7, 0x3F, 0xE0, 0x3E, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x1C, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0C, 0x60, 0x1D, 0xC0, 0x3F, 0x80, 0x3E, 0x00, 0x00, 0x00,
-    0xF8, 0x01, 0xF0, 0x03, 0xF0, 0x0F, 0xE0, 0x1F, 0xC0, 0x7B, 0xC0, 0xF7, 0x81, 0xC7, 0x87, 0x8F,
-    0x0F, 0xFE, 0x3F, 0xFE, 0x7F, 0xFC, 0xF0, 0x7B, 0xC0, 0x7F, 0x80, 0xF0, 0x19, 0x87, 0x78, 0xFE,
-    0x0F, 0x80, 0x00, 0x00, 0x0F, 0xE1, 0xFE, 0x3F, 0xC6, 0x7C, 0xFF, 0xBF, 0xF7, 0x9F, 0xF3, 0xDF,
-    0xFB, 0xFF, 0x3F, 0xC0, 0x1E, 0xE0, 0x3D, 0xE0, 0x7B, 0x80, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x01,
-    0xF8, 0x07, 0xF0, 0x0F, 0xE0, 0x3D, 0xE0, 0x7B, 0xC0, 0xE3, 0xC3, 0xC7, 0x87, 0xFF, 0x1F, 0xFF,
-    0x3F, 0xFE, 0x78, 0x3D, 0xE0, 0x3F, 0xC0, 0x78, 0x3B, 0xCF, 0x78, 0xEF, 0x00, 0x00, 0x00, 0x7F,
-    0x0F, 0xF1, 0xFE, 0x33, 0xE7, 0xFD, 0xFF, 0xBC, 0xFF, 0x9E, 0xFF, 0xDF, 0xF9, 0xFE, 0x00, 0xFF,
-    0xF0, 0x07, 0xFF, 0x80, 0x7F, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x03, 0xDE, 0x00, 0x1E, 0xFF,
-    0x81, 0xE7, 0xFC, 0x0F, 0x3F, 0xE0, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x7F, 0xF8, 0x07, 0xC3, 0xFF,
-    0xBC, 0x1F, 0xFF, 0xC0, 0xFF, 0xE0, 0x3F, 0xFF, 0x0F, 0xFF, 0xE3, 0xFF, 0xF8, 0xCF, 0x9F, 0x3F,
-    0xFF, 0xDF, 0xFF, 0xF7, 0x9E, 0x03, 0xE7, 0xC6, 0x7F, 0xFF, 0x9F, 0xFF, 0xE3, 0xFF, 0xF8, 0x39,
-    0x87, 0x78, 0xFE, 0x0F, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1E, 0x03, 0xC0, 0x7F, 0xEF,
-    0xFD, 0xFF, 0xBC, 0x07, 0x80, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x18, 0xC3, 0xDC, 0x1F, 0xC0,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xFE, 0x7F, 0xE7, 0x9F, 0x7F, 0xF7, 0xFF, 0x78, 0x07, 0xC6,
-    0x7F, 0xE3, 0xFE, 0x1F, 0xE0, 0x3F, 0xC1, 0xFF, 0x87, 0xFF, 0x1C, 0x7E, 0x00, 0x78, 0x01, 0xEF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xEF, 0x07, 0xBF, 0x7E, 0x7F, 0xF0, 0xFF, 0x81, 0xFC, 0x00,
-    0x7F, 0x87, 0xFC, 0x7F, 0xE3, 0x3E, 0x00, 0xF7, 0xFF, 0x7F, 0xF7, 0x9E, 0x7F, 0xE3, 0xFC, 0x1F,
-    0x80, 0x3D, 0xC0, 0xF7, 0x83, 0xDC, 0x00, 0x00, 0x3F, 0xC1, 0xFF, 0x87, 0xFF, 0x1C, 0x7E, 0x00,
-    0x78, 0x01, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xEF, 0x07, 0xBF, 0x7E, 0x7F, 0xF0, 0xFF,
-    0x81, 0xFC, 0x00, 0x39, 0xC3, 0xFC, 0x39, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x7F, 0xC7, 0xFE, 0x33,
-    0xE0, 0x0F, 0x7F, 0xF7, 0xFF, 0x79, 0xE7, 0xFE, 0x3F, 0xC1, 0xF8, 0x03, 0xDC, 0x00, 0x1E, 0xF0,
-    0x00, 0xF7, 0x00, 0x00, 0x00, 0x0F, 0x8F, 0x0F, 0x3E, 0x78, 0xF8, 0xF3, 0xCF, 0x87, 0xDE, 0xF8,
-    0x1F, 0xF7, 0xC0, 0x7F, 0xFC, 0x01, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0xC0,
-    0x7F, 0xDF, 0x07, 0xDE, 0x7C, 0x7C, 0xF1, 0xE3, 0xC7, 0x8F, 0xBE, 0x3C, 0x3E, 0x07, 0x38, 0x01,
-    0xFE, 0x00, 0x73, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x79, 0xE7, 0xDE, 0xF8, 0xF7, 0xFC, 0x1F,
-    0xFE, 0x07, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xF8, 0x3F, 0xFE, 0x0F, 0x7B, 0xC7, 0x9E, 0x7B, 0xE7,
-    0x9F, 0x39, 0xC3, 0xBC, 0x39, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0xE7, 0xFE, 0x31, 0xF0, 0x1F,
-    0x03, 0xE1, 0xFE, 0x1F, 0xE1, 0xFF, 0x01, 0xF0, 0x0F, 0x71, 0xF7, 0xFF, 0xFF, 0xE7, 0xFC, 0x73,
-    0x9D, 0xE7, 0x38, 0x00, 0x00, 0x1F, 0xC7, 0xF9, 0xFF, 0x67, 0xCF, 0xE3, 0xF8, 0x0F, 0x63, 0xDF,
-    0xFF, 0xF9, 0xFC, 0x7F, 0xF7, 0xFF, 0x7F, 0xF0, 0x3E, 0x07, 0xC0, 0xF8, 0x1F, 0xC1, 0xFE, 0x03,
-    0xF0, 0x0F, 0x00, 0xF7, 0x1F, 0xFF, 0xFF, 0xFE, 0x7F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0x0F,
-    0x07, 0x83, 0xF0, 0xFE, 0x07, 0xC0, 0xF0, 0x3F, 0x9F, 0xFF, 0xFF, 0xEF, 0xF0, 0x0F, 0xE0, 0x3F,
-    0x80, 0x00, 0x3C, 0x0F, 0xF0, 0x7F, 0xC3, 0xFF, 0x1F, 0xFC, 0x7F, 0xF3, 0xFF, 0xDE, 0xFF, 0x7B,
-    0xFF, 0xCF, 0xFE, 0x3F, 0xF8, 0xFF, 0xC3, 0xFE, 0x0F, 0xF8, 0x3F, 0xC0, 0xF0, 0x3F, 0x87, 0xF0,
-    0x00, 0x00, 0x0F, 0x1F, 0xE7, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x9F, 0xF3,
-    0xFC, 0x78, 0x1C, 0xE0, 0x7B, 0x81, 0xCE, 0x00, 0x00, 0xF0, 0x3F, 0xC1, 0xFF, 0x0F, 0xFC, 0x7F,
-    0xF1, 0xFF, 0xCF, 0xFF, 0x7B, 0xFD, 0xEF, 0xFF, 0x3F, 0xF8, 0xFF, 0xE3, 0xFF, 0x0F, 0xF8, 0x3F,
-    0xE0, 0xFF, 0x03, 0xC0, 0x3B, 0xCF, 0x78, 0xEF, 0x00, 0x00, 0x01, 0xE3, 0xFC, 0xFF, 0xBF, 0xF7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF3, 0xFE, 0x7F, 0x8F, 0x1E, 0xE0, 0x3D, 0xE0, 0x7B, 0x80,
-    0x00, 0x00, 0xFE, 0x07, 0xFE, 0x1F, 0xFE, 0x3E, 0x7E, 0xF8, 0x3D, 0xE0, 0x7F, 0xC0, 0x7F, 0x80,
-    0xFF, 0x01, 0xFE, 0x07, 0xFE, 0x0F, 0x3E, 0x7E, 0x7F, 0xF8, 0x7F, 0xF0, 0x3F, 0x80, 0x3D, 0xC3,
-    0xDE, 0x3D, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0xE7, 0xFE, 0x7D, 0xF7, 0x8F, 0x78, 0xF7, 0x8F,
-    0x7D, 0xF7, 0xFE, 0x3F, 0xE1, 0xFC, 0x0F, 0xE0, 0x7F, 0xE1, 0xFF, 0xE3, 0xE7, 0xEF, 0x83, 0xDE,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x7F, 0xE0, 0xF3, 0xE7, 0xE7, 0xFF, 0x87, 0xFF,
-    0x03, 0xF8, 0x00, 0x1F, 0xC3, 0xFE, 0x7F, 0xE7, 0x9F, 0x7F, 0xF7, 0xFF, 0x78, 0xF7, 0xDF, 0x7F,
-    0xE3, 0xFE, 0x1F, 0xC0, 0x1E, 0xE0, 0x3D, 0xE0, 0x7B, 0x80, 0x00, 0x00, 0xFE, 0x07, 0xFE, 0x1F,
-    0xFE, 0x3E, 0x7E, 0xF8, 0x3D, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0x07, 0xFE, 0x0F,
-    0x3E, 0x7E, 0x7F, 0xF8, 0x7F, 0xF0, 0x3F, 0x80, 0x3D, 0xC3, 0xDE, 0x3D, 0xC0, 0x00, 0x00, 0x01,
-    0xFC, 0x3F, 0xE7, 0xFE, 0x79, 0xF7, 0xFF, 0x7F, 0xF7, 0x8F, 0x7D, 0xF7, 0xFE, 0x3F, 0xE1, 0xFC,
-    0x1D, 0xC0, 0xF7, 0x81, 0xDC, 0x00, 0x00, 0x3F, 0xC1, 0xFF, 0x87, 0xFF, 0x1C, 0x7E, 0x00, 0x78,
-    0x01, 0xE1, 0xFF, 0xC7, 0xFF, 0x1F, 0xFC, 0x01, 0xE0, 0x07, 0x9C, 0x7E, 0x7F, 0xF1, 0xFF, 0x83,
-    0xFC, 0x00, 0x73, 0x8F, 0x71, 0xCE, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xE3, 0xFE, 0x63, 0xC7, 0xF8,
-    0xFF, 0x81, 0xE6, 0x7C, 0xFF, 0xBF, 0xE7, 0xF8, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x3E, 0x1F, 0x78,
-    0x79, 0xF1, 0xE3, 0xC7, 0x8F, 0x3C, 0x1E, 0xF0, 0x7B, 0x80, 0xFE, 0x03, 0xF8, 0x07, 0xC0, 0x1F,
-    0x04, 0xF8, 0x1F, 0xE0, 0x7F, 0x01, 0xF8, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0xF0, 0xFF,
-    0x1E, 0x79, 0xE7, 0x9E, 0x7B, 0xC3, 0xFC, 0x3F, 0x81, 0xF8, 0x1F, 0x81, 0xF0, 0x0F, 0x01, 0xE0,
-    0xFE, 0x0F, 0xC0, 0xF8, 0x00, 0x1C, 0xE0, 0x7B, 0x81, 0xCE, 0x00, 0x00, 0xF8, 0x7D, 0xE1, 0xE7,
-    0xC7, 0x8F, 0x1E, 0x3C, 0xF0, 0x7B, 0xC1, 0xEE, 0x03, 0xF8, 0x0F, 0xE0, 0x1F, 0x00, 0x7C, 0x13,
-    0xE0, 0x7F, 0x81, 0xFC, 0x07, 0xE0, 0x00, 0x3B, 0xC7, 0xBC, 0x3B, 0xC0, 0x00, 0x00, 0x0F, 0x0F,
-    0xF1, 0xE7, 0x9E, 0x79, 0xE7, 0xBC, 0x3F, 0xC3, 0xF8, 0x1F, 0x81, 0xF8, 0x1F, 0x00, 0xF0, 0x1E,
-    0x0F, 0xE0, 0xFC, 0x0F, 0x80, 0x07, 0x70, 0x1D, 0xC0, 0xEE, 0x07, 0x38, 0x0C, 0xC0, 0x00, 0x0F,
-    0x87, 0xDE, 0x1E, 0x7C, 0x78, 0xF1, 0xE3, 0xCF, 0x07, 0xBC, 0x1E, 0xE0, 0x3F, 0x80, 0xFE, 0x01,
-    0xF0, 0x07, 0xC1, 0x3E, 0x07, 0xF8, 0x1F, 0xC0, 0x7E, 0x00, 0x0C, 0xC1, 0xDE, 0x1D, 0xC3, 0xB8,
-    0x33, 0x80, 0x00, 0xF0, 0xFF, 0x1E, 0x79, 0xE7, 0x9E, 0x7B, 0xC3, 0xFC, 0x3F, 0x81, 0xF8, 0x1F,
-    0x81, 0xF0, 0x0F, 0x01, 0xE0, 0xFE, 0x0F, 0xC0, 0xF8, 0x00, 0x1D, 0xE1, 0xEF, 0x07, 0x78, 0x00,
-    0x0F, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF8, 0x7B, 0xC3, 0xDF, 0x1E, 0xFF, 0xF3, 0xFF, 0x8F,
-    0xFC, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x3B, 0xCF, 0x78, 0xEF, 0x00, 0x00, 0x00,
-    0xE3, 0xDC, 0x7B, 0x8F, 0x71, 0xEF, 0x3D, 0xFF, 0xBF, 0xF3, 0xFE, 0x03, 0xC0, 0x78, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F,
-    0xE1, 0xFC, 0x3F, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0x07,
-    0x83, 0xC1, 0xE0, 0xFC, 0x7E, 0x3F, 0x03, 0x81, 0xC0, 0xE0, 0x07, 0x38, 0x03, 0xBC, 0x01, 0xCE,
-    0x00, 0x00, 0x0F, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xF0, 0x07, 0xFF, 0xC3, 0xFF,
-    0xF9, 0xFF, 0xFC, 0xFF, 0x3F, 0x7F, 0x87, 0xBF, 0xC3, 0xDF, 0xE7, 0xEF, 0xFF, 0xE7, 0xFF, 0xF3,
-    0xFF, 0xE1, 0xE0, 0x0E, 0xF0, 0x3D, 0xE0, 0x3B, 0xC0, 0x00, 0x00, 0x00, 0x1E, 0x03, 0xFC, 0x07,
-    0xF8, 0x0F, 0xF0, 0x1F, 0xFF, 0x3F, 0xFF, 0x7F, 0xFE, 0xFF, 0x3D, 0xFF, 0xFB, 0xFF, 0xF7, 0xFF,
-    0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3B, 0xDE, 0xE7, 0x38, 0x7B, 0xDC, 0xEF, 0x70, 0x7B, 0xDC,
-    0xEF, 0x70, 0x3B, 0x9E, 0xE7, 0x79, 0xDE, 0x77, 0x9D, 0xE0, 0x7F, 0xBF, 0xDD, 0xEE, 0xFF, 0x77,
-    0x38, 0x7F, 0xBF, 0xDD, 0xEE, 0xFF, 0x77, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x00, 0x0E,
-    0x03, 0x80, 0xE0, 0x38, 0xFF, 0xFF, 0xFF, 0xFC, 0x38, 0x0E, 0x03, 0x8F, 0xFF, 0xFF, 0xFF, 0xC3,
-    0x80, 0xE0, 0x38, 0x0E, 0x03, 0x00, 0x3C, 0xFD, 0xFB, 0xF7, 0xE7, 0x80, 0xF0, 0xE1, 0xFE, 0x3E,
-    0x3F, 0xC7, 0xC7, 0xF8, 0x70, 0xF0, 0x3E, 0x0E, 0x00, 0x0F, 0xE3, 0xC0, 0x01, 0xDC, 0xF0, 0x00,
-    0x7B, 0xDE, 0x00, 0x0F, 0x7F, 0x80, 0x00, 0xEE, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x01, 0xF7, 0x7C,
-    0x3E, 0x01, 0xFF, 0xCF, 0xE0, 0x3B, 0xBF, 0xDC, 0x0F, 0x73, 0xF3, 0x81, 0xCE, 0x7E, 0x70, 0x79,
-    0xDF, 0xEE, 0x1E, 0x3F, 0x9F, 0xC3, 0xC3, 0xE1, 0xF0, 0x00, 0x38, 0xF3, 0xE7, 0x9F, 0x1E, 0x3E,
-    0x3C, 0x38, 0x00, 0x00, 0xE1, 0xE3, 0xC3, 0xC7, 0xCF, 0x3C, 0x78, 0xE0, 0x00, 0x00, 0xE0, 0x3C,
-    0x0F, 0x01, 0xE0, 0x78, 0x0F, 0x03, 0xC0, 0x78, 0x1E, 0x03, 0xC0, 0xF0, 0x1E, 0x07, 0x80, 0xE0,
-    0x3C, 0x00, 0x7C, 0x7E, 0xFE, 0xE7, 0xE7, 0xE7, 0xFE, 0x7E, 0x7C, 0x1E, 0x3E, 0x7E, 0x6E, 0xFF,
-    0xFF, 0x0E, 0x0E, 0x7E, 0xFD, 0xC3, 0xE7, 0xE1, 0xD3, 0xFF, 0xFC, 0x1E, 0x3E, 0x78, 0x7E, 0xFE,
-    0xEE, 0xFE, 0x7E, 0x3C, 0xFE, 0xFE, 0x0E, 0x1C, 0x1C, 0x38, 0x38, 0x38, 0x7C, 0x7E, 0xEE, 0x7E,
-    0x7E, 0xFE, 0xEF, 0xFE, 0x7E, 0x7C, 0x7E, 0xEE, 0xEE, 0x7E, 0x7E, 0x1E, 0x7C, 0x78, 0x7C, 0x7E,
-    0xFE, 0xE7, 0xE7, 0xE7, 0xFE, 0x7E, 0x7C, 0x1D, 0xF7, 0xDF, 0x1C, 0x71, 0xC7, 0x1C, 0x7D, 0xFD,
-    0xB8, 0xF3, 0xCF, 0x1C, 0x7F, 0xFE, 0xFD, 0xFD, 0x79, 0xE3, 0xE1, 0xD3, 0xFF, 0xFC, 0x1E, 0x3E,
-    0x7E, 0x6E, 0xFF, 0xFF, 0x0E, 0x0E, 0x7E, 0xFD, 0xC3, 0xE7, 0xE1, 0xD3, 0xFF, 0xFC, 0x1E, 0x3E,
-    0x78, 0x7E, 0xFE, 0xEE, 0xFE, 0x7E, 0x3C, 0xFE, 0xFE, 0x0E, 0x1C, 0x1C, 0x38, 0x38, 0x38, 0x7C,
-    0x7E, 0xEE, 0x7E, 0x7E, 0xFE, 0xEF, 0xFE, 0x7E, 0x7C, 0x7E, 0xEE, 0xEE, 0x7E, 0x7E, 0x1E, 0x7C,
-    0x78, 0x07, 0xF0, 0xFF, 0x1F, 0xE1, 0xF2, 0x3C, 0x07, 0xFE, 0x7F, 0xC3, 0xC0, 0x7F, 0xC7, 0xFC,
-    0x3C, 0x01, 0xF3, 0x1F, 0xF0, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x0F, 0xC0,
-    0xFC, 0x0F, 0xC3, 0xF0, 0x3F, 0xC3, 0xFC, 0x1F, 0xC3, 0xF0, 0x3F, 0x03, 0xF0, 0x0F, 0x00, 0x3F,
-    0x87, 0xFC, 0x3F, 0xC3, 0x3E, 0xFF, 0xFF, 0xFF, 0x1F, 0x83, 0xF0, 0xFF, 0xFF, 0xFF, 0x78, 0x07,
-    0xCC, 0x7F, 0xE3, 0xFE, 0x1F, 0xC0, 0x7F, 0xFB, 0xFF, 0xC1, 0xF0, 0x03, 0x87, 0xFF, 0x3F, 0xF8,
-    0x0F, 0x01, 0xF8, 0x7F, 0x83, 0xF8, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1E, 0x00, 0x3F,
-    0x83, 0xFC, 0x3F, 0xE3, 0x3F, 0x00, 0xF1, 0xFF, 0x3F, 0xF7, 0xFF, 0x7D, 0xFF, 0x0F, 0xF0, 0xF7,
-    0xBE, 0x7F, 0xE7, 0xFC, 0x1F, 0x80, 0x07, 0x80, 0x0F, 0x80, 0x3F, 0x00, 0x7F, 0x00, 0xFE, 0x03,
-    0xDC, 0x07, 0xBC, 0x1E, 0x78, 0x3C, 0x78, 0x78, 0xF1, 0xE1, 0xE3, 0xC1, 0xE7, 0xFF, 0xDF, 0xFF,
-    0xBF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F,
-    0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x78, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xBC, 0x03, 0xC0, 0x7C, 0x07, 0x80, 0x78, 0x0F, 0x01, 0xE0, 0x78, 0x1E, 0x07,
-    0xC0, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xE0, 0x3C, 0x0F, 0x01,
-    0xE0, 0x78, 0x0F, 0x03, 0xC0, 0x78, 0x1E, 0x03, 0xC0, 0xF0, 0x1E, 0x07, 0x80, 0xE0, 0x3C, 0x00,
-    0x77, 0xFE, 0xE0, 0x00, 0x3C, 0x00, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x70, 0x03, 0xC0, 0x0F, 0x0E,
-    0x38, 0xFD, 0xE1, 0xF7, 0x87, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x1E, 0x00, 0x78, 0x00, 0x3D, 0xF3,
-    0xFF, 0xFF, 0xEF, 0xCE, 0x7F, 0xFB, 0xBF, 0xFC, 0xF7, 0xC0, 0x00, 0x07, 0xC7, 0xE3, 0xF3, 0xE1,
-    0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x7E, 0x3E, 0x1F,
-    0x00, 0x00, 0x3C, 0x77, 0xEF, 0x7F, 0xEF, 0xFE, 0xE3, 0xC0, 0x00, 0x3C, 0x77, 0xFF, 0x7F, 0xEF,
-    0xFE, 0xE3, 0xC0, 0x01, 0x80, 0xE0, 0x3B, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0x70, 0xFF, 0xFF, 0xFF,
-    0xFD, 0xC0, 0x70, 0x18, 0x00, 0x03, 0xCF, 0xFF, 0xFF, 0xFE, 0xF8, 0x3F, 0xEF, 0xFC, 0xFF, 0x03,
-    0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0, 0x3F, 0xCF, 0xFD, 0xFF, 0x07, 0xDF, 0xFF, 0xFF, 0xFC,
-    0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFE, 0x3C, 0xFC, 0x3C, 0xF8, 0x3C, 0xF8, 0x3C, 0xF0, 0x3C, 0x0C, 0xC0, 0x1E, 0xE0, 0x0F, 0xE0,
+    0x07, 0xC0, 0x00, 0x00, 0xF8, 0x7C, 0x78, 0x78, 0x7C, 0x78, 0x3C, 0x78, 0x3C, 0xF0, 0x1E, 0xF0,
+    0x1E, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x07, 0xC0, 0x07, 0xC0, 0x4F, 0x80, 0x7F, 0x80, 0x7F, 0x00,
+    0x7E, 0x00, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78,
+    0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8,
+    0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xE0, 0x0F, 0xE0,
+    0x0F, 0xE0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1C, 0x78, 0x3C, 0x78, 0x3F, 0xF8, 0x7F, 0xFC, 0x7F, 0xFC,
+    0x78, 0x3C, 0xF0, 0x1E, 0xF0, 0x1E, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00,
+    0xFF, 0x80, 0xFF, 0xE0, 0xFF, 0xF0, 0xF3, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF3, 0xF0, 0xFF, 0xE0,
+    0xFF, 0xE0, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xE0, 0xFF, 0xF0, 0xF1, 0xF0, 0xF1, 0xF0, 0xFF, 0xE0,
+    0xFF, 0xE0, 0xFF, 0xF0, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF0, 0xFF, 0xF0, 0xFF, 0xE0,
+    0xFF, 0xC0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0x0F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0x1E, 0x00, 0x0F, 0x1E, 0x00, 0x0F,
+    0x1E, 0x00, 0x0F, 0x1E, 0x00, 0x0F, 0x1E, 0x00, 0x0F, 0x1E, 0x00, 0x1E, 0x1E, 0x00, 0x1E, 0x1E,
+    0x00, 0x3E, 0x1E, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xF0, 0x07, 0x80,
+    0xF0, 0x07, 0x80, 0xF0, 0x07, 0x80, 0xF0, 0x07, 0x80, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF8, 0xF0, 0xF0, 0x7C, 0xF1, 0xF0, 0x3C, 0xF3, 0xE0,
+    0x3E, 0xF7, 0xC0, 0x1F, 0xF7, 0xC0, 0x0F, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x0F,
+    0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x1F, 0xF7, 0xC0, 0x3E, 0xF3, 0xE0, 0x7C, 0xF1, 0xE0, 0x78, 0xF1,
+    0xF0, 0xF8, 0xF0, 0xF8, 0x3F, 0x80, 0x7F, 0xE0, 0x7F, 0xE0, 0x31, 0xF0, 0x01, 0xF0, 0x03, 0xE0,
+    0x1F, 0xE0, 0x1F, 0xE0, 0x1F, 0xF0, 0x01, 0xF0, 0x00, 0xF0, 0x71, 0xF0, 0x7F, 0xF0, 0xFF, 0xE0,
+    0x7F, 0xC0, 0xF0, 0x3C, 0xF0, 0x7C, 0xF0, 0xFC, 0xF1, 0xFC, 0xF1, 0xFC, 0xF3, 0xFC, 0xF7, 0xBC,
+    0xF7, 0xBC, 0xFF, 0x3C, 0xFE, 0x3C, 0xFE, 0x3C, 0xFC, 0x3C, 0xF8, 0x3C, 0xF8, 0x3C, 0xF0, 0x3C,
+    0x0C, 0xC0, 0x1E, 0xE0, 0x0F, 0xE0, 0x07, 0xC0, 0x00, 0x00, 0xF0, 0x3C, 0xF0, 0x7C, 0xF0, 0xFC,
+    0xF1, 0xFC, 0xF1, 0xFC, 0xF3, 0xFC, 0xF7, 0xBC, 0xF7, 0xBC, 0xFF, 0x3C, 0xFE, 0x3C, 0xFE, 0x3C,
+    0xFC, 0x3C, 0xF8, 0x3C, 0xF8, 0x3C, 0xF0, 0x3C, 0xF0, 0xF8, 0xF1, 0xF0, 0xF3, 0xE0, 0xF7, 0xC0,
+    0xFF, 0x80, 0xFF, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x80, 0xF7, 0xC0, 0xF3, 0xC0, 0xF3, 0xE0,
+    0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0x07, 0xFE, 0x07, 0xFE, 0x07, 0xFE, 0x0F, 0x1E, 0x0F, 0x1E,
+    0x0F, 0x1E, 0x0F, 0x1E, 0x0F, 0x1E, 0x0F, 0x1E, 0x0F, 0x1E, 0x1E, 0x1E, 0x7E, 0x1E, 0xFC, 0x1E,
+    0xFC, 0x1E, 0xF0, 0x1E, 0x78, 0x0F, 0x00, 0x7C, 0x1F, 0x00, 0x7C, 0x1F, 0x00, 0x7E, 0x3F, 0x00,
+    0x7E, 0x3F, 0x00, 0xFE, 0x3F, 0x00, 0xFF, 0x7F, 0x00, 0xF7, 0x77, 0x80, 0xF7, 0xF7, 0x80, 0xF7,
+    0xE7, 0x80, 0xF3, 0xE7, 0x80, 0xF3, 0xE7, 0x80, 0xF1, 0xC7, 0x80, 0xF0, 0x07, 0x80, 0xF0, 0x07,
+    0x80, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xFF, 0xF8, 0xFF,
+    0xF8, 0xFF, 0xF8, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0x0F,
+    0xE0, 0x3F, 0xF0, 0x7F, 0xF8, 0x7C, 0xFC, 0xF8, 0x3C, 0xF0, 0x3E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0,
+    0x1E, 0xF0, 0x3E, 0xF8, 0x3C, 0x7C, 0xFC, 0x7F, 0xF8, 0x3F, 0xF8, 0x0F, 0xE0, 0xFF, 0xF8, 0xFF,
+    0xF8, 0xFF, 0xF8, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0,
+    0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xFF, 0xC0, 0xFF, 0xE0, 0xFF,
+    0xF0, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF3, 0xF0, 0xFF, 0xF0, 0xFF, 0xE0, 0xFF, 0xC0, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x0F, 0xF0, 0x3F, 0xF0, 0x7F, 0xF0, 0x7E,
+    0xF0, 0xF8, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0xFC,
+    0x70, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0xF8, 0x7C, 0x78, 0x78, 0x7C, 0x78, 0x3C, 0x78, 0x3C, 0xF0, 0x1E,
+    0xF0, 0x1E, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x07, 0xC0, 0x07, 0xC0, 0x4F, 0x80, 0x7F, 0x80, 0x7F,
+    0x00, 0x7E, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0x00, 0x3F,
+    0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x79, 0xE7, 0x80, 0x79, 0xE3, 0xC0, 0x79, 0xE3, 0xC0, 0x79, 0xE7,
+    0x80, 0x7F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xE0, 0x00,
+    0x01, 0xE0, 0x00, 0xF8, 0x7C, 0x7C, 0x78, 0x3C, 0xF8, 0x3F, 0xF0, 0x1F, 0xE0, 0x0F, 0xE0, 0x0F,
+    0xC0, 0x07, 0xC0, 0x0F, 0xC0, 0x1F, 0xE0, 0x1F, 0xF0, 0x3F, 0xF0, 0x7C, 0xF8, 0x78, 0x7C, 0xF8,
+    0x7C, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0,
+    0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF8,
+    0x78, 0x78, 0x78, 0x7C, 0x78, 0x7F, 0xF8, 0x3F, 0xF8, 0x1F, 0xF8, 0x00, 0x78, 0x00, 0x78, 0x00,
+    0x78, 0x00, 0x78, 0x00, 0x78, 0xF0, 0xF1, 0xE0, 0xF0, 0xF1, 0xE0, 0xF0, 0xF1, 0xE0, 0xF0, 0xF1,
+    0xE0, 0xF0, 0xF1, 0xE0, 0xF0, 0xF1, 0xE0, 0xF0, 0xF1, 0xE0, 0xF0, 0xF1, 0xE0, 0xF0, 0xF1, 0xE0,
+    0xF0, 0xF1, 0xE0, 0xF0, 0xF1, 0xE0, 0xF0, 0xF1, 0xE0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0xFF,
+    0xFF, 0xE0, 0xF0, 0xF1, 0xE0, 0xF0, 0xF1, 0xE0, 0xF0, 0xF1, 0xE0, 0xF0, 0xF1, 0xE0, 0xF0, 0xF1,
+    0xE0, 0xF0, 0xF1, 0xE0, 0xF0, 0xF1, 0xE0, 0xF0, 0xF1, 0xE0, 0xF0, 0xF1, 0xE0, 0xF0, 0xF1, 0xE0,
+    0xF0, 0xF1, 0xE0, 0xF0, 0xF1, 0xE0, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0xF8, 0x0F, 0xFC, 0x0F, 0xFE, 0x0F, 0x3E, 0x0F, 0x1F, 0x0F,
+    0x1F, 0x0F, 0x3E, 0x0F, 0xFE, 0x0F, 0xFC, 0x0F, 0xF8, 0xF0, 0x07, 0x80, 0xF0, 0x07, 0x80, 0xF0,
+    0x07, 0x80, 0xF0, 0x07, 0x80, 0xF0, 0x07, 0x80, 0xFF, 0x87, 0x80, 0xFF, 0xE7, 0x80, 0xFF, 0xE7,
+    0x80, 0xF3, 0xF7, 0x80, 0xF0, 0xF7, 0x80, 0xF0, 0xF7, 0x80, 0xF3, 0xF7, 0x80, 0xFF, 0xE7, 0x80,
+    0xFF, 0xE7, 0x80, 0xFF, 0x87, 0x80, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xFF, 0xC0, 0xFF, 0xE0, 0xFF, 0xF0, 0xF3, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF3, 0xF0, 0xFF, 0xF0,
+    0xFF, 0xE0, 0xFF, 0x80, 0x3F, 0xC0, 0x7F, 0xE0, 0x7F, 0xF0, 0x71, 0xF8, 0x00, 0x78, 0x00, 0x78,
+    0x1F, 0xFC, 0x1F, 0xFC, 0x1F, 0xFC, 0x00, 0x78, 0x00, 0x78, 0x71, 0xF8, 0x7F, 0xF0, 0x7F, 0xE0,
+    0x3F, 0xC0, 0xF0, 0x3F, 0x80, 0xF0, 0x7F, 0xE0, 0xF0, 0xFF, 0xE0, 0xF1, 0xF9, 0xF0, 0xF1, 0xE0,
+    0xF8, 0xF3, 0xE0, 0x78, 0xFF, 0xC0, 0x78, 0xFF, 0xC0, 0x78, 0xFF, 0xC0, 0x78, 0xF3, 0xE0, 0x78,
+    0xF1, 0xE0, 0xF8, 0xF1, 0xF9, 0xF0, 0xF0, 0xFF, 0xF0, 0xF0, 0xFF, 0xE0, 0xF0, 0x3F, 0x80, 0x0F,
+    0xF8, 0x1F, 0xF8, 0x3F, 0xF8, 0x3E, 0x78, 0x78, 0x78, 0x78, 0x78, 0x7E, 0x78, 0x3F, 0xF8, 0x3F,
+    0xF8, 0x1F, 0xF8, 0x1E, 0x78, 0x3E, 0x78, 0x3C, 0x78, 0x7C, 0x78, 0x78, 0x78, 0x3F, 0x80, 0x3F,
+    0xC0, 0x3F, 0xC0, 0x33, 0xE0, 0x3F, 0xE0, 0x7F, 0xE0, 0x79, 0xE0, 0xF9, 0xE0, 0x7F, 0xE0, 0x7F,
+    0xE0, 0x3F, 0xC0, 0x03, 0xE0, 0x0F, 0xE0, 0x1F, 0xE0, 0x3F, 0xC0, 0x7C, 0x00, 0x7F, 0xC0, 0x7F,
+    0xE0, 0x7F, 0xE0, 0x79, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x7D, 0xF0, 0x7F, 0xE0, 0x3F,
+    0xE0, 0x1F, 0x80, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xC0, 0xF3, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xF1,
+    0xE0, 0xF1, 0xE0, 0xFF, 0xE0, 0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x1F,
+    0xF0, 0x1F, 0xF0, 0x1F, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0xFF,
+    0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0x1F, 0x80, 0x3F, 0xE0, 0x7F,
+    0xE0, 0x79, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x78, 0x00, 0x7C, 0x60, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F,
+    0xE0, 0xF9, 0xE7, 0x80, 0x7D, 0xEF, 0x80, 0x3D, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFC, 0x00,
+    0x0F, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x3D, 0xEF, 0x00, 0x79, 0xE7, 0x80, 0xF9,
+    0xE7, 0xC0, 0x7F, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x67, 0xC0, 0x3F, 0x80, 0x3F, 0x80, 0x03, 0xC0,
+    0x63, 0xC0, 0x7F, 0xC0, 0xFF, 0x80, 0x7F, 0x00, 0xF1, 0xE0, 0xF3, 0xE0, 0xF7, 0xE0, 0xF7, 0xE0,
+    0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFD, 0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0xF1, 0xE0, 0x31, 0x80,
+    0x3B, 0x80, 0x3F, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xE0, 0xF3, 0xE0, 0xF7, 0xE0,
+    0xF7, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFD, 0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0xF1, 0xE0,
+    0xF3, 0xE0, 0xF7, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x80,
+    0xF7, 0xC0, 0xF3, 0xC0, 0xF1, 0xE0, 0x1F, 0xF0, 0x1F, 0xF0, 0x1F, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0,
+    0x1E, 0xF0, 0x3C, 0xF0, 0x7C, 0xF0, 0xFC, 0xF0, 0xF8, 0xF0, 0xF0, 0xF0, 0x70, 0x38, 0x78, 0x78,
+    0xF8, 0xFC, 0xFC, 0xFC, 0xFD, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xBC, 0xF7, 0xBC, 0xF7, 0xBC,
+    0xF0, 0x3C, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0,
+    0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xE0, 0x7D, 0xF0,
+    0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x7D, 0xF0, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xC0, 0xFF, 0xC0,
+    0xFF, 0xC0, 0xFF, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0,
+    0xF3, 0xC0, 0xF3, 0xC0, 0xFF, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xF3, 0xE0, 0xF1, 0xE0, 0xF1, 0xE0,
+    0xF1, 0xE0, 0xF3, 0xE0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0x80, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0x7C, 0x80, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00,
+    0x7C, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x1F, 0xC0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x0E, 0x00,
+    0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0xF0, 0xF0,
+    0xF1, 0xE0, 0x79, 0xE0, 0x79, 0xE0, 0x7B, 0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x1F, 0x80, 0x1F, 0x80,
+    0x1F, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x01, 0xC0, 0x03, 0xC0,
+    0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x0F, 0xF8, 0x3F, 0xFC, 0x7F, 0xFE, 0x7F, 0xDF, 0x7B, 0xCF,
+    0x7B, 0xCF, 0x7B, 0xCF, 0x7F, 0xDF, 0x7F, 0xFE, 0x3F, 0xFC, 0x0F, 0xF8, 0x03, 0xC0, 0x03, 0xC0,
+    0x03, 0xC0, 0x03, 0xC0, 0xF1, 0xE0, 0x79, 0xE0, 0x3F, 0xC0, 0x3F, 0x80, 0x1F, 0x80, 0x0F, 0x00,
+    0x1F, 0x80, 0x3F, 0xC0, 0x7B, 0xC0, 0x79, 0xE0, 0xF1, 0xF0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0,
+    0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0,
+    0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x71, 0xE0, 0x71, 0xE0, 0x71, 0xE0, 0x71, 0xE0, 0x79, 0xE0,
+    0x7F, 0xE0, 0x7F, 0xE0, 0x3F, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0xF3, 0xCF, 0xF3, 0xCF,
+    0xF3, 0xCF, 0xF3, 0xCF, 0xF3, 0xCF, 0xF3, 0xCF, 0xF3, 0xCF, 0xF3, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF3, 0xCF, 0x00, 0xF3, 0xCF, 0x00, 0xF3, 0xCF, 0x00, 0xF3, 0xCF, 0x00, 0xF3, 0xCF,
+    0x00, 0xF3, 0xCF, 0x00, 0xF3, 0xCF, 0x00, 0xF3, 0xCF, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0xFE, 0x00, 0xFE, 0x00,
+    0xFE, 0x00, 0x1E, 0x00, 0x1F, 0xE0, 0x1F, 0xF0, 0x1F, 0xF8, 0x1E, 0x78, 0x1F, 0xF8, 0x1F, 0xF8,
+    0x1F, 0xE0, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xFF, 0x9E, 0xFF, 0xDE, 0xFF, 0xDE,
+    0xF3, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0x9E, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xC0, 0xF3, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0x80, 0x7F, 0x00,
+    0x7F, 0x80, 0x7F, 0xC0, 0x63, 0xC0, 0x3F, 0xC0, 0x3F, 0xE0, 0x03, 0xC0, 0x67, 0xC0, 0x7F, 0xC0,
+    0xFF, 0x80, 0xFF, 0x00, 0xF0, 0xFC, 0x00, 0xF1, 0xFE, 0x00, 0xF3, 0xFF, 0x00, 0xF3, 0xEF, 0x00,
+    0xFF, 0xC7, 0x80, 0xFF, 0x87, 0x80, 0xFF, 0xC7, 0x80, 0xF3, 0xCF, 0x00, 0xF3, 0xFF, 0x00, 0xF1,
+    0xFE, 0x00, 0xF0, 0xFC, 0x00, 0x1F, 0xE0, 0x3F, 0xE0, 0x7F, 0xE0, 0x79, 0xE0, 0x79, 0xE0, 0x7F,
+    0xE0, 0x7F, 0xE0, 0x3F, 0xE0, 0x3D, 0xE0, 0x79, 0xE0, 0x79, 0xE0, 0x0C, 0x00, 0x0E, 0x00, 0x0F,
+    0x00, 0x07, 0x80, 0x03, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x7F, 0xE0, 0x79, 0xF0, 0x7F,
+    0xF0, 0x7F, 0xF0, 0x78, 0x00, 0x7C, 0x60, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xE0, 0x3D, 0xC0, 0x3D,
+    0xE0, 0x3D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x7F, 0xE0, 0x79, 0xF0, 0x7F,
+    0xF0, 0x7F, 0xF0, 0x78, 0x00, 0x7C, 0x60, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xE0, 0x78, 0x00, 0x78,
+    0x00, 0xFF, 0x00, 0xFF, 0x00, 0x78, 0x00, 0x7F, 0xC0, 0x7F, 0xE0, 0x7F, 0xE0, 0x79, 0xE0, 0x78,
+    0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x01, 0xF0, 0x07,
+    0xE0, 0x07, 0xE0, 0x07, 0xC0, 0x0C, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x00,
+    0x00, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0x78, 0xC0, 0xFF,
+    0x00, 0xFF, 0x00, 0xF0, 0x00, 0x7C, 0xC0, 0x7F, 0xC0, 0x3F, 0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0x7F,
+    0x80, 0x7F, 0x80, 0x79, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x3F, 0xC0, 0x63, 0xC0, 0x7F, 0xC0, 0x7F,
+    0x80, 0x7F, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0x73, 0x80, 0x7F, 0x80, 0x73, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x1E,
+    0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E,
+    0x00, 0x1E, 0x00, 0x1E, 0x1E, 0x1E, 0x1E, 0x00, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+    0x1E, 0x1E, 0x1E, 0x1E, 0xFE, 0xFC, 0xF8, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00,
+    0x1E, 0xF0, 0x00, 0x1E, 0xFF, 0x80, 0x1E, 0xFF, 0xC0, 0x3C, 0xFF, 0xC0, 0x7C, 0xF3, 0xE0, 0xFC,
+    0xFF, 0xC0, 0xF8, 0xFF, 0xC0, 0xF0, 0xFF, 0x80, 0xF3, 0xC0, 0x00, 0xF3, 0xC0, 0x00, 0xF3, 0xC0,
+    0x00, 0xF3, 0xC0, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0xF3, 0xCF, 0x80,
+    0xF3, 0xFF, 0x80, 0xF3, 0xFF, 0x00, 0xF1, 0xFE, 0x00, 0x78, 0x00, 0x78, 0x00, 0xFF, 0x00, 0xFF,
+    0x00, 0x78, 0x00, 0x7F, 0xC0, 0x7F, 0xE0, 0x7F, 0xE0, 0x79, 0xE0, 0x78, 0xF0, 0x78, 0xF0, 0x78,
+    0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x02, 0x00, 0x07, 0x00, 0x0F, 0x00, 0x1E,
+    0x00, 0x0C, 0x00, 0x00, 0x00, 0xF3, 0xE0, 0xF7, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xFE, 0x00, 0xFE,
+    0x00, 0xFF, 0x00, 0xFF, 0x80, 0xF7, 0xC0, 0xF3, 0xC0, 0xF1, 0xE0, 0x18, 0x00, 0x3C, 0x00, 0x3C,
+    0x00, 0x1E, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xF1, 0xE0, 0xF3, 0xE0, 0xF7, 0xE0, 0xF7, 0xE0, 0xFF,
+    0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFD, 0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0xF1, 0xE0, 0x19, 0x80, 0x3B,
+    0xC0, 0x3F, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF1, 0xE0, 0x79, 0xE0, 0x79,
+    0xE0, 0x7B, 0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x1F, 0x80, 0x1F, 0x80, 0x1F, 0x00, 0x0F, 0x00, 0x1E,
+    0x00, 0xFE, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3,
+    0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x1E, 0x00, 0x1E,
+    0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x1E, 0x00, 0x1F,
+    0xF0, 0x1F, 0xFC, 0x1F, 0xFE, 0x1E, 0x7E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x7E, 0x1F, 0xFC, 0x1F,
+    0xFC, 0x1F, 0xF0, 0x1C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0xFF, 0xC0, 0xFF,
+    0xC0, 0xFF, 0xC0, 0x3C, 0x00, 0x3C, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x3C, 0xF8, 0x3F, 0xF8, 0x3F,
+    0xF0, 0x1F, 0xE0, 0x0F, 0xE0, 0x3F, 0xF0, 0x7F, 0xF8, 0x7C, 0xFC, 0xF0, 0x3C, 0xFF, 0xBE, 0xFF,
+    0xFE, 0xFF, 0xFE, 0xFB, 0xFE, 0xF0, 0x3E, 0xF8, 0x3C, 0x7E, 0xFC, 0x7F, 0xF8, 0x3F, 0xF8, 0x0F,
+    0xE0, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xE0, 0x7D, 0xF0, 0x7E, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x7D,
+    0xF0, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xC0, 0xF0, 0x0F, 0x80, 0xF8, 0x1F, 0x80, 0x78, 0x3F, 0x80,
+    0x78, 0x3D, 0x00, 0x7C, 0x3C, 0x00, 0x3C, 0x78, 0x00, 0x3C, 0x78, 0x00, 0x1E, 0xF0, 0x00, 0x1E,
+    0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xC0,
+    0x00, 0x07, 0xC0, 0x00, 0xF0, 0xF8, 0xF1, 0xF8, 0x79, 0xF8, 0x79, 0xC0, 0x7B, 0xC0, 0x3B, 0xC0,
+    0x3F, 0x80, 0x1F, 0x80, 0x1F, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x1E, 0xE0, 0x0F, 0xE0, 0x0F, 0xC0,
+    0x00, 0x00, 0xF0, 0x3C, 0xF0, 0x7C, 0xF0, 0xFC, 0xF1, 0xFC, 0xF1, 0xFC, 0xF3, 0xFC, 0xF7, 0xBC,
+    0xF7, 0xBC, 0xFF, 0x3C, 0xFE, 0x3C, 0xFE, 0x3C, 0xFC, 0x3C, 0xF8, 0x3F, 0xF8, 0x3F, 0xF0, 0x3F,
+    0x00, 0x1E, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x1C, 0x7B, 0x80, 0x7F, 0x80, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0xC0, 0xF3, 0xC0, 0xF7, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFD, 0xC0,
+    0xF9, 0xC0, 0xF9, 0xF0, 0xF1, 0xF0, 0xF1, 0xF0, 0x00, 0xF0, 0x01, 0xE0, 0x00, 0xC0, 0x38, 0x00,
+    0x38, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x38, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x3F, 0xF8, 0x38, 0xF8,
+    0x38, 0x78, 0x38, 0x78, 0x38, 0xF8, 0x3F, 0xF8, 0x3F, 0xF0, 0x3F, 0xE0, 0x78, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x78, 0x00, 0x7F, 0xC0, 0x7F, 0xE0, 0x79, 0xE0, 0x79, 0xF0, 0x7F, 0xE0, 0x7F, 0xE0,
+    0x7F, 0xC0, 0xFF, 0xC0, 0xFF, 0xE0, 0xFF, 0xF0, 0xF1, 0xF0, 0xF2, 0xF0, 0xFF, 0xF0, 0xF7, 0xF0,
+    0xFF, 0xF0, 0xFF, 0xE0, 0xFF, 0xC0, 0xF1, 0xE0, 0xF0, 0xE0, 0xF0, 0x80, 0xF0, 0x00, 0xF0, 0x00,
+    0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xE0, 0xF3, 0xE0, 0xF1, 0xE0, 0xF1, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0,
+    0xFF, 0xE0, 0xFF, 0xC0, 0xFF, 0xC0, 0xF1, 0xC0, 0xF1, 0xC0, 0xF0, 0x80, 0xF0, 0x00, 0x01, 0xE0,
+    0x01, 0xE0, 0x01, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xF0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x3F, 0xF0,
+    0x3F, 0xF0, 0x3F, 0xF0, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80,
+    0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x7F, 0xC0, 0x7F, 0xC0,
+    0x7F, 0xC0, 0x78, 0x00, 0x78, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00,
+    0x78, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xC0,
+    0xFF, 0xE0, 0xFF, 0xF0, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0xF0,
+    0x01, 0xF0, 0x07, 0xF0, 0x07, 0xE0, 0x07, 0xC0, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xF0, 0x00,
+    0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xF3, 0xC0, 0xF1, 0xE0, 0xF1, 0xE0, 0x03, 0xC0,
+    0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0xF8, 0xF0, 0xF0, 0x7C, 0xF1, 0xF0, 0x3C, 0xF3, 0xE0, 0x3E,
+    0xF7, 0xC0, 0x1F, 0xF7, 0xC0, 0x0F, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFF,
+    0x00, 0x0F, 0xFF, 0x80, 0x1F, 0xF7, 0xC0, 0x3E, 0xF7, 0xE0, 0x7C, 0xF3, 0xF8, 0x78, 0xF1, 0xF8,
+    0xF8, 0xF0, 0xF8, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0xF9,
+    0xE7, 0x80, 0x7D, 0xEF, 0x80, 0x3D, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFC,
+    0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x3D, 0xFF, 0xC0, 0x79, 0xEF, 0xC0, 0xF9, 0xE7, 0xC0,
+    0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x3F, 0x80, 0x7F, 0xE0, 0x7F, 0xE0, 0x31,
+    0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x1F, 0xE0, 0x1F, 0xE0, 0x1F, 0xF0, 0x01, 0xF0, 0x00, 0xF0, 0x71,
+    0xF0, 0x7F, 0xF0, 0xFF, 0xE0, 0x7F, 0xC0, 0x06, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x1F, 0x00, 0x1F,
+    0x00, 0x7F, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x67, 0xC0, 0x3F, 0x80, 0x3F, 0x80, 0x03, 0xC0, 0x63,
+    0xC0, 0x7F, 0xC0, 0xFF, 0x80, 0xFF, 0x80, 0x0C, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x3E, 0x00, 0x3E,
+    0x00, 0xF0, 0xF8, 0xF1, 0xF0, 0xF3, 0xE0, 0xF7, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xFE, 0x00, 0xFF,
+    0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xF7, 0xE0, 0xF3, 0xE0, 0xF1, 0xFC, 0xF0, 0xFC, 0xF0, 0x7C, 0x00,
+    0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0xF3, 0xE0, 0xF3, 0xC0, 0xF7, 0x80, 0xFF, 0x00, 0xFE,
+    0x00, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x80, 0xF7, 0xF0, 0xF3, 0xF0, 0xF1, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xF0, 0xF0, 0x3E, 0xF0, 0x3C, 0xF6, 0x7C, 0xF6, 0xF8, 0xF7, 0xF0, 0xFF, 0xE0, 0xFF,
+    0xE0, 0xFF, 0xE0, 0xF7, 0xF0, 0xF6, 0xF8, 0xF6, 0xF8, 0xF0, 0x7C, 0xF0, 0x3C, 0xF0, 0x3E, 0xF0,
+    0x1E, 0xF0, 0xF8, 0xFC, 0xF0, 0xFD, 0xE0, 0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xE0, 0xFD,
+    0xE0, 0xF1, 0xF0, 0xF0, 0xF8, 0xF0, 0x78, 0x3C, 0x00, 0x3C, 0x3E, 0xFE, 0x7C, 0xFE, 0xF8, 0x3D,
+    0xF0, 0x3F, 0xE0, 0x3F, 0xC0, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0xE0, 0x3D, 0xE0, 0x3C,
+    0xF0, 0x3C, 0xF8, 0x3C, 0x7C, 0x3C, 0x3C, 0x78, 0x00, 0xFE, 0xF8, 0xFF, 0xF0, 0xFF, 0xE0, 0x7F,
+    0xC0, 0x7F, 0x80, 0x7F, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x7B, 0xE0, 0x79, 0xF0, 0x78, 0xF0, 0xFF,
+    0x1F, 0x00, 0xFF, 0x3E, 0x00, 0xFF, 0x3C, 0x00, 0x0F, 0x78, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF0,
+    0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0x78, 0x00, 0x0F, 0x7C, 0x00,
+    0x0F, 0x3E, 0x00, 0x0F, 0x1E, 0x00, 0x0F, 0x1F, 0x00, 0x0F, 0x0F, 0x80, 0xFE, 0x78, 0xFE, 0xF0,
+    0xFF, 0xE0, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xE0, 0x1F, 0xF0, 0x1E, 0xF8, 0x1E, 0x78,
+    0x1E, 0x7C, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xFF, 0xF8,
+    0xFF, 0xF8, 0xFF, 0xF8, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x7F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0,
+    0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xF3, 0xC0, 0xF3, 0xF0, 0xF3, 0xF0, 0xF3, 0xF0, 0x00, 0x70,
+    0x00, 0x70, 0x00, 0x70, 0xF0, 0x7F, 0x80, 0xF0, 0x7F, 0x80, 0xF0, 0x7F, 0x80, 0xF0, 0x78, 0x00,
+    0xF0, 0x78, 0x00, 0xF0, 0x78, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x00, 0xF0,
+    0x78, 0x00, 0xF0, 0x78, 0x00, 0xF0, 0x78, 0x00, 0xF0, 0x78, 0x00, 0xF0, 0x78, 0x00, 0xF0, 0x78,
+    0x00, 0xF3, 0xF8, 0xF3, 0xF8, 0xF3, 0xF8, 0xF3, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xF3,
+    0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x00,
+    0xF0, 0x78, 0x00, 0xF0, 0x78, 0x00, 0xF0, 0x78, 0x00, 0xF0, 0x7F, 0xE0, 0xF0, 0x7F, 0xF0, 0xF0,
+    0x7F, 0xF8, 0xF0, 0x78, 0xF8, 0xF0, 0x78, 0x78, 0xF0, 0x78, 0x3C, 0xF0, 0x78, 0x3C, 0xF0, 0x78,
+    0x3C, 0xF0, 0x78, 0x78, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0,
+    0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xF3, 0xC0, 0x00, 0xF3, 0xFE, 0x00, 0xF3,
+    0xFF, 0x00, 0xF3, 0xFF, 0x00, 0xF3, 0xCF, 0x80, 0xF3, 0xC7, 0x80, 0xF3, 0xC7, 0x80, 0xF3, 0xC7,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xE0, 0x3F,
+    0xE0, 0x7F, 0xE0, 0x7E, 0x60, 0xF8, 0x00, 0xF1, 0xFC, 0xF3, 0xFE, 0xF3, 0xFE, 0xF7, 0xDE, 0xF7,
+    0x8E, 0xF7, 0x9E, 0xFF, 0xBE, 0x7F, 0xFE, 0x3F, 0xFC, 0x1F, 0xF0, 0x01, 0xFC, 0x00, 0xFE, 0x00,
+    0x7E, 0x00, 0x1E, 0x1F, 0xC0, 0x3F, 0xC0, 0x7F, 0x80, 0x7F, 0xF0, 0x73, 0xF8, 0x77, 0xB8, 0x77,
+    0x38, 0x7F, 0x78, 0x7F, 0xF8, 0x3F, 0xF0, 0x1F, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xF8, 0x0F,
+    0xF0, 0x3F, 0xF0, 0x7F, 0xF0, 0x7E, 0xF0, 0xF8, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x70, 0x7F, 0xF0, 0x3F, 0xF0, 0x0F, 0xF0, 0x07, 0x00, 0x07,
+    0x80, 0x03, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x1F, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0x7C, 0x80, 0x78,
+    0x00, 0x78, 0x00, 0x78, 0x00, 0x7C, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x0F, 0xC0, 0x0F, 0x00, 0x07,
+    0x00, 0x1F, 0x00, 0x1F, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0xE0, 0x0F,
+    0xE0, 0x0F, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF,
+    0xE0, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1F, 0x80, 0x1F, 0x80, 0x1F,
+    0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0xF8, 0x3C, 0xF8, 0x78, 0x7C, 0x78, 0x3C, 0xF0, 0x3F,
+    0xF0, 0x1F, 0xE0, 0x1F, 0xE0, 0x0F, 0xC0, 0x0F, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07,
+    0x80, 0x07, 0x80, 0x07, 0x80, 0xF1, 0xF0, 0xF1, 0xE0, 0x79, 0xE0, 0x79, 0xE0, 0x7B, 0xC0, 0x3F,
+    0xC0, 0x3F, 0x80, 0x1F, 0x80, 0x1F, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0xF8, 0x3C, 0xF8, 0x78, 0x78, 0x78, 0x3C, 0xF0, 0x3F, 0xF0, 0x1F, 0xE0, 0x1F,
+    0xE0, 0x0F, 0xC0, 0x0F, 0xC0, 0x3F, 0xF0, 0x3F, 0xF0, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07,
+    0x80, 0xF1, 0xF0, 0xF1, 0xE0, 0x79, 0xE0, 0x79, 0xE0, 0x7B, 0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x1F,
+    0x80, 0x1F, 0x80, 0x7F, 0xC0, 0x7F, 0xC0, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0xF8,
+    0x7C, 0x7C, 0x78, 0x3C, 0xF8, 0x3F, 0xF0, 0x1F, 0xE0, 0x0F, 0xE0, 0x0F, 0xC0, 0x07, 0xC0, 0x0F,
+    0xC0, 0x1F, 0xE0, 0x1F, 0xF0, 0x3F, 0xF0, 0x7C, 0xFE, 0x78, 0x7E, 0xF8, 0x7E, 0x00, 0x1E, 0x00,
+    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0xF9, 0xE0, 0x79, 0xE0, 0x3F, 0xC0, 0x3F, 0x80, 0x1F, 0x80, 0x0F,
+    0x00, 0x1F, 0x80, 0x3F, 0xC0, 0x7F, 0xF0, 0x79, 0xF0, 0xF1, 0xF0, 0x00, 0x70, 0x00, 0x70, 0x00,
+    0x70, 0xFF, 0xF7, 0x80, 0xFF, 0xF7, 0x80, 0xFF, 0xF7, 0x80, 0x0F, 0x07, 0x80, 0x0F, 0x07, 0x80,
+    0x0F, 0x07, 0x80, 0x0F, 0x07, 0x80, 0x0F, 0x07, 0x80, 0x0F, 0x07, 0x80, 0x0F, 0x07, 0x80, 0x0F,
+    0x07, 0x80, 0x0F, 0x07, 0x80, 0x0F, 0xFF, 0xE0, 0x0F, 0xFF, 0xE0, 0x0F, 0xFF, 0xE0, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0xFF, 0x78, 0xFF, 0x78, 0xFF, 0x78,
+    0x3C, 0x78, 0x3C, 0x78, 0x3C, 0x78, 0x3C, 0x78, 0x3C, 0x78, 0x3F, 0xFE, 0x3F, 0xFE, 0x3F, 0xFE,
+    0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF8, 0xF0, 0xFF, 0xF0, 0x7F, 0xF0, 0x3F, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFC,
+    0x00, 0xFC, 0x00, 0xFC, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0xF1, 0xE0, 0xF1, 0xE0,
+    0xF1, 0xE0, 0xF1, 0xE0, 0xF9, 0xE0, 0xFF, 0xE0, 0x7F, 0xE0, 0x3F, 0xE0, 0x01, 0xF8, 0x01, 0xF8,
+    0x01, 0xF8, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF6, 0xF0, 0xFE, 0xF0, 0xFF, 0xF0, 0x7F, 0xF0, 0x3F, 0xF0, 0x06, 0xF0, 0x06, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0xF1, 0xE0, 0xF1, 0xE0, 0xF1, 0xE0, 0xF7, 0xE0, 0xFF, 0xE0,
+    0xFF, 0xE0, 0x7F, 0xE0, 0x3F, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x01, 0xE0, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF1, 0xF8, 0xF0, 0x78,
+    0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0,
+    0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0x01, 0xFE, 0x00, 0x03, 0xFF, 0x00,
+    0xE7, 0xFF, 0x80, 0xEF, 0xCF, 0x80, 0xFF, 0x07, 0xC0, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x3F,
+    0xFF, 0xC0, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xE7, 0x00, 0x07, 0xFF,
+    0x80, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0xC3, 0xF0, 0xE7, 0xF8, 0xEF, 0xFC, 0xFF, 0x3C, 0x7F,
+    0xFC, 0x3F, 0xFC, 0x1E, 0x00, 0x0F, 0x98, 0x0F, 0xF8, 0x07, 0xFC, 0x03, 0xF8, 0x01, 0xFC, 0x00,
+    0x03, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0xE7, 0xCF, 0x80, 0xEF, 0x87, 0x80, 0xFF, 0x03, 0xC0, 0xFF,
+    0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC7,
+    0x00, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00,
+    0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x03, 0xF0, 0xC7, 0xF8, 0xEF, 0xFC, 0xEF, 0x7C, 0xFE, 0x3C,
+    0x7F, 0xFC, 0x3F, 0xFC, 0x1F, 0x18, 0x0F, 0xF8, 0x0F, 0xFC, 0x03, 0xF8, 0x01, 0xE0, 0x01, 0xE0,
+    0x01, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0x01, 0x98, 0x00, 0x03, 0xDC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xF0, 0xF0, 0x7C, 0xF1, 0xF0, 0x3C, 0xF3, 0xE0, 0x3E, 0xF7, 0xC0, 0x1F, 0xF7, 0xC0, 0x0F,
+    0xFF, 0x80, 0x07, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x1F, 0xF7,
+    0xC0, 0x3E, 0xF3, 0xE0, 0x7C, 0xF1, 0xE0, 0x78, 0xF1, 0xF0, 0xF8, 0xF0, 0xF8, 0x03, 0x30, 0x00,
+    0x07, 0x78, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xE7, 0x80, 0x7D, 0xEF, 0x80, 0x3D, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFC,
+    0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x3D, 0xEF, 0x00, 0x79, 0xE7, 0x80, 0xF9, 0xE7, 0xC0,
+    0xF0, 0xF8, 0xF1, 0xF0, 0xF3, 0xE0, 0xF7, 0xC0, 0xF7, 0x80, 0xFF, 0x00, 0xFF, 0xC0, 0xFF, 0xE0,
+    0xFF, 0xF0, 0xF3, 0xF0, 0xF0, 0xF8, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0xF8, 0x01, 0xF0,
+    0x07, 0xF0, 0x07, 0xE0, 0x07, 0xC0, 0xF3, 0xE0, 0xF3, 0xC0, 0xF7, 0x80, 0xFF, 0x00, 0xFE, 0x00,
+    0xFF, 0x80, 0xFF, 0xC0, 0xF7, 0xC0, 0xF1, 0xE0, 0xF1, 0xE0, 0xF1, 0xE0, 0x01, 0xE0, 0x03, 0xC0,
+    0x0F, 0xC0, 0x0F, 0x80, 0x0F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0x1E, 0x00,
+    0x0F, 0x1E, 0x00, 0x0F, 0x1E, 0x00, 0x0F, 0x1E, 0x00, 0x0F, 0x1E, 0x00, 0x0F, 0x1E, 0x00, 0x1E,
+    0x1E, 0x00, 0x1E, 0x1E, 0x00, 0x7E, 0x1E, 0x00, 0xFC, 0x1F, 0x80, 0xF8, 0x1F, 0x80, 0xF0, 0x1F,
+    0x80, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x06, 0x00, 0x1F, 0xF0, 0x1F,
+    0xF0, 0x1F, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x3C, 0xF0, 0x7C, 0xF0, 0xFC, 0xFC, 0xF8,
+    0xFC, 0xF0, 0xFC, 0x00, 0x38, 0x00, 0x78, 0x00, 0x30, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0,
+    0x78, 0xF0, 0x78, 0xF0, 0x78, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xF0, 0x78, 0xF0, 0x78, 0xF0,
+    0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0x00, 0x78, 0x01, 0xF8, 0x01, 0xF0, 0x01, 0xF0, 0xF1,
+    0xE0, 0xF1, 0xE0, 0xF1, 0xE0, 0xF1, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF1, 0xE0, 0xF1,
+    0xE0, 0xF1, 0xE0, 0xF1, 0xC0, 0x03, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0xF0, 0x78, 0xF0,
+    0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xF0,
+    0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x7E, 0xF0, 0x7E, 0xF0, 0x7E, 0x00, 0x1E, 0x00, 0x1C, 0x00,
+    0x3C, 0x00, 0x18, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF,
+    0xC0, 0xF3, 0xC0, 0xF3, 0xF0, 0xF3, 0xF0, 0xF3, 0xF0, 0x00, 0xE0, 0x01, 0xE0, 0x01, 0xC0, 0xF0,
+    0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF8, 0x78, 0x78, 0x78, 0x7C, 0x78, 0x7F, 0xF8, 0x3F,
+    0xF8, 0x1F, 0xF8, 0x00, 0x78, 0x00, 0x78, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xC0, 0x03,
+    0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x71, 0xE0, 0x71, 0xE0, 0x71, 0xE0, 0x79, 0xE0, 0x7F, 0xE0, 0x7F,
+    0xE0, 0x3F, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x78, 0x0F, 0x00, 0x7C, 0x1F, 0x00, 0x7C, 0x1F, 0x00, 0x7E, 0x3F, 0x00, 0x7E, 0x3F, 0x00,
+    0xFE, 0x3F, 0x00, 0xFF, 0x7F, 0x00, 0xF7, 0x77, 0x80, 0xF7, 0xF7, 0x80, 0xF7, 0xE7, 0x80, 0xF3,
+    0xE7, 0x80, 0xF3, 0xE7, 0x80, 0xF1, 0xC7, 0xE0, 0xF0, 0x07, 0xE0, 0xF0, 0x07, 0xE0, 0x00, 0x01,
+    0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x01, 0x80, 0xF0, 0x78, 0xF8, 0x78, 0xF8, 0xF8,
+    0xFC, 0xF8, 0xFD, 0xF8, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xBC, 0xF7, 0xBF, 0xF7, 0x3F, 0xE0, 0x3E,
+    0x00, 0x0E, 0x00, 0x1C, 0x00, 0x1C, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x0C, 0x60, 0x0E, 0xE0, 0x0F, 0xE0, 0x07, 0xC0, 0x00, 0x00, 0x07,
+    0xC0, 0x07, 0xC0, 0x07, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1C, 0x78, 0x3C,
+    0x78, 0x3F, 0xF8, 0x7F, 0xFC, 0x7F, 0xFC, 0x78, 0x3C, 0xF0, 0x1E, 0xF0, 0x1E, 0x19, 0x80, 0x3B,
+    0xC0, 0x3F, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x3F, 0xC0, 0x33,
+    0xE0, 0x3F, 0xE0, 0x7F, 0xE0, 0x79, 0xE0, 0xF9, 0xE0, 0x7F, 0xE0, 0x7F, 0xE0, 0x3F, 0xC0, 0x1E,
+    0xE0, 0x1E, 0xF0, 0x1E, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xE0, 0x0F, 0xE0, 0x0F,
+    0xE0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1C, 0x78, 0x3C, 0x78, 0x3F, 0xF8, 0x7F, 0xFC, 0x7F, 0xFC, 0x78,
+    0x3C, 0xF0, 0x1E, 0xF0, 0x1E, 0x3B, 0xC0, 0x7B, 0xC0, 0x3B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0x80, 0x3F, 0xC0, 0x3F, 0xC0, 0x33, 0xE0, 0x3F, 0xE0, 0x7F, 0xE0, 0x79, 0xE0, 0xF9, 0xE0, 0x7F,
+    0xE0, 0x7F, 0xE0, 0x3F, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xF0, 0x01, 0xFC,
+    0x00, 0x03, 0xFC, 0x00, 0x07, 0xBC, 0x00, 0x07, 0xBF, 0xE0, 0x0F, 0x3F, 0xE0, 0x0F, 0x3F, 0xE0,
+    0x1F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x7C, 0x3F, 0xF8, 0x78, 0x3F, 0xF8, 0xF0,
+    0x3F, 0xF8, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x33, 0xE7, 0xC0, 0x3F, 0xFF,
+    0xC0, 0x7F, 0xFF, 0xC0, 0x79, 0xE0, 0x00, 0xF9, 0xF1, 0x80, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80,
+    0x3F, 0xFF, 0x80, 0x39, 0x80, 0x3B, 0xC0, 0x3F, 0x80, 0x1F, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF,
+    0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x18, 0xC0, 0x3D, 0xC0, 0x1F,
+    0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x7F, 0xE0, 0x79, 0xF0, 0x7F,
+    0xF0, 0x7F, 0xF0, 0x78, 0x00, 0x7C, 0x60, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xE0, 0x3F, 0xC0, 0x7F,
+    0xE0, 0x7F, 0xF0, 0x71, 0xF8, 0x00, 0x78, 0x00, 0x78, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xF0,
+    0x78, 0xF0, 0x78, 0xFD, 0xF8, 0x7F, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x7F, 0x80, 0x7F, 0xC0, 0x7F,
+    0xE0, 0x33, 0xE0, 0x00, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x79, 0xE0, 0x7F, 0xE0, 0x3F, 0xC0, 0x1F,
+    0x80, 0x3D, 0xC0, 0x3D, 0xE0, 0x3D, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0xE0, 0x7F, 0xF0, 0x71,
+    0xF8, 0x00, 0x78, 0x00, 0x78, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xF0, 0x78, 0xF0, 0x78, 0xFD,
+    0xF8, 0x7F, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x39, 0xC0, 0x3F, 0xC0, 0x39, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x7F, 0xE0, 0x33, 0xE0, 0x00, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x79,
+    0xE0, 0x7F, 0xE0, 0x3F, 0xC0, 0x1F, 0x80, 0x03, 0xDC, 0x00, 0x03, 0xDE, 0x00, 0x03, 0xDC, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xF0, 0xF0, 0x7C, 0xF1, 0xF0, 0x3C, 0xF3, 0xE0, 0x3E, 0xF7, 0xC0, 0x1F,
+    0xF7, 0xC0, 0x0F, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF,
+    0x80, 0x1F, 0xF7, 0xC0, 0x3E, 0xF3, 0xE0, 0x7C, 0xF1, 0xE0, 0x78, 0xF1, 0xF0, 0xF8, 0xF0, 0xF8,
+    0x07, 0x38, 0x00, 0x07, 0xF8, 0x00, 0x07, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xE7, 0x80, 0x7D, 0xEF, 0x80, 0x3D, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFC,
+    0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x3D, 0xEF, 0x00, 0x79, 0xE7, 0x80, 0xF9, 0xE7, 0xC0,
+    0x39, 0xC0, 0x3B, 0xC0, 0x39, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0xE0, 0x7F, 0xE0,
+    0x31, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x1F, 0xE0, 0x1F, 0xE0, 0x1F, 0xF0, 0x01, 0xF0, 0x00, 0xF0,
+    0x71, 0xF0, 0x7F, 0xF0, 0xFF, 0xE0, 0x7F, 0xC0, 0x73, 0x80, 0x77, 0x80, 0x73, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x67, 0xC0, 0x3F, 0x80, 0x3F, 0x80, 0x03, 0xC0,
+    0x63, 0xC0, 0x7F, 0xC0, 0xFF, 0x80, 0x7F, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x03, 0xE0,
+    0x07, 0xC0, 0x0F, 0x80, 0x1F, 0xC0, 0x1F, 0xE0, 0x03, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x71, 0xF0,
+    0xFF, 0xF0, 0xFF, 0xE0, 0x7F, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x07, 0x80, 0x0F, 0x00,
+    0x1E, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x07, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0xE7, 0xC0, 0xFF, 0xC0,
+    0xFF, 0x80, 0xFF, 0x00, 0x0F, 0xE0, 0x0F, 0xE0, 0x00, 0x00, 0xF0, 0x3C, 0xF0, 0x7C, 0xF0, 0xFC,
+    0xF1, 0xFC, 0xF1, 0xFC, 0xF3, 0xFC, 0xF7, 0xBC, 0xF7, 0xBC, 0xFF, 0x3C, 0xFE, 0x3C, 0xFE, 0x3C,
+    0xFC, 0x3C, 0xF8, 0x3C, 0xF8, 0x3C, 0xF0, 0x3C, 0x3F, 0x80, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xE0, 0xF3, 0xE0, 0xF7, 0xE0, 0xF7, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFD, 0xE0,
+    0xF9, 0xE0, 0xF9, 0xE0, 0xF1, 0xE0, 0x1C, 0xE0, 0x1E, 0xE0, 0x1C, 0xE0, 0x00, 0x00, 0xF0, 0x3C,
+    0xF0, 0x7C, 0xF0, 0xFC, 0xF1, 0xFC, 0xF1, 0xFC, 0xF3, 0xFC, 0xF7, 0xBC, 0xF7, 0xBC, 0xFF, 0x3C,
+    0xFE, 0x3C, 0xFE, 0x3C, 0xFC, 0x3C, 0xF8, 0x3C, 0xF8, 0x3C, 0xF0, 0x3C, 0x3B, 0xC0, 0x7B, 0xC0,
+    0x3B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xE0, 0xF3, 0xE0, 0xF7, 0xE0, 0xF7, 0xE0, 0xFF, 0xE0,
+    0xFF, 0xE0, 0xFF, 0xE0, 0xFD, 0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0xF1, 0xE0, 0x1E, 0xE0, 0x1E, 0xF0,
+    0x1E, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x7F, 0xF8, 0x7C, 0xFC, 0xF8, 0x3C, 0xF0, 0x3E,
+    0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x3E, 0xF8, 0x3C, 0x7C, 0xFC, 0x7F, 0xF8, 0x3F, 0xF8,
+    0x0F, 0xE0, 0x3D, 0xC0, 0x3D, 0xE0, 0x3D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0,
+    0x7F, 0xE0, 0x7D, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x7D, 0xF0, 0x7F, 0xE0, 0x3F, 0xE0,
+    0x1F, 0xC0, 0x0F, 0xE0, 0x3F, 0xF0, 0x7F, 0xF8, 0x7C, 0xFC, 0xF8, 0x3C, 0xF0, 0x1E, 0xFF, 0xFE,
+    0xFF, 0xFE, 0xF0, 0x1E, 0xF0, 0x3E, 0xF8, 0x3C, 0x7C, 0xFC, 0x7F, 0xF8, 0x3F, 0xF8, 0x0F, 0xE0,
+    0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xE0, 0x79, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x78, 0xF0, 0x7D, 0xF0,
+    0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xC0, 0x1E, 0xE0, 0x1E, 0xF0, 0x1E, 0xE0, 0x00, 0x00, 0x0F, 0xE0,
+    0x3F, 0xF0, 0x7F, 0xF8, 0x7C, 0xFC, 0xF8, 0x3C, 0xF0, 0x1E, 0xFF, 0xFE, 0xFF, 0xFE, 0xF0, 0x1E,
+    0xF0, 0x3E, 0xF8, 0x3C, 0x7C, 0xFC, 0x7F, 0xF8, 0x3F, 0xF8, 0x0F, 0xE0, 0x3D, 0xC0, 0x3D, 0xE0,
+    0x3D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xE0, 0x79, 0xF0, 0x7F, 0xF0,
+    0x7F, 0xF0, 0x78, 0xF0, 0x7D, 0xF0, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xC0, 0x1D, 0xC0, 0x3D, 0xE0,
+    0x1D, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0xE0, 0x7F, 0xF0, 0x71, 0xF8, 0x00, 0x78, 0x00, 0x78,
+    0x1F, 0xFC, 0x1F, 0xFC, 0x1F, 0xFC, 0x00, 0x78, 0x00, 0x78, 0x71, 0xF8, 0x7F, 0xF0, 0x7F, 0xE0,
+    0x3F, 0xC0, 0x73, 0x80, 0x7B, 0x80, 0x73, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x80,
+    0x7F, 0xC0, 0x63, 0xC0, 0x3F, 0xC0, 0x3F, 0xE0, 0x03, 0xC0, 0x67, 0xC0, 0x7F, 0xC0, 0xFF, 0x80,
+    0xFF, 0x00, 0x1F, 0xE0, 0x1F, 0xE0, 0x00, 0x00, 0xF8, 0x7C, 0x78, 0x78, 0x7C, 0x78, 0x3C, 0x78,
+    0x3C, 0xF0, 0x1E, 0xF0, 0x1E, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x07, 0xC0, 0x07, 0xC0, 0x4F, 0x80,
+    0x7F, 0x80, 0x7F, 0x00, 0x7E, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0,
+    0xF1, 0xE0, 0x79, 0xE0, 0x79, 0xE0, 0x7B, 0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x1F, 0x80, 0x1F, 0x80,
+    0x1F, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x1C, 0xE0, 0x1E, 0xE0,
+    0x1C, 0xE0, 0x00, 0x00, 0xF8, 0x7C, 0x78, 0x78, 0x7C, 0x78, 0x3C, 0x78, 0x3C, 0xF0, 0x1E, 0xF0,
+    0x1E, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x07, 0xC0, 0x07, 0xC0, 0x4F, 0x80, 0x7F, 0x80, 0x7F, 0x00,
+    0x7E, 0x00, 0x3B, 0xC0, 0x7B, 0xC0, 0x3B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF1, 0xE0,
+    0x79, 0xE0, 0x79, 0xE0, 0x7B, 0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x1F, 0x80, 0x1F, 0x80, 0x1F, 0x00,
+    0x0F, 0x00, 0x1E, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x07, 0x70, 0x07, 0x70, 0x0E, 0xE0,
+    0x1C, 0xE0, 0x0C, 0xC0, 0x00, 0x00, 0xF8, 0x7C, 0x78, 0x78, 0x7C, 0x78, 0x3C, 0x78, 0x3C, 0xF0,
+    0x1E, 0xF0, 0x1E, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x07, 0xC0, 0x07, 0xC0, 0x4F, 0x80, 0x7F, 0x80,
+    0x7F, 0x00, 0x7E, 0x00, 0x0C, 0xC0, 0x1D, 0xE0, 0x1D, 0xC0, 0x3B, 0x80, 0x33, 0x80, 0x00, 0x00,
+    0xF0, 0xF0, 0xF1, 0xE0, 0x79, 0xE0, 0x79, 0xE0, 0x7B, 0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x1F, 0x80,
+    0x1F, 0x80, 0x1F, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x1D, 0xE0,
+    0x3D, 0xE0, 0x1D, 0xE0, 0x00, 0x00, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF8, 0x78,
+    0x78, 0x78, 0x7C, 0x78, 0x7F, 0xF8, 0x3F, 0xF8, 0x1F, 0xF8, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78,
+    0x00, 0x78, 0x00, 0x78, 0x3B, 0xC0, 0x7B, 0xC0, 0x3B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x71, 0xE0,
+    0x71, 0xE0, 0x71, 0xE0, 0x71, 0xE0, 0x79, 0xE0, 0x7F, 0xE0, 0x7F, 0xE0, 0x3F, 0xE0, 0x01, 0xE0,
+    0x01, 0xE0, 0x01, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFE, 0x00, 0xFE, 0x00,
+    0xFE, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00,
+    0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x07, 0x38, 0x00, 0x07, 0x78, 0x00, 0x07, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0x07, 0x80, 0xF0, 0x07, 0x80, 0xF0, 0x07, 0x80, 0xF0, 0x07, 0x80, 0xF0, 0x07,
+    0x80, 0xFF, 0x87, 0x80, 0xFF, 0xE7, 0x80, 0xFF, 0xE7, 0x80, 0xF3, 0xF7, 0x80, 0xF0, 0xF7, 0x80,
+    0xF0, 0xF7, 0x80, 0xF3, 0xF7, 0x80, 0xFF, 0xE7, 0x80, 0xFF, 0xE7, 0x80, 0xFF, 0x87, 0x80, 0x0E,
+    0xF0, 0x1E, 0xF0, 0x0E, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0,
+    0x1E, 0xFF, 0x9E, 0xFF, 0xDE, 0xFF, 0xDE, 0xF3, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0x9E, 0xFF,
+    0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0x38, 0x78, 0x78, 0x70, 0x70, 0x70, 0x78, 0x78, 0x70,
+    0x70, 0xF0, 0xE0, 0x78, 0x78, 0x70, 0x70, 0xF0, 0xE0, 0x3B, 0x80, 0x7B, 0x80, 0x77, 0x80, 0x77,
+    0x80, 0x77, 0x80, 0x77, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x77, 0x80, 0x77, 0x80, 0xF7, 0x00, 0xE7,
+    0x00, 0x7F, 0x80, 0x7F, 0x80, 0x77, 0x80, 0x77, 0x80, 0xF7, 0x00, 0xE7, 0x00, 0x0E, 0x00, 0x0E,
+    0x00, 0x0E, 0x00, 0x0E, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x0E, 0x00, 0x0E, 0x00, 0x0E,
+    0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0C,
+    0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x0E,
+    0x00, 0x0E, 0x00, 0x0E, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x0E, 0x00, 0x0E, 0x00, 0x0E,
+    0x00, 0x0E, 0x00, 0x0C, 0x00, 0x3C, 0x7E, 0x7E, 0x7E, 0x7E, 0x3C, 0xF0, 0xE1, 0xE0, 0xF1, 0xF1,
+    0xE0, 0xF1, 0xF1, 0xE0, 0xF0, 0xE1, 0xE0, 0x3E, 0x0E, 0x00, 0x00, 0x7F, 0x1E, 0x00, 0x00, 0x77,
+    0x3C, 0x00, 0x00, 0xF7, 0xBC, 0x00, 0x00, 0xF7, 0xF8, 0x00, 0x00, 0x77, 0x78, 0x00, 0x00, 0x7F,
+    0xF0, 0x00, 0x00, 0x3E, 0xEF, 0x87, 0xC0, 0x01, 0xFF, 0xCF, 0xE0, 0x01, 0xDD, 0xFE, 0xE0, 0x03,
+    0xDC, 0xFC, 0xE0, 0x03, 0x9C, 0xFC, 0xE0, 0x07, 0x9D, 0xFE, 0xE0, 0x0F, 0x1F, 0xCF, 0xE0, 0x0F,
+    0x0F, 0x87, 0xC0, 0x00, 0x1C, 0x3C, 0x7C, 0x78, 0xF8, 0x78, 0x7C, 0x3C, 0x1C, 0x00, 0x00, 0x70,
+    0x78, 0x78, 0x3C, 0x3E, 0x3C, 0x78, 0x78, 0x70, 0x00, 0x00, 0xE0, 0x01, 0xE0, 0x03, 0xC0, 0x03,
+    0xC0, 0x07, 0x80, 0x07, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x3C,
+    0x00, 0x78, 0x00, 0x70, 0x00, 0xF0, 0x00, 0x7C, 0x7E, 0xFE, 0xE7, 0xE7, 0xE7, 0xFE, 0x7E, 0x7C,
+    0x1E, 0x3E, 0x7E, 0x6E, 0xFF, 0xFF, 0x0E, 0x0E, 0x7E, 0x7E, 0x70, 0x7C, 0x7E, 0x0E, 0x4E, 0xFE,
+    0xFC, 0x1E, 0x3E, 0x78, 0x7E, 0xFE, 0xEE, 0xFE, 0x7E, 0x3C, 0xFE, 0xFE, 0x0E, 0x1C, 0x1C, 0x38,
+    0x38, 0x38, 0x7C, 0x7E, 0xEE, 0x7E, 0x7E, 0xFE, 0xEF, 0xFE, 0x7E, 0x7C, 0x7E, 0xEE, 0xEE, 0x7E,
+    0x7E, 0x1E, 0x7C, 0x78, 0x7C, 0x7E, 0xFE, 0xE7, 0xE7, 0xE7, 0xFE, 0x7E, 0x7C, 0x1C, 0x7C, 0x7C,
+    0x7C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x7C, 0xFE, 0x6E, 0x1E, 0x3C, 0x78, 0x70, 0xFE, 0xFE, 0xFC,
+    0xFE, 0x5E, 0x3C, 0x3E, 0x0E, 0x4E, 0xFE, 0xFC, 0x1E, 0x3E, 0x7E, 0x6E, 0xFF, 0xFF, 0x0E, 0x0E,
+    0x7E, 0x7E, 0x70, 0x7C, 0x7E, 0x0E, 0x4E, 0xFE, 0xFC, 0x1E, 0x3E, 0x78, 0x7E, 0xFE, 0xEE, 0xFE,
+    0x7E, 0x3C, 0xFE, 0xFE, 0x0E, 0x1C, 0x1C, 0x38, 0x38, 0x38, 0x7C, 0x7E, 0xEE, 0x7E, 0x7E, 0xFE,
+    0xEF, 0xFE, 0x7E, 0x7C, 0x7E, 0xEE, 0xEE, 0x7E, 0x7E, 0x1E, 0x7C, 0x78, 0x07, 0xF0, 0x0F, 0xF0,
+    0x1F, 0xE0, 0x1F, 0x20, 0x3C, 0x00, 0x7F, 0xE0, 0x7F, 0xC0, 0x3C, 0x00, 0x7F, 0xC0, 0x7F, 0xC0,
+    0x3C, 0x00, 0x1F, 0x30, 0x1F, 0xF0, 0x0F, 0xF0, 0x07, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0,
+    0x0F, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x3F, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x1F, 0xC0,
+    0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x0F, 0x00, 0x3F, 0x80, 0x7F, 0xC0, 0x3F, 0xC0, 0x33, 0xE0,
+    0xFF, 0xF0, 0xFF, 0xF0, 0x1F, 0x80, 0x3F, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x78, 0x00, 0x7C, 0xC0,
+    0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xC0, 0x7F, 0xF8, 0x7F, 0xF8, 0x07, 0xC0, 0x01, 0xC0, 0x7F, 0xF0,
+    0x7F, 0xF0, 0x03, 0xC0, 0x0F, 0xC0, 0x7F, 0x80, 0x7F, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00,
+    0x0F, 0x80, 0x07, 0x80, 0x3F, 0x80, 0x3F, 0xC0, 0x3F, 0xE0, 0x33, 0xF0, 0x00, 0xF0, 0x1F, 0xF0,
+    0x3F, 0xF0, 0x7F, 0xF0, 0x7D, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x7B, 0xE0, 0x7F, 0xE0, 0x7F, 0xC0,
+    0x1F, 0x80, 0x07, 0x80, 0x07, 0xC0, 0x0F, 0xC0, 0x0F, 0xE0, 0x0F, 0xE0, 0x1E, 0xE0, 0x1E, 0xF0,
+    0x3C, 0xF0, 0x3C, 0x78, 0x3C, 0x78, 0x78, 0x78, 0x78, 0x3C, 0x7F, 0xFC, 0xFF, 0xFC, 0xFF, 0xFE,
+    0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78,
+    0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78,
+    0xF0, 0x78, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x78, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x1E, 0x00,
+    0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x78, 0x00, 0xFF, 0xE0,
+    0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xE0, 0x01, 0xE0, 0x03, 0xC0,
+    0x03, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x3C, 0x00,
+    0x3C, 0x00, 0x78, 0x00, 0x70, 0x00, 0xF0, 0x00, 0x70, 0xF8, 0xF8, 0x70, 0x00, 0x3C, 0x00, 0x38,
+    0x00, 0x78, 0x00, 0x78, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x38, 0xE0, 0xFD, 0xE0, 0x7D, 0xE0,
+    0x7F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x3D, 0xF0, 0x7F, 0xF8, 0xFF, 0xB8,
+    0xE7, 0x38, 0xFF, 0xB8, 0x7F, 0xF8, 0x3D, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0x80, 0x1F, 0x80,
+    0x3E, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00,
+    0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+    0x00, 0x00, 0x3C, 0x70, 0x7E, 0xF0, 0x7F, 0xE0, 0xFF, 0xE0, 0xE3, 0xC0, 0x00, 0x00, 0x3C, 0x70,
+    0x7F, 0xF0, 0x7F, 0xE0, 0xFF, 0xE0, 0xE3, 0xC0, 0x01, 0x80, 0x03, 0x80, 0x03, 0x80, 0xFF, 0xC0,
+    0xFF, 0xC0, 0xFF, 0xC0, 0x0E, 0x00, 0x1C, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x70, 0x00,
+    0x70, 0x00, 0x60, 0x00, 0x03, 0xC0, 0x3F, 0xC0, 0xFF, 0xC0, 0xFF, 0x80, 0xF8, 0x00, 0xFF, 0x80,
+    0xFF, 0xC0, 0x3F, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xF0, 0x00,
+    0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x07, 0xC0, 0x7F, 0xC0, 0xFF, 0xC0, 0xFF, 0x00, 0xF0, 0x00,
+    0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0,
 };
 
 static const EpdGlyph ubuntu_10_boldGlyphs[] = {
@@ -885,591 +1121,591 @@ static const EpdGlyph ubuntu_10_boldGlyphs[] = {
     { 0, 0, 5, 0, 0, 0, 0 }, // 
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 4, 15, 6, 1, 15, 8, 0 }, // !
-    { 8, 6, 10, 1, 16, 6, 8 }, // "
-    { 13, 15, 15, 1, 15, 25, 14 }, // #
-    { 11, 19, 12, 0, 16, 27, 39 }, // $
-    { 19, 15, 19, 0, 15, 36, 66 }, // %
-    { 15, 15, 15, 0, 15, 29, 102 }, // &
-    { 4, 6, 5, 1, 16, 3, 131 }, // '
-    { 7, 20, 7, 1, 16, 18, 134 }, // (
-    { 6, 20, 7, 0, 16, 15, 152 }, // )
-    { 10, 8, 11, 0, 15, 10, 167 }, // *
-    { 10, 11, 12, 1, 12, 14, 177 }, // +
-    { 5, 6, 5, 0, 3, 4, 191 }, // ,
-    { 7, 3, 7, 0, 8, 3, 195 }, // -
-    { 5, 4, 5, 0, 4, 3, 198 }, // .
-    { 11, 20, 9, -1, 16, 28, 201 }, // /
-    { 12, 15, 12, 0, 15, 23, 229 }, // 0
-    { 8, 15, 12, 1, 15, 15, 252 }, // 1
-    { 11, 15, 12, 0, 15, 21, 267 }, // 2
-    { 11, 15, 12, 0, 15, 21, 288 }, // 3
-    { 12, 15, 12, 0, 15, 23, 309 }, // 4
-    { 11, 15, 12, 0, 15, 21, 332 }, // 5
-    { 12, 15, 12, 0, 15, 23, 353 }, // 6
-    { 12, 15, 12, 0, 15, 23, 376 }, // 7
-    { 12, 15, 12, 0, 15, 23, 399 }, // 8
-    { 12, 15, 12, 0, 15, 23, 422 }, // 9
-    { 5, 11, 5, 0, 11, 7, 445 }, // :
-    { 5, 14, 5, 0, 11, 9, 452 }, // ;
-    { 10, 11, 12, 1, 12, 14, 461 }, // <
-    { 10, 8, 12, 1, 10, 10, 475 }, // =
-    { 10, 11, 12, 1, 12, 14, 485 }, // >
-    { 10, 16, 10, 0, 16, 20, 499 }, // ?
-    { 19, 18, 20, 1, 15, 43, 519 }, // @
-    { 15, 15, 15, 0, 15, 29, 562 }, // A
-    { 13, 15, 14, 1, 15, 25, 591 }, // B
-    { 13, 15, 14, 1, 15, 25, 616 }, // C
-    { 14, 15, 15, 1, 15, 27, 641 }, // D
-    { 11, 15, 13, 1, 15, 21, 668 }, // E
-    { 11, 15, 12, 1, 15, 21, 689 }, // F
-    { 13, 15, 15, 1, 15, 25, 710 }, // G
-    { 13, 15, 15, 1, 15, 25, 735 }, // H
-    { 4, 15, 7, 1, 15, 8, 760 }, // I
-    { 10, 15, 11, 0, 15, 19, 768 }, // J
-    { 14, 15, 14, 1, 15, 27, 787 }, // K
-    { 11, 15, 12, 1, 15, 21, 814 }, // L
-    { 17, 15, 19, 1, 15, 32, 835 }, // M
-    { 14, 15, 16, 1, 15, 27, 867 }, // N
-    { 15, 15, 17, 1, 15, 29, 894 }, // O
-    { 12, 15, 14, 1, 15, 23, 923 }, // P
-    { 15, 18, 17, 1, 15, 34, 946 }, // Q
-    { 13, 15, 14, 1, 15, 25, 980 }, // R
-    { 12, 15, 12, 0, 15, 23, 1005 }, // S
-    { 13, 15, 13, 0, 15, 25, 1028 }, // T
-    { 13, 15, 15, 1, 15, 25, 1053 }, // U
-    { 15, 15, 15, 0, 15, 29, 1078 }, // V
-    { 20, 15, 20, 0, 15, 38, 1107 }, // W
-    { 14, 15, 14, 0, 15, 27, 1145 }, // X
-    { 14, 15, 14, 0, 15, 27, 1172 }, // Y
-    { 13, 15, 13, 0, 15, 25, 1199 }, // Z
-    { 7, 20, 8, 1, 16, 18, 1224 }, // [
-    { 11, 20, 9, -1, 16, 28, 1242 }, // <backslash>
-    { 6, 20, 8, 0, 16, 15, 1270 }, // ]
-    { 12, 9, 12, 0, 15, 14, 1285 }, // ^
-    { 11, 3, 11, 0, -1, 5, 1299 }, // _
-    { 6, 5, 6, 0, 17, 4, 1304 }, // `
-    { 11, 11, 12, 0, 11, 16, 1308 }, // a
-    { 11, 16, 13, 1, 16, 22, 1324 }, // b
-    { 10, 11, 11, 0, 11, 14, 1346 }, // c
-    { 12, 16, 13, 0, 16, 24, 1360 }, // d
-    { 12, 11, 12, 0, 11, 17, 1384 }, // e
-    { 9, 16, 9, 1, 16, 18, 1401 }, // f
-    { 11, 15, 12, 0, 11, 21, 1419 }, // g
-    { 10, 16, 12, 1, 16, 20, 1440 }, // h
-    { 4, 16, 6, 1, 16, 8, 1460 }, // i
-    { 7, 20, 6, -2, 16, 18, 1468 }, // j
-    { 11, 16, 12, 1, 16, 22, 1486 }, // k
-    { 6, 16, 7, 1, 16, 12, 1508 }, // l
-    { 16, 11, 18, 1, 11, 22, 1520 }, // m
-    { 10, 11, 12, 1, 11, 14, 1542 }, // n
-    { 12, 11, 13, 0, 11, 17, 1556 }, // o
-    { 11, 15, 13, 1, 11, 21, 1573 }, // p
-    { 12, 15, 13, 0, 11, 23, 1594 }, // q
-    { 8, 11, 9, 1, 11, 11, 1617 }, // r
-    { 10, 11, 10, 0, 11, 14, 1628 }, // s
-    { 8, 14, 9, 1, 14, 14, 1642 }, // t
-    { 10, 11, 12, 1, 11, 14, 1656 }, // u
-    { 12, 11, 12, 0, 11, 17, 1670 }, // v
-    { 17, 11, 16, 0, 11, 24, 1687 }, // w
-    { 12, 11, 12, 0, 11, 17, 1711 }, // x
-    { 12, 15, 11, 0, 11, 23, 1728 }, // y
-    { 10, 11, 11, 0, 11, 14, 1751 }, // z
-    { 8, 20, 8, 0, 16, 20, 1765 }, // {
-    { 4, 20, 7, 1, 16, 10, 1785 }, // |
-    { 8, 20, 8, 0, 16, 20, 1795 }, // }
-    { 12, 5, 12, 0, 9, 8, 1815 }, // ~
-    { 0, 0, 5, 0, 0, 0, 1823 }, //  
-    { 4, 15, 6, 1, 11, 8, 1823 }, // ¡
-    { 10, 16, 12, 0, 14, 20, 1831 }, // ¢
-    { 11, 15, 12, 0, 15, 21, 1851 }, // £
-    { 12, 11, 12, 0, 13, 17, 1872 }, // ¤
-    { 14, 15, 12, -1, 15, 27, 1889 }, // ¥
-    { 4, 20, 6, 1, 16, 10, 1916 }, // ¦
-    { 11, 19, 11, 0, 15, 27, 1926 }, // §
-    { 9, 3, 11, 1, 16, 4, 1953 }, // ¨
-    { 15, 15, 17, 1, 15, 29, 1957 }, // ©
-    { 8, 8, 8, 0, 15, 8, 1986 }, // ª
-    { 12, 11, 13, 0, 11, 17, 1994 }, // «
-    { 10, 8, 12, 1, 9, 10, 2011 }, // ¬
-    { 7, 3, 7, 0, 8, 3, 2021 }, // ­
-    { 15, 15, 17, 1, 15, 29, 2024 }, // ®
-    { 8, 2, 8, 0, 15, 2, 2053 }, // ¯
-    { 8, 6, 8, 0, 16, 6, 2055 }, // °
-    { 10, 15, 12, 1, 15, 19, 2061 }, // ±
-    { 7, 9, 8, 0, 15, 8, 2080 }, // ²
-    { 7, 9, 8, 0, 15, 8, 2088 }, // ³
-    { 6, 5, 6, 0, 17, 4, 2096 }, // ´
-    { 10, 15, 12, 1, 11, 19, 2100 }, // µ
-    { 14, 19, 15, 0, 15, 34, 2119 }, // ¶
-    { 5, 4, 5, 0, 9, 3, 2153 }, // ·
-    { 6, 6, 7, 0, 1, 5, 2156 }, // ¸
-    { 6, 9, 8, 0, 15, 7, 2161 }, // ¹
-    { 9, 8, 10, 0, 15, 9, 2168 }, // º
-    { 13, 11, 13, 0, 11, 18, 2177 }, // »
-    { 19, 15, 18, 0, 15, 36, 2195 }, // ¼
-    { 18, 15, 18, 0, 15, 34, 2231 }, // ½
-    { 19, 15, 18, 0, 15, 36, 2265 }, // ¾
-    { 10, 15, 10, 0, 11, 19, 2301 }, // ¿
-    { 15, 21, 15, 0, 21, 40, 2320 }, // À
-    { 15, 21, 15, 0, 21, 40, 2360 }, // Á
-    { 15, 21, 15, 0, 21, 40, 2400 }, // Â
-    { 15, 19, 15, 0, 19, 36, 2440 }, // Ã
-    { 15, 19, 15, 0, 19, 36, 2476 }, // Ä
-    { 15, 19, 15, 0, 19, 36, 2512 }, // Å
-    { 21, 15, 21, 0, 15, 40, 2548 }, // Æ
-    { 13, 20, 14, 1, 15, 33, 2588 }, // Ç
-    { 11, 21, 13, 1, 21, 29, 2621 }, // È
-    { 11, 21, 13, 1, 21, 29, 2650 }, // É
-    { 11, 21, 13, 1, 21, 29, 2679 }, // Ê
-    { 11, 19, 13, 1, 19, 27, 2708 }, // Ë
-    { 6, 21, 7, 0, 21, 16, 2735 }, // Ì
-    { 5, 21, 7, 1, 21, 14, 2751 }, // Í
-    { 7, 21, 7, 0, 21, 19, 2765 }, // Î
-    { 9, 19, 7, -1, 19, 22, 2784 }, // Ï
-    { 15, 15, 16, 0, 15, 29, 2806 }, // Ð
-    { 14, 19, 16, 1, 19, 34, 2835 }, // Ñ
-    { 15, 21, 17, 1, 21, 40, 2869 }, // Ò
-    { 15, 21, 17, 1, 21, 40, 2909 }, // Ó
-    { 15, 21, 17, 1, 21, 40, 2949 }, // Ô
-    { 15, 19, 17, 1, 19, 36, 2989 }, // Õ
-    { 15, 19, 17, 1, 19, 36, 3025 }, // Ö
-    { 10, 9, 12, 1, 11, 12, 3061 }, // ×
-    { 15, 17, 17, 1, 16, 32, 3073 }, // Ø
-    { 13, 21, 15, 1, 21, 35, 3105 }, // Ù
-    { 13, 21, 15, 1, 21, 35, 3140 }, // Ú
-    { 13, 21, 15, 1, 21, 35, 3175 }, // Û
-    { 13, 19, 15, 1, 19, 31, 3210 }, // Ü
-    { 14, 21, 14, 0, 21, 37, 3241 }, // Ý
-    { 12, 15, 14, 1, 15, 23, 3278 }, // Þ
-    { 13, 16, 14, 1, 16, 26, 3301 }, // ß
-    { 11, 17, 12, 0, 17, 24, 3327 }, // à
-    { 11, 17, 12, 0, 17, 24, 3351 }, // á
-    { 11, 17, 12, 0, 17, 24, 3375 }, // â
-    { 11, 16, 12, 0, 16, 22, 3399 }, // ã
-    { 11, 16, 12, 0, 16, 22, 3421 }, // ä
-    { 11, 18, 12, 0, 18, 25, 3443 }, // å
-    { 18, 11, 18, 0, 11, 25, 3468 }, // æ
-    { 10, 15, 11, 0, 11, 19, 3493 }, // ç
-    { 12, 17, 12, 0, 17, 26, 3512 }, // è
-    { 12, 17, 12, 0, 17, 26, 3538 }, // é
-    { 12, 17, 12, 0, 17, 26, 3564 }, // ê
-    { 12, 16, 12, 0, 16, 24, 3590 }, // ë
-    { 6, 17, 6, 0, 17, 13, 3614 }, // ì
-    { 6, 17, 6, 0, 17, 13, 3627 }, // í
-    { 8, 17, 6, -1, 17, 17, 3640 }, // î
-    { 9, 16, 6, -2, 16, 18, 3657 }, // ï
-    { 13, 16, 13, 0, 16, 26, 3675 }, // ð
-    { 10, 16, 12, 1, 16, 20, 3701 }, // ñ
-    { 12, 17, 13, 0, 17, 26, 3721 }, // ò
-    { 12, 17, 13, 0, 17, 26, 3747 }, // ó
-    { 12, 17, 13, 0, 17, 26, 3773 }, // ô
-    { 12, 16, 13, 0, 16, 24, 3799 }, // õ
-    { 12, 16, 13, 0, 16, 24, 3823 }, // ö
-    { 10, 13, 12, 1, 13, 17, 3847 }, // ÷
-    { 12, 13, 13, 0, 12, 20, 3864 }, // ø
-    { 10, 17, 12, 1, 17, 22, 3884 }, // ù
-    { 10, 17, 12, 1, 17, 22, 3906 }, // ú
-    { 10, 17, 12, 1, 17, 22, 3928 }, // û
-    { 10, 16, 12, 1, 16, 20, 3950 }, // ü
-    { 12, 21, 11, 0, 17, 32, 3970 }, // ý
-    { 11, 20, 13, 1, 16, 28, 4002 }, // þ
-    { 12, 20, 11, 0, 16, 30, 4030 }, // ÿ
-    { 15, 18, 15, 0, 18, 34, 4060 }, // Ā
-    { 11, 15, 12, 0, 15, 21, 4094 }, // ā
-    { 15, 19, 15, 0, 19, 36, 4115 }, // Ă
-    { 11, 16, 12, 0, 16, 22, 4151 }, // ă
-    { 16, 20, 15, 0, 15, 40, 4173 }, // Ą
-    { 11, 15, 12, 0, 11, 21, 4213 }, // ą
-    { 13, 21, 14, 1, 21, 35, 4234 }, // Ć
-    { 10, 17, 11, 0, 17, 22, 4269 }, // ć
-    { 13, 21, 14, 1, 21, 35, 4291 }, // Ĉ
-    { 10, 17, 11, 0, 17, 22, 4326 }, // ĉ
-    { 13, 19, 14, 1, 19, 31, 4348 }, // Ċ
-    { 10, 16, 11, 0, 16, 20, 4379 }, // ċ
-    { 13, 21, 14, 1, 21, 35, 4399 }, // Č
-    { 10, 17, 11, 0, 17, 22, 4434 }, // č
-    { 14, 21, 15, 1, 21, 37, 4456 }, // Ď
-    { 16, 16, 14, 0, 16, 32, 4493 }, // ď
-    { 15, 15, 16, 0, 15, 29, 4525 }, // Đ
-    { 13, 16, 13, 0, 16, 26, 4554 }, // đ
-    { 11, 18, 13, 1, 18, 25, 4580 }, // Ē
-    { 12, 15, 12, 0, 15, 23, 4605 }, // ē
-    { 11, 19, 13, 1, 19, 27, 4628 }, // Ĕ
-    { 12, 16, 12, 0, 16, 24, 4655 }, // ĕ
-    { 11, 19, 13, 1, 19, 27, 4679 }, // Ė
-    { 12, 16, 12, 0, 16, 24, 4706 }, // ė
-    { 12, 20, 13, 1, 15, 30, 4730 }, // Ę
-    { 12, 15, 12, 0, 11, 23, 4760 }, // ę
-    { 11, 21, 13, 1, 21, 29, 4783 }, // Ě
-    { 12, 17, 12, 0, 17, 26, 4812 }, // ě
-    { 13, 21, 15, 1, 21, 35, 4838 }, // Ĝ
-    { 11, 21, 12, 0, 17, 29, 4873 }, // ĝ
-    { 13, 19, 15, 1, 19, 31, 4902 }, // Ğ
-    { 11, 20, 12, 0, 16, 28, 4933 }, // ğ
-    { 13, 19, 15, 1, 19, 31, 4961 }, // Ġ
-    { 11, 20, 12, 0, 16, 28, 4992 }, // ġ
-    { 13, 20, 15, 1, 15, 33, 5020 }, // Ģ
-    { 11, 21, 12, 0, 17, 29, 5053 }, // ģ
-    { 13, 21, 15, 1, 21, 35, 5082 }, // Ĥ
-    { 10, 20, 12, 1, 20, 25, 5117 }, // ĥ
-    { 16, 15, 16, 0, 15, 30, 5142 }, // Ħ
-    { 12, 16, 13, 0, 16, 24, 5172 }, // ħ
-    { 9, 19, 7, -1, 19, 22, 5196 }, // Ĩ
-    { 8, 16, 6, -1, 16, 16, 5218 }, // ĩ
-    { 8, 18, 7, -1, 18, 18, 5234 }, // Ī
-    { 8, 15, 6, -1, 15, 15, 5252 }, // ī
-    { 7, 19, 7, 0, 19, 17, 5267 }, // Ĭ
-    { 8, 16, 6, -1, 16, 16, 5284 }, // ĭ
-    { 6, 20, 7, 0, 15, 15, 5300 }, // Į
-    { 6, 21, 6, 0, 16, 16, 5315 }, // į
-    { 4, 19, 7, 1, 19, 10, 5331 }, // İ
-    { 4, 11, 6, 1, 11, 6, 5341 }, // ı
-    { 16, 15, 18, 1, 15, 30, 5347 }, // Ĳ
-    { 10, 20, 12, 1, 16, 25, 5377 }, // ĳ
-    { 12, 21, 11, 0, 21, 32, 5402 }, // Ĵ
-    { 9, 21, 6, -2, 17, 24, 5434 }, // ĵ
-    { 14, 20, 14, 1, 15, 35, 5458 }, // Ķ
-    { 11, 21, 12, 1, 16, 29, 5493 }, // ķ
-    { 12, 11, 12, 1, 11, 17, 5522 }, // ĸ
-    { 11, 21, 12, 1, 21, 29, 5539 }, // Ĺ
-    { 6, 21, 7, 1, 21, 16, 5568 }, // ĺ
-    { 11, 20, 12, 1, 15, 28, 5584 }, // Ļ
-    { 6, 21, 7, 1, 16, 16, 5612 }, // ļ
-    { 11, 15, 12, 1, 15, 21, 5628 }, // Ľ
-    { 8, 16, 8, 1, 16, 16, 5649 }, // ľ
-    { 11, 15, 12, 1, 15, 21, 5665 }, // Ŀ
-    { 10, 16, 11, 1, 16, 20, 5686 }, // ŀ
-    { 13, 15, 12, 0, 15, 25, 5706 }, // Ł
-    { 9, 16, 8, -1, 16, 18, 5731 }, // ł
-    { 14, 21, 16, 1, 21, 37, 5749 }, // Ń
-    { 10, 17, 12, 1, 17, 22, 5786 }, // ń
-    { 14, 20, 16, 1, 15, 35, 5808 }, // Ņ
-    { 10, 16, 12, 1, 11, 20, 5843 }, // ņ
-    { 14, 21, 16, 1, 21, 37, 5863 }, // Ň
-    { 10, 17, 12, 1, 17, 22, 5900 }, // ň
-    { 13, 16, 13, -1, 16, 26, 5922 }, // ŉ
-    { 14, 19, 16, 1, 15, 34, 5948 }, // Ŋ
-    { 10, 15, 12, 1, 11, 19, 5982 }, // ŋ
-    { 15, 18, 17, 1, 18, 34, 6001 }, // Ō
-    { 12, 15, 13, 0, 15, 23, 6035 }, // ō
-    { 15, 19, 17, 1, 19, 36, 6058 }, // Ŏ
-    { 12, 16, 13, 0, 16, 24, 6094 }, // ŏ
-    { 15, 21, 17, 1, 21, 40, 6118 }, // Ő
-    { 12, 17, 13, 0, 17, 26, 6158 }, // ő
-    { 20, 15, 21, 1, 15, 38, 6184 }, // Œ
-    { 19, 11, 20, 0, 11, 27, 6222 }, // œ
-    { 13, 21, 14, 1, 21, 35, 6249 }, // Ŕ
-    { 8, 17, 9, 1, 17, 17, 6284 }, // ŕ
-    { 13, 20, 14, 1, 15, 33, 6301 }, // Ŗ
-    { 9, 16, 9, 0, 11, 18, 6334 }, // ŗ
-    { 13, 20, 14, 1, 20, 33, 6352 }, // Ř
-    { 8, 17, 9, 1, 17, 17, 6385 }, // ř
-    { 12, 21, 12, 0, 21, 32, 6402 }, // Ś
-    { 10, 17, 10, 0, 17, 22, 6434 }, // ś
-    { 12, 21, 12, 0, 21, 32, 6456 }, // Ŝ
-    { 10, 17, 10, 0, 17, 22, 6488 }, // ŝ
-    { 12, 20, 12, 0, 15, 30, 6510 }, // Ş
-    { 10, 16, 10, 0, 11, 20, 6540 }, // ş
-    { 12, 21, 12, 0, 21, 32, 6560 }, // Š
-    { 10, 17, 10, 0, 17, 22, 6592 }, // š
-    { 13, 19, 13, 0, 15, 31, 6614 }, // Ţ
-    { 8, 18, 9, 1, 14, 18, 6645 }, // ţ
-    { 13, 21, 13, 0, 21, 35, 6663 }, // Ť
-    { 8, 16, 9, 1, 16, 16, 6698 }, // ť
-    { 13, 15, 13, 0, 15, 25, 6714 }, // Ŧ
-    { 8, 14, 9, 1, 14, 14, 6739 }, // ŧ
-    { 13, 19, 15, 1, 19, 31, 6753 }, // Ũ
-    { 10, 16, 12, 1, 16, 20, 6784 }, // ũ
-    { 13, 18, 15, 1, 18, 30, 6804 }, // Ū
-    { 10, 15, 12, 1, 15, 19, 6834 }, // ū
-    { 13, 19, 15, 1, 19, 31, 6853 }, // Ŭ
-    { 10, 16, 12, 1, 16, 20, 6884 }, // ŭ
-    { 13, 21, 15, 1, 21, 35, 6904 }, // Ů
-    { 10, 18, 12, 1, 18, 23, 6939 }, // ů
-    { 13, 21, 15, 1, 21, 35, 6962 }, // Ű
-    { 11, 17, 12, 1, 17, 24, 6997 }, // ű
-    { 13, 19, 15, 1, 15, 31, 7021 }, // Ų
-    { 10, 15, 12, 1, 11, 19, 7052 }, // ų
-    { 20, 21, 20, 0, 21, 53, 7071 }, // Ŵ
-    { 17, 17, 16, 0, 17, 37, 7124 }, // ŵ
-    { 14, 21, 14, 0, 21, 37, 7161 }, // Ŷ
-    { 12, 21, 11, 0, 17, 32, 7198 }, // ŷ
-    { 14, 19, 14, 0, 19, 34, 7230 }, // Ÿ
-    { 13, 21, 13, 0, 21, 35, 7264 }, // Ź
-    { 10, 17, 11, 0, 17, 22, 7299 }, // ź
-    { 13, 19, 13, 0, 19, 31, 7321 }, // Ż
-    { 10, 16, 11, 0, 16, 20, 7352 }, // ż
-    { 13, 21, 13, 0, 21, 35, 7372 }, // Ž
-    { 10, 17, 11, 0, 17, 22, 7407 }, // ž
-    { 9, 16, 7, 1, 16, 18, 7429 }, // ſ
-    { 8, 3, 8, 0, 15, 3, 7447 }, // ̑
-    { 11, 21, 13, 1, 21, 29, 7450 }, // Ѐ
-    { 11, 20, 13, 1, 20, 28, 7479 }, // Ё
-    { 17, 15, 17, 0, 15, 32, 7507 }, // Ђ
-    { 11, 21, 12, 1, 21, 29, 7539 }, // Ѓ
-    { 13, 15, 14, 1, 15, 25, 7568 }, // Є
-    { 12, 15, 12, 0, 15, 23, 7593 }, // Ѕ
-    { 4, 15, 7, 1, 15, 8, 7616 }, // І
-    { 9, 19, 7, -1, 19, 22, 7624 }, // Ї
-    { 10, 15, 11, 0, 15, 19, 7646 }, // Ј
-    { 23, 15, 24, 0, 15, 44, 7665 }, // Љ
-    { 21, 15, 23, 1, 15, 40, 7709 }, // Њ
-    { 16, 15, 16, 0, 15, 30, 7749 }, // Ћ
-    { 14, 21, 14, 1, 21, 37, 7779 }, // Ќ
-    { 14, 21, 16, 1, 21, 37, 7816 }, // Ѝ
-    { 14, 20, 14, 0, 20, 35, 7853 }, // Ў
-    { 13, 19, 15, 1, 15, 31, 7888 }, // Џ
-    { 15, 15, 15, 0, 15, 29, 7919 }, // А
-    { 12, 15, 14, 1, 15, 23, 7948 }, // Б
-    { 13, 15, 14, 1, 15, 25, 7971 }, // В
-    { 11, 15, 12, 1, 15, 21, 7996 }, // Г
-    { 17, 19, 17, 0, 15, 41, 8017 }, // Д
-    { 11, 15, 13, 1, 15, 21, 8058 }, // Е
-    { 21, 15, 21, 0, 15, 40, 8079 }, // Ж
-    { 12, 15, 13, 0, 15, 23, 8119 }, // З
-    { 14, 15, 16, 1, 15, 27, 8142 }, // И
-    { 14, 20, 16, 1, 20, 35, 8169 }, // Й
-    { 14, 15, 14, 1, 15, 27, 8204 }, // К
-    { 15, 15, 17, 0, 15, 29, 8231 }, // Л
-    { 17, 15, 19, 1, 15, 32, 8260 }, // М
-    { 13, 15, 15, 1, 15, 25, 8292 }, // Н
-    { 15, 15, 17, 1, 15, 29, 8317 }, // О
-    { 13, 15, 15, 1, 15, 25, 8346 }, // П
-    { 12, 15, 14, 1, 15, 23, 8371 }, // Р
-    { 13, 15, 14, 1, 15, 25, 8394 }, // С
-    { 13, 15, 13, 0, 15, 25, 8419 }, // Т
-    { 14, 15, 14, 0, 15, 27, 8444 }, // У
-    { 18, 16, 18, 0, 16, 36, 8471 }, // Ф
-    { 14, 15, 14, 0, 15, 27, 8507 }, // Х
-    { 16, 19, 17, 1, 15, 38, 8534 }, // Ц
-    { 13, 15, 14, 0, 15, 25, 8572 }, // Ч
-    { 19, 15, 21, 1, 15, 36, 8597 }, // Ш
-    { 22, 19, 23, 1, 15, 53, 8633 }, // Щ
-    { 16, 15, 16, 0, 15, 30, 8686 }, // Ъ
-    { 17, 15, 19, 1, 15, 32, 8716 }, // Ы
-    { 12, 15, 14, 1, 15, 23, 8748 }, // Ь
-    { 14, 15, 14, 0, 15, 27, 8771 }, // Э
-    { 21, 15, 23, 1, 15, 40, 8798 }, // Ю
-    { 13, 15, 14, 0, 15, 25, 8838 }, // Я
-    { 11, 11, 12, 0, 11, 16, 8863 }, // а
-    { 12, 16, 13, 0, 16, 24, 8879 }, // б
-    { 11, 11, 13, 1, 11, 16, 8903 }, // в
-    { 9, 11, 10, 1, 11, 13, 8919 }, // г
-    { 14, 14, 14, 0, 11, 25, 8932 }, // д
-    { 12, 11, 12, 0, 11, 17, 8957 }, // е
-    { 18, 11, 18, 0, 11, 25, 8974 }, // ж
-    { 10, 11, 10, 0, 11, 14, 8999 }, // з
-    { 11, 11, 13, 1, 11, 16, 9013 }, // и
-    { 11, 17, 13, 1, 17, 24, 9029 }, // й
-    { 12, 11, 12, 1, 11, 17, 9053 }, // к
-    { 12, 11, 13, 0, 11, 17, 9070 }, // л
-    { 14, 11, 16, 1, 11, 20, 9087 }, // м
-    { 10, 11, 12, 1, 11, 14, 9107 }, // н
-    { 12, 11, 13, 0, 11, 17, 9121 }, // о
-    { 10, 11, 12, 1, 11, 14, 9138 }, // п
-    { 11, 15, 13, 1, 11, 21, 9152 }, // р
-    { 10, 11, 11, 0, 11, 14, 9173 }, // с
-    { 11, 11, 11, 0, 11, 16, 9187 }, // т
-    { 12, 15, 11, 0, 11, 23, 9203 }, // у
-    { 16, 20, 17, 0, 16, 40, 9226 }, // ф
-    { 12, 11, 12, 0, 11, 17, 9266 }, // х
-    { 12, 14, 13, 1, 11, 21, 9283 }, // ц
-    { 11, 11, 12, 0, 11, 16, 9304 }, // ч
-    { 16, 11, 18, 1, 11, 22, 9320 }, // ш
-    { 18, 14, 19, 1, 11, 32, 9342 }, // щ
-    { 13, 11, 13, 0, 11, 18, 9374 }, // ъ
-    { 15, 11, 17, 1, 11, 21, 9392 }, // ы
-    { 11, 11, 12, 1, 11, 16, 9413 }, // ь
-    { 11, 11, 11, 0, 11, 16, 9429 }, // э
-    { 17, 11, 18, 1, 11, 24, 9445 }, // ю
-    { 11, 11, 12, 0, 11, 16, 9469 }, // я
-    { 12, 17, 12, 0, 17, 26, 9485 }, // ѐ
-    { 12, 16, 12, 0, 16, 24, 9511 }, // ё
-    { 12, 20, 13, 0, 16, 30, 9535 }, // ђ
-    { 9, 17, 10, 1, 17, 20, 9565 }, // ѓ
-    { 11, 11, 11, 0, 11, 16, 9585 }, // є
-    { 10, 11, 10, 0, 11, 14, 9601 }, // ѕ
-    { 4, 16, 6, 1, 16, 8, 9615 }, // і
-    { 9, 16, 6, -2, 16, 18, 9623 }, // ї
-    { 7, 20, 6, -2, 16, 18, 9641 }, // ј
-    { 19, 11, 19, 0, 11, 27, 9659 }, // љ
-    { 17, 11, 18, 1, 11, 24, 9686 }, // њ
-    { 12, 16, 13, 0, 16, 24, 9710 }, // ћ
-    { 12, 17, 12, 1, 17, 26, 9734 }, // ќ
-    { 11, 17, 13, 1, 17, 24, 9760 }, // ѝ
-    { 12, 21, 11, 0, 17, 32, 9784 }, // ў
-    { 10, 14, 12, 1, 11, 18, 9816 }, // џ
-    { 15, 16, 16, 0, 16, 30, 9834 }, // Ѣ
-    { 13, 16, 13, 0, 16, 26, 9864 }, // ѣ
-    { 15, 15, 17, 1, 15, 29, 9890 }, // Ѳ
-    { 12, 11, 13, 0, 11, 17, 9919 }, // ѳ
-    { 18, 15, 17, 0, 15, 34, 9936 }, // Ѵ
-    { 13, 11, 13, 0, 11, 18, 9970 }, // ѵ
-    { 16, 23, 17, 1, 19, 46, 9988 }, // Ҋ
-    { 13, 19, 13, 1, 16, 31, 10034 }, // ҋ
-    { 13, 15, 14, 0, 15, 25, 10065 }, // Ҍ
-    { 12, 11, 12, 0, 11, 17, 10090 }, // ҍ
-    { 12, 15, 14, 1, 15, 23, 10107 }, // Ҏ
-    { 11, 15, 13, 1, 11, 21, 10130 }, // ҏ
-    { 11, 18, 12, 1, 18, 25, 10151 }, // Ґ
-    { 9, 14, 10, 1, 14, 16, 10176 }, // ґ
-    { 12, 15, 13, 1, 15, 23, 10192 }, // Ғ
-    { 10, 11, 11, 1, 11, 14, 10215 }, // ғ
-    { 13, 19, 14, 1, 15, 31, 10229 }, // Ҕ
-    { 11, 15, 12, 1, 11, 21, 10260 }, // ҕ
-    { 22, 19, 21, 0, 15, 53, 10281 }, // Җ
-    { 18, 14, 18, 0, 11, 32, 10334 }, // җ
-    { 12, 20, 13, 0, 15, 30, 10366 }, // Ҙ
-    { 10, 16, 10, 0, 11, 20, 10396 }, // ҙ
-    { 15, 19, 15, 1, 15, 36, 10416 }, // Қ
-    { 12, 14, 13, 1, 11, 21, 10452 }, // қ
-    { 16, 15, 16, 1, 15, 30, 10473 }, // Ҝ
-    { 14, 11, 14, 1, 11, 20, 10503 }, // ҝ
-    { 15, 16, 15, 0, 16, 30, 10523 }, // Ҟ
-    { 13, 12, 13, 0, 12, 20, 10553 }, // ҟ
-    { 17, 15, 17, 0, 15, 32, 10573 }, // Ҡ
-    { 14, 11, 14, 0, 11, 20, 10605 }, // ҡ
-    { 16, 19, 17, 1, 15, 38, 10625 }, // Ң
-    { 12, 14, 13, 1, 11, 21, 10663 }, // ң
-    { 17, 15, 18, 1, 15, 32, 10684 }, // Ҥ
-    { 13, 11, 14, 1, 11, 18, 10716 }, // ҥ
-    { 22, 19, 23, 1, 15, 53, 10734 }, // Ҧ
-    { 17, 15, 18, 1, 11, 32, 10787 }, // ҧ
-    { 16, 19, 17, 1, 15, 38, 10819 }, // Ҩ
-    { 13, 14, 13, 0, 11, 23, 10857 }, // ҩ
-    { 13, 20, 14, 1, 15, 33, 10880 }, // Ҫ
-    { 10, 15, 11, 0, 11, 19, 10913 }, // ҫ
-    { 13, 19, 13, 0, 15, 31, 10932 }, // Ҭ
-    { 11, 14, 11, 0, 11, 20, 10963 }, // ҭ
-    { 14, 15, 14, 0, 15, 27, 10983 }, // Ү
-    { 12, 15, 12, 0, 11, 23, 11010 }, // ү
-    { 14, 15, 14, 0, 15, 27, 11033 }, // Ұ
-    { 12, 15, 12, 0, 11, 23, 11060 }, // ұ
-    { 15, 19, 15, 0, 15, 36, 11083 }, // Ҳ
-    { 12, 14, 12, 0, 11, 21, 11119 }, // ҳ
-    { 20, 19, 20, 0, 15, 48, 11140 }, // Ҵ
-    { 15, 14, 15, 0, 11, 27, 11188 }, // ҵ
-    { 14, 19, 15, 1, 15, 34, 11215 }, // Ҷ
-    { 13, 14, 12, 0, 11, 23, 11249 }, // ҷ
-    { 12, 15, 14, 1, 15, 23, 11272 }, // Ҹ
-    { 11, 11, 12, 0, 11, 16, 11295 }, // ҹ
-    { 13, 15, 15, 1, 15, 25, 11311 }, // Һ
-    { 10, 16, 12, 1, 16, 20, 11336 }, // һ
-    { 18, 15, 18, 0, 15, 34, 11356 }, // Ҽ
-    { 14, 11, 15, 0, 11, 20, 11390 }, // ҽ
-    { 18, 19, 18, 0, 15, 43, 11410 }, // Ҿ
-    { 14, 14, 15, 0, 11, 25, 11453 }, // ҿ
-    { 4, 15, 7, 1, 15, 8, 11478 }, // Ӏ
-    { 21, 20, 21, 0, 20, 53, 11486 }, // Ӂ
-    { 18, 17, 18, 0, 17, 39, 11539 }, // ӂ
-    { 13, 19, 15, 1, 15, 31, 11578 }, // Ӄ
-    { 11, 15, 12, 1, 11, 21, 11609 }, // ӄ
-    { 18, 19, 17, 0, 15, 43, 11630 }, // Ӆ
-    { 14, 14, 14, 0, 11, 25, 11673 }, // ӆ
-    { 13, 19, 15, 1, 15, 31, 11698 }, // Ӈ
-    { 11, 15, 13, 1, 11, 21, 11729 }, // ӈ
-    { 16, 19, 17, 1, 15, 38, 11750 }, // Ӊ
-    { 12, 14, 13, 1, 11, 21, 11788 }, // ӊ
-    { 13, 19, 14, 0, 15, 31, 11809 }, // Ӌ
-    { 11, 14, 12, 0, 11, 20, 11840 }, // ӌ
-    { 19, 19, 20, 1, 15, 46, 11860 }, // Ӎ
-    { 16, 14, 17, 1, 11, 28, 11906 }, // ӎ
-    { 4, 15, 6, 1, 15, 8, 11934 }, // ӏ
-    { 15, 20, 15, 0, 20, 38, 11942 }, // Ӑ
-    { 11, 17, 12, 0, 17, 24, 11980 }, // ӑ
-    { 15, 19, 15, 0, 19, 36, 12004 }, // Ӓ
-    { 11, 16, 12, 0, 16, 22, 12040 }, // ӓ
-    { 21, 15, 21, 0, 15, 40, 12062 }, // Ӕ
-    { 18, 11, 18, 0, 11, 25, 12102 }, // ӕ
-    { 11, 20, 13, 1, 20, 28, 12127 }, // Ӗ
-    { 12, 17, 12, 0, 17, 26, 12155 }, // ӗ
-    { 14, 15, 15, 1, 15, 27, 12181 }, // Ә
-    { 12, 11, 12, 0, 11, 17, 12208 }, // ә
-    { 14, 19, 15, 1, 19, 34, 12225 }, // Ӛ
-    { 12, 16, 12, 0, 16, 24, 12259 }, // ӛ
-    { 21, 19, 21, 0, 19, 50, 12283 }, // Ӝ
-    { 18, 16, 18, 0, 16, 36, 12333 }, // ӝ
-    { 12, 20, 13, 0, 20, 30, 12369 }, // Ӟ
-    { 10, 16, 10, 0, 16, 20, 12399 }, // ӟ
-    { 12, 15, 13, 0, 15, 23, 12419 }, // Ӡ
-    { 10, 15, 11, 0, 11, 19, 12442 }, // ӡ
-    { 14, 18, 16, 1, 18, 32, 12461 }, // Ӣ
-    { 11, 15, 13, 1, 15, 21, 12493 }, // ӣ
-    { 14, 19, 16, 1, 19, 34, 12514 }, // Ӥ
-    { 11, 16, 13, 1, 16, 22, 12548 }, // ӥ
-    { 15, 19, 17, 1, 19, 36, 12570 }, // Ӧ
-    { 12, 16, 13, 0, 16, 24, 12606 }, // ӧ
-    { 15, 15, 17, 1, 15, 29, 12630 }, // Ө
-    { 12, 11, 13, 0, 11, 17, 12659 }, // ө
-    { 15, 19, 17, 1, 19, 36, 12676 }, // Ӫ
-    { 12, 16, 13, 0, 16, 24, 12712 }, // ӫ
-    { 14, 19, 14, 0, 19, 34, 12736 }, // Ӭ
-    { 11, 16, 11, 0, 16, 22, 12770 }, // ӭ
-    { 14, 18, 14, 0, 18, 32, 12792 }, // Ӯ
-    { 12, 19, 11, 0, 15, 29, 12824 }, // ӯ
-    { 14, 19, 14, 0, 19, 34, 12853 }, // Ӱ
-    { 12, 20, 11, 0, 16, 30, 12887 }, // ӱ
-    { 14, 21, 14, 0, 21, 37, 12917 }, // Ӳ
-    { 12, 21, 11, 0, 17, 32, 12954 }, // ӳ
-    { 13, 19, 14, 0, 19, 31, 12986 }, // Ӵ
-    { 11, 16, 12, 0, 16, 22, 13017 }, // ӵ
-    { 11, 19, 12, 1, 15, 27, 13039 }, // Ӷ
-    { 9, 14, 10, 1, 11, 16, 13066 }, // ӷ
-    { 17, 19, 19, 1, 19, 41, 13082 }, // Ӹ
-    { 15, 16, 17, 1, 16, 30, 13123 }, // ӹ
-    { 11, 3, 11, 0, 8, 5, 13153 }, // –
-    { 21, 3, 21, 0, 8, 8, 13158 }, // —
-    { 21, 3, 21, 0, 8, 8, 13166 }, // ―
-    { 5, 6, 5, 0, 16, 4, 13174 }, // ‘
-    { 5, 6, 5, 0, 16, 4, 13178 }, // ’
-    { 5, 6, 5, 0, 3, 4, 13182 }, // ‚
-    { 10, 6, 10, 0, 16, 8, 13186 }, // “
-    { 9, 6, 10, 0, 16, 7, 13194 }, // ”
-    { 9, 6, 10, 0, 3, 7, 13201 }, // „
-    { 10, 18, 10, 0, 15, 23, 13208 }, // †
-    { 10, 18, 10, 0, 15, 23, 13231 }, // ‡
-    { 7, 6, 8, 0, 10, 6, 13254 }, // •
-    { 19, 4, 21, 1, 4, 10, 13260 }, // …
-    { 27, 15, 28, 0, 15, 51, 13270 }, // ‰
-    { 7, 11, 7, 0, 11, 10, 13321 }, // ‹
-    { 7, 11, 7, 0, 11, 10, 13331 }, // ›
-    { 11, 15, 3, -4, 15, 21, 13341 }, // ⁄
-    { 8, 9, 8, 0, 15, 9, 13362 }, // ⁰
-    { 8, 8, 8, 0, 15, 8, 13371 }, // ⁴
-    { 7, 9, 8, 0, 15, 8, 13379 }, // ⁵
-    { 8, 9, 8, 0, 15, 9, 13387 }, // ⁶
-    { 8, 8, 8, 0, 15, 8, 13396 }, // ⁷
-    { 8, 9, 8, 0, 15, 9, 13404 }, // ⁸
-    { 8, 9, 8, 0, 15, 9, 13413 }, // ⁹
-    { 8, 9, 8, 0, 9, 9, 13422 }, // ₀
-    { 6, 9, 8, 0, 9, 7, 13431 }, // ₁
-    { 7, 9, 8, 0, 9, 8, 13438 }, // ₂
-    { 7, 9, 8, 0, 9, 8, 13446 }, // ₃
-    { 8, 8, 8, 0, 9, 8, 13454 }, // ₄
-    { 7, 9, 8, 0, 9, 8, 13462 }, // ₅
-    { 8, 9, 8, 0, 9, 9, 13470 }, // ₆
-    { 8, 8, 8, 0, 9, 8, 13479 }, // ₇
-    { 8, 9, 8, 0, 9, 9, 13487 }, // ₈
-    { 8, 9, 8, 0, 9, 9, 13496 }, // ₉
-    { 12, 15, 12, 0, 15, 23, 13505 }, // €
-    { 12, 15, 12, 0, 15, 23, 13528 }, // ₮
-    { 12, 15, 12, 0, 15, 23, 13551 }, // ₴
-    { 13, 15, 12, 0, 15, 25, 13574 }, // ₹
-    { 12, 15, 13, 0, 15, 23, 13599 }, // ∂
-    { 15, 15, 15, 0, 15, 29, 13622 }, // ∆
-    { 13, 17, 15, 1, 15, 28, 13651 }, // ∏
-    { 11, 17, 11, 0, 15, 24, 13679 }, // ∑
-    { 10, 3, 12, 1, 8, 4, 13703 }, // −
-    { 11, 15, 3, -4, 15, 21, 13707 }, // ∕
-    { 5, 4, 5, 0, 9, 3, 13728 }, // ∙
-    { 14, 15, 13, 0, 15, 27, 13731 }, // √
-    { 13, 7, 13, 0, 10, 12, 13758 }, // ∞
-    { 9, 21, 8, 0, 16, 24, 13770 }, // ∫
-    { 12, 11, 12, 0, 12, 17, 13794 }, // ≈
-    { 10, 14, 12, 1, 14, 18, 13811 }, // ≠
-    { 10, 13, 12, 1, 13, 17, 13829 }, // ≤
-    { 10, 13, 12, 1, 13, 17, 13846 }, // ≥
+    { 4, 15, 6, 1, 15, 15, 0 }, // !
+    { 8, 6, 10, 1, 16, 6, 15 }, // "
+    { 13, 15, 15, 1, 15, 30, 21 }, // #
+    { 11, 19, 12, 0, 16, 38, 51 }, // $
+    { 19, 15, 19, 0, 15, 45, 89 }, // %
+    { 15, 15, 15, 0, 15, 30, 134 }, // &
+    { 4, 6, 5, 1, 16, 6, 164 }, // '
+    { 7, 20, 7, 1, 16, 20, 170 }, // (
+    { 6, 20, 7, 0, 16, 20, 190 }, // )
+    { 10, 8, 11, 0, 15, 16, 210 }, // *
+    { 10, 11, 12, 1, 12, 22, 226 }, // +
+    { 5, 6, 5, 0, 3, 6, 248 }, // ,
+    { 7, 3, 7, 0, 8, 3, 254 }, // -
+    { 5, 4, 5, 0, 4, 4, 257 }, // .
+    { 11, 20, 9, -1, 16, 40, 261 }, // /
+    { 12, 15, 12, 0, 15, 30, 301 }, // 0
+    { 8, 15, 12, 1, 15, 15, 331 }, // 1
+    { 11, 15, 12, 0, 15, 30, 346 }, // 2
+    { 11, 15, 12, 0, 15, 30, 376 }, // 3
+    { 12, 15, 12, 0, 15, 30, 406 }, // 4
+    { 11, 15, 12, 0, 15, 30, 436 }, // 5
+    { 12, 15, 12, 0, 15, 30, 466 }, // 6
+    { 12, 15, 12, 0, 15, 30, 496 }, // 7
+    { 12, 15, 12, 0, 15, 30, 526 }, // 8
+    { 12, 15, 12, 0, 15, 30, 556 }, // 9
+    { 5, 11, 5, 0, 11, 11, 586 }, // :
+    { 5, 14, 5, 0, 11, 14, 597 }, // ;
+    { 10, 11, 12, 1, 12, 22, 611 }, // <
+    { 10, 8, 12, 1, 10, 16, 633 }, // =
+    { 10, 11, 12, 1, 12, 22, 649 }, // >
+    { 10, 16, 10, 0, 16, 32, 671 }, // ?
+    { 19, 18, 20, 1, 15, 54, 703 }, // @
+    { 15, 15, 15, 0, 15, 30, 757 }, // A
+    { 13, 15, 14, 1, 15, 30, 787 }, // B
+    { 13, 15, 14, 1, 15, 30, 817 }, // C
+    { 14, 15, 15, 1, 15, 30, 847 }, // D
+    { 11, 15, 13, 1, 15, 30, 877 }, // E
+    { 11, 15, 12, 1, 15, 30, 907 }, // F
+    { 13, 15, 15, 1, 15, 30, 937 }, // G
+    { 13, 15, 15, 1, 15, 30, 967 }, // H
+    { 4, 15, 7, 1, 15, 15, 997 }, // I
+    { 10, 15, 11, 0, 15, 30, 1012 }, // J
+    { 14, 15, 14, 1, 15, 30, 1042 }, // K
+    { 11, 15, 12, 1, 15, 30, 1072 }, // L
+    { 17, 15, 19, 1, 15, 45, 1102 }, // M
+    { 14, 15, 16, 1, 15, 30, 1147 }, // N
+    { 15, 15, 17, 1, 15, 30, 1177 }, // O
+    { 12, 15, 14, 1, 15, 30, 1207 }, // P
+    { 15, 18, 17, 1, 15, 36, 1237 }, // Q
+    { 13, 15, 14, 1, 15, 30, 1273 }, // R
+    { 12, 15, 12, 0, 15, 30, 1303 }, // S
+    { 13, 15, 13, 0, 15, 30, 1333 }, // T
+    { 13, 15, 15, 1, 15, 30, 1363 }, // U
+    { 15, 15, 15, 0, 15, 30, 1393 }, // V
+    { 20, 15, 20, 0, 15, 45, 1423 }, // W
+    { 14, 15, 14, 0, 15, 30, 1468 }, // X
+    { 14, 15, 14, 0, 15, 30, 1498 }, // Y
+    { 13, 15, 13, 0, 15, 30, 1528 }, // Z
+    { 7, 20, 8, 1, 16, 20, 1558 }, // [
+    { 11, 20, 9, -1, 16, 40, 1578 }, // <backslash>
+    { 6, 20, 8, 0, 16, 20, 1618 }, // ]
+    { 12, 9, 12, 0, 15, 18, 1638 }, // ^
+    { 11, 3, 11, 0, -1, 6, 1656 }, // _
+    { 6, 5, 6, 0, 17, 5, 1662 }, // `
+    { 11, 11, 12, 0, 11, 22, 1667 }, // a
+    { 11, 16, 13, 1, 16, 32, 1689 }, // b
+    { 10, 11, 11, 0, 11, 22, 1721 }, // c
+    { 12, 16, 13, 0, 16, 32, 1743 }, // d
+    { 12, 11, 12, 0, 11, 22, 1775 }, // e
+    { 9, 16, 9, 1, 16, 32, 1797 }, // f
+    { 11, 15, 12, 0, 11, 30, 1829 }, // g
+    { 10, 16, 12, 1, 16, 32, 1859 }, // h
+    { 4, 16, 6, 1, 16, 16, 1891 }, // i
+    { 7, 20, 6, -2, 16, 20, 1907 }, // j
+    { 11, 16, 12, 1, 16, 32, 1927 }, // k
+    { 6, 16, 7, 1, 16, 16, 1959 }, // l
+    { 16, 11, 18, 1, 11, 22, 1975 }, // m
+    { 10, 11, 12, 1, 11, 22, 1997 }, // n
+    { 12, 11, 13, 0, 11, 22, 2019 }, // o
+    { 11, 15, 13, 1, 11, 30, 2041 }, // p
+    { 12, 15, 13, 0, 11, 30, 2071 }, // q
+    { 8, 11, 9, 1, 11, 11, 2101 }, // r
+    { 10, 11, 10, 0, 11, 22, 2112 }, // s
+    { 8, 14, 9, 1, 14, 14, 2134 }, // t
+    { 10, 11, 12, 1, 11, 22, 2148 }, // u
+    { 12, 11, 12, 0, 11, 22, 2170 }, // v
+    { 17, 11, 16, 0, 11, 33, 2192 }, // w
+    { 12, 11, 12, 0, 11, 22, 2225 }, // x
+    { 12, 15, 11, 0, 11, 30, 2247 }, // y
+    { 10, 11, 11, 0, 11, 22, 2277 }, // z
+    { 8, 20, 8, 0, 16, 20, 2299 }, // {
+    { 4, 20, 7, 1, 16, 20, 2319 }, // |
+    { 8, 20, 8, 0, 16, 20, 2339 }, // }
+    { 12, 5, 12, 0, 9, 10, 2359 }, // ~
+    { 0, 0, 5, 0, 0, 0, 2369 }, //  
+    { 4, 15, 6, 1, 11, 15, 2369 }, // ¡
+    { 10, 16, 12, 0, 14, 32, 2384 }, // ¢
+    { 11, 15, 12, 0, 15, 30, 2416 }, // £
+    { 12, 11, 12, 0, 13, 22, 2446 }, // ¤
+    { 14, 15, 12, -1, 15, 30, 2468 }, // ¥
+    { 4, 20, 6, 1, 16, 20, 2498 }, // ¦
+    { 11, 19, 11, 0, 15, 38, 2518 }, // §
+    { 9, 3, 11, 1, 16, 6, 2556 }, // ¨
+    { 15, 15, 17, 1, 15, 30, 2562 }, // ©
+    { 8, 8, 8, 0, 15, 8, 2592 }, // ª
+    { 12, 11, 13, 0, 11, 22, 2600 }, // «
+    { 10, 8, 12, 1, 9, 16, 2622 }, // ¬
+    { 7, 3, 7, 0, 8, 3, 2638 }, // ­
+    { 15, 15, 17, 1, 15, 30, 2641 }, // ®
+    { 8, 2, 8, 0, 15, 2, 2671 }, // ¯
+    { 8, 6, 8, 0, 16, 6, 2673 }, // °
+    { 10, 15, 12, 1, 15, 30, 2679 }, // ±
+    { 7, 9, 8, 0, 15, 9, 2709 }, // ²
+    { 7, 9, 8, 0, 15, 9, 2718 }, // ³
+    { 6, 5, 6, 0, 17, 5, 2727 }, // ´
+    { 10, 15, 12, 1, 11, 30, 2732 }, // µ
+    { 14, 19, 15, 0, 15, 38, 2762 }, // ¶
+    { 5, 4, 5, 0, 9, 4, 2800 }, // ·
+    { 6, 6, 7, 0, 1, 6, 2804 }, // ¸
+    { 6, 9, 8, 0, 15, 9, 2810 }, // ¹
+    { 9, 8, 10, 0, 15, 16, 2819 }, // º
+    { 13, 11, 13, 0, 11, 22, 2835 }, // »
+    { 19, 15, 18, 0, 15, 45, 2857 }, // ¼
+    { 18, 15, 18, 0, 15, 45, 2902 }, // ½
+    { 19, 15, 18, 0, 15, 45, 2947 }, // ¾
+    { 10, 15, 10, 0, 11, 30, 2992 }, // ¿
+    { 15, 21, 15, 0, 21, 42, 3022 }, // À
+    { 15, 21, 15, 0, 21, 42, 3064 }, // Á
+    { 15, 21, 15, 0, 21, 42, 3106 }, // Â
+    { 15, 19, 15, 0, 19, 38, 3148 }, // Ã
+    { 15, 19, 15, 0, 19, 38, 3186 }, // Ä
+    { 15, 19, 15, 0, 19, 38, 3224 }, // Å
+    { 21, 15, 21, 0, 15, 45, 3262 }, // Æ
+    { 13, 20, 14, 1, 15, 40, 3307 }, // Ç
+    { 11, 21, 13, 1, 21, 42, 3347 }, // È
+    { 11, 21, 13, 1, 21, 42, 3389 }, // É
+    { 11, 21, 13, 1, 21, 42, 3431 }, // Ê
+    { 11, 19, 13, 1, 19, 38, 3473 }, // Ë
+    { 6, 21, 7, 0, 21, 21, 3511 }, // Ì
+    { 5, 21, 7, 1, 21, 21, 3532 }, // Í
+    { 7, 21, 7, 0, 21, 21, 3553 }, // Î
+    { 9, 19, 7, -1, 19, 38, 3574 }, // Ï
+    { 15, 15, 16, 0, 15, 30, 3612 }, // Ð
+    { 14, 19, 16, 1, 19, 38, 3642 }, // Ñ
+    { 15, 21, 17, 1, 21, 42, 3680 }, // Ò
+    { 15, 21, 17, 1, 21, 42, 3722 }, // Ó
+    { 15, 21, 17, 1, 21, 42, 3764 }, // Ô
+    { 15, 19, 17, 1, 19, 38, 3806 }, // Õ
+    { 15, 19, 17, 1, 19, 38, 3844 }, // Ö
+    { 10, 9, 12, 1, 11, 18, 3882 }, // ×
+    { 15, 17, 17, 1, 16, 34, 3900 }, // Ø
+    { 13, 21, 15, 1, 21, 42, 3934 }, // Ù
+    { 13, 21, 15, 1, 21, 42, 3976 }, // Ú
+    { 13, 21, 15, 1, 21, 42, 4018 }, // Û
+    { 13, 19, 15, 1, 19, 38, 4060 }, // Ü
+    { 14, 21, 14, 0, 21, 42, 4098 }, // Ý
+    { 12, 15, 14, 1, 15, 30, 4140 }, // Þ
+    { 13, 16, 14, 1, 16, 32, 4170 }, // ß
+    { 11, 17, 12, 0, 17, 34, 4202 }, // à
+    { 11, 17, 12, 0, 17, 34, 4236 }, // á
+    { 11, 17, 12, 0, 17, 34, 4270 }, // â
+    { 11, 16, 12, 0, 16, 32, 4304 }, // ã
+    { 11, 16, 12, 0, 16, 32, 4336 }, // ä
+    { 11, 18, 12, 0, 18, 36, 4368 }, // å
+    { 18, 11, 18, 0, 11, 33, 4404 }, // æ
+    { 10, 15, 11, 0, 11, 30, 4437 }, // ç
+    { 12, 17, 12, 0, 17, 34, 4467 }, // è
+    { 12, 17, 12, 0, 17, 34, 4501 }, // é
+    { 12, 17, 12, 0, 17, 34, 4535 }, // ê
+    { 12, 16, 12, 0, 16, 32, 4569 }, // ë
+    { 6, 17, 6, 0, 17, 17, 4601 }, // ì
+    { 6, 17, 6, 0, 17, 17, 4618 }, // í
+    { 8, 17, 6, -1, 17, 17, 4635 }, // î
+    { 9, 16, 6, -2, 16, 32, 4652 }, // ï
+    { 13, 16, 13, 0, 16, 32, 4684 }, // ð
+    { 10, 16, 12, 1, 16, 32, 4716 }, // ñ
+    { 12, 17, 13, 0, 17, 34, 4748 }, // ò
+    { 12, 17, 13, 0, 17, 34, 4782 }, // ó
+    { 12, 17, 13, 0, 17, 34, 4816 }, // ô
+    { 12, 16, 13, 0, 16, 32, 4850 }, // õ
+    { 12, 16, 13, 0, 16, 32, 4882 }, // ö
+    { 10, 13, 12, 1, 13, 26, 4914 }, // ÷
+    { 12, 13, 13, 0, 12, 26, 4940 }, // ø
+    { 10, 17, 12, 1, 17, 34, 4966 }, // ù
+    { 10, 17, 12, 1, 17, 34, 5000 }, // ú
+    { 10, 17, 12, 1, 17, 34, 5034 }, // û
+    { 10, 16, 12, 1, 16, 32, 5068 }, // ü
+    { 12, 21, 11, 0, 17, 42, 5100 }, // ý
+    { 11, 20, 13, 1, 16, 40, 5142 }, // þ
+    { 12, 20, 11, 0, 16, 40, 5182 }, // ÿ
+    { 15, 18, 15, 0, 18, 36, 5222 }, // Ā
+    { 11, 15, 12, 0, 15, 30, 5258 }, // ā
+    { 15, 19, 15, 0, 19, 38, 5288 }, // Ă
+    { 11, 16, 12, 0, 16, 32, 5326 }, // ă
+    { 16, 20, 15, 0, 15, 40, 5358 }, // Ą
+    { 11, 15, 12, 0, 11, 30, 5398 }, // ą
+    { 13, 21, 14, 1, 21, 42, 5428 }, // Ć
+    { 10, 17, 11, 0, 17, 34, 5470 }, // ć
+    { 13, 21, 14, 1, 21, 42, 5504 }, // Ĉ
+    { 10, 17, 11, 0, 17, 34, 5546 }, // ĉ
+    { 13, 19, 14, 1, 19, 38, 5580 }, // Ċ
+    { 10, 16, 11, 0, 16, 32, 5618 }, // ċ
+    { 13, 21, 14, 1, 21, 42, 5650 }, // Č
+    { 10, 17, 11, 0, 17, 34, 5692 }, // č
+    { 14, 21, 15, 1, 21, 42, 5726 }, // Ď
+    { 16, 16, 14, 0, 16, 32, 5768 }, // ď
+    { 15, 15, 16, 0, 15, 30, 5800 }, // Đ
+    { 13, 16, 13, 0, 16, 32, 5830 }, // đ
+    { 11, 18, 13, 1, 18, 36, 5862 }, // Ē
+    { 12, 15, 12, 0, 15, 30, 5898 }, // ē
+    { 11, 19, 13, 1, 19, 38, 5928 }, // Ĕ
+    { 12, 16, 12, 0, 16, 32, 5966 }, // ĕ
+    { 11, 19, 13, 1, 19, 38, 5998 }, // Ė
+    { 12, 16, 12, 0, 16, 32, 6036 }, // ė
+    { 12, 20, 13, 1, 15, 40, 6068 }, // Ę
+    { 12, 15, 12, 0, 11, 30, 6108 }, // ę
+    { 11, 21, 13, 1, 21, 42, 6138 }, // Ě
+    { 12, 17, 12, 0, 17, 34, 6180 }, // ě
+    { 13, 21, 15, 1, 21, 42, 6214 }, // Ĝ
+    { 11, 21, 12, 0, 17, 42, 6256 }, // ĝ
+    { 13, 19, 15, 1, 19, 38, 6298 }, // Ğ
+    { 11, 20, 12, 0, 16, 40, 6336 }, // ğ
+    { 13, 19, 15, 1, 19, 38, 6376 }, // Ġ
+    { 11, 20, 12, 0, 16, 40, 6414 }, // ġ
+    { 13, 20, 15, 1, 15, 40, 6454 }, // Ģ
+    { 11, 21, 12, 0, 17, 42, 6494 }, // ģ
+    { 13, 21, 15, 1, 21, 42, 6536 }, // Ĥ
+    { 10, 20, 12, 1, 20, 40, 6578 }, // ĥ
+    { 16, 15, 16, 0, 15, 30, 6618 }, // Ħ
+    { 12, 16, 13, 0, 16, 32, 6648 }, // ħ
+    { 9, 19, 7, -1, 19, 38, 6680 }, // Ĩ
+    { 8, 16, 6, -1, 16, 16, 6718 }, // ĩ
+    { 8, 18, 7, -1, 18, 18, 6734 }, // Ī
+    { 8, 15, 6, -1, 15, 15, 6752 }, // ī
+    { 7, 19, 7, 0, 19, 19, 6767 }, // Ĭ
+    { 8, 16, 6, -1, 16, 16, 6786 }, // ĭ
+    { 6, 20, 7, 0, 15, 20, 6802 }, // Į
+    { 6, 21, 6, 0, 16, 21, 6822 }, // į
+    { 4, 19, 7, 1, 19, 19, 6843 }, // İ
+    { 4, 11, 6, 1, 11, 11, 6862 }, // ı
+    { 16, 15, 18, 1, 15, 30, 6873 }, // Ĳ
+    { 10, 20, 12, 1, 16, 40, 6903 }, // ĳ
+    { 12, 21, 11, 0, 21, 42, 6943 }, // Ĵ
+    { 9, 21, 6, -2, 17, 42, 6985 }, // ĵ
+    { 14, 20, 14, 1, 15, 40, 7027 }, // Ķ
+    { 11, 21, 12, 1, 16, 42, 7067 }, // ķ
+    { 12, 11, 12, 1, 11, 22, 7109 }, // ĸ
+    { 11, 21, 12, 1, 21, 42, 7131 }, // Ĺ
+    { 6, 21, 7, 1, 21, 21, 7173 }, // ĺ
+    { 11, 20, 12, 1, 15, 40, 7194 }, // Ļ
+    { 6, 21, 7, 1, 16, 21, 7234 }, // ļ
+    { 11, 15, 12, 1, 15, 30, 7255 }, // Ľ
+    { 8, 16, 8, 1, 16, 16, 7285 }, // ľ
+    { 11, 15, 12, 1, 15, 30, 7301 }, // Ŀ
+    { 10, 16, 11, 1, 16, 32, 7331 }, // ŀ
+    { 13, 15, 12, 0, 15, 30, 7363 }, // Ł
+    { 9, 16, 8, -1, 16, 32, 7393 }, // ł
+    { 14, 21, 16, 1, 21, 42, 7425 }, // Ń
+    { 10, 17, 12, 1, 17, 34, 7467 }, // ń
+    { 14, 20, 16, 1, 15, 40, 7501 }, // Ņ
+    { 10, 16, 12, 1, 11, 32, 7541 }, // ņ
+    { 14, 21, 16, 1, 21, 42, 7573 }, // Ň
+    { 10, 17, 12, 1, 17, 34, 7615 }, // ň
+    { 13, 16, 13, -1, 16, 32, 7649 }, // ŉ
+    { 14, 19, 16, 1, 15, 38, 7681 }, // Ŋ
+    { 10, 15, 12, 1, 11, 30, 7719 }, // ŋ
+    { 15, 18, 17, 1, 18, 36, 7749 }, // Ō
+    { 12, 15, 13, 0, 15, 30, 7785 }, // ō
+    { 15, 19, 17, 1, 19, 38, 7815 }, // Ŏ
+    { 12, 16, 13, 0, 16, 32, 7853 }, // ŏ
+    { 15, 21, 17, 1, 21, 42, 7885 }, // Ő
+    { 12, 17, 13, 0, 17, 34, 7927 }, // ő
+    { 20, 15, 21, 1, 15, 45, 7961 }, // Œ
+    { 19, 11, 20, 0, 11, 33, 8006 }, // œ
+    { 13, 21, 14, 1, 21, 42, 8039 }, // Ŕ
+    { 8, 17, 9, 1, 17, 17, 8081 }, // ŕ
+    { 13, 20, 14, 1, 15, 40, 8098 }, // Ŗ
+    { 9, 16, 9, 0, 11, 32, 8138 }, // ŗ
+    { 13, 20, 14, 1, 20, 40, 8170 }, // Ř
+    { 8, 17, 9, 1, 17, 17, 8210 }, // ř
+    { 12, 21, 12, 0, 21, 42, 8227 }, // Ś
+    { 10, 17, 10, 0, 17, 34, 8269 }, // ś
+    { 12, 21, 12, 0, 21, 42, 8303 }, // Ŝ
+    { 10, 17, 10, 0, 17, 34, 8345 }, // ŝ
+    { 12, 20, 12, 0, 15, 40, 8379 }, // Ş
+    { 10, 16, 10, 0, 11, 32, 8419 }, // ş
+    { 12, 21, 12, 0, 21, 42, 8451 }, // Š
+    { 10, 17, 10, 0, 17, 34, 8493 }, // š
+    { 13, 19, 13, 0, 15, 38, 8527 }, // Ţ
+    { 8, 18, 9, 1, 14, 18, 8565 }, // ţ
+    { 13, 21, 13, 0, 21, 42, 8583 }, // Ť
+    { 8, 16, 9, 1, 16, 16, 8625 }, // ť
+    { 13, 15, 13, 0, 15, 30, 8641 }, // Ŧ
+    { 8, 14, 9, 1, 14, 14, 8671 }, // ŧ
+    { 13, 19, 15, 1, 19, 38, 8685 }, // Ũ
+    { 10, 16, 12, 1, 16, 32, 8723 }, // ũ
+    { 13, 18, 15, 1, 18, 36, 8755 }, // Ū
+    { 10, 15, 12, 1, 15, 30, 8791 }, // ū
+    { 13, 19, 15, 1, 19, 38, 8821 }, // Ŭ
+    { 10, 16, 12, 1, 16, 32, 8859 }, // ŭ
+    { 13, 21, 15, 1, 21, 42, 8891 }, // Ů
+    { 10, 18, 12, 1, 18, 36, 8933 }, // ů
+    { 13, 21, 15, 1, 21, 42, 8969 }, // Ű
+    { 11, 17, 12, 1, 17, 34, 9011 }, // ű
+    { 13, 19, 15, 1, 15, 38, 9045 }, // Ų
+    { 10, 15, 12, 1, 11, 30, 9083 }, // ų
+    { 20, 21, 20, 0, 21, 63, 9113 }, // Ŵ
+    { 17, 17, 16, 0, 17, 51, 9176 }, // ŵ
+    { 14, 21, 14, 0, 21, 42, 9227 }, // Ŷ
+    { 12, 21, 11, 0, 17, 42, 9269 }, // ŷ
+    { 14, 19, 14, 0, 19, 38, 9311 }, // Ÿ
+    { 13, 21, 13, 0, 21, 42, 9349 }, // Ź
+    { 10, 17, 11, 0, 17, 34, 9391 }, // ź
+    { 13, 19, 13, 0, 19, 38, 9425 }, // Ż
+    { 10, 16, 11, 0, 16, 32, 9463 }, // ż
+    { 13, 21, 13, 0, 21, 42, 9495 }, // Ž
+    { 10, 17, 11, 0, 17, 34, 9537 }, // ž
+    { 9, 16, 7, 1, 16, 32, 9571 }, // ſ
+    { 8, 3, 8, 0, 15, 3, 9603 }, // ̑
+    { 11, 21, 13, 1, 21, 42, 9606 }, // Ѐ
+    { 11, 20, 13, 1, 20, 40, 9648 }, // Ё
+    { 17, 15, 17, 0, 15, 45, 9688 }, // Ђ
+    { 11, 21, 12, 1, 21, 42, 9733 }, // Ѓ
+    { 13, 15, 14, 1, 15, 30, 9775 }, // Є
+    { 12, 15, 12, 0, 15, 30, 9805 }, // Ѕ
+    { 4, 15, 7, 1, 15, 15, 9835 }, // І
+    { 9, 19, 7, -1, 19, 38, 9850 }, // Ї
+    { 10, 15, 11, 0, 15, 30, 9888 }, // Ј
+    { 23, 15, 24, 0, 15, 45, 9918 }, // Љ
+    { 21, 15, 23, 1, 15, 45, 9963 }, // Њ
+    { 16, 15, 16, 0, 15, 30, 10008 }, // Ћ
+    { 14, 21, 14, 1, 21, 42, 10038 }, // Ќ
+    { 14, 21, 16, 1, 21, 42, 10080 }, // Ѝ
+    { 14, 20, 14, 0, 20, 40, 10122 }, // Ў
+    { 13, 19, 15, 1, 15, 38, 10162 }, // Џ
+    { 15, 15, 15, 0, 15, 30, 10200 }, // А
+    { 12, 15, 14, 1, 15, 30, 10230 }, // Б
+    { 13, 15, 14, 1, 15, 30, 10260 }, // В
+    { 11, 15, 12, 1, 15, 30, 10290 }, // Г
+    { 17, 19, 17, 0, 15, 57, 10320 }, // Д
+    { 11, 15, 13, 1, 15, 30, 10377 }, // Е
+    { 21, 15, 21, 0, 15, 45, 10407 }, // Ж
+    { 12, 15, 13, 0, 15, 30, 10452 }, // З
+    { 14, 15, 16, 1, 15, 30, 10482 }, // И
+    { 14, 20, 16, 1, 20, 40, 10512 }, // Й
+    { 14, 15, 14, 1, 15, 30, 10552 }, // К
+    { 15, 15, 17, 0, 15, 30, 10582 }, // Л
+    { 17, 15, 19, 1, 15, 45, 10612 }, // М
+    { 13, 15, 15, 1, 15, 30, 10657 }, // Н
+    { 15, 15, 17, 1, 15, 30, 10687 }, // О
+    { 13, 15, 15, 1, 15, 30, 10717 }, // П
+    { 12, 15, 14, 1, 15, 30, 10747 }, // Р
+    { 13, 15, 14, 1, 15, 30, 10777 }, // С
+    { 13, 15, 13, 0, 15, 30, 10807 }, // Т
+    { 14, 15, 14, 0, 15, 30, 10837 }, // У
+    { 18, 16, 18, 0, 16, 48, 10867 }, // Ф
+    { 14, 15, 14, 0, 15, 30, 10915 }, // Х
+    { 16, 19, 17, 1, 15, 38, 10945 }, // Ц
+    { 13, 15, 14, 0, 15, 30, 10983 }, // Ч
+    { 19, 15, 21, 1, 15, 45, 11013 }, // Ш
+    { 22, 19, 23, 1, 15, 57, 11058 }, // Щ
+    { 16, 15, 16, 0, 15, 30, 11115 }, // Ъ
+    { 17, 15, 19, 1, 15, 45, 11145 }, // Ы
+    { 12, 15, 14, 1, 15, 30, 11190 }, // Ь
+    { 14, 15, 14, 0, 15, 30, 11220 }, // Э
+    { 21, 15, 23, 1, 15, 45, 11250 }, // Ю
+    { 13, 15, 14, 0, 15, 30, 11295 }, // Я
+    { 11, 11, 12, 0, 11, 22, 11325 }, // а
+    { 12, 16, 13, 0, 16, 32, 11347 }, // б
+    { 11, 11, 13, 1, 11, 22, 11379 }, // в
+    { 9, 11, 10, 1, 11, 22, 11401 }, // г
+    { 14, 14, 14, 0, 11, 28, 11423 }, // д
+    { 12, 11, 12, 0, 11, 22, 11451 }, // е
+    { 18, 11, 18, 0, 11, 33, 11473 }, // ж
+    { 10, 11, 10, 0, 11, 22, 11506 }, // з
+    { 11, 11, 13, 1, 11, 22, 11528 }, // и
+    { 11, 17, 13, 1, 17, 34, 11550 }, // й
+    { 12, 11, 12, 1, 11, 22, 11584 }, // к
+    { 12, 11, 13, 0, 11, 22, 11606 }, // л
+    { 14, 11, 16, 1, 11, 22, 11628 }, // м
+    { 10, 11, 12, 1, 11, 22, 11650 }, // н
+    { 12, 11, 13, 0, 11, 22, 11672 }, // о
+    { 10, 11, 12, 1, 11, 22, 11694 }, // п
+    { 11, 15, 13, 1, 11, 30, 11716 }, // р
+    { 10, 11, 11, 0, 11, 22, 11746 }, // с
+    { 11, 11, 11, 0, 11, 22, 11768 }, // т
+    { 12, 15, 11, 0, 11, 30, 11790 }, // у
+    { 16, 20, 17, 0, 16, 40, 11820 }, // ф
+    { 12, 11, 12, 0, 11, 22, 11860 }, // х
+    { 12, 14, 13, 1, 11, 28, 11882 }, // ц
+    { 11, 11, 12, 0, 11, 22, 11910 }, // ч
+    { 16, 11, 18, 1, 11, 22, 11932 }, // ш
+    { 18, 14, 19, 1, 11, 42, 11954 }, // щ
+    { 13, 11, 13, 0, 11, 22, 11996 }, // ъ
+    { 15, 11, 17, 1, 11, 22, 12018 }, // ы
+    { 11, 11, 12, 1, 11, 22, 12040 }, // ь
+    { 11, 11, 11, 0, 11, 22, 12062 }, // э
+    { 17, 11, 18, 1, 11, 33, 12084 }, // ю
+    { 11, 11, 12, 0, 11, 22, 12117 }, // я
+    { 12, 17, 12, 0, 17, 34, 12139 }, // ѐ
+    { 12, 16, 12, 0, 16, 32, 12173 }, // ё
+    { 12, 20, 13, 0, 16, 40, 12205 }, // ђ
+    { 9, 17, 10, 1, 17, 34, 12245 }, // ѓ
+    { 11, 11, 11, 0, 11, 22, 12279 }, // є
+    { 10, 11, 10, 0, 11, 22, 12301 }, // ѕ
+    { 4, 16, 6, 1, 16, 16, 12323 }, // і
+    { 9, 16, 6, -2, 16, 32, 12339 }, // ї
+    { 7, 20, 6, -2, 16, 20, 12371 }, // ј
+    { 19, 11, 19, 0, 11, 33, 12391 }, // љ
+    { 17, 11, 18, 1, 11, 33, 12424 }, // њ
+    { 12, 16, 13, 0, 16, 32, 12457 }, // ћ
+    { 12, 17, 12, 1, 17, 34, 12489 }, // ќ
+    { 11, 17, 13, 1, 17, 34, 12523 }, // ѝ
+    { 12, 21, 11, 0, 17, 42, 12557 }, // ў
+    { 10, 14, 12, 1, 11, 28, 12599 }, // џ
+    { 15, 16, 16, 0, 16, 32, 12627 }, // Ѣ
+    { 13, 16, 13, 0, 16, 32, 12659 }, // ѣ
+    { 15, 15, 17, 1, 15, 30, 12691 }, // Ѳ
+    { 12, 11, 13, 0, 11, 22, 12721 }, // ѳ
+    { 18, 15, 17, 0, 15, 45, 12743 }, // Ѵ
+    { 13, 11, 13, 0, 11, 22, 12788 }, // ѵ
+    { 16, 23, 17, 1, 19, 46, 12810 }, // Ҋ
+    { 13, 19, 13, 1, 16, 38, 12856 }, // ҋ
+    { 13, 15, 14, 0, 15, 30, 12894 }, // Ҍ
+    { 12, 11, 12, 0, 11, 22, 12924 }, // ҍ
+    { 12, 15, 14, 1, 15, 30, 12946 }, // Ҏ
+    { 11, 15, 13, 1, 11, 30, 12976 }, // ҏ
+    { 11, 18, 12, 1, 18, 36, 13006 }, // Ґ
+    { 9, 14, 10, 1, 14, 28, 13042 }, // ґ
+    { 12, 15, 13, 1, 15, 30, 13070 }, // Ғ
+    { 10, 11, 11, 1, 11, 22, 13100 }, // ғ
+    { 13, 19, 14, 1, 15, 38, 13122 }, // Ҕ
+    { 11, 15, 12, 1, 11, 30, 13160 }, // ҕ
+    { 22, 19, 21, 0, 15, 57, 13190 }, // Җ
+    { 18, 14, 18, 0, 11, 42, 13247 }, // җ
+    { 12, 20, 13, 0, 15, 40, 13289 }, // Ҙ
+    { 10, 16, 10, 0, 11, 32, 13329 }, // ҙ
+    { 15, 19, 15, 1, 15, 38, 13361 }, // Қ
+    { 12, 14, 13, 1, 11, 28, 13399 }, // қ
+    { 16, 15, 16, 1, 15, 30, 13427 }, // Ҝ
+    { 14, 11, 14, 1, 11, 22, 13457 }, // ҝ
+    { 15, 16, 15, 0, 16, 32, 13479 }, // Ҟ
+    { 13, 12, 13, 0, 12, 24, 13511 }, // ҟ
+    { 17, 15, 17, 0, 15, 45, 13535 }, // Ҡ
+    { 14, 11, 14, 0, 11, 22, 13580 }, // ҡ
+    { 16, 19, 17, 1, 15, 38, 13602 }, // Ң
+    { 12, 14, 13, 1, 11, 28, 13640 }, // ң
+    { 17, 15, 18, 1, 15, 45, 13668 }, // Ҥ
+    { 13, 11, 14, 1, 11, 22, 13713 }, // ҥ
+    { 22, 19, 23, 1, 15, 57, 13735 }, // Ҧ
+    { 17, 15, 18, 1, 11, 45, 13792 }, // ҧ
+    { 16, 19, 17, 1, 15, 38, 13837 }, // Ҩ
+    { 13, 14, 13, 0, 11, 28, 13875 }, // ҩ
+    { 13, 20, 14, 1, 15, 40, 13903 }, // Ҫ
+    { 10, 15, 11, 0, 11, 30, 13943 }, // ҫ
+    { 13, 19, 13, 0, 15, 38, 13973 }, // Ҭ
+    { 11, 14, 11, 0, 11, 28, 14011 }, // ҭ
+    { 14, 15, 14, 0, 15, 30, 14039 }, // Ү
+    { 12, 15, 12, 0, 11, 30, 14069 }, // ү
+    { 14, 15, 14, 0, 15, 30, 14099 }, // Ұ
+    { 12, 15, 12, 0, 11, 30, 14129 }, // ұ
+    { 15, 19, 15, 0, 15, 38, 14159 }, // Ҳ
+    { 12, 14, 12, 0, 11, 28, 14197 }, // ҳ
+    { 20, 19, 20, 0, 15, 57, 14225 }, // Ҵ
+    { 15, 14, 15, 0, 11, 28, 14282 }, // ҵ
+    { 14, 19, 15, 1, 15, 38, 14310 }, // Ҷ
+    { 13, 14, 12, 0, 11, 28, 14348 }, // ҷ
+    { 12, 15, 14, 1, 15, 30, 14376 }, // Ҹ
+    { 11, 11, 12, 0, 11, 22, 14406 }, // ҹ
+    { 13, 15, 15, 1, 15, 30, 14428 }, // Һ
+    { 10, 16, 12, 1, 16, 32, 14458 }, // һ
+    { 18, 15, 18, 0, 15, 45, 14490 }, // Ҽ
+    { 14, 11, 15, 0, 11, 22, 14535 }, // ҽ
+    { 18, 19, 18, 0, 15, 57, 14557 }, // Ҿ
+    { 14, 14, 15, 0, 11, 28, 14614 }, // ҿ
+    { 4, 15, 7, 1, 15, 15, 14642 }, // Ӏ
+    { 21, 20, 21, 0, 20, 60, 14657 }, // Ӂ
+    { 18, 17, 18, 0, 17, 51, 14717 }, // ӂ
+    { 13, 19, 15, 1, 15, 38, 14768 }, // Ӄ
+    { 11, 15, 12, 1, 11, 30, 14806 }, // ӄ
+    { 18, 19, 17, 0, 15, 57, 14836 }, // Ӆ
+    { 14, 14, 14, 0, 11, 28, 14893 }, // ӆ
+    { 13, 19, 15, 1, 15, 38, 14921 }, // Ӈ
+    { 11, 15, 13, 1, 11, 30, 14959 }, // ӈ
+    { 16, 19, 17, 1, 15, 38, 14989 }, // Ӊ
+    { 12, 14, 13, 1, 11, 28, 15027 }, // ӊ
+    { 13, 19, 14, 0, 15, 38, 15055 }, // Ӌ
+    { 11, 14, 12, 0, 11, 28, 15093 }, // ӌ
+    { 19, 19, 20, 1, 15, 57, 15121 }, // Ӎ
+    { 16, 14, 17, 1, 11, 28, 15178 }, // ӎ
+    { 4, 15, 6, 1, 15, 15, 15206 }, // ӏ
+    { 15, 20, 15, 0, 20, 40, 15221 }, // Ӑ
+    { 11, 17, 12, 0, 17, 34, 15261 }, // ӑ
+    { 15, 19, 15, 0, 19, 38, 15295 }, // Ӓ
+    { 11, 16, 12, 0, 16, 32, 15333 }, // ӓ
+    { 21, 15, 21, 0, 15, 45, 15365 }, // Ӕ
+    { 18, 11, 18, 0, 11, 33, 15410 }, // ӕ
+    { 11, 20, 13, 1, 20, 40, 15443 }, // Ӗ
+    { 12, 17, 12, 0, 17, 34, 15483 }, // ӗ
+    { 14, 15, 15, 1, 15, 30, 15517 }, // Ә
+    { 12, 11, 12, 0, 11, 22, 15547 }, // ә
+    { 14, 19, 15, 1, 19, 38, 15569 }, // Ӛ
+    { 12, 16, 12, 0, 16, 32, 15607 }, // ӛ
+    { 21, 19, 21, 0, 19, 57, 15639 }, // Ӝ
+    { 18, 16, 18, 0, 16, 48, 15696 }, // ӝ
+    { 12, 20, 13, 0, 20, 40, 15744 }, // Ӟ
+    { 10, 16, 10, 0, 16, 32, 15784 }, // ӟ
+    { 12, 15, 13, 0, 15, 30, 15816 }, // Ӡ
+    { 10, 15, 11, 0, 11, 30, 15846 }, // ӡ
+    { 14, 18, 16, 1, 18, 36, 15876 }, // Ӣ
+    { 11, 15, 13, 1, 15, 30, 15912 }, // ӣ
+    { 14, 19, 16, 1, 19, 38, 15942 }, // Ӥ
+    { 11, 16, 13, 1, 16, 32, 15980 }, // ӥ
+    { 15, 19, 17, 1, 19, 38, 16012 }, // Ӧ
+    { 12, 16, 13, 0, 16, 32, 16050 }, // ӧ
+    { 15, 15, 17, 1, 15, 30, 16082 }, // Ө
+    { 12, 11, 13, 0, 11, 22, 16112 }, // ө
+    { 15, 19, 17, 1, 19, 38, 16134 }, // Ӫ
+    { 12, 16, 13, 0, 16, 32, 16172 }, // ӫ
+    { 14, 19, 14, 0, 19, 38, 16204 }, // Ӭ
+    { 11, 16, 11, 0, 16, 32, 16242 }, // ӭ
+    { 14, 18, 14, 0, 18, 36, 16274 }, // Ӯ
+    { 12, 19, 11, 0, 15, 38, 16310 }, // ӯ
+    { 14, 19, 14, 0, 19, 38, 16348 }, // Ӱ
+    { 12, 20, 11, 0, 16, 40, 16386 }, // ӱ
+    { 14, 21, 14, 0, 21, 42, 16426 }, // Ӳ
+    { 12, 21, 11, 0, 17, 42, 16468 }, // ӳ
+    { 13, 19, 14, 0, 19, 38, 16510 }, // Ӵ
+    { 11, 16, 12, 0, 16, 32, 16548 }, // ӵ
+    { 11, 19, 12, 1, 15, 38, 16580 }, // Ӷ
+    { 9, 14, 10, 1, 11, 28, 16618 }, // ӷ
+    { 17, 19, 19, 1, 19, 57, 16646 }, // Ӹ
+    { 15, 16, 17, 1, 16, 32, 16703 }, // ӹ
+    { 11, 3, 11, 0, 8, 6, 16735 }, // –
+    { 21, 3, 21, 0, 8, 9, 16741 }, // —
+    { 21, 3, 21, 0, 8, 9, 16750 }, // ―
+    { 5, 6, 5, 0, 16, 6, 16759 }, // ‘
+    { 5, 6, 5, 0, 16, 6, 16765 }, // ’
+    { 5, 6, 5, 0, 3, 6, 16771 }, // ‚
+    { 10, 6, 10, 0, 16, 12, 16777 }, // “
+    { 9, 6, 10, 0, 16, 12, 16789 }, // ”
+    { 9, 6, 10, 0, 3, 12, 16801 }, // „
+    { 10, 18, 10, 0, 15, 36, 16813 }, // †
+    { 10, 18, 10, 0, 15, 36, 16849 }, // ‡
+    { 7, 6, 8, 0, 10, 6, 16885 }, // •
+    { 19, 4, 21, 1, 4, 12, 16891 }, // …
+    { 27, 15, 28, 0, 15, 60, 16903 }, // ‰
+    { 7, 11, 7, 0, 11, 11, 16963 }, // ‹
+    { 7, 11, 7, 0, 11, 11, 16974 }, // ›
+    { 11, 15, 3, -4, 15, 30, 16985 }, // ⁄
+    { 8, 9, 8, 0, 15, 9, 17015 }, // ⁰
+    { 8, 8, 8, 0, 15, 8, 17024 }, // ⁴
+    { 7, 9, 8, 0, 15, 9, 17032 }, // ⁵
+    { 8, 9, 8, 0, 15, 9, 17041 }, // ⁶
+    { 8, 8, 8, 0, 15, 8, 17050 }, // ⁷
+    { 8, 9, 8, 0, 15, 9, 17058 }, // ⁸
+    { 8, 9, 8, 0, 15, 9, 17067 }, // ⁹
+    { 8, 9, 8, 0, 9, 9, 17076 }, // ₀
+    { 6, 9, 8, 0, 9, 9, 17085 }, // ₁
+    { 7, 9, 8, 0, 9, 9, 17094 }, // ₂
+    { 7, 9, 8, 0, 9, 9, 17103 }, // ₃
+    { 8, 8, 8, 0, 9, 8, 17112 }, // ₄
+    { 7, 9, 8, 0, 9, 9, 17120 }, // ₅
+    { 8, 9, 8, 0, 9, 9, 17129 }, // ₆
+    { 8, 8, 8, 0, 9, 8, 17138 }, // ₇
+    { 8, 9, 8, 0, 9, 9, 17146 }, // ₈
+    { 8, 9, 8, 0, 9, 9, 17155 }, // ₉
+    { 12, 15, 12, 0, 15, 30, 17164 }, // €
+    { 12, 15, 12, 0, 15, 30, 17194 }, // ₮
+    { 12, 15, 12, 0, 15, 30, 17224 }, // ₴
+    { 13, 15, 12, 0, 15, 30, 17254 }, // ₹
+    { 12, 15, 13, 0, 15, 30, 17284 }, // ∂
+    { 15, 15, 15, 0, 15, 30, 17314 }, // ∆
+    { 13, 17, 15, 1, 15, 34, 17344 }, // ∏
+    { 11, 17, 11, 0, 15, 34, 17378 }, // ∑
+    { 10, 3, 12, 1, 8, 6, 17412 }, // −
+    { 11, 15, 3, -4, 15, 30, 17418 }, // ∕
+    { 5, 4, 5, 0, 9, 4, 17448 }, // ∙
+    { 14, 15, 13, 0, 15, 30, 17452 }, // √
+    { 13, 7, 13, 0, 10, 14, 17482 }, // ∞
+    { 9, 21, 8, 0, 16, 42, 17496 }, // ∫
+    { 12, 11, 12, 0, 12, 22, 17538 }, // ≈
+    { 10, 14, 12, 1, 14, 28, 17560 }, // ≠
+    { 10, 13, 12, 1, 13, 26, 17588 }, // ≤
+    { 10, 13, 12, 1, 13, 26, 17614 }, // ≥
 };
 
 static const EpdUnicodeInterval ubuntu_10_boldIntervals[] = {
@@ -1513,6 +1749,19 @@ static const EpdUnicodeInterval ubuntu_10_boldIntervals[] = {
     { 0x2264, 0x2265, 0x24D },
 };
 
+static const EpdFontMetrics ubuntu_10_boldMetrics = {
+    11, 28, 5,
+    -4, 27, 21, -5,
+    {
+        5, 6, 10, 15, 12, 19, 15, 5, 7, 7, 11, 12, 5, 7, 5, 9,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 12, 12, 12, 10,
+        20, 15, 14, 14, 15, 13, 12, 15, 15, 7, 11, 14, 12, 19, 16, 17,
+        14, 17, 14, 12, 13, 15, 15, 20, 14, 14, 13, 8, 9, 8, 12, 11,
+        6, 12, 13, 11, 13, 12, 9, 12, 12, 6, 6, 12, 7, 18, 12, 13,
+        13, 13, 9, 10, 9, 12, 12, 16, 12, 11, 11, 8, 7, 8, 12,
+    },
+};
+
 static const EpdFontData ubuntu_10_bold = {
     ubuntu_10_boldBitmaps,
     ubuntu_10_boldGlyphs,
@@ -1522,4 +1771,9 @@ static const EpdFontData ubuntu_10_bold = {
     20,
     -4,
     false,
+    nullptr,
+    &ubuntu_10_boldMetrics,
+    nullptr,
+    0,
+    true,
 };
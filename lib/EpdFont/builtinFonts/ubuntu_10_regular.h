@@ -2,794 +2,1054 @@
  * generated by fontconvert.py
  * name: ubuntu_10_regular
  * size: 10
- * mode: 1-bit
- * Command used: fontconvert.py ubuntu_10_regular 10 ../builtinFonts/source/Ubuntu/Ubuntu-Regular.ttf
+ * mode: 1-bit, row-aligned
+ * Command used: fontconvert.py ubuntu_10_regular 10 ../builtinFonts/source/Ubuntu/Ubuntu-Regular.ttf --row-aligned --no-kerning
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t ubuntu_10_regularBitmaps[12484] = {
-    0xEE, 0xEE, 0xE6, 0x66, 0x66, 0x00, 0xEF, 0xE0, 0xEF, 0xDF, 0xBF, 0x6E, 0xC0, 0x1C, 0x61, 0xCE,
-    0x1C, 0xE1, 0x8E, 0xFF, 0xFF, 0xFF, 0x38, 0xC3, 0x9C, 0x31, 0xCF, 0xFF, 0xFF, 0xF7, 0x18, 0x73,
-    0x87, 0x38, 0x63, 0x80, 0x0C, 0x03, 0x03, 0xF9, 0xFE, 0xF1, 0xB8, 0x0E, 0x01, 0xE0, 0x7E, 0x07,
-    0xE0, 0x78, 0x07, 0x01, 0xF8, 0xFF, 0xFB, 0xFC, 0x0C, 0x03, 0x00, 0xC0, 0x7C, 0x38, 0xEE, 0x38,
-    0xC6, 0x70, 0xC6, 0x70, 0xC6, 0xE0, 0xEE, 0xC0, 0x7D, 0xC0, 0x01, 0x80, 0x03, 0xBE, 0x03, 0x77,
-    0x07, 0x63, 0x0E, 0x63, 0x0E, 0x63, 0x1C, 0x77, 0x1C, 0x3E, 0x0F, 0x80, 0x7F, 0x03, 0xDC, 0x0E,
-    0x30, 0x39, 0xC0, 0x6E, 0x01, 0xF8, 0x07, 0x80, 0x3F, 0x19, 0xCE, 0xE6, 0x1F, 0x18, 0x3C, 0x78,
-    0xF1, 0xFF, 0xE3, 0xF9, 0xC0, 0xFF, 0xFE, 0x1C, 0x73, 0x8C, 0x71, 0xC6, 0x38, 0xE3, 0x8E, 0x38,
-    0xE1, 0x87, 0x1C, 0x30, 0xE1, 0xC7, 0xC3, 0x87, 0x1C, 0x38, 0xE3, 0x86, 0x18, 0x71, 0xC6, 0x18,
-    0xE3, 0x8E, 0x71, 0xCE, 0x30, 0x0C, 0x03, 0x06, 0xD9, 0xFE, 0x1E, 0x07, 0x83, 0xF0, 0xCC, 0x0C,
-    0x03, 0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xF0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0x77, 0x76, 0x60, 0xFF,
-    0xF0, 0xFF, 0x80, 0x01, 0xC0, 0x60, 0x38, 0x0E, 0x03, 0x01, 0xC0, 0x70, 0x18, 0x0E, 0x03, 0x81,
-    0xC0, 0x70, 0x1C, 0x0E, 0x03, 0x80, 0xC0, 0x70, 0x1C, 0x06, 0x03, 0x80, 0x3F, 0x1F, 0xE7, 0x3B,
-    0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x07, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0x73, 0x9F, 0xE3, 0xF0, 0x0E,
-    0x3D, 0xFB, 0xF7, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x80, 0x7E, 0x3F, 0xCE,
-    0x78, 0x0E, 0x03, 0x80, 0xE0, 0x70, 0x3C, 0x1E, 0x0F, 0x03, 0x81, 0xC0, 0xE0, 0x3F, 0xFF, 0xFC,
-    0x7E, 0x3F, 0xC6, 0x78, 0x0E, 0x03, 0x81, 0xE3, 0xF0, 0xFC, 0x07, 0x80, 0x60, 0x1C, 0x07, 0xC7,
-    0xBF, 0xEF, 0xE0, 0x03, 0xC0, 0x78, 0x1F, 0x07, 0xE1, 0xDC, 0x3B, 0x8E, 0x73, 0x8E, 0x61, 0xDF,
-    0xFF, 0xFF, 0x80, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x7F, 0x9F, 0xE7, 0x01, 0xC0, 0x70, 0x1F, 0x87,
-    0xF0, 0x7E, 0x03, 0x80, 0x70, 0x1C, 0x07, 0xE7, 0xBF, 0xEF, 0xE0, 0x07, 0x87, 0xE3, 0xF1, 0xC0,
-    0x60, 0x3F, 0xCF, 0xFB, 0xCF, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0x73, 0xDF, 0xE3, 0xF0, 0xFF, 0xFF,
-    0xF0, 0x1C, 0x0E, 0x07, 0x01, 0xC0, 0xE0, 0x38, 0x0C, 0x07, 0x01, 0xC0, 0x60, 0x38, 0x0E, 0x03,
-    0x80, 0x3F, 0x1F, 0xEF, 0x3B, 0x87, 0xE1, 0xFC, 0xE7, 0xF8, 0xFC, 0x7F, 0xB8, 0xFE, 0x1F, 0x87,
-    0xF3, 0xDF, 0xE3, 0xF0, 0x3F, 0x1F, 0xEF, 0x7B, 0x87, 0xE1, 0xF8, 0x7F, 0x3D, 0xFF, 0x3F, 0xC0,
-    0x60, 0x38, 0x1E, 0x1F, 0x1F, 0x87, 0x80, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x77, 0x70, 0x00, 0x00,
-    0x07, 0x77, 0x66, 0x01, 0xC3, 0xF7, 0xFB, 0xF0, 0xF0, 0x3F, 0x07, 0xF8, 0x3F, 0x01, 0xC0, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0xE0, 0x3F, 0x07, 0xF8, 0x3F, 0x03, 0xC3, 0xF7,
-    0xFB, 0xF0, 0xE0, 0x00, 0xFE, 0xFF, 0x6F, 0x07, 0x07, 0x06, 0x0E, 0x1C, 0x38, 0x38, 0x00, 0x00,
-    0x38, 0x38, 0x38, 0x07, 0xF8, 0x03, 0xFF, 0x81, 0xF3, 0xF0, 0xE0, 0x1C, 0x70, 0x03, 0x9C, 0x7E,
-    0x6E, 0x7F, 0x9F, 0x9E, 0xE7, 0xE6, 0x19, 0xFB, 0x86, 0x7E, 0xE1, 0x9F, 0xB8, 0x67, 0xE7, 0xBB,
-    0xB9, 0xFF, 0xE7, 0x3F, 0xF1, 0xC0, 0x00, 0x38, 0x00, 0x07, 0xC6, 0x00, 0xFF, 0x80, 0x1F, 0xE0,
-    0x07, 0x00, 0x1E, 0x00, 0x78, 0x03, 0xF0, 0x0D, 0xC0, 0x73, 0x01, 0xCE, 0x06, 0x18, 0x38, 0x70,
-    0xFF, 0xC7, 0xFF, 0x1C, 0x0E, 0x60, 0x3B, 0x80, 0x7E, 0x01, 0xC0, 0x7F, 0x8F, 0xFC, 0xE3, 0xEE,
-    0x0E, 0xE0, 0xEE, 0x3E, 0xFF, 0xCF, 0xFE, 0xE1, 0xEE, 0x07, 0xE0, 0x7E, 0x07, 0xE1, 0xEF, 0xFE,
-    0x7F, 0x80, 0x0F, 0xE3, 0xFF, 0x7C, 0x67, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E,
-    0x00, 0xE0, 0x07, 0x00, 0x7C, 0x63, 0xFF, 0x0F, 0xE0, 0x7F, 0x87, 0xFF, 0x38, 0xFD, 0xC0, 0xEE,
-    0x07, 0xF0, 0x1F, 0x80, 0xFC, 0x07, 0xE0, 0x3F, 0x01, 0xF8, 0x0F, 0xC0, 0xEE, 0x3F, 0x7F, 0xF1,
-    0xFE, 0x00, 0xFF, 0xDF, 0xFB, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x3F, 0xE7, 0xFC, 0xE0, 0x1C, 0x03,
-    0x80, 0x70, 0x0E, 0x01, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFE, 0x03, 0x80, 0xE0, 0x38, 0x0F, 0xFB,
-    0xFE, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x00, 0x0F, 0xE3, 0xFF, 0x7C, 0x77, 0x00,
-    0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x7E, 0x07, 0xE0, 0x77, 0x07, 0x7C, 0x73, 0xFF, 0x0F,
-    0xF0, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x3E, 0x03,
-    0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0x81,
-    0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x7E, 0x7F, 0xF9, 0xF8, 0xE0,
-    0xF7, 0x07, 0x38, 0x71, 0xC7, 0x0E, 0x70, 0x77, 0x03, 0xF0, 0x1F, 0x80, 0xFE, 0x07, 0x78, 0x39,
-    0xE1, 0xC7, 0x8E, 0x1E, 0x70, 0x7B, 0x81, 0xC0, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E,
-    0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x3F, 0xFF, 0xFC, 0x70, 0x0E, 0x70, 0x0E, 0x78,
-    0x1E, 0x78, 0x1F, 0x6C, 0x3F, 0x6C, 0x37, 0x66, 0x37, 0xE6, 0x67, 0xE7, 0x67, 0xE3, 0xE7, 0xE3,
-    0xC7, 0xE3, 0xC7, 0xE1, 0xC7, 0xE0, 0x07, 0xE0, 0x03, 0xE0, 0x3F, 0x81, 0xFE, 0x0F, 0xF8, 0x7F,
-    0xC3, 0xF7, 0x1F, 0x9C, 0xFC, 0x77, 0xE3, 0xBF, 0x0F, 0xF8, 0x3F, 0xC1, 0xFE, 0x07, 0xF0, 0x3F,
-    0x80, 0xE0, 0x0F, 0xE0, 0x7F, 0xE1, 0xF3, 0xE3, 0x81, 0xEE, 0x01, 0xDC, 0x03, 0xB8, 0x07, 0x70,
-    0x06, 0xE0, 0x1D, 0xC0, 0x3B, 0x80, 0x73, 0x81, 0xE7, 0xCF, 0x87, 0xFE, 0x03, 0xF8, 0x00, 0x7F,
-    0x8F, 0xFC, 0xE3, 0xEE, 0x0E, 0xE0, 0xEE, 0x0E, 0xE3, 0xEF, 0xFC, 0xFF, 0x8E, 0x00, 0xE0, 0x0E,
-    0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x00, 0x0F, 0xE0, 0x7F, 0xE1, 0xF3, 0xE3, 0x81, 0xEE, 0x01, 0xDC,
-    0x03, 0xB8, 0x07, 0x70, 0x06, 0xE0, 0x1D, 0xC0, 0x3B, 0x80, 0x73, 0x81, 0xE7, 0xCF, 0x87, 0xFE,
-    0x03, 0xF8, 0x01, 0xC0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xE0, 0x7F, 0x8F, 0xFC, 0xE3, 0xEE, 0x0E,
-    0xE0, 0xEE, 0x0E, 0xE3, 0xEF, 0xFC, 0xFF, 0x8E, 0x38, 0xE3, 0xCE, 0x1C, 0xE0, 0xEE, 0x0E, 0xE0,
-    0x70, 0x1F, 0xCF, 0xF9, 0xE7, 0x38, 0x07, 0x00, 0xE0, 0x1F, 0x80, 0xFC, 0x07, 0xC0, 0x3C, 0x03,
-    0x80, 0x77, 0x3F, 0xFF, 0x9F, 0xE0, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06,
-    0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0xE0, 0x7E, 0x07,
-    0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x77, 0x07, 0x79,
-    0xE3, 0xFE, 0x1F, 0xC0, 0xE0, 0x1F, 0x80, 0xE7, 0x03, 0x9C, 0x0E, 0x70, 0x70, 0xE1, 0xC3, 0x87,
-    0x0E, 0x38, 0x1C, 0xE0, 0x73, 0x80, 0xFC, 0x03, 0xF0, 0x0F, 0x80, 0x1E, 0x00, 0x70, 0x00, 0xE0,
-    0x00, 0xFC, 0x00, 0x1D, 0xC3, 0x83, 0xB8, 0x78, 0x77, 0x0F, 0x0C, 0xE3, 0xE3, 0x9C, 0x7E, 0x71,
-    0xCD, 0xCE, 0x3B, 0x99, 0xC7, 0x73, 0xB0, 0xEC, 0x7E, 0x0F, 0x87, 0xC1, 0xF0, 0xF8, 0x3C, 0x1E,
-    0x03, 0x81, 0xC0, 0x70, 0x7B, 0x83, 0x8E, 0x38, 0x3B, 0xC1, 0xDC, 0x07, 0xC0, 0x1E, 0x00, 0xE0,
-    0x0F, 0x80, 0x7E, 0x07, 0x70, 0x71, 0xC3, 0x87, 0x38, 0x3B, 0x80, 0xE0, 0xE0, 0x3B, 0x83, 0x9C,
-    0x38, 0x71, 0xC3, 0x9C, 0x0E, 0xE0, 0x7E, 0x01, 0xF0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00,
-    0x70, 0x03, 0x80, 0x1C, 0x00, 0x7F, 0xE7, 0xFE, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x78, 0x07, 0x00,
-    0xE0, 0x1C, 0x01, 0xC0, 0x38, 0x07, 0x00, 0x70, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0xF1, 0x8C, 0x63,
-    0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x3F, 0xF0, 0xE0, 0x18, 0x07, 0x01, 0xC0, 0x30, 0x0E,
-    0x03, 0x80, 0x60, 0x1C, 0x07, 0x00, 0xE0, 0x38, 0x06, 0x01, 0xC0, 0x70, 0x0C, 0x03, 0x80, 0xE0,
-    0x18, 0x07, 0xFF, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xFF, 0xF0, 0x0E,
-    0x01, 0xE0, 0x7E, 0x0D, 0xC3, 0x9C, 0x63, 0x9C, 0x3B, 0x03, 0x7F, 0xF7, 0xFF, 0xC7, 0x1C, 0x60,
-    0x3F, 0x0F, 0xE3, 0x3C, 0x07, 0x3F, 0xDF, 0xF7, 0x9D, 0x87, 0x71, 0xDF, 0xF3, 0xFC, 0xE0, 0x1C,
-    0x03, 0x80, 0x70, 0x0E, 0x01, 0xFE, 0x3F, 0xE7, 0x9E, 0xE1, 0xDC, 0x1F, 0x83, 0xF0, 0x7E, 0x1D,
-    0xC7, 0xBF, 0xE7, 0xF8, 0x3F, 0x3F, 0xBE, 0x5C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xF9, 0x3F, 0xCF,
-    0xE0, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xCF, 0xF7, 0xFF, 0xCF, 0xE1, 0xF8, 0x7E, 0x1F, 0x87,
-    0xE1, 0xFE, 0x77, 0xFC, 0xFF, 0x3F, 0x1F, 0xEF, 0x3F, 0x87, 0xFF, 0xFF, 0xFE, 0x03, 0x80, 0xF9,
-    0x9F, 0xE3, 0xF8, 0x3F, 0x7E, 0x72, 0xE0, 0xE0, 0xFE, 0xFE, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-    0xE0, 0xE0, 0xE0, 0x3F, 0xDF, 0xFF, 0x9F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xF3, 0xDF, 0xF3,
-    0xFC, 0x07, 0x63, 0xBF, 0xEF, 0xF0, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x3F, 0xCF, 0xFB, 0xCF,
-    0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x1C, 0x70, 0x00, 0x00, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0xFF, 0xBE, 0xE0,
-    0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0xEE, 0x73, 0xBC, 0xEE, 0x3F, 0x0F, 0x83, 0xF0, 0xEE, 0x39,
-    0xCE, 0x3B, 0x87, 0xE7, 0x39, 0xCE, 0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x79, 0xEE, 0xFF, 0xFC, 0xFF,
-    0xFE, 0xE7, 0xCF, 0xE3, 0x87, 0xE1, 0x87, 0xE1, 0x87, 0xE1, 0x87, 0xE1, 0x87, 0xE1, 0x87, 0xE1,
-    0x87, 0xE1, 0x87, 0xFF, 0x3F, 0xEE, 0x3F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E,
-    0x1C, 0x3F, 0x0F, 0xF3, 0xEF, 0x70, 0xEE, 0x0F, 0xC1, 0xF8, 0x3F, 0x0E, 0xF3, 0xCF, 0xF0, 0xFC,
-    0x00, 0xFF, 0x1F, 0xF3, 0x8F, 0x70, 0xEE, 0x0F, 0xC1, 0xF8, 0x3F, 0x0E, 0xF3, 0xDF, 0xF3, 0xFC,
-    0x70, 0x0E, 0x01, 0xC0, 0x38, 0x00, 0x3F, 0xDF, 0xFF, 0x9F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87,
-    0xF3, 0xDF, 0xF3, 0xFC, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x7F, 0xFF, 0x8F, 0x0E, 0x1C, 0x38, 0x70,
-    0xE1, 0xC3, 0x80, 0x3F, 0x3F, 0x9C, 0xCE, 0x07, 0xC1, 0xF8, 0x3E, 0x07, 0x47, 0xBF, 0xDF, 0xC0,
-    0xE0, 0xE0, 0xE0, 0xFE, 0xFE, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF2, 0x7E, 0x7E, 0xE1, 0xF8,
-    0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0x71, 0xDF, 0xF3, 0xFC, 0xE0, 0xDC, 0x39, 0x87,
-    0x38, 0xE7, 0x38, 0x67, 0x0E, 0xC0, 0xF8, 0x1F, 0x03, 0xC0, 0x38, 0x00, 0xE1, 0xC7, 0xE1, 0xC7,
-    0x63, 0xC7, 0x73, 0xC6, 0x73, 0xEE, 0x33, 0xEE, 0x3F, 0x6C, 0x3E, 0x7C, 0x1E, 0x7C, 0x1E, 0x38,
-    0x1C, 0x38, 0xE1, 0xCE, 0x70, 0xEE, 0x0F, 0x81, 0xE0, 0x1C, 0x07, 0xC1, 0xF8, 0x73, 0x8E, 0x3B,
-    0x83, 0x00, 0xE0, 0xDC, 0x39, 0xC7, 0x38, 0xC7, 0x18, 0x77, 0x0E, 0xE0, 0xD8, 0x1F, 0x01, 0xC0,
-    0x38, 0x07, 0x01, 0xC1, 0xF8, 0x3E, 0x00, 0x7F, 0x9F, 0xE0, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81,
-    0xE0, 0x70, 0x3F, 0xEF, 0xF8, 0x0E, 0x3C, 0x71, 0xC3, 0x87, 0x0E, 0x1C, 0x79, 0xE3, 0xE3, 0xC3,
-    0x87, 0x0E, 0x1C, 0x38, 0x38, 0x78, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE1, 0xC1, 0xC3,
-    0x87, 0x0E, 0x1C, 0x3C, 0x3C, 0xF9, 0xE3, 0x87, 0x0E, 0x1C, 0x38, 0xE3, 0xC7, 0x00, 0x3C, 0x6F,
-    0xFD, 0xBF, 0xB1, 0xE0, 0xEF, 0xE0, 0x06, 0x66, 0x66, 0xEE, 0xEE, 0xE0, 0x0E, 0x03, 0x80, 0xE0,
-    0x7E, 0x3F, 0x9E, 0x67, 0x01, 0x80, 0xE0, 0x18, 0x07, 0x01, 0xE2, 0x3F, 0x87, 0xE0, 0xE0, 0x38,
-    0x0E, 0x00, 0x0F, 0xC7, 0xF3, 0xC8, 0xE0, 0x38, 0x0E, 0x03, 0x83, 0xFE, 0xFF, 0x8E, 0x03, 0x00,
-    0xC0, 0x30, 0x1F, 0xF7, 0xFC, 0x60, 0x6F, 0xFC, 0xFF, 0x1C, 0xE3, 0x0C, 0x61, 0x8E, 0x71, 0xFE,
-    0x7F, 0xEC, 0x0C, 0xE0, 0x77, 0x0E, 0x70, 0xE3, 0x9C, 0x1B, 0x81, 0xF8, 0x0F, 0x07, 0xFE, 0x7F,
-    0xE0, 0x60, 0x06, 0x07, 0xFE, 0x7F, 0xE0, 0x60, 0x06, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x1F,
-    0x8F, 0xE7, 0x99, 0xC0, 0x38, 0x0F, 0x87, 0xF9, 0x8F, 0x61, 0xD8, 0x77, 0x98, 0xFE, 0x1F, 0x00,
-    0xE0, 0x19, 0x8E, 0x7F, 0x9F, 0xC0, 0x66, 0x66, 0x0F, 0xE0, 0x3F, 0xF0, 0xF1, 0xE3, 0x80, 0xE6,
-    0x7E, 0xFD, 0xC9, 0xF3, 0x01, 0xEE, 0x03, 0xCC, 0x07, 0xDC, 0x9D, 0x9F, 0xBB, 0x80, 0xE3, 0xC7,
-    0x83, 0xFF, 0x03, 0xF8, 0x00, 0x7C, 0x2E, 0x06, 0x7E, 0x66, 0xE6, 0x66, 0x7E, 0x19, 0xCE, 0x73,
-    0xB9, 0xDC, 0xE7, 0x1D, 0xC3, 0xB8, 0xE7, 0x19, 0xC0, 0xFF, 0xFF, 0xF0, 0x0C, 0x03, 0x00, 0xC0,
-    0x30, 0x0C, 0x03, 0xFF, 0xF0, 0x0F, 0xE0, 0x3F, 0xF0, 0xF1, 0xE3, 0x80, 0xE6, 0xFC, 0xFD, 0x9D,
-    0xF3, 0x39, 0xE7, 0xE3, 0xCD, 0xC7, 0xD9, 0xDD, 0xB1, 0xBB, 0x80, 0xE3, 0xC7, 0x83, 0xFF, 0x03,
-    0xF8, 0x00, 0x7E, 0xFC, 0x7C, 0xFB, 0xBF, 0x77, 0xCF, 0x80, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0xFF,
-    0xFF, 0xF0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x7C, 0xD8, 0x38, 0xE3, 0xCF,
-    0x18, 0x3F, 0x7C, 0xD8, 0x31, 0xE0, 0xE0, 0xD3, 0xFE, 0x39, 0xDC, 0xC0, 0xE1, 0xF8, 0x7E, 0x1F,
-    0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xF9, 0xFF, 0xFF, 0xFF, 0x80, 0xE0, 0x38, 0x0E, 0x00, 0x1F,
-    0xF3, 0xF7, 0x7F, 0x77, 0xF7, 0x7F, 0x77, 0xF7, 0x7F, 0x77, 0xF7, 0x3F, 0x70, 0xF7, 0x07, 0x70,
-    0x77, 0x07, 0x70, 0x77, 0x07, 0x70, 0x77, 0x07, 0x70, 0x77, 0x07, 0x70, 0xFF, 0x80, 0x33, 0x8F,
-    0xE0, 0x3F, 0xF3, 0x33, 0x33, 0x3E, 0x3B, 0x98, 0xEC, 0x76, 0x3B, 0x1D, 0xDC, 0x7C, 0x66, 0x1D,
-    0xC3, 0x38, 0xE7, 0x1D, 0xCE, 0x73, 0x39, 0xDC, 0x66, 0x00, 0x30, 0x18, 0x78, 0x1C, 0x3C, 0x0C,
-    0x06, 0x0E, 0x03, 0x0E, 0x01, 0x87, 0x00, 0xC7, 0x00, 0x63, 0x0E, 0x03, 0x87, 0x01, 0x87, 0x81,
-    0xC6, 0xC0, 0xC7, 0x60, 0xE3, 0xF8, 0x60, 0x18, 0x70, 0x0C, 0x30, 0x38, 0x78, 0x18, 0x3C, 0x1C,
-    0x06, 0x0C, 0x03, 0x0E, 0x01, 0x8E, 0x00, 0xC7, 0x00, 0x67, 0x3E, 0x03, 0x3B, 0x03, 0x81, 0x81,
-    0x81, 0xC1, 0xC1, 0xC0, 0xC1, 0xC0, 0xE0, 0xC0, 0x60, 0xFE, 0x7C, 0x0E, 0x1B, 0x07, 0x00, 0xC1,
-    0xC0, 0xF0, 0xE0, 0x0E, 0x30, 0x01, 0x9C, 0x04, 0xE6, 0x03, 0xF3, 0x8E, 0x00, 0xC3, 0x80, 0x71,
-    0xE0, 0x38, 0xD8, 0x0E, 0x76, 0x07, 0x1F, 0xC1, 0x80, 0x60, 0xE0, 0x18, 0x1C, 0x0F, 0x07, 0x00,
-    0x00, 0x00, 0x60, 0x30, 0x38, 0x38, 0x38, 0x18, 0x1C, 0x0F, 0x33, 0xF8, 0xFC, 0x06, 0x00, 0x3C,
-    0x00, 0x70, 0x00, 0xC0, 0x00, 0x00, 0x1C, 0x00, 0x78, 0x01, 0xE0, 0x0F, 0xC0, 0x37, 0x01, 0xCC,
-    0x07, 0x38, 0x18, 0x60, 0xE1, 0xC3, 0xFF, 0x1F, 0xFC, 0x70, 0x39, 0x80, 0xEE, 0x01, 0xF8, 0x07,
-    0x01, 0xC0, 0x07, 0x00, 0x38, 0x00, 0xC0, 0x00, 0x00, 0x1C, 0x00, 0x78, 0x01, 0xE0, 0x0F, 0xC0,
-    0x37, 0x01, 0xCC, 0x07, 0x38, 0x18, 0x60, 0xE1, 0xC3, 0xFF, 0x1F, 0xFC, 0x70, 0x39, 0x80, 0xEE,
-    0x01, 0xF8, 0x07, 0x03, 0x00, 0x1E, 0x00, 0xFC, 0x03, 0x30, 0x00, 0x00, 0x1C, 0x00, 0x78, 0x01,
-    0xE0, 0x0F, 0xC0, 0x37, 0x01, 0xCC, 0x07, 0x38, 0x18, 0x60, 0xE1, 0xC3, 0xFF, 0x1F, 0xFC, 0x70,
-    0x39, 0x80, 0xEE, 0x01, 0xF8, 0x07, 0x0F, 0x60, 0x3F, 0x01, 0xBC, 0x00, 0x00, 0x07, 0x00, 0x1E,
-    0x00, 0x78, 0x03, 0xF0, 0x0D, 0xC0, 0x73, 0x01, 0xCE, 0x06, 0x18, 0x38, 0x70, 0xFF, 0xC7, 0xFF,
-    0x1C, 0x0E, 0x60, 0x3B, 0x80, 0x7E, 0x01, 0xC0, 0x0C, 0xC0, 0x33, 0x00, 0x00, 0x01, 0xC0, 0x07,
-    0x80, 0x1E, 0x00, 0xFC, 0x03, 0x70, 0x1C, 0xC0, 0x73, 0x81, 0x86, 0x0E, 0x1C, 0x3F, 0xF1, 0xFF,
-    0xC7, 0x03, 0x98, 0x0E, 0xE0, 0x1F, 0x80, 0x70, 0x07, 0x80, 0x1E, 0x00, 0xD8, 0x01, 0xE0, 0x07,
-    0x80, 0x1E, 0x00, 0xFC, 0x03, 0xF0, 0x1C, 0xC0, 0x73, 0x81, 0x8E, 0x0E, 0x1C, 0x3F, 0xF1, 0xFF,
-    0xC7, 0x03, 0x98, 0x0E, 0xE0, 0x1F, 0x80, 0x70, 0x00, 0xFF, 0xE0, 0x1F, 0xFC, 0x07, 0xC0, 0x01,
-    0xD8, 0x00, 0x3B, 0x00, 0x0E, 0x60, 0x01, 0x8F, 0xF0, 0x71, 0xFE, 0x1C, 0x30, 0x03, 0xFE, 0x00,
-    0xFF, 0xC0, 0x18, 0x18, 0x07, 0x03, 0x00, 0xC0, 0x7F, 0xF8, 0x0F, 0xF8, 0x0F, 0xE3, 0xFF, 0x7C,
-    0x67, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x07, 0x00, 0x7C, 0x63,
-    0xFF, 0x1F, 0xE0, 0x70, 0x03, 0x80, 0xF0, 0x18, 0x03, 0x80, 0x38, 0x03, 0x00, 0x01, 0xFF, 0xBF,
-    0xF7, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x7F, 0xCF, 0xF9, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03,
-    0xFF, 0xFF, 0xF0, 0x03, 0x00, 0xE0, 0x38, 0x06, 0x00, 0x01, 0xFF, 0xBF, 0xF7, 0x00, 0xE0, 0x1C,
-    0x03, 0x80, 0x7F, 0xCF, 0xF9, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0xFF, 0xFF, 0xF0, 0x0C,
-    0x03, 0xC0, 0xFC, 0x19, 0x80, 0x01, 0xFF, 0xBF, 0xF7, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x7F, 0xCF,
-    0xF9, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0xFF, 0xFF, 0xF0, 0x3B, 0x87, 0x70, 0x00, 0x7F,
-    0xEF, 0xFD, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1F, 0xF3, 0xFE, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07,
-    0x00, 0xFF, 0xFF, 0xFC, 0xC7, 0x1C, 0x60, 0x39, 0xCE, 0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x73, 0x9C,
-    0xE0, 0x33, 0xB9, 0x80, 0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x73, 0x9C, 0xE7, 0x39, 0xC0, 0x18, 0x79,
-    0xFB, 0x30, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC0,
-    0xEE, 0xEE, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x38, 0x38, 0x3F, 0xC0, 0x7F, 0xE0, 0xE3, 0xE1, 0x81, 0xC3, 0x01, 0xC6, 0x03, 0xBF, 0x87, 0x7F,
-    0x0E, 0x30, 0x1C, 0x60, 0x38, 0xC0, 0x71, 0x81, 0xC3, 0x8F, 0x87, 0xFE, 0x0F, 0xF0, 0x00, 0x0F,
-    0xC0, 0xFE, 0x06, 0xE0, 0x00, 0x0E, 0x03, 0xF8, 0x1F, 0xE0, 0xFF, 0x87, 0xFC, 0x3F, 0x71, 0xF9,
-    0xCF, 0xC7, 0x7E, 0x3B, 0xF0, 0xFF, 0x83, 0xFC, 0x1F, 0xE0, 0x7F, 0x03, 0xF8, 0x0E, 0x06, 0x00,
-    0x0E, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xFC, 0x3E, 0x7C, 0x70, 0x3D, 0xC0,
-    0x3B, 0x80, 0x77, 0x00, 0xEE, 0x00, 0xDC, 0x03, 0xB8, 0x07, 0x70, 0x0E, 0x70, 0x3C, 0xF9, 0xF0,
-    0xFF, 0xC0, 0x7F, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x0E, 0x00, 0x18, 0x00, 0x00, 0x01, 0xFC, 0x0F,
-    0xFC, 0x3E, 0x7C, 0x70, 0x3D, 0xC0, 0x3B, 0x80, 0x77, 0x00, 0xEE, 0x00, 0xDC, 0x03, 0xB8, 0x07,
-    0x70, 0x0E, 0x70, 0x3C, 0xF9, 0xF0, 0xFF, 0xC0, 0x7F, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x3F, 0x00,
-    0x66, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xFC, 0x3E, 0x7C, 0x70, 0x3D, 0xC0, 0x3B, 0x80, 0x77, 0x00,
-    0xEE, 0x00, 0xDC, 0x03, 0xB8, 0x07, 0x70, 0x0E, 0x70, 0x3C, 0xF9, 0xF0, 0xFF, 0xC0, 0x7F, 0x00,
-    0x0F, 0x60, 0x1F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0x07, 0xFE, 0x1F, 0x3E, 0x38, 0x1E, 0xE0,
-    0x1D, 0xC0, 0x3B, 0x80, 0x77, 0x00, 0x6E, 0x01, 0xDC, 0x03, 0xB8, 0x07, 0x38, 0x1E, 0x7C, 0xF8,
-    0x7F, 0xE0, 0x3F, 0x80, 0x0E, 0xE0, 0x1D, 0xC0, 0x00, 0x00, 0x7F, 0x03, 0xFF, 0x0F, 0x9F, 0x1C,
-    0x0F, 0x70, 0x0E, 0xE0, 0x1D, 0xC0, 0x3B, 0x80, 0x37, 0x00, 0xEE, 0x01, 0xDC, 0x03, 0x9C, 0x0F,
-    0x3E, 0x7C, 0x3F, 0xF0, 0x1F, 0xC0, 0x41, 0x18, 0xE7, 0xF8, 0xFC, 0x1E, 0x0F, 0xC7, 0xF9, 0x8E,
-    0x41, 0x00, 0x0F, 0xFC, 0x7F, 0xF9, 0xF3, 0xE3, 0x83, 0xEE, 0x0F, 0xDC, 0x3B, 0xB8, 0x77, 0x71,
-    0xC6, 0xE7, 0x0D, 0xDC, 0x3B, 0xF0, 0x73, 0xC1, 0xE7, 0xCF, 0x8F, 0xFE, 0x1B, 0xF8, 0x00, 0x0C,
-    0x00, 0xE0, 0x07, 0x00, 0x30, 0x00, 0x0E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E,
-    0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0x70, 0x77, 0x9E, 0x3F, 0xE1, 0xFC, 0x01, 0x80, 0x38,
-    0x07, 0x00, 0x60, 0x00, 0x0E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0,
-    0x7E, 0x07, 0xE0, 0x7E, 0x07, 0x70, 0x77, 0x9E, 0x3F, 0xE1, 0xFC, 0x06, 0x00, 0xF0, 0x1F, 0x81,
-    0x98, 0x00, 0x0E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07,
-    0xE0, 0x7E, 0x07, 0x70, 0x77, 0x9E, 0x3F, 0xE1, 0xFC, 0x1D, 0xC1, 0xDC, 0x00, 0x0E, 0x07, 0xE0,
-    0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0x70, 0x77,
-    0x9E, 0x3F, 0xE1, 0xFC, 0x01, 0x80, 0x1C, 0x01, 0xC0, 0x0C, 0x00, 0x00, 0x70, 0x1D, 0xC1, 0xCE,
-    0x1C, 0x38, 0xE1, 0xCE, 0x07, 0x70, 0x3F, 0x00, 0xF8, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00,
-    0x38, 0x01, 0xC0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0x8F, 0xFC, 0xE3, 0xEE, 0x0E, 0xE0, 0xEE,
-    0x0E, 0xE0, 0xEE, 0x3E, 0xFF, 0xCF, 0xF8, 0xE0, 0x0E, 0x00, 0xE0, 0x00, 0x3F, 0x07, 0xF8, 0x7B,
-    0xCE, 0x1C, 0xE1, 0x8E, 0x38, 0xE7, 0x0E, 0x60, 0xEF, 0x0E, 0x7C, 0xE3, 0xEE, 0x1E, 0xE0, 0x7E,
-    0xCF, 0xEF, 0xEE, 0xFC, 0x18, 0x07, 0x00, 0xE0, 0x18, 0x00, 0x0F, 0xC3, 0xF8, 0xCF, 0x01, 0xCF,
-    0xF7, 0xFD, 0xE7, 0x61, 0xDC, 0x77, 0xFC, 0xFF, 0x03, 0x01, 0xC0, 0xE0, 0x30, 0x00, 0x0F, 0xC3,
-    0xF8, 0xCF, 0x01, 0xCF, 0xF7, 0xFD, 0xE7, 0x61, 0xDC, 0x77, 0xFC, 0xFF, 0x04, 0x03, 0x81, 0xF0,
-    0x64, 0x00, 0x0F, 0xC3, 0xF8, 0xCF, 0x01, 0xCF, 0xF7, 0xFD, 0xE7, 0x61, 0xDC, 0x77, 0xFC, 0xFF,
-    0x1D, 0x8F, 0xE3, 0x70, 0x00, 0x00, 0x0F, 0xC3, 0xF8, 0xCF, 0x01, 0xCF, 0xF7, 0xFD, 0xE7, 0x61,
-    0xDC, 0x77, 0xFC, 0xFF, 0x3B, 0x8E, 0xE0, 0x00, 0x00, 0x3F, 0x0F, 0xE3, 0x3C, 0x07, 0x3F, 0xDF,
-    0xF7, 0x9D, 0x87, 0x71, 0xDF, 0xF3, 0xFC, 0x0E, 0x06, 0xC1, 0xB0, 0x38, 0x00, 0x0F, 0xC3, 0xF8,
-    0xCF, 0x01, 0xCF, 0xF7, 0xFD, 0xE7, 0x61, 0xDC, 0x77, 0xFC, 0xFF, 0x3F, 0x3E, 0x1F, 0xFF, 0x8C,
-    0xFD, 0xE0, 0x38, 0x73, 0xFF, 0xFB, 0xFF, 0xFD, 0xE7, 0x00, 0xC3, 0x80, 0x71, 0xF1, 0x3F, 0xFF,
-    0x8F, 0xFF, 0xC0, 0x3F, 0x3F, 0xBE, 0x5C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xF9, 0x3F, 0xCF, 0xE1,
-    0x80, 0xE0, 0x70, 0xF8, 0x18, 0x0F, 0x01, 0xC0, 0x30, 0x00, 0x0F, 0xC7, 0xFB, 0xCF, 0xE1, 0xFF,
-    0xFF, 0xFF, 0x80, 0xE0, 0x3E, 0x67, 0xF8, 0xFE, 0x06, 0x03, 0xC0, 0xE0, 0x30, 0x00, 0x0F, 0xC7,
-    0xFB, 0xCF, 0xE1, 0xFF, 0xFF, 0xFF, 0x80, 0xE0, 0x3E, 0x67, 0xF8, 0xFE, 0x0C, 0x07, 0x83, 0xF0,
-    0xCC, 0x00, 0x0F, 0xC7, 0xFB, 0xCF, 0xE1, 0xFF, 0xFF, 0xFF, 0x80, 0xE0, 0x3E, 0x67, 0xF8, 0xFE,
-    0x33, 0x0C, 0xC0, 0x00, 0x00, 0x3F, 0x1F, 0xEF, 0x3F, 0x87, 0xFF, 0xFF, 0xFE, 0x03, 0x80, 0xF9,
-    0x9F, 0xE3, 0xF8, 0xC7, 0x1C, 0x60, 0x39, 0xCE, 0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x33, 0xB9, 0x80,
-    0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x73, 0x9C, 0x18, 0x79, 0xF3, 0x30, 0x07, 0x0E, 0x1C, 0x38, 0x70,
-    0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0xEF, 0xDC, 0x00, 0x03, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3,
-    0x87, 0x0E, 0x00, 0x07, 0xE1, 0xFC, 0x3E, 0x07, 0xE0, 0x1C, 0x7F, 0x9F, 0xF7, 0x9E, 0xE0, 0xFC,
-    0x1B, 0x03, 0x70, 0xEE, 0x1D, 0xE7, 0x9F, 0xE1, 0xF8, 0x3D, 0x8F, 0xE7, 0xF0, 0x00, 0x00, 0x3F,
-    0xCF, 0xFB, 0x8F, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0x18, 0x03, 0x80,
-    0x38, 0x03, 0x00, 0x00, 0x7E, 0x1F, 0xE7, 0xDE, 0xE1, 0xDC, 0x1F, 0x83, 0xF0, 0x7E, 0x1D, 0xE7,
-    0x9F, 0xE1, 0xF8, 0x03, 0x00, 0xE0, 0x38, 0x06, 0x00, 0x00, 0x7E, 0x1F, 0xE7, 0xDE, 0xE1, 0xDC,
-    0x1F, 0x83, 0xF0, 0x7E, 0x1D, 0xE7, 0x9F, 0xE1, 0xF8, 0x0C, 0x03, 0xC0, 0xFC, 0x19, 0x80, 0x00,
-    0x7E, 0x1F, 0xE7, 0xDE, 0xE1, 0xDC, 0x1F, 0x83, 0xF0, 0x7E, 0x1D, 0xE7, 0x9F, 0xE1, 0xF8, 0x3D,
-    0x87, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0xE7, 0xDE, 0xE1, 0xDC, 0x1F, 0x83, 0xF0, 0x7E,
-    0x1D, 0xE7, 0x9F, 0xE1, 0xF8, 0x3B, 0x87, 0x70, 0x00, 0x00, 0x03, 0xF0, 0xFF, 0x3E, 0xF7, 0x0E,
-    0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0xEF, 0x3C, 0xFF, 0x0F, 0xC0, 0x0C, 0x07, 0x80, 0xC0, 0x00, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0x01, 0xE0, 0x30, 0x3F, 0xCF, 0xFB, 0xCF, 0x71, 0xEE, 0x7F,
-    0x9D, 0xFF, 0x3F, 0xCE, 0x73, 0xDF, 0xF3, 0xFC, 0x00, 0x18, 0x0F, 0x01, 0xC0, 0x30, 0x00, 0x38,
-    0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xDC, 0x77, 0xFC, 0xFF, 0x06, 0x03, 0xC0,
-    0xE0, 0x30, 0x00, 0x38, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xDC, 0x77, 0xFC,
-    0xFF, 0x0C, 0x07, 0x83, 0xF0, 0xCC, 0x00, 0x38, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87,
-    0xE1, 0xDC, 0x77, 0xFC, 0xFF, 0x33, 0x0C, 0xC0, 0x00, 0x00, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1,
-    0xF8, 0x7E, 0x1F, 0x87, 0x71, 0xDF, 0xF3, 0xFC, 0x03, 0x00, 0xE0, 0x38, 0x06, 0x00, 0x01, 0xC1,
-    0xB8, 0x73, 0x8E, 0x71, 0x8E, 0x30, 0xEE, 0x1D, 0xC1, 0xB0, 0x3E, 0x03, 0x80, 0x70, 0x0E, 0x03,
-    0x83, 0xF0, 0x7C, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xFE, 0x3F, 0xE7, 0x9E, 0xE1,
-    0xDC, 0x1F, 0x83, 0xF0, 0x7E, 0x1D, 0xE7, 0xBF, 0xE7, 0xF8, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x00,
-    0x3B, 0x87, 0x70, 0x00, 0x00, 0x0E, 0x0D, 0xC3, 0x9C, 0x73, 0x8C, 0x71, 0x87, 0x70, 0xEE, 0x0D,
-    0x81, 0xF0, 0x1C, 0x03, 0x80, 0x70, 0x1C, 0x1F, 0x83, 0xE0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00,
-    0x01, 0xC0, 0x07, 0x80, 0x1E, 0x00, 0xFC, 0x03, 0x70, 0x1C, 0xC0, 0x73, 0x81, 0x86, 0x0E, 0x1C,
-    0x3F, 0xF1, 0xFF, 0xC7, 0x03, 0x98, 0x0E, 0xE0, 0x1F, 0x80, 0x70, 0x3F, 0x8F, 0xE0, 0x00, 0x00,
-    0x3F, 0x0F, 0xE3, 0x3C, 0x07, 0x3F, 0xDF, 0xF7, 0x9D, 0x87, 0x71, 0xDF, 0xF3, 0xFC, 0x0C, 0xC0,
-    0x3F, 0x00, 0x78, 0x00, 0x00, 0x07, 0x00, 0x1E, 0x00, 0x78, 0x03, 0xF0, 0x0D, 0xC0, 0x73, 0x01,
-    0xCE, 0x06, 0x18, 0x38, 0x70, 0xFF, 0xC7, 0xFF, 0x1C, 0x0E, 0x60, 0x3B, 0x80, 0x7E, 0x01, 0xC0,
-    0x3B, 0x87, 0xC1, 0xF0, 0x00, 0x00, 0x0F, 0xC3, 0xF8, 0xCF, 0x01, 0xCF, 0xF7, 0xFD, 0xE7, 0x61,
-    0xDC, 0x77, 0xFC, 0xFF, 0x07, 0x00, 0x1E, 0x00, 0x78, 0x03, 0xF0, 0x0D, 0xC0, 0x73, 0x01, 0xCE,
-    0x06, 0x18, 0x38, 0x70, 0xFF, 0xC7, 0xFF, 0x1C, 0x0E, 0x60, 0x3B, 0x80, 0x7E, 0x01, 0xC0, 0x07,
-    0x00, 0x38, 0x00, 0xE0, 0x03, 0xC0, 0x3F, 0x0F, 0xE3, 0x3C, 0x07, 0x3F, 0xDF, 0xF7, 0x9D, 0x87,
-    0x71, 0xDF, 0xF3, 0xFC, 0x0E, 0x07, 0x00, 0xF0, 0x01, 0x80, 0x38, 0x07, 0x00, 0x60, 0x00, 0x00,
-    0xFE, 0x3F, 0xF7, 0xC6, 0x70, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00,
-    0x70, 0x07, 0xC6, 0x3F, 0xF0, 0xFE, 0x07, 0x07, 0x83, 0x81, 0x80, 0x01, 0xF9, 0xFD, 0xF2, 0xE0,
-    0x70, 0x38, 0x1C, 0x0E, 0x07, 0xC9, 0xFE, 0x7F, 0x03, 0x00, 0x78, 0x0F, 0xC0, 0xCC, 0x00, 0x00,
-    0xFE, 0x3F, 0xF7, 0xC6, 0x70, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00,
-    0x70, 0x07, 0xC6, 0x3F, 0xF0, 0xFE, 0x0C, 0x0F, 0x0F, 0xC6, 0x60, 0x01, 0xF9, 0xFD, 0xF2, 0xE0,
-    0x70, 0x38, 0x1C, 0x0E, 0x07, 0xC9, 0xFE, 0x7F, 0x07, 0x00, 0x70, 0x07, 0x00, 0x00, 0x0F, 0xE3,
-    0xFF, 0x7C, 0x67, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x07, 0x00,
-    0x7C, 0x63, 0xFF, 0x0F, 0xE0, 0x0C, 0x0F, 0x03, 0x00, 0x00, 0x01, 0xF9, 0xFD, 0xF2, 0xE0, 0x70,
-    0x38, 0x1C, 0x0E, 0x07, 0xC9, 0xFE, 0x7F, 0x0C, 0xC0, 0xFC, 0x07, 0x80, 0x30, 0x00, 0x00, 0xFE,
-    0x3F, 0xF7, 0xC6, 0x70, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x70,
-    0x07, 0xC6, 0x3F, 0xF0, 0xFE, 0x33, 0x1F, 0x87, 0x81, 0x80, 0x01, 0xF9, 0xFD, 0xF2, 0xE0, 0x70,
-    0x38, 0x1C, 0x0E, 0x07, 0xC9, 0xFE, 0x7F, 0x19, 0x80, 0xFC, 0x03, 0xC0, 0x0C, 0x00, 0x00, 0x3F,
-    0xC3, 0xFF, 0x9C, 0x7E, 0xE0, 0x77, 0x03, 0xF8, 0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x1F, 0x80, 0xFC,
-    0x07, 0xE0, 0x77, 0x1F, 0xBF, 0xF8, 0xFF, 0x00, 0x01, 0xD8, 0x07, 0x60, 0x1D, 0x80, 0x76, 0x01,
-    0xD8, 0xFF, 0x07, 0xFC, 0x3C, 0xF0, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0xE7,
-    0x07, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0x7F, 0xE0, 0xE3, 0xE1, 0x81, 0xC3, 0x01, 0xC6, 0x03, 0xBF,
-    0x87, 0x7F, 0x0E, 0x30, 0x1C, 0x60, 0x38, 0xC0, 0x71, 0x81, 0xC3, 0x8F, 0x87, 0xFE, 0x0F, 0xF0,
-    0x00, 0x01, 0xC0, 0xFF, 0x0F, 0xF0, 0x1C, 0x01, 0xC3, 0xFC, 0x7F, 0xCF, 0x3C, 0xE1, 0xCE, 0x1C,
-    0xE1, 0xCE, 0x1C, 0xE1, 0xCF, 0x9C, 0x7F, 0xC3, 0xFC, 0x3F, 0x87, 0xF0, 0x00, 0x7F, 0xEF, 0xFD,
-    0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1F, 0xF3, 0xFE, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xFF,
-    0xFF, 0xFC, 0x7F, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x1F, 0xEF, 0x3F, 0x87, 0xFF, 0xFF, 0xFE, 0x03,
-    0x80, 0xF9, 0x9F, 0xE3, 0xF8, 0x33, 0x07, 0xE0, 0x78, 0x00, 0x0F, 0xFD, 0xFF, 0xB8, 0x07, 0x00,
-    0xE0, 0x1C, 0x03, 0xFE, 0x7F, 0xCE, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1F, 0xFF, 0xFF, 0x80,
-    0x33, 0x0F, 0xC1, 0xE0, 0x00, 0x00, 0x0F, 0xC7, 0xFB, 0xCF, 0xE1, 0xFF, 0xFF, 0xFF, 0x80, 0xE0,
-    0x3E, 0x67, 0xF8, 0xFE, 0x0E, 0x01, 0xC0, 0x38, 0x00, 0x0F, 0xFD, 0xFF, 0xB8, 0x07, 0x00, 0xE0,
-    0x1C, 0x03, 0xFE, 0x7F, 0xCE, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1F, 0xFF, 0xFF, 0x80, 0x0C,
-    0x07, 0x80, 0xC0, 0x00, 0x00, 0x0F, 0xC7, 0xFB, 0xCF, 0xE1, 0xFF, 0xFF, 0xFF, 0x80, 0xE0, 0x3E,
-    0x67, 0xF8, 0xFE, 0xFF, 0xDF, 0xFB, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x3F, 0xE7, 0xFC, 0xE0, 0x1C,
-    0x03, 0x80, 0x70, 0x0E, 0x01, 0xFF, 0xFF, 0xF8, 0x0E, 0x03, 0x80, 0x70, 0x07, 0x80, 0x3F, 0x1F,
-    0xEF, 0x3F, 0x87, 0xFF, 0xFF, 0xFE, 0x03, 0x80, 0xF9, 0x9F, 0xE3, 0xF8, 0x1C, 0x06, 0x01, 0xE0,
-    0x33, 0x07, 0xE0, 0x78, 0x06, 0x00, 0x01, 0xFF, 0xBF, 0xF7, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x7F,
-    0xCF, 0xF9, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0xFF, 0xFF, 0xF0, 0x33, 0x0F, 0xC1, 0xE0,
-    0x30, 0x00, 0x00, 0x03, 0xF1, 0xFE, 0xF3, 0xF8, 0x7F, 0xFF, 0xFF, 0xE0, 0x38, 0x0F, 0x99, 0xFE,
-    0x3F, 0x80, 0x03, 0x00, 0x78, 0x0F, 0xC0, 0xCC, 0x00, 0x00, 0xFE, 0x3F, 0xF7, 0xC7, 0x70, 0x0E,
-    0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x07, 0xE0, 0x7E, 0x07, 0x70, 0x77, 0xC7, 0x3F, 0xF0, 0xFF,
-    0x0C, 0x07, 0x81, 0xF0, 0xCC, 0x00, 0x0F, 0xF7, 0xFF, 0xE7, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1,
-    0xFC, 0xF7, 0xFC, 0xFF, 0x01, 0xD8, 0xEF, 0xFB, 0xFC, 0x0C, 0xC0, 0xFC, 0x07, 0x80, 0x00, 0x0F,
-    0xE3, 0xFF, 0x7C, 0x77, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x7E, 0x07, 0xE0, 0x77,
-    0x07, 0x7C, 0x73, 0xFF, 0x0F, 0xF0, 0x3B, 0x07, 0xC1, 0xF0, 0x00, 0x00, 0x0F, 0xF7, 0xFF, 0xE7,
-    0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xFC, 0xF7, 0xFC, 0xFF, 0x01, 0xD8, 0xEF, 0xFB, 0xFC, 0x03,
-    0x00, 0x70, 0x03, 0x00, 0x00, 0x0F, 0xE3, 0xFF, 0x7C, 0x77, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E,
-    0x00, 0xE0, 0x7E, 0x07, 0xE0, 0x77, 0x07, 0x7C, 0x73, 0xFF, 0x0F, 0xF0, 0x0E, 0x03, 0x80, 0xE0,
-    0x00, 0x00, 0x0F, 0xF7, 0xFF, 0xE7, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xFC, 0xF7, 0xFC, 0xFF,
-    0x01, 0xD8, 0xEF, 0xFB, 0xFC, 0x0F, 0xE3, 0xFF, 0x7C, 0x77, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E,
-    0x00, 0xE0, 0x7E, 0x07, 0xE0, 0x77, 0x07, 0x7C, 0x73, 0xFF, 0x0F, 0xF0, 0x00, 0x07, 0x00, 0xF0,
-    0x0F, 0x00, 0x07, 0x03, 0x80, 0xE0, 0x38, 0x00, 0x00, 0x03, 0xFD, 0xFF, 0xF9, 0xF8, 0x7E, 0x1F,
-    0x87, 0xE1, 0xF8, 0x7F, 0x3D, 0xFF, 0x3F, 0xC0, 0x76, 0x3B, 0xFE, 0xFF, 0x00, 0x06, 0x00, 0x70,
-    0x0F, 0x81, 0x98, 0x00, 0x0E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0x30, 0x3E, 0x0D, 0x80, 0x00,
-    0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x3F, 0xCF, 0xFB, 0xCF, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1,
-    0xF8, 0x7E, 0x1F, 0x87, 0x30, 0x1D, 0xFF, 0xFF, 0xFF, 0xF9, 0x80, 0xE3, 0x01, 0xC6, 0x03, 0x8F,
-    0xFF, 0x1F, 0xFE, 0x30, 0x1C, 0x60, 0x38, 0xC0, 0x71, 0x80, 0xE3, 0x01, 0xC6, 0x03, 0x8C, 0x07,
-    0x00, 0x70, 0x1F, 0xE3, 0xFC, 0x38, 0x07, 0x00, 0xFF, 0x1F, 0xF3, 0xCF, 0x70, 0xEE, 0x1D, 0xC3,
-    0xB8, 0x77, 0x0E, 0xE1, 0xDC, 0x3B, 0x87, 0x7E, 0xFE, 0xDE, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x7E, 0xFE, 0xDC, 0x00, 0x00, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0xFF, 0xFC, 0x01, 0xC3, 0x87, 0x0E,
-    0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xFF, 0xFC, 0x00, 0x03, 0x87, 0x0E,
-    0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x00, 0xCF, 0xF7, 0x80, 0x71, 0xC7, 0x1C, 0x71, 0xC7,
-    0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x00, 0x6E, 0xFD, 0xF0, 0x00, 0x07, 0x0E, 0x1C, 0x38, 0x70,
-    0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x73, 0x9C, 0xE7, 0x39, 0xCE, 0xE7,
-    0x3C, 0x77, 0x00, 0x07, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7E, 0xEF, 0xEE, 0xE0, 0xEE, 0xEE, 0xEE,
-    0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8,
-    0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE7,
-    0x7B, 0x9F, 0xEE, 0x7F, 0x00, 0xE3, 0x71, 0xC0, 0x00, 0x00, 0x07, 0x1B, 0x8D, 0xC6, 0xE3, 0x71,
-    0xB8, 0xDC, 0x6E, 0x37, 0x1B, 0x8D, 0xC6, 0x03, 0x03, 0x87, 0xC3, 0xC0, 0x01, 0x80, 0x78, 0x1F,
-    0x83, 0x30, 0x00, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00,
-    0xE0, 0x1C, 0x03, 0x9C, 0xF3, 0xFC, 0x3F, 0x00, 0x0C, 0x1E, 0x3E, 0x33, 0x00, 0x1C, 0x1C, 0x1C,
-    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x3C, 0xF8, 0xF8, 0xE0, 0xF7, 0x07, 0x38,
-    0x71, 0xC7, 0x0E, 0x70, 0x77, 0x03, 0xF0, 0x1F, 0x80, 0xFE, 0x07, 0x78, 0x39, 0xE1, 0xC7, 0x8E,
-    0x1E, 0x70, 0x7B, 0x81, 0xC0, 0x00, 0x06, 0x00, 0xF0, 0x07, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80,
-    0xE0, 0x38, 0xEE, 0x73, 0xBC, 0xEE, 0x3F, 0x0F, 0x83, 0xF0, 0xEE, 0x39, 0xCE, 0x3B, 0x87, 0x00,
-    0x07, 0x03, 0xC0, 0xE0, 0xE3, 0xF9, 0xEE, 0x73, 0xB8, 0xFC, 0x3E, 0x0F, 0xE3, 0xBC, 0xE7, 0xB8,
-    0xEE, 0x1C, 0x18, 0x0E, 0x07, 0x01, 0x80, 0x00, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03,
-    0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0F, 0xFF, 0xFF, 0x37, 0xBC, 0x0E, 0x73, 0x9C,
-    0xE7, 0x39, 0xCE, 0x73, 0x9C, 0xE7, 0x9E, 0xE0, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E,
-    0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x3F, 0xFF, 0xFC, 0x00, 0x0E, 0x07, 0x01, 0xC0,
-    0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xE3, 0xCE, 0x00, 0xCF, 0x3C, 0xEE,
-    0x3B, 0x8E, 0xE3, 0xB8, 0xEC, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x3F,
-    0xFF, 0xFC, 0xEF, 0xBE, 0xFB, 0xEF, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0xC7, 0x9C, 0xE0, 0x38,
-    0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x3B, 0x8E, 0xE3, 0xB8, 0x0E, 0x03, 0x80, 0xE0, 0x3F, 0xFF,
-    0xFC, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x77, 0xEF, 0xDF, 0x87, 0x0E, 0x1E, 0x1E, 0x38, 0x1C,
-    0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1D, 0x01, 0xF0, 0x1F, 0x03, 0xC0, 0x7C, 0x07, 0xC0, 0x1C, 0x01,
-    0xC0, 0x1C, 0x01, 0xFF, 0x1F, 0xF0, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x8F, 0x3C, 0xF1, 0xE0, 0xC1,
-    0x83, 0x07, 0x0F, 0x1E, 0x01, 0x80, 0x1C, 0x01, 0xC0, 0x0C, 0x00, 0x00, 0x70, 0x1F, 0xC0, 0xFF,
-    0x07, 0xFC, 0x3F, 0xE1, 0xFB, 0x8F, 0xCE, 0x7E, 0x3B, 0xF1, 0xDF, 0x87, 0xFC, 0x1F, 0xE0, 0xFF,
-    0x03, 0xF8, 0x1F, 0xC0, 0x70, 0x07, 0x01, 0xC0, 0xE0, 0x30, 0x00, 0x3F, 0xCF, 0xFB, 0x8F, 0xE1,
-    0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE0, 0x3F, 0x81, 0xFE, 0x0F, 0xF8, 0x7F,
-    0xC3, 0xF7, 0x1F, 0x9C, 0xFC, 0x77, 0xE3, 0xBF, 0x0F, 0xF8, 0x3F, 0xC1, 0xFE, 0x07, 0xF0, 0x3F,
-    0x80, 0xE0, 0x00, 0x07, 0x00, 0x78, 0x03, 0x80, 0xFF, 0x3F, 0xEE, 0x3F, 0x87, 0xE1, 0xF8, 0x7E,
-    0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1C, 0x00, 0x0C, 0x0F, 0x01, 0xC0, 0x0C, 0xC0, 0x7C, 0x01, 0xE0,
-    0x06, 0x00, 0x00, 0x70, 0x1F, 0xC0, 0xFF, 0x07, 0xFC, 0x3F, 0xE1, 0xFB, 0x8F, 0xCE, 0x7E, 0x3B,
-    0xF1, 0xDF, 0x87, 0xFC, 0x1F, 0xE0, 0xFF, 0x03, 0xF8, 0x1F, 0xC0, 0x70, 0x33, 0x0F, 0xC1, 0xE0,
-    0x30, 0x00, 0x3F, 0xCF, 0xFB, 0x8F, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87,
-    0x60, 0x1C, 0x03, 0x80, 0x60, 0x00, 0x00, 0xFF, 0x1F, 0xF3, 0x8F, 0x70, 0xEE, 0x1D, 0xC3, 0xB8,
-    0x77, 0x0E, 0xE1, 0xDC, 0x3B, 0x87, 0xE0, 0x3F, 0x81, 0xFE, 0x0F, 0xF8, 0x7F, 0xC3, 0xF7, 0x1F,
-    0x9C, 0xFC, 0x77, 0xE3, 0xBF, 0x0F, 0xF8, 0x3F, 0xC1, 0xFE, 0x07, 0xF0, 0x1F, 0x80, 0xE0, 0x07,
-    0x00, 0x38, 0x07, 0x80, 0x3C, 0xFF, 0x3F, 0xEE, 0x3F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1,
-    0xF8, 0x7E, 0x1C, 0x07, 0x01, 0xC1, 0xE0, 0x78, 0x0F, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x03,
-    0xFF, 0x0F, 0x9F, 0x1C, 0x0F, 0x70, 0x0E, 0xE0, 0x1D, 0xC0, 0x3B, 0x80, 0x37, 0x00, 0xEE, 0x01,
-    0xDC, 0x03, 0x9C, 0x0F, 0x3E, 0x7C, 0x3F, 0xF0, 0x1F, 0xC0, 0x3F, 0x87, 0xF0, 0x00, 0x00, 0x03,
-    0xF0, 0xFF, 0x3E, 0xF7, 0x0E, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0xEF, 0x3C, 0xFF, 0x0F, 0xC0, 0x0C,
-    0xC0, 0x1F, 0x80, 0x1E, 0x00, 0x00, 0x00, 0xFE, 0x07, 0xFE, 0x1F, 0x3E, 0x38, 0x1E, 0xE0, 0x1D,
-    0xC0, 0x3B, 0x80, 0x77, 0x00, 0x6E, 0x01, 0xDC, 0x03, 0xB8, 0x07, 0x38, 0x1E, 0x7C, 0xF8, 0x7F,
-    0xE0, 0x3F, 0x80, 0x3B, 0x07, 0xE0, 0x78, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0xE7, 0xDE, 0xE1, 0xDC,
-    0x1F, 0x83, 0xF0, 0x7E, 0x1D, 0xE7, 0x9F, 0xE1, 0xF8, 0x03, 0x30, 0x0E, 0xE0, 0x3B, 0x80, 0x26,
-    0x00, 0x00, 0x01, 0xFC, 0x0F, 0xFC, 0x3E, 0x7C, 0x70, 0x3D, 0xC0, 0x3B, 0x80, 0x77, 0x00, 0xEE,
-    0x00, 0xDC, 0x03, 0xB8, 0x07, 0x70, 0x0E, 0x70, 0x3C, 0xF9, 0xF0, 0xFF, 0xC0, 0x7F, 0x00, 0x0C,
-    0xC3, 0xB8, 0xEE, 0x09, 0x80, 0x00, 0x7E, 0x1F, 0xE7, 0xDE, 0xE1, 0xDC, 0x1F, 0x83, 0xF0, 0x7E,
-    0x1D, 0xE7, 0x9F, 0xE1, 0xF8, 0x0F, 0xFF, 0xE3, 0xFF, 0xFE, 0x7E, 0x30, 0x07, 0x03, 0x00, 0xF0,
-    0x30, 0x0E, 0x03, 0x00, 0xE0, 0x3F, 0xCE, 0x03, 0xFC, 0xE0, 0x30, 0x0E, 0x03, 0x00, 0xF0, 0x30,
-    0x07, 0x03, 0x00, 0x7E, 0x30, 0x03, 0xFF, 0xFE, 0x0F, 0xFF, 0xE0, 0x3F, 0x3F, 0x1F, 0xFF, 0xEF,
-    0xBF, 0x3F, 0x87, 0x87, 0xE0, 0xFF, 0xF8, 0x3F, 0xFE, 0x0E, 0x03, 0x87, 0x80, 0xF3, 0xF9, 0x9F,
-    0xFF, 0xE3, 0xF1, 0xF8, 0x03, 0x00, 0x70, 0x0E, 0x00, 0xC0, 0x00, 0x07, 0xF8, 0xFF, 0xCE, 0x3E,
-    0xE0, 0xEE, 0x0E, 0xE0, 0xEE, 0x3E, 0xFF, 0xCF, 0xF8, 0xE3, 0x8E, 0x3C, 0xE1, 0xCE, 0x0E, 0xE0,
-    0xEE, 0x07, 0x0C, 0x38, 0xE1, 0x80, 0x0F, 0xFF, 0xF1, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70,
-    0x7F, 0x8F, 0xFC, 0xE3, 0xEE, 0x0E, 0xE0, 0xEE, 0x0E, 0xE3, 0xEF, 0xFC, 0xFF, 0x8E, 0x38, 0xE3,
-    0xCE, 0x1C, 0xE0, 0xEE, 0x0E, 0xE0, 0x70, 0x00, 0x0E, 0x01, 0xE0, 0x1E, 0x00, 0x3F, 0x7F, 0x71,
-    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x00, 0x70, 0xF0, 0xE0, 0x33, 0x03, 0xF0, 0x1E,
-    0x00, 0xC0, 0x00, 0x07, 0xF8, 0xFF, 0xCE, 0x3E, 0xE0, 0xEE, 0x0E, 0xE0, 0xEE, 0x3E, 0xFF, 0xCF,
-    0xF8, 0xE3, 0x8E, 0x3C, 0xE1, 0xCE, 0x0E, 0xE0, 0xEE, 0x07, 0x66, 0xFC, 0xF0, 0xC0, 0x0F, 0xFF,
-    0xF1, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0x03, 0x00, 0xE0, 0x38, 0x06, 0x00, 0x00, 0x3F,
-    0x9F, 0xF3, 0xCE, 0x70, 0x0E, 0x01, 0xC0, 0x3F, 0x01, 0xF8, 0x0F, 0x80, 0x78, 0x07, 0x00, 0xEE,
-    0x7F, 0xFF, 0x3F, 0xC0, 0x06, 0x07, 0x07, 0x03, 0x00, 0x01, 0xF9, 0xFC, 0xE6, 0x70, 0x3E, 0x0F,
-    0xC1, 0xF0, 0x3A, 0x3D, 0xFE, 0xFE, 0x06, 0x01, 0xE0, 0x7E, 0x0C, 0xC0, 0x00, 0x3F, 0x9F, 0xF3,
-    0xCE, 0x70, 0x0E, 0x01, 0xC0, 0x3F, 0x01, 0xF8, 0x0F, 0x80, 0x78, 0x07, 0x00, 0xEE, 0x7F, 0xFF,
-    0x3F, 0xC0, 0x0C, 0x0F, 0x0F, 0xC6, 0x60, 0x01, 0xF9, 0xFC, 0xE6, 0x70, 0x3E, 0x0F, 0xC1, 0xF0,
-    0x3A, 0x3D, 0xFE, 0xFE, 0x1F, 0xCF, 0xF9, 0xE7, 0x38, 0x07, 0x00, 0xE0, 0x1F, 0x80, 0xFC, 0x07,
-    0xC0, 0x3C, 0x03, 0x80, 0x77, 0x3F, 0xFF, 0x9F, 0xE0, 0x70, 0x06, 0x03, 0xC0, 0x3F, 0x3F, 0x9C,
-    0xCE, 0x07, 0xC1, 0xF8, 0x3E, 0x07, 0x47, 0xBF, 0x9F, 0xC3, 0x80, 0xC1, 0xE0, 0x19, 0x83, 0xF0,
-    0x3C, 0x03, 0x00, 0x00, 0x3F, 0x9F, 0xF3, 0xCE, 0x70, 0x0E, 0x01, 0xC0, 0x3F, 0x01, 0xF8, 0x0F,
-    0x80, 0x78, 0x07, 0x00, 0xEE, 0x7F, 0xFF, 0x3F, 0xC0, 0x33, 0x1F, 0x07, 0x81, 0x80, 0x01, 0xF9,
-    0xFC, 0xE6, 0x70, 0x3E, 0x0F, 0xC1, 0xF0, 0x3A, 0x3D, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0x06, 0x00,
-    0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60,
-    0x06, 0x00, 0xE0, 0x07, 0x01, 0xE0, 0xE0, 0xE0, 0xE0, 0xFE, 0xFE, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-    0xE0, 0xF2, 0x7E, 0x7E, 0x18, 0x1C, 0x3C, 0x19, 0x81, 0xF8, 0x0F, 0x00, 0x60, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06,
-    0x00, 0x60, 0x06, 0x00, 0x60, 0x0C, 0x0C, 0xEC, 0xEC, 0xE0, 0xFE, 0xFE, 0xE0, 0xE0, 0xE0, 0xE0,
-    0xE0, 0xE0, 0xF2, 0x7E, 0x7E, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x03,
-    0xFC, 0x3F, 0xC0, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0xE0, 0xE0, 0xE0, 0xFE,
-    0xFE, 0xE0, 0xE0, 0xE0, 0xFE, 0xFE, 0xE0, 0xF2, 0x7E, 0x7E, 0x1E, 0xC1, 0xFC, 0x1F, 0x80, 0x00,
-    0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0,
-    0x77, 0x07, 0x79, 0xE3, 0xFE, 0x1F, 0xC0, 0x3D, 0x8F, 0xC6, 0xF0, 0x00, 0x00, 0x38, 0x7E, 0x1F,
-    0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xDC, 0x77, 0xFC, 0xFF, 0x1F, 0xC1, 0xFC, 0x00, 0x0E,
-    0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07,
-    0x70, 0x77, 0x9E, 0x3F, 0xE1, 0xFC, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0xE1, 0xF8, 0x7E, 0x1F, 0x87,
-    0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0x71, 0xDF, 0xF3, 0xFC, 0x1D, 0x81, 0xF8, 0x0F, 0x00, 0x00, 0xE0,
-    0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x77,
-    0x07, 0x79, 0xE3, 0xFE, 0x1F, 0xC0, 0x33, 0x0F, 0xC1, 0xE0, 0x00, 0x00, 0x38, 0x7E, 0x1F, 0x87,
-    0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xDC, 0x77, 0xFC, 0xFF, 0x0F, 0x00, 0xD8, 0x0D, 0x80, 0xF0,
-    0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0,
-    0x77, 0x07, 0x79, 0xE3, 0xFE, 0x1F, 0xC0, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x00, 0x38, 0x7E, 0x1F,
-    0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xDC, 0x77, 0xFC, 0xFF, 0x06, 0x60, 0xEE, 0x0D, 0xC0,
-    0x98, 0x00, 0x0E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07,
-    0xE0, 0x7E, 0x07, 0x70, 0x77, 0x9E, 0x3F, 0xE1, 0xFC, 0x0D, 0x87, 0x63, 0xB8, 0xCC, 0x00, 0x38,
-    0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xDC, 0x77, 0xFC, 0xFF, 0xE0, 0x7E, 0x07,
-    0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x77, 0x07, 0x79,
-    0xE3, 0xFE, 0x1F, 0x80, 0x70, 0x07, 0x00, 0x78, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E,
-    0x1F, 0x87, 0x71, 0xDF, 0xF3, 0xFC, 0x0E, 0x07, 0x00, 0xF0, 0x00, 0x60, 0x00, 0x1E, 0x00, 0x07,
-    0xE0, 0x00, 0xCC, 0x00, 0x00, 0x01, 0xC0, 0x01, 0xF8, 0x00, 0x3B, 0x87, 0x07, 0x70, 0xF0, 0xEE,
-    0x1E, 0x19, 0xC7, 0xC7, 0x38, 0xFC, 0xE3, 0x9B, 0x9C, 0x77, 0x33, 0x8E, 0xE7, 0x61, 0xD8, 0xFC,
-    0x1F, 0x0F, 0x83, 0xE1, 0xF0, 0x78, 0x3C, 0x07, 0x03, 0x80, 0x01, 0x80, 0x03, 0xC0, 0x07, 0xE0,
-    0x06, 0x60, 0x00, 0x00, 0xE1, 0xC7, 0xE1, 0xC7, 0x63, 0xC7, 0x73, 0xC6, 0x73, 0xEE, 0x33, 0xEE,
-    0x3F, 0x6C, 0x3E, 0x7C, 0x1E, 0x7C, 0x1E, 0x38, 0x1C, 0x38, 0x06, 0x00, 0x78, 0x07, 0xE0, 0x33,
-    0x00, 0x00, 0x70, 0x1D, 0xC1, 0xCE, 0x1C, 0x38, 0xE1, 0xCE, 0x07, 0x70, 0x3F, 0x00, 0xF8, 0x03,
-    0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x04, 0x01, 0xC0, 0x7C, 0x08,
-    0x80, 0x01, 0xC1, 0xB8, 0x73, 0x8E, 0x71, 0x8E, 0x30, 0xEE, 0x1D, 0xC1, 0xB0, 0x3E, 0x03, 0x80,
-    0x70, 0x0E, 0x03, 0x83, 0xF0, 0x7C, 0x00, 0x1D, 0xC0, 0xEE, 0x00, 0x01, 0xC0, 0x77, 0x07, 0x38,
-    0x70, 0xE3, 0x87, 0x38, 0x1D, 0xC0, 0xFC, 0x03, 0xE0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00,
-    0xE0, 0x07, 0x00, 0x38, 0x00, 0x03, 0x80, 0x38, 0x07, 0x00, 0x60, 0x00, 0x07, 0xFE, 0x7F, 0xE0,
-    0x0E, 0x01, 0xC0, 0x38, 0x07, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x1C, 0x03, 0x80, 0x70, 0x07, 0x00,
-    0xFF, 0xFF, 0xFF, 0x06, 0x03, 0x81, 0xC0, 0x60, 0x00, 0x1F, 0xE7, 0xF8, 0x0E, 0x07, 0x03, 0x81,
-    0xC0, 0xE0, 0x78, 0x1C, 0x0F, 0xFB, 0xFE, 0x06, 0x00, 0x70, 0x06, 0x00, 0x00, 0x7F, 0xE7, 0xFE,
-    0x00, 0xE0, 0x1C, 0x03, 0x80, 0x78, 0x07, 0x00, 0xE0, 0x1C, 0x01, 0xC0, 0x38, 0x07, 0x00, 0x70,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x1C, 0x07, 0x01, 0xC0, 0x00, 0x00, 0x1F, 0xE7, 0xF8, 0x0E, 0x07, 0x03,
-    0x81, 0xC0, 0xE0, 0x78, 0x1C, 0x0F, 0xFB, 0xFE, 0x19, 0x81, 0xF8, 0x0F, 0x00, 0x60, 0x00, 0x07,
-    0xFE, 0x7F, 0xE0, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x1C, 0x03, 0x80,
-    0x70, 0x07, 0x00, 0xFF, 0xFF, 0xFF, 0x33, 0x0F, 0xC1, 0xE0, 0x30, 0x00, 0x1F, 0xE7, 0xF8, 0x0E,
-    0x07, 0x03, 0x81, 0xC0, 0xE0, 0x78, 0x1C, 0x0F, 0xFB, 0xFE, 0x3F, 0x7E, 0x70, 0xE0, 0xE0, 0xE0,
-    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x7B, 0xFC, 0xC0, 0x18, 0x03, 0x80,
-    0x38, 0x03, 0x00, 0x01, 0xFF, 0xBF, 0xF7, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x7F, 0xCF, 0xF9, 0xC0,
-    0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0xFF, 0xFF, 0xF0, 0x3B, 0x87, 0x70, 0x00, 0x7F, 0xEF, 0xFD,
-    0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1F, 0xF3, 0xFE, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xFF,
-    0xFF, 0xFC, 0xFF, 0xF1, 0xFF, 0xE0, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xFF, 0x03, 0xFF, 0x07,
-    0x9F, 0x0E, 0x0E, 0x1C, 0x1C, 0x38, 0x38, 0x70, 0x70, 0xE1, 0xE1, 0xCF, 0x83, 0x9E, 0x00, 0x07,
-    0x01, 0xC0, 0xE0, 0x30, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38,
-    0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0x0F, 0xE3, 0xFF, 0x7C, 0x67, 0x00, 0xE0, 0x0E,
-    0x00, 0xFF, 0x8F, 0xF8, 0xE0, 0x0E, 0x00, 0xE0, 0x07, 0x00, 0x7C, 0x63, 0xFF, 0x1F, 0xE0, 0x1F,
-    0xCF, 0xF9, 0xE7, 0x38, 0x07, 0x00, 0xE0, 0x1F, 0x80, 0xFC, 0x07, 0xC0, 0x3C, 0x03, 0x80, 0x77,
-    0x3F, 0xFF, 0x9F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xEE, 0xEE, 0x00, 0x38, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x03, 0x81, 0xC0, 0xE0,
-    0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x7E, 0x7F, 0xF9, 0xF8, 0x0F, 0xF8, 0x00,
-    0x3F, 0xE0, 0x00, 0xE1, 0x80, 0x03, 0x86, 0x00, 0x0E, 0x18, 0x00, 0x38, 0x7F, 0x80, 0xE1, 0xFF,
-    0x03, 0x86, 0x3E, 0x0E, 0x18, 0x38, 0x30, 0x60, 0x61, 0xC1, 0x81, 0x87, 0x06, 0x0E, 0x78, 0x18,
-    0xFB, 0xE0, 0x7F, 0xCE, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xE0, 0x70, 0x0E, 0x07, 0x00, 0xE0, 0x70,
-    0x0E, 0x07, 0x00, 0xE0, 0x70, 0x0F, 0xFF, 0xFC, 0xFF, 0xFF, 0xEE, 0x07, 0x1F, 0xE0, 0x70, 0x7E,
-    0x07, 0x07, 0xE0, 0x70, 0x7E, 0x07, 0x07, 0xE0, 0x71, 0xFE, 0x07, 0xFE, 0xE0, 0x7F, 0x80, 0xFF,
-    0xF1, 0xFF, 0xE0, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xFF, 0x03, 0xFF, 0x07, 0x9E, 0x0E, 0x0E,
-    0x1C, 0x1C, 0x38, 0x38, 0x70, 0x70, 0xE0, 0xE1, 0xC1, 0xC3, 0x83, 0x80, 0x03, 0x00, 0x38, 0x03,
-    0x80, 0x18, 0x00, 0x00, 0x70, 0x7B, 0x83, 0x9C, 0x38, 0xE3, 0x87, 0x38, 0x3B, 0x81, 0xF8, 0x0F,
-    0xC0, 0x7F, 0x03, 0xBC, 0x1C, 0xF0, 0xE3, 0xC7, 0x0F, 0x38, 0x3D, 0xC0, 0xE0, 0x0C, 0x00, 0x70,
-    0x01, 0xC0, 0x06, 0x00, 0x00, 0x70, 0x1F, 0x81, 0xFC, 0x0F, 0xE0, 0xFF, 0x0F, 0xF8, 0xEF, 0xC7,
-    0x7E, 0x73, 0xF7, 0x1F, 0xF8, 0xFF, 0x87, 0xF8, 0x3F, 0xC1, 0xFC, 0x0F, 0xC0, 0x70, 0x1D, 0xC0,
-    0xFC, 0x03, 0xE0, 0x00, 0x0E, 0x07, 0x38, 0x39, 0xC1, 0xCE, 0x0C, 0x38, 0xE1, 0xC7, 0x07, 0x30,
-    0x3F, 0x80, 0xFC, 0x03, 0xC0, 0x1E, 0x00, 0xE0, 0x4F, 0x03, 0xF0, 0x1F, 0x00, 0xE0, 0x7E, 0x07,
-    0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0,
-    0x7F, 0xFF, 0xFF, 0xF0, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x07, 0x00, 0x1E, 0x00, 0x78, 0x03,
-    0xF0, 0x0D, 0xC0, 0x73, 0x01, 0xCE, 0x06, 0x18, 0x38, 0x70, 0xFF, 0xC7, 0xFF, 0x1C, 0x0E, 0x60,
-    0x3B, 0x80, 0x7E, 0x01, 0xC0, 0xFF, 0xCF, 0xFC, 0xE0, 0x0E, 0x00, 0xE0, 0x0F, 0xF8, 0xFF, 0xCE,
-    0x3E, 0xE0, 0xEE, 0x06, 0xE0, 0x6E, 0x0E, 0xE3, 0xEF, 0xFC, 0xFF, 0x80, 0x7F, 0x8F, 0xFC, 0xE3,
-    0xEE, 0x0E, 0xE0, 0xEE, 0x3E, 0xFF, 0xCF, 0xFE, 0xE1, 0xEE, 0x07, 0xE0, 0x7E, 0x07, 0xE1, 0xEF,
-    0xFE, 0x7F, 0x80, 0xFF, 0xFF, 0xFE, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E,
-    0x03, 0x80, 0xE0, 0x38, 0x0E, 0x00, 0x0F, 0xF8, 0x1F, 0xF0, 0x38, 0x60, 0x70, 0xC0, 0xE1, 0x81,
-    0xC3, 0x03, 0x86, 0x07, 0x0C, 0x0C, 0x18, 0x38, 0x30, 0x70, 0x60, 0xE0, 0xC3, 0x81, 0x9F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x38, 0xFF, 0xDF, 0xFB, 0x80, 0x70, 0x0E,
-    0x01, 0xC0, 0x3F, 0xE7, 0xFC, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xFF, 0xFF, 0xF8, 0x70,
-    0xE1, 0xCF, 0x1C, 0x78, 0xE3, 0x8E, 0x0E, 0x73, 0x80, 0xEE, 0xE0, 0x1F, 0xF8, 0x01, 0xFF, 0x00,
-    0x1F, 0xC0, 0x07, 0xFC, 0x01, 0xDD, 0xC0, 0x73, 0xBC, 0x1E, 0x73, 0xC3, 0x8E, 0x38, 0xE1, 0xC3,
-    0xBC, 0x38, 0x78, 0x7F, 0x8F, 0xF9, 0xCF, 0x00, 0x70, 0x0C, 0x07, 0x87, 0xE0, 0xFE, 0x03, 0xE0,
-    0x1C, 0x03, 0x80, 0x77, 0x3F, 0xFF, 0x9F, 0xE0, 0xE0, 0x3F, 0x03, 0xF8, 0x1F, 0xC1, 0xFE, 0x1F,
-    0xF1, 0xDF, 0x8E, 0xFC, 0xE7, 0xEE, 0x3F, 0xF1, 0xFF, 0x0F, 0xF0, 0x7F, 0x83, 0xF8, 0x1F, 0x80,
-    0xE0, 0x1D, 0xC0, 0x7E, 0x03, 0xE0, 0x00, 0x0E, 0x03, 0xF0, 0x3F, 0x81, 0xFC, 0x1F, 0xE1, 0xFF,
-    0x1D, 0xF8, 0xEF, 0xCE, 0x7E, 0xE3, 0xFF, 0x1F, 0xF0, 0xFF, 0x07, 0xF8, 0x3F, 0x81, 0xF8, 0x0E,
-    0xE0, 0xF7, 0x07, 0x38, 0x71, 0xC7, 0x0E, 0x70, 0x77, 0x03, 0xF0, 0x1F, 0x80, 0xFE, 0x07, 0x78,
-    0x39, 0xE1, 0xC7, 0x8E, 0x1E, 0x70, 0x7B, 0x81, 0xC0, 0x0F, 0xF8, 0x3F, 0xE0, 0xE1, 0x83, 0x86,
-    0x0E, 0x18, 0x38, 0x60, 0xE1, 0x83, 0x86, 0x0E, 0x18, 0x30, 0x61, 0xC1, 0x87, 0x06, 0x78, 0x1B,
-    0xE0, 0x6E, 0x01, 0x80, 0x70, 0x0E, 0x70, 0x0E, 0x78, 0x1E, 0x78, 0x1F, 0x6C, 0x3F, 0x6C, 0x37,
-    0x66, 0x37, 0xE6, 0x67, 0xE7, 0x67, 0xE3, 0xE7, 0xE3, 0xC7, 0xE3, 0xC7, 0xE1, 0xC7, 0xE0, 0x07,
-    0xE0, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x3E,
-    0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x30, 0x0F, 0xE0, 0x7F, 0xE1, 0xF3, 0xE3, 0x81,
-    0xEE, 0x01, 0xDC, 0x03, 0xB8, 0x07, 0x70, 0x06, 0xE0, 0x1D, 0xC0, 0x3B, 0x80, 0x73, 0x81, 0xE7,
-    0xCF, 0x87, 0xFE, 0x03, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0,
-    0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x70, 0x7F, 0x8F, 0xFC,
-    0xE3, 0xEE, 0x0E, 0xE0, 0xEE, 0x0E, 0xE3, 0xEF, 0xFC, 0xFF, 0x8E, 0x00, 0xE0, 0x0E, 0x00, 0xE0,
-    0x0E, 0x00, 0xE0, 0x00, 0x0F, 0xE3, 0xFF, 0x7C, 0x67, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00,
-    0xE0, 0x0E, 0x00, 0xE0, 0x07, 0x00, 0x7C, 0x63, 0xFF, 0x0F, 0xE0, 0xFF, 0xFF, 0xFF, 0x06, 0x00,
-    0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60,
-    0x06, 0x00, 0xE0, 0x73, 0x83, 0x9C, 0x1C, 0xE0, 0xC3, 0x8E, 0x1C, 0x70, 0x73, 0x03, 0xF8, 0x0F,
-    0xC0, 0x3C, 0x01, 0xE0, 0x0E, 0x04, 0xF0, 0x3F, 0x01, 0xF0, 0x00, 0x01, 0x80, 0x01, 0x80, 0x1F,
-    0xF8, 0x3F, 0xFC, 0x7D, 0xBE, 0xF1, 0x8F, 0xE1, 0x87, 0xE1, 0x87, 0xE1, 0x87, 0xE1, 0x87, 0xF1,
-    0x8F, 0x7D, 0xBE, 0x3F, 0xFC, 0x1F, 0xF8, 0x01, 0x80, 0x01, 0x80, 0x70, 0x7B, 0x83, 0x8E, 0x38,
-    0x3B, 0xC1, 0xDC, 0x07, 0xC0, 0x1E, 0x00, 0xE0, 0x0F, 0x80, 0x7E, 0x07, 0x70, 0x71, 0xC3, 0x87,
-    0x38, 0x3B, 0x80, 0xE0, 0xE0, 0x73, 0x81, 0xCE, 0x07, 0x38, 0x1C, 0xE0, 0x73, 0x81, 0xCE, 0x07,
-    0x38, 0x1C, 0xE0, 0x73, 0x81, 0xCE, 0x07, 0x38, 0x1C, 0xE0, 0x73, 0xFF, 0xFF, 0xFF, 0xC0, 0x07,
-    0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F,
-    0x8F, 0x7F, 0xE7, 0xFC, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0xE0, 0xE1, 0xF8, 0x38, 0x7E,
-    0x0E, 0x1F, 0x83, 0x87, 0xE0, 0xE1, 0xF8, 0x38, 0x7E, 0x0E, 0x1F, 0x83, 0x87, 0xE0, 0xE1, 0xF8,
-    0x38, 0x7E, 0x0E, 0x1F, 0x83, 0x87, 0xE0, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xE0, 0xE1, 0xCE,
-    0x0E, 0x1C, 0xE0, 0xE1, 0xCE, 0x0E, 0x1C, 0xE0, 0xE1, 0xCE, 0x0E, 0x1C, 0xE0, 0xE1, 0xCE, 0x0E,
-    0x1C, 0xE0, 0xE1, 0xCE, 0x0E, 0x1C, 0xE0, 0xE1, 0xCE, 0x0E, 0x1C, 0xE0, 0xE1, 0xCF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0xFE, 0x01, 0xFC,
-    0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xFE, 0x03, 0xFF, 0x07, 0x3E, 0x0E, 0x1E, 0x1C, 0x1C,
-    0x38, 0x38, 0x70, 0xF0, 0xE3, 0xC1, 0xFF, 0x83, 0xFC, 0x00, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
-    0xE0, 0x07, 0xE0, 0x07, 0xFF, 0x87, 0xFF, 0xC7, 0xE3, 0xE7, 0xE0, 0xE7, 0xE0, 0xE7, 0xE0, 0xE7,
-    0xE0, 0xE7, 0xE3, 0xE7, 0xFF, 0xC7, 0x7F, 0x87, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0F,
-    0xF8, 0xFF, 0xCE, 0x3E, 0xE0, 0xEE, 0x06, 0xE0, 0x6E, 0x0E, 0xE3, 0xEF, 0xFC, 0x7F, 0x80, 0x7F,
-    0x0F, 0xFC, 0x63, 0xE0, 0x0E, 0x00, 0x70, 0x07, 0x1F, 0xF1, 0xFF, 0x00, 0x70, 0x07, 0x00, 0x70,
-    0x0E, 0x63, 0xEF, 0xFC, 0x7F, 0x00, 0xE0, 0x7F, 0x0E, 0x0F, 0xF8, 0xE1, 0xF3, 0xCE, 0x3C, 0x0E,
-    0xE3, 0x80, 0xEE, 0x38, 0x07, 0xFF, 0x80, 0x7F, 0xF8, 0x07, 0xE3, 0x80, 0x7E, 0x38, 0x07, 0xE3,
-    0x80, 0xEE, 0x1C, 0x0E, 0xE1, 0xF3, 0xCE, 0x0F, 0xFC, 0xE0, 0x7F, 0x00, 0x1F, 0xF3, 0xFF, 0x7C,
-    0x77, 0x07, 0x70, 0x77, 0x07, 0x7C, 0x73, 0xFF, 0x1F, 0xF1, 0xC7, 0x1C, 0x73, 0x87, 0x38, 0x77,
-    0x07, 0x70, 0x70, 0x3F, 0x0F, 0xE3, 0x3C, 0x07, 0x3F, 0xDF, 0xF7, 0x9D, 0x87, 0x71, 0xDF, 0xF3,
-    0xFC, 0x07, 0xC3, 0xF8, 0xFE, 0x38, 0x06, 0x01, 0xFF, 0x3F, 0xF7, 0x9E, 0xE0, 0xFC, 0x1F, 0x83,
-    0xF0, 0x7E, 0x1C, 0xF7, 0x9F, 0xE1, 0xF8, 0xFF, 0x3F, 0xEE, 0x3B, 0x8E, 0xFF, 0xBF, 0xEE, 0x3F,
-    0x87, 0xE3, 0xFF, 0xEF, 0xF0, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-    0x1F, 0xE0, 0xFF, 0x07, 0x38, 0x39, 0xC1, 0xCE, 0x0C, 0x70, 0xE3, 0x87, 0x1C, 0x70, 0xE7, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x7E, 0x03, 0xF0, 0x1C, 0x3F, 0x1F, 0xEF, 0x3F, 0x87, 0xFF, 0xFF, 0xFE, 0x03,
-    0x80, 0xF9, 0x9F, 0xE3, 0xF8, 0x71, 0x8E, 0x39, 0x9C, 0x39, 0x9C, 0x1D, 0xB8, 0x0F, 0xF0, 0x07,
-    0xE0, 0x0F, 0xF0, 0x1D, 0xB8, 0x39, 0x9C, 0x71, 0x8E, 0xE1, 0x87, 0x7F, 0x1F, 0xE6, 0x38, 0x0E,
-    0x3F, 0x0F, 0xE0, 0x38, 0x07, 0x63, 0xDF, 0xE7, 0xF0, 0xE1, 0xF8, 0xFE, 0x3F, 0x9F, 0xEE, 0xFB,
-    0x3F, 0xCF, 0xE3, 0xF0, 0xFC, 0x3E, 0x0C, 0x3B, 0x8F, 0xC1, 0xF0, 0x00, 0x00, 0x38, 0x7E, 0x3F,
-    0x8F, 0xE7, 0xFB, 0xBE, 0xCF, 0xF3, 0xF8, 0xFC, 0x3F, 0x0F, 0x83, 0xE3, 0xF9, 0xEE, 0x73, 0xB8,
-    0xFC, 0x3E, 0x0F, 0xE3, 0xBC, 0xE7, 0xB8, 0xEE, 0x1C, 0x1F, 0xE3, 0xFC, 0x71, 0x8E, 0x31, 0xC6,
-    0x38, 0xC6, 0x19, 0xC3, 0x78, 0x7E, 0x0F, 0x81, 0x80, 0x70, 0x3B, 0x83, 0xDE, 0x1E, 0xF1, 0xFF,
-    0xCF, 0xF6, 0xFF, 0xB6, 0xFC, 0xF3, 0xE7, 0x1F, 0x38, 0xF8, 0x06, 0xE1, 0xF8, 0x7E, 0x1F, 0x87,
-    0xFF, 0xFF, 0xFE, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1C, 0x3F, 0x0F, 0xF3, 0xEF, 0x70, 0xEE, 0x0F,
-    0xC1, 0xF8, 0x3F, 0x0E, 0xF3, 0xCF, 0xF0, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x1F, 0x87, 0xE1, 0xF8,
-    0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1C, 0xFF, 0x1F, 0xF3, 0x8F, 0x70, 0xEE, 0x0F, 0xC1, 0xF8,
-    0x3F, 0x0E, 0xF3, 0xDF, 0xF3, 0xFC, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x00, 0x3F, 0x3F, 0xBE, 0x5C,
-    0x0E, 0x07, 0x03, 0x81, 0xC0, 0xF9, 0x3F, 0xCF, 0xE0, 0xFF, 0xFF, 0xF0, 0xC0, 0x30, 0x0C, 0x03,
-    0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0xE0, 0xDC, 0x39, 0xC7, 0x38, 0xC7, 0x18, 0x77, 0x0E,
-    0xE0, 0xD8, 0x1F, 0x01, 0xC0, 0x38, 0x07, 0x01, 0xC1, 0xF8, 0x3E, 0x00, 0x03, 0x00, 0x06, 0x00,
-    0x0C, 0x00, 0x18, 0x00, 0x30, 0x03, 0xFC, 0x1F, 0xFE, 0x3D, 0xBE, 0xE3, 0x1D, 0xC6, 0x1B, 0x0C,
-    0x37, 0x18, 0x6E, 0x31, 0xCF, 0x6F, 0x9F, 0xFE, 0x0F, 0xF0, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00,
-    0x18, 0x00, 0xE1, 0xCE, 0x70, 0xEE, 0x0F, 0x81, 0xE0, 0x1C, 0x07, 0xC1, 0xF8, 0x73, 0x8E, 0x3B,
-    0x83, 0x00, 0xE1, 0xDC, 0x3B, 0x87, 0x70, 0xEE, 0x1D, 0xC3, 0xB8, 0x77, 0x0E, 0xE1, 0xDF, 0xFF,
-    0xFF, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x61, 0xD8, 0x76, 0x1D, 0x87, 0x71, 0xDF, 0xF3, 0xFC, 0x07,
-    0x01, 0xC0, 0x70, 0x1C, 0xE3, 0x8F, 0xC7, 0x1F, 0x8E, 0x3F, 0x1C, 0x7E, 0x38, 0xFC, 0x71, 0xF8,
-    0xE3, 0xF1, 0xC7, 0xE3, 0x8F, 0xFF, 0xFF, 0xFF, 0xF8, 0xE3, 0x8E, 0x71, 0xC7, 0x38, 0xE3, 0x9C,
-    0x71, 0xCE, 0x38, 0xE7, 0x1C, 0x73, 0x8E, 0x39, 0xC7, 0x1C, 0xE3, 0x8E, 0x7F, 0xFF, 0xBF, 0xFF,
-    0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0xF8, 0x0F, 0x80, 0x18, 0x01, 0xFE, 0x1F, 0xF1, 0xCF,
-    0x18, 0x71, 0x87, 0x1C, 0xF1, 0xFF, 0x1F, 0xE0, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xFF,
-    0x1F, 0xFE, 0x7E, 0x39, 0xF8, 0x77, 0xE3, 0x9F, 0xFE, 0x7F, 0xF1, 0xC0, 0xE0, 0x38, 0x0E, 0x03,
-    0xFC, 0xFF, 0xB8, 0xFE, 0x1F, 0x87, 0xE3, 0xFF, 0xEF, 0xF0, 0x7E, 0x1F, 0xC6, 0x78, 0x06, 0x1F,
-    0xC7, 0xF0, 0x1C, 0x0E, 0x47, 0xBF, 0xCF, 0xE0, 0xE1, 0xF9, 0xC7, 0xFB, 0x9E, 0x7F, 0x38, 0x7F,
-    0xE0, 0xFF, 0xC0, 0xF9, 0x83, 0xF3, 0x87, 0xE7, 0x9F, 0xC7, 0xFB, 0x87, 0xE0, 0x1F, 0xCF, 0xF7,
-    0x9D, 0xC3, 0x78, 0xDF, 0xF3, 0xFC, 0xE3, 0x30, 0xDC, 0x36, 0x0C, 0x18, 0x0F, 0x01, 0xC0, 0x30,
-    0x00, 0x0F, 0xC7, 0xFB, 0xCF, 0xE1, 0xFF, 0xFF, 0xFF, 0x80, 0xE0, 0x3E, 0x67, 0xF8, 0xFE, 0x33,
-    0x0C, 0xC0, 0x00, 0x00, 0x3F, 0x1F, 0xEF, 0x3F, 0x87, 0xFF, 0xFF, 0xFE, 0x03, 0x80, 0xF9, 0x9F,
-    0xE3, 0xF8, 0x70, 0x1F, 0xE3, 0xFC, 0x38, 0x07, 0x00, 0xFF, 0x1F, 0xF3, 0xCE, 0x70, 0xEE, 0x1D,
-    0xC3, 0xB8, 0x77, 0x0E, 0xE1, 0xDC, 0x3B, 0x87, 0x00, 0xE0, 0x1C, 0x0F, 0x01, 0xE0, 0x06, 0x0E,
-    0x1C, 0x18, 0x00, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x3F, 0xBF,
-    0xFC, 0x5C, 0x0F, 0xE7, 0xF3, 0x81, 0xC0, 0xF9, 0xBF, 0xCF, 0xE0, 0x3F, 0x3F, 0x9C, 0xCE, 0x07,
-    0xC1, 0xF8, 0x3E, 0x07, 0x47, 0xBF, 0xDF, 0xC0, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDC,
-    0x00, 0x03, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x00, 0x1C, 0x70, 0x00, 0x00,
-    0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0xFF, 0xBE, 0x1F, 0xE0, 0x07, 0xF8, 0x01,
-    0xC6, 0x00, 0x71, 0x80, 0x1C, 0x7F, 0x07, 0x1F, 0xE1, 0x86, 0x3C, 0xE1, 0x87, 0xF8, 0x63, 0xFC,
-    0x1F, 0xEE, 0x07, 0xF0, 0xE1, 0xC0, 0x70, 0xE0, 0x38, 0x70, 0x1C, 0x38, 0x0F, 0xFF, 0xE7, 0xFF,
-    0xFB, 0x87, 0x1D, 0xC3, 0x87, 0xE1, 0xC7, 0x70, 0xFF, 0xB8, 0x7F, 0x80, 0x70, 0x1F, 0xE3, 0xFC,
-    0x38, 0x07, 0x00, 0xFF, 0x1F, 0xF3, 0xCF, 0x70, 0xEE, 0x1D, 0xC3, 0xB8, 0x77, 0x0E, 0xE1, 0xDC,
-    0x3B, 0x87, 0x06, 0x03, 0xC0, 0xE0, 0x30, 0x00, 0x38, 0xFE, 0x7B, 0x9C, 0xEE, 0x3F, 0x0F, 0x83,
-    0xF8, 0xEF, 0x39, 0xEE, 0x3B, 0x87, 0x18, 0x07, 0x00, 0xE0, 0x18, 0x00, 0x38, 0x7E, 0x3F, 0x8F,
-    0xE7, 0xFB, 0xBE, 0xCF, 0xF3, 0xF8, 0xFC, 0x3F, 0x0F, 0x83, 0x3B, 0x87, 0xF0, 0x7C, 0x00, 0x00,
-    0x01, 0xC1, 0xB8, 0x73, 0x8E, 0x71, 0x8E, 0x30, 0xEE, 0x1D, 0xC1, 0xB0, 0x3E, 0x03, 0x80, 0x70,
-    0x0E, 0x03, 0x83, 0xF0, 0x7C, 0x00, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87,
-    0xE1, 0xFF, 0xFF, 0xFC, 0x30, 0x0C, 0x03, 0x00, 0x0E, 0x00, 0x1C, 0x03, 0xFF, 0x87, 0xFF, 0x00,
-    0xE0, 0x01, 0xC0, 0x03, 0xFC, 0x07, 0xFE, 0x0E, 0x7C, 0x1C, 0x1C, 0x38, 0x38, 0x70, 0x70, 0xE1,
-    0xE1, 0xC7, 0x83, 0xFF, 0x07, 0xF8, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x0F, 0xF8, 0xFF,
-    0x81, 0x80, 0x1F, 0xE1, 0xFF, 0x1C, 0xF1, 0x87, 0x18, 0x71, 0xCF, 0x1F, 0xF1, 0xFE, 0x0F, 0xE0,
-    0x7F, 0xE1, 0xF3, 0xE3, 0x81, 0xEE, 0x01, 0xDF, 0xC3, 0xBF, 0xE7, 0x79, 0xFE, 0xE1, 0xFD, 0xC0,
-    0x3B, 0x80, 0x73, 0x81, 0xE7, 0xCF, 0x87, 0xFE, 0x03, 0xF8, 0x00, 0x3F, 0x0F, 0xF3, 0xCF, 0x7C,
-    0xEF, 0xFF, 0xDF, 0xF9, 0xFF, 0x06, 0xFB, 0xCF, 0xF0, 0xFC, 0x00, 0xE0, 0x0F, 0x70, 0x0F, 0x9C,
-    0x0F, 0xCE, 0x07, 0x07, 0x03, 0x01, 0xC3, 0x80, 0xE1, 0xC0, 0x71, 0xC0, 0x1C, 0xE0, 0x0E, 0x60,
-    0x03, 0xF0, 0x01, 0xF8, 0x00, 0xF8, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0xE0, 0xFE, 0x0F, 0x71, 0xC7,
-    0x18, 0x73, 0x83, 0xB8, 0x3B, 0x01, 0xF0, 0x1F, 0x01, 0xE0, 0x0E, 0x00, 0x1D, 0xC0, 0x1F, 0x80,
-    0x3E, 0x00, 0x00, 0x0E, 0x03, 0x9C, 0x0F, 0x38, 0x1E, 0x70, 0x7C, 0xE1, 0xF9, 0xC7, 0x73, 0x8E,
-    0xE7, 0x39, 0xCE, 0xE3, 0x9F, 0xC7, 0x3F, 0x0E, 0x7C, 0x1C, 0xF8, 0x39, 0xE0, 0x7F, 0x80, 0xF8,
-    0x00, 0x60, 0x01, 0xC0, 0x03, 0x00, 0x0E, 0x00, 0x3B, 0x83, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x0E,
-    0x1C, 0xE3, 0xCE, 0x3C, 0xE7, 0xCE, 0xEC, 0xEC, 0xCF, 0xCC, 0xF8, 0xCF, 0x0C, 0xF0, 0xCE, 0x0F,
-    0x00, 0x70, 0x07, 0x00, 0xE0, 0x0C, 0x30, 0x01, 0x80, 0x3F, 0x81, 0xFC, 0x03, 0x00, 0x18, 0x00,
-    0xFF, 0x07, 0xFE, 0x39, 0xF1, 0x83, 0xCC, 0x0E, 0x60, 0x73, 0x07, 0x9C, 0xF8, 0xFF, 0xC7, 0xF8,
-    0xFE, 0x1F, 0xC1, 0xC0, 0x38, 0x07, 0xF8, 0xFF, 0x9C, 0x7B, 0x87, 0x71, 0xEF, 0xF8, 0xFE, 0x00,
-    0x7F, 0x8F, 0xFC, 0xE3, 0xEE, 0x0E, 0xE0, 0xEE, 0x6E, 0xE7, 0xEF, 0xFC, 0xFF, 0x8E, 0x18, 0xE1,
-    0xCE, 0x0C, 0xE0, 0x0E, 0x00, 0xE0, 0x00, 0xFF, 0x1F, 0xF3, 0x8F, 0x70, 0xEE, 0x0F, 0xC1, 0xF9,
-    0xBF, 0x3E, 0xF7, 0xDF, 0xF3, 0xFE, 0x70, 0xCE, 0x19, 0xC0, 0x38, 0x00, 0x01, 0xC0, 0x70, 0x1F,
-    0xFF, 0xFF, 0xF8, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80,
-    0xE0, 0x38, 0x00, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-    0xE0, 0x3F, 0xE7, 0xFC, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x3F, 0xC7, 0xF8, 0x30, 0x06, 0x00, 0xC0,
-    0x18, 0x03, 0x00, 0x60, 0x0C, 0x00, 0x7F, 0xBF, 0xDC, 0x0E, 0x07, 0x07, 0xF3, 0xF8, 0xE0, 0x70,
-    0x38, 0x1C, 0x00, 0xFF, 0xCF, 0xFC, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0x8F, 0xFC, 0xF3,
-    0xEE, 0x0E, 0xE0, 0x6E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0xE0, 0x0E, 0x03, 0xE0, 0xFC, 0x0F, 0x80,
-    0xFF, 0x3F, 0xCE, 0x03, 0x80, 0xFF, 0x3F, 0xEE, 0x3F, 0x87, 0xE1, 0xF8, 0x7E, 0x1C, 0x07, 0x03,
-    0x83, 0xE0, 0xF0, 0x70, 0xE1, 0xC7, 0x8E, 0x3C, 0x38, 0xE7, 0x81, 0xCE, 0x70, 0x0E, 0xEE, 0x00,
-    0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xFC, 0x00, 0xEE, 0xE0, 0x1C, 0xEF, 0x03, 0xCE,
-    0x78, 0x38, 0xE3, 0xC7, 0x0E, 0x1F, 0xF0, 0xE1, 0xF0, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07,
-    0x00, 0x00, 0x70, 0x71, 0x8E, 0x1C, 0xCE, 0x0E, 0x67, 0x03, 0xB7, 0x00, 0xFF, 0x00, 0x3F, 0x80,
-    0x3F, 0xE0, 0x3B, 0xF8, 0x39, 0x9E, 0x38, 0xC7, 0xF8, 0x61, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00,
-    0x1C, 0x7F, 0x8F, 0xF9, 0xCF, 0x00, 0x70, 0x0C, 0x07, 0x87, 0xE0, 0xFE, 0x03, 0xE0, 0x1C, 0x03,
-    0x80, 0x77, 0x3F, 0xFF, 0x9F, 0xE0, 0x70, 0x07, 0x03, 0xC0, 0x7F, 0x1F, 0xE6, 0x38, 0x0E, 0x3F,
-    0x0F, 0xE0, 0x38, 0x07, 0x63, 0x9F, 0xE7, 0xF0, 0x30, 0x0E, 0x0F, 0x80, 0xE0, 0xF7, 0x0F, 0x38,
-    0x71, 0xC7, 0x0E, 0x70, 0x77, 0x03, 0xF0, 0x1F, 0x80, 0xFE, 0x07, 0x78, 0x39, 0xE1, 0xC7, 0x8E,
-    0x1E, 0x70, 0x7F, 0x81, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0xE3, 0xDC, 0xF3, 0x9C, 0x77,
-    0x0F, 0xC1, 0xF0, 0x3F, 0x87, 0x78, 0xE7, 0x9C, 0x7F, 0x87, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x00,
-    0xE0, 0x3B, 0x81, 0xCE, 0x0F, 0x38, 0x38, 0xED, 0xC3, 0xBE, 0x0E, 0xF8, 0x3F, 0xC0, 0xFF, 0x83,
-    0xBF, 0x0E, 0xDE, 0x3B, 0x38, 0xE0, 0x73, 0x80, 0xEE, 0x03, 0x80, 0xE0, 0xEE, 0x1C, 0xE1, 0xCE,
-    0xF8, 0xEF, 0x0F, 0xE0, 0xEF, 0x0E, 0xF8, 0xE1, 0xCE, 0x0E, 0xE0, 0x70, 0x30, 0x38, 0xC1, 0xCF,
-    0xEE, 0x3F, 0xF0, 0x33, 0x80, 0xDC, 0x03, 0xF0, 0x0F, 0x80, 0x3F, 0x00, 0xCE, 0x03, 0x1C, 0x0C,
-    0x38, 0x30, 0x70, 0xC1, 0xE3, 0x03, 0x80, 0x70, 0xEF, 0xDC, 0x73, 0x87, 0x70, 0x7E, 0x07, 0xE0,
-    0x77, 0x07, 0x38, 0x73, 0xC7, 0x1E, 0x70, 0xE0, 0xFE, 0x0E, 0xFE, 0x1C, 0x0E, 0x38, 0x0E, 0x70,
-    0x0E, 0xE0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x0F, 0xC0, 0x0E, 0xE0, 0x0E, 0x70, 0x0E, 0x38,
-    0x0E, 0x1C, 0x0E, 0x1E, 0x0E, 0x0E, 0xF8, 0x77, 0xC7, 0x06, 0x70, 0x37, 0x01, 0xF0, 0x0F, 0x80,
-    0x7E, 0x03, 0x38, 0x18, 0xE0, 0xC3, 0x86, 0x1E, 0xE0, 0x33, 0x80, 0xCE, 0x03, 0x38, 0x0C, 0xE0,
-    0x33, 0x80, 0xCF, 0xFF, 0x3F, 0xFC, 0xE0, 0x33, 0x80, 0xCE, 0x03, 0x38, 0x0C, 0xE0, 0x33, 0x80,
-    0xFE, 0x03, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0xE1, 0xCE, 0x1C, 0xE1, 0xCE, 0x1C,
-    0xFF, 0xCF, 0xFC, 0xE1, 0xCE, 0x1C, 0xE1, 0xCE, 0x1E, 0xE1, 0xE0, 0x06, 0x00, 0x60, 0x06, 0xE0,
-    0x3F, 0xE0, 0x3F, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xFF, 0xF0, 0xFF, 0xF0, 0xE0,
-    0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE1, 0xFF, 0x0F,
-    0xF8, 0x71, 0xC3, 0x8F, 0xFC, 0x7F, 0xE3, 0x87, 0x1C, 0x38, 0xE1, 0xC7, 0x0E, 0x38, 0x70, 0xFF,
-    0xF0, 0x0F, 0xFF, 0x00, 0xE0, 0x70, 0x0E, 0x07, 0x00, 0xE0, 0x70, 0x0E, 0x07, 0x00, 0xE0, 0x7F,
-    0x8E, 0x07, 0xFE, 0xE0, 0x79, 0xEE, 0x07, 0x07, 0xE0, 0x70, 0x7E, 0x07, 0x07, 0xE0, 0x70, 0x7E,
-    0x07, 0x07, 0xE0, 0x70, 0x70, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0x80, 0xFF,
-    0xC0, 0x7F, 0xE0, 0x38, 0x70, 0x1C, 0x38, 0x0E, 0x1F, 0xE7, 0x0F, 0xFB, 0x87, 0x3D, 0xC3, 0x87,
-    0xE1, 0xC3, 0xF0, 0xE1, 0xF8, 0x70, 0xE0, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0x78, 0x0F,
-    0xE0, 0x7F, 0xC1, 0xF1, 0x83, 0x80, 0x0E, 0x1F, 0x9C, 0x7F, 0xB8, 0xF7, 0x71, 0x86, 0xE7, 0x0F,
-    0xCE, 0x1F, 0x9C, 0x33, 0x98, 0xE7, 0xFF, 0xC7, 0xFF, 0x03, 0xF8, 0x00, 0xE0, 0x00, 0xF8, 0x00,
-    0xF8, 0x00, 0xF0, 0x3E, 0x0F, 0xC3, 0xE0, 0x73, 0xEC, 0xFF, 0x9D, 0xF3, 0x1F, 0x67, 0xFF, 0xEF,
-    0xF8, 0xFE, 0x03, 0xC0, 0x3E, 0x03, 0xC0, 0x0F, 0xE3, 0xFF, 0x7C, 0x67, 0x00, 0xE0, 0x0E, 0x00,
-    0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x07, 0x00, 0x7C, 0x63, 0xFF, 0x1F, 0xE0, 0x70, 0x03,
-    0x80, 0xF0, 0x3F, 0x3F, 0xBE, 0x5C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xF9, 0x3F, 0xCF, 0xE1, 0x80,
-    0xE0, 0x70, 0xF8, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06,
-    0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x78, 0x07, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
-    0xFF, 0xFF, 0xF0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0xC0, 0xF0, 0x1C, 0x07,
-    0x01, 0xC0, 0xE0, 0x3B, 0x83, 0x9C, 0x38, 0x71, 0xC3, 0x9C, 0x0E, 0xE0, 0x7E, 0x01, 0xF0, 0x07,
-    0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0xDC, 0x39, 0xC7, 0x38,
-    0xE7, 0x38, 0x77, 0x0E, 0xC1, 0xF8, 0x1F, 0x03, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80,
-    0xE0, 0x3B, 0x83, 0x9C, 0x18, 0x71, 0xC3, 0x9C, 0x0E, 0xE0, 0x7E, 0x01, 0xF0, 0x0F, 0x01, 0xFF,
-    0x0F, 0xF8, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0xDC, 0x39, 0xC7, 0x38, 0xC7, 0x38,
-    0x77, 0x0E, 0xC0, 0xF8, 0x1E, 0x0F, 0xF1, 0xFE, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x79,
-    0xC1, 0xC3, 0x8E, 0x07, 0x78, 0x1F, 0xC0, 0x3E, 0x00, 0x78, 0x01, 0xE0, 0x0F, 0x80, 0x3F, 0x01,
-    0xDE, 0x0E, 0x38, 0x38, 0x71, 0xC1, 0xFE, 0x03, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0,
-    0xF1, 0xCE, 0x70, 0xEE, 0x0F, 0x81, 0xE0, 0x1C, 0x07, 0xC1, 0xFC, 0x73, 0x8E, 0x3F, 0x83, 0x80,
-    0x30, 0x06, 0x00, 0xC0, 0xFF, 0xE7, 0x3F, 0xF9, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03,
-    0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E,
-    0x07, 0x03, 0xFF, 0xF0, 0xFF, 0xFC, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x1C, 0xFF,
-    0x33, 0xFC, 0xC1, 0xC3, 0x07, 0x0C, 0x1C, 0x30, 0x70, 0xC1, 0xC3, 0x07, 0x0C, 0x1C, 0x30, 0x7F,
-    0xF1, 0xFF, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0xE0, 0xE7, 0x07, 0x38, 0x39, 0xC1, 0xCE, 0x0E,
-    0x70, 0x73, 0x83, 0x9E, 0x3C, 0x7F, 0xE1, 0xFF, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x7C, 0x03,
-    0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x61, 0xCC, 0x39, 0x87, 0x30, 0xE7, 0x1C, 0xFF, 0x8F,
-    0xF0, 0x0E, 0x01, 0xC0, 0x3C, 0x07, 0x80, 0x30, 0x06, 0x00, 0xC0, 0xE0, 0xFC, 0x1F, 0x83, 0xF0,
-    0x7E, 0x0F, 0xDD, 0xFB, 0xBF, 0xFF, 0x7F, 0xE7, 0xFC, 0x3B, 0x87, 0x70, 0xEE, 0x01, 0xC0, 0x38,
-    0xE1, 0xF8, 0x7E, 0x1F, 0xB7, 0x7D, 0xDF, 0xF3, 0xFC, 0x37, 0x0D, 0xC0, 0x70, 0x1C, 0xE0, 0x0E,
-    0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0F, 0xFC, 0xFF, 0xEF, 0x1E, 0xE0, 0xEE, 0x07, 0xE0, 0x7E, 0x07,
-    0xE0, 0x7E, 0x07, 0xE0, 0x70, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x3F, 0xCF, 0xFB, 0xCF, 0xE1,
-    0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0x01, 0xFC, 0x01, 0xFF, 0x01, 0xE7, 0xC1,
-    0xE0, 0xEC, 0xE0, 0x37, 0x70, 0x1F, 0xFF, 0xFE, 0xFF, 0xFF, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80,
-    0x01, 0xE0, 0x00, 0x7C, 0x60, 0x1F, 0xF8, 0x07, 0xF8, 0x07, 0xE0, 0x7F, 0xB3, 0xDF, 0xF8, 0x7F,
-    0xFF, 0xBF, 0xFC, 0x70, 0x03, 0x80, 0x0F, 0x10, 0x7F, 0x81, 0xFC, 0x01, 0xFC, 0x01, 0xFF, 0x01,
-    0xE7, 0xC1, 0xE0, 0xEC, 0xE0, 0x37, 0x70, 0x1F, 0xFF, 0xFE, 0xFF, 0xFF, 0x0E, 0x00, 0x07, 0x00,
-    0x03, 0x80, 0x01, 0xE0, 0x00, 0x7C, 0x60, 0x1F, 0xF8, 0x07, 0xF8, 0x00, 0xE0, 0x00, 0x70, 0x00,
-    0x38, 0x00, 0x1C, 0x00, 0x07, 0xE0, 0x7F, 0xB3, 0xDF, 0xF8, 0x7F, 0xFF, 0xBF, 0xFC, 0x70, 0x03,
-    0x80, 0x0F, 0x10, 0x7F, 0x80, 0xFC, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x03, 0xB8, 0x00, 0x7F, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0x0E, 0x1C, 0xF1, 0xC7, 0x8E,
-    0x38, 0xE0, 0xE7, 0x38, 0x0E, 0xEE, 0x01, 0xFF, 0x80, 0x1F, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0xC0,
-    0x1D, 0xDC, 0x07, 0x3B, 0xC1, 0xE7, 0x3C, 0x38, 0xE3, 0x8E, 0x1C, 0x3B, 0xC3, 0x87, 0x80, 0x06,
+static const uint8_t ubuntu_10_regularBitmaps[16645] = {
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0xE0, 0xF0, 0xE0, 0xEE,
+    0xEE, 0xEE, 0xEC, 0xEC, 0x1C, 0x60, 0x1C, 0xE0, 0x1C, 0xE0, 0x18, 0xE0, 0xFF, 0xF0, 0xFF, 0xF0,
+    0x38, 0xC0, 0x39, 0xC0, 0x31, 0xC0, 0xFF, 0xF0, 0xFF, 0xF0, 0x71, 0x80, 0x73, 0x80, 0x73, 0x80,
+    0x63, 0x80, 0x0C, 0x00, 0x0C, 0x00, 0x3F, 0x80, 0x7F, 0x80, 0xF1, 0x80, 0xE0, 0x00, 0xE0, 0x00,
+    0x78, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0x80, 0x01, 0xC0, 0x01, 0xC0, 0xE3, 0xC0, 0xFF, 0x80,
+    0xFF, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x7C, 0x38, 0xEE, 0x38, 0xC6, 0x70, 0xC6, 0x70,
+    0xC6, 0xE0, 0xEE, 0xC0, 0x7D, 0xC0, 0x01, 0x80, 0x03, 0xBE, 0x03, 0x77, 0x07, 0x63, 0x0E, 0x63,
+    0x0E, 0x63, 0x1C, 0x77, 0x1C, 0x3E, 0x0F, 0x80, 0x1F, 0xC0, 0x3D, 0xC0, 0x38, 0xC0, 0x39, 0xC0,
+    0x1B, 0x80, 0x1F, 0x80, 0x1E, 0x00, 0x3F, 0x18, 0x73, 0xB8, 0x61, 0xF0, 0x60, 0xF0, 0x78, 0xF0,
+    0x7F, 0xF8, 0x3F, 0x9C, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x1C, 0x1C, 0x38, 0x30, 0x70, 0x70, 0x60,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x60, 0x70, 0x70, 0x30, 0x38, 0x1C, 0x1C, 0xC0, 0xE0, 0x70,
+    0x70, 0x38, 0x38, 0x38, 0x18, 0x18, 0x1C, 0x1C, 0x18, 0x18, 0x38, 0x38, 0x38, 0x70, 0x70, 0xE0,
+    0xC0, 0x0C, 0x00, 0x0C, 0x00, 0x6D, 0x80, 0x7F, 0x80, 0x1E, 0x00, 0x1E, 0x00, 0x3F, 0x00, 0x33,
+    0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x0C, 0x00, 0x0C,
+    0x00, 0x0C, 0x00, 0x0C, 0x00, 0x70, 0x70, 0x70, 0x60, 0x60, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0x01,
+    0xC0, 0x01, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x00, 0x07, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0E,
+    0x00, 0x0E, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x38, 0x00, 0x30, 0x00, 0x70,
+    0x00, 0x70, 0x00, 0x60, 0x00, 0xE0, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0x73, 0x80, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xC1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0x73,
+    0x80, 0x7F, 0x80, 0x3F, 0x00, 0x0E, 0x1E, 0x7E, 0x7E, 0x7E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+    0x0E, 0x0E, 0x0E, 0x0E, 0x7E, 0x00, 0xFF, 0x00, 0xE7, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+    0x07, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xFF, 0xC0,
+    0xFF, 0xC0, 0x7E, 0x00, 0xFF, 0x00, 0x67, 0x80, 0x03, 0x80, 0x03, 0x80, 0x07, 0x80, 0x3F, 0x00,
+    0x3F, 0x00, 0x07, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x01, 0xC0, 0xC7, 0x80, 0xFF, 0x80, 0xFE, 0x00,
+    0x03, 0xC0, 0x03, 0xC0, 0x07, 0xC0, 0x0F, 0xC0, 0x1D, 0xC0, 0x1D, 0xC0, 0x39, 0xC0, 0x71, 0xC0,
+    0x61, 0xC0, 0xFF, 0xE0, 0xFF, 0xE0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x7F, 0x80,
+    0x7F, 0x80, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x1F, 0x80, 0x03, 0x80,
+    0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0xE7, 0x80, 0xFF, 0x80, 0xFE, 0x00, 0x07, 0x80, 0x1F, 0x80,
+    0x3F, 0x00, 0x70, 0x00, 0x60, 0x00, 0xFF, 0x00, 0xFF, 0x80, 0xF3, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0,
+    0xE1, 0xC0, 0xE1, 0xC0, 0x73, 0xC0, 0x7F, 0x80, 0x3F, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x01, 0xC0,
+    0x03, 0x80, 0x07, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x1C, 0x00, 0x1C, 0x00,
+    0x18, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0xF3, 0x80, 0xE1, 0xC0,
+    0xE1, 0xC0, 0xF3, 0x80, 0x7F, 0x80, 0x3F, 0x00, 0x7F, 0x80, 0xE3, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0,
+    0xF3, 0xC0, 0x7F, 0x80, 0x3F, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0xF7, 0x80, 0xE1, 0xC0, 0xE1, 0xC0,
+    0xE1, 0xC0, 0xF3, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x01, 0x80, 0x03, 0x80, 0x07, 0x80, 0x1F, 0x00,
+    0x7E, 0x00, 0x78, 0x00, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0x70,
+    0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x60, 0x60, 0x01, 0xC0, 0x0F,
+    0xC0, 0x7F, 0x80, 0xFC, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xC0, 0x01, 0xC0, 0xFF,
+    0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xFC,
+    0x00, 0x7F, 0x80, 0x0F, 0xC0, 0x03, 0xC0, 0x0F, 0xC0, 0x7F, 0x80, 0xFC, 0x00, 0xE0, 0x00, 0xFE,
+    0xFF, 0x6F, 0x07, 0x07, 0x06, 0x0E, 0x1C, 0x38, 0x38, 0x00, 0x00, 0x38, 0x38, 0x38, 0x07, 0xF8,
+    0x00, 0x0F, 0xFE, 0x00, 0x1F, 0x3F, 0x00, 0x38, 0x07, 0x00, 0x70, 0x03, 0x80, 0x71, 0xF9, 0x80,
+    0xE7, 0xF9, 0xC0, 0xE7, 0xB9, 0xC0, 0xE6, 0x19, 0xC0, 0xEE, 0x19, 0xC0, 0xEE, 0x19, 0xC0, 0xEE,
+    0x19, 0xC0, 0xE7, 0xBB, 0x80, 0xE7, 0xFF, 0x80, 0x73, 0xFF, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00,
+    0x00, 0x1F, 0x18, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0x00, 0x07, 0x80, 0x07, 0x80,
+    0x0F, 0xC0, 0x0D, 0xC0, 0x1C, 0xC0, 0x1C, 0xE0, 0x18, 0x60, 0x38, 0x70, 0x3F, 0xF0, 0x7F, 0xF0,
+    0x70, 0x38, 0x60, 0x38, 0xE0, 0x1C, 0xE0, 0x1C, 0x7F, 0x80, 0xFF, 0xC0, 0xE3, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE3, 0xE0, 0xFF, 0xC0, 0xFF, 0xE0, 0xE1, 0xE0, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70,
+    0xE1, 0xE0, 0xFF, 0xE0, 0x7F, 0x80, 0x0F, 0xE0, 0x3F, 0xF0, 0x7C, 0x60, 0x70, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x7C, 0x60,
+    0x3F, 0xF0, 0x0F, 0xE0, 0x7F, 0x80, 0xFF, 0xE0, 0xE3, 0xF0, 0xE0, 0x70, 0xE0, 0x78, 0xE0, 0x38,
+    0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x70, 0xE3, 0xF0, 0xFF, 0xE0,
+    0x7F, 0x80, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0x80,
+    0xFF, 0x80, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0,
+    0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0x80, 0xFF, 0x80,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x0F, 0xE0,
+    0x3F, 0xF0, 0x7C, 0x70, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x70,
+    0xE0, 0x70, 0xE0, 0x70, 0x70, 0x70, 0x7C, 0x70, 0x3F, 0xF0, 0x0F, 0xF0, 0xE0, 0x30, 0xE0, 0x30,
+    0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xFF, 0xF0, 0xFF, 0xF0, 0xE0, 0x30, 0xE0, 0x30,
+    0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03,
+    0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03,
+    0x80, 0xE7, 0x80, 0xFF, 0x00, 0x7E, 0x00, 0xE0, 0xF0, 0xE0, 0xE0, 0xE1, 0xC0, 0xE3, 0x80, 0xE7,
+    0x00, 0xEE, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xEF, 0x00, 0xE7, 0x80, 0xE3, 0xC0, 0xE1,
+    0xE0, 0xE0, 0xF0, 0xE0, 0x70, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF,
+    0xC0, 0xFF, 0xC0, 0x70, 0x0E, 0x70, 0x0E, 0x78, 0x1E, 0x78, 0x1F, 0x6C, 0x3F, 0x6C, 0x37, 0x66,
+    0x37, 0xE6, 0x67, 0xE7, 0x67, 0xE3, 0xE7, 0xE3, 0xC7, 0xE3, 0xC7, 0xE1, 0xC7, 0xE0, 0x07, 0xE0,
+    0x03, 0xE0, 0x38, 0xF0, 0x38, 0xF8, 0x38, 0xFC, 0x38, 0xFC, 0x38, 0xEE, 0x38, 0xE7, 0x38, 0xE3,
+    0xB8, 0xE3, 0xB8, 0xE1, 0xF8, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0x78, 0xE0, 0x78, 0xE0, 0x38, 0x0F,
+    0xE0, 0x3F, 0xF0, 0x7C, 0xF8, 0x70, 0x3C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x0C, 0xE0,
+    0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0x70, 0x3C, 0x7C, 0xF8, 0x3F, 0xF0, 0x0F, 0xE0, 0x7F, 0x80, 0xFF,
+    0xC0, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE0, 0xFF, 0xC0, 0xFF, 0x80, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x7C,
+    0xF8, 0x70, 0x3C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x0C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0,
+    0x1C, 0x70, 0x3C, 0x7C, 0xF8, 0x3F, 0xF0, 0x0F, 0xE0, 0x03, 0x80, 0x01, 0xF0, 0x00, 0xF8, 0x00,
+    0x78, 0x7F, 0x80, 0xFF, 0xC0, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE0, 0xFF,
+    0xC0, 0xFF, 0x80, 0xE3, 0x80, 0xE3, 0xC0, 0xE1, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x70, 0x1F,
+    0xC0, 0x7F, 0xC0, 0x79, 0xC0, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07,
+    0xC0, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x73, 0xE0, 0xFF, 0xC0, 0x7F, 0x80, 0xFF, 0xF0, 0xFF,
+    0xF0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06,
+    0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
+    0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
+    0x70, 0x70, 0x70, 0x79, 0xE0, 0x3F, 0xE0, 0x1F, 0xC0, 0xE0, 0x1C, 0xE0, 0x38, 0x70, 0x38, 0x70,
+    0x38, 0x70, 0x70, 0x38, 0x70, 0x38, 0x70, 0x38, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x0F, 0xC0, 0x0F,
+    0xC0, 0x0F, 0x80, 0x07, 0x80, 0x07, 0x00, 0xE0, 0x00, 0xE0, 0xE0, 0x00, 0xE0, 0x70, 0xE0, 0xE0,
+    0x70, 0xF0, 0xE0, 0x70, 0xF0, 0xC0, 0x71, 0xF1, 0xC0, 0x71, 0xF9, 0xC0, 0x39, 0xB9, 0xC0, 0x3B,
+    0x99, 0xC0, 0x3B, 0x9D, 0x80, 0x3B, 0x1F, 0x80, 0x1F, 0x0F, 0x80, 0x1F, 0x0F, 0x80, 0x1E, 0x0F,
+    0x00, 0x0E, 0x07, 0x00, 0x70, 0x78, 0x70, 0x70, 0x38, 0xE0, 0x1D, 0xE0, 0x1D, 0xC0, 0x0F, 0x80,
+    0x07, 0x80, 0x07, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x1D, 0xC0, 0x38, 0xE0, 0x38, 0x70, 0x70, 0x70,
+    0xE0, 0x38, 0xE0, 0x38, 0x70, 0x70, 0x70, 0xE0, 0x38, 0xE0, 0x39, 0xC0, 0x1D, 0xC0, 0x1F, 0x80,
+    0x0F, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+    0x7F, 0xE0, 0x7F, 0xE0, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x80, 0x07, 0x00, 0x0E, 0x00,
+    0x1C, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0x70, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xF8, 0xF8,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xF8, 0xF8, 0xE0, 0x00, 0x60, 0x00, 0x70, 0x00, 0x70, 0x00, 0x30, 0x00, 0x38, 0x00, 0x38, 0x00,
+    0x18, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x07, 0x00, 0x07, 0x00,
+    0x03, 0x00, 0x03, 0x80, 0x03, 0x80, 0x01, 0x80, 0x01, 0xC0, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xF8, 0xF8, 0x0E, 0x00,
+    0x0F, 0x00, 0x1F, 0x80, 0x1B, 0x80, 0x39, 0xC0, 0x31, 0xC0, 0x70, 0xE0, 0x60, 0x60, 0x7F, 0xF0,
+    0x7F, 0xF0, 0xC0, 0xE0, 0x70, 0x30, 0x3F, 0x00, 0x3F, 0x80, 0x33, 0xC0, 0x01, 0xC0, 0x3F, 0xC0,
+    0x7F, 0xC0, 0x79, 0xC0, 0x61, 0xC0, 0x71, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0x00, 0xFF, 0x80, 0xF3, 0xC0, 0xE1, 0xC0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xC0, 0xE3, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0x3F, 0x00, 0x7F, 0x00,
+    0xF9, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF9, 0x00, 0x7F, 0x80,
+    0x3F, 0x80, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0,
+    0xF3, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xF9, 0xC0, 0x7F, 0xC0,
+    0x3F, 0xC0, 0x3F, 0x00, 0x7F, 0x80, 0xF3, 0xC0, 0xE1, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00,
+    0xE0, 0x00, 0xF9, 0x80, 0x7F, 0x80, 0x3F, 0x80, 0x3F, 0x7E, 0x72, 0xE0, 0xE0, 0xFE, 0xFE, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x3F, 0xC0, 0x7F, 0xC0, 0xF9, 0xC0, 0xE1, 0xC0,
+    0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xF3, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x01, 0xC0,
+    0x63, 0x80, 0xFF, 0x80, 0xFF, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xFF, 0x00, 0xFF, 0x80, 0xF3, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0,
+    0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x3C, 0xF8, 0xF8, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE3, 0x80, 0xE7, 0x00, 0xEF, 0x00, 0xEE, 0x00, 0xFC, 0x00, 0xF8, 0x00,
+    0xFC, 0x00, 0xEE, 0x00, 0xE7, 0x00, 0xE3, 0x80, 0xE1, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0x78, 0x70, 0xFF, 0xFC, 0xFF, 0xFE, 0xE7, 0xCF,
+    0xE3, 0x87, 0xE1, 0x87, 0xE1, 0x87, 0xE1, 0x87, 0xE1, 0x87, 0xE1, 0x87, 0xE1, 0x87, 0xE1, 0x87,
+    0xFF, 0x00, 0xFF, 0x80, 0xE3, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0,
+    0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0x3F, 0x00, 0x7F, 0x80, 0xFB, 0xC0, 0xE1, 0xC0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xC0, 0xF3, 0xC0, 0x7F, 0x80, 0x3F, 0x00, 0xFF, 0x00, 0xFF, 0x80,
+    0xE3, 0xC0, 0xE1, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xC0, 0xF3, 0xC0, 0xFF, 0x80,
+    0xFF, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0xF9, 0xC0,
+    0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xF3, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0,
+    0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x7E, 0xFE, 0xE2, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0x3F, 0x00, 0x7F, 0x00, 0x73, 0x00, 0x70, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x0F,
+    0x80, 0x03, 0x80, 0x47, 0x80, 0x7F, 0x80, 0x7F, 0x00, 0xE0, 0xE0, 0xE0, 0xFE, 0xFE, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xF2, 0x7E, 0x7E, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0x71, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0xE0, 0xC0, 0xE1,
+    0xC0, 0x61, 0xC0, 0x71, 0xC0, 0x73, 0x80, 0x33, 0x80, 0x3B, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1E,
+    0x00, 0x0E, 0x00, 0xE1, 0xC7, 0xE1, 0xC7, 0x63, 0xC7, 0x73, 0xC6, 0x73, 0xEE, 0x33, 0xEE, 0x3F,
+    0x6C, 0x3E, 0x7C, 0x1E, 0x7C, 0x1E, 0x38, 0x1C, 0x38, 0xE1, 0xC0, 0x73, 0x80, 0x3B, 0x80, 0x1F,
+    0x00, 0x1E, 0x00, 0x0E, 0x00, 0x1F, 0x00, 0x3F, 0x00, 0x73, 0x80, 0x71, 0xC0, 0xE0, 0xC0, 0xE0,
+    0xC0, 0xE1, 0xC0, 0x71, 0xC0, 0x71, 0x80, 0x71, 0x80, 0x3B, 0x80, 0x3B, 0x80, 0x1B, 0x00, 0x1F,
+    0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x7F, 0x80, 0x7F,
+    0x80, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x78, 0x00, 0x70, 0x00, 0xFF,
+    0x80, 0xFF, 0x80, 0x0E, 0x1E, 0x1C, 0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0xF0, 0xF8, 0x78, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x1C, 0x1E, 0x0E, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xF0, 0x70, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x3C, 0x1E, 0x3E, 0x3C, 0x38, 0x38, 0x38, 0x38, 0x38, 0x70, 0xF0, 0xE0, 0x3C,
+    0x60, 0x7F, 0xE0, 0x6F, 0xE0, 0x63, 0xC0, 0xE0, 0xF0, 0xE0, 0x00, 0x00, 0x60, 0x60, 0x60, 0x60,
+    0x60, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1F, 0x80, 0x3F, 0x80,
+    0x79, 0x80, 0x70, 0x00, 0x60, 0x00, 0xE0, 0x00, 0x60, 0x00, 0x70, 0x00, 0x78, 0x80, 0x3F, 0x80,
+    0x1F, 0x80, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x3C, 0x80, 0x38, 0x00,
+    0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x60, 0x60, 0x7F, 0xE0, 0x3F, 0xC0, 0x39, 0xC0, 0x30, 0xC0,
+    0x30, 0xC0, 0x39, 0xC0, 0x3F, 0xC0, 0x7F, 0xE0, 0x60, 0x60, 0xE0, 0x70, 0x70, 0xE0, 0x70, 0xE0,
+    0x39, 0xC0, 0x1B, 0x80, 0x1F, 0x80, 0x0F, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x06, 0x00, 0x06, 0x00,
+    0x7F, 0xE0, 0x7F, 0xE0, 0x06, 0x00, 0x06, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x1F, 0x80, 0x3F, 0x80,
+    0x79, 0x80, 0x70, 0x00, 0x38, 0x00, 0x3E, 0x00, 0x7F, 0x80, 0x63, 0xC0, 0x61, 0xC0, 0x61, 0xC0,
+    0x79, 0x80, 0x3F, 0x80, 0x1F, 0x00, 0x03, 0x80, 0x01, 0x80, 0x63, 0x80, 0x7F, 0x80, 0x7F, 0x00,
+    0x66, 0x66, 0x0F, 0xE0, 0x1F, 0xF8, 0x3C, 0x78, 0x70, 0x1C, 0x67, 0xEE, 0xEE, 0x4E, 0xCC, 0x06,
+    0xDC, 0x06, 0xCC, 0x06, 0xEE, 0x4E, 0x67, 0xEE, 0x70, 0x1C, 0x3C, 0x78, 0x1F, 0xF8, 0x0F, 0xE0,
+    0x7C, 0x2E, 0x06, 0x7E, 0x66, 0xE6, 0x66, 0x7E, 0x19, 0xC0, 0x39, 0xC0, 0x3B, 0x80, 0x77, 0x00,
+    0xE7, 0x00, 0x77, 0x00, 0x3B, 0x80, 0x39, 0xC0, 0x19, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xC0,
+    0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0xFC, 0xFC, 0x0F, 0xE0, 0x1F, 0xF8,
+    0x3C, 0x78, 0x70, 0x1C, 0x6F, 0xCE, 0xEC, 0xEE, 0xCC, 0xE6, 0xCF, 0xC6, 0xCD, 0xC6, 0xEC, 0xEE,
+    0x6C, 0x6E, 0x70, 0x1C, 0x3C, 0x78, 0x1F, 0xF8, 0x0F, 0xE0, 0x7E, 0x7E, 0x7C, 0x7C, 0xEE, 0xEE,
+    0x7C, 0x7C, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x0C, 0x00,
+    0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x7C, 0x6C, 0x0E, 0x1C,
+    0x3C, 0x78, 0x60, 0x7E, 0x7C, 0x6C, 0x0C, 0x3C, 0x0E, 0x06, 0x4E, 0xFC, 0x38, 0x38, 0x70, 0x60,
+    0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0,
+    0xF9, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x1F, 0xF0,
+    0x3F, 0x70, 0x7F, 0x70, 0x7F, 0x70, 0x7F, 0x70, 0x7F, 0x70, 0x7F, 0x70, 0x7F, 0x70, 0x3F, 0x70,
+    0x0F, 0x70, 0x07, 0x70, 0x07, 0x70, 0x07, 0x70, 0x07, 0x70, 0x07, 0x70, 0x07, 0x70, 0x07, 0x70,
+    0x07, 0x70, 0x07, 0x70, 0xE0, 0xE0, 0xE0, 0x30, 0x70, 0x38, 0xF0, 0x30, 0xF0, 0xF0, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x3E, 0x00, 0x77, 0x00, 0x63, 0x80, 0x63, 0x80, 0x63, 0x80, 0x63, 0x80, 0x77,
+    0x00, 0x3E, 0x00, 0x66, 0x00, 0x77, 0x00, 0x33, 0x80, 0x39, 0xC0, 0x1D, 0xC0, 0x39, 0xC0, 0x33,
+    0x80, 0x77, 0x00, 0x66, 0x00, 0x30, 0x18, 0x00, 0xF0, 0x38, 0x00, 0xF0, 0x30, 0x00, 0x30, 0x70,
+    0x00, 0x30, 0xE0, 0x00, 0x30, 0xE0, 0x00, 0x31, 0xC0, 0x00, 0x31, 0x87, 0x00, 0x03, 0x87, 0x00,
+    0x03, 0x0F, 0x00, 0x07, 0x1B, 0x00, 0x06, 0x3B, 0x00, 0x0E, 0x3F, 0x80, 0x0C, 0x03, 0x00, 0x1C,
+    0x03, 0x00, 0x30, 0x38, 0x00, 0xF0, 0x30, 0x00, 0xF0, 0x70, 0x00, 0x30, 0x60, 0x00, 0x30, 0xE0,
+    0x00, 0x31, 0xC0, 0x00, 0x31, 0xC0, 0x00, 0x33, 0x9F, 0x00, 0x03, 0x3B, 0x00, 0x07, 0x03, 0x00,
+    0x06, 0x07, 0x00, 0x0E, 0x0E, 0x00, 0x0C, 0x1C, 0x00, 0x1C, 0x18, 0x00, 0x18, 0x3F, 0x80, 0x7C,
+    0x0E, 0x00, 0x6C, 0x1C, 0x00, 0x0C, 0x1C, 0x00, 0x3C, 0x38, 0x00, 0x0E, 0x30, 0x00, 0x06, 0x70,
+    0x00, 0x4E, 0x60, 0x00, 0xFC, 0xE3, 0x80, 0x00, 0xC3, 0x80, 0x01, 0xC7, 0x80, 0x03, 0x8D, 0x80,
+    0x03, 0x9D, 0x80, 0x07, 0x1F, 0xC0, 0x06, 0x01, 0x80, 0x0E, 0x01, 0x80, 0x1C, 0x00, 0x1E, 0x00,
+    0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00,
+    0x60, 0x00, 0xE0, 0x00, 0xF3, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x06, 0x00, 0x0F, 0x00, 0x07, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x80, 0x07, 0x80, 0x0F, 0xC0, 0x0D, 0xC0, 0x1C, 0xC0,
+    0x1C, 0xE0, 0x18, 0x60, 0x38, 0x70, 0x3F, 0xF0, 0x7F, 0xF0, 0x70, 0x38, 0x60, 0x38, 0xE0, 0x1C,
+    0xE0, 0x1C, 0x01, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x80,
+    0x07, 0x80, 0x0F, 0xC0, 0x0D, 0xC0, 0x1C, 0xC0, 0x1C, 0xE0, 0x18, 0x60, 0x38, 0x70, 0x3F, 0xF0,
+    0x7F, 0xF0, 0x70, 0x38, 0x60, 0x38, 0xE0, 0x1C, 0xE0, 0x1C, 0x03, 0x00, 0x07, 0x80, 0x0F, 0xC0,
+    0x0C, 0xC0, 0x00, 0x00, 0x07, 0x00, 0x07, 0x80, 0x07, 0x80, 0x0F, 0xC0, 0x0D, 0xC0, 0x1C, 0xC0,
+    0x1C, 0xE0, 0x18, 0x60, 0x38, 0x70, 0x3F, 0xF0, 0x7F, 0xF0, 0x70, 0x38, 0x60, 0x38, 0xE0, 0x1C,
+    0xE0, 0x1C, 0x0F, 0x60, 0x0F, 0xC0, 0x1B, 0xC0, 0x00, 0x00, 0x07, 0x00, 0x07, 0x80, 0x07, 0x80,
+    0x0F, 0xC0, 0x0D, 0xC0, 0x1C, 0xC0, 0x1C, 0xE0, 0x18, 0x60, 0x38, 0x70, 0x3F, 0xF0, 0x7F, 0xF0,
+    0x70, 0x38, 0x60, 0x38, 0xE0, 0x1C, 0xE0, 0x1C, 0x0C, 0xC0, 0x0C, 0xC0, 0x00, 0x00, 0x07, 0x00,
+    0x07, 0x80, 0x07, 0x80, 0x0F, 0xC0, 0x0D, 0xC0, 0x1C, 0xC0, 0x1C, 0xE0, 0x18, 0x60, 0x38, 0x70,
+    0x3F, 0xF0, 0x7F, 0xF0, 0x70, 0x38, 0x60, 0x38, 0xE0, 0x1C, 0xE0, 0x1C, 0x07, 0x80, 0x07, 0x80,
+    0x0D, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x0F, 0xC0, 0x0F, 0xC0, 0x1C, 0xC0, 0x1C, 0xE0,
+    0x18, 0xE0, 0x38, 0x70, 0x3F, 0xF0, 0x7F, 0xF0, 0x70, 0x38, 0x60, 0x38, 0xE0, 0x1C, 0xE0, 0x1C,
+    0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x01, 0xF0, 0x00, 0x03, 0xB0, 0x00, 0x03, 0xB0, 0x00, 0x07,
+    0x30, 0x00, 0x06, 0x3F, 0xC0, 0x0E, 0x3F, 0xC0, 0x1C, 0x30, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xF0,
+    0x00, 0x30, 0x30, 0x00, 0x70, 0x30, 0x00, 0x60, 0x3F, 0xE0, 0xE0, 0x3F, 0xE0, 0x0F, 0xE0, 0x3F,
+    0xF0, 0x7C, 0x60, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0x70, 0x00, 0x7C, 0x60, 0x3F, 0xF0, 0x1F, 0xE0, 0x07, 0x00, 0x03, 0x80, 0x0F,
+    0x00, 0x18, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0x03, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x0C,
+    0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF,
+    0x80, 0xFF, 0x80, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xE0, 0xFF,
+    0xE0, 0x0C, 0x00, 0x1E, 0x00, 0x3F, 0x00, 0x33, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0x3B, 0x80, 0x3B, 0x80, 0x00, 0x00, 0xFF,
+    0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xC0, 0xE0, 0x70,
+    0x30, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x70, 0x30, 0x70, 0xE0, 0xC0, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x18, 0x3C, 0x7E, 0x66, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0xEE, 0xEE, 0x00, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3F, 0xC0, 0x3F, 0xF0, 0x38,
+    0xF8, 0x30, 0x38, 0x30, 0x1C, 0x30, 0x1C, 0xFE, 0x1C, 0xFE, 0x1C, 0x30, 0x1C, 0x30, 0x1C, 0x30,
+    0x1C, 0x30, 0x38, 0x38, 0xF8, 0x3F, 0xF0, 0x3F, 0xC0, 0x0F, 0xC0, 0x1F, 0xC0, 0x1B, 0x80, 0x00,
+    0x00, 0xE0, 0x38, 0xF0, 0x38, 0xF8, 0x38, 0xFC, 0x38, 0xFC, 0x38, 0xEE, 0x38, 0xE7, 0x38, 0xE3,
+    0xB8, 0xE3, 0xB8, 0xE1, 0xF8, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0x78, 0xE0, 0x78, 0xE0, 0x38, 0x06,
+    0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x7C, 0xF8, 0x70,
+    0x3C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x0C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0x70,
+    0x3C, 0x7C, 0xF8, 0x3F, 0xF0, 0x0F, 0xE0, 0x00, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x03, 0x00, 0x00,
+    0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x7C, 0xF8, 0x70, 0x3C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0,
+    0x0C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0x70, 0x3C, 0x7C, 0xF8, 0x3F, 0xF0, 0x0F, 0xE0, 0x03,
+    0x00, 0x07, 0x80, 0x0F, 0xC0, 0x0C, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x7C, 0xF8, 0x70,
+    0x3C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x0C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0x70,
+    0x3C, 0x7C, 0xF8, 0x3F, 0xF0, 0x0F, 0xE0, 0x0F, 0x60, 0x0F, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x0F,
+    0xE0, 0x3F, 0xF0, 0x7C, 0xF8, 0x70, 0x3C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x0C, 0xE0,
+    0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0x70, 0x3C, 0x7C, 0xF8, 0x3F, 0xF0, 0x0F, 0xE0, 0x0E, 0xE0, 0x0E,
+    0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x7C, 0xF8, 0x70, 0x3C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0,
+    0x1C, 0xE0, 0x0C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0x70, 0x3C, 0x7C, 0xF8, 0x3F, 0xF0, 0x0F,
+    0xE0, 0x41, 0x00, 0x63, 0x80, 0x7F, 0x80, 0x3F, 0x00, 0x1E, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0x63,
+    0x80, 0x41, 0x00, 0x0F, 0xFC, 0x3F, 0xFC, 0x7C, 0xF8, 0x70, 0x7C, 0xE0, 0xFC, 0xE1, 0xDC, 0xE1,
+    0xDC, 0xE3, 0x8C, 0xE7, 0x0C, 0xEE, 0x1C, 0xFC, 0x1C, 0x78, 0x3C, 0x7C, 0xF8, 0x7F, 0xF0, 0x6F,
+    0xE0, 0x0C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
+    0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
+    0x70, 0x70, 0x70, 0x79, 0xE0, 0x3F, 0xE0, 0x1F, 0xC0, 0x01, 0x80, 0x03, 0x80, 0x07, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
+    0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0x70, 0x70, 0x79, 0xE0, 0x3F, 0xE0, 0x1F,
+    0xC0, 0x06, 0x00, 0x0F, 0x00, 0x1F, 0x80, 0x19, 0x80, 0x00, 0x00, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
+    0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
+    0x70, 0x70, 0x70, 0x79, 0xE0, 0x3F, 0xE0, 0x1F, 0xC0, 0x1D, 0xC0, 0x1D, 0xC0, 0x00, 0x00, 0xE0,
+    0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
+    0x70, 0xE0, 0x70, 0xE0, 0x70, 0x70, 0x70, 0x79, 0xE0, 0x3F, 0xE0, 0x1F, 0xC0, 0x01, 0x80, 0x03,
+    0x80, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x70, 0x70, 0x70, 0xE0, 0x38, 0xE0, 0x39,
+    0xC0, 0x1D, 0xC0, 0x1F, 0x80, 0x0F, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xE3, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE0, 0xFF, 0xC0, 0xFF, 0x80, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0x7B, 0xC0, 0xE1, 0xC0, 0xE1, 0x80, 0xE3, 0x80, 0xE7,
+    0x00, 0xE6, 0x00, 0xEF, 0x00, 0xE7, 0xC0, 0xE3, 0xE0, 0xE1, 0xE0, 0xE0, 0x70, 0xEC, 0xF0, 0xEF,
+    0xE0, 0xEF, 0xC0, 0x18, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F,
+    0x80, 0x33, 0xC0, 0x01, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0x79, 0xC0, 0x61, 0xC0, 0x71, 0xC0, 0x7F,
+    0xC0, 0x3F, 0xC0, 0x03, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F,
+    0x80, 0x33, 0xC0, 0x01, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0x79, 0xC0, 0x61, 0xC0, 0x71, 0xC0, 0x7F,
+    0xC0, 0x3F, 0xC0, 0x04, 0x00, 0x0E, 0x00, 0x1F, 0x00, 0x19, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F,
+    0x80, 0x33, 0xC0, 0x01, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0x79, 0xC0, 0x61, 0xC0, 0x71, 0xC0, 0x7F,
+    0xC0, 0x3F, 0xC0, 0x1D, 0x80, 0x3F, 0x80, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F,
+    0x80, 0x33, 0xC0, 0x01, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0x79, 0xC0, 0x61, 0xC0, 0x71, 0xC0, 0x7F,
+    0xC0, 0x3F, 0xC0, 0x3B, 0x80, 0x3B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x33,
+    0xC0, 0x01, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0x79, 0xC0, 0x61, 0xC0, 0x71, 0xC0, 0x7F, 0xC0, 0x3F,
+    0xC0, 0x0E, 0x00, 0x1B, 0x00, 0x1B, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x33,
+    0xC0, 0x01, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0x79, 0xC0, 0x61, 0xC0, 0x71, 0xC0, 0x7F, 0xC0, 0x3F,
+    0xC0, 0x3F, 0x3E, 0x00, 0x3F, 0xFF, 0x00, 0x33, 0xF7, 0x80, 0x01, 0xC3, 0x80, 0x3F, 0xFF, 0x80,
+    0x7F, 0xFF, 0x80, 0x79, 0xC0, 0x00, 0x61, 0xC0, 0x00, 0x71, 0xF1, 0x00, 0x7F, 0xFF, 0x00, 0x3F,
+    0xFF, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0xF9, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xF9, 0x00, 0x7F, 0x80, 0x3F, 0x80, 0x0C, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x3E, 0x00,
+    0x18, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0xF3, 0xC0,
+    0xE1, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xF9, 0x80, 0x7F, 0x80, 0x3F, 0x80,
+    0x06, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0xF3, 0xC0,
+    0xE1, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xF9, 0x80, 0x7F, 0x80, 0x3F, 0x80,
+    0x0C, 0x00, 0x1E, 0x00, 0x3F, 0x00, 0x33, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0xF3, 0xC0,
+    0xE1, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xF9, 0x80, 0x7F, 0x80, 0x3F, 0x80,
+    0x33, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0xF3, 0xC0, 0xE1, 0xC0,
+    0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xF9, 0x80, 0x7F, 0x80, 0x3F, 0x80, 0xC0, 0xE0,
+    0x70, 0x30, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70,
+    0xE0, 0xC0, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x18, 0x3C,
+    0x7C, 0x66, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0xEE, 0xEE,
+    0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x07, 0xE0, 0x0F,
+    0xE0, 0x0F, 0x80, 0x0F, 0xC0, 0x01, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0xF3, 0xC0, 0xE0, 0xE0, 0xE0,
+    0xC0, 0xC0, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xF3, 0xC0, 0x7F, 0x80, 0x3F, 0x00, 0x3D, 0x80, 0x3F,
+    0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x80, 0xE3, 0xC0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0x18, 0x00, 0x1C,
+    0x00, 0x0E, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0xFB, 0xC0, 0xE1, 0xC0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xC0, 0xF3, 0xC0, 0x7F, 0x80, 0x3F, 0x00, 0x03, 0x00, 0x07,
+    0x00, 0x0E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0xFB, 0xC0, 0xE1, 0xC0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xC0, 0xF3, 0xC0, 0x7F, 0x80, 0x3F, 0x00, 0x0C, 0x00, 0x1E,
+    0x00, 0x3F, 0x00, 0x33, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0xFB, 0xC0, 0xE1, 0xC0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xC0, 0xF3, 0xC0, 0x7F, 0x80, 0x3F, 0x00, 0x3D, 0x80, 0x3F,
+    0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0xFB, 0xC0, 0xE1, 0xC0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xC0, 0xF3, 0xC0, 0x7F, 0x80, 0x3F, 0x00, 0x3B, 0x80, 0x3B,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0xFB, 0xC0, 0xE1, 0xC0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE1, 0xC0, 0xF3, 0xC0, 0x7F, 0x80, 0x3F, 0x00, 0x0C, 0x00, 0x1E, 0x00, 0x0C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x1E,
+    0x00, 0x0C, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0xF3, 0xC0, 0xE3, 0xC0, 0xE7, 0xE0, 0xCE, 0xE0, 0xFC,
+    0xE0, 0xF9, 0xC0, 0x73, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0x18, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x0C,
+    0x00, 0x00, 0x00, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0x71, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x06, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x0C,
+    0x00, 0x00, 0x00, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0x71, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x0C, 0x00, 0x1E, 0x00, 0x3F, 0x00, 0x33,
+    0x00, 0x00, 0x00, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0x71, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x33, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0x71, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x03, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x00,
+    0x00, 0xE0, 0xC0, 0xE1, 0xC0, 0x71, 0xC0, 0x71, 0x80, 0x71, 0x80, 0x3B, 0x80, 0x3B, 0x80, 0x1B,
+    0x00, 0x1F, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0x00, 0xFF, 0x80, 0xF3, 0xC0, 0xE1,
+    0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xC0, 0xF3, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x3B, 0x80, 0x3B, 0x80, 0x00, 0x00, 0x00, 0x00, 0xE0,
+    0xC0, 0xE1, 0xC0, 0x71, 0xC0, 0x71, 0x80, 0x71, 0x80, 0x3B, 0x80, 0x3B, 0x80, 0x1B, 0x00, 0x1F,
+    0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x0F,
+    0xC0, 0x00, 0x00, 0x07, 0x00, 0x07, 0x80, 0x07, 0x80, 0x0F, 0xC0, 0x0D, 0xC0, 0x1C, 0xC0, 0x1C,
+    0xE0, 0x18, 0x60, 0x38, 0x70, 0x3F, 0xF0, 0x7F, 0xF0, 0x70, 0x38, 0x60, 0x38, 0xE0, 0x1C, 0xE0,
+    0x1C, 0x3F, 0x80, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x33, 0xC0, 0x01,
+    0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0x79, 0xC0, 0x61, 0xC0, 0x71, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x0C,
+    0xC0, 0x0F, 0xC0, 0x07, 0x80, 0x00, 0x00, 0x07, 0x00, 0x07, 0x80, 0x07, 0x80, 0x0F, 0xC0, 0x0D,
+    0xC0, 0x1C, 0xC0, 0x1C, 0xE0, 0x18, 0x60, 0x38, 0x70, 0x3F, 0xF0, 0x7F, 0xF0, 0x70, 0x38, 0x60,
+    0x38, 0xE0, 0x1C, 0xE0, 0x1C, 0x3B, 0x80, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x3F, 0x80, 0x33, 0xC0, 0x01, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0x79, 0xC0, 0x61, 0xC0, 0x71,
+    0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x07, 0x00, 0x07, 0x80, 0x07, 0x80, 0x0F, 0xC0, 0x0D, 0xC0, 0x1C,
+    0xC0, 0x1C, 0xE0, 0x18, 0x60, 0x38, 0x70, 0x3F, 0xF0, 0x7F, 0xF0, 0x70, 0x38, 0x60, 0x38, 0xE0,
+    0x1C, 0xE0, 0x1C, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3C, 0x3F, 0x00, 0x3F, 0x80, 0x33,
+    0xC0, 0x01, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0x79, 0xC0, 0x61, 0xC0, 0x71, 0xC0, 0x7F, 0xC0, 0x3F,
+    0xC0, 0x03, 0x80, 0x07, 0x00, 0x03, 0xC0, 0x01, 0x80, 0x03, 0x80, 0x07, 0x00, 0x06, 0x00, 0x00,
+    0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x7C, 0x60, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x7C, 0x60, 0x3F, 0xF0, 0x0F, 0xE0, 0x07,
+    0x00, 0x0F, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0xF9, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF9, 0x00, 0x7F, 0x80, 0x3F, 0x80, 0x03,
+    0x00, 0x07, 0x80, 0x0F, 0xC0, 0x0C, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x7C, 0x60, 0x70,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x70,
+    0x00, 0x7C, 0x60, 0x3F, 0xF0, 0x0F, 0xE0, 0x0C, 0x00, 0x1E, 0x00, 0x3F, 0x00, 0x33, 0x00, 0x00,
+    0x00, 0x3F, 0x00, 0x7F, 0x00, 0xF9, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xF9, 0x00, 0x7F, 0x80, 0x3F, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F,
+    0xE0, 0x3F, 0xF0, 0x7C, 0x60, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x7C, 0x60, 0x3F, 0xF0, 0x0F, 0xE0, 0x0C, 0x00, 0x1E,
+    0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0xF9, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF9, 0x00, 0x7F, 0x80, 0x3F, 0x80, 0x0C, 0xC0, 0x0F,
+    0xC0, 0x07, 0x80, 0x03, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x7C, 0x60, 0x70, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x7C,
+    0x60, 0x3F, 0xF0, 0x0F, 0xE0, 0x33, 0x00, 0x3F, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x7F, 0x00, 0xF9, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF9,
+    0x00, 0x7F, 0x80, 0x3F, 0x80, 0x19, 0x80, 0x1F, 0x80, 0x0F, 0x00, 0x06, 0x00, 0x00, 0x00, 0x7F,
+    0x80, 0xFF, 0xE0, 0xE3, 0xF0, 0xE0, 0x70, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0,
+    0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x70, 0xE3, 0xF0, 0xFF, 0xE0, 0x7F, 0x80, 0x01, 0xD8, 0x01,
+    0xD8, 0x01, 0xD8, 0x01, 0xD8, 0x01, 0xD8, 0x3F, 0xC0, 0x7F, 0xC0, 0xF3, 0xC0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xF9, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x3F, 0xC0, 0x3F,
+    0xF0, 0x38, 0xF8, 0x30, 0x38, 0x30, 0x1C, 0x30, 0x1C, 0xFE, 0x1C, 0xFE, 0x1C, 0x30, 0x1C, 0x30,
+    0x1C, 0x30, 0x1C, 0x30, 0x38, 0x38, 0xF8, 0x3F, 0xF0, 0x3F, 0xC0, 0x01, 0xC0, 0x0F, 0xF0, 0x0F,
+    0xF0, 0x01, 0xC0, 0x01, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0xF3, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xF9, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x3F, 0x80, 0x00,
+    0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0x80, 0xFF,
+    0x80, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0x7F,
+    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0xF3, 0xC0, 0xE1, 0xC0, 0xFF,
+    0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xF9, 0x80, 0x7F, 0x80, 0x3F, 0x80, 0x33, 0x00, 0x3F,
+    0x00, 0x1E, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xFF, 0x80, 0xFF, 0x80, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF,
+    0xE0, 0xFF, 0xE0, 0x33, 0x00, 0x3F, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F,
+    0x80, 0xF3, 0xC0, 0xE1, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xF9, 0x80, 0x7F,
+    0x80, 0x3F, 0x80, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0x0C, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0xF3, 0xC0, 0xE1, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0,
+    0x00, 0xE0, 0x00, 0xF9, 0x80, 0x7F, 0x80, 0x3F, 0x80, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x01, 0xE0, 0x3F,
+    0x00, 0x7F, 0x80, 0xF3, 0xC0, 0xE1, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xF9,
+    0x80, 0x7F, 0x80, 0x3F, 0x80, 0x07, 0x00, 0x06, 0x00, 0x07, 0x80, 0x33, 0x00, 0x3F, 0x00, 0x1E,
+    0x00, 0x0C, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xFF, 0x80, 0xFF, 0x80, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF,
+    0xE0, 0xFF, 0xE0, 0x33, 0x00, 0x3F, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x7F, 0x80, 0xF3, 0xC0, 0xE1, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xF9,
+    0x80, 0x7F, 0x80, 0x3F, 0x80, 0x03, 0x00, 0x07, 0x80, 0x0F, 0xC0, 0x0C, 0xC0, 0x00, 0x00, 0x0F,
+    0xE0, 0x3F, 0xF0, 0x7C, 0x70, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x70, 0xE0, 0x70, 0xE0, 0x70, 0x70, 0x70, 0x7C, 0x70, 0x3F, 0xF0, 0x0F, 0xF0, 0x0C, 0x00, 0x1E,
+    0x00, 0x1F, 0x00, 0x33, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0xF9, 0xC0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xF3, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x01, 0xC0, 0x63,
+    0x80, 0xFF, 0x80, 0xFF, 0x00, 0x0C, 0xC0, 0x0F, 0xC0, 0x07, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x3F,
+    0xF0, 0x7C, 0x70, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x70, 0xE0,
+    0x70, 0xE0, 0x70, 0x70, 0x70, 0x7C, 0x70, 0x3F, 0xF0, 0x0F, 0xF0, 0x3B, 0x00, 0x1F, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0xF9, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xF3, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x01, 0xC0, 0x63, 0x80, 0xFF,
+    0x80, 0xFF, 0x00, 0x03, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x7C,
+    0x70, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
+    0x70, 0x70, 0x70, 0x7C, 0x70, 0x3F, 0xF0, 0x0F, 0xF0, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0xF9, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0xF3, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x01, 0xC0, 0x63, 0x80, 0xFF, 0x80, 0xFF,
+    0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x7C, 0x70, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0x70, 0x70, 0x7C, 0x70, 0x3F, 0xF0, 0x0F, 0xF0, 0x00,
+    0x00, 0x07, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0xF9, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0xF3, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x01, 0xC0, 0x63, 0x80, 0xFF, 0x80, 0xFF,
+    0x00, 0x06, 0x00, 0x07, 0x00, 0x0F, 0x80, 0x19, 0x80, 0x00, 0x00, 0xE0, 0x30, 0xE0, 0x30, 0xE0,
+    0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xFF, 0xF0, 0xFF, 0xF0, 0xE0, 0x30, 0xE0, 0x30, 0xE0,
+    0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0x30, 0x00, 0xF8, 0x00, 0xD8, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0x00, 0xFF, 0x80, 0xF3,
+    0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0x30, 0x1C, 0xFF, 0xFE, 0xFF, 0xFE, 0x30, 0x1C, 0x30, 0x1C, 0x30, 0x1C, 0x3F, 0xFC, 0x3F,
+    0xFC, 0x30, 0x1C, 0x30, 0x1C, 0x30, 0x1C, 0x30, 0x1C, 0x30, 0x1C, 0x30, 0x1C, 0x30, 0x1C, 0x70,
+    0x00, 0xFF, 0x00, 0xFF, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x79, 0xE0, 0x70,
+    0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x7E,
+    0xFE, 0xDE, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x7E, 0xFE, 0xDC, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0xFE, 0xFE, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0xFE, 0xFE, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xCC, 0xFC, 0x78, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x6E, 0x7E, 0x7C, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0xE0, 0xE0, 0xF0, 0x70, 0x70, 0x00, 0x00, 0x00, 0x70, 0x70,
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0xE0, 0xE0, 0xF0, 0xE0, 0xE0, 0xE0,
+    0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0,
+    0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0,
+    0x1C, 0xE0, 0x1C, 0xE7, 0x78, 0xE7, 0xF8, 0xE7, 0xF0, 0xE3, 0x00, 0xE3, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE3, 0x00, 0xE3, 0x00, 0xE3, 0x00, 0xE3, 0x00, 0xE3, 0x00, 0xE3, 0x00, 0xE3,
+    0x00, 0xE3, 0x00, 0xE3, 0x00, 0xE3, 0x00, 0xE3, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1F, 0x00, 0x1E,
+    0x00, 0x01, 0x80, 0x03, 0xC0, 0x07, 0xE0, 0x06, 0x60, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03,
+    0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03,
+    0x80, 0x03, 0x80, 0xE7, 0x80, 0xFF, 0x00, 0x7E, 0x00, 0x0C, 0x1E, 0x3E, 0x33, 0x00, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x3C, 0xF8, 0xF8, 0xE0, 0xF0, 0xE0,
+    0xE0, 0xE1, 0xC0, 0xE3, 0x80, 0xE7, 0x00, 0xEE, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xEF,
+    0x00, 0xE7, 0x80, 0xE3, 0xC0, 0xE1, 0xE0, 0xE0, 0xF0, 0xE0, 0x70, 0x00, 0x00, 0x06, 0x00, 0x1E,
+    0x00, 0x1E, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE3, 0x80, 0xE7,
+    0x00, 0xEF, 0x00, 0xEE, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0xEE, 0x00, 0xE7, 0x00, 0xE3,
+    0x80, 0xE1, 0xC0, 0x00, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x38, 0x00, 0xE3, 0xC0, 0xE7, 0x80, 0xE7,
+    0x00, 0xEE, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0xFE, 0x00, 0xEF, 0x00, 0xE7, 0x80, 0xE3, 0x80, 0xE1,
+    0xC0, 0x18, 0x00, 0x38, 0x00, 0x70, 0x00, 0x60, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x30, 0xF0, 0xF0, 0x00, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0x78, 0x70, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0E, 0x00, 0x1C,
+    0x00, 0x1C, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x78, 0x3C, 0x38, 0x00, 0x30, 0xF0, 0xF0, 0xEE, 0x00, 0xEE, 0x00, 0xEE, 0x00, 0xEE, 0x00, 0xEC,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xF0, 0x78, 0x70, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE3, 0x80, 0xE3, 0x80, 0xE3, 0x80, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF,
+    0xC0, 0xFF, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xEE, 0xEE, 0xEE, 0xE0, 0xE0, 0xE0,
+    0xF0, 0x78, 0x70, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1D, 0x00, 0x1F, 0x00, 0x1F,
+    0x00, 0x3C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1F, 0xF0, 0x1F,
+    0xF0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x34, 0x3C, 0x78, 0xF0, 0xF0, 0x30, 0x30, 0x30, 0x38, 0x3C,
+    0x3C, 0x01, 0x80, 0x03, 0x80, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0xE0, 0x38, 0xF0, 0x38, 0xF8,
+    0x38, 0xFC, 0x38, 0xFC, 0x38, 0xEE, 0x38, 0xE7, 0x38, 0xE3, 0xB8, 0xE3, 0xB8, 0xE1, 0xF8, 0xE0,
+    0xF8, 0xE0, 0xF8, 0xE0, 0x78, 0xE0, 0x78, 0xE0, 0x38, 0x07, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x0C,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x80, 0xE3, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE0, 0x38, 0xF0, 0x38, 0xF8, 0x38, 0xFC,
+    0x38, 0xFC, 0x38, 0xEE, 0x38, 0xE7, 0x38, 0xE3, 0xB8, 0xE3, 0xB8, 0xE1, 0xF8, 0xE0, 0xF8, 0xE0,
+    0xF8, 0xE0, 0x78, 0xE0, 0x78, 0xE0, 0x38, 0x00, 0x00, 0x07, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0xFF,
+    0x00, 0xFF, 0x80, 0xE3, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0x00, 0x00, 0x0C, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x0C, 0xC0, 0x0F,
+    0x80, 0x07, 0x80, 0x03, 0x00, 0x00, 0x00, 0xE0, 0x38, 0xF0, 0x38, 0xF8, 0x38, 0xFC, 0x38, 0xFC,
+    0x38, 0xEE, 0x38, 0xE7, 0x38, 0xE3, 0xB8, 0xE3, 0xB8, 0xE1, 0xF8, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0,
+    0x78, 0xE0, 0x78, 0xE0, 0x38, 0x33, 0x00, 0x3F, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0xFF, 0x80, 0xE3, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0x60, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x7F,
+    0x80, 0x7F, 0xC0, 0x71, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70,
+    0xE0, 0x70, 0xE0, 0x70, 0xE0, 0xE0, 0x38, 0xF0, 0x38, 0xF8, 0x38, 0xFC, 0x38, 0xFC, 0x38, 0xEE,
+    0x38, 0xE7, 0x38, 0xE3, 0xB8, 0xE3, 0xB8, 0xE1, 0xF8, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0x78, 0xE0,
+    0x38, 0xE0, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0xF0, 0x00, 0xF0, 0xFF, 0x00, 0xFF, 0x80, 0xE3,
+    0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x0F, 0xE0, 0x0F, 0xE0, 0x00, 0x00, 0x0F,
+    0xE0, 0x3F, 0xF0, 0x7C, 0xF8, 0x70, 0x3C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x0C, 0xE0,
+    0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0x70, 0x3C, 0x7C, 0xF8, 0x3F, 0xF0, 0x0F, 0xE0, 0x3F, 0x80, 0x3F,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0xFB, 0xC0, 0xE1, 0xC0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE1, 0xC0, 0xF3, 0xC0, 0x7F, 0x80, 0x3F, 0x00, 0x0C, 0xC0, 0x0F, 0xC0, 0x07,
+    0x80, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x7C, 0xF8, 0x70, 0x3C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0,
+    0x1C, 0xE0, 0x0C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0x70, 0x3C, 0x7C, 0xF8, 0x3F, 0xF0, 0x0F,
+    0xE0, 0x3B, 0x00, 0x3F, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0xFB,
+    0xC0, 0xE1, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xC0, 0xF3, 0xC0, 0x7F, 0x80, 0x3F,
+    0x00, 0x03, 0x30, 0x07, 0x70, 0x0E, 0xE0, 0x04, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x7C,
+    0xF8, 0x70, 0x3C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x0C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0,
+    0x1C, 0x70, 0x3C, 0x7C, 0xF8, 0x3F, 0xF0, 0x0F, 0xE0, 0x0C, 0xC0, 0x1D, 0xC0, 0x3B, 0x80, 0x13,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0xFB, 0xC0, 0xE1, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE1, 0xC0, 0xF3, 0xC0, 0x7F, 0x80, 0x3F, 0x00, 0x0F, 0xFF, 0xE0, 0x3F, 0xFF, 0xE0, 0x7E,
+    0x30, 0x00, 0x70, 0x30, 0x00, 0xF0, 0x30, 0x00, 0xE0, 0x30, 0x00, 0xE0, 0x3F, 0xC0, 0xE0, 0x3F,
+    0xC0, 0xE0, 0x30, 0x00, 0xE0, 0x30, 0x00, 0xF0, 0x30, 0x00, 0x70, 0x30, 0x00, 0x7E, 0x30, 0x00,
+    0x3F, 0xFF, 0xE0, 0x0F, 0xFF, 0xE0, 0x3F, 0x3F, 0x00, 0x7F, 0xFF, 0x80, 0xFB, 0xF3, 0xC0, 0xE1,
+    0xE1, 0xC0, 0xE0, 0xFF, 0xC0, 0xE0, 0xFF, 0xC0, 0xE0, 0xE0, 0x00, 0xE1, 0xE0, 0x00, 0xF3, 0xF9,
+    0x80, 0x7F, 0xFF, 0x80, 0x3F, 0x1F, 0x80, 0x03, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x00,
+    0x00, 0x7F, 0x80, 0xFF, 0xC0, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE0, 0xFF,
+    0xC0, 0xFF, 0x80, 0xE3, 0x80, 0xE3, 0xC0, 0xE1, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x70, 0x0C,
+    0x1C, 0x38, 0x30, 0x00, 0x7E, 0xFE, 0xE2, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x7F,
+    0x80, 0xFF, 0xC0, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE0, 0xFF, 0xC0, 0xFF,
+    0x80, 0xE3, 0x80, 0xE3, 0xC0, 0xE1, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x70, 0x00, 0x00, 0x0E,
+    0x00, 0x1E, 0x00, 0x1E, 0x00, 0x3F, 0x7F, 0x71, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x00, 0x70, 0xF0, 0xE0, 0x33, 0x00, 0x3F, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x7F, 0x80,
+    0xFF, 0xC0, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE0, 0xFF, 0xC0, 0xFF, 0x80,
+    0xE3, 0x80, 0xE3, 0xC0, 0xE1, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x70, 0x66, 0x7E, 0x3C, 0x18,
+    0x00, 0x7E, 0xFE, 0xE2, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x03, 0x00, 0x07, 0x00,
+    0x0E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0xC0, 0x79, 0xC0, 0x70, 0x00, 0x70, 0x00,
+    0x70, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xC0, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x73, 0xE0,
+    0xFF, 0xC0, 0x7F, 0x80, 0x06, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x00, 0x00, 0x3F, 0x00,
+    0x7F, 0x00, 0x73, 0x00, 0x70, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x03, 0x80, 0x47, 0x80,
+    0x7F, 0x80, 0x7F, 0x00, 0x06, 0x00, 0x0F, 0x00, 0x1F, 0x80, 0x19, 0x80, 0x00, 0x00, 0x1F, 0xC0,
+    0x7F, 0xC0, 0x79, 0xC0, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xC0,
+    0x01, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x73, 0xE0, 0xFF, 0xC0, 0x7F, 0x80, 0x0C, 0x00, 0x1E, 0x00,
+    0x3F, 0x00, 0x33, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x73, 0x00, 0x70, 0x00, 0x7C, 0x00,
+    0x3F, 0x00, 0x0F, 0x80, 0x03, 0x80, 0x47, 0x80, 0x7F, 0x80, 0x7F, 0x00, 0x1F, 0xC0, 0x7F, 0xC0,
+    0x79, 0xC0, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xC0, 0x01, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x73, 0xE0, 0xFF, 0xC0, 0x7F, 0x80, 0x0E, 0x00, 0x06, 0x00, 0x1E, 0x00,
+    0x3F, 0x00, 0x7F, 0x00, 0x73, 0x00, 0x70, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x03, 0x80,
+    0x47, 0x80, 0x7F, 0x00, 0x7F, 0x00, 0x1C, 0x00, 0x0C, 0x00, 0x3C, 0x00, 0x19, 0x80, 0x1F, 0x80,
+    0x0F, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0xC0, 0x79, 0xC0, 0x70, 0x00, 0x70, 0x00,
+    0x70, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xC0, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x73, 0xE0,
+    0xFF, 0xC0, 0x7F, 0x80, 0x33, 0x00, 0x3E, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x3F, 0x00,
+    0x7F, 0x00, 0x73, 0x00, 0x70, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x03, 0x80, 0x47, 0x80,
+    0x7F, 0x80, 0x7F, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+    0x06, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x1E, 0x00, 0xE0, 0xE0, 0xE0, 0xFE, 0xFE, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xF2, 0x7E, 0x7E, 0x18, 0x1C, 0x3C, 0x19, 0x80, 0x1F, 0x80, 0x0F, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06,
+    0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06,
+    0x00, 0x0C, 0x0C, 0xEC, 0xEC, 0xE0, 0xFE, 0xFE, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF2, 0x7E,
+    0x7E, 0xFF, 0xF0, 0xFF, 0xF0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x3F,
+    0xC0, 0x3F, 0xC0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0xE0,
+    0xE0, 0xE0, 0xFE, 0xFE, 0xE0, 0xE0, 0xE0, 0xFE, 0xFE, 0xE0, 0xF2, 0x7E, 0x7E, 0x1E, 0xC0, 0x1F,
+    0xC0, 0x1F, 0x80, 0x00, 0x00, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
+    0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0x70, 0x70, 0x79, 0xE0, 0x3F,
+    0xE0, 0x1F, 0xC0, 0x3D, 0x80, 0x3F, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0x71, 0xC0, 0x7F,
+    0xC0, 0x3F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
+    0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0x70,
+    0x70, 0x79, 0xE0, 0x3F, 0xE0, 0x1F, 0xC0, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1,
+    0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0x71,
+    0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x1D, 0x80, 0x1F, 0x80, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0x70, 0xE0,
+    0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
+    0x70, 0xE0, 0x70, 0x70, 0x70, 0x79, 0xE0, 0x3F, 0xE0, 0x1F, 0xC0, 0x33, 0x00, 0x3F, 0x00, 0x1E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0x71, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x0F, 0x00, 0x0D, 0x80, 0x0D,
+    0x80, 0x0F, 0x00, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
+    0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0x70, 0x70, 0x79, 0xE0, 0x3F, 0xE0, 0x1F,
+    0xC0, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0x71, 0xC0, 0x7F, 0xC0, 0x3F,
+    0xC0, 0x06, 0x60, 0x0E, 0xE0, 0x0D, 0xC0, 0x09, 0x80, 0x00, 0x00, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
+    0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
+    0x70, 0x70, 0x70, 0x79, 0xE0, 0x3F, 0xE0, 0x1F, 0xC0, 0x0D, 0x80, 0x1D, 0x80, 0x3B, 0x80, 0x33,
+    0x00, 0x00, 0x00, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0x71, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
+    0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0x70,
+    0x70, 0x79, 0xE0, 0x3F, 0xE0, 0x1F, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x80, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0x71, 0xC0, 0x7F,
+    0xC0, 0x3F, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x03, 0xC0, 0x00, 0x60, 0x00, 0x00, 0xF0, 0x00, 0x01,
+    0xF8, 0x00, 0x01, 0x98, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0xE0, 0x00, 0xE0, 0x70, 0xE0,
+    0xE0, 0x70, 0xF0, 0xE0, 0x70, 0xF0, 0xC0, 0x71, 0xF1, 0xC0, 0x71, 0xF9, 0xC0, 0x39, 0xB9, 0xC0,
+    0x3B, 0x99, 0xC0, 0x3B, 0x9D, 0x80, 0x3B, 0x1F, 0x80, 0x1F, 0x0F, 0x80, 0x1F, 0x0F, 0x80, 0x1E,
+    0x0F, 0x00, 0x0E, 0x07, 0x00, 0x01, 0x80, 0x03, 0xC0, 0x07, 0xE0, 0x06, 0x60, 0x00, 0x00, 0xE1,
+    0xC7, 0xE1, 0xC7, 0x63, 0xC7, 0x73, 0xC6, 0x73, 0xEE, 0x33, 0xEE, 0x3F, 0x6C, 0x3E, 0x7C, 0x1E,
+    0x7C, 0x1E, 0x38, 0x1C, 0x38, 0x06, 0x00, 0x0F, 0x00, 0x1F, 0x80, 0x19, 0x80, 0x00, 0x00, 0xE0,
+    0x38, 0x70, 0x70, 0x70, 0xE0, 0x38, 0xE0, 0x39, 0xC0, 0x1D, 0xC0, 0x1F, 0x80, 0x0F, 0x80, 0x07,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x04, 0x00, 0x0E,
+    0x00, 0x1F, 0x00, 0x11, 0x00, 0x00, 0x00, 0xE0, 0xC0, 0xE1, 0xC0, 0x71, 0xC0, 0x71, 0x80, 0x71,
+    0x80, 0x3B, 0x80, 0x3B, 0x80, 0x1B, 0x00, 0x1F, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1C,
+    0x00, 0xFC, 0x00, 0xF8, 0x00, 0x1D, 0xC0, 0x1D, 0xC0, 0x00, 0x00, 0xE0, 0x38, 0x70, 0x70, 0x70,
+    0xE0, 0x38, 0xE0, 0x39, 0xC0, 0x1D, 0xC0, 0x1F, 0x80, 0x0F, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x80, 0x07,
+    0x00, 0x0E, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0x70, 0x00, 0xFF, 0xF0, 0xFF,
+    0xF0, 0x06, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0x80, 0x03,
+    0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x78, 0x00, 0x70, 0x00, 0xFF, 0x80, 0xFF,
+    0x80, 0x06, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x00, 0xE0, 0x01,
+    0xC0, 0x03, 0x80, 0x07, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70,
+    0x00, 0x70, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0x80, 0x7F, 0x80, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x78,
+    0x00, 0x70, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x19, 0x80, 0x1F, 0x80, 0x0F, 0x00, 0x06, 0x00, 0x00,
+    0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x80, 0x07, 0x00, 0x0E,
+    0x00, 0x1C, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0x70, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x33,
+    0x00, 0x3F, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0x80, 0x03, 0x80, 0x07,
+    0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x78, 0x00, 0x70, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x3F,
+    0x7E, 0x70, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x78,
+    0xFC, 0xCC, 0x18, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0x3B, 0x80, 0x3B, 0x80, 0x00, 0x00,
+    0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0x80, 0xFF, 0x80,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xF0,
+    0xFF, 0xF0, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0F, 0xF8, 0x0F, 0xFC, 0x0F, 0x3E, 0x0E, 0x0E,
+    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1E, 0x0E, 0x7C, 0x0E, 0x78, 0x07, 0x00, 0x07, 0x00,
+    0x0E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x7C, 0x60, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xFF, 0x80, 0xFF, 0x80, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x7C, 0x60, 0x3F, 0xF0,
+    0x1F, 0xE0, 0x1F, 0xC0, 0x7F, 0xC0, 0x79, 0xC0, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7E, 0x00,
+    0x1F, 0x80, 0x07, 0xC0, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x73, 0xE0, 0xFF, 0xC0, 0x7F, 0x80,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xEE,
+    0xEE, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03,
+    0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0xE7, 0x80, 0xFF, 0x00, 0x7E, 0x00, 0x0F,
+    0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0E, 0x18, 0x00, 0x0E, 0x18, 0x00, 0x0E, 0x18, 0x00, 0x0E, 0x1F,
+    0xE0, 0x0E, 0x1F, 0xF0, 0x0E, 0x18, 0xF8, 0x0E, 0x18, 0x38, 0x0C, 0x18, 0x18, 0x1C, 0x18, 0x18,
+    0x1C, 0x18, 0x38, 0x78, 0x18, 0xF8, 0xF8, 0x1F, 0xF0, 0xE0, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xE0,
+    0x70, 0x00, 0xE0, 0x70, 0x00, 0xE0, 0x70, 0x00, 0xE0, 0x70, 0x00, 0xE0, 0x70, 0x00, 0xFF, 0xFF,
+    0xC0, 0xFF, 0xFF, 0xE0, 0xE0, 0x71, 0xF0, 0xE0, 0x70, 0x70, 0xE0, 0x70, 0x70, 0xE0, 0x70, 0x70,
+    0xE0, 0x70, 0x70, 0xE0, 0x71, 0xF0, 0xE0, 0x7F, 0xE0, 0xE0, 0x7F, 0x80, 0xFF, 0xF0, 0xFF, 0xF0,
+    0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0F, 0xF8, 0x0F, 0xFC, 0x0F, 0x3C, 0x0E, 0x0E, 0x0E, 0x0E,
+    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x03, 0x00, 0x07, 0x00, 0x0E, 0x00,
+    0x0C, 0x00, 0x00, 0x00, 0xE0, 0xF0, 0xE0, 0xE0, 0xE1, 0xC0, 0xE3, 0x80, 0xE7, 0x00, 0xEE, 0x00,
+    0xFC, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xEF, 0x00, 0xE7, 0x80, 0xE3, 0xC0, 0xE1, 0xE0, 0xE0, 0xF0,
+    0xE0, 0x70, 0x0C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0xE0, 0x38, 0xE0, 0x78,
+    0xE0, 0x78, 0xE0, 0xF8, 0xE1, 0xF8, 0xE3, 0xB8, 0xE3, 0xB8, 0xE7, 0x38, 0xEE, 0x38, 0xFE, 0x38,
+    0xFC, 0x38, 0xF8, 0x38, 0xF8, 0x38, 0xF0, 0x38, 0xE0, 0x38, 0x1D, 0xC0, 0x1F, 0x80, 0x0F, 0x80,
+    0x00, 0x00, 0xE0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x60, 0x38, 0xE0, 0x38, 0xE0, 0x1C, 0xC0,
+    0x1F, 0xC0, 0x0F, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x07, 0x00, 0x4F, 0x00, 0x7E, 0x00, 0x7C, 0x00,
+    0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70,
+    0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xFF, 0xF0, 0xFF, 0xF0, 0x07, 0x00,
+    0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x80, 0x07, 0x80, 0x0F, 0xC0, 0x0D, 0xC0,
+    0x1C, 0xC0, 0x1C, 0xE0, 0x18, 0x60, 0x38, 0x70, 0x3F, 0xF0, 0x7F, 0xF0, 0x70, 0x38, 0x60, 0x38,
+    0xE0, 0x1C, 0xE0, 0x1C, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0x80,
+    0xFF, 0xC0, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0, 0x60, 0xE0, 0x60, 0xE0, 0xE0, 0xE3, 0xE0, 0xFF, 0xC0,
+    0xFF, 0x80, 0x7F, 0x80, 0xFF, 0xC0, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE0, 0xFF, 0xC0,
+    0xFF, 0xE0, 0xE1, 0xE0, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE1, 0xE0, 0xFF, 0xE0, 0x7F, 0x80,
+    0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x0F, 0xF8,
+    0x0F, 0xF8, 0x0E, 0x18, 0x0E, 0x18, 0x0E, 0x18, 0x0E, 0x18, 0x0E, 0x18, 0x0E, 0x18, 0x0C, 0x18,
+    0x1C, 0x18, 0x1C, 0x18, 0x1C, 0x18, 0x38, 0x18, 0xFF, 0xFE, 0xFF, 0xFE, 0xE0, 0x0E, 0xE0, 0x0E,
+    0xE0, 0x0E, 0xE0, 0x0E, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xFF, 0x80, 0xFF, 0x80, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xE0,
+    0xFF, 0xE0, 0x70, 0xE1, 0xC0, 0x78, 0xE3, 0xC0, 0x38, 0xE3, 0x80, 0x1C, 0xE7, 0x00, 0x0E, 0xEE,
+    0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x0E, 0xEE, 0x00,
+    0x1C, 0xEF, 0x00, 0x3C, 0xE7, 0x80, 0x38, 0xE3, 0x80, 0x70, 0xE1, 0xC0, 0xF0, 0xE1, 0xE0, 0x7F,
+    0x80, 0x7F, 0xC0, 0x73, 0xC0, 0x00, 0xE0, 0x00, 0xC0, 0x03, 0xC0, 0x1F, 0x80, 0x1F, 0xC0, 0x03,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x73, 0xE0, 0xFF, 0xC0, 0x7F, 0x80, 0xE0, 0x38, 0xE0,
+    0x78, 0xE0, 0x78, 0xE0, 0xF8, 0xE1, 0xF8, 0xE3, 0xB8, 0xE3, 0xB8, 0xE7, 0x38, 0xEE, 0x38, 0xFE,
+    0x38, 0xFC, 0x38, 0xF8, 0x38, 0xF8, 0x38, 0xF0, 0x38, 0xE0, 0x38, 0x1D, 0xC0, 0x0F, 0xC0, 0x0F,
+    0x80, 0x00, 0x00, 0xE0, 0x38, 0xE0, 0x78, 0xE0, 0x78, 0xE0, 0xF8, 0xE1, 0xF8, 0xE3, 0xB8, 0xE3,
+    0xB8, 0xE7, 0x38, 0xEE, 0x38, 0xFE, 0x38, 0xFC, 0x38, 0xF8, 0x38, 0xF8, 0x38, 0xF0, 0x38, 0xE0,
+    0x38, 0xE0, 0xF0, 0xE0, 0xE0, 0xE1, 0xC0, 0xE3, 0x80, 0xE7, 0x00, 0xEE, 0x00, 0xFC, 0x00, 0xFC,
+    0x00, 0xFE, 0x00, 0xEF, 0x00, 0xE7, 0x80, 0xE3, 0xC0, 0xE1, 0xE0, 0xE0, 0xF0, 0xE0, 0x70, 0x0F,
+    0xF8, 0x0F, 0xF8, 0x0E, 0x18, 0x0E, 0x18, 0x0E, 0x18, 0x0E, 0x18, 0x0E, 0x18, 0x0E, 0x18, 0x0E,
+    0x18, 0x0C, 0x18, 0x1C, 0x18, 0x1C, 0x18, 0x78, 0x18, 0xF8, 0x18, 0xE0, 0x18, 0x70, 0x0E, 0x70,
+    0x0E, 0x78, 0x1E, 0x78, 0x1F, 0x6C, 0x3F, 0x6C, 0x37, 0x66, 0x37, 0xE6, 0x67, 0xE7, 0x67, 0xE3,
+    0xE7, 0xE3, 0xC7, 0xE3, 0xC7, 0xE1, 0xC7, 0xE0, 0x07, 0xE0, 0x03, 0xE0, 0x30, 0xE0, 0x30, 0xE0,
+    0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xFF, 0xF0, 0xFF, 0xF0, 0xE0, 0x30, 0xE0, 0x30, 0xE0,
+    0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0x0F, 0xE0, 0x3F, 0xF0, 0x7C, 0xF8, 0x70,
+    0x3C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x0C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0x70,
+    0x3C, 0x7C, 0xF8, 0x3F, 0xF0, 0x0F, 0xE0, 0xFF, 0xF0, 0xFF, 0xF0, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
+    0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
+    0x70, 0xE0, 0x70, 0xE0, 0x70, 0x7F, 0x80, 0xFF, 0xC0, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE3, 0xE0, 0xFF, 0xC0, 0xFF, 0x80, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x7C, 0x60, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x7C, 0x60, 0x3F, 0xF0, 0x0F,
+    0xE0, 0xFF, 0xF0, 0xFF, 0xF0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06,
+    0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0xE0,
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x60, 0x38, 0xE0, 0x38, 0xE0, 0x1C, 0xC0, 0x1F, 0xC0, 0x0F,
+    0xC0, 0x07, 0x80, 0x07, 0x80, 0x07, 0x00, 0x4F, 0x00, 0x7E, 0x00, 0x7C, 0x00, 0x01, 0x80, 0x01,
+    0x80, 0x1F, 0xF8, 0x3F, 0xFC, 0x7D, 0xBE, 0xF1, 0x8F, 0xE1, 0x87, 0xE1, 0x87, 0xE1, 0x87, 0xE1,
+    0x87, 0xF1, 0x8F, 0x7D, 0xBE, 0x3F, 0xFC, 0x1F, 0xF8, 0x01, 0x80, 0x01, 0x80, 0x70, 0x78, 0x70,
+    0x70, 0x38, 0xE0, 0x1D, 0xE0, 0x1D, 0xC0, 0x0F, 0x80, 0x07, 0x80, 0x07, 0x00, 0x0F, 0x80, 0x0F,
+    0xC0, 0x1D, 0xC0, 0x38, 0xE0, 0x38, 0x70, 0x70, 0x70, 0xE0, 0x38, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
+    0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
+    0x70, 0xE0, 0x70, 0xE0, 0x70, 0xFF, 0xFC, 0xFF, 0xFC, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00,
+    0x1C, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1,
+    0xE0, 0x7F, 0xE0, 0x3F, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0xE0,
+    0xE1, 0xC0, 0xE0, 0xE1, 0xC0, 0xE0, 0xE1, 0xC0, 0xE0, 0xE1, 0xC0, 0xE0, 0xE1, 0xC0, 0xE0, 0xE1,
+    0xC0, 0xE0, 0xE1, 0xC0, 0xE0, 0xE1, 0xC0, 0xE0, 0xE1, 0xC0, 0xE0, 0xE1, 0xC0, 0xE0, 0xE1, 0xC0,
+    0xE0, 0xE1, 0xC0, 0xE0, 0xE1, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xE0, 0xE1, 0xC0, 0xE0,
+    0xE1, 0xC0, 0xE0, 0xE1, 0xC0, 0xE0, 0xE1, 0xC0, 0xE0, 0xE1, 0xC0, 0xE0, 0xE1, 0xC0, 0xE0, 0xE1,
+    0xC0, 0xE0, 0xE1, 0xC0, 0xE0, 0xE1, 0xC0, 0xE0, 0xE1, 0xC0, 0xE0, 0xE1, 0xC0, 0xE0, 0xE1, 0xC0,
+    0xE0, 0xE1, 0xC0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
+    0x00, 0x70, 0x00, 0x00, 0x70, 0xFE, 0x00, 0xFE, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0F,
+    0xF0, 0x0F, 0xFC, 0x0E, 0x7C, 0x0E, 0x1E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1E, 0x0E, 0x3C, 0x0F,
+    0xFC, 0x0F, 0xF0, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xFF, 0x87, 0xFF,
+    0xC7, 0xE3, 0xE7, 0xE0, 0xE7, 0xE0, 0xE7, 0xE0, 0xE7, 0xE0, 0xE7, 0xE3, 0xE7, 0xFF, 0xC7, 0x7F,
+    0x87, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xE3,
+    0xE0, 0xE0, 0xE0, 0xE0, 0x60, 0xE0, 0x60, 0xE0, 0xE0, 0xE3, 0xE0, 0xFF, 0xC0, 0x7F, 0x80, 0x7F,
+    0x00, 0xFF, 0xC0, 0x63, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x70, 0x1F, 0xF0, 0x1F, 0xF0, 0x00,
+    0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0xE0, 0x63, 0xE0, 0xFF, 0xC0, 0x7F, 0x00, 0xE0, 0x7F, 0x00,
+    0xE0, 0xFF, 0x80, 0xE1, 0xF3, 0xC0, 0xE3, 0xC0, 0xE0, 0xE3, 0x80, 0xE0, 0xE3, 0x80, 0x70, 0xFF,
+    0x80, 0x70, 0xFF, 0x80, 0x70, 0xE3, 0x80, 0x70, 0xE3, 0x80, 0x70, 0xE3, 0x80, 0xE0, 0xE1, 0xC0,
+    0xE0, 0xE1, 0xF3, 0xC0, 0xE0, 0xFF, 0xC0, 0xE0, 0x7F, 0x00, 0x1F, 0xF0, 0x3F, 0xF0, 0x7C, 0x70,
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x7C, 0x70, 0x3F, 0xF0, 0x1F, 0xF0, 0x1C, 0x70, 0x1C, 0x70,
+    0x38, 0x70, 0x38, 0x70, 0x70, 0x70, 0x70, 0x70, 0x3F, 0x00, 0x3F, 0x80, 0x33, 0xC0, 0x01, 0xC0,
+    0x3F, 0xC0, 0x7F, 0xC0, 0x79, 0xC0, 0x61, 0xC0, 0x71, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x07, 0xC0,
+    0x1F, 0xC0, 0x3F, 0x80, 0x70, 0x00, 0x60, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xF3, 0xC0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xC0, 0x7B, 0xC0, 0x7F, 0x80, 0x3F, 0x00, 0xFF, 0x00,
+    0xFF, 0x80, 0xE3, 0x80, 0xE3, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xE3, 0xC0, 0xE1, 0xC0, 0xE3, 0xC0,
+    0xFF, 0x80, 0xFF, 0x00, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x1F,
+    0xE0, 0x1F, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x18, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x70,
+    0xE0, 0xFF, 0xF8, 0xFF, 0xF8, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0x3F, 0x00, 0x7F, 0x80, 0xF3,
+    0xC0, 0xE1, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xF9, 0x80, 0x7F, 0x80, 0x3F,
+    0x80, 0x71, 0x8E, 0x39, 0x9C, 0x39, 0x9C, 0x1D, 0xB8, 0x0F, 0xF0, 0x07, 0xE0, 0x0F, 0xF0, 0x1D,
+    0xB8, 0x39, 0x9C, 0x71, 0x8E, 0xE1, 0x87, 0x7F, 0x00, 0x7F, 0x80, 0x63, 0x80, 0x03, 0x80, 0x3F,
+    0x00, 0x3F, 0x80, 0x03, 0x80, 0x01, 0xC0, 0x63, 0xC0, 0x7F, 0x80, 0x7F, 0x00, 0xE1, 0xC0, 0xE3,
+    0xC0, 0xE3, 0xC0, 0xE7, 0xC0, 0xEE, 0xC0, 0xEC, 0xC0, 0xFC, 0xC0, 0xF8, 0xC0, 0xF0, 0xC0, 0xF0,
+    0xC0, 0xE0, 0xC0, 0x3B, 0x80, 0x3F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xC0, 0xE3,
+    0xC0, 0xE3, 0xC0, 0xE7, 0xC0, 0xEE, 0xC0, 0xEC, 0xC0, 0xFC, 0xC0, 0xF8, 0xC0, 0xF0, 0xC0, 0xF0,
+    0xC0, 0xE0, 0xC0, 0xE3, 0xC0, 0xE7, 0x80, 0xE7, 0x00, 0xEE, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0xFE,
+    0x00, 0xEF, 0x00, 0xE7, 0x80, 0xE3, 0x80, 0xE1, 0xC0, 0x1F, 0xE0, 0x1F, 0xE0, 0x1C, 0x60, 0x1C,
+    0x60, 0x1C, 0x60, 0x1C, 0x60, 0x18, 0x60, 0x38, 0x60, 0x78, 0x60, 0xF0, 0x60, 0xE0, 0x60, 0x70,
+    0x38, 0x70, 0x78, 0x78, 0x78, 0x78, 0xF8, 0xFC, 0xF8, 0xED, 0xF8, 0xED, 0xB8, 0xE7, 0x98, 0xE7,
+    0x18, 0xE7, 0x18, 0xE0, 0x18, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xFF, 0xC0, 0xFF,
+    0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0x3F, 0x00, 0x7F, 0x80, 0xFB,
+    0xC0, 0xE1, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xC0, 0xF3, 0xC0, 0x7F, 0x80, 0x3F,
+    0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xFF, 0x00, 0xFF, 0x80, 0xE3, 0xC0, 0xE1, 0xC0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xC0, 0xF3, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0xF9, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF9, 0x00, 0x7F, 0x80, 0x3F, 0x80, 0xFF, 0xC0, 0xFF, 0xC0, 0x0C,
+    0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C,
+    0x00, 0xE0, 0xC0, 0xE1, 0xC0, 0x71, 0xC0, 0x71, 0x80, 0x71, 0x80, 0x3B, 0x80, 0x3B, 0x80, 0x1B,
+    0x00, 0x1F, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x1F, 0xE0, 0x7F, 0xF8, 0x7B, 0x7C, 0xE3,
+    0x1C, 0xE3, 0x0C, 0xC3, 0x0C, 0xE3, 0x0C, 0xE3, 0x1C, 0x7B, 0x7C, 0x7F, 0xF8, 0x1F, 0xE0, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xE1, 0xC0, 0x73, 0x80, 0x3B, 0x80, 0x1F, 0x00, 0x1E,
+    0x00, 0x0E, 0x00, 0x1F, 0x00, 0x3F, 0x00, 0x73, 0x80, 0x71, 0xC0, 0xE0, 0xC0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xFF,
+    0xE0, 0xFF, 0xE0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x61, 0xC0, 0x61, 0xC0, 0x61, 0xC0, 0x61,
+    0xC0, 0x71, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0xE3,
+    0x8E, 0xE3, 0x8E, 0xE3, 0x8E, 0xE3, 0x8E, 0xE3, 0x8E, 0xE3, 0x8E, 0xE3, 0x8E, 0xE3, 0x8E, 0xE3,
+    0x8E, 0xFF, 0xFE, 0xFF, 0xFE, 0xE3, 0x8E, 0x00, 0xE3, 0x8E, 0x00, 0xE3, 0x8E, 0x00, 0xE3, 0x8E,
+    0x00, 0xE3, 0x8E, 0x00, 0xE3, 0x8E, 0x00, 0xE3, 0x8E, 0x00, 0xE3, 0x8E, 0x00, 0xE3, 0x8E, 0x00,
+    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0xF8,
+    0x00, 0xF8, 0x00, 0x18, 0x00, 0x1F, 0xE0, 0x1F, 0xF0, 0x1C, 0xF0, 0x18, 0x70, 0x18, 0x70, 0x1C,
+    0xF0, 0x1F, 0xF0, 0x1F, 0xE0, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xFF, 0x1C, 0xFF,
+    0x9C, 0xE3, 0x9C, 0xE1, 0xDC, 0xE3, 0x9C, 0xFF, 0x9C, 0xFF, 0x1C, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xFF, 0x00, 0xFF, 0x80, 0xE3, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE3, 0xC0, 0xFF, 0x80, 0xFF,
+    0x00, 0x7E, 0x00, 0x7F, 0x00, 0x67, 0x80, 0x01, 0x80, 0x1F, 0xC0, 0x1F, 0xC0, 0x01, 0xC0, 0x03,
+    0x80, 0x47, 0x80, 0xFF, 0x00, 0xFE, 0x00, 0xE1, 0xF8, 0xE3, 0xFC, 0xE7, 0x9E, 0xE7, 0x0E, 0xFE,
+    0x0E, 0xFE, 0x06, 0xE6, 0x0E, 0xE7, 0x0E, 0xE7, 0x9E, 0xE3, 0xFC, 0xE1, 0xF8, 0x1F, 0xC0, 0x3F,
+    0xC0, 0x79, 0xC0, 0x70, 0xC0, 0x78, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x38, 0xC0, 0x30, 0xC0, 0x70,
+    0xC0, 0x60, 0xC0, 0x18, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F,
+    0x80, 0xF3, 0xC0, 0xE1, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xF9, 0x80, 0x7F,
+    0x80, 0x3F, 0x80, 0x33, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0xF3,
+    0xC0, 0xE1, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xF9, 0x80, 0x7F, 0x80, 0x3F,
+    0x80, 0x70, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x79,
+    0xC0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x06, 0x0E, 0x1C, 0x18, 0x00, 0xFF, 0xFF,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x3F, 0x80, 0x7F, 0x80, 0xF1, 0x00, 0xE0,
+    0x00, 0xFE, 0x00, 0xFE, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF9, 0x80, 0x7F, 0x80, 0x3F, 0x80, 0x3F,
+    0x00, 0x7F, 0x00, 0x73, 0x00, 0x70, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x03, 0x80, 0x47,
+    0x80, 0x7F, 0x80, 0x7F, 0x00, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xEE, 0xEE, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x3C, 0xF8, 0xF8, 0x1F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x1C, 0x60,
+    0x00, 0x1C, 0x60, 0x00, 0x1C, 0x7F, 0x00, 0x1C, 0x7F, 0x80, 0x18, 0x63, 0xC0, 0x38, 0x61, 0xC0,
+    0xF8, 0x63, 0xC0, 0xF0, 0x7F, 0x80, 0xE0, 0x7F, 0x00, 0xE1, 0xC0, 0x00, 0xE1, 0xC0, 0x00, 0xE1,
+    0xC0, 0x00, 0xE1, 0xC0, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0xE1, 0xC7, 0x00, 0xE1, 0xC3,
+    0x80, 0xE1, 0xC7, 0x00, 0xE1, 0xFF, 0x00, 0xE1, 0xFE, 0x00, 0x70, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0x70, 0x00, 0x70, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x79, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
+    0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x06, 0x00, 0x0F, 0x00, 0x0E, 0x00,
+    0x0C, 0x00, 0x00, 0x00, 0xE3, 0xC0, 0xE7, 0x80, 0xE7, 0x00, 0xEE, 0x00, 0xFC, 0x00, 0xF8, 0x00,
+    0xFE, 0x00, 0xEF, 0x00, 0xE7, 0x80, 0xE3, 0x80, 0xE1, 0xC0, 0x18, 0x00, 0x1C, 0x00, 0x0E, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0xE1, 0xC0, 0xE3, 0xC0, 0xE3, 0xC0, 0xE7, 0xC0, 0xEE, 0xC0, 0xEC, 0xC0,
+    0xFC, 0xC0, 0xF8, 0xC0, 0xF0, 0xC0, 0xF0, 0xC0, 0xE0, 0xC0, 0x3B, 0x80, 0x3F, 0x80, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0xC0, 0xE1, 0xC0, 0x71, 0xC0, 0x71, 0x80, 0x71, 0x80, 0x3B, 0x80,
+    0x3B, 0x80, 0x1B, 0x00, 0x1F, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0xFC, 0x00,
+    0xF8, 0x00, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0,
+    0xE1, 0xC0, 0xE1, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0E, 0x00,
+    0x0E, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0x0E, 0x00, 0x0E, 0x00, 0x0F, 0xF0, 0x0F, 0xFC, 0x0E, 0x7C,
+    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1E, 0x0E, 0x3C, 0x0F, 0xFC, 0x0F, 0xF0, 0x18, 0x00,
+    0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x18, 0x00, 0x1F, 0xE0,
+    0x1F, 0xF0, 0x1C, 0xF0, 0x18, 0x70, 0x18, 0x70, 0x1C, 0xF0, 0x1F, 0xF0, 0x1F, 0xE0, 0x0F, 0xE0,
+    0x3F, 0xF0, 0x7C, 0xF8, 0x70, 0x3C, 0xE0, 0x1C, 0xFE, 0x1C, 0xFF, 0x9C, 0xF3, 0xFC, 0xE1, 0xFC,
+    0xE0, 0x1C, 0xE0, 0x1C, 0x70, 0x3C, 0x7C, 0xF8, 0x3F, 0xF0, 0x0F, 0xE0, 0x3F, 0x00, 0x7F, 0x80,
+    0xF3, 0xC0, 0xF9, 0xC0, 0xFF, 0xE0, 0xEF, 0xE0, 0xE7, 0xE0, 0xE0, 0xC0, 0xFB, 0xC0, 0x7F, 0x80,
+    0x3F, 0x00, 0xE0, 0x0F, 0x00, 0xE0, 0x1F, 0x00, 0x70, 0x3F, 0x00, 0x70, 0x38, 0x00, 0x70, 0x30,
+    0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0xE0, 0x00, 0x1C, 0xE0, 0x00, 0x1C, 0xC0, 0x00,
+    0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x00, 0x00, 0xE0,
+    0xF0, 0xE0, 0xF0, 0x71, 0xC0, 0x71, 0x80, 0x73, 0x80, 0x3B, 0x80, 0x3B, 0x00, 0x1F, 0x00, 0x1F,
+    0x00, 0x1E, 0x00, 0x0E, 0x00, 0x1D, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0xE0, 0x38, 0xE0,
+    0x78, 0xE0, 0x78, 0xE0, 0xF8, 0xE1, 0xF8, 0xE3, 0xB8, 0xE3, 0xB8, 0xE7, 0x38, 0xEE, 0x38, 0xFE,
+    0x38, 0xFC, 0x38, 0xF8, 0x38, 0xF8, 0x38, 0xF0, 0x3E, 0xE0, 0x3E, 0x00, 0x0C, 0x00, 0x1C, 0x00,
+    0x18, 0x00, 0x38, 0x3B, 0x80, 0x3F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xC0, 0xE3,
+    0xC0, 0xE3, 0xC0, 0xE7, 0xC0, 0xEE, 0xC0, 0xEC, 0xC0, 0xFC, 0xC0, 0xF8, 0xC0, 0xF0, 0xC0, 0xF0,
+    0xC0, 0xE0, 0xF0, 0x00, 0x70, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xC0, 0x30, 0x00, 0x30, 0x00, 0xFE,
+    0x00, 0xFE, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xC0, 0x3F, 0xF0, 0x39, 0xF0, 0x30, 0x78, 0x30,
+    0x38, 0x30, 0x38, 0x30, 0x78, 0x39, 0xF0, 0x3F, 0xF0, 0x3F, 0xC0, 0xFE, 0x00, 0xFE, 0x00, 0x70,
+    0x00, 0x70, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x71, 0xE0, 0x70, 0xE0, 0x71, 0xE0, 0x7F, 0xC0, 0x3F,
+    0x80, 0x7F, 0x80, 0xFF, 0xC0, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE6, 0xE0, 0xE7, 0xE0, 0xFF,
+    0xC0, 0xFF, 0x80, 0xE1, 0x80, 0xE1, 0xC0, 0xE0, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF,
+    0x00, 0xFF, 0x80, 0xE3, 0xC0, 0xE1, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE6, 0xE0, 0xE7, 0xC0, 0xF7,
+    0xC0, 0xFF, 0x80, 0xFF, 0x80, 0xE1, 0x80, 0xE1, 0x80, 0xE0, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x01,
+    0xC0, 0x01, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x3F,
+    0xE0, 0x3F, 0xE0, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x30,
+    0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x7F, 0x80, 0x7F,
+    0x80, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70,
+    0x00, 0x70, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF,
+    0x80, 0xFF, 0xC0, 0xF3, 0xE0, 0xE0, 0xE0, 0xE0, 0x60, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
+    0xE0, 0x00, 0xE0, 0x03, 0xE0, 0x0F, 0xC0, 0x0F, 0x80, 0xFF, 0x00, 0xFF, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xFF, 0x00, 0xFF, 0x80, 0xE3, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0x01,
+    0xC0, 0x03, 0x80, 0x0F, 0x80, 0x0F, 0x00, 0x70, 0xE1, 0xC0, 0x78, 0xE3, 0xC0, 0x38, 0xE7, 0x80,
+    0x1C, 0xE7, 0x00, 0x0E, 0xEE, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07,
+    0xFC, 0x00, 0x0E, 0xEE, 0x00, 0x1C, 0xEF, 0x00, 0x3C, 0xE7, 0x80, 0x38, 0xE3, 0xC0, 0x70, 0xE1,
+    0xF0, 0xF0, 0xE1, 0xF0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
+    0x71, 0x8E, 0x00, 0x39, 0x9C, 0x00, 0x39, 0x9C, 0x00, 0x1D, 0xB8, 0x00, 0x0F, 0xF0, 0x00, 0x07,
+    0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1D, 0xFC, 0x00, 0x39, 0x9E, 0x00, 0x71, 0x8F, 0x80, 0xE1, 0x87,
+    0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x7F, 0x80, 0x7F, 0xC0, 0x73, 0xC0,
+    0x00, 0xE0, 0x00, 0xC0, 0x03, 0xC0, 0x1F, 0x80, 0x1F, 0xC0, 0x03, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x73, 0xE0, 0xFF, 0xC0, 0x7F, 0x80, 0x0E, 0x00, 0x07, 0x00, 0x1E, 0x00, 0x7F, 0x00,
+    0x7F, 0x80, 0x63, 0x80, 0x03, 0x80, 0x3F, 0x00, 0x3F, 0x80, 0x03, 0x80, 0x01, 0xC0, 0x63, 0x80,
+    0x7F, 0x80, 0x7F, 0x00, 0x0C, 0x00, 0x0E, 0x00, 0x3E, 0x00, 0xE0, 0xF0, 0xE1, 0xE0, 0xE1, 0xC0,
+    0xE3, 0x80, 0xE7, 0x00, 0xEE, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xEF, 0x00, 0xE7, 0x80,
+    0xE3, 0xC0, 0xE1, 0xE0, 0xE0, 0xF8, 0xE0, 0x78, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
+    0xE3, 0xC0, 0xE7, 0x80, 0xE7, 0x00, 0xEE, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0xFE, 0x00, 0xEF, 0x00,
+    0xE7, 0x80, 0xE3, 0xE0, 0xE1, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x38,
+    0xE0, 0x70, 0xE0, 0xF0, 0xE0, 0xE0, 0xED, 0xC0, 0xEF, 0x80, 0xEF, 0x80, 0xFF, 0x00, 0xFF, 0x80,
+    0xEF, 0xC0, 0xED, 0xE0, 0xEC, 0xE0, 0xE0, 0x70, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0xE0, 0xE1, 0xC0,
+    0xE1, 0xC0, 0xEF, 0x80, 0xEF, 0x00, 0xFE, 0x00, 0xEF, 0x00, 0xEF, 0x80, 0xE1, 0xC0, 0xE0, 0xE0,
+    0xE0, 0x70, 0x30, 0x38, 0x30, 0x70, 0xFE, 0xE0, 0xFF, 0xC0, 0x33, 0x80, 0x37, 0x00, 0x3F, 0x00,
+    0x3E, 0x00, 0x3F, 0x00, 0x33, 0x80, 0x31, 0xC0, 0x30, 0xE0, 0x30, 0x70, 0x30, 0x78, 0x30, 0x38,
+    0x70, 0xE0, 0xFD, 0xC0, 0x73, 0x80, 0x77, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x77, 0x00, 0x73, 0x80,
+    0x73, 0xC0, 0x71, 0xE0, 0x70, 0xE0, 0xFE, 0x0E, 0xFE, 0x1C, 0x0E, 0x38, 0x0E, 0x70, 0x0E, 0xE0,
+    0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x0F, 0xC0, 0x0E, 0xE0, 0x0E, 0x70, 0x0E, 0x38, 0x0E, 0x1C,
+    0x0E, 0x1E, 0x0E, 0x0E, 0xF8, 0x70, 0xF8, 0xE0, 0x19, 0xC0, 0x1B, 0x80, 0x1F, 0x00, 0x1F, 0x00,
+    0x1F, 0x80, 0x19, 0xC0, 0x18, 0xE0, 0x18, 0x70, 0x18, 0x78, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30,
+    0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xFF, 0xF0, 0xFF, 0xF0, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30,
+    0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x3C, 0xE0, 0x3C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C,
+    0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0,
+    0xE1, 0xC0, 0xE1, 0xE0, 0xE1, 0xE0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0xE0, 0x3F, 0xE0, 0x3F,
+    0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xFF, 0xF0, 0xFF, 0xF0, 0xE0, 0x30, 0xE0, 0x30,
+    0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE1, 0xF8, 0xE1, 0xF8, 0xE1, 0xC0,
+    0xE1, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0,
+    0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0xE0, 0x70, 0x00, 0xE0, 0x70, 0x00, 0xE0, 0x70, 0x00, 0xE0,
+    0x70, 0x00, 0xE0, 0x7F, 0x80, 0xE0, 0x7F, 0xE0, 0xE0, 0x79, 0xE0, 0xE0, 0x70, 0x70, 0xE0, 0x70,
+    0x70, 0xE0, 0x70, 0x70, 0xE0, 0x70, 0x70, 0xE0, 0x70, 0x70, 0xE0, 0x70, 0x70, 0x00, 0x00, 0xF0,
+    0x00, 0x01, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0x80, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xE1,
+    0xC0, 0x00, 0xE1, 0xC0, 0x00, 0xE1, 0xFE, 0x00, 0xE1, 0xFF, 0x00, 0xE1, 0xCF, 0x00, 0xE1, 0xC3,
+    0x80, 0xE1, 0xC3, 0x80, 0xE1, 0xC3, 0x80, 0xE1, 0xC3, 0x80, 0x00, 0x03, 0x80, 0x00, 0x0F, 0x00,
+    0x00, 0x1F, 0x00, 0x00, 0x1E, 0x00, 0x0F, 0xE0, 0x3F, 0xE0, 0x7C, 0x60, 0x70, 0x00, 0xE1, 0xF8,
+    0xE3, 0xFC, 0xE3, 0xDC, 0xE3, 0x0C, 0xE7, 0x0E, 0xE7, 0x0E, 0xE7, 0x0C, 0x73, 0x1C, 0x7F, 0xFC,
+    0x3F, 0xF8, 0x0F, 0xE0, 0x01, 0xC0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3C, 0x3E, 0x00, 0x7E, 0x00,
+    0xF8, 0x00, 0xE7, 0xC0, 0xCF, 0xE0, 0xCE, 0xE0, 0xCC, 0x60, 0xEC, 0xE0, 0xFF, 0xE0, 0x7F, 0xC0,
+    0x3F, 0x80, 0x07, 0x80, 0x03, 0xE0, 0x01, 0xE0, 0x0F, 0xE0, 0x3F, 0xF0, 0x7C, 0x60, 0x70, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x00,
+    0x7C, 0x60, 0x3F, 0xF0, 0x1F, 0xE0, 0x07, 0x00, 0x03, 0x80, 0x0F, 0x00, 0x3F, 0x00, 0x7F, 0x00,
+    0xF9, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF9, 0x00, 0x7F, 0x80,
+    0x3F, 0x80, 0x0C, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x3E, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x06, 0x00,
+    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+    0x06, 0x00, 0x06, 0x00, 0x07, 0x80, 0x07, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
+    0xFF, 0xC0, 0xFF, 0xC0, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00,
+    0x0C, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xE0, 0x38, 0x70, 0x70,
+    0x70, 0xE0, 0x38, 0xE0, 0x39, 0xC0, 0x1D, 0xC0, 0x1F, 0x80, 0x0F, 0x80, 0x07, 0x00, 0x07, 0x00,
+    0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xE0, 0xC0, 0xE1, 0xC0, 0x71, 0xC0,
+    0x71, 0xC0, 0x73, 0x80, 0x3B, 0x80, 0x3B, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0x1E, 0x00, 0x0E, 0x00,
+    0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0xE0, 0x38, 0x70, 0x70, 0x70, 0x60, 0x38, 0xE0,
+    0x39, 0xC0, 0x1D, 0xC0, 0x1F, 0x80, 0x0F, 0x80, 0x0F, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x07, 0x00,
+    0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xE0, 0xC0, 0xE1, 0xC0, 0x71, 0xC0, 0x71, 0x80, 0x73, 0x80,
+    0x3B, 0x80, 0x3B, 0x00, 0x1F, 0x00, 0x1E, 0x00, 0x7F, 0x80, 0x7F, 0x80, 0x0E, 0x00, 0x0E, 0x00,
+    0x0E, 0x00, 0x0E, 0x00, 0x70, 0x78, 0x70, 0x70, 0x38, 0xE0, 0x1D, 0xE0, 0x1F, 0xC0, 0x0F, 0x80,
+    0x07, 0x80, 0x07, 0x80, 0x0F, 0x80, 0x0F, 0xC0, 0x1D, 0xE0, 0x38, 0xE0, 0x38, 0x70, 0x70, 0x7C,
+    0xE0, 0x3C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0xF1, 0xC0, 0x73, 0x80, 0x3B, 0x80,
+    0x1F, 0x00, 0x1E, 0x00, 0x0E, 0x00, 0x1F, 0x00, 0x3F, 0x80, 0x73, 0x80, 0x71, 0xE0, 0xE0, 0xE0,
+    0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0xFF, 0xE7, 0x00, 0xFF, 0xE7, 0x00, 0x0E, 0x07, 0x00, 0x0E,
+    0x07, 0x00, 0x0E, 0x07, 0x00, 0x0E, 0x07, 0x00, 0x0E, 0x07, 0x00, 0x0E, 0x07, 0x00, 0x0E, 0x07,
+    0x00, 0x0E, 0x07, 0x00, 0x0E, 0x07, 0x00, 0x0E, 0x07, 0x00, 0x0E, 0x07, 0x00, 0x0F, 0xFF, 0xC0,
+    0x0F, 0xFF, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0xFF,
+    0x30, 0xFF, 0x30, 0x1C, 0x30, 0x1C, 0x30, 0x1C, 0x30, 0x1C, 0x30, 0x1C, 0x30, 0x1C, 0x30, 0x1C,
+    0x30, 0x1F, 0xFC, 0x1F, 0xFC, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xE0, 0x7F, 0xE0, 0x3F, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
+    0x38, 0x61, 0xC0, 0x61, 0xC0, 0x61, 0xC0, 0x61, 0xC0, 0x71, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x01,
+    0xC0, 0x01, 0xC0, 0x01, 0xE0, 0x01, 0xE0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xEE, 0xE0, 0xEE, 0xE0, 0xFF, 0xE0, 0x7F, 0xE0, 0x3F,
+    0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xED, 0xC0, 0x7D, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x0D, 0xC0, 0x0D, 0xC0, 0x01, 0xC0, 0x01,
+    0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xC0, 0xFF, 0xE0, 0xF1,
+    0xE0, 0xE0, 0xE0, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0x00, 0xFF, 0x80, 0xF3, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0x01,
+    0xFC, 0x00, 0x03, 0xFE, 0x00, 0x07, 0x9F, 0x00, 0x0F, 0x07, 0x00, 0xCE, 0x03, 0x00, 0xEE, 0x03,
+    0x80, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00,
+    0x0F, 0x00, 0x00, 0x07, 0xC6, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xE0, 0x0F, 0xF0,
+    0xCF, 0x78, 0xFC, 0x38, 0xFF, 0xF8, 0x7F, 0xF8, 0x1C, 0x00, 0x1C, 0x00, 0x0F, 0x10, 0x0F, 0xF0,
+    0x07, 0xF0, 0x01, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x07, 0x9F, 0x00, 0x0F, 0x07, 0x00, 0xCE, 0x03,
+    0x00, 0xEE, 0x03, 0x80, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC6, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x00,
+    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x07, 0xE0, 0x0F, 0xF0, 0xCF,
+    0x78, 0xFC, 0x38, 0xFF, 0xF8, 0x7F, 0xF8, 0x1C, 0x00, 0x1C, 0x00, 0x0F, 0x10, 0x0F, 0xF0, 0x03,
+    0xF0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x03, 0xB8, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0xE1, 0xC0, 0x78, 0xE3, 0xC0, 0x38, 0xE3, 0x80, 0x1C, 0xE7, 0x00, 0x0E, 0xEE,
+    0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x0E, 0xEE, 0x00,
+    0x1C, 0xEF, 0x00, 0x3C, 0xE7, 0x80, 0x38, 0xE3, 0x80, 0x70, 0xE1, 0xC0, 0xF0, 0xE1, 0xE0, 0x06,
     0x60, 0x07, 0xE0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x71, 0x8E, 0x39, 0x9C, 0x39, 0x9C, 0x1D,
     0xB8, 0x0F, 0xF0, 0x07, 0xE0, 0x0F, 0xF0, 0x1D, 0xB8, 0x39, 0x9C, 0x71, 0x8E, 0xE1, 0x87, 0xE0,
-    0xEE, 0x1E, 0xE1, 0xCE, 0x38, 0xE7, 0x0E, 0xE0, 0xFC, 0x0F, 0xF8, 0xFF, 0xCE, 0x3E, 0xE0, 0xEE,
-    0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x70, 0x0E, 0x01, 0xE0, 0xFC, 0x0F, 0x80, 0xE3, 0xF8, 0xEE, 0x73,
-    0xB8, 0xFC, 0x3F, 0xCF, 0xFB, 0x9F, 0xE1, 0xF8, 0x7E, 0x1C, 0x07, 0x03, 0xC3, 0xE0, 0xF0, 0x0F,
-    0xF8, 0x1F, 0xF0, 0x38, 0x60, 0x70, 0xC0, 0xE1, 0x81, 0xC3, 0x03, 0x86, 0x07, 0x0C, 0x0E, 0x18,
-    0x18, 0x30, 0x70, 0x60, 0xE0, 0xC7, 0x81, 0x9F, 0x03, 0xF8, 0x07, 0x80, 0x07, 0x00, 0x0E, 0x00,
-    0x38, 0x00, 0x60, 0x1F, 0xE0, 0xFF, 0x07, 0x18, 0x38, 0xC1, 0xC6, 0x0E, 0x30, 0x61, 0x87, 0x0C,
-    0x78, 0x67, 0x83, 0x38, 0x1E, 0x00, 0x70, 0x03, 0x80, 0x38, 0x01, 0x80, 0xE0, 0x3E, 0x03, 0xE0,
-    0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3E,
-    0x03, 0xE0, 0x30, 0x03, 0x00, 0x70, 0x1F, 0x01, 0xE0, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xFF, 0xFF,
-    0xFE, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1C, 0x07, 0x01, 0xC1, 0xF0, 0x78, 0xE0, 0x33, 0x80, 0xCE,
-    0x03, 0x38, 0x0C, 0xE0, 0x33, 0x80, 0xCF, 0xFF, 0x3F, 0xFC, 0xE0, 0x33, 0x80, 0xCE, 0x03, 0x38,
-    0x0C, 0xE0, 0x33, 0x80, 0xFE, 0x03, 0xC0, 0x07, 0x00, 0x18, 0x00, 0xE0, 0x03, 0x00, 0xE1, 0xCE,
-    0x1C, 0xE1, 0xCE, 0x1C, 0xFF, 0xCF, 0xFC, 0xE1, 0xCE, 0x1C, 0xE1, 0xCE, 0x1C, 0xE1, 0xF0, 0x07,
-    0x00, 0x60, 0x0E, 0x00, 0xC0, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0xCF,
-    0x7F, 0xE7, 0xFC, 0x03, 0x80, 0x70, 0x0E, 0x07, 0xC0, 0xF8, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x00,
-    0x61, 0xD8, 0x76, 0x1D, 0x87, 0x71, 0xDF, 0xF3, 0xFC, 0x07, 0x01, 0xC0, 0xF0, 0x3C, 0x0C, 0x03,
-    0x00, 0xC0, 0x70, 0x0E, 0x1C, 0x03, 0x87, 0x81, 0xE1, 0xE0, 0x7C, 0x6C, 0x3F, 0x1B, 0x0D, 0xC6,
-    0x63, 0x73, 0x99, 0x9C, 0xE7, 0x67, 0x38, 0xF9, 0xCE, 0x3C, 0x73, 0x8F, 0x1C, 0xE1, 0xC7, 0x38,
-    0x01, 0xFE, 0x00, 0x3C, 0x00, 0x07, 0x00, 0x01, 0x80, 0x00, 0xE0, 0x00, 0x30, 0x70, 0x38, 0xE0,
-    0xF1, 0xE1, 0xE3, 0xC7, 0xCF, 0xCF, 0x9D, 0xBF, 0x3B, 0x6E, 0x73, 0xCC, 0xE7, 0x19, 0xCE, 0x33,
-    0x80, 0x78, 0x00, 0x70, 0x00, 0xE0, 0x03, 0x80, 0x06, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x0C, 0xC0, 0x3F, 0x00, 0x78, 0x00, 0x00, 0x07, 0x00, 0x1E, 0x00, 0x78, 0x03, 0xF0, 0x0D, 0xC0,
-    0x73, 0x01, 0xCE, 0x06, 0x18, 0x38, 0x70, 0xFF, 0xC7, 0xFF, 0x1C, 0x0E, 0x60, 0x3B, 0x80, 0x7E,
-    0x01, 0xC0, 0x3B, 0x8F, 0xE1, 0xF0, 0x00, 0x00, 0x0F, 0xC3, 0xF8, 0xCF, 0x01, 0xCF, 0xF7, 0xFD,
-    0xE7, 0x61, 0xDC, 0x77, 0xFC, 0xFF, 0x0C, 0xC0, 0x33, 0x00, 0x00, 0x01, 0xC0, 0x07, 0x80, 0x1E,
-    0x00, 0xFC, 0x03, 0x70, 0x1C, 0xC0, 0x73, 0x81, 0x86, 0x0E, 0x1C, 0x3F, 0xF1, 0xFF, 0xC7, 0x03,
-    0x98, 0x0E, 0xE0, 0x1F, 0x80, 0x70, 0x3B, 0x8E, 0xE0, 0x00, 0x00, 0x3F, 0x0F, 0xE3, 0x3C, 0x07,
-    0x3F, 0xDF, 0xF7, 0x9D, 0x87, 0x71, 0xDF, 0xF3, 0xFC, 0x00, 0xFF, 0xE0, 0x1F, 0xFC, 0x07, 0xC0,
-    0x01, 0xD8, 0x00, 0x3B, 0x00, 0x0E, 0x60, 0x01, 0x8F, 0xF0, 0x71, 0xFE, 0x1C, 0x30, 0x03, 0xFE,
-    0x00, 0xFF, 0xC0, 0x18, 0x18, 0x07, 0x03, 0x00, 0xC0, 0x7F, 0xF8, 0x0F, 0xF8, 0x3F, 0x3E, 0x1F,
-    0xFF, 0x8C, 0xFD, 0xE0, 0x38, 0x73, 0xFF, 0xFB, 0xFF, 0xFD, 0xE7, 0x00, 0xC3, 0x80, 0x71, 0xF1,
-    0x3F, 0xFF, 0x8F, 0xFF, 0xC0, 0x33, 0x07, 0xE0, 0x78, 0x00, 0x0F, 0xFD, 0xFF, 0xB8, 0x07, 0x00,
-    0xE0, 0x1C, 0x03, 0xFE, 0x7F, 0xCE, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1F, 0xFF, 0xFF, 0x80,
-    0x33, 0x0F, 0xC1, 0xE0, 0x00, 0x00, 0x0F, 0xC7, 0xFB, 0xCF, 0xE1, 0xFF, 0xFF, 0xFF, 0x80, 0xE0,
-    0x3E, 0x67, 0xF8, 0xFE, 0x7F, 0x83, 0xFF, 0x1C, 0x7C, 0x00, 0xE0, 0x07, 0x80, 0x1C, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0x0F, 0xC0, 0xE7, 0x9F, 0x1F, 0xF0, 0x7E, 0x00, 0x7F, 0x1F, 0xE6,
-    0x78, 0x07, 0x01, 0xFF, 0xFF, 0xFF, 0x87, 0xF3, 0x9F, 0xE3, 0xF0, 0x1D, 0xC0, 0xEE, 0x00, 0x00,
-    0xFF, 0x07, 0xFE, 0x38, 0xF8, 0x01, 0xC0, 0x0F, 0x00, 0x38, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x03,
-    0xF0, 0x1F, 0x81, 0xCF, 0x3E, 0x3F, 0xE0, 0xFC, 0x00, 0x77, 0x1D, 0xC0, 0x00, 0x00, 0x7F, 0x1F,
-    0xE6, 0x78, 0x07, 0x01, 0xFF, 0xFF, 0xFF, 0x87, 0xF3, 0x9F, 0xE3, 0xF0, 0x03, 0xB8, 0x00, 0x77,
-    0x00, 0x00, 0x00, 0x38, 0x70, 0xE7, 0x8E, 0x3C, 0x71, 0xC7, 0x07, 0x39, 0xC0, 0x77, 0x70, 0x0F,
-    0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xE0, 0x03, 0xFE, 0x00, 0xEE, 0xE0, 0x39, 0xDE, 0x0F, 0x39, 0xE1,
-    0xC7, 0x1C, 0x70, 0xE1, 0xDE, 0x1C, 0x3C, 0x06, 0x60, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x71,
-    0x8E, 0x39, 0x9C, 0x39, 0x9C, 0x1D, 0xB8, 0x0F, 0xF0, 0x07, 0xE0, 0x0F, 0xF0, 0x1D, 0xB8, 0x39,
-    0x9C, 0x71, 0x8E, 0xE1, 0x87, 0x3B, 0x87, 0x70, 0x00, 0x3F, 0xC7, 0xFC, 0xE7, 0x80, 0x38, 0x06,
-    0x03, 0xC3, 0xF0, 0x7F, 0x01, 0xF0, 0x0E, 0x01, 0xC0, 0x3B, 0x9F, 0xFF, 0xCF, 0xF0, 0x77, 0x1D,
-    0xC0, 0x00, 0x00, 0x7F, 0x1F, 0xE6, 0x38, 0x0E, 0x3F, 0x0F, 0xE0, 0x38, 0x07, 0x63, 0xDF, 0xE7,
-    0xF0, 0x7F, 0xEF, 0xFC, 0x07, 0x01, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xFC, 0x03, 0xC0, 0x1C, 0x03,
-    0x80, 0x77, 0x3F, 0xFF, 0x9F, 0xE0, 0x7F, 0xCF, 0xF8, 0x0E, 0x01, 0xC0, 0x70, 0x1C, 0x03, 0x80,
-    0xF8, 0x07, 0xC0, 0x38, 0x03, 0x00, 0xE6, 0x3C, 0xFF, 0x1F, 0xC0, 0x1F, 0xC0, 0xFE, 0x00, 0x01,
-    0xC0, 0x7E, 0x07, 0xF0, 0x3F, 0x83, 0xFC, 0x3F, 0xE3, 0xBF, 0x1D, 0xF9, 0xCF, 0xDC, 0x7F, 0xE3,
-    0xFE, 0x1F, 0xE0, 0xFF, 0x07, 0xF0, 0x3F, 0x01, 0xC0, 0x3F, 0x8F, 0xE0, 0x00, 0x00, 0xE1, 0xF8,
-    0xFE, 0x3F, 0x9F, 0xEE, 0xFB, 0x3F, 0xCF, 0xE3, 0xF0, 0xFC, 0x3E, 0x0C, 0x1D, 0xC0, 0xEE, 0x00,
-    0x01, 0xC0, 0x7E, 0x07, 0xF0, 0x3F, 0x83, 0xFC, 0x3F, 0xE3, 0xBF, 0x1D, 0xF9, 0xCF, 0xDC, 0x7F,
-    0xE3, 0xFE, 0x1F, 0xE0, 0xFF, 0x07, 0xF0, 0x3F, 0x01, 0xC0, 0x3B, 0x8E, 0xE0, 0x00, 0x00, 0xE1,
-    0xF8, 0xFE, 0x3F, 0x9F, 0xEE, 0xFB, 0x3F, 0xCF, 0xE3, 0xF0, 0xFC, 0x3E, 0x0C, 0x0E, 0xE0, 0x1D,
-    0xC0, 0x00, 0x00, 0x7F, 0x03, 0xFF, 0x0F, 0x9F, 0x1C, 0x0F, 0x70, 0x0E, 0xE0, 0x1D, 0xC0, 0x3B,
-    0x80, 0x37, 0x00, 0xEE, 0x01, 0xDC, 0x03, 0x9C, 0x0F, 0x3E, 0x7C, 0x3F, 0xF0, 0x1F, 0xC0, 0x3B,
-    0x87, 0x70, 0x00, 0x00, 0x03, 0xF0, 0xFF, 0x3E, 0xF7, 0x0E, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0xEF,
-    0x3C, 0xFF, 0x0F, 0xC0, 0x0F, 0xE0, 0x7F, 0xE1, 0xF3, 0xE3, 0x81, 0xEE, 0x01, 0xDC, 0x03, 0xBF,
-    0xFF, 0x7F, 0xFE, 0xE0, 0x1D, 0xC0, 0x3B, 0x80, 0x73, 0x81, 0xE7, 0xCF, 0x87, 0xFE, 0x03, 0xF8,
-    0x00, 0x3F, 0x0F, 0xF3, 0xCF, 0x70, 0x6F, 0xFF, 0xFF, 0xF8, 0x3F, 0x0E, 0xF3, 0xCF, 0xF0, 0xFC,
-    0x00, 0x0E, 0xE0, 0x1D, 0xC0, 0x00, 0x00, 0x7F, 0x03, 0xFF, 0x0F, 0x9F, 0x1C, 0x0F, 0x70, 0x0E,
-    0xE0, 0x1D, 0xFF, 0xFB, 0xFF, 0xF7, 0x00, 0xEE, 0x01, 0xDC, 0x03, 0x9C, 0x0F, 0x3E, 0x7C, 0x3F,
-    0xF0, 0x1F, 0xC0, 0x3B, 0x87, 0x70, 0x00, 0x00, 0x03, 0xF0, 0xFF, 0x3C, 0xF7, 0x06, 0xFF, 0xFF,
-    0xFF, 0x83, 0xF0, 0xEF, 0x3C, 0xFF, 0x0F, 0xC0, 0x3B, 0x83, 0xB8, 0x00, 0x07, 0xF0, 0xFF, 0xC6,
-    0x3E, 0x00, 0xE0, 0x07, 0x00, 0x71, 0xFF, 0x1F, 0xF0, 0x07, 0x00, 0x70, 0x07, 0x00, 0xE6, 0x3E,
-    0xFF, 0xC7, 0xF0, 0x77, 0x1D, 0xC0, 0x00, 0x00, 0x7E, 0x1F, 0xC6, 0x78, 0x06, 0x1F, 0xC7, 0xF0,
-    0x1C, 0x0E, 0x47, 0xBF, 0xCF, 0xE0, 0x1F, 0xC0, 0xFE, 0x00, 0x01, 0xC0, 0xE7, 0x07, 0x38, 0x39,
-    0xC1, 0x87, 0x1C, 0x38, 0xE0, 0xE6, 0x07, 0xF0, 0x1F, 0x80, 0x78, 0x03, 0xC0, 0x1C, 0x09, 0xE0,
-    0x7E, 0x03, 0xE0, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x00, 0x0E, 0x0D, 0xC3, 0x9C, 0x73, 0x8C, 0x71,
-    0x87, 0x70, 0xEE, 0x0D, 0x81, 0xF0, 0x1C, 0x03, 0x80, 0x70, 0x1C, 0x1F, 0x83, 0xE0, 0x00, 0x1D,
-    0xC0, 0xEE, 0x00, 0x01, 0xC0, 0xE7, 0x07, 0x38, 0x39, 0xC1, 0x87, 0x1C, 0x38, 0xE0, 0xE6, 0x07,
-    0xF0, 0x1F, 0x80, 0x78, 0x03, 0xC0, 0x1C, 0x09, 0xE0, 0x7E, 0x03, 0xE0, 0x00, 0x3B, 0x87, 0x70,
-    0x00, 0x00, 0x0E, 0x0D, 0xC3, 0x9C, 0x73, 0x8C, 0x71, 0x87, 0x70, 0xEE, 0x0D, 0x81, 0xF0, 0x1C,
-    0x03, 0x80, 0x70, 0x1C, 0x1F, 0x83, 0xE0, 0x00, 0x06, 0x60, 0x37, 0x03, 0xF0, 0x1B, 0x0E, 0x07,
-    0x38, 0x39, 0xC1, 0xCE, 0x0C, 0x38, 0xE1, 0xC7, 0x07, 0x30, 0x3F, 0x80, 0xFC, 0x03, 0xC0, 0x1E,
-    0x00, 0xE0, 0x4F, 0x03, 0xF0, 0x1F, 0x00, 0x0C, 0xC1, 0xB8, 0x7E, 0x0D, 0x80, 0x01, 0xC1, 0xB8,
-    0x73, 0x8E, 0x71, 0x8E, 0x30, 0xEE, 0x1D, 0xC1, 0xB0, 0x3E, 0x03, 0x80, 0x70, 0x0E, 0x03, 0x83,
-    0xF0, 0x7C, 0x00, 0x3B, 0x87, 0x70, 0x00, 0x70, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC,
-    0x1F, 0xC7, 0xBF, 0xF3, 0xFE, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x3B, 0x8E, 0xE0, 0x00,
-    0x00, 0x61, 0xD8, 0x76, 0x1D, 0x87, 0x71, 0xDF, 0xF3, 0xFC, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0xFF,
-    0xFF, 0xFE, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x3E,
-    0x0F, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-    0xF0, 0xF0, 0x30, 0x30, 0x30, 0x06, 0x60, 0x06, 0x60, 0x00, 0x00, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
-    0x07, 0xE0, 0x07, 0xE0, 0x07, 0xFF, 0x87, 0xFF, 0xC7, 0xE3, 0xE7, 0xE0, 0xE7, 0xE0, 0xE7, 0xE0,
-    0xE7, 0xE0, 0xE7, 0xE3, 0xE7, 0xFF, 0xC7, 0x7F, 0x87, 0x0C, 0xC0, 0x33, 0x00, 0x00, 0x00, 0x00,
-    0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xFF, 0x1F, 0xFE, 0x7E, 0x39, 0xF8, 0x77, 0xE3, 0x9F,
-    0xFE, 0x7F, 0xF1, 0xC0, 0x7F, 0xF7, 0xFF, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFD,
-    0xFF, 0xFF, 0xF0, 0x66, 0xEE, 0xE0, 0x77, 0x76, 0xE0, 0x77, 0x76, 0xE0, 0x66, 0x6E, 0xEE, 0xEE,
-    0xEE, 0x77, 0x77, 0x77, 0x66, 0xEE, 0x77, 0x77, 0x77, 0x66, 0xEE, 0x0C, 0x03, 0x00, 0xC0, 0x30,
-    0x0C, 0x3F, 0xFF, 0xFC, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C,
-    0x03, 0x00, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x3F, 0xFF, 0xFC, 0x30, 0x0C, 0x03, 0x0F, 0xFF,
-    0xFF, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0x7B, 0xFF, 0xFF, 0x78, 0xE1, 0xC3, 0xF0,
-    0xE1, 0xF8, 0x70, 0xE0, 0x7C, 0x38, 0x00, 0xEE, 0x38, 0x00, 0xC6, 0x70, 0x00, 0xC6, 0x70, 0x00,
-    0xC6, 0xE0, 0x00, 0xEE, 0xC0, 0x00, 0x7D, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x03, 0xBE, 0x3E, 0x03,
-    0x77, 0x77, 0x07, 0x63, 0x63, 0x0E, 0x63, 0x63, 0x0E, 0x63, 0x63, 0x1C, 0x77, 0x77, 0x1C, 0x3E,
-    0x3E, 0x18, 0xE3, 0x9C, 0xE1, 0xC3, 0x8E, 0x18, 0x61, 0xC3, 0x0E, 0x1C, 0xE3, 0x1C, 0x60, 0x00,
-    0xE0, 0x38, 0x07, 0x01, 0xC0, 0x30, 0x0E, 0x01, 0x80, 0x70, 0x0C, 0x03, 0x80, 0x60, 0x1C, 0x07,
-    0x00, 0xE0, 0x38, 0x00, 0x7C, 0xDF, 0x9F, 0x3E, 0x7C, 0xDB, 0xBE, 0x0C, 0x1C, 0x3C, 0x7C, 0x6C,
-    0xFE, 0x0C, 0x0C, 0x7E, 0xC1, 0x83, 0xE1, 0xE0, 0xD3, 0xBE, 0x1E, 0x71, 0x83, 0xEE, 0xEC, 0xDB,
-    0x9E, 0xFE, 0x1C, 0x70, 0xC1, 0x87, 0x0C, 0x18, 0x7C, 0xDD, 0x9B, 0xE7, 0xFC, 0xFB, 0xBE, 0x7C,
-    0xDF, 0x9F, 0x37, 0xE1, 0xCF, 0x3C, 0x7C, 0xDF, 0x9F, 0x3E, 0x7C, 0xDB, 0xBE, 0x3F, 0xF3, 0x33,
-    0x33, 0x7C, 0xD8, 0x38, 0xE3, 0xCF, 0x18, 0x3F, 0x7C, 0xD8, 0x31, 0xE0, 0xE0, 0xD3, 0xFE, 0x0C,
-    0x1C, 0x3C, 0x7C, 0x6C, 0xFE, 0x0C, 0x0C, 0x7E, 0xC1, 0x83, 0xE1, 0xE0, 0xD3, 0xBE, 0x1E, 0x71,
-    0x83, 0xEE, 0xEC, 0xDB, 0x9E, 0xFE, 0x1C, 0x70, 0xC1, 0x87, 0x0C, 0x18, 0x7C, 0xDD, 0x9B, 0xE7,
-    0xFC, 0xFB, 0xBE, 0x7C, 0xDF, 0x9F, 0x37, 0xE1, 0xCF, 0x3C, 0x07, 0xE0, 0xFE, 0x1E, 0x21, 0xC0,
-    0x7F, 0xC7, 0xFC, 0x38, 0x07, 0xF8, 0x7F, 0x81, 0x80, 0x1C, 0x01, 0xF2, 0x0F, 0xF0, 0x7F, 0xFF,
-    0xEF, 0xFE, 0x06, 0x00, 0x60, 0x07, 0xC0, 0x7C, 0x1F, 0x83, 0xE0, 0x37, 0xC0, 0x7C, 0x1F, 0x83,
-    0xE0, 0x36, 0x00, 0x60, 0x06, 0x00, 0x3F, 0x83, 0xFC, 0x33, 0xC0, 0x0C, 0x00, 0xCF, 0xFE, 0x07,
-    0x81, 0xE0, 0xFF, 0xE7, 0x00, 0x70, 0x07, 0x00, 0x3C, 0xC3, 0xFE, 0x1F, 0xC0, 0xFF, 0xFF, 0xFC,
-    0x1C, 0x01, 0xCF, 0xFD, 0xFF, 0x80, 0xE0, 0x78, 0xFF, 0x1F, 0x83, 0xC0, 0x1C, 0x01, 0xC0, 0x1C,
-    0x01, 0xC0, 0x3F, 0x03, 0xFC, 0x33, 0xC0, 0x0E, 0x00, 0xE1, 0xFE, 0x3F, 0xE7, 0x9F, 0x70, 0x76,
-    0x06, 0x60, 0x66, 0x0E, 0x60, 0xE7, 0xBC, 0x3F, 0x81, 0xF0, 0x07, 0x00, 0x1E, 0x00, 0xF8, 0x03,
-    0xF0, 0x0D, 0xC0, 0x73, 0x81, 0x8E, 0x0E, 0x18, 0x38, 0x70, 0xC1, 0xC7, 0x03, 0x1C, 0x0E, 0x60,
-    0x3B, 0xFF, 0xEF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E,
-    0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x70, 0xFF,
-    0xFF, 0xFD, 0xC0, 0x38, 0x03, 0x80, 0x38, 0x07, 0x00, 0x70, 0x07, 0x01, 0xC0, 0x70, 0x1E, 0x03,
-    0x80, 0xE0, 0x38, 0x07, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF0, 0x00, 0xE0, 0x38, 0x07, 0x01, 0xC0,
-    0x30, 0x0E, 0x01, 0x80, 0x70, 0x0C, 0x03, 0x80, 0x60, 0x1C, 0x07, 0x00, 0xE0, 0x38, 0x00, 0xFF,
-    0x80, 0x00, 0x30, 0x01, 0x80, 0x1C, 0x00, 0xC0, 0x06, 0x00, 0x70, 0x03, 0x80, 0x18, 0x70, 0xC7,
-    0xCE, 0x3E, 0x60, 0x3B, 0x01, 0xF8, 0x07, 0x80, 0x3C, 0x00, 0xE0, 0x06, 0x00, 0x7D, 0xE7, 0xFF,
-    0xE7, 0x3E, 0x73, 0x7F, 0xF7, 0xDE, 0x0F, 0x1F, 0x1E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0x38, 0x78, 0xF8, 0xF0, 0x3C, 0x6F, 0xFD, 0xBF, 0xB1, 0xE3,
-    0xC6, 0xFF, 0xDB, 0xFB, 0x1E, 0x03, 0x00, 0xC0, 0x73, 0xFF, 0xFF, 0xC3, 0x80, 0xC0, 0x70, 0xFF,
-    0xFF, 0xF3, 0x01, 0xC0, 0x60, 0x00, 0x01, 0xC3, 0xF7, 0xFB, 0xF0, 0xF0, 0x3F, 0x07, 0xF8, 0x3F,
-    0x01, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x3F, 0x07, 0xF8, 0x3F, 0x03, 0xC3, 0xF7, 0xFB, 0xF0, 0xE0,
-    0x00, 0x0F, 0xFF, 0xFF,
+    0xE0, 0xE1, 0xE0, 0xE1, 0xC0, 0xE3, 0x80, 0xE7, 0x00, 0xEE, 0x00, 0xFC, 0x00, 0xFF, 0x80, 0xFF,
+    0xC0, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0x00, 0xE0, 0x01,
+    0xE0, 0x0F, 0xC0, 0x0F, 0x80, 0xE3, 0xC0, 0xE3, 0x80, 0xE7, 0x00, 0xEE, 0x00, 0xFC, 0x00, 0xFF,
+    0x00, 0xFF, 0x80, 0xE7, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0x01, 0xC0, 0x03, 0xC0, 0x0F,
+    0x80, 0x0F, 0x00, 0x0F, 0xF8, 0x0F, 0xF8, 0x0E, 0x18, 0x0E, 0x18, 0x0E, 0x18, 0x0E, 0x18, 0x0E,
+    0x18, 0x0E, 0x18, 0x0E, 0x18, 0x0C, 0x18, 0x1C, 0x18, 0x1C, 0x18, 0x78, 0x18, 0xF8, 0x1E, 0xE0,
+    0x1E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x18, 0x1F, 0xE0, 0x1F, 0xE0, 0x1C, 0x60, 0x1C,
+    0x60, 0x1C, 0x60, 0x1C, 0x60, 0x18, 0x60, 0x38, 0x60, 0x78, 0x60, 0xF0, 0x60, 0xE0, 0x78, 0x00,
+    0x38, 0x00, 0x38, 0x00, 0x70, 0x00, 0x60, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE0,
+    0x30, 0xE0, 0x30, 0xFF, 0xF0, 0xFF, 0xF0, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE0,
+    0x30, 0xE0, 0x30, 0xE0, 0x30, 0x00, 0x30, 0x00, 0x70, 0x01, 0xF0, 0x01, 0xE0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x07, 0xC0, 0x07, 0x80, 0xE0, 0x30, 0xE0, 0x30, 0xE0,
+    0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xFF, 0xF0, 0xFF, 0xF0, 0xE0, 0x30, 0xE0, 0x30, 0xE0,
+    0x30, 0xE0, 0x30, 0xE0, 0x30, 0xE0, 0x3C, 0xE0, 0x3C, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x38, 0x00,
+    0x30, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xE1, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE1, 0xF0, 0x00, 0x70, 0x00, 0x60, 0x00, 0xE0, 0x00, 0xC0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF9, 0xE0, 0x7F,
+    0xE0, 0x3F, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0x80, 0x03,
+    0x80, 0x03, 0x80, 0x03, 0x80, 0x61, 0xC0, 0x61, 0xC0, 0x61, 0xC0, 0x61, 0xC0, 0x71, 0xC0, 0x7F,
+    0xC0, 0x3F, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x78, 0x1E, 0x00, 0x78, 0x1F, 0x00, 0x6C, 0x3F, 0x00,
+    0x6C, 0x37, 0x00, 0x66, 0x37, 0x00, 0xE6, 0x67, 0x00, 0xE7, 0x67, 0x00, 0xE3, 0xE7, 0x00, 0xE3,
+    0xC7, 0x00, 0xE3, 0xC7, 0x00, 0xE1, 0xC7, 0x00, 0xE0, 0x07, 0xC0, 0xE0, 0x03, 0xC0, 0x00, 0x01,
+    0xC0, 0x00, 0x01, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x70, 0x38, 0x70, 0x78, 0x78, 0x78,
+    0x78, 0xF8, 0xFC, 0xF8, 0xED, 0xF8, 0xED, 0xB8, 0xE7, 0x98, 0xE7, 0x18, 0xE7, 0x18, 0xE0, 0x1E,
+    0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x18, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x0C, 0xC0, 0x0F, 0xC0, 0x07, 0x80, 0x00, 0x00, 0x07,
+    0x00, 0x07, 0x80, 0x07, 0x80, 0x0F, 0xC0, 0x0D, 0xC0, 0x1C, 0xC0, 0x1C, 0xE0, 0x18, 0x60, 0x38,
+    0x70, 0x3F, 0xF0, 0x7F, 0xF0, 0x70, 0x38, 0x60, 0x38, 0xE0, 0x1C, 0xE0, 0x1C, 0x3B, 0x80, 0x3F,
+    0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x33, 0xC0, 0x01, 0xC0, 0x3F,
+    0xC0, 0x7F, 0xC0, 0x79, 0xC0, 0x61, 0xC0, 0x71, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x0C, 0xC0, 0x0C,
+    0xC0, 0x00, 0x00, 0x07, 0x00, 0x07, 0x80, 0x07, 0x80, 0x0F, 0xC0, 0x0D, 0xC0, 0x1C, 0xC0, 0x1C,
+    0xE0, 0x18, 0x60, 0x38, 0x70, 0x3F, 0xF0, 0x7F, 0xF0, 0x70, 0x38, 0x60, 0x38, 0xE0, 0x1C, 0xE0,
+    0x1C, 0x3B, 0x80, 0x3B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x33, 0xC0, 0x01,
+    0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0x79, 0xC0, 0x61, 0xC0, 0x71, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x00,
+    0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x01, 0xF0, 0x00, 0x03, 0xB0, 0x00, 0x03, 0xB0, 0x00, 0x07, 0x30,
+    0x00, 0x06, 0x3F, 0xC0, 0x0E, 0x3F, 0xC0, 0x1C, 0x30, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xF0, 0x00,
+    0x30, 0x30, 0x00, 0x70, 0x30, 0x00, 0x60, 0x3F, 0xE0, 0xE0, 0x3F, 0xE0, 0x3F, 0x3E, 0x00, 0x3F,
+    0xFF, 0x00, 0x33, 0xF7, 0x80, 0x01, 0xC3, 0x80, 0x3F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x79, 0xC0,
+    0x00, 0x61, 0xC0, 0x00, 0x71, 0xF1, 0x00, 0x7F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x33, 0x00, 0x3F,
+    0x00, 0x1E, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xFF, 0x80, 0xFF, 0x80, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF,
+    0xE0, 0xFF, 0xE0, 0x33, 0x00, 0x3F, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F,
+    0x80, 0xF3, 0xC0, 0xE1, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xF9, 0x80, 0x7F,
+    0x80, 0x3F, 0x80, 0x7F, 0x80, 0x7F, 0xE0, 0x71, 0xF0, 0x00, 0x70, 0x00, 0x78, 0x00, 0x38, 0x00,
+    0x38, 0xFF, 0xF8, 0xFF, 0xF8, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x70, 0x79, 0xF0, 0x3F, 0xE0, 0x1F,
+    0x80, 0x7F, 0x00, 0x7F, 0x80, 0x67, 0x80, 0x01, 0xC0, 0x01, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xE1,
+    0xC0, 0xF3, 0x80, 0x7F, 0x80, 0x3F, 0x00, 0x1D, 0xC0, 0x1D, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x7F,
+    0xE0, 0x71, 0xF0, 0x00, 0x70, 0x00, 0x78, 0x00, 0x38, 0x00, 0x38, 0xFF, 0xF8, 0xFF, 0xF8, 0xE0,
+    0x38, 0xE0, 0x38, 0xE0, 0x70, 0x79, 0xF0, 0x3F, 0xE0, 0x1F, 0x80, 0x77, 0x00, 0x77, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x80, 0x67, 0x80, 0x01, 0xC0, 0x01, 0xC0, 0xFF, 0xC0, 0xFF,
+    0xC0, 0xE1, 0xC0, 0xF3, 0x80, 0x7F, 0x80, 0x3F, 0x00, 0x03, 0xB8, 0x00, 0x03, 0xB8, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0xE1, 0xC0, 0x78, 0xE3, 0xC0, 0x38, 0xE3, 0x80, 0x1C, 0xE7, 0x00, 0x0E, 0xEE,
+    0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x0E, 0xEE, 0x00,
+    0x1C, 0xEF, 0x00, 0x3C, 0xE7, 0x80, 0x38, 0xE3, 0x80, 0x70, 0xE1, 0xC0, 0xF0, 0xE1, 0xE0, 0x06,
+    0x60, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x71, 0x8E, 0x39, 0x9C, 0x39, 0x9C, 0x1D, 0xB8, 0x0F,
+    0xF0, 0x07, 0xE0, 0x0F, 0xF0, 0x1D, 0xB8, 0x39, 0x9C, 0x71, 0x8E, 0xE1, 0x87, 0x3B, 0x80, 0x3B,
+    0x80, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x73, 0xC0, 0x00, 0xE0, 0x00, 0xC0, 0x03, 0xC0, 0x1F,
+    0x80, 0x1F, 0xC0, 0x03, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x73, 0xE0, 0xFF, 0xC0, 0x7F,
+    0x80, 0x77, 0x00, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x80, 0x63, 0x80, 0x03,
+    0x80, 0x3F, 0x00, 0x3F, 0x80, 0x03, 0x80, 0x01, 0xC0, 0x63, 0xC0, 0x7F, 0x80, 0x7F, 0x00, 0x7F,
+    0xE0, 0x7F, 0xE0, 0x01, 0xC0, 0x03, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1F, 0x80, 0x03,
+    0xC0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x73, 0xE0, 0xFF, 0xC0, 0x7F, 0x80, 0x7F, 0xC0, 0x7F,
+    0xC0, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01,
+    0xC0, 0x00, 0xC0, 0x01, 0xC0, 0x63, 0xC0, 0x7F, 0x80, 0x7F, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00,
+    0x00, 0xE0, 0x38, 0xE0, 0x78, 0xE0, 0x78, 0xE0, 0xF8, 0xE1, 0xF8, 0xE3, 0xB8, 0xE3, 0xB8, 0xE7,
+    0x38, 0xEE, 0x38, 0xFE, 0x38, 0xFC, 0x38, 0xF8, 0x38, 0xF8, 0x38, 0xF0, 0x38, 0xE0, 0x38, 0x3F,
+    0x80, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xC0, 0xE3, 0xC0, 0xE3, 0xC0, 0xE7, 0xC0, 0xEE,
+    0xC0, 0xEC, 0xC0, 0xFC, 0xC0, 0xF8, 0xC0, 0xF0, 0xC0, 0xF0, 0xC0, 0xE0, 0xC0, 0x1D, 0xC0, 0x1D,
+    0xC0, 0x00, 0x00, 0xE0, 0x38, 0xE0, 0x78, 0xE0, 0x78, 0xE0, 0xF8, 0xE1, 0xF8, 0xE3, 0xB8, 0xE3,
+    0xB8, 0xE7, 0x38, 0xEE, 0x38, 0xFE, 0x38, 0xFC, 0x38, 0xF8, 0x38, 0xF8, 0x38, 0xF0, 0x38, 0xE0,
+    0x38, 0x3B, 0x80, 0x3B, 0x80, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xC0, 0xE3, 0xC0, 0xE3, 0xC0, 0xE7,
+    0xC0, 0xEE, 0xC0, 0xEC, 0xC0, 0xFC, 0xC0, 0xF8, 0xC0, 0xF0, 0xC0, 0xF0, 0xC0, 0xE0, 0xC0, 0x0E,
+    0xE0, 0x0E, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x7C, 0xF8, 0x70, 0x3C, 0xE0, 0x1C, 0xE0,
+    0x1C, 0xE0, 0x1C, 0xE0, 0x0C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0x70, 0x3C, 0x7C, 0xF8, 0x3F,
+    0xF0, 0x0F, 0xE0, 0x3B, 0x80, 0x3B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0xFB,
+    0xC0, 0xE1, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xC0, 0xF3, 0xC0, 0x7F, 0x80, 0x3F,
+    0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x7C, 0xF8, 0x70, 0x3C, 0xE0, 0x1C, 0xE0, 0x1C, 0xFF, 0xFC, 0xFF,
+    0xFC, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0x70, 0x3C, 0x7C, 0xF8, 0x3F, 0xF0, 0x0F, 0xE0, 0x3F,
+    0x00, 0x7F, 0x80, 0xF3, 0xC0, 0xE0, 0xC0, 0xFF, 0xE0, 0xFF, 0xE0, 0xE0, 0xE0, 0xE1, 0xC0, 0xF3,
+    0xC0, 0x7F, 0x80, 0x3F, 0x00, 0x0E, 0xE0, 0x0E, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x7C,
+    0xF8, 0x70, 0x3C, 0xE0, 0x1C, 0xE0, 0x1C, 0xFF, 0xFC, 0xFF, 0xFC, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0,
+    0x1C, 0x70, 0x3C, 0x7C, 0xF8, 0x3F, 0xF0, 0x0F, 0xE0, 0x3B, 0x80, 0x3B, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0x00, 0x7F, 0x80, 0xF3, 0xC0, 0xE0, 0xC0, 0xFF, 0xE0, 0xFF, 0xE0, 0xE0, 0xE0, 0xE1,
+    0xC0, 0xF3, 0xC0, 0x7F, 0x80, 0x3F, 0x00, 0x3B, 0x80, 0x3B, 0x80, 0x00, 0x00, 0x7F, 0x00, 0xFF,
+    0xC0, 0x63, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x70, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0x70, 0x00,
+    0x70, 0x00, 0x70, 0x00, 0xE0, 0x63, 0xE0, 0xFF, 0xC0, 0x7F, 0x00, 0x77, 0x00, 0x77, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x67, 0x80, 0x01, 0x80, 0x1F, 0xC0, 0x1F, 0xC0, 0x01,
+    0xC0, 0x03, 0x80, 0x47, 0x80, 0xFF, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0xE0,
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x60, 0x38, 0xE0, 0x38, 0xE0, 0x1C, 0xC0, 0x1F, 0xC0, 0x0F,
+    0xC0, 0x07, 0x80, 0x07, 0x80, 0x07, 0x00, 0x4F, 0x00, 0x7E, 0x00, 0x7C, 0x00, 0x3F, 0x80, 0x3F,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xC0, 0xE1, 0xC0, 0x71, 0xC0, 0x71, 0x80, 0x71, 0x80, 0x3B,
+    0x80, 0x3B, 0x80, 0x1B, 0x00, 0x1F, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0xFC,
+    0x00, 0xF8, 0x00, 0x1D, 0xC0, 0x1D, 0xC0, 0x00, 0x00, 0xE0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x60, 0x38, 0xE0, 0x38, 0xE0, 0x1C, 0xC0, 0x1F, 0xC0, 0x0F, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x07,
+    0x00, 0x4F, 0x00, 0x7E, 0x00, 0x7C, 0x00, 0x3B, 0x80, 0x3B, 0x80, 0x00, 0x00, 0x00, 0x00, 0xE0,
+    0xC0, 0xE1, 0xC0, 0x71, 0xC0, 0x71, 0x80, 0x71, 0x80, 0x3B, 0x80, 0x3B, 0x80, 0x1B, 0x00, 0x1F,
+    0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x06, 0x60, 0x06,
+    0xE0, 0x0F, 0xC0, 0x0D, 0x80, 0xE0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x60, 0x38, 0xE0, 0x38,
+    0xE0, 0x1C, 0xC0, 0x1F, 0xC0, 0x0F, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x07, 0x00, 0x4F, 0x00, 0x7E,
+    0x00, 0x7C, 0x00, 0x0C, 0xC0, 0x0D, 0xC0, 0x1F, 0x80, 0x1B, 0x00, 0x00, 0x00, 0xE0, 0xC0, 0xE1,
+    0xC0, 0x71, 0xC0, 0x71, 0x80, 0x71, 0x80, 0x3B, 0x80, 0x3B, 0x80, 0x1B, 0x00, 0x1F, 0x00, 0x0E,
+    0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x3B, 0x80, 0x3B, 0x80, 0x00,
+    0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1,
+    0xE0, 0x7F, 0xE0, 0x3F, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x3B,
+    0x80, 0x3B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x61, 0xC0, 0x61, 0xC0, 0x61, 0xC0, 0x61, 0xC0, 0x71,
+    0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0xFF, 0xC0, 0xFF,
+    0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
+    0x00, 0x38, 0x00, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0x30, 0x30,
+    0x30, 0x06, 0x60, 0x06, 0x60, 0x00, 0x00, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
+    0x07, 0xFF, 0x87, 0xFF, 0xC7, 0xE3, 0xE7, 0xE0, 0xE7, 0xE0, 0xE7, 0xE0, 0xE7, 0xE0, 0xE7, 0xE3,
+    0xE7, 0xFF, 0xC7, 0x7F, 0x87, 0x0C, 0xC0, 0x0C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1C, 0xE0,
+    0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xFF, 0x1C, 0xFF, 0x9C, 0xE3, 0x9C, 0xE1, 0xDC, 0xE3, 0x9C, 0xFF,
+    0x9C, 0xFF, 0x1C, 0x7F, 0xF0, 0x7F, 0xF0, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC,
+    0x7F, 0xFF, 0xFC, 0x60, 0x60, 0xE0, 0xE0, 0xE0, 0x70, 0x70, 0x70, 0x60, 0xE0, 0x70, 0x70, 0x70,
+    0x60, 0xE0, 0x66, 0x6E, 0xEE, 0xEE, 0xEE, 0x77, 0x77, 0x77, 0x66, 0xEE, 0x77, 0x77, 0x77, 0x66,
+    0xEE, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x0C,
+    0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C,
+    0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0xFF,
+    0xC0, 0xFF, 0xC0, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x0C, 0x00, 0x0C,
+    0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x78, 0xFC, 0xFC, 0xFC, 0x78, 0xE1, 0xC3,
+    0x80, 0xE1, 0xC3, 0x80, 0xE1, 0xC3, 0x80, 0x7C, 0x38, 0x00, 0xEE, 0x38, 0x00, 0xC6, 0x70, 0x00,
+    0xC6, 0x70, 0x00, 0xC6, 0xE0, 0x00, 0xEE, 0xC0, 0x00, 0x7D, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x03,
+    0xBE, 0x3E, 0x03, 0x77, 0x77, 0x07, 0x63, 0x63, 0x0E, 0x63, 0x63, 0x0E, 0x63, 0x63, 0x1C, 0x77,
+    0x77, 0x1C, 0x3E, 0x3E, 0x18, 0x38, 0x38, 0x70, 0xE0, 0x70, 0x38, 0x38, 0x18, 0x60, 0x70, 0x30,
+    0x38, 0x1C, 0x38, 0x30, 0x70, 0x60, 0x00, 0xE0, 0x01, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x03, 0x00,
+    0x07, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x38, 0x00, 0x70, 0x00,
+    0x70, 0x00, 0xE0, 0x00, 0x7C, 0x6E, 0xE6, 0xE6, 0xE6, 0xE6, 0x6E, 0x7C, 0x0C, 0x1C, 0x3C, 0x7C,
+    0x6C, 0xFE, 0x0C, 0x0C, 0x7E, 0x60, 0x60, 0x7C, 0x1E, 0x06, 0x4E, 0x7C, 0x1E, 0x38, 0x60, 0x7C,
+    0xEE, 0x66, 0x6E, 0x3C, 0xFE, 0x0E, 0x1C, 0x18, 0x18, 0x38, 0x30, 0x30, 0x7C, 0x6E, 0x66, 0x7C,
+    0x7E, 0xE6, 0xEE, 0x7C, 0x7C, 0x6E, 0xE6, 0xE6, 0x7E, 0x0E, 0x3C, 0x78, 0x7C, 0x6E, 0xE6, 0xE6,
+    0xE6, 0xE6, 0x6E, 0x7C, 0x30, 0xF0, 0xF0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x7C, 0x6C, 0x0E, 0x1C,
+    0x3C, 0x78, 0x60, 0x7E, 0x7C, 0x6C, 0x0C, 0x3C, 0x0E, 0x06, 0x4E, 0xFC, 0x0C, 0x1C, 0x3C, 0x7C,
+    0x6C, 0xFE, 0x0C, 0x0C, 0x7E, 0x60, 0x60, 0x7C, 0x1E, 0x06, 0x4E, 0x7C, 0x1E, 0x38, 0x60, 0x7C,
+    0xEE, 0x66, 0x6E, 0x3C, 0xFE, 0x0E, 0x1C, 0x18, 0x18, 0x38, 0x30, 0x30, 0x7C, 0x6E, 0x66, 0x7C,
+    0x7E, 0xE6, 0xEE, 0x7C, 0x7C, 0x6E, 0xE6, 0xE6, 0x7E, 0x0E, 0x3C, 0x78, 0x07, 0xE0, 0x0F, 0xE0,
+    0x1E, 0x20, 0x1C, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x38, 0x00, 0x7F, 0x80, 0x7F, 0x80, 0x18, 0x00,
+    0x1C, 0x00, 0x1F, 0x20, 0x0F, 0xF0, 0x07, 0xF0, 0xFF, 0xE0, 0xFF, 0xE0, 0x06, 0x00, 0x06, 0x00,
+    0x07, 0xC0, 0x07, 0xC0, 0x1F, 0x80, 0x3E, 0x00, 0x37, 0xC0, 0x07, 0xC0, 0x1F, 0x80, 0x3E, 0x00,
+    0x36, 0x00, 0x06, 0x00, 0x06, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x33, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
+    0xFF, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0xFF, 0xE0, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x3C, 0xC0,
+    0x3F, 0xE0, 0x1F, 0xC0, 0xFF, 0xE0, 0xFF, 0xE0, 0x07, 0x00, 0x03, 0x80, 0xFF, 0xC0, 0xFF, 0xC0,
+    0x03, 0x80, 0x0F, 0x00, 0xFF, 0x00, 0xFC, 0x00, 0xF0, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00,
+    0x07, 0x00, 0x3F, 0x00, 0x3F, 0xC0, 0x33, 0xC0, 0x00, 0xE0, 0x00, 0xE0, 0x1F, 0xE0, 0x3F, 0xE0,
+    0x79, 0xF0, 0x70, 0x70, 0x60, 0x60, 0x60, 0x60, 0x60, 0xE0, 0x60, 0xE0, 0x7B, 0xC0, 0x3F, 0x80,
+    0x1F, 0x00, 0x07, 0x00, 0x07, 0x80, 0x0F, 0x80, 0x0F, 0xC0, 0x0D, 0xC0, 0x1C, 0xE0, 0x18, 0xE0,
+    0x38, 0x60, 0x38, 0x70, 0x30, 0x70, 0x70, 0x30, 0x70, 0x38, 0x60, 0x38, 0xFF, 0xF8, 0xFF, 0xFC,
+    0xFF, 0xF0, 0xFF, 0xF0, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70,
+    0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70,
+    0xE0, 0x70, 0xFF, 0xE0, 0xFF, 0xE0, 0x70, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x1C, 0x00,
+    0x0E, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x00,
+    0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xE0, 0x01, 0xC0, 0x01, 0xC0, 0x03, 0x80,
+    0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x38, 0x00,
+    0x70, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0xE0, 0xE0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x70, 0x00,
+    0x60, 0x00, 0x60, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xC0, 0x70, 0xC0, 0xF9, 0xC0, 0xF9, 0x80, 0x1D,
+    0x80, 0x1F, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x06, 0x00, 0x7D, 0xE0, 0x7F, 0xF0, 0xE7,
+    0x30, 0xE7, 0x30, 0x7F, 0xF0, 0x7D, 0xE0, 0x0F, 0x1F, 0x1E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0x38, 0x78, 0xF8, 0xF0, 0x3C, 0x60, 0x7F, 0xE0, 0x6F,
+    0xE0, 0x63, 0xC0, 0x3C, 0x60, 0x7F, 0xE0, 0x6F, 0xE0, 0x63, 0xC0, 0x03, 0x00, 0x03, 0x00, 0x07,
+    0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x0E, 0x00, 0x0C, 0x00, 0x1C, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x30,
+    0x00, 0x70, 0x00, 0x60, 0x00, 0x01, 0xC0, 0x0F, 0xC0, 0x7F, 0x80, 0xFC, 0x00, 0xF0, 0x00, 0xFC,
+    0x00, 0x7F, 0x80, 0x0F, 0xC0, 0x01, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xFC,
+    0x00, 0x7F, 0x80, 0x0F, 0xC0, 0x03, 0xC0, 0x0F, 0xC0, 0x7F, 0x80, 0xFC, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xFF, 0xC0, 0xFF, 0xC0,
 };
 
 static const EpdGlyph ubuntu_10_regularGlyphs[] = {
@@ -799,591 +1059,591 @@ static const EpdGlyph ubuntu_10_regularGlyphs[] = {
     { 0, 0, 5, 0, 0, 0, 0 }, // 
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 4, 15, 6, 1, 15, 8, 0 }, // !
-    { 7, 5, 9, 1, 16, 5, 8 }, // "
-    { 12, 15, 14, 1, 15, 23, 13 }, // #
-    { 10, 19, 12, 1, 16, 24, 36 }, // $
-    { 16, 15, 18, 1, 15, 30, 60 }, // %
-    { 14, 15, 14, 0, 15, 27, 90 }, // &
-    { 3, 5, 5, 1, 16, 2, 117 }, // '
-    { 6, 20, 7, 1, 16, 15, 119 }, // (
-    { 6, 20, 7, 0, 16, 15, 134 }, // )
-    { 10, 8, 10, 0, 15, 10, 149 }, // *
-    { 10, 10, 12, 1, 11, 13, 159 }, // +
-    { 4, 5, 5, 0, 2, 3, 172 }, // ,
-    { 6, 2, 6, 0, 7, 2, 175 }, // -
-    { 3, 3, 5, 1, 3, 2, 177 }, // .
-    { 10, 20, 8, -1, 16, 25, 179 }, // /
-    { 10, 15, 12, 1, 15, 19, 204 }, // 0
-    { 7, 15, 12, 1, 15, 14, 223 }, // 1
-    { 10, 15, 12, 1, 15, 19, 237 }, // 2
-    { 10, 15, 12, 1, 15, 19, 256 }, // 3
-    { 11, 15, 12, 0, 15, 21, 275 }, // 4
-    { 10, 15, 12, 1, 15, 19, 296 }, // 5
-    { 10, 15, 12, 1, 15, 19, 315 }, // 6
-    { 10, 15, 12, 1, 15, 19, 334 }, // 7
-    { 10, 15, 12, 1, 15, 19, 353 }, // 8
-    { 10, 15, 12, 1, 15, 19, 372 }, // 9
-    { 3, 11, 5, 1, 11, 5, 391 }, // :
-    { 4, 14, 5, 0, 11, 7, 396 }, // ;
-    { 10, 9, 12, 1, 11, 12, 403 }, // <
-    { 10, 7, 12, 1, 10, 9, 415 }, // =
-    { 10, 9, 12, 1, 11, 12, 424 }, // >
-    { 8, 15, 8, 0, 15, 15, 436 }, // ?
-    { 18, 20, 20, 1, 16, 45, 451 }, // @
-    { 14, 15, 14, 0, 15, 27, 496 }, // A
-    { 12, 15, 14, 1, 15, 23, 523 }, // B
-    { 12, 15, 13, 1, 15, 23, 546 }, // C
-    { 13, 15, 15, 1, 15, 25, 569 }, // D
-    { 11, 15, 12, 1, 15, 21, 594 }, // E
-    { 10, 15, 11, 1, 15, 19, 615 }, // F
-    { 12, 15, 14, 1, 15, 23, 634 }, // G
-    { 12, 15, 15, 1, 15, 23, 657 }, // H
-    { 3, 15, 6, 1, 15, 6, 680 }, // I
-    { 9, 15, 11, 0, 15, 17, 686 }, // J
-    { 13, 15, 13, 1, 15, 25, 703 }, // K
-    { 10, 15, 11, 1, 15, 19, 728 }, // L
-    { 16, 15, 18, 1, 15, 30, 747 }, // M
-    { 13, 15, 15, 1, 15, 25, 777 }, // N
-    { 15, 15, 16, 1, 15, 29, 802 }, // O
-    { 12, 15, 13, 1, 15, 23, 831 }, // P
-    { 15, 19, 16, 1, 15, 36, 854 }, // Q
-    { 12, 15, 13, 1, 15, 23, 890 }, // R
-    { 11, 15, 11, 0, 15, 21, 913 }, // S
-    { 12, 15, 12, 0, 15, 23, 934 }, // T
-    { 12, 15, 14, 1, 15, 23, 957 }, // U
-    { 14, 15, 14, 0, 15, 27, 980 }, // V
-    { 19, 15, 20, 0, 15, 36, 1007 }, // W
-    { 13, 15, 13, 0, 15, 25, 1043 }, // X
-    { 13, 15, 13, 0, 15, 25, 1068 }, // Y
-    { 12, 15, 12, 0, 15, 23, 1093 }, // Z
-    { 5, 20, 7, 2, 16, 13, 1116 }, // [
-    { 10, 20, 8, -1, 16, 25, 1129 }, // <backslash>
-    { 5, 20, 7, 0, 16, 13, 1154 }, // ]
-    { 11, 8, 12, 0, 15, 11, 1167 }, // ^
-    { 12, 2, 10, -1, -2, 3, 1178 }, // _
-    { 5, 4, 8, 1, 16, 3, 1181 }, // `
-    { 10, 11, 11, 0, 11, 14, 1184 }, // a
-    { 11, 16, 12, 1, 16, 22, 1198 }, // b
-    { 9, 11, 10, 1, 11, 13, 1220 }, // c
-    { 10, 16, 12, 1, 16, 20, 1233 }, // d
-    { 10, 11, 12, 1, 11, 14, 1253 }, // e
-    { 8, 16, 8, 1, 16, 16, 1267 }, // f
-    { 10, 15, 12, 1, 11, 19, 1283 }, // g
-    { 10, 16, 12, 1, 16, 20, 1302 }, // h
-    { 3, 16, 5, 1, 16, 6, 1322 }, // i
-    { 6, 20, 5, -2, 16, 15, 1328 }, // j
-    { 10, 16, 11, 1, 16, 20, 1343 }, // k
-    { 5, 16, 6, 1, 16, 10, 1363 }, // l
-    { 16, 11, 18, 1, 11, 22, 1373 }, // m
-    { 10, 11, 12, 1, 11, 14, 1395 }, // n
-    { 11, 11, 12, 1, 11, 16, 1409 }, // o
-    { 11, 15, 12, 1, 11, 21, 1425 }, // p
-    { 10, 15, 12, 1, 11, 19, 1446 }, // q
-    { 7, 11, 8, 1, 11, 10, 1465 }, // r
-    { 9, 11, 9, 0, 11, 13, 1475 }, // s
-    { 8, 14, 8, 1, 14, 14, 1488 }, // t
-    { 10, 11, 12, 1, 11, 14, 1502 }, // u
-    { 11, 11, 11, 0, 11, 16, 1516 }, // v
-    { 16, 11, 16, 0, 11, 22, 1532 }, // w
-    { 11, 11, 11, 0, 11, 16, 1554 }, // x
-    { 11, 15, 10, 0, 11, 21, 1570 }, // y
-    { 10, 11, 10, 0, 11, 14, 1591 }, // z
-    { 7, 20, 7, 0, 16, 18, 1605 }, // {
-    { 2, 20, 6, 2, 16, 5, 1623 }, // |
-    { 7, 20, 7, 0, 16, 18, 1628 }, // }
-    { 11, 4, 12, 0, 8, 6, 1646 }, // ~
-    { 0, 0, 5, 0, 0, 0, 1652 }, //  
-    { 4, 15, 6, 1, 11, 8, 1652 }, // ¡
-    { 10, 17, 12, 1, 14, 22, 1660 }, // ¢
-    { 10, 15, 12, 1, 15, 19, 1682 }, // £
-    { 11, 10, 12, 0, 12, 14, 1701 }, // ¤
-    { 12, 15, 12, 0, 15, 23, 1715 }, // ¥
-    { 2, 20, 6, 2, 16, 5, 1738 }, // ¦
-    { 10, 18, 10, 0, 16, 23, 1743 }, // §
-    { 8, 2, 8, 0, 15, 2, 1766 }, // ¨
-    { 15, 15, 17, 1, 15, 29, 1768 }, // ©
-    { 8, 8, 8, 0, 15, 8, 1797 }, // ª
-    { 10, 9, 10, 0, 10, 12, 1805 }, // «
-    { 10, 8, 12, 1, 9, 10, 1817 }, // ¬
-    { 6, 2, 6, 0, 7, 2, 1827 }, // ­
-    { 15, 15, 17, 1, 15, 29, 1829 }, // ®
-    { 7, 2, 8, 0, 15, 2, 1858 }, // ¯
-    { 7, 6, 7, 0, 16, 6, 1860 }, // °
-    { 10, 13, 12, 1, 13, 17, 1866 }, // ±
-    { 7, 8, 8, 0, 15, 7, 1883 }, // ²
-    { 7, 8, 8, 0, 15, 7, 1890 }, // ³
-    { 5, 4, 8, 2, 16, 3, 1897 }, // ´
-    { 10, 15, 12, 1, 11, 19, 1900 }, // µ
-    { 12, 19, 14, 0, 15, 29, 1919 }, // ¶
-    { 3, 3, 5, 1, 8, 2, 1948 }, // ·
-    { 5, 4, 8, 1, 0, 3, 1950 }, // ¸
-    { 4, 8, 8, 1, 15, 4, 1953 }, // ¹
-    { 9, 8, 9, 0, 15, 9, 1957 }, // º
-    { 10, 9, 10, 0, 10, 12, 1966 }, // »
-    { 17, 15, 18, 1, 15, 32, 1978 }, // ¼
-    { 17, 15, 18, 1, 15, 32, 2010 }, // ½
-    { 18, 15, 18, 0, 15, 34, 2042 }, // ¾
-    { 9, 15, 8, 0, 11, 17, 2076 }, // ¿
-    { 14, 20, 14, 0, 20, 35, 2093 }, // À
-    { 14, 20, 14, 0, 20, 35, 2128 }, // Á
-    { 14, 20, 14, 0, 20, 35, 2163 }, // Â
-    { 14, 19, 14, 0, 19, 34, 2198 }, // Ã
-    { 14, 18, 14, 0, 18, 32, 2232 }, // Ä
-    { 14, 18, 14, 0, 18, 32, 2264 }, // Å
-    { 19, 15, 20, 0, 15, 36, 2296 }, // Æ
-    { 12, 18, 13, 1, 15, 27, 2332 }, // Ç
-    { 11, 20, 12, 1, 20, 28, 2359 }, // È
-    { 11, 20, 12, 1, 20, 28, 2387 }, // É
-    { 11, 20, 12, 1, 20, 28, 2415 }, // Ê
-    { 11, 18, 12, 1, 18, 25, 2443 }, // Ë
-    { 5, 20, 6, 0, 20, 13, 2468 }, // Ì
-    { 5, 20, 6, 1, 20, 13, 2481 }, // Í
-    { 7, 20, 6, -1, 20, 18, 2494 }, // Î
-    { 8, 18, 6, -1, 18, 18, 2512 }, // Ï
-    { 15, 15, 15, 0, 15, 29, 2530 }, // Ð
-    { 13, 19, 15, 1, 19, 31, 2559 }, // Ñ
-    { 15, 20, 16, 1, 20, 38, 2590 }, // Ò
-    { 15, 20, 16, 1, 20, 38, 2628 }, // Ó
-    { 15, 20, 16, 1, 20, 38, 2666 }, // Ô
-    { 15, 19, 16, 1, 19, 36, 2704 }, // Õ
-    { 15, 18, 16, 1, 18, 34, 2740 }, // Ö
-    { 10, 9, 12, 1, 11, 12, 2774 }, // ×
-    { 15, 15, 16, 1, 15, 29, 2786 }, // Ø
-    { 12, 20, 14, 1, 20, 30, 2815 }, // Ù
-    { 12, 20, 14, 1, 20, 30, 2845 }, // Ú
-    { 12, 20, 14, 1, 20, 30, 2875 }, // Û
-    { 12, 18, 14, 1, 18, 27, 2905 }, // Ü
-    { 13, 20, 13, 0, 20, 33, 2932 }, // Ý
-    { 12, 15, 13, 1, 15, 23, 2965 }, // Þ
-    { 12, 16, 13, 1, 16, 24, 2988 }, // ß
-    { 10, 16, 11, 0, 16, 20, 3012 }, // à
-    { 10, 16, 11, 0, 16, 20, 3032 }, // á
-    { 10, 16, 11, 0, 16, 20, 3052 }, // â
-    { 10, 16, 11, 0, 16, 20, 3072 }, // ã
-    { 10, 15, 11, 0, 15, 19, 3092 }, // ä
-    { 10, 16, 11, 0, 16, 20, 3111 }, // å
-    { 17, 11, 18, 0, 11, 24, 3131 }, // æ
-    { 9, 15, 10, 1, 11, 17, 3155 }, // ç
-    { 10, 16, 12, 1, 16, 20, 3172 }, // è
-    { 10, 16, 12, 1, 16, 20, 3192 }, // é
-    { 10, 16, 12, 1, 16, 20, 3212 }, // ê
-    { 10, 15, 12, 1, 15, 19, 3232 }, // ë
-    { 5, 16, 5, 0, 16, 10, 3251 }, // ì
-    { 5, 16, 5, 1, 16, 10, 3261 }, // í
-    { 7, 16, 5, -1, 16, 14, 3271 }, // î
-    { 7, 15, 5, -1, 15, 14, 3285 }, // ï
-    { 11, 16, 12, 1, 16, 22, 3299 }, // ð
-    { 10, 16, 12, 1, 16, 20, 3321 }, // ñ
-    { 11, 16, 12, 1, 16, 22, 3341 }, // ò
-    { 11, 16, 12, 1, 16, 22, 3363 }, // ó
-    { 11, 16, 12, 1, 16, 22, 3385 }, // ô
-    { 11, 16, 12, 1, 16, 22, 3407 }, // õ
-    { 11, 15, 12, 1, 15, 21, 3429 }, // ö
-    { 10, 12, 12, 1, 12, 15, 3450 }, // ÷
-    { 11, 11, 12, 1, 11, 16, 3465 }, // ø
-    { 10, 16, 12, 1, 16, 20, 3481 }, // ù
-    { 10, 16, 12, 1, 16, 20, 3501 }, // ú
-    { 10, 16, 12, 1, 16, 20, 3521 }, // û
-    { 10, 15, 12, 1, 15, 19, 3541 }, // ü
-    { 11, 20, 10, 0, 16, 28, 3560 }, // ý
-    { 11, 20, 12, 1, 16, 28, 3588 }, // þ
-    { 11, 19, 10, 0, 15, 27, 3616 }, // ÿ
-    { 14, 18, 14, 0, 18, 32, 3643 }, // Ā
-    { 10, 15, 11, 0, 15, 19, 3675 }, // ā
-    { 14, 19, 14, 0, 19, 34, 3694 }, // Ă
-    { 10, 16, 11, 0, 16, 20, 3728 }, // ă
-    { 14, 19, 14, 0, 15, 34, 3748 }, // Ą
-    { 10, 14, 11, 0, 11, 18, 3782 }, // ą
-    { 12, 20, 13, 1, 20, 30, 3800 }, // Ć
-    { 9, 16, 10, 1, 16, 18, 3830 }, // ć
-    { 12, 20, 13, 1, 20, 30, 3848 }, // Ĉ
-    { 9, 16, 10, 1, 16, 18, 3878 }, // ĉ
-    { 12, 19, 13, 1, 19, 29, 3896 }, // Ċ
-    { 9, 16, 10, 1, 16, 18, 3925 }, // ċ
-    { 12, 20, 13, 1, 20, 30, 3943 }, // Č
-    { 9, 16, 10, 1, 16, 18, 3973 }, // č
-    { 13, 20, 15, 1, 20, 33, 3991 }, // Ď
-    { 14, 16, 13, 1, 16, 28, 4024 }, // ď
-    { 15, 15, 15, 0, 15, 29, 4052 }, // Đ
-    { 12, 16, 12, 1, 16, 24, 4081 }, // đ
-    { 11, 18, 12, 1, 18, 25, 4105 }, // Ē
-    { 10, 15, 12, 1, 15, 19, 4130 }, // ē
-    { 11, 19, 12, 1, 19, 27, 4149 }, // Ĕ
-    { 10, 16, 12, 1, 16, 20, 4176 }, // ĕ
-    { 11, 19, 12, 1, 19, 27, 4196 }, // Ė
-    { 10, 16, 12, 1, 16, 20, 4223 }, // ė
-    { 11, 19, 12, 1, 15, 27, 4243 }, // Ę
-    { 10, 14, 12, 1, 11, 18, 4270 }, // ę
-    { 11, 20, 12, 1, 20, 28, 4288 }, // Ě
-    { 10, 17, 12, 1, 17, 22, 4316 }, // ě
-    { 12, 20, 14, 1, 20, 30, 4338 }, // Ĝ
-    { 10, 20, 12, 1, 16, 25, 4368 }, // ĝ
-    { 12, 19, 14, 1, 19, 29, 4393 }, // Ğ
-    { 10, 20, 12, 1, 16, 25, 4422 }, // ğ
-    { 12, 19, 14, 1, 19, 29, 4447 }, // Ġ
-    { 10, 20, 12, 1, 16, 25, 4476 }, // ġ
-    { 12, 19, 14, 1, 15, 29, 4501 }, // Ģ
-    { 10, 21, 12, 1, 17, 27, 4530 }, // ģ
-    { 12, 20, 15, 1, 20, 30, 4557 }, // Ĥ
-    { 10, 20, 12, 1, 20, 25, 4587 }, // ĥ
-    { 15, 15, 15, 0, 15, 29, 4612 }, // Ħ
-    { 11, 16, 12, 0, 16, 22, 4641 }, // ħ
-    { 8, 19, 6, -1, 19, 19, 4663 }, // Ĩ
-    { 8, 16, 5, -1, 16, 16, 4682 }, // ĩ
-    { 7, 18, 6, -1, 18, 16, 4698 }, // Ī
-    { 7, 15, 5, -1, 15, 14, 4714 }, // ī
-    { 6, 19, 6, 0, 19, 15, 4728 }, // Ĭ
-    { 7, 16, 5, -1, 16, 14, 4743 }, // ĭ
-    { 5, 19, 6, 0, 15, 12, 4757 }, // Į
-    { 4, 20, 5, 0, 16, 10, 4769 }, // į
-    { 4, 19, 6, 1, 19, 10, 4779 }, // İ
-    { 3, 11, 5, 1, 11, 5, 4789 }, // ı
-    { 14, 15, 16, 1, 15, 27, 4794 }, // Ĳ
-    { 9, 20, 11, 1, 16, 23, 4821 }, // ĳ
-    { 11, 20, 11, 0, 20, 28, 4844 }, // Ĵ
-    { 8, 20, 5, -2, 16, 20, 4872 }, // ĵ
-    { 13, 19, 13, 1, 15, 31, 4892 }, // Ķ
-    { 10, 20, 11, 1, 16, 25, 4923 }, // ķ
-    { 10, 11, 11, 1, 11, 14, 4948 }, // ĸ
-    { 10, 20, 11, 1, 20, 25, 4962 }, // Ĺ
-    { 5, 20, 6, 1, 20, 13, 4987 }, // ĺ
-    { 10, 19, 11, 1, 15, 24, 5000 }, // Ļ
-    { 6, 20, 6, 0, 16, 15, 5024 }, // ļ
-    { 10, 15, 11, 1, 15, 19, 5039 }, // Ľ
-    { 6, 16, 6, 1, 16, 12, 5058 }, // ľ
-    { 10, 15, 11, 1, 15, 19, 5070 }, // Ŀ
-    { 7, 16, 8, 1, 16, 14, 5089 }, // ŀ
-    { 12, 15, 11, -1, 15, 23, 5103 }, // Ł
-    { 7, 16, 6, 0, 16, 14, 5126 }, // ł
-    { 13, 20, 15, 1, 20, 33, 5140 }, // Ń
-    { 10, 16, 12, 1, 16, 20, 5173 }, // ń
-    { 13, 19, 15, 1, 15, 31, 5193 }, // Ņ
-    { 10, 15, 12, 1, 11, 19, 5224 }, // ņ
-    { 13, 20, 15, 1, 20, 33, 5243 }, // Ň
-    { 10, 16, 12, 1, 16, 20, 5276 }, // ň
-    { 11, 16, 12, 0, 16, 22, 5296 }, // ŉ
-    { 13, 19, 15, 1, 15, 31, 5318 }, // Ŋ
-    { 10, 15, 12, 1, 11, 19, 5349 }, // ŋ
-    { 15, 18, 16, 1, 18, 34, 5368 }, // Ō
-    { 11, 15, 12, 1, 15, 21, 5402 }, // ō
-    { 15, 19, 16, 1, 19, 36, 5423 }, // Ŏ
-    { 11, 16, 12, 1, 16, 22, 5459 }, // ŏ
-    { 15, 20, 16, 1, 20, 38, 5481 }, // Ő
-    { 11, 16, 12, 1, 16, 22, 5519 }, // ő
-    { 20, 15, 21, 1, 15, 38, 5541 }, // Œ
-    { 18, 11, 20, 1, 11, 25, 5579 }, // œ
-    { 12, 20, 13, 1, 20, 30, 5604 }, // Ŕ
-    { 7, 16, 8, 1, 16, 14, 5634 }, // ŕ
-    { 12, 19, 13, 1, 15, 29, 5648 }, // Ŗ
-    { 8, 15, 8, 0, 11, 15, 5677 }, // ŗ
-    { 12, 20, 13, 1, 20, 30, 5692 }, // Ř
-    { 7, 16, 8, 1, 16, 14, 5722 }, // ř
-    { 11, 20, 11, 0, 20, 28, 5736 }, // Ś
-    { 9, 16, 9, 0, 16, 18, 5764 }, // ś
-    { 11, 20, 11, 0, 20, 28, 5782 }, // Ŝ
-    { 9, 16, 9, 0, 16, 18, 5810 }, // ŝ
-    { 11, 18, 11, 0, 15, 25, 5828 }, // Ş
-    { 9, 14, 9, 0, 11, 16, 5853 }, // ş
-    { 11, 20, 11, 0, 20, 28, 5869 }, // Š
-    { 9, 16, 9, 0, 16, 18, 5897 }, // š
-    { 12, 18, 12, 0, 15, 27, 5915 }, // Ţ
-    { 8, 17, 8, 1, 14, 17, 5942 }, // ţ
-    { 12, 20, 12, 0, 20, 30, 5959 }, // Ť
-    { 8, 16, 8, 1, 16, 16, 5989 }, // ť
-    { 12, 15, 12, 0, 15, 23, 6005 }, // Ŧ
-    { 8, 14, 8, 1, 14, 14, 6028 }, // ŧ
-    { 12, 19, 14, 1, 19, 29, 6042 }, // Ũ
-    { 10, 16, 12, 1, 16, 20, 6071 }, // ũ
-    { 12, 18, 14, 1, 18, 27, 6091 }, // Ū
-    { 10, 15, 12, 1, 15, 19, 6118 }, // ū
-    { 12, 19, 14, 1, 19, 29, 6137 }, // Ŭ
-    { 10, 16, 12, 1, 16, 20, 6166 }, // ŭ
-    { 12, 19, 14, 1, 19, 29, 6186 }, // Ů
-    { 10, 16, 12, 1, 16, 20, 6215 }, // ů
-    { 12, 20, 14, 1, 20, 30, 6235 }, // Ű
-    { 10, 16, 12, 1, 16, 20, 6265 }, // ű
-    { 12, 18, 14, 1, 15, 27, 6285 }, // Ų
-    { 10, 14, 12, 1, 11, 18, 6312 }, // ų
-    { 19, 20, 20, 0, 20, 48, 6330 }, // Ŵ
-    { 16, 16, 16, 0, 16, 32, 6378 }, // ŵ
-    { 13, 20, 13, 0, 20, 33, 6410 }, // Ŷ
-    { 11, 20, 10, 0, 16, 28, 6443 }, // ŷ
-    { 13, 18, 13, 0, 18, 30, 6471 }, // Ÿ
-    { 12, 20, 12, 0, 20, 30, 6501 }, // Ź
-    { 10, 16, 10, 0, 16, 20, 6531 }, // ź
-    { 12, 19, 12, 0, 19, 29, 6551 }, // Ż
-    { 10, 16, 10, 0, 16, 20, 6580 }, // ż
-    { 12, 20, 12, 0, 20, 30, 6600 }, // Ž
-    { 10, 16, 10, 0, 16, 20, 6630 }, // ž
-    { 8, 16, 6, 1, 16, 16, 6650 }, // ſ
-    { 6, 3, 8, 1, 16, 3, 6666 }, // ̑
-    { 11, 20, 12, 1, 20, 28, 6669 }, // Ѐ
-    { 11, 18, 12, 1, 18, 25, 6697 }, // Ё
-    { 15, 15, 16, 0, 15, 29, 6722 }, // Ђ
-    { 10, 20, 11, 1, 20, 25, 6751 }, // Ѓ
-    { 12, 15, 13, 1, 15, 23, 6776 }, // Є
-    { 11, 15, 11, 0, 15, 21, 6799 }, // Ѕ
-    { 3, 15, 6, 1, 15, 6, 6820 }, // І
-    { 8, 18, 6, -1, 18, 18, 6826 }, // Ї
-    { 9, 15, 11, 0, 15, 17, 6844 }, // Ј
-    { 22, 16, 22, 0, 15, 44, 6861 }, // Љ
-    { 20, 15, 22, 1, 15, 38, 6905 }, // Њ
-    { 15, 15, 16, 0, 15, 29, 6943 }, // Ћ
-    { 13, 20, 13, 1, 20, 33, 6972 }, // Ќ
-    { 13, 20, 15, 1, 20, 33, 7005 }, // Ѝ
-    { 13, 19, 12, 0, 19, 31, 7038 }, // Ў
-    { 12, 19, 15, 1, 15, 29, 7069 }, // Џ
-    { 14, 15, 14, 0, 15, 27, 7098 }, // А
-    { 12, 15, 13, 1, 15, 23, 7125 }, // Б
-    { 12, 15, 14, 1, 15, 23, 7148 }, // В
-    { 10, 15, 11, 1, 15, 19, 7171 }, // Г
-    { 15, 19, 15, 0, 15, 36, 7190 }, // Д
-    { 11, 15, 12, 1, 15, 21, 7226 }, // Е
-    { 19, 15, 19, 0, 15, 36, 7247 }, // Ж
-    { 11, 15, 12, 0, 15, 21, 7283 }, // З
-    { 13, 15, 15, 1, 15, 25, 7304 }, // И
-    { 13, 19, 15, 1, 19, 31, 7329 }, // Й
-    { 13, 15, 13, 1, 15, 25, 7360 }, // К
-    { 14, 15, 15, 0, 15, 27, 7385 }, // Л
-    { 16, 15, 18, 1, 15, 30, 7412 }, // М
-    { 12, 15, 15, 1, 15, 23, 7442 }, // Н
-    { 15, 15, 16, 1, 15, 29, 7465 }, // О
-    { 12, 15, 15, 1, 15, 23, 7494 }, // П
-    { 12, 15, 13, 1, 15, 23, 7517 }, // Р
-    { 12, 15, 13, 1, 15, 23, 7540 }, // С
-    { 12, 15, 12, 0, 15, 23, 7563 }, // Т
-    { 13, 15, 12, 0, 15, 25, 7586 }, // У
-    { 16, 16, 18, 1, 16, 32, 7611 }, // Ф
-    { 13, 15, 13, 0, 15, 25, 7643 }, // Х
-    { 14, 19, 15, 1, 15, 34, 7668 }, // Ц
-    { 11, 15, 13, 1, 15, 21, 7702 }, // Ч
-    { 18, 15, 21, 1, 15, 34, 7723 }, // Ш
-    { 20, 19, 21, 1, 15, 48, 7757 }, // Щ
-    { 15, 15, 15, 0, 15, 29, 7805 }, // Ъ
-    { 16, 15, 18, 1, 15, 30, 7834 }, // Ы
-    { 12, 15, 13, 1, 15, 23, 7864 }, // Ь
-    { 12, 15, 13, 0, 15, 23, 7887 }, // Э
-    { 20, 15, 22, 1, 15, 38, 7910 }, // Ю
-    { 12, 15, 13, 0, 15, 23, 7948 }, // Я
-    { 10, 11, 11, 0, 11, 14, 7971 }, // а
-    { 11, 16, 13, 1, 16, 22, 7985 }, // б
-    { 10, 11, 12, 1, 11, 14, 8007 }, // в
-    { 8, 11, 9, 1, 11, 11, 8021 }, // г
-    { 13, 14, 13, 0, 11, 23, 8032 }, // д
-    { 10, 11, 12, 1, 11, 14, 8055 }, // е
-    { 16, 11, 16, 0, 11, 22, 8069 }, // ж
-    { 10, 11, 10, 0, 11, 14, 8091 }, // з
-    { 10, 11, 13, 1, 11, 14, 8105 }, // и
-    { 10, 16, 13, 1, 16, 20, 8119 }, // й
-    { 10, 11, 11, 1, 11, 14, 8139 }, // к
-    { 11, 11, 13, 0, 11, 16, 8153 }, // л
-    { 13, 11, 15, 1, 11, 18, 8169 }, // м
-    { 10, 11, 12, 1, 11, 14, 8187 }, // н
-    { 11, 11, 12, 1, 11, 16, 8201 }, // о
-    { 10, 11, 12, 1, 11, 14, 8217 }, // п
-    { 11, 15, 12, 1, 11, 21, 8231 }, // р
-    { 9, 11, 10, 1, 11, 13, 8252 }, // с
-    { 10, 11, 10, 0, 11, 14, 8265 }, // т
-    { 11, 15, 10, 0, 11, 21, 8279 }, // у
-    { 15, 20, 16, 1, 16, 38, 8300 }, // ф
-    { 11, 11, 11, 0, 11, 16, 8338 }, // х
-    { 11, 14, 12, 1, 11, 20, 8354 }, // ц
-    { 10, 11, 11, 0, 11, 14, 8374 }, // ч
-    { 15, 11, 17, 1, 11, 21, 8388 }, // ш
-    { 17, 14, 18, 1, 11, 30, 8409 }, // щ
-    { 12, 11, 13, 0, 11, 17, 8439 }, // ъ
-    { 14, 11, 16, 1, 11, 20, 8456 }, // ы
-    { 10, 11, 11, 1, 11, 14, 8476 }, // ь
-    { 10, 11, 10, 0, 11, 14, 8490 }, // э
-    { 15, 11, 17, 1, 11, 21, 8504 }, // ю
-    { 10, 11, 12, 0, 11, 14, 8525 }, // я
-    { 10, 16, 12, 1, 16, 20, 8539 }, // ѐ
-    { 10, 15, 12, 1, 15, 19, 8559 }, // ё
-    { 11, 20, 12, 0, 16, 28, 8578 }, // ђ
-    { 8, 16, 9, 1, 16, 16, 8606 }, // ѓ
-    { 9, 11, 10, 1, 11, 13, 8622 }, // є
-    { 9, 11, 9, 0, 11, 13, 8635 }, // ѕ
-    { 3, 16, 5, 1, 16, 6, 8648 }, // і
-    { 7, 15, 5, -1, 15, 14, 8654 }, // ї
-    { 6, 20, 5, -2, 16, 15, 8668 }, // ј
-    { 18, 11, 18, 0, 11, 25, 8683 }, // љ
-    { 17, 11, 18, 1, 11, 24, 8708 }, // њ
-    { 11, 16, 12, 0, 16, 22, 8732 }, // ћ
-    { 10, 16, 11, 1, 16, 20, 8754 }, // ќ
-    { 10, 16, 13, 1, 16, 20, 8774 }, // ѝ
-    { 11, 20, 10, 0, 16, 28, 8794 }, // ў
-    { 10, 14, 12, 1, 11, 18, 8822 }, // џ
-    { 15, 16, 15, 0, 16, 30, 8840 }, // Ѣ
-    { 12, 16, 13, 0, 16, 24, 8870 }, // ѣ
-    { 15, 15, 16, 1, 15, 29, 8894 }, // Ѳ
-    { 11, 11, 12, 1, 11, 16, 8923 }, // ѳ
-    { 17, 15, 16, 0, 15, 32, 8939 }, // Ѵ
-    { 12, 11, 12, 0, 11, 17, 8971 }, // ѵ
-    { 15, 23, 16, 1, 19, 44, 8988 }, // Ҋ
-    { 12, 20, 13, 1, 16, 30, 9032 }, // ҋ
-    { 13, 16, 13, 0, 16, 26, 9062 }, // Ҍ
-    { 11, 11, 11, 0, 11, 16, 9088 }, // ҍ
-    { 12, 15, 13, 1, 15, 23, 9104 }, // Ҏ
-    { 11, 15, 12, 1, 11, 21, 9127 }, // ҏ
-    { 10, 18, 11, 1, 18, 23, 9148 }, // Ґ
-    { 8, 14, 9, 1, 14, 14, 9171 }, // ґ
-    { 11, 15, 11, 0, 15, 21, 9185 }, // Ғ
-    { 9, 11, 9, 0, 11, 13, 9206 }, // ғ
-    { 12, 19, 13, 1, 15, 29, 9219 }, // Ҕ
-    { 10, 15, 11, 1, 11, 19, 9248 }, // ҕ
-    { 20, 19, 19, 0, 15, 48, 9267 }, // Җ
-    { 17, 14, 16, 0, 11, 30, 9315 }, // җ
-    { 11, 18, 12, 0, 15, 25, 9345 }, // Ҙ
-    { 10, 14, 10, 0, 11, 18, 9370 }, // ҙ
-    { 13, 19, 14, 1, 15, 31, 9388 }, // Қ
-    { 11, 15, 11, 1, 11, 21, 9419 }, // қ
-    { 14, 15, 15, 1, 15, 27, 9440 }, // Ҝ
-    { 12, 11, 13, 1, 11, 17, 9467 }, // ҝ
-    { 14, 15, 13, 0, 15, 27, 9484 }, // Ҟ
-    { 12, 11, 12, 0, 11, 17, 9511 }, // ҟ
-    { 16, 15, 16, 0, 15, 30, 9528 }, // Ҡ
-    { 13, 11, 13, 0, 11, 18, 9558 }, // ҡ
-    { 14, 19, 15, 1, 15, 34, 9576 }, // Ң
-    { 12, 14, 13, 1, 11, 21, 9610 }, // ң
-    { 16, 15, 17, 1, 15, 30, 9631 }, // Ҥ
-    { 13, 11, 14, 1, 11, 18, 9661 }, // ҥ
-    { 20, 19, 22, 1, 15, 48, 9679 }, // Ҧ
-    { 17, 15, 18, 1, 11, 32, 9727 }, // ҧ
-    { 15, 19, 17, 1, 15, 36, 9759 }, // Ҩ
-    { 11, 14, 13, 1, 11, 20, 9795 }, // ҩ
-    { 12, 18, 13, 1, 15, 27, 9815 }, // Ҫ
-    { 9, 15, 10, 1, 11, 17, 9842 }, // ҫ
-    { 12, 19, 12, 0, 15, 29, 9859 }, // Ҭ
-    { 10, 14, 10, 0, 11, 18, 9888 }, // ҭ
-    { 13, 15, 13, 0, 15, 25, 9906 }, // Ү
-    { 11, 15, 11, 0, 11, 21, 9931 }, // ү
-    { 13, 15, 13, 0, 15, 25, 9952 }, // Ұ
-    { 11, 15, 11, 0, 11, 21, 9977 }, // ұ
-    { 14, 19, 14, 0, 15, 34, 9998 }, // Ҳ
-    { 11, 14, 11, 0, 11, 20, 10032 }, // ҳ
-    { 18, 19, 18, 0, 15, 43, 10052 }, // Ҵ
-    { 14, 14, 14, 0, 11, 25, 10095 }, // ҵ
-    { 13, 19, 14, 1, 15, 31, 10120 }, // Ҷ
-    { 11, 14, 11, 0, 11, 20, 10151 }, // ҷ
-    { 11, 15, 13, 1, 15, 21, 10171 }, // Ҹ
-    { 10, 11, 11, 0, 11, 14, 10192 }, // ҹ
-    { 12, 15, 13, 1, 15, 23, 10206 }, // Һ
-    { 10, 16, 12, 1, 16, 20, 10229 }, // һ
-    { 17, 15, 18, 0, 15, 32, 10249 }, // Ҽ
-    { 13, 11, 14, 0, 11, 18, 10281 }, // ҽ
-    { 17, 19, 18, 0, 15, 41, 10299 }, // Ҿ
-    { 13, 14, 14, 0, 11, 23, 10340 }, // ҿ
-    { 3, 15, 6, 1, 15, 6, 10363 }, // Ӏ
-    { 19, 19, 19, 0, 19, 46, 10369 }, // Ӂ
-    { 16, 16, 16, 0, 16, 32, 10415 }, // ӂ
-    { 12, 19, 13, 1, 15, 29, 10447 }, // Ӄ
-    { 10, 15, 11, 1, 11, 19, 10476 }, // ӄ
-    { 15, 19, 15, 0, 15, 36, 10495 }, // Ӆ
-    { 13, 15, 13, 0, 11, 25, 10531 }, // ӆ
-    { 12, 19, 15, 1, 15, 29, 10556 }, // Ӈ
-    { 10, 15, 12, 1, 11, 19, 10585 }, // ӈ
-    { 14, 19, 15, 1, 15, 34, 10604 }, // Ӊ
-    { 12, 15, 13, 1, 11, 23, 10638 }, // ӊ
-    { 11, 19, 13, 1, 15, 27, 10661 }, // Ӌ
-    { 10, 14, 11, 0, 11, 18, 10688 }, // ӌ
-    { 18, 19, 19, 1, 15, 43, 10706 }, // Ӎ
-    { 15, 15, 16, 1, 11, 29, 10749 }, // ӎ
-    { 3, 15, 6, 1, 15, 6, 10778 }, // ӏ
-    { 14, 19, 14, 0, 19, 34, 10784 }, // Ӑ
-    { 10, 16, 11, 0, 16, 20, 10818 }, // ӑ
-    { 14, 18, 14, 0, 18, 32, 10838 }, // Ӓ
-    { 10, 15, 11, 0, 15, 19, 10870 }, // ӓ
-    { 19, 15, 20, 0, 15, 36, 10889 }, // Ӕ
-    { 17, 11, 18, 0, 11, 24, 10925 }, // ӕ
-    { 11, 19, 12, 1, 19, 27, 10949 }, // Ӗ
-    { 10, 16, 12, 1, 16, 20, 10976 }, // ӗ
-    { 13, 15, 15, 1, 15, 25, 10996 }, // Ә
-    { 10, 11, 12, 1, 11, 14, 11021 }, // ә
-    { 13, 18, 15, 1, 18, 30, 11035 }, // Ӛ
-    { 10, 15, 12, 1, 15, 19, 11065 }, // ӛ
-    { 19, 18, 19, 0, 18, 43, 11084 }, // Ӝ
-    { 16, 15, 16, 0, 15, 30, 11127 }, // ӝ
-    { 11, 18, 12, 0, 18, 25, 11157 }, // Ӟ
-    { 10, 15, 10, 0, 15, 19, 11182 }, // ӟ
-    { 11, 15, 12, 0, 15, 21, 11201 }, // Ӡ
-    { 11, 15, 10, -1, 11, 21, 11222 }, // ӡ
-    { 13, 18, 15, 1, 18, 30, 11243 }, // Ӣ
-    { 10, 15, 13, 1, 15, 19, 11273 }, // ӣ
-    { 13, 18, 15, 1, 18, 30, 11292 }, // Ӥ
-    { 10, 15, 13, 1, 15, 19, 11322 }, // ӥ
-    { 15, 18, 16, 1, 18, 34, 11341 }, // Ӧ
-    { 11, 15, 12, 1, 15, 21, 11375 }, // ӧ
-    { 15, 15, 16, 1, 15, 29, 11396 }, // Ө
-    { 11, 11, 12, 1, 11, 16, 11425 }, // ө
-    { 15, 18, 16, 1, 18, 34, 11441 }, // Ӫ
-    { 11, 15, 12, 1, 15, 21, 11475 }, // ӫ
-    { 12, 18, 13, 0, 18, 27, 11496 }, // Ӭ
-    { 10, 15, 10, 0, 15, 19, 11523 }, // ӭ
-    { 13, 18, 12, 0, 18, 30, 11542 }, // Ӯ
-    { 11, 19, 10, 0, 15, 27, 11572 }, // ӯ
-    { 13, 18, 12, 0, 18, 30, 11599 }, // Ӱ
-    { 11, 19, 10, 0, 15, 27, 11629 }, // ӱ
-    { 13, 19, 12, 0, 19, 31, 11656 }, // Ӳ
-    { 11, 20, 10, 0, 16, 28, 11687 }, // ӳ
-    { 11, 18, 13, 1, 18, 25, 11715 }, // Ӵ
-    { 10, 15, 11, 0, 15, 19, 11740 }, // ӵ
-    { 10, 19, 11, 1, 15, 24, 11759 }, // Ӷ
-    { 8, 14, 9, 1, 11, 14, 11783 }, // ӷ
-    { 16, 18, 18, 1, 18, 36, 11797 }, // Ӹ
-    { 14, 15, 16, 1, 15, 27, 11833 }, // ӹ
-    { 12, 2, 10, -1, 7, 3, 11860 }, // –
-    { 22, 2, 21, -1, 7, 6, 11863 }, // —
-    { 22, 2, 21, -1, 7, 6, 11869 }, // ―
-    { 4, 5, 5, 1, 16, 3, 11875 }, // ‘
-    { 4, 5, 5, 0, 16, 3, 11878 }, // ’
-    { 4, 5, 5, 0, 2, 3, 11881 }, // ‚
-    { 8, 5, 9, 1, 16, 5, 11884 }, // “
-    { 8, 5, 9, 0, 16, 5, 11889 }, // ”
-    { 8, 5, 9, 0, 2, 5, 11894 }, // „
-    { 10, 18, 10, 0, 15, 23, 11899 }, // †
-    { 10, 18, 10, 0, 15, 23, 11922 }, // ‡
-    { 6, 5, 8, 1, 10, 4, 11945 }, // •
-    { 17, 3, 21, 2, 3, 7, 11949 }, // …
-    { 24, 15, 26, 1, 15, 45, 11956 }, // ‰
-    { 6, 9, 6, 0, 10, 7, 12001 }, // ‹
-    { 6, 9, 6, 0, 10, 7, 12008 }, // ›
-    { 11, 15, 3, -4, 15, 21, 12015 }, // ⁄
-    { 7, 8, 8, 0, 15, 7, 12036 }, // ⁰
-    { 8, 8, 8, 0, 15, 8, 12043 }, // ⁴
-    { 7, 8, 8, 0, 15, 7, 12051 }, // ⁵
-    { 7, 8, 8, 0, 15, 7, 12058 }, // ⁶
-    { 7, 8, 8, 0, 15, 7, 12065 }, // ⁷
-    { 7, 8, 8, 0, 15, 7, 12072 }, // ⁸
-    { 7, 8, 8, 0, 15, 7, 12079 }, // ⁹
-    { 7, 8, 8, 0, 8, 7, 12086 }, // ₀
-    { 4, 8, 8, 1, 8, 4, 12093 }, // ₁
-    { 7, 8, 8, 0, 8, 7, 12097 }, // ₂
-    { 7, 8, 8, 0, 8, 7, 12104 }, // ₃
-    { 8, 8, 8, 0, 8, 8, 12111 }, // ₄
-    { 7, 8, 8, 0, 8, 7, 12119 }, // ₅
-    { 7, 8, 8, 0, 8, 7, 12126 }, // ₆
-    { 7, 8, 8, 0, 8, 7, 12133 }, // ₇
-    { 7, 8, 8, 0, 8, 7, 12140 }, // ₈
-    { 7, 8, 8, 0, 8, 7, 12147 }, // ₉
-    { 12, 14, 12, 0, 14, 21, 12154 }, // €
-    { 12, 15, 12, 0, 15, 23, 12175 }, // ₮
-    { 12, 15, 12, 0, 15, 23, 12198 }, // ₴
-    { 11, 15, 12, 1, 15, 21, 12221 }, // ₹
-    { 12, 16, 12, 0, 16, 24, 12242 }, // ∂
-    { 14, 15, 14, 0, 15, 27, 12266 }, // ∆
-    { 12, 17, 15, 1, 15, 26, 12293 }, // ∏
-    { 11, 17, 11, 0, 15, 24, 12319 }, // ∑
-    { 10, 2, 12, 1, 7, 3, 12343 }, // −
-    { 11, 15, 3, -4, 15, 21, 12346 }, // ∕
-    { 3, 3, 5, 1, 8, 2, 12367 }, // ∙
-    { 13, 17, 12, 0, 16, 28, 12369 }, // √
-    { 12, 6, 12, 0, 9, 9, 12397 }, // ∞
-    { 8, 20, 8, 0, 16, 20, 12406 }, // ∫
-    { 11, 8, 12, 0, 10, 11, 12426 }, // ≈
-    { 10, 13, 12, 1, 13, 17, 12437 }, // ≠
-    { 10, 12, 12, 1, 12, 15, 12454 }, // ≤
-    { 10, 12, 12, 1, 12, 15, 12469 }, // ≥
+    { 4, 15, 6, 1, 15, 15, 0 }, // !
+    { 7, 5, 9, 1, 16, 5, 15 }, // "
+    { 12, 15, 14, 1, 15, 30, 20 }, // #
+    { 10, 19, 12, 1, 16, 38, 50 }, // $
+    { 16, 15, 18, 1, 15, 30, 88 }, // %
+    { 14, 15, 14, 0, 15, 30, 118 }, // &
+    { 3, 5, 5, 1, 16, 5, 148 }, // '
+    { 6, 20, 7, 1, 16, 20, 153 }, // (
+    { 6, 20, 7, 0, 16, 20, 173 }, // )
+    { 10, 8, 10, 0, 15, 16, 193 }, // *
+    { 10, 10, 12, 1, 11, 20, 209 }, // +
+    { 4, 5, 5, 0, 2, 5, 229 }, // ,
+    { 6, 2, 6, 0, 7, 2, 234 }, // -
+    { 3, 3, 5, 1, 3, 3, 236 }, // .
+    { 10, 20, 8, -1, 16, 40, 239 }, // /
+    { 10, 15, 12, 1, 15, 30, 279 }, // 0
+    { 7, 15, 12, 1, 15, 15, 309 }, // 1
+    { 10, 15, 12, 1, 15, 30, 324 }, // 2
+    { 10, 15, 12, 1, 15, 30, 354 }, // 3
+    { 11, 15, 12, 0, 15, 30, 384 }, // 4
+    { 10, 15, 12, 1, 15, 30, 414 }, // 5
+    { 10, 15, 12, 1, 15, 30, 444 }, // 6
+    { 10, 15, 12, 1, 15, 30, 474 }, // 7
+    { 10, 15, 12, 1, 15, 30, 504 }, // 8
+    { 10, 15, 12, 1, 15, 30, 534 }, // 9
+    { 3, 11, 5, 1, 11, 11, 564 }, // :
+    { 4, 14, 5, 0, 11, 14, 575 }, // ;
+    { 10, 9, 12, 1, 11, 18, 589 }, // <
+    { 10, 7, 12, 1, 10, 14, 607 }, // =
+    { 10, 9, 12, 1, 11, 18, 621 }, // >
+    { 8, 15, 8, 0, 15, 15, 639 }, // ?
+    { 18, 20, 20, 1, 16, 60, 654 }, // @
+    { 14, 15, 14, 0, 15, 30, 714 }, // A
+    { 12, 15, 14, 1, 15, 30, 744 }, // B
+    { 12, 15, 13, 1, 15, 30, 774 }, // C
+    { 13, 15, 15, 1, 15, 30, 804 }, // D
+    { 11, 15, 12, 1, 15, 30, 834 }, // E
+    { 10, 15, 11, 1, 15, 30, 864 }, // F
+    { 12, 15, 14, 1, 15, 30, 894 }, // G
+    { 12, 15, 15, 1, 15, 30, 924 }, // H
+    { 3, 15, 6, 1, 15, 15, 954 }, // I
+    { 9, 15, 11, 0, 15, 30, 969 }, // J
+    { 13, 15, 13, 1, 15, 30, 999 }, // K
+    { 10, 15, 11, 1, 15, 30, 1029 }, // L
+    { 16, 15, 18, 1, 15, 30, 1059 }, // M
+    { 13, 15, 15, 1, 15, 30, 1089 }, // N
+    { 15, 15, 16, 1, 15, 30, 1119 }, // O
+    { 12, 15, 13, 1, 15, 30, 1149 }, // P
+    { 15, 19, 16, 1, 15, 38, 1179 }, // Q
+    { 12, 15, 13, 1, 15, 30, 1217 }, // R
+    { 11, 15, 11, 0, 15, 30, 1247 }, // S
+    { 12, 15, 12, 0, 15, 30, 1277 }, // T
+    { 12, 15, 14, 1, 15, 30, 1307 }, // U
+    { 14, 15, 14, 0, 15, 30, 1337 }, // V
+    { 19, 15, 20, 0, 15, 45, 1367 }, // W
+    { 13, 15, 13, 0, 15, 30, 1412 }, // X
+    { 13, 15, 13, 0, 15, 30, 1442 }, // Y
+    { 12, 15, 12, 0, 15, 30, 1472 }, // Z
+    { 5, 20, 7, 2, 16, 20, 1502 }, // [
+    { 10, 20, 8, -1, 16, 40, 1522 }, // <backslash>
+    { 5, 20, 7, 0, 16, 20, 1562 }, // ]
+    { 11, 8, 12, 0, 15, 16, 1582 }, // ^
+    { 12, 2, 10, -1, -2, 4, 1598 }, // _
+    { 5, 4, 8, 1, 16, 4, 1602 }, // `
+    { 10, 11, 11, 0, 11, 22, 1606 }, // a
+    { 11, 16, 12, 1, 16, 32, 1628 }, // b
+    { 9, 11, 10, 1, 11, 22, 1660 }, // c
+    { 10, 16, 12, 1, 16, 32, 1682 }, // d
+    { 10, 11, 12, 1, 11, 22, 1714 }, // e
+    { 8, 16, 8, 1, 16, 16, 1736 }, // f
+    { 10, 15, 12, 1, 11, 30, 1752 }, // g
+    { 10, 16, 12, 1, 16, 32, 1782 }, // h
+    { 3, 16, 5, 1, 16, 16, 1814 }, // i
+    { 6, 20, 5, -2, 16, 20, 1830 }, // j
+    { 10, 16, 11, 1, 16, 32, 1850 }, // k
+    { 5, 16, 6, 1, 16, 16, 1882 }, // l
+    { 16, 11, 18, 1, 11, 22, 1898 }, // m
+    { 10, 11, 12, 1, 11, 22, 1920 }, // n
+    { 11, 11, 12, 1, 11, 22, 1942 }, // o
+    { 11, 15, 12, 1, 11, 30, 1964 }, // p
+    { 10, 15, 12, 1, 11, 30, 1994 }, // q
+    { 7, 11, 8, 1, 11, 11, 2024 }, // r
+    { 9, 11, 9, 0, 11, 22, 2035 }, // s
+    { 8, 14, 8, 1, 14, 14, 2057 }, // t
+    { 10, 11, 12, 1, 11, 22, 2071 }, // u
+    { 11, 11, 11, 0, 11, 22, 2093 }, // v
+    { 16, 11, 16, 0, 11, 22, 2115 }, // w
+    { 11, 11, 11, 0, 11, 22, 2137 }, // x
+    { 11, 15, 10, 0, 11, 30, 2159 }, // y
+    { 10, 11, 10, 0, 11, 22, 2189 }, // z
+    { 7, 20, 7, 0, 16, 20, 2211 }, // {
+    { 2, 20, 6, 2, 16, 20, 2231 }, // |
+    { 7, 20, 7, 0, 16, 20, 2251 }, // }
+    { 11, 4, 12, 0, 8, 8, 2271 }, // ~
+    { 0, 0, 5, 0, 0, 0, 2279 }, //  
+    { 4, 15, 6, 1, 11, 15, 2279 }, // ¡
+    { 10, 17, 12, 1, 14, 34, 2294 }, // ¢
+    { 10, 15, 12, 1, 15, 30, 2328 }, // £
+    { 11, 10, 12, 0, 12, 20, 2358 }, // ¤
+    { 12, 15, 12, 0, 15, 30, 2378 }, // ¥
+    { 2, 20, 6, 2, 16, 20, 2408 }, // ¦
+    { 10, 18, 10, 0, 16, 36, 2428 }, // §
+    { 8, 2, 8, 0, 15, 2, 2464 }, // ¨
+    { 15, 15, 17, 1, 15, 30, 2466 }, // ©
+    { 8, 8, 8, 0, 15, 8, 2496 }, // ª
+    { 10, 9, 10, 0, 10, 18, 2504 }, // «
+    { 10, 8, 12, 1, 9, 16, 2522 }, // ¬
+    { 6, 2, 6, 0, 7, 2, 2538 }, // ­
+    { 15, 15, 17, 1, 15, 30, 2540 }, // ®
+    { 7, 2, 8, 0, 15, 2, 2570 }, // ¯
+    { 7, 6, 7, 0, 16, 6, 2572 }, // °
+    { 10, 13, 12, 1, 13, 26, 2578 }, // ±
+    { 7, 8, 8, 0, 15, 8, 2604 }, // ²
+    { 7, 8, 8, 0, 15, 8, 2612 }, // ³
+    { 5, 4, 8, 2, 16, 4, 2620 }, // ´
+    { 10, 15, 12, 1, 11, 30, 2624 }, // µ
+    { 12, 19, 14, 0, 15, 38, 2654 }, // ¶
+    { 3, 3, 5, 1, 8, 3, 2692 }, // ·
+    { 5, 4, 8, 1, 0, 4, 2695 }, // ¸
+    { 4, 8, 8, 1, 15, 8, 2699 }, // ¹
+    { 9, 8, 9, 0, 15, 16, 2707 }, // º
+    { 10, 9, 10, 0, 10, 18, 2723 }, // »
+    { 17, 15, 18, 1, 15, 45, 2741 }, // ¼
+    { 17, 15, 18, 1, 15, 45, 2786 }, // ½
+    { 18, 15, 18, 0, 15, 45, 2831 }, // ¾
+    { 9, 15, 8, 0, 11, 30, 2876 }, // ¿
+    { 14, 20, 14, 0, 20, 40, 2906 }, // À
+    { 14, 20, 14, 0, 20, 40, 2946 }, // Á
+    { 14, 20, 14, 0, 20, 40, 2986 }, // Â
+    { 14, 19, 14, 0, 19, 38, 3026 }, // Ã
+    { 14, 18, 14, 0, 18, 36, 3064 }, // Ä
+    { 14, 18, 14, 0, 18, 36, 3100 }, // Å
+    { 19, 15, 20, 0, 15, 45, 3136 }, // Æ
+    { 12, 18, 13, 1, 15, 36, 3181 }, // Ç
+    { 11, 20, 12, 1, 20, 40, 3217 }, // È
+    { 11, 20, 12, 1, 20, 40, 3257 }, // É
+    { 11, 20, 12, 1, 20, 40, 3297 }, // Ê
+    { 11, 18, 12, 1, 18, 36, 3337 }, // Ë
+    { 5, 20, 6, 0, 20, 20, 3373 }, // Ì
+    { 5, 20, 6, 1, 20, 20, 3393 }, // Í
+    { 7, 20, 6, -1, 20, 20, 3413 }, // Î
+    { 8, 18, 6, -1, 18, 18, 3433 }, // Ï
+    { 15, 15, 15, 0, 15, 30, 3451 }, // Ð
+    { 13, 19, 15, 1, 19, 38, 3481 }, // Ñ
+    { 15, 20, 16, 1, 20, 40, 3519 }, // Ò
+    { 15, 20, 16, 1, 20, 40, 3559 }, // Ó
+    { 15, 20, 16, 1, 20, 40, 3599 }, // Ô
+    { 15, 19, 16, 1, 19, 38, 3639 }, // Õ
+    { 15, 18, 16, 1, 18, 36, 3677 }, // Ö
+    { 10, 9, 12, 1, 11, 18, 3713 }, // ×
+    { 15, 15, 16, 1, 15, 30, 3731 }, // Ø
+    { 12, 20, 14, 1, 20, 40, 3761 }, // Ù
+    { 12, 20, 14, 1, 20, 40, 3801 }, // Ú
+    { 12, 20, 14, 1, 20, 40, 3841 }, // Û
+    { 12, 18, 14, 1, 18, 36, 3881 }, // Ü
+    { 13, 20, 13, 0, 20, 40, 3917 }, // Ý
+    { 12, 15, 13, 1, 15, 30, 3957 }, // Þ
+    { 12, 16, 13, 1, 16, 32, 3987 }, // ß
+    { 10, 16, 11, 0, 16, 32, 4019 }, // à
+    { 10, 16, 11, 0, 16, 32, 4051 }, // á
+    { 10, 16, 11, 0, 16, 32, 4083 }, // â
+    { 10, 16, 11, 0, 16, 32, 4115 }, // ã
+    { 10, 15, 11, 0, 15, 30, 4147 }, // ä
+    { 10, 16, 11, 0, 16, 32, 4177 }, // å
+    { 17, 11, 18, 0, 11, 33, 4209 }, // æ
+    { 9, 15, 10, 1, 11, 30, 4242 }, // ç
+    { 10, 16, 12, 1, 16, 32, 4272 }, // è
+    { 10, 16, 12, 1, 16, 32, 4304 }, // é
+    { 10, 16, 12, 1, 16, 32, 4336 }, // ê
+    { 10, 15, 12, 1, 15, 30, 4368 }, // ë
+    { 5, 16, 5, 0, 16, 16, 4398 }, // ì
+    { 5, 16, 5, 1, 16, 16, 4414 }, // í
+    { 7, 16, 5, -1, 16, 16, 4430 }, // î
+    { 7, 15, 5, -1, 15, 15, 4446 }, // ï
+    { 11, 16, 12, 1, 16, 32, 4461 }, // ð
+    { 10, 16, 12, 1, 16, 32, 4493 }, // ñ
+    { 11, 16, 12, 1, 16, 32, 4525 }, // ò
+    { 11, 16, 12, 1, 16, 32, 4557 }, // ó
+    { 11, 16, 12, 1, 16, 32, 4589 }, // ô
+    { 11, 16, 12, 1, 16, 32, 4621 }, // õ
+    { 11, 15, 12, 1, 15, 30, 4653 }, // ö
+    { 10, 12, 12, 1, 12, 24, 4683 }, // ÷
+    { 11, 11, 12, 1, 11, 22, 4707 }, // ø
+    { 10, 16, 12, 1, 16, 32, 4729 }, // ù
+    { 10, 16, 12, 1, 16, 32, 4761 }, // ú
+    { 10, 16, 12, 1, 16, 32, 4793 }, // û
+    { 10, 15, 12, 1, 15, 30, 4825 }, // ü
+    { 11, 20, 10, 0, 16, 40, 4855 }, // ý
+    { 11, 20, 12, 1, 16, 40, 4895 }, // þ
+    { 11, 19, 10, 0, 15, 38, 4935 }, // ÿ
+    { 14, 18, 14, 0, 18, 36, 4973 }, // Ā
+    { 10, 15, 11, 0, 15, 30, 5009 }, // ā
+    { 14, 19, 14, 0, 19, 38, 5039 }, // Ă
+    { 10, 16, 11, 0, 16, 32, 5077 }, // ă
+    { 14, 19, 14, 0, 15, 38, 5109 }, // Ą
+    { 10, 14, 11, 0, 11, 28, 5147 }, // ą
+    { 12, 20, 13, 1, 20, 40, 5175 }, // Ć
+    { 9, 16, 10, 1, 16, 32, 5215 }, // ć
+    { 12, 20, 13, 1, 20, 40, 5247 }, // Ĉ
+    { 9, 16, 10, 1, 16, 32, 5287 }, // ĉ
+    { 12, 19, 13, 1, 19, 38, 5319 }, // Ċ
+    { 9, 16, 10, 1, 16, 32, 5357 }, // ċ
+    { 12, 20, 13, 1, 20, 40, 5389 }, // Č
+    { 9, 16, 10, 1, 16, 32, 5429 }, // č
+    { 13, 20, 15, 1, 20, 40, 5461 }, // Ď
+    { 14, 16, 13, 1, 16, 32, 5501 }, // ď
+    { 15, 15, 15, 0, 15, 30, 5533 }, // Đ
+    { 12, 16, 12, 1, 16, 32, 5563 }, // đ
+    { 11, 18, 12, 1, 18, 36, 5595 }, // Ē
+    { 10, 15, 12, 1, 15, 30, 5631 }, // ē
+    { 11, 19, 12, 1, 19, 38, 5661 }, // Ĕ
+    { 10, 16, 12, 1, 16, 32, 5699 }, // ĕ
+    { 11, 19, 12, 1, 19, 38, 5731 }, // Ė
+    { 10, 16, 12, 1, 16, 32, 5769 }, // ė
+    { 11, 19, 12, 1, 15, 38, 5801 }, // Ę
+    { 10, 14, 12, 1, 11, 28, 5839 }, // ę
+    { 11, 20, 12, 1, 20, 40, 5867 }, // Ě
+    { 10, 17, 12, 1, 17, 34, 5907 }, // ě
+    { 12, 20, 14, 1, 20, 40, 5941 }, // Ĝ
+    { 10, 20, 12, 1, 16, 40, 5981 }, // ĝ
+    { 12, 19, 14, 1, 19, 38, 6021 }, // Ğ
+    { 10, 20, 12, 1, 16, 40, 6059 }, // ğ
+    { 12, 19, 14, 1, 19, 38, 6099 }, // Ġ
+    { 10, 20, 12, 1, 16, 40, 6137 }, // ġ
+    { 12, 19, 14, 1, 15, 38, 6177 }, // Ģ
+    { 10, 21, 12, 1, 17, 42, 6215 }, // ģ
+    { 12, 20, 15, 1, 20, 40, 6257 }, // Ĥ
+    { 10, 20, 12, 1, 20, 40, 6297 }, // ĥ
+    { 15, 15, 15, 0, 15, 30, 6337 }, // Ħ
+    { 11, 16, 12, 0, 16, 32, 6367 }, // ħ
+    { 8, 19, 6, -1, 19, 19, 6399 }, // Ĩ
+    { 8, 16, 5, -1, 16, 16, 6418 }, // ĩ
+    { 7, 18, 6, -1, 18, 18, 6434 }, // Ī
+    { 7, 15, 5, -1, 15, 15, 6452 }, // ī
+    { 6, 19, 6, 0, 19, 19, 6467 }, // Ĭ
+    { 7, 16, 5, -1, 16, 16, 6486 }, // ĭ
+    { 5, 19, 6, 0, 15, 19, 6502 }, // Į
+    { 4, 20, 5, 0, 16, 20, 6521 }, // į
+    { 4, 19, 6, 1, 19, 19, 6541 }, // İ
+    { 3, 11, 5, 1, 11, 11, 6560 }, // ı
+    { 14, 15, 16, 1, 15, 30, 6571 }, // Ĳ
+    { 9, 20, 11, 1, 16, 40, 6601 }, // ĳ
+    { 11, 20, 11, 0, 20, 40, 6641 }, // Ĵ
+    { 8, 20, 5, -2, 16, 20, 6681 }, // ĵ
+    { 13, 19, 13, 1, 15, 38, 6701 }, // Ķ
+    { 10, 20, 11, 1, 16, 40, 6739 }, // ķ
+    { 10, 11, 11, 1, 11, 22, 6779 }, // ĸ
+    { 10, 20, 11, 1, 20, 40, 6801 }, // Ĺ
+    { 5, 20, 6, 1, 20, 20, 6841 }, // ĺ
+    { 10, 19, 11, 1, 15, 38, 6861 }, // Ļ
+    { 6, 20, 6, 0, 16, 20, 6899 }, // ļ
+    { 10, 15, 11, 1, 15, 30, 6919 }, // Ľ
+    { 6, 16, 6, 1, 16, 16, 6949 }, // ľ
+    { 10, 15, 11, 1, 15, 30, 6965 }, // Ŀ
+    { 7, 16, 8, 1, 16, 16, 6995 }, // ŀ
+    { 12, 15, 11, -1, 15, 30, 7011 }, // Ł
+    { 7, 16, 6, 0, 16, 16, 7041 }, // ł
+    { 13, 20, 15, 1, 20, 40, 7057 }, // Ń
+    { 10, 16, 12, 1, 16, 32, 7097 }, // ń
+    { 13, 19, 15, 1, 15, 38, 7129 }, // Ņ
+    { 10, 15, 12, 1, 11, 30, 7167 }, // ņ
+    { 13, 20, 15, 1, 20, 40, 7197 }, // Ň
+    { 10, 16, 12, 1, 16, 32, 7237 }, // ň
+    { 11, 16, 12, 0, 16, 32, 7269 }, // ŉ
+    { 13, 19, 15, 1, 15, 38, 7301 }, // Ŋ
+    { 10, 15, 12, 1, 11, 30, 7339 }, // ŋ
+    { 15, 18, 16, 1, 18, 36, 7369 }, // Ō
+    { 11, 15, 12, 1, 15, 30, 7405 }, // ō
+    { 15, 19, 16, 1, 19, 38, 7435 }, // Ŏ
+    { 11, 16, 12, 1, 16, 32, 7473 }, // ŏ
+    { 15, 20, 16, 1, 20, 40, 7505 }, // Ő
+    { 11, 16, 12, 1, 16, 32, 7545 }, // ő
+    { 20, 15, 21, 1, 15, 45, 7577 }, // Œ
+    { 18, 11, 20, 1, 11, 33, 7622 }, // œ
+    { 12, 20, 13, 1, 20, 40, 7655 }, // Ŕ
+    { 7, 16, 8, 1, 16, 16, 7695 }, // ŕ
+    { 12, 19, 13, 1, 15, 38, 7711 }, // Ŗ
+    { 8, 15, 8, 0, 11, 15, 7749 }, // ŗ
+    { 12, 20, 13, 1, 20, 40, 7764 }, // Ř
+    { 7, 16, 8, 1, 16, 16, 7804 }, // ř
+    { 11, 20, 11, 0, 20, 40, 7820 }, // Ś
+    { 9, 16, 9, 0, 16, 32, 7860 }, // ś
+    { 11, 20, 11, 0, 20, 40, 7892 }, // Ŝ
+    { 9, 16, 9, 0, 16, 32, 7932 }, // ŝ
+    { 11, 18, 11, 0, 15, 36, 7964 }, // Ş
+    { 9, 14, 9, 0, 11, 28, 8000 }, // ş
+    { 11, 20, 11, 0, 20, 40, 8028 }, // Š
+    { 9, 16, 9, 0, 16, 32, 8068 }, // š
+    { 12, 18, 12, 0, 15, 36, 8100 }, // Ţ
+    { 8, 17, 8, 1, 14, 17, 8136 }, // ţ
+    { 12, 20, 12, 0, 20, 40, 8153 }, // Ť
+    { 8, 16, 8, 1, 16, 16, 8193 }, // ť
+    { 12, 15, 12, 0, 15, 30, 8209 }, // Ŧ
+    { 8, 14, 8, 1, 14, 14, 8239 }, // ŧ
+    { 12, 19, 14, 1, 19, 38, 8253 }, // Ũ
+    { 10, 16, 12, 1, 16, 32, 8291 }, // ũ
+    { 12, 18, 14, 1, 18, 36, 8323 }, // Ū
+    { 10, 15, 12, 1, 15, 30, 8359 }, // ū
+    { 12, 19, 14, 1, 19, 38, 8389 }, // Ŭ
+    { 10, 16, 12, 1, 16, 32, 8427 }, // ŭ
+    { 12, 19, 14, 1, 19, 38, 8459 }, // Ů
+    { 10, 16, 12, 1, 16, 32, 8497 }, // ů
+    { 12, 20, 14, 1, 20, 40, 8529 }, // Ű
+    { 10, 16, 12, 1, 16, 32, 8569 }, // ű
+    { 12, 18, 14, 1, 15, 36, 8601 }, // Ų
+    { 10, 14, 12, 1, 11, 28, 8637 }, // ų
+    { 19, 20, 20, 0, 20, 60, 8665 }, // Ŵ
+    { 16, 16, 16, 0, 16, 32, 8725 }, // ŵ
+    { 13, 20, 13, 0, 20, 40, 8757 }, // Ŷ
+    { 11, 20, 10, 0, 16, 40, 8797 }, // ŷ
+    { 13, 18, 13, 0, 18, 36, 8837 }, // Ÿ
+    { 12, 20, 12, 0, 20, 40, 8873 }, // Ź
+    { 10, 16, 10, 0, 16, 32, 8913 }, // ź
+    { 12, 19, 12, 0, 19, 38, 8945 }, // Ż
+    { 10, 16, 10, 0, 16, 32, 8983 }, // ż
+    { 12, 20, 12, 0, 20, 40, 9015 }, // Ž
+    { 10, 16, 10, 0, 16, 32, 9055 }, // ž
+    { 8, 16, 6, 1, 16, 16, 9087 }, // ſ
+    { 6, 3, 8, 1, 16, 3, 9103 }, // ̑
+    { 11, 20, 12, 1, 20, 40, 9106 }, // Ѐ
+    { 11, 18, 12, 1, 18, 36, 9146 }, // Ё
+    { 15, 15, 16, 0, 15, 30, 9182 }, // Ђ
+    { 10, 20, 11, 1, 20, 40, 9212 }, // Ѓ
+    { 12, 15, 13, 1, 15, 30, 9252 }, // Є
+    { 11, 15, 11, 0, 15, 30, 9282 }, // Ѕ
+    { 3, 15, 6, 1, 15, 15, 9312 }, // І
+    { 8, 18, 6, -1, 18, 18, 9327 }, // Ї
+    { 9, 15, 11, 0, 15, 30, 9345 }, // Ј
+    { 22, 16, 22, 0, 15, 48, 9375 }, // Љ
+    { 20, 15, 22, 1, 15, 45, 9423 }, // Њ
+    { 15, 15, 16, 0, 15, 30, 9468 }, // Ћ
+    { 13, 20, 13, 1, 20, 40, 9498 }, // Ќ
+    { 13, 20, 15, 1, 20, 40, 9538 }, // Ѝ
+    { 13, 19, 12, 0, 19, 38, 9578 }, // Ў
+    { 12, 19, 15, 1, 15, 38, 9616 }, // Џ
+    { 14, 15, 14, 0, 15, 30, 9654 }, // А
+    { 12, 15, 13, 1, 15, 30, 9684 }, // Б
+    { 12, 15, 14, 1, 15, 30, 9714 }, // В
+    { 10, 15, 11, 1, 15, 30, 9744 }, // Г
+    { 15, 19, 15, 0, 15, 38, 9774 }, // Д
+    { 11, 15, 12, 1, 15, 30, 9812 }, // Е
+    { 19, 15, 19, 0, 15, 45, 9842 }, // Ж
+    { 11, 15, 12, 0, 15, 30, 9887 }, // З
+    { 13, 15, 15, 1, 15, 30, 9917 }, // И
+    { 13, 19, 15, 1, 19, 38, 9947 }, // Й
+    { 13, 15, 13, 1, 15, 30, 9985 }, // К
+    { 14, 15, 15, 0, 15, 30, 10015 }, // Л
+    { 16, 15, 18, 1, 15, 30, 10045 }, // М
+    { 12, 15, 15, 1, 15, 30, 10075 }, // Н
+    { 15, 15, 16, 1, 15, 30, 10105 }, // О
+    { 12, 15, 15, 1, 15, 30, 10135 }, // П
+    { 12, 15, 13, 1, 15, 30, 10165 }, // Р
+    { 12, 15, 13, 1, 15, 30, 10195 }, // С
+    { 12, 15, 12, 0, 15, 30, 10225 }, // Т
+    { 13, 15, 12, 0, 15, 30, 10255 }, // У
+    { 16, 16, 18, 1, 16, 32, 10285 }, // Ф
+    { 13, 15, 13, 0, 15, 30, 10317 }, // Х
+    { 14, 19, 15, 1, 15, 38, 10347 }, // Ц
+    { 11, 15, 13, 1, 15, 30, 10385 }, // Ч
+    { 18, 15, 21, 1, 15, 45, 10415 }, // Ш
+    { 20, 19, 21, 1, 15, 57, 10460 }, // Щ
+    { 15, 15, 15, 0, 15, 30, 10517 }, // Ъ
+    { 16, 15, 18, 1, 15, 30, 10547 }, // Ы
+    { 12, 15, 13, 1, 15, 30, 10577 }, // Ь
+    { 12, 15, 13, 0, 15, 30, 10607 }, // Э
+    { 20, 15, 22, 1, 15, 45, 10637 }, // Ю
+    { 12, 15, 13, 0, 15, 30, 10682 }, // Я
+    { 10, 11, 11, 0, 11, 22, 10712 }, // а
+    { 11, 16, 13, 1, 16, 32, 10734 }, // б
+    { 10, 11, 12, 1, 11, 22, 10766 }, // в
+    { 8, 11, 9, 1, 11, 11, 10788 }, // г
+    { 13, 14, 13, 0, 11, 28, 10799 }, // д
+    { 10, 11, 12, 1, 11, 22, 10827 }, // е
+    { 16, 11, 16, 0, 11, 22, 10849 }, // ж
+    { 10, 11, 10, 0, 11, 22, 10871 }, // з
+    { 10, 11, 13, 1, 11, 22, 10893 }, // и
+    { 10, 16, 13, 1, 16, 32, 10915 }, // й
+    { 10, 11, 11, 1, 11, 22, 10947 }, // к
+    { 11, 11, 13, 0, 11, 22, 10969 }, // л
+    { 13, 11, 15, 1, 11, 22, 10991 }, // м
+    { 10, 11, 12, 1, 11, 22, 11013 }, // н
+    { 11, 11, 12, 1, 11, 22, 11035 }, // о
+    { 10, 11, 12, 1, 11, 22, 11057 }, // п
+    { 11, 15, 12, 1, 11, 30, 11079 }, // р
+    { 9, 11, 10, 1, 11, 22, 11109 }, // с
+    { 10, 11, 10, 0, 11, 22, 11131 }, // т
+    { 11, 15, 10, 0, 11, 30, 11153 }, // у
+    { 15, 20, 16, 1, 16, 40, 11183 }, // ф
+    { 11, 11, 11, 0, 11, 22, 11223 }, // х
+    { 11, 14, 12, 1, 11, 28, 11245 }, // ц
+    { 10, 11, 11, 0, 11, 22, 11273 }, // ч
+    { 15, 11, 17, 1, 11, 22, 11295 }, // ш
+    { 17, 14, 18, 1, 11, 42, 11317 }, // щ
+    { 12, 11, 13, 0, 11, 22, 11359 }, // ъ
+    { 14, 11, 16, 1, 11, 22, 11381 }, // ы
+    { 10, 11, 11, 1, 11, 22, 11403 }, // ь
+    { 10, 11, 10, 0, 11, 22, 11425 }, // э
+    { 15, 11, 17, 1, 11, 22, 11447 }, // ю
+    { 10, 11, 12, 0, 11, 22, 11469 }, // я
+    { 10, 16, 12, 1, 16, 32, 11491 }, // ѐ
+    { 10, 15, 12, 1, 15, 30, 11523 }, // ё
+    { 11, 20, 12, 0, 16, 40, 11553 }, // ђ
+    { 8, 16, 9, 1, 16, 16, 11593 }, // ѓ
+    { 9, 11, 10, 1, 11, 22, 11609 }, // є
+    { 9, 11, 9, 0, 11, 22, 11631 }, // ѕ
+    { 3, 16, 5, 1, 16, 16, 11653 }, // і
+    { 7, 15, 5, -1, 15, 15, 11669 }, // ї
+    { 6, 20, 5, -2, 16, 20, 11684 }, // ј
+    { 18, 11, 18, 0, 11, 33, 11704 }, // љ
+    { 17, 11, 18, 1, 11, 33, 11737 }, // њ
+    { 11, 16, 12, 0, 16, 32, 11770 }, // ћ
+    { 10, 16, 11, 1, 16, 32, 11802 }, // ќ
+    { 10, 16, 13, 1, 16, 32, 11834 }, // ѝ
+    { 11, 20, 10, 0, 16, 40, 11866 }, // ў
+    { 10, 14, 12, 1, 11, 28, 11906 }, // џ
+    { 15, 16, 15, 0, 16, 32, 11934 }, // Ѣ
+    { 12, 16, 13, 0, 16, 32, 11966 }, // ѣ
+    { 15, 15, 16, 1, 15, 30, 11998 }, // Ѳ
+    { 11, 11, 12, 1, 11, 22, 12028 }, // ѳ
+    { 17, 15, 16, 0, 15, 45, 12050 }, // Ѵ
+    { 12, 11, 12, 0, 11, 22, 12095 }, // ѵ
+    { 15, 23, 16, 1, 19, 46, 12117 }, // Ҋ
+    { 12, 20, 13, 1, 16, 40, 12163 }, // ҋ
+    { 13, 16, 13, 0, 16, 32, 12203 }, // Ҍ
+    { 11, 11, 11, 0, 11, 22, 12235 }, // ҍ
+    { 12, 15, 13, 1, 15, 30, 12257 }, // Ҏ
+    { 11, 15, 12, 1, 11, 30, 12287 }, // ҏ
+    { 10, 18, 11, 1, 18, 36, 12317 }, // Ґ
+    { 8, 14, 9, 1, 14, 14, 12353 }, // ґ
+    { 11, 15, 11, 0, 15, 30, 12367 }, // Ғ
+    { 9, 11, 9, 0, 11, 22, 12397 }, // ғ
+    { 12, 19, 13, 1, 15, 38, 12419 }, // Ҕ
+    { 10, 15, 11, 1, 11, 30, 12457 }, // ҕ
+    { 20, 19, 19, 0, 15, 57, 12487 }, // Җ
+    { 17, 14, 16, 0, 11, 42, 12544 }, // җ
+    { 11, 18, 12, 0, 15, 36, 12586 }, // Ҙ
+    { 10, 14, 10, 0, 11, 28, 12622 }, // ҙ
+    { 13, 19, 14, 1, 15, 38, 12650 }, // Қ
+    { 11, 15, 11, 1, 11, 30, 12688 }, // қ
+    { 14, 15, 15, 1, 15, 30, 12718 }, // Ҝ
+    { 12, 11, 13, 1, 11, 22, 12748 }, // ҝ
+    { 14, 15, 13, 0, 15, 30, 12770 }, // Ҟ
+    { 12, 11, 12, 0, 11, 22, 12800 }, // ҟ
+    { 16, 15, 16, 0, 15, 30, 12822 }, // Ҡ
+    { 13, 11, 13, 0, 11, 22, 12852 }, // ҡ
+    { 14, 19, 15, 1, 15, 38, 12874 }, // Ң
+    { 12, 14, 13, 1, 11, 28, 12912 }, // ң
+    { 16, 15, 17, 1, 15, 30, 12940 }, // Ҥ
+    { 13, 11, 14, 1, 11, 22, 12970 }, // ҥ
+    { 20, 19, 22, 1, 15, 57, 12992 }, // Ҧ
+    { 17, 15, 18, 1, 11, 45, 13049 }, // ҧ
+    { 15, 19, 17, 1, 15, 38, 13094 }, // Ҩ
+    { 11, 14, 13, 1, 11, 28, 13132 }, // ҩ
+    { 12, 18, 13, 1, 15, 36, 13160 }, // Ҫ
+    { 9, 15, 10, 1, 11, 30, 13196 }, // ҫ
+    { 12, 19, 12, 0, 15, 38, 13226 }, // Ҭ
+    { 10, 14, 10, 0, 11, 28, 13264 }, // ҭ
+    { 13, 15, 13, 0, 15, 30, 13292 }, // Ү
+    { 11, 15, 11, 0, 11, 30, 13322 }, // ү
+    { 13, 15, 13, 0, 15, 30, 13352 }, // Ұ
+    { 11, 15, 11, 0, 11, 30, 13382 }, // ұ
+    { 14, 19, 14, 0, 15, 38, 13412 }, // Ҳ
+    { 11, 14, 11, 0, 11, 28, 13450 }, // ҳ
+    { 18, 19, 18, 0, 15, 57, 13478 }, // Ҵ
+    { 14, 14, 14, 0, 11, 28, 13535 }, // ҵ
+    { 13, 19, 14, 1, 15, 38, 13563 }, // Ҷ
+    { 11, 14, 11, 0, 11, 28, 13601 }, // ҷ
+    { 11, 15, 13, 1, 15, 30, 13629 }, // Ҹ
+    { 10, 11, 11, 0, 11, 22, 13659 }, // ҹ
+    { 12, 15, 13, 1, 15, 30, 13681 }, // Һ
+    { 10, 16, 12, 1, 16, 32, 13711 }, // һ
+    { 17, 15, 18, 0, 15, 45, 13743 }, // Ҽ
+    { 13, 11, 14, 0, 11, 22, 13788 }, // ҽ
+    { 17, 19, 18, 0, 15, 57, 13810 }, // Ҿ
+    { 13, 14, 14, 0, 11, 28, 13867 }, // ҿ
+    { 3, 15, 6, 1, 15, 15, 13895 }, // Ӏ
+    { 19, 19, 19, 0, 19, 57, 13910 }, // Ӂ
+    { 16, 16, 16, 0, 16, 32, 13967 }, // ӂ
+    { 12, 19, 13, 1, 15, 38, 13999 }, // Ӄ
+    { 10, 15, 11, 1, 11, 30, 14037 }, // ӄ
+    { 15, 19, 15, 0, 15, 38, 14067 }, // Ӆ
+    { 13, 15, 13, 0, 11, 30, 14105 }, // ӆ
+    { 12, 19, 15, 1, 15, 38, 14135 }, // Ӈ
+    { 10, 15, 12, 1, 11, 30, 14173 }, // ӈ
+    { 14, 19, 15, 1, 15, 38, 14203 }, // Ӊ
+    { 12, 15, 13, 1, 11, 30, 14241 }, // ӊ
+    { 11, 19, 13, 1, 15, 38, 14271 }, // Ӌ
+    { 10, 14, 11, 0, 11, 28, 14309 }, // ӌ
+    { 18, 19, 19, 1, 15, 57, 14337 }, // Ӎ
+    { 15, 15, 16, 1, 11, 30, 14394 }, // ӎ
+    { 3, 15, 6, 1, 15, 15, 14424 }, // ӏ
+    { 14, 19, 14, 0, 19, 38, 14439 }, // Ӑ
+    { 10, 16, 11, 0, 16, 32, 14477 }, // ӑ
+    { 14, 18, 14, 0, 18, 36, 14509 }, // Ӓ
+    { 10, 15, 11, 0, 15, 30, 14545 }, // ӓ
+    { 19, 15, 20, 0, 15, 45, 14575 }, // Ӕ
+    { 17, 11, 18, 0, 11, 33, 14620 }, // ӕ
+    { 11, 19, 12, 1, 19, 38, 14653 }, // Ӗ
+    { 10, 16, 12, 1, 16, 32, 14691 }, // ӗ
+    { 13, 15, 15, 1, 15, 30, 14723 }, // Ә
+    { 10, 11, 12, 1, 11, 22, 14753 }, // ә
+    { 13, 18, 15, 1, 18, 36, 14775 }, // Ӛ
+    { 10, 15, 12, 1, 15, 30, 14811 }, // ӛ
+    { 19, 18, 19, 0, 18, 54, 14841 }, // Ӝ
+    { 16, 15, 16, 0, 15, 30, 14895 }, // ӝ
+    { 11, 18, 12, 0, 18, 36, 14925 }, // Ӟ
+    { 10, 15, 10, 0, 15, 30, 14961 }, // ӟ
+    { 11, 15, 12, 0, 15, 30, 14991 }, // Ӡ
+    { 11, 15, 10, -1, 11, 30, 15021 }, // ӡ
+    { 13, 18, 15, 1, 18, 36, 15051 }, // Ӣ
+    { 10, 15, 13, 1, 15, 30, 15087 }, // ӣ
+    { 13, 18, 15, 1, 18, 36, 15117 }, // Ӥ
+    { 10, 15, 13, 1, 15, 30, 15153 }, // ӥ
+    { 15, 18, 16, 1, 18, 36, 15183 }, // Ӧ
+    { 11, 15, 12, 1, 15, 30, 15219 }, // ӧ
+    { 15, 15, 16, 1, 15, 30, 15249 }, // Ө
+    { 11, 11, 12, 1, 11, 22, 15279 }, // ө
+    { 15, 18, 16, 1, 18, 36, 15301 }, // Ӫ
+    { 11, 15, 12, 1, 15, 30, 15337 }, // ӫ
+    { 12, 18, 13, 0, 18, 36, 15367 }, // Ӭ
+    { 10, 15, 10, 0, 15, 30, 15403 }, // ӭ
+    { 13, 18, 12, 0, 18, 36, 15433 }, // Ӯ
+    { 11, 19, 10, 0, 15, 38, 15469 }, // ӯ
+    { 13, 18, 12, 0, 18, 36, 15507 }, // Ӱ
+    { 11, 19, 10, 0, 15, 38, 15543 }, // ӱ
+    { 13, 19, 12, 0, 19, 38, 15581 }, // Ӳ
+    { 11, 20, 10, 0, 16, 40, 15619 }, // ӳ
+    { 11, 18, 13, 1, 18, 36, 15659 }, // Ӵ
+    { 10, 15, 11, 0, 15, 30, 15695 }, // ӵ
+    { 10, 19, 11, 1, 15, 38, 15725 }, // Ӷ
+    { 8, 14, 9, 1, 11, 14, 15763 }, // ӷ
+    { 16, 18, 18, 1, 18, 36, 15777 }, // Ӹ
+    { 14, 15, 16, 1, 15, 30, 15813 }, // ӹ
+    { 12, 2, 10, -1, 7, 4, 15843 }, // –
+    { 22, 2, 21, -1, 7, 6, 15847 }, // —
+    { 22, 2, 21, -1, 7, 6, 15853 }, // ―
+    { 4, 5, 5, 1, 16, 5, 15859 }, // ‘
+    { 4, 5, 5, 0, 16, 5, 15864 }, // ’
+    { 4, 5, 5, 0, 2, 5, 15869 }, // ‚
+    { 8, 5, 9, 1, 16, 5, 15874 }, // “
+    { 8, 5, 9, 0, 16, 5, 15879 }, // ”
+    { 8, 5, 9, 0, 2, 5, 15884 }, // „
+    { 10, 18, 10, 0, 15, 36, 15889 }, // †
+    { 10, 18, 10, 0, 15, 36, 15925 }, // ‡
+    { 6, 5, 8, 1, 10, 5, 15961 }, // •
+    { 17, 3, 21, 2, 3, 9, 15966 }, // …
+    { 24, 15, 26, 1, 15, 45, 15975 }, // ‰
+    { 6, 9, 6, 0, 10, 9, 16020 }, // ‹
+    { 6, 9, 6, 0, 10, 9, 16029 }, // ›
+    { 11, 15, 3, -4, 15, 30, 16038 }, // ⁄
+    { 7, 8, 8, 0, 15, 8, 16068 }, // ⁰
+    { 8, 8, 8, 0, 15, 8, 16076 }, // ⁴
+    { 7, 8, 8, 0, 15, 8, 16084 }, // ⁵
+    { 7, 8, 8, 0, 15, 8, 16092 }, // ⁶
+    { 7, 8, 8, 0, 15, 8, 16100 }, // ⁷
+    { 7, 8, 8, 0, 15, 8, 16108 }, // ⁸
+    { 7, 8, 8, 0, 15, 8, 16116 }, // ⁹
+    { 7, 8, 8, 0, 8, 8, 16124 }, // ₀
+    { 4, 8, 8, 1, 8, 8, 16132 }, // ₁
+    { 7, 8, 8, 0, 8, 8, 16140 }, // ₂
+    { 7, 8, 8, 0, 8, 8, 16148 }, // ₃
+    { 8, 8, 8, 0, 8, 8, 16156 }, // ₄
+    { 7, 8, 8, 0, 8, 8, 16164 }, // ₅
+    { 7, 8, 8, 0, 8, 8, 16172 }, // ₆
+    { 7, 8, 8, 0, 8, 8, 16180 }, // ₇
+    { 7, 8, 8, 0, 8, 8, 16188 }, // ₈
+    { 7, 8, 8, 0, 8, 8, 16196 }, // ₉
+    { 12, 14, 12, 0, 14, 28, 16204 }, // €
+    { 12, 15, 12, 0, 15, 30, 16232 }, // ₮
+    { 12, 15, 12, 0, 15, 30, 16262 }, // ₴
+    { 11, 15, 12, 1, 15, 30, 16292 }, // ₹
+    { 12, 16, 12, 0, 16, 32, 16322 }, // ∂
+    { 14, 15, 14, 0, 15, 30, 16354 }, // ∆
+    { 12, 17, 15, 1, 15, 34, 16384 }, // ∏
+    { 11, 17, 11, 0, 15, 34, 16418 }, // ∑
+    { 10, 2, 12, 1, 7, 4, 16452 }, // −
+    { 11, 15, 3, -4, 15, 30, 16456 }, // ∕
+    { 3, 3, 5, 1, 8, 3, 16486 }, // ∙
+    { 13, 17, 12, 0, 16, 34, 16489 }, // √
+    { 12, 6, 12, 0, 9, 12, 16523 }, // ∞
+    { 8, 20, 8, 0, 16, 20, 16535 }, // ∫
+    { 11, 8, 12, 0, 10, 16, 16555 }, // ≈
+    { 10, 13, 12, 1, 13, 26, 16571 }, // ≠
+    { 10, 12, 12, 1, 12, 24, 16597 }, // ≤
+    { 10, 12, 12, 1, 12, 24, 16621 }, // ≥
 };
 
 static const EpdUnicodeInterval ubuntu_10_regularIntervals[] = {
@@ -1427,6 +1687,19 @@ static const EpdUnicodeInterval ubuntu_10_regularIntervals[] = {
     { 0x2264, 0x2265, 0x24D },
 };
 
+static const EpdFontMetrics ubuntu_10_regularMetrics = {
+    10, 26, 5,
+    -4, 25, 20, -4,
+    {
+        5, 6, 9, 14, 12, 18, 14, 5, 7, 7, 10, 12, 5, 6, 5, 8,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 12, 12, 12, 8,
+        20, 14, 14, 13, 15, 12, 11, 14, 15, 6, 11, 13, 11, 18, 15, 16,
+        13, 16, 13, 11, 12, 14, 14, 20, 13, 13, 12, 7, 8, 7, 12, 10,
+        8, 11, 12, 10, 12, 12, 8, 12, 12, 5, 5, 11, 6, 18, 12, 12,
+        12, 12, 8, 9, 8, 12, 11, 16, 11, 10, 10, 7, 6, 7, 12,
+    },
+};
+
 static const EpdFontData ubuntu_10_regular = {
     ubuntu_10_regularBitmaps,
     ubuntu_10_regularGlyphs,
@@ -1436,4 +1709,9 @@ static const EpdFontData ubuntu_10_regular = {
     20,
     -4,
     false,
+    nullptr,
+    &ubuntu_10_regularMetrics,
+    nullptr,
+    0,
+    true,
 };
@@ -2,1190 +2,1440 @@
  * generated by fontconvert.py
  * name: ubuntu_12_bold
  * size: 12
- * mode: 1-bit
- * Command used: fontconvert.py ubuntu_12_bold 12 ../builtinFonts/source/Ubuntu/Ubuntu-Bold.ttf
+ * mode: 1-bit, row-aligned
+ * Command used: fontconvert.py ubuntu_12_bold 12 ../builtinFonts/source/Ubuntu/Ubuntu-Bold.ttf --row-aligned --no-kerning
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t ubuntu_12_boldBitmaps[18832] = {
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xDC, 0x07, 0x7F, 0xFF, 0x70, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF,
-    0xF3, 0xFC, 0xEF, 0x38, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0xFF, 0xFE, 0xFF, 0xFE,
-    0xFF, 0xFE, 0x1E, 0x78, 0x1E, 0x78, 0x3C, 0x78, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0x3C, 0xF0,
-    0x78, 0xF0, 0x79, 0xE0, 0x79, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x07, 0xFC, 0x3F, 0xF8, 0xFF,
-    0xC7, 0xE7, 0x1F, 0x00, 0x7C, 0x01, 0xFE, 0x03, 0xFE, 0x0F, 0xFC, 0x0F, 0xF8, 0x07, 0xE0, 0x07,
-    0x80, 0x1E, 0x78, 0xF9, 0xFF, 0xE7, 0xFF, 0x0F, 0xF8, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x00, 0x3F,
-    0x03, 0xC0, 0xFF, 0x0F, 0x81, 0xEF, 0x1E, 0x03, 0x9E, 0x78, 0x07, 0x1C, 0xF0, 0x0E, 0x7B, 0xC0,
-    0x1E, 0xFF, 0x80, 0x3F, 0xDE, 0x00, 0x3F, 0x7D, 0xF8, 0x00, 0xF7, 0xF8, 0x03, 0xDE, 0xF0, 0x07,
-    0xBC, 0xE0, 0x1E, 0x71, 0xC0, 0x7C, 0xF3, 0x80, 0xF1, 0xEF, 0x03, 0xE1, 0xFE, 0x07, 0x81, 0xF8,
-    0x0F, 0xE0, 0x07, 0xFC, 0x01, 0xFF, 0x80, 0xFB, 0xE0, 0x3C, 0x78, 0x07, 0xBC, 0x01, 0xFF, 0x00,
-    0x7F, 0x80, 0x3F, 0xCF, 0x1F, 0xFB, 0xC7, 0x9F, 0xF1, 0xE3, 0xFC, 0x78, 0x7E, 0x1F, 0x1F, 0x87,
-    0xFF, 0xF0, 0xFF, 0xFE, 0x1F, 0xE7, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0x0E, 0x0F, 0x1F, 0x1E, 0x3E,
-    0x3C, 0x7C, 0x7C, 0x78, 0x78, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x78, 0x78, 0x7C, 0x7C, 0x3C, 0x3E,
-    0x1E, 0x1F, 0x0F, 0x0E, 0x60, 0xF0, 0xF8, 0x78, 0x7C, 0x3C, 0x3E, 0x3E, 0x1E, 0x1E, 0x1E, 0x1E,
-    0x1F, 0x1E, 0x1E, 0x1E, 0x1E, 0x3E, 0x3E, 0x3C, 0x7C, 0x78, 0xF8, 0xF0, 0x60, 0x1E, 0x03, 0xC3,
-    0xBB, 0x7F, 0xEF, 0xFF, 0xFF, 0x8F, 0xE3, 0xFE, 0x7B, 0xC6, 0x60, 0x0F, 0x00, 0xF0, 0x0F, 0x00,
-    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0x7D, 0xF7, 0xDE, 0x79,
-    0xEF, 0x3C, 0xFF, 0xFF, 0xFF, 0x79, 0xFF, 0xDF, 0x78, 0x00, 0xF8, 0x07, 0x80, 0x3C, 0x03, 0xE0,
-    0x1E, 0x00, 0xF0, 0x0F, 0x80, 0x78, 0x03, 0xC0, 0x3E, 0x01, 0xE0, 0x0F, 0x00, 0xF8, 0x07, 0x80,
-    0x3C, 0x03, 0xE0, 0x1E, 0x00, 0xF0, 0x0F, 0x80, 0x78, 0x03, 0xC0, 0x3E, 0x01, 0xE0, 0x0F, 0x00,
-    0xF8, 0x00, 0x0F, 0xC0, 0x7F, 0x83, 0xFF, 0x1F, 0xBE, 0x7C, 0x79, 0xE1, 0xE7, 0x87, 0xDE, 0x1F,
-    0xF8, 0x7D, 0xE1, 0xF7, 0x87, 0xDE, 0x1E, 0x7C, 0x79, 0xFB, 0xE3, 0xFF, 0x07, 0xFC, 0x0F, 0xC0,
-    0x07, 0x87, 0xE7, 0xF9, 0xFE, 0x7F, 0x9D, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07,
-    0x81, 0xE0, 0x78, 0x1E, 0x07, 0x80, 0x1F, 0xC3, 0xFF, 0x9F, 0xFC, 0xFB, 0xF3, 0x0F, 0x80, 0x7C,
-    0x03, 0xC0, 0x3E, 0x03, 0xE0, 0x7E, 0x07, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x01, 0xFF, 0xEF, 0xFF,
-    0x7F, 0xF8, 0x3F, 0xC3, 0xFF, 0x1F, 0xFC, 0x73, 0xE0, 0x0F, 0x00, 0xF8, 0x7F, 0xC3, 0xFC, 0x1F,
-    0xF0, 0x1F, 0x80, 0x3E, 0x01, 0xF0, 0x0F, 0xB8, 0xFD, 0xFF, 0xDF, 0xFC, 0x7F, 0xC0, 0x01, 0xF0,
-    0x0F, 0xC0, 0x7F, 0x01, 0xFC, 0x0F, 0xF0, 0x7F, 0xC3, 0xEF, 0x0F, 0x3C, 0x78, 0xF1, 0xE3, 0xCF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x3F, 0xF1, 0xFF, 0x8F,
-    0xFC, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xFF, 0x07, 0xFC, 0x3F, 0xF0, 0x3F, 0xC0, 0x3E, 0x00, 0xF0,
-    0x0F, 0xB8, 0xFD, 0xFF, 0xCF, 0xFC, 0x7F, 0xC0, 0x01, 0xF0, 0x1F, 0xC0, 0xFF, 0x87, 0xF8, 0x3E,
-    0x01, 0xF0, 0x07, 0xFE, 0x1F, 0xFC, 0x7F, 0xF9, 0xF3, 0xE7, 0x87, 0xDE, 0x1F, 0x78, 0x7D, 0xFB,
-    0xE3, 0xFF, 0x8F, 0xFC, 0x0F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xE0, 0x3E, 0x01, 0xF0,
-    0x1F, 0x00, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x00, 0x78, 0x07, 0xC0,
-    0x3E, 0x00, 0x0F, 0xE0, 0xFF, 0xC3, 0xFF, 0x9F, 0x3E, 0x78, 0x79, 0xF1, 0xE7, 0xCF, 0x8F, 0xFC,
-    0x1F, 0xE0, 0xFF, 0xC7, 0xFF, 0x9E, 0x1F, 0x78, 0x7D, 0xF3, 0xE7, 0xFF, 0x8F, 0xFC, 0x1F, 0xE0,
-    0x1F, 0xC0, 0xFF, 0xC7, 0xFF, 0x1F, 0x7E, 0xF8, 0x7B, 0xE1, 0xEF, 0x87, 0x9F, 0x3E, 0x7F, 0xF8,
-    0xFF, 0xE1, 0xFF, 0x80, 0x3E, 0x01, 0xF0, 0x3F, 0xC3, 0xFE, 0x0F, 0xF0, 0x3F, 0x00, 0x79, 0xFF,
-    0xDF, 0x78, 0x00, 0x00, 0x01, 0xE7, 0xFF, 0x7D, 0xE0, 0x79, 0xFF, 0xDF, 0x78, 0x00, 0x00, 0x00,
-    0x07, 0xDF, 0x7D, 0xE7, 0x9E, 0xF3, 0xC0, 0x00, 0xF0, 0x7F, 0x3F, 0xFF, 0xFF, 0xFF, 0xEF, 0xF0,
-    0xF8, 0x0F, 0xF0, 0xFF, 0xEF, 0xFF, 0x3F, 0xF0, 0x7F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x0F, 0xE0, 0xFF, 0xCF, 0xFF, 0x7F, 0xF0, 0xFF,
-    0x01, 0xF0, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xCF, 0xE0, 0x70, 0x00, 0x7F, 0x9F, 0xF9, 0xFF, 0xB9,
-    0xF0, 0x3E, 0x07, 0xC0, 0xF8, 0x3E, 0x0F, 0x83, 0xF0, 0x7C, 0x0F, 0x01, 0xE0, 0x00, 0x07, 0x80,
-    0xF8, 0x3F, 0x03, 0xE0, 0x78, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0xFE,
-    0x3F, 0x83, 0xE0, 0x0F, 0x8F, 0x80, 0x0F, 0x9E, 0x3F, 0xCF, 0x78, 0xFF, 0xCE, 0xF3, 0xFF, 0x9D,
-    0xEF, 0xDF, 0x3B, 0xDE, 0x1E, 0x77, 0xBC, 0x3C, 0xEF, 0x78, 0x7B, 0xDE, 0xFD, 0xF7, 0xBC, 0xFF,
-    0xFE, 0x3D, 0xFF, 0xFC, 0x7C, 0xFF, 0xF0, 0x7C, 0x00, 0x00, 0xFF, 0x0C, 0x00, 0xFF, 0xFC, 0x00,
-    0x7F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0xE0, 0x07,
-    0xF8, 0x03, 0xFF, 0x00, 0xF3, 0xC0, 0x7C, 0xF8, 0x1E, 0x3E, 0x07, 0x87, 0x83, 0xFF, 0xF0, 0xFF,
-    0xFC, 0x3F, 0xFF, 0x9F, 0x03, 0xE7, 0xC0, 0xFB, 0xE0, 0x1F, 0xF8, 0x07, 0xC0, 0xFF, 0xC3, 0xFF,
-    0xCF, 0xFF, 0xBC, 0x7E, 0xF0, 0x7B, 0xC1, 0xEF, 0x1F, 0xBF, 0xFC, 0xFF, 0xF3, 0xFF, 0xEF, 0x0F,
-    0xFC, 0x1F, 0xF0, 0x7F, 0xC7, 0xFF, 0xFF, 0xBF, 0xFE, 0xFF, 0xE0, 0x07, 0xFC, 0x3F, 0xFC, 0xFF,
-    0xF3, 0xF8, 0xE7, 0xC0, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07,
-    0xC0, 0x07, 0xC0, 0x0F, 0xE3, 0x8F, 0xFF, 0x8F, 0xFF, 0x0F, 0xFC, 0xFF, 0xC0, 0xFF, 0xF0, 0xFF,
-    0xF8, 0xF1, 0xFC, 0xF0, 0x7E, 0xF0, 0x3E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1F, 0xF0, 0x1E, 0xF0,
-    0x3E, 0xF0, 0x3E, 0xF0, 0x7E, 0xF1, 0xFC, 0xFF, 0xF8, 0xFF, 0xF0, 0xFF, 0xC0, 0xFF, 0xF7, 0xFF,
-    0xBF, 0xFD, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1F, 0xFC, 0xFF, 0xE7, 0xFF, 0x3C, 0x01, 0xE0,
-    0x0F, 0x00, 0x78, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF0,
-    0x0F, 0x00, 0xF0, 0x0F, 0xFE, 0xFF, 0xEF, 0xFE, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
-    0x00, 0xF0, 0x00, 0x07, 0xFC, 0x3F, 0xFC, 0xFF, 0xFB, 0xF8, 0xE7, 0xC0, 0x1F, 0x00, 0x3E, 0x00,
-    0x7C, 0x00, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xF7, 0xC1, 0xEF, 0xE3, 0xCF, 0xFF, 0x8F,
-    0xFF, 0x07, 0xFE, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8,
-    0x1F, 0xF0, 0x3E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xF0, 0x1F, 0x01,
-    0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF7,
-    0x3E, 0xFF, 0xEF, 0xFC, 0x7F, 0x80, 0xF0, 0x7D, 0xE1, 0xF3, 0xC7, 0xE7, 0x9F, 0x8F, 0x7E, 0x1F,
-    0xF8, 0x3F, 0xE0, 0x7F, 0x80, 0xFF, 0x01, 0xFF, 0x03, 0xFF, 0x07, 0xBF, 0x0F, 0x3F, 0x1E, 0x3F,
-    0x3C, 0x3E, 0x78, 0x3E, 0xF0, 0x7E, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
-    0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x7C, 0x03, 0xE7, 0xE0, 0x3E, 0x7E, 0x07, 0xE7, 0xF0, 0x7E, 0x7F, 0x0F, 0xE7, 0xF8, 0xFF, 0x7F,
-    0x9F, 0xF7, 0xFD, 0xFF, 0x7B, 0xDF, 0xF7, 0xBF, 0xDF, 0x79, 0xFD, 0xFF, 0x9F, 0x8F, 0xF9, 0xF8,
-    0xFF, 0x8F, 0x8F, 0xF8, 0xF0, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xF0, 0xF0, 0x1F, 0xF0, 0x3F, 0xF0,
-    0x7F, 0xF0, 0xFF, 0xF1, 0xFF, 0xE3, 0xFF, 0xE7, 0xFB, 0xEF, 0xF7, 0xDF, 0xE7, 0xFF, 0xC7, 0xFF,
-    0x87, 0xFF, 0x0F, 0xFE, 0x0F, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x1E, 0x07, 0xF8, 0x07, 0xFF, 0x83,
-    0xFF, 0xF1, 0xFC, 0xFC, 0x7C, 0x0F, 0xBE, 0x03, 0xEF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE,
-    0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x3E, 0x7C, 0x0F, 0x9F, 0xCF, 0xE3, 0xFF, 0xF0, 0x7F, 0xF8, 0x07,
-    0xF8, 0x00, 0xFF, 0xC3, 0xFF, 0xCF, 0xFF, 0xBC, 0x7E, 0xF0, 0x7B, 0xC1, 0xFF, 0x07, 0xBC, 0x7E,
-    0xFF, 0xFB, 0xFF, 0xCF, 0xFC, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x00,
-    0x07, 0xF8, 0x07, 0xFF, 0x83, 0xFF, 0xF1, 0xFC, 0xFC, 0x7C, 0x0F, 0xBE, 0x03, 0xEF, 0x80, 0x7F,
-    0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x3E, 0x7C, 0x0F, 0x9F, 0xCF, 0xE3,
-    0xFF, 0xF0, 0x7F, 0xF8, 0x0F, 0xF8, 0x00, 0x7C, 0x00, 0x0F, 0xE0, 0x03, 0xFE, 0x00, 0x7F, 0x00,
-    0x07, 0xC0, 0xFF, 0xC1, 0xFF, 0xE3, 0xFF, 0xE7, 0x8F, 0xCF, 0x0F, 0x9E, 0x0F, 0x3C, 0x3E, 0x78,
-    0xFC, 0xFF, 0xF9, 0xFF, 0xE3, 0xFF, 0x87, 0x9F, 0x0F, 0x1F, 0x1E, 0x3F, 0x3C, 0x3E, 0x78, 0x7E,
-    0xF0, 0x7C, 0x0F, 0xF0, 0xFF, 0xE7, 0xFF, 0x9F, 0x9C, 0x7C, 0x01, 0xF0, 0x07, 0xF8, 0x0F, 0xF8,
-    0x1F, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x1F, 0x00, 0x7D, 0xE3, 0xF7, 0xFF, 0x9F, 0xFE, 0x3F, 0xE0,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07,
-    0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0,
-    0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8,
-    0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xF7, 0xC3, 0xEF, 0xCF, 0xDF, 0xFF, 0x1F, 0xFC, 0x0F, 0xF0,
-    0xF8, 0x07, 0xFF, 0x01, 0xF7, 0xC0, 0xF9, 0xF0, 0x3E, 0x3E, 0x0F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0,
-    0x7C, 0x78, 0x1F, 0x3E, 0x03, 0xCF, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x07, 0xF8, 0x01, 0xFE, 0x00,
-    0x3F, 0x00, 0x0F, 0xC0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x1E, 0xF8, 0x00, 0x1E, 0x7C, 0x3C, 0x3E,
+static const uint8_t ubuntu_12_boldBitmaps[22827] = {
+    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x78, 0x70, 0x00, 0x70, 0xF8, 0xF8, 0xF8,
+    0x70, 0xF7, 0xC0, 0xF7, 0xC0, 0xF7, 0xC0, 0xF7, 0xC0, 0xF3, 0xC0, 0xF3, 0x80, 0xF3, 0x80, 0x0F,
+    0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0x1E, 0x78, 0x1E,
+    0x78, 0x3C, 0x78, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0x3C, 0xF0, 0x78, 0xF0, 0x79, 0xE0, 0x79,
+    0xE0, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x1F, 0xF0, 0x3F, 0xF8, 0x3F, 0xF0, 0x7E, 0x70, 0x7C,
+    0x00, 0x7C, 0x00, 0x7F, 0x80, 0x3F, 0xE0, 0x3F, 0xF0, 0x0F, 0xF8, 0x01, 0xF8, 0x00, 0x78, 0x00,
+    0x78, 0x78, 0xF8, 0x7F, 0xF8, 0x7F, 0xF0, 0x3F, 0xE0, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x3F,
+    0x03, 0xC0, 0x7F, 0x87, 0xC0, 0x7B, 0xC7, 0x80, 0x73, 0xCF, 0x00, 0x71, 0xCF, 0x00, 0x73, 0xDE,
+    0x00, 0x7B, 0xFE, 0x00, 0x7F, 0xBC, 0x00, 0x3F, 0x7D, 0xF8, 0x00, 0x7B, 0xFC, 0x00, 0xF7, 0xBC,
+    0x00, 0xF7, 0x9C, 0x01, 0xE7, 0x1C, 0x03, 0xE7, 0x9C, 0x03, 0xC7, 0xBC, 0x07, 0xC3, 0xFC, 0x07,
+    0x81, 0xF8, 0x0F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3C, 0x78,
+    0x00, 0x1E, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xCF, 0x00, 0x7F, 0xEF, 0x00,
+    0x79, 0xFF, 0x00, 0x78, 0xFF, 0x00, 0x78, 0x7E, 0x00, 0x7C, 0x7E, 0x00, 0x7F, 0xFF, 0x00, 0x3F,
+    0xFF, 0x80, 0x1F, 0xE7, 0x80, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x0E, 0x0F, 0x1F, 0x1E,
+    0x3E, 0x3C, 0x7C, 0x7C, 0x78, 0x78, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x78, 0x78, 0x7C, 0x7C, 0x3C,
+    0x3E, 0x1E, 0x1F, 0x0F, 0x0E, 0x60, 0xF0, 0xF8, 0x78, 0x7C, 0x3C, 0x3E, 0x3E, 0x1E, 0x1E, 0x1E,
+    0x1E, 0x1F, 0x1E, 0x1E, 0x1E, 0x1E, 0x3E, 0x3E, 0x3C, 0x7C, 0x78, 0xF8, 0xF0, 0x60, 0x1E, 0x00,
+    0x1E, 0x00, 0xEE, 0xC0, 0xFF, 0xC0, 0xFF, 0xE0, 0xFF, 0xC0, 0x3F, 0x80, 0x7F, 0xC0, 0x7B, 0xC0,
+    0x33, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0,
+    0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x7C, 0x7C, 0x7C, 0x78, 0x78, 0x78, 0xF0, 0xF0,
+    0xFF, 0xFF, 0xFF, 0x78, 0x7C, 0xFC, 0x7C, 0x78, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0xF0, 0x01, 0xF0,
+    0x01, 0xE0, 0x01, 0xE0, 0x03, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0xC0, 0x07, 0x80, 0x07, 0x80,
+    0x0F, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0x3C, 0x00,
+    0x3C, 0x00, 0x7C, 0x00, 0x78, 0x00, 0x78, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x3F, 0xF0,
+    0x7E, 0xF8, 0x7C, 0x78, 0x78, 0x78, 0x78, 0x7C, 0x78, 0x7C, 0xF8, 0x7C, 0x78, 0x7C, 0x78, 0x7C,
+    0x78, 0x78, 0x7C, 0x78, 0x7E, 0xF8, 0x3F, 0xF0, 0x1F, 0xF0, 0x0F, 0xC0, 0x07, 0x80, 0x1F, 0x80,
+    0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x77, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80,
+    0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x1F, 0xC0,
+    0x7F, 0xF0, 0x7F, 0xF0, 0x7D, 0xF8, 0x30, 0xF8, 0x00, 0xF8, 0x00, 0xF0, 0x01, 0xF0, 0x03, 0xE0,
+    0x0F, 0xC0, 0x1F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x7F, 0xF8, 0x7F, 0xF8, 0x7F, 0xF8,
+    0x3F, 0xC0, 0x7F, 0xE0, 0x7F, 0xF0, 0x39, 0xF0, 0x00, 0xF0, 0x01, 0xF0, 0x1F, 0xF0, 0x1F, 0xE0,
+    0x1F, 0xF0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x71, 0xF8, 0x7F, 0xF0, 0xFF, 0xE0,
+    0x7F, 0xC0, 0x01, 0xF0, 0x03, 0xF0, 0x07, 0xF0, 0x07, 0xF0, 0x0F, 0xF0, 0x1F, 0xF0, 0x3E, 0xF0,
+    0x3C, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00,
+    0x3F, 0xC0, 0x3F, 0xE0, 0x3F, 0xF0, 0x07, 0xF8, 0x00, 0xF8, 0x00, 0x78, 0x00, 0xF8, 0x71, 0xF8,
+    0x7F, 0xF0, 0x7F, 0xE0, 0x7F, 0xC0, 0x01, 0xF0, 0x07, 0xF0, 0x0F, 0xF8, 0x1F, 0xE0, 0x3E, 0x00,
+    0x7C, 0x00, 0x7F, 0xE0, 0x7F, 0xF0, 0x7F, 0xF8, 0x7C, 0xF8, 0x78, 0x7C, 0x78, 0x7C, 0x78, 0x7C,
+    0x7E, 0xF8, 0x3F, 0xF8, 0x3F, 0xF0, 0x0F, 0xE0, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x01, 0xF0,
+    0x03, 0xE0, 0x03, 0xE0, 0x07, 0xC0, 0x07, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x00, 0x1F, 0x00,
+    0x1F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x3F, 0xF8,
+    0x7C, 0xF8, 0x78, 0x78, 0x7C, 0x78, 0x7C, 0xF8, 0x3F, 0xF0, 0x1F, 0xE0, 0x3F, 0xF0, 0x7F, 0xF8,
+    0x78, 0x7C, 0x78, 0x7C, 0x7C, 0xF8, 0x7F, 0xF8, 0x3F, 0xF0, 0x1F, 0xE0, 0x1F, 0xC0, 0x3F, 0xF0,
+    0x7F, 0xF0, 0x7D, 0xF8, 0xF8, 0x78, 0xF8, 0x78, 0xF8, 0x78, 0x7C, 0xF8, 0x7F, 0xF8, 0x3F, 0xF8,
+    0x1F, 0xF8, 0x00, 0xF8, 0x01, 0xF0, 0x0F, 0xF0, 0x3F, 0xE0, 0x3F, 0xC0, 0x3F, 0x00, 0x78, 0x7C,
+    0xFC, 0x7C, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x7C, 0xFC, 0x7C, 0x78, 0x78, 0x7C, 0xFC, 0x7C,
+    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x7C, 0x78, 0x78, 0x78, 0xF0, 0xF0, 0x00, 0xF0,
+    0x07, 0xF0, 0x3F, 0xF0, 0xFF, 0xF0, 0xFF, 0xE0, 0xFF, 0x00, 0xF8, 0x00, 0xFF, 0x00, 0xFF, 0xE0,
+    0xFF, 0xF0, 0x3F, 0xF0, 0x07, 0xF0, 0x00, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x70, 0x00, 0xFE, 0x00, 0xFF, 0xC0, 0xFF, 0xF0,
+    0x7F, 0xF0, 0x0F, 0xF0, 0x01, 0xF0, 0x0F, 0xF0, 0x7F, 0xF0, 0xFF, 0xF0, 0xFF, 0xC0, 0xFE, 0x00,
+    0x70, 0x00, 0x7F, 0x80, 0xFF, 0xC0, 0x7F, 0xE0, 0x73, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
+    0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x80, 0x1F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00,
+    0x1F, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0x1E, 0x00, 0x01, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x0F, 0xFF,
+    0xF0, 0x1F, 0xC7, 0xF0, 0x3E, 0x00, 0xF8, 0x7C, 0x00, 0x7C, 0x78, 0xFF, 0x3C, 0xF1, 0xFF, 0x9C,
+    0xF3, 0xFF, 0x9C, 0xF7, 0xEF, 0x9C, 0xF7, 0x87, 0x9C, 0xF7, 0x87, 0x9C, 0xF7, 0x87, 0xBC, 0xF7,
+    0xEF, 0xBC, 0xF3, 0xFF, 0xF8, 0x7B, 0xFF, 0xF8, 0x7C, 0xFF, 0xF0, 0x3E, 0x00, 0x00, 0x3F, 0xC3,
+    0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xE0, 0x00, 0x03, 0xF0, 0x00,
+    0x03, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0x3C, 0x00, 0x1F,
+    0x3E, 0x00, 0x1E, 0x3E, 0x00, 0x1E, 0x1E, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF,
+    0x80, 0x7C, 0x0F, 0x80, 0x7C, 0x0F, 0x80, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xFF, 0xC0, 0xFF,
+    0xF0, 0xFF, 0xF8, 0xF1, 0xF8, 0xF0, 0x78, 0xF0, 0x78, 0xF1, 0xF8, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF,
+    0xF8, 0xF0, 0xFC, 0xF0, 0x7C, 0xF0, 0x7C, 0xF1, 0xFC, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xE0, 0x07,
+    0xFC, 0x1F, 0xFE, 0x3F, 0xFC, 0x7F, 0x1C, 0x7C, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x7F, 0x1C, 0x3F, 0xFE, 0x1F, 0xFE, 0x0F,
+    0xFC, 0xFF, 0xC0, 0xFF, 0xF0, 0xFF, 0xF8, 0xF1, 0xFC, 0xF0, 0x7E, 0xF0, 0x3E, 0xF0, 0x1E, 0xF0,
+    0x1E, 0xF0, 0x1F, 0xF0, 0x1E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x7E, 0xF1, 0xFC, 0xFF, 0xF8, 0xFF,
+    0xF0, 0xFF, 0xC0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF,
+    0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x07, 0xFC, 0x1F, 0xFE, 0x3F, 0xFE, 0x7F, 0x1C, 0x7C,
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0x7C,
+    0x1E, 0x7F, 0x1E, 0x3F, 0xFE, 0x1F, 0xFE, 0x07, 0xFE, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0,
+    0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xF0, 0x3E, 0xF0,
+    0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x01, 0xF0, 0x01, 0xF0,
+    0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0,
+    0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x73, 0xE0, 0xFF, 0xE0, 0xFF, 0xC0, 0x7F, 0x80, 0xF0, 0x7C,
+    0xF0, 0xF8, 0xF1, 0xF8, 0xF3, 0xF0, 0xF7, 0xE0, 0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x80, 0xFF, 0xC0, 0xF7, 0xE0, 0xF3, 0xF0, 0xF1, 0xF8, 0xF0, 0xF8, 0xF0, 0x7C, 0xF0, 0x7E,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0,
+    0xFF, 0xF0, 0x7C, 0x03, 0xE0, 0x7E, 0x03, 0xE0, 0x7E, 0x07, 0xE0, 0x7F, 0x07, 0xE0, 0x7F, 0x0F,
+    0xE0, 0x7F, 0x8F, 0xF0, 0x7F, 0x9F, 0xF0, 0x7F, 0xDF, 0xF0, 0x7B, 0xDF, 0xF0, 0x7B, 0xFD, 0xF0,
+    0x79, 0xFD, 0xF0, 0xF9, 0xF8, 0xF0, 0xF9, 0xF8, 0xF0, 0xF8, 0xF8, 0xF0, 0xF8, 0xF0, 0xF0, 0xF8,
+    0x00, 0xF0, 0xF8, 0x00, 0xF0, 0xF0, 0x1E, 0xF8, 0x1E, 0xFC, 0x1E, 0xFE, 0x1E, 0xFF, 0x1E, 0xFF,
+    0x1E, 0xFF, 0x9E, 0xF7, 0xDE, 0xF7, 0xDE, 0xF3, 0xFE, 0xF1, 0xFE, 0xF0, 0xFE, 0xF0, 0xFE, 0xF0,
+    0x7E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x1E, 0x07, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFF, 0x00,
+    0x7F, 0x3F, 0x00, 0x7C, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8,
+    0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x0F, 0x80, 0x7C, 0x0F, 0x80, 0x7F, 0x3F,
+    0x80, 0x3F, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0xFF, 0xF8,
+    0xF1, 0xF8, 0xF0, 0x78, 0xF0, 0x7C, 0xF0, 0x78, 0xF1, 0xF8, 0xFF, 0xF8, 0xFF, 0xF0, 0xFF, 0xC0,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x1F,
+    0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0x3F, 0x00, 0x7C, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x07,
+    0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x0F, 0x80,
+    0x7C, 0x0F, 0x80, 0x7F, 0x3F, 0x80, 0x3F, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x01,
+    0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x00, 0xFF, 0xC0,
+    0xFF, 0xF0, 0xFF, 0xF8, 0xF1, 0xF8, 0xF0, 0xF8, 0xF0, 0x78, 0xF0, 0xF8, 0xF1, 0xF8, 0xFF, 0xF8,
+    0xFF, 0xF0, 0xFF, 0xE0, 0xF3, 0xE0, 0xF1, 0xF0, 0xF1, 0xF8, 0xF0, 0xF8, 0xF0, 0xFC, 0xF0, 0x7C,
+    0x0F, 0xF0, 0x3F, 0xF8, 0x7F, 0xF8, 0x7E, 0x70, 0x7C, 0x00, 0x7C, 0x00, 0x7F, 0x80, 0x3F, 0xE0,
+    0x1F, 0xF0, 0x0F, 0xF8, 0x01, 0xFC, 0x00, 0x7C, 0x00, 0x7C, 0x78, 0xFC, 0x7F, 0xF8, 0x7F, 0xF8,
+    0x3F, 0xE0, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0,
+    0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0,
+    0x07, 0xC0, 0x07, 0xC0, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E,
+    0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0x7C, 0x3E, 0x7E, 0x7E,
+    0x7F, 0xFC, 0x3F, 0xF8, 0x0F, 0xF0, 0xF8, 0x07, 0xC0, 0xFC, 0x07, 0xC0, 0x7C, 0x0F, 0x80, 0x7C,
+    0x0F, 0x80, 0x3E, 0x0F, 0x00, 0x3E, 0x1F, 0x00, 0x3E, 0x1F, 0x00, 0x1F, 0x1E, 0x00, 0x1F, 0x3E,
+    0x00, 0x0F, 0x3C, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00,
+    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x1E, 0xF8, 0x00, 0x1E, 0x7C,
+    0x3C, 0x3E, 0x7C, 0x7C, 0x3E, 0x7C, 0x7E, 0x3E, 0x7C, 0x7E, 0x3C, 0x3C, 0x7E, 0x3C, 0x3E, 0xFF,
+    0x7C, 0x3E, 0xFF, 0x7C, 0x3E, 0xEF, 0x78, 0x1F, 0xE7, 0xF8, 0x1F, 0xE7, 0xF8, 0x1F, 0xC7, 0xF0,
+    0x1F, 0xC3, 0xF0, 0x0F, 0xC3, 0xF0, 0x0F, 0x83, 0xF0, 0x0F, 0x81, 0xE0, 0xFC, 0x1F, 0x00, 0x7E,
+    0x3F, 0x00, 0x3E, 0x3E, 0x00, 0x3F, 0x7C, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF0,
+    0x00, 0x07, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xFC, 0x00,
+    0x1F, 0x7C, 0x00, 0x3E, 0x7E, 0x00, 0x7E, 0x3F, 0x00, 0x7C, 0x1F, 0x00, 0xF8, 0x1F, 0x80, 0xF8,
+    0x1F, 0x80, 0x7C, 0x1F, 0x00, 0x7C, 0x3E, 0x00, 0x3E, 0x3E, 0x00, 0x3E, 0x7C, 0x00, 0x1F, 0x7C,
+    0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xE0, 0x00,
+    0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03,
+    0xE0, 0x00, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFC, 0x00, 0xFC, 0x01, 0xF8, 0x01, 0xF0, 0x03, 0xE0,
+    0x07, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x7F, 0xFE,
+    0xFF, 0xFE, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFE, 0xFE, 0xFE, 0xF8, 0x00, 0xF8,
+    0x00, 0x78, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x1E, 0x00, 0x1F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0xC0, 0x03, 0xC0, 0x03,
+    0xC0, 0x03, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0xFE,
+    0xFE, 0xFE, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+    0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0xFE, 0xFE, 0xFE, 0x07, 0x80, 0x0F, 0xC0, 0x0F, 0xE0, 0x1F, 0xE0,
+    0x3F, 0xF0, 0x3E, 0xF0, 0x7C, 0xF8, 0x78, 0x7C, 0xF8, 0x7C, 0x30, 0x30, 0xFF, 0xF8, 0xFF, 0xF8,
+    0xFF, 0xF8, 0x30, 0x78, 0x78, 0x3C, 0x1C, 0x0C, 0x3F, 0xC0, 0x3F, 0xF0, 0x3F, 0xF0, 0x31, 0xF0,
+    0x00, 0xF8, 0x1F, 0xF8, 0x7F, 0xF8, 0x7F, 0xF8, 0x7C, 0xF8, 0x7C, 0xF8, 0x7F, 0xF8, 0x7F, 0xF8,
+    0x3F, 0xF0, 0x78, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0xC0,
+    0xFF, 0xF0, 0xFF, 0xF0, 0xFD, 0xF8, 0xF8, 0xF8, 0xF8, 0x78, 0xF8, 0x78, 0xF8, 0x78, 0xF8, 0xF8,
+    0xF9, 0xF8, 0xFF, 0xF0, 0xFF, 0xE0, 0x7F, 0xC0, 0x1F, 0xE0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFC, 0xC0,
+    0xF8, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0xFC, 0x60, 0x7F, 0xE0, 0x3F, 0xE0,
+    0x1F, 0xE0, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x1F, 0xF8,
+    0x7F, 0xF8, 0x7F, 0xF8, 0xFD, 0xF8, 0xF8, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF8, 0xF8,
+    0xFC, 0xF8, 0x7F, 0xF8, 0x3F, 0xF8, 0x1F, 0xF0, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFD, 0xF0,
+    0xF8, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xF8, 0x00, 0xFC, 0x70, 0x7F, 0xF0, 0x3F, 0xF0,
+    0x1F, 0xF0, 0x1F, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0x7C, 0x80, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0x80,
+    0xFF, 0x80, 0xFF, 0x80, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+    0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x1F, 0xF0, 0x3F, 0xF0, 0x7F, 0xF0, 0xFC, 0xF0,
+    0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF0, 0xFD, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0,
+    0x3F, 0xF0, 0x00, 0xF0, 0x71, 0xF0, 0x7F, 0xF0, 0x7F, 0xE0, 0x7F, 0xC0, 0x78, 0x00, 0xF8, 0x00,
+    0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0xC0, 0xFF, 0xE0, 0xFF, 0xF0, 0xF9, 0xF0,
+    0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0,
+    0xF8, 0xF0, 0x78, 0xF8, 0xF8, 0x78, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x0F, 0x1F, 0x1F, 0x0F, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0xFE, 0xFE, 0xFC, 0x78, 0x00, 0xF8,
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0xF8, 0xF9, 0xF0, 0xFB, 0xE0, 0xFF,
+    0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xE0, 0xFB, 0xE0, 0xF9, 0xF0, 0xF8,
+    0xF8, 0xF8, 0xF8, 0x78, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+    0xF8, 0xF8, 0xFC, 0x7E, 0x7E, 0x3C, 0x7F, 0x9F, 0x80, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0xF9,
+    0xFB, 0xE0, 0xF9, 0xF1, 0xE0, 0xF8, 0xF1, 0xE0, 0xF8, 0xF1, 0xE0, 0xF8, 0xF1, 0xE0, 0xF8, 0xF1,
+    0xE0, 0xF8, 0xF1, 0xE0, 0xF8, 0xF1, 0xE0, 0xF8, 0xF1, 0xE0, 0xF8, 0xF1, 0xE0, 0x7F, 0xC0, 0xFF,
+    0xE0, 0xFF, 0xF0, 0xF9, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8,
+    0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFD, 0xF8, 0xF8,
+    0xF8, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF8, 0xF8, 0xFD, 0xF8, 0x7F, 0xF0, 0x3F, 0xE0, 0x1F,
+    0xC0, 0x7F, 0xC0, 0xFF, 0xE0, 0xFF, 0xF0, 0xF9, 0xF8, 0xF8, 0xF8, 0xF8, 0x78, 0xF8, 0x78, 0xF8,
+    0x78, 0xF8, 0xF8, 0xFD, 0xF8, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xC0, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0x1F, 0xF0, 0x3F, 0xF8, 0x7F, 0xF8, 0xFC, 0xF8, 0xF8, 0xF8, 0xF0,
+    0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF8, 0xF8, 0xFC, 0xF8, 0x7F, 0xF8, 0x7F, 0xF8, 0x1F, 0xF8, 0x00,
+    0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x7F, 0xC0, 0xFF, 0x80, 0xFF, 0x80, 0xF9,
+    0x80, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+    0x00, 0xF8, 0x00, 0x1F, 0xE0, 0x3F, 0xE0, 0x7F, 0xC0, 0x7C, 0xC0, 0x7F, 0x00, 0x7F, 0xE0, 0x7F,
+    0xE0, 0x3F, 0xE0, 0x03, 0xE0, 0x71, 0xE0, 0x7F, 0xE0, 0x7F, 0xC0, 0x7F, 0x80, 0xF8, 0x00, 0xF8,
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFC, 0x80, 0x7F, 0x80, 0x7F, 0xC0, 0x3F, 0x80, 0xF8,
+    0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8,
+    0xF0, 0x7C, 0xF0, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0xF8, 0x7C, 0xF8, 0x78, 0x78, 0x78, 0x7C,
+    0xF8, 0x7C, 0xF0, 0x3C, 0xF0, 0x3D, 0xF0, 0x3F, 0xE0, 0x1F, 0xE0, 0x1F, 0xC0, 0x0F, 0xC0, 0x0F,
+    0xC0, 0x07, 0x80, 0xF8, 0xF1, 0xF0, 0xF8, 0xF1, 0xE0, 0x78, 0xF1, 0xE0, 0x79, 0xF3, 0xE0, 0x7D,
+    0xFB, 0xC0, 0x3D, 0xFB, 0xC0, 0x3F, 0xFB, 0xC0, 0x3F, 0xFF, 0x80, 0x1F, 0xBF, 0x80, 0x1F, 0x9F,
+    0x80, 0x1F, 0x9F, 0x00, 0x0F, 0x1F, 0x00, 0x0F, 0x0F, 0x00, 0xF8, 0x78, 0x7C, 0xF8, 0x3F, 0xF0,
+    0x3F, 0xE0, 0x1F, 0xE0, 0x0F, 0xC0, 0x0F, 0x80, 0x0F, 0xC0, 0x1F, 0xE0, 0x3F, 0xF0, 0x7C, 0xF0,
+    0x78, 0xF8, 0xF8, 0x7C, 0xF8, 0x7C, 0xF8, 0x78, 0x78, 0x78, 0x7C, 0xF8, 0x7C, 0xF0, 0x3C, 0xF0,
+    0x3F, 0xF0, 0x3F, 0xE0, 0x1F, 0xE0, 0x1F, 0xE0, 0x0F, 0xC0, 0x0F, 0xC0, 0x07, 0x80, 0x0F, 0x80,
+    0x5F, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x03, 0xE0,
+    0x07, 0xC0, 0x0F, 0x80, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x7F, 0xF0, 0xFF, 0xF0,
+    0xFF, 0xF0, 0x07, 0x80, 0x1F, 0x80, 0x1F, 0x80, 0x1F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
+    0x1E, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x3E, 0x00,
+    0x3E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x1F, 0x80,
+    0x1F, 0x80, 0x07, 0x80, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0x00, 0xFC,
+    0x00, 0xFC, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E,
+    0x00, 0x1F, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x1F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E,
+    0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x3E,
+    0x1C, 0x7F, 0xBC, 0x7F, 0xF8, 0xF7, 0xF8, 0xF1, 0xF0, 0x70, 0xF8, 0xF8, 0xF8, 0x70, 0x00, 0x70,
+    0x78, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x0F, 0x80, 0x0F, 0x80, 0x0F,
+    0x80, 0x1F, 0xE0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFC, 0xC0, 0xF8, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF8,
+    0x00, 0xFC, 0x60, 0x7F, 0xE0, 0x7F, 0xE0, 0x1F, 0xE0, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x07,
+    0xF0, 0x0F, 0xF0, 0x1F, 0xF0, 0x1F, 0x30, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0xFF, 0xE0, 0xFF,
+    0xE0, 0xFF, 0xE0, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3C, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x3F,
+    0xF8, 0x00, 0x00, 0x30, 0x30, 0x7F, 0xF8, 0x7F, 0xFC, 0x3F, 0xF8, 0x3C, 0xF0, 0x3C, 0x78, 0x3C,
+    0x78, 0x3C, 0xF0, 0x3F, 0xF8, 0x7F, 0xFC, 0x7F, 0xF8, 0x30, 0x30, 0x7C, 0x3E, 0x7C, 0x3E, 0x3E,
+    0x3C, 0x3E, 0x7C, 0x1F, 0x78, 0x1F, 0xF8, 0x0F, 0xF0, 0x0F, 0xF0, 0x3F, 0xFC, 0x3F, 0xFC, 0x03,
+    0xC0, 0x03, 0xC0, 0x3F, 0xFC, 0x3F, 0xFC, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x1F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x7C, 0x60, 0x7C, 0x00,
+    0x7F, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0x7B, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x7E, 0xF0,
+    0x7F, 0xF0, 0x3F, 0xE0, 0x1F, 0xE0, 0x07, 0xF0, 0x01, 0xF0, 0x71, 0xF0, 0x7F, 0xF0, 0xFF, 0xE0,
+    0x7F, 0xC0, 0x79, 0xC0, 0x7B, 0xE0, 0x7B, 0xE0, 0x79, 0xC0, 0x07, 0xF8, 0x00, 0x1F, 0xFC, 0x00,
+    0x3F, 0x3F, 0x00, 0x7C, 0x0F, 0x00, 0x7B, 0xF7, 0x80, 0xF7, 0xF3, 0x80, 0xF7, 0xF3, 0xC0, 0xE7,
+    0xB1, 0xC0, 0xEF, 0x01, 0xC0, 0xEF, 0x01, 0xC0, 0xE7, 0xB1, 0xC0, 0xF7, 0xF3, 0xC0, 0xF7, 0xFB,
+    0x80, 0x7B, 0xF7, 0x80, 0x7C, 0x0F, 0x00, 0x3F, 0x3F, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xF8, 0x00,
+    0x7F, 0x00, 0x7F, 0x80, 0x27, 0x80, 0x1F, 0x80, 0x7F, 0x80, 0xFF, 0x80, 0xF3, 0x80, 0xF3, 0x80,
+    0x7F, 0x80, 0x7F, 0x80, 0x00, 0x10, 0x0E, 0x3C, 0x1F, 0x3C, 0x3E, 0x7C, 0x7C, 0xF8, 0x7C, 0xF8,
+    0xF9, 0xF0, 0x7C, 0xF8, 0x7C, 0xF8, 0x3E, 0x7C, 0x1F, 0x3C, 0x0E, 0x3C, 0x08, 0x10, 0xFF, 0xF0,
+    0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0xFF, 0xFF, 0xFF, 0x07, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x3F, 0x00, 0x7C, 0x0F, 0x00, 0x7F,
+    0xF7, 0x80, 0xF7, 0xF3, 0x80, 0xF7, 0x7B, 0xC0, 0xE7, 0x79, 0xC0, 0xE7, 0xF9, 0xC0, 0xE7, 0xF1,
+    0xC0, 0xE7, 0x71, 0xC0, 0xF7, 0x73, 0xC0, 0xF7, 0x3B, 0x80, 0x7F, 0x3F, 0x80, 0x7C, 0x0F, 0x00,
+    0x3F, 0x3F, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0x3E,
+    0x00, 0x7F, 0x00, 0xF7, 0x80, 0xF7, 0x80, 0xF7, 0x80, 0x7F, 0x00, 0x3E, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x7E, 0x00, 0xFF, 0x00, 0x6F,
+    0x00, 0x0F, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x78, 0x00, 0x7F, 0x00, 0xFF, 0x00, 0x7E,
+    0xFF, 0x6F, 0x0F, 0x3E, 0x3F, 0x0F, 0x47, 0xFF, 0xFE, 0x18, 0x3C, 0x3C, 0x78, 0x70, 0x60, 0xF8,
+    0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8,
+    0xF0, 0xFC, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+    0x00, 0xF8, 0x00, 0x07, 0xF8, 0x3F, 0xFE, 0x7F, 0xFE, 0xFF, 0xFE, 0xFF, 0x9E, 0xFF, 0x9E, 0xFF,
+    0x9E, 0xFF, 0x9E, 0xFF, 0x9E, 0x7F, 0x9E, 0x3F, 0x9E, 0x0F, 0x9E, 0x07, 0x9E, 0x07, 0x9E, 0x07,
+    0x9E, 0x07, 0x9E, 0x07, 0x9E, 0x07, 0x9E, 0x07, 0x9E, 0x07, 0x9E, 0x07, 0x9E, 0x07, 0x9E, 0x07,
+    0x9E, 0x78, 0x7C, 0xFC, 0x7C, 0x78, 0x38, 0x38, 0x7C, 0x1C, 0xFC, 0xFC, 0xF0, 0x1E, 0x7E, 0x7E,
+    0x7E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1F, 0x80, 0x3F, 0xC0, 0x7B, 0xC0, 0x71, 0xE0, 0xF1,
+    0xE0, 0xF1, 0xE0, 0x71, 0xE0, 0x7B, 0xC0, 0x3F, 0xC0, 0x1F, 0x80, 0x10, 0x00, 0x78, 0xE0, 0x79,
+    0xF0, 0x7C, 0xF8, 0x3E, 0xF8, 0x3E, 0x7C, 0x1F, 0x3E, 0x3E, 0x7C, 0x3E, 0xF8, 0x7C, 0xF8, 0x79,
+    0xF0, 0x78, 0xE0, 0x10, 0x00, 0x1E, 0x07, 0x80, 0x7E, 0x07, 0x80, 0xFE, 0x0F, 0x00, 0x7E, 0x0F,
+    0x00, 0x1E, 0x1E, 0x00, 0x1E, 0x1E, 0x00, 0x1E, 0x3C, 0x00, 0x1E, 0x3C, 0x78, 0x1E, 0x78, 0xF8,
+    0x1E, 0x79, 0xF8, 0x00, 0xF1, 0xF8, 0x00, 0xF3, 0xB8, 0x01, 0xE7, 0xB8, 0x01, 0xE7, 0xFC, 0x03,
+    0xC7, 0xFC, 0x03, 0xC0, 0x38, 0x07, 0x80, 0x38, 0x0F, 0x80, 0x00, 0x1E, 0x07, 0x00, 0x7E, 0x0F,
+    0x00, 0xFE, 0x0F, 0x00, 0x7E, 0x1E, 0x00, 0x1E, 0x3E, 0x00, 0x1E, 0x3C, 0x00, 0x1E, 0x7C, 0x00,
+    0x1E, 0x7B, 0xF0, 0x1E, 0xFF, 0xF8, 0x1E, 0xF3, 0x78, 0x01, 0xF0, 0x78, 0x01, 0xE0, 0xF8, 0x03,
+    0xE1, 0xF0, 0x03, 0xC3, 0xE0, 0x07, 0xC3, 0xC0, 0x07, 0x87, 0xF8, 0x0F, 0x87, 0xF8, 0x0F, 0x00,
+    0x00, 0x7E, 0x03, 0xC0, 0x7F, 0x07, 0x80, 0x6F, 0x07, 0x80, 0x0F, 0x0F, 0x00, 0x3E, 0x0F, 0x00,
+    0x3F, 0x1E, 0x00, 0x07, 0x1E, 0x00, 0x67, 0x3C, 0x78, 0xFF, 0x3C, 0xF8, 0xFE, 0x79, 0xF8, 0x00,
+    0x79, 0xF8, 0x00, 0xF3, 0xB8, 0x00, 0xF7, 0xB8, 0x01, 0xE7, 0xFC, 0x01, 0xE7, 0xFC, 0x03, 0xC0,
+    0x38, 0x03, 0xC0, 0x38, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x0F,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8,
+    0x00, 0xF8, 0x00, 0xFD, 0xC0, 0x7F, 0xE0, 0x7F, 0xE0, 0x3F, 0xC0, 0x01, 0x80, 0x00, 0x03, 0xC0,
+    0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x0F,
+    0xFC, 0x00, 0x0F, 0x3C, 0x00, 0x1F, 0x3E, 0x00, 0x1E, 0x3E, 0x00, 0x1E, 0x1E, 0x00, 0x3F, 0xFF,
+    0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x7C, 0x0F, 0x80, 0x7C, 0x0F, 0x80, 0xF8, 0x07, 0xC0,
+    0xF8, 0x07, 0xC0, 0x00, 0x60, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03,
+    0xC0, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0,
+    0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0x3C, 0x00, 0x1F, 0x3E, 0x00,
+    0x1E, 0x3E, 0x00, 0x1E, 0x1E, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x7C,
+    0x0F, 0x80, 0x7C, 0x0F, 0x80, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0x00, 0xC0, 0x00, 0x01, 0xE0,
+    0x00, 0x03, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00,
+    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
+    0x3C, 0x00, 0x1F, 0x3E, 0x00, 0x1E, 0x3E, 0x00, 0x1E, 0x1E, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF,
+    0x00, 0x3F, 0xFF, 0x80, 0x7C, 0x0F, 0x80, 0x7C, 0x0F, 0x80, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0,
+    0x03, 0xD8, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8,
+    0x00, 0x0F, 0xFC, 0x00, 0x0F, 0x3C, 0x00, 0x1F, 0x3E, 0x00, 0x1E, 0x3E, 0x00, 0x1E, 0x1E, 0x00,
+    0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x7C, 0x0F, 0x80, 0x7C, 0x0F, 0x80, 0xF8,
+    0x07, 0xC0, 0xF8, 0x07, 0xC0, 0x0F, 0x38, 0x00, 0x0F, 0x7C, 0x00, 0x0F, 0x7C, 0x00, 0x0F, 0x38,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00,
+    0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0x3C, 0x00, 0x1F, 0x3E, 0x00, 0x1E,
+    0x3E, 0x00, 0x1E, 0x1E, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x7C, 0x0F,
+    0x80, 0x7C, 0x0F, 0x80, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0x01, 0xE0, 0x00, 0x03, 0xF0, 0x00,
+    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07,
+    0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0x3C, 0x00, 0x1F, 0x3E,
+    0x00, 0x1E, 0x3E, 0x00, 0x1E, 0x1E, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x80,
+    0x7C, 0x0F, 0x80, 0x78, 0x0F, 0x80, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0x00, 0x3F, 0xFF, 0x00,
+    0x7F, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xEF, 0x00, 0x03, 0xEF,
+    0x00, 0x07, 0xCF, 0xFE, 0x07, 0xCF, 0xFE, 0x0F, 0x8F, 0xFE, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0x00,
+    0x3F, 0xFF, 0x00, 0x3E, 0x0F, 0x00, 0x7C, 0x0F, 0xFF, 0x7C, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0x07,
+    0xFC, 0x1F, 0xFE, 0x3F, 0xFC, 0x7F, 0x1C, 0x7C, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x7F, 0x1C, 0x3F, 0xFE, 0x1F, 0xFE, 0x07,
+    0xFC, 0x01, 0xC0, 0x01, 0xE0, 0x00, 0xE0, 0x07, 0xE0, 0x07, 0xC0, 0x0C, 0x00, 0x1E, 0x00, 0x1F,
+    0x00, 0x0F, 0x80, 0x07, 0x80, 0x03, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x03, 0x00, 0x07, 0x80, 0x0F,
+    0x80, 0x1F, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x06, 0x00, 0x0F, 0x00, 0x3F,
+    0x80, 0x3F, 0xC0, 0x39, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x79, 0xC0, 0x7B, 0xE0, 0x7B, 0xE0, 0x79,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x30, 0x78, 0x7C, 0x3E, 0x1E, 0x0C, 0x00, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x18,
+    0x3C, 0x7C, 0xF8, 0xF0, 0x60, 0x00, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
+    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x18, 0x3C, 0x7E, 0xFF, 0x66, 0x00, 0x3C, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0xF3, 0xC0,
+    0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
+    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
+    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x3F, 0xF8, 0x00, 0x3F,
+    0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x3E, 0x7F, 0x80, 0x3E, 0x0F, 0x80, 0x3E, 0x0F, 0x80, 0x3E, 0x07,
+    0xC0, 0xFF, 0xC7, 0xC0, 0xFF, 0xC7, 0xC0, 0xFF, 0xC7, 0xC0, 0x3E, 0x07, 0xC0, 0x3E, 0x0F, 0x80,
+    0x3E, 0x1F, 0x80, 0x3E, 0x7F, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x0F,
+    0x70, 0x1F, 0xF0, 0x1F, 0xF0, 0x1D, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1E, 0xF8, 0x1E, 0xFC,
+    0x1E, 0xFE, 0x1E, 0xFF, 0x1E, 0xFF, 0x1E, 0xFF, 0x9E, 0xF7, 0xDE, 0xF7, 0xDE, 0xF3, 0xFE, 0xF1,
+    0xFE, 0xF0, 0xFE, 0xF0, 0xFE, 0xF0, 0x7E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x1E, 0x01, 0x80, 0x00,
+    0x03, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0x3F, 0x00, 0x7C, 0x0F,
+    0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0,
+    0xF8, 0x07, 0xC0, 0xF8, 0x0F, 0x80, 0x7C, 0x0F, 0x80, 0x7F, 0x3F, 0x80, 0x3F, 0xFF, 0x00, 0x1F,
+    0xFE, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x60, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0,
+    0x00, 0x03, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xFE, 0x00,
+    0x3F, 0xFF, 0x00, 0x7F, 0x3F, 0x00, 0x7C, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x07, 0xC0, 0xF8,
+    0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x0F, 0x80, 0x7C, 0x0F,
+    0x80, 0x7F, 0x3F, 0x80, 0x3F, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xC0, 0x00,
+    0x01, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x07, 0x30, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0x3F, 0x00, 0x7C, 0x0F, 0x80, 0xF8, 0x0F,
+    0x80, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0,
+    0xF8, 0x0F, 0x80, 0x7C, 0x0F, 0x80, 0x7F, 0x3F, 0x80, 0x3F, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x07,
+    0xF8, 0x00, 0x07, 0xD8, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x06, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0x3F, 0x00,
+    0x7C, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8,
+    0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x0F, 0x80, 0x7C, 0x0F, 0x80, 0x7F, 0x3F, 0x80, 0x3F, 0xFF,
+    0x00, 0x1F, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0x38, 0x00, 0x0F, 0x7C, 0x00, 0x0F, 0x7C, 0x00,
+    0x0F, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x3F,
+    0xFF, 0x00, 0x7F, 0x3F, 0x00, 0x7C, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x07, 0xC0, 0xF8, 0x07,
+    0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x0F, 0x80, 0x7C, 0x0F, 0x80,
+    0x7F, 0x3F, 0x80, 0x3F, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x30, 0xC0, 0x79, 0xE0,
+    0xFF, 0xF0, 0x7F, 0xE0, 0x3F, 0xC0, 0x1F, 0x80, 0x3F, 0xC0, 0x7F, 0xE0, 0xFF, 0xF0, 0x79, 0xE0,
+    0x30, 0xC0, 0x00, 0x03, 0x00, 0x07, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x7F, 0x3F,
+    0x00, 0x7C, 0x3F, 0x80, 0xF8, 0x7F, 0x80, 0xF8, 0xFF, 0xC0, 0xF8, 0xF7, 0xC0, 0xF9, 0xE7, 0xC0,
+    0xFB, 0xC7, 0xC0, 0xFF, 0x87, 0xC0, 0xFF, 0x8F, 0x80, 0x7F, 0x0F, 0x80, 0x7F, 0x3F, 0x80, 0x3F,
+    0xFF, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xF8, 0x00, 0x30, 0x00, 0x00, 0x06, 0x00, 0x0F, 0x00, 0x0F,
+    0x80, 0x07, 0xC0, 0x03, 0xC0, 0x01, 0x80, 0x00, 0x00, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8,
+    0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8,
+    0x1E, 0x7C, 0x3E, 0x7E, 0x7E, 0x7F, 0xFC, 0x3F, 0xF8, 0x0F, 0xF0, 0x00, 0xC0, 0x01, 0xE0, 0x03,
+    0xE0, 0x07, 0xC0, 0x07, 0x80, 0x03, 0x00, 0x00, 0x00, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8,
+    0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8,
+    0x1E, 0x7C, 0x3E, 0x7E, 0x7E, 0x7F, 0xFC, 0x3F, 0xF8, 0x0F, 0xF0, 0x01, 0x80, 0x03, 0xC0, 0x0F,
+    0xE0, 0x0F, 0xF0, 0x0E, 0x60, 0x00, 0x00, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8,
+    0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0x7C,
+    0x3E, 0x7E, 0x7E, 0x7F, 0xFC, 0x3F, 0xF8, 0x0F, 0xF0, 0x1E, 0x70, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8,
+    0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0x7C, 0x3E, 0x7E,
+    0x7E, 0x7F, 0xFC, 0x3F, 0xF8, 0x0F, 0xF0, 0x00, 0x60, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00,
+    0x03, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x80, 0x7C,
+    0x1F, 0x00, 0x7C, 0x3E, 0x00, 0x3E, 0x3E, 0x00, 0x3E, 0x7C, 0x00, 0x1F, 0x7C, 0x00, 0x1F, 0xF8,
+    0x00, 0x0F, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00,
+    0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0xFF, 0xF8, 0xF1, 0xF8, 0xF0, 0xF8, 0xF0, 0x7C, 0xF0,
+    0x7C, 0xF0, 0xF8, 0xF1, 0xF8, 0xFF, 0xF8, 0xFF, 0xF0, 0xFF, 0xC0, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0x1F, 0xC0, 0x3F, 0xF0, 0x7F, 0xF0, 0x7C, 0xF8, 0x78, 0xF8, 0xF8, 0xF0, 0xF9, 0xF0, 0xF9,
+    0xE0, 0xFB, 0xC0, 0xFB, 0xC0, 0xFB, 0xF0, 0xFB, 0xF8, 0xF9, 0xFC, 0xF8, 0x7E, 0xF8, 0x3E, 0xFB,
+    0x3E, 0xFB, 0xFE, 0xFB, 0xFC, 0xFB, 0xF8, 0x06, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x07, 0x80, 0x03,
+    0x80, 0x01, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xF0, 0x3F, 0xF0, 0x31, 0xF0, 0x00, 0xF8, 0x1F,
+    0xF8, 0x7F, 0xF8, 0x7F, 0xF8, 0x7C, 0xF8, 0x7C, 0xF8, 0x7F, 0xF8, 0x7F, 0xF8, 0x3F, 0xF0, 0x01,
+    0x80, 0x03, 0xC0, 0x07, 0xC0, 0x0F, 0x80, 0x0F, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x3F,
+    0xF0, 0x3F, 0xF0, 0x31, 0xF0, 0x00, 0xF8, 0x1F, 0xF8, 0x7F, 0xF8, 0x7F, 0xF8, 0x7C, 0xF8, 0x7C,
+    0xF8, 0x7F, 0xF8, 0x7F, 0xF8, 0x3F, 0xF0, 0x07, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x3F, 0xE0, 0x18,
+    0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xF0, 0x3F, 0xF0, 0x31, 0xF0, 0x00, 0xF8, 0x1F, 0xF8, 0x7F,
+    0xF8, 0x7F, 0xF8, 0x7C, 0xF8, 0x7C, 0xF8, 0x7F, 0xF8, 0x7F, 0xF8, 0x3F, 0xF0, 0x1F, 0x60, 0x3F,
+    0xF0, 0x3F, 0xE0, 0x1B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xF0, 0x3F, 0xF0, 0x31,
+    0xF0, 0x00, 0xF8, 0x1F, 0xF8, 0x7F, 0xF8, 0x7F, 0xF8, 0x7C, 0xF8, 0x7C, 0xF8, 0x7F, 0xF8, 0x7F,
+    0xF8, 0x3F, 0xF0, 0x3C, 0xE0, 0x3D, 0xF0, 0x3D, 0xF0, 0x3C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0xC0, 0x3F, 0xF0, 0x3F, 0xF0, 0x31, 0xF0, 0x00, 0xF8, 0x1F, 0xF8, 0x7F, 0xF8, 0x7F, 0xF8, 0x7C,
+    0xF8, 0x7C, 0xF8, 0x7F, 0xF8, 0x7F, 0xF8, 0x3F, 0xF0, 0x07, 0x80, 0x0F, 0xC0, 0x0D, 0xC0, 0x0F,
+    0xC0, 0x0F, 0xC0, 0x07, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xF0, 0x3F, 0xF0, 0x31, 0xF0, 0x00,
+    0xF8, 0x1F, 0xF8, 0x7F, 0xF8, 0x7F, 0xF8, 0x7C, 0xF8, 0x7C, 0xF8, 0x7F, 0xF8, 0x7F, 0xF8, 0x3F,
+    0xF0, 0x3F, 0xCF, 0xC0, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xF0, 0x31, 0xFD, 0xF8, 0x00, 0xF8, 0x78,
+    0x1F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF8, 0x7C, 0xF8, 0x00, 0x7C, 0x7E, 0x70, 0x7F,
+    0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x1F, 0xE0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFC, 0xC0,
+    0xF8, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0xFC, 0x60, 0x7F, 0xE0, 0x3F, 0xE0,
+    0x0F, 0xE0, 0x0F, 0x00, 0x07, 0x80, 0x07, 0x80, 0x1F, 0x80, 0x1F, 0x00, 0x0C, 0x00, 0x1E, 0x00,
+    0x1F, 0x00, 0x0F, 0x80, 0x07, 0x80, 0x03, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0,
+    0xFD, 0xF0, 0xF8, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xF8, 0x00, 0xFC, 0x70, 0x7F, 0xF0,
+    0x3F, 0xF0, 0x1F, 0xF0, 0x03, 0x00, 0x07, 0x80, 0x0F, 0x80, 0x0F, 0x00, 0x0E, 0x00, 0x0C, 0x00,
+    0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFD, 0xF0, 0xF8, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8,
+    0xFF, 0xF8, 0xF8, 0x00, 0xFC, 0x70, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x06, 0x00, 0x0F, 0x80,
+    0x1F, 0xC0, 0x3F, 0xC0, 0x18, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFD, 0xF0,
+    0xF8, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xF8, 0x00, 0xFC, 0x70, 0x7F, 0xF0, 0x3F, 0xF0,
+    0x1F, 0xF0, 0x39, 0xE0, 0x7D, 0xE0, 0x7D, 0xE0, 0x39, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
+    0x3F, 0xE0, 0x7F, 0xF0, 0xFD, 0xF0, 0xF8, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xF8, 0x00,
+    0xFC, 0x70, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x30, 0x78, 0x7C, 0x3C, 0x1C, 0x0C, 0x00, 0x7C,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x18, 0x3C, 0x7C, 0xF8,
+    0xF0, 0x60, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+    0x0C, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x7F, 0x80, 0x63, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00,
+    0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00,
+    0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x71, 0xC0, 0x7B, 0xE0, 0x7B, 0xE0, 0x71, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00,
+    0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x07, 0x00, 0x0F, 0xF8,
+    0x07, 0xF8, 0x0F, 0xF8, 0x0F, 0xF0, 0x07, 0xF0, 0x00, 0xF8, 0x1F, 0xF8, 0x7F, 0xF8, 0x7F, 0xF8,
+    0xFC, 0xF8, 0xF8, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF8, 0xF8, 0xFD, 0xF0, 0x7F, 0xF0, 0x7F, 0xE0,
+    0x1F, 0xC0, 0x1E, 0xE0, 0x3F, 0xE0, 0x3F, 0xE0, 0x3B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0,
+    0xFF, 0xE0, 0xFF, 0xF0, 0xF9, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0,
+    0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0x06, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x07, 0x80,
+    0x03, 0x80, 0x01, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFD, 0xF8, 0xF8, 0xF8,
+    0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF8, 0xF8, 0xFD, 0xF8, 0x7F, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0,
+    0x03, 0x80, 0x03, 0xC0, 0x07, 0xC0, 0x0F, 0x80, 0x0F, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1F, 0xC0,
+    0x3F, 0xE0, 0x7F, 0xF0, 0xFD, 0xF8, 0xF8, 0xF8, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF8, 0xF8,
+    0xFD, 0xF8, 0x7F, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x07, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x3F, 0xE0,
+    0x18, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFD, 0xF8, 0xF8, 0xF8, 0xF0, 0x78,
+    0xF0, 0x78, 0xF0, 0x78, 0xF8, 0xF8, 0xFD, 0xF8, 0x7F, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x1E, 0xE0,
+    0x3F, 0xE0, 0x3F, 0xE0, 0x3B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0,
+    0xFD, 0xF8, 0xF8, 0xF8, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF8, 0xF8, 0xFD, 0xF8, 0x7F, 0xF0,
+    0x3F, 0xE0, 0x1F, 0xC0, 0x3C, 0xE0, 0x3D, 0xF0, 0x3D, 0xF0, 0x3C, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFD, 0xF8, 0xF8, 0xF8, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78,
+    0xF8, 0xF8, 0xFD, 0xF8, 0x7F, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x0F, 0x00, 0x0F, 0x80, 0x0F, 0x80,
+    0x0F, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x80,
+    0x0F, 0x80, 0x0F, 0x00, 0x00, 0x30, 0x1F, 0xF8, 0x3F, 0xF8, 0x7F, 0xF0, 0xFD, 0xF8, 0xFB, 0xF8,
+    0xF3, 0xF8, 0xF7, 0x78, 0xFF, 0x78, 0xFE, 0x78, 0xFD, 0xF8, 0x7F, 0xF0, 0x7F, 0xE0, 0xFF, 0xC0,
+    0x60, 0x00, 0x0C, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0x80, 0x03, 0x00, 0x00, 0x00,
+    0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0,
+    0xF8, 0xF0, 0x7C, 0xF0, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x03, 0x00, 0x07, 0x80, 0x07, 0x80,
+    0x0F, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0,
+    0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0x7C, 0xF0, 0x7F, 0xF0, 0x3F, 0xF0,
+    0x1F, 0xF0, 0x06, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x3F, 0xC0, 0x18, 0xC0, 0x00, 0x00, 0xF8, 0xF0,
+    0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0,
+    0x7C, 0xF0, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x39, 0xE0, 0x7D, 0xE0, 0x7D, 0xE0, 0x39, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0,
+    0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0x7C, 0xF0, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x00, 0xC0,
+    0x01, 0xE0, 0x03, 0xE0, 0x07, 0xC0, 0x07, 0x80, 0x03, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0xF8, 0x78,
+    0x78, 0x78, 0x7C, 0xF8, 0x7C, 0xF0, 0x3C, 0xF0, 0x3F, 0xF0, 0x3F, 0xE0, 0x1F, 0xE0, 0x1F, 0xE0,
+    0x0F, 0xC0, 0x0F, 0xC0, 0x07, 0x80, 0x0F, 0x80, 0x5F, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0xFC, 0x00,
+    0x78, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0xC0, 0xFF, 0xE0,
+    0xFF, 0xF0, 0xF9, 0xF8, 0xF8, 0xF8, 0xF8, 0x78, 0xF8, 0x78, 0xF8, 0x78, 0xF8, 0xF8, 0xFD, 0xF8,
+    0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xC0, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+    0x3C, 0xE0, 0x3D, 0xF0, 0x3D, 0xF0, 0x3C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0xF8, 0x78,
+    0x78, 0x78, 0x7C, 0xF8, 0x7C, 0xF0, 0x3C, 0xF0, 0x3F, 0xF0, 0x3F, 0xE0, 0x1F, 0xE0, 0x1F, 0xE0,
+    0x0F, 0xC0, 0x0F, 0xC0, 0x07, 0x80, 0x0F, 0x80, 0x5F, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0xFC, 0x00,
+    0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8,
+    0x00, 0x0F, 0xFC, 0x00, 0x0F, 0x3C, 0x00, 0x1F, 0x3E, 0x00, 0x1E, 0x3E, 0x00, 0x1E, 0x1E, 0x00,
+    0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x7C, 0x0F, 0x80, 0x7C, 0x0F, 0x80, 0xF8,
+    0x07, 0xC0, 0xF8, 0x07, 0xC0, 0x3F, 0xE0, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xC0, 0x3F, 0xF0, 0x3F, 0xF0, 0x31, 0xF0, 0x00, 0xF8, 0x1F, 0xF8, 0x7F, 0xF8, 0x7F,
+    0xF8, 0x7C, 0xF8, 0x7C, 0xF8, 0x7F, 0xF8, 0x7F, 0xF8, 0x3F, 0xF0, 0x07, 0x3C, 0x00, 0x07, 0xB8,
+    0x00, 0x03, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00,
+    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
+    0x3C, 0x00, 0x1F, 0x3E, 0x00, 0x1E, 0x3E, 0x00, 0x1E, 0x1E, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF,
+    0x00, 0x3F, 0xFF, 0x80, 0x7C, 0x0F, 0x80, 0x7C, 0x0F, 0x80, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0,
+    0x1C, 0xE0, 0x1D, 0xE0, 0x1F, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xF0,
+    0x3F, 0xF0, 0x31, 0xF0, 0x00, 0xF8, 0x1F, 0xF8, 0x7F, 0xF8, 0x7F, 0xF8, 0x7C, 0xF8, 0x7C, 0xF8,
+    0x7F, 0xF8, 0x7F, 0xF8, 0x3F, 0xF0, 0x01, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07,
+    0xF8, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0x3C, 0x00, 0x1F, 0x3E, 0x00, 0x1E, 0x3E,
+    0x00, 0x1E, 0x1E, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x7C, 0x0F, 0x80,
+    0x7C, 0x0F, 0x80, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00,
+    0x07, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x3F, 0xC0, 0x3F, 0xF0, 0x3F,
+    0xF0, 0x31, 0xF0, 0x00, 0xF8, 0x1F, 0xF8, 0x7F, 0xF8, 0x7F, 0xF8, 0x7C, 0xF8, 0x7C, 0xF8, 0x7F,
+    0xF8, 0x7F, 0xF8, 0x3F, 0xF0, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x03, 0xF0, 0x01, 0xF8, 0x01,
+    0xF8, 0x00, 0x60, 0x00, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x03, 0xC0, 0x01, 0x80, 0x00, 0x00, 0x07,
+    0xFC, 0x1F, 0xFE, 0x3F, 0xFC, 0x7F, 0x1C, 0x7C, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x7F, 0x1C, 0x3F, 0xFE, 0x1F, 0xFE, 0x0F,
+    0xFC, 0x01, 0x80, 0x03, 0xC0, 0x07, 0xC0, 0x0F, 0x80, 0x0F, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1F,
+    0xE0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFC, 0xC0, 0xF8, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF8,
+    0x00, 0xFC, 0x60, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xE0, 0x00, 0xC0, 0x01, 0xE0, 0x07, 0xF0, 0x07,
+    0xF8, 0x07, 0x30, 0x00, 0x00, 0x07, 0xFC, 0x1F, 0xFE, 0x3F, 0xFC, 0x7F, 0x1C, 0x7C, 0x00, 0xF8,
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x7F,
+    0x1C, 0x3F, 0xFE, 0x1F, 0xFE, 0x0F, 0xFC, 0x07, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x3F, 0xC0, 0x18,
+    0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFC, 0xC0, 0xF8, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF8, 0x00, 0xFC, 0x60, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xE0, 0x01, 0xE0, 0x01,
+    0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x1F, 0xFE, 0x3F, 0xFC, 0x7F,
+    0x1C, 0x7C, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+    0x00, 0x7C, 0x00, 0x7F, 0x1C, 0x3F, 0xFE, 0x1F, 0xFE, 0x0F, 0xFC, 0x07, 0x00, 0x0F, 0x80, 0x0F,
+    0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFC, 0xC0, 0xF8,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0xFC, 0x60, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F,
+    0xE0, 0x06, 0x30, 0x07, 0xF8, 0x07, 0xF0, 0x01, 0xE0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xFC, 0x1F, 0xFE, 0x3F, 0xFC, 0x7F, 0x1C, 0x7C, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x7F, 0x1C, 0x3F, 0xFE, 0x1F, 0xFE, 0x0F,
+    0xFC, 0x18, 0xC0, 0x3F, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xE0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFC, 0xC0, 0xF8, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF8,
+    0x00, 0xFC, 0x60, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F, 0xE0, 0x1C, 0xC0, 0x1F, 0xE0, 0x1F, 0xC0, 0x07,
+    0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0xFF, 0xF8, 0xF1, 0xFC, 0xF0,
+    0x7E, 0xF0, 0x3E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1F, 0xF0, 0x1E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0,
+    0x7E, 0xF1, 0xFC, 0xFF, 0xF8, 0xFF, 0xF0, 0xFF, 0xC0, 0x00, 0xFB, 0x80, 0x00, 0xFB, 0x80, 0x00,
+    0xFB, 0x80, 0x00, 0xFB, 0x80, 0x00, 0xFB, 0x80, 0x00, 0xFB, 0x80, 0x1F, 0xF8, 0x00, 0x7F, 0xF8,
+    0x00, 0x7F, 0xF8, 0x00, 0xFD, 0xF8, 0x00, 0xF8, 0xF8, 0x00, 0xF0, 0xF8, 0x00, 0xF0, 0xF8, 0x00,
+    0xF0, 0xF8, 0x00, 0xF8, 0xF8, 0x00, 0xFC, 0xF8, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x1F,
+    0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x3E, 0x7F, 0x80, 0x3E, 0x0F,
+    0x80, 0x3E, 0x0F, 0x80, 0x3E, 0x07, 0xC0, 0xFF, 0xC7, 0xC0, 0xFF, 0xC7, 0xC0, 0xFF, 0xC7, 0xC0,
+    0x3E, 0x07, 0xC0, 0x3E, 0x0F, 0x80, 0x3E, 0x1F, 0x80, 0x3E, 0x7F, 0x00, 0x3F, 0xFF, 0x00, 0x3F,
+    0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0xF8, 0x00,
+    0xF8, 0x1F, 0xF8, 0x3F, 0xF8, 0x7F, 0xF8, 0xFD, 0xF8, 0xF8, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0,
+    0xF8, 0xF8, 0xF8, 0xFC, 0xF8, 0x7F, 0xF8, 0x3F, 0xF8, 0x1F, 0xF0, 0x7F, 0xC0, 0x7F, 0xC0, 0x7F,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x3F, 0xE0, 0x3F, 0xE0, 0x3F, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFD, 0xF0, 0xF8, 0xF8, 0xFF,
+    0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xF8, 0x00, 0xFC, 0x70, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x39,
+    0xC0, 0x3F, 0xC0, 0x3F, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF,
+    0xF0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x39, 0xE0, 0x3D,
+    0xC0, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFD,
+    0xF0, 0xF8, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xF8, 0x00, 0xFC, 0x70, 0x7F, 0xF0, 0x3F,
+    0xF0, 0x1F, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF,
+    0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0xF8, 0x0F, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F,
+    0xE0, 0x7F, 0xF0, 0xFD, 0xF0, 0xF8, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xF8, 0x00, 0xFC,
+    0x70, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0xF0, 0x00, 0xE0, 0x01, 0xE0, 0x01,
+    0xF8, 0x01, 0xF8, 0x00, 0xF8, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFD, 0xF0, 0xF8, 0xF8, 0xFF,
+    0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xF8, 0x00, 0xFC, 0x70, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x01,
+    0xC0, 0x03, 0xC0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x19, 0x80, 0x3F, 0xC0, 0x1F, 0x80, 0x0F,
+    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x18, 0xC0, 0x3F, 0xE0, 0x1F, 0xC0, 0x0F,
+    0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFD, 0xF0, 0xF8,
+    0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xF8, 0x00, 0xFC, 0x70, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F,
+    0xF0, 0x00, 0xC0, 0x01, 0xE0, 0x07, 0xF0, 0x07, 0xF8, 0x07, 0x30, 0x00, 0x00, 0x07, 0xFC, 0x1F,
+    0xFE, 0x3F, 0xFE, 0x7F, 0x1C, 0x7C, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x1E, 0xF8,
+    0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0x7C, 0x1E, 0x7F, 0x1E, 0x3F, 0xFE, 0x1F, 0xFE, 0x07, 0xFE, 0x03,
+    0x00, 0x07, 0x80, 0x1F, 0xC0, 0x1F, 0xE0, 0x0C, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xF0, 0x7F,
+    0xF0, 0xFC, 0xF0, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF0, 0xFD, 0xF0, 0x7F,
+    0xF0, 0x7F, 0xF0, 0x3F, 0xF0, 0x00, 0xF0, 0x71, 0xF0, 0x7F, 0xF0, 0x7F, 0xE0, 0x7F, 0xC0, 0x0F,
+    0x38, 0x07, 0x78, 0x07, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x1F, 0xFE, 0x3F,
+    0xFE, 0x7F, 0x1C, 0x7C, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8,
+    0x1E, 0xF8, 0x1E, 0x7C, 0x1E, 0x7F, 0x1E, 0x3F, 0xFE, 0x1F, 0xFE, 0x07, 0xFE, 0x1C, 0xE0, 0x1D,
+    0xE0, 0x1F, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xF0, 0x7F, 0xF0, 0xFC,
+    0xF0, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF0, 0xFD, 0xF0, 0x7F, 0xF0, 0x7F,
+    0xF0, 0x3F, 0xF0, 0x00, 0xF0, 0x71, 0xF0, 0x7F, 0xF0, 0x7F, 0xE0, 0x7F, 0xC0, 0x01, 0xE0, 0x01,
+    0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x1F, 0xFE, 0x3F, 0xFE, 0x7F,
+    0x1C, 0x7C, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8,
+    0x1E, 0x7C, 0x1E, 0x7F, 0x1E, 0x3F, 0xFE, 0x1F, 0xFE, 0x07, 0xFE, 0x07, 0x00, 0x0F, 0x80, 0x0F,
+    0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xF0, 0x7F, 0xF0, 0xFC, 0xF0, 0xF8,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF0, 0xFD, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x3F,
+    0xF0, 0x00, 0xF0, 0x71, 0xF0, 0x7F, 0xF0, 0x7F, 0xE0, 0x7F, 0xC0, 0x07, 0xFC, 0x1F, 0xFE, 0x3F,
+    0xFE, 0x7F, 0x1C, 0x7C, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8,
+    0x1E, 0xF8, 0x1E, 0x7C, 0x1E, 0x7F, 0x1E, 0x3F, 0xFE, 0x1F, 0xFE, 0x07, 0xFE, 0x00, 0x00, 0x01,
+    0xE0, 0x01, 0xE0, 0x07, 0xE0, 0x03, 0xC0, 0x01, 0x80, 0x03, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x07,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xF0, 0x7F, 0xF0, 0xFC, 0xF0, 0xF8, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF0, 0xFD, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x3F, 0xF0, 0x00,
+    0xF0, 0x71, 0xF0, 0x7F, 0xF0, 0x7F, 0xE0, 0x7F, 0xC0, 0x03, 0x00, 0x07, 0x80, 0x0F, 0xE0, 0x1F,
+    0xE0, 0x0C, 0xE0, 0x00, 0x00, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0,
+    0x3E, 0xF0, 0x3E, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0,
+    0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0x1C, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x63,
+    0x00, 0x00, 0x00, 0x78, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFF,
+    0xC0, 0xFF, 0xE0, 0xFF, 0xF0, 0xF9, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8,
+    0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0x3E, 0x0F, 0x80, 0x3E, 0x0F, 0x80, 0xFF,
+    0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0x3E, 0x0F, 0x80, 0x3E, 0x0F, 0x80, 0x3F, 0xFF,
+    0x80, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x3E, 0x0F, 0x80, 0x3E, 0x0F, 0x80, 0x3E, 0x0F, 0x80,
+    0x3E, 0x0F, 0x80, 0x3E, 0x0F, 0x80, 0x3E, 0x0F, 0x80, 0x3E, 0x0F, 0x80, 0x3C, 0x00, 0x3C, 0x00,
+    0xFF, 0xC0, 0xFF, 0xC0, 0x3C, 0x00, 0x3C, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x3F, 0xF8, 0x3C, 0xF8,
+    0x3C, 0x7C, 0x3C, 0x7C, 0x3C, 0x7C, 0x3C, 0x7C, 0x3C, 0x7C, 0x3C, 0x7C, 0x3C, 0x7C, 0x3C, 0x7C,
+    0x3C, 0x7C, 0x7D, 0x80, 0x7F, 0xC0, 0xFF, 0x80, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00,
+    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
+    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
+    0x7D, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00,
+    0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00,
+    0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
+    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
+    0x1E, 0x00, 0x1E, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00,
+    0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0xE7, 0x80, 0xF7, 0x00, 0x7F, 0x00,
+    0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00,
+    0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00,
+    0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0xF3, 0x80, 0xF7, 0x80, 0x7F, 0x00, 0x3E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00,
+    0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+    0x78, 0x78, 0xFE, 0x7E, 0x7E, 0x3C, 0x7C, 0x7C, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x78, 0x70, 0xF0, 0xFC, 0xFC, 0x7C, 0x78, 0x78,
+    0x78, 0x78, 0x00, 0x00, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
+    0x78, 0x78, 0x78, 0x78, 0x78, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+    0xF8, 0xF8, 0xF0, 0x07, 0xC0, 0xF0, 0x07, 0xC0, 0xF0, 0x07, 0xC0, 0xF0, 0x07, 0xC0, 0xF0, 0x07,
+    0xC0, 0xF0, 0x07, 0xC0, 0xF0, 0x07, 0xC0, 0xF0, 0x07, 0xC0, 0xF0, 0x07, 0xC0, 0xF0, 0x07, 0xC0,
+    0xF0, 0x07, 0xC0, 0xF0, 0x07, 0xC0, 0xF0, 0x07, 0xC0, 0xF1, 0xCF, 0x80, 0xF3, 0xFF, 0x80, 0xF3,
+    0xFF, 0x00, 0xF1, 0xFE, 0x00, 0x78, 0xF0, 0xF9, 0xF0, 0xF9, 0xF0, 0x78, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8,
+    0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x0F,
+    0xF0, 0x0F, 0xE0, 0x0F, 0xC0, 0x00, 0xE0, 0x01, 0xF0, 0x03, 0xF8, 0x07, 0xF8, 0x03, 0x18, 0x00,
+    0x00, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01,
+    0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x73, 0xE0, 0xFF, 0xE0, 0xFF,
+    0xC0, 0x7F, 0x80, 0x06, 0x00, 0x1F, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x31, 0x80, 0x00, 0x00, 0x1F,
+    0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F,
+    0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0xFE, 0x00, 0xFE,
+    0x00, 0xFC, 0x00, 0xF0, 0x7C, 0xF0, 0xF8, 0xF1, 0xF8, 0xF3, 0xF0, 0xF7, 0xE0, 0xFF, 0xC0, 0xFF,
+    0x80, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xF7, 0xE0, 0xF3, 0xF0, 0xF1, 0xF8, 0xF0,
+    0xF8, 0xF0, 0x7C, 0xF0, 0x7E, 0x00, 0x00, 0x07, 0x80, 0x07, 0x80, 0x0F, 0x80, 0x0F, 0x00, 0x78,
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0xF8, 0xF9, 0xF0, 0xFB,
+    0xE0, 0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xE0, 0xFB, 0xE0, 0xF9,
+    0xF0, 0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x07, 0x80, 0x0F, 0x80, 0x1F, 0x00, 0x1E, 0x00, 0xF8,
+    0xF8, 0xF9, 0xF0, 0xFB, 0xE0, 0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xFF,
+    0xE0, 0xFB, 0xE0, 0xF9, 0xF0, 0xF9, 0xF8, 0xF8, 0xF8, 0x1C, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0x7C,
+    0x00, 0x78, 0x00, 0x30, 0x00, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78,
+    0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78,
+    0x00, 0x78, 0x00, 0x7F, 0xF8, 0x7F, 0xF8, 0x7F, 0xF8, 0x0C, 0x7C, 0xFE, 0xF0, 0x00, 0x78, 0xF8,
+    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFC, 0x7E, 0x7E,
+    0x3C, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xF0, 0xFF,
+    0xF0, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x1E, 0x00, 0x78, 0xF8, 0xF8,
+    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFC, 0x7E, 0x7E, 0x3C,
+    0x00, 0x38, 0x78, 0xF8, 0xF0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0x80, 0xF3, 0x80, 0xF3, 0x80, 0xF3,
+    0x80, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x7B, 0xC0, 0xFB, 0x80, 0xFB, 0x80, 0xFB, 0x80, 0xFB,
+    0x80, 0xFB, 0x80, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF1, 0xE0, 0xF3, 0xE0, 0xF3, 0xF0, 0xF3, 0xE0, 0xF1, 0xE0, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x78,
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF9, 0xE0, 0xFB, 0xF0, 0xFB,
+    0xF0, 0xFB, 0xF0, 0xF9, 0xE0, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x7E,
+    0x00, 0x7E, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x40, 0x3F,
+    0xE0, 0x3F, 0xE0, 0x3F, 0xC0, 0x7F, 0x80, 0xFE, 0x00, 0xFE, 0x00, 0x7E, 0x00, 0x3E, 0x00, 0x3E,
+    0x00, 0x3F, 0xFE, 0x3F, 0xFE, 0x3F, 0xFE, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F,
+    0x00, 0x1F, 0x80, 0x1F, 0xC0, 0x1F, 0xC0, 0x7F, 0x80, 0x7F, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x1F,
+    0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x07, 0x80, 0x01, 0x80, 0x01,
+    0xE0, 0x03, 0xE0, 0x07, 0xC0, 0x07, 0x80, 0x02, 0x00, 0x00, 0x00, 0xF0, 0x1E, 0xF8, 0x1E, 0xFC,
+    0x1E, 0xFE, 0x1E, 0xFF, 0x1E, 0xFF, 0x1E, 0xFF, 0x9E, 0xF7, 0xDE, 0xF7, 0xDE, 0xF3, 0xFE, 0xF1,
+    0xFE, 0xF0, 0xFE, 0xF0, 0xFE, 0xF0, 0x7E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x1E, 0x03, 0x00, 0x07,
+    0x80, 0x0F, 0x80, 0x1F, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xE0, 0xFF,
+    0xF0, 0xF9, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8,
+    0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF0, 0x1E, 0xF8, 0x1E, 0xFC, 0x1E, 0xFE, 0x1E, 0xFF, 0x1E, 0xFF,
+    0x1E, 0xFF, 0x9E, 0xF7, 0xDE, 0xF7, 0xDE, 0xF3, 0xFE, 0xF1, 0xFE, 0xF0, 0xFE, 0xF0, 0xFE, 0xF0,
+    0x7E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x07, 0xC0, 0x0F, 0x80, 0x0F,
+    0x80, 0x7F, 0xC0, 0xFF, 0xE0, 0xFF, 0xF0, 0xF9, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8,
+    0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0x00, 0x00, 0x07, 0x00, 0x0F,
+    0x00, 0x1F, 0x00, 0x1E, 0x00, 0x0C, 0xE0, 0x1F, 0xE0, 0x0F, 0xE0, 0x07, 0x80, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0x1E, 0xF8, 0x1E, 0xFC, 0x1E, 0xFE, 0x1E, 0xFF, 0x1E, 0xFF, 0x1E, 0xFF,
+    0x9E, 0xF7, 0xDE, 0xF7, 0xDE, 0xF3, 0xFE, 0xF1, 0xFE, 0xF0, 0xFE, 0xF0, 0xFE, 0xF0, 0x7E, 0xF0,
+    0x3E, 0xF0, 0x3E, 0xF0, 0x1E, 0x18, 0xC0, 0x3F, 0xC0, 0x1F, 0xC0, 0x0F, 0x80, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xE0, 0xFF, 0xF0, 0xF9, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8,
+    0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0x78, 0x00, 0x78,
+    0x00, 0x78, 0x00, 0x78, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x1F, 0xF8, 0x1F, 0xFC, 0x1F, 0xFE, 0x1F,
+    0x3E, 0x1F, 0x1E, 0x1F, 0x1E, 0x1F, 0x1E, 0x1F, 0x1E, 0x1F, 0x1E, 0x1F, 0x1E, 0x1F, 0x1E, 0x1F,
+    0x1E, 0x1F, 0x1E, 0xF0, 0x1E, 0xF8, 0x1E, 0xFC, 0x1E, 0xFE, 0x1E, 0xFF, 0x1E, 0xFF, 0x1E, 0xFF,
+    0x9E, 0xF7, 0xDE, 0xF7, 0xDE, 0xF3, 0xFE, 0xF1, 0xFE, 0xF0, 0xFE, 0xF0, 0xFE, 0xF0, 0x7E, 0xF0,
+    0x7E, 0xF0, 0x3E, 0xF0, 0x1E, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0xF8, 0x7F,
+    0xC0, 0xFF, 0xE0, 0xFF, 0xF0, 0xF9, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8,
+    0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0x00, 0xF0, 0x01, 0xF0, 0x07, 0xF0, 0x07,
+    0xF0, 0x07, 0xE0, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0x3F,
+    0x00, 0x7C, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0,
+    0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x0F, 0x80, 0x7C, 0x0F, 0x80, 0x7F, 0x3F, 0x80, 0x3F,
+    0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFD, 0xF8, 0xF8, 0xF8, 0xF0, 0x78,
+    0xF0, 0x78, 0xF0, 0x78, 0xF8, 0xF8, 0xFD, 0xF8, 0x7F, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x0F, 0x38,
+    0x00, 0x07, 0x78, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0x3F, 0x00, 0x7C, 0x0F, 0x80, 0xF8,
+    0x0F, 0x80, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07,
+    0xC0, 0xF8, 0x0F, 0x80, 0x7C, 0x0F, 0x80, 0x7F, 0x3F, 0x80, 0x3F, 0xFF, 0x00, 0x1F, 0xFE, 0x00,
+    0x07, 0xF8, 0x00, 0x3C, 0xE0, 0x3D, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFD, 0xF8, 0xF8, 0xF8, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF8,
+    0xF8, 0xFD, 0xF8, 0x7F, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x01, 0x8C, 0x00, 0x03, 0xCE, 0x00, 0x03,
+    0xDE, 0x00, 0x07, 0xBC, 0x00, 0x07, 0x38, 0x00, 0x06, 0x30, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8,
+    0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0x3F, 0x00, 0x7C, 0x0F, 0x80, 0xF8, 0x0F, 0x80,
+    0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8,
+    0x0F, 0x80, 0x7C, 0x0F, 0x80, 0x7F, 0x3F, 0x80, 0x3F, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xF8,
+    0x00, 0x04, 0x20, 0x0E, 0x78, 0x1F, 0xF8, 0x1E, 0xF0, 0x3D, 0xE0, 0x38, 0xC0, 0x00, 0x00, 0x1F,
+    0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFD, 0xF8, 0xF8, 0xF8, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF8,
+    0xF8, 0xFD, 0xF8, 0x7F, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x07, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x3F,
+    0xFF, 0xFE, 0x7F, 0x9E, 0x00, 0x7C, 0x1E, 0x00, 0xF8, 0x1E, 0x00, 0xF8, 0x1E, 0x00, 0xF8, 0x1F,
+    0xFC, 0xF8, 0x1F, 0xFC, 0xF8, 0x1F, 0xFC, 0xF8, 0x1E, 0x00, 0xF8, 0x1E, 0x00, 0x7C, 0x1E, 0x00,
+    0x7F, 0x9E, 0x00, 0x3F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x07, 0xFF, 0xFE, 0x1F, 0xCF, 0xE0, 0x3F,
+    0xFF, 0xF0, 0x7F, 0xFF, 0xF8, 0xFD, 0xFC, 0xF8, 0xF8, 0xF8, 0x78, 0xF0, 0x7F, 0xFC, 0xF0, 0x7F,
+    0xFC, 0xF0, 0x7F, 0xFC, 0xF8, 0xF8, 0x00, 0xFD, 0xFE, 0x30, 0x7F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF8,
+    0x1F, 0xCF, 0xF8, 0x03, 0x00, 0x07, 0x80, 0x0F, 0x80, 0x1F, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0x00,
+    0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0xFF, 0xF8, 0xF1, 0xF8, 0xF0, 0xF8, 0xF0, 0x78, 0xF0, 0xF8, 0xF1,
+    0xF8, 0xFF, 0xF8, 0xFF, 0xF0, 0xFF, 0xE0, 0xF3, 0xE0, 0xF1, 0xF0, 0xF1, 0xF8, 0xF0, 0xF8, 0xF0,
+    0xFC, 0xF0, 0x7C, 0x06, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x3C, 0x00, 0x18, 0x00, 0x00,
+    0x00, 0x7F, 0xC0, 0xFF, 0x80, 0xFF, 0x80, 0xF9, 0x80, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0xFF,
+    0xF8, 0xF1, 0xF8, 0xF0, 0xF8, 0xF0, 0x78, 0xF0, 0xF8, 0xF1, 0xF8, 0xFF, 0xF8, 0xFF, 0xF0, 0xFF,
+    0xE0, 0xF3, 0xE0, 0xF1, 0xF0, 0xF1, 0xF8, 0xF0, 0xF8, 0xF0, 0xFC, 0xF0, 0x7C, 0x00, 0x00, 0x07,
+    0x80, 0x07, 0x80, 0x1F, 0x00, 0x1F, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x7F, 0xC0, 0x7C, 0xC0, 0x7C,
+    0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0x19, 0x80, 0x3F, 0xC0, 0x1F,
+    0x80, 0x0F, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0xFF, 0xF8, 0xF1,
+    0xF8, 0xF0, 0xF8, 0xF0, 0x78, 0xF0, 0xF8, 0xF1, 0xF8, 0xFF, 0xF8, 0xFF, 0xF0, 0xFF, 0xE0, 0xF3,
+    0xE0, 0xF1, 0xF0, 0xF1, 0xF8, 0xF0, 0xF8, 0xF0, 0xFC, 0xF0, 0x7C, 0x33, 0x80, 0x7F, 0x80, 0x3F,
+    0x80, 0x1E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x80, 0xFF, 0x80, 0xF9,
+    0x80, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+    0x00, 0xF8, 0x00, 0x00, 0xC0, 0x01, 0xE0, 0x03, 0xE0, 0x07, 0xC0, 0x07, 0x80, 0x03, 0x00, 0x00,
+    0x00, 0x0F, 0xF0, 0x3F, 0xF8, 0x7F, 0xF8, 0x7E, 0x70, 0x7C, 0x00, 0x7C, 0x00, 0x7F, 0x80, 0x3F,
+    0xE0, 0x1F, 0xF0, 0x0F, 0xF8, 0x01, 0xFC, 0x00, 0x7C, 0x00, 0x7C, 0x78, 0xFC, 0x7F, 0xF8, 0x7F,
+    0xF8, 0x3F, 0xE0, 0x03, 0x00, 0x03, 0xC0, 0x07, 0xC0, 0x0F, 0x80, 0x0F, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x1F, 0xE0, 0x3F, 0xE0, 0x7F, 0xC0, 0x7C, 0xC0, 0x7F, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x3F,
+    0xE0, 0x03, 0xE0, 0x71, 0xE0, 0x7F, 0xE0, 0x7F, 0xC0, 0x7F, 0x80, 0x03, 0x80, 0x07, 0xC0, 0x0F,
+    0xE0, 0x0F, 0xF0, 0x0C, 0x60, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xF8, 0x7F, 0xF8, 0x7E, 0x70, 0x7C,
+    0x00, 0x7C, 0x00, 0x7F, 0x80, 0x3F, 0xE0, 0x1F, 0xF0, 0x0F, 0xF8, 0x01, 0xFC, 0x00, 0x7C, 0x00,
+    0x7C, 0x78, 0xFC, 0x7F, 0xF8, 0x7F, 0xF8, 0x3F, 0xE0, 0x07, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x3F,
+    0xC0, 0x18, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x3F, 0xE0, 0x7F, 0xC0, 0x7C, 0xC0, 0x7F, 0x00, 0x7F,
+    0xE0, 0x7F, 0xE0, 0x3F, 0xE0, 0x03, 0xE0, 0x71, 0xE0, 0x7F, 0xE0, 0x7F, 0xC0, 0x7F, 0x80, 0x0F,
+    0xF0, 0x3F, 0xF8, 0x7F, 0xF8, 0x7E, 0x70, 0x7C, 0x00, 0x7C, 0x00, 0x7F, 0x80, 0x3F, 0xE0, 0x1F,
+    0xF0, 0x0F, 0xF8, 0x01, 0xFC, 0x00, 0x7C, 0x00, 0x7C, 0x78, 0xFC, 0x7F, 0xF8, 0x7F, 0xF8, 0x3F,
+    0xE0, 0x07, 0x80, 0x07, 0xC0, 0x0B, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x1F, 0xE0, 0x3F, 0xE0, 0x7F,
+    0xC0, 0x7C, 0xC0, 0x7F, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x3F, 0xE0, 0x03, 0xE0, 0x71, 0xE0, 0x7F,
+    0xE0, 0x7F, 0xE0, 0x7F, 0x80, 0x0E, 0x00, 0x0F, 0x00, 0x17, 0x80, 0x3F, 0x00, 0x3F, 0x00, 0x0C,
+    0x60, 0x0F, 0xF0, 0x0F, 0xE0, 0x07, 0xC0, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x3F,
+    0xF8, 0x7F, 0xF8, 0x7E, 0x70, 0x7C, 0x00, 0x7C, 0x00, 0x7F, 0x80, 0x3F, 0xE0, 0x1F, 0xF0, 0x0F,
+    0xF8, 0x01, 0xFC, 0x00, 0x7C, 0x00, 0x7C, 0x78, 0xFC, 0x7F, 0xF8, 0x7F, 0xF8, 0x3F, 0xE0, 0x18,
+    0xC0, 0x3F, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x3F,
+    0xE0, 0x7F, 0xC0, 0x7C, 0xC0, 0x7F, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x3F, 0xE0, 0x03, 0xE0, 0x71,
+    0xE0, 0x7F, 0xE0, 0x7F, 0xC0, 0x7F, 0x80, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0x07, 0xC0, 0x07,
+    0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07,
+    0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x03, 0x80, 0x07, 0x80, 0x03, 0xC0, 0x03,
+    0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0x80, 0xFF,
+    0x80, 0xFF, 0x80, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFC,
+    0x80, 0x7F, 0x80, 0x7F, 0xC0, 0x3F, 0xC0, 0x0E, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x3F, 0x00, 0x3E,
+    0x00, 0x0C, 0x60, 0x0F, 0xF0, 0x0F, 0xE0, 0x07, 0xC0, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07,
+    0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07,
+    0xC0, 0x07, 0x80, 0x07, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x00, 0xF8, 0x00, 0xFF, 0x80, 0xFF,
+    0x80, 0xFF, 0x80, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFC,
+    0x80, 0x7F, 0x80, 0x7F, 0xC0, 0x3F, 0x80, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0x07, 0xC0, 0x07,
+    0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x07, 0xC0, 0x07, 0xC0, 0x07,
+    0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+    0x00, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0xF8,
+    0x00, 0xF8, 0x00, 0xFC, 0x80, 0x7F, 0x80, 0x7F, 0xC0, 0x3F, 0x80, 0x0F, 0xB0, 0x0F, 0xF8, 0x1F,
+    0xF0, 0x0D, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8,
+    0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0x7C,
+    0x3E, 0x7E, 0x7E, 0x7F, 0xFC, 0x3F, 0xF8, 0x0F, 0xF0, 0x1E, 0xE0, 0x3F, 0xE0, 0x7F, 0xE0, 0x37,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8,
+    0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0x7C, 0xF0, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x1F,
+    0xF0, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8,
+    0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8,
+    0x1E, 0xF8, 0x1E, 0x7C, 0x3E, 0x7E, 0x7E, 0x7F, 0xFC, 0x3F, 0xF8, 0x0F, 0xF0, 0x3F, 0xE0, 0x3F,
+    0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8,
+    0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0x7C, 0xF0, 0x7F, 0xF0, 0x3F,
+    0xF0, 0x1F, 0xF0, 0x1E, 0x70, 0x0E, 0xF0, 0x0F, 0xE0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8,
+    0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0x7C, 0x3E, 0x7E, 0x7E, 0x7F, 0xFC, 0x3F, 0xF8, 0x0F,
+    0xF0, 0x39, 0xE0, 0x3D, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF0, 0xF8,
+    0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0x7C,
+    0xF0, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x03, 0xC0, 0x07, 0xE0, 0x06, 0xE0, 0x06, 0xE0, 0x07,
+    0xE0, 0x03, 0xC0, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8,
+    0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0x7C, 0x3E, 0x7E, 0x7E, 0x7F,
+    0xFC, 0x3F, 0xF8, 0x0F, 0xF0, 0x0F, 0x80, 0x1F, 0x80, 0x1D, 0xC0, 0x1D, 0xC0, 0x1F, 0x80, 0x0F,
+    0x80, 0x00, 0x00, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8,
+    0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0x7C, 0xF0, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x03, 0x18, 0x07,
+    0xBC, 0x07, 0xBC, 0x0F, 0x78, 0x0E, 0x70, 0x0C, 0x60, 0x00, 0x00, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8,
+    0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8,
+    0x1E, 0xF8, 0x1E, 0x7C, 0x3E, 0x7E, 0x7E, 0x7F, 0xFC, 0x3F, 0xF8, 0x0F, 0xF0, 0x0C, 0x60, 0x0E,
+    0x70, 0x1E, 0xF0, 0x1C, 0xE0, 0x3D, 0xE0, 0x39, 0xC0, 0x00, 0x00, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8,
+    0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0x7C, 0xF0, 0x7F,
+    0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8,
+    0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0x7C, 0x3E, 0x7E,
+    0x7E, 0x7F, 0xFC, 0x3F, 0xF8, 0x0F, 0xF0, 0x01, 0xC0, 0x03, 0xC0, 0x03, 0xF0, 0x03, 0xF0, 0x03,
+    0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8,
+    0xF0, 0xF8, 0xF0, 0x7C, 0xF0, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x03,
+    0xF0, 0x03, 0xF0, 0x01, 0xF0, 0x00, 0x18, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xE6, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x1E, 0xF8, 0x00, 0x1E, 0x7C, 0x3C, 0x3E,
     0x7C, 0x7C, 0x3E, 0x7C, 0x7E, 0x3E, 0x7C, 0x7E, 0x3C, 0x3C, 0x7E, 0x3C, 0x3E, 0xFF, 0x7C, 0x3E,
     0xFF, 0x7C, 0x3E, 0xEF, 0x78, 0x1F, 0xE7, 0xF8, 0x1F, 0xE7, 0xF8, 0x1F, 0xC7, 0xF0, 0x1F, 0xC3,
-    0xF0, 0x0F, 0xC3, 0xF0, 0x0F, 0x83, 0xF0, 0x0F, 0x81, 0xE0, 0xFC, 0x1F, 0x3F, 0x1F, 0x8F, 0x8F,
-    0x87, 0xEF, 0x81, 0xFF, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x0F, 0xE0, 0x03, 0xE0, 0x03, 0xF8, 0x03,
-    0xFE, 0x03, 0xFF, 0x81, 0xF7, 0xC1, 0xF3, 0xF1, 0xF8, 0xFC, 0xF8, 0x3E, 0xF8, 0x1F, 0x80, 0xF8,
-    0x1F, 0xBE, 0x0F, 0x9F, 0x0F, 0x87, 0xC7, 0xC3, 0xE7, 0xC0, 0xFB, 0xE0, 0x7F, 0xE0, 0x1F, 0xF0,
-    0x07, 0xF0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07,
-    0xC0, 0x03, 0xE0, 0x00, 0x7F, 0xFE, 0xFF, 0xFD, 0xFF, 0xF0, 0x07, 0xE0, 0x1F, 0x80, 0x3E, 0x00,
-    0xF8, 0x03, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFE, 0xFE, 0xFE, 0xF8, 0x07, 0xC0,
-    0x1E, 0x00, 0xF8, 0x07, 0xC0, 0x1E, 0x00, 0xF8, 0x07, 0xC0, 0x1E, 0x00, 0xF8, 0x03, 0xC0, 0x1E,
-    0x00, 0xF8, 0x03, 0xC0, 0x1E, 0x00, 0xF8, 0x03, 0xC0, 0x1E, 0x00, 0xF8, 0x03, 0xC0, 0x1E, 0x00,
-    0xF8, 0x03, 0xC0, 0x1E, 0x00, 0xF8, 0xFE, 0xFE, 0xFE, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
-    0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0xFE, 0xFE, 0xFE, 0x07,
-    0x80, 0x3F, 0x00, 0xFE, 0x07, 0xF8, 0x3F, 0xF0, 0xFB, 0xC7, 0xCF, 0x9E, 0x1F, 0xF8, 0x7C, 0xC0,
-    0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0xF1, 0xE1, 0xE1, 0xC1, 0x80, 0x3F, 0xC1, 0xFF, 0x8F,
-    0xFC, 0x63, 0xE0, 0x0F, 0x8F, 0xFD, 0xFF, 0xEF, 0xFF, 0x7C, 0xFB, 0xE7, 0xDF, 0xFE, 0xFF, 0xF3,
-    0xFF, 0x00, 0x78, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xFF, 0x1F, 0xFE, 0xFF,
-    0xF7, 0xEF, 0xFE, 0x3F, 0xF0, 0xFF, 0x87, 0xFC, 0x3F, 0xE3, 0xFF, 0x3F, 0xFF, 0xF7, 0xFF, 0x1F,
-    0xF0, 0x1F, 0xE7, 0xFD, 0xFF, 0x7E, 0x6F, 0x81, 0xE0, 0x3C, 0x07, 0x80, 0xF8, 0x1F, 0x8D, 0xFF,
-    0x9F, 0xF1, 0xFE, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x7F, 0xEF, 0xFF,
-    0x7F, 0xFF, 0xEF, 0xFE, 0x3F, 0xE1, 0xFF, 0x0F, 0xF8, 0x7F, 0xE3, 0xFF, 0x9F, 0x7F, 0xF9, 0xFF,
-    0xC7, 0xFC, 0x1F, 0xC1, 0xFF, 0x1F, 0xFD, 0xFB, 0xEF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x07, 0xE3, 0x9F, 0xFC, 0x7F, 0xE1, 0xFF, 0x00, 0x1F, 0xCF, 0xF7, 0xFD, 0xF2, 0xF8, 0x3E, 0x0F,
-    0xFB, 0xFE, 0xFF, 0xBE, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x80,
-    0x1F, 0xF1, 0xFF, 0x9F, 0xFD, 0xF9, 0xEF, 0x8F, 0x78, 0x7B, 0xC3, 0xDE, 0x1E, 0xF8, 0xF7, 0xEF,
-    0x9F, 0xFC, 0xFF, 0xE3, 0xFF, 0x00, 0x79, 0xC7, 0xCF, 0xFE, 0x7F, 0xE3, 0xFE, 0x00, 0x78, 0x07,
-    0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xFF, 0x1F, 0xFC, 0xFF, 0xF7, 0xCF, 0xBE, 0x3D,
-    0xF1, 0xEF, 0x8F, 0x7C, 0x7B, 0xE3, 0xDF, 0x1E, 0xF8, 0xF7, 0xC7, 0xBE, 0x3C, 0x7F, 0xFE, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0x1F, 0x1F, 0x0F, 0x00, 0x00, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0xFE, 0xFE,
-    0xFC, 0x78, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x8F, 0xBE, 0x7C, 0xFB,
-    0xE3, 0xFF, 0x0F, 0xF8, 0x3F, 0xC0, 0xFF, 0x83, 0xFF, 0x0F, 0xFE, 0x3E, 0xF8, 0xF9, 0xF3, 0xE3,
-    0xEF, 0x8F, 0x80, 0x79, 0xF3, 0xE7, 0xCF, 0x9F, 0x3E, 0x7C, 0xF9, 0xF3, 0xE7, 0xCF, 0x9F, 0x3E,
-    0x7E, 0x7E, 0xFC, 0xF0, 0x7F, 0x9F, 0x9F, 0xFF, 0xFB, 0xFF, 0xFF, 0xFC, 0xFD, 0xFF, 0x9F, 0x1F,
-    0xF1, 0xE3, 0xFE, 0x3C, 0x7F, 0xC7, 0x8F, 0xF8, 0xF1, 0xFF, 0x1E, 0x3F, 0xE3, 0xC7, 0xFC, 0x78,
-    0xFF, 0x8F, 0x1E, 0x7F, 0xC7, 0xFF, 0x3F, 0xFD, 0xF3, 0xEF, 0x8F, 0x7C, 0x7B, 0xE3, 0xDF, 0x1E,
-    0xF8, 0xF7, 0xC7, 0xBE, 0x3D, 0xF1, 0xEF, 0x8F, 0x00, 0x1F, 0xC0, 0xFF, 0x87, 0xFF, 0x3F, 0x7E,
-    0xF8, 0xFB, 0xC1, 0xEF, 0x07, 0xBC, 0x1E, 0xF8, 0xFB, 0xF7, 0xE7, 0xFF, 0x0F, 0xF8, 0x1F, 0xC0,
-    0x7F, 0xC7, 0xFF, 0x3F, 0xFD, 0xF3, 0xFF, 0x8F, 0xFC, 0x3F, 0xE1, 0xFF, 0x0F, 0xF8, 0xFF, 0xEF,
-    0xFF, 0xFD, 0xFF, 0xEF, 0xFC, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0x1F, 0xF1,
-    0xFF, 0xDF, 0xFF, 0xF9, 0xFF, 0x8F, 0xF8, 0x7F, 0xC3, 0xFE, 0x1F, 0xF8, 0xFF, 0xE7, 0xDF, 0xFE,
-    0xFF, 0xF1, 0xFF, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x7F, 0xFF, 0xEF, 0xFB,
-    0xE6, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x00, 0x1F, 0xE3, 0xFE,
-    0x7F, 0xC7, 0xCC, 0x7F, 0x07, 0xFE, 0x7F, 0xE3, 0xFE, 0x03, 0xE7, 0x1E, 0x7F, 0xE7, 0xFC, 0x7F,
-    0x80, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xFF, 0xBF, 0xEF, 0xFB, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0,
-    0xF8, 0x3F, 0x27, 0xF9, 0xFF, 0x3F, 0x80, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F,
-    0xF8, 0xFF, 0x8F, 0xF8, 0xF7, 0xCF, 0x7F, 0xF3, 0xFF, 0x1F, 0xF0, 0xF8, 0x7F, 0xE1, 0xE7, 0x87,
-    0x9F, 0x3E, 0x7C, 0xF0, 0xF3, 0xC3, 0xDF, 0x0F, 0xF8, 0x1F, 0xE0, 0x7F, 0x00, 0xFC, 0x03, 0xF0,
-    0x07, 0x80, 0xF8, 0xF1, 0xFF, 0x8F, 0x1E, 0x78, 0xF1, 0xE7, 0x9F, 0x3E, 0x7D, 0xFB, 0xC3, 0xDF,
-    0xBC, 0x3F, 0xFB, 0xC3, 0xFF, 0xF8, 0x1F, 0xBF, 0x81, 0xF9, 0xF8, 0x1F, 0x9F, 0x00, 0xF1, 0xF0,
-    0x0F, 0x0F, 0x00, 0xF8, 0x79, 0xF3, 0xE3, 0xFF, 0x0F, 0xF8, 0x1F, 0xE0, 0x3F, 0x00, 0xF8, 0x03,
-    0xF0, 0x1F, 0xE0, 0xFF, 0xC7, 0xCF, 0x1E, 0x3E, 0xF8, 0x7C, 0xF8, 0x7F, 0xE1, 0xE7, 0x87, 0x9F,
-    0x3E, 0x7C, 0xF0, 0xF3, 0xC3, 0xFF, 0x0F, 0xF8, 0x1F, 0xE0, 0x7F, 0x80, 0xFC, 0x03, 0xF0, 0x07,
-    0x80, 0x3E, 0x05, 0xF0, 0x3F, 0xC0, 0xFE, 0x03, 0xF0, 0x00, 0x7F, 0xF7, 0xFF, 0x7F, 0xF0, 0x3E,
-    0x07, 0xC0, 0xF8, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x87,
-    0xE1, 0xF8, 0x7C, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x0F, 0x83, 0xE3, 0xF0, 0xF8, 0x3F, 0x03,
-    0xE0, 0xF8, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0xC1, 0xF8, 0x7E, 0x07, 0x80, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF8, 0x7E, 0x3F, 0x07, 0xC3,
-    0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x07, 0xC3, 0xF0, 0xF8, 0xFC, 0x7C, 0x7C, 0x3E, 0x1F, 0x0F,
-    0x87, 0xC3, 0xE1, 0xF3, 0xF1, 0xF8, 0xF8, 0x00, 0x3E, 0x1D, 0xFE, 0xF7, 0xFF, 0xBD, 0xFE, 0xF1,
-    0xF0, 0x77, 0xFF, 0xF7, 0x01, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0x81, 0xF0,
-    0x3E, 0x0F, 0xF3, 0xFE, 0xFF, 0xBF, 0x37, 0xC0, 0xF0, 0x1E, 0x03, 0xE0, 0x7E, 0x37, 0xFE, 0xFF,
-    0xC7, 0xF8, 0x7C, 0x0F, 0x81, 0xF0, 0x07, 0xF0, 0x7F, 0x87, 0xFC, 0x3E, 0x63, 0xE0, 0x1F, 0x00,
-    0xF8, 0x1F, 0xFC, 0xFF, 0xE7, 0xFF, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1E, 0x00, 0xFF, 0xE7, 0xFF,
-    0x3F, 0xF8, 0x00, 0x00, 0xC0, 0xC7, 0xFF, 0x9F, 0xFF, 0x3F, 0xF8, 0xF3, 0xC3, 0xC7, 0x8F, 0x1E,
-    0x3C, 0xF0, 0xFF, 0xE7, 0xFF, 0xDF, 0xFE, 0x30, 0x30, 0x7C, 0x3E, 0x7C, 0x3E, 0x3E, 0x3C, 0x3E,
-    0x7C, 0x1F, 0x78, 0x1F, 0xF8, 0x0F, 0xF0, 0x0F, 0xF0, 0x3F, 0xFC, 0x3F, 0xFC, 0x03, 0xC0, 0x03,
-    0xC0, 0x3F, 0xFC, 0x3F, 0xFC, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xF1, 0xFF, 0x8F, 0xFC, 0xF8, 0xC7, 0xC0,
-    0x3F, 0x80, 0xFF, 0x07, 0xFC, 0x7F, 0xF3, 0xDF, 0x9E, 0x3C, 0xF1, 0xE7, 0xEF, 0x3F, 0xF8, 0xFF,
-    0x83, 0xFC, 0x07, 0xF0, 0x0F, 0x9C, 0x7C, 0xFF, 0xEF, 0xFE, 0x3F, 0xE0, 0x79, 0xCF, 0x7D, 0xEF,
-    0xBC, 0xE0, 0x07, 0xF8, 0x07, 0xFF, 0x03, 0xF3, 0xF1, 0xF0, 0x3C, 0x7B, 0xF7, 0xBD, 0xFC, 0xEF,
-    0x7F, 0x3F, 0x9E, 0xC7, 0xEF, 0x01, 0xFB, 0xC0, 0x7E, 0x7B, 0x1F, 0xDF, 0xCF, 0xF7, 0xFB, 0x9E,
-    0xFD, 0xE7, 0xC0, 0xF0, 0xFC, 0xFC, 0x1F, 0xFC, 0x01, 0xFE, 0x00, 0x7F, 0x1F, 0xE2, 0x78, 0x7E,
-    0x7F, 0xBF, 0xEF, 0x3B, 0xCE, 0x7F, 0x9F, 0xE0, 0x00, 0x10, 0x1C, 0x78, 0x7C, 0xF1, 0xF3, 0xE7,
-    0xCF, 0x8F, 0x9F, 0x3E, 0x7C, 0x3E, 0x7C, 0x7C, 0xF8, 0x7C, 0xF8, 0x7C, 0xF0, 0x71, 0xE0, 0x81,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0xFF,
-    0xFF, 0xFF, 0x07, 0xF8, 0x07, 0xFF, 0x03, 0xF3, 0xF1, 0xF0, 0x3C, 0x7F, 0xF7, 0xBD, 0xFC, 0xEF,
-    0x77, 0xBF, 0x9D, 0xE7, 0xE7, 0xF9, 0xF9, 0xFC, 0x7E, 0x77, 0x1F, 0xDD, 0xCF, 0xF7, 0x3B, 0x9F,
-    0xCF, 0xE7, 0xC0, 0xF0, 0xFC, 0xFC, 0x1F, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x3E,
-    0x3F, 0xBD, 0xFE, 0xFF, 0x7B, 0xF8, 0xF8, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7E, 0x7F,
-    0x9B, 0xC1, 0xE1, 0xF1, 0xF1, 0xF0, 0xF0, 0x7F, 0x7F, 0x80, 0x7E, 0xFF, 0x6F, 0x0F, 0x3E, 0x3F,
-    0x0F, 0x47, 0xFF, 0xFE, 0x18, 0x78, 0xF3, 0xC7, 0x0C, 0x00, 0xF8, 0xF7, 0xC7, 0xBE, 0x3D, 0xF1,
-    0xEF, 0x8F, 0x7C, 0x7B, 0xE3, 0xDF, 0x1E, 0xF8, 0xF7, 0xE7, 0xBF, 0xFD, 0xFF, 0xEF, 0xFF, 0x7C,
-    0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0x07, 0xF8, 0x7F, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF9, 0xFF, 0xF3, 0xFF, 0xE7, 0xFF, 0xCF, 0xFF, 0x9E, 0xFF, 0x3C, 0xFE, 0x78, 0x7C, 0xF0, 0x79,
-    0xE0, 0xF3, 0xC1, 0xE7, 0x83, 0xCF, 0x07, 0x9E, 0x0F, 0x3C, 0x1E, 0x78, 0x3C, 0xF0, 0x79, 0xE0,
-    0xF3, 0xC1, 0xE7, 0x80, 0x79, 0xFF, 0xDF, 0x78, 0x38, 0xE7, 0xC7, 0xFF, 0xFF, 0x00, 0x1E, 0xFD,
-    0xFB, 0xF0, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x1F, 0x87, 0xF9, 0xEF, 0x38, 0xFF, 0x1F, 0xE3, 0xDC,
-    0x7B, 0xDE, 0x3F, 0xC3, 0xF0, 0x10, 0x00, 0xF1, 0xC1, 0xE7, 0xC3, 0xE7, 0xC3, 0xEF, 0x87, 0xCF,
-    0x87, 0xCF, 0x9F, 0x3E, 0x3E, 0xF8, 0xF9, 0xF1, 0xE7, 0xC3, 0xC7, 0x01, 0x00, 0x00, 0x1E, 0x07,
-    0x81, 0xF8, 0x1E, 0x0F, 0xE0, 0xF0, 0x1F, 0x83, 0xC0, 0x1E, 0x1E, 0x00, 0x78, 0x78, 0x01, 0xE3,
-    0xC0, 0x07, 0x8F, 0x1E, 0x1E, 0x78, 0xF8, 0x79, 0xE7, 0xE0, 0x0F, 0x1F, 0x80, 0x3C, 0xEE, 0x01,
-    0xE7, 0xB8, 0x07, 0x9F, 0xF0, 0x3C, 0x7F, 0xC0, 0xF0, 0x0E, 0x07, 0x80, 0x38, 0x3E, 0x00, 0x00,
-    0x1E, 0x07, 0x03, 0xF0, 0x78, 0x3F, 0x83, 0xC0, 0xFC, 0x3C, 0x01, 0xE3, 0xE0, 0x0F, 0x1E, 0x00,
-    0x79, 0xF0, 0x03, 0xCF, 0x7E, 0x1E, 0xFF, 0xF8, 0xF7, 0x9B, 0xC0, 0x7C, 0x1E, 0x03, 0xC1, 0xF0,
-    0x3E, 0x1F, 0x01, 0xE1, 0xF0, 0x1F, 0x0F, 0x00, 0xF0, 0xFF, 0x0F, 0x87, 0xF8, 0x78, 0x00, 0x00,
-    0x7E, 0x03, 0xC1, 0xFC, 0x1E, 0x06, 0xF0, 0x78, 0x03, 0xC3, 0xC0, 0x3E, 0x0F, 0x00, 0xFC, 0x78,
-    0x00, 0x71, 0xE0, 0x19, 0xCF, 0x1E, 0xFF, 0x3C, 0xFB, 0xF9, 0xE7, 0xE0, 0x07, 0x9F, 0x80, 0x3C,
-    0xEE, 0x00, 0xF7, 0xB8, 0x07, 0x9F, 0xF0, 0x1E, 0x7F, 0xC0, 0xF0, 0x0E, 0x03, 0xC0, 0x38, 0x1E,
-    0x00, 0x00, 0x0F, 0x01, 0xF0, 0x3E, 0x07, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0x78, 0x1F, 0x03, 0xE0,
-    0xF8, 0x3E, 0x0F, 0x81, 0xF0, 0x3F, 0x73, 0xFF, 0x7F, 0xE7, 0xF8, 0x01, 0x80, 0x00, 0xF0, 0x00,
-    0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF0, 0x00, 0x18, 0x00, 0x00, 0x00, 0x07, 0x80, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x0F, 0xFC, 0x03, 0xCF, 0x01, 0xF3, 0xE0, 0x78, 0xF8, 0x1E,
-    0x1E, 0x0F, 0xFF, 0xC3, 0xFF, 0xF0, 0xFF, 0xFE, 0x7C, 0x0F, 0x9F, 0x03, 0xEF, 0x80, 0x7F, 0xE0,
-    0x1F, 0x00, 0x60, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x03, 0xC0, 0x00, 0x60, 0x00, 0x00,
-    0x00, 0x07, 0x80, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x0F, 0xFC, 0x03, 0xCF,
-    0x01, 0xF3, 0xE0, 0x78, 0xF8, 0x1E, 0x1E, 0x0F, 0xFF, 0xC3, 0xFF, 0xF0, 0xFF, 0xFE, 0x7C, 0x0F,
-    0x9F, 0x03, 0xEF, 0x80, 0x7F, 0xE0, 0x1F, 0x00, 0xC0, 0x00, 0x78, 0x00, 0x3F, 0x00, 0x1F, 0xE0,
-    0x03, 0x30, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x01, 0xFE, 0x00, 0x7F, 0x80,
-    0x3F, 0xF0, 0x0F, 0x3C, 0x07, 0xCF, 0x81, 0xE3, 0xE0, 0x78, 0x78, 0x3F, 0xFF, 0x0F, 0xFF, 0xC3,
-    0xFF, 0xF9, 0xF0, 0x3E, 0x7C, 0x0F, 0xBE, 0x01, 0xFF, 0x80, 0x7C, 0x03, 0xD8, 0x01, 0xFF, 0x00,
-    0xFF, 0x80, 0x1B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x01,
-    0xFE, 0x00, 0x7F, 0x80, 0x3F, 0xF0, 0x0F, 0x3C, 0x07, 0xCF, 0x81, 0xE3, 0xE0, 0x78, 0x78, 0x3F,
-    0xFF, 0x0F, 0xFF, 0xC3, 0xFF, 0xF9, 0xF0, 0x3E, 0x7C, 0x0F, 0xBE, 0x01, 0xFF, 0x80, 0x7C, 0x0F,
-    0x38, 0x03, 0xDF, 0x00, 0xF7, 0xC0, 0x3C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0xF0, 0x0F, 0x3C, 0x07, 0xCF, 0x81, 0xE3,
-    0xE0, 0x78, 0x78, 0x3F, 0xFF, 0x0F, 0xFF, 0xC3, 0xFF, 0xF9, 0xF0, 0x3E, 0x7C, 0x0F, 0xBE, 0x01,
-    0xFF, 0x80, 0x7C, 0x01, 0xE0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0xFF, 0xC0, 0x3C, 0xF0, 0x1F, 0x3E,
-    0x07, 0x8F, 0x81, 0xE1, 0xE0, 0xFF, 0xFC, 0x3F, 0xFF, 0x1F, 0xFF, 0xE7, 0xC0, 0xF9, 0xE0, 0x3E,
-    0xF8, 0x07, 0xFE, 0x01, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0xFF,
-    0x00, 0x01, 0xFF, 0x00, 0x01, 0xEF, 0x00, 0x03, 0xEF, 0x00, 0x07, 0xCF, 0xFE, 0x07, 0xCF, 0xFE,
-    0x0F, 0x8F, 0xFE, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x3E, 0x0F, 0x00, 0x7C,
-    0x0F, 0xFF, 0x7C, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0x07, 0xFC, 0x3F, 0xFC, 0xFF, 0xF3, 0xF8, 0xE7,
-    0xC0, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x07, 0xC0,
-    0x0F, 0xE3, 0x8F, 0xFF, 0x8F, 0xFF, 0x07, 0xFC, 0x03, 0x80, 0x07, 0x80, 0x07, 0x00, 0x7E, 0x00,
-    0xF8, 0x00, 0x0C, 0x00, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x78, 0x01, 0x80, 0x00, 0x1F, 0xFE, 0xFF,
-    0xF7, 0xFF, 0xBC, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xFF, 0x9F, 0xFC, 0xFF, 0xE7, 0x80, 0x3C,
-    0x01, 0xE0, 0x0F, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x3C, 0x03, 0xE0, 0x3E, 0x01,
-    0xE0, 0x06, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 0xF7, 0xFF, 0xBC, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03,
-    0xFF, 0x9F, 0xFC, 0xFF, 0xE7, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x06, 0x00, 0x78, 0x0F, 0xE0, 0x7F, 0x83, 0x98, 0x00, 0x03, 0xFF, 0xDF, 0xFE, 0xFF, 0xF7, 0x80,
-    0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x7F, 0xF3, 0xFF, 0x9F, 0xFC, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x79, 0xC3, 0xDF, 0x1E, 0xF8, 0xF3, 0x80, 0x00, 0x00, 0x03,
-    0xFF, 0xDF, 0xFE, 0xFF, 0xF7, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x7F, 0xF3, 0xFF, 0x9F, 0xFC,
-    0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x30, 0xF1, 0xF1, 0xF1,
-    0xE1, 0x80, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F,
-    0x1E, 0x18, 0x79, 0xF7, 0xCF, 0x0C, 0x00, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x78,
-    0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x18, 0x3C, 0x7E, 0xFF, 0x66, 0x00, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0xF3, 0xFC, 0xFF,
-    0x3F, 0xCF, 0x00, 0x00, 0x01, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0,
-    0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x3F, 0xF8, 0x0F, 0xFF, 0x83, 0xFF,
-    0xF0, 0xF9, 0xFE, 0x3E, 0x0F, 0x8F, 0x83, 0xE3, 0xE0, 0x7F, 0xFF, 0x1F, 0xFF, 0xC7, 0xFF, 0xF1,
-    0xF3, 0xE0, 0x7C, 0xF8, 0x3E, 0x3E, 0x1F, 0x8F, 0x9F, 0xC3, 0xFF, 0xF0, 0xFF, 0xF0, 0x3F, 0xF8,
-    0x00, 0x0F, 0x70, 0x3F, 0xE0, 0x7F, 0xC0, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x07, 0xFC, 0x0F,
-    0xFC, 0x1F, 0xFC, 0x3F, 0xFC, 0x7F, 0xF8, 0xFF, 0xF9, 0xFE, 0xFB, 0xFD, 0xF7, 0xF9, 0xFF, 0xF1,
-    0xFF, 0xE1, 0xFF, 0xC3, 0xFF, 0x83, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x07, 0x80, 0x01, 0x80, 0x00,
-    0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF0, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x1F,
-    0xFE, 0x0F, 0xFF, 0xC7, 0xF3, 0xF1, 0xF0, 0x3E, 0xF8, 0x0F, 0xBE, 0x01, 0xFF, 0x80, 0x7F, 0xE0,
-    0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0xF9, 0xF0, 0x3E, 0x7F, 0x3F, 0x8F, 0xFF, 0xC1, 0xFF,
-    0xE0, 0x1F, 0xE0, 0x00, 0x60, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x03, 0xC0, 0x00, 0x60,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xFE, 0x0F, 0xFF, 0xC7, 0xF3, 0xF1, 0xF0, 0x3E, 0xF8, 0x0F,
-    0xBE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0xF9, 0xF0, 0x3E,
-    0x7F, 0x3F, 0x8F, 0xFF, 0xC1, 0xFF, 0xE0, 0x1F, 0xE0, 0x00, 0xC0, 0x00, 0x78, 0x00, 0x7F, 0x00,
-    0x1F, 0xE0, 0x07, 0x30, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0xF8, 0x3F, 0xFF, 0x1F, 0xCF, 0xC7,
-    0xC0, 0xFB, 0xE0, 0x3E, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE,
-    0x03, 0xE7, 0xC0, 0xF9, 0xFC, 0xFE, 0x3F, 0xFF, 0x07, 0xFF, 0x80, 0x7F, 0x80, 0x07, 0xD8, 0x01,
-    0xFF, 0x00, 0xFF, 0x80, 0x1B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0xF8, 0x3F,
-    0xFF, 0x1F, 0xCF, 0xC7, 0xC0, 0xFB, 0xE0, 0x3E, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0,
-    0x1F, 0xF8, 0x07, 0xFE, 0x03, 0xE7, 0xC0, 0xF9, 0xFC, 0xFE, 0x3F, 0xFF, 0x07, 0xFF, 0x80, 0x7F,
-    0x80, 0x0F, 0x38, 0x03, 0xDF, 0x00, 0xF7, 0xC0, 0x3C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x7F, 0xF8, 0x3F, 0xFF, 0x1F, 0xCF, 0xC7, 0xC0, 0xFB, 0xE0, 0x3E, 0xF8, 0x07, 0xFE, 0x01,
-    0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x03, 0xE7, 0xC0, 0xF9, 0xFC, 0xFE, 0x3F, 0xFF,
-    0x07, 0xFF, 0x80, 0x7F, 0x80, 0x30, 0xC7, 0x9E, 0xFF, 0xF7, 0xFE, 0x3F, 0xC1, 0xF8, 0x3F, 0xC7,
-    0xFE, 0xFF, 0xF7, 0x9E, 0x30, 0xC0, 0x00, 0x03, 0x01, 0xFF, 0xE1, 0xFF, 0xF8, 0xFF, 0xFC, 0x7F,
-    0x3F, 0x1F, 0x0F, 0xEF, 0x87, 0xFB, 0xE3, 0xFF, 0xF8, 0xF7, 0xFE, 0x79, 0xFF, 0xBC, 0x7F, 0xFE,
-    0x1F, 0xFF, 0x8F, 0x9F, 0xC3, 0xE7, 0xF3, 0xF8, 0xFF, 0xFC, 0x7F, 0xFE, 0x1F, 0xFE, 0x03, 0x00,
-    0x00, 0x06, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3C, 0x00, 0x30, 0x00, 0x00, 0x7C, 0x0F,
-    0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8,
-    0x1F, 0xF0, 0x3F, 0xE0, 0x7B, 0xE1, 0xF7, 0xE7, 0xEF, 0xFF, 0x8F, 0xFE, 0x07, 0xF8, 0x00, 0xC0,
-    0x03, 0xC0, 0x0F, 0x80, 0x3E, 0x00, 0x78, 0x00, 0x60, 0x00, 0x00, 0x7C, 0x0F, 0xF8, 0x1F, 0xF0,
-    0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F,
-    0xE0, 0x7B, 0xE1, 0xF7, 0xE7, 0xEF, 0xFF, 0x8F, 0xFE, 0x07, 0xF8, 0x01, 0x80, 0x07, 0x80, 0x3F,
-    0x80, 0x7F, 0x80, 0xE6, 0x00, 0x00, 0x3E, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F,
-    0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3D, 0xF0, 0xFB, 0xF3,
-    0xF7, 0xFF, 0xC7, 0xFF, 0x03, 0xFC, 0x00, 0x1E, 0x70, 0x3D, 0xF0, 0x7B, 0xE0, 0xF3, 0x80, 0x00,
-    0x00, 0x00, 0x3E, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF,
-    0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3D, 0xF0, 0xFB, 0xF3, 0xF7, 0xFF, 0xC7, 0xFF,
-    0x03, 0xFC, 0x00, 0x00, 0x60, 0x00, 0x78, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x0C, 0x00,
-    0x00, 0x01, 0xF0, 0x3F, 0x7C, 0x1F, 0x3E, 0x1F, 0x0F, 0x8F, 0x87, 0xCF, 0x81, 0xF7, 0xC0, 0xFF,
-    0xC0, 0x3F, 0xE0, 0x0F, 0xE0, 0x07, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00,
-    0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0xF0, 0x03, 0xC0, 0x0F, 0xFC, 0x3F, 0xFC, 0xFF, 0xFB, 0xC7,
-    0xEF, 0x0F, 0xBC, 0x1F, 0xF0, 0x7F, 0xC3, 0xEF, 0x1F, 0xBF, 0xFE, 0xFF, 0xF3, 0xFF, 0x0F, 0x00,
-    0x3C, 0x00, 0xF0, 0x00, 0x1F, 0xC0, 0x7F, 0xE1, 0xFF, 0xC3, 0xE7, 0xC7, 0x8F, 0x9F, 0x1E, 0x3E,
-    0x7C, 0x7C, 0xF0, 0xFB, 0xC1, 0xF7, 0x83, 0xEF, 0xC7, 0xDF, 0xCF, 0x9F, 0xDF, 0x0F, 0xFE, 0x0F,
-    0xFD, 0x9F, 0xFB, 0xFF, 0xF7, 0xFB, 0xEF, 0xE0, 0x06, 0x00, 0x78, 0x03, 0xE0, 0x0F, 0x00, 0x38,
-    0x00, 0xC0, 0x00, 0x07, 0xF8, 0x3F, 0xF1, 0xFF, 0x8C, 0x7C, 0x01, 0xF1, 0xFF, 0xBF, 0xFD, 0xFF,
-    0xEF, 0x9F, 0x7C, 0xFB, 0xFF, 0xDF, 0xFE, 0x7F, 0xE0, 0x01, 0x80, 0x1E, 0x01, 0xF0, 0x1F, 0x00,
-    0xF0, 0x03, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0xF1, 0xFF, 0x8C, 0x7C, 0x01, 0xF1, 0xFF, 0xBF, 0xFD,
-    0xFF, 0xEF, 0x9F, 0x7C, 0xFB, 0xFF, 0xDF, 0xFE, 0x7F, 0xE0, 0x07, 0x00, 0x7C, 0x07, 0xF0, 0x7F,
-    0xC1, 0x8C, 0x00, 0x00, 0xFF, 0x07, 0xFE, 0x3F, 0xF1, 0x8F, 0x80, 0x3E, 0x3F, 0xF7, 0xFF, 0xBF,
-    0xFD, 0xF3, 0xEF, 0x9F, 0x7F, 0xFB, 0xFF, 0xCF, 0xFC, 0x1F, 0x61, 0xFF, 0x8F, 0xF8, 0x37, 0x80,
-    0x00, 0x00, 0x00, 0xFF, 0x07, 0xFE, 0x3F, 0xF1, 0x8F, 0x80, 0x3E, 0x3F, 0xF7, 0xFF, 0xBF, 0xFD,
-    0xF3, 0xEF, 0x9F, 0x7F, 0xFB, 0xFF, 0xCF, 0xFC, 0x3C, 0xE1, 0xEF, 0x8F, 0x7C, 0x79, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0x07, 0xFE, 0x3F, 0xF1, 0x8F, 0x80, 0x3E, 0x3F, 0xF7, 0xFF, 0xBF, 0xFD, 0xF3,
-    0xEF, 0x9F, 0x7F, 0xFB, 0xFF, 0xCF, 0xFC, 0x07, 0x80, 0x7E, 0x03, 0x70, 0x1F, 0x80, 0xFC, 0x03,
-    0xC0, 0x00, 0x07, 0xF8, 0x3F, 0xF1, 0xFF, 0x8C, 0x7C, 0x01, 0xF1, 0xFF, 0xBF, 0xFD, 0xFF, 0xEF,
-    0x9F, 0x7C, 0xFB, 0xFF, 0xDF, 0xFE, 0x7F, 0xE0, 0x3F, 0xCF, 0xC1, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC,
-    0x63, 0xFB, 0xF0, 0x0F, 0x87, 0x8F, 0xFF, 0xFD, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x7C, 0xF8, 0x03,
-    0xE3, 0xF3, 0x9F, 0xFF, 0xFC, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x00, 0x1F, 0xE7, 0xFD, 0xFF, 0x7E,
-    0x6F, 0x81, 0xE0, 0x3C, 0x07, 0x80, 0xF8, 0x1F, 0x8D, 0xFF, 0x9F, 0xF0, 0xFE, 0x1E, 0x01, 0xE0,
-    0x3C, 0x1F, 0x83, 0xE0, 0x0C, 0x00, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x78, 0x01, 0x80, 0x00, 0x03,
-    0xF8, 0x3F, 0xE3, 0xFF, 0xBF, 0x7D, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFC, 0x73,
-    0xFF, 0x8F, 0xFC, 0x3F, 0xE0, 0x03, 0x00, 0x3C, 0x03, 0xE0, 0x1E, 0x00, 0xE0, 0x06, 0x00, 0x00,
-    0x03, 0xF8, 0x3F, 0xE3, 0xFF, 0xBF, 0x7D, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFC,
-    0x73, 0xFF, 0x8F, 0xFC, 0x3F, 0xE0, 0x06, 0x00, 0x7C, 0x07, 0xF0, 0x7F, 0x81, 0x8C, 0x00, 0x00,
-    0x7F, 0x07, 0xFC, 0x7F, 0xF7, 0xEF, 0xBE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0x8E,
-    0x7F, 0xF1, 0xFF, 0x87, 0xFC, 0x39, 0xE3, 0xEF, 0x1F, 0x78, 0x73, 0xC0, 0x00, 0x00, 0x00, 0x7F,
-    0x07, 0xFC, 0x7F, 0xF7, 0xEF, 0xBE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0x8E, 0x7F,
-    0xF1, 0xFF, 0x87, 0xFC, 0x30, 0xF1, 0xF1, 0xE1, 0xC1, 0x80, 0x3E, 0x7C, 0xF9, 0xF3, 0xE7, 0xCF,
-    0x9F, 0x3E, 0x7C, 0xF9, 0xF3, 0xE0, 0x18, 0xF7, 0xFE, 0xF1, 0x80, 0x3E, 0xFB, 0xEF, 0xBE, 0xFB,
-    0xEF, 0xBE, 0xFB, 0xEF, 0xBE, 0x0C, 0x1F, 0x1F, 0xCF, 0xF6, 0x30, 0x00, 0xF8, 0x7C, 0x3E, 0x1F,
-    0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x80, 0x71, 0xCF, 0x7D, 0xEF, 0xB8,
-    0xE0, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0,
-    0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x00, 0x07, 0x00, 0x3F, 0xE0, 0x7F, 0x83, 0xFE, 0x0F, 0xF0, 0x1F,
-    0xC0, 0x0F, 0x87, 0xFE, 0x7F, 0xF9, 0xFF, 0xEF, 0xCF, 0xBE, 0x1E, 0xF0, 0x7B, 0xC1, 0xEF, 0x8F,
-    0xBF, 0x7C, 0x7F, 0xF1, 0xFF, 0x81, 0xFC, 0x00, 0x1E, 0xE1, 0xFF, 0x0F, 0xF8, 0x77, 0x80, 0x00,
-    0x00, 0x01, 0xFF, 0x1F, 0xFC, 0xFF, 0xF7, 0xCF, 0xBE, 0x3D, 0xF1, 0xEF, 0x8F, 0x7C, 0x7B, 0xE3,
-    0xDF, 0x1E, 0xF8, 0xF7, 0xC7, 0xBE, 0x3C, 0x06, 0x00, 0x3C, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0x80,
-    0x06, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0xE1, 0xFF, 0xCF, 0xDF, 0xBE, 0x3E, 0xF0, 0x7B, 0xC1, 0xEF,
-    0x07, 0xBE, 0x3E, 0xFD, 0xF9, 0xFF, 0xC3, 0xFE, 0x07, 0xF0, 0x03, 0x80, 0x0F, 0x00, 0x7C, 0x03,
-    0xE0, 0x0F, 0x00, 0x18, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0xE1, 0xFF, 0xCF, 0xDF, 0xBE, 0x3E, 0xF0,
-    0x7B, 0xC1, 0xEF, 0x07, 0xBE, 0x3E, 0xFD, 0xF9, 0xFF, 0xC3, 0xFE, 0x07, 0xF0, 0x07, 0x00, 0x3E,
-    0x01, 0xFC, 0x0F, 0xF8, 0x18, 0xC0, 0x00, 0x01, 0xFC, 0x0F, 0xF8, 0x7F, 0xF3, 0xF7, 0xEF, 0x8F,
-    0xBC, 0x1E, 0xF0, 0x7B, 0xC1, 0xEF, 0x8F, 0xBF, 0x7E, 0x7F, 0xF0, 0xFF, 0x81, 0xFC, 0x00, 0x1E,
-    0xE0, 0xFF, 0x83, 0xFE, 0x0E, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xF8, 0x7F, 0xF3, 0xF7,
-    0xEF, 0x8F, 0xBC, 0x1E, 0xF0, 0x7B, 0xC1, 0xEF, 0x8F, 0xBF, 0x7E, 0x7F, 0xF0, 0xFF, 0x81, 0xFC,
-    0x00, 0x3C, 0xE0, 0xF7, 0xC3, 0xDF, 0x0F, 0x38, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xF8, 0x7F,
-    0xF3, 0xF7, 0xEF, 0x8F, 0xBC, 0x1E, 0xF0, 0x7B, 0xC1, 0xEF, 0x8F, 0xBF, 0x7E, 0x7F, 0xF0, 0xFF,
-    0x81, 0xFC, 0x00, 0x0F, 0x00, 0xF8, 0x0F, 0x80, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0xF0, 0x0F, 0x80, 0xF8, 0x0F, 0x00, 0x00, 0x30, 0x7F, 0xE3, 0xFF, 0x9F, 0xFC, 0xFD, 0xFB,
-    0xEF, 0xEF, 0x3F, 0xBD, 0xDE, 0xFF, 0x7B, 0xF9, 0xEF, 0xDF, 0x9F, 0xFC, 0x7F, 0xE3, 0xFF, 0x06,
-    0x00, 0x00, 0x0C, 0x01, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0x80, 0x30, 0x00, 0x0F, 0x8F, 0xF8, 0xFF,
-    0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0x7C, 0xF7, 0xFF, 0x3F, 0xF1, 0xFF,
-    0x03, 0x00, 0x78, 0x07, 0x80, 0xF0, 0x0E, 0x00, 0xC0, 0x00, 0x0F, 0x8F, 0xF8, 0xFF, 0x8F, 0xF8,
-    0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0x7C, 0xF7, 0xFF, 0x3F, 0xF1, 0xFF, 0x06, 0x00,
-    0xF8, 0x1F, 0xC3, 0xFC, 0x18, 0xC0, 0x00, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F,
-    0xF8, 0xFF, 0x8F, 0xF8, 0xF7, 0xCF, 0x7F, 0xF3, 0xFF, 0x1F, 0xF0, 0x39, 0xE7, 0xDE, 0x7D, 0xE3,
-    0x9E, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F,
-    0xF8, 0xF7, 0xCF, 0x7F, 0xF3, 0xFF, 0x1F, 0xF0, 0x00, 0xC0, 0x07, 0x80, 0x3E, 0x01, 0xF0, 0x07,
-    0x80, 0x0C, 0x00, 0x00, 0x3E, 0x1F, 0xF8, 0x79, 0xE1, 0xE7, 0xCF, 0x9F, 0x3C, 0x3C, 0xF0, 0xFF,
-    0xC3, 0xFE, 0x07, 0xF8, 0x1F, 0xE0, 0x3F, 0x00, 0xFC, 0x01, 0xE0, 0x0F, 0x81, 0x7C, 0x0F, 0xF0,
-    0x3F, 0x80, 0xFC, 0x00, 0x78, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xFF, 0x1F,
-    0xFC, 0xFF, 0xF7, 0xCF, 0xFE, 0x3F, 0xF0, 0xFF, 0x87, 0xFC, 0x3F, 0xE3, 0xFF, 0xBF, 0xFF, 0xF7,
-    0xFF, 0xBF, 0xF1, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0x3C, 0xE0, 0xF7, 0xC3, 0xDF,
-    0x0F, 0x38, 0x00, 0x00, 0x00, 0x0F, 0x87, 0xFE, 0x1E, 0x78, 0x79, 0xF3, 0xE7, 0xCF, 0x0F, 0x3C,
-    0x3F, 0xF0, 0xFF, 0x81, 0xFE, 0x07, 0xF8, 0x0F, 0xC0, 0x3F, 0x00, 0x78, 0x03, 0xE0, 0x5F, 0x03,
-    0xFC, 0x0F, 0xE0, 0x3F, 0x00, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0xF0,
-    0x0F, 0x3C, 0x07, 0xCF, 0x81, 0xE3, 0xE0, 0x78, 0x78, 0x3F, 0xFF, 0x0F, 0xFF, 0xC3, 0xFF, 0xF9,
-    0xF0, 0x3E, 0x7C, 0x0F, 0xBE, 0x01, 0xFF, 0x80, 0x7C, 0x3F, 0xE1, 0xFF, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x07, 0xFE, 0x3F, 0xF1, 0x8F, 0x80, 0x3E, 0x3F, 0xF7, 0xFF, 0xBF, 0xFD,
-    0xF3, 0xEF, 0x9F, 0x7F, 0xFB, 0xFF, 0xCF, 0xFC, 0x07, 0x3C, 0x01, 0xEE, 0x00, 0x3F, 0x80, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x01, 0xFE, 0x00, 0x7F,
-    0x80, 0x3F, 0xF0, 0x0F, 0x3C, 0x07, 0xCF, 0x81, 0xE3, 0xE0, 0x78, 0x78, 0x3F, 0xFF, 0x0F, 0xFF,
-    0xC3, 0xFF, 0xF9, 0xF0, 0x3E, 0x7C, 0x0F, 0xBE, 0x01, 0xFF, 0x80, 0x7C, 0x1C, 0xE0, 0xEF, 0x07,
-    0xF8, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x07, 0xFE, 0x3F, 0xF1, 0x8F, 0x80, 0x3E, 0x3F, 0xF7,
-    0xFF, 0xBF, 0xFD, 0xF3, 0xEF, 0x9F, 0x7F, 0xFB, 0xFF, 0xCF, 0xFC, 0x01, 0xE0, 0x00, 0x7E, 0x00,
-    0x0F, 0xC0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x1F, 0xF8, 0x03, 0xCF, 0x00, 0xF9, 0xF0, 0x1E, 0x3E,
-    0x03, 0xC3, 0xC0, 0xFF, 0xFC, 0x1F, 0xFF, 0x83, 0xFF, 0xF8, 0xF8, 0x1F, 0x1F, 0x03, 0xE7, 0xC0,
-    0x3E, 0xF8, 0x07, 0xC0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x03, 0x80, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
-    0x01, 0xF8, 0x3F, 0xC1, 0xFF, 0x8F, 0xFC, 0x63, 0xE0, 0x0F, 0x8F, 0xFD, 0xFF, 0xEF, 0xFF, 0x7C,
-    0xFB, 0xE7, 0xDF, 0xFE, 0xFF, 0xF3, 0xFF, 0x00, 0x78, 0x07, 0x80, 0x78, 0x03, 0xF0, 0x0F, 0xC0,
-    0x7E, 0x00, 0x60, 0x01, 0xE0, 0x07, 0xC0, 0x1F, 0x00, 0x3C, 0x00, 0x30, 0x00, 0x00, 0x03, 0xFE,
-    0x1F, 0xFE, 0x7F, 0xF9, 0xFC, 0x73, 0xE0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8,
-    0x01, 0xF0, 0x03, 0xE0, 0x03, 0xE0, 0x07, 0xF1, 0xC7, 0xFF, 0xC7, 0xFF, 0x87, 0xFE, 0x01, 0x80,
-    0x78, 0x1F, 0x07, 0xC0, 0xF0, 0x0C, 0x00, 0x00, 0xFF, 0x3F, 0xEF, 0xFB, 0xF3, 0x7C, 0x0F, 0x01,
-    0xE0, 0x3C, 0x07, 0xC0, 0xFC, 0x6F, 0xFC, 0xFF, 0x8F, 0xF0, 0x00, 0xC0, 0x03, 0xC0, 0x1F, 0xC0,
-    0x3F, 0xC0, 0x73, 0x00, 0x00, 0x01, 0xFF, 0x0F, 0xFF, 0x3F, 0xFC, 0xFE, 0x39, 0xF0, 0x07, 0xC0,
-    0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x01, 0xF0, 0x03, 0xF8, 0xE3,
-    0xFF, 0xE3, 0xFF, 0xC3, 0xFF, 0x00, 0x07, 0x01, 0xF0, 0x7F, 0x1F, 0xE1, 0x8C, 0x00, 0x07, 0xF9,
-    0xFF, 0x7F, 0xDF, 0x9B, 0xE0, 0x78, 0x0F, 0x01, 0xE0, 0x3E, 0x07, 0xE3, 0x7F, 0xE7, 0xFC, 0x7F,
-    0x80, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x0F, 0xFF,
-    0x3F, 0xFC, 0xFE, 0x39, 0xF0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8,
-    0x01, 0xF0, 0x01, 0xF0, 0x03, 0xF8, 0xE3, 0xFF, 0xE3, 0xFF, 0xC3, 0xFF, 0x00, 0x07, 0x01, 0xF0,
-    0x3E, 0x03, 0x80, 0x00, 0x00, 0x07, 0xF9, 0xFF, 0x7F, 0xDF, 0x9B, 0xE0, 0x78, 0x0F, 0x01, 0xE0,
-    0x3E, 0x07, 0xE3, 0x7F, 0xE7, 0xFC, 0x7F, 0x80, 0x06, 0x30, 0x0F, 0xF0, 0x1F, 0xC0, 0x0F, 0x00,
-    0x0C, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x1F, 0xFE, 0x7F, 0xF9, 0xFC, 0x73, 0xE0, 0x0F, 0x80,
-    0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x03, 0xE0, 0x07, 0xF1, 0xC7,
-    0xFF, 0xC7, 0xFF, 0x87, 0xFE, 0x18, 0xC7, 0xFC, 0x7F, 0x07, 0xC0, 0x70, 0x00, 0x00, 0x00, 0xFF,
-    0x3F, 0xEF, 0xFB, 0xF3, 0x7C, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0xC0, 0xFC, 0x6F, 0xFC, 0xFF, 0x8F,
-    0xF0, 0x1C, 0xC0, 0x1F, 0xE0, 0x1F, 0xC0, 0x07, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0xFF, 0xF0, 0xFF, 0xF8, 0xF1, 0xFC, 0xF0, 0x7E, 0xF0, 0x3E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0,
-    0x1F, 0xF0, 0x1E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x7E, 0xF1, 0xFC, 0xFF, 0xF8, 0xFF, 0xF0, 0xFF,
-    0xC0, 0x00, 0xFB, 0x80, 0x3E, 0xE0, 0x0F, 0xB8, 0x03, 0xEE, 0x00, 0xFB, 0x80, 0x3E, 0xE1, 0xFF,
-    0x81, 0xFF, 0xE0, 0x7F, 0xF8, 0x3F, 0x7E, 0x0F, 0x8F, 0x83, 0xC3, 0xE0, 0xF0, 0xF8, 0x3C, 0x3E,
-    0x0F, 0x8F, 0x83, 0xF3, 0xE0, 0x7F, 0xF8, 0x0F, 0xFE, 0x01, 0xFF, 0x00, 0x3F, 0xF8, 0x0F, 0xFF,
-    0x83, 0xFF, 0xF0, 0xF9, 0xFE, 0x3E, 0x0F, 0x8F, 0x83, 0xE3, 0xE0, 0x7F, 0xFF, 0x1F, 0xFF, 0xC7,
-    0xFF, 0xF1, 0xF3, 0xE0, 0x7C, 0xF8, 0x3E, 0x3E, 0x1F, 0x8F, 0x9F, 0xC3, 0xFF, 0xF0, 0xFF, 0xF0,
-    0x3F, 0xF8, 0x00, 0x00, 0xF8, 0x03, 0xE0, 0x7F, 0xC1, 0xFF, 0x00, 0xF8, 0x03, 0xE1, 0xFF, 0x8F,
-    0xFE, 0x7F, 0xFB, 0xF7, 0xEF, 0x8F, 0xBC, 0x3E, 0xF0, 0xFB, 0xC3, 0xEF, 0x8F, 0xBF, 0x3E, 0x7F,
-    0xF8, 0xFF, 0xE1, 0xFF, 0x00, 0x7F, 0xC3, 0xFE, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xDF, 0xFE, 0xFF, 0xF7, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x7F, 0xF3, 0xFF, 0x9F, 0xFC, 0xF0,
-    0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xE1, 0xFF, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xFC, 0x7F, 0xF7, 0xEF, 0xBE, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x1F, 0x8E, 0x7F, 0xF1, 0xFF, 0x87, 0xFC, 0x39, 0xC1, 0xFE, 0x0F, 0xF0, 0x3F,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xDF, 0xFE, 0xFF, 0xF7, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x7F,
-    0xF3, 0xFF, 0x9F, 0xFC, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x39, 0xE1, 0xEE, 0x07, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xFC, 0x7F, 0xF7, 0xEF,
-    0xBE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0x8E, 0x7F, 0xF1, 0xFF, 0x87, 0xFC, 0x0F,
-    0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xDF, 0xFE, 0xFF, 0xF7, 0x80, 0x3C,
-    0x01, 0xE0, 0x0F, 0x00, 0x7F, 0xF3, 0xFF, 0x9F, 0xFC, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0x00, 0x7C, 0x03, 0xE0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x07, 0xFC, 0x7F, 0xF7, 0xEF, 0xBE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0x8E, 0x7F,
-    0xF1, 0xFF, 0x87, 0xFC, 0xFF, 0xF7, 0xFF, 0xBF, 0xFD, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1F,
-    0xFC, 0xFF, 0xE7, 0xFF, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x07, 0x80, 0x38, 0x03, 0xC0, 0x1F, 0x80, 0xFC, 0x03, 0xE0, 0x1F, 0xC1, 0xFF, 0x1F, 0xFD, 0xFB,
-    0xEF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xE3, 0x9F, 0xFC, 0x7F, 0xE1, 0xFF, 0x00,
-    0xE0, 0x0F, 0x00, 0x7E, 0x03, 0xF0, 0x1F, 0x80, 0x19, 0x81, 0xFE, 0x07, 0xE0, 0x1E, 0x00, 0x60,
-    0x00, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 0xF7, 0xFF, 0xBC, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xFF,
-    0x9F, 0xFC, 0xFF, 0xE7, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x18,
-    0xC1, 0xFF, 0x07, 0xF0, 0x1F, 0x00, 0x70, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xE3, 0xFF, 0xBF,
-    0x7D, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFC, 0x73, 0xFF, 0x8F, 0xFC, 0x3F, 0xE0,
-    0x00, 0xC0, 0x03, 0xC0, 0x1F, 0xC0, 0x3F, 0xC0, 0x73, 0x00, 0x00, 0x01, 0xFF, 0x0F, 0xFF, 0x3F,
-    0xFE, 0xFE, 0x39, 0xF0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x07, 0xFC, 0x0F, 0xF8, 0x1F,
-    0xF0, 0x3D, 0xF0, 0x7B, 0xF8, 0xF3, 0xFF, 0xE3, 0xFF, 0xC1, 0xFF, 0x80, 0x03, 0x00, 0x3C, 0x07,
-    0xF0, 0x3F, 0xC0, 0xCC, 0x00, 0x00, 0x7F, 0xC7, 0xFE, 0x7F, 0xF7, 0xE7, 0xBE, 0x3D, 0xE1, 0xEF,
-    0x0F, 0x78, 0x7B, 0xE3, 0xDF, 0xBE, 0x7F, 0xF3, 0xFF, 0x8F, 0xFC, 0x01, 0xE7, 0x1F, 0x3F, 0xF9,
-    0xFF, 0x8F, 0xF8, 0x0F, 0x38, 0x0E, 0xF0, 0x1F, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x0F, 0xFF, 0x3F, 0xFE, 0xFE, 0x39, 0xF0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x07, 0xFC,
-    0x0F, 0xF8, 0x1F, 0xF0, 0x3D, 0xF0, 0x7B, 0xF8, 0xF3, 0xFF, 0xE3, 0xFF, 0xC1, 0xFF, 0x80, 0x1C,
-    0xE0, 0xEF, 0x07, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xC7, 0xFE, 0x7F, 0xF7, 0xE7, 0xBE,
-    0x3D, 0xE1, 0xEF, 0x0F, 0x78, 0x7B, 0xE3, 0xDF, 0xBE, 0x7F, 0xF3, 0xFF, 0x8F, 0xFC, 0x01, 0xE7,
-    0x1F, 0x3F, 0xF9, 0xFF, 0x8F, 0xF8, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x0F, 0xFF, 0x3F, 0xFE, 0xFE, 0x39, 0xF0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00,
-    0x3E, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3D, 0xF0, 0x7B, 0xF8, 0xF3, 0xFF, 0xE3, 0xFF, 0xC1,
-    0xFF, 0x80, 0x07, 0x00, 0x7C, 0x03, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC7, 0xFE, 0x7F,
-    0xF7, 0xE7, 0xBE, 0x3D, 0xE1, 0xEF, 0x0F, 0x78, 0x7B, 0xE3, 0xDF, 0xBE, 0x7F, 0xF3, 0xFF, 0x8F,
-    0xFC, 0x01, 0xE7, 0x1F, 0x3F, 0xF9, 0xFF, 0x8F, 0xF8, 0x07, 0xFC, 0x3F, 0xFC, 0xFF, 0xFB, 0xF8,
-    0xE7, 0xC0, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xF7,
-    0xC1, 0xEF, 0xE3, 0xCF, 0xFF, 0x8F, 0xFF, 0x07, 0xFE, 0x00, 0x00, 0x07, 0x80, 0x0F, 0x00, 0x7E,
-    0x00, 0x78, 0x00, 0x01, 0x80, 0x1E, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x3F, 0xF3, 0xFF, 0xBF, 0x3D, 0xF1, 0xEF, 0x0F, 0x78, 0x7B, 0xC3, 0xDF, 0x1E, 0xFD, 0xF3, 0xFF,
-    0x9F, 0xFC, 0x7F, 0xE0, 0x0F, 0x38, 0xF9, 0xFF, 0xCF, 0xFC, 0x7F, 0xC0, 0x03, 0x00, 0x0F, 0x00,
-    0x3F, 0x80, 0xFF, 0x00, 0xCE, 0x00, 0x00, 0x3C, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0,
-    0xFF, 0x81, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF,
-    0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0x80, 0x1C, 0x01, 0xF0, 0x1F, 0xC0, 0xFE, 0x06, 0x30,
-    0x00, 0x01, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0xFC, 0x7F, 0xF3, 0xFF,
-    0xDF, 0x3E, 0xF8, 0xF7, 0xC7, 0xBE, 0x3D, 0xF1, 0xEF, 0x8F, 0x7C, 0x7B, 0xE3, 0xDF, 0x1E, 0xF8,
-    0xF0, 0x3E, 0x0F, 0x87, 0xC1, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7C, 0x1F, 0x0F,
-    0x83, 0xE1, 0xFF, 0xFC, 0x3F, 0xFF, 0x87, 0xFF, 0xF0, 0xF8, 0x3E, 0x1F, 0x07, 0xC3, 0xE0, 0xF8,
-    0x7C, 0x1F, 0x0F, 0x83, 0xE1, 0xF0, 0x7C, 0x3E, 0x0F, 0x80, 0x3C, 0x00, 0xF0, 0x0F, 0xFC, 0x3F,
-    0xF0, 0x3C, 0x00, 0xF0, 0x03, 0xFE, 0x0F, 0xFC, 0x3F, 0xF8, 0xF3, 0xE3, 0xC7, 0xCF, 0x1F, 0x3C,
-    0x7C, 0xF1, 0xF3, 0xC7, 0xCF, 0x1F, 0x3C, 0x7C, 0xF1, 0xF3, 0xC7, 0xC0, 0x7D, 0x9F, 0xFF, 0xF9,
-    0xBE, 0x00, 0x00, 0x01, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78,
-    0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x7D, 0xBF, 0xEF, 0xFB, 0xBC, 0x00, 0x00,
-    0x03, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83,
-    0xE0, 0x7F, 0x9F, 0xE7, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78,
-    0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xF8, 0x7C,
-    0x3E, 0x1F, 0x0F, 0x80, 0xE7, 0xFB, 0x9F, 0xC7, 0xC0, 0x00, 0x00, 0xF0, 0x78, 0x3C, 0x1E, 0x0F,
-    0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0xF3, 0xFB,
-    0xDF, 0xC7, 0xC0, 0x00, 0x00, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xF8, 0x7C,
-    0x3E, 0x1F, 0x0F, 0x80, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7,
-    0x8F, 0x1E, 0x3C, 0x79, 0xE3, 0xCF, 0xEF, 0xDF, 0x80, 0x3D, 0xF7, 0xCF, 0x00, 0x07, 0xDF, 0x7D,
-    0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDE, 0x73, 0xCF, 0xFF, 0x7C, 0x7B, 0xDE, 0xF0, 0x01,
-    0xEF, 0x7B, 0xDE, 0xF7, 0xBD, 0xEF, 0x7B, 0xDE, 0xF7, 0xBD, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0xF0, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x07, 0xFC,
-    0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0,
-    0x07, 0xFC, 0x73, 0xEF, 0x3F, 0xFB, 0xCF, 0xFC, 0xF1, 0xFE, 0x00, 0x78, 0xFF, 0x9F, 0xF9, 0xF7,
-    0x8F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F,
-    0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xF0, 0x1F, 0x01, 0xF0, 0xFF, 0x0F, 0xE0, 0xFC, 0x00,
-    0xE0, 0x07, 0xC0, 0x3F, 0x81, 0xFE, 0x03, 0x18, 0x00, 0x00, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07,
-    0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F,
-    0x1C, 0xF8, 0xFF, 0xE3, 0xFF, 0x07, 0xF8, 0x00, 0x06, 0x07, 0xC3, 0xF8, 0xFF, 0x31, 0x80, 0x01,
-    0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0,
-    0x7C, 0x1F, 0x3F, 0x8F, 0xE3, 0xF0, 0xF0, 0x7D, 0xE1, 0xF3, 0xC7, 0xE7, 0x9F, 0x8F, 0x7E, 0x1F,
-    0xF8, 0x3F, 0xE0, 0x7F, 0x80, 0xFF, 0x01, 0xFF, 0x03, 0xFF, 0x07, 0xBF, 0x0F, 0x3F, 0x1E, 0x3F,
-    0x3C, 0x3E, 0x78, 0x3E, 0xF0, 0x7E, 0x00, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0xF8, 0x01, 0xE0, 0x00,
-    0x78, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x8F, 0xBE, 0x7C, 0xFB, 0xE3,
-    0xFF, 0x0F, 0xF8, 0x3F, 0xC0, 0xFF, 0x83, 0xFF, 0x0F, 0xFE, 0x3E, 0xF8, 0xF9, 0xF3, 0xE3, 0xEF,
-    0x8F, 0x80, 0x00, 0x07, 0x80, 0x3E, 0x01, 0xF0, 0x07, 0x80, 0xF8, 0xFB, 0xE7, 0xCF, 0xBE, 0x3F,
-    0xF0, 0xFF, 0x83, 0xFC, 0x0F, 0xF8, 0x3F, 0xF0, 0xFF, 0xE3, 0xEF, 0x8F, 0x9F, 0x3E, 0x7E, 0xF8,
-    0xF8, 0x1C, 0x00, 0xF0, 0x0F, 0x80, 0xF8, 0x07, 0x80, 0x18, 0x00, 0x00, 0x0F, 0x00, 0x78, 0x03,
-    0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00,
-    0xF0, 0x07, 0x80, 0x3F, 0xFD, 0xFF, 0xEF, 0xFF, 0x0C, 0xFB, 0xFF, 0x80, 0x0F, 0x3E, 0x7C, 0xF9,
-    0xF3, 0xE7, 0xCF, 0x9F, 0x3E, 0x7C, 0xF9, 0xF3, 0xE7, 0xCF, 0xCF, 0xDF, 0x9E, 0xF0, 0x0F, 0x00,
-    0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
-    0x0F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0x00, 0xF0, 0x1F, 0x01, 0xE0, 0x79, 0xF3,
-    0xE7, 0xCF, 0x9F, 0x3E, 0x7C, 0xF9, 0xF3, 0xE7, 0xCF, 0x9F, 0x3E, 0x7E, 0x7E, 0xFC, 0xF0, 0x03,
-    0x8F, 0x3E, 0x78, 0xF3, 0xCF, 0x3C, 0xF3, 0x8F, 0x38, 0xF3, 0x8F, 0x38, 0xF0, 0x0F, 0x00, 0xF0,
-    0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7B, 0xFE, 0xEF,
-    0xBB, 0xEE, 0xFB, 0xBE, 0xEF, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83,
-    0xF0, 0x7E, 0x1F, 0x83, 0xC0, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF1, 0xEF, 0x3E, 0xF3, 0xFF,
-    0x3E, 0xF1, 0xEF, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x78,
-    0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF9, 0xEF, 0xBF, 0xFB, 0xFF, 0xBF, 0xF9, 0xEF,
-    0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0xC0, 0x7E, 0x07, 0xE0, 0x3C, 0x00, 0x3E, 0x00, 0x7C, 0x00,
-    0xF8, 0x01, 0xF0, 0x03, 0xE4, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xE0, 0x7F, 0x81, 0xFC, 0x03, 0xF8,
-    0x03, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0xFF, 0x9F, 0xFF, 0x3F, 0xFE, 0x1F, 0x03, 0xE0, 0x7C,
-    0x0F, 0x81, 0xF0, 0x3F, 0x07, 0xF0, 0xFE, 0x7F, 0x8F, 0xE1, 0xFC, 0x1F, 0x81, 0xF0, 0x3E, 0x07,
-    0xC0, 0xF8, 0x1F, 0x81, 0xF0, 0x1E, 0x00, 0x01, 0x80, 0x03, 0xC0, 0x0F, 0x80, 0x3E, 0x00, 0x78,
-    0x00, 0x40, 0x00, 0x00, 0x78, 0x0F, 0xF8, 0x1F, 0xF8, 0x3F, 0xF8, 0x7F, 0xF8, 0xFF, 0xF1, 0xFF,
-    0xF3, 0xFD, 0xF7, 0xFB, 0xEF, 0xF3, 0xFF, 0xE3, 0xFF, 0xC3, 0xFF, 0x87, 0xFF, 0x07, 0xFE, 0x07,
-    0xFC, 0x0F, 0xF8, 0x0F, 0x03, 0x00, 0x3C, 0x03, 0xE0, 0x3E, 0x01, 0xE0, 0x06, 0x00, 0x00, 0x0F,
-    0xF8, 0xFF, 0xE7, 0xFF, 0xBE, 0x7D, 0xF1, 0xEF, 0x8F, 0x7C, 0x7B, 0xE3, 0xDF, 0x1E, 0xF8, 0xF7,
-    0xC7, 0xBE, 0x3D, 0xF1, 0xE0, 0xF0, 0x1F, 0xF0, 0x3F, 0xF0, 0x7F, 0xF0, 0xFF, 0xF1, 0xFF, 0xE3,
-    0xFF, 0xE7, 0xFB, 0xEF, 0xF7, 0xDF, 0xE7, 0xFF, 0xC7, 0xFF, 0x87, 0xFF, 0x0F, 0xFE, 0x0F, 0xFC,
-    0x0F, 0xF8, 0x1F, 0xF0, 0x1E, 0x00, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x7F,
-    0xC7, 0xFF, 0x3F, 0xFD, 0xF3, 0xEF, 0x8F, 0x7C, 0x7B, 0xE3, 0xDF, 0x1E, 0xF8, 0xF7, 0xC7, 0xBE,
-    0x3D, 0xF1, 0xEF, 0x8F, 0x00, 0x00, 0x1C, 0x01, 0xE0, 0x1F, 0x00, 0xF0, 0x00, 0x0C, 0xE0, 0x3F,
-    0xC0, 0x3F, 0x80, 0x3C, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0F, 0xF8, 0x1F, 0xF8, 0x3F,
-    0xF8, 0x7F, 0xF8, 0xFF, 0xF1, 0xFF, 0xF3, 0xFD, 0xF7, 0xFB, 0xEF, 0xF3, 0xFF, 0xE3, 0xFF, 0xC3,
-    0xFF, 0x87, 0xFF, 0x07, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x0F, 0x18, 0xC1, 0xFE, 0x07, 0xF0, 0x1F,
-    0x00, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xE7, 0xFF, 0xBE, 0x7D, 0xF1, 0xEF, 0x8F, 0x7C,
-    0x7B, 0xE3, 0xDF, 0x1E, 0xF8, 0xF7, 0xC7, 0xBE, 0x3D, 0xF1, 0xE0, 0x78, 0x00, 0xF0, 0x01, 0xE0,
-    0x03, 0xC0, 0x0F, 0x00, 0x1E, 0x00, 0x07, 0xFE, 0x0F, 0xFE, 0x1F, 0xFE, 0x3E, 0x7C, 0x7C, 0x78,
-    0xF8, 0xF1, 0xF1, 0xE3, 0xE3, 0xC7, 0xC7, 0x8F, 0x8F, 0x1F, 0x1E, 0x3E, 0x3C, 0x7C, 0x78, 0xF0,
-    0x1F, 0xF0, 0x3F, 0xF0, 0x7F, 0xF0, 0xFF, 0xF1, 0xFF, 0xE3, 0xFF, 0xE7, 0xFB, 0xEF, 0xF7, 0xDF,
-    0xE7, 0xFF, 0xC7, 0xFF, 0x87, 0xFF, 0x0F, 0xFE, 0x0F, 0xFC, 0x1F, 0xF8, 0x1F, 0xF0, 0x1E, 0x00,
-    0x3C, 0x00, 0xF8, 0x07, 0xF0, 0x0F, 0xC0, 0x1F, 0x00, 0x7F, 0xC7, 0xFF, 0x3F, 0xFD, 0xF3, 0xEF,
-    0x8F, 0x7C, 0x7B, 0xE3, 0xDF, 0x1E, 0xF8, 0xF7, 0xC7, 0xBE, 0x3D, 0xF1, 0xEF, 0x8F, 0x00, 0x78,
-    0x07, 0xC0, 0xFE, 0x07, 0xF0, 0x3F, 0x00, 0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0xF8, 0x3F, 0xFF, 0x1F, 0xCF, 0xC7, 0xC0, 0xFB,
-    0xE0, 0x3E, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x03, 0xE7,
-    0xC0, 0xF9, 0xFC, 0xFE, 0x3F, 0xFF, 0x07, 0xFF, 0x80, 0x7F, 0x80, 0x3F, 0xE0, 0xFF, 0x83, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xF8, 0x7F, 0xF3, 0xF7, 0xEF, 0x8F, 0xBC, 0x1E,
-    0xF0, 0x7B, 0xC1, 0xEF, 0x8F, 0xBF, 0x7E, 0x7F, 0xF0, 0xFF, 0x81, 0xFC, 0x00, 0x0F, 0x38, 0x01,
-    0xDE, 0x00, 0x7F, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0xF8, 0x3F,
-    0xFF, 0x1F, 0xCF, 0xC7, 0xC0, 0xFB, 0xE0, 0x3E, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0,
-    0x1F, 0xF8, 0x07, 0xFE, 0x03, 0xE7, 0xC0, 0xF9, 0xFC, 0xFE, 0x3F, 0xFF, 0x07, 0xFF, 0x80, 0x7F,
-    0x80, 0x3C, 0xE0, 0xF7, 0x81, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xF8, 0x7F,
-    0xF3, 0xF7, 0xEF, 0x8F, 0xBC, 0x1E, 0xF0, 0x7B, 0xC1, 0xEF, 0x8F, 0xBF, 0x7E, 0x7F, 0xF0, 0xFF,
-    0x81, 0xFC, 0x00, 0x01, 0x8C, 0x00, 0xF3, 0x80, 0x3D, 0xE0, 0x1E, 0xF0, 0x07, 0x38, 0x01, 0x8C,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xFE, 0x0F, 0xFF, 0xC7, 0xF3, 0xF1, 0xF0, 0x3E, 0xF8, 0x0F,
-    0xBE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0xF9, 0xF0, 0x3E,
-    0x7F, 0x3F, 0x8F, 0xFF, 0xC1, 0xFF, 0xE0, 0x1F, 0xE0, 0x04, 0x20, 0x39, 0xE1, 0xFF, 0x87, 0xBC,
-    0x3D, 0xE0, 0xE3, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0xE1, 0xFF, 0xCF, 0xDF, 0xBE, 0x3E, 0xF0, 0x7B,
-    0xC1, 0xEF, 0x07, 0xBE, 0x3E, 0xFD, 0xF9, 0xFF, 0xC3, 0xFE, 0x07, 0xF0, 0x07, 0xFF, 0xFE, 0x1F,
-    0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x7F, 0x9E, 0x00, 0x7C, 0x1E, 0x00, 0xF8, 0x1E, 0x00, 0xF8, 0x1E,
-    0x00, 0xF8, 0x1F, 0xFC, 0xF8, 0x1F, 0xFC, 0xF8, 0x1F, 0xFC, 0xF8, 0x1E, 0x00, 0xF8, 0x1E, 0x00,
-    0x7C, 0x1E, 0x00, 0x7F, 0x9E, 0x00, 0x3F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x07, 0xFF, 0xFE, 0x1F,
-    0xCF, 0xE0, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xBF, 0x7F, 0x3E, 0xF8, 0xF8, 0x7B, 0xC1, 0xFF, 0xFF,
-    0x07, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0xF8, 0x03, 0xF7, 0xF8, 0xC7, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE,
-    0x1F, 0xCF, 0xF8, 0x03, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0xF8, 0x01, 0xE0, 0x01, 0x80, 0x00, 0x00,
-    0x7F, 0xE0, 0xFF, 0xF1, 0xFF, 0xF3, 0xC7, 0xE7, 0x87, 0xCF, 0x07, 0x9E, 0x1F, 0x3C, 0x7E, 0x7F,
-    0xFC, 0xFF, 0xF1, 0xFF, 0xC3, 0xCF, 0x87, 0x8F, 0x8F, 0x1F, 0x9E, 0x1F, 0x3C, 0x3F, 0x78, 0x3E,
-    0x06, 0x03, 0xC1, 0xF0, 0xF8, 0x3C, 0x06, 0x00, 0x01, 0xFF, 0xFF, 0xBF, 0xEF, 0x9B, 0xE0, 0xF8,
-    0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xFF, 0xC1, 0xFF, 0xE3, 0xFF, 0xE7, 0x8F,
-    0xCF, 0x0F, 0x9E, 0x0F, 0x3C, 0x3E, 0x78, 0xFC, 0xFF, 0xF9, 0xFF, 0xE3, 0xFF, 0x87, 0x9F, 0x0F,
-    0x1F, 0x1E, 0x3F, 0x3C, 0x3E, 0x78, 0x7E, 0xF0, 0x7C, 0x00, 0x00, 0x1E, 0x00, 0x3C, 0x01, 0xF0,
-    0x03, 0xE0, 0x00, 0x3F, 0xEF, 0xF9, 0xFF, 0x3E, 0x67, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0F,
-    0x81, 0xF0, 0x3E, 0x07, 0xC0, 0x00, 0x0F, 0x03, 0xC0, 0xF8, 0x1E, 0x00, 0x19, 0x80, 0x7F, 0x80,
-    0x7E, 0x00, 0x78, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0xF1, 0xFF, 0xF3, 0xC7,
-    0xE7, 0x87, 0xCF, 0x07, 0x9E, 0x1F, 0x3C, 0x7E, 0x7F, 0xFC, 0xFF, 0xF1, 0xFF, 0xC3, 0xCF, 0x87,
-    0x8F, 0x8F, 0x1F, 0x9E, 0x1F, 0x3C, 0x3F, 0x78, 0x3E, 0x33, 0x9F, 0xE3, 0xF8, 0x78, 0x0C, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xBF, 0xEF, 0x9B, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F,
-    0x83, 0xE0, 0x00, 0xC0, 0x07, 0x80, 0x3E, 0x01, 0xF0, 0x07, 0x80, 0x0C, 0x00, 0x00, 0x03, 0xFC,
-    0x3F, 0xF9, 0xFF, 0xE7, 0xE7, 0x1F, 0x00, 0x7C, 0x01, 0xFE, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8,
-    0x07, 0xF0, 0x07, 0xC0, 0x1F, 0x78, 0xFD, 0xFF, 0xE7, 0xFF, 0x8F, 0xF8, 0x03, 0x00, 0x3C, 0x07,
-    0xC0, 0xF8, 0x0F, 0x00, 0x40, 0x00, 0x01, 0xFE, 0x3F, 0xE7, 0xFC, 0x7C, 0xC7, 0xF0, 0x7F, 0xE7,
-    0xFE, 0x3F, 0xE0, 0x3E, 0x71, 0xE7, 0xFE, 0x7F, 0xC7, 0xF8, 0x03, 0x80, 0x1F, 0x00, 0xFE, 0x03,
-    0xFC, 0x0C, 0x60, 0x00, 0x00, 0xFF, 0x0F, 0xFE, 0x7F, 0xF9, 0xF9, 0xC7, 0xC0, 0x1F, 0x00, 0x7F,
-    0x80, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x01, 0xFC, 0x01, 0xF0, 0x07, 0xDE, 0x3F, 0x7F, 0xF9, 0xFF,
-    0xE3, 0xFE, 0x00, 0x07, 0x00, 0xF8, 0x1F, 0xC3, 0xFC, 0x18, 0xC0, 0x00, 0x1F, 0xE3, 0xFE, 0x7F,
-    0xC7, 0xCC, 0x7F, 0x07, 0xFE, 0x7F, 0xE3, 0xFE, 0x03, 0xE7, 0x1E, 0x7F, 0xE7, 0xFC, 0x7F, 0x80,
-    0x0F, 0xF0, 0xFF, 0xE7, 0xFF, 0x9F, 0x9C, 0x7C, 0x01, 0xF0, 0x07, 0xF8, 0x0F, 0xF8, 0x1F, 0xF0,
-    0x3F, 0xE0, 0x1F, 0xC0, 0x1F, 0x00, 0x7D, 0xE3, 0xF7, 0xFF, 0x9F, 0xFE, 0x3F, 0xE0, 0x1E, 0x00,
-    0x7C, 0x02, 0xF0, 0x0F, 0xC0, 0x3E, 0x00, 0x1F, 0xE3, 0xFE, 0x7F, 0xC7, 0xCC, 0x7F, 0x07, 0xFE,
-    0x7F, 0xE3, 0xFE, 0x03, 0xE7, 0x1E, 0x7F, 0xE7, 0xFE, 0x7F, 0x80, 0xE0, 0x0F, 0x01, 0x78, 0x3F,
-    0x03, 0xF0, 0x0C, 0x60, 0x3F, 0xC0, 0xFE, 0x01, 0xF0, 0x01, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x3F, 0xF9, 0xFF, 0xE7, 0xE7, 0x1F, 0x00, 0x7C, 0x01, 0xFE, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8,
-    0x07, 0xF0, 0x07, 0xC0, 0x1F, 0x78, 0xFD, 0xFF, 0xE7, 0xFF, 0x8F, 0xF8, 0x18, 0xC3, 0xFE, 0x1F,
-    0xC0, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x3F, 0xE7, 0xFC, 0x7C, 0xC7, 0xF0, 0x7F, 0xE7,
-    0xFE, 0x3F, 0xE0, 0x3E, 0x71, 0xE7, 0xFE, 0x7F, 0xC7, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E,
-    0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x07, 0x00, 0x1E, 0x00, 0x1E, 0x00,
-    0x3C, 0x01, 0xF8, 0x03, 0xE0, 0x00, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xFF, 0xBF, 0xEF, 0xFB, 0xE0,
-    0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3F, 0x27, 0xF9, 0xFF, 0x3F, 0xC3, 0x80, 0xF0, 0x1C, 0x3F,
-    0x0F, 0x80, 0x0C, 0x60, 0x1F, 0xE0, 0x3F, 0x80, 0x3E, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0,
-    0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07,
-    0x81, 0xEF, 0xFB, 0xFE, 0xFF, 0x3E, 0x0F, 0xFB, 0xFE, 0xFF, 0xBE, 0x0F, 0x83, 0xE0, 0xF8, 0x3E,
-    0x0F, 0x83, 0xF2, 0x7F, 0x9F, 0xF3, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3E, 0x00, 0x7C,
-    0x00, 0xF8, 0x01, 0xF0, 0x1F, 0xFE, 0x3F, 0xFC, 0x7F, 0xF8, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00,
-    0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xFF, 0xBF, 0xEF, 0xFB,
-    0xE0, 0xF8, 0x3F, 0xEF, 0xFB, 0xE0, 0xF8, 0x3F, 0x27, 0xF9, 0xFF, 0x3F, 0x80, 0x0F, 0xB0, 0x1F,
-    0xF0, 0x7F, 0xC0, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F,
-    0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3D, 0xF0,
-    0xFB, 0xF3, 0xF7, 0xFF, 0xC7, 0xFF, 0x03, 0xFC, 0x00, 0x1E, 0xE3, 0xFE, 0x7F, 0xE3, 0x7C, 0x00,
-    0x00, 0x00, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xF7,
-    0xCF, 0x7F, 0xF3, 0xFF, 0x1F, 0xF0, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03,
-    0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3D, 0xF0, 0xFB, 0xF3, 0xF7, 0xFF, 0xC7, 0xFF, 0x03,
-    0xFC, 0x00, 0x3F, 0xE3, 0xFE, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF,
-    0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xF7, 0xCF, 0x7F, 0xF3, 0xFF, 0x1F, 0xF0, 0x1E,
-    0x70, 0x1D, 0xE0, 0x3F, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x07, 0xFC, 0x0F, 0xF8, 0x1F,
-    0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0,
-    0x3D, 0xF0, 0xFB, 0xF3, 0xF7, 0xFF, 0xC7, 0xFF, 0x03, 0xFC, 0x00, 0x39, 0xE3, 0xDE, 0x1F, 0xC0,
-    0xF8, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F,
-    0xF8, 0xF7, 0xCF, 0x7F, 0xF3, 0xFF, 0x1F, 0xF0, 0x03, 0xC0, 0x0F, 0xC0, 0x1B, 0x80, 0x37, 0x00,
-    0x7E, 0x00, 0x78, 0x3E, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81,
-    0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3D, 0xF0, 0xFB, 0xF3, 0xF7, 0xFF, 0xC7,
-    0xFF, 0x03, 0xFC, 0x00, 0x0F, 0x81, 0xF8, 0x1D, 0xC1, 0xDC, 0x1F, 0x80, 0xF8, 0x00, 0x0F, 0x8F,
-    0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0x7C, 0xF7, 0xFF, 0x3F,
-    0xF1, 0xFF, 0x03, 0x18, 0x0F, 0x78, 0x1E, 0xF0, 0x7B, 0xC0, 0xE7, 0x01, 0x8C, 0x00, 0x00, 0x7C,
-    0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F,
-    0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7B, 0xE1, 0xF7, 0xE7, 0xEF, 0xFF, 0x8F, 0xFE, 0x07, 0xF8, 0x0C,
-    0x60, 0x73, 0x87, 0xBC, 0x39, 0xC3, 0xDE, 0x1C, 0xE0, 0x00, 0x1F, 0x1E, 0xF8, 0xF7, 0xC7, 0xBE,
-    0x3D, 0xF1, 0xEF, 0x8F, 0x7C, 0x7B, 0xE3, 0xDF, 0x1E, 0x7C, 0xF3, 0xFF, 0x8F, 0xFC, 0x3F, 0xE0,
-    0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8,
-    0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xF7, 0xC3, 0xEF, 0xCF, 0xDF, 0xFF, 0x1F, 0xFC, 0x0F, 0xF0,
-    0x03, 0x80, 0x0F, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xF8, 0xF7, 0xC7, 0xBE, 0x3D, 0xF1,
-    0xEF, 0x8F, 0x7C, 0x7B, 0xE3, 0xDF, 0x1E, 0xF8, 0xF3, 0xE7, 0x9F, 0xFC, 0x7F, 0xE1, 0xFF, 0x00,
-    0xF0, 0x0F, 0x00, 0x7E, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0x18, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xE6, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x1E, 0xF8, 0x00, 0x1E,
-    0x7C, 0x3C, 0x3E, 0x7C, 0x7C, 0x3E, 0x7C, 0x7E, 0x3E, 0x7C, 0x7E, 0x3C, 0x3C, 0x7E, 0x3C, 0x3E,
-    0xFF, 0x7C, 0x3E, 0xFF, 0x7C, 0x3E, 0xEF, 0x78, 0x1F, 0xE7, 0xF8, 0x1F, 0xE7, 0xF8, 0x1F, 0xC7,
-    0xF0, 0x1F, 0xC3, 0xF0, 0x0F, 0xC3, 0xF0, 0x0F, 0x83, 0xF0, 0x0F, 0x81, 0xE0, 0x00, 0x60, 0x00,
-    0x0F, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x03, 0x18, 0x00, 0x00, 0x00, 0xF8, 0xF1, 0xFF, 0x8F,
-    0x1E, 0x78, 0xF1, 0xE7, 0x9F, 0x3E, 0x7D, 0xFB, 0xC3, 0xDF, 0xBC, 0x3F, 0xFB, 0xC3, 0xFF, 0xF8,
-    0x1F, 0xBF, 0x81, 0xF9, 0xF8, 0x1F, 0x9F, 0x00, 0xF1, 0xF0, 0x0F, 0x0F, 0x00, 0x01, 0x80, 0x01,
-    0xF0, 0x01, 0xFC, 0x01, 0xFE, 0x00, 0x63, 0x00, 0x00, 0x03, 0xE0, 0x7E, 0xF8, 0x3E, 0x7C, 0x3E,
-    0x1F, 0x1F, 0x0F, 0x9F, 0x03, 0xEF, 0x81, 0xFF, 0x80, 0x7F, 0xC0, 0x1F, 0xC0, 0x0F, 0xC0, 0x03,
-    0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x03, 0x00,
-    0x1E, 0x01, 0xFC, 0x07, 0xF8, 0x1C, 0xC0, 0x00, 0x0F, 0x87, 0xFE, 0x1E, 0x78, 0x79, 0xF3, 0xE7,
-    0xCF, 0x0F, 0x3C, 0x3F, 0xF0, 0xFF, 0x81, 0xFE, 0x07, 0xF8, 0x0F, 0xC0, 0x3F, 0x00, 0x78, 0x03,
-    0xE0, 0x5F, 0x03, 0xFC, 0x0F, 0xE0, 0x3F, 0x00, 0x0E, 0x78, 0x0F, 0xBC, 0x07, 0xDE, 0x01, 0xCF,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x7E, 0xF8, 0x3E, 0x7C, 0x3E, 0x1F, 0x1F, 0x0F, 0x9F, 0x03,
-    0xEF, 0x81, 0xFF, 0x80, 0x7F, 0xC0, 0x1F, 0xC0, 0x0F, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8,
-    0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x00, 0xC0, 0x03, 0xC0, 0x0F, 0x80, 0x3E,
-    0x00, 0x78, 0x00, 0x60, 0x00, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0xFF, 0xF8, 0x03, 0xF0, 0x0F, 0xC0,
-    0x1F, 0x00, 0x7C, 0x01, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x80, 0x3C, 0x07, 0xC0, 0xF8, 0x0F, 0x00, 0x60, 0x00,
-    0x07, 0xFF, 0x7F, 0xF7, 0xFF, 0x03, 0xE0, 0x7C, 0x0F, 0x80, 0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x80, 0x0F, 0x80, 0x1F, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xBF, 0xFF, 0x7F, 0xFC, 0x01, 0xF8, 0x07, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xFC, 0x01, 0xF0,
-    0x07, 0xC0, 0x1F, 0x00, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0xFF, 0x7F, 0xF0, 0x3E, 0x07,
-    0xC0, 0xF8, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0C, 0x60, 0x1F,
-    0xE0, 0x3F, 0x80, 0x1E, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0xFF, 0xF8,
-    0x03, 0xF0, 0x0F, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0x7C,
-    0x01, 0xF0, 0x07, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0xC3, 0xFC, 0x1F, 0xC0, 0xF8,
-    0x07, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x7F, 0xF7, 0xFF, 0x03, 0xE0, 0x7C, 0x0F, 0x80, 0xF8, 0x1F,
-    0x03, 0xE0, 0x7C, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xCF, 0xF7, 0xFD, 0xF2, 0xF8, 0x3E, 0x0F,
-    0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x80,
-    0x3F, 0x3F, 0xDD, 0xFE, 0x70, 0x0C, 0x00, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x78, 0x01, 0x80, 0x00,
-    0x1F, 0xFE, 0xFF, 0xF7, 0xFF, 0xBC, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xFF, 0x9F, 0xFC, 0xFF,
-    0xE7, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x79, 0xC3, 0xDF, 0x1E,
-    0xF8, 0xF3, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xDF, 0xFE, 0xFF, 0xF7, 0x80, 0x3C, 0x01, 0xE0, 0x0F,
-    0x00, 0x7F, 0xF3, 0xFF, 0x9F, 0xFC, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0xFF, 0xFE, 0x0F, 0xFF, 0xE0, 0xFF, 0xFE, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C,
-    0x00, 0x07, 0xFF, 0x80, 0x7F, 0xFC, 0x07, 0xFF, 0xE0, 0x7C, 0x7E, 0x07, 0xC1, 0xE0, 0x7C, 0x1F,
-    0x07, 0xC1, 0xF0, 0x7C, 0x3E, 0x07, 0xDF, 0xE0, 0x7D, 0xFC, 0x07, 0xDF, 0x80, 0x03, 0x00, 0x78,
-    0x0F, 0x81, 0xF0, 0x1E, 0x00, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0x00, 0xF0,
-    0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
-    0x00, 0x07, 0xFC, 0x1F, 0xFE, 0x3F, 0xFE, 0x7F, 0x1C, 0x7C, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFF,
-    0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF8, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x7F, 0x3C, 0x3F, 0xFE, 0x1F,
-    0xFE, 0x07, 0xFC, 0x0F, 0xF0, 0xFF, 0xE7, 0xFF, 0x9F, 0x9C, 0x7C, 0x01, 0xF0, 0x07, 0xF8, 0x0F,
-    0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x1F, 0x00, 0x7D, 0xE3, 0xF7, 0xFF, 0x9F, 0xFE, 0x3F,
-    0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0x00,
-    0x00, 0x01, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07,
-    0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F,
-    0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF7, 0x3E, 0xFF, 0xEF, 0xFC, 0x7F,
-    0x80, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xFC, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x7C, 0x7C, 0x00, 0x07,
-    0xC7, 0xC0, 0x00, 0x7C, 0x7C, 0x00, 0x07, 0xC7, 0xFF, 0x00, 0x7C, 0x7F, 0xFC, 0x07, 0x87, 0xFF,
-    0xE0, 0x78, 0x7C, 0x7E, 0x07, 0x87, 0xC1, 0xE0, 0xF8, 0x7C, 0x1E, 0x1F, 0x07, 0xC1, 0xE7, 0xF0,
-    0x7C, 0x7E, 0xFE, 0x07, 0xFF, 0xEF, 0xC0, 0x7F, 0xFC, 0xF8, 0x03, 0xFF, 0x00, 0xF0, 0x3E, 0x00,
-    0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xFF,
-    0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xF0, 0x3E, 0x7F, 0xF0, 0x3E, 0x1F, 0xF0, 0x3E,
-    0x1F, 0xF0, 0x3E, 0x1F, 0xF0, 0x3E, 0x7F, 0xF0, 0x3F, 0xFE, 0xF0, 0x3F, 0xFC, 0xF0, 0x3F, 0xF8,
-    0xFF, 0xFE, 0x1F, 0xFF, 0xC3, 0xFF, 0xF8, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xFF,
-    0xC0, 0x3F, 0xFC, 0x07, 0xFF, 0xC0, 0xF9, 0xF8, 0x1F, 0x0F, 0x83, 0xE1, 0xF0, 0x7C, 0x3E, 0x0F,
-    0x87, 0xC1, 0xF0, 0xF8, 0x3E, 0x1F, 0x07, 0xC3, 0xE0, 0x00, 0xC0, 0x03, 0xC0, 0x0F, 0x80, 0x3E,
-    0x00, 0x78, 0x00, 0x60, 0x00, 0x00, 0x78, 0x3E, 0xF0, 0xF9, 0xE3, 0xF3, 0xCF, 0xC7, 0xBF, 0x0F,
-    0xFC, 0x1F, 0xF0, 0x3F, 0xC0, 0x7F, 0x80, 0xFF, 0x81, 0xFF, 0x83, 0xDF, 0x87, 0x9F, 0x8F, 0x1F,
-    0x9E, 0x1F, 0x3C, 0x1F, 0x78, 0x3F, 0x03, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3C, 0x00,
-    0x30, 0x00, 0x00, 0x78, 0x0F, 0xF0, 0x3F, 0xE0, 0xFF, 0xC3, 0xFF, 0x8F, 0xFF, 0x1F, 0xFE, 0x7F,
-    0xFD, 0xF7, 0xFF, 0xCF, 0xFF, 0x9F, 0xFE, 0x3F, 0xF8, 0x7F, 0xF0, 0xFF, 0xC1, 0xFF, 0x03, 0xFE,
-    0x07, 0xF8, 0x0F, 0x06, 0x38, 0x07, 0xBC, 0x03, 0xFE, 0x00, 0xFE, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF0, 0x3E, 0x7C, 0x1F, 0x3E, 0x0F, 0x8F, 0x8F, 0x87, 0xC7, 0xC1, 0xF3, 0xC0, 0xFB,
-    0xE0, 0x3F, 0xE0, 0x1F, 0xF0, 0x07, 0xF8, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7C, 0x02, 0x7E, 0x03,
-    0xFE, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE,
-    0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x00,
-    0x01, 0xE0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0xE0, 0x07, 0xF8, 0x03, 0xFF, 0x00, 0xF3, 0xC0,
-    0x7C, 0xF8, 0x1E, 0x3E, 0x07, 0x87, 0x83, 0xFF, 0xF0, 0xFF, 0xFC, 0x3F, 0xFF, 0x9F, 0x03, 0xE7,
-    0xC0, 0xFB, 0xE0, 0x1F, 0xF8, 0x07, 0xC0, 0xFF, 0xF3, 0xFF, 0xCF, 0xFF, 0x3C, 0x00, 0xF0, 0x03,
-    0xC0, 0x0F, 0xFC, 0x3F, 0xFC, 0xFF, 0xFB, 0xC7, 0xEF, 0x07, 0xBC, 0x1E, 0xF0, 0x7B, 0xC7, 0xEF,
-    0xFF, 0xBF, 0xFC, 0xFF, 0xC0, 0xFF, 0xC3, 0xFF, 0xCF, 0xFF, 0xBC, 0x7E, 0xF0, 0x7B, 0xC1, 0xEF,
-    0x1F, 0xBF, 0xFC, 0xFF, 0xF3, 0xFF, 0xEF, 0x0F, 0xFC, 0x1F, 0xF0, 0x7F, 0xC7, 0xFF, 0xFF, 0xBF,
-    0xFE, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
-    0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x00, 0x07, 0xFF, 0x80,
-    0x3F, 0xFC, 0x01, 0xFF, 0xE0, 0x0F, 0x8F, 0x00, 0x7C, 0x78, 0x03, 0xE3, 0xC0, 0x1E, 0x1E, 0x00,
-    0xF0, 0xF0, 0x07, 0x87, 0x80, 0x7C, 0x3C, 0x03, 0xE1, 0xE0, 0x1E, 0x0F, 0x01, 0xF0, 0x78, 0x0F,
-    0x83, 0xC3, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xC0, 0x07, 0xBE, 0x00, 0x3D, 0xF0,
-    0x01, 0xEF, 0x80, 0x0F, 0x7C, 0x00, 0x78, 0xFF, 0xF7, 0xFF, 0xBF, 0xFD, 0xE0, 0x0F, 0x00, 0x78,
-    0x03, 0xC0, 0x1F, 0xFC, 0xFF, 0xE7, 0xFF, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0xFC, 0x3E, 0x1F, 0x3F, 0x1F, 0x1F, 0x8F, 0x8F, 0x9F, 0x87, 0xE7, 0xDF, 0x81,
-    0xFB, 0xEF, 0x80, 0x7F, 0xFF, 0x80, 0x1F, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x01,
-    0xFF, 0xF0, 0x01, 0xFF, 0xFC, 0x01, 0xF7, 0xFF, 0x01, 0xF3, 0xEF, 0xC1, 0xF9, 0xF3, 0xE1, 0xF8,
-    0xF8, 0xF8, 0xF8, 0x7C, 0x7E, 0xF8, 0x3E, 0x1F, 0x00, 0x3F, 0xE0, 0xFF, 0xE1, 0xFF, 0xE1, 0xC7,
-    0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x7E, 0x0F, 0xFC, 0x1F, 0xF0, 0x3F, 0xF8, 0x03, 0xF0, 0x01, 0xE0,
-    0x03, 0xCF, 0x1F, 0x9F, 0xFF, 0x7F, 0xFC, 0x3F, 0xF0, 0xF0, 0x1F, 0xE0, 0x7F, 0xC1, 0xFF, 0x87,
-    0xFF, 0x1F, 0xFE, 0x3F, 0xFC, 0xFF, 0xFB, 0xEF, 0xFF, 0x9F, 0xFF, 0x3F, 0xFC, 0x7F, 0xF0, 0xFF,
-    0xE1, 0xFF, 0x83, 0xFE, 0x07, 0xFC, 0x0F, 0xF0, 0x1E, 0x0C, 0x70, 0x3D, 0xE0, 0x7F, 0xC0, 0x7F,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0F, 0xF0, 0x3F, 0xE0, 0xFF, 0xC3, 0xFF, 0x8F, 0xFF,
-    0x1F, 0xFE, 0x7F, 0xFD, 0xF7, 0xFF, 0xCF, 0xFF, 0x9F, 0xFE, 0x3F, 0xF8, 0x7F, 0xF0, 0xFF, 0xC1,
-    0xFF, 0x03, 0xFE, 0x07, 0xF8, 0x0F, 0xF0, 0x7D, 0xE1, 0xF3, 0xC7, 0xE7, 0x9F, 0x8F, 0x7E, 0x1F,
-    0xF8, 0x3F, 0xE0, 0x7F, 0x80, 0xFF, 0x01, 0xFF, 0x03, 0xFF, 0x07, 0xBF, 0x0F, 0x3F, 0x1E, 0x3F,
-    0x3C, 0x3E, 0x78, 0x3E, 0xF0, 0x7E, 0x03, 0xFF, 0xC1, 0xFF, 0xF0, 0x7F, 0xFC, 0x1F, 0x1F, 0x07,
-    0xC7, 0xC1, 0xF1, 0xF0, 0x7C, 0x7C, 0x1F, 0x1F, 0x07, 0x87, 0xC1, 0xE1, 0xF0, 0x78, 0x7C, 0x3E,
-    0x1F, 0x1F, 0x07, 0xDF, 0xC1, 0xFF, 0xE0, 0x7F, 0xF0, 0x1F, 0xF8, 0x07, 0xC0, 0x7C, 0x03, 0xE7,
-    0xE0, 0x3E, 0x7E, 0x07, 0xE7, 0xF0, 0x7E, 0x7F, 0x0F, 0xE7, 0xF8, 0xFF, 0x7F, 0x9F, 0xF7, 0xFD,
-    0xFF, 0x7B, 0xDF, 0xF7, 0xBF, 0xDF, 0x79, 0xFD, 0xFF, 0x9F, 0x8F, 0xF9, 0xF8, 0xFF, 0x8F, 0x8F,
-    0xF8, 0xF0, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xF0, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF,
-    0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x81, 0xFF, 0x03,
-    0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3E, 0x07, 0xF8, 0x07, 0xFF, 0x83, 0xFF, 0xF1, 0xFC,
-    0xFC, 0x7C, 0x0F, 0xBE, 0x03, 0xEF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80,
-    0x7F, 0xE0, 0x3E, 0x7C, 0x0F, 0x9F, 0xCF, 0xE3, 0xFF, 0xF0, 0x7F, 0xF8, 0x07, 0xF8, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F,
-    0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3E, 0xFF,
-    0xC3, 0xFF, 0xCF, 0xFF, 0xBC, 0x7E, 0xF0, 0x7B, 0xC1, 0xFF, 0x07, 0xBC, 0x7E, 0xFF, 0xFB, 0xFF,
-    0xCF, 0xFC, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x07, 0xFC, 0x3F,
-    0xFC, 0xFF, 0xF3, 0xF8, 0xE7, 0xC0, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03,
-    0xE0, 0x07, 0xC0, 0x07, 0xC0, 0x0F, 0xE3, 0x8F, 0xFF, 0x8F, 0xFF, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80,
-    0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x1F, 0x3E,
-    0x0F, 0x9F, 0x07, 0xC7, 0xC7, 0xC3, 0xE3, 0xE0, 0xF9, 0xE0, 0x7D, 0xF0, 0x1F, 0xF0, 0x0F, 0xF8,
-    0x03, 0xFC, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3E, 0x01, 0x3F, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x0F, 0xFE, 0x01, 0xFF, 0xF8, 0x3F, 0xFF, 0xC7, 0xEF,
-    0xFE, 0xF8, 0xF3, 0xEF, 0x8F, 0x1F, 0xF0, 0xF1, 0xFF, 0x0F, 0x1F, 0xF8, 0xF1, 0xFF, 0x8F, 0x3E,
-    0x7E, 0xF7, 0xE7, 0xFF, 0xFC, 0x3F, 0xFF, 0x80, 0xFF, 0xF0, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0xFC,
-    0x1F, 0x3F, 0x1F, 0x8F, 0x8F, 0x87, 0xEF, 0x81, 0xFF, 0xC0, 0x7F, 0xC0, 0x3F, 0xC0, 0x0F, 0xE0,
-    0x03, 0xE0, 0x03, 0xF8, 0x03, 0xFE, 0x03, 0xFF, 0x81, 0xF7, 0xC1, 0xF3, 0xF1, 0xF8, 0xFC, 0xF8,
-    0x3E, 0xF8, 0x1F, 0x80, 0xF0, 0x3E, 0x3C, 0x0F, 0x8F, 0x03, 0xE3, 0xC0, 0xF8, 0xF0, 0x3E, 0x3C,
-    0x0F, 0x8F, 0x03, 0xE3, 0xC0, 0xF8, 0xF0, 0x3E, 0x3C, 0x0F, 0x8F, 0x03, 0xE3, 0xC0, 0xF8, 0xF0,
-    0x3E, 0x3C, 0x0F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00,
-    0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0,
-    0xFF, 0x83, 0xFF, 0x1F, 0xFF, 0xFD, 0xFF, 0xF3, 0xFF, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
-    0xC0, 0x0F, 0x00, 0x3C, 0xF0, 0xF8, 0x7F, 0xC3, 0xE1, 0xFF, 0x0F, 0x87, 0xFC, 0x3E, 0x1F, 0xF0,
-    0xF8, 0x7F, 0xC3, 0xE1, 0xFF, 0x0F, 0x87, 0xFC, 0x3E, 0x1F, 0xF0, 0xF8, 0x7F, 0xC3, 0xE1, 0xFF,
-    0x0F, 0x87, 0xFC, 0x3E, 0x1F, 0xF0, 0xF8, 0x7F, 0xC3, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0xF0, 0xF8, 0x7C, 0x78, 0x7C, 0x3E, 0x3C, 0x3E, 0x1F, 0x1E, 0x1F, 0x0F, 0x8F,
-    0x0F, 0x87, 0xC7, 0x87, 0xC3, 0xE3, 0xC3, 0xE1, 0xF1, 0xE1, 0xF0, 0xF8, 0xF0, 0xF8, 0x7C, 0x78,
-    0x7C, 0x3E, 0x3C, 0x3E, 0x1F, 0x1E, 0x1F, 0x0F, 0x8F, 0x0F, 0x87, 0xC7, 0x87, 0xC3, 0xE3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0xFF, 0x80, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x07,
-    0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xFF, 0x80, 0x7F, 0xFC, 0x0F, 0xFF, 0xC1, 0xF3, 0xF8,
-    0x3E, 0x0F, 0x07, 0xC1, 0xF0, 0xF8, 0x3C, 0x1F, 0x1F, 0x83, 0xFF, 0xF0, 0x7F, 0xFC, 0x07, 0xFE,
-    0x00, 0xF0, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x1F,
-    0xFF, 0xC1, 0xFF, 0xFF, 0x1F, 0xFF, 0xF9, 0xFF, 0x3F, 0x9F, 0xF0, 0xF9, 0xFF, 0x07, 0x9F, 0xF0,
-    0xF9, 0xFF, 0x1F, 0x9F, 0xFF, 0xF9, 0xFF, 0xFF, 0x1F, 0xFF, 0xC1, 0xF0, 0xF0, 0x03, 0xC0, 0x0F,
-    0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0xFC, 0x3F, 0xFC, 0xFF, 0xFB, 0xCF, 0xEF, 0x07, 0xFC,
-    0x1F, 0xF0, 0x7F, 0xC7, 0xEF, 0xFF, 0xBF, 0xFC, 0xFF, 0xC0, 0x7F, 0xC1, 0xFF, 0xE3, 0xFF, 0xE3,
-    0x8F, 0xE0, 0x07, 0xC0, 0x07, 0xC0, 0x0F, 0x8F, 0xFF, 0x1F, 0xFE, 0x3F, 0xFC, 0x00, 0xF8, 0x01,
-    0xF0, 0x07, 0xCF, 0x3F, 0xBF, 0xFE, 0x7F, 0xF8, 0x7F, 0xC0, 0xF0, 0x0F, 0xE0, 0xF0, 0x3F, 0xF8,
-    0xF0, 0x7F, 0xFC, 0xF0, 0xFC, 0xFE, 0xF0, 0xF8, 0x3E, 0xF1, 0xF0, 0x1F, 0xF1, 0xF0, 0x1F, 0xFF,
-    0xE0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x1F, 0xF1, 0xF0, 0x1F, 0xF1, 0xF0, 0x1F, 0xF1, 0xF8,
-    0x3E, 0xF0, 0xFC, 0xFE, 0xF0, 0x7F, 0xFC, 0xF0, 0x3F, 0xF8, 0xF0, 0x1F, 0xE0, 0x0F, 0xFC, 0x7F,
-    0xFC, 0xFF, 0xFB, 0xF9, 0xF7, 0xC3, 0xEF, 0x07, 0xDF, 0x0F, 0xBF, 0x1F, 0x7F, 0xFE, 0x7F, 0xFC,
-    0x7F, 0xF8, 0xF9, 0xF3, 0xE3, 0xEF, 0x87, 0xDF, 0x0F, 0xFC, 0x1F, 0xF8, 0x3E, 0x3F, 0xC1, 0xFF,
-    0x8F, 0xFC, 0x63, 0xE0, 0x0F, 0x8F, 0xFD, 0xFF, 0xEF, 0xFF, 0x7C, 0xFB, 0xE7, 0xDF, 0xFE, 0xFF,
-    0xF3, 0xFF, 0x00, 0x01, 0xF0, 0x7F, 0x87, 0xFE, 0x7F, 0xC7, 0xC0, 0x3C, 0x03, 0xFF, 0x1F, 0xFE,
-    0xFF, 0xF7, 0xEF, 0xFC, 0x3F, 0xE0, 0xFF, 0x07, 0xFC, 0x3F, 0xE3, 0xFF, 0xBF, 0x7F, 0xF1, 0xFF,
-    0x07, 0xF0, 0xFF, 0xE7, 0xFF, 0xBF, 0xFD, 0xF1, 0xFF, 0x8F, 0x7F, 0xFB, 0xFF, 0xDF, 0xFF, 0xF8,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xE7, 0xFE, 0x00, 0xFF, 0xDF, 0xFB, 0xFF, 0x7C, 0x0F, 0x81, 0xF0,
-    0x3E, 0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x80, 0x0F, 0xFE, 0x07, 0xFF, 0x03, 0xFF,
-    0x83, 0xE7, 0xC1, 0xF3, 0xE0, 0xF9, 0xF0, 0x78, 0xF8, 0x3C, 0x7C, 0x1E, 0x3E, 0x1F, 0x1F, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xF0, 0x07, 0x80, 0x1F,
-    0xC1, 0xFF, 0x1F, 0xFD, 0xFB, 0xEF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xE3, 0x9F,
-    0xFC, 0x7F, 0xE1, 0xFF, 0x00, 0xFC, 0xF8, 0xFB, 0xE7, 0xCF, 0x8F, 0xBE, 0xF8, 0x3F, 0xFF, 0xC1,
-    0xFF, 0xFC, 0x07, 0xFF, 0xC0, 0x1F, 0xFC, 0x01, 0xFF, 0xF0, 0x1F, 0xFF, 0xC1, 0xFF, 0xDF, 0x0F,
-    0xBE, 0xFC, 0xF9, 0xF3, 0xEF, 0x8F, 0x8F, 0x80, 0x7F, 0xC7, 0xFE, 0x7F, 0xE7, 0x3E, 0x01, 0xE3,
-    0xFE, 0x3F, 0xE3, 0xFE, 0x01, 0xF7, 0x1F, 0x7F, 0xF7, 0xFE, 0x7F, 0xC0, 0xF8, 0x7F, 0xC7, 0xFE,
-    0x7F, 0xF7, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFE, 0x7F, 0xF3, 0xFF, 0x1F, 0xF0, 0xFF,
-    0x87, 0x80, 0x18, 0xE1, 0xEF, 0x0F, 0xF8, 0x3F, 0x80, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x0F, 0xF8,
-    0xFF, 0xCF, 0xFE, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xCF, 0xFE, 0x7F, 0xE3, 0xFE,
-    0x1F, 0xF0, 0xF0, 0xF8, 0xFB, 0xE7, 0xCF, 0xBE, 0x3F, 0xF0, 0xFF, 0x83, 0xFC, 0x0F, 0xF8, 0x3F,
-    0xF0, 0xFF, 0xC3, 0xEF, 0x8F, 0x9F, 0x3E, 0x7E, 0xF8, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0xFF, 0xC3,
-    0xCF, 0x0F, 0x3C, 0x7C, 0xF1, 0xF3, 0xC7, 0xCF, 0x1E, 0x3D, 0xF8, 0xFF, 0xC3, 0xFE, 0x0F, 0xF0,
-    0x3C, 0x78, 0x0F, 0x3E, 0x0F, 0x9F, 0x07, 0xCF, 0xC7, 0xE7, 0xE3, 0xF3, 0xFB, 0xF9, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFB, 0xEF, 0xFD, 0xF7, 0xFE, 0x73, 0xFF, 0x01, 0xFF, 0x80, 0xF8, 0xF8, 0xF7, 0xC7,
-    0xBE, 0x3D, 0xF1, 0xEF, 0x8F, 0x7F, 0xFB, 0xFF, 0xDF, 0xFE, 0xF8, 0xF7, 0xC7, 0xBE, 0x3D, 0xF1,
-    0xEF, 0x8F, 0x00, 0x1F, 0xC0, 0xFF, 0x87, 0xFF, 0x3F, 0x7E, 0xF8, 0xFB, 0xC1, 0xEF, 0x07, 0xBC,
-    0x1E, 0xF8, 0xFB, 0xF7, 0xE7, 0xFF, 0x0F, 0xF8, 0x1F, 0xC0, 0xFF, 0xF7, 0xFF, 0xBF, 0xFD, 0xF1,
-    0xEF, 0x8F, 0x7C, 0x7B, 0xE3, 0xDF, 0x1E, 0xF8, 0xF7, 0xC7, 0xBE, 0x3D, 0xF1, 0xEF, 0x8F, 0x00,
-    0x7F, 0xC7, 0xFF, 0x3F, 0xFD, 0xF3, 0xFF, 0x8F, 0xFC, 0x3F, 0xE1, 0xFF, 0x0F, 0xF8, 0xFF, 0xEF,
-    0xFF, 0xFD, 0xFF, 0xEF, 0xFC, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0x1F, 0xE7,
-    0xFD, 0xFF, 0x7E, 0x6F, 0x81, 0xE0, 0x3C, 0x07, 0x80, 0xF8, 0x1F, 0x8D, 0xFF, 0x9F, 0xF1, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C,
-    0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x00, 0xF8, 0x7F, 0xE1, 0xE7, 0x87, 0x9F, 0x3E, 0x7C, 0xF0, 0xF3,
-    0xC3, 0xFF, 0x0F, 0xF8, 0x1F, 0xE0, 0x7F, 0x80, 0xFC, 0x03, 0xF0, 0x07, 0x80, 0x3E, 0x05, 0xF0,
-    0x3F, 0xC0, 0xFE, 0x03, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01,
-    0xE0, 0x00, 0x78, 0x00, 0xFF, 0xC0, 0xFF, 0xFC, 0x7F, 0xFF, 0xBF, 0xFF, 0xEF, 0x9E, 0x7F, 0xC7,
-    0x9F, 0xF1, 0xE3, 0xFC, 0x79, 0xFF, 0x9E, 0x7F, 0xFF, 0xBE, 0x7F, 0xFF, 0x8F, 0xFF, 0xC0, 0xFF,
-    0xC0, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0xF8, 0x79, 0xF3, 0xE3,
-    0xFF, 0x0F, 0xF8, 0x1F, 0xE0, 0x3F, 0x00, 0xF8, 0x03, 0xF0, 0x1F, 0xE0, 0xFF, 0xC7, 0xCF, 0x1E,
-    0x3E, 0xF8, 0x7C, 0xF8, 0xF1, 0xF1, 0xE3, 0xE3, 0xC7, 0xC7, 0x8F, 0x8F, 0x1F, 0x1E, 0x3E, 0x3C,
-    0x7C, 0x78, 0xF8, 0xF1, 0xF1, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xC0, 0x07, 0x80,
-    0x0F, 0x00, 0x1E, 0xF1, 0xFF, 0x1F, 0xF1, 0xFF, 0x1F, 0xF1, 0xFF, 0x9F, 0xFF, 0xF7, 0xFF, 0x3F,
-    0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0xF8, 0xF1, 0xFF, 0x1E, 0x3F, 0xE3, 0xC7, 0xFC, 0x78,
-    0xFF, 0x8F, 0x1F, 0xF1, 0xE3, 0xFE, 0x3C, 0x7F, 0xC7, 0x8F, 0xF8, 0xF1, 0xFF, 0x1E, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xF1, 0xE7, 0xC7, 0x8F, 0x3E, 0x3C, 0x79, 0xF1, 0xE3,
-    0xCF, 0x8F, 0x1E, 0x7C, 0x78, 0xF3, 0xE3, 0xC7, 0x9F, 0x1E, 0x3C, 0xF8, 0xF1, 0xE7, 0xC7, 0x8F,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F,
-    0x00, 0x00, 0x78, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x1F, 0x00, 0x1F, 0xF8, 0x1F, 0xFC, 0x1F,
-    0xFE, 0x1F, 0x3E, 0x1F, 0x1E, 0x1F, 0x3E, 0x1F, 0xFE, 0x1F, 0xFC, 0x1F, 0xF8, 0xF8, 0x03, 0xFE,
-    0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x0F, 0xFF, 0xC3, 0xFF, 0xF8, 0xFF, 0xFF, 0x3F, 0xE7, 0xCF, 0xF8,
-    0xFB, 0xFE, 0x7C, 0xFF, 0xFF, 0x3F, 0xFF, 0xCF, 0x7F, 0xC3, 0xC0, 0xF8, 0x07, 0xC0, 0x3E, 0x01,
-    0xF0, 0x0F, 0xFC, 0x7F, 0xFB, 0xFF, 0xDF, 0x3E, 0xF8, 0xFF, 0xCF, 0xBF, 0xFD, 0xFF, 0xE7, 0xFC,
-    0x00, 0x7F, 0x83, 0xFF, 0x1F, 0xF8, 0xE7, 0xE0, 0x0F, 0x0F, 0xF8, 0x7F, 0xE3, 0xFE, 0x00, 0xF3,
-    0x9F, 0x9F, 0xF8, 0xFF, 0xC7, 0xF8, 0x00, 0xF8, 0x3F, 0x8F, 0x87, 0xFC, 0xF8, 0xFF, 0xEF, 0x9F,
-    0xBE, 0xF9, 0xF1, 0xFF, 0xFE, 0x1F, 0xFF, 0xE1, 0xFF, 0xFE, 0x1F, 0xF9, 0xF1, 0xFF, 0x9F, 0xBE,
-    0xF8, 0xFF, 0xEF, 0x87, 0xFC, 0xF8, 0x3F, 0x80, 0x1F, 0xF9, 0xFF, 0xDF, 0xFE, 0xF8, 0xF7, 0xC7,
-    0xBF, 0xFC, 0xFF, 0xE3, 0xFF, 0x1E, 0x79, 0xF3, 0xCF, 0x1E, 0xF8, 0xF7, 0x87, 0x80, 0x0C, 0x00,
-    0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x78, 0x01, 0x80, 0x00, 0x03, 0xF8, 0x3F, 0xE3, 0xFF, 0xBF, 0x7D,
-    0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFC, 0x73, 0xFF, 0x8F, 0xFC, 0x3F, 0xE0, 0x39,
-    0xE3, 0xEF, 0x1F, 0x78, 0x73, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xFC, 0x7F, 0xF7, 0xEF, 0xBE,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0x8E, 0x7F, 0xF1, 0xFF, 0x87, 0xFC, 0x3C, 0x00,
-    0xF0, 0x0F, 0xFC, 0x3F, 0xF0, 0x3C, 0x00, 0xF0, 0x03, 0xFE, 0x0F, 0xFC, 0x3F, 0xF8, 0xF3, 0xE3,
-    0xC7, 0xCF, 0x1F, 0x3C, 0x7C, 0xF1, 0xF3, 0xC7, 0xCF, 0x1F, 0x3C, 0x7C, 0xF1, 0xF3, 0xC7, 0xC0,
-    0x1F, 0x00, 0x7C, 0x0F, 0xE0, 0x3F, 0x80, 0xFC, 0x06, 0x01, 0xE0, 0x3E, 0x0F, 0x01, 0xC0, 0x10,
-    0x00, 0x07, 0xFE, 0xFF, 0xDF, 0xFB, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0, 0xF8, 0x1F,
-    0x03, 0xE0, 0x7C, 0x00, 0x0F, 0xF0, 0xFF, 0x8F, 0xFC, 0xFC, 0xE7, 0x80, 0x3F, 0xE1, 0xFF, 0x0F,
-    0xF8, 0x78, 0x03, 0xF3, 0x8F, 0xFC, 0x7F, 0xF0, 0xFF, 0x00, 0x1F, 0xE3, 0xFE, 0x7F, 0xC7, 0xCC,
-    0x7F, 0x07, 0xFE, 0x7F, 0xE3, 0xFE, 0x03, 0xE7, 0x1E, 0x7F, 0xE7, 0xFC, 0x7F, 0x80, 0x7F, 0xFE,
-    0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x71, 0xCF, 0x7D, 0xEF, 0xB8, 0xE0,
-    0x00, 0x00, 0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0, 0xF8,
-    0x1F, 0x03, 0xE0, 0x7C, 0x00, 0x0F, 0x1F, 0x1F, 0x0F, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0xFE, 0xFE, 0xFC, 0x0F, 0xFC, 0x00,
-    0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xCF, 0x00, 0x0F, 0x3C, 0x00, 0x7C, 0xFF, 0xC1, 0xF3, 0xFF,
-    0x87, 0xCF, 0xFF, 0x1E, 0x3C, 0x7D, 0xF8, 0xF1, 0xFF, 0xC3, 0xFF, 0xFE, 0x0F, 0xFE, 0xF0, 0x3F,
-    0xF0, 0xF8, 0xF0, 0x0F, 0x8F, 0x00, 0xF8, 0xF0, 0x0F, 0x8F, 0x00, 0xF8, 0xF0, 0x0F, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xF8, 0xF9, 0xFF, 0x8F, 0x1F, 0xF8, 0xFF, 0xFF, 0x8F, 0xFE, 0xF8,
-    0xFF, 0xC0, 0x3C, 0x00, 0xF0, 0x0F, 0xFC, 0x3F, 0xF0, 0x3C, 0x00, 0xF0, 0x03, 0xFE, 0x0F, 0xFC,
-    0x3F, 0xF8, 0xF3, 0xE3, 0xC7, 0xCF, 0x1F, 0x3C, 0x7C, 0xF1, 0xF3, 0xC7, 0xCF, 0x1F, 0x3C, 0x7C,
-    0xF1, 0xF3, 0xC7, 0xC0, 0x01, 0x80, 0x0F, 0x00, 0x7C, 0x03, 0xE0, 0x0F, 0x00, 0x18, 0x00, 0x00,
-    0x3E, 0x3E, 0xF9, 0xF3, 0xEF, 0x8F, 0xFC, 0x3F, 0xE0, 0xFF, 0x03, 0xFE, 0x0F, 0xFC, 0x3F, 0xF0,
-    0xFB, 0xE3, 0xE7, 0xCF, 0x9F, 0xBE, 0x3E, 0x0C, 0x00, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x78, 0x01,
-    0x80, 0x00, 0x1F, 0x0F, 0xF8, 0xFF, 0xCF, 0xFE, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF,
-    0xCF, 0xFE, 0x7F, 0xE3, 0xFE, 0x1F, 0xF0, 0xF0, 0x18, 0xE0, 0xF7, 0x83, 0xFE, 0x07, 0xF0, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0xF8, 0x79, 0xE1, 0xE7, 0xCF, 0x9F, 0x3C, 0x3C, 0xF0, 0xFF,
-    0xC3, 0xFE, 0x07, 0xF8, 0x1F, 0xE0, 0x3F, 0x00, 0xFC, 0x01, 0xE0, 0x0F, 0x81, 0x7C, 0x0F, 0xF0,
-    0x3F, 0x80, 0xFC, 0x00, 0xF8, 0xF7, 0xC7, 0xBE, 0x3D, 0xF1, 0xEF, 0x8F, 0x7C, 0x7B, 0xE3, 0xDF,
-    0x1E, 0xF8, 0xF7, 0xC7, 0xBF, 0xFD, 0xFF, 0xEF, 0xFF, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00,
-    0x0F, 0x80, 0x03, 0xE0, 0x0F, 0xFF, 0x83, 0xFF, 0xE0, 0xFF, 0xF8, 0x03, 0xE0, 0x00, 0xF8, 0x00,
-    0x3F, 0xF0, 0x0F, 0xFF, 0x03, 0xFF, 0xE0, 0xF9, 0xF8, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0,
-    0xF8, 0x7C, 0x3E, 0x7E, 0x0F, 0xFF, 0x83, 0xFF, 0xC0, 0xFF, 0xC0, 0x1E, 0x00, 0x3C, 0x00, 0x78,
-    0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x3F, 0xFC, 0x7F, 0xF8, 0xFF, 0xF0, 0x3C, 0x00, 0x78, 0x00,
-    0xFF, 0xC1, 0xFF, 0xC3, 0xFF, 0xC7, 0x8F, 0x8F, 0x1F, 0x1F, 0xFE, 0x3F, 0xF8, 0x7F, 0xE0, 0x07,
-    0xF8, 0x07, 0xFF, 0x83, 0xFF, 0xF1, 0xFC, 0xFC, 0x7C, 0x0F, 0xBE, 0x03, 0xEF, 0x80, 0x7F, 0xFF,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xE0, 0x1E, 0x7C, 0x0F, 0x9F, 0xCF, 0xE3, 0xFF,
-    0xF0, 0x7F, 0xF8, 0x07, 0xF8, 0x00, 0x1F, 0xC0, 0xFF, 0x87, 0xFF, 0x3F, 0x7E, 0xF8, 0x7B, 0xFD,
-    0xEF, 0xFF, 0xBD, 0xFE, 0xF8, 0x7B, 0xF7, 0xE7, 0xFF, 0x0F, 0xF8, 0x1F, 0xC0, 0xF8, 0x03, 0xF7,
-    0xC0, 0x3F, 0x9F, 0x03, 0xFC, 0xF8, 0x1F, 0x47, 0xC1, 0xF0, 0x1F, 0x0F, 0x80, 0xF8, 0x78, 0x03,
-    0xC7, 0xC0, 0x1F, 0x3E, 0x00, 0xF9, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0x80, 0x03,
-    0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xE0, 0x00, 0xF8, 0x3E, 0xF8, 0x7E, 0x78, 0x7E,
-    0x7C, 0xF8, 0x7C, 0xF0, 0x3C, 0xF0, 0x3F, 0xE0, 0x1F, 0xE0, 0x1F, 0xE0, 0x1F, 0xC0, 0x0F, 0xC0,
-    0x0F, 0x80, 0x07, 0x80, 0x1E, 0x70, 0x07, 0xBC, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x78, 0xF0, 0x3E, 0x3C, 0x1F, 0x8F, 0x0F, 0xE3, 0xC7, 0xF8, 0xF1,
-    0xFE, 0x3C, 0xFF, 0x8F, 0x7D, 0xE3, 0xFE, 0x78, 0xFF, 0x9E, 0x3F, 0xC7, 0x8F, 0xE1, 0xE3, 0xF8,
-    0x78, 0xFC, 0x1E, 0x3E, 0x07, 0xFF, 0x81, 0xFF, 0xC0, 0x7F, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00,
-    0xF8, 0x00, 0x3C, 0x00, 0x06, 0x00, 0x38, 0xE0, 0x7B, 0xC0, 0xFF, 0x80, 0xFE, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x78, 0x7C, 0xF1, 0xF9, 0xE3, 0xF3, 0xCF, 0xE7, 0xBF, 0xCF, 0xFF, 0x9F, 0xFF,
-    0x3F, 0xFE, 0x7F, 0x7C, 0xFC, 0xF9, 0xF9, 0xFF, 0xE3, 0xFF, 0x87, 0xE0, 0x03, 0xC0, 0x0F, 0x80,
-    0x1E, 0x00, 0x18, 0x3C, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0x3C, 0x00, 0x3C, 0x00, 0x3F,
-    0xF8, 0x3F, 0xFC, 0x3F, 0xFE, 0x3C, 0x7E, 0x3C, 0x1F, 0x3C, 0x1F, 0x3C, 0x1F, 0x3C, 0x7E, 0x3F,
-    0xFE, 0x3F, 0xFC, 0x3F, 0xF0, 0x7C, 0x01, 0xF0, 0x0F, 0xF8, 0x3F, 0xE0, 0x7C, 0x01, 0xFF, 0x87,
-    0xFF, 0x9F, 0xFE, 0x7C, 0xFD, 0xF1, 0xF7, 0xCF, 0xDF, 0xFE, 0x7F, 0xF8, 0xFF, 0x80, 0xFF, 0xE3,
-    0xFF, 0xCF, 0xFF, 0xBC, 0x7F, 0xF0, 0x7F, 0xDD, 0xFF, 0x7F, 0xFD, 0xFE, 0xFF, 0xFB, 0xFF, 0xCF,
-    0xFE, 0x3C, 0x3C, 0xF0, 0xF3, 0xC1, 0x8F, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x7F, 0xC3, 0xFF, 0xCF,
-    0xFF, 0x3E, 0x7E, 0xF8, 0xFB, 0xE1, 0xFF, 0x87, 0xFE, 0xDF, 0xFF, 0xFB, 0xFF, 0xEF, 0xFF, 0xBF,
-    0xFC, 0xFF, 0xF3, 0xE3, 0xCF, 0x87, 0x3E, 0x1C, 0xF8, 0x03, 0xE0, 0x00, 0x00, 0xF0, 0x0F, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
-    0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0x01, 0xC0, 0x38, 0x07, 0x7F, 0xEF,
-    0xFD, 0xFF, 0xBE, 0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0,
-    0x3F, 0xFE, 0x7F, 0xFC, 0xFF, 0xF9, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x7F, 0xF0, 0xFF,
-    0xE1, 0xFF, 0xC0, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00,
-    0x3F, 0xF3, 0xFF, 0x3F, 0xF3, 0xC0, 0x3C, 0x03, 0xC0, 0xFF, 0xCF, 0xFC, 0x3C, 0x03, 0xC0, 0x3C,
-    0x03, 0xC0, 0x3C, 0x00, 0xFF, 0xF3, 0xFF, 0xCF, 0xFF, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0xFC,
-    0x3F, 0xFC, 0xFF, 0xFB, 0xC7, 0xEF, 0x07, 0xFC, 0x1F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x1F,
-    0xF0, 0x7C, 0x01, 0xF0, 0x1F, 0x81, 0xFC, 0x07, 0xF0, 0x1F, 0x00, 0xFF, 0xE7, 0xFF, 0x3F, 0xF9,
-    0xF0, 0x0F, 0x80, 0x7F, 0xE3, 0xFF, 0x9F, 0xFE, 0xF9, 0xF7, 0xC7, 0xBE, 0x3F, 0xF0, 0xFF, 0x8F,
-    0x80, 0x7C, 0x07, 0xC0, 0xFE, 0x07, 0xE0, 0x3E, 0x00, 0xFC, 0x3E, 0x1F, 0x1F, 0x8F, 0x8F, 0xC3,
-    0xE3, 0xE7, 0xE0, 0xFC, 0xFB, 0xF0, 0x1F, 0xBE, 0xF8, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x00,
-    0x0F, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x00, 0x3E, 0xFF, 0xE0,
-    0x1F, 0x3E, 0xF8, 0x0F, 0xCF, 0x9F, 0x07, 0xE3, 0xE3, 0xF9, 0xF0, 0xF8, 0xFE, 0xF8, 0x3E, 0x1F,
-    0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0xFC, 0xF8,
-    0xF9, 0xF3, 0xE7, 0xC3, 0xEF, 0xBE, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xC0, 0x3F, 0xFE, 0x00, 0x7F,
-    0xF0, 0x03, 0xFF, 0xE0, 0x1F, 0xFF, 0xC0, 0xFF, 0xFF, 0x83, 0xEF, 0xBF, 0xDF, 0x3E, 0x7F, 0xF8,
-    0xF8, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x3F, 0xE0, 0xFF,
-    0xE1, 0xFF, 0xE1, 0xC7, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x7E, 0x0F, 0xFC, 0x1F, 0xF0, 0x3F, 0xF8,
-    0x03, 0xF0, 0x01, 0xE0, 0x03, 0xCF, 0x1F, 0x9F, 0xFF, 0x7F, 0xFC, 0x3F, 0xF0, 0x0F, 0x00, 0x1F,
-    0x00, 0x1E, 0x00, 0xFC, 0x01, 0xF0, 0x00, 0x7F, 0xC7, 0xFE, 0x7F, 0xE7, 0x3E, 0x01, 0xE3, 0xFE,
-    0x3F, 0xE3, 0xFE, 0x01, 0xF7, 0x1F, 0x7F, 0xF7, 0xFE, 0x7F, 0xC0, 0xF0, 0x0F, 0x01, 0x78, 0x1F,
-    0x81, 0xF0, 0xF0, 0x7C, 0xF0, 0xFC, 0xF1, 0xF8, 0xF3, 0xF0, 0xF7, 0xE0, 0xFF, 0xC0, 0xFF, 0x80,
-    0xFF, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xC0, 0xF7, 0xE0, 0xF3, 0xF0, 0xF1, 0xF8, 0xF0, 0xFF,
-    0xF0, 0x7F, 0xF0, 0x7F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0xF8, 0xFB,
-    0xE7, 0xCF, 0xBE, 0x3F, 0xF0, 0xFF, 0x83, 0xFC, 0x0F, 0xF8, 0x3F, 0xF0, 0xFF, 0xC3, 0xEF, 0x8F,
-    0x9F, 0xFE, 0x3F, 0xF8, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0xF0, 0x0F, 0xBC, 0x07,
-    0xEF, 0x01, 0xF3, 0xDC, 0xF8, 0xF7, 0x7C, 0x3D, 0xFE, 0x0F, 0x7F, 0x83, 0xFF, 0xC0, 0xFF, 0xF0,
-    0x3F, 0xFE, 0x0F, 0x7F, 0xC3, 0xDF, 0xF0, 0xF7, 0x7E, 0x3D, 0xCF, 0xCF, 0x01, 0xF3, 0xC0, 0x7E,
-    0xF0, 0x0F, 0x80, 0xF8, 0x3F, 0xF8, 0x3E, 0xFF, 0x7C, 0xFF, 0xF8, 0xFF, 0xF0, 0xFF, 0xE0, 0xFF,
-    0xF0, 0xFF, 0xF0, 0xFF, 0xF8, 0xFF, 0x7C, 0xF8, 0x3E, 0xF8, 0x3E, 0xF8, 0x1F, 0x3E, 0x00, 0x0F,
-    0x83, 0xEF, 0xF9, 0xFB, 0xFE, 0xFC, 0xFF, 0xFE, 0x0F, 0xBF, 0x03, 0xFF, 0x80, 0xFF, 0xC0, 0x3F,
-    0xE0, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0xFF, 0xC0, 0x3F, 0xF8, 0x0F, 0xBF, 0x03, 0xE7, 0xE0, 0xF8,
-    0xFC, 0x3E, 0x1F, 0x0F, 0x83, 0xE0, 0x7C, 0x01, 0xFE, 0x7F, 0xFD, 0xF7, 0xFF, 0xC7, 0xDF, 0x0F,
-    0xFC, 0x1F, 0xF0, 0x3F, 0xC0, 0x7F, 0xC0, 0xFF, 0xC1, 0xFF, 0xC3, 0xEF, 0xC7, 0xC7, 0xCF, 0x8F,
-    0xC0, 0xFF, 0x83, 0xEF, 0xF8, 0x7C, 0xFF, 0x8F, 0x80, 0xF9, 0xF0, 0x0F, 0xBF, 0x00, 0xFF, 0xC0,
-    0x0F, 0xF8, 0x00, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0xFF, 0xE0, 0x0F, 0xFE, 0x00, 0xFB, 0xF0, 0x0F,
-    0x9F, 0x80, 0xF8, 0xFC, 0x0F, 0x87, 0xC0, 0xF8, 0x3E, 0x0F, 0x83, 0xF0, 0xFF, 0x1F, 0x7F, 0x9F,
-    0x3F, 0xDF, 0x03, 0xFF, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x3F, 0xF0, 0x1F, 0xFC, 0x0F,
-    0xBE, 0x07, 0xCF, 0x83, 0xE7, 0xE1, 0xF1, 0xF0, 0xF0, 0x3E, 0x3C, 0x0F, 0x8F, 0x03, 0xE3, 0xC0,
-    0xF8, 0xF0, 0x3E, 0x3C, 0x0F, 0x8F, 0x03, 0xE3, 0xFF, 0xF8, 0xFF, 0xFE, 0x3F, 0xFF, 0x8F, 0x03,
-    0xE3, 0xC0, 0xF8, 0xF0, 0x3E, 0x3C, 0x0F, 0x8F, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x3F, 0xC0, 0x00,
-    0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0xF8, 0xF1, 0xF1, 0xE3, 0xE3, 0xC7,
-    0xC7, 0x8F, 0x8F, 0x1F, 0xFE, 0x3F, 0xFC, 0x7F, 0xF8, 0xF8, 0xF1, 0xF1, 0xE3, 0xE3, 0xFF, 0xC7,
-    0xFF, 0x8F, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0xF0, 0x3F, 0xFE, 0x07, 0xFF, 0xC0,
-    0xFF, 0xF8, 0x1F, 0x0F, 0x03, 0xE1, 0xE0, 0x7C, 0x3C, 0x0F, 0x87, 0xFF, 0xF0, 0xFF, 0xFE, 0x1F,
-    0xFF, 0xC3, 0xC0, 0xF8, 0x78, 0x1F, 0x0F, 0x03, 0xE1, 0xE0, 0x7C, 0x3C, 0x0F, 0x87, 0x81, 0xF0,
-    0xF0, 0x3E, 0x00, 0xF8, 0xFE, 0xF8, 0xFE, 0xF8, 0xFE, 0xF8, 0xF0, 0xF8, 0xF0, 0xFF, 0xF0, 0xFF,
-    0xF0, 0xFF, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xFF, 0xFE, 0x00,
-    0x7F, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x1E, 0x07, 0xC0, 0x0F, 0x03, 0xE0, 0x07, 0x81, 0xF0, 0x03,
-    0xC0, 0xFF, 0xE1, 0xE0, 0x7F, 0xF8, 0xF0, 0x3F, 0xFE, 0x78, 0x1F, 0x3F, 0xBC, 0x0F, 0x83, 0xDE,
-    0x07, 0xC1, 0xFF, 0x03, 0xE0, 0xFF, 0x81, 0xF0, 0x3F, 0xC0, 0xF8, 0x3F, 0xE0, 0x7C, 0x1F, 0xF0,
-    0x3E, 0x0F, 0x80, 0x00, 0x07, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00,
-    0x0F, 0xC0, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0xFF, 0xF0, 0x0F, 0x8F, 0x00, 0xF8, 0xF0, 0x0F, 0x8F,
-    0xF8, 0xF8, 0xFF, 0xEF, 0x8F, 0xFE, 0xF8, 0xFB, 0xFF, 0x8F, 0x0F, 0xF8, 0xF0, 0xFF, 0x8F, 0x0F,
-    0xF8, 0xF0, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFC, 0x07,
-    0xFC, 0x03, 0xFF, 0x80, 0xFF, 0xE0, 0x3F, 0x8C, 0x07, 0xC0, 0x01, 0xF0, 0xFE, 0x3E, 0x3F, 0xE7,
-    0xCF, 0xFE, 0xF9, 0xF7, 0xDF, 0x3C, 0x7B, 0xEF, 0x8F, 0x7D, 0xF1, 0xE7, 0xFE, 0x7C, 0xFF, 0xFF,
-    0x8F, 0xFF, 0xE0, 0xFF, 0xF8, 0x07, 0xFC, 0x00, 0x1F, 0xE0, 0x01, 0xFF, 0x00, 0x0F, 0xE0, 0x00,
-    0x7C, 0x1F, 0xC0, 0x7F, 0x81, 0xFF, 0x07, 0xE6, 0x0F, 0x1F, 0x9E, 0x7F, 0xBD, 0xFF, 0x7B, 0xDE,
-    0xF7, 0x9D, 0xFF, 0x79, 0xFF, 0xF1, 0xFF, 0xC1, 0xFF, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x7E, 0x00,
-    0x3C, 0x07, 0xFC, 0x3F, 0xFC, 0xFF, 0xF3, 0xF8, 0xE7, 0xC0, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00,
-    0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x07, 0xC0, 0x0F, 0xE3, 0x8F, 0xFF, 0x8F, 0xFF, 0x07,
-    0xFC, 0x03, 0x80, 0x07, 0x80, 0x07, 0x00, 0x7E, 0x00, 0xF8, 0x00, 0x1F, 0xE7, 0xFD, 0xFF, 0x7E,
-    0x6F, 0x81, 0xE0, 0x3C, 0x07, 0x80, 0xF8, 0x1F, 0x8D, 0xFF, 0x9F, 0xF0, 0xFE, 0x1E, 0x01, 0xE0,
-    0x3C, 0x1F, 0x83, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01,
-    0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xFE,
-    0x03, 0xFC, 0x07, 0xF8, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xF8,
-    0x1F, 0xC0, 0xFE, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0xF8, 0x1F, 0xBE, 0x0F, 0x9F, 0x0F,
-    0x87, 0xC7, 0xC3, 0xE7, 0xC0, 0xFB, 0xE0, 0x7F, 0xE0, 0x1F, 0xF0, 0x07, 0xF0, 0x03, 0xF0, 0x00,
-    0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0xF8,
-    0x7F, 0xE1, 0xE7, 0x8F, 0x9F, 0x3E, 0x7C, 0xF0, 0xF7, 0xC3, 0xFF, 0x07, 0xF8, 0x1F, 0xE0, 0x7F,
-    0x00, 0xFC, 0x03, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0xF8,
-    0x1F, 0xBE, 0x0F, 0x9F, 0x0F, 0x87, 0xC7, 0xC3, 0xE7, 0xC0, 0xFB, 0xE0, 0x7F, 0xE0, 0x1F, 0xF0,
-    0x07, 0xF0, 0x03, 0xF0, 0x07, 0xFF, 0x03, 0xFF, 0x81, 0xFF, 0xC0, 0x1F, 0x00, 0x0F, 0x80, 0x07,
-    0xC0, 0x03, 0xE0, 0x00, 0xF8, 0x7F, 0xE1, 0xE7, 0x8F, 0x9F, 0x3E, 0x7C, 0xF0, 0xF7, 0xC3, 0xFF,
-    0x07, 0xF8, 0x1F, 0xE0, 0x7F, 0x00, 0xFC, 0x0F, 0xFC, 0x3F, 0xF0, 0x1E, 0x00, 0x78, 0x01, 0xE0,
-    0x07, 0x80, 0x1E, 0x00, 0xFC, 0x1F, 0x1F, 0x8F, 0xC3, 0xE3, 0xE0, 0xFD, 0xF0, 0x1F, 0xFC, 0x03,
-    0xFE, 0x00, 0xFF, 0x00, 0x1F, 0xC0, 0x03, 0xE0, 0x01, 0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x1F,
-    0x7C, 0x0F, 0x9F, 0x87, 0xE3, 0xFD, 0xF0, 0x7F, 0xF8, 0x1F, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00,
-    0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0xF8, 0x78, 0xF9, 0xF0, 0xFF, 0xC1, 0xFF, 0x01, 0xFE, 0x01,
-    0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x1F, 0xE0, 0x7F, 0xE1, 0xF3, 0xFB, 0xC7, 0xFF, 0x87, 0xE0, 0x03,
-    0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0xFF, 0xFD, 0xF1, 0xFF, 0xFB, 0xE3, 0xFF, 0xF7, 0xC0, 0x3C,
-    0x0F, 0x80, 0x78, 0x1F, 0x00, 0xF0, 0x3E, 0x01, 0xE0, 0x7C, 0x03, 0xC0, 0xF8, 0x07, 0x81, 0xF0,
-    0x0F, 0x03, 0xE0, 0x1E, 0x07, 0xC0, 0x3C, 0x0F, 0x80, 0x78, 0x1F, 0x00, 0xF0, 0x3E, 0x01, 0xFF,
-    0xFF, 0x83, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0,
-    0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0xFF, 0xDE, 0x7F, 0xEF, 0x3F, 0xF7, 0x87, 0xC3, 0xC3, 0xE1,
-    0xE1, 0xF0, 0xF0, 0xF8, 0x78, 0x7C, 0x3C, 0x3E, 0x1E, 0x1F, 0x0F, 0x0F, 0xFF, 0xE7, 0xFF, 0xF3,
-    0xFF, 0xF8, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80, 0xF8, 0x3E, 0x7C, 0x1F, 0x3E,
-    0x0F, 0x9F, 0x07, 0xCF, 0x83, 0xE7, 0xC1, 0xF3, 0xE0, 0xF9, 0xF8, 0x7C, 0x7F, 0xFE, 0x3F, 0xFF,
-    0x07, 0xFF, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x80,
-    0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0xF8, 0xF1, 0xF1, 0xE3, 0xE3, 0xC7,
-    0xC7, 0x8F, 0x8F, 0x1F, 0x9E, 0x1F, 0xFC, 0x3F, 0xF8, 0x3F, 0xF0, 0x01, 0xE0, 0x03, 0xF8, 0x07,
-    0xF0, 0x0F, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0xF8, 0x3F, 0xE0, 0xFF, 0x83, 0xFE,
-    0x0F, 0xF8, 0x3F, 0xEE, 0xFF, 0xBB, 0xFF, 0xEF, 0x7F, 0xFD, 0xFF, 0xF1, 0xFF, 0xC0, 0xEF, 0x03,
-    0xBC, 0x0E, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0xF8, 0x7F, 0xC3, 0xFE, 0x1F, 0xF0, 0xFF, 0xB7,
-    0xFF, 0xBD, 0xFF, 0xEF, 0xFF, 0x3F, 0xF8, 0x1B, 0xC0, 0xDE, 0x00, 0xF0, 0x07, 0x80, 0xF0, 0x03,
-    0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xFF, 0x8F, 0xFF, 0xBF, 0xFF, 0xF8, 0xFF, 0xC1, 0xFF,
-    0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3C, 0x78, 0x07, 0xC0, 0x3E,
-    0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xFF, 0x1F, 0xFC, 0xFF, 0xF7, 0xCF, 0xBE, 0x3D, 0xF1, 0xEF,
-    0x8F, 0x7C, 0x7B, 0xE3, 0xDF, 0x1E, 0xF8, 0xF7, 0xC7, 0xBE, 0x3C, 0x00, 0x7F, 0x80, 0x07, 0xFE,
-    0x00, 0x7F, 0xF8, 0x07, 0xE7, 0xEF, 0x7E, 0x1F, 0x7B, 0xE0, 0x7F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xF8, 0xFF, 0xFF, 0xC1, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x01, 0xFC, 0xF0,
-    0x07, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x7F, 0xC0, 0x01, 0xFC, 0x71, 0xFF, 0x3D, 0xFF, 0xDF, 0xFB,
-    0xEF, 0xF8, 0xFF, 0xFF, 0xFD, 0xFF, 0xFE, 0x7F, 0xFF, 0x0F, 0x80, 0x07, 0xE3, 0x81, 0xFF, 0xC0,
-    0x7F, 0xE0, 0x1F, 0xF0, 0x00, 0x7F, 0x80, 0x07, 0xFE, 0x00, 0x7F, 0xF8, 0x07, 0xE7, 0xEF, 0x7E,
-    0x1F, 0x7B, 0xE0, 0x7F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xF8, 0xFF, 0xFF, 0xC1, 0xF0,
-    0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x01, 0xFC, 0xF0, 0x0F, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x7F,
-    0xE0, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xFC, 0x71, 0xFF,
-    0x3D, 0xFF, 0xDF, 0xFB, 0xEF, 0xF8, 0xFF, 0xFF, 0xFD, 0xFF, 0xFE, 0x7F, 0xFF, 0x0F, 0x80, 0x07,
-    0xE3, 0x81, 0xFF, 0xC0, 0x7F, 0xE0, 0x1F, 0xF0, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xE3, 0x00, 0x00, 0x7B, 0xC0, 0x00, 0x3F, 0xE0,
-    0x00, 0x0F, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x7C, 0x3E,
-    0x7E, 0x3E, 0x3F, 0x1F, 0x1F, 0x3F, 0x0F, 0xCF, 0xBF, 0x03, 0xF7, 0xDF, 0x00, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xF8, 0x03,
-    0xEF, 0xFE, 0x03, 0xE7, 0xDF, 0x83, 0xF3, 0xE7, 0xC3, 0xF1, 0xF1, 0xF1, 0xF0, 0xF8, 0xFD, 0xF0,
-    0x7C, 0x3E, 0x01, 0x8C, 0x00, 0x1E, 0xF0, 0x00, 0xFF, 0x80, 0x03, 0xF8, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x9F, 0x1F, 0x7C, 0xF9, 0xF1, 0xF7, 0xDF, 0x07, 0xFF, 0xF8, 0x3F,
-    0xFF, 0x80, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x3F, 0xFE, 0x03, 0xFF, 0xF8, 0x3F, 0xFB, 0xE1, 0xF7,
-    0xDF, 0x9F, 0x3E, 0x7D, 0xF1, 0xF1, 0xF0, 0xF0, 0x7D, 0xE1, 0xF3, 0xC7, 0xE7, 0x9F, 0x8F, 0x7E,
-    0x1E, 0xF8, 0x3F, 0xE0, 0x7F, 0xE0, 0xFF, 0xF1, 0xFF, 0xF3, 0xCF, 0xF7, 0x83, 0xEF, 0x03, 0xDE,
-    0x07, 0xBC, 0x0F, 0x78, 0x1E, 0xF0, 0x3C, 0x00, 0xF8, 0x07, 0xF0, 0x3F, 0xC0, 0x7F, 0x00, 0xFC,
-    0x00, 0xF8, 0xFF, 0xCF, 0xBE, 0xF9, 0xFF, 0x8F, 0xF8, 0x7F, 0xE3, 0xFF, 0x9F, 0xFE, 0xF9, 0xF7,
-    0xC7, 0xFE, 0x1F, 0xF0, 0xFF, 0x87, 0x80, 0x7C, 0x07, 0xC0, 0xFE, 0x07, 0xE0, 0x3E, 0x00, 0x07,
-    0xFF, 0xC0, 0x3F, 0xFE, 0x01, 0xFF, 0xF0, 0x0F, 0x8F, 0x80, 0x7C, 0x7C, 0x03, 0xE3, 0xE0, 0x1E,
-    0x1F, 0x00, 0xF0, 0xF8, 0x07, 0x87, 0xC0, 0x3C, 0x3E, 0x03, 0xE1, 0xF0, 0x1F, 0x0F, 0x81, 0xF0,
-    0x7C, 0x3F, 0x83, 0xE3, 0xF8, 0x1F, 0xFF, 0x80, 0xFE, 0xF0, 0x07, 0xF0, 0x00, 0x07, 0x80, 0x00,
-    0x7C, 0x00, 0x03, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xE0, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x01,
-    0xE7, 0x80, 0xF3, 0xC0, 0xF9, 0xE0, 0x7C, 0xF0, 0x3E, 0x78, 0x1E, 0x3C, 0x3F, 0x1E, 0x3F, 0x0F,
-    0xFF, 0x07, 0xFF, 0x03, 0xF0, 0x00, 0x78, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x0C, 0x00, 0xF0, 0x3F,
-    0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3E, 0x00, 0x7C,
-    0x00, 0xF8, 0x0F, 0xE0, 0x1F, 0xC0, 0x3F, 0x00, 0xF8, 0xFF, 0xC7, 0xFE, 0x3F, 0xF1, 0xFF, 0x8F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xC7, 0xFE, 0x3F, 0xF1, 0xFF, 0x8F, 0x80, 0x7C, 0x03,
-    0xC0, 0xFE, 0x07, 0xF0, 0x3F, 0x00, 0xF0, 0x3E, 0x3C, 0x0F, 0x8F, 0x03, 0xE3, 0xC0, 0xF8, 0xF0,
-    0x3E, 0x3C, 0x0F, 0x8F, 0x03, 0xE3, 0xFF, 0xF8, 0xFF, 0xFE, 0x3F, 0xFF, 0x8F, 0x03, 0xE3, 0xC0,
-    0xF8, 0xF0, 0x3E, 0x3C, 0x0F, 0x8F, 0x03, 0xFB, 0xC0, 0xFE, 0xF0, 0x3F, 0x80, 0x03, 0xE0, 0x00,
-    0xF8, 0x00, 0x7C, 0x00, 0x1E, 0x00, 0x03, 0x80, 0xF8, 0xF1, 0xF1, 0xE3, 0xE3, 0xC7, 0xC7, 0x8F,
-    0x8F, 0x1F, 0xFE, 0x3F, 0xFC, 0x7F, 0xF8, 0xF8, 0xF1, 0xF1, 0xE3, 0xE3, 0xF7, 0xC7, 0xEF, 0x8F,
-    0xC0, 0x07, 0x80, 0x1E, 0x00, 0x3C, 0x00, 0x30, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0,
-    0x3F, 0xC0, 0xFF, 0x83, 0xFF, 0x1F, 0xFF, 0xFD, 0xFF, 0xF3, 0xFF, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
-    0xF0, 0x1F, 0xC0, 0x7F, 0x01, 0xFC, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0xF1,
-    0xFF, 0x1F, 0xF1, 0xFF, 0x1F, 0xF9, 0xFF, 0xFF, 0x7F, 0xF3, 0xFF, 0x01, 0xF0, 0x1F, 0x07, 0xF0,
-    0x7F, 0x07, 0xF0, 0x78, 0x07, 0x80, 0x78, 0x07, 0x80, 0x7C, 0x03, 0xE0, 0xFC, 0x07, 0xC1, 0xF8,
-    0x1F, 0x83, 0xF8, 0x3F, 0x07, 0xF0, 0xFE, 0x0F, 0xF1, 0xFE, 0x1F, 0xE7, 0xFC, 0x3F, 0xEF, 0xF8,
-    0x7B, 0xDF, 0xF0, 0xF7, 0xFB, 0xE1, 0xE7, 0xF7, 0xC7, 0xCF, 0xC7, 0x8F, 0x9F, 0x8F, 0x1F, 0x1F,
-    0x1E, 0x3E, 0x3C, 0x3F, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0xFE, 0x00, 0x00, 0x78, 0x00, 0x01, 0xF0,
-    0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x06, 0x00, 0x78, 0x1F, 0x0F, 0x83, 0xE1, 0xF0, 0xFC,
-    0x3F, 0x1F, 0x8F, 0xE7, 0xF1, 0xFE, 0xFE, 0x3F, 0xFF, 0xC7, 0xBF, 0xF8, 0xF7, 0xEF, 0x1E, 0x7D,
-    0xE3, 0xCF, 0x3F, 0xF8, 0x07, 0xFF, 0x00, 0xFE, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x3C, 0x00,
-    0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0x38, 0x03,
-    0xDE, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x0F, 0xFC, 0x03, 0xCF, 0x01, 0xF3, 0xE0, 0x78,
-    0xF8, 0x1E, 0x1E, 0x0F, 0xFF, 0xC3, 0xFF, 0xF0, 0xFF, 0xFE, 0x7C, 0x0F, 0x9F, 0x03, 0xEF, 0x80,
-    0x7F, 0xE0, 0x1F, 0x1C, 0xE1, 0xE7, 0x87, 0xF8, 0x3F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF8,
-    0x3F, 0xF1, 0xFF, 0x8C, 0x7C, 0x01, 0xF1, 0xFF, 0xBF, 0xFD, 0xFF, 0xEF, 0x9F, 0x7C, 0xFB, 0xFF,
-    0xDF, 0xFE, 0x7F, 0xE0, 0x0F, 0x38, 0x03, 0xDF, 0x00, 0xF7, 0xC0, 0x3C, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1E, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0xF0, 0x0F,
-    0x3C, 0x07, 0xCF, 0x81, 0xE3, 0xE0, 0x78, 0x78, 0x3F, 0xFF, 0x0F, 0xFF, 0xC3, 0xFF, 0xF9, 0xF0,
-    0x3E, 0x7C, 0x0F, 0xBE, 0x01, 0xFF, 0x80, 0x7C, 0x3C, 0xE1, 0xEF, 0x8F, 0x7C, 0x79, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0x07, 0xFE, 0x3F, 0xF1, 0x8F, 0x80, 0x3E, 0x3F, 0xF7, 0xFF, 0xBF, 0xFD, 0xF3,
-    0xEF, 0x9F, 0x7F, 0xFB, 0xFF, 0xCF, 0xFC, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x7F, 0xFF,
-    0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xEF, 0x00, 0x03, 0xEF, 0x00, 0x07, 0xCF, 0xFE, 0x07,
-    0xCF, 0xFE, 0x0F, 0x8F, 0xFE, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x3E, 0x0F,
-    0x00, 0x7C, 0x0F, 0xFF, 0x7C, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0x3F, 0xCF, 0xC1, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFC, 0x63, 0xFB, 0xF0, 0x0F, 0x87, 0x8F, 0xFF, 0xFD, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x7C,
-    0xF8, 0x03, 0xE3, 0xF3, 0x9F, 0xFF, 0xFC, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x00, 0x39, 0xC3, 0xCF,
-    0x0F, 0xF0, 0x7F, 0x81, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 0xF7, 0xFF, 0xBC, 0x01, 0xE0,
-    0x0F, 0x00, 0x78, 0x03, 0xFF, 0x9F, 0xFC, 0xFF, 0xE7, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0xC1, 0xEF, 0x0F, 0xF8, 0x3F, 0x80, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x3F, 0xE3, 0xFF, 0xBF, 0x7D, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFC, 0x73,
-    0xFF, 0x8F, 0xFC, 0x3F, 0xE0, 0x1F, 0xF0, 0x7F, 0xF8, 0x7F, 0xFC, 0x38, 0xFE, 0x00, 0x1F, 0x00,
-    0x1F, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xF8, 0x1F, 0x7C, 0x3F, 0x7E,
-    0x7E, 0x3F, 0xFC, 0x1F, 0xF8, 0x0F, 0xF0, 0x7F, 0x83, 0xFF, 0x1F, 0xFC, 0xE7, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xCF, 0x9F, 0xFC, 0xFF, 0xC1, 0xF8, 0x00, 0x1E, 0x70, 0x1E,
-    0xF8, 0x1E, 0xF8, 0x1E, 0x70, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xF8, 0x7F, 0xFC, 0x38,
-    0xFE, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xF8,
-    0x1F, 0x7C, 0x3F, 0x7E, 0x7E, 0x3F, 0xFC, 0x1F, 0xF8, 0x0F, 0xF0, 0x39, 0xE3, 0xEF, 0x1F, 0x78,
-    0x73, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x0F, 0xFC, 0x7F, 0xF3, 0x9F, 0x80, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC3, 0xFF, 0x3E, 0x7F, 0xF3, 0xFF, 0x07, 0xE0, 0x00, 0xE7, 0x80, 0x00, 0xFB, 0xC0,
-    0x00, 0x7D, 0xE0, 0x00, 0x1C, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xF8, 0x7C,
-    0xFC, 0x7C, 0x7E, 0x3E, 0x3E, 0x7E, 0x1F, 0x9F, 0x7E, 0x07, 0xEF, 0xBE, 0x01, 0xFF, 0xFE, 0x00,
-    0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x07,
-    0xDF, 0xFC, 0x07, 0xCF, 0xBF, 0x07, 0xE7, 0xCF, 0x87, 0xE3, 0xE3, 0xE3, 0xE1, 0xF1, 0xFB, 0xE0,
-    0xF8, 0x7C, 0x03, 0xCE, 0x00, 0x1E, 0xF8, 0x00, 0xF7, 0xC0, 0x07, 0x9C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF3, 0xE3, 0xEF, 0x9F, 0x3E, 0x3E, 0xFB, 0xE0, 0xFF, 0xFF, 0x07, 0xFF, 0xF0, 0x1F,
-    0xFF, 0x00, 0x7F, 0xF0, 0x07, 0xFF, 0xC0, 0x7F, 0xFF, 0x07, 0xFF, 0x7C, 0x3E, 0xFB, 0xF3, 0xE7,
-    0xCF, 0xBE, 0x3E, 0x3E, 0x3C, 0xF0, 0x79, 0xE0, 0xF3, 0xC1, 0xE7, 0x80, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x3F, 0xF8, 0x7F, 0xF8, 0x71, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x1F, 0x83, 0xFF, 0x07, 0xFC,
-    0x0F, 0xFE, 0x00, 0xFC, 0x00, 0x78, 0x00, 0xF3, 0xC7, 0xE7, 0xFF, 0xDF, 0xFF, 0x0F, 0xFC, 0x00,
-    0x79, 0xC7, 0xBE, 0x7B, 0xE7, 0x9C, 0x00, 0x00, 0x00, 0x7F, 0xC7, 0xFE, 0x7F, 0xE7, 0x3E, 0x01,
-    0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x01, 0xF7, 0x1F, 0x7F, 0xF7, 0xFE, 0x7F, 0xC0, 0x7F, 0xFD, 0xFF,
-    0xF7, 0xFF, 0xC0, 0x7E, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x03, 0xFC, 0x0F, 0xF8, 0x07, 0xF0, 0x07,
-    0xC0, 0x0F, 0x00, 0x7D, 0xE3, 0xF7, 0xFF, 0xBF, 0xFE, 0x3F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x3E, 0x07, 0xC0, 0x7C, 0x0F, 0x81, 0xF0, 0x1F, 0xC1, 0xFE, 0x03, 0xF0, 0x1F, 0x00, 0xF0, 0x0F,
-    0x63, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x07, 0xF8, 0x1F, 0xF0, 0x7F, 0xE1, 0xFF, 0xC7, 0xFF, 0x8F, 0xFF, 0x3F, 0xFE, 0xFB,
-    0xFF, 0xE7, 0xFF, 0xCF, 0xFF, 0x1F, 0xFC, 0x3F, 0xF8, 0x7F, 0xE0, 0xFF, 0x81, 0xFF, 0x03, 0xFC,
-    0x07, 0x80, 0x3F, 0xE1, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xFF, 0x1F, 0xF9,
-    0xFF, 0xDF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF9, 0xFF, 0xCF, 0xFC, 0x7F, 0xC3, 0xFE,
-    0x1E, 0x1E, 0x70, 0x3D, 0xF0, 0x7B, 0xE0, 0xF3, 0x80, 0x00, 0x00, 0x00, 0x3C, 0x07, 0xF8, 0x1F,
-    0xF0, 0x7F, 0xE1, 0xFF, 0xC7, 0xFF, 0x8F, 0xFF, 0x3F, 0xFE, 0xFB, 0xFF, 0xE7, 0xFF, 0xCF, 0xFF,
-    0x1F, 0xFC, 0x3F, 0xF8, 0x7F, 0xE0, 0xFF, 0x81, 0xFF, 0x03, 0xFC, 0x07, 0x80, 0x3C, 0xE1, 0xE7,
-    0x8F, 0x3C, 0x79, 0xC0, 0x00, 0x00, 0x03, 0xE1, 0xFF, 0x1F, 0xF9, 0xFF, 0xDF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xBF, 0xF9, 0xFF, 0xCF, 0xFC, 0x7F, 0xC3, 0xFE, 0x1E, 0x0F, 0x38, 0x03, 0xCF,
-    0x00, 0xF3, 0xC0, 0x3C, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0xF8, 0x3F, 0xFF,
-    0x1F, 0xCF, 0xC7, 0xC0, 0xFB, 0xE0, 0x3E, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F,
-    0xF8, 0x07, 0xFE, 0x03, 0xE7, 0xC0, 0xF9, 0xFC, 0xFE, 0x3F, 0xFF, 0x07, 0xFF, 0x80, 0x7F, 0x80,
-    0x3C, 0xE0, 0xF7, 0xC3, 0xDF, 0x0F, 0x38, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xF8, 0x7F, 0xF3,
-    0xF7, 0xEF, 0x8F, 0xBC, 0x1E, 0xF0, 0x7B, 0xC1, 0xEF, 0x8F, 0xBF, 0x7E, 0x7F, 0xF0, 0xFF, 0x81,
-    0xFC, 0x00, 0x07, 0xF8, 0x07, 0xFF, 0x83, 0xFF, 0xF1, 0xFC, 0xFC, 0x7C, 0x0F, 0xBE, 0x03, 0xEF,
-    0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xE0, 0x3E, 0x7C, 0x0F, 0x9F,
-    0xCF, 0xE3, 0xFF, 0xF0, 0x7F, 0xF8, 0x07, 0xF8, 0x00, 0x1F, 0xC0, 0xFF, 0x87, 0xFF, 0x3F, 0x7E,
-    0xF0, 0x7B, 0xFF, 0xEF, 0xFF, 0xBC, 0x1E, 0xF8, 0xFB, 0xF7, 0xE7, 0xFF, 0x0F, 0xF8, 0x1F, 0xC0,
-    0x0F, 0x38, 0x03, 0xCF, 0x00, 0xF3, 0xC0, 0x3C, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x7F, 0xF8, 0x3F, 0xFF, 0x1F, 0xCF, 0xC7, 0xC0, 0xFB, 0xE0, 0x3E, 0xF8, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFE, 0x03, 0xE7, 0xC0, 0xF9, 0xFC, 0xFE, 0x3F, 0xFF, 0x07,
-    0xFF, 0x80, 0x7F, 0x80, 0x39, 0xE1, 0xF7, 0x87, 0xDE, 0x0E, 0x78, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x0F, 0xF8, 0x7F, 0xF3, 0xF7, 0xEF, 0x07, 0xBF, 0xFE, 0xFF, 0xFB, 0xC1, 0xEF, 0x8F, 0xBF, 0x7E,
-    0x7F, 0xF0, 0xFF, 0x81, 0xFC, 0x00, 0x3C, 0xE0, 0x7B, 0xE0, 0xF7, 0xC1, 0xE7, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x7F, 0xF8, 0xFF, 0xF8, 0xE3, 0xF8, 0x01, 0xF0, 0x01, 0xF0, 0x03, 0xE3, 0xFF,
-    0xC7, 0xFF, 0x8F, 0xFF, 0x00, 0x3E, 0x00, 0x7C, 0x01, 0xF3, 0xCF, 0xEF, 0xFF, 0x9F, 0xFE, 0x1F,
-    0xF0, 0x00, 0x39, 0xE3, 0xEF, 0x1F, 0x78, 0x73, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x0F, 0xFC, 0x7F,
-    0xE3, 0x9F, 0x80, 0x3C, 0x3F, 0xE1, 0xFF, 0x8F, 0xF8, 0x03, 0xCE, 0x7E, 0x7F, 0xE3, 0xFF, 0x1F,
-    0xE0, 0x0F, 0xF8, 0x07, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x7C,
-    0xF8, 0x3E, 0x7C, 0x1F, 0x1F, 0x1F, 0x0F, 0x8F, 0x83, 0xE7, 0x81, 0xF7, 0xC0, 0x7F, 0xC0, 0x3F,
-    0xE0, 0x0F, 0xF0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xF8, 0x04, 0xFC, 0x07, 0xFC, 0x03, 0xFC, 0x01,
-    0xFC, 0x00, 0x1F, 0xE0, 0x7F, 0x81, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x87, 0xFE, 0x1E,
-    0x78, 0x79, 0xF3, 0xE7, 0xCF, 0x0F, 0x3C, 0x3F, 0xF0, 0xFF, 0x81, 0xFE, 0x07, 0xF8, 0x0F, 0xC0,
-    0x3F, 0x00, 0x78, 0x03, 0xE0, 0x5F, 0x03, 0xFC, 0x0F, 0xE0, 0x3F, 0x00, 0x0E, 0x38, 0x07, 0xBE,
-    0x03, 0xDF, 0x01, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x7C, 0xF8, 0x3E, 0x7C, 0x1F, 0x1F,
-    0x1F, 0x0F, 0x8F, 0x83, 0xE7, 0x81, 0xF7, 0xC0, 0x7F, 0xC0, 0x3F, 0xE0, 0x0F, 0xF0, 0x03, 0xF0,
-    0x01, 0xF8, 0x00, 0xF8, 0x04, 0xFC, 0x07, 0xFC, 0x03, 0xFC, 0x01, 0xFC, 0x00, 0x3C, 0xE0, 0xF7,
-    0xC3, 0xDF, 0x0F, 0x38, 0x00, 0x00, 0x00, 0x0F, 0x87, 0xFE, 0x1E, 0x78, 0x79, 0xF3, 0xE7, 0xCF,
-    0x0F, 0x3C, 0x3F, 0xF0, 0xFF, 0x81, 0xFE, 0x07, 0xF8, 0x0F, 0xC0, 0x3F, 0x00, 0x78, 0x03, 0xE0,
-    0x5F, 0x03, 0xFC, 0x0F, 0xE0, 0x3F, 0x00, 0x03, 0x18, 0x01, 0xCE, 0x01, 0xEF, 0x00, 0xE7, 0x80,
-    0xF7, 0x80, 0x73, 0x80, 0x00, 0x01, 0xF0, 0x3E, 0x7C, 0x1F, 0x3E, 0x0F, 0x8F, 0x8F, 0x87, 0xC7,
-    0xC1, 0xF3, 0xC0, 0xFB, 0xE0, 0x3F, 0xE0, 0x1F, 0xF0, 0x07, 0xF8, 0x01, 0xF8, 0x00, 0xFC, 0x00,
-    0x7C, 0x02, 0x7E, 0x03, 0xFE, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0x06, 0x30, 0x3D, 0xE0, 0xF7, 0x87,
-    0xBC, 0x3D, 0xE0, 0x63, 0x00, 0x00, 0x3E, 0x1F, 0xF8, 0x79, 0xE1, 0xE7, 0xCF, 0x9F, 0x3C, 0x3C,
-    0xF0, 0xFF, 0xC3, 0xFE, 0x07, 0xF8, 0x1F, 0xE0, 0x3F, 0x00, 0xFC, 0x01, 0xE0, 0x0F, 0x81, 0x7C,
-    0x0F, 0xF0, 0x3F, 0x80, 0xFC, 0x00, 0x1C, 0xF0, 0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x00, 0x00, 0x00,
-    0x0F, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF8, 0x3F, 0xF1, 0xFF, 0xFF,
-    0xDF, 0xFF, 0x3F, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x79,
-    0xC7, 0xBE, 0x7B, 0xE7, 0x9C, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0x1F, 0xF1, 0xFF, 0x1F, 0xF1, 0xFF,
-    0x9F, 0xFF, 0xF7, 0xFF, 0x3F, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
-    0x00, 0xFE, 0x0F, 0xE0, 0xFE, 0x01, 0xE0, 0x1E, 0x01, 0xE0, 0x1E, 0x01, 0xE0, 0xFF, 0xDF, 0xFB,
-    0xFF, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xF8, 0x7F, 0x0F, 0xE0, 0x3C,
-    0x07, 0x80, 0xF0, 0x1E, 0x00, 0x07, 0x9C, 0x00, 0x7B, 0xE0, 0x07, 0xBE, 0x00, 0x79, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x01,
-    0xFF, 0x00, 0x1F, 0xFF, 0xC1, 0xFF, 0xFF, 0x1F, 0xFF, 0xF9, 0xFF, 0x3F, 0x9F, 0xF0, 0xF9, 0xFF,
-    0x07, 0x9F, 0xF0, 0xF9, 0xFF, 0x1F, 0x9F, 0xFF, 0xF9, 0xFF, 0xFF, 0x1F, 0xFF, 0xC1, 0xF0, 0x07,
-    0x3C, 0x03, 0xEF, 0x00, 0xFB, 0xC0, 0x1C, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0xE0,
-    0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0x8F, 0xFF, 0xF3, 0xFE, 0x7C, 0xFF, 0x8F,
-    0xBF, 0xE7, 0xCF, 0xFF, 0xF3, 0xFF, 0xFC, 0xF7, 0xFC, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x7B, 0xFD, 0xEF, 0x7B, 0xC0, 0x79, 0xE7, 0x9E, 0x7B, 0xCF, 0x00, 0x79, 0xE7,
-    0x9E, 0x7B, 0xCF, 0x00, 0x79, 0xDE, 0xFF, 0x3F, 0xDE, 0xF7, 0xBD, 0xEF, 0x78, 0x7B, 0xEF, 0x7D,
-    0xEF, 0xBD, 0xE7, 0xBD, 0xE7, 0xBC, 0xE0, 0x7B, 0xEF, 0x7D, 0xEF, 0xBD, 0xE7, 0xBD, 0xE7, 0xBC,
-    0xE0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xF0,
-    0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0x70, 0x07,
-    0x00, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xF0,
-    0x0F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0x70, 0x07,
-    0x00, 0x3E, 0x3F, 0x9F, 0xCF, 0xE7, 0xF3, 0xF8, 0xF8, 0x78, 0x38, 0x3D, 0xF0, 0xF8, 0x7F, 0xE1,
-    0xF0, 0xFF, 0xC3, 0xE1, 0xF7, 0x83, 0x83, 0xC0, 0x3F, 0x03, 0xC0, 0x00, 0x3F, 0xC3, 0xE0, 0x00,
-    0x1E, 0xF1, 0xE0, 0x00, 0x0E, 0x79, 0xE0, 0x00, 0x07, 0x1C, 0xF0, 0x00, 0x03, 0x9E, 0xF0, 0x00,
-    0x01, 0xEF, 0xF8, 0x00, 0x00, 0xFF, 0x78, 0x00, 0x00, 0x3F, 0x7D, 0xF8, 0x7E, 0x00, 0x3D, 0xFE,
-    0x7F, 0x80, 0x3D, 0xEF, 0x7B, 0xC0, 0x1E, 0xF3, 0xBC, 0xE0, 0x1E, 0x71, 0xDC, 0x70, 0x1F, 0x3C,
-    0xEF, 0x38, 0x0F, 0x1E, 0xF7, 0xBC, 0x0F, 0x87, 0xF9, 0xFE, 0x07, 0x81, 0xF8, 0x7E, 0x00, 0x00,
-    0x0E, 0x1F, 0x3E, 0x7C, 0x7C, 0xF8, 0x7C, 0x7C, 0x3E, 0x1F, 0x0E, 0x08, 0x10, 0x78, 0x78, 0x7C,
-    0x3E, 0x3E, 0x1F, 0x3E, 0x3E, 0x7C, 0x78, 0x78, 0x10, 0x00, 0x78, 0x01, 0xE0, 0x0F, 0x80, 0x3C,
-    0x01, 0xF0, 0x07, 0x80, 0x3C, 0x00, 0xF0, 0x07, 0x80, 0x1E, 0x00, 0xF0, 0x03, 0xC0, 0x1E, 0x00,
-    0x78, 0x03, 0xC0, 0x0F, 0x00, 0x78, 0x01, 0xE0, 0x00, 0x3E, 0x3F, 0xBD, 0xFE, 0x7E, 0x3F, 0x1F,
-    0xCF, 0xEF, 0x7F, 0x1F, 0x00, 0x0F, 0x0F, 0x87, 0xC7, 0xE7, 0x73, 0xBB, 0xFF, 0xFF, 0x07, 0x03,
-    0x80, 0x7F, 0x3F, 0x9C, 0x0E, 0x07, 0xE3, 0xF8, 0x3C, 0x8E, 0x7F, 0x7F, 0x00, 0x0F, 0x1F, 0x9F,
-    0x8F, 0x07, 0xF7, 0xFB, 0xDE, 0xEF, 0x7F, 0x1F, 0x00, 0xFF, 0xFF, 0xC3, 0xC1, 0xE1, 0xE0, 0xF0,
-    0x70, 0x78, 0x3C, 0x1E, 0x00, 0x3F, 0x3F, 0xBD, 0xEE, 0xE7, 0xF3, 0xFB, 0xDF, 0xEF, 0xFF, 0xBF,
-    0x80, 0x3E, 0x3F, 0xBD, 0xDE, 0xF7, 0xFB, 0xFC, 0x1C, 0x3E, 0x7E, 0x3E, 0x00, 0x3E, 0x3F, 0xBD,
-    0xFE, 0x7E, 0x3F, 0x1F, 0xCF, 0xEF, 0x7F, 0x1F, 0x00, 0x1E, 0xFD, 0xFB, 0xF0, 0xE1, 0xC3, 0x87,
-    0x0E, 0x1C, 0x7E, 0x7F, 0x9B, 0xC1, 0xE1, 0xF1, 0xF1, 0xF0, 0xF0, 0x7F, 0x7F, 0x80, 0x7E, 0xFF,
-    0x6F, 0x0F, 0x3E, 0x3F, 0x0F, 0x47, 0xFF, 0xFE, 0x0F, 0x0F, 0x87, 0xC7, 0xE7, 0x73, 0xBB, 0xFF,
-    0xFF, 0x07, 0x03, 0x80, 0x7F, 0x3F, 0x9C, 0x0E, 0x07, 0xE3, 0xF8, 0x3C, 0x8E, 0x7F, 0x7F, 0x00,
-    0x0F, 0x1F, 0x9F, 0x8F, 0x07, 0xF7, 0xFB, 0xDE, 0xEF, 0x7F, 0x1F, 0x00, 0xFF, 0xFF, 0xC3, 0xC1,
-    0xE1, 0xE0, 0xF0, 0x70, 0x78, 0x3C, 0x1E, 0x00, 0x3F, 0x3F, 0xBD, 0xEE, 0xE7, 0xF3, 0xFB, 0xDF,
-    0xEF, 0xFF, 0xBF, 0x80, 0x3E, 0x3F, 0xBD, 0xDE, 0xF7, 0xFB, 0xFC, 0x1C, 0x3E, 0x7E, 0x3E, 0x00,
-    0x07, 0xF8, 0x3F, 0xE1, 0xFF, 0x87, 0xC4, 0x3E, 0x00, 0xF0, 0x0F, 0xFE, 0x3F, 0xF8, 0x7C, 0x01,
-    0xF0, 0x0F, 0xFE, 0x3F, 0xF0, 0x3C, 0x00, 0xFC, 0xE1, 0xFF, 0x87, 0xFE, 0x07, 0xF8, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC1, 0xE0, 0x07, 0xB0, 0x1F, 0xC0, 0x7F, 0x07, 0xF8, 0x3F, 0x80, 0xFF, 0xC1,
-    0x7F, 0x01, 0xFC, 0x3F, 0xC0, 0xFE, 0x01, 0xF8, 0x01, 0xE0, 0x07, 0x80, 0x1F, 0xE0, 0xFF, 0xC3,
-    0xFF, 0x06, 0x3E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF8, 0x1F, 0x83, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x7C, 0x01, 0xF9, 0xC3, 0xFF, 0x8F, 0xFE, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1,
-    0xF8, 0x01, 0xE3, 0xFF, 0xEF, 0xFF, 0x80, 0xF8, 0x0F, 0xE3, 0xFF, 0x0F, 0xF8, 0x3F, 0xC0, 0xFC,
-    0x01, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x1F, 0xC0, 0x7F, 0xE0, 0x7F, 0xE0, 0xCF, 0xC0,
-    0x07, 0xC0, 0x07, 0x83, 0xFF, 0x0F, 0xFE, 0x3F, 0xFC, 0xFC, 0xF9, 0xE0, 0xF3, 0xC1, 0xE7, 0x83,
-    0xCF, 0x0F, 0x9F, 0x3E, 0x3F, 0xFC, 0x3F, 0xF0, 0x3F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x7F,
-    0x00, 0x1F, 0xC0, 0x07, 0xF8, 0x03, 0xFE, 0x00, 0xF7, 0xC0, 0x7D, 0xF0, 0x1E, 0x3C, 0x07, 0x8F,
-    0x83, 0xE3, 0xE0, 0xF0, 0x7C, 0x7C, 0x1F, 0x1F, 0x03, 0xC7, 0xFF, 0xFB, 0xFF, 0xFE, 0xFF, 0xFF,
-    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F,
-    0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0,
-    0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xE0, 0xFF, 0xFB, 0xFF, 0xEF, 0xFF, 0x9F, 0x00,
-    0x3E, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x0F, 0x80, 0x1F, 0x00, 0xFC, 0x03, 0xE0, 0x1F, 0x00,
-    0xFC, 0x03, 0xE0, 0x1F, 0x00, 0x7C, 0x03, 0xFF, 0xEF, 0xFF, 0xBF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x78, 0x01, 0xE0, 0x0F, 0x80, 0x3C, 0x01, 0xF0, 0x07, 0x80, 0x3C, 0x00, 0xF0, 0x07,
-    0x80, 0x1E, 0x00, 0xF0, 0x03, 0xC0, 0x1E, 0x00, 0x78, 0x03, 0xC0, 0x0F, 0x00, 0x78, 0x01, 0xE0,
-    0x00, 0x79, 0xFF, 0xDF, 0x78, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
-    0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x1C, 0x78, 0x7E, 0x78, 0x7E, 0x78, 0x7F, 0xF0, 0x7F, 0xF0, 0x0F,
-    0xF0, 0x07, 0xE0, 0x07, 0xE0, 0x03, 0xE0, 0x03, 0xC0, 0x3E, 0x7C, 0x7F, 0xFE, 0x7F, 0xFE, 0xF7,
-    0xEE, 0xF7, 0xEE, 0x7F, 0xFE, 0x7F, 0xFE, 0x3E, 0x7C, 0x00, 0x01, 0xF0, 0xFC, 0x7F, 0x1F, 0x07,
-    0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81,
-    0xE0, 0x78, 0x3E, 0x3F, 0x8F, 0xC3, 0xE0, 0x00, 0x00, 0x3E, 0x1D, 0xFE, 0xF7, 0xFF, 0xBD, 0xFE,
-    0x71, 0xF0, 0x00, 0x03, 0xE1, 0xDF, 0xEF, 0x7F, 0xFB, 0xDF, 0xE7, 0x1F, 0x00, 0x00, 0xC0, 0x1E,
-    0x01, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x80, 0x78,
-    0x03, 0x00, 0x01, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xC0, 0xFF, 0xEF, 0xFF, 0xFF, 0xF3,
-    0xFF, 0x01, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x78, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F,
-    0xF0, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x78, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+    0xF0, 0x0F, 0xC3, 0xF0, 0x0F, 0x83, 0xF0, 0x0F, 0x81, 0xE0, 0x00, 0x60, 0x00, 0x00, 0xF0, 0x00,
+    0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF1, 0xF0, 0xF8,
+    0xF1, 0xE0, 0x78, 0xF1, 0xE0, 0x79, 0xF3, 0xE0, 0x7D, 0xFB, 0xC0, 0x3D, 0xFB, 0xC0, 0x3F, 0xFB,
+    0xC0, 0x3F, 0xFF, 0x80, 0x1F, 0xBF, 0x80, 0x1F, 0x9F, 0x80, 0x1F, 0x9F, 0x00, 0x0F, 0x1F, 0x00,
+    0x0F, 0x0F, 0x00, 0x01, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x06,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x80, 0x7C, 0x1F, 0x00, 0x7C, 0x3E, 0x00, 0x3E, 0x3E,
+    0x00, 0x3E, 0x7C, 0x00, 0x1F, 0x7C, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xF0, 0x00,
+    0x07, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03,
+    0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0x00, 0x07, 0x80, 0x1F, 0xC0, 0x1F, 0xE0,
+    0x1C, 0xC0, 0x00, 0x00, 0xF8, 0x7C, 0xF8, 0x78, 0x78, 0x78, 0x7C, 0xF8, 0x7C, 0xF0, 0x3C, 0xF0,
+    0x3F, 0xF0, 0x3F, 0xE0, 0x1F, 0xE0, 0x1F, 0xE0, 0x0F, 0xC0, 0x0F, 0xC0, 0x07, 0x80, 0x0F, 0x80,
+    0x5F, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0x0E, 0x78, 0x00, 0x1F, 0x78, 0x00, 0x1F, 0x78,
+    0x00, 0x0E, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x80, 0x7C, 0x1F, 0x00,
+    0x7C, 0x3E, 0x00, 0x3E, 0x3E, 0x00, 0x3E, 0x7C, 0x00, 0x1F, 0x7C, 0x00, 0x1F, 0xF8, 0x00, 0x0F,
+    0xF8, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0,
+    0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xC0, 0x01,
+    0xE0, 0x03, 0xE0, 0x07, 0xC0, 0x07, 0x80, 0x03, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F,
+    0xFC, 0x00, 0xFC, 0x01, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F,
+    0x00, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x7F, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0x03, 0x80, 0x03,
+    0xC0, 0x07, 0xC0, 0x0F, 0x80, 0x0F, 0x00, 0x06, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x7F,
+    0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x7F,
+    0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x03, 0x80, 0x07, 0xC0, 0x07, 0xC0, 0x03, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFC, 0x00, 0xFC, 0x01, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07,
+    0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x7F, 0xFE, 0xFF,
+    0xFE, 0xFF, 0xFE, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x0F, 0x80, 0x1F, 0x00, 0x3E,
+    0x00, 0x7C, 0x00, 0x7F, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x0C, 0x60, 0x0F, 0xF0, 0x0F, 0xE0, 0x03,
+    0xC0, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFC, 0x00, 0xFC, 0x01,
+    0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x1F, 0x00, 0x3E,
+    0x00, 0x7C, 0x00, 0x7F, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0x18, 0xC0, 0x3F, 0xC0, 0x1F, 0xC0, 0x0F,
+    0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x03, 0xE0, 0x07,
+    0xC0, 0x0F, 0x80, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x7F, 0xF0, 0xFF, 0xF0, 0xFF,
+    0xF0, 0x1F, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0x7C, 0x80, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0x77, 0x80, 0xF3, 0x80, 0x0C,
+    0x00, 0x1E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0x80, 0x03, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF,
+    0xF0, 0xFF, 0xF0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF,
+    0xE0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x79,
+    0xC0, 0x7B, 0xE0, 0x7B, 0xE0, 0x79, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF,
+    0xF0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xFE, 0x00,
+    0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07,
+    0xFF, 0x80, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x07, 0xC7, 0xE0, 0x07, 0xC1, 0xE0, 0x07, 0xC1,
+    0xF0, 0x07, 0xC1, 0xF0, 0x07, 0xC3, 0xE0, 0x07, 0xDF, 0xE0, 0x07, 0xDF, 0xC0, 0x07, 0xDF, 0x80,
+    0x03, 0x00, 0x07, 0x80, 0x0F, 0x80, 0x1F, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0xFF, 0xF0,
+    0xFF, 0xF0, 0xFF, 0xF0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0x07, 0xFC, 0x1F, 0xFE, 0x3F, 0xFE, 0x7F, 0x1C, 0x7C, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0xF0,
+    0xFF, 0xF0, 0xFF, 0xF0, 0xF8, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x7F, 0x3C, 0x3F, 0xFE, 0x1F, 0xFE,
+    0x07, 0xFC, 0x0F, 0xF0, 0x3F, 0xF8, 0x7F, 0xF8, 0x7E, 0x70, 0x7C, 0x00, 0x7C, 0x00, 0x7F, 0x80,
+    0x3F, 0xE0, 0x1F, 0xF0, 0x0F, 0xF8, 0x01, 0xFC, 0x00, 0x7C, 0x00, 0x7C, 0x78, 0xFC, 0x7F, 0xF8,
+    0x7F, 0xF8, 0x3F, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0xF3, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E,
+    0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E,
+    0x00, 0x1E, 0x00, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01,
+    0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x73, 0xE0, 0xFF,
+    0xE0, 0xFF, 0xC0, 0x7F, 0x80, 0x03, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xC0,
+    0x00, 0x07, 0xC7, 0xC0, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x07, 0xC7, 0xFF,
+    0x00, 0x07, 0xC7, 0xFF, 0xC0, 0x07, 0x87, 0xFF, 0xE0, 0x07, 0x87, 0xC7, 0xE0, 0x07, 0x87, 0xC1,
+    0xE0, 0x0F, 0x87, 0xC1, 0xE0, 0x1F, 0x07, 0xC1, 0xE0, 0x7F, 0x07, 0xC7, 0xE0, 0xFE, 0x07, 0xFF,
+    0xE0, 0xFC, 0x07, 0xFF, 0xC0, 0xF8, 0x03, 0xFF, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0,
+    0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xFC, 0xFF, 0xFF, 0xFE, 0xF0, 0x3E, 0x7F, 0xF0, 0x3E, 0x1F, 0xF0, 0x3E, 0x1F, 0xF0, 0x3E, 0x1F,
+    0xF0, 0x3E, 0x7F, 0xF0, 0x3F, 0xFE, 0xF0, 0x3F, 0xFC, 0xF0, 0x3F, 0xF8, 0xFF, 0xFE, 0x00, 0xFF,
+    0xFE, 0x00, 0xFF, 0xFE, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xFF,
+    0x00, 0x07, 0xFF, 0x80, 0x07, 0xFF, 0xC0, 0x07, 0xCF, 0xC0, 0x07, 0xC3, 0xE0, 0x07, 0xC3, 0xE0,
+    0x07, 0xC3, 0xE0, 0x07, 0xC3, 0xE0, 0x07, 0xC3, 0xE0, 0x07, 0xC3, 0xE0, 0x07, 0xC3, 0xE0, 0x00,
+    0xC0, 0x01, 0xE0, 0x03, 0xE0, 0x07, 0xC0, 0x07, 0x80, 0x03, 0x00, 0x00, 0x00, 0xF0, 0x7C, 0xF0,
+    0xF8, 0xF1, 0xF8, 0xF3, 0xF0, 0xF7, 0xE0, 0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+    0x80, 0xFF, 0xC0, 0xF7, 0xE0, 0xF3, 0xF0, 0xF1, 0xF8, 0xF0, 0xF8, 0xF0, 0x7C, 0xF0, 0x7E, 0x03,
+    0x00, 0x0F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xC0, 0x01, 0x80, 0x00, 0x00, 0xF0, 0x1E, 0xF0,
+    0x3E, 0xF0, 0x7E, 0xF0, 0xFE, 0xF1, 0xFE, 0xF1, 0xFE, 0xF3, 0xFE, 0xF7, 0xDE, 0xFF, 0x9E, 0xFF,
+    0x9E, 0xFF, 0x1E, 0xFE, 0x1E, 0xFE, 0x1E, 0xFC, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF0, 0x1E, 0x06,
+    0x38, 0x00, 0x0F, 0x78, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x7C, 0x1F, 0x00, 0x7C, 0x1F, 0x00, 0x3E, 0x3E, 0x00,
+    0x3E, 0x3E, 0x00, 0x1F, 0x3C, 0x00, 0x1F, 0x7C, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x07,
+    0xF8, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x27, 0xE0, 0x00, 0x7F, 0xC0,
+    0x00, 0x7F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0,
+    0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0,
+    0x3E, 0xF0, 0x3E, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07,
+    0x80, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x07,
+    0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0x3C, 0x00, 0x1F, 0x3E, 0x00, 0x1E, 0x3E, 0x00, 0x1E, 0x1E,
+    0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x7C, 0x0F, 0x80, 0x7C, 0x0F, 0x80,
+    0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0xFF, 0xF8, 0xF1, 0xF8, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78,
+    0xF1, 0xF8, 0xFF, 0xF8, 0xFF, 0xF0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xF0, 0xFF, 0xF8, 0xF1, 0xF8,
+    0xF0, 0x78, 0xF0, 0x78, 0xF1, 0xF8, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF8, 0xF0, 0xFC, 0xF0, 0x7C,
+    0xF0, 0x7C, 0xF1, 0xFC, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xE0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x07, 0xFF, 0x80, 0x07,
+    0xFF, 0x80, 0x07, 0xFF, 0x80, 0x07, 0xC7, 0x80, 0x07, 0xC7, 0x80, 0x07, 0xC7, 0x80, 0x07, 0x87,
+    0x80, 0x07, 0x87, 0x80, 0x07, 0x87, 0x80, 0x0F, 0x87, 0x80, 0x0F, 0x87, 0x80, 0x0F, 0x07, 0x80,
+    0x1F, 0x07, 0x80, 0x1F, 0x07, 0x80, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xF8,
+    0x00, 0xF0, 0xF8, 0x00, 0xF0, 0xF8, 0x00, 0xF0, 0xF8, 0x00, 0xF0, 0xF8, 0x00, 0xF0, 0xFF, 0xF0,
+    0xFF, 0xF0, 0xFF, 0xF0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0,
+    0xFF, 0xE0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8,
+    0xFC, 0x3E, 0x1F, 0x00, 0x7E, 0x3E, 0x3F, 0x00, 0x3E, 0x3E, 0x7E, 0x00, 0x3F, 0x3E, 0xFC, 0x00,
+    0x1F, 0xBE, 0xF8, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00,
+    0x03, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x0F, 0xBF, 0xF8, 0x00,
+    0x1F, 0x3E, 0xFC, 0x00, 0x3F, 0x3E, 0x7C, 0x00, 0x7E, 0x3E, 0x3E, 0x00, 0x7C, 0x3E, 0x3F, 0x00,
+    0xF8, 0x3E, 0x1F, 0x00, 0x3F, 0xE0, 0x7F, 0xF0, 0x7F, 0xF8, 0x38, 0xFC, 0x00, 0x7C, 0x00, 0x7C,
+    0x01, 0xF8, 0x1F, 0xF8, 0x1F, 0xF0, 0x1F, 0xFC, 0x00, 0xFC, 0x00, 0x3C, 0x00, 0x3C, 0x78, 0xFC,
+    0x7F, 0xFC, 0xFF, 0xF8, 0x3F, 0xF0, 0xF0, 0x1E, 0xF0, 0x3E, 0xF0, 0x7E, 0xF0, 0xFE, 0xF1, 0xFE,
+    0xF1, 0xFE, 0xF3, 0xFE, 0xF7, 0xDE, 0xFF, 0x9E, 0xFF, 0x9E, 0xFF, 0x1E, 0xFE, 0x1E, 0xFE, 0x1E,
+    0xFC, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF0, 0x1E, 0x0C, 0x70, 0x1E, 0xF0, 0x1F, 0xF0, 0x0F, 0xE0,
+    0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1E, 0xF0, 0x3E, 0xF0, 0x7E, 0xF0, 0xFE, 0xF1, 0xFE,
+    0xF1, 0xFE, 0xF3, 0xFE, 0xF7, 0xDE, 0xFF, 0x9E, 0xFF, 0x9E, 0xFF, 0x1E, 0xFE, 0x1E, 0xFE, 0x1E,
+    0xFC, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF0, 0x1E, 0xF0, 0x7C, 0xF0, 0xF8, 0xF1, 0xF8, 0xF3, 0xF0,
+    0xF7, 0xE0, 0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xF7, 0xE0,
+    0xF3, 0xF0, 0xF1, 0xF8, 0xF0, 0xF8, 0xF0, 0x7C, 0xF0, 0x7E, 0x03, 0xFF, 0xC0, 0x07, 0xFF, 0xC0,
+    0x07, 0xFF, 0xC0, 0x07, 0xC7, 0xC0, 0x07, 0xC7, 0xC0, 0x07, 0xC7, 0xC0, 0x07, 0xC7, 0xC0, 0x07,
+    0xC7, 0xC0, 0x07, 0x87, 0xC0, 0x07, 0x87, 0xC0, 0x07, 0x87, 0xC0, 0x0F, 0x87, 0xC0, 0x1F, 0x07,
+    0xC0, 0x7F, 0x07, 0xC0, 0xFE, 0x07, 0xC0, 0xFC, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0x7C, 0x03, 0xE0,
+    0x7E, 0x03, 0xE0, 0x7E, 0x07, 0xE0, 0x7F, 0x07, 0xE0, 0x7F, 0x0F, 0xE0, 0x7F, 0x8F, 0xF0, 0x7F,
+    0x9F, 0xF0, 0x7F, 0xDF, 0xF0, 0x7B, 0xDF, 0xF0, 0x7B, 0xFD, 0xF0, 0x79, 0xFD, 0xF0, 0xF9, 0xF8,
+    0xF0, 0xF9, 0xF8, 0xF0, 0xF8, 0xF8, 0xF0, 0xF8, 0xF0, 0xF0, 0xF8, 0x00, 0xF0, 0xF8, 0x00, 0xF0,
+    0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xFF, 0xFE,
+    0xFF, 0xFE, 0xFF, 0xFE, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E,
+    0xF0, 0x3E, 0x07, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0x3F, 0x00, 0x7C, 0x0F,
+    0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0,
+    0xF8, 0x07, 0xC0, 0xF8, 0x0F, 0x80, 0x7C, 0x0F, 0x80, 0x7F, 0x3F, 0x80, 0x3F, 0xFF, 0x00, 0x1F,
+    0xFE, 0x00, 0x07, 0xF8, 0x00, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0,
+    0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0,
+    0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xFF, 0xC0, 0xFF, 0xF0, 0xFF, 0xF8, 0xF1, 0xF8, 0xF0,
+    0x78, 0xF0, 0x7C, 0xF0, 0x78, 0xF1, 0xF8, 0xFF, 0xF8, 0xFF, 0xF0, 0xFF, 0xC0, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x07, 0xFC, 0x1F, 0xFE, 0x3F, 0xFC, 0x7F,
+    0x1C, 0x7C, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+    0x00, 0x7C, 0x00, 0x7F, 0x1C, 0x3F, 0xFE, 0x1F, 0xFE, 0x0F, 0xFC, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF,
+    0xFE, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07,
+    0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0xF8, 0x1F, 0x00,
+    0x7C, 0x1F, 0x00, 0x7C, 0x1F, 0x00, 0x3E, 0x3E, 0x00, 0x3E, 0x3E, 0x00, 0x1F, 0x3C, 0x00, 0x1F,
+    0x7C, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0,
+    0x00, 0x03, 0xE0, 0x00, 0x27, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x00, 0x00,
+    0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x7E,
+    0xFF, 0xE0, 0xF8, 0xF3, 0xE0, 0xF8, 0xF1, 0xF0, 0xF0, 0xF1, 0xF0, 0xF0, 0xF1, 0xF0, 0xF8, 0xF1,
+    0xF0, 0xF8, 0xF3, 0xE0, 0x7E, 0xF7, 0xE0, 0x7F, 0xFF, 0xC0, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0x00,
+    0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0xFC, 0x1F, 0x00, 0x7E, 0x3F, 0x00, 0x3E, 0x3E, 0x00, 0x3F,
+    0x7C, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xE0,
+    0x00, 0x07, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x7E, 0x00,
+    0x7E, 0x3F, 0x00, 0x7C, 0x1F, 0x00, 0xF8, 0x1F, 0x80, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0,
+    0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E,
+    0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00,
+    0xF0, 0x3E, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xC0, 0x00,
+    0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0,
+    0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF8, 0x3C, 0xFC, 0x7C, 0xFF, 0xFC, 0x7F, 0xFC, 0x3F,
+    0xFC, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0xF0, 0xF8, 0x7C,
+    0xF0, 0xF8, 0x7C, 0xF0, 0xF8, 0x7C, 0xF0, 0xF8, 0x7C, 0xF0, 0xF8, 0x7C, 0xF0, 0xF8, 0x7C, 0xF0,
+    0xF8, 0x7C, 0xF0, 0xF8, 0x7C, 0xF0, 0xF8, 0x7C, 0xF0, 0xF8, 0x7C, 0xF0, 0xF8, 0x7C, 0xF0, 0xF8,
+    0x7C, 0xF0, 0xF8, 0x7C, 0xF0, 0xF8, 0x7C, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC,
+    0xF0, 0xF8, 0x7C, 0x00, 0xF0, 0xF8, 0x7C, 0x00, 0xF0, 0xF8, 0x7C, 0x00, 0xF0, 0xF8, 0x7C, 0x00,
+    0xF0, 0xF8, 0x7C, 0x00, 0xF0, 0xF8, 0x7C, 0x00, 0xF0, 0xF8, 0x7C, 0x00, 0xF0, 0xF8, 0x7C, 0x00,
+    0xF0, 0xF8, 0x7C, 0x00, 0xF0, 0xF8, 0x7C, 0x00, 0xF0, 0xF8, 0x7C, 0x00, 0xF0, 0xF8, 0x7C, 0x00,
+    0xF0, 0xF8, 0x7C, 0x00, 0xF0, 0xF8, 0x7C, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80,
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80,
+    0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFF, 0x80,
+    0x0F, 0xFF, 0xC0, 0x0F, 0x9F, 0xC0, 0x0F, 0x83, 0xC0, 0x0F, 0x83, 0xE0, 0x0F, 0x83, 0xC0, 0x0F,
+    0x8F, 0xC0, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0xF0, 0x01, 0xF0, 0xF0, 0x01,
+    0xF0, 0xF0, 0x01, 0xF0, 0xF0, 0x01, 0xF0, 0xF0, 0x01, 0xF0, 0xF0, 0x01, 0xF0, 0xFF, 0xC1, 0xF0,
+    0xFF, 0xF1, 0xF0, 0xFF, 0xF9, 0xF0, 0xF3, 0xF9, 0xF0, 0xF0, 0xF9, 0xF0, 0xF0, 0x79, 0xF0, 0xF0,
+    0xF9, 0xF0, 0xF1, 0xF9, 0xF0, 0xFF, 0xF9, 0xF0, 0xFF, 0xF1, 0xF0, 0xFF, 0xC1, 0xF0, 0xF0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0xFF, 0xF8,
+    0xF3, 0xF8, 0xF0, 0x7C, 0xF0, 0x7C, 0xF0, 0x7C, 0xF1, 0xF8, 0xFF, 0xF8, 0xFF, 0xF0, 0xFF, 0xC0,
+    0x7F, 0xC0, 0xFF, 0xF0, 0xFF, 0xF8, 0x71, 0xFC, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x3E, 0x1F, 0xFE,
+    0x1F, 0xFE, 0x1F, 0xFE, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x7C, 0x79, 0xFC, 0xFF, 0xF8, 0xFF, 0xF0,
+    0x7F, 0xC0, 0xF0, 0x0F, 0xE0, 0xF0, 0x3F, 0xF8, 0xF0, 0x7F, 0xFC, 0xF0, 0xFC, 0xFE, 0xF0, 0xF8,
+    0x3E, 0xF1, 0xF0, 0x1F, 0xF1, 0xF0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x1F,
+    0xF1, 0xF0, 0x1F, 0xF1, 0xF0, 0x1F, 0xF1, 0xF8, 0x3E, 0xF0, 0xFC, 0xFE, 0xF0, 0x7F, 0xFC, 0xF0,
+    0x3F, 0xF8, 0xF0, 0x1F, 0xE0, 0x0F, 0xFC, 0x3F, 0xFE, 0x3F, 0xFE, 0x7F, 0x3E, 0x7C, 0x3E, 0x78,
+    0x3E, 0x7C, 0x3E, 0x7E, 0x3E, 0x7F, 0xFE, 0x3F, 0xFE, 0x1F, 0xFE, 0x1F, 0x3E, 0x3E, 0x3E, 0x7C,
+    0x3E, 0x7C, 0x3E, 0xF8, 0x3E, 0xF8, 0x3E, 0x3F, 0xC0, 0x3F, 0xF0, 0x3F, 0xF0, 0x31, 0xF0, 0x00,
+    0xF8, 0x1F, 0xF8, 0x7F, 0xF8, 0x7F, 0xF8, 0x7C, 0xF8, 0x7C, 0xF8, 0x7F, 0xF8, 0x7F, 0xF8, 0x3F,
+    0xF0, 0x01, 0xF0, 0x0F, 0xF0, 0x1F, 0xF8, 0x3F, 0xE0, 0x7C, 0x00, 0x78, 0x00, 0xFF, 0xC0, 0xFF,
+    0xF0, 0xFF, 0xF0, 0xFD, 0xF8, 0xF0, 0xF8, 0xF0, 0x78, 0xF0, 0x78, 0xF8, 0x78, 0xF8, 0xF8, 0xFD,
+    0xF8, 0x7F, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0xFF, 0xE0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF8, 0xF8, 0xF8,
+    0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xF8, 0xFF, 0xF0, 0x7F,
+    0xE0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFE,
+    0x00, 0x0F, 0xFE, 0x00, 0x1F, 0x3E, 0x00, 0x1F, 0x3E, 0x00, 0x1F, 0x3E, 0x00, 0x1E, 0x3E, 0x00,
+    0x1E, 0x3E, 0x00, 0x1E, 0x3E, 0x00, 0x3E, 0x3E, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0x80, 0xF0, 0x07, 0x80, 0xF0, 0x07, 0x80, 0xF0, 0x07, 0x80, 0xF0, 0x07, 0x80, 0x1F, 0xC0,
+    0x3F, 0xE0, 0x7F, 0xF0, 0xFD, 0xF0, 0xF8, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xF8, 0x00,
+    0xFC, 0x70, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0xFC, 0xF8, 0xF8, 0x7C, 0xF9, 0xF0, 0x3E, 0xFB,
+    0xE0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x0F, 0xFF, 0x80,
+    0x1F, 0xFF, 0xC0, 0x3F, 0xFB, 0xE0, 0x3E, 0xFB, 0xF0, 0x7C, 0xF9, 0xF0, 0xF8, 0xF8, 0xF8, 0x7F,
+    0xC0, 0x7F, 0xE0, 0x7F, 0xE0, 0x73, 0xE0, 0x01, 0xE0, 0x3F, 0xE0, 0x3F, 0xE0, 0x3F, 0xE0, 0x01,
+    0xF0, 0x71, 0xF0, 0x7F, 0xF0, 0x7F, 0xE0, 0x7F, 0xC0, 0xF8, 0x78, 0xF8, 0xF8, 0xF9, 0xF8, 0xFB,
+    0xF8, 0xFB, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0x78, 0xFE, 0x78, 0xFE, 0x78, 0xFC, 0x78, 0xF8,
+    0x78, 0xF8, 0x78, 0x18, 0xE0, 0x3D, 0xE0, 0x3F, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0x78, 0xF8, 0xF8, 0xF9, 0xF8, 0xFB, 0xF8, 0xFB, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0x78, 0xFE, 0x78, 0xFE, 0x78, 0xFC, 0x78, 0xF8, 0x78, 0xF8, 0x78, 0xF8, 0xF8, 0xF9, 0xF0, 0xFB,
+    0xE0, 0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xC0, 0xFB, 0xE0, 0xF9,
+    0xF0, 0xF9, 0xF8, 0xF8, 0xF8, 0x0F, 0xFC, 0x0F, 0xFC, 0x0F, 0xFC, 0x0F, 0x3C, 0x0F, 0x3C, 0x1F,
+    0x3C, 0x1F, 0x3C, 0x1F, 0x3C, 0x1E, 0x3C, 0x7E, 0x3C, 0xFC, 0x3C, 0xF8, 0x3C, 0xF0, 0x3C, 0x78,
+    0x0F, 0x00, 0x7C, 0x1F, 0x00, 0x7C, 0x1F, 0x00, 0x7E, 0x3F, 0x00, 0x7E, 0x3F, 0x00, 0x7F, 0x7F,
+    0x00, 0x7F, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFB, 0xEF, 0x80, 0xFB, 0xEF, 0x80, 0xF9, 0xCF, 0x80,
+    0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0,
+    0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0,
+    0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFD, 0xF8, 0xF8, 0xF8, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78,
+    0xF8, 0xF8, 0xFD, 0xF8, 0x7F, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0,
+    0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0,
+    0xF8, 0xF0, 0xF8, 0xF0, 0x7F, 0xC0, 0xFF, 0xE0, 0xFF, 0xF0, 0xF9, 0xF8, 0xF8, 0xF8, 0xF8, 0x78,
+    0xF8, 0x78, 0xF8, 0x78, 0xF8, 0xF8, 0xFD, 0xF8, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xC0, 0xF8, 0x00,
+    0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x1F, 0xE0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFC, 0xC0,
+    0xF8, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0xFC, 0x60, 0x7F, 0xE0, 0x3F, 0xE0,
+    0x1F, 0xE0, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x80,
+    0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0xF8, 0x7C, 0xF8, 0x78,
+    0x78, 0x78, 0x7C, 0xF8, 0x7C, 0xF0, 0x3C, 0xF0, 0x3F, 0xF0, 0x3F, 0xE0, 0x1F, 0xE0, 0x1F, 0xE0,
+    0x0F, 0xC0, 0x0F, 0xC0, 0x07, 0x80, 0x0F, 0x80, 0x5F, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0xFC, 0x00,
+    0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01,
+    0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xF9, 0xE7,
+    0xC0, 0xF1, 0xE7, 0xC0, 0xF1, 0xE3, 0xC0, 0xF1, 0xE7, 0xC0, 0xF9, 0xE7, 0xC0, 0xFF, 0xEF, 0x80,
+    0x7F, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01,
+    0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0xF8, 0x78, 0x7C, 0xF8, 0x3F, 0xF0, 0x3F, 0xE0,
+    0x1F, 0xE0, 0x0F, 0xC0, 0x0F, 0x80, 0x0F, 0xC0, 0x1F, 0xE0, 0x3F, 0xF0, 0x7C, 0xF0, 0x78, 0xF8,
+    0xF8, 0x7C, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0,
+    0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0x00, 0x1E, 0x00, 0x1E,
+    0x00, 0x1E, 0x00, 0x1E, 0xF1, 0xF0, 0xF1, 0xF0, 0xF1, 0xF0, 0xF1, 0xF0, 0xF1, 0xF0, 0xF9, 0xF0,
+    0xFF, 0xF0, 0x7F, 0xF0, 0x3F, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0xF8, 0xF1,
+    0xE0, 0xF8, 0xF1, 0xE0, 0xF8, 0xF1, 0xE0, 0xF8, 0xF1, 0xE0, 0xF8, 0xF1, 0xE0, 0xF8, 0xF1, 0xE0,
+    0xF8, 0xF1, 0xE0, 0xF8, 0xF1, 0xE0, 0xF8, 0xF1, 0xE0, 0xF8, 0xF1, 0xE0, 0xFF, 0xFF, 0xE0, 0xFF,
+    0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0xF8, 0xF1, 0xE0, 0xF8, 0xF1, 0xE0, 0xF8, 0xF1, 0xE0, 0xF8, 0xF1,
+    0xE0, 0xF8, 0xF1, 0xE0, 0xF8, 0xF1, 0xE0, 0xF8, 0xF1, 0xE0, 0xF8, 0xF1, 0xE0, 0xF8, 0xF1, 0xE0,
+    0xF8, 0xF1, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x78, 0x00,
+    0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x1F, 0x00,
+    0x1F, 0xF8, 0x1F, 0xFC, 0x1F, 0xFE, 0x1F, 0x3E, 0x1F, 0x1E, 0x1F, 0x3E, 0x1F, 0xFE, 0x1F, 0xFC,
+    0x1F, 0xF8, 0xF8, 0x03, 0xC0, 0xF8, 0x03, 0xC0, 0xF8, 0x03, 0xC0, 0xF8, 0x03, 0xC0, 0xFF, 0xC3,
+    0xC0, 0xFF, 0xE3, 0xC0, 0xFF, 0xF3, 0xC0, 0xF9, 0xF3, 0xC0, 0xF8, 0xFB, 0xC0, 0xF9, 0xF3, 0xC0,
+    0xFF, 0xF3, 0xC0, 0xFF, 0xF3, 0xC0, 0x7F, 0xC3, 0xC0, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+    0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF9, 0xF0, 0xF8, 0xF8, 0xF9, 0xF0, 0xFF, 0xF0, 0xFF,
+    0xF0, 0x7F, 0xC0, 0x7F, 0x80, 0x7F, 0xE0, 0x7F, 0xE0, 0x73, 0xF0, 0x00, 0xF0, 0x1F, 0xF0, 0x1F,
+    0xF8, 0x1F, 0xF0, 0x00, 0xF0, 0x73, 0xF0, 0x7F, 0xE0, 0x7F, 0xE0, 0x7F, 0x80, 0xF8, 0x3F, 0x80,
+    0xF8, 0x7F, 0xC0, 0xF8, 0xFF, 0xE0, 0xF9, 0xFB, 0xE0, 0xF9, 0xF1, 0xF0, 0xFF, 0xE1, 0xF0, 0xFF,
+    0xE1, 0xF0, 0xFF, 0xE1, 0xF0, 0xF9, 0xF1, 0xF0, 0xF9, 0xFB, 0xE0, 0xF8, 0xFF, 0xE0, 0xF8, 0x7F,
+    0xC0, 0xF8, 0x3F, 0x80, 0x1F, 0xF8, 0x3F, 0xF8, 0x7F, 0xF8, 0x7C, 0x78, 0x7C, 0x78, 0x7F, 0xF8,
+    0x3F, 0xF8, 0x1F, 0xF8, 0x1E, 0x78, 0x3E, 0x78, 0x3C, 0x78, 0x7C, 0x78, 0x78, 0x78, 0x0C, 0x00,
+    0x1E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0x80, 0x03, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0,
+    0x7F, 0xF0, 0xFD, 0xF0, 0xF8, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xF8, 0x00, 0xFC, 0x70,
+    0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x39, 0xE0, 0x7D, 0xE0, 0x7D, 0xE0, 0x39, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFD, 0xF0, 0xF8, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8,
+    0xFF, 0xF8, 0xF8, 0x00, 0xFC, 0x70, 0x7F, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x3C, 0x00, 0x3C, 0x00,
+    0xFF, 0xC0, 0xFF, 0xC0, 0x3C, 0x00, 0x3C, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x3F, 0xF8, 0x3C, 0xF8,
+    0x3C, 0x7C, 0x3C, 0x7C, 0x3C, 0x7C, 0x3C, 0x7C, 0x3C, 0x7C, 0x3C, 0x7C, 0x3C, 0x7C, 0x3C, 0x7C,
+    0x3C, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF0, 0x06, 0x00, 0x0F, 0x00,
+    0x0F, 0x80, 0x1E, 0x00, 0x1C, 0x00, 0x08, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0,
+    0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+    0xF8, 0x00, 0xF8, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x3F, 0xF0, 0x7E, 0x70, 0x78, 0x00, 0x7F, 0xC0,
+    0x7F, 0xC0, 0x7F, 0xC0, 0x78, 0x00, 0x7E, 0x70, 0x3F, 0xF0, 0x3F, 0xF8, 0x0F, 0xF0, 0x1F, 0xE0,
+    0x3F, 0xE0, 0x7F, 0xC0, 0x7C, 0xC0, 0x7F, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x3F, 0xE0, 0x03, 0xE0,
+    0x71, 0xE0, 0x7F, 0xE0, 0x7F, 0xC0, 0x7F, 0x80, 0x78, 0xF8, 0xF8, 0x78, 0x00, 0x00, 0xF8, 0xF8,
+    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x71, 0xC0, 0x7B, 0xE0, 0x7B,
+    0xE0, 0x71, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F,
+    0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F,
+    0x00, 0x0F, 0x1F, 0x1F, 0x0F, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0xFE, 0xFE, 0xFC, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
+    0xFC, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x1F, 0x3F, 0xF0, 0x1F, 0x3F, 0xF8, 0x1F, 0x3F,
+    0xFC, 0x1E, 0x3C, 0x7C, 0x7E, 0x3C, 0x7C, 0xFC, 0x3F, 0xFC, 0xF8, 0x3F, 0xF8, 0xF0, 0x3F, 0xF0,
+    0xF8, 0xF0, 0x00, 0xF8, 0xF0, 0x00, 0xF8, 0xF0, 0x00, 0xF8, 0xF0, 0x00, 0xF8, 0xF0, 0x00, 0xFF,
+    0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF0, 0xF8, 0xF9, 0xF0, 0xF8, 0xF1, 0xF0, 0xF8, 0xFF,
+    0xF0, 0xF8, 0xFF, 0xE0, 0xF8, 0xFF, 0xC0, 0x3C, 0x00, 0x3C, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x3C,
+    0x00, 0x3C, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x3F, 0xF8, 0x3C, 0xF8, 0x3C, 0x7C, 0x3C, 0x7C, 0x3C,
+    0x7C, 0x3C, 0x7C, 0x3C, 0x7C, 0x3C, 0x7C, 0x3C, 0x7C, 0x3C, 0x7C, 0x3C, 0x7C, 0x01, 0x80, 0x03,
+    0xC0, 0x07, 0xC0, 0x0F, 0x80, 0x0F, 0x00, 0x06, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF9, 0xF0, 0xFB,
+    0xE0, 0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xC0, 0xFB, 0xE0, 0xF9,
+    0xF0, 0xF9, 0xF8, 0xF8, 0xF8, 0x0C, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0x80, 0x03,
+    0x00, 0x00, 0x00, 0xF8, 0x78, 0xF8, 0xF8, 0xF9, 0xF8, 0xFB, 0xF8, 0xFB, 0xF8, 0xFF, 0xF8, 0xFF,
+    0xF8, 0xFF, 0x78, 0xFE, 0x78, 0xFE, 0x78, 0xFC, 0x78, 0xF8, 0x78, 0xF8, 0x78, 0x18, 0xE0, 0x3D,
+    0xE0, 0x3F, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0xF8, 0x78, 0x78,
+    0x78, 0x7C, 0xF8, 0x7C, 0xF0, 0x3C, 0xF0, 0x3F, 0xF0, 0x3F, 0xE0, 0x1F, 0xE0, 0x1F, 0xE0, 0x0F,
+    0xC0, 0x0F, 0xC0, 0x07, 0x80, 0x0F, 0x80, 0x5F, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0xF8,
+    0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8,
+    0xF0, 0xF8, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x00,
+    0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x0F,
+    0x9F, 0x80, 0x0F, 0x87, 0xC0, 0x0F, 0x87, 0xC0, 0x0F, 0x87, 0xC0, 0x0F, 0x87, 0xC0, 0x0F, 0x9F,
+    0x80, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
+    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x1E, 0x00, 0x1E, 0x00,
+    0x1F, 0xF8, 0x1F, 0xFC, 0x1F, 0xFE, 0x1E, 0x3E, 0x1E, 0x3E, 0x1F, 0xFE, 0x1F, 0xFC, 0x1F, 0xF8,
+    0x07, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0x3F, 0x00, 0x7C, 0x0F, 0x80, 0xF8,
+    0x0F, 0x80, 0xF8, 0x07, 0xC0, 0xFF, 0xEF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFD, 0xFF,
+    0xC0, 0xF8, 0x07, 0x80, 0x7C, 0x0F, 0x80, 0x7F, 0x3F, 0x80, 0x3F, 0xFF, 0x00, 0x1F, 0xFE, 0x00,
+    0x07, 0xF8, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFD, 0xF8, 0xF8, 0x78, 0xFF, 0x78, 0xFF,
+    0xF8, 0xF7, 0xF8, 0xF8, 0x78, 0xFD, 0xF8, 0x7F, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0xF8, 0x03, 0xF0,
+    0xF8, 0x07, 0xF0, 0x7C, 0x0F, 0xF0, 0x7C, 0x0F, 0xA0, 0x7C, 0x1F, 0x00, 0x3E, 0x1F, 0x00, 0x3E,
+    0x1E, 0x00, 0x1E, 0x3E, 0x00, 0x1F, 0x3E, 0x00, 0x1F, 0x3C, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF8,
+    0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00,
+    0xF8, 0x3E, 0xF8, 0x7E, 0x78, 0x7E, 0x7C, 0xF8, 0x7C, 0xF0, 0x3C, 0xF0, 0x3F, 0xE0, 0x1F, 0xE0,
+    0x1F, 0xE0, 0x1F, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x07, 0x80, 0x1E, 0x70, 0x00, 0x1E, 0xF0, 0x00,
+    0x0F, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
+    0x1E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x7E, 0x00, 0xF0, 0xFE, 0x00, 0xF1, 0xFE, 0x00, 0xF1, 0xFE,
+    0x00, 0xF3, 0xFE, 0x00, 0xF7, 0xDE, 0x00, 0xFF, 0x9E, 0x00, 0xFF, 0x9E, 0x00, 0xFF, 0x1E, 0x00,
+    0xFE, 0x1E, 0x00, 0xFE, 0x1E, 0x00, 0xFC, 0x1E, 0x00, 0xF8, 0x1F, 0xC0, 0xF8, 0x1F, 0xC0, 0xF0,
+    0x1F, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x06,
+    0x00, 0x38, 0xE0, 0x3D, 0xE0, 0x3F, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF0,
+    0xF8, 0xF1, 0xF8, 0xF1, 0xF8, 0xF3, 0xF8, 0xF7, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFE,
+    0xF8, 0xFC, 0xF8, 0xFC, 0xFE, 0xF8, 0xFE, 0xF0, 0xFC, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x78, 0x00,
+    0x30, 0x3C, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0x3C, 0x00, 0x3C, 0x00, 0x3F, 0xF8, 0x3F,
+    0xFC, 0x3F, 0xFE, 0x3C, 0x7E, 0x3C, 0x1F, 0x3C, 0x1F, 0x3C, 0x1F, 0x3C, 0x7E, 0x3F, 0xFE, 0x3F,
+    0xFC, 0x3F, 0xF0, 0x7C, 0x00, 0x7C, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x7C, 0x00, 0x7F, 0xE0, 0x7F,
+    0xF8, 0x7F, 0xF8, 0x7C, 0xFC, 0x7C, 0x7C, 0x7C, 0xFC, 0x7F, 0xF8, 0x7F, 0xF8, 0x3F, 0xE0, 0xFF,
+    0xE0, 0xFF, 0xF0, 0xFF, 0xF8, 0xF1, 0xFC, 0xF0, 0x7C, 0xF7, 0x7C, 0xF7, 0xFC, 0xF7, 0xF8, 0xFF,
+    0xF8, 0xFF, 0xF0, 0xFF, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x60, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0x7F, 0xC0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF9, 0xF8, 0xF8, 0xF8, 0xF8, 0x7C, 0xF8, 0x7C, 0xFB,
+    0x7C, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF0, 0xFF, 0xF0, 0xF8, 0xF0, 0xF8, 0x70, 0xF8,
+    0x70, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF,
+    0xF0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x01, 0xC0, 0x01,
+    0xC0, 0x01, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x3F, 0xFE, 0x3F,
+    0xFE, 0x3F, 0xFE, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF,
+    0xE0, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3F,
+    0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x3C,
+    0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0xFF, 0xF8, 0xF1, 0xF8, 0xF0, 0x7C, 0xF0,
+    0x7C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x7C, 0xF0, 0x7C, 0x00, 0x7C, 0x01, 0xF8, 0x07,
+    0xF0, 0x07, 0xF0, 0x07, 0xC0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF8, 0x00, 0xF8, 0x00, 0xFF,
+    0xC0, 0xFF, 0xE0, 0xFF, 0xF0, 0xF9, 0xF0, 0xF8, 0xF0, 0xF8, 0xF8, 0xF8, 0x78, 0xF8, 0xF8, 0x00,
+    0xF8, 0x01, 0xF0, 0x07, 0xF0, 0x07, 0xE0, 0x07, 0xC0, 0xFC, 0x3E, 0x1F, 0x00, 0x7E, 0x3E, 0x3F,
+    0x00, 0x3E, 0x3E, 0x7E, 0x00, 0x3F, 0x3E, 0xFC, 0x00, 0x1F, 0xBE, 0xF8, 0x00, 0x0F, 0xFF, 0xF0,
+    0x00, 0x07, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xE0,
+    0x00, 0x07, 0xFF, 0xF0, 0x00, 0x0F, 0xBF, 0xF8, 0x00, 0x1F, 0x3E, 0xF8, 0x00, 0x3F, 0x3E, 0x7C,
+    0x00, 0x7E, 0x3E, 0x3F, 0x80, 0x7C, 0x3E, 0x3F, 0x80, 0xF8, 0x3E, 0x1F, 0x80, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80, 0xFC, 0xF8, 0xF8,
+    0x7C, 0xF9, 0xF0, 0x3E, 0xFB, 0xE0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x07,
+    0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x1F, 0xFF, 0xC0, 0x3F, 0xFF, 0xE0, 0x3E, 0xFB, 0xFC, 0x7C, 0xF9,
+    0xFC, 0xF8, 0xF8, 0xFC, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
+    0x3F, 0xE0, 0x7F, 0xF0, 0x7F, 0xF8, 0x38, 0xFC, 0x00, 0x7C, 0x00, 0x7C, 0x01, 0xF8, 0x1F, 0xF8,
+    0x1F, 0xF0, 0x1F, 0xFC, 0x00, 0xFC, 0x00, 0x3C, 0x00, 0x3C, 0x78, 0xFC, 0x7F, 0xFC, 0xFF, 0xF8,
+    0x3F, 0xF0, 0x07, 0x80, 0x07, 0xC0, 0x03, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x7F, 0xC0, 0x7F, 0xE0,
+    0x7F, 0xE0, 0x73, 0xE0, 0x01, 0xE0, 0x3F, 0xE0, 0x3F, 0xE0, 0x3F, 0xE0, 0x01, 0xF0, 0x71, 0xF0,
+    0x7F, 0xF0, 0x7F, 0xE0, 0x7F, 0xC0, 0x0F, 0x00, 0x0F, 0x00, 0x17, 0x80, 0x1F, 0x80, 0x1F, 0x00,
+    0xF0, 0x7C, 0xF0, 0xFC, 0xF1, 0xF8, 0xF3, 0xF0, 0xF7, 0xE0, 0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0x00,
+    0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xC0, 0xF7, 0xE0, 0xF3, 0xF0, 0xF1, 0xF8, 0xF0, 0xFF, 0xF0, 0x7F,
+    0xF0, 0x7F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0xF8, 0xF8, 0xF9, 0xF0,
+    0xFB, 0xE0, 0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xC0, 0xFB, 0xE0,
+    0xF9, 0xFC, 0xF8, 0xFC, 0xF8, 0xFC, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0xF0, 0x0F,
+    0x80, 0xF0, 0x1F, 0x80, 0xF0, 0x1F, 0x00, 0xF7, 0x3E, 0x00, 0xF7, 0x7C, 0x00, 0xF7, 0xF8, 0x00,
+    0xF7, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF8, 0x00, 0xF7, 0xFC, 0x00, 0xF7,
+    0xFC, 0x00, 0xF7, 0x7E, 0x00, 0xF7, 0x3F, 0x00, 0xF0, 0x1F, 0x00, 0xF0, 0x1F, 0x80, 0xF0, 0x0F,
+    0x80, 0xF8, 0x3F, 0xF8, 0x3E, 0xFF, 0x7C, 0xFF, 0xF8, 0xFF, 0xF0, 0xFF, 0xE0, 0xFF, 0xF0, 0xFF,
+    0xF0, 0xFF, 0xF8, 0xFF, 0x7C, 0xF8, 0x3E, 0xF8, 0x3E, 0xF8, 0x1F, 0x3E, 0x00, 0x00, 0x3E, 0x0F,
+    0x80, 0xFF, 0x9F, 0x80, 0xFF, 0xBF, 0x00, 0xFF, 0xFE, 0x00, 0x3E, 0xFC, 0x00, 0x3F, 0xF8, 0x00,
+    0x3F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x3F,
+    0xF8, 0x00, 0x3E, 0xFC, 0x00, 0x3E, 0x7E, 0x00, 0x3E, 0x3F, 0x00, 0x3E, 0x1F, 0x00, 0x3E, 0x0F,
+    0x80, 0x7C, 0x00, 0xFF, 0x3E, 0xFF, 0x7C, 0xFF, 0xF8, 0x7D, 0xF0, 0x7F, 0xE0, 0x7F, 0xC0, 0x7F,
+    0x80, 0x7F, 0xC0, 0x7F, 0xE0, 0x7F, 0xF0, 0x7D, 0xF8, 0x7C, 0x7C, 0x7C, 0x7E, 0xFF, 0x83, 0xE0,
+    0xFF, 0x87, 0xC0, 0xFF, 0x8F, 0x80, 0x0F, 0x9F, 0x00, 0x0F, 0xBF, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
+    0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xBF,
+    0x00, 0x0F, 0x9F, 0x80, 0x0F, 0x8F, 0xC0, 0x0F, 0x87, 0xC0, 0x0F, 0x83, 0xE0, 0x0F, 0x83, 0xF0,
+    0xFF, 0x1F, 0x00, 0xFF, 0x3E, 0x00, 0xFF, 0x7C, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x1F,
+    0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0x7C, 0x00, 0x1F, 0x3E,
+    0x00, 0x1F, 0x3F, 0x00, 0x1F, 0x1F, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00,
+    0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xFF, 0xFE, 0x00, 0xFF,
+    0xFE, 0x00, 0xFF, 0xFE, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E,
+    0x00, 0xF0, 0x3F, 0xC0, 0xF0, 0x3F, 0xC0, 0xF0, 0x3F, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0,
+    0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8,
+    0xF0, 0xF8, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xFE, 0xF8,
+    0xFE, 0xF8, 0xFE, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0xF0, 0x3F, 0xE0, 0xF0, 0x3F,
+    0xE0, 0xF0, 0x3F, 0xE0, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00,
+    0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0,
+    0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF8, 0xFE,
+    0xF8, 0xFE, 0xF8, 0xFE, 0xF8, 0xF0, 0xF8, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xF8, 0xF0,
+    0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
+    0xFF, 0xFE, 0x00, 0x00, 0xF0, 0x3E, 0x00, 0x00, 0xF0, 0x3E, 0x00, 0x00, 0xF0, 0x3E, 0x00, 0x00,
+    0xF0, 0x3F, 0xF8, 0x00, 0xF0, 0x3F, 0xFC, 0x00, 0xF0, 0x3F, 0xFE, 0x00, 0xF0, 0x3E, 0x7F, 0x00,
+    0xF0, 0x3E, 0x0F, 0x00, 0xF0, 0x3E, 0x0F, 0x80, 0xF0, 0x3E, 0x0F, 0x80, 0xF0, 0x3E, 0x07, 0x80,
+    0xF0, 0x3E, 0x0F, 0x80, 0xF0, 0x3E, 0x0F, 0x80, 0xF0, 0x3E, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00,
+    0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0xF8, 0xF0, 0x00, 0xF8, 0xF0, 0x00, 0xF8,
+    0xFF, 0x80, 0xF8, 0xFF, 0xE0, 0xF8, 0xFF, 0xE0, 0xF8, 0xFB, 0xF0, 0xF8, 0xF0, 0xF0, 0xF8, 0xF0,
+    0xF0, 0xF8, 0xF0, 0xF0, 0xF8, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xE0,
+    0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xC0, 0x07, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x7F,
+    0x18, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0xF8, 0xFF, 0x80, 0xF9, 0xFF, 0xC0, 0xF9, 0xF7,
+    0xC0, 0xF9, 0xE3, 0xC0, 0xFB, 0xE3, 0xC0, 0xFB, 0xE3, 0xC0, 0x7F, 0xE7, 0xC0, 0x7F, 0xFF, 0xC0,
+    0x3F, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00,
+    0x1F, 0xC0, 0x00, 0x07, 0xC0, 0x1F, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0xFC, 0xC0, 0xF1, 0xF8, 0xF3,
+    0xFC, 0xF7, 0xFC, 0xF7, 0xBC, 0xF7, 0x9C, 0xFF, 0xBC, 0x7F, 0xFC, 0x3F, 0xF8, 0x1F, 0xF0, 0x03,
+    0xF8, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x3C, 0x07, 0xFC, 0x1F, 0xFE, 0x3F, 0xFC, 0x7F, 0x1C, 0x7C,
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x7C,
+    0x00, 0x7F, 0x1C, 0x3F, 0xFE, 0x1F, 0xFE, 0x07, 0xFC, 0x01, 0xC0, 0x01, 0xE0, 0x00, 0xE0, 0x07,
+    0xE0, 0x07, 0xC0, 0x1F, 0xE0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFC, 0xC0, 0xF8, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF8, 0x00, 0xFC, 0x60, 0x7F, 0xE0, 0x3F, 0xE0, 0x0F, 0xE0, 0x0F, 0x00, 0x07,
+    0x80, 0x07, 0x80, 0x1F, 0x80, 0x1F, 0x00, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0x07, 0xC0, 0x07,
+    0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07,
+    0xC0, 0x07, 0xC0, 0x07, 0xF8, 0x07, 0xF8, 0x07, 0xF8, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00,
+    0x78, 0x00, 0x78, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x0F,
+    0x80, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x01, 0xE0, 0x01,
+    0xE0, 0x01, 0xE0, 0x01, 0xE0, 0xF8, 0x1F, 0x80, 0x7C, 0x1F, 0x00, 0x7C, 0x3E, 0x00, 0x3E, 0x3E,
+    0x00, 0x3E, 0x7C, 0x00, 0x1F, 0x7C, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xF0, 0x00,
+    0x07, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03,
+    0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0xF8, 0x7C, 0xF8, 0x78, 0x78, 0xF8, 0x7C, 0xF8,
+    0x7C, 0xF0, 0x3D, 0xF0, 0x3F, 0xF0, 0x1F, 0xE0, 0x1F, 0xE0, 0x1F, 0xC0, 0x0F, 0xC0, 0x0F, 0x80,
+    0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0xF8, 0x1F, 0x80, 0x7C,
+    0x1F, 0x00, 0x7C, 0x3E, 0x00, 0x3E, 0x3E, 0x00, 0x3E, 0x7C, 0x00, 0x1F, 0x7C, 0x00, 0x1F, 0xF8,
+    0x00, 0x0F, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFC, 0x00,
+    0x1F, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0xF8,
+    0x7C, 0xF8, 0x78, 0x78, 0xF8, 0x7C, 0xF8, 0x7C, 0xF0, 0x3D, 0xF0, 0x3F, 0xF0, 0x1F, 0xE0, 0x1F,
+    0xE0, 0x1F, 0xC0, 0x0F, 0xC0, 0x3F, 0xF0, 0x3F, 0xF0, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07,
+    0x80, 0x07, 0x80, 0xFC, 0x1F, 0x00, 0x7E, 0x3F, 0x00, 0x3E, 0x3E, 0x00, 0x3F, 0x7C, 0x00, 0x1F,
+    0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xF0,
+    0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x7E, 0x00, 0x7E, 0x3F, 0xC0,
+    0x7C, 0x1F, 0xC0, 0xF8, 0x1F, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00,
+    0x07, 0xC0, 0x00, 0x07, 0xC0, 0xF8, 0x78, 0x7C, 0xF8, 0x3F, 0xF0, 0x3F, 0xE0, 0x1F, 0xE0, 0x0F,
+    0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x1F, 0xE0, 0x3F, 0xF0, 0x7C, 0xFE, 0x78, 0xFE, 0xF8, 0x7E, 0x00,
+    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0xFF, 0xFD, 0xF0, 0xFF, 0xFD, 0xF0, 0xFF, 0xFD, 0xF0,
+    0x07, 0x81, 0xF0, 0x07, 0x81, 0xF0, 0x07, 0x81, 0xF0, 0x07, 0x81, 0xF0, 0x07, 0x81, 0xF0, 0x07,
+    0x81, 0xF0, 0x07, 0x81, 0xF0, 0x07, 0x81, 0xF0, 0x07, 0x81, 0xF0, 0x07, 0x81, 0xF0, 0x07, 0x81,
+    0xF0, 0x07, 0xFF, 0xFE, 0x07, 0xFF, 0xFE, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E,
+    0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0xFF, 0xDE, 0x00, 0xFF, 0xDE, 0x00, 0xFF,
+    0xDE, 0x00, 0x3E, 0x1E, 0x00, 0x3E, 0x1E, 0x00, 0x3E, 0x1E, 0x00, 0x3E, 0x1E, 0x00, 0x3E, 0x1E,
+    0x00, 0x3E, 0x1E, 0x00, 0x3E, 0x1E, 0x00, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x80,
+    0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0xF8, 0x3E, 0x00, 0xF8,
+    0x3E, 0x00, 0xF8, 0x3E, 0x00, 0xF8, 0x3E, 0x00, 0xF8, 0x3E, 0x00, 0xF8, 0x3E, 0x00, 0xF8, 0x3E,
+    0x00, 0xFC, 0x3E, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x3E, 0x00,
+    0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00,
+    0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0xF8, 0xF0,
+    0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xFC, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x3F, 0xF0,
+    0x00, 0xF0, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E,
+    0xF8, 0x3C, 0xF8, 0x3C, 0xF8, 0x3C, 0xF8, 0x3C, 0xF8, 0x3C, 0xFB, 0xBC, 0xFB, 0xBC, 0xFF, 0xBC,
+    0x7F, 0xFC, 0x7F, 0xFC, 0x1F, 0xFC, 0x03, 0xBC, 0x03, 0xBC, 0x03, 0xBC, 0x00, 0x3C, 0x00, 0x3C,
+    0x00, 0x3C, 0xF8, 0x78, 0xF8, 0x78, 0xF8, 0x78, 0xF8, 0x78, 0xFB, 0x78, 0xFF, 0x78, 0x7F, 0xF8,
+    0x7F, 0xF8, 0x3F, 0xF8, 0x03, 0x78, 0x03, 0x78, 0x00, 0x78, 0x00, 0x78, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xF8, 0xFF, 0xFC, 0xF8, 0xFC, 0xF0, 0x7C,
+    0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0x78, 0x00,
+    0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0xC0, 0xFF, 0xE0, 0xFF, 0xF0,
+    0xF9, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0,
+    0xF8, 0xF0, 0xF8, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xE0, 0x03, 0xF3, 0xF0,
+    0xF7, 0xE1, 0xF0, 0xF7, 0xC0, 0xF8, 0xFF, 0xC0, 0xF8, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xF8, 0x1F,
+    0xFF, 0xF8, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xF9, 0xE0, 0x01, 0xFF,
+    0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFC, 0x00, 0xE3, 0xFE, 0x00, 0xF7, 0xFF, 0x00,
+    0xFF, 0xDF, 0x00, 0xFF, 0x8F, 0x80, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x0F,
+    0x80, 0x00, 0x0F, 0xC7, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xE0, 0x03, 0xF3, 0xF0, 0xF7, 0xE1, 0xF0, 0xF7, 0xC0, 0xF8,
+    0xFF, 0xC0, 0xF8, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8, 0x07, 0xC0, 0x00, 0x07,
+    0xC0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xF9, 0xE0, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x7F,
+    0xE0, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x01, 0xFC, 0x00,
+    0xE3, 0xFE, 0x00, 0xF7, 0xFF, 0x00, 0xFF, 0xDF, 0x00, 0xFF, 0x8F, 0x80, 0xFF, 0xFF, 0x80, 0x7F,
+    0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x0F, 0x80, 0x00, 0x0F, 0xC7, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0xE3,
+    0x00, 0x00, 0x00, 0xF7, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3E, 0x1F, 0x00, 0x7E, 0x3E,
+    0x3F, 0x00, 0x3E, 0x3E, 0x7E, 0x00, 0x3F, 0x3E, 0xFC, 0x00, 0x1F, 0xBE, 0xF8, 0x00, 0x0F, 0xFF,
+    0xF0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
+    0xE0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x0F, 0xBF, 0xF8, 0x00, 0x1F, 0x3E, 0xFC, 0x00, 0x3F, 0x3E,
+    0x7C, 0x00, 0x7E, 0x3E, 0x3E, 0x00, 0x7C, 0x3E, 0x3F, 0x00, 0xF8, 0x3E, 0x1F, 0x00, 0x01, 0x8C,
+    0x00, 0x03, 0xDE, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0xF8, 0xF8, 0x7C, 0xF9, 0xF0, 0x3E, 0xFB, 0xE0, 0x1F, 0xFF, 0xE0, 0x1F,
+    0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x1F, 0xFF, 0xC0, 0x3F, 0xFB,
+    0xE0, 0x3E, 0xFB, 0xF0, 0x7C, 0xF9, 0xF0, 0xF8, 0xF8, 0xF8, 0xF0, 0x7C, 0xF0, 0xF8, 0xF1, 0xF8,
+    0xF3, 0xF0, 0xF7, 0xE0, 0xF7, 0xC0, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xF0, 0xFF, 0xF8, 0xF3, 0xFC,
+    0xF0, 0x7C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0x00, 0x7C, 0x01, 0xFC,
+    0x07, 0xF8, 0x07, 0xF0, 0x07, 0xE0, 0xF8, 0xF8, 0xF9, 0xF0, 0xFB, 0xE0, 0xFF, 0xC0, 0xFF, 0x80,
+    0xFF, 0xC0, 0xFF, 0xE0, 0xFF, 0xF0, 0xF9, 0xF0, 0xF8, 0xF8, 0xF8, 0x78, 0xF8, 0x78, 0xF8, 0x78,
+    0x00, 0xF8, 0x01, 0xF0, 0x07, 0xF0, 0x07, 0xE0, 0x07, 0xC0, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0xC0,
+    0x07, 0xFF, 0xC0, 0x07, 0xC7, 0xC0, 0x07, 0xC7, 0xC0, 0x07, 0xC7, 0xC0, 0x07, 0x87, 0xC0, 0x07,
+    0x87, 0xC0, 0x07, 0x87, 0xC0, 0x07, 0x87, 0xC0, 0x0F, 0x87, 0xC0, 0x0F, 0x87, 0xC0, 0x1F, 0x07,
+    0xC0, 0x7F, 0x07, 0xC0, 0xFE, 0x07, 0xF8, 0xFC, 0x07, 0xF0, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0xF0,
+    0x00, 0x01, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xC0, 0x0F, 0xFC, 0x00, 0x0F,
+    0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x1F, 0x3C, 0x00, 0x1F, 0x3C,
+    0x00, 0x1F, 0x3C, 0x00, 0x1E, 0x3C, 0x00, 0x7E, 0x3C, 0x00, 0xFC, 0x3F, 0x80, 0xF8, 0x3F, 0x80,
+    0xF0, 0x3F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0C, 0x00, 0xF0,
+    0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xFF, 0xFE, 0xFF,
+    0xFE, 0xFF, 0xFE, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0,
+    0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x01, 0xFC, 0x01, 0xFC, 0x01, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0xF8, 0x00, 0xF0, 0x07, 0xF0, 0x07, 0xF0, 0x07, 0xE0, 0xF0,
+    0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E,
+    0x00, 0xF0, 0x3E, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0xF0, 0x3E, 0x00,
+    0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3E, 0x00, 0xF0, 0x3F, 0x80, 0xF0, 0x3F, 0x80, 0xF0,
+    0x3F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0E,
+    0x00, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF,
+    0xF0, 0xF8, 0xF0, 0xF8, 0xF0, 0xF8, 0xFC, 0xF8, 0xFC, 0xF8, 0xFC, 0x00, 0x3C, 0x00, 0x78, 0x00,
+    0x78, 0x00, 0x30, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF8,
+    0x3C, 0xFC, 0x7C, 0xFF, 0xFC, 0x7F, 0xFC, 0x3F, 0xFC, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x01,
+    0xFC, 0x01, 0xFC, 0x01, 0xFC, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0xF1,
+    0xF0, 0xF1, 0xF0, 0xF1, 0xF0, 0xF1, 0xF0, 0xF9, 0xF0, 0xFF, 0xF0, 0x7F, 0xF0, 0x3F, 0xF0, 0x01,
+    0xF0, 0x01, 0xF0, 0x07, 0xF0, 0x07, 0xF0, 0x07, 0xF0, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07,
+    0x80, 0x7C, 0x03, 0xE0, 0x7E, 0x03, 0xE0, 0x7E, 0x07, 0xE0, 0x7F, 0x07, 0xE0, 0x7F, 0x0F, 0xE0,
+    0x7F, 0x8F, 0xF0, 0x7F, 0x9F, 0xF0, 0x7F, 0xDF, 0xF0, 0x7B, 0xDF, 0xF0, 0x7B, 0xFD, 0xF0, 0x79,
+    0xFD, 0xF0, 0xF9, 0xF8, 0xF0, 0xF9, 0xF8, 0xF0, 0xF8, 0xF8, 0xF0, 0xF8, 0xF0, 0xFE, 0xF8, 0x00,
+    0xFE, 0xF8, 0x00, 0xFE, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78,
+    0x00, 0x00, 0x30, 0x78, 0x1F, 0x00, 0x7C, 0x1F, 0x00, 0x7C, 0x3F, 0x00, 0x7E, 0x3F, 0x00, 0xFE,
+    0x7F, 0x00, 0xFF, 0x7F, 0x00, 0xFF, 0xFF, 0x00, 0xF7, 0xFF, 0x00, 0xF7, 0xEF, 0x00, 0xF3, 0xEF,
+    0x00, 0xF3, 0xCF, 0xE0, 0xF0, 0x0F, 0xE0, 0xF0, 0x0F, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0,
+    0x00, 0x07, 0x80, 0x00, 0x03, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x07, 0x38, 0x00, 0x0F, 0x78, 0x00, 0x07, 0xF8, 0x00,
+    0x07, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x03,
+    0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0x3C,
+    0x00, 0x1F, 0x3E, 0x00, 0x1E, 0x3E, 0x00, 0x1E, 0x1E, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x00,
+    0x3F, 0xFF, 0x80, 0x7C, 0x0F, 0x80, 0x7C, 0x0F, 0x80, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0x1C,
+    0xE0, 0x3C, 0xF0, 0x1F, 0xE0, 0x1F, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x3F,
+    0xF0, 0x3F, 0xF0, 0x31, 0xF0, 0x00, 0xF8, 0x1F, 0xF8, 0x7F, 0xF8, 0x7F, 0xF8, 0x7C, 0xF8, 0x7C,
+    0xF8, 0x7F, 0xF8, 0x7F, 0xF8, 0x3F, 0xF0, 0x0F, 0x38, 0x00, 0x0F, 0x7C, 0x00, 0x0F, 0x7C, 0x00,
+    0x0F, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x03,
+    0xF0, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0x3C, 0x00, 0x1F, 0x3E,
+    0x00, 0x1E, 0x3E, 0x00, 0x1E, 0x1E, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x80,
+    0x7C, 0x0F, 0x80, 0x7C, 0x0F, 0x80, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0x3C, 0xE0, 0x3D, 0xF0,
+    0x3D, 0xF0, 0x3C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xF0, 0x3F, 0xF0, 0x31, 0xF0,
+    0x00, 0xF8, 0x1F, 0xF8, 0x7F, 0xF8, 0x7F, 0xF8, 0x7C, 0xF8, 0x7C, 0xF8, 0x7F, 0xF8, 0x7F, 0xF8,
+    0x3F, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0x00, 0x01, 0xFF,
+    0x00, 0x01, 0xEF, 0x00, 0x03, 0xEF, 0x00, 0x07, 0xCF, 0xFE, 0x07, 0xCF, 0xFE, 0x0F, 0x8F, 0xFE,
+    0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x3E, 0x0F, 0x00, 0x7C, 0x0F, 0xFF, 0x7C,
+    0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0x3F, 0xCF, 0xC0, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xF0, 0x31, 0xFD,
+    0xF8, 0x00, 0xF8, 0x78, 0x1F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF8, 0x7C, 0xF8, 0x00,
+    0x7C, 0x7E, 0x70, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x39, 0xC0, 0x79, 0xE0,
+    0x3F, 0xC0, 0x3F, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xF0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x18, 0xC0, 0x3D, 0xE0,
+    0x3F, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0,
+    0xFD, 0xF0, 0xF8, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xF8, 0x00, 0xFC, 0x70, 0x7F, 0xF0,
+    0x3F, 0xF0, 0x1F, 0xF0, 0x1F, 0xF0, 0x7F, 0xF8, 0x7F, 0xFC, 0x38, 0xFE, 0x00, 0x1F, 0x00, 0x1F,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xF8, 0x1F, 0x7C, 0x3F, 0x7E, 0x7E,
+    0x3F, 0xFC, 0x1F, 0xF8, 0x0F, 0xF0, 0x7F, 0x80, 0x7F, 0xE0, 0x7F, 0xF0, 0x73, 0xF0, 0x00, 0xF8,
+    0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xF0, 0xF8, 0xF9, 0xF0, 0x7F, 0xF0, 0x7F, 0xE0, 0x1F, 0x80,
+    0x1E, 0x70, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0x70, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xF8,
+    0x7F, 0xFC, 0x38, 0xFE, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF8, 0x1F, 0xF8, 0x1F, 0x7C, 0x3F, 0x7E, 0x7E, 0x3F, 0xFC, 0x1F, 0xF8, 0x0F, 0xF0, 0x39, 0xE0,
+    0x7D, 0xE0, 0x7D, 0xE0, 0x39, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0xE0, 0x7F, 0xF0,
+    0x73, 0xF0, 0x00, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xF0, 0xF8, 0xF9, 0xF0, 0x7F, 0xF0,
+    0x7F, 0xE0, 0x1F, 0x80, 0x00, 0xE7, 0x80, 0x00, 0x01, 0xF7, 0x80, 0x00, 0x01, 0xF7, 0x80, 0x00,
+    0x00, 0xE7, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3E, 0x1F, 0x00,
+    0x7E, 0x3E, 0x3F, 0x00, 0x3E, 0x3E, 0x7E, 0x00, 0x3F, 0x3E, 0xFC, 0x00, 0x1F, 0xBE, 0xF8, 0x00,
+    0x0F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xC0, 0x00,
+    0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x0F, 0xBF, 0xF8, 0x00, 0x1F, 0x3E, 0xFC, 0x00,
+    0x3F, 0x3E, 0x7C, 0x00, 0x7E, 0x3E, 0x3E, 0x00, 0x7C, 0x3E, 0x3F, 0x00, 0xF8, 0x3E, 0x1F, 0x00,
+    0x03, 0xCE, 0x00, 0x03, 0xDF, 0x00, 0x03, 0xDF, 0x00, 0x03, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFC, 0xF8, 0xF8, 0x7C, 0xF9, 0xF0, 0x3E, 0xFB, 0xE0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF,
+    0xC0, 0x0F, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x1F, 0xFF, 0xC0, 0x3F, 0xFB, 0xE0,
+    0x3E, 0xFB, 0xF0, 0x7C, 0xF9, 0xF0, 0xF8, 0xF8, 0xF8, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xF0, 0x7F, 0xF8, 0x38, 0xFC, 0x00, 0x7C, 0x00,
+    0x7C, 0x01, 0xF8, 0x1F, 0xF8, 0x1F, 0xF0, 0x1F, 0xFC, 0x00, 0xFC, 0x00, 0x3C, 0x00, 0x3C, 0x78,
+    0xFC, 0x7F, 0xFC, 0xFF, 0xF8, 0x3F, 0xF0, 0x79, 0xC0, 0x7B, 0xE0, 0x7B, 0xE0, 0x79, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0xE0, 0x7F, 0xE0, 0x73, 0xE0, 0x01, 0xE0, 0x3F, 0xE0, 0x3F,
+    0xE0, 0x3F, 0xE0, 0x01, 0xF0, 0x71, 0xF0, 0x7F, 0xF0, 0x7F, 0xE0, 0x7F, 0xC0, 0x7F, 0xFC, 0x7F,
+    0xFC, 0x7F, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF8, 0x01,
+    0xFC, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x7C, 0x78, 0xFC, 0x7F, 0xF8, 0xFF, 0xF8, 0x3F, 0xE0, 0xFF,
+    0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x1F,
+    0xC0, 0x1F, 0xE0, 0x03, 0xF0, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x63, 0xF0, 0xFF, 0xF0, 0xFF,
+    0xE0, 0xFF, 0x80, 0x1F, 0xF0, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
+    0x1E, 0xF0, 0x3E, 0xF0, 0x7E, 0xF0, 0xFE, 0xF1, 0xFE, 0xF1, 0xFE, 0xF3, 0xFE, 0xF7, 0xDE, 0xFF,
+    0x9E, 0xFF, 0x9E, 0xFF, 0x1E, 0xFE, 0x1E, 0xFE, 0x1E, 0xFC, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF0,
+    0x1E, 0x3F, 0xE0, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x78, 0xF8,
+    0xF8, 0xF9, 0xF8, 0xFB, 0xF8, 0xFB, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0x78, 0xFE, 0x78, 0xFE,
+    0x78, 0xFC, 0x78, 0xF8, 0x78, 0xF8, 0x78, 0x1E, 0x70, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0x1E, 0xF0, 0x3E, 0xF0, 0x7E, 0xF0, 0xFE, 0xF1, 0xFE, 0xF1, 0xFE, 0xF3,
+    0xFE, 0xF7, 0xDE, 0xFF, 0x9E, 0xFF, 0x9E, 0xFF, 0x1E, 0xFE, 0x1E, 0xFE, 0x1E, 0xFC, 0x1E, 0xF8,
+    0x1E, 0xF8, 0x1E, 0xF0, 0x1E, 0x3C, 0xE0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0x78, 0xF8, 0xF8, 0xF9, 0xF8, 0xFB, 0xF8, 0xFB, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF,
+    0x78, 0xFE, 0x78, 0xFE, 0x78, 0xFC, 0x78, 0xF8, 0x78, 0xF8, 0x78, 0x0F, 0x38, 0x00, 0x0F, 0x3C,
+    0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
+    0x1F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0x3F, 0x00, 0x7C, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8,
+    0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x0F,
+    0x80, 0x7C, 0x0F, 0x80, 0x7F, 0x3F, 0x80, 0x3F, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xF8, 0x00,
+    0x3C, 0xE0, 0x3D, 0xF0, 0x3D, 0xF0, 0x3C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0,
+    0x7F, 0xF0, 0xFD, 0xF8, 0xF8, 0xF8, 0xF0, 0x78, 0xF0, 0x78, 0xF0, 0x78, 0xF8, 0xF8, 0xFD, 0xF8,
+    0x7F, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x07, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x7F,
+    0x3F, 0x00, 0x7C, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x07, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xC0, 0xFF, 0xFF, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x0F, 0x80, 0x7C, 0x0F, 0x80, 0x7F, 0x3F, 0x80,
+    0x3F, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFD,
+    0xF8, 0xF0, 0x78, 0xFF, 0xF8, 0xFF, 0xF8, 0xF0, 0x78, 0xF8, 0xF8, 0xFD, 0xF8, 0x7F, 0xF0, 0x3F,
+    0xE0, 0x1F, 0xC0, 0x0F, 0x38, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0x3F,
+    0x00, 0x7C, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x07, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0,
+    0xFF, 0xFF, 0xC0, 0xF8, 0x07, 0xC0, 0xF8, 0x0F, 0x80, 0x7C, 0x0F, 0x80, 0x7F, 0x3F, 0x80, 0x3F,
+    0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x39, 0xE0, 0x7D, 0xE0, 0x7D, 0xE0, 0x39, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x7F, 0xF0, 0xFD, 0xF8, 0xF0, 0x78, 0xFF, 0xF8,
+    0xFF, 0xF8, 0xF0, 0x78, 0xF8, 0xF8, 0xFD, 0xF8, 0x7F, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x3C, 0xE0,
+    0x3D, 0xF0, 0x3D, 0xF0, 0x3C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xF0, 0xFF, 0xF8,
+    0x71, 0xFC, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x3E, 0x1F, 0xFE, 0x1F, 0xFE, 0x1F, 0xFE, 0x00, 0x3E,
+    0x00, 0x3E, 0x00, 0x7C, 0x79, 0xFC, 0xFF, 0xF8, 0xFF, 0xF0, 0x7F, 0xC0, 0x39, 0xE0, 0x7D, 0xE0,
+    0x7D, 0xE0, 0x39, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0xE0, 0x7F, 0xE0, 0x73, 0xF0,
+    0x00, 0xF0, 0x1F, 0xF0, 0x1F, 0xF8, 0x1F, 0xF0, 0x00, 0xF0, 0x73, 0xF0, 0x7F, 0xE0, 0x7F, 0xE0,
+    0x7F, 0x80, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x7C, 0x1F, 0x00, 0x7C, 0x1F, 0x00, 0x3E, 0x3E, 0x00,
+    0x3E, 0x3E, 0x00, 0x1F, 0x3C, 0x00, 0x1F, 0x7C, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x07,
+    0xF8, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x27, 0xE0, 0x00, 0x7F, 0xC0,
+    0x00, 0x7F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xE0, 0x1F, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0x7C, 0xF8, 0x78, 0x78, 0x78, 0x7C, 0xF8, 0x7C, 0xF0, 0x3C, 0xF0, 0x3F,
+    0xF0, 0x3F, 0xE0, 0x1F, 0xE0, 0x1F, 0xE0, 0x0F, 0xC0, 0x0F, 0xC0, 0x07, 0x80, 0x0F, 0x80, 0x5F,
+    0x00, 0xFF, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0x0E, 0x38, 0x00, 0x0F, 0x7C, 0x00, 0x0F, 0x7C, 0x00,
+    0x0E, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x7C, 0x1F, 0x00, 0x7C,
+    0x1F, 0x00, 0x3E, 0x3E, 0x00, 0x3E, 0x3E, 0x00, 0x1F, 0x3C, 0x00, 0x1F, 0x7C, 0x00, 0x0F, 0xF8,
+    0x00, 0x0F, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00,
+    0x27, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x3C, 0xE0, 0x3D, 0xF0,
+    0x3D, 0xF0, 0x3C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0xF8, 0x78, 0x78, 0x78, 0x7C, 0xF8,
+    0x7C, 0xF0, 0x3C, 0xF0, 0x3F, 0xF0, 0x3F, 0xE0, 0x1F, 0xE0, 0x1F, 0xE0, 0x0F, 0xC0, 0x0F, 0xC0,
+    0x07, 0x80, 0x0F, 0x80, 0x5F, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0x03, 0x18, 0x00, 0x03,
+    0x9C, 0x00, 0x07, 0xBC, 0x00, 0x07, 0x3C, 0x00, 0x0F, 0x78, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0x1F, 0x00, 0x7C, 0x1F, 0x00, 0x7C, 0x1F, 0x00, 0x3E, 0x3E, 0x00, 0x3E, 0x3E, 0x00,
+    0x1F, 0x3C, 0x00, 0x1F, 0x7C, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x03,
+    0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x27, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0x80,
+    0x00, 0x7F, 0x00, 0x00, 0x06, 0x30, 0x0F, 0x78, 0x0F, 0x78, 0x1E, 0xF0, 0x3D, 0xE0, 0x18, 0xC0,
+    0x00, 0x00, 0xF8, 0x7C, 0xF8, 0x78, 0x78, 0x78, 0x7C, 0xF8, 0x7C, 0xF0, 0x3C, 0xF0, 0x3F, 0xF0,
+    0x3F, 0xE0, 0x1F, 0xE0, 0x1F, 0xE0, 0x0F, 0xC0, 0x0F, 0xC0, 0x07, 0x80, 0x0F, 0x80, 0x5F, 0x00,
+    0xFF, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0x1C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C, 0xF8, 0x3C,
+    0xFC, 0x7C, 0xFF, 0xFC, 0x7F, 0xFC, 0x3F, 0xFC, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C,
+    0x00, 0x3C, 0x00, 0x3C, 0x79, 0xC0, 0x7B, 0xE0, 0x7B, 0xE0, 0x79, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xF0, 0xF1, 0xF0, 0xF1, 0xF0, 0xF1, 0xF0, 0xF1, 0xF0, 0xF9, 0xF0, 0xFF, 0xF0, 0x7F, 0xF0,
+    0x3F, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x1E, 0x00, 0x1E, 0x00,
+    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xF8, 0x00, 0xF8, 0x00,
+    0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00,
+    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x07, 0x9C, 0x00, 0x07, 0xBE, 0x00, 0x07, 0xBE,
+    0x00, 0x07, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xF0, 0xF0, 0x01, 0xF0,
+    0xF0, 0x01, 0xF0, 0xF0, 0x01, 0xF0, 0xF0, 0x01, 0xF0, 0xF0, 0x01, 0xF0, 0xFF, 0xC1, 0xF0, 0xFF,
+    0xF1, 0xF0, 0xFF, 0xF9, 0xF0, 0xF3, 0xF9, 0xF0, 0xF0, 0xF9, 0xF0, 0xF0, 0x79, 0xF0, 0xF0, 0xF9,
+    0xF0, 0xF1, 0xF9, 0xF0, 0xFF, 0xF9, 0xF0, 0xFF, 0xF1, 0xF0, 0xFF, 0xC1, 0xF0, 0x07, 0x3C, 0x00,
+    0x0F, 0xBC, 0x00, 0x0F, 0xBC, 0x00, 0x07, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0x03, 0xC0, 0xF8, 0x03, 0xC0, 0xF8, 0x03, 0xC0, 0xF8, 0x03, 0xC0, 0xFF, 0xC3, 0xC0, 0xFF, 0xE3,
+    0xC0, 0xFF, 0xF3, 0xC0, 0xF9, 0xF3, 0xC0, 0xF8, 0xFB, 0xC0, 0xF9, 0xF3, 0xC0, 0xFF, 0xF3, 0xC0,
+    0xFF, 0xF3, 0xC0, 0x7F, 0xC3, 0xC0, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0x80, 0x78, 0x78, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x78, 0x78, 0x78, 0x78, 0x78,
+    0xF0, 0xF0, 0x78, 0x78, 0x78, 0x78, 0x78, 0xF0, 0xF0, 0x79, 0xC0, 0x7B, 0xC0, 0xF3, 0xC0, 0xF7,
+    0x80, 0xF7, 0x80, 0xF7, 0x80, 0xF7, 0x80, 0x7B, 0xE0, 0x7B, 0xE0, 0x7B, 0xE0, 0x7B, 0xC0, 0x7B,
+    0xC0, 0xF3, 0xC0, 0xF3, 0x80, 0x7B, 0xE0, 0x7B, 0xE0, 0x7B, 0xE0, 0x7B, 0xC0, 0x7B, 0xC0, 0xF3,
+    0xC0, 0xF3, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0xFF, 0xF0, 0xFF,
+    0xF0, 0xFF, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0x0F, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x00, 0x0F, 0x00, 0x07, 0x00, 0x07, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x7F,
+    0x00, 0x7F, 0x00, 0x3E, 0x00, 0x78, 0x38, 0x3C, 0xF8, 0x7C, 0x3E, 0xF8, 0x7C, 0x3E, 0xF8, 0x7C,
+    0x3E, 0x78, 0x38, 0x3C, 0x3F, 0x03, 0xC0, 0x00, 0x00, 0x7F, 0x87, 0xC0, 0x00, 0x00, 0x7B, 0xC7,
+    0x80, 0x00, 0x00, 0x73, 0xCF, 0x00, 0x00, 0x00, 0x71, 0xCF, 0x00, 0x00, 0x00, 0x73, 0xDE, 0x00,
+    0x00, 0x00, 0x7B, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x7D, 0xF8, 0x7E,
+    0x00, 0x00, 0x7B, 0xFC, 0xFF, 0x00, 0x00, 0xF7, 0xBD, 0xEF, 0x00, 0x00, 0xF7, 0x9D, 0xE7, 0x00,
+    0x01, 0xE7, 0x1D, 0xC7, 0x00, 0x03, 0xE7, 0x9D, 0xE7, 0x00, 0x03, 0xC7, 0xBD, 0xEF, 0x00, 0x07,
+    0xC3, 0xFC, 0xFF, 0x00, 0x07, 0x81, 0xF8, 0x7E, 0x00, 0x00, 0x0E, 0x1F, 0x3E, 0x7C, 0x7C, 0xF8,
+    0x7C, 0x7C, 0x3E, 0x1F, 0x0E, 0x08, 0x10, 0x78, 0x78, 0x7C, 0x3E, 0x3E, 0x1F, 0x3E, 0x3E, 0x7C,
+    0x78, 0x78, 0x10, 0x00, 0x78, 0x00, 0x78, 0x00, 0xF8, 0x00, 0xF0, 0x01, 0xF0, 0x01, 0xE0, 0x03,
+    0xC0, 0x03, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x3C,
+    0x00, 0x3C, 0x00, 0x78, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0xF7, 0x80, 0xF3, 0x80, 0xE3,
+    0x80, 0xE3, 0x80, 0xF3, 0x80, 0xF7, 0x80, 0x7F, 0x00, 0x3E, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x1F,
+    0x00, 0x3F, 0x00, 0x77, 0x00, 0x77, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x07, 0x00, 0x07, 0x00, 0x7F,
+    0x00, 0x7F, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x0F, 0x00, 0x47, 0x00, 0x7F,
+    0x00, 0xFE, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x78, 0x00, 0x7F, 0x00, 0xFF, 0x00, 0xF7,
+    0x80, 0x77, 0x80, 0x7F, 0x00, 0x3E, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x1E,
+    0x00, 0x1E, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0xF7,
+    0x80, 0x77, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0xF7, 0x80, 0xF7, 0x80, 0xFF, 0x80, 0x7F, 0x00, 0x3E,
+    0x00, 0x7F, 0x00, 0xF7, 0x00, 0xF7, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x07, 0x00, 0x1F, 0x00, 0x7E,
+    0x00, 0x7C, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0xF7, 0x80, 0xF3, 0x80, 0xE3, 0x80, 0xE3, 0x80, 0xF3,
+    0x80, 0xF7, 0x80, 0x7F, 0x00, 0x3E, 0x00, 0x1E, 0x7E, 0x7E, 0x7E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+    0x0E, 0x7E, 0x00, 0xFF, 0x00, 0x6F, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x78,
+    0x00, 0x7F, 0x00, 0xFF, 0x00, 0x7E, 0xFF, 0x6F, 0x0F, 0x3E, 0x3F, 0x0F, 0x47, 0xFF, 0xFE, 0x0F,
+    0x00, 0x1F, 0x00, 0x1F, 0x00, 0x3F, 0x00, 0x77, 0x00, 0x77, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x07,
+    0x00, 0x07, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x0F,
+    0x00, 0x47, 0x00, 0x7F, 0x00, 0xFE, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x78, 0x00, 0x7F,
+    0x00, 0xFF, 0x00, 0xF7, 0x80, 0x77, 0x80, 0x7F, 0x00, 0x3E, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x0F,
+    0x00, 0x0F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3F,
+    0x00, 0x7F, 0x00, 0xF7, 0x80, 0x77, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0xF7, 0x80, 0xF7, 0x80, 0xFF,
+    0x80, 0x7F, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0xF7, 0x00, 0xF7, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x07,
+    0x00, 0x1F, 0x00, 0x7E, 0x00, 0x7C, 0x00, 0x07, 0xF8, 0x0F, 0xF8, 0x1F, 0xF8, 0x1F, 0x10, 0x3E,
+    0x00, 0x3C, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0x7C, 0x00, 0x7C, 0x00, 0xFF, 0xE0, 0xFF, 0xC0, 0x3C,
+    0x00, 0x3F, 0x38, 0x1F, 0xF8, 0x1F, 0xF8, 0x07, 0xF8, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x07,
+    0x80, 0x07, 0xB0, 0x07, 0xF0, 0x07, 0xF0, 0x1F, 0xE0, 0x3F, 0x80, 0x3F, 0xF0, 0x17, 0xF0, 0x07,
+    0xF0, 0x3F, 0xC0, 0x3F, 0x80, 0x1F, 0x80, 0x07, 0x80, 0x07, 0x80, 0x1F, 0xE0, 0x3F, 0xF0, 0x3F,
+    0xF0, 0x18, 0xF8, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x0F, 0xE0, 0x1F, 0x80, 0xFF, 0xFC, 0xFF,
+    0xFC, 0xFF, 0xFC, 0x7C, 0x00, 0x7E, 0x70, 0x3F, 0xF8, 0x3F, 0xF8, 0x0F, 0xF0, 0xFF, 0xFC, 0xFF,
+    0xFC, 0xFF, 0xFC, 0x07, 0xE0, 0x01, 0xE0, 0xFF, 0xF8, 0xFF, 0xF8, 0x03, 0xE0, 0x0F, 0xE0, 0xFF,
+    0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x1F,
+    0xC0, 0x3F, 0xF0, 0x1F, 0xF8, 0x19, 0xF8, 0x00, 0x7C, 0x00, 0x3C, 0x0F, 0xFC, 0x1F, 0xFC, 0x3F,
+    0xFC, 0x7E, 0x7C, 0x78, 0x3C, 0x78, 0x3C, 0x78, 0x3C, 0x78, 0x7C, 0x7C, 0xF8, 0x7F, 0xF8, 0x3F,
+    0xF0, 0x1F, 0xC0, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x07,
+    0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x7C, 0x00, 0x1F, 0x7C, 0x00, 0x1E, 0x3C, 0x00, 0x1E, 0x3E,
+    0x00, 0x3E, 0x3E, 0x00, 0x3C, 0x1F, 0x00, 0x7C, 0x1F, 0x00, 0x7C, 0x0F, 0x00, 0x7F, 0xFF, 0x80,
+    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xF0, 0x3E, 0xF0, 0x3E,
+    0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E,
+    0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3E,
+    0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x7C, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80,
+    0x0F, 0x80, 0x07, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x7C, 0x00,
+    0x7C, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x78,
+    0x00, 0x78, 0x00, 0xF8, 0x00, 0xF0, 0x01, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0x80,
+    0x07, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x78, 0x00,
+    0x78, 0x00, 0x78, 0x7C, 0xFC, 0x7C, 0x78, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x1E, 0x00,
+    0x1E, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x1C, 0x78, 0x7E, 0x78, 0x7E, 0x78, 0x7F, 0xF0, 0x7F,
+    0xF0, 0x0F, 0xF0, 0x07, 0xE0, 0x07, 0xE0, 0x03, 0xE0, 0x03, 0xC0, 0x3E, 0x7C, 0x7F, 0xFE, 0x7F,
+    0xFE, 0xF7, 0xEE, 0xF7, 0xEE, 0x7F, 0xFE, 0x7F, 0xFE, 0x3E, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x0F,
+    0xC0, 0x1F, 0xC0, 0x1F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E,
+    0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E,
+    0x00, 0x1E, 0x00, 0x3E, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x1C, 0x7F,
+    0xBC, 0x7F, 0xF8, 0xF7, 0xF8, 0x71, 0xF0, 0x00, 0x00, 0x3E, 0x1C, 0x7F, 0xBC, 0x7F, 0xF8, 0xF7,
+    0xF8, 0x71, 0xF0, 0x00, 0xC0, 0x01, 0xE0, 0x01, 0xC0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x07,
+    0x00, 0x0F, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x38, 0x00, 0x78, 0x00, 0x30, 0x00, 0x01,
+    0xF0, 0x3F, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xE0, 0xFC, 0x00, 0xFF, 0xE0, 0xFF, 0xF0, 0xFF,
+    0xF0, 0x3F, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x78, 0x00, 0xFF,
+    0xC0, 0xFF, 0xF0, 0xFF, 0xF0, 0x3F, 0xF0, 0x03, 0xF0, 0x7F, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF,
+    0xC0, 0x78, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0,
 };
 
 static const EpdGlyph ubuntu_12_boldGlyphs[] = {
@@ -1195,591 +1445,591 @@ static const EpdGlyph ubuntu_12_boldGlyphs[] = {
     { 0, 0, 6, 0, 0, 0, 0 }, // 
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 5, 17, 7, 1, 17, 11, 0 }, // !
-    { 10, 7, 12, 1, 19, 9, 11 }, // "
-    { 16, 17, 17, 1, 17, 34, 20 }, // #
-    { 14, 23, 14, 0, 20, 41, 54 }, // $
-    { 23, 17, 23, 0, 17, 49, 95 }, // %
-    { 18, 17, 18, 0, 17, 39, 144 }, // &
-    { 4, 7, 6, 1, 19, 4, 183 }, // '
-    { 8, 25, 9, 1, 20, 25, 187 }, // (
-    { 8, 25, 9, 0, 20, 25, 212 }, // )
-    { 11, 10, 13, 1, 17, 14, 237 }, // *
-    { 12, 11, 14, 1, 13, 17, 251 }, // +
-    { 6, 8, 6, 0, 4, 6, 268 }, // ,
-    { 8, 3, 9, 0, 9, 3, 274 }, // -
-    { 6, 5, 6, 0, 5, 4, 277 }, // .
-    { 13, 25, 11, -1, 20, 41, 281 }, // /
-    { 14, 17, 14, 0, 17, 30, 322 }, // 0
-    { 10, 17, 14, 1, 17, 22, 352 }, // 1
-    { 13, 17, 14, 0, 17, 28, 374 }, // 2
-    { 13, 17, 14, 0, 17, 28, 402 }, // 3
-    { 14, 17, 14, 0, 17, 30, 430 }, // 4
-    { 13, 17, 14, 0, 17, 28, 460 }, // 5
-    { 14, 17, 14, 0, 17, 30, 488 }, // 6
-    { 13, 17, 14, 1, 17, 28, 518 }, // 7
-    { 14, 17, 14, 0, 17, 30, 546 }, // 8
-    { 14, 17, 14, 0, 17, 30, 576 }, // 9
-    { 6, 14, 6, 0, 14, 11, 606 }, // :
-    { 6, 18, 6, 0, 14, 14, 617 }, // ;
-    { 12, 13, 14, 1, 14, 20, 631 }, // <
-    { 12, 8, 14, 1, 12, 12, 651 }, // =
-    { 12, 13, 14, 1, 14, 20, 663 }, // >
-    { 11, 19, 11, 0, 19, 27, 683 }, // ?
-    { 23, 22, 24, 1, 18, 64, 710 }, // @
-    { 18, 17, 18, 0, 17, 39, 774 }, // A
-    { 14, 17, 17, 2, 17, 30, 813 }, // B
-    { 15, 17, 16, 1, 17, 32, 843 }, // C
-    { 16, 17, 18, 2, 17, 34, 875 }, // D
-    { 13, 17, 15, 2, 17, 28, 909 }, // E
-    { 12, 17, 14, 2, 17, 26, 937 }, // F
-    { 15, 17, 18, 1, 17, 32, 963 }, // G
-    { 15, 17, 18, 2, 17, 32, 995 }, // H
-    { 4, 17, 8, 2, 17, 9, 1027 }, // I
-    { 12, 17, 13, 0, 17, 26, 1036 }, // J
-    { 15, 17, 17, 2, 17, 32, 1062 }, // K
-    { 12, 17, 14, 2, 17, 26, 1094 }, // L
-    { 20, 17, 22, 1, 17, 43, 1120 }, // M
-    { 15, 17, 19, 2, 17, 32, 1163 }, // N
-    { 18, 17, 20, 1, 17, 39, 1195 }, // O
-    { 14, 17, 16, 2, 17, 30, 1234 }, // P
-    { 18, 22, 20, 1, 17, 50, 1264 }, // Q
-    { 15, 17, 17, 2, 17, 32, 1314 }, // R
-    { 14, 17, 15, 0, 17, 30, 1346 }, // S
-    { 15, 17, 15, 0, 17, 32, 1376 }, // T
-    { 15, 17, 18, 1, 17, 32, 1408 }, // U
-    { 18, 17, 18, 0, 17, 39, 1440 }, // V
-    { 24, 17, 24, 0, 17, 51, 1479 }, // W
-    { 17, 17, 17, 0, 17, 37, 1530 }, // X
-    { 17, 17, 17, 0, 17, 37, 1567 }, // Y
-    { 15, 17, 15, 0, 17, 32, 1604 }, // Z
-    { 8, 25, 9, 2, 20, 25, 1636 }, // [
-    { 13, 25, 11, -1, 20, 41, 1661 }, // <backslash>
-    { 8, 25, 9, 0, 20, 25, 1702 }, // ]
-    { 14, 10, 14, 0, 17, 18, 1727 }, // ^
-    { 13, 3, 13, 0, -2, 5, 1745 }, // _
-    { 7, 6, 7, 0, 20, 6, 1750 }, // `
-    { 13, 13, 14, 0, 13, 22, 1756 }, // a
-    { 13, 19, 15, 1, 19, 31, 1778 }, // b
-    { 11, 13, 13, 1, 13, 18, 1809 }, // c
-    { 13, 19, 15, 1, 19, 31, 1827 }, // d
-    { 13, 13, 15, 1, 13, 22, 1858 }, // e
-    { 10, 19, 11, 1, 19, 24, 1880 }, // f
-    { 13, 18, 15, 1, 13, 30, 1904 }, // g
-    { 13, 19, 15, 1, 19, 31, 1934 }, // h
-    { 5, 19, 7, 1, 19, 12, 1965 }, // i
-    { 8, 24, 7, -2, 19, 24, 1977 }, // j
-    { 14, 19, 14, 1, 19, 34, 2001 }, // k
-    { 7, 19, 8, 1, 19, 17, 2035 }, // l
-    { 19, 13, 22, 1, 13, 31, 2052 }, // m
-    { 13, 13, 15, 1, 13, 22, 2083 }, // n
-    { 14, 13, 15, 1, 13, 23, 2105 }, // o
-    { 13, 18, 15, 1, 13, 30, 2128 }, // p
-    { 13, 18, 15, 1, 13, 30, 2158 }, // q
-    { 10, 13, 11, 1, 13, 17, 2188 }, // r
-    { 12, 13, 12, 0, 13, 20, 2205 }, // s
-    { 10, 17, 11, 1, 17, 22, 2225 }, // t
-    { 12, 13, 15, 1, 13, 20, 2247 }, // u
-    { 14, 13, 14, 0, 13, 23, 2267 }, // v
-    { 20, 13, 20, 0, 13, 33, 2290 }, // w
-    { 14, 13, 14, 0, 13, 23, 2323 }, // x
-    { 14, 18, 14, 0, 13, 32, 2346 }, // y
-    { 12, 13, 13, 0, 13, 20, 2378 }, // z
-    { 10, 25, 9, 0, 20, 32, 2398 }, // {
-    { 4, 25, 8, 2, 20, 13, 2430 }, // |
-    { 9, 25, 9, 0, 20, 29, 2443 }, // }
-    { 14, 5, 14, 0, 10, 9, 2472 }, // ~
-    { 0, 0, 6, 0, 0, 0, 2481 }, //  
-    { 5, 18, 7, 1, 13, 12, 2481 }, // ¡
-    { 11, 18, 14, 1, 16, 25, 2493 }, // ¢
-    { 13, 17, 14, 0, 17, 28, 2518 }, // £
-    { 14, 13, 14, 0, 16, 23, 2546 }, // ¤
-    { 16, 17, 14, -1, 17, 34, 2569 }, // ¥
-    { 4, 25, 8, 2, 20, 13, 2603 }, // ¦
-    { 13, 22, 13, 0, 17, 36, 2616 }, // §
-    { 11, 4, 13, 1, 19, 6, 2652 }, // ¨
-    { 18, 18, 20, 1, 18, 41, 2658 }, // ©
-    { 10, 10, 10, 0, 18, 13, 2699 }, // ª
-    { 15, 13, 15, 0, 14, 25, 2712 }, // «
-    { 12, 9, 14, 1, 10, 14, 2737 }, // ¬
-    { 8, 3, 9, 0, 9, 3, 2751 }, // ­
-    { 18, 18, 20, 1, 18, 41, 2754 }, // ®
-    { 9, 3, 9, 0, 19, 4, 2795 }, // ¯
-    { 9, 7, 9, 0, 19, 8, 2799 }, // °
-    { 12, 15, 14, 1, 15, 23, 2807 }, // ±
-    { 9, 10, 9, 0, 18, 12, 2830 }, // ²
-    { 8, 10, 9, 0, 18, 10, 2842 }, // ³
-    { 7, 6, 7, 0, 20, 6, 2852 }, // ´
-    { 13, 18, 15, 1, 13, 30, 2858 }, // µ
-    { 15, 23, 18, 1, 18, 44, 2888 }, // ¶
-    { 6, 5, 6, 0, 10, 4, 2932 }, // ·
-    { 6, 7, 8, 1, 1, 6, 2936 }, // ¸
-    { 7, 10, 9, 0, 18, 9, 2942 }, // ¹
-    { 11, 10, 11, 0, 18, 14, 2951 }, // º
-    { 15, 13, 15, 0, 14, 25, 2965 }, // »
-    { 22, 18, 22, 0, 18, 50, 2990 }, // ¼
-    { 21, 18, 22, 0, 18, 48, 3040 }, // ½
-    { 22, 18, 22, 0, 18, 50, 3088 }, // ¾
-    { 11, 18, 11, 0, 13, 25, 3138 }, // ¿
-    { 18, 24, 18, 0, 24, 54, 3163 }, // À
-    { 18, 24, 18, 0, 24, 54, 3217 }, // Á
-    { 18, 23, 18, 0, 23, 52, 3271 }, // Â
-    { 18, 23, 18, 0, 23, 52, 3323 }, // Ã
-    { 18, 23, 18, 0, 23, 52, 3375 }, // Ä
-    { 18, 22, 18, 0, 22, 50, 3427 }, // Å
-    { 24, 17, 25, 0, 17, 51, 3477 }, // Æ
-    { 15, 22, 16, 1, 17, 42, 3528 }, // Ç
-    { 13, 24, 15, 2, 24, 39, 3570 }, // È
-    { 13, 24, 15, 2, 24, 39, 3609 }, // É
-    { 13, 23, 15, 2, 23, 38, 3648 }, // Ê
-    { 13, 23, 15, 2, 23, 38, 3686 }, // Ë
-    { 7, 24, 8, 0, 24, 21, 3724 }, // Ì
-    { 7, 24, 8, 1, 24, 21, 3745 }, // Í
-    { 8, 23, 8, 0, 23, 23, 3766 }, // Î
-    { 10, 23, 8, -1, 23, 29, 3789 }, // Ï
-    { 18, 17, 19, 0, 17, 39, 3818 }, // Ð
-    { 15, 23, 19, 2, 23, 44, 3857 }, // Ñ
-    { 18, 24, 20, 1, 24, 54, 3901 }, // Ò
-    { 18, 24, 20, 1, 24, 54, 3955 }, // Ó
-    { 18, 23, 20, 1, 23, 52, 4009 }, // Ô
-    { 18, 23, 20, 1, 23, 52, 4061 }, // Õ
-    { 18, 23, 20, 1, 23, 52, 4113 }, // Ö
-    { 12, 11, 14, 1, 13, 17, 4165 }, // ×
-    { 18, 19, 20, 1, 18, 43, 4182 }, // Ø
-    { 15, 24, 18, 1, 24, 45, 4225 }, // Ù
-    { 15, 24, 18, 1, 24, 45, 4270 }, // Ú
-    { 15, 23, 18, 1, 23, 44, 4315 }, // Û
-    { 15, 23, 18, 1, 23, 44, 4359 }, // Ü
-    { 17, 24, 17, 0, 24, 51, 4403 }, // Ý
-    { 14, 17, 16, 2, 17, 30, 4454 }, // Þ
-    { 15, 19, 16, 1, 19, 36, 4484 }, // ß
-    { 13, 20, 14, 0, 20, 33, 4520 }, // à
-    { 13, 20, 14, 0, 20, 33, 4553 }, // á
-    { 13, 19, 14, 0, 19, 31, 4586 }, // â
-    { 13, 19, 14, 0, 19, 31, 4617 }, // ã
-    { 13, 19, 14, 0, 19, 31, 4648 }, // ä
-    { 13, 20, 14, 0, 20, 33, 4679 }, // å
-    { 21, 13, 22, 0, 13, 35, 4712 }, // æ
-    { 11, 18, 13, 1, 13, 25, 4747 }, // ç
-    { 13, 20, 15, 1, 20, 33, 4772 }, // è
-    { 13, 20, 15, 1, 20, 33, 4805 }, // é
-    { 13, 19, 15, 1, 19, 31, 4838 }, // ê
-    { 13, 19, 15, 1, 19, 31, 4869 }, // ë
-    { 7, 20, 7, 0, 20, 18, 4900 }, // ì
-    { 6, 20, 7, 1, 20, 15, 4918 }, // í
-    { 9, 19, 7, -1, 19, 22, 4933 }, // î
-    { 11, 19, 7, -2, 19, 27, 4955 }, // ï
-    { 14, 19, 15, 1, 19, 34, 4982 }, // ð
-    { 13, 19, 15, 1, 19, 31, 5016 }, // ñ
-    { 14, 20, 15, 1, 20, 35, 5047 }, // ò
-    { 14, 20, 15, 1, 20, 35, 5082 }, // ó
-    { 14, 19, 15, 1, 19, 34, 5117 }, // ô
-    { 14, 19, 15, 1, 19, 34, 5151 }, // õ
-    { 14, 19, 15, 1, 19, 34, 5185 }, // ö
-    { 12, 13, 14, 1, 13, 20, 5219 }, // ÷
-    { 14, 15, 15, 1, 14, 27, 5239 }, // ø
-    { 12, 20, 15, 1, 20, 30, 5266 }, // ù
-    { 12, 20, 15, 1, 20, 30, 5296 }, // ú
-    { 12, 19, 15, 1, 19, 29, 5326 }, // û
-    { 12, 19, 15, 1, 19, 29, 5355 }, // ü
-    { 14, 25, 14, 0, 20, 44, 5384 }, // ý
-    { 13, 24, 15, 1, 19, 39, 5428 }, // þ
-    { 14, 24, 14, 0, 19, 42, 5467 }, // ÿ
-    { 18, 23, 18, 0, 23, 52, 5509 }, // Ā
-    { 13, 19, 14, 0, 19, 31, 5561 }, // ā
-    { 18, 23, 18, 0, 23, 52, 5592 }, // Ă
-    { 13, 19, 14, 0, 19, 31, 5644 }, // ă
-    { 19, 23, 18, 0, 17, 55, 5675 }, // Ą
-    { 13, 19, 14, 0, 13, 31, 5730 }, // ą
-    { 15, 24, 16, 1, 24, 45, 5761 }, // Ć
-    { 11, 20, 13, 1, 20, 28, 5806 }, // ć
-    { 15, 23, 16, 1, 23, 44, 5834 }, // Ĉ
-    { 11, 19, 13, 1, 19, 27, 5878 }, // ĉ
-    { 15, 23, 16, 1, 23, 44, 5905 }, // Ċ
-    { 11, 19, 13, 1, 19, 27, 5949 }, // ċ
-    { 15, 24, 16, 1, 24, 45, 5976 }, // Č
-    { 11, 20, 13, 1, 20, 28, 6021 }, // č
-    { 16, 24, 18, 2, 24, 48, 6049 }, // Ď
-    { 18, 19, 17, 1, 19, 43, 6097 }, // ď
-    { 18, 17, 19, 0, 17, 39, 6140 }, // Đ
-    { 14, 19, 15, 1, 19, 34, 6179 }, // đ
-    { 13, 23, 15, 2, 23, 38, 6213 }, // Ē
-    { 13, 19, 15, 1, 19, 31, 6251 }, // ē
-    { 13, 23, 15, 2, 23, 38, 6282 }, // Ĕ
-    { 13, 19, 15, 1, 19, 31, 6320 }, // ĕ
-    { 13, 23, 15, 2, 23, 38, 6351 }, // Ė
-    { 13, 19, 15, 1, 19, 31, 6389 }, // ė
-    { 13, 23, 15, 2, 17, 38, 6420 }, // Ę
-    { 13, 18, 15, 1, 13, 30, 6458 }, // ę
-    { 13, 24, 15, 2, 24, 39, 6488 }, // Ě
-    { 13, 20, 15, 1, 20, 33, 6527 }, // ě
-    { 15, 23, 18, 1, 23, 44, 6560 }, // Ĝ
-    { 13, 24, 15, 1, 19, 39, 6604 }, // ĝ
-    { 15, 23, 18, 1, 23, 44, 6643 }, // Ğ
-    { 13, 24, 15, 1, 19, 39, 6687 }, // ğ
-    { 15, 23, 18, 1, 23, 44, 6726 }, // Ġ
-    { 13, 24, 15, 1, 19, 39, 6770 }, // ġ
-    { 15, 22, 18, 1, 17, 42, 6809 }, // Ģ
-    { 13, 25, 15, 1, 20, 41, 6851 }, // ģ
-    { 15, 23, 18, 2, 23, 44, 6892 }, // Ĥ
-    { 13, 25, 15, 1, 25, 41, 6936 }, // ĥ
-    { 19, 17, 19, 0, 17, 41, 6977 }, // Ħ
-    { 14, 19, 15, 0, 19, 34, 7018 }, // ħ
-    { 10, 23, 8, -1, 23, 29, 7052 }, // Ĩ
-    { 10, 19, 7, -1, 19, 24, 7081 }, // ĩ
-    { 10, 23, 8, -1, 23, 29, 7105 }, // Ī
-    { 9, 19, 7, -1, 19, 22, 7134 }, // ī
-    { 9, 23, 8, 0, 23, 26, 7156 }, // Ĭ
-    { 9, 19, 7, -1, 19, 22, 7182 }, // ĭ
-    { 7, 23, 8, 0, 17, 21, 7204 }, // Į
-    { 6, 25, 7, 0, 19, 19, 7225 }, // į
-    { 5, 23, 8, 1, 23, 15, 7244 }, // İ
-    { 5, 13, 7, 1, 13, 9, 7259 }, // ı
-    { 18, 17, 21, 2, 17, 39, 7268 }, // Ĳ
-    { 12, 24, 14, 1, 19, 36, 7307 }, // ĳ
-    { 14, 23, 13, 0, 23, 41, 7343 }, // Ĵ
-    { 10, 24, 7, -2, 19, 30, 7384 }, // ĵ
-    { 15, 22, 17, 2, 17, 42, 7414 }, // Ķ
-    { 14, 24, 14, 1, 19, 42, 7456 }, // ķ
-    { 14, 13, 15, 1, 13, 23, 7498 }, // ĸ
-    { 13, 24, 14, 1, 24, 39, 7521 }, // Ĺ
-    { 7, 24, 8, 1, 24, 21, 7560 }, // ĺ
-    { 12, 22, 14, 2, 17, 33, 7581 }, // Ļ
-    { 7, 24, 8, 1, 19, 21, 7614 }, // ļ
-    { 12, 17, 14, 2, 17, 26, 7635 }, // Ľ
-    { 10, 19, 9, 1, 19, 24, 7661 }, // ľ
-    { 12, 17, 14, 2, 17, 26, 7685 }, // Ŀ
-    { 12, 19, 13, 1, 19, 29, 7711 }, // ŀ
-    { 15, 17, 15, 0, 17, 32, 7740 }, // Ł
-    { 11, 19, 9, -1, 19, 27, 7772 }, // ł
-    { 15, 24, 19, 2, 24, 45, 7799 }, // Ń
-    { 13, 20, 15, 1, 20, 33, 7844 }, // ń
-    { 15, 22, 19, 2, 17, 42, 7877 }, // Ņ
-    { 13, 18, 15, 1, 13, 30, 7919 }, // ņ
-    { 15, 24, 19, 2, 24, 45, 7949 }, // Ň
-    { 13, 20, 15, 1, 20, 33, 7994 }, // ň
-    { 15, 19, 15, -1, 19, 36, 8027 }, // ŉ
-    { 15, 22, 19, 2, 17, 42, 8063 }, // Ŋ
-    { 13, 18, 15, 1, 13, 30, 8105 }, // ŋ
-    { 18, 23, 20, 1, 23, 52, 8135 }, // Ō
-    { 14, 19, 15, 1, 19, 34, 8187 }, // ō
-    { 18, 23, 20, 1, 23, 52, 8221 }, // Ŏ
-    { 14, 19, 15, 1, 19, 34, 8273 }, // ŏ
-    { 18, 24, 20, 1, 24, 54, 8307 }, // Ő
-    { 14, 20, 15, 1, 20, 35, 8361 }, // ő
-    { 24, 17, 25, 1, 17, 51, 8396 }, // Œ
-    { 22, 13, 23, 1, 13, 36, 8447 }, // œ
-    { 15, 24, 17, 2, 24, 45, 8483 }, // Ŕ
-    { 10, 20, 11, 1, 20, 25, 8528 }, // ŕ
-    { 15, 22, 17, 2, 17, 42, 8553 }, // Ŗ
-    { 11, 18, 11, 0, 13, 25, 8595 }, // ŗ
-    { 15, 24, 17, 2, 24, 45, 8620 }, // Ř
-    { 10, 20, 11, 1, 20, 25, 8665 }, // ř
-    { 14, 24, 15, 0, 24, 42, 8690 }, // Ś
-    { 12, 20, 12, 0, 20, 30, 8732 }, // ś
-    { 14, 23, 15, 0, 23, 41, 8762 }, // Ŝ
-    { 12, 19, 12, 0, 19, 29, 8803 }, // ŝ
-    { 14, 22, 15, 0, 17, 39, 8832 }, // Ş
-    { 12, 18, 12, 0, 13, 27, 8871 }, // ş
-    { 14, 24, 15, 0, 24, 42, 8898 }, // Š
-    { 12, 20, 12, 0, 20, 30, 8940 }, // š
-    { 15, 23, 15, 0, 17, 44, 8970 }, // Ţ
-    { 10, 22, 11, 1, 17, 28, 9014 }, // ţ
-    { 15, 24, 15, 0, 24, 45, 9042 }, // Ť
-    { 10, 19, 11, 1, 19, 24, 9087 }, // ť
-    { 15, 17, 15, 0, 17, 32, 9111 }, // Ŧ
-    { 10, 17, 11, 1, 17, 22, 9143 }, // ŧ
-    { 15, 23, 18, 1, 23, 44, 9165 }, // Ũ
-    { 12, 19, 15, 1, 19, 29, 9209 }, // ũ
-    { 15, 23, 18, 1, 23, 44, 9238 }, // Ū
-    { 12, 19, 15, 1, 19, 29, 9282 }, // ū
-    { 15, 23, 18, 1, 23, 44, 9311 }, // Ŭ
-    { 12, 19, 15, 1, 19, 29, 9355 }, // ŭ
-    { 15, 23, 18, 1, 23, 44, 9384 }, // Ů
-    { 12, 20, 15, 1, 20, 30, 9428 }, // ů
-    { 15, 24, 18, 1, 24, 45, 9458 }, // Ű
-    { 13, 20, 15, 1, 20, 33, 9503 }, // ű
-    { 15, 22, 18, 1, 17, 42, 9536 }, // Ų
-    { 13, 18, 15, 1, 13, 30, 9578 }, // ų
-    { 24, 23, 24, 0, 23, 69, 9608 }, // Ŵ
-    { 20, 19, 20, 0, 19, 48, 9677 }, // ŵ
-    { 17, 23, 17, 0, 23, 49, 9725 }, // Ŷ
-    { 14, 24, 14, 0, 19, 42, 9774 }, // ŷ
-    { 17, 23, 17, 0, 23, 49, 9816 }, // Ÿ
-    { 15, 24, 15, 0, 24, 45, 9865 }, // Ź
-    { 12, 20, 13, 0, 20, 30, 9910 }, // ź
-    { 15, 23, 15, 0, 23, 44, 9940 }, // Ż
-    { 12, 19, 13, 0, 19, 29, 9984 }, // ż
-    { 15, 24, 15, 0, 24, 45, 10013 }, // Ž
-    { 12, 20, 13, 0, 20, 30, 10058 }, // ž
-    { 10, 19, 8, 1, 19, 24, 10088 }, // ſ
-    { 9, 4, 10, 0, 19, 5, 10112 }, // ̑
-    { 13, 24, 15, 2, 24, 39, 10117 }, // Ѐ
-    { 13, 23, 15, 2, 23, 38, 10156 }, // Ё
-    { 20, 17, 20, 0, 17, 43, 10194 }, // Ђ
-    { 12, 24, 15, 2, 24, 36, 10237 }, // Ѓ
-    { 16, 17, 17, 1, 17, 34, 10273 }, // Є
-    { 14, 17, 15, 0, 17, 30, 10307 }, // Ѕ
-    { 4, 17, 8, 2, 17, 9, 10337 }, // І
-    { 10, 23, 8, -1, 23, 29, 10346 }, // Ї
-    { 12, 17, 13, 0, 17, 26, 10375 }, // Ј
-    { 28, 17, 28, 0, 17, 60, 10401 }, // Љ
-    { 24, 17, 27, 2, 17, 51, 10461 }, // Њ
-    { 19, 17, 19, 0, 17, 41, 10512 }, // Ћ
-    { 15, 24, 17, 2, 24, 45, 10553 }, // Ќ
-    { 15, 24, 19, 2, 24, 45, 10598 }, // Ѝ
-    { 17, 24, 16, 0, 24, 51, 10643 }, // Ў
-    { 15, 22, 18, 2, 17, 42, 10694 }, // Џ
-    { 18, 17, 18, 0, 17, 39, 10736 }, // А
-    { 14, 17, 16, 2, 17, 30, 10775 }, // Б
-    { 14, 17, 17, 2, 17, 30, 10805 }, // В
-    { 12, 17, 15, 2, 17, 26, 10835 }, // Г
-    { 21, 22, 21, 0, 17, 58, 10861 }, // Д
-    { 13, 17, 15, 2, 17, 28, 10919 }, // Е
-    { 25, 17, 25, 0, 17, 54, 10947 }, // Ж
-    { 15, 17, 15, 0, 17, 32, 11001 }, // З
-    { 15, 17, 19, 2, 17, 32, 11033 }, // И
-    { 15, 24, 19, 2, 24, 45, 11065 }, // Й
-    { 15, 17, 17, 2, 17, 32, 11110 }, // К
-    { 18, 17, 20, 0, 17, 39, 11142 }, // Л
-    { 20, 17, 22, 1, 17, 43, 11181 }, // М
-    { 15, 17, 18, 2, 17, 32, 11224 }, // Н
-    { 18, 17, 20, 1, 17, 39, 11256 }, // О
-    { 15, 17, 18, 2, 17, 32, 11295 }, // П
-    { 14, 17, 16, 2, 17, 30, 11327 }, // Р
-    { 15, 17, 16, 1, 17, 32, 11357 }, // С
-    { 15, 17, 15, 0, 17, 32, 11389 }, // Т
-    { 17, 17, 16, 0, 17, 37, 11421 }, // У
-    { 20, 18, 22, 1, 18, 45, 11458 }, // Ф
-    { 17, 17, 17, 0, 17, 37, 11503 }, // Х
-    { 18, 22, 20, 2, 17, 50, 11540 }, // Ц
-    { 14, 17, 17, 1, 17, 30, 11590 }, // Ч
-    { 22, 17, 26, 2, 17, 47, 11620 }, // Ш
-    { 25, 22, 27, 2, 17, 69, 11667 }, // Щ
-    { 19, 17, 19, 0, 17, 41, 11736 }, // Ъ
-    { 20, 17, 23, 2, 17, 43, 11777 }, // Ы
-    { 14, 17, 16, 2, 17, 30, 11820 }, // Ь
-    { 15, 17, 17, 1, 17, 32, 11850 }, // Э
-    { 24, 17, 27, 2, 17, 51, 11882 }, // Ю
-    { 15, 17, 17, 1, 17, 32, 11933 }, // Я
-    { 13, 13, 14, 0, 13, 22, 11965 }, // а
-    { 13, 19, 15, 1, 19, 31, 11987 }, // б
-    { 13, 13, 15, 1, 13, 22, 12018 }, // в
-    { 11, 13, 11, 1, 13, 18, 12040 }, // г
-    { 17, 17, 17, 0, 13, 37, 12058 }, // д
-    { 13, 13, 15, 1, 13, 22, 12095 }, // е
-    { 21, 13, 21, 0, 13, 35, 12117 }, // ж
-    { 12, 13, 12, 0, 13, 20, 12152 }, // з
-    { 13, 13, 15, 1, 13, 22, 12172 }, // и
-    { 13, 20, 15, 1, 20, 33, 12194 }, // й
-    { 14, 13, 15, 1, 13, 23, 12227 }, // к
-    { 14, 13, 16, 0, 13, 23, 12250 }, // л
-    { 17, 13, 19, 1, 13, 28, 12273 }, // м
-    { 13, 13, 15, 1, 13, 22, 12301 }, // н
-    { 14, 13, 15, 1, 13, 23, 12323 }, // о
-    { 13, 13, 15, 1, 13, 22, 12346 }, // п
-    { 13, 18, 15, 1, 13, 30, 12368 }, // р
-    { 11, 13, 13, 1, 13, 18, 12398 }, // с
-    { 13, 13, 13, 0, 13, 22, 12416 }, // т
-    { 14, 18, 14, 0, 13, 32, 12438 }, // у
-    { 18, 24, 20, 1, 19, 54, 12470 }, // ф
-    { 14, 13, 14, 0, 13, 23, 12524 }, // х
-    { 15, 17, 16, 1, 13, 32, 12547 }, // ц
-    { 12, 13, 14, 1, 13, 20, 12579 }, // ч
-    { 19, 13, 22, 1, 13, 31, 12599 }, // ш
-    { 21, 17, 22, 1, 13, 45, 12630 }, // щ
-    { 16, 13, 16, 0, 13, 26, 12675 }, // ъ
-    { 18, 13, 21, 1, 13, 30, 12701 }, // ы
-    { 13, 13, 14, 1, 13, 22, 12731 }, // ь
-    { 13, 13, 13, 0, 13, 22, 12753 }, // э
-    { 20, 13, 22, 1, 13, 33, 12775 }, // ю
-    { 13, 13, 15, 0, 13, 22, 12808 }, // я
-    { 13, 20, 15, 1, 20, 33, 12830 }, // ѐ
-    { 13, 19, 15, 1, 19, 31, 12863 }, // ё
-    { 14, 24, 15, 0, 19, 42, 12894 }, // ђ
-    { 11, 20, 11, 1, 20, 28, 12936 }, // ѓ
-    { 13, 13, 13, 0, 13, 22, 12964 }, // є
-    { 12, 13, 12, 0, 13, 20, 12986 }, // ѕ
-    { 5, 19, 7, 1, 19, 12, 13006 }, // і
-    { 11, 19, 7, -2, 19, 27, 13018 }, // ї
-    { 8, 24, 7, -2, 19, 24, 13045 }, // ј
-    { 22, 13, 23, 0, 13, 36, 13069 }, // љ
-    { 20, 13, 22, 1, 13, 33, 13105 }, // њ
-    { 14, 19, 15, 0, 19, 34, 13138 }, // ћ
-    { 14, 20, 15, 1, 20, 35, 13172 }, // ќ
-    { 13, 20, 15, 1, 20, 33, 13207 }, // ѝ
-    { 14, 25, 14, 0, 20, 44, 13240 }, // ў
-    { 13, 17, 15, 1, 13, 28, 13284 }, // џ
-    { 18, 19, 19, 0, 19, 43, 13312 }, // Ѣ
-    { 15, 19, 16, 0, 19, 36, 13355 }, // ѣ
-    { 18, 17, 20, 1, 17, 39, 13391 }, // Ѳ
-    { 14, 13, 15, 1, 13, 23, 13430 }, // ѳ
-    { 21, 17, 20, 0, 17, 45, 13453 }, // Ѵ
-    { 16, 13, 15, 0, 13, 26, 13498 }, // ѵ
-    { 18, 29, 21, 2, 24, 66, 13524 }, // Ҋ
-    { 15, 24, 16, 1, 20, 45, 13590 }, // ҋ
-    { 16, 17, 17, 0, 17, 34, 13635 }, // Ҍ
-    { 14, 14, 14, 0, 14, 25, 13669 }, // ҍ
-    { 14, 17, 16, 2, 17, 30, 13694 }, // Ҏ
-    { 14, 18, 15, 1, 13, 32, 13724 }, // ҏ
-    { 12, 20, 14, 2, 20, 30, 13756 }, // Ґ
-    { 11, 16, 12, 1, 16, 22, 13786 }, // ґ
-    { 15, 17, 16, 1, 17, 32, 13808 }, // Ғ
-    { 12, 13, 13, 1, 13, 20, 13840 }, // ғ
-    { 14, 22, 17, 2, 17, 39, 13860 }, // Ҕ
-    { 13, 18, 14, 1, 13, 30, 13899 }, // ҕ
-    { 26, 21, 26, 0, 17, 69, 13929 }, // Җ
-    { 22, 17, 22, 0, 13, 47, 13998 }, // җ
-    { 15, 22, 15, 0, 17, 42, 14045 }, // Ҙ
-    { 12, 18, 12, 0, 13, 27, 14087 }, // ҙ
-    { 16, 22, 18, 2, 17, 44, 14114 }, // Қ
-    { 14, 17, 15, 1, 13, 30, 14158 }, // қ
-    { 18, 17, 20, 2, 17, 39, 14188 }, // Ҝ
-    { 16, 13, 17, 1, 13, 26, 14227 }, // ҝ
-    { 18, 18, 18, 0, 18, 41, 14253 }, // Ҟ
-    { 15, 14, 15, 0, 14, 27, 14294 }, // ҟ
-    { 20, 17, 20, 0, 17, 43, 14321 }, // Ҡ
-    { 17, 13, 16, 0, 13, 28, 14364 }, // ҡ
-    { 18, 22, 20, 2, 17, 50, 14392 }, // Ң
-    { 15, 17, 16, 1, 13, 32, 14442 }, // ң
-    { 19, 17, 21, 2, 17, 41, 14474 }, // Ҥ
-    { 16, 13, 16, 1, 13, 26, 14515 }, // ҥ
-    { 25, 22, 28, 2, 17, 69, 14541 }, // Ҧ
-    { 20, 18, 22, 1, 13, 45, 14610 }, // ҧ
-    { 19, 21, 20, 1, 17, 50, 14655 }, // Ҩ
-    { 15, 17, 16, 1, 13, 32, 14705 }, // ҩ
-    { 15, 22, 16, 1, 17, 42, 14737 }, // Ҫ
-    { 11, 18, 13, 1, 13, 25, 14779 }, // ҫ
-    { 15, 22, 15, 0, 17, 42, 14804 }, // Ҭ
-    { 13, 17, 13, 0, 13, 28, 14846 }, // ҭ
-    { 17, 17, 17, 0, 17, 37, 14874 }, // Ү
-    { 14, 18, 14, 0, 13, 32, 14911 }, // ү
-    { 17, 17, 17, 0, 17, 37, 14943 }, // Ұ
-    { 14, 18, 14, 0, 13, 32, 14980 }, // ұ
-    { 18, 22, 18, 0, 17, 50, 15012 }, // Ҳ
-    { 15, 17, 15, 0, 13, 32, 15062 }, // ҳ
-    { 23, 22, 23, 0, 17, 64, 15094 }, // Ҵ
-    { 17, 17, 17, 0, 13, 37, 15158 }, // ҵ
-    { 17, 22, 18, 1, 17, 47, 15195 }, // Ҷ
-    { 15, 17, 15, 0, 13, 32, 15242 }, // ҷ
-    { 14, 17, 17, 1, 17, 30, 15274 }, // Ҹ
-    { 13, 13, 14, 0, 13, 22, 15304 }, // ҹ
-    { 14, 17, 18, 2, 17, 30, 15326 }, // Һ
-    { 13, 19, 15, 1, 19, 31, 15356 }, // һ
-    { 21, 17, 22, 0, 17, 45, 15387 }, // Ҽ
-    { 17, 13, 18, 0, 13, 28, 15432 }, // ҽ
-    { 21, 21, 22, 0, 17, 56, 15460 }, // Ҿ
-    { 17, 16, 18, 0, 13, 34, 15516 }, // ҿ
-    { 4, 17, 8, 2, 17, 9, 15550 }, // Ӏ
-    { 25, 24, 25, 0, 24, 75, 15559 }, // Ӂ
-    { 21, 20, 21, 0, 20, 53, 15634 }, // ӂ
-    { 15, 22, 18, 2, 17, 42, 15687 }, // Ӄ
-    { 13, 18, 14, 1, 13, 30, 15729 }, // ӄ
-    { 21, 22, 21, 0, 17, 58, 15759 }, // Ӆ
-    { 17, 17, 17, 0, 13, 37, 15817 }, // ӆ
-    { 15, 22, 18, 2, 17, 42, 15854 }, // Ӈ
-    { 13, 18, 15, 1, 13, 30, 15896 }, // ӈ
-    { 18, 22, 20, 2, 17, 50, 15926 }, // Ӊ
-    { 15, 17, 16, 1, 13, 32, 15976 }, // ӊ
-    { 14, 22, 17, 1, 17, 39, 16008 }, // Ӌ
-    { 12, 17, 14, 1, 13, 26, 16047 }, // ӌ
-    { 23, 22, 24, 1, 17, 64, 16073 }, // Ӎ
-    { 19, 17, 20, 1, 13, 41, 16137 }, // ӎ
-    { 5, 17, 7, 1, 17, 11, 16178 }, // ӏ
-    { 18, 24, 18, 0, 24, 54, 16189 }, // Ӑ
-    { 13, 20, 14, 0, 20, 33, 16243 }, // ӑ
-    { 18, 23, 18, 0, 23, 52, 16276 }, // Ӓ
-    { 13, 19, 14, 0, 19, 31, 16328 }, // ӓ
-    { 24, 17, 25, 0, 17, 51, 16359 }, // Ӕ
-    { 21, 13, 22, 0, 13, 35, 16410 }, // ӕ
-    { 13, 24, 15, 2, 24, 39, 16445 }, // Ӗ
-    { 13, 20, 15, 1, 20, 33, 16484 }, // ӗ
-    { 16, 17, 18, 1, 17, 34, 16517 }, // Ә
-    { 13, 13, 15, 1, 13, 22, 16551 }, // ә
-    { 16, 23, 18, 1, 23, 46, 16573 }, // Ӛ
-    { 13, 19, 15, 1, 19, 31, 16619 }, // ӛ
-    { 25, 23, 25, 0, 23, 72, 16650 }, // Ӝ
-    { 21, 19, 21, 0, 19, 50, 16722 }, // ӝ
-    { 15, 23, 15, 0, 23, 44, 16772 }, // Ӟ
-    { 12, 19, 12, 0, 19, 29, 16816 }, // ӟ
-    { 14, 17, 15, 0, 17, 30, 16845 }, // Ӡ
-    { 12, 18, 13, 0, 13, 27, 16875 }, // ӡ
-    { 15, 23, 19, 2, 23, 44, 16902 }, // Ӣ
-    { 13, 19, 15, 1, 19, 31, 16946 }, // ӣ
-    { 15, 23, 19, 2, 23, 44, 16977 }, // Ӥ
-    { 13, 19, 15, 1, 19, 31, 17021 }, // ӥ
-    { 18, 23, 20, 1, 23, 52, 17052 }, // Ӧ
-    { 14, 19, 15, 1, 19, 34, 17104 }, // ӧ
-    { 18, 17, 20, 1, 17, 39, 17138 }, // Ө
-    { 14, 13, 15, 1, 13, 23, 17177 }, // ө
-    { 18, 23, 20, 1, 23, 52, 17200 }, // Ӫ
-    { 14, 19, 15, 1, 19, 34, 17252 }, // ӫ
-    { 15, 23, 17, 1, 23, 44, 17286 }, // Ӭ
-    { 13, 19, 13, 0, 19, 31, 17330 }, // ӭ
-    { 17, 23, 16, 0, 23, 49, 17361 }, // Ӯ
-    { 14, 24, 14, 0, 19, 42, 17410 }, // ӯ
-    { 17, 23, 16, 0, 23, 49, 17452 }, // Ӱ
-    { 14, 24, 14, 0, 19, 42, 17501 }, // ӱ
-    { 17, 24, 16, 0, 24, 51, 17543 }, // Ӳ
-    { 14, 25, 14, 0, 20, 44, 17594 }, // ӳ
-    { 14, 23, 17, 1, 23, 41, 17638 }, // Ӵ
-    { 12, 19, 14, 1, 19, 29, 17679 }, // ӵ
-    { 12, 22, 15, 2, 17, 33, 17708 }, // Ӷ
-    { 11, 17, 11, 1, 13, 24, 17741 }, // ӷ
-    { 20, 23, 23, 2, 23, 58, 17765 }, // Ӹ
-    { 18, 19, 21, 1, 19, 43, 17823 }, // ӹ
-    { 13, 3, 13, 0, 9, 5, 17866 }, // –
-    { 25, 3, 25, 0, 9, 10, 17871 }, // —
-    { 25, 3, 25, 0, 9, 10, 17881 }, // ―
-    { 5, 7, 6, 1, 19, 5, 17891 }, // ‘
-    { 6, 7, 6, 0, 19, 6, 17896 }, // ’
-    { 6, 7, 6, 0, 4, 6, 17902 }, // ‚
-    { 10, 7, 11, 1, 19, 9, 17908 }, // “
-    { 11, 7, 11, 0, 19, 10, 17917 }, // ”
-    { 11, 7, 11, 0, 4, 10, 17927 }, // „
-    { 12, 21, 12, 0, 17, 32, 17937 }, // †
-    { 12, 21, 12, 0, 17, 32, 17969 }, // ‡
-    { 9, 7, 9, 0, 12, 8, 18001 }, // •
-    { 23, 5, 25, 1, 5, 15, 18009 }, // …
-    { 33, 17, 33, 0, 17, 71, 18024 }, // ‰
-    { 8, 13, 8, 0, 14, 13, 18095 }, // ‹
-    { 8, 13, 8, 0, 14, 13, 18108 }, // ›
-    { 14, 18, 4, -5, 18, 32, 18121 }, // ⁄
-    { 9, 10, 9, 0, 18, 12, 18153 }, // ⁰
-    { 9, 10, 9, 0, 18, 12, 18165 }, // ⁴
-    { 9, 10, 9, 0, 18, 12, 18177 }, // ⁵
-    { 9, 10, 9, 0, 18, 12, 18189 }, // ⁶
-    { 9, 10, 9, 0, 18, 12, 18201 }, // ⁷
-    { 9, 10, 9, 0, 18, 12, 18213 }, // ⁸
-    { 9, 10, 9, 0, 18, 12, 18225 }, // ⁹
-    { 9, 10, 9, 0, 11, 12, 18237 }, // ₀
-    { 7, 10, 9, 0, 11, 9, 18249 }, // ₁
-    { 9, 10, 9, 0, 11, 12, 18258 }, // ₂
-    { 8, 10, 9, 0, 11, 10, 18270 }, // ₃
-    { 9, 10, 9, 0, 11, 12, 18280 }, // ₄
-    { 9, 10, 9, 0, 11, 12, 18292 }, // ₅
-    { 9, 10, 9, 0, 11, 12, 18304 }, // ₆
-    { 9, 10, 9, 0, 11, 12, 18316 }, // ₇
-    { 9, 10, 9, 0, 11, 12, 18328 }, // ₈
-    { 9, 10, 9, 0, 11, 12, 18340 }, // ₉
-    { 14, 17, 14, 1, 17, 30, 18352 }, // €
-    { 14, 17, 14, 0, 17, 30, 18382 }, // ₮
-    { 14, 17, 14, 0, 17, 30, 18412 }, // ₴
-    { 14, 17, 14, 1, 17, 30, 18442 }, // ₹
-    { 15, 18, 15, 0, 18, 34, 18472 }, // ∂
-    { 18, 17, 17, 0, 17, 39, 18506 }, // ∆
-    { 15, 21, 18, 2, 18, 40, 18545 }, // ∏
-    { 14, 20, 14, 0, 17, 35, 18585 }, // ∑
-    { 12, 3, 14, 1, 9, 5, 18620 }, // −
-    { 14, 18, 4, -5, 18, 32, 18625 }, // ∕
-    { 6, 5, 6, 0, 10, 4, 18657 }, // ∙
-    { 16, 18, 15, 0, 18, 36, 18661 }, // √
-    { 16, 8, 16, 0, 11, 16, 18697 }, // ∞
-    { 10, 25, 10, 0, 19, 32, 18713 }, // ∫
-    { 14, 11, 14, 0, 13, 20, 18745 }, // ≈
-    { 12, 14, 14, 1, 14, 21, 18765 }, // ≠
-    { 12, 15, 14, 1, 15, 23, 18786 }, // ≤
-    { 12, 15, 14, 1, 15, 23, 18809 }, // ≥
+    { 5, 17, 7, 1, 17, 17, 0 }, // !
+    { 10, 7, 12, 1, 19, 14, 17 }, // "
+    { 16, 17, 17, 1, 17, 34, 31 }, // #
+    { 14, 23, 14, 0, 20, 46, 65 }, // $
+    { 23, 17, 23, 0, 17, 51, 111 }, // %
+    { 18, 17, 18, 0, 17, 51, 162 }, // &
+    { 4, 7, 6, 1, 19, 7, 213 }, // '
+    { 8, 25, 9, 1, 20, 25, 220 }, // (
+    { 8, 25, 9, 0, 20, 25, 245 }, // )
+    { 11, 10, 13, 1, 17, 20, 270 }, // *
+    { 12, 11, 14, 1, 13, 22, 290 }, // +
+    { 6, 8, 6, 0, 4, 8, 312 }, // ,
+    { 8, 3, 9, 0, 9, 3, 320 }, // -
+    { 6, 5, 6, 0, 5, 5, 323 }, // .
+    { 13, 25, 11, -1, 20, 50, 328 }, // /
+    { 14, 17, 14, 0, 17, 34, 378 }, // 0
+    { 10, 17, 14, 1, 17, 34, 412 }, // 1
+    { 13, 17, 14, 0, 17, 34, 446 }, // 2
+    { 13, 17, 14, 0, 17, 34, 480 }, // 3
+    { 14, 17, 14, 0, 17, 34, 514 }, // 4
+    { 13, 17, 14, 0, 17, 34, 548 }, // 5
+    { 14, 17, 14, 0, 17, 34, 582 }, // 6
+    { 13, 17, 14, 1, 17, 34, 616 }, // 7
+    { 14, 17, 14, 0, 17, 34, 650 }, // 8
+    { 14, 17, 14, 0, 17, 34, 684 }, // 9
+    { 6, 14, 6, 0, 14, 14, 718 }, // :
+    { 6, 18, 6, 0, 14, 18, 732 }, // ;
+    { 12, 13, 14, 1, 14, 26, 750 }, // <
+    { 12, 8, 14, 1, 12, 16, 776 }, // =
+    { 12, 13, 14, 1, 14, 26, 792 }, // >
+    { 11, 19, 11, 0, 19, 38, 818 }, // ?
+    { 23, 22, 24, 1, 18, 66, 856 }, // @
+    { 18, 17, 18, 0, 17, 51, 922 }, // A
+    { 14, 17, 17, 2, 17, 34, 973 }, // B
+    { 15, 17, 16, 1, 17, 34, 1007 }, // C
+    { 16, 17, 18, 2, 17, 34, 1041 }, // D
+    { 13, 17, 15, 2, 17, 34, 1075 }, // E
+    { 12, 17, 14, 2, 17, 34, 1109 }, // F
+    { 15, 17, 18, 1, 17, 34, 1143 }, // G
+    { 15, 17, 18, 2, 17, 34, 1177 }, // H
+    { 4, 17, 8, 2, 17, 17, 1211 }, // I
+    { 12, 17, 13, 0, 17, 34, 1228 }, // J
+    { 15, 17, 17, 2, 17, 34, 1262 }, // K
+    { 12, 17, 14, 2, 17, 34, 1296 }, // L
+    { 20, 17, 22, 1, 17, 51, 1330 }, // M
+    { 15, 17, 19, 2, 17, 34, 1381 }, // N
+    { 18, 17, 20, 1, 17, 51, 1415 }, // O
+    { 14, 17, 16, 2, 17, 34, 1466 }, // P
+    { 18, 22, 20, 1, 17, 66, 1500 }, // Q
+    { 15, 17, 17, 2, 17, 34, 1566 }, // R
+    { 14, 17, 15, 0, 17, 34, 1600 }, // S
+    { 15, 17, 15, 0, 17, 34, 1634 }, // T
+    { 15, 17, 18, 1, 17, 34, 1668 }, // U
+    { 18, 17, 18, 0, 17, 51, 1702 }, // V
+    { 24, 17, 24, 0, 17, 51, 1753 }, // W
+    { 17, 17, 17, 0, 17, 51, 1804 }, // X
+    { 17, 17, 17, 0, 17, 51, 1855 }, // Y
+    { 15, 17, 15, 0, 17, 34, 1906 }, // Z
+    { 8, 25, 9, 2, 20, 25, 1940 }, // [
+    { 13, 25, 11, -1, 20, 50, 1965 }, // <backslash>
+    { 8, 25, 9, 0, 20, 25, 2015 }, // ]
+    { 14, 10, 14, 0, 17, 20, 2040 }, // ^
+    { 13, 3, 13, 0, -2, 6, 2060 }, // _
+    { 7, 6, 7, 0, 20, 6, 2066 }, // `
+    { 13, 13, 14, 0, 13, 26, 2072 }, // a
+    { 13, 19, 15, 1, 19, 38, 2098 }, // b
+    { 11, 13, 13, 1, 13, 26, 2136 }, // c
+    { 13, 19, 15, 1, 19, 38, 2162 }, // d
+    { 13, 13, 15, 1, 13, 26, 2200 }, // e
+    { 10, 19, 11, 1, 19, 38, 2226 }, // f
+    { 13, 18, 15, 1, 13, 36, 2264 }, // g
+    { 13, 19, 15, 1, 19, 38, 2300 }, // h
+    { 5, 19, 7, 1, 19, 19, 2338 }, // i
+    { 8, 24, 7, -2, 19, 24, 2357 }, // j
+    { 14, 19, 14, 1, 19, 38, 2381 }, // k
+    { 7, 19, 8, 1, 19, 19, 2419 }, // l
+    { 19, 13, 22, 1, 13, 39, 2438 }, // m
+    { 13, 13, 15, 1, 13, 26, 2477 }, // n
+    { 14, 13, 15, 1, 13, 26, 2503 }, // o
+    { 13, 18, 15, 1, 13, 36, 2529 }, // p
+    { 13, 18, 15, 1, 13, 36, 2565 }, // q
+    { 10, 13, 11, 1, 13, 26, 2601 }, // r
+    { 12, 13, 12, 0, 13, 26, 2627 }, // s
+    { 10, 17, 11, 1, 17, 34, 2653 }, // t
+    { 12, 13, 15, 1, 13, 26, 2687 }, // u
+    { 14, 13, 14, 0, 13, 26, 2713 }, // v
+    { 20, 13, 20, 0, 13, 39, 2739 }, // w
+    { 14, 13, 14, 0, 13, 26, 2778 }, // x
+    { 14, 18, 14, 0, 13, 36, 2804 }, // y
+    { 12, 13, 13, 0, 13, 26, 2840 }, // z
+    { 10, 25, 9, 0, 20, 50, 2866 }, // {
+    { 4, 25, 8, 2, 20, 25, 2916 }, // |
+    { 9, 25, 9, 0, 20, 50, 2941 }, // }
+    { 14, 5, 14, 0, 10, 10, 2991 }, // ~
+    { 0, 0, 6, 0, 0, 0, 3001 }, //  
+    { 5, 18, 7, 1, 13, 18, 3001 }, // ¡
+    { 11, 18, 14, 1, 16, 36, 3019 }, // ¢
+    { 13, 17, 14, 0, 17, 34, 3055 }, // £
+    { 14, 13, 14, 0, 16, 26, 3089 }, // ¤
+    { 16, 17, 14, -1, 17, 34, 3115 }, // ¥
+    { 4, 25, 8, 2, 20, 25, 3149 }, // ¦
+    { 13, 22, 13, 0, 17, 44, 3174 }, // §
+    { 11, 4, 13, 1, 19, 8, 3218 }, // ¨
+    { 18, 18, 20, 1, 18, 54, 3226 }, // ©
+    { 10, 10, 10, 0, 18, 20, 3280 }, // ª
+    { 15, 13, 15, 0, 14, 26, 3300 }, // «
+    { 12, 9, 14, 1, 10, 18, 3326 }, // ¬
+    { 8, 3, 9, 0, 9, 3, 3344 }, // ­
+    { 18, 18, 20, 1, 18, 54, 3347 }, // ®
+    { 9, 3, 9, 0, 19, 6, 3401 }, // ¯
+    { 9, 7, 9, 0, 19, 14, 3407 }, // °
+    { 12, 15, 14, 1, 15, 30, 3421 }, // ±
+    { 9, 10, 9, 0, 18, 20, 3451 }, // ²
+    { 8, 10, 9, 0, 18, 10, 3471 }, // ³
+    { 7, 6, 7, 0, 20, 6, 3481 }, // ´
+    { 13, 18, 15, 1, 13, 36, 3487 }, // µ
+    { 15, 23, 18, 1, 18, 46, 3523 }, // ¶
+    { 6, 5, 6, 0, 10, 5, 3569 }, // ·
+    { 6, 7, 8, 1, 1, 7, 3574 }, // ¸
+    { 7, 10, 9, 0, 18, 10, 3581 }, // ¹
+    { 11, 10, 11, 0, 18, 20, 3591 }, // º
+    { 15, 13, 15, 0, 14, 26, 3611 }, // »
+    { 22, 18, 22, 0, 18, 54, 3637 }, // ¼
+    { 21, 18, 22, 0, 18, 54, 3691 }, // ½
+    { 22, 18, 22, 0, 18, 54, 3745 }, // ¾
+    { 11, 18, 11, 0, 13, 36, 3799 }, // ¿
+    { 18, 24, 18, 0, 24, 72, 3835 }, // À
+    { 18, 24, 18, 0, 24, 72, 3907 }, // Á
+    { 18, 23, 18, 0, 23, 69, 3979 }, // Â
+    { 18, 23, 18, 0, 23, 69, 4048 }, // Ã
+    { 18, 23, 18, 0, 23, 69, 4117 }, // Ä
+    { 18, 22, 18, 0, 22, 66, 4186 }, // Å
+    { 24, 17, 25, 0, 17, 51, 4252 }, // Æ
+    { 15, 22, 16, 1, 17, 44, 4303 }, // Ç
+    { 13, 24, 15, 2, 24, 48, 4347 }, // È
+    { 13, 24, 15, 2, 24, 48, 4395 }, // É
+    { 13, 23, 15, 2, 23, 46, 4443 }, // Ê
+    { 13, 23, 15, 2, 23, 46, 4489 }, // Ë
+    { 7, 24, 8, 0, 24, 24, 4535 }, // Ì
+    { 7, 24, 8, 1, 24, 24, 4559 }, // Í
+    { 8, 23, 8, 0, 23, 23, 4583 }, // Î
+    { 10, 23, 8, -1, 23, 46, 4606 }, // Ï
+    { 18, 17, 19, 0, 17, 51, 4652 }, // Ð
+    { 15, 23, 19, 2, 23, 46, 4703 }, // Ñ
+    { 18, 24, 20, 1, 24, 72, 4749 }, // Ò
+    { 18, 24, 20, 1, 24, 72, 4821 }, // Ó
+    { 18, 23, 20, 1, 23, 69, 4893 }, // Ô
+    { 18, 23, 20, 1, 23, 69, 4962 }, // Õ
+    { 18, 23, 20, 1, 23, 69, 5031 }, // Ö
+    { 12, 11, 14, 1, 13, 22, 5100 }, // ×
+    { 18, 19, 20, 1, 18, 57, 5122 }, // Ø
+    { 15, 24, 18, 1, 24, 48, 5179 }, // Ù
+    { 15, 24, 18, 1, 24, 48, 5227 }, // Ú
+    { 15, 23, 18, 1, 23, 46, 5275 }, // Û
+    { 15, 23, 18, 1, 23, 46, 5321 }, // Ü
+    { 17, 24, 17, 0, 24, 72, 5367 }, // Ý
+    { 14, 17, 16, 2, 17, 34, 5439 }, // Þ
+    { 15, 19, 16, 1, 19, 38, 5473 }, // ß
+    { 13, 20, 14, 0, 20, 40, 5511 }, // à
+    { 13, 20, 14, 0, 20, 40, 5551 }, // á
+    { 13, 19, 14, 0, 19, 38, 5591 }, // â
+    { 13, 19, 14, 0, 19, 38, 5629 }, // ã
+    { 13, 19, 14, 0, 19, 38, 5667 }, // ä
+    { 13, 20, 14, 0, 20, 40, 5705 }, // å
+    { 21, 13, 22, 0, 13, 39, 5745 }, // æ
+    { 11, 18, 13, 1, 13, 36, 5784 }, // ç
+    { 13, 20, 15, 1, 20, 40, 5820 }, // è
+    { 13, 20, 15, 1, 20, 40, 5860 }, // é
+    { 13, 19, 15, 1, 19, 38, 5900 }, // ê
+    { 13, 19, 15, 1, 19, 38, 5938 }, // ë
+    { 7, 20, 7, 0, 20, 20, 5976 }, // ì
+    { 6, 20, 7, 1, 20, 20, 5996 }, // í
+    { 9, 19, 7, -1, 19, 38, 6016 }, // î
+    { 11, 19, 7, -2, 19, 38, 6054 }, // ï
+    { 14, 19, 15, 1, 19, 38, 6092 }, // ð
+    { 13, 19, 15, 1, 19, 38, 6130 }, // ñ
+    { 14, 20, 15, 1, 20, 40, 6168 }, // ò
+    { 14, 20, 15, 1, 20, 40, 6208 }, // ó
+    { 14, 19, 15, 1, 19, 38, 6248 }, // ô
+    { 14, 19, 15, 1, 19, 38, 6286 }, // õ
+    { 14, 19, 15, 1, 19, 38, 6324 }, // ö
+    { 12, 13, 14, 1, 13, 26, 6362 }, // ÷
+    { 14, 15, 15, 1, 14, 30, 6388 }, // ø
+    { 12, 20, 15, 1, 20, 40, 6418 }, // ù
+    { 12, 20, 15, 1, 20, 40, 6458 }, // ú
+    { 12, 19, 15, 1, 19, 38, 6498 }, // û
+    { 12, 19, 15, 1, 19, 38, 6536 }, // ü
+    { 14, 25, 14, 0, 20, 50, 6574 }, // ý
+    { 13, 24, 15, 1, 19, 48, 6624 }, // þ
+    { 14, 24, 14, 0, 19, 48, 6672 }, // ÿ
+    { 18, 23, 18, 0, 23, 69, 6720 }, // Ā
+    { 13, 19, 14, 0, 19, 38, 6789 }, // ā
+    { 18, 23, 18, 0, 23, 69, 6827 }, // Ă
+    { 13, 19, 14, 0, 19, 38, 6896 }, // ă
+    { 19, 23, 18, 0, 17, 69, 6934 }, // Ą
+    { 13, 19, 14, 0, 13, 38, 7003 }, // ą
+    { 15, 24, 16, 1, 24, 48, 7041 }, // Ć
+    { 11, 20, 13, 1, 20, 40, 7089 }, // ć
+    { 15, 23, 16, 1, 23, 46, 7129 }, // Ĉ
+    { 11, 19, 13, 1, 19, 38, 7175 }, // ĉ
+    { 15, 23, 16, 1, 23, 46, 7213 }, // Ċ
+    { 11, 19, 13, 1, 19, 38, 7259 }, // ċ
+    { 15, 24, 16, 1, 24, 48, 7297 }, // Č
+    { 11, 20, 13, 1, 20, 40, 7345 }, // č
+    { 16, 24, 18, 2, 24, 48, 7385 }, // Ď
+    { 18, 19, 17, 1, 19, 57, 7433 }, // ď
+    { 18, 17, 19, 0, 17, 51, 7490 }, // Đ
+    { 14, 19, 15, 1, 19, 38, 7541 }, // đ
+    { 13, 23, 15, 2, 23, 46, 7579 }, // Ē
+    { 13, 19, 15, 1, 19, 38, 7625 }, // ē
+    { 13, 23, 15, 2, 23, 46, 7663 }, // Ĕ
+    { 13, 19, 15, 1, 19, 38, 7709 }, // ĕ
+    { 13, 23, 15, 2, 23, 46, 7747 }, // Ė
+    { 13, 19, 15, 1, 19, 38, 7793 }, // ė
+    { 13, 23, 15, 2, 17, 46, 7831 }, // Ę
+    { 13, 18, 15, 1, 13, 36, 7877 }, // ę
+    { 13, 24, 15, 2, 24, 48, 7913 }, // Ě
+    { 13, 20, 15, 1, 20, 40, 7961 }, // ě
+    { 15, 23, 18, 1, 23, 46, 8001 }, // Ĝ
+    { 13, 24, 15, 1, 19, 48, 8047 }, // ĝ
+    { 15, 23, 18, 1, 23, 46, 8095 }, // Ğ
+    { 13, 24, 15, 1, 19, 48, 8141 }, // ğ
+    { 15, 23, 18, 1, 23, 46, 8189 }, // Ġ
+    { 13, 24, 15, 1, 19, 48, 8235 }, // ġ
+    { 15, 22, 18, 1, 17, 44, 8283 }, // Ģ
+    { 13, 25, 15, 1, 20, 50, 8327 }, // ģ
+    { 15, 23, 18, 2, 23, 46, 8377 }, // Ĥ
+    { 13, 25, 15, 1, 25, 50, 8423 }, // ĥ
+    { 19, 17, 19, 0, 17, 51, 8473 }, // Ħ
+    { 14, 19, 15, 0, 19, 38, 8524 }, // ħ
+    { 10, 23, 8, -1, 23, 46, 8562 }, // Ĩ
+    { 10, 19, 7, -1, 19, 38, 8608 }, // ĩ
+    { 10, 23, 8, -1, 23, 46, 8646 }, // Ī
+    { 9, 19, 7, -1, 19, 38, 8692 }, // ī
+    { 9, 23, 8, 0, 23, 46, 8730 }, // Ĭ
+    { 9, 19, 7, -1, 19, 38, 8776 }, // ĭ
+    { 7, 23, 8, 0, 17, 23, 8814 }, // Į
+    { 6, 25, 7, 0, 19, 25, 8837 }, // į
+    { 5, 23, 8, 1, 23, 23, 8862 }, // İ
+    { 5, 13, 7, 1, 13, 13, 8885 }, // ı
+    { 18, 17, 21, 2, 17, 51, 8898 }, // Ĳ
+    { 12, 24, 14, 1, 19, 48, 8949 }, // ĳ
+    { 14, 23, 13, 0, 23, 46, 8997 }, // Ĵ
+    { 10, 24, 7, -2, 19, 48, 9043 }, // ĵ
+    { 15, 22, 17, 2, 17, 44, 9091 }, // Ķ
+    { 14, 24, 14, 1, 19, 48, 9135 }, // ķ
+    { 14, 13, 15, 1, 13, 26, 9183 }, // ĸ
+    { 13, 24, 14, 1, 24, 48, 9209 }, // Ĺ
+    { 7, 24, 8, 1, 24, 24, 9257 }, // ĺ
+    { 12, 22, 14, 2, 17, 44, 9281 }, // Ļ
+    { 7, 24, 8, 1, 19, 24, 9325 }, // ļ
+    { 12, 17, 14, 2, 17, 34, 9349 }, // Ľ
+    { 10, 19, 9, 1, 19, 38, 9383 }, // ľ
+    { 12, 17, 14, 2, 17, 34, 9421 }, // Ŀ
+    { 12, 19, 13, 1, 19, 38, 9455 }, // ŀ
+    { 15, 17, 15, 0, 17, 34, 9493 }, // Ł
+    { 11, 19, 9, -1, 19, 38, 9527 }, // ł
+    { 15, 24, 19, 2, 24, 48, 9565 }, // Ń
+    { 13, 20, 15, 1, 20, 40, 9613 }, // ń
+    { 15, 22, 19, 2, 17, 44, 9653 }, // Ņ
+    { 13, 18, 15, 1, 13, 36, 9697 }, // ņ
+    { 15, 24, 19, 2, 24, 48, 9733 }, // Ň
+    { 13, 20, 15, 1, 20, 40, 9781 }, // ň
+    { 15, 19, 15, -1, 19, 38, 9821 }, // ŉ
+    { 15, 22, 19, 2, 17, 44, 9859 }, // Ŋ
+    { 13, 18, 15, 1, 13, 36, 9903 }, // ŋ
+    { 18, 23, 20, 1, 23, 69, 9939 }, // Ō
+    { 14, 19, 15, 1, 19, 38, 10008 }, // ō
+    { 18, 23, 20, 1, 23, 69, 10046 }, // Ŏ
+    { 14, 19, 15, 1, 19, 38, 10115 }, // ŏ
+    { 18, 24, 20, 1, 24, 72, 10153 }, // Ő
+    { 14, 20, 15, 1, 20, 40, 10225 }, // ő
+    { 24, 17, 25, 1, 17, 51, 10265 }, // Œ
+    { 22, 13, 23, 1, 13, 39, 10316 }, // œ
+    { 15, 24, 17, 2, 24, 48, 10355 }, // Ŕ
+    { 10, 20, 11, 1, 20, 40, 10403 }, // ŕ
+    { 15, 22, 17, 2, 17, 44, 10443 }, // Ŗ
+    { 11, 18, 11, 0, 13, 36, 10487 }, // ŗ
+    { 15, 24, 17, 2, 24, 48, 10523 }, // Ř
+    { 10, 20, 11, 1, 20, 40, 10571 }, // ř
+    { 14, 24, 15, 0, 24, 48, 10611 }, // Ś
+    { 12, 20, 12, 0, 20, 40, 10659 }, // ś
+    { 14, 23, 15, 0, 23, 46, 10699 }, // Ŝ
+    { 12, 19, 12, 0, 19, 38, 10745 }, // ŝ
+    { 14, 22, 15, 0, 17, 44, 10783 }, // Ş
+    { 12, 18, 12, 0, 13, 36, 10827 }, // ş
+    { 14, 24, 15, 0, 24, 48, 10863 }, // Š
+    { 12, 20, 12, 0, 20, 40, 10911 }, // š
+    { 15, 23, 15, 0, 17, 46, 10951 }, // Ţ
+    { 10, 22, 11, 1, 17, 44, 10997 }, // ţ
+    { 15, 24, 15, 0, 24, 48, 11041 }, // Ť
+    { 10, 19, 11, 1, 19, 38, 11089 }, // ť
+    { 15, 17, 15, 0, 17, 34, 11127 }, // Ŧ
+    { 10, 17, 11, 1, 17, 34, 11161 }, // ŧ
+    { 15, 23, 18, 1, 23, 46, 11195 }, // Ũ
+    { 12, 19, 15, 1, 19, 38, 11241 }, // ũ
+    { 15, 23, 18, 1, 23, 46, 11279 }, // Ū
+    { 12, 19, 15, 1, 19, 38, 11325 }, // ū
+    { 15, 23, 18, 1, 23, 46, 11363 }, // Ŭ
+    { 12, 19, 15, 1, 19, 38, 11409 }, // ŭ
+    { 15, 23, 18, 1, 23, 46, 11447 }, // Ů
+    { 12, 20, 15, 1, 20, 40, 11493 }, // ů
+    { 15, 24, 18, 1, 24, 48, 11533 }, // Ű
+    { 13, 20, 15, 1, 20, 40, 11581 }, // ű
+    { 15, 22, 18, 1, 17, 44, 11621 }, // Ų
+    { 13, 18, 15, 1, 13, 36, 11665 }, // ų
+    { 24, 23, 24, 0, 23, 69, 11701 }, // Ŵ
+    { 20, 19, 20, 0, 19, 57, 11770 }, // ŵ
+    { 17, 23, 17, 0, 23, 69, 11827 }, // Ŷ
+    { 14, 24, 14, 0, 19, 48, 11896 }, // ŷ
+    { 17, 23, 17, 0, 23, 69, 11944 }, // Ÿ
+    { 15, 24, 15, 0, 24, 48, 12013 }, // Ź
+    { 12, 20, 13, 0, 20, 40, 12061 }, // ź
+    { 15, 23, 15, 0, 23, 46, 12101 }, // Ż
+    { 12, 19, 13, 0, 19, 38, 12147 }, // ż
+    { 15, 24, 15, 0, 24, 48, 12185 }, // Ž
+    { 12, 20, 13, 0, 20, 40, 12233 }, // ž
+    { 10, 19, 8, 1, 19, 38, 12273 }, // ſ
+    { 9, 4, 10, 0, 19, 8, 12311 }, // ̑
+    { 13, 24, 15, 2, 24, 48, 12319 }, // Ѐ
+    { 13, 23, 15, 2, 23, 46, 12367 }, // Ё
+    { 20, 17, 20, 0, 17, 51, 12413 }, // Ђ
+    { 12, 24, 15, 2, 24, 48, 12464 }, // Ѓ
+    { 16, 17, 17, 1, 17, 34, 12512 }, // Є
+    { 14, 17, 15, 0, 17, 34, 12546 }, // Ѕ
+    { 4, 17, 8, 2, 17, 17, 12580 }, // І
+    { 10, 23, 8, -1, 23, 46, 12597 }, // Ї
+    { 12, 17, 13, 0, 17, 34, 12643 }, // Ј
+    { 28, 17, 28, 0, 17, 68, 12677 }, // Љ
+    { 24, 17, 27, 2, 17, 51, 12745 }, // Њ
+    { 19, 17, 19, 0, 17, 51, 12796 }, // Ћ
+    { 15, 24, 17, 2, 24, 48, 12847 }, // Ќ
+    { 15, 24, 19, 2, 24, 48, 12895 }, // Ѝ
+    { 17, 24, 16, 0, 24, 72, 12943 }, // Ў
+    { 15, 22, 18, 2, 17, 44, 13015 }, // Џ
+    { 18, 17, 18, 0, 17, 51, 13059 }, // А
+    { 14, 17, 16, 2, 17, 34, 13110 }, // Б
+    { 14, 17, 17, 2, 17, 34, 13144 }, // В
+    { 12, 17, 15, 2, 17, 34, 13178 }, // Г
+    { 21, 22, 21, 0, 17, 66, 13212 }, // Д
+    { 13, 17, 15, 2, 17, 34, 13278 }, // Е
+    { 25, 17, 25, 0, 17, 68, 13312 }, // Ж
+    { 15, 17, 15, 0, 17, 34, 13380 }, // З
+    { 15, 17, 19, 2, 17, 34, 13414 }, // И
+    { 15, 24, 19, 2, 24, 48, 13448 }, // Й
+    { 15, 17, 17, 2, 17, 34, 13496 }, // К
+    { 18, 17, 20, 0, 17, 51, 13530 }, // Л
+    { 20, 17, 22, 1, 17, 51, 13581 }, // М
+    { 15, 17, 18, 2, 17, 34, 13632 }, // Н
+    { 18, 17, 20, 1, 17, 51, 13666 }, // О
+    { 15, 17, 18, 2, 17, 34, 13717 }, // П
+    { 14, 17, 16, 2, 17, 34, 13751 }, // Р
+    { 15, 17, 16, 1, 17, 34, 13785 }, // С
+    { 15, 17, 15, 0, 17, 34, 13819 }, // Т
+    { 17, 17, 16, 0, 17, 51, 13853 }, // У
+    { 20, 18, 22, 1, 18, 54, 13904 }, // Ф
+    { 17, 17, 17, 0, 17, 51, 13958 }, // Х
+    { 18, 22, 20, 2, 17, 66, 14009 }, // Ц
+    { 14, 17, 17, 1, 17, 34, 14075 }, // Ч
+    { 22, 17, 26, 2, 17, 51, 14109 }, // Ш
+    { 25, 22, 27, 2, 17, 88, 14160 }, // Щ
+    { 19, 17, 19, 0, 17, 51, 14248 }, // Ъ
+    { 20, 17, 23, 2, 17, 51, 14299 }, // Ы
+    { 14, 17, 16, 2, 17, 34, 14350 }, // Ь
+    { 15, 17, 17, 1, 17, 34, 14384 }, // Э
+    { 24, 17, 27, 2, 17, 51, 14418 }, // Ю
+    { 15, 17, 17, 1, 17, 34, 14469 }, // Я
+    { 13, 13, 14, 0, 13, 26, 14503 }, // а
+    { 13, 19, 15, 1, 19, 38, 14529 }, // б
+    { 13, 13, 15, 1, 13, 26, 14567 }, // в
+    { 11, 13, 11, 1, 13, 26, 14593 }, // г
+    { 17, 17, 17, 0, 13, 51, 14619 }, // д
+    { 13, 13, 15, 1, 13, 26, 14670 }, // е
+    { 21, 13, 21, 0, 13, 39, 14696 }, // ж
+    { 12, 13, 12, 0, 13, 26, 14735 }, // з
+    { 13, 13, 15, 1, 13, 26, 14761 }, // и
+    { 13, 20, 15, 1, 20, 40, 14787 }, // й
+    { 14, 13, 15, 1, 13, 26, 14827 }, // к
+    { 14, 13, 16, 0, 13, 26, 14853 }, // л
+    { 17, 13, 19, 1, 13, 39, 14879 }, // м
+    { 13, 13, 15, 1, 13, 26, 14918 }, // н
+    { 14, 13, 15, 1, 13, 26, 14944 }, // о
+    { 13, 13, 15, 1, 13, 26, 14970 }, // п
+    { 13, 18, 15, 1, 13, 36, 14996 }, // р
+    { 11, 13, 13, 1, 13, 26, 15032 }, // с
+    { 13, 13, 13, 0, 13, 26, 15058 }, // т
+    { 14, 18, 14, 0, 13, 36, 15084 }, // у
+    { 18, 24, 20, 1, 19, 72, 15120 }, // ф
+    { 14, 13, 14, 0, 13, 26, 15192 }, // х
+    { 15, 17, 16, 1, 13, 34, 15218 }, // ц
+    { 12, 13, 14, 1, 13, 26, 15252 }, // ч
+    { 19, 13, 22, 1, 13, 39, 15278 }, // ш
+    { 21, 17, 22, 1, 13, 51, 15317 }, // щ
+    { 16, 13, 16, 0, 13, 26, 15368 }, // ъ
+    { 18, 13, 21, 1, 13, 39, 15394 }, // ы
+    { 13, 13, 14, 1, 13, 26, 15433 }, // ь
+    { 13, 13, 13, 0, 13, 26, 15459 }, // э
+    { 20, 13, 22, 1, 13, 39, 15485 }, // ю
+    { 13, 13, 15, 0, 13, 26, 15524 }, // я
+    { 13, 20, 15, 1, 20, 40, 15550 }, // ѐ
+    { 13, 19, 15, 1, 19, 38, 15590 }, // ё
+    { 14, 24, 15, 0, 19, 48, 15628 }, // ђ
+    { 11, 20, 11, 1, 20, 40, 15676 }, // ѓ
+    { 13, 13, 13, 0, 13, 26, 15716 }, // є
+    { 12, 13, 12, 0, 13, 26, 15742 }, // ѕ
+    { 5, 19, 7, 1, 19, 19, 15768 }, // і
+    { 11, 19, 7, -2, 19, 38, 15787 }, // ї
+    { 8, 24, 7, -2, 19, 24, 15825 }, // ј
+    { 22, 13, 23, 0, 13, 39, 15849 }, // љ
+    { 20, 13, 22, 1, 13, 39, 15888 }, // њ
+    { 14, 19, 15, 0, 19, 38, 15927 }, // ћ
+    { 14, 20, 15, 1, 20, 40, 15965 }, // ќ
+    { 13, 20, 15, 1, 20, 40, 16005 }, // ѝ
+    { 14, 25, 14, 0, 20, 50, 16045 }, // ў
+    { 13, 17, 15, 1, 13, 34, 16095 }, // џ
+    { 18, 19, 19, 0, 19, 57, 16129 }, // Ѣ
+    { 15, 19, 16, 0, 19, 38, 16186 }, // ѣ
+    { 18, 17, 20, 1, 17, 51, 16224 }, // Ѳ
+    { 14, 13, 15, 1, 13, 26, 16275 }, // ѳ
+    { 21, 17, 20, 0, 17, 51, 16301 }, // Ѵ
+    { 16, 13, 15, 0, 13, 26, 16352 }, // ѵ
+    { 18, 29, 21, 2, 24, 87, 16378 }, // Ҋ
+    { 15, 24, 16, 1, 20, 48, 16465 }, // ҋ
+    { 16, 17, 17, 0, 17, 34, 16513 }, // Ҍ
+    { 14, 14, 14, 0, 14, 28, 16547 }, // ҍ
+    { 14, 17, 16, 2, 17, 34, 16575 }, // Ҏ
+    { 14, 18, 15, 1, 13, 36, 16609 }, // ҏ
+    { 12, 20, 14, 2, 20, 40, 16645 }, // Ґ
+    { 11, 16, 12, 1, 16, 32, 16685 }, // ґ
+    { 15, 17, 16, 1, 17, 34, 16717 }, // Ғ
+    { 12, 13, 13, 1, 13, 26, 16751 }, // ғ
+    { 14, 22, 17, 2, 17, 44, 16777 }, // Ҕ
+    { 13, 18, 14, 1, 13, 36, 16821 }, // ҕ
+    { 26, 21, 26, 0, 17, 84, 16857 }, // Җ
+    { 22, 17, 22, 0, 13, 51, 16941 }, // җ
+    { 15, 22, 15, 0, 17, 44, 16992 }, // Ҙ
+    { 12, 18, 12, 0, 13, 36, 17036 }, // ҙ
+    { 16, 22, 18, 2, 17, 44, 17072 }, // Қ
+    { 14, 17, 15, 1, 13, 34, 17116 }, // қ
+    { 18, 17, 20, 2, 17, 51, 17150 }, // Ҝ
+    { 16, 13, 17, 1, 13, 26, 17201 }, // ҝ
+    { 18, 18, 18, 0, 18, 54, 17227 }, // Ҟ
+    { 15, 14, 15, 0, 14, 28, 17281 }, // ҟ
+    { 20, 17, 20, 0, 17, 51, 17309 }, // Ҡ
+    { 17, 13, 16, 0, 13, 39, 17360 }, // ҡ
+    { 18, 22, 20, 2, 17, 66, 17399 }, // Ң
+    { 15, 17, 16, 1, 13, 34, 17465 }, // ң
+    { 19, 17, 21, 2, 17, 51, 17499 }, // Ҥ
+    { 16, 13, 16, 1, 13, 26, 17550 }, // ҥ
+    { 25, 22, 28, 2, 17, 88, 17576 }, // Ҧ
+    { 20, 18, 22, 1, 13, 54, 17664 }, // ҧ
+    { 19, 21, 20, 1, 17, 63, 17718 }, // Ҩ
+    { 15, 17, 16, 1, 13, 34, 17781 }, // ҩ
+    { 15, 22, 16, 1, 17, 44, 17815 }, // Ҫ
+    { 11, 18, 13, 1, 13, 36, 17859 }, // ҫ
+    { 15, 22, 15, 0, 17, 44, 17895 }, // Ҭ
+    { 13, 17, 13, 0, 13, 34, 17939 }, // ҭ
+    { 17, 17, 17, 0, 17, 51, 17973 }, // Ү
+    { 14, 18, 14, 0, 13, 36, 18024 }, // ү
+    { 17, 17, 17, 0, 17, 51, 18060 }, // Ұ
+    { 14, 18, 14, 0, 13, 36, 18111 }, // ұ
+    { 18, 22, 18, 0, 17, 66, 18147 }, // Ҳ
+    { 15, 17, 15, 0, 13, 34, 18213 }, // ҳ
+    { 23, 22, 23, 0, 17, 66, 18247 }, // Ҵ
+    { 17, 17, 17, 0, 13, 51, 18313 }, // ҵ
+    { 17, 22, 18, 1, 17, 66, 18364 }, // Ҷ
+    { 15, 17, 15, 0, 13, 34, 18430 }, // ҷ
+    { 14, 17, 17, 1, 17, 34, 18464 }, // Ҹ
+    { 13, 13, 14, 0, 13, 26, 18498 }, // ҹ
+    { 14, 17, 18, 2, 17, 34, 18524 }, // Һ
+    { 13, 19, 15, 1, 19, 38, 18558 }, // һ
+    { 21, 17, 22, 0, 17, 51, 18596 }, // Ҽ
+    { 17, 13, 18, 0, 13, 39, 18647 }, // ҽ
+    { 21, 21, 22, 0, 17, 63, 18686 }, // Ҿ
+    { 17, 16, 18, 0, 13, 48, 18749 }, // ҿ
+    { 4, 17, 8, 2, 17, 17, 18797 }, // Ӏ
+    { 25, 24, 25, 0, 24, 96, 18814 }, // Ӂ
+    { 21, 20, 21, 0, 20, 60, 18910 }, // ӂ
+    { 15, 22, 18, 2, 17, 44, 18970 }, // Ӄ
+    { 13, 18, 14, 1, 13, 36, 19014 }, // ӄ
+    { 21, 22, 21, 0, 17, 66, 19050 }, // Ӆ
+    { 17, 17, 17, 0, 13, 51, 19116 }, // ӆ
+    { 15, 22, 18, 2, 17, 44, 19167 }, // Ӈ
+    { 13, 18, 15, 1, 13, 36, 19211 }, // ӈ
+    { 18, 22, 20, 2, 17, 66, 19247 }, // Ӊ
+    { 15, 17, 16, 1, 13, 34, 19313 }, // ӊ
+    { 14, 22, 17, 1, 17, 44, 19347 }, // Ӌ
+    { 12, 17, 14, 1, 13, 34, 19391 }, // ӌ
+    { 23, 22, 24, 1, 17, 66, 19425 }, // Ӎ
+    { 19, 17, 20, 1, 13, 51, 19491 }, // ӎ
+    { 5, 17, 7, 1, 17, 17, 19542 }, // ӏ
+    { 18, 24, 18, 0, 24, 72, 19559 }, // Ӑ
+    { 13, 20, 14, 0, 20, 40, 19631 }, // ӑ
+    { 18, 23, 18, 0, 23, 69, 19671 }, // Ӓ
+    { 13, 19, 14, 0, 19, 38, 19740 }, // ӓ
+    { 24, 17, 25, 0, 17, 51, 19778 }, // Ӕ
+    { 21, 13, 22, 0, 13, 39, 19829 }, // ӕ
+    { 13, 24, 15, 2, 24, 48, 19868 }, // Ӗ
+    { 13, 20, 15, 1, 20, 40, 19916 }, // ӗ
+    { 16, 17, 18, 1, 17, 34, 19956 }, // Ә
+    { 13, 13, 15, 1, 13, 26, 19990 }, // ә
+    { 16, 23, 18, 1, 23, 46, 20016 }, // Ӛ
+    { 13, 19, 15, 1, 19, 38, 20062 }, // ӛ
+    { 25, 23, 25, 0, 23, 92, 20100 }, // Ӝ
+    { 21, 19, 21, 0, 19, 57, 20192 }, // ӝ
+    { 15, 23, 15, 0, 23, 46, 20249 }, // Ӟ
+    { 12, 19, 12, 0, 19, 38, 20295 }, // ӟ
+    { 14, 17, 15, 0, 17, 34, 20333 }, // Ӡ
+    { 12, 18, 13, 0, 13, 36, 20367 }, // ӡ
+    { 15, 23, 19, 2, 23, 46, 20403 }, // Ӣ
+    { 13, 19, 15, 1, 19, 38, 20449 }, // ӣ
+    { 15, 23, 19, 2, 23, 46, 20487 }, // Ӥ
+    { 13, 19, 15, 1, 19, 38, 20533 }, // ӥ
+    { 18, 23, 20, 1, 23, 69, 20571 }, // Ӧ
+    { 14, 19, 15, 1, 19, 38, 20640 }, // ӧ
+    { 18, 17, 20, 1, 17, 51, 20678 }, // Ө
+    { 14, 13, 15, 1, 13, 26, 20729 }, // ө
+    { 18, 23, 20, 1, 23, 69, 20755 }, // Ӫ
+    { 14, 19, 15, 1, 19, 38, 20824 }, // ӫ
+    { 15, 23, 17, 1, 23, 46, 20862 }, // Ӭ
+    { 13, 19, 13, 0, 19, 38, 20908 }, // ӭ
+    { 17, 23, 16, 0, 23, 69, 20946 }, // Ӯ
+    { 14, 24, 14, 0, 19, 48, 21015 }, // ӯ
+    { 17, 23, 16, 0, 23, 69, 21063 }, // Ӱ
+    { 14, 24, 14, 0, 19, 48, 21132 }, // ӱ
+    { 17, 24, 16, 0, 24, 72, 21180 }, // Ӳ
+    { 14, 25, 14, 0, 20, 50, 21252 }, // ӳ
+    { 14, 23, 17, 1, 23, 46, 21302 }, // Ӵ
+    { 12, 19, 14, 1, 19, 38, 21348 }, // ӵ
+    { 12, 22, 15, 2, 17, 44, 21386 }, // Ӷ
+    { 11, 17, 11, 1, 13, 34, 21430 }, // ӷ
+    { 20, 23, 23, 2, 23, 69, 21464 }, // Ӹ
+    { 18, 19, 21, 1, 19, 57, 21533 }, // ӹ
+    { 13, 3, 13, 0, 9, 6, 21590 }, // –
+    { 25, 3, 25, 0, 9, 12, 21596 }, // —
+    { 25, 3, 25, 0, 9, 12, 21608 }, // ―
+    { 5, 7, 6, 1, 19, 7, 21620 }, // ‘
+    { 6, 7, 6, 0, 19, 7, 21627 }, // ’
+    { 6, 7, 6, 0, 4, 7, 21634 }, // ‚
+    { 10, 7, 11, 1, 19, 14, 21641 }, // “
+    { 11, 7, 11, 0, 19, 14, 21655 }, // ”
+    { 11, 7, 11, 0, 4, 14, 21669 }, // „
+    { 12, 21, 12, 0, 17, 42, 21683 }, // †
+    { 12, 21, 12, 0, 17, 42, 21725 }, // ‡
+    { 9, 7, 9, 0, 12, 14, 21767 }, // •
+    { 23, 5, 25, 1, 5, 15, 21781 }, // …
+    { 33, 17, 33, 0, 17, 85, 21796 }, // ‰
+    { 8, 13, 8, 0, 14, 13, 21881 }, // ‹
+    { 8, 13, 8, 0, 14, 13, 21894 }, // ›
+    { 14, 18, 4, -5, 18, 36, 21907 }, // ⁄
+    { 9, 10, 9, 0, 18, 20, 21943 }, // ⁰
+    { 9, 10, 9, 0, 18, 20, 21963 }, // ⁴
+    { 9, 10, 9, 0, 18, 20, 21983 }, // ⁵
+    { 9, 10, 9, 0, 18, 20, 22003 }, // ⁶
+    { 9, 10, 9, 0, 18, 20, 22023 }, // ⁷
+    { 9, 10, 9, 0, 18, 20, 22043 }, // ⁸
+    { 9, 10, 9, 0, 18, 20, 22063 }, // ⁹
+    { 9, 10, 9, 0, 11, 20, 22083 }, // ₀
+    { 7, 10, 9, 0, 11, 10, 22103 }, // ₁
+    { 9, 10, 9, 0, 11, 20, 22113 }, // ₂
+    { 8, 10, 9, 0, 11, 10, 22133 }, // ₃
+    { 9, 10, 9, 0, 11, 20, 22143 }, // ₄
+    { 9, 10, 9, 0, 11, 20, 22163 }, // ₅
+    { 9, 10, 9, 0, 11, 20, 22183 }, // ₆
+    { 9, 10, 9, 0, 11, 20, 22203 }, // ₇
+    { 9, 10, 9, 0, 11, 20, 22223 }, // ₈
+    { 9, 10, 9, 0, 11, 20, 22243 }, // ₉
+    { 14, 17, 14, 1, 17, 34, 22263 }, // €
+    { 14, 17, 14, 0, 17, 34, 22297 }, // ₮
+    { 14, 17, 14, 0, 17, 34, 22331 }, // ₴
+    { 14, 17, 14, 1, 17, 34, 22365 }, // ₹
+    { 15, 18, 15, 0, 18, 36, 22399 }, // ∂
+    { 18, 17, 17, 0, 17, 51, 22435 }, // ∆
+    { 15, 21, 18, 2, 18, 42, 22486 }, // ∏
+    { 14, 20, 14, 0, 17, 40, 22528 }, // ∑
+    { 12, 3, 14, 1, 9, 6, 22568 }, // −
+    { 14, 18, 4, -5, 18, 36, 22574 }, // ∕
+    { 6, 5, 6, 0, 10, 5, 22610 }, // ∙
+    { 16, 18, 15, 0, 18, 36, 22615 }, // √
+    { 16, 8, 16, 0, 11, 16, 22651 }, // ∞
+    { 10, 25, 10, 0, 19, 50, 22667 }, // ∫
+    { 14, 11, 14, 0, 13, 22, 22717 }, // ≈
+    { 12, 14, 14, 1, 14, 28, 22739 }, // ≠
+    { 12, 15, 14, 1, 15, 30, 22767 }, // ≤
+    { 12, 15, 14, 1, 15, 30, 22797 }, // ≥
 };
 
 static const EpdUnicodeInterval ubuntu_12_boldIntervals[] = {
@@ -1823,6 +2073,19 @@ static const EpdUnicodeInterval ubuntu_12_boldIntervals[] = {
     { 0x2264, 0x2265, 0x24D },
 };
 
+static const EpdFontMetrics ubuntu_12_boldMetrics = {
+    13, 33, 6,
+    -5, 33, 25, -6,
+    {
+        6, 7, 12, 17, 14, 23, 18, 6, 9, 9, 13, 14, 6, 9, 6, 11,
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 6, 6, 14, 14, 14, 11,
+        24, 18, 17, 16, 18, 15, 14, 18, 18, 8, 13, 17, 14, 22, 19, 20,
+        16, 20, 17, 15, 15, 18, 18, 24, 17, 17, 15, 9, 11, 9, 14, 13,
+        7, 14, 15, 13, 15, 15, 11, 15, 15, 7, 7, 14, 8, 22, 15, 15,
+        15, 15, 11, 12, 11, 15, 14, 20, 14, 14, 13, 9, 8, 9, 14,
+    },
+};
+
 static const EpdFontData ubuntu_12_bold = {
     ubuntu_12_boldBitmaps,
     ubuntu_12_boldGlyphs,
@@ -1832,4 +2095,9 @@ static const EpdFontData ubuntu_12_bold = {
     24,
     -5,
     false,
+    nullptr,
+    &ubuntu_12_boldMetrics,
+    nullptr,
+    0,
+    true,
 };
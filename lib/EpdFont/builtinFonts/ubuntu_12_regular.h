@@ -2,1082 +2,1356 @@
  * generated by fontconvert.py
  * name: ubuntu_12_regular
  * size: 12
- * mode: 1-bit
- * Command used: fontconvert.py ubuntu_12_regular 12 ../builtinFonts/source/Ubuntu/Ubuntu-Regular.ttf
+ * mode: 1-bit, row-aligned
+ * Command used: fontconvert.py ubuntu_12_regular 12 ../builtinFonts/source/Ubuntu/Ubuntu-Regular.ttf --row-aligned --no-kerning
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t ubuntu_12_regularBitmaps[17102] = {
-    0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x73, 0x9C, 0xE0, 0x01, 0xDE, 0x70, 0xF7, 0xF7, 0xF7, 0x67, 0x67,
-    0x67, 0x0E, 0x18, 0x1C, 0x70, 0x38, 0xE0, 0x71, 0xC0, 0xC3, 0x9F, 0xFF, 0xFF, 0xFF, 0x8E, 0x38,
-    0x1C, 0x70, 0x30, 0xE3, 0xFF, 0xFF, 0xFF, 0xF3, 0x8E, 0x07, 0x1C, 0x0E, 0x38, 0x38, 0x60, 0x71,
-    0xC0, 0x06, 0x00, 0x60, 0x06, 0x01, 0xFE, 0x7F, 0xE7, 0x8E, 0x70, 0x07, 0x00, 0x70, 0x07, 0x80,
-    0x3E, 0x01, 0xF8, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x00, 0xF7, 0x1F, 0xFF, 0xE7, 0xFC, 0x06,
-    0x00, 0x60, 0x06, 0x00, 0x3E, 0x07, 0x07, 0xF0, 0xE0, 0xF7, 0x0E, 0x0E, 0x31, 0xC0, 0xE3, 0xBC,
-    0x0E, 0x3B, 0x80, 0xE3, 0x70, 0x0F, 0x77, 0x7C, 0x7F, 0xEF, 0xE3, 0xEF, 0xEE, 0x01, 0xDC, 0x60,
-    0x3D, 0xC7, 0x03, 0x9C, 0x70, 0x71, 0xC6, 0x07, 0x1E, 0xE0, 0xE0, 0xFE, 0x0E, 0x07, 0xC0, 0x0F,
-    0x80, 0x3F, 0xC0, 0x3D, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x3B, 0xC0, 0x1F, 0x80, 0x3F,
-    0x00, 0x7F, 0x0C, 0xF3, 0x9C, 0xE1, 0xDC, 0xE0, 0xF8, 0xE0, 0x78, 0xF9, 0xF8, 0x7F, 0xFE, 0x3F,
-    0x8E, 0xFF, 0xF6, 0x66, 0x06, 0x1C, 0x70, 0xE3, 0x87, 0x1E, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E,
-    0x1C, 0x38, 0x70, 0xE1, 0xE1, 0xC3, 0x83, 0x87, 0x07, 0x06, 0xE1, 0xC1, 0xC3, 0x83, 0x87, 0x07,
-    0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xE3, 0x87, 0x0E, 0x1C, 0x38, 0x71, 0xC3, 0x8E, 0x1C, 0x70, 0xE0,
-    0x06, 0x00, 0x60, 0x66, 0x67, 0xFE, 0x7F, 0xE0, 0xF0, 0x1F, 0x81, 0xF8, 0x39, 0xC1, 0x98, 0x06,
-    0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF, 0xFF, 0xF0, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00,
-    0x60, 0x39, 0xDE, 0xE7, 0x39, 0x80, 0xFF, 0xFC, 0xFF, 0xF0, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x1C,
-    0x01, 0xC0, 0x1C, 0x03, 0x80, 0x38, 0x03, 0x80, 0x70, 0x07, 0x00, 0x70, 0x0E, 0x00, 0xE0, 0x0E,
-    0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x38, 0x03, 0x80, 0x38, 0x07, 0x00, 0x70, 0x07, 0x00, 0xE0, 0x00,
-    0x1F, 0x83, 0xFC, 0x79, 0xE7, 0x0E, 0xF0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0,
-    0x7E, 0x07, 0xF0, 0x77, 0x0E, 0x79, 0xE3, 0xFC, 0x1F, 0x80, 0x0F, 0x1F, 0x7F, 0xFF, 0xE7, 0x07,
-    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x3F, 0x87, 0xFC, 0xF3, 0xE4,
-    0x0E, 0x00, 0xE0, 0x0E, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x01, 0xC0, 0x38, 0x07, 0x00,
-    0x70, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0x87, 0xFC, 0x73, 0xC0, 0x1E, 0x00, 0xE0, 0x1E, 0x03, 0xC1,
-    0xF8, 0x1F, 0xC0, 0x7E, 0x00, 0xE0, 0x0F, 0x00, 0xF0, 0x0E, 0xE3, 0xEF, 0xFC, 0xFF, 0x80, 0x01,
-    0xC0, 0x1E, 0x01, 0xF0, 0x1F, 0x80, 0xFC, 0x0E, 0xE0, 0xE7, 0x07, 0x38, 0x71, 0xC3, 0x0E, 0x38,
-    0x71, 0xFF, 0xEF, 0xFF, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x3F, 0xE3, 0xFE, 0x38, 0x03,
-    0x80, 0x30, 0x03, 0x00, 0x7F, 0x07, 0xFC, 0x0F, 0xE0, 0x1E, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0E,
-    0x63, 0xEF, 0xFC, 0x7F, 0x80, 0x03, 0xE0, 0xFE, 0x1F, 0xC3, 0xC0, 0x78, 0x07, 0x00, 0x7F, 0xCF,
-    0xFE, 0xF9, 0xFE, 0x07, 0xE0, 0x7F, 0x07, 0xF0, 0x77, 0x0F, 0x7D, 0xE3, 0xFE, 0x1F, 0x80, 0xFF,
-    0xFF, 0xFF, 0x00, 0xF0, 0x1E, 0x01, 0xC0, 0x3C, 0x03, 0x80, 0x70, 0x07, 0x00, 0x70, 0x0E, 0x00,
-    0xE0, 0x0E, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x00, 0x1F, 0x83, 0xFE, 0x79, 0xE7, 0x0F, 0xF0,
-    0x77, 0x0E, 0x78, 0xE7, 0xFC, 0x3F, 0xC7, 0xFE, 0x71, 0xFE, 0x07, 0xE0, 0x7E, 0x07, 0xF9, 0xF7,
-    0xFE, 0x3F, 0xC0, 0x1F, 0x87, 0xFC, 0x79, 0xEF, 0x0E, 0xE0, 0xFE, 0x07, 0xE0, 0x7F, 0x9F, 0x7F,
-    0xF3, 0xFF, 0x00, 0xE0, 0x0E, 0x01, 0xE0, 0x3C, 0x1F, 0x87, 0xF0, 0x7C, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x7B, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x77, 0xB9, 0xCE, 0x60, 0x00,
-    0x70, 0x1F, 0x0F, 0xE3, 0xF8, 0xFC, 0x0F, 0x00, 0xFC, 0x03, 0xF8, 0x0F, 0xE0, 0x1F, 0x00, 0x70,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0xE0, 0x0F, 0x80, 0x7F, 0x00,
-    0xFC, 0x03, 0xF0, 0x0F, 0x03, 0xF0, 0xFC, 0x7F, 0x0F, 0x80, 0xE0, 0x00, 0x7F, 0x3F, 0xE6, 0x7C,
-    0x0F, 0x01, 0xC0, 0xE0, 0x78, 0x3C, 0x0E, 0x07, 0x01, 0xC0, 0x60, 0x00, 0x00, 0x01, 0xC0, 0xF0,
-    0x1C, 0x00, 0x01, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0xFC, 0xFC, 0x07, 0x80, 0x78, 0x3C, 0x00, 0x71,
-    0xE3, 0xFD, 0xE7, 0x1F, 0xF3, 0x9C, 0xF9, 0xCE, 0xE3, 0x87, 0x3B, 0x8E, 0x1C, 0x6E, 0x78, 0x71,
-    0xB9, 0xE1, 0xCE, 0xE3, 0x87, 0x3B, 0x8E, 0x1C, 0xE7, 0x3C, 0xF7, 0x9C, 0x7F, 0xFC, 0x78, 0xFF,
-    0xE0, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x07, 0xF0, 0x80, 0x07, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x01,
-    0xC0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x77, 0x00, 0x73, 0x80, 0x39, 0xE0, 0x3C, 0x70,
-    0x1C, 0x3C, 0x0E, 0x0E, 0x0F, 0x07, 0x07, 0xFF, 0xC3, 0xFF, 0xE3, 0x80, 0x71, 0xC0, 0x3D, 0xE0,
-    0x0E, 0xE0, 0x07, 0x80, 0xFF, 0xC7, 0xFF, 0x38, 0xFD, 0xC0, 0xEE, 0x07, 0x70, 0x3B, 0x87, 0xDF,
-    0xFC, 0xFF, 0xF7, 0x0F, 0xB8, 0x1F, 0xC0, 0x7E, 0x03, 0xF0, 0x3F, 0x87, 0xDF, 0xFE, 0xFF, 0xC0,
-    0x07, 0xF8, 0x7F, 0xF3, 0xF3, 0xDE, 0x00, 0x78, 0x01, 0xC0, 0x0F, 0x00, 0x38, 0x00, 0xE0, 0x03,
-    0x80, 0x0F, 0x00, 0x3C, 0x00, 0x70, 0x01, 0xE0, 0x03, 0xF1, 0xC7, 0xFF, 0x07, 0xF8, 0xFF, 0xC1,
-    0xFF, 0xC3, 0x87, 0xE7, 0x03, 0xCE, 0x03, 0xDC, 0x03, 0xB8, 0x07, 0xF0, 0x0F, 0xE0, 0x1F, 0xC0,
-    0x3F, 0x80, 0x7F, 0x00, 0xEE, 0x03, 0xDC, 0x0F, 0x38, 0x7E, 0x7F, 0xF0, 0xFF, 0xC0, 0xFF, 0xEF,
-    0xFE, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0F, 0xFC, 0xFF, 0xCE, 0x00, 0xE0, 0x0E, 0x00,
-    0xE0, 0x0E, 0x00, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x80, 0x70, 0x0E, 0x01, 0xC0,
-    0x38, 0x07, 0xFE, 0xFF, 0xDC, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x00,
-    0x07, 0xF8, 0x3F, 0xF8, 0xFC, 0xF3, 0xC0, 0x07, 0x80, 0x0E, 0x00, 0x3C, 0x00, 0x70, 0x00, 0xE0,
-    0x01, 0xC0, 0x3F, 0xC0, 0x7F, 0x80, 0xF7, 0x01, 0xEF, 0x03, 0xCF, 0xC7, 0x8F, 0xFF, 0x07, 0xFC,
-    0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1C, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07,
-    0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x03, 0xF9, 0xF7, 0xFE, 0x7F, 0x00, 0xE0, 0x7B, 0x83,
-    0xCE, 0x1E, 0x38, 0xF0, 0xE7, 0x83, 0xBC, 0x0F, 0xE0, 0x3F, 0x00, 0xFE, 0x03, 0xFC, 0x0E, 0xF8,
-    0x39, 0xF0, 0xE3, 0xE3, 0x87, 0xCE, 0x0F, 0x38, 0x1E, 0xE0, 0x3C, 0xE0, 0x1C, 0x03, 0x80, 0x70,
-    0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07,
-    0xFF, 0xFF, 0xE0, 0x38, 0x01, 0xC7, 0x80, 0x1C, 0x7C, 0x03, 0xC7, 0xC0, 0x3E, 0x7E, 0x06, 0xE7,
-    0x60, 0x6E, 0x77, 0x0C, 0xE7, 0x30, 0xCE, 0x73, 0x1C, 0xE7, 0x39, 0x8E, 0x71, 0x98, 0xE7, 0x1F,
-    0x8E, 0x70, 0xF0, 0xEF, 0x0F, 0x0E, 0xF0, 0xE0, 0xEE, 0x00, 0x0E, 0xE0, 0x00, 0xE0, 0xE0, 0x1D,
-    0xE0, 0x3B, 0xE0, 0x77, 0xE0, 0xEF, 0xC1, 0xDD, 0xC3, 0xBB, 0xC7, 0x73, 0xCE, 0xE3, 0x9D, 0xC3,
-    0xBB, 0x87, 0xF7, 0x07, 0xEE, 0x07, 0xDC, 0x0F, 0xB8, 0x0F, 0x70, 0x0E, 0xE0, 0x1C, 0x07, 0xF8,
-    0x0F, 0xFE, 0x0F, 0xCF, 0x8F, 0x01, 0xE7, 0x00, 0x7B, 0x80, 0x3F, 0xC0, 0x0F, 0xC0, 0x07, 0xE0,
-    0x03, 0xF0, 0x01, 0xFC, 0x00, 0xEE, 0x00, 0xF7, 0x00, 0x7B, 0xC0, 0x78, 0xFC, 0xF8, 0x3F, 0xF8,
-    0x07, 0xF8, 0x00, 0xFF, 0x87, 0xFF, 0x38, 0xFD, 0xC0, 0xEE, 0x07, 0xF0, 0x3F, 0x81, 0xFC, 0x0E,
-    0xE3, 0xF7, 0xFF, 0x3F, 0xF1, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x00, 0x07,
-    0xF8, 0x0F, 0xFE, 0x0F, 0xCF, 0x8F, 0x01, 0xE7, 0x00, 0x7B, 0x80, 0x3F, 0xC0, 0x0F, 0xC0, 0x07,
-    0xE0, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0xEE, 0x00, 0xF7, 0x00, 0x7B, 0xC0, 0x78, 0xFC, 0xF8, 0x3F,
-    0xF8, 0x07, 0xF8, 0x00, 0x70, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x78, 0xFF, 0xC3,
-    0xFF, 0x8E, 0x3F, 0x38, 0x1C, 0xE0, 0x7B, 0x81, 0xEE, 0x07, 0x38, 0x7C, 0xFF, 0xE3, 0xFF, 0x0E,
-    0x3C, 0x38, 0x70, 0xE0, 0xE3, 0x83, 0xCE, 0x07, 0x38, 0x1E, 0xE0, 0x38, 0x1F, 0xE1, 0xFF, 0x9F,
-    0x1C, 0xE0, 0x07, 0x00, 0x3C, 0x00, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x3C, 0x00, 0xF0,
-    0x03, 0x80, 0x3D, 0xE7, 0xCF, 0xFE, 0x3F, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x78, 0x01, 0xE0, 0x07,
-    0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E,
-    0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80,
-    0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0E, 0xE0, 0x3B, 0xC1, 0xE7, 0xCF,
-    0x0F, 0xFC, 0x1F, 0xC0, 0xE0, 0x07, 0x78, 0x03, 0x9C, 0x03, 0xCF, 0x01, 0xC7, 0x80, 0xE1, 0xC0,
-    0xF0, 0xF0, 0x70, 0x38, 0x78, 0x1C, 0x38, 0x0F, 0x1C, 0x03, 0x9E, 0x01, 0xEE, 0x00, 0x7F, 0x00,
-    0x3F, 0x00, 0x0F, 0x80, 0x07, 0x80, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x0E, 0xE0, 0x00, 0x3D, 0xC0,
-    0xE0, 0x73, 0x81, 0xE0, 0xE7, 0x07, 0xC1, 0xCF, 0x0F, 0x83, 0x8E, 0x1F, 0x8F, 0x1C, 0x77, 0x1C,
-    0x38, 0xEE, 0x38, 0x79, 0xCE, 0x70, 0x77, 0x1C, 0xE0, 0xEE, 0x3B, 0x81, 0xDC, 0x3F, 0x03, 0xF0,
-    0x7E, 0x03, 0xE0, 0x78, 0x07, 0x80, 0xF0, 0x0F, 0x01, 0xE0, 0x70, 0x1E, 0x78, 0x1C, 0x3C, 0x3C,
-    0x1C, 0x78, 0x1E, 0x70, 0x0F, 0xF0, 0x07, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0xE0, 0x0F, 0xE0,
-    0x0E, 0xF0, 0x1E, 0x78, 0x3C, 0x3C, 0x38, 0x1C, 0x78, 0x1E, 0xF0, 0x0E, 0xF0, 0x1E, 0xE0, 0x39,
-    0xE0, 0xF1, 0xC1, 0xC3, 0xC7, 0x83, 0xDE, 0x03, 0xB8, 0x07, 0xF0, 0x07, 0xC0, 0x07, 0x00, 0x0E,
-    0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x7F, 0xFD, 0xFF, 0xF0,
-    0x07, 0x80, 0x3C, 0x00, 0xE0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x07, 0x00, 0x3C, 0x01, 0xE0, 0x07,
-    0x00, 0x3C, 0x01, 0xE0, 0x07, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0xFD, 0xFB, 0x87, 0x0E, 0x1C, 0x38,
-    0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x7E, 0xFC,
-    0xE0, 0x07, 0x00, 0x70, 0x07, 0x00, 0x38, 0x03, 0x80, 0x38, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x0E,
-    0x00, 0xE0, 0x0E, 0x00, 0x70, 0x07, 0x00, 0x70, 0x03, 0x80, 0x38, 0x03, 0x80, 0x1C, 0x01, 0xC0,
-    0x1C, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0xFF, 0xF1, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C,
-    0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xFF, 0xFC, 0x0F, 0x00, 0xF0, 0x1F, 0x81, 0xDC, 0x39,
-    0xC7, 0x0E, 0x70, 0xEE, 0x07, 0xE0, 0x70, 0x7F, 0xFD, 0xFF, 0xF0, 0x63, 0xC7, 0x0E, 0x18, 0x7F,
-    0x8F, 0xF9, 0x8F, 0x00, 0xE0, 0x0E, 0x7F, 0xDF, 0xFF, 0xCF, 0xE0, 0xFC, 0x1F, 0xC7, 0xFF, 0xF3,
-    0xFC, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0x8F, 0xFC, 0xF3, 0xEE, 0x0E,
-    0xE0, 0xFE, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0xFE, 0x0E, 0xE3, 0xEF, 0xFC, 0xFF, 0x80, 0x1F, 0xC7,
-    0xF9, 0xF3, 0x38, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1E, 0x01, 0xF3, 0x1F, 0xE1, 0xFC,
-    0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x1F, 0xF3, 0xFF, 0x79, 0xFF, 0x07, 0xE0,
-    0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7F, 0x07, 0x7C, 0x73, 0xFF, 0x1F, 0xF0, 0x1F, 0x83, 0xFE,
-    0x79, 0xEF, 0x0F, 0xE0, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0xE0, 0x0F, 0x00, 0x7C, 0x63, 0xFE, 0x1F,
-    0xE0, 0x3F, 0x7F, 0xF3, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-    0xE0, 0xE0, 0xE0, 0xE0, 0x1F, 0xF3, 0xFF, 0x7C, 0xF7, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07,
-    0xE0, 0x7F, 0x07, 0x7D, 0xF3, 0xFF, 0x1F, 0xF0, 0x07, 0x00, 0xF7, 0x1E, 0x7F, 0xE7, 0xF8, 0xE0,
-    0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x3F, 0xE7, 0xFE, 0xF3, 0xDC, 0x3F, 0x83, 0xF0, 0x7E,
-    0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0x80, 0xFF, 0x00, 0x07, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x1E, 0x3C, 0x00, 0x00, 0x01, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3,
-    0x87, 0x0E, 0x1C, 0x38, 0xF3, 0xDF, 0xBE, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0,
-    0x38, 0x77, 0x1C, 0xEF, 0x1F, 0xC3, 0xF0, 0x7C, 0x0F, 0xC1, 0xFC, 0x3B, 0xC7, 0x3C, 0xE3, 0xDC,
-    0x3B, 0x87, 0x80, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x79,
-    0xF3, 0x80, 0xFF, 0x7F, 0x3F, 0xFF, 0xEE, 0x3E, 0x7F, 0x87, 0x07, 0xE1, 0xC1, 0xF8, 0x70, 0x7E,
-    0x1C, 0x1F, 0x87, 0x07, 0xE1, 0xC1, 0xF8, 0x70, 0x7E, 0x1C, 0x1F, 0x87, 0x07, 0xE1, 0xC1, 0xC0,
-    0xFF, 0x9F, 0xFB, 0x8F, 0x70, 0xFE, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0,
-    0x7E, 0x0E, 0x1F, 0xC1, 0xFF, 0x1E, 0x7C, 0xE0, 0xEE, 0x07, 0xF0, 0x1F, 0x80, 0xFC, 0x07, 0xE0,
-    0x7B, 0x83, 0x9E, 0x7C, 0x7F, 0xC1, 0xFC, 0x00, 0xFF, 0x8F, 0xFC, 0xE3, 0xEE, 0x0E, 0xE0, 0xFE,
-    0x07, 0xE0, 0x7E, 0x07, 0xE0, 0xFE, 0x0E, 0xF3, 0xEF, 0xFC, 0xFF, 0x8E, 0x00, 0xE0, 0x0E, 0x00,
-    0xE0, 0x0E, 0x00, 0x1F, 0xF3, 0xFF, 0x7C, 0x7F, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0,
-    0x7F, 0x07, 0x79, 0xF3, 0xFF, 0x1F, 0xF0, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0xFF, 0xFF,
-    0xE2, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x3F, 0xBF, 0xEF, 0x33, 0x80,
-    0xF0, 0x3F, 0x03, 0xF0, 0x3E, 0x03, 0x80, 0xFE, 0x7B, 0xFE, 0xFF, 0x00, 0x70, 0x78, 0x3C, 0x1E,
-    0x0F, 0xF7, 0xFB, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x03, 0x81, 0xE4, 0xFF, 0x3F, 0x80,
-    0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0x70, 0x77, 0x07, 0x78,
-    0xF3, 0xFF, 0x1F, 0xF0, 0xE0, 0x77, 0x83, 0x9C, 0x1C, 0xE1, 0xC7, 0x8E, 0x1C, 0x70, 0xE7, 0x03,
-    0xB8, 0x1F, 0xC0, 0xFC, 0x03, 0xE0, 0x1E, 0x00, 0x70, 0x00, 0xE0, 0xE0, 0xFE, 0x1C, 0x1D, 0xC3,
-    0xC3, 0xB8, 0x78, 0xE7, 0x1F, 0x1C, 0x73, 0xF3, 0x8E, 0x6E, 0xE1, 0xDD, 0xDC, 0x1F, 0x9B, 0x83,
-    0xE3, 0xE0, 0x7C, 0x7C, 0x07, 0x87, 0x80, 0xE0, 0xE0, 0x70, 0x73, 0xC7, 0x0E, 0x78, 0x3B, 0x81,
-    0xF8, 0x07, 0x80, 0x3C, 0x01, 0xF0, 0x1F, 0xC1, 0xEF, 0x0E, 0x38, 0xE1, 0xEF, 0x07, 0x00, 0xE0,
-    0x7F, 0x07, 0x70, 0x77, 0x0E, 0x78, 0xE3, 0x8E, 0x38, 0xC1, 0xDC, 0x1D, 0xC1, 0xF8, 0x0F, 0x80,
-    0xF8, 0x07, 0x00, 0x70, 0x07, 0x09, 0xE0, 0xFC, 0x0F, 0x80, 0x7F, 0xEF, 0xFC, 0x07, 0x81, 0xE0,
-    0x78, 0x1E, 0x03, 0x80, 0xF0, 0x3C, 0x0F, 0x01, 0xC0, 0x3F, 0xF7, 0xFE, 0x0E, 0x1F, 0x3C, 0x38,
+static const uint8_t ubuntu_12_regularBitmaps[21479] = {
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x00, 0x00, 0x70, 0xF0,
+    0x70, 0xF7, 0xF7, 0xF7, 0x67, 0x67, 0x67, 0x0E, 0x18, 0x0E, 0x38, 0x0E, 0x38, 0x0E, 0x38, 0x0C,
+    0x38, 0xFF, 0xFE, 0xFF, 0xFE, 0x1C, 0x70, 0x1C, 0x70, 0x18, 0x70, 0xFF, 0xFE, 0xFF, 0xFE, 0x38,
+    0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x70, 0xC0, 0x71, 0xC0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x1F,
+    0xE0, 0x7F, 0xE0, 0x78, 0xE0, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x1F,
+    0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0xF0, 0x71, 0xF0, 0xFF, 0xE0, 0x7F,
+    0xC0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x3E, 0x07, 0x00, 0x7F, 0x0E, 0x00, 0xF7, 0x0E, 0x00,
+    0xE3, 0x1C, 0x00, 0xE3, 0xBC, 0x00, 0xE3, 0xB8, 0x00, 0xE3, 0x70, 0x00, 0xF7, 0x77, 0xC0, 0x7F,
+    0xEF, 0xE0, 0x3E, 0xFE, 0xE0, 0x01, 0xDC, 0x60, 0x03, 0xDC, 0x70, 0x03, 0x9C, 0x70, 0x07, 0x1C,
+    0x60, 0x07, 0x1E, 0xE0, 0x0E, 0x0F, 0xE0, 0x0E, 0x07, 0xC0, 0x0F, 0x80, 0x3F, 0xC0, 0x3D, 0xE0,
+    0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x3B, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7F, 0x0C, 0xF3, 0x9C,
+    0xE1, 0xDC, 0xE0, 0xF8, 0xE0, 0x78, 0xF9, 0xF8, 0x7F, 0xFE, 0x3F, 0x8E, 0xF0, 0xF0, 0xF0, 0x60,
+    0x60, 0x60, 0x06, 0x0E, 0x1C, 0x1C, 0x38, 0x38, 0x78, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x70, 0x70, 0x70, 0x70, 0x78, 0x38, 0x38, 0x1C, 0x1C, 0x0E, 0x06, 0xE0, 0xE0, 0x70, 0x70, 0x38,
+    0x38, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1E, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x38, 0x38,
+    0x70, 0x70, 0xE0, 0xE0, 0x06, 0x00, 0x06, 0x00, 0x66, 0x60, 0x7F, 0xE0, 0x7F, 0xE0, 0x0F, 0x00,
+    0x1F, 0x80, 0x1F, 0x80, 0x39, 0xC0, 0x19, 0x80, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+    0x06, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+    0x38, 0x38, 0x78, 0x70, 0x70, 0x70, 0x60, 0xFE, 0xFE, 0xF0, 0xF0, 0xF0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00,
+    0x07, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00,
+    0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0xE0, 0x00, 0x1F, 0x80,
+    0x3F, 0xC0, 0x79, 0xE0, 0x70, 0xE0, 0xF0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70,
+    0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xF0, 0x70, 0x70, 0xE0, 0x79, 0xE0, 0x3F, 0xC0, 0x1F, 0x80,
+    0x0F, 0x1F, 0x7F, 0xFF, 0xE7, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x3F, 0x80, 0x7F, 0xC0, 0xF3, 0xE0, 0x40, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x01, 0xE0, 0x03,
+    0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0x70, 0x00, 0xFF,
+    0xF0, 0xFF, 0xF0, 0x3F, 0x80, 0x7F, 0xC0, 0x73, 0xC0, 0x01, 0xE0, 0x00, 0xE0, 0x01, 0xE0, 0x03,
+    0xC0, 0x1F, 0x80, 0x1F, 0xC0, 0x07, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xE0, 0xE3,
+    0xE0, 0xFF, 0xC0, 0xFF, 0x80, 0x01, 0xC0, 0x03, 0xC0, 0x07, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x1D,
+    0xC0, 0x39, 0xC0, 0x39, 0xC0, 0x71, 0xC0, 0x61, 0xC0, 0xE1, 0xC0, 0xFF, 0xF0, 0xFF, 0xF0, 0x01,
+    0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x3F, 0xE0, 0x3F, 0xE0, 0x38, 0x00, 0x38, 0x00, 0x30,
+    0x00, 0x30, 0x00, 0x7F, 0x00, 0x7F, 0xC0, 0x0F, 0xE0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xE0, 0x63, 0xE0, 0xFF, 0xC0, 0x7F, 0x80, 0x03, 0xE0, 0x0F, 0xE0, 0x1F, 0xC0, 0x3C,
+    0x00, 0x78, 0x00, 0x70, 0x00, 0x7F, 0xC0, 0xFF, 0xE0, 0xF9, 0xF0, 0xE0, 0x70, 0xE0, 0x70, 0xF0,
+    0x70, 0xF0, 0x70, 0x70, 0xF0, 0x7D, 0xE0, 0x3F, 0xE0, 0x1F, 0x80, 0xFF, 0xF0, 0xFF, 0xF0, 0x00,
+    0xF0, 0x01, 0xE0, 0x01, 0xC0, 0x03, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0E,
+    0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1F, 0x80, 0x3F,
+    0xE0, 0x79, 0xE0, 0x70, 0xF0, 0xF0, 0x70, 0x70, 0xE0, 0x78, 0xE0, 0x7F, 0xC0, 0x3F, 0xC0, 0x7F,
+    0xE0, 0x71, 0xF0, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xF9, 0xF0, 0x7F, 0xE0, 0x3F, 0xC0, 0x1F,
+    0x80, 0x7F, 0xC0, 0x79, 0xE0, 0xF0, 0xE0, 0xE0, 0xF0, 0xE0, 0x70, 0xE0, 0x70, 0xF9, 0xF0, 0x7F,
+    0xF0, 0x3F, 0xF0, 0x00, 0xE0, 0x00, 0xE0, 0x01, 0xE0, 0x03, 0xC0, 0x1F, 0x80, 0x7F, 0x00, 0x7C,
+    0x00, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF0, 0x78, 0x78,
+    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x78, 0x70, 0x70, 0x70, 0x60, 0x00,
+    0x70, 0x01, 0xF0, 0x0F, 0xE0, 0x3F, 0x80, 0xFC, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0x0F,
+    0xE0, 0x01, 0xF0, 0x00, 0x70, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xF0, 0xFF, 0xF0, 0xE0, 0x00, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xF0, 0x03,
+    0xF0, 0x0F, 0xC0, 0x7F, 0x00, 0xF8, 0x00, 0xE0, 0x00, 0x7F, 0x00, 0xFF, 0x80, 0x67, 0xC0, 0x03,
+    0xC0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x80, 0x0F, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x18,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xFF,
+    0x80, 0x0F, 0xCF, 0xC0, 0x1E, 0x01, 0xE0, 0x3C, 0x00, 0x70, 0x78, 0xFF, 0x78, 0x71, 0xFF, 0x38,
+    0x73, 0xE7, 0x38, 0xE3, 0x87, 0x38, 0xE3, 0x87, 0x18, 0xE7, 0x87, 0x18, 0xE7, 0x87, 0x38, 0xE3,
+    0x87, 0x38, 0xE3, 0x87, 0x38, 0x73, 0xCF, 0x78, 0x71, 0xFF, 0xF0, 0x78, 0xFF, 0xE0, 0x3C, 0x00,
+    0x00, 0x1E, 0x00, 0x00, 0x1F, 0xC2, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xC0, 0x00,
+    0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0x70, 0x00, 0x0E, 0x70, 0x00, 0x0E,
+    0x78, 0x00, 0x1E, 0x38, 0x00, 0x1C, 0x3C, 0x00, 0x1C, 0x1C, 0x00, 0x3C, 0x1C, 0x00, 0x3F, 0xFE,
+    0x00, 0x3F, 0xFE, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0F, 0x00, 0xF0, 0x07, 0x00, 0xE0, 0x07, 0x80,
+    0xFF, 0xC0, 0xFF, 0xE0, 0xE3, 0xF0, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE1, 0xF0, 0xFF, 0xE0,
+    0xFF, 0xF0, 0xE1, 0xF0, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x78, 0xE1, 0xF0, 0xFF, 0xF0,
+    0xFF, 0xC0, 0x07, 0xF8, 0x1F, 0xFC, 0x3F, 0x3C, 0x78, 0x00, 0x78, 0x00, 0x70, 0x00, 0xF0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x78, 0x00, 0x3F, 0x1C,
+    0x1F, 0xFC, 0x07, 0xF8, 0xFF, 0xC0, 0xFF, 0xE0, 0xE1, 0xF8, 0xE0, 0x78, 0xE0, 0x3C, 0xE0, 0x1C,
+    0xE0, 0x1E, 0xE0, 0x1E, 0xE0, 0x1E, 0xE0, 0x1E, 0xE0, 0x1E, 0xE0, 0x1C, 0xE0, 0x3C, 0xE0, 0x78,
+    0xE1, 0xF8, 0xFF, 0xE0, 0xFF, 0xC0, 0xFF, 0xE0, 0xFF, 0xE0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xE0, 0xFF, 0xE0, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x07, 0xF8, 0x1F, 0xFC, 0x3F, 0x3C,
+    0x78, 0x00, 0x78, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x1E, 0xF0, 0x1E,
+    0xF0, 0x1E, 0x70, 0x1E, 0x78, 0x1E, 0x3F, 0x1E, 0x1F, 0xFE, 0x07, 0xFC, 0xE0, 0x1C, 0xE0, 0x1C,
+    0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xFF, 0xFC, 0xFF, 0xFC, 0xE0, 0x1C,
+    0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x01, 0xE0, 0xE7, 0xC0, 0xFF, 0xC0, 0x7F,
+    0x00, 0xE0, 0x78, 0xE0, 0xF0, 0xE1, 0xE0, 0xE3, 0xC0, 0xE7, 0x80, 0xEF, 0x00, 0xFE, 0x00, 0xFC,
+    0x00, 0xFE, 0x00, 0xFF, 0x00, 0xEF, 0x80, 0xE7, 0xC0, 0xE3, 0xE0, 0xE1, 0xF0, 0xE0, 0xF0, 0xE0,
+    0x78, 0xE0, 0x3C, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0x38, 0x01, 0xC0, 0x78, 0x01, 0xC0, 0x7C, 0x03, 0xC0, 0x7C, 0x03,
+    0xE0, 0x7E, 0x06, 0xE0, 0x76, 0x06, 0xE0, 0x77, 0x0C, 0xE0, 0x73, 0x0C, 0xE0, 0x73, 0x1C, 0xE0,
+    0x73, 0x98, 0xE0, 0x71, 0x98, 0xE0, 0x71, 0xF8, 0xE0, 0x70, 0xF0, 0xE0, 0xF0, 0xF0, 0xE0, 0xF0,
+    0xE0, 0xE0, 0xE0, 0x00, 0xE0, 0xE0, 0x00, 0xE0, 0xE0, 0x1C, 0xF0, 0x1C, 0xF8, 0x1C, 0xFC, 0x1C,
+    0xFC, 0x1C, 0xEE, 0x1C, 0xEF, 0x1C, 0xE7, 0x9C, 0xE3, 0x9C, 0xE1, 0xDC, 0xE1, 0xFC, 0xE0, 0xFC,
+    0xE0, 0x7C, 0xE0, 0x7C, 0xE0, 0x3C, 0xE0, 0x1C, 0xE0, 0x1C, 0x07, 0xF8, 0x00, 0x1F, 0xFC, 0x00,
+    0x3F, 0x3E, 0x00, 0x78, 0x0F, 0x00, 0x70, 0x07, 0x80, 0x70, 0x07, 0x80, 0xF0, 0x03, 0x80, 0xE0,
+    0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xF0, 0x03, 0x80, 0x70, 0x07, 0x80, 0x70, 0x07,
+    0x80, 0x78, 0x0F, 0x00, 0x3F, 0x3E, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0xFF, 0x80, 0xFF,
+    0xE0, 0xE3, 0xF0, 0xE0, 0x70, 0xE0, 0x78, 0xE0, 0x78, 0xE0, 0x78, 0xE0, 0x70, 0xE3, 0xF0, 0xFF,
+    0xE0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x07,
+    0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x3E, 0x00, 0x78, 0x0F, 0x00, 0x70, 0x07, 0x80, 0x70, 0x07,
+    0x80, 0xF0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xF0, 0x03, 0x80,
+    0x70, 0x07, 0x80, 0x70, 0x07, 0x80, 0x78, 0x0F, 0x00, 0x3F, 0x3E, 0x00, 0x1F, 0xFC, 0x00, 0x07,
+    0xF8, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
+    0x00, 0xFF, 0xC0, 0xFF, 0xE0, 0xE3, 0xF0, 0xE0, 0x70, 0xE0, 0x78, 0xE0, 0x78, 0xE0, 0x70, 0xE1,
+    0xF0, 0xFF, 0xE0, 0xFF, 0xC0, 0xE3, 0xC0, 0xE1, 0xC0, 0xE0, 0xE0, 0xE0, 0xF0, 0xE0, 0x70, 0xE0,
+    0x78, 0xE0, 0x38, 0x1F, 0xE0, 0x3F, 0xF0, 0x7C, 0x70, 0x70, 0x00, 0x70, 0x00, 0x78, 0x00, 0x3E,
+    0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x38, 0x00, 0x78, 0x79,
+    0xF0, 0x7F, 0xF0, 0x3F, 0xC0, 0xFF, 0xFC, 0xFF, 0xFC, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07,
+    0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07,
+    0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0,
+    0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x38, 0xE0,
+    0x38, 0xF0, 0x78, 0x7C, 0xF0, 0x3F, 0xF0, 0x1F, 0xC0, 0xE0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0x70,
+    0x0F, 0x00, 0x78, 0x0E, 0x00, 0x78, 0x0E, 0x00, 0x38, 0x1E, 0x00, 0x3C, 0x1C, 0x00, 0x1C, 0x3C,
+    0x00, 0x1C, 0x38, 0x00, 0x1E, 0x38, 0x00, 0x0E, 0x78, 0x00, 0x0F, 0x70, 0x00, 0x07, 0xF0, 0x00,
+    0x07, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x0E, 0x70,
+    0x00, 0x1E, 0x70, 0x38, 0x1C, 0x70, 0x3C, 0x1C, 0x70, 0x7C, 0x1C, 0x78, 0x7C, 0x1C, 0x38, 0x7E,
+    0x3C, 0x38, 0xEE, 0x38, 0x38, 0xEE, 0x38, 0x3C, 0xE7, 0x38, 0x1D, 0xC7, 0x38, 0x1D, 0xC7, 0x70,
+    0x1D, 0xC3, 0xF0, 0x1F, 0x83, 0xF0, 0x0F, 0x81, 0xE0, 0x0F, 0x01, 0xE0, 0x0F, 0x01, 0xE0, 0x70,
+    0x1E, 0x78, 0x1C, 0x3C, 0x3C, 0x1C, 0x78, 0x1E, 0x70, 0x0F, 0xF0, 0x07, 0xE0, 0x03, 0xC0, 0x03,
+    0xC0, 0x07, 0xE0, 0x0F, 0xE0, 0x0E, 0xF0, 0x1E, 0x78, 0x3C, 0x3C, 0x38, 0x1C, 0x78, 0x1E, 0xF0,
+    0x0E, 0xF0, 0x1E, 0x70, 0x1C, 0x78, 0x3C, 0x38, 0x38, 0x3C, 0x78, 0x1E, 0xF0, 0x0E, 0xE0, 0x0F,
+    0xE0, 0x07, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03,
+    0x80, 0x03, 0x80, 0x7F, 0xFC, 0x7F, 0xFC, 0x00, 0x78, 0x00, 0xF0, 0x00, 0xE0, 0x01, 0xE0, 0x03,
+    0xC0, 0x07, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x70,
+    0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFC, 0xFC, 0xE0, 0x00,
+    0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x1C, 0x00,
+    0x1C, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x03, 0x80,
+    0x03, 0x80, 0x03, 0x80, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0xFC, 0xFC, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFC, 0xFC, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x80, 0x1D,
+    0xC0, 0x39, 0xC0, 0x70, 0xE0, 0x70, 0xE0, 0xE0, 0x70, 0xE0, 0x70, 0x7F, 0xFC, 0x7F, 0xFC, 0x60,
+    0xF0, 0x70, 0x38, 0x18, 0x7F, 0x80, 0x7F, 0xC0, 0x63, 0xC0, 0x01, 0xC0, 0x00, 0xE0, 0x3F, 0xE0,
+    0x7F, 0xE0, 0xF9, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xE0, 0xFF, 0xE0, 0x3F, 0xC0, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xF3, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xF0, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0xF0, 0xE0, 0xE0, 0xE3, 0xE0,
+    0xFF, 0xC0, 0xFF, 0x80, 0x1F, 0xC0, 0x3F, 0xC0, 0x7C, 0xC0, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0x7C, 0xC0, 0x3F, 0xC0, 0x1F, 0xC0, 0x00, 0x70,
+    0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x1F, 0xF0, 0x3F, 0xF0, 0x79, 0xF0,
+    0xF0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xF0, 0x70, 0x7C, 0x70,
+    0x3F, 0xF0, 0x1F, 0xF0, 0x1F, 0x80, 0x3F, 0xE0, 0x79, 0xE0, 0xF0, 0xF0, 0xE0, 0x70, 0xFF, 0xF0,
+    0xFF, 0xF0, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0x7C, 0x60, 0x3F, 0xE0, 0x1F, 0xE0, 0x3F, 0x7F,
+    0xF3, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0x1F, 0xF0, 0x3F, 0xF0, 0x7C, 0xF0, 0x70, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
+    0x70, 0xE0, 0x70, 0xF0, 0x70, 0x7D, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x00, 0x70, 0x00, 0xF0, 0x71,
+    0xE0, 0x7F, 0xE0, 0x7F, 0x80, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xF3, 0xC0, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0x00, 0x00, 0x00,
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x1E, 0x1E, 0x00,
+    0x00, 0x00, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+    0x1E, 0x3C, 0xFC, 0xF8, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE1, 0xC0, 0xE3, 0x80, 0xEF, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0xFE, 0x00,
+    0xEF, 0x00, 0xE7, 0x80, 0xE3, 0xC0, 0xE1, 0xC0, 0xE1, 0xE0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x78, 0x7C, 0x38, 0xFF, 0x7F, 0x00,
+    0xFF, 0xFF, 0x80, 0xE3, 0xE7, 0xC0, 0xE1, 0xC1, 0xC0, 0xE1, 0xC1, 0xC0, 0xE1, 0xC1, 0xC0, 0xE1,
+    0xC1, 0xC0, 0xE1, 0xC1, 0xC0, 0xE1, 0xC1, 0xC0, 0xE1, 0xC1, 0xC0, 0xE1, 0xC1, 0xC0, 0xE1, 0xC1,
+    0xC0, 0xE1, 0xC1, 0xC0, 0xFF, 0x80, 0xFF, 0xC0, 0xE3, 0xC0, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x1F, 0xC0,
+    0x3F, 0xE0, 0x79, 0xF0, 0x70, 0x70, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x78,
+    0x70, 0x70, 0x79, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0xFF, 0x80, 0xFF, 0xC0, 0xE3, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xF0, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0xF0, 0xE0, 0xE0, 0xF3, 0xE0, 0xFF, 0xC0,
+    0xFF, 0x80, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x1F, 0xF0, 0x3F, 0xF0,
+    0x7C, 0x70, 0xF0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xF0, 0x70,
+    0x79, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70,
+    0xFF, 0xFF, 0xE2, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x3F, 0x80, 0xFF,
+    0x80, 0xF3, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x03, 0x80, 0x03,
+    0xC0, 0xE7, 0x80, 0xFF, 0x80, 0xFF, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF,
+    0x00, 0xFF, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0x70, 0x00, 0x79, 0x00, 0x7F, 0x80, 0x3F, 0x80, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0,
+    0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x78, 0xF0, 0x3F,
+    0xF0, 0x1F, 0xF0, 0xE0, 0x70, 0xF0, 0x70, 0x70, 0x70, 0x70, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x39,
+    0xC0, 0x1D, 0xC0, 0x1F, 0xC0, 0x1F, 0x80, 0x0F, 0x80, 0x0F, 0x00, 0x07, 0x00, 0xE0, 0xE0, 0xE0,
+    0xF0, 0xE0, 0xE0, 0x70, 0xF0, 0xE0, 0x70, 0xF1, 0xC0, 0x71, 0xF1, 0xC0, 0x39, 0xF9, 0xC0, 0x39,
+    0xBB, 0x80, 0x3B, 0xBB, 0x80, 0x1F, 0x9B, 0x80, 0x1F, 0x1F, 0x00, 0x1F, 0x1F, 0x00, 0x0F, 0x0F,
+    0x00, 0x0E, 0x0E, 0x00, 0x70, 0x70, 0x78, 0xE0, 0x39, 0xE0, 0x1D, 0xC0, 0x1F, 0x80, 0x0F, 0x00,
+    0x0F, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x3D, 0xE0, 0x38, 0xE0, 0x70, 0xF0, 0xF0, 0x70, 0xE0, 0x70,
+    0xF0, 0x70, 0x70, 0x70, 0x70, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xC0, 0x1D, 0xC0, 0x1D, 0xC0,
+    0x1F, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x9E, 0x00, 0xFC, 0x00,
+    0xF8, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x0E, 0x00,
+    0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x70, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x0E, 0x1F, 0x3C, 0x38,
     0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x70, 0xE0, 0xF0, 0x78, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x38, 0x38, 0x3C, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xF0,
-    0xF8, 0x78, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x18, 0x1C, 0x1E, 0x0F, 0x1F, 0x1E, 0x1C, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0xF8, 0xF0, 0x7C, 0x3F, 0xF7, 0xEF, 0xFC, 0x3E, 0x77, 0x9C,
-    0x00, 0x39, 0xCE, 0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x73, 0x80, 0x06, 0x01, 0x80, 0x60, 0x7F, 0x3F,
-    0xDF, 0x3F, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xF0, 0x1F, 0x33, 0xFC, 0x7F, 0x06, 0x01,
-    0x80, 0x60, 0x07, 0xF0, 0xFF, 0x1E, 0x61, 0xC0, 0x1C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0xFF, 0xCF,
-    0xFC, 0x3C, 0x03, 0x80, 0x38, 0x03, 0x80, 0x38, 0x03, 0xFF, 0x3F, 0xF0, 0x60, 0x7F, 0xFF, 0x7F,
-    0xE7, 0x9E, 0x70, 0xE7, 0x06, 0x70, 0x67, 0x0E, 0x79, 0xE7, 0xFE, 0xFF, 0xF6, 0x07, 0xF0, 0x3D,
-    0xC0, 0xE7, 0x87, 0x8E, 0x1C, 0x1C, 0xE0, 0x7B, 0x80, 0xFC, 0x01, 0xF0, 0x7F, 0xF9, 0xFF, 0xE0,
-    0x38, 0x00, 0xE0, 0x7F, 0xF9, 0xFF, 0xE0, 0x38, 0x00, 0xE0, 0x03, 0x80, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xCF, 0xF9, 0xE7, 0x38, 0x07, 0x00, 0xF8, 0x1F, 0xC7,
-    0xFE, 0xE3, 0xDC, 0x1F, 0x83, 0xF8, 0xE7, 0xFC, 0x7F, 0x01, 0xF0, 0x0E, 0x01, 0xDC, 0x7B, 0xFE,
-    0x7F, 0x80, 0x73, 0xBB, 0xDC, 0xE0, 0x07, 0xF8, 0x03, 0xFF, 0x81, 0xF3, 0xF0, 0xE0, 0x1E, 0x73,
-    0xFB, 0x9D, 0xFE, 0x7E, 0x7B, 0x1F, 0xB8, 0x07, 0xEE, 0x00, 0xFB, 0x80, 0x7E, 0x79, 0x9D, 0xDF,
-    0xE7, 0x73, 0xFB, 0x8E, 0x01, 0xE1, 0xF1, 0xF0, 0x3F, 0xF8, 0x07, 0xF8, 0x00, 0x3F, 0x1F, 0x88,
-    0xE7, 0xF7, 0xFB, 0x9D, 0xCE, 0xFF, 0x3F, 0x80, 0x0C, 0x61, 0xCF, 0x3C, 0xE3, 0x9C, 0x7B, 0xC7,
-    0x38, 0x7B, 0xC3, 0x9C, 0x3C, 0xE1, 0xCF, 0x0C, 0x60, 0xFF, 0xFF, 0xFF, 0x00, 0x70, 0x07, 0x00,
-    0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0xFF, 0xFC, 0x07, 0xF8, 0x03, 0xFF, 0x81, 0xF3, 0xF0,
-    0xE0, 0x1E, 0x77, 0xF3, 0x9D, 0xFE, 0x7E, 0x73, 0x9F, 0x9C, 0xE7, 0xE7, 0xF8, 0xF9, 0xFC, 0x7E,
-    0x77, 0x1D, 0xDC, 0xE7, 0x77, 0x1F, 0x8E, 0x01, 0xE1, 0xF1, 0xF0, 0x3F, 0xF8, 0x07, 0xF8, 0x00,
-    0xFF, 0xFF, 0x3E, 0x7E, 0xF7, 0xE3, 0xF7, 0x7E, 0x3E, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x00, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x7E, 0x7F, 0x67, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0x7F, 0x7F, 0x7E, 0x7E, 0x6F, 0x3E, 0x3E, 0x0F,
-    0x07, 0x67, 0x7F, 0x7E, 0x19, 0xDD, 0xCC, 0x00, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1,
-    0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0xE7, 0xFF, 0xFF, 0xFF, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C,
-    0x00, 0x1F, 0xF9, 0xFF, 0xDF, 0xCF, 0xFE, 0x7F, 0xF3, 0xFF, 0x9F, 0xFC, 0xFF, 0xE7, 0xFF, 0x3B,
-    0xF9, 0xC7, 0xCE, 0x06, 0x70, 0x33, 0x81, 0x9C, 0x0C, 0xE0, 0x67, 0x03, 0x38, 0x19, 0xC0, 0xCE,
-    0x06, 0x70, 0x33, 0x81, 0x9C, 0xFF, 0xF0, 0x38, 0xE3, 0x87, 0x7F, 0xE0, 0x3B, 0xFF, 0xF1, 0x8C,
-    0x63, 0x18, 0xC0, 0x3E, 0x1F, 0xCF, 0x7B, 0x86, 0xC1, 0xB8, 0x6F, 0x79, 0xFC, 0x3E, 0x00, 0xC7,
-    0x1C, 0xE1, 0xCE, 0x3D, 0xE3, 0x9C, 0x7B, 0xCE, 0x73, 0xDE, 0x73, 0x9C, 0xE3, 0x1C, 0x00, 0x38,
-    0x00, 0x03, 0xC0, 0x38, 0x3E, 0x03, 0x81, 0xF0, 0x1C, 0x01, 0x81, 0xC0, 0x0C, 0x0E, 0x00, 0x60,
-    0xE0, 0x03, 0x07, 0x00, 0x18, 0x70, 0xE0, 0xC7, 0x0F, 0x00, 0x38, 0x78, 0x03, 0x87, 0xC0, 0x1C,
-    0x76, 0x01, 0xC3, 0x30, 0x0E, 0x3F, 0xE0, 0xE1, 0xFF, 0x0E, 0x00, 0x60, 0x70, 0x03, 0x00, 0x38,
-    0x00, 0x07, 0x80, 0xE0, 0xF8, 0x0E, 0x0F, 0x81, 0xC0, 0x18, 0x1C, 0x01, 0x83, 0x80, 0x18, 0x38,
-    0x01, 0x87, 0x00, 0x18, 0xE7, 0xE1, 0x8E, 0xFE, 0x01, 0xC6, 0x70, 0x1C, 0x06, 0x03, 0x80, 0xE0,
-    0x38, 0x1C, 0x07, 0x03, 0x80, 0xE0, 0x70, 0x0E, 0x07, 0xF1, 0xC0, 0x7F, 0x7E, 0x00, 0x01, 0xF8,
-    0x0E, 0x06, 0xF0, 0x38, 0x0F, 0x81, 0xC0, 0x3E, 0x07, 0x00, 0x3C, 0x38, 0x00, 0x71, 0xC0, 0x19,
-    0xC7, 0x00, 0x7F, 0x38, 0x71, 0xF8, 0xE3, 0xC0, 0x07, 0x0F, 0x00, 0x1C, 0x7C, 0x00, 0xE3, 0xB0,
-    0x07, 0x0C, 0xC0, 0x1C, 0x7F, 0xC0, 0xE1, 0xFF, 0x03, 0x80, 0x30, 0x1C, 0x00, 0xC0, 0x0E, 0x03,
-    0xC0, 0xE0, 0x00, 0x00, 0x01, 0x80, 0xE0, 0x38, 0x1E, 0x0F, 0x03, 0x81, 0xC0, 0x70, 0x3C, 0x0F,
-    0x01, 0xE6, 0x7F, 0xCF, 0xE0, 0x07, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x0C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0xE0, 0x01, 0xF0, 0x01, 0xF8, 0x00, 0xEE, 0x00, 0xE7,
-    0x00, 0x73, 0xC0, 0x78, 0xE0, 0x38, 0x78, 0x1C, 0x1C, 0x1E, 0x0E, 0x0F, 0xFF, 0x87, 0xFF, 0xC7,
-    0x00, 0xE3, 0x80, 0x7B, 0xC0, 0x1D, 0xC0, 0x0F, 0x00, 0x60, 0x00, 0x70, 0x00, 0x78, 0x00, 0x38,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0xE0, 0x01, 0xF0, 0x01, 0xF8, 0x00,
-    0xEE, 0x00, 0xE7, 0x00, 0x73, 0xC0, 0x78, 0xE0, 0x38, 0x78, 0x1C, 0x1C, 0x1E, 0x0E, 0x0F, 0xFF,
-    0x87, 0xFF, 0xC7, 0x00, 0xE3, 0x80, 0x7B, 0xC0, 0x1D, 0xC0, 0x0F, 0x01, 0x80, 0x01, 0xE0, 0x00,
-    0xF8, 0x00, 0xEE, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0xE0, 0x01, 0xF0,
-    0x01, 0xF8, 0x00, 0xEE, 0x00, 0xE7, 0x00, 0x73, 0xC0, 0x78, 0xE0, 0x38, 0x78, 0x1C, 0x1C, 0x1E,
-    0x0E, 0x0F, 0xFF, 0x87, 0xFF, 0xC7, 0x00, 0xE3, 0x80, 0x7B, 0xC0, 0x1D, 0xC0, 0x0F, 0x07, 0xB8,
-    0x07, 0xF8, 0x03, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0xC0, 0x03,
-    0xE0, 0x03, 0xF0, 0x01, 0xDC, 0x01, 0xCE, 0x00, 0xE7, 0x80, 0xF1, 0xC0, 0x70, 0xF0, 0x38, 0x38,
-    0x3C, 0x1C, 0x1F, 0xFF, 0x0F, 0xFF, 0x8E, 0x01, 0xC7, 0x00, 0xF7, 0x80, 0x3B, 0x80, 0x1E, 0x0E,
-    0x70, 0x07, 0xB8, 0x03, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0F, 0x80, 0x07, 0xC0,
-    0x07, 0xE0, 0x03, 0xB8, 0x03, 0x9C, 0x01, 0xCF, 0x01, 0xE3, 0x80, 0xE1, 0xE0, 0x70, 0x70, 0x78,
-    0x38, 0x3F, 0xFE, 0x1F, 0xFF, 0x1C, 0x03, 0x8E, 0x01, 0xEF, 0x00, 0x77, 0x00, 0x3C, 0x03, 0xC0,
-    0x01, 0xB0, 0x01, 0x98, 0x00, 0xEC, 0x00, 0x3E, 0x00, 0x1E, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x07,
-    0x70, 0x07, 0x38, 0x03, 0x9E, 0x03, 0xC7, 0x01, 0xC3, 0xC0, 0xE0, 0xE0, 0xF0, 0x70, 0x7F, 0xFC,
-    0x7F, 0xFE, 0x38, 0x07, 0x1C, 0x03, 0xDE, 0x00, 0xEE, 0x00, 0x78, 0x00, 0x3F, 0xFC, 0x00, 0xFF,
-    0xF8, 0x03, 0xF8, 0x00, 0x07, 0x70, 0x00, 0x1E, 0xE0, 0x00, 0x39, 0xC0, 0x00, 0xE3, 0x80, 0x03,
-    0xC7, 0xFC, 0x07, 0x0F, 0xF8, 0x1C, 0x1C, 0x00, 0x78, 0x38, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xE0,
-    0x07, 0x01, 0xC0, 0x1E, 0x03, 0x80, 0x38, 0x07, 0xFF, 0xE0, 0x0F, 0xFE, 0x07, 0xF8, 0x7F, 0xF3,
-    0xF3, 0xDE, 0x00, 0x78, 0x01, 0xC0, 0x0F, 0x00, 0x38, 0x00, 0xE0, 0x03, 0x80, 0x0F, 0x00, 0x3C,
-    0x00, 0x70, 0x01, 0xE0, 0x03, 0xF1, 0xC7, 0xFF, 0x07, 0xF8, 0x06, 0x00, 0x3C, 0x00, 0x70, 0x01,
-    0xC0, 0x1F, 0x00, 0x7C, 0x00, 0x18, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0xFF, 0xEE, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xCF, 0xFC, 0xE0, 0x0E, 0x00,
-    0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x80, 0x38, 0x07, 0x00, 0xE0, 0x0C,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xEE, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xCF,
-    0xFC, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xE0,
-    0x1F, 0x03, 0xB8, 0x31, 0x80, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xEE, 0x00, 0xE0, 0x0E, 0x00, 0xE0,
-    0x0E, 0x00, 0xFF, 0xCF, 0xFC, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xFF,
-    0xFF, 0x3B, 0x87, 0xBC, 0x3B, 0x80, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xEE, 0x00, 0xE0, 0x0E, 0x00,
-    0xE0, 0x0E, 0x00, 0xFF, 0xCF, 0xFC, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF,
-    0xFF, 0xFF, 0xE3, 0xC7, 0x0E, 0x18, 0x00, 0x0E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3,
-    0x8E, 0x38, 0xE3, 0x8E, 0x18, 0xE7, 0x9C, 0x60, 0x00, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C,
-    0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x18, 0x1C, 0x3E, 0x77, 0x63, 0x00, 0x00, 0x1C, 0x1C, 0x1C,
-    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x67, 0x7B,
-    0xD9, 0xC0, 0x00, 0x00, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38,
-    0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x3F, 0xF0, 0x1F, 0xFE, 0x0E, 0x1F, 0x87, 0x01, 0xE3,
-    0x80, 0x71, 0xC0, 0x3C, 0xE0, 0x0F, 0xFF, 0x07, 0xFF, 0x83, 0x9C, 0x01, 0xCE, 0x00, 0xE7, 0x00,
-    0xF3, 0x80, 0x71, 0xC0, 0x78, 0xE1, 0xF8, 0x7F, 0xF8, 0x3F, 0xF0, 0x00, 0x0F, 0x60, 0x3F, 0xC0,
-    0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x07, 0x78, 0x0E, 0xF8, 0x1D, 0xF8, 0x3B, 0xF0,
-    0x77, 0x70, 0xEE, 0xF1, 0xDC, 0xF3, 0xB8, 0xE7, 0x70, 0xEE, 0xE1, 0xFD, 0xC1, 0xFB, 0x81, 0xF7,
-    0x03, 0xEE, 0x03, 0xDC, 0x03, 0xB8, 0x07, 0x00, 0x03, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x38,
-    0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xFC, 0x1F, 0x9F, 0x1E, 0x03, 0xCE,
-    0x00, 0xF7, 0x00, 0x7F, 0x80, 0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF8, 0x01, 0xDC, 0x01,
-    0xEE, 0x00, 0xF7, 0x80, 0xF1, 0xF9, 0xF0, 0x7F, 0xF0, 0x0F, 0xF0, 0x00, 0x70, 0x00, 0x38, 0x00,
-    0x38, 0x00, 0x38, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xFC, 0x1F, 0x9F,
-    0x1E, 0x03, 0xCE, 0x00, 0xF7, 0x00, 0x7F, 0x80, 0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF8,
-    0x01, 0xDC, 0x01, 0xEE, 0x00, 0xF7, 0x80, 0xF1, 0xF9, 0xF0, 0x7F, 0xF0, 0x0F, 0xF0, 0x00, 0xC0,
-    0x00, 0xF0, 0x00, 0xF8, 0x00, 0xEE, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x1F,
-    0xFC, 0x1F, 0x9F, 0x1E, 0x03, 0xCE, 0x00, 0xF7, 0x00, 0x7F, 0x80, 0x1F, 0x80, 0x0F, 0xC0, 0x07,
-    0xE0, 0x03, 0xF8, 0x01, 0xDC, 0x01, 0xEE, 0x00, 0xF7, 0x80, 0xF1, 0xF9, 0xF0, 0x7F, 0xF0, 0x0F,
-    0xF0, 0x07, 0xD8, 0x03, 0xFC, 0x03, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x3F, 0xF8, 0x3F, 0x3E, 0x3C, 0x07, 0x9C, 0x01, 0xEE, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0x1F, 0x80,
-    0x0F, 0xC0, 0x07, 0xF0, 0x03, 0xB8, 0x03, 0xDC, 0x01, 0xEF, 0x01, 0xE3, 0xF3, 0xE0, 0xFF, 0xE0,
-    0x1F, 0xE0, 0x07, 0x38, 0x03, 0xBC, 0x01, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F,
-    0xF0, 0x7E, 0x7C, 0x78, 0x0F, 0x38, 0x03, 0xDC, 0x01, 0xFE, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F,
-    0x80, 0x0F, 0xE0, 0x07, 0x70, 0x07, 0xB8, 0x03, 0xDE, 0x03, 0xC7, 0xE7, 0xC1, 0xFF, 0xC0, 0x3F,
-    0xC0, 0x40, 0x9C, 0x3B, 0xCF, 0x3F, 0xC3, 0xF0, 0x3C, 0x0F, 0xC3, 0xFC, 0xF3, 0xDC, 0x39, 0x02,
-    0x00, 0x00, 0x03, 0x03, 0xFD, 0xC7, 0xFF, 0xC7, 0xE7, 0xC7, 0x81, 0xF3, 0x81, 0xF9, 0xC0, 0xFF,
-    0xE0, 0xE7, 0xE0, 0xE3, 0xF0, 0xE1, 0xF8, 0xF0, 0xFE, 0xF0, 0x77, 0x70, 0x3B, 0xF0, 0x3D, 0xF0,
-    0x3C, 0x7E, 0x7C, 0x7F, 0xFC, 0x3B, 0xFC, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x38, 0x00, 0xF0, 0x01,
-    0xC0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x38, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0,
-    0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xB8, 0x0E, 0xF0, 0x79, 0xF3,
-    0xC3, 0xFF, 0x07, 0xF0, 0x01, 0xC0, 0x0F, 0x00, 0x38, 0x01, 0xC0, 0x06, 0x00, 0x00, 0x00, 0x00,
-    0x38, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F,
-    0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xB8, 0x0E, 0xF0, 0x79, 0xF3, 0xC3, 0xFF, 0x07, 0xF0, 0x03, 0x00,
-    0x1C, 0x00, 0xF8, 0x07, 0x70, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x38, 0x0F, 0xE0, 0x3F, 0x80, 0xFE,
-    0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xB8,
-    0x0E, 0xF0, 0x79, 0xF3, 0xC3, 0xFF, 0x07, 0xF0, 0x1D, 0xC0, 0xF7, 0x81, 0xDC, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80,
-    0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3B, 0x80, 0xEF, 0x07, 0x9F, 0x3C, 0x3F, 0xF0, 0x7F, 0x00, 0x00,
-    0xC0, 0x03, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0F, 0x70, 0x1C,
-    0xF0, 0x78, 0xE0, 0xE1, 0xE3, 0xC1, 0xEF, 0x01, 0xDC, 0x03, 0xF8, 0x03, 0xE0, 0x03, 0x80, 0x07,
-    0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0xE0, 0x07, 0x00, 0x38,
-    0x01, 0xFF, 0x0F, 0xFE, 0x71, 0xFB, 0x81, 0xDC, 0x0F, 0xE0, 0x7F, 0x03, 0xF8, 0x1D, 0xC7, 0xEF,
-    0xFE, 0x7F, 0xE3, 0x80, 0x1C, 0x00, 0xE0, 0x00, 0x3F, 0x83, 0xFE, 0x3E, 0xF9, 0xC1, 0xCE, 0x0E,
-    0x70, 0xE3, 0x87, 0x1C, 0x70, 0xE7, 0x07, 0x38, 0x39, 0xE1, 0xCF, 0xCE, 0x3F, 0x70, 0x7F, 0x80,
-    0xFC, 0x07, 0xEE, 0x7F, 0x7F, 0xBB, 0xF8, 0x18, 0x03, 0x80, 0x78, 0x07, 0x00, 0x60, 0x00, 0x00,
-    0x03, 0xFC, 0x7F, 0xCC, 0x78, 0x07, 0x00, 0x73, 0xFE, 0xFF, 0xFE, 0x7F, 0x07, 0xE0, 0xFE, 0x3F,
-    0xFF, 0x9F, 0xE0, 0x03, 0x00, 0xF0, 0x1C, 0x07, 0x00, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0xCC,
-    0x78, 0x07, 0x00, 0x73, 0xFE, 0xFF, 0xFE, 0x7F, 0x07, 0xE0, 0xFE, 0x3F, 0xFF, 0x9F, 0xE0, 0x04,
-    0x01, 0xC0, 0x7C, 0x1D, 0xC3, 0x18, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0xCC, 0x78, 0x07, 0x00, 0x73,
-    0xFE, 0xFF, 0xFE, 0x7F, 0x07, 0xE0, 0xFE, 0x3F, 0xFF, 0x9F, 0xE0, 0x3E, 0xC7, 0xF9, 0xDE, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xE3, 0xFE, 0x63, 0xC0, 0x38, 0x03, 0x9F, 0xF7, 0xFF, 0xF3, 0xF8, 0x3F,
-    0x07, 0xF1, 0xFF, 0xFC, 0xFF, 0x00, 0x3B, 0x8F, 0x78, 0xEE, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xF3,
-    0x1E, 0x01, 0xC0, 0x1C, 0xFF, 0xBF, 0xFF, 0x9F, 0xC1, 0xF8, 0x3F, 0x8F, 0xFF, 0xE7, 0xF8, 0x1F,
-    0x03, 0x60, 0x6C, 0x0D, 0x81, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0xCC, 0x78, 0x07, 0x00, 0x73,
-    0xFE, 0xFF, 0xFE, 0x7F, 0x07, 0xE0, 0xFE, 0x3F, 0xFF, 0x9F, 0xE0, 0x7F, 0x1F, 0x87, 0xFB, 0xFC,
-    0x63, 0xFB, 0xE0, 0x1E, 0x0E, 0x00, 0xE0, 0xE3, 0xFF, 0xFE, 0x7F, 0xFF, 0xEF, 0x9E, 0x00, 0xE0,
-    0xE0, 0x0E, 0x0F, 0x00, 0xF1, 0xF8, 0xCF, 0xFF, 0xFC, 0x3F, 0x9F, 0xC0, 0x1F, 0xC7, 0xF9, 0xF3,
-    0x38, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1E, 0x01, 0xF3, 0x1F, 0xE1, 0xFC, 0x0C, 0x01,
-    0xC0, 0x38, 0x07, 0x03, 0xE0, 0x7C, 0x00, 0x1C, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x3F, 0xE7, 0x9E, 0xF0, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x0E, 0x00, 0xF0,
-    0x07, 0xC6, 0x3F, 0xE1, 0xFE, 0x01, 0x80, 0x38, 0x07, 0x00, 0xE0, 0x06, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x3F, 0xE7, 0x9E, 0xF0, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x0E, 0x00, 0xF0, 0x07, 0xC6,
-    0x3F, 0xE1, 0xFE, 0x06, 0x00, 0xF0, 0x1F, 0x81, 0x9C, 0x18, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x3F,
-    0xE7, 0x9E, 0xF0, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x0E, 0x00, 0xF0, 0x07, 0xC6, 0x3F, 0xE1,
-    0xFE, 0x39, 0xC3, 0xDC, 0x39, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0xE7, 0x9E, 0xF0, 0xFE, 0x07,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0E, 0x00, 0xF0, 0x07, 0xC6, 0x3F, 0xE1, 0xFE, 0xE7, 0x1C, 0x71, 0x80,
-    0x07, 0x39, 0xCE, 0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x70, 0x18, 0xE7, 0x38, 0x60, 0x00, 0x1C, 0x71,
-    0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x18, 0x3C, 0x7E, 0x67, 0x62, 0x00, 0x00, 0x1C,
-    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xE7, 0xF7, 0xE7, 0x00,
-    0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x03, 0x00,
-    0x1E, 0xE0, 0x3F, 0x81, 0xF8, 0x07, 0xE0, 0x01, 0xC0, 0x07, 0x07, 0xFC, 0x7F, 0xF9, 0xE7, 0xEF,
-    0x03, 0xB8, 0x0E, 0xE0, 0x7B, 0x81, 0xCE, 0x07, 0x3C, 0x1C, 0x79, 0xE0, 0xFF, 0x81, 0xF8, 0x00,
-    0x3D, 0xCF, 0xF1, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE7, 0xFE, 0xE3, 0xDC, 0x3F, 0x83, 0xF0,
-    0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0x80, 0x1C, 0x00, 0xF0, 0x03, 0x80,
-    0x0E, 0x00, 0x30, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xE3, 0xCF, 0x9C, 0x1D, 0xC0, 0xFE, 0x03,
-    0xF0, 0x1F, 0x80, 0xFC, 0x0F, 0x70, 0x73, 0xCF, 0x8F, 0xF8, 0x3F, 0x80, 0x01, 0x80, 0x1C, 0x01,
-    0xE0, 0x0E, 0x00, 0x60, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xE3, 0xCF, 0x9C, 0x1D, 0xC0, 0xFE,
-    0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x0F, 0x70, 0x73, 0xCF, 0x8F, 0xF8, 0x3F, 0x80, 0x06, 0x00, 0x38,
-    0x03, 0xE0, 0x3B, 0x81, 0x8C, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xE3, 0xCF, 0x9C, 0x1D, 0xC0,
-    0xFE, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x0F, 0x70, 0x73, 0xCF, 0x8F, 0xF8, 0x3F, 0x80, 0x1E, 0xE1,
-    0xFE, 0x0D, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xFC, 0x79, 0xF3, 0x83, 0xB8, 0x1F,
-    0xC0, 0x7E, 0x03, 0xF0, 0x1F, 0x81, 0xEE, 0x0E, 0x79, 0xF1, 0xFF, 0x07, 0xF0, 0x19, 0xC1, 0xEF,
-    0x06, 0x70, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x8F, 0x3E, 0x70, 0x77, 0x03, 0xF8, 0x0F, 0xC0,
-    0x7E, 0x03, 0xF0, 0x3D, 0xC1, 0xCF, 0x3E, 0x3F, 0xE0, 0xFE, 0x00, 0x0F, 0x00, 0xF0, 0x0F, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x00, 0x30, 0xFF,
-    0x8F, 0xFC, 0xF3, 0xEF, 0x1F, 0x70, 0xFF, 0x8E, 0xFC, 0xE7, 0xEE, 0x3F, 0xE3, 0xDE, 0x1C, 0xFB,
-    0xE7, 0xFE, 0x7F, 0xE3, 0x00, 0x00, 0x18, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x00, 0x00, 0x00,
-    0x0F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x77, 0x07, 0x70, 0x77,
-    0x8F, 0x3F, 0xF1, 0xFF, 0x01, 0x80, 0x38, 0x07, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x0F, 0x07,
-    0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x77, 0x07, 0x70, 0x77, 0x8F, 0x3F,
-    0xF1, 0xFF, 0x06, 0x00, 0xF0, 0x1F, 0x81, 0x9C, 0x18, 0x80, 0x00, 0x00, 0x0F, 0x07, 0xF0, 0x7F,
-    0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x77, 0x07, 0x70, 0x77, 0x8F, 0x3F, 0xF1, 0xFF,
-    0x39, 0xC3, 0xDC, 0x39, 0xC0, 0x00, 0x00, 0x0F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0,
-    0x7F, 0x07, 0xF0, 0x77, 0x07, 0x70, 0x77, 0x8F, 0x3F, 0xF1, 0xFF, 0x01, 0x80, 0x3C, 0x03, 0x80,
-    0x70, 0x06, 0x00, 0x00, 0x00, 0x0E, 0x07, 0xF0, 0x77, 0x07, 0x70, 0xE7, 0x8E, 0x38, 0xE3, 0x8C,
-    0x1D, 0xC1, 0xDC, 0x1F, 0x80, 0xF8, 0x0F, 0x80, 0x70, 0x07, 0x00, 0x70, 0x9E, 0x0F, 0xC0, 0xF8,
-    0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0x8F, 0xFC, 0xF3, 0xEE, 0x0E,
-    0xE0, 0xFE, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0xFE, 0x0E, 0xF3, 0xEF, 0xFC, 0xFF, 0x8E, 0x00, 0xE0,
-    0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x1D, 0xC3, 0xDE, 0x1D, 0xC0, 0x00, 0x00, 0x0E, 0x07, 0xF0, 0x77,
-    0x07, 0x70, 0xE7, 0x8E, 0x38, 0xE3, 0x8C, 0x1D, 0xC1, 0xDC, 0x1F, 0x80, 0xF8, 0x0F, 0x80, 0x70,
-    0x07, 0x00, 0x70, 0x9E, 0x0F, 0xC0, 0xF8, 0x00, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0E, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x07, 0xE0, 0x03, 0xB8, 0x03, 0x9C, 0x01,
-    0xCF, 0x01, 0xE3, 0x80, 0xE1, 0xE0, 0x70, 0x70, 0x78, 0x38, 0x3F, 0xFE, 0x1F, 0xFF, 0x1C, 0x03,
-    0x8E, 0x01, 0xEF, 0x00, 0x77, 0x00, 0x3C, 0x3F, 0xC7, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x1F,
-    0xF3, 0x1E, 0x01, 0xC0, 0x1C, 0xFF, 0xBF, 0xFF, 0x9F, 0xC1, 0xF8, 0x3F, 0x8F, 0xFF, 0xE7, 0xF8,
-    0x06, 0x30, 0x03, 0xB8, 0x01, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07,
-    0xC0, 0x03, 0xE0, 0x03, 0xF0, 0x01, 0xDC, 0x01, 0xCE, 0x00, 0xE7, 0x80, 0xF1, 0xC0, 0x70, 0xF0,
-    0x38, 0x38, 0x3C, 0x1C, 0x1F, 0xFF, 0x0F, 0xFF, 0x8E, 0x01, 0xC7, 0x00, 0xF7, 0x80, 0x3B, 0x80,
-    0x1E, 0x31, 0x87, 0x70, 0x7E, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0xE3, 0xFE, 0x63, 0xC0, 0x38, 0x03,
-    0x9F, 0xF7, 0xFF, 0xF3, 0xF8, 0x3F, 0x07, 0xF1, 0xFF, 0xFC, 0xFF, 0x00, 0x01, 0xC0, 0x01, 0xF0,
-    0x00, 0xF8, 0x00, 0xFC, 0x00, 0x77, 0x00, 0x73, 0x80, 0x39, 0xE0, 0x3C, 0x70, 0x1C, 0x3C, 0x0E,
-    0x0E, 0x0F, 0x07, 0x07, 0xFF, 0xC3, 0xFF, 0xE3, 0x80, 0x71, 0xC0, 0x3D, 0xE0, 0x0E, 0xE0, 0x07,
-    0x80, 0x03, 0x80, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xF8, 0x00, 0x7C, 0x7F, 0x8F, 0xF9, 0x8F, 0x00,
-    0xE0, 0x0E, 0x7F, 0xDF, 0xFF, 0xCF, 0xE0, 0xFC, 0x1F, 0xC7, 0xFF, 0xF3, 0xFC, 0x07, 0x80, 0xE0,
-    0x3C, 0x03, 0xC0, 0x7C, 0x00, 0x60, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x01, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0xFE, 0x1F, 0xFC, 0xFC, 0xF7, 0x80, 0x1E, 0x00, 0x70, 0x03, 0xC0, 0x0E, 0x00, 0x38, 0x00,
-    0xE0, 0x03, 0xC0, 0x0F, 0x00, 0x1C, 0x00, 0x78, 0x00, 0xFC, 0x71, 0xFF, 0xC1, 0xFE, 0x01, 0x80,
-    0x70, 0x1C, 0x07, 0x00, 0x60, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xCF, 0x99, 0xC0, 0x70, 0x0E, 0x01,
-    0xC0, 0x38, 0x07, 0x00, 0xF0, 0x0F, 0x98, 0xFF, 0x0F, 0xE0, 0x01, 0x80, 0x0F, 0x00, 0x7E, 0x01,
-    0x9C, 0x06, 0x20, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x1F, 0xFC, 0xFC, 0xF7, 0x80, 0x1E, 0x00, 0x70,
-    0x03, 0xC0, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0x03, 0xC0, 0x0F, 0x00, 0x1C, 0x00, 0x78, 0x00, 0xFC,
-    0x71, 0xFF, 0xC1, 0xFE, 0x06, 0x01, 0xE0, 0x7E, 0x0C, 0xE1, 0x88, 0x00, 0x00, 0x00, 0xFE, 0x3F,
-    0xCF, 0x99, 0xC0, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xF0, 0x0F, 0x98, 0xFF, 0x0F, 0xE0,
-    0x01, 0xC0, 0x0F, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE1, 0xFF, 0xCF, 0xCF, 0x78, 0x01,
-    0xE0, 0x07, 0x00, 0x3C, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x3C, 0x00, 0xF0, 0x01, 0xC0, 0x07,
-    0x80, 0x0F, 0xC7, 0x1F, 0xFC, 0x1F, 0xE0, 0x07, 0x01, 0xE0, 0x1C, 0x00, 0x00, 0x00, 0x3F, 0x8F,
-    0xF3, 0xE6, 0x70, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x3C, 0x03, 0xE6, 0x3F, 0xC3, 0xF8,
-    0x06, 0x20, 0x19, 0xC0, 0x7E, 0x00, 0xF0, 0x01, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x1F, 0xFC,
-    0xFC, 0xF7, 0x80, 0x1E, 0x00, 0x70, 0x03, 0xC0, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0x03, 0xC0, 0x0F,
-    0x00, 0x1C, 0x00, 0x78, 0x00, 0xFC, 0x71, 0xFF, 0xC1, 0xFE, 0x18, 0x83, 0x38, 0x7E, 0x07, 0x80,
-    0x60, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xCF, 0x99, 0xC0, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00,
-    0xF0, 0x0F, 0x98, 0xFF, 0x0F, 0xE0, 0x18, 0xC0, 0x3B, 0x80, 0x3E, 0x00, 0x78, 0x00, 0x60, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0xE1, 0xC3, 0xF3, 0x81, 0xE7, 0x01, 0xEE, 0x01, 0xDC, 0x03,
-    0xF8, 0x07, 0xF0, 0x0F, 0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0x77, 0x01, 0xEE, 0x07, 0x9C, 0x3F, 0x3F,
-    0xF8, 0x7F, 0xE0, 0x00, 0x77, 0x00, 0x77, 0x00, 0x77, 0x00, 0x77, 0x00, 0x77, 0x00, 0x76, 0x1F,
-    0xF0, 0x3F, 0xF0, 0x79, 0xF0, 0xF0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0,
-    0x70, 0xF0, 0x70, 0x7C, 0x70, 0x3F, 0xF0, 0x1F, 0xF0, 0x3F, 0xF0, 0x1F, 0xFE, 0x0E, 0x1F, 0x87,
-    0x01, 0xE3, 0x80, 0x71, 0xC0, 0x3C, 0xE0, 0x0F, 0xFF, 0x07, 0xFF, 0x83, 0x9C, 0x01, 0xCE, 0x00,
-    0xE7, 0x00, 0xF3, 0x80, 0x71, 0xC0, 0x78, 0xE1, 0xF8, 0x7F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0x70,
-    0x01, 0xC0, 0x7F, 0xC1, 0xFF, 0x00, 0x70, 0x01, 0xC1, 0xFF, 0x0F, 0xFC, 0x79, 0xF3, 0xC1, 0xCE,
-    0x07, 0x38, 0x1C, 0xE0, 0x73, 0x81, 0xCE, 0x07, 0x3C, 0x1C, 0x7C, 0x70, 0xFF, 0xC1, 0xFF, 0x00,
-    0x7F, 0x87, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xEE, 0x00, 0xE0, 0x0E, 0x00, 0xE0,
-    0x0E, 0x00, 0xFF, 0xCF, 0xFC, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0xE7, 0x9E, 0xF0, 0xFE, 0x07,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0E, 0x00, 0xF0, 0x07, 0xC6, 0x3F, 0xE1, 0xFE, 0x31, 0x83, 0xB8, 0x3F,
-    0x01, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0xFE, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0F,
-    0xFC, 0xFF, 0xCE, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x39,
-    0xC1, 0xDC, 0x1F, 0x80, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xFE, 0x79, 0xEF, 0x0F, 0xE0, 0x7F,
-    0xFF, 0xFF, 0xFE, 0x00, 0xE0, 0x0F, 0x00, 0x7C, 0x63, 0xFE, 0x1F, 0xE0, 0x0E, 0x00, 0xE0, 0x0E,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xEE, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xCF,
-    0xFC, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xF0,
-    0x07, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0xE7, 0x9E, 0xF0, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x0E, 0x00, 0xF0, 0x07, 0xC6, 0x3F, 0xE1, 0xFE, 0xFF, 0xEF, 0xFE, 0xE0, 0x0E, 0x00, 0xE0, 0x0E,
-    0x00, 0xE0, 0x0F, 0xFC, 0xFF, 0xCE, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x0E, 0x01, 0xC0, 0x1C, 0x01, 0xF0, 0x1F, 0x1F, 0x83, 0xFE, 0x79, 0xEF, 0x0F, 0xE0,
-    0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0xE0, 0x0F, 0x00, 0x7C, 0x63, 0xFE, 0x1F, 0xE0, 0x1C, 0x03, 0x80,
-    0x38, 0x03, 0xE0, 0x3E, 0x31, 0x03, 0x38, 0x1F, 0x01, 0xE0, 0x0C, 0x00, 0x00, 0x00, 0x0F, 0xFE,
-    0xFF, 0xEE, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xCF, 0xFC, 0xE0, 0x0E, 0x00, 0xE0,
-    0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xFF, 0xFF, 0x18, 0x81, 0x9C, 0x1F, 0x80, 0xF0, 0x06, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xFE, 0x79, 0xEF, 0x0F, 0xE0, 0x7F, 0xFF, 0xFF, 0xFE, 0x00,
-    0xE0, 0x0F, 0x00, 0x7C, 0x63, 0xFE, 0x1F, 0xE0, 0x01, 0x80, 0x03, 0x80, 0x0F, 0x80, 0x3B, 0x80,
-    0x63, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x1F, 0xFC, 0x7E, 0x79, 0xE0, 0x03, 0xC0, 0x07, 0x00,
-    0x1E, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x1F, 0xE0, 0x3F, 0xC0, 0x7B, 0x80, 0xF7, 0x81, 0xE7,
-    0xE3, 0xC7, 0xFF, 0x83, 0xFE, 0x02, 0x00, 0x70, 0x0F, 0x81, 0xDC, 0x18, 0xC0, 0x00, 0x00, 0x01,
-    0xFF, 0x3F, 0xF7, 0xCF, 0x70, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xF0, 0x77, 0xDF,
-    0x3F, 0xF1, 0xFF, 0x00, 0x70, 0x0F, 0x71, 0xE7, 0xFE, 0x7F, 0x80, 0x06, 0x30, 0x0E, 0xE0, 0x1F,
-    0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x0F, 0xFE, 0x3F, 0x3C, 0xF0, 0x01, 0xE0, 0x03,
-    0x80, 0x0F, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x0F, 0xF0, 0x1F, 0xE0, 0x3D, 0xC0, 0x7B, 0xC0,
-    0xF3, 0xF1, 0xE3, 0xFF, 0xC1, 0xFF, 0x00, 0x18, 0xC1, 0xDC, 0x0F, 0xC0, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0xF3, 0xFF, 0x7C, 0xF7, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7F, 0x07, 0x7D,
-    0xF3, 0xFF, 0x1F, 0xF0, 0x07, 0x00, 0xF7, 0x1E, 0x7F, 0xE7, 0xF8, 0x01, 0xC0, 0x03, 0x80, 0x07,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x07, 0xFF, 0x1F, 0x9E, 0x78, 0x00, 0xF0, 0x01, 0xC0, 0x07,
-    0x80, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x07, 0xF8, 0x0F, 0xF0, 0x1E, 0xE0, 0x3D, 0xE0, 0x79, 0xF8,
-    0xF1, 0xFF, 0xE0, 0xFF, 0x80, 0x07, 0x00, 0x70, 0x07, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x3F, 0xF7,
-    0xCF, 0x70, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xF0, 0x77, 0xDF, 0x3F, 0xF1, 0xFF,
-    0x00, 0x70, 0x0F, 0x71, 0xE7, 0xFE, 0x7F, 0x80, 0x07, 0xF8, 0x3F, 0xF8, 0xFC, 0xF3, 0xC0, 0x07,
-    0x80, 0x0E, 0x00, 0x3C, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x3F, 0xC0, 0x7F, 0x80, 0xF7, 0x01,
-    0xEF, 0x03, 0xCF, 0xC7, 0x8F, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0x07, 0x00, 0x3E, 0x00, 0x78, 0x00,
-    0x03, 0x80, 0x38, 0x07, 0x00, 0x70, 0x00, 0x00, 0x00, 0x1F, 0xF3, 0xFF, 0x7C, 0xF7, 0x07, 0xE0,
-    0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7F, 0x07, 0x7D, 0xF3, 0xFF, 0x1F, 0xF0, 0x07, 0x00, 0xF7,
-    0x1E, 0x7F, 0xE7, 0xF8, 0x03, 0x00, 0x1E, 0x00, 0xF8, 0x07, 0x30, 0x18, 0xC0, 0x00, 0x00, 0x00,
-    0x38, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0x30, 0x07,
-    0xC0, 0xFE, 0x0C, 0xC0, 0x00, 0x00, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00,
-    0x7F, 0xC7, 0xFE, 0x79, 0xE7, 0x0F, 0x70, 0x77, 0x07, 0x70, 0x77, 0x07, 0x70, 0x77, 0x07, 0x70,
-    0x77, 0x07, 0x70, 0x70, 0x38, 0x07, 0x0E, 0x01, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x07, 0x0E,
-    0x01, 0xC3, 0x80, 0x70, 0xFF, 0xFC, 0x3F, 0xFF, 0x0E, 0x01, 0xC3, 0x80, 0x70, 0xE0, 0x1C, 0x38,
-    0x07, 0x0E, 0x01, 0xC3, 0x80, 0x70, 0xE0, 0x1C, 0x38, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x3F, 0xE1,
-    0xFF, 0x03, 0x80, 0x1C, 0x00, 0xFF, 0x87, 0xFE, 0x3C, 0xF1, 0xC3, 0xCE, 0x0E, 0x70, 0x73, 0x83,
-    0x9C, 0x1C, 0xE0, 0xE7, 0x07, 0x38, 0x39, 0xC1, 0xCE, 0x0E, 0x7B, 0xFF, 0xB7, 0xC0, 0x00, 0x00,
-    0x00, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03,
-    0x81, 0xC0, 0xE0, 0x70, 0x7B, 0x7F, 0xB7, 0xC0, 0x00, 0x00, 0x00, 0x70, 0x38, 0x1C, 0x0E, 0x07,
-    0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1C,
+    0x38, 0x38, 0x3C, 0x1F, 0x1F, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF8,
+    0x78, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x18, 0x1C, 0x1E, 0x0F, 0x1F, 0x1E, 0x1C, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x78, 0xF8, 0xF0, 0x7C, 0x30, 0xFF, 0x70, 0xEF, 0xF0, 0xC3, 0xE0, 0x70,
+    0xF0, 0x70, 0x00, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x70, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x7C, 0xC0, 0xF0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0x7C, 0xC0, 0x3F, 0xC0, 0x1F,
+    0xC0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x07, 0xF0, 0x0F, 0xF0, 0x1E, 0x60, 0x1C, 0x00, 0x1C,
+    0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x3C, 0x00, 0x38, 0x00, 0x38,
+    0x00, 0x38, 0x00, 0x38, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x60, 0x70, 0xFF, 0xF0, 0x7F, 0xE0, 0x79,
+    0xE0, 0x70, 0xE0, 0x70, 0x60, 0x70, 0x60, 0x70, 0xE0, 0x79, 0xE0, 0x7F, 0xE0, 0xFF, 0xF0, 0x60,
+    0x70, 0xF0, 0x3C, 0x70, 0x38, 0x78, 0x78, 0x38, 0x70, 0x1C, 0xE0, 0x1E, 0xE0, 0x0F, 0xC0, 0x07,
+    0xC0, 0x7F, 0xF8, 0x7F, 0xF8, 0x03, 0x80, 0x03, 0x80, 0x7F, 0xF8, 0x7F, 0xF8, 0x03, 0x80, 0x03,
+    0x80, 0x03, 0x80, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x3F, 0xC0, 0x7F, 0xC0,
+    0x79, 0xC0, 0x70, 0x00, 0x70, 0x00, 0x7C, 0x00, 0x7F, 0x00, 0xFF, 0xC0, 0xE3, 0xC0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xF1, 0xC0, 0x7F, 0xC0, 0x3F, 0x80, 0x07, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0xE3, 0xC0,
+    0xFF, 0x80, 0xFF, 0x00, 0x73, 0x80, 0x77, 0x80, 0x73, 0x80, 0x07, 0xF8, 0x00, 0x0F, 0xFE, 0x00,
+    0x1F, 0x3F, 0x00, 0x38, 0x07, 0x80, 0x73, 0xFB, 0x80, 0x77, 0xF9, 0xC0, 0xE7, 0xB1, 0xC0, 0xEE,
+    0x01, 0xC0, 0xEE, 0x00, 0xC0, 0xEE, 0x01, 0xC0, 0xE7, 0x99, 0xC0, 0x77, 0xF9, 0xC0, 0x73, 0xFB,
+    0x80, 0x38, 0x07, 0x80, 0x1F, 0x1F, 0x00, 0x0F, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0x00, 0x3F,
+    0x00, 0x23, 0x80, 0x3F, 0x80, 0x7F, 0x80, 0x73, 0x80, 0x73, 0x80, 0x7F, 0x80, 0x3F, 0x80, 0x0C,
+    0x60, 0x1C, 0xF0, 0x3C, 0xE0, 0x39, 0xC0, 0x7B, 0xC0, 0x73, 0x80, 0x7B, 0xC0, 0x39, 0xC0, 0x3C,
+    0xE0, 0x1C, 0xF0, 0x0C, 0x60, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
+    0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0xFE, 0xFE, 0x07, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x1F,
+    0x3F, 0x00, 0x38, 0x07, 0x80, 0x77, 0xF3, 0x80, 0x77, 0xF9, 0xC0, 0xE7, 0x39, 0xC0, 0xE7, 0x39,
+    0xC0, 0xE7, 0xF8, 0xC0, 0xE7, 0xF1, 0xC0, 0xE7, 0x71, 0xC0, 0x77, 0x39, 0xC0, 0x77, 0x1F, 0x80,
+    0x38, 0x07, 0x80, 0x1F, 0x1F, 0x00, 0x0F, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0xFF, 0xFF, 0x3E, 0x7E,
+    0xF7, 0xE3, 0xF7, 0x7E, 0x3E, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0xFF,
+    0xF0, 0xFF, 0xF0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0xFF,
+    0xF0, 0xFF, 0xF0, 0x7E, 0x7F, 0x67, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0x7F, 0x7F, 0x7E, 0x7E, 0x6F,
+    0x3E, 0x3E, 0x0F, 0x07, 0x67, 0x7F, 0x7E, 0x18, 0x38, 0x70, 0xE0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xF9, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0x1F, 0xF8, 0x3F, 0xF8, 0x7F, 0x38, 0xFF, 0x38, 0xFF, 0x38, 0xFF, 0x38, 0xFF, 0x38, 0xFF, 0x38,
+    0xFF, 0x38, 0x7F, 0x38, 0x1F, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38,
+    0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0xF0, 0xF0, 0xF0, 0x38,
+    0x38, 0x38, 0x1C, 0x7C, 0xF8, 0x38, 0x78, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3E,
+    0x00, 0x7F, 0x00, 0xF7, 0x80, 0xE1, 0x80, 0xC1, 0x80, 0xE1, 0x80, 0xF7, 0x80, 0x7F, 0x00, 0x3E,
+    0x00, 0xC7, 0x00, 0xE7, 0x00, 0x73, 0x80, 0x7B, 0xC0, 0x39, 0xC0, 0x3D, 0xE0, 0x39, 0xC0, 0x7B,
+    0xC0, 0x73, 0x80, 0xE7, 0x00, 0xC7, 0x00, 0x38, 0x00, 0x00, 0x78, 0x07, 0x00, 0xF8, 0x0E, 0x00,
+    0xF8, 0x0E, 0x00, 0x18, 0x1C, 0x00, 0x18, 0x1C, 0x00, 0x18, 0x38, 0x00, 0x18, 0x38, 0x00, 0x18,
+    0x70, 0xE0, 0x18, 0xE1, 0xE0, 0x00, 0xE1, 0xE0, 0x01, 0xC3, 0xE0, 0x01, 0xC7, 0x60, 0x03, 0x86,
+    0x60, 0x03, 0x8F, 0xF8, 0x07, 0x0F, 0xF8, 0x0E, 0x00, 0x60, 0x0E, 0x00, 0x60, 0x38, 0x00, 0x00,
+    0x78, 0x0E, 0x00, 0xF8, 0x0E, 0x00, 0xF8, 0x1C, 0x00, 0x18, 0x1C, 0x00, 0x18, 0x38, 0x00, 0x18,
+    0x38, 0x00, 0x18, 0x70, 0x00, 0x18, 0xE7, 0xE0, 0x18, 0xEF, 0xE0, 0x01, 0xC6, 0x70, 0x01, 0xC0,
+    0x60, 0x03, 0x80, 0xE0, 0x03, 0x81, 0xC0, 0x07, 0x03, 0x80, 0x0E, 0x07, 0x00, 0x0E, 0x07, 0xF0,
+    0x1C, 0x07, 0xF0, 0x7E, 0x00, 0x00, 0x7E, 0x03, 0x80, 0x6F, 0x03, 0x80, 0x3E, 0x07, 0x00, 0x3E,
+    0x07, 0x00, 0x0F, 0x0E, 0x00, 0x07, 0x1C, 0x00, 0x67, 0x1C, 0x00, 0x7F, 0x38, 0x70, 0x7E, 0x38,
+    0xF0, 0x00, 0x70, 0xF0, 0x00, 0x71, 0xF0, 0x00, 0xE3, 0xB0, 0x01, 0xC3, 0x30, 0x01, 0xC7, 0xFC,
+    0x03, 0x87, 0xFC, 0x03, 0x80, 0x30, 0x07, 0x00, 0x30, 0x0E, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x70,
+    0x00, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x79, 0x80, 0x7F, 0xC0, 0x3F, 0x80, 0x07, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0x70,
+    0x00, 0x0E, 0x70, 0x00, 0x0E, 0x78, 0x00, 0x1E, 0x38, 0x00, 0x1C, 0x3C, 0x00, 0x1C, 0x1C, 0x00,
+    0x3C, 0x1C, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0F, 0x00, 0xF0,
+    0x07, 0x00, 0xE0, 0x07, 0x80, 0x00, 0x60, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xC0,
+    0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xE0, 0x00,
+    0x03, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0x70, 0x00, 0x0E, 0x70, 0x00, 0x0E, 0x78, 0x00, 0x1E,
+    0x38, 0x00, 0x1C, 0x3C, 0x00, 0x1C, 0x1C, 0x00, 0x3C, 0x1C, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFE,
+    0x00, 0x70, 0x0E, 0x00, 0x70, 0x0F, 0x00, 0xF0, 0x07, 0x00, 0xE0, 0x07, 0x80, 0x01, 0x80, 0x00,
+    0x03, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0x70, 0x00, 0x06, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0x70,
+    0x00, 0x0E, 0x70, 0x00, 0x0E, 0x78, 0x00, 0x1E, 0x38, 0x00, 0x1C, 0x3C, 0x00, 0x1C, 0x1C, 0x00,
+    0x3C, 0x1C, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0F, 0x00, 0xF0,
+    0x07, 0x00, 0xE0, 0x07, 0x80, 0x07, 0xB8, 0x00, 0x0F, 0xF0, 0x00, 0x0D, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00,
+    0x07, 0xE0, 0x00, 0x07, 0x70, 0x00, 0x0E, 0x70, 0x00, 0x0E, 0x78, 0x00, 0x1E, 0x38, 0x00, 0x1C,
+    0x3C, 0x00, 0x1C, 0x1C, 0x00, 0x3C, 0x1C, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x70, 0x0E,
+    0x00, 0x70, 0x0F, 0x00, 0xF0, 0x07, 0x00, 0xE0, 0x07, 0x80, 0x0E, 0x70, 0x00, 0x0F, 0x70, 0x00,
+    0x0E, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03,
+    0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0x70, 0x00, 0x0E, 0x70, 0x00, 0x0E, 0x78, 0x00, 0x1E, 0x38,
+    0x00, 0x1C, 0x3C, 0x00, 0x1C, 0x1C, 0x00, 0x3C, 0x1C, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFE, 0x00,
+    0x70, 0x0E, 0x00, 0x70, 0x0F, 0x00, 0xF0, 0x07, 0x00, 0xE0, 0x07, 0x80, 0x03, 0xC0, 0x00, 0x03,
+    0x60, 0x00, 0x06, 0x60, 0x00, 0x07, 0x60, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xE0,
+    0x00, 0x07, 0xE0, 0x00, 0x07, 0x70, 0x00, 0x0E, 0x70, 0x00, 0x0E, 0x78, 0x00, 0x1E, 0x38, 0x00,
+    0x1C, 0x3C, 0x00, 0x1C, 0x1C, 0x00, 0x3C, 0x1C, 0x00, 0x3F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x70,
+    0x0E, 0x00, 0x70, 0x0F, 0x00, 0xF0, 0x07, 0x00, 0xE0, 0x07, 0x80, 0x00, 0x3F, 0xFC, 0x00, 0x7F,
+    0xFC, 0x00, 0xFE, 0x00, 0x00, 0xEE, 0x00, 0x01, 0xEE, 0x00, 0x01, 0xCE, 0x00, 0x03, 0x8E, 0x00,
+    0x07, 0x8F, 0xF8, 0x07, 0x0F, 0xF8, 0x0E, 0x0E, 0x00, 0x1E, 0x0E, 0x00, 0x1F, 0xFE, 0x00, 0x3F,
+    0xFE, 0x00, 0x38, 0x0E, 0x00, 0x78, 0x0E, 0x00, 0x70, 0x0F, 0xFE, 0xE0, 0x0F, 0xFE, 0x07, 0xF8,
+    0x1F, 0xFC, 0x3F, 0x3C, 0x78, 0x00, 0x78, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x78, 0x00, 0x3F, 0x1C, 0x1F, 0xFC, 0x07, 0xF8,
+    0x01, 0x80, 0x03, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x18, 0x00, 0x1C, 0x00,
+    0x0E, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x01, 0x80, 0x03, 0x80,
+    0x07, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x0C, 0x00, 0x0E, 0x00,
+    0x1F, 0x00, 0x3B, 0x80, 0x31, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x3B, 0x80, 0x7B, 0xC0,
+    0x3B, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xE0, 0xF0, 0x70, 0x38, 0x18, 0x00, 0x00, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x18, 0x38, 0x78, 0x70, 0x60, 0x00, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x18, 0x1C, 0x3E, 0x77, 0x63, 0x00, 0x00, 0x1C,
     0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
-    0x1C, 0x1C, 0xC7, 0xDF, 0xF3, 0xE0, 0x00, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C,
-    0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x00, 0x63, 0x77, 0x7E, 0x3C, 0x00, 0x00, 0x1C, 0x1C, 0x1C,
-    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x39, 0xCE, 0x73, 0x9C, 0xE7, 0x39,
-    0xCE, 0x73, 0x9C, 0xE7, 0x3B, 0x99, 0xCF, 0xBC, 0x7B, 0xC0, 0x00, 0x1C, 0xE7, 0x39, 0xCE, 0x73,
-    0x9C, 0xE7, 0x39, 0xDD, 0xCE, 0x7F, 0xE0, 0x77, 0x70, 0x07, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0,
-    0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0,
-    0x0F, 0xE0, 0x0E, 0xE7, 0x3E, 0xE7, 0xFC, 0xE3, 0xF8, 0xF1, 0xDE, 0x38, 0x00, 0x00, 0x00, 0x00,
-    0xE3, 0x9C, 0x73, 0x8E, 0x71, 0xCE, 0x39, 0xC7, 0x38, 0xE7, 0x1C, 0xE3, 0x9C, 0x73, 0x8E, 0x71,
-    0xCE, 0x38, 0x07, 0x00, 0xE0, 0x3C, 0x1F, 0x07, 0xC0, 0x00, 0xC0, 0x0F, 0x00, 0x7C, 0x06, 0x70,
-    0x31, 0x80, 0x00, 0x00, 0x00, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70,
-    0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x1E, 0x73, 0xE3, 0xFF, 0x0F, 0xE0,
-    0x0C, 0x0F, 0x0F, 0xC6, 0x73, 0x10, 0x00, 0x00, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70,
-    0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0xF0, 0xF1, 0xF8, 0xF8, 0x00, 0xE0, 0x7B, 0x83,
-    0xCE, 0x1E, 0x38, 0xF0, 0xE7, 0x83, 0xBC, 0x0F, 0xE0, 0x3F, 0x00, 0xFE, 0x03, 0xFC, 0x0E, 0xF8,
-    0x39, 0xF0, 0xE3, 0xE3, 0x87, 0xCE, 0x0F, 0x38, 0x1E, 0xE0, 0x3C, 0x00, 0x00, 0x70, 0x07, 0xC0,
-    0x1E, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x77, 0x1C, 0xEF, 0x1F, 0xC3,
-    0xF0, 0x7C, 0x0F, 0xC1, 0xFC, 0x3B, 0xC7, 0x3C, 0xE3, 0xDC, 0x3B, 0x87, 0x80, 0x01, 0xC0, 0x78,
-    0x0F, 0x00, 0xE1, 0xEE, 0x3C, 0xE7, 0x8E, 0xF0, 0xFE, 0x0F, 0xC0, 0xFC, 0x0F, 0xE0, 0xEF, 0x0E,
-    0x78, 0xE3, 0xCE, 0x1C, 0xE0, 0xE0, 0x18, 0x07, 0x01, 0xC0, 0x70, 0x0C, 0x00, 0x00, 0x00, 0x07,
-    0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80,
-    0x70, 0x0E, 0x01, 0xC0, 0x3F, 0xFF, 0xFF, 0x19, 0xEF, 0x80, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C,
-    0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x79, 0xF3, 0x80, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01,
-    0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0xFF, 0xFF,
-    0xE0, 0x00, 0x38, 0x1F, 0x03, 0xC0, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1,
-    0xC3, 0x87, 0x0E, 0x1C, 0x3C, 0x7C, 0x70, 0x03, 0x8F, 0x1C, 0x00, 0xEE, 0x1D, 0xC3, 0xB8, 0x77,
-    0x0E, 0xE1, 0xDC, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07,
-    0xFF, 0xFF, 0xE0, 0x77, 0x76, 0x76, 0x76, 0x76, 0x76, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
-    0x70, 0x70, 0x70, 0x78, 0x7C, 0x38, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07,
-    0x1C, 0xE3, 0xDC, 0x73, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0xFF, 0xFF, 0xE0, 0x70, 0x38,
-    0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x3B, 0x9D, 0xEE, 0xE7, 0x03, 0x81, 0xC0, 0xE0,
-    0x78, 0x3E, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x90, 0x07,
-    0xF0, 0x0F, 0xC0, 0x3E, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00,
-    0x0F, 0xFE, 0x1F, 0xFC, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3A, 0x3E, 0x3E, 0xF8, 0xF8, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x3C, 0x3E, 0x1E, 0x00, 0xC0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x00, 0x70,
-    0x00, 0x00, 0x00, 0x00, 0x70, 0x0E, 0xF0, 0x1D, 0xF0, 0x3B, 0xF0, 0x77, 0xE0, 0xEE, 0xE1, 0xDD,
-    0xE3, 0xB9, 0xE7, 0x71, 0xCE, 0xE1, 0xDD, 0xC3, 0xFB, 0x83, 0xF7, 0x03, 0xEE, 0x07, 0xDC, 0x07,
-    0xB8, 0x07, 0x70, 0x0E, 0x03, 0x00, 0xE0, 0x38, 0x07, 0x00, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0xFF,
-    0xDC, 0x7B, 0x87, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x70,
-    0xE0, 0x1D, 0xE0, 0x3B, 0xE0, 0x77, 0xE0, 0xEF, 0xC1, 0xDD, 0xC3, 0xBB, 0xC7, 0x73, 0xCE, 0xE3,
-    0x9D, 0xC3, 0xBB, 0x87, 0xF7, 0x07, 0xEE, 0x07, 0xDC, 0x0F, 0xB8, 0x0F, 0x70, 0x0E, 0xE0, 0x1C,
-    0x00, 0x00, 0x1E, 0x00, 0x78, 0x00, 0xF0, 0x00, 0xFF, 0x9F, 0xFB, 0x8F, 0x70, 0xFE, 0x0F, 0xC1,
-    0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0E, 0x00, 0x03, 0x81, 0xF0, 0x3C, 0x00,
-    0x0C, 0x40, 0x19, 0xC0, 0x3F, 0x00, 0x3C, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0E, 0xF0,
-    0x1D, 0xF0, 0x3B, 0xF0, 0x77, 0xE0, 0xEE, 0xE1, 0xDD, 0xE3, 0xB9, 0xE7, 0x71, 0xCE, 0xE1, 0xDD,
-    0xC3, 0xFB, 0x83, 0xF7, 0x03, 0xEE, 0x07, 0xDC, 0x07, 0xB8, 0x07, 0x70, 0x0E, 0x31, 0x86, 0x70,
-    0x7C, 0x0F, 0x00, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0xFF, 0xDC, 0x7B, 0x87, 0xF0, 0x7E, 0x0F, 0xC1,
-    0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x70, 0x70, 0x03, 0x80, 0x38, 0x01, 0xC0, 0x0E,
-    0x00, 0x00, 0x00, 0xFF, 0x87, 0xFE, 0x38, 0xF1, 0xC3, 0xCE, 0x0E, 0x70, 0x73, 0x83, 0x9C, 0x1C,
-    0xE0, 0xE7, 0x07, 0x38, 0x39, 0xC1, 0xCE, 0x0E, 0xE0, 0x1D, 0xE0, 0x3B, 0xE0, 0x77, 0xE0, 0xEF,
-    0xC1, 0xDD, 0xC3, 0xBB, 0xC7, 0x73, 0xCE, 0xE3, 0x9D, 0xC3, 0xBB, 0x83, 0xF7, 0x07, 0xEE, 0x07,
-    0xDC, 0x07, 0xB8, 0x07, 0x70, 0x0E, 0xE0, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x07, 0xC0,
-    0x0F, 0x00, 0xFF, 0x9F, 0xFB, 0x8F, 0x70, 0xFE, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F,
-    0x83, 0xF0, 0x7E, 0x0E, 0x01, 0xC0, 0x38, 0x0F, 0x07, 0xC0, 0xF8, 0x07, 0xF8, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0xF0, 0x7E, 0x7C, 0x78, 0x0F, 0x38, 0x03,
-    0xDC, 0x01, 0xFE, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xE0, 0x07, 0x70, 0x07, 0xB8,
-    0x03, 0xDE, 0x03, 0xC7, 0xE7, 0xC1, 0xFF, 0xC0, 0x3F, 0xC0, 0x3F, 0xC1, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x8F, 0x3E, 0x70, 0x77, 0x03, 0xF8, 0x0F, 0xC0, 0x7E, 0x03, 0xF0,
-    0x3D, 0xC1, 0xCF, 0x3E, 0x3F, 0xE0, 0xFE, 0x00, 0x06, 0x30, 0x03, 0xB8, 0x00, 0xFC, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x3F, 0xF8, 0x3F, 0x3E, 0x3C, 0x07, 0x9C, 0x01, 0xEE,
-    0x00, 0xFF, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xF0, 0x03, 0xB8, 0x03, 0xDC, 0x01,
-    0xEF, 0x01, 0xE3, 0xF3, 0xE0, 0xFF, 0xE0, 0x1F, 0xE0, 0x18, 0xC0, 0xEE, 0x07, 0xE0, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x07, 0xFC, 0x79, 0xF3, 0x83, 0xB8, 0x1F, 0xC0, 0x7E, 0x03, 0xF0, 0x1F,
-    0x81, 0xEE, 0x0E, 0x79, 0xF1, 0xFF, 0x07, 0xF0, 0x00, 0xCC, 0x00, 0xEE, 0x00, 0xEE, 0x00, 0x66,
-    0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xFC, 0x1F, 0x9F, 0x1E, 0x03, 0xCE,
-    0x00, 0xF7, 0x00, 0x7F, 0x80, 0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF8, 0x01, 0xDC, 0x01,
-    0xEE, 0x00, 0xF7, 0x80, 0xF1, 0xF9, 0xF0, 0x7F, 0xF0, 0x0F, 0xF0, 0x06, 0x70, 0x3B, 0x83, 0xB8,
-    0x3B, 0x81, 0x98, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xE3, 0xCF, 0x9C, 0x1D, 0xC0, 0xFE, 0x03,
-    0xF0, 0x1F, 0x80, 0xFC, 0x0F, 0x70, 0x73, 0xCF, 0x8F, 0xF8, 0x3F, 0x80, 0x07, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xFC, 0xFC, 0x38, 0x01, 0xE0, 0x70, 0x07, 0x80, 0xE0, 0x0E, 0x01, 0xC0, 0x3C, 0x03, 0x80,
-    0x70, 0x07, 0xFE, 0xE0, 0x0F, 0xFD, 0xC0, 0x1C, 0x03, 0xC0, 0x38, 0x03, 0x80, 0x70, 0x07, 0x80,
-    0xE0, 0x0F, 0x81, 0xC0, 0x0F, 0xC3, 0x80, 0x0F, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x1F, 0x87, 0xE0,
-    0xFF, 0xBF, 0xC7, 0x9F, 0xE7, 0x9C, 0x1E, 0x0E, 0xE0, 0x78, 0x3F, 0x80, 0xFF, 0xFE, 0x03, 0xFF,
-    0xF8, 0x0E, 0x00, 0xE0, 0x78, 0x01, 0xC1, 0xF0, 0x07, 0x9F, 0xF3, 0x0F, 0xFB, 0xFE, 0x1F, 0x87,
-    0xF8, 0x03, 0x00, 0x1C, 0x00, 0xF0, 0x03, 0x80, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF,
-    0xE3, 0x8F, 0xCE, 0x07, 0x38, 0x1E, 0xE0, 0x7B, 0x81, 0xCE, 0x1F, 0x3F, 0xF8, 0xFF, 0xC3, 0x8F,
-    0x0E, 0x1C, 0x38, 0x38, 0xE0, 0xF3, 0x81, 0xCE, 0x07, 0xB8, 0x0E, 0x0E, 0x0E, 0x1C, 0x38, 0x30,
-    0x00, 0x00, 0xFF, 0xFF, 0xE2, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF,
-    0xC3, 0xFF, 0x8E, 0x3F, 0x38, 0x1C, 0xE0, 0x7B, 0x81, 0xEE, 0x07, 0x38, 0x7C, 0xFF, 0xE3, 0xFF,
-    0x0E, 0x3C, 0x38, 0x70, 0xE0, 0xE3, 0x83, 0xCE, 0x07, 0x38, 0x1E, 0xE0, 0x38, 0x00, 0x00, 0x70,
-    0x07, 0xC0, 0x1E, 0x00, 0x3F, 0xCF, 0xF3, 0x88, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E,
-    0x03, 0x80, 0xE0, 0x38, 0x00, 0x07, 0x83, 0xC0, 0xF0, 0x00, 0x31, 0x80, 0xEE, 0x01, 0xF0, 0x03,
-    0x80, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xE3, 0x8F, 0xCE, 0x07, 0x38, 0x1E, 0xE0,
-    0x7B, 0x81, 0xCE, 0x1F, 0x3F, 0xF8, 0xFF, 0xC3, 0x8F, 0x0E, 0x1C, 0x38, 0x38, 0xE0, 0xF3, 0x81,
-    0xCE, 0x07, 0xB8, 0x0E, 0xC6, 0xEE, 0x7C, 0x3C, 0x18, 0x00, 0x00, 0xFF, 0xFF, 0xE2, 0xE0, 0xE0,
-    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0xC0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x60,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xF3, 0xE3, 0x9C, 0x00, 0xE0, 0x07, 0x80, 0x1F, 0x00, 0x7C,
-    0x00, 0xF8, 0x01, 0xF0, 0x07, 0x80, 0x1E, 0x00, 0x70, 0x07, 0xBC, 0xF9, 0xFF, 0xC7, 0xF8, 0x07,
-    0x01, 0xC0, 0xE0, 0x70, 0x18, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xBC, 0xCE, 0x03, 0xC0, 0xFC, 0x0F,
-    0xC0, 0xF8, 0x0E, 0x03, 0xF9, 0xEF, 0xFB, 0xFC, 0x03, 0x00, 0x3C, 0x03, 0xF0, 0x39, 0x80, 0x8C,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xF3, 0xE3, 0x9C, 0x00, 0xE0, 0x07, 0x80, 0x1F, 0x00, 0x7C,
-    0x00, 0xF8, 0x01, 0xF0, 0x07, 0x80, 0x1E, 0x00, 0x70, 0x07, 0xBC, 0xF9, 0xFF, 0xC7, 0xF8, 0x0C,
-    0x07, 0x03, 0xE1, 0xDC, 0x63, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xBC, 0xCE, 0x03, 0xC0, 0xFC, 0x0F,
-    0xC0, 0xF8, 0x0E, 0x03, 0xF9, 0xEF, 0xFB, 0xFC, 0x1F, 0xE1, 0xFF, 0x9F, 0x1C, 0xE0, 0x07, 0x00,
-    0x3C, 0x00, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x3C, 0x00, 0xF0, 0x03, 0x80, 0x3D, 0xE7,
-    0xCF, 0xFE, 0x3F, 0xC0, 0x38, 0x01, 0xC0, 0x07, 0x00, 0xF8, 0x07, 0x80, 0x3F, 0xBF, 0xEF, 0x33,
-    0x80, 0xF0, 0x3F, 0x03, 0xF0, 0x3E, 0x03, 0x80, 0xFE, 0x7B, 0xFE, 0xFF, 0x07, 0x01, 0xC0, 0x38,
-    0x3E, 0x1F, 0x00, 0x08, 0xC0, 0xE6, 0x03, 0xF0, 0x0F, 0x00, 0x30, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x3F, 0xF3, 0xE3, 0x9C, 0x00, 0xE0, 0x07, 0x80, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x07,
-    0x80, 0x1E, 0x00, 0x70, 0x07, 0xBC, 0xF9, 0xFF, 0xC7, 0xF8, 0x63, 0x1D, 0xC3, 0xE0, 0x70, 0x08,
-    0x00, 0x00, 0x00, 0xFE, 0xFF, 0xBC, 0xCE, 0x03, 0xC0, 0xFC, 0x0F, 0xC0, 0xF8, 0x0E, 0x03, 0xF9,
-    0xEF, 0xFB, 0xFC, 0xFF, 0xFF, 0xFF, 0xF0, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01,
-    0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07,
-    0x80, 0x0C, 0x00, 0x70, 0x00, 0xE0, 0x03, 0x80, 0x3E, 0x00, 0xF0, 0x00, 0x70, 0x78, 0x3C, 0x1E,
-    0x0F, 0xF7, 0xFB, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x07, 0x03, 0x81, 0xE4, 0xFF, 0x3F, 0x86,
-    0x03, 0x81, 0xC3, 0xE1, 0xF0, 0x08, 0x40, 0x33, 0x80, 0xFC, 0x01, 0xE0, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01,
-    0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x06,
-    0x03, 0x01, 0x8E, 0xCF, 0x67, 0x83, 0xC1, 0xFE, 0xFF, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1,
-    0xE0, 0x70, 0x3C, 0x9F, 0xE7, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E,
-    0x00, 0x78, 0x0F, 0xFC, 0x3F, 0xF0, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78,
-    0x01, 0xE0, 0x07, 0x80, 0x70, 0x78, 0x3C, 0x1E, 0x0F, 0xF7, 0xFB, 0xC1, 0xE0, 0xF0, 0x7F, 0xBF,
-    0xDE, 0x0F, 0x03, 0x81, 0xE4, 0xFF, 0x3F, 0x80, 0x1F, 0x60, 0x7F, 0x83, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0E, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80,
-    0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xEE, 0x03, 0xBC, 0x1E, 0x7C, 0xF0, 0xFF, 0xC1, 0xFC,
-    0x00, 0x1E, 0xC3, 0xFC, 0x37, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07,
-    0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0x70, 0x77, 0x07, 0x78, 0xF3, 0xFF, 0x1F, 0xF0, 0x1F, 0xE0,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE,
-    0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3B, 0x80, 0xEF, 0x07, 0x9F,
-    0x3C, 0x3F, 0xF0, 0x7F, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x07, 0xF0, 0x7F,
-    0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x77, 0x07, 0x70, 0x77, 0x8F, 0x3F, 0xF1, 0xFF,
-    0x18, 0xC0, 0x77, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0x03, 0xF8, 0x0F, 0xE0, 0x3F,
-    0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xEE,
-    0x03, 0xBC, 0x1E, 0x7C, 0xF0, 0xFF, 0xC1, 0xFC, 0x00, 0x39, 0xC1, 0xDC, 0x1F, 0x80, 0xF0, 0x00,
-    0x00, 0x00, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0x70, 0x77,
-    0x07, 0x78, 0xF3, 0xFF, 0x1F, 0xF0, 0x07, 0x80, 0x36, 0x00, 0xCC, 0x03, 0x60, 0x07, 0x80, 0x00,
-    0x00, 0x00, 0x38, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03,
-    0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xB8, 0x0E, 0xF0, 0x79, 0xF3, 0xC3, 0xFF, 0x07, 0xF0,
-    0x0F, 0x01, 0xD8, 0x19, 0x81, 0xD8, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x07, 0xF0, 0x7F, 0x07, 0xF0,
-    0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x77, 0x07, 0x70, 0x77, 0x8F, 0x3F, 0xF1, 0xFF, 0x03, 0x30,
-    0x1D, 0xC0, 0xEE, 0x07, 0x30, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x38, 0x0F, 0xE0, 0x3F, 0x80, 0xFE,
-    0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xB8,
-    0x0E, 0xF0, 0x79, 0xF3, 0xC3, 0xFF, 0x07, 0xF0, 0x06, 0x60, 0xEE, 0x0E, 0xE1, 0xDC, 0x19, 0x80,
-    0x00, 0x00, 0x0F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x77, 0x07,
-    0x70, 0x77, 0x8F, 0x3F, 0xF1, 0xFF, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80,
-    0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0E, 0xE0, 0x3B, 0xC1, 0xE7, 0xCF,
-    0x8F, 0xFC, 0x1F, 0xE0, 0x0E, 0x00, 0x70, 0x01, 0xC0, 0x07, 0xC0, 0x0F, 0x00, 0xF0, 0x7F, 0x07,
-    0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0x70, 0x77, 0x07, 0x78, 0xF3, 0xFF, 0x1F,
-    0xF0, 0x0E, 0x01, 0xC0, 0x1C, 0x01, 0xF0, 0x1F, 0x00, 0x18, 0x00, 0x00, 0x70, 0x00, 0x01, 0xF0,
-    0x00, 0x07, 0x70, 0x00, 0x0C, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x07, 0x70,
-    0x00, 0x1E, 0xE0, 0x70, 0x39, 0xC0, 0xF0, 0x73, 0x83, 0xE0, 0xE7, 0x87, 0xC1, 0xC7, 0x0F, 0xC7,
-    0x8E, 0x3B, 0x8E, 0x1C, 0x77, 0x1C, 0x3C, 0xE7, 0x38, 0x3B, 0x8E, 0x70, 0x77, 0x1D, 0xC0, 0xEE,
-    0x1F, 0x81, 0xF8, 0x3F, 0x01, 0xF0, 0x3C, 0x03, 0xC0, 0x78, 0x07, 0x80, 0xF0, 0x00, 0x60, 0x00,
-    0x1C, 0x00, 0x07, 0xC0, 0x01, 0xDC, 0x00, 0x31, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07,
-    0xF0, 0xE0, 0xEE, 0x1E, 0x1D, 0xC3, 0xC7, 0x38, 0xF8, 0xE3, 0x9F, 0x9C, 0x73, 0x77, 0x0E, 0xEE,
-    0xE0, 0xFC, 0xDC, 0x1F, 0x1F, 0x03, 0xE3, 0xE0, 0x3C, 0x3C, 0x07, 0x07, 0x00, 0x01, 0x00, 0x07,
-    0x00, 0x1F, 0x00, 0x77, 0x00, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0F, 0x70, 0x1C, 0xF0, 0x78,
-    0xE0, 0xE1, 0xE3, 0xC1, 0xEF, 0x01, 0xDC, 0x03, 0xF8, 0x03, 0xE0, 0x03, 0x80, 0x07, 0x00, 0x0E,
-    0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x02, 0x00, 0x70, 0x0F, 0x81, 0xDC,
-    0x18, 0xC0, 0x00, 0x00, 0x0E, 0x07, 0xF0, 0x77, 0x07, 0x70, 0xE7, 0x8E, 0x38, 0xE3, 0x8C, 0x1D,
-    0xC1, 0xDC, 0x1F, 0x80, 0xF8, 0x0F, 0x80, 0x70, 0x07, 0x00, 0x70, 0x9E, 0x0F, 0xC0, 0xF8, 0x00,
-    0x0E, 0xE0, 0x3D, 0xE0, 0x3B, 0x80, 0x00, 0x00, 0x00, 0x1E, 0x03, 0xDC, 0x07, 0x3C, 0x1E, 0x38,
-    0x38, 0x78, 0xF0, 0x7B, 0xC0, 0x77, 0x00, 0xFE, 0x00, 0xF8, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80,
-    0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x38, 0x00,
-    0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x7F, 0xFC, 0x01, 0xE0, 0x0F, 0x00, 0x38, 0x01,
-    0xE0, 0x0F, 0x00, 0x78, 0x01, 0xC0, 0x0F, 0x00, 0x78, 0x01, 0xC0, 0x0F, 0x00, 0x78, 0x01, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x03, 0x80, 0x70, 0x1C, 0x07, 0x00, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x7F,
-    0xE0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x1C, 0x07, 0x81, 0xE0, 0x78, 0x0E, 0x01, 0xFF, 0xBF, 0xF0,
-    0x03, 0x80, 0x1E, 0x00, 0x38, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF7, 0xFF, 0xC0, 0x1E, 0x00, 0xF0,
-    0x03, 0x80, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x1C, 0x00, 0xF0, 0x07, 0x80, 0x1C, 0x00, 0xF0, 0x07,
-    0x80, 0x1C, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x0E, 0x01, 0xE0, 0x38, 0x00, 0x00, 0x00, 0xFF, 0xDF,
-    0xF8, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x07, 0x01, 0xE0, 0x78, 0x1E, 0x03, 0x80, 0x7F, 0xEF, 0xFC,
-    0x0C, 0x60, 0x3B, 0x80, 0x7C, 0x01, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x7F, 0xFC,
-    0x01, 0xE0, 0x0F, 0x00, 0x38, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x01, 0xC0, 0x0F, 0x00, 0x78, 0x01,
-    0xC0, 0x0F, 0x00, 0x78, 0x01, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x31, 0x87, 0x30, 0x7C, 0x07, 0x80,
-    0x60, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0xE0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x1C, 0x07, 0x81, 0xE0,
-    0x78, 0x0E, 0x01, 0xFF, 0xBF, 0xF0, 0x3F, 0x7F, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x7C, 0x7E, 0xEE, 0xC6, 0x18, 0x01, 0xC0,
-    0x0E, 0x00, 0x70, 0x03, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xEE, 0x00, 0xE0, 0x0E, 0x00, 0xE0,
-    0x0E, 0x00, 0xFF, 0xCF, 0xFC, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xFF,
-    0xFF, 0x3B, 0x87, 0xBC, 0x3B, 0x80, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xEE, 0x00, 0xE0, 0x0E, 0x00,
-    0xE0, 0x0E, 0x00, 0xFF, 0xCF, 0xFC, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00,
-    0x7F, 0xE0, 0x1F, 0xFE, 0x07, 0x8F, 0x81, 0xC0, 0xF0, 0x70, 0x1C, 0x1C, 0x07, 0x07, 0x01, 0xC1,
-    0xC0, 0xF0, 0x70, 0x7C, 0x1C, 0x7E, 0x07, 0x1F, 0x00, 0x03, 0x00, 0xE0, 0x38, 0x0F, 0x00, 0xC0,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0,
-    0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0x07, 0xF8, 0x7F, 0xF3, 0xF1, 0xDE,
-    0x00, 0x70, 0x01, 0xC0, 0x0F, 0x00, 0x3F, 0xF8, 0xFF, 0xE3, 0x80, 0x0F, 0x00, 0x1C, 0x00, 0x70,
-    0x01, 0xE0, 0x03, 0xF1, 0xC7, 0xFF, 0x07, 0xF8, 0x1F, 0xE1, 0xFF, 0x9F, 0x1C, 0xE0, 0x07, 0x00,
-    0x3C, 0x00, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x3C, 0x00, 0xF0, 0x03, 0x80, 0x3D, 0xE7,
-    0xCF, 0xFE, 0x3F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x67, 0x7B, 0xD9, 0xC0, 0x00,
-    0x00, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07,
-    0x03, 0x81, 0xC0, 0xE0, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00,
-    0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x03, 0xF9, 0xF7, 0xFE, 0x7F, 0x00, 0x07, 0xFF, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x70, 0x70, 0x00, 0x1C, 0x1C, 0x00, 0x07, 0x07, 0x00, 0x01, 0xC1, 0xC0, 0x00,
-    0x70, 0x7F, 0xC0, 0x1C, 0x1F, 0xFC, 0x07, 0x07, 0x1F, 0x81, 0xC1, 0xC0, 0xE0, 0xF0, 0x70, 0x38,
-    0x38, 0x1C, 0x0F, 0x0E, 0x07, 0x03, 0x87, 0x81, 0xC0, 0xE7, 0xC0, 0x71, 0xFB, 0xE0, 0x1F, 0xFC,
-    0xF0, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x01, 0xC0, 0x70, 0x03, 0x80, 0xE0, 0x07,
-    0x01, 0xC0, 0x0E, 0x03, 0x80, 0x1C, 0x07, 0x00, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0xE0, 0x3C,
-    0x7D, 0xC0, 0x70, 0x3F, 0x80, 0xE0, 0x3F, 0x01, 0xC0, 0x7E, 0x03, 0x80, 0xFC, 0x07, 0x03, 0xF8,
-    0x0F, 0x1F, 0x70, 0x1F, 0xFC, 0xE0, 0x3F, 0xF0, 0xFF, 0xFC, 0x3F, 0xFF, 0x00, 0x70, 0x00, 0x1C,
-    0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x7F, 0xE0, 0x1F, 0xFC, 0x07, 0x8F, 0x81, 0xC0, 0xE0, 0x70,
-    0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x80, 0x01,
-    0x80, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x38, 0x1E, 0xE0, 0xF3, 0x87,
-    0x8E, 0x3C, 0x39, 0xE0, 0xEF, 0x03, 0xF8, 0x0F, 0xC0, 0x3F, 0x80, 0xFF, 0x03, 0xBE, 0x0E, 0x7C,
-    0x38, 0xF8, 0xE1, 0xF3, 0x83, 0xCE, 0x07, 0xB8, 0x0F, 0x0C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0E, 0xE0, 0x3D, 0xC0, 0xFB, 0x81, 0xF7, 0x07, 0xEE,
-    0x1F, 0xDC, 0x7B, 0xB8, 0xE7, 0x73, 0x8E, 0xEF, 0x1D, 0xFC, 0x3B, 0xF0, 0x77, 0xE0, 0xEF, 0x81,
-    0xDE, 0x03, 0xBC, 0x07, 0x70, 0x0E, 0x0C, 0x70, 0x1D, 0xC0, 0x3F, 0x80, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x07, 0xB8, 0x0E, 0x78, 0x1C, 0x70, 0x78, 0xF0, 0xE0, 0xE1, 0xC1, 0xE7, 0x01, 0xCE,
-    0x03, 0xFC, 0x03, 0xF0, 0x03, 0xE0, 0x07, 0x80, 0x07, 0x00, 0x1C, 0x04, 0xF8, 0x0F, 0xE0, 0x1F,
-    0x80, 0x00, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07,
-    0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x01, 0xC0, 0x01, 0xF0, 0x00, 0xF8, 0x00,
-    0xFC, 0x00, 0x77, 0x00, 0x73, 0x80, 0x39, 0xE0, 0x3C, 0x70, 0x1C, 0x3C, 0x0E, 0x0E, 0x0F, 0x07,
-    0x07, 0xFF, 0xC3, 0xFF, 0xE3, 0x80, 0x71, 0xC0, 0x3D, 0xE0, 0x0E, 0xE0, 0x07, 0x80, 0xFF, 0xE7,
-    0xFF, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0xFF, 0x1F, 0xFC, 0xE3, 0xF7, 0x03, 0xF8, 0x1F,
-    0xC0, 0x7E, 0x07, 0xF0, 0x3B, 0x87, 0xDF, 0xFC, 0xFF, 0xC0, 0xFF, 0xC7, 0xFF, 0x38, 0xFD, 0xC0,
-    0xEE, 0x07, 0x70, 0x3B, 0x87, 0xDF, 0xFC, 0xFF, 0xF7, 0x0F, 0xB8, 0x1F, 0xC0, 0x7E, 0x03, 0xF0,
-    0x3F, 0x87, 0xDF, 0xFE, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07,
-    0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x00, 0x07, 0xFF,
-    0x01, 0xFF, 0xC0, 0x70, 0x70, 0x1C, 0x1C, 0x07, 0x07, 0x01, 0xC1, 0xC0, 0x70, 0x70, 0x1C, 0x1C,
-    0x07, 0x07, 0x01, 0xC1, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x1E, 0x07, 0x07, 0x01, 0xC3, 0xC0, 0x73,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x70,
-    0xFF, 0xEF, 0xFE, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0F, 0xFC, 0xFF, 0xCE, 0x00, 0xE0,
-    0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x78, 0x38, 0x3C, 0x78, 0x70, 0xF0,
-    0x70, 0xE3, 0xC0, 0x71, 0xCF, 0x00, 0xF3, 0xBC, 0x00, 0xF7, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0xFF,
-    0x80, 0x03, 0xFF, 0x00, 0x0F, 0x77, 0x00, 0x1C, 0xE7, 0x00, 0x71, 0xCF, 0x01, 0xC3, 0x8F, 0x07,
-    0x87, 0x0E, 0x0E, 0x0E, 0x1E, 0x3C, 0x1C, 0x1E, 0xF0, 0x38, 0x1C, 0x3F, 0xC1, 0xFF, 0xC3, 0x9F,
-    0x00, 0x1E, 0x00, 0x78, 0x01, 0xC0, 0x1F, 0x07, 0xF8, 0x1F, 0xF0, 0x07, 0xE0, 0x03, 0x80, 0x0E,
-    0x00, 0x38, 0x00, 0xE7, 0x9F, 0x9F, 0xFC, 0x3F, 0xE0, 0xE0, 0x1D, 0xC0, 0x7B, 0x81, 0xF7, 0x03,
-    0xEE, 0x0F, 0xDC, 0x3F, 0xB8, 0xF7, 0x71, 0xCE, 0xE7, 0x1D, 0xDE, 0x3B, 0xF8, 0x77, 0xE0, 0xEF,
-    0xC1, 0xDF, 0x03, 0xBC, 0x07, 0x78, 0x0E, 0xE0, 0x1C, 0x1C, 0x60, 0x3D, 0xC0, 0x3F, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x07, 0x70, 0x1E, 0xE0, 0x7D, 0xC0, 0xFB, 0x83, 0xF7, 0x0F, 0xEE,
-    0x3D, 0xDC, 0x73, 0xB9, 0xC7, 0x77, 0x8E, 0xFE, 0x1D, 0xF8, 0x3B, 0xF0, 0x77, 0xC0, 0xEF, 0x01,
-    0xDE, 0x03, 0xB8, 0x07, 0x00, 0xE0, 0x7B, 0x83, 0xCE, 0x1E, 0x38, 0xF0, 0xE7, 0x83, 0xBC, 0x0F,
-    0xE0, 0x3F, 0x00, 0xFE, 0x03, 0xFC, 0x0E, 0xF8, 0x39, 0xF0, 0xE3, 0xE3, 0x87, 0xCE, 0x0F, 0x38,
-    0x1E, 0xE0, 0x3C, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x07, 0x0E, 0x07, 0x0E, 0x07, 0x1E, 0x07, 0x7C,
-    0x07, 0xF8, 0x07, 0xF0, 0x07, 0x38, 0x01, 0xC7, 0x80, 0x1C, 0x7C, 0x03, 0xC7, 0xC0, 0x3E, 0x7E,
-    0x06, 0xE7, 0x60, 0x6E, 0x77, 0x0C, 0xE7, 0x30, 0xCE, 0x73, 0x1C, 0xE7, 0x39, 0x8E, 0x71, 0x98,
-    0xE7, 0x1F, 0x8E, 0x70, 0xF0, 0xEF, 0x0F, 0x0E, 0xF0, 0xE0, 0xEE, 0x00, 0x0E, 0xE0, 0x00, 0xE0,
-    0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1C, 0x07, 0xF8,
-    0x0F, 0xFE, 0x0F, 0xCF, 0x8F, 0x01, 0xE7, 0x00, 0x7B, 0x80, 0x3F, 0xC0, 0x0F, 0xC0, 0x07, 0xE0,
-    0x03, 0xF0, 0x01, 0xFC, 0x00, 0xEE, 0x00, 0xF7, 0x00, 0x7B, 0xC0, 0x78, 0xFC, 0xF8, 0x3F, 0xF8,
-    0x07, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8,
-    0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0,
-    0x1C, 0xFF, 0x87, 0xFF, 0x38, 0xFD, 0xC0, 0xEE, 0x07, 0xF0, 0x3F, 0x81, 0xFC, 0x0E, 0xE3, 0xF7,
-    0xFF, 0x3F, 0xF1, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x00, 0x07, 0xF8, 0x7F,
-    0xF3, 0xF3, 0xDE, 0x00, 0x78, 0x01, 0xC0, 0x0F, 0x00, 0x38, 0x00, 0xE0, 0x03, 0x80, 0x0F, 0x00,
-    0x3C, 0x00, 0x70, 0x01, 0xE0, 0x03, 0xF1, 0xC7, 0xFF, 0x07, 0xF8, 0xFF, 0xFF, 0xFF, 0xF0, 0x78,
-    0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0,
-    0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0xF0, 0x1E, 0xE0, 0x39, 0xE0, 0x71, 0xC1,
-    0xE3, 0xC3, 0x83, 0x87, 0x07, 0x9C, 0x07, 0x38, 0x0F, 0xF0, 0x0F, 0xC0, 0x0F, 0x80, 0x1E, 0x00,
-    0x1C, 0x00, 0x70, 0x13, 0xE0, 0x3F, 0x80, 0x7E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x07, 0xFE,
-    0x01, 0xFF, 0xF8, 0x3E, 0xEF, 0xC7, 0x8E, 0x1E, 0x70, 0xE0, 0xEF, 0x0E, 0x0E, 0xE0, 0xE0, 0xFE,
-    0x0E, 0x0F, 0xF0, 0xE0, 0xE7, 0x0E, 0x0E, 0x78, 0xE1, 0xE3, 0xEE, 0xFC, 0x1F, 0xFF, 0x80, 0xFF,
-    0xE0, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x70, 0x1E, 0x78, 0x1C, 0x3C, 0x3C, 0x1C, 0x78, 0x1E, 0x70,
-    0x0F, 0xF0, 0x07, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0xE0, 0x0F, 0xE0, 0x0E, 0xF0, 0x1E, 0x78,
-    0x3C, 0x3C, 0x38, 0x1C, 0x78, 0x1E, 0xF0, 0x0E, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C,
+    0x67, 0x00, 0xF7, 0x80, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00,
+    0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00,
+    0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x3F, 0xF0, 0x00, 0x3F,
+    0xFC, 0x00, 0x38, 0x7E, 0x00, 0x38, 0x0F, 0x00, 0x38, 0x07, 0x00, 0x38, 0x07, 0x80, 0x38, 0x03,
+    0x80, 0xFF, 0x83, 0x80, 0xFF, 0x83, 0x80, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x38, 0x07, 0x80,
+    0x38, 0x07, 0x00, 0x38, 0x0F, 0x00, 0x38, 0x7E, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F,
+    0x60, 0x1F, 0xE0, 0x1B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1C, 0xF0, 0x1C, 0xF8,
+    0x1C, 0xFC, 0x1C, 0xFC, 0x1C, 0xEE, 0x1C, 0xEF, 0x1C, 0xE7, 0x9C, 0xE3, 0x9C, 0xE1, 0xDC, 0xE1,
+    0xFC, 0xE0, 0xFC, 0xE0, 0x7C, 0xE0, 0x7C, 0xE0, 0x3C, 0xE0, 0x1C, 0xE0, 0x1C, 0x03, 0x00, 0x00,
+    0x03, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x3E, 0x00, 0x78, 0x0F, 0x00, 0x70, 0x07,
+    0x80, 0x70, 0x07, 0x80, 0xF0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80,
+    0xF0, 0x03, 0x80, 0x70, 0x07, 0x80, 0x70, 0x07, 0x80, 0x78, 0x0F, 0x00, 0x3F, 0x3E, 0x00, 0x1F,
+    0xFC, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0,
+    0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xFC, 0x00,
+    0x3F, 0x3E, 0x00, 0x78, 0x0F, 0x00, 0x70, 0x07, 0x80, 0x70, 0x07, 0x80, 0xF0, 0x03, 0x80, 0xE0,
+    0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xF0, 0x03, 0x80, 0x70, 0x07, 0x80, 0x70, 0x07,
+    0x80, 0x78, 0x0F, 0x00, 0x3F, 0x3E, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xC0, 0x00,
+    0x01, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0x70, 0x00, 0x06, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x3E, 0x00, 0x78, 0x0F, 0x00, 0x70, 0x07,
+    0x80, 0x70, 0x07, 0x80, 0xF0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80,
+    0xF0, 0x03, 0x80, 0x70, 0x07, 0x80, 0x70, 0x07, 0x80, 0x78, 0x0F, 0x00, 0x3F, 0x3E, 0x00, 0x1F,
+    0xFC, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xD8, 0x00, 0x07, 0xF8, 0x00, 0x0E, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x3E, 0x00,
+    0x78, 0x0F, 0x00, 0x70, 0x07, 0x80, 0x70, 0x07, 0x80, 0xF0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0,
+    0x03, 0x80, 0xE0, 0x03, 0x80, 0xF0, 0x03, 0x80, 0x70, 0x07, 0x80, 0x70, 0x07, 0x80, 0x78, 0x0F,
+    0x00, 0x3F, 0x3E, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x07, 0x38, 0x00, 0x07, 0x78, 0x00,
+    0x07, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F,
+    0x3E, 0x00, 0x78, 0x0F, 0x00, 0x70, 0x07, 0x80, 0x70, 0x07, 0x80, 0xF0, 0x03, 0x80, 0xE0, 0x03,
+    0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xF0, 0x03, 0x80, 0x70, 0x07, 0x80, 0x70, 0x07, 0x80,
+    0x78, 0x0F, 0x00, 0x3F, 0x3E, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x40, 0x80, 0xE1, 0xC0,
+    0xF3, 0xC0, 0x7F, 0x80, 0x3F, 0x00, 0x1E, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0xF3, 0xC0, 0xE1, 0xC0,
+    0x40, 0x80, 0x00, 0x03, 0x00, 0x07, 0xFB, 0x80, 0x1F, 0xFF, 0x00, 0x3F, 0x3E, 0x00, 0x78, 0x1F,
+    0x00, 0x70, 0x3F, 0x00, 0x70, 0x3F, 0x80, 0xF0, 0x73, 0x80, 0xE0, 0xE3, 0x80, 0xE1, 0xC3, 0x80,
+    0xE3, 0xC3, 0x80, 0xF7, 0x83, 0x80, 0x77, 0x03, 0x80, 0x7E, 0x07, 0x80, 0x7C, 0x0F, 0x00, 0x3F,
+    0x3E, 0x00, 0x7F, 0xFC, 0x00, 0x77, 0xF8, 0x00, 0x60, 0x00, 0x00, 0x0C, 0x00, 0x0E, 0x00, 0x0F,
+    0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0,
+    0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0,
+    0x38, 0xE0, 0x38, 0xF0, 0x78, 0x7C, 0xF0, 0x3F, 0xF0, 0x1F, 0xC0, 0x01, 0xC0, 0x03, 0xC0, 0x03,
+    0x80, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0,
+    0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0,
+    0x38, 0xE0, 0x38, 0xF0, 0x78, 0x7C, 0xF0, 0x3F, 0xF0, 0x1F, 0xC0, 0x03, 0x00, 0x07, 0x00, 0x0F,
+    0x80, 0x1D, 0xC0, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0,
+    0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0,
+    0x38, 0xE0, 0x38, 0xF0, 0x78, 0x7C, 0xF0, 0x3F, 0xF0, 0x1F, 0xC0, 0x1D, 0xC0, 0x3D, 0xE0, 0x1D,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0,
+    0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x38, 0xE0, 0x38, 0xF0,
+    0x78, 0x7C, 0xF0, 0x3F, 0xF0, 0x1F, 0xC0, 0x00, 0xC0, 0x01, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1E, 0x70, 0x1C, 0x78, 0x3C, 0x38, 0x38, 0x3C, 0x78, 0x1E,
+    0xF0, 0x0E, 0xE0, 0x0F, 0xE0, 0x07, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03,
+    0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0x80, 0xFF,
+    0xE0, 0xE3, 0xF0, 0xE0, 0x70, 0xE0, 0x78, 0xE0, 0x78, 0xE0, 0x78, 0xE0, 0x70, 0xE3, 0xF0, 0xFF,
+    0xE0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x3F, 0x80, 0x7F, 0xC0, 0xFB, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE1, 0xC0, 0xE1, 0xC0, 0xE3, 0x80, 0xE7, 0x00, 0xE7, 0x00, 0xE7, 0x80, 0xE7,
+    0xE0, 0xE3, 0xF0, 0xE0, 0xF8, 0xE0, 0x38, 0xE0, 0x38, 0xEE, 0x78, 0xEF, 0xF0, 0xEF, 0xE0, 0x18,
+    0x00, 0x1C, 0x00, 0x1E, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F,
+    0xC0, 0x63, 0xC0, 0x01, 0xC0, 0x00, 0xE0, 0x3F, 0xE0, 0x7F, 0xE0, 0xF9, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xF1, 0xE0, 0xFF, 0xE0, 0x3F, 0xC0, 0x03, 0x00, 0x07, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x0C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x63, 0xC0, 0x01, 0xC0, 0x00, 0xE0, 0x3F,
+    0xE0, 0x7F, 0xE0, 0xF9, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xE0, 0xFF, 0xE0, 0x3F, 0xC0, 0x04,
+    0x00, 0x0E, 0x00, 0x1F, 0x00, 0x3B, 0x80, 0x31, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F,
+    0xC0, 0x63, 0xC0, 0x01, 0xC0, 0x00, 0xE0, 0x3F, 0xE0, 0x7F, 0xE0, 0xF9, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xF1, 0xE0, 0xFF, 0xE0, 0x3F, 0xC0, 0x3E, 0xC0, 0x3F, 0xC0, 0x77, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x63, 0xC0, 0x01, 0xC0, 0x00, 0xE0, 0x3F, 0xE0, 0x7F,
+    0xE0, 0xF9, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xE0, 0xFF, 0xE0, 0x3F, 0xC0, 0x3B, 0x80, 0x7B,
+    0xC0, 0x3B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x63, 0xC0, 0x01, 0xC0, 0x00,
+    0xE0, 0x3F, 0xE0, 0x7F, 0xE0, 0xF9, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xE0, 0xFF, 0xE0, 0x3F,
+    0xC0, 0x1F, 0x00, 0x1B, 0x00, 0x1B, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0x80, 0x7F, 0xC0, 0x63, 0xC0, 0x01, 0xC0, 0x00, 0xE0, 0x3F, 0xE0, 0x7F, 0xE0, 0xF9, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xF1, 0xE0, 0xFF, 0xE0, 0x3F, 0xC0, 0x7F, 0x1F, 0x80, 0x7F, 0xBF, 0xC0, 0x63,
+    0xFB, 0xE0, 0x01, 0xE0, 0xE0, 0x00, 0xE0, 0xE0, 0x3F, 0xFF, 0xE0, 0x7F, 0xFF, 0xE0, 0xF9, 0xE0,
+    0x00, 0xE0, 0xE0, 0x00, 0xE0, 0xF0, 0x00, 0xF1, 0xF8, 0xC0, 0xFF, 0xFF, 0xC0, 0x3F, 0x9F, 0xC0,
+    0x1F, 0xC0, 0x3F, 0xC0, 0x7C, 0xC0, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xF0, 0x00, 0x7C, 0xC0, 0x3F, 0xC0, 0x1F, 0xC0, 0x06, 0x00, 0x07, 0x00, 0x07, 0x00,
+    0x07, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x79, 0xE0, 0xF0, 0xF0, 0xE0, 0x70, 0xFF, 0xF0,
+    0xFF, 0xF0, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0x7C, 0x60, 0x3F, 0xE0, 0x1F, 0xE0, 0x01, 0x80,
+    0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0,
+    0x79, 0xE0, 0xF0, 0xF0, 0xE0, 0x70, 0xFF, 0xF0, 0xFF, 0xF0, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00,
+    0x7C, 0x60, 0x3F, 0xE0, 0x1F, 0xE0, 0x06, 0x00, 0x0F, 0x00, 0x1F, 0x80, 0x19, 0xC0, 0x18, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x79, 0xE0, 0xF0, 0xF0, 0xE0, 0x70, 0xFF, 0xF0,
+    0xFF, 0xF0, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0x7C, 0x60, 0x3F, 0xE0, 0x1F, 0xE0, 0x39, 0xC0,
+    0x3D, 0xC0, 0x39, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x79, 0xE0, 0xF0, 0xF0,
+    0xE0, 0x70, 0xFF, 0xF0, 0xFF, 0xF0, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0x7C, 0x60, 0x3F, 0xE0,
+    0x1F, 0xE0, 0xE0, 0xE0, 0x70, 0x38, 0x18, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x18, 0x38, 0x70, 0xE0, 0x60, 0x00, 0x00, 0x70, 0x70, 0x70,
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x18, 0x3C, 0x7E, 0x67, 0x62, 0x00,
+    0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xE7, 0xF7,
+    0xE7, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x03, 0x00, 0x07, 0xB8, 0x03, 0xF8, 0x07, 0xE0, 0x07, 0xE0, 0x00, 0x70, 0x00, 0x70, 0x1F, 0xF0,
+    0x7F, 0xF8, 0x79, 0xF8, 0xF0, 0x38, 0xE0, 0x38, 0xE0, 0x78, 0xE0, 0x70, 0xE0, 0x70, 0xF0, 0x70,
+    0x79, 0xE0, 0x3F, 0xE0, 0x1F, 0x80, 0x3D, 0xC0, 0x7F, 0x80, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xE3, 0xC0, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x1C, 0x00, 0x1E, 0x00,
+    0x0E, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x79, 0xF0,
+    0x70, 0x70, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x78, 0x70, 0x70, 0x79, 0xF0,
+    0x3F, 0xE0, 0x1F, 0xC0, 0x01, 0x80, 0x03, 0x80, 0x07, 0x80, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x79, 0xF0, 0x70, 0x70, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x38,
+    0xE0, 0x38, 0xE0, 0x78, 0x70, 0x70, 0x79, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x06, 0x00, 0x07, 0x00,
+    0x0F, 0x80, 0x1D, 0xC0, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x79, 0xF0,
+    0x70, 0x70, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x78, 0x70, 0x70, 0x79, 0xF0,
+    0x3F, 0xE0, 0x1F, 0xC0, 0x1E, 0xE0, 0x3F, 0xC0, 0x37, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xC0, 0x3F, 0xE0, 0x79, 0xF0, 0x70, 0x70, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38,
+    0xE0, 0x78, 0x70, 0x70, 0x79, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x19, 0xC0, 0x3D, 0xE0, 0x19, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x79, 0xF0, 0x70, 0x70, 0xE0, 0x78, 0xE0, 0x38,
+    0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x78, 0x70, 0x70, 0x79, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x0F, 0x00,
+    0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x30, 0x1F, 0xF0, 0x3F, 0xF0, 0x79, 0xF0, 0xF1, 0xF0,
+    0xE1, 0xF8, 0xE3, 0xB8, 0xE7, 0x38, 0xEE, 0x38, 0xFC, 0x78, 0x78, 0x70, 0x7D, 0xF0, 0x7F, 0xE0,
+    0xFF, 0xC0, 0xC0, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70,
+    0xF0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x78, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x01, 0x80, 0x03, 0x80,
+    0x07, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70,
+    0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x78, 0xF0,
+    0x3F, 0xF0, 0x1F, 0xF0, 0x06, 0x00, 0x0F, 0x00, 0x1F, 0x80, 0x19, 0xC0, 0x18, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70,
+    0xF0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x78, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x39, 0xC0, 0x3D, 0xC0,
+    0x39, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70,
+    0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x78, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0,
+    0x01, 0x80, 0x03, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x70,
+    0xF0, 0x70, 0x70, 0x70, 0x70, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xC0, 0x1D, 0xC0, 0x1D, 0xC0,
+    0x1F, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x9E, 0x00, 0xFC, 0x00,
+    0xF8, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0x80,
+    0xFF, 0xC0, 0xF3, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0xF0,
+    0xE0, 0xE0, 0xF3, 0xE0, 0xFF, 0xC0, 0xFF, 0x80, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0x1D, 0xC0, 0x3D, 0xE0, 0x1D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x70, 0xF0, 0x70,
+    0x70, 0x70, 0x70, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xC0, 0x1D, 0xC0, 0x1D, 0xC0, 0x1F, 0x80,
+    0x0F, 0x80, 0x0F, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x9E, 0x00, 0xFC, 0x00, 0xF8, 0x00,
+    0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0x70, 0x00, 0x0E, 0x70,
+    0x00, 0x0E, 0x78, 0x00, 0x1E, 0x38, 0x00, 0x1C, 0x3C, 0x00, 0x1C, 0x1C, 0x00, 0x3C, 0x1C, 0x00,
+    0x3F, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0F, 0x00, 0xF0, 0x07, 0x00, 0xE0,
+    0x07, 0x80, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0xC0,
+    0x63, 0xC0, 0x01, 0xC0, 0x00, 0xE0, 0x3F, 0xE0, 0x7F, 0xE0, 0xF9, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xF1, 0xE0, 0xFF, 0xE0, 0x3F, 0xC0, 0x06, 0x30, 0x00, 0x07, 0x70, 0x00, 0x07, 0xE0, 0x00, 0x03,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0,
+    0x00, 0x07, 0xE0, 0x00, 0x07, 0x70, 0x00, 0x0E, 0x70, 0x00, 0x0E, 0x78, 0x00, 0x1E, 0x38, 0x00,
+    0x1C, 0x3C, 0x00, 0x1C, 0x1C, 0x00, 0x3C, 0x1C, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x70,
+    0x0E, 0x00, 0x70, 0x0F, 0x00, 0xF0, 0x07, 0x00, 0xE0, 0x07, 0x80, 0x31, 0x80, 0x3B, 0x80, 0x1F,
+    0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x63, 0xC0, 0x01, 0xC0, 0x00,
+    0xE0, 0x3F, 0xE0, 0x7F, 0xE0, 0xF9, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xE0, 0xFF, 0xE0, 0x3F,
+    0xC0, 0x01, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0x70, 0x00,
+    0x0E, 0x70, 0x00, 0x0E, 0x78, 0x00, 0x1E, 0x38, 0x00, 0x1C, 0x3C, 0x00, 0x1C, 0x1C, 0x00, 0x3C,
+    0x1C, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0F, 0x00, 0xF0, 0x07,
+    0x00, 0xE0, 0x07, 0x80, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0F, 0x80,
+    0x00, 0x0F, 0x80, 0x7F, 0x80, 0x7F, 0xC0, 0x63, 0xC0, 0x01, 0xC0, 0x00, 0xE0, 0x3F, 0xE0, 0x7F,
+    0xE0, 0xF9, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xE0, 0xFF, 0xE0, 0x3F, 0xC0, 0x03, 0xC0, 0x03,
+    0x80, 0x07, 0x80, 0x03, 0xC0, 0x03, 0xE0, 0x00, 0x60, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x01,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x1F, 0xFC, 0x3F, 0x3C, 0x78, 0x00, 0x78, 0x00, 0x70,
+    0x00, 0xF0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x78,
+    0x00, 0x3F, 0x1C, 0x1F, 0xFC, 0x07, 0xF8, 0x01, 0x80, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x7C, 0xC0, 0x70, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0x7C, 0xC0, 0x3F, 0xC0, 0x1F, 0xC0, 0x01,
+    0x80, 0x03, 0xC0, 0x07, 0xE0, 0x06, 0x70, 0x06, 0x20, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x1F,
+    0xFC, 0x3F, 0x3C, 0x78, 0x00, 0x78, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x78, 0x00, 0x3F, 0x1C, 0x1F, 0xFC, 0x07, 0xF8, 0x06,
+    0x00, 0x0F, 0x00, 0x1F, 0x80, 0x19, 0xC0, 0x18, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F,
+    0xC0, 0x7C, 0xC0, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF0,
+    0x00, 0x7C, 0xC0, 0x3F, 0xC0, 0x1F, 0xC0, 0x01, 0xC0, 0x03, 0xC0, 0x01, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xF8, 0x1F, 0xFC, 0x3F, 0x3C, 0x78, 0x00, 0x78, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x78, 0x00, 0x3F, 0x1C, 0x1F,
+    0xFC, 0x07, 0xF8, 0x07, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F,
+    0xC0, 0x7C, 0xC0, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF0,
+    0x00, 0x7C, 0xC0, 0x3F, 0xC0, 0x1F, 0xC0, 0x06, 0x20, 0x06, 0x70, 0x07, 0xE0, 0x03, 0xC0, 0x01,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x1F, 0xFC, 0x3F, 0x3C, 0x78, 0x00, 0x78, 0x00, 0x70,
+    0x00, 0xF0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x78,
+    0x00, 0x3F, 0x1C, 0x1F, 0xFC, 0x07, 0xF8, 0x18, 0x80, 0x19, 0xC0, 0x1F, 0x80, 0x0F, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x7C, 0xC0, 0x70, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0x7C, 0xC0, 0x3F, 0xC0, 0x1F, 0xC0, 0x18,
+    0xC0, 0x1D, 0xC0, 0x0F, 0x80, 0x0F, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF,
+    0xE0, 0xE1, 0xF8, 0xE0, 0x78, 0xE0, 0x3C, 0xE0, 0x1C, 0xE0, 0x1E, 0xE0, 0x1E, 0xE0, 0x1E, 0xE0,
+    0x1E, 0xE0, 0x1E, 0xE0, 0x1C, 0xE0, 0x3C, 0xE0, 0x78, 0xE1, 0xF8, 0xFF, 0xE0, 0xFF, 0xC0, 0x00,
+    0x77, 0x00, 0x77, 0x00, 0x77, 0x00, 0x77, 0x00, 0x77, 0x00, 0x76, 0x1F, 0xF0, 0x3F, 0xF0, 0x79,
+    0xF0, 0xF0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xF0, 0x70, 0x7C,
+    0x70, 0x3F, 0xF0, 0x1F, 0xF0, 0x3F, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x38, 0x7E, 0x00, 0x38, 0x0F,
+    0x00, 0x38, 0x07, 0x00, 0x38, 0x07, 0x80, 0x38, 0x03, 0x80, 0xFF, 0x83, 0x80, 0xFF, 0x83, 0x80,
+    0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x38, 0x07, 0x80, 0x38, 0x07, 0x00, 0x38, 0x0F, 0x00, 0x38,
+    0x7E, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x70, 0x00, 0x70, 0x07, 0xFC, 0x07, 0xFC,
+    0x00, 0x70, 0x00, 0x70, 0x1F, 0xF0, 0x3F, 0xF0, 0x79, 0xF0, 0xF0, 0x70, 0xE0, 0x70, 0xE0, 0x70,
+    0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xF0, 0x70, 0x7C, 0x70, 0x3F, 0xF0, 0x1F, 0xF0, 0x7F, 0x80,
+    0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x79, 0xE0, 0xF0, 0xF0, 0xE0, 0x70, 0xFF, 0xF0,
+    0xFF, 0xF0, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0x7C, 0x60, 0x3F, 0xE0, 0x1F, 0xE0, 0x31, 0x80,
+    0x3B, 0x80, 0x3F, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x39, 0xC0, 0x1D, 0xC0,
+    0x1F, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x79, 0xE0, 0xF0, 0xF0,
+    0xE0, 0x70, 0xFF, 0xF0, 0xFF, 0xF0, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0x7C, 0x60, 0x3F, 0xE0,
+    0x1F, 0xE0, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xE0,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x07, 0x00,
+    0x0F, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x79, 0xE0, 0xF0, 0xF0,
+    0xE0, 0x70, 0xFF, 0xF0, 0xFF, 0xF0, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0x7C, 0x60, 0x3F, 0xE0,
+    0x1F, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0xE0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xF0, 0x01, 0xF0, 0x1F, 0x80,
+    0x3F, 0xE0, 0x79, 0xE0, 0xF0, 0xF0, 0xE0, 0x70, 0xFF, 0xF0, 0xFF, 0xF0, 0xE0, 0x00, 0xE0, 0x00,
+    0xF0, 0x00, 0x7C, 0x60, 0x3F, 0xE0, 0x1F, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x03, 0xE0,
+    0x03, 0xE0, 0x31, 0x00, 0x33, 0x80, 0x1F, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xE0, 0xFF, 0xE0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xC0,
+    0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xF0,
+    0xFF, 0xF0, 0x18, 0x80, 0x19, 0xC0, 0x1F, 0x80, 0x0F, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x79, 0xE0, 0xF0, 0xF0, 0xE0, 0x70, 0xFF, 0xF0, 0xFF, 0xF0,
+    0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0x7C, 0x60, 0x3F, 0xE0, 0x1F, 0xE0, 0x01, 0x80, 0x01, 0xC0,
+    0x03, 0xE0, 0x07, 0x70, 0x06, 0x30, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x1F, 0xFC, 0x3F, 0x3C,
+    0x78, 0x00, 0x78, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x1E, 0xF0, 0x1E,
+    0xF0, 0x1E, 0x70, 0x1E, 0x78, 0x1E, 0x3F, 0x1E, 0x1F, 0xFE, 0x07, 0xFC, 0x02, 0x00, 0x07, 0x00,
+    0x0F, 0x80, 0x1D, 0xC0, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xF0, 0x7C, 0xF0,
+    0x70, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xF0, 0x70, 0x7D, 0xF0,
+    0x3F, 0xF0, 0x1F, 0xF0, 0x00, 0x70, 0x00, 0xF0, 0x71, 0xE0, 0x7F, 0xE0, 0x7F, 0x80, 0x06, 0x30,
+    0x07, 0x70, 0x07, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x1F, 0xFC, 0x3F, 0x3C,
+    0x78, 0x00, 0x78, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x1E, 0xF0, 0x1E,
+    0xF0, 0x1E, 0x70, 0x1E, 0x78, 0x1E, 0x3F, 0x1E, 0x1F, 0xFE, 0x07, 0xFC, 0x18, 0xC0, 0x1D, 0xC0,
+    0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xF0, 0x7C, 0xF0, 0x70, 0x70,
+    0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xF0, 0x70, 0x7D, 0xF0, 0x3F, 0xF0,
+    0x1F, 0xF0, 0x00, 0x70, 0x00, 0xF0, 0x71, 0xE0, 0x7F, 0xE0, 0x7F, 0x80, 0x01, 0xC0, 0x01, 0xC0,
+    0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x1F, 0xFC, 0x3F, 0x3C, 0x78, 0x00, 0x78, 0x00,
+    0x70, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0x70, 0x1E,
+    0x78, 0x1E, 0x3F, 0x1E, 0x1F, 0xFE, 0x07, 0xFC, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xF0, 0x7C, 0xF0, 0x70, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70,
+    0xE0, 0x70, 0xE0, 0x70, 0xF0, 0x70, 0x7D, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x00, 0x70, 0x00, 0xF0,
+    0x71, 0xE0, 0x7F, 0xE0, 0x7F, 0x80, 0x07, 0xF8, 0x1F, 0xFC, 0x3F, 0x3C, 0x78, 0x00, 0x78, 0x00,
+    0x70, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0x70, 0x1E,
+    0x78, 0x1E, 0x3F, 0x1E, 0x1F, 0xFE, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xC0, 0x07, 0xC0, 0x07, 0x80,
+    0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xF0,
+    0x7C, 0xF0, 0x70, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xF0, 0x70,
+    0x7D, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x00, 0x70, 0x00, 0xF0, 0x71, 0xE0, 0x7F, 0xE0, 0x7F, 0x80,
+    0x03, 0x00, 0x07, 0x80, 0x0F, 0x80, 0x1C, 0xC0, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1C,
+    0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xFF, 0xFC, 0xFF, 0xFC,
     0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C,
-    0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
-    0x00, 0x07, 0x00, 0x07, 0xE0, 0x3F, 0x01, 0xF8, 0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x1F, 0x80, 0xFE,
-    0x07, 0x78, 0x7B, 0xFF, 0xC7, 0xFE, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38,
-    0xE0, 0x70, 0x3F, 0x03, 0x81, 0xF8, 0x1C, 0x0F, 0xC0, 0xE0, 0x7E, 0x07, 0x03, 0xF0, 0x38, 0x1F,
-    0x81, 0xC0, 0xFC, 0x0E, 0x07, 0xE0, 0x70, 0x3F, 0x03, 0x81, 0xF8, 0x1C, 0x0F, 0xC0, 0xE0, 0x7E,
-    0x07, 0x03, 0xF0, 0x38, 0x1F, 0x81, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0x70, 0x39,
-    0xC0, 0xE0, 0x73, 0x81, 0xC0, 0xE7, 0x03, 0x81, 0xCE, 0x07, 0x03, 0x9C, 0x0E, 0x07, 0x38, 0x1C,
-    0x0E, 0x70, 0x38, 0x1C, 0xE0, 0x70, 0x39, 0xC0, 0xE0, 0x73, 0x81, 0xC0, 0xE7, 0x03, 0x81, 0xCE,
-    0x07, 0x03, 0x9C, 0x0E, 0x07, 0x38, 0x1C, 0x0E, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0xFF, 0x00, 0x3F,
-    0xC0, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x7F, 0xC0, 0x1F, 0xFC, 0x07,
-    0x1F, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0F, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x71, 0xF8, 0x1F,
-    0xFC, 0x07, 0xFC, 0x00, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8,
-    0x00, 0xFF, 0xF8, 0x3F, 0xFF, 0x8F, 0xE3, 0xF3, 0xF8, 0x1C, 0xFE, 0x07, 0x3F, 0x81, 0xEF, 0xE0,
-    0x73, 0xF8, 0x1C, 0xFE, 0x3F, 0x3F, 0xFF, 0x8F, 0xFF, 0x83, 0xC0, 0xE0, 0x07, 0x00, 0x38, 0x01,
-    0xC0, 0x0E, 0x00, 0x70, 0x03, 0xFF, 0x1F, 0xFC, 0xE3, 0xF7, 0x03, 0xB8, 0x1F, 0xC0, 0x7E, 0x07,
-    0xF0, 0x3B, 0x87, 0xDF, 0xFC, 0xFF, 0xC0, 0x7F, 0xC1, 0xFF, 0xC1, 0xC7, 0xC0, 0x03, 0xC0, 0x03,
-    0xC0, 0x03, 0x80, 0x07, 0x0F, 0xFE, 0x1F, 0xFC, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x03, 0xC0,
-    0x0F, 0x1C, 0x7C, 0x7F, 0xF0, 0x7F, 0xC0, 0xE0, 0x1F, 0xC1, 0xC0, 0xFF, 0xE3, 0x83, 0xE7, 0xE7,
-    0x0F, 0x01, 0xCE, 0x1C, 0x03, 0xDC, 0x78, 0x03, 0xB8, 0xF0, 0x07, 0x7F, 0xC0, 0x0F, 0xFF, 0x80,
-    0x1F, 0xC7, 0x00, 0x3F, 0x8F, 0x00, 0x77, 0x0E, 0x00, 0xEE, 0x1C, 0x03, 0xDC, 0x3C, 0x07, 0x38,
-    0x3E, 0x7E, 0x70, 0x3F, 0xF8, 0xE0, 0x1F, 0xC0, 0x0F, 0xFC, 0x7F, 0xF3, 0xE1, 0xDE, 0x07, 0x70,
-    0x1D, 0xC0, 0x77, 0x81, 0xCF, 0x87, 0x3F, 0xFC, 0x3F, 0xF0, 0xE1, 0xC7, 0x87, 0x1C, 0x1C, 0xF0,
-    0x73, 0x81, 0xDE, 0x07, 0x70, 0x1C, 0x7F, 0x8F, 0xF9, 0x8F, 0x00, 0xE0, 0x0E, 0x7F, 0xDF, 0xFF,
-    0xCF, 0xE0, 0xFC, 0x1F, 0xC7, 0xFF, 0xF3, 0xFC, 0x03, 0xF0, 0x7F, 0x87, 0xF8, 0x78, 0x07, 0x80,
-    0x38, 0x01, 0xFF, 0x1F, 0xFC, 0xFD, 0xF7, 0x83, 0xF8, 0x0F, 0xC0, 0x7E, 0x03, 0xF8, 0x1D, 0xC1,
-    0xEE, 0x0E, 0x7C, 0xF1, 0xFF, 0x07, 0xF0, 0xFF, 0x9F, 0xFB, 0x8F, 0x70, 0xEE, 0x3D, 0xFF, 0x3F,
-    0xF7, 0x1F, 0xE0, 0xFC, 0x1F, 0x8F, 0xFF, 0xEF, 0xF8, 0xFF, 0x7F, 0xB8, 0x1C, 0x0E, 0x07, 0x03,
-    0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x00, 0x0F, 0xF8, 0x1F, 0xF0, 0x38, 0xE0, 0x71, 0xC0,
-    0xE3, 0x81, 0x87, 0x07, 0x0E, 0x0E, 0x1C, 0x1C, 0x38, 0x70, 0x70, 0xE0, 0xE7, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0E, 0x1F, 0x83, 0xFE, 0x79, 0xEF, 0x0F, 0xE0, 0x7F,
-    0xFF, 0xFF, 0xFE, 0x00, 0xE0, 0x0F, 0x00, 0x7C, 0x63, 0xFE, 0x1F, 0xE0, 0x78, 0xE1, 0xC7, 0x1C,
-    0x70, 0x73, 0x9C, 0x07, 0x77, 0x00, 0x7F, 0xC0, 0x07, 0xF8, 0x01, 0xFF, 0x00, 0x77, 0x70, 0x1C,
-    0xE7, 0x07, 0x9C, 0xF0, 0xE3, 0x8F, 0x38, 0x70, 0xEF, 0x0E, 0x1E, 0xFF, 0x3F, 0xEE, 0x7C, 0x07,
-    0x03, 0xCF, 0xE3, 0xF8, 0x0F, 0x01, 0xC0, 0x7E, 0x3F, 0xFF, 0xFF, 0x00, 0xE0, 0xFC, 0x3F, 0x8F,
-    0xF1, 0xFE, 0x7F, 0xDD, 0xFB, 0xBF, 0xE7, 0xF8, 0xFF, 0x1F, 0xC3, 0xF0, 0x7E, 0x0E, 0x71, 0x87,
-    0x70, 0xFE, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x3F, 0x0F, 0xE3, 0xFC, 0x7F, 0x9F, 0xF7, 0x7E, 0xEF,
-    0xF9, 0xFE, 0x3F, 0xC7, 0xF0, 0xFC, 0x1F, 0x83, 0x80, 0xE1, 0xEE, 0x3C, 0xE7, 0x8E, 0xF0, 0xFE,
-    0x0F, 0xC0, 0xFC, 0x0F, 0xE0, 0xEF, 0x0E, 0x78, 0xE3, 0xCE, 0x1C, 0xE0, 0xE0, 0x0F, 0xF8, 0x7F,
-    0xC3, 0x8E, 0x1C, 0x70, 0xE3, 0x87, 0x1C, 0x38, 0xE3, 0x87, 0x1C, 0x39, 0xE1, 0xDE, 0x0F, 0xF0,
-    0x7E, 0x03, 0x80, 0x70, 0x0E, 0x78, 0x1E, 0x78, 0x1E, 0x7C, 0x3E, 0x7C, 0x36, 0x76, 0x77, 0x76,
-    0x67, 0x67, 0xE7, 0x63, 0xC7, 0xE3, 0xC7, 0xE1, 0xC7, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0xFC, 0x1F,
-    0x83, 0xF0, 0x7E, 0x0F, 0xFF, 0xFF, 0xFF, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0E, 0x1F,
-    0xC1, 0xFF, 0x1E, 0x7C, 0xE0, 0xEE, 0x07, 0xF0, 0x1F, 0x80, 0xFC, 0x07, 0xE0, 0x7B, 0x83, 0x9E,
-    0x7C, 0x7F, 0xC1, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07,
-    0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0E, 0xFF, 0x8F, 0xFC, 0xE3, 0xEE, 0x0E, 0xE0, 0xFE, 0x07,
-    0xE0, 0x7E, 0x07, 0xE0, 0xFE, 0x0E, 0xF3, 0xEF, 0xFC, 0xFF, 0x8E, 0x00, 0xE0, 0x0E, 0x00, 0xE0,
-    0x0E, 0x00, 0x1F, 0xC7, 0xF9, 0xF3, 0x38, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1E, 0x01,
-    0xF3, 0x1F, 0xE1, 0xFC, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0,
-    0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x7F, 0x07, 0x70, 0x77, 0x0E, 0x78, 0xE3,
-    0x8E, 0x38, 0xC1, 0xDC, 0x1D, 0xC1, 0xF8, 0x0F, 0x80, 0xF8, 0x07, 0x00, 0x70, 0x07, 0x09, 0xE0,
-    0xFC, 0x0F, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00,
-    0x3F, 0xE0, 0x7F, 0xFC, 0x7D, 0xDF, 0x38, 0xE3, 0xF8, 0x70, 0xFC, 0x38, 0x7E, 0x1C, 0x3F, 0x0E,
-    0x1F, 0x87, 0x0E, 0xE3, 0x8F, 0x7D, 0xDF, 0x1F, 0xFF, 0x03, 0xFE, 0x00, 0x38, 0x00, 0x1C, 0x00,
-    0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x70, 0x73, 0xC7, 0x0E, 0x78, 0x3B, 0x81, 0xF8, 0x07, 0x80,
-    0x3C, 0x01, 0xF0, 0x1F, 0xC1, 0xEF, 0x0E, 0x38, 0xE1, 0xEF, 0x07, 0x00, 0xE0, 0xE7, 0x07, 0x38,
-    0x39, 0xC1, 0xCE, 0x0E, 0x70, 0x73, 0x83, 0x9C, 0x1C, 0xE0, 0xE7, 0x07, 0x38, 0x39, 0xFF, 0xFF,
-    0xFF, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xE3,
-    0xDF, 0xF9, 0xFF, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0xE1, 0xC3, 0xF0, 0xE1, 0xF8, 0x70,
-    0xFC, 0x38, 0x7E, 0x1C, 0x3F, 0x0E, 0x1F, 0x87, 0x0F, 0xC3, 0x87, 0xE1, 0xC3, 0xF0, 0xE1, 0xF8,
-    0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE1, 0xC3, 0x9C, 0x38, 0x73, 0x87, 0x0E, 0x70, 0xE1, 0xCE,
-    0x1C, 0x39, 0xC3, 0x87, 0x38, 0x70, 0xE7, 0x0E, 0x1C, 0xE1, 0xC3, 0x9C, 0x38, 0x73, 0x87, 0x0E,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xE0, 0xFC,
-    0x01, 0xF8, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xFF, 0x03, 0xFF, 0x87, 0x8F, 0x0E, 0x0E, 0x1C, 0x1E,
-    0x38, 0x38, 0x78, 0xF0, 0xFF, 0xE0, 0xFF, 0x00, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E,
-    0x00, 0xFF, 0xF1, 0xFF, 0xF3, 0xF1, 0xE7, 0xE1, 0xEF, 0xC3, 0xDF, 0x8F, 0x3F, 0xFE, 0x7F, 0xF8,
-    0xE0, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0F, 0xF9, 0xFF, 0xB8, 0xF7, 0x0F, 0xE0, 0xFC, 0x3F, 0x8F,
-    0x7F, 0xEF, 0xF8, 0x7F, 0x07, 0xFC, 0x63, 0xC0, 0x0E, 0x00, 0xE1, 0xFE, 0x1F, 0xF0, 0x0E, 0x00,
-    0xE0, 0x1E, 0x63, 0xE7, 0xFC, 0x7F, 0x00, 0xE0, 0xFC, 0x71, 0xFF, 0x38, 0xF3, 0xDC, 0xF0, 0xFE,
-    0x70, 0x3F, 0xF8, 0x1F, 0xFC, 0x0F, 0xCE, 0x07, 0xE7, 0x03, 0xF3, 0xC3, 0xF8, 0xF3, 0xDC, 0x3F,
-    0xCE, 0x0F, 0xC0, 0x1F, 0xF3, 0xFF, 0x3C, 0x77, 0x07, 0x70, 0x77, 0xC7, 0x3F, 0xF1, 0xFF, 0x1C,
-    0x73, 0x87, 0x38, 0x77, 0x07, 0x70, 0x70, 0x1C, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x3F, 0xE7, 0x9E, 0xF0, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x0E, 0x00, 0xF0,
-    0x07, 0xC6, 0x3F, 0xE1, 0xFE, 0x39, 0xC3, 0xDC, 0x39, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0xE7,
-    0x9E, 0xF0, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x0E, 0x00, 0xF0, 0x07, 0xC6, 0x3F, 0xE1, 0xFE,
-    0x38, 0x01, 0xC0, 0x3F, 0xE1, 0xFF, 0x03, 0x80, 0x1C, 0x00, 0xFF, 0x87, 0xFE, 0x3C, 0xF1, 0xC3,
-    0xCE, 0x0E, 0x70, 0x73, 0x83, 0x9C, 0x1C, 0xE0, 0xE7, 0x07, 0x38, 0x39, 0xC1, 0xCE, 0x0E, 0x00,
-    0x70, 0x03, 0x80, 0x3C, 0x07, 0xC0, 0x3E, 0x07, 0x03, 0x83, 0x83, 0x81, 0x80, 0x00, 0x01, 0xFE,
-    0xFF, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x00, 0x1F, 0xC7,
-    0xF9, 0xF3, 0x38, 0x0E, 0x01, 0xFE, 0x3F, 0xC7, 0x00, 0xE0, 0x1E, 0x01, 0xF3, 0x9F, 0xF1, 0xFE,
-    0x3F, 0xBF, 0xEF, 0x33, 0x80, 0xF0, 0x3F, 0x03, 0xF0, 0x3E, 0x03, 0x80, 0xFE, 0x7B, 0xFE, 0xFF,
-    0x00, 0xFF, 0x00, 0x07, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xE7, 0x7B, 0xB9, 0xC0, 0x00, 0x00,
-    0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x00, 0x1E,
-    0x3C, 0x00, 0x00, 0x01, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38,
-    0xF3, 0xDF, 0xBE, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0x03, 0x8E, 0x00, 0x1C, 0x70, 0x00, 0xE3,
-    0x80, 0x07, 0x1F, 0xF0, 0x38, 0xFF, 0xC3, 0x87, 0x9F, 0x1C, 0x38, 0x39, 0xE1, 0xC1, 0xDE, 0x0E,
-    0x1F, 0xF0, 0x7F, 0xEE, 0x03, 0xFE, 0x00, 0xE0, 0xE0, 0x1C, 0x1C, 0x03, 0x83, 0x80, 0x70, 0x70,
-    0x0E, 0x0E, 0x01, 0xC1, 0xFF, 0x3F, 0xFF, 0xF7, 0xFF, 0x1F, 0xE0, 0xE0, 0xFC, 0x1C, 0x1F, 0x83,
-    0x8F, 0xF0, 0x7F, 0xEE, 0x0F, 0xF8, 0x38, 0x01, 0xC0, 0x3F, 0xE1, 0xFF, 0x03, 0x80, 0x1C, 0x00,
-    0xFF, 0x87, 0xFE, 0x3C, 0xF1, 0xC3, 0xCE, 0x0E, 0x70, 0x73, 0x83, 0x9C, 0x1C, 0xE0, 0xE7, 0x07,
-    0x38, 0x39, 0xC1, 0xCE, 0x0E, 0x03, 0x00, 0x70, 0x0E, 0x01, 0xC0, 0x1C, 0x00, 0x00, 0x00, 0x0E,
-    0x1E, 0xE3, 0xCE, 0x78, 0xEF, 0x0F, 0xE0, 0xFC, 0x0F, 0xC0, 0xFE, 0x0E, 0xF0, 0xE7, 0x8E, 0x3C,
-    0xE1, 0xCE, 0x0E, 0x18, 0x07, 0x80, 0x70, 0x07, 0x00, 0x60, 0x00, 0x00, 0x07, 0x07, 0xE1, 0xFC,
-    0x7F, 0x8F, 0xF3, 0xFE, 0xEF, 0xDD, 0xFF, 0x3F, 0xC7, 0xF8, 0xFE, 0x1F, 0x83, 0xF0, 0x70, 0x18,
-    0xE1, 0xDC, 0x1F, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x07, 0x70, 0x77, 0x0E, 0x78, 0xE3,
-    0x8E, 0x38, 0xC1, 0xDC, 0x1D, 0xC1, 0xF8, 0x0F, 0x80, 0xF8, 0x07, 0x00, 0x70, 0x07, 0x09, 0xE0,
-    0xFC, 0x0F, 0x80, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC,
-    0x1F, 0x83, 0xFF, 0xFF, 0xFE, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x0F,
-    0xFF, 0x83, 0xFF, 0xE0, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x1F, 0xF0, 0x07, 0xFF, 0x01,
-    0xC7, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0xC1, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x7E, 0x07,
-    0xFF, 0x01, 0xFF, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x3F,
-    0xF8, 0x7F, 0xF0, 0x1C, 0x00, 0x38, 0x00, 0x7F, 0xC0, 0xFF, 0xE1, 0xE3, 0xC3, 0x83, 0x87, 0x07,
-    0x8E, 0x0E, 0x1E, 0x3C, 0x3F, 0xF8, 0x3F, 0xC0, 0x07, 0xF8, 0x0F, 0xFE, 0x0F, 0xCF, 0x8F, 0x01,
-    0xE7, 0x80, 0x7B, 0x80, 0x3F, 0xC0, 0x0F, 0xFF, 0x07, 0xFF, 0xE7, 0xFC, 0xFF, 0xFC, 0x1F, 0xEE,
-    0x00, 0x77, 0x00, 0x7B, 0xC0, 0x78, 0xF8, 0xF8, 0x3F, 0xF8, 0x07, 0xF8, 0x00, 0x1F, 0xC1, 0xFF,
-    0x1E, 0x7C, 0xE0, 0xEF, 0xE7, 0xFF, 0xBF, 0xDF, 0xFC, 0x7F, 0xE0, 0x7B, 0x83, 0x9E, 0x7C, 0x7F,
-    0xC1, 0xFC, 0x00, 0xE0, 0x03, 0xEF, 0x00, 0x7E, 0x70, 0x0F, 0x67, 0x80, 0xE0, 0x78, 0x0E, 0x03,
-    0x81, 0xC0, 0x3C, 0x1C, 0x01, 0xC3, 0xC0, 0x1C, 0x38, 0x01, 0xE3, 0x80, 0x0E, 0x70, 0x00, 0xF7,
-    0x00, 0x07, 0xF0, 0x00, 0x7E, 0x00, 0x03, 0xE0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0xE0, 0x3D,
-    0xE0, 0xF9, 0xC1, 0xC3, 0x87, 0x07, 0x8E, 0x07, 0x1C, 0x0E, 0x70, 0x0E, 0xE0, 0x1F, 0x80, 0x3F,
-    0x00, 0x3E, 0x00, 0x78, 0x00, 0x70, 0x00, 0x1C, 0x60, 0x0F, 0x70, 0x03, 0xF0, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x71, 0xC0, 0x78, 0xE0, 0x7C, 0x70, 0x3E, 0x38, 0x3F, 0x1C, 0x3F,
-    0x8E, 0x3D, 0xC7, 0x1C, 0xE3, 0x9C, 0x71, 0xDE, 0x38, 0xFE, 0x1C, 0x7E, 0x0E, 0x3F, 0x07, 0x1F,
-    0x03, 0x8F, 0x01, 0xC7, 0x80, 0xFF, 0x80, 0x7E, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x07, 0x00, 0x03,
-    0x80, 0x01, 0x80, 0x71, 0x80, 0xEE, 0x03, 0xF8, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0x38,
-    0x78, 0xE3, 0xE3, 0x8F, 0x8E, 0x7E, 0x3B, 0xB8, 0xEE, 0xE3, 0xF3, 0x8F, 0x8E, 0x3E, 0x38, 0xF0,
-    0xE3, 0x83, 0xEE, 0x0F, 0x80, 0x0E, 0x00, 0x38, 0x01, 0xE0, 0x07, 0x00, 0x18, 0x38, 0x00, 0x70,
-    0x03, 0xFE, 0x07, 0xFC, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1F, 0xF8, 0x3F, 0xF8, 0x71, 0xF8,
-    0xE0, 0x79, 0xC0, 0x73, 0x80, 0xE7, 0x01, 0xCE, 0x07, 0x9C, 0x3E, 0x3F, 0xF8, 0x7F, 0xE0, 0x38,
-    0x07, 0xFC, 0x3F, 0xE0, 0x70, 0x03, 0x80, 0x1F, 0xF0, 0xFF, 0xC7, 0x1F, 0x38, 0x39, 0xC1, 0xCE,
-    0x3E, 0x7F, 0xE3, 0xFE, 0x00, 0xFF, 0x87, 0xFF, 0x38, 0xFD, 0xC0, 0xEE, 0x07, 0xF0, 0x3F, 0x99,
-    0xFC, 0xEE, 0xE7, 0xF7, 0xFF, 0x3F, 0xF1, 0xC3, 0x8E, 0x0E, 0x70, 0x63, 0x80, 0x1C, 0x00, 0xE0,
-    0x00, 0xFF, 0x8F, 0xFC, 0xE3, 0xEE, 0x0E, 0xE0, 0xFE, 0x07, 0xE0, 0x7E, 0x67, 0xE6, 0xFE, 0x7E,
-    0xF3, 0xEF, 0xFC, 0xFF, 0xCE, 0x1C, 0xE0, 0xCE, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0xE0, 0x1C, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38,
-    0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x00, 0x03, 0x81, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0x81,
-    0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0x3F, 0xF9, 0xFF, 0xCE, 0x00, 0x70,
-    0x03, 0x80, 0x1C, 0x00, 0xE0, 0x1F, 0xF0, 0xFF, 0x81, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C,
-    0x00, 0xE0, 0x07, 0x00, 0x38, 0x00, 0x3F, 0xE7, 0xFC, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x3F, 0xE7,
-    0xFC, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0xFF, 0xE7, 0xFF, 0x38, 0x01, 0xC0, 0x0E, 0x00,
-    0x70, 0x03, 0xFE, 0x1F, 0xFC, 0xF1, 0xF7, 0x07, 0xB8, 0x1F, 0xC0, 0xFE, 0x03, 0xF0, 0x1F, 0x80,
-    0xFC, 0x07, 0xE0, 0x78, 0x03, 0x80, 0x3C, 0x07, 0xC0, 0xFE, 0x07, 0xC0, 0xFF, 0x9F, 0xF3, 0x80,
-    0x70, 0x0E, 0x01, 0xFF, 0x3F, 0xF7, 0x1E, 0xE1, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0E, 0x01, 0xC0,
-    0x78, 0x1E, 0x0F, 0x81, 0xE0, 0x78, 0x38, 0x3C, 0x78, 0x70, 0xF0, 0x70, 0xE3, 0xC0, 0x71, 0xCF,
-    0x00, 0x73, 0xBC, 0x00, 0xF7, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x0F,
-    0x77, 0x00, 0x1C, 0xE7, 0x00, 0x71, 0xCF, 0x01, 0xC3, 0x8F, 0x07, 0x87, 0x0E, 0x0E, 0x0E, 0x1E,
-    0x3C, 0x1C, 0x1F, 0xF0, 0x38, 0x1E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0xE0, 0x00, 0x01, 0xC0, 0x78, 0xE1, 0xC3, 0x8E, 0x38, 0x1C, 0xE7, 0x00, 0xEE, 0xE0, 0x07,
-    0xFC, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0xEF, 0xE0, 0x1C, 0xEF, 0x03, 0xCE, 0x78, 0x38, 0xE3,
-    0xC7, 0x0E, 0x1F, 0xF0, 0xE1, 0xF0, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70,
-    0x3F, 0xC1, 0xFF, 0xC3, 0x9F, 0x00, 0x1E, 0x00, 0x78, 0x01, 0xC0, 0x1F, 0x07, 0xF8, 0x1F, 0xF0,
-    0x07, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xE7, 0x9F, 0x9F, 0xFC, 0x7F, 0xE0, 0x1C, 0x00,
-    0x38, 0x00, 0xE0, 0x0F, 0x80, 0x3C, 0x00, 0xFF, 0x3F, 0xEE, 0x7C, 0x07, 0x03, 0xCF, 0xE3, 0xF8,
-    0x0F, 0x01, 0xC0, 0x7E, 0x3F, 0xFF, 0xFF, 0x07, 0x00, 0xE0, 0x38, 0x3E, 0x0F, 0x00, 0xE0, 0x79,
-    0xC1, 0xE3, 0x87, 0x87, 0x1E, 0x0E, 0x78, 0x1D, 0xE0, 0x3F, 0x80, 0x7E, 0x00, 0xFE, 0x01, 0xDE,
-    0x03, 0x9E, 0x07, 0x1E, 0x0E, 0x1E, 0x1C, 0x3C, 0x38, 0x3C, 0x70, 0x3F, 0xE0, 0x3E, 0x00, 0x1C,
-    0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0xE1, 0xEE, 0x3C, 0xE7, 0x8E, 0xE0, 0xFC, 0x0F,
-    0x80, 0xFC, 0x0F, 0xE0, 0xEF, 0x0E, 0x78, 0xE3, 0xCE, 0x1F, 0xE0, 0xF0, 0x07, 0x00, 0x70, 0x07,
-    0x00, 0x70, 0xE0, 0x1E, 0xE0, 0x3C, 0xE0, 0x78, 0xEC, 0xF0, 0xED, 0xE0, 0xED, 0xC0, 0xEF, 0x80,
-    0xFF, 0x80, 0xFF, 0x80, 0xED, 0xC0, 0xED, 0xE0, 0xEC, 0xF0, 0xEC, 0x70, 0xE0, 0x78, 0xE0, 0x3C,
-    0xE0, 0x1E, 0xE0, 0x0E, 0xE0, 0x73, 0x83, 0xCF, 0xDE, 0x3F, 0xF0, 0xFF, 0x83, 0xFC, 0x0F, 0xF8,
-    0x3F, 0xE0, 0xFD, 0xC3, 0xF3, 0x8E, 0x0F, 0x38, 0x1E, 0xE0, 0x38, 0x38, 0x1E, 0x38, 0x3C, 0xFF,
-    0x78, 0xFF, 0xF0, 0x39, 0xE0, 0x3B, 0xC0, 0x3F, 0x80, 0x3F, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x3B,
-    0xE0, 0x38, 0xF0, 0x38, 0x78, 0x38, 0x3C, 0x38, 0x1E, 0x38, 0x1E, 0x38, 0x0F, 0x38, 0x78, 0xE3,
-    0xCF, 0xFE, 0x3F, 0xF0, 0x3F, 0x80, 0xFC, 0x03, 0xF0, 0x0F, 0xE0, 0x3B, 0xC0, 0xE7, 0x83, 0x8F,
-    0x0E, 0x1E, 0x38, 0x3C, 0xFF, 0x03, 0xDF, 0xE0, 0xF0, 0x1C, 0x3C, 0x03, 0x8F, 0x00, 0x73, 0xC0,
-    0x0E, 0xF0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0x00, 0x1D, 0xF0, 0x03, 0x9F,
-    0x00, 0x71, 0xE0, 0x0E, 0x1E, 0x01, 0xC1, 0xE0, 0x38, 0x1E, 0x07, 0x01, 0xC0, 0xFC, 0x1D, 0xF8,
-    0x70, 0x71, 0xE0, 0xE7, 0x81, 0xDE, 0x03, 0xF8, 0x07, 0xE0, 0x0F, 0xF0, 0x1C, 0xF0, 0x38, 0xF0,
-    0x70, 0xE0, 0xE0, 0xE1, 0xC1, 0xE0, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C,
-    0xE0, 0x1C, 0xE0, 0x1C, 0xFF, 0xFC, 0xFF, 0xFC, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C,
-    0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1F, 0xE0, 0x1F, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
-    0x00, 0x07, 0xE0, 0xE7, 0x07, 0x38, 0x39, 0xC1, 0xCE, 0x0E, 0x7F, 0xF3, 0xFF, 0x9C, 0x1C, 0xE0,
-    0xE7, 0x07, 0x38, 0x39, 0xC1, 0xFE, 0x0F, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0xE0, 0x1F,
-    0xF8, 0x07, 0xFE, 0x01, 0xC3, 0x80, 0x70, 0xE0, 0x1C, 0x38, 0x07, 0x0E, 0x01, 0xC3, 0xFF, 0xF0,
-    0xFF, 0xFC, 0x38, 0x07, 0x0E, 0x01, 0xC3, 0x80, 0x70, 0xE0, 0x1C, 0x38, 0x07, 0x0E, 0x01, 0xC3,
-    0x80, 0x70, 0xE0, 0x1C, 0x00, 0xE0, 0xFF, 0x83, 0xFE, 0x0E, 0x38, 0x38, 0xE0, 0xE3, 0xFF, 0x8F,
-    0xFE, 0x38, 0x38, 0xE0, 0xE3, 0x83, 0x8E, 0x0E, 0x38, 0x38, 0xE0, 0xE0, 0xFF, 0xF8, 0x01, 0xFF,
-    0xF0, 0x03, 0x80, 0xE0, 0x07, 0x01, 0xC0, 0x0E, 0x03, 0x80, 0x1C, 0x07, 0x00, 0x38, 0x0F, 0xFC,
-    0x70, 0x1F, 0xFC, 0xE0, 0x3C, 0x7D, 0xC0, 0x70, 0x3B, 0x80, 0xE0, 0x7F, 0x01, 0xC0, 0x7E, 0x03,
-    0x80, 0xFC, 0x07, 0x01, 0xF8, 0x0E, 0x03, 0xF0, 0x1C, 0x07, 0xE0, 0x38, 0x0E, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x70, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0x7C, 0x00, 0xFF, 0xE0, 0x1F, 0xFC,
-    0x03, 0x83, 0x80, 0x70, 0x70, 0x0E, 0x0E, 0x01, 0xC1, 0xFF, 0x38, 0x3F, 0xF7, 0x07, 0x1E, 0xE0,
-    0xE1, 0xFC, 0x1C, 0x1F, 0x83, 0x83, 0xF0, 0x70, 0x7E, 0x0E, 0x0E, 0x00, 0x01, 0xC0, 0x00, 0x78,
-    0x00, 0x1E, 0x00, 0x0F, 0xC0, 0x01, 0xE0, 0x07, 0xF8, 0x07, 0xFE, 0x03, 0xF1, 0x80, 0xF0, 0x00,
-    0x78, 0x00, 0x1C, 0x1F, 0x8F, 0x0F, 0xF3, 0x87, 0xDE, 0xE1, 0xC3, 0xB8, 0x70, 0xFF, 0x1C, 0x3D,
-    0xC7, 0x0F, 0x71, 0xC3, 0x9E, 0x71, 0xE3, 0xFD, 0xF0, 0x7F, 0xF8, 0x07, 0xF8, 0x00, 0x1C, 0x00,
-    0x07, 0x80, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x01, 0xE0, 0x1F, 0x80, 0xFE, 0x07, 0xC0, 0x3C, 0x7C,
-    0xE3, 0xFB, 0x9E, 0xEE, 0x73, 0xB9, 0xC6, 0xE7, 0x3B, 0xDC, 0xE7, 0xFF, 0x8F, 0xFC, 0x1F, 0xC0,
-    0x0F, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x78, 0x07, 0xF8, 0x7F, 0xF3, 0xF3, 0xDE, 0x00, 0x78, 0x01,
-    0xC0, 0x0F, 0x00, 0x38, 0x00, 0xE0, 0x03, 0x80, 0x0F, 0x00, 0x3C, 0x00, 0x70, 0x01, 0xE0, 0x03,
-    0xF1, 0xC7, 0xFF, 0x07, 0xF8, 0x06, 0x00, 0x3C, 0x00, 0x70, 0x01, 0xC0, 0x1F, 0x00, 0x7C, 0x00,
-    0x1F, 0xC7, 0xF9, 0xF3, 0x38, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1E, 0x01, 0xF3, 0x1F,
-    0xE1, 0xFC, 0x0C, 0x01, 0xC0, 0x38, 0x07, 0x03, 0xE0, 0x7C, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x78,
-    0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0,
-    0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xF8, 0x07, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xE0,
-    0x03, 0x80, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00,
-    0xE0, 0x0E, 0x00, 0xF8, 0x0F, 0x80, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0xF0, 0x1E, 0xE0, 0x39,
-    0xE0, 0xF1, 0xC1, 0xC3, 0xC7, 0x83, 0xDE, 0x03, 0xB8, 0x07, 0xF0, 0x07, 0xC0, 0x07, 0x00, 0x0E,
-    0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0xE0, 0x77, 0x83, 0x9C,
-    0x1C, 0xE1, 0xE7, 0x8E, 0x1C, 0x70, 0xE7, 0x07, 0xB8, 0x1D, 0xC0, 0xFC, 0x03, 0xE0, 0x1E, 0x00,
-    0xF0, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x00, 0xF0, 0x1E, 0xE0, 0x39, 0xE0, 0xF1,
-    0xC1, 0xC3, 0xC7, 0x83, 0xCE, 0x03, 0xB8, 0x07, 0xF0, 0x07, 0xC0, 0x0F, 0x80, 0xFF, 0xE1, 0xFF,
-    0xC0, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0xE0, 0x77, 0x83, 0x9C, 0x1C, 0xE1,
-    0xC7, 0x8E, 0x1C, 0x70, 0xE7, 0x03, 0xB8, 0x1F, 0x80, 0xFC, 0x03, 0xE0, 0xFF, 0xC7, 0xFE, 0x03,
-    0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x00, 0x70, 0x1E, 0x3C, 0x0E, 0x0F, 0x0F, 0x03, 0x8F,
-    0x01, 0xE7, 0x00, 0x7F, 0x80, 0x1F, 0x80, 0x07, 0x80, 0x03, 0xC0, 0x03, 0xF0, 0x03, 0xF8, 0x01,
-    0xDE, 0x01, 0xE7, 0x81, 0xE1, 0xE0, 0xE0, 0x70, 0xF0, 0x3F, 0xF0, 0x0F, 0x80, 0x03, 0xC0, 0x01,
-    0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x70, 0x73, 0xC7, 0x0E, 0x78, 0x3B, 0x81, 0xF8, 0x07,
-    0x80, 0x3C, 0x01, 0xF0, 0x1F, 0xC1, 0xEF, 0x0E, 0x38, 0xE1, 0xFF, 0x07, 0x80, 0x1C, 0x00, 0xE0,
-    0x07, 0x00, 0x38, 0xFF, 0xF8, 0xE7, 0xFF, 0xC7, 0x01, 0xC0, 0x38, 0x0E, 0x01, 0xC0, 0x70, 0x0E,
-    0x03, 0x80, 0x70, 0x1C, 0x03, 0x80, 0xE0, 0x1C, 0x07, 0x00, 0xE0, 0x38, 0x07, 0x01, 0xC0, 0x38,
-    0x0E, 0x01, 0xC0, 0x70, 0x0E, 0x03, 0x80, 0x70, 0x1C, 0x03, 0x80, 0xFF, 0xFF, 0x07, 0xFF, 0xF8,
-    0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x1C, 0xFF, 0xCE, 0xFF,
-    0xCE, 0x1E, 0x0E, 0x1E, 0x0E, 0x1E, 0x0E, 0x1E, 0x0E, 0x1E, 0x0E, 0x1E, 0x0E, 0x1E, 0x0E, 0x1E,
-    0x0E, 0x1E, 0x0E, 0x1F, 0xFF, 0x1F, 0xFF, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xE0,
-    0x39, 0xC0, 0x73, 0x80, 0xE7, 0x01, 0xCE, 0x03, 0x9C, 0x07, 0x38, 0x0E, 0x78, 0x1C, 0x78, 0x78,
-    0xFF, 0xF0, 0x7F, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1F, 0x00, 0x3E, 0x00,
-    0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0xE0, 0xE7, 0x07, 0x38, 0x39, 0xC1, 0xCE,
-    0x0E, 0x78, 0xF1, 0xFF, 0x87, 0xFC, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xE0, 0x0F, 0x00, 0x38,
-    0x01, 0xC0, 0x0E, 0x00, 0x70, 0xE0, 0x3F, 0x01, 0xF8, 0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x1F, 0x9C,
-    0xFE, 0xE7, 0x7F, 0x7B, 0xFF, 0xCF, 0xFE, 0x0E, 0x70, 0x73, 0x83, 0x9C, 0x00, 0xE0, 0x07, 0x00,
-    0x38, 0x70, 0x77, 0x07, 0x70, 0x77, 0x07, 0x76, 0x77, 0xEF, 0x7F, 0xF3, 0xFF, 0x06, 0x70, 0x67,
-    0x00, 0x70, 0x07, 0x00, 0x70, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0xFF,
-    0x1F, 0xFE, 0xF1, 0xF7, 0x03, 0xF8, 0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x07, 0xE0,
-    0x38, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x3F, 0xE7, 0xFE, 0xF3, 0xDC, 0x3F, 0x83,
-    0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0x80, 0x00, 0x7F, 0x00, 0x1F,
-    0xFC, 0x03, 0xE7, 0xC0, 0x38, 0x1E, 0xE7, 0x00, 0xEE, 0x70, 0x0F, 0xFF, 0x00, 0x77, 0xFF, 0xFF,
-    0x3F, 0xFF, 0xF0, 0xF0, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x80, 0x00, 0x38, 0x00, 0x03,
-    0xF1, 0xC0, 0x1F, 0xFE, 0x00, 0x7F, 0xC0, 0x01, 0xF8, 0x07, 0xFC, 0xE7, 0x9E, 0xEF, 0x0E, 0xFE,
-    0x07, 0x7F, 0xFF, 0x3F, 0xFF, 0x0E, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x07, 0xCE, 0x07, 0xFE, 0x01,
-    0xFE, 0x00, 0x7F, 0x00, 0x1F, 0xFC, 0x03, 0xE7, 0xC0, 0x38, 0x1E, 0xE7, 0x00, 0xEE, 0x70, 0x0F,
-    0xFF, 0x00, 0x77, 0xFF, 0xFF, 0x3F, 0xFF, 0xF0, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x70, 0x00, 0x07,
-    0x80, 0x00, 0x38, 0x00, 0x03, 0xF1, 0xC0, 0x1F, 0xFE, 0x00, 0x7F, 0xC0, 0x01, 0xC0, 0x00, 0x1C,
-    0x00, 0x01, 0xC0, 0x00, 0x1C, 0x00, 0x01, 0xC0, 0x01, 0xF8, 0x07, 0xFC, 0xE7, 0x9E, 0xEF, 0x0E,
+    0x30, 0x00, 0x7C, 0x00, 0xFE, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x00,
+    0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7F, 0xC0, 0x7F, 0xE0, 0x79, 0xE0, 0x70, 0xF0,
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x70, 0x70, 0x38, 0x07, 0x00, 0x38, 0x07, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x38, 0x07,
+    0x00, 0x38, 0x07, 0x00, 0x38, 0x07, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x38, 0x07, 0x00,
+    0x38, 0x07, 0x00, 0x38, 0x07, 0x00, 0x38, 0x07, 0x00, 0x38, 0x07, 0x00, 0x38, 0x07, 0x00, 0x38,
+    0x07, 0x00, 0x38, 0x07, 0x00, 0x38, 0x00, 0x38, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x38, 0x00, 0x38,
+    0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x3C, 0xF0, 0x38, 0x78, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x7B, 0x80, 0xFF, 0x00, 0xDF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C,
+    0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C,
+    0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x7B, 0x00, 0xFF, 0x00, 0xDF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C,
+    0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xC6, 0xEE, 0xFC, 0x7C, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x63, 0x77,
+    0x7E, 0x3C, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x70, 0x60, 0xE0, 0xF8, 0x78, 0x78, 0x78, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x70, 0xE0, 0xE0, 0xF8, 0xF8, 0x70, 0x70,
+    0x70, 0x00, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x70, 0x70, 0x70, 0x70, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0,
+    0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0E, 0xE7, 0x3E, 0xE7,
+    0xFC, 0xE3, 0xF8, 0xF1, 0xC0, 0xF1, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xC0, 0x71,
+    0xC0, 0x71, 0xC0, 0x71, 0xC0, 0x71, 0xC0, 0x71, 0xC0, 0x71, 0xC0, 0x71, 0xC0, 0x71, 0xC0, 0x71,
+    0xC0, 0x71, 0xC0, 0x71, 0xC0, 0x71, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x03, 0xC0, 0x0F, 0x80, 0x1F,
+    0x00, 0x00, 0xC0, 0x01, 0xE0, 0x01, 0xF0, 0x03, 0x38, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x01, 0xE0, 0xE7, 0xC0, 0xFF, 0xC0, 0x7F,
+    0x00, 0x0C, 0x00, 0x1E, 0x00, 0x3F, 0x00, 0x33, 0x80, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,
+    0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E,
+    0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0xFC,
+    0x00, 0xF8, 0x00, 0xE0, 0x78, 0xE0, 0xF0, 0xE1, 0xE0, 0xE3, 0xC0, 0xE7, 0x80, 0xEF, 0x00, 0xFE,
+    0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0xEF, 0x80, 0xE7, 0xC0, 0xE3, 0xE0, 0xE1, 0xF0, 0xE0,
+    0xF0, 0xE0, 0x78, 0xE0, 0x3C, 0x00, 0x00, 0x07, 0x00, 0x1F, 0x00, 0x1E, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE1, 0xC0, 0xE3, 0x80, 0xEF, 0x00, 0xFE,
+    0x00, 0xFC, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xEF, 0x00, 0xE7, 0x80, 0xE3, 0xC0, 0xE1,
+    0xC0, 0xE1, 0xE0, 0x00, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0xE1, 0xE0, 0xE3, 0xC0, 0xE7,
+    0x80, 0xEF, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xEF, 0x00, 0xE7, 0x80, 0xE3,
+    0xC0, 0xE1, 0xC0, 0xE0, 0xE0, 0x18, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0x18, 0x78, 0xF8, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x78, 0x7C, 0x38, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0x00,
+    0x0E, 0x00, 0x3E, 0x00, 0x3C, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3C, 0x3E, 0x1C, 0x00, 0x38, 0x78, 0x70, 0xEE, 0x00, 0xEE,
+    0x00, 0xEE, 0x00, 0xEE, 0x00, 0xEE, 0x00, 0xEE, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0x77,
+    0x76, 0x76, 0x76, 0x76, 0x76, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x78,
+    0x7C, 0x38, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE3, 0x80, 0xE3, 0xC0, 0xE3, 0x80, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xFF, 0xE0, 0xFF, 0xE0, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
+    0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x77, 0x00, 0x77, 0x80, 0x77, 0x00, 0x70, 0x00, 0x70, 0x00,
+    0x70, 0x00, 0x70, 0x00, 0x78, 0x00, 0x7C, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00,
+    0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x80, 0x1F, 0xC0, 0x1F, 0x80, 0x3E, 0x00, 0x7C, 0x00, 0x7C, 0x00,
+    0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1F, 0xFC, 0x1F, 0xFC, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x3A, 0x3E, 0x3E, 0xF8, 0xF8, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3C, 0x3E, 0x1E, 0x00,
+    0xC0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1C, 0xF0,
+    0x1C, 0xF8, 0x1C, 0xFC, 0x1C, 0xFC, 0x1C, 0xEE, 0x1C, 0xEF, 0x1C, 0xE7, 0x9C, 0xE3, 0x9C, 0xE1,
+    0xDC, 0xE1, 0xFC, 0xE0, 0xFC, 0xE0, 0x7C, 0xE0, 0x7C, 0xE0, 0x3C, 0xE0, 0x1C, 0xE0, 0x1C, 0x03,
+    0x00, 0x07, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF,
+    0xC0, 0xE3, 0xC0, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x1C, 0xF0, 0x1C, 0xF8, 0x1C, 0xFC, 0x1C, 0xFC,
+    0x1C, 0xEE, 0x1C, 0xEF, 0x1C, 0xE7, 0x9C, 0xE3, 0x9C, 0xE1, 0xDC, 0xE1, 0xFC, 0xE0, 0xFC, 0xE0,
+    0x7C, 0xE0, 0x7C, 0xE0, 0x3C, 0xE0, 0x1C, 0xE0, 0x1C, 0x00, 0x00, 0x07, 0x80, 0x0F, 0x00, 0x0F,
+    0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xE3, 0xC0, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x0E, 0x00, 0x3E,
+    0x00, 0x3C, 0x00, 0x0C, 0x40, 0x0C, 0xE0, 0x0F, 0xC0, 0x07, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE0, 0x1C, 0xF0, 0x1C, 0xF8, 0x1C, 0xFC, 0x1C, 0xFC, 0x1C, 0xEE, 0x1C, 0xEF, 0x1C, 0xE7,
+    0x9C, 0xE3, 0x9C, 0xE1, 0xDC, 0xE1, 0xFC, 0xE0, 0xFC, 0xE0, 0x7C, 0xE0, 0x7C, 0xE0, 0x3C, 0xE0,
+    0x1C, 0xE0, 0x1C, 0x31, 0x80, 0x33, 0x80, 0x1F, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xE3, 0xC0, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x70, 0x00, 0x70, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x38, 0xF0, 0x38, 0x78, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0xE0, 0x1C, 0xF0, 0x1C, 0xF8, 0x1C, 0xFC, 0x1C, 0xFC, 0x1C, 0xEE, 0x1C, 0xEF, 0x1C, 0xE7,
+    0x9C, 0xE3, 0x9C, 0xE1, 0xDC, 0xE0, 0xFC, 0xE0, 0xFC, 0xE0, 0x7C, 0xE0, 0x3C, 0xE0, 0x1C, 0xE0,
+    0x1C, 0xE0, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x7C, 0x00, 0x78, 0xFF, 0x80, 0xFF,
+    0xC0, 0xE3, 0xC0, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x01, 0xE0, 0x07, 0xC0, 0x07,
+    0xC0, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x3E, 0x00, 0x78, 0x0F, 0x00, 0x70, 0x07, 0x80, 0x70,
+    0x07, 0x80, 0xF0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xF0, 0x03,
+    0x80, 0x70, 0x07, 0x80, 0x70, 0x07, 0x80, 0x78, 0x0F, 0x00, 0x3F, 0x3E, 0x00, 0x1F, 0xFC, 0x00,
+    0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F,
+    0xE0, 0x79, 0xF0, 0x70, 0x70, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x78, 0x70,
+    0x70, 0x79, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x06, 0x30, 0x00, 0x07, 0x70, 0x00, 0x03, 0xF0, 0x00,
+    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F,
+    0x3E, 0x00, 0x78, 0x0F, 0x00, 0x70, 0x07, 0x80, 0x70, 0x07, 0x80, 0xF0, 0x03, 0x80, 0xE0, 0x03,
+    0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xF0, 0x03, 0x80, 0x70, 0x07, 0x80, 0x70, 0x07, 0x80,
+    0x78, 0x0F, 0x00, 0x3F, 0x3E, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x18, 0xC0, 0x1D, 0xC0,
+    0x1F, 0x80, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x79, 0xF0, 0x70, 0x70,
+    0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x78, 0x70, 0x70, 0x79, 0xF0, 0x3F, 0xE0,
+    0x1F, 0xC0, 0x00, 0xCC, 0x00, 0x01, 0xDC, 0x00, 0x03, 0xB8, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x3E, 0x00,
+    0x78, 0x0F, 0x00, 0x70, 0x07, 0x80, 0x70, 0x07, 0x80, 0xF0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0,
+    0x03, 0x80, 0xE0, 0x03, 0x80, 0xF0, 0x03, 0x80, 0x70, 0x07, 0x80, 0x70, 0x07, 0x80, 0x78, 0x0F,
+    0x00, 0x3F, 0x3E, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x06, 0x70, 0x07, 0x70, 0x0E, 0xE0,
+    0x1D, 0xC0, 0x19, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x79, 0xF0, 0x70, 0x70,
+    0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x78, 0x70, 0x70, 0x79, 0xF0, 0x3F, 0xE0,
+    0x1F, 0xC0, 0x07, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x3F, 0x0E, 0x00, 0x3C, 0x0E, 0x00, 0x78, 0x0E,
+    0x00, 0x70, 0x0E, 0x00, 0xF0, 0x0E, 0x00, 0xE0, 0x0F, 0xFC, 0xE0, 0x0F, 0xFC, 0xE0, 0x0E, 0x00,
+    0xF0, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x78, 0x0E, 0x00, 0x7C, 0x0E, 0x00, 0x3F, 0x0E, 0x00, 0x1F,
+    0xFF, 0xFE, 0x07, 0xFF, 0xFE, 0x1F, 0x87, 0xE0, 0x3F, 0xEF, 0xF0, 0x79, 0xFE, 0x78, 0x70, 0x78,
+    0x38, 0xE0, 0x78, 0x3C, 0xE0, 0x3F, 0xFC, 0xE0, 0x3F, 0xFC, 0xE0, 0x38, 0x00, 0xE0, 0x78, 0x00,
+    0x70, 0x7C, 0x00, 0x79, 0xFF, 0x30, 0x3F, 0xEF, 0xF8, 0x1F, 0x87, 0xF8, 0x03, 0x00, 0x07, 0x00,
+    0x0F, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xE0, 0xE3, 0xF0,
+    0xE0, 0x70, 0xE0, 0x78, 0xE0, 0x78, 0xE0, 0x70, 0xE1, 0xF0, 0xFF, 0xE0, 0xFF, 0xC0, 0xE3, 0xC0,
+    0xE1, 0xC0, 0xE0, 0xE0, 0xE0, 0xF0, 0xE0, 0x70, 0xE0, 0x78, 0xE0, 0x38, 0x0E, 0x0E, 0x1C, 0x38,
+    0x30, 0x00, 0x00, 0xFF, 0xFF, 0xE2, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xFF, 0xC0, 0xFF, 0xE0, 0xE3, 0xF0, 0xE0, 0x70, 0xE0, 0x78, 0xE0, 0x78, 0xE0, 0x70, 0xE1, 0xF0,
+    0xFF, 0xE0, 0xFF, 0xC0, 0xE3, 0xC0, 0xE1, 0xC0, 0xE0, 0xE0, 0xE0, 0xF0, 0xE0, 0x70, 0xE0, 0x78,
+    0xE0, 0x38, 0x00, 0x00, 0x07, 0x00, 0x1F, 0x00, 0x1E, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x38, 0x80,
+    0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
+    0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x78, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x31, 0x80, 0x3B, 0x80,
+    0x1F, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xE0, 0xE3, 0xF0,
+    0xE0, 0x70, 0xE0, 0x78, 0xE0, 0x78, 0xE0, 0x70, 0xE1, 0xF0, 0xFF, 0xE0, 0xFF, 0xC0, 0xE3, 0xC0,
+    0xE1, 0xC0, 0xE0, 0xE0, 0xE0, 0xF0, 0xE0, 0x70, 0xE0, 0x78, 0xE0, 0x38, 0xC6, 0xEE, 0x7C, 0x3C,
+    0x18, 0x00, 0x00, 0xFF, 0xFF, 0xE2, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0x00, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0,
+    0x3F, 0xF0, 0x7C, 0x70, 0x70, 0x00, 0x70, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x07, 0xC0,
+    0x01, 0xF0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x38, 0x00, 0x78, 0x79, 0xF0, 0x7F, 0xF0, 0x3F, 0xC0,
+    0x07, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
+    0xFF, 0x80, 0xF3, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x03, 0x80,
+    0x03, 0xC0, 0xE7, 0x80, 0xFF, 0x80, 0xFF, 0x00, 0x03, 0x00, 0x07, 0x80, 0x0F, 0xC0, 0x1C, 0xC0,
+    0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x3F, 0xF0, 0x7C, 0x70, 0x70, 0x00, 0x70, 0x00,
+    0x78, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x38,
+    0x00, 0x78, 0x79, 0xF0, 0x7F, 0xF0, 0x3F, 0xC0, 0x0C, 0x00, 0x1C, 0x00, 0x3E, 0x00, 0x77, 0x00,
+    0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0x80, 0xF3, 0x00, 0xE0, 0x00, 0xF0, 0x00,
+    0xFC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x03, 0x80, 0x03, 0xC0, 0xE7, 0x80, 0xFF, 0x80, 0xFF, 0x00,
+    0x1F, 0xE0, 0x3F, 0xF0, 0x7C, 0x70, 0x70, 0x00, 0x70, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x1F, 0x00,
+    0x07, 0xC0, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x38, 0x00, 0x78, 0x79, 0xF0, 0x7F, 0xF0,
+    0x3F, 0xC0, 0x07, 0x00, 0x07, 0x00, 0x03, 0x80, 0x0F, 0x80, 0x0F, 0x00, 0x3F, 0x80, 0xFF, 0x80,
+    0xF3, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x03, 0x80, 0x03, 0xC0,
+    0xE7, 0x80, 0xFF, 0x80, 0xFF, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x3E, 0x00, 0x7C, 0x00,
+    0x08, 0xC0, 0x1C, 0xC0, 0x0F, 0xC0, 0x07, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0,
+    0x3F, 0xF0, 0x7C, 0x70, 0x70, 0x00, 0x70, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x07, 0xC0,
+    0x01, 0xF0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x38, 0x00, 0x78, 0x79, 0xF0, 0x7F, 0xF0, 0x3F, 0xC0,
+    0x63, 0x00, 0x77, 0x00, 0x3E, 0x00, 0x1C, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
+    0xFF, 0x80, 0xF3, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x03, 0x80,
+    0x03, 0xC0, 0xE7, 0x80, 0xFF, 0x80, 0xFF, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0x07, 0x80, 0x07, 0x80,
+    0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80,
+    0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x03, 0x00, 0x07, 0x00, 0x03, 0x80,
+    0x03, 0x80, 0x0F, 0x80, 0x0F, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00,
+    0x70, 0x00, 0x79, 0x00, 0x7F, 0x80, 0x3F, 0x80, 0x0C, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x3E, 0x00,
+    0x3E, 0x00, 0x08, 0x40, 0x0C, 0xE0, 0x0F, 0xC0, 0x07, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFC, 0xFF, 0xFC, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80,
+    0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80,
+    0x07, 0x80, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x76, 0x00, 0xF6, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0x70, 0x00, 0x79, 0x00, 0x7F, 0x80, 0x3F, 0x80, 0xFF, 0xFC, 0xFF, 0xFC, 0x07, 0x80,
+    0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x3F, 0xF0, 0x3F, 0xF0, 0x07, 0x80, 0x07, 0x80,
+    0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x70, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x79, 0x00, 0x7F, 0x80, 0x3F, 0x80, 0x1F, 0x60,
+    0x1F, 0xE0, 0x3B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C,
+    0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C,
+    0xE0, 0x38, 0xE0, 0x38, 0xF0, 0x78, 0x7C, 0xF0, 0x3F, 0xF0, 0x1F, 0xC0, 0x1E, 0xC0, 0x3F, 0xC0,
+    0x37, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70,
+    0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x78, 0xF0, 0x3F, 0xF0,
+    0x1F, 0xF0, 0x1F, 0xE0, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3C, 0xE0, 0x3C,
+    0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C,
+    0xE0, 0x3C, 0xE0, 0x38, 0xE0, 0x38, 0xF0, 0x78, 0x7C, 0xF0, 0x3F, 0xF0, 0x1F, 0xC0, 0x3F, 0xC0,
+    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70,
+    0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x78, 0xF0, 0x3F, 0xF0,
+    0x1F, 0xF0, 0x18, 0xC0, 0x1D, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3C,
+    0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C,
+    0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x38, 0xE0, 0x38, 0xF0, 0x78, 0x7C, 0xF0, 0x3F, 0xF0, 0x1F, 0xC0,
+    0x39, 0xC0, 0x1D, 0xC0, 0x1F, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x70, 0xF0, 0x70,
+    0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x78, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x07, 0x80, 0x0D, 0x80, 0x0C, 0xC0, 0x0D, 0x80, 0x07, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C,
+    0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x38, 0xE0, 0x38, 0xF0, 0x78,
+    0x7C, 0xF0, 0x3F, 0xF0, 0x1F, 0xC0, 0x0F, 0x00, 0x1D, 0x80, 0x19, 0x80, 0x1D, 0x80, 0x0F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70,
+    0xF0, 0x70, 0xF0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x78, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x03, 0x30,
+    0x07, 0x70, 0x0E, 0xE0, 0x1C, 0xC0, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3C, 0xE0, 0x3C,
+    0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C,
+    0xE0, 0x3C, 0xE0, 0x38, 0xE0, 0x38, 0xF0, 0x78, 0x7C, 0xF0, 0x3F, 0xF0, 0x1F, 0xC0, 0x06, 0x60,
+    0x0E, 0xE0, 0x0E, 0xE0, 0x1D, 0xC0, 0x19, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x70, 0xF0, 0x70,
+    0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x78, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C,
+    0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x38, 0xE0, 0x38,
+    0xF0, 0x78, 0x7C, 0xF8, 0x3F, 0xF0, 0x1F, 0xE0, 0x03, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0xC0,
+    0x03, 0xC0, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70, 0xF0, 0x70,
+    0xF0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x78, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x00, 0xE0, 0x01, 0xC0,
+    0x01, 0xC0, 0x01, 0xF0, 0x01, 0xF0, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0xEE, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0E, 0x70, 0x00,
+    0x1E, 0x70, 0x38, 0x1C, 0x70, 0x3C, 0x1C, 0x70, 0x7C, 0x1C, 0x78, 0x7C, 0x1C, 0x38, 0x7E, 0x3C,
+    0x38, 0xEE, 0x38, 0x38, 0xEE, 0x38, 0x3C, 0xE7, 0x38, 0x1D, 0xC7, 0x38, 0x1D, 0xC7, 0x70, 0x1D,
+    0xC3, 0xF0, 0x1F, 0x83, 0xF0, 0x0F, 0x81, 0xE0, 0x0F, 0x01, 0xE0, 0x0F, 0x01, 0xE0, 0x00, 0x60,
+    0x00, 0x00, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xB8, 0x00, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xF0, 0xE0, 0xE0, 0x70, 0xF0, 0xE0, 0x70, 0xF1, 0xC0, 0x71,
+    0xF1, 0xC0, 0x39, 0xF9, 0xC0, 0x39, 0xBB, 0x80, 0x3B, 0xBB, 0x80, 0x1F, 0x9B, 0x80, 0x1F, 0x1F,
+    0x00, 0x1F, 0x1F, 0x00, 0x0F, 0x0F, 0x00, 0x0E, 0x0E, 0x00, 0x01, 0x00, 0x03, 0x80, 0x07, 0xC0,
+    0x0E, 0xE0, 0x0C, 0x60, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1E, 0x70, 0x1C, 0x78, 0x3C, 0x38, 0x38,
+    0x3C, 0x78, 0x1E, 0xF0, 0x0E, 0xE0, 0x0F, 0xE0, 0x07, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+    0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x02, 0x00, 0x07, 0x00, 0x0F, 0x80,
+    0x1D, 0xC0, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x70, 0xF0, 0x70, 0x70, 0x70, 0x70, 0xE0,
+    0x78, 0xE0, 0x38, 0xE0, 0x38, 0xC0, 0x1D, 0xC0, 0x1D, 0xC0, 0x1F, 0x80, 0x0F, 0x80, 0x0F, 0x80,
+    0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x9E, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x0E, 0xE0, 0x1E, 0xF0,
+    0x0E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1E, 0x70, 0x1C, 0x78, 0x3C, 0x38, 0x38, 0x3C, 0x78,
+    0x1E, 0xF0, 0x0E, 0xE0, 0x0F, 0xE0, 0x07, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+    0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x03, 0x80,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x7F, 0xFC, 0x00, 0x78, 0x00, 0xF0, 0x00, 0xE0,
+    0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0x3C, 0x00,
+    0x78, 0x00, 0x70, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80,
+    0x0F, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x70, 0x00, 0x7F, 0xE0, 0x7F, 0xE0,
+    0x03, 0x80, 0x07, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x7F, 0xFC, 0x00, 0x78,
+    0x00, 0xF0, 0x00, 0xE0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x1E, 0x00,
+    0x1C, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x70, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0x0E, 0x00, 0x0F, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80,
+    0x0F, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x70, 0x00, 0x7F, 0xE0, 0x7F, 0xE0,
+    0x0C, 0x60, 0x0E, 0xE0, 0x07, 0xC0, 0x07, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC,
+    0x7F, 0xFC, 0x00, 0x78, 0x00, 0xF0, 0x00, 0xE0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x07, 0x00,
+    0x0F, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x70, 0x00, 0xFF, 0xFC, 0xFF, 0xFC,
+    0x31, 0x80, 0x39, 0x80, 0x1F, 0x00, 0x0F, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0,
+    0x7F, 0xE0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x3C, 0x00,
+    0x78, 0x00, 0x70, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x3F, 0x7F, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x7C, 0x7E, 0xEE, 0xC6, 0x18,
+    0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF,
+    0xE0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x3B,
+    0x80, 0x7B, 0xC0, 0x3B, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xFC, 0x00, 0xFF, 0xFC,
+    0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0xFE, 0x00,
+    0x07, 0xFF, 0x80, 0x07, 0x8F, 0x80, 0x07, 0x03, 0xC0, 0x07, 0x01, 0xC0, 0x07, 0x01, 0xC0, 0x07,
+    0x01, 0xC0, 0x07, 0x03, 0xC0, 0x07, 0x07, 0xC0, 0x07, 0x1F, 0x80, 0x07, 0x1F, 0x00, 0x03, 0x00,
+    0x07, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xE0,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x07, 0xF8,
+    0x1F, 0xFC, 0x3F, 0x1C, 0x78, 0x00, 0x70, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0,
+    0xE0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x78, 0x00, 0x3F, 0x1C, 0x1F, 0xFC, 0x07, 0xF8,
+    0x1F, 0xE0, 0x3F, 0xF0, 0x7C, 0x70, 0x70, 0x00, 0x70, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x1F, 0x00,
+    0x07, 0xC0, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x38, 0x00, 0x78, 0x79, 0xF0, 0x7F, 0xF0,
+    0x3F, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0x67, 0x00, 0xF7, 0x80, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x1C,
+    0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C,
+    0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x01, 0xE0, 0xE7, 0xC0, 0xFF, 0xC0, 0x7F,
+    0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x07, 0x07, 0x00,
+    0x00, 0x07, 0x07, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x07, 0x07, 0xFC, 0x00, 0x07, 0x07, 0xFF,
+    0x00, 0x07, 0x07, 0x1F, 0x80, 0x07, 0x07, 0x03, 0x80, 0x0F, 0x07, 0x03, 0x80, 0x0E, 0x07, 0x03,
+    0xC0, 0x0E, 0x07, 0x03, 0x80, 0x1E, 0x07, 0x03, 0x80, 0x7C, 0x07, 0x1F, 0x80, 0xF8, 0x07, 0xFF,
+    0x00, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xE0,
+    0x38, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+    0xFC, 0xE0, 0x3C, 0x7C, 0xE0, 0x38, 0x1E, 0xE0, 0x38, 0x0E, 0xE0, 0x38, 0x0E, 0xE0, 0x38, 0x0E,
+    0xE0, 0x38, 0x1E, 0xE0, 0x3C, 0x7C, 0xE0, 0x3F, 0xF8, 0xE0, 0x3F, 0xF0, 0xFF, 0xFC, 0x00, 0xFF,
+    0xFC, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0xFE,
+    0x00, 0x07, 0xFF, 0x00, 0x07, 0x8F, 0x80, 0x07, 0x03, 0x80, 0x07, 0x03, 0x80, 0x07, 0x03, 0x80,
+    0x07, 0x03, 0x80, 0x07, 0x03, 0x80, 0x07, 0x03, 0x80, 0x07, 0x03, 0x80, 0x07, 0x03, 0x80, 0x01,
+    0x80, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x78, 0xE0,
+    0xF0, 0xE1, 0xE0, 0xE3, 0xC0, 0xE7, 0x80, 0xEF, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFF,
+    0x00, 0xEF, 0x80, 0xE7, 0xC0, 0xE3, 0xE0, 0xE1, 0xF0, 0xE0, 0xF0, 0xE0, 0x78, 0xE0, 0x3C, 0x0C,
+    0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1C, 0xE0,
+    0x3C, 0xE0, 0x7C, 0xE0, 0x7C, 0xE0, 0xFC, 0xE1, 0xFC, 0xE3, 0xDC, 0xE3, 0x9C, 0xE7, 0x1C, 0xEF,
+    0x1C, 0xFE, 0x1C, 0xFC, 0x1C, 0xFC, 0x1C, 0xF8, 0x1C, 0xF0, 0x1C, 0xF0, 0x1C, 0xE0, 0x1C, 0x0C,
+    0x70, 0x0E, 0xE0, 0x0F, 0xE0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1E, 0x70, 0x1C, 0x78,
+    0x1C, 0x38, 0x3C, 0x3C, 0x38, 0x1C, 0x38, 0x1E, 0x70, 0x0E, 0x70, 0x0F, 0xF0, 0x07, 0xE0, 0x03,
+    0xE0, 0x03, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x4F, 0x80, 0x7F, 0x00, 0x7E, 0x00, 0xE0, 0x1C, 0xE0,
+    0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0,
+    0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xFF, 0xFC, 0xFF, 0xFC, 0x07,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03,
+    0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0x70, 0x00, 0x0E, 0x70, 0x00, 0x0E, 0x78, 0x00, 0x1E, 0x38,
+    0x00, 0x1C, 0x3C, 0x00, 0x1C, 0x1C, 0x00, 0x3C, 0x1C, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFE, 0x00,
+    0x70, 0x0E, 0x00, 0x70, 0x0F, 0x00, 0xF0, 0x07, 0x00, 0xE0, 0x07, 0x80, 0xFF, 0xE0, 0xFF, 0xE0,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xC0, 0xFF, 0xE0, 0xE3, 0xF0, 0xE0, 0x78,
+    0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x78, 0xE0, 0x70, 0xE1, 0xF0, 0xFF, 0xE0, 0xFF, 0xC0, 0xFF, 0xC0,
+    0xFF, 0xE0, 0xE3, 0xF0, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE1, 0xF0, 0xFF, 0xE0, 0xFF, 0xF0,
+    0xE1, 0xF0, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x78, 0xE1, 0xF0, 0xFF, 0xF0, 0xFF, 0xC0,
+    0xFF, 0xE0, 0xFF, 0xE0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x07, 0x07, 0x00, 0x07, 0x07, 0x00, 0x07, 0x07,
+    0x00, 0x07, 0x07, 0x00, 0x07, 0x07, 0x00, 0x07, 0x07, 0x00, 0x07, 0x07, 0x00, 0x07, 0x07, 0x00,
+    0x0E, 0x07, 0x00, 0x0E, 0x07, 0x00, 0x1E, 0x07, 0x00, 0x1C, 0x07, 0x00, 0x3C, 0x07, 0x00, 0xFF,
+    0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xE0, 0x01, 0xC0, 0xE0, 0x01, 0xC0, 0xE0, 0x01, 0xC0, 0xE0, 0x01,
+    0xC0, 0xE0, 0x01, 0xC0, 0xFF, 0xE0, 0xFF, 0xE0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x78, 0x38, 0x3C, 0x3C, 0x38, 0x78, 0x1C, 0x38, 0xF0, 0x0E,
+    0x39, 0xE0, 0x0F, 0x3B, 0xC0, 0x07, 0xBF, 0x80, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFF,
+    0x00, 0x07, 0xBB, 0x80, 0x07, 0x39, 0xC0, 0x0E, 0x39, 0xE0, 0x1C, 0x38, 0xF0, 0x3C, 0x38, 0x70,
+    0x38, 0x38, 0x78, 0x78, 0x38, 0x3C, 0xF0, 0x38, 0x1C, 0x3F, 0xC0, 0x7F, 0xF0, 0x39, 0xF0, 0x00,
+    0x78, 0x00, 0x78, 0x00, 0x70, 0x01, 0xF0, 0x1F, 0xE0, 0x1F, 0xF0, 0x01, 0xF8, 0x00, 0x38, 0x00,
+    0x38, 0x00, 0x38, 0x00, 0x38, 0x79, 0xF8, 0x7F, 0xF0, 0x3F, 0xE0, 0xE0, 0x1C, 0xE0, 0x3C, 0xE0,
+    0x7C, 0xE0, 0x7C, 0xE0, 0xFC, 0xE1, 0xFC, 0xE3, 0xDC, 0xE3, 0x9C, 0xE7, 0x1C, 0xEF, 0x1C, 0xFE,
+    0x1C, 0xFC, 0x1C, 0xFC, 0x1C, 0xF8, 0x1C, 0xF0, 0x1C, 0xF0, 0x1C, 0xE0, 0x1C, 0x1C, 0x60, 0x1E,
+    0xE0, 0x0F, 0xC0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1C, 0xE0, 0x3C, 0xE0, 0x7C, 0xE0,
+    0x7C, 0xE0, 0xFC, 0xE1, 0xFC, 0xE3, 0xDC, 0xE3, 0x9C, 0xE7, 0x1C, 0xEF, 0x1C, 0xFE, 0x1C, 0xFC,
+    0x1C, 0xFC, 0x1C, 0xF8, 0x1C, 0xF0, 0x1C, 0xF0, 0x1C, 0xE0, 0x1C, 0xE0, 0x78, 0xE0, 0xF0, 0xE1,
+    0xE0, 0xE3, 0xC0, 0xE7, 0x80, 0xEF, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0xEF,
+    0x80, 0xE7, 0xC0, 0xE3, 0xE0, 0xE1, 0xF0, 0xE0, 0xF0, 0xE0, 0x78, 0xE0, 0x3C, 0x07, 0xFF, 0x07,
+    0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x0F, 0x07, 0x0E, 0x07, 0x0E, 0x07, 0x1E, 0x07, 0x7C, 0x07, 0xF8, 0x07, 0xF0, 0x07, 0x38,
+    0x01, 0xC0, 0x78, 0x01, 0xC0, 0x7C, 0x03, 0xC0, 0x7C, 0x03, 0xE0, 0x7E, 0x06, 0xE0, 0x76, 0x06,
+    0xE0, 0x77, 0x0C, 0xE0, 0x73, 0x0C, 0xE0, 0x73, 0x1C, 0xE0, 0x73, 0x98, 0xE0, 0x71, 0x98, 0xE0,
+    0x71, 0xF8, 0xE0, 0x70, 0xF0, 0xE0, 0xF0, 0xF0, 0xE0, 0xF0, 0xE0, 0xE0, 0xE0, 0x00, 0xE0, 0xE0,
+    0x00, 0xE0, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C,
+    0xFF, 0xFC, 0xFF, 0xFC, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C,
+    0xE0, 0x1C, 0xE0, 0x1C, 0x07, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x3E, 0x00, 0x78, 0x0F, 0x00,
+    0x70, 0x07, 0x80, 0x70, 0x07, 0x80, 0xF0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0,
+    0x03, 0x80, 0xF0, 0x03, 0x80, 0x70, 0x07, 0x80, 0x70, 0x07, 0x80, 0x78, 0x0F, 0x00, 0x3F, 0x3E,
+    0x00, 0x1F, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0,
+    0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0,
+    0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xFF, 0x80, 0xFF, 0xE0, 0xE3, 0xF0, 0xE0,
+    0x70, 0xE0, 0x78, 0xE0, 0x78, 0xE0, 0x78, 0xE0, 0x70, 0xE3, 0xF0, 0xFF, 0xE0, 0xFF, 0xC0, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x07, 0xF8, 0x1F, 0xFC, 0x3F,
+    0x3C, 0x78, 0x00, 0x78, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0x70, 0x00, 0x78, 0x00, 0x3F, 0x1C, 0x1F, 0xFC, 0x07, 0xF8, 0xFF, 0xFC, 0xFF,
+    0xFC, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07,
+    0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0xF0,
+    0x1E, 0x70, 0x1C, 0x78, 0x1C, 0x38, 0x3C, 0x3C, 0x38, 0x1C, 0x38, 0x1E, 0x70, 0x0E, 0x70, 0x0F,
+    0xF0, 0x07, 0xE0, 0x03, 0xE0, 0x03, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x4F, 0x80, 0x7F, 0x00, 0x7E,
+    0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x3E, 0xEF, 0xC0,
+    0x78, 0xE1, 0xE0, 0x70, 0xE0, 0xE0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xE0, 0xE0, 0xF0, 0xF0,
+    0xE0, 0xE0, 0x70, 0xE0, 0xE0, 0x78, 0xE1, 0xE0, 0x3E, 0xEF, 0xC0, 0x1F, 0xFF, 0x80, 0x0F, 0xFE,
+    0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x70, 0x1E, 0x78, 0x1C, 0x3C, 0x3C, 0x1C, 0x78, 0x1E,
+    0x70, 0x0F, 0xF0, 0x07, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0xE0, 0x0F, 0xE0, 0x0E, 0xF0, 0x1E,
+    0x78, 0x3C, 0x3C, 0x38, 0x1C, 0x78, 0x1E, 0xF0, 0x0E, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0,
+    0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0,
+    0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0x00, 0x07, 0x00,
+    0x07, 0x00, 0x07, 0x00, 0x07, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0,
+    0x38, 0xE0, 0x38, 0xF0, 0x38, 0x78, 0x78, 0x7F, 0xF8, 0x1F, 0xF8, 0x00, 0x38, 0x00, 0x38, 0x00,
+    0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38,
+    0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0,
+    0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70,
+    0x38, 0xE0, 0x70, 0x38, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38,
+    0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0,
+    0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70,
+    0x38, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x38, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0E,
+    0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0xFC,
+    0x00, 0x07, 0xFF, 0x00, 0x07, 0x1F, 0x80, 0x07, 0x03, 0x80, 0x07, 0x03, 0x80, 0x07, 0x03, 0xC0,
+    0x07, 0x03, 0x80, 0x07, 0x03, 0x80, 0x07, 0x1F, 0x80, 0x07, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0xE0,
+    0x03, 0xC0, 0xE0, 0x03, 0xC0, 0xE0, 0x03, 0xC0, 0xE0, 0x03, 0xC0, 0xE0, 0x03, 0xC0, 0xE0, 0x03,
+    0xC0, 0xFF, 0x83, 0xC0, 0xFF, 0xE3, 0xC0, 0xE3, 0xF3, 0xC0, 0xE0, 0x73, 0xC0, 0xE0, 0x73, 0xC0,
+    0xE0, 0x7B, 0xC0, 0xE0, 0x73, 0xC0, 0xE0, 0x73, 0xC0, 0xE3, 0xF3, 0xC0, 0xFF, 0xE3, 0xC0, 0xFF,
+    0x83, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xC0,
+    0xFF, 0xE0, 0xE3, 0xF0, 0xE0, 0x70, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x78, 0xE0, 0x70, 0xE1, 0xF0,
+    0xFF, 0xE0, 0xFF, 0xC0, 0x7F, 0xC0, 0xFF, 0xE0, 0x71, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1C,
+    0x00, 0x1C, 0x1F, 0xFC, 0x1F, 0xFC, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x78,
+    0x71, 0xF0, 0xFF, 0xE0, 0x7F, 0xC0, 0xE0, 0x1F, 0xC0, 0xE0, 0x7F, 0xF0, 0xE0, 0xF9, 0xF8, 0xE1,
+    0xE0, 0x38, 0xE1, 0xC0, 0x3C, 0xE3, 0xC0, 0x1C, 0xE3, 0xC0, 0x1C, 0xFF, 0x80, 0x1E, 0xFF, 0x80,
+    0x1E, 0xE3, 0x80, 0x1E, 0xE3, 0xC0, 0x1C, 0xE1, 0xC0, 0x1C, 0xE1, 0xC0, 0x3C, 0xE1, 0xE0, 0x38,
+    0xE0, 0xF9, 0xF8, 0xE0, 0x7F, 0xF0, 0xE0, 0x1F, 0xC0, 0x0F, 0xFC, 0x1F, 0xFC, 0x3E, 0x1C, 0x78,
+    0x1C, 0x70, 0x1C, 0x70, 0x1C, 0x78, 0x1C, 0x3E, 0x1C, 0x3F, 0xFC, 0x0F, 0xFC, 0x0E, 0x1C, 0x1E,
+    0x1C, 0x1C, 0x1C, 0x3C, 0x1C, 0x38, 0x1C, 0x78, 0x1C, 0x70, 0x1C, 0x7F, 0x80, 0x7F, 0xC0, 0x63,
+    0xC0, 0x01, 0xC0, 0x00, 0xE0, 0x3F, 0xE0, 0x7F, 0xE0, 0xF9, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1,
+    0xE0, 0xFF, 0xE0, 0x3F, 0xC0, 0x03, 0xF0, 0x0F, 0xF0, 0x1F, 0xE0, 0x3C, 0x00, 0x78, 0x00, 0x70,
+    0x00, 0x7F, 0xC0, 0xFF, 0xE0, 0xFD, 0xF0, 0xF0, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xF0,
+    0x38, 0x70, 0x78, 0x70, 0x70, 0x7C, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0xFF, 0x80, 0xFF, 0xC0, 0xE3,
+    0xC0, 0xE1, 0xC0, 0xE3, 0xC0, 0xFF, 0x80, 0xFF, 0xC0, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3,
+    0xE0, 0xFF, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xFF, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x0F,
+    0xF8, 0x0F, 0xF8, 0x0E, 0x38, 0x0E, 0x38, 0x0E, 0x38, 0x0C, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x1C,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0xFF, 0xFE, 0xFF, 0xFE, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0,
+    0x0E, 0x1F, 0x80, 0x3F, 0xE0, 0x79, 0xE0, 0xF0, 0xF0, 0xE0, 0x70, 0xFF, 0xF0, 0xFF, 0xF0, 0xE0,
+    0x00, 0xE0, 0x00, 0xF0, 0x00, 0x7C, 0x60, 0x3F, 0xE0, 0x1F, 0xE0, 0x78, 0xE1, 0xC0, 0x38, 0xE3,
+    0x80, 0x1C, 0xE7, 0x00, 0x0E, 0xEE, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00,
+    0x0E, 0xEE, 0x00, 0x1C, 0xE7, 0x00, 0x3C, 0xE7, 0x80, 0x38, 0xE3, 0xC0, 0x70, 0xE1, 0xC0, 0xF0,
+    0xE1, 0xE0, 0xFF, 0x00, 0xFF, 0x80, 0xE7, 0xC0, 0x01, 0xC0, 0x03, 0xC0, 0x3F, 0x80, 0x3F, 0x80,
+    0x03, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0xE3, 0xC0, 0xFF, 0xC0, 0xFF, 0x00, 0xE0, 0xE0, 0xE1, 0xE0,
+    0xE3, 0xE0, 0xE3, 0xE0, 0xE7, 0xE0, 0xEE, 0xE0, 0xEE, 0xE0, 0xFC, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0,
+    0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x71, 0x80, 0x3B, 0x80, 0x3F, 0x80, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE0, 0xE0, 0xE1, 0xE0, 0xE3, 0xE0, 0xE3, 0xE0, 0xE7, 0xE0, 0xEE, 0xE0, 0xEE, 0xE0,
+    0xFC, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE0, 0xE3, 0xC0,
+    0xE7, 0x80, 0xEF, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xEF, 0x00, 0xE7, 0x80,
+    0xE3, 0xC0, 0xE1, 0xC0, 0xE0, 0xE0, 0x0F, 0xF8, 0x0F, 0xF8, 0x0E, 0x38, 0x0E, 0x38, 0x0E, 0x38,
+    0x0E, 0x38, 0x0E, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x3C, 0x38, 0x78, 0x38, 0xF8, 0x38, 0xE0, 0x38,
+    0x70, 0x0E, 0x78, 0x1E, 0x78, 0x1E, 0x7C, 0x3E, 0x7C, 0x36, 0x76, 0x77, 0x76, 0x67, 0x67, 0xE7,
+    0x63, 0xC7, 0xE3, 0xC7, 0xE1, 0xC7, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0x1F, 0xC0, 0x3F, 0xE0, 0x79, 0xF0, 0x70, 0x70, 0xE0, 0x78, 0xE0, 0x38,
+    0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x78, 0x70, 0x70, 0x79, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0xFF, 0xE0,
+    0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0x80, 0xFF, 0xC0, 0xE3, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xF0, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0xF0, 0xE0, 0xE0, 0xF3, 0xE0, 0xFF, 0xC0,
+    0xFF, 0x80, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x1F, 0xC0, 0x3F, 0xC0,
+    0x7C, 0xC0, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00,
+    0x7C, 0xC0, 0x3F, 0xC0, 0x1F, 0xC0, 0xFF, 0xF0, 0xFF, 0xF0, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00,
+    0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00,
+    0xE0, 0x70, 0xF0, 0x70, 0x70, 0x70, 0x70, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xC0, 0x1D, 0xC0,
+    0x1D, 0xC0, 0x1F, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x9E, 0x00,
+    0xFC, 0x00, 0xF8, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00,
+    0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFE, 0x00, 0x7D, 0xDF, 0x00, 0x71,
+    0xC7, 0x80, 0xE1, 0xC3, 0x80, 0xE1, 0xC3, 0x80, 0xE1, 0xC3, 0x80, 0xE1, 0xC3, 0x80, 0xE1, 0xC3,
+    0x80, 0x71, 0xC7, 0x80, 0x7D, 0xDF, 0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xC0, 0x00,
+    0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x70, 0x78, 0xE0,
+    0x39, 0xE0, 0x1D, 0xC0, 0x1F, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x3D, 0xE0,
+    0x38, 0xE0, 0x70, 0xF0, 0xF0, 0x70, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xF8, 0xFF, 0xF8,
+    0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xF1, 0xE0, 0x7F, 0xE0, 0x3F, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0xE1, 0xC3, 0x80, 0xE1, 0xC3, 0x80, 0xE1, 0xC3, 0x80, 0xE1, 0xC3, 0x80, 0xE1, 0xC3,
+    0x80, 0xE1, 0xC3, 0x80, 0xE1, 0xC3, 0x80, 0xE1, 0xC3, 0x80, 0xE1, 0xC3, 0x80, 0xE1, 0xC3, 0x80,
+    0xE1, 0xC3, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xE1, 0xC3, 0x80, 0xE1, 0xC3, 0x80, 0xE1,
+    0xC3, 0x80, 0xE1, 0xC3, 0x80, 0xE1, 0xC3, 0x80, 0xE1, 0xC3, 0x80, 0xE1, 0xC3, 0x80, 0xE1, 0xC3,
+    0x80, 0xE1, 0xC3, 0x80, 0xE1, 0xC3, 0x80, 0xE1, 0xC3, 0x80, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0xFC, 0x00, 0xFC, 0x00,
+    0x1C, 0x00, 0x1C, 0x00, 0x1F, 0xF0, 0x1F, 0xFC, 0x1E, 0x3C, 0x1C, 0x1C, 0x1C, 0x1E, 0x1C, 0x1C,
+    0x1E, 0x3C, 0x1F, 0xFC, 0x0F, 0xF0, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E,
+    0xFF, 0x8E, 0xFF, 0xCE, 0xE3, 0xCE, 0xE1, 0xEE, 0xE1, 0xEE, 0xE3, 0xCE, 0xFF, 0xCE, 0xFF, 0x8E,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xE3, 0xC0, 0xE1, 0xE0,
+    0xE0, 0xE0, 0xE1, 0xE0, 0xE3, 0xC0, 0xFF, 0xC0, 0xFF, 0x80, 0x7F, 0x00, 0x7F, 0xC0, 0x63, 0xC0,
+    0x00, 0xE0, 0x00, 0xE0, 0x1F, 0xE0, 0x1F, 0xF0, 0x00, 0xE0, 0x00, 0xE0, 0x01, 0xE0, 0x63, 0xE0,
+    0x7F, 0xC0, 0x7F, 0x00, 0xE0, 0xFC, 0x00, 0xE3, 0xFE, 0x00, 0xE3, 0xCF, 0x00, 0xE7, 0x87, 0x80,
+    0xE7, 0x03, 0x80, 0xFF, 0x03, 0x80, 0xFF, 0x03, 0x80, 0xE7, 0x03, 0x80, 0xE7, 0x03, 0x80, 0xE7,
+    0x87, 0x80, 0xE3, 0xCF, 0x00, 0xE1, 0xFE, 0x00, 0xE0, 0xFC, 0x00, 0x1F, 0xF0, 0x3F, 0xF0, 0x3C,
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x7C, 0x70, 0x3F, 0xF0, 0x1F, 0xF0, 0x1C, 0x70, 0x38, 0x70, 0x38,
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x1C, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x79, 0xE0, 0xF0, 0xF0, 0xE0, 0x70, 0xFF, 0xF0, 0xFF,
+    0xF0, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0x7C, 0x60, 0x3F, 0xE0, 0x1F, 0xE0, 0x39, 0xC0, 0x3D,
+    0xC0, 0x39, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x79, 0xE0, 0xF0, 0xF0, 0xE0,
+    0x70, 0xFF, 0xF0, 0xFF, 0xF0, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0x7C, 0x60, 0x3F, 0xE0, 0x1F,
+    0xE0, 0x38, 0x00, 0x38, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x38, 0x00, 0x38, 0x00, 0x3F, 0xE0, 0x3F,
+    0xF0, 0x3C, 0xF0, 0x38, 0x78, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x78, 0x01, 0xF0, 0x01,
+    0xF0, 0x07, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0xFF, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x7C, 0xC0, 0x70,
+    0x00, 0xE0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0x7C, 0xE0, 0x3F,
+    0xE0, 0x1F, 0xE0, 0x3F, 0x80, 0xFF, 0x80, 0xF3, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
+    0x00, 0x0F, 0x80, 0x03, 0x80, 0x03, 0xC0, 0xE7, 0x80, 0xFF, 0x80, 0xFF, 0x00, 0xF0, 0xF0, 0x00,
+    0x00, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0xE7,
+    0x00, 0xF7, 0x00, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C,
+    0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C,
+    0x00, 0x1C, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1E, 0x3C, 0xFC, 0xF8, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00,
+    0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x3F, 0xE0, 0x0E, 0x3F, 0xF0, 0x1C,
+    0x3C, 0xF8, 0x1C, 0x38, 0x38, 0x3C, 0x38, 0x38, 0x78, 0x38, 0x78, 0xF8, 0x3F, 0xF0, 0xE0, 0x3F,
+    0xE0, 0xE0, 0xE0, 0x00, 0xE0, 0xE0, 0x00, 0xE0, 0xE0, 0x00, 0xE0, 0xE0, 0x00, 0xE0, 0xE0, 0x00,
+    0xE0, 0xFF, 0x80, 0xFF, 0xFF, 0xC0, 0xFF, 0xE3, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE3, 0xE0, 0xE0, 0xFF, 0xC0, 0xE0, 0xFF, 0x80, 0x38, 0x00, 0x38, 0x00, 0xFF, 0x80, 0xFF, 0x80,
+    0x38, 0x00, 0x38, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x3C, 0xF0, 0x38, 0x78, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x03, 0x00,
+    0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xE0, 0xE3, 0xC0,
+    0xE7, 0x80, 0xEF, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xEF, 0x00, 0xE7, 0x80,
+    0xE3, 0xC0, 0xE1, 0xC0, 0xE0, 0xE0, 0x18, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE1, 0xE0, 0xE3, 0xE0, 0xE3, 0xE0, 0xE7, 0xE0, 0xEE, 0xE0,
+    0xEE, 0xE0, 0xFC, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x18, 0xE0,
+    0x1D, 0xC0, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x70, 0xF0, 0x70, 0x70, 0x70,
+    0x70, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xC0, 0x1D, 0xC0, 0x1D, 0xC0, 0x1F, 0x80, 0x0F, 0x80,
+    0x0F, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x9E, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00,
+    0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x07, 0x1F, 0x80, 0x07, 0x03,
+    0x80, 0x07, 0x03, 0x80, 0x07, 0x03, 0xC0, 0x07, 0x03, 0x80, 0x07, 0x03, 0x80, 0x07, 0x1F, 0x80,
+    0x07, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00,
+    0x1C, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0x1C, 0x00, 0x1C, 0x00, 0x1F, 0xF0, 0x1F, 0xFC, 0x1E, 0x3C,
+    0x1C, 0x1C, 0x1C, 0x1E, 0x1C, 0x1C, 0x1E, 0x3C, 0x1F, 0xFC, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0x1F,
+    0xFC, 0x00, 0x3F, 0x3E, 0x00, 0x78, 0x0F, 0x00, 0x78, 0x07, 0x80, 0x70, 0x07, 0x80, 0xF0, 0x03,
+    0x80, 0xFF, 0x83, 0x80, 0xFF, 0xE7, 0x80, 0xF9, 0xFF, 0x80, 0xF0, 0x7F, 0x80, 0x70, 0x03, 0x80,
+    0x70, 0x07, 0x80, 0x78, 0x0F, 0x00, 0x3E, 0x3E, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x1F,
+    0xC0, 0x3F, 0xE0, 0x79, 0xF0, 0x70, 0x70, 0xFE, 0x78, 0xFF, 0x78, 0xF7, 0xF8, 0xE3, 0xF8, 0xE0,
+    0x78, 0x70, 0x70, 0x79, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0xE0, 0x03, 0xE0, 0xF0, 0x07, 0xE0, 0x70,
+    0x0F, 0x60, 0x78, 0x0E, 0x00, 0x78, 0x0E, 0x00, 0x38, 0x1C, 0x00, 0x3C, 0x1C, 0x00, 0x1C, 0x3C,
+    0x00, 0x1C, 0x38, 0x00, 0x1E, 0x38, 0x00, 0x0E, 0x70, 0x00, 0x0F, 0x70, 0x00, 0x07, 0xF0, 0x00,
+    0x07, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0xE0, 0x3C, 0xF0, 0x7C,
+    0x70, 0x70, 0x70, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x39, 0xC0, 0x1D, 0xC0, 0x1F, 0x80, 0x1F, 0x80,
+    0x0F, 0x80, 0x0F, 0x00, 0x07, 0x00, 0x1C, 0x60, 0x00, 0x1E, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x07,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x3C, 0x00, 0xE0, 0x7C,
+    0x00, 0xE0, 0x7C, 0x00, 0xE0, 0xFC, 0x00, 0xE1, 0xFC, 0x00, 0xE3, 0xDC, 0x00, 0xE3, 0x9C, 0x00,
+    0xE7, 0x1C, 0x00, 0xEF, 0x1C, 0x00, 0xFE, 0x1C, 0x00, 0xFC, 0x1C, 0x00, 0xFC, 0x1C, 0x00, 0xF8,
+    0x1C, 0x00, 0xF0, 0x1C, 0x00, 0xF0, 0x1F, 0x80, 0xE0, 0x1F, 0x80, 0x00, 0x07, 0x00, 0x00, 0x07,
+    0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0C, 0x00, 0x71, 0x80, 0x3B, 0x80, 0x3F, 0x80,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE1, 0xE0, 0xE3, 0xE0, 0xE3, 0xE0, 0xE7, 0xE0,
+    0xEE, 0xE0, 0xEE, 0xE0, 0xFC, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF0, 0xE0, 0xE0, 0xF8, 0xE0, 0xF8,
+    0x00, 0x38, 0x00, 0x38, 0x00, 0x78, 0x00, 0x70, 0x00, 0x60, 0x38, 0x00, 0x38, 0x00, 0xFF, 0x80,
+    0xFF, 0x80, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3F, 0xF0, 0x3F, 0xF8, 0x38, 0xFC, 0x38, 0x1E,
+    0x38, 0x0E, 0x38, 0x0E, 0x38, 0x0E, 0x38, 0x1E, 0x38, 0x7C, 0x3F, 0xF8, 0x3F, 0xF0, 0x38, 0x00,
+    0xFF, 0x80, 0xFF, 0x80, 0x38, 0x00, 0x38, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x38, 0xF8, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xF8, 0x3F, 0xF0, 0x3F, 0xE0, 0xFF, 0x80, 0xFF, 0xE0, 0xE3, 0xF0, 0xE0, 0x70,
+    0xE0, 0x78, 0xE0, 0x78, 0xE6, 0x78, 0xE7, 0x70, 0xE7, 0xF0, 0xFF, 0xE0, 0xFF, 0xC0, 0xE1, 0xC0,
+    0xE0, 0xE0, 0xE0, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xE3, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xF0, 0xE0, 0x70, 0xE0, 0x70, 0xE6, 0x70, 0xE6, 0xF0, 0xE7, 0xE0, 0xF3, 0xE0,
+    0xFF, 0xC0, 0xFF, 0xC0, 0xE1, 0xC0, 0xE0, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0xFF, 0x80, 0xFF, 0x80,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
+    0x38, 0x00, 0x38, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
+    0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x38, 0x00, 0x38, 0x00,
+    0x38, 0x00, 0x38, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
+    0x38, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0x80,
+    0xFF, 0xE0, 0xF1, 0xF0, 0xE0, 0xF0, 0xE0, 0x78, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38,
+    0xE0, 0x38, 0xE0, 0x78, 0x00, 0x70, 0x00, 0xF0, 0x03, 0xE0, 0x0F, 0xE0, 0x0F, 0x80, 0xFF, 0x80,
+    0xFF, 0x80, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xE3, 0xC0, 0xE1, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0xE0, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x80,
+    0x0F, 0x00, 0x78, 0x38, 0x3C, 0x3C, 0x38, 0x78, 0x1C, 0x38, 0xF0, 0x0E, 0x39, 0xE0, 0x07, 0x3B,
+    0xC0, 0x07, 0xBF, 0x80, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xBB, 0x80,
+    0x07, 0x39, 0xC0, 0x0E, 0x39, 0xE0, 0x1C, 0x38, 0xF0, 0x3C, 0x38, 0x70, 0x38, 0x38, 0x78, 0x78,
+    0x38, 0x3E, 0xF0, 0x38, 0x1E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x0E, 0x78, 0xE1, 0xC0, 0x38, 0xE3, 0x80, 0x1C, 0xE7, 0x00, 0x0E, 0xEE, 0x00,
+    0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0E, 0xFE, 0x00, 0x1C, 0xEF, 0x00, 0x3C,
+    0xE7, 0x80, 0x38, 0xE3, 0xC0, 0x70, 0xE1, 0xF0, 0xF0, 0xE1, 0xF0, 0x00, 0x00, 0x70, 0x00, 0x00,
+    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x3F, 0xC0, 0x7F, 0xF0, 0x39, 0xF0, 0x00, 0x78, 0x00,
+    0x78, 0x00, 0x70, 0x01, 0xF0, 0x1F, 0xE0, 0x1F, 0xF0, 0x01, 0xF8, 0x00, 0x38, 0x00, 0x38, 0x00,
+    0x38, 0x00, 0x38, 0x79, 0xF8, 0x7F, 0xF0, 0x7F, 0xE0, 0x07, 0x00, 0x03, 0x80, 0x03, 0x80, 0x0F,
+    0x80, 0x0F, 0x00, 0xFF, 0x00, 0xFF, 0x80, 0xE7, 0xC0, 0x01, 0xC0, 0x03, 0xC0, 0x3F, 0x80, 0x3F,
+    0x80, 0x03, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0xE3, 0xC0, 0xFF, 0xC0, 0xFF, 0x00, 0x1C, 0x00, 0x0E,
+    0x00, 0x0E, 0x00, 0x3E, 0x00, 0x3C, 0x00, 0xE0, 0x78, 0xE0, 0xF0, 0xE1, 0xE0, 0xE3, 0xC0, 0xE7,
+    0x80, 0xEF, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xEF, 0x00, 0xE7, 0x80, 0xE3, 0xC0, 0xE1,
+    0xE0, 0xE1, 0xE0, 0xE0, 0xF0, 0xE0, 0x7E, 0xE0, 0x3E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00,
+    0x0E, 0x00, 0x0E, 0xE1, 0xE0, 0xE3, 0xC0, 0xE7, 0x80, 0xEE, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0xFC,
+    0x00, 0xFE, 0x00, 0xEF, 0x00, 0xE7, 0x80, 0xE3, 0xC0, 0xE1, 0xF0, 0xE0, 0xF0, 0x00, 0x70, 0x00,
+    0x70, 0x00, 0x70, 0x00, 0x70, 0xE0, 0x1E, 0xE0, 0x3C, 0xE0, 0x78, 0xEC, 0xF0, 0xED, 0xE0, 0xED,
+    0xC0, 0xEF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xED, 0xC0, 0xED, 0xE0, 0xEC, 0xF0, 0xEC, 0x70, 0xE0,
+    0x78, 0xE0, 0x3C, 0xE0, 0x1E, 0xE0, 0x0E, 0xE0, 0x70, 0xE0, 0xF0, 0xFD, 0xE0, 0xFF, 0xC0, 0xFF,
+    0x80, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0xFD, 0xC0, 0xFC, 0xE0, 0xE0, 0xF0, 0xE0, 0x78, 0xE0,
+    0x38, 0x38, 0x1E, 0x38, 0x3C, 0xFF, 0x78, 0xFF, 0xF0, 0x39, 0xE0, 0x3B, 0xC0, 0x3F, 0x80, 0x3F,
+    0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x3B, 0xE0, 0x38, 0xF0, 0x38, 0x78, 0x38, 0x3C, 0x38, 0x1E, 0x38,
+    0x1E, 0x38, 0x0F, 0x38, 0x78, 0x38, 0xF0, 0xFF, 0xE0, 0xFF, 0xC0, 0x3F, 0x80, 0x3F, 0x00, 0x3F,
+    0x00, 0x3F, 0x80, 0x3B, 0xC0, 0x39, 0xE0, 0x38, 0xF0, 0x38, 0x78, 0x38, 0x3C, 0xFF, 0x03, 0xC0,
+    0xFF, 0x07, 0x80, 0x07, 0x0F, 0x00, 0x07, 0x1E, 0x00, 0x07, 0x3C, 0x00, 0x07, 0x78, 0x00, 0x07,
+    0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x07, 0x7C, 0x00, 0x07, 0x3E,
+    0x00, 0x07, 0x1E, 0x00, 0x07, 0x0F, 0x00, 0x07, 0x07, 0x80, 0x07, 0x03, 0xC0, 0x07, 0x01, 0xC0,
+    0xFC, 0x1C, 0xFC, 0x38, 0x1C, 0x78, 0x1C, 0xF0, 0x1D, 0xE0, 0x1F, 0xC0, 0x1F, 0x80, 0x1F, 0xE0,
+    0x1C, 0xF0, 0x1C, 0x78, 0x1C, 0x38, 0x1C, 0x1C, 0x1C, 0x1E, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C,
+    0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xFF, 0xFC, 0xFF, 0xFC, 0xE0, 0x1C, 0xE0, 0x1C,
+    0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1F, 0xE0, 0x1F, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xFF, 0xE0, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xE0, 0xF8,
+    0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0xE0, 0x1F, 0xC0, 0xE0, 0x1F, 0xC0, 0xE0, 0x1C,
+    0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xFF, 0xFC, 0x00,
+    0xFF, 0xFC, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0,
+    0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0xFC, 0xE0, 0xFC, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38,
+    0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x3F, 0xF0, 0xE0, 0x3F, 0xF8, 0xE0, 0x3C, 0x7C,
+    0xE0, 0x38, 0x1C, 0xE0, 0x38, 0x1E, 0xE0, 0x38, 0x0E, 0xE0, 0x38, 0x0E, 0xE0, 0x38, 0x0E, 0xE0,
+    0x38, 0x0E, 0xE0, 0x38, 0x0E, 0xE0, 0x38, 0x0E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1C, 0x00, 0x00,
+    0x7C, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xE0, 0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0xE0, 0xE0, 0x00,
+    0xE0, 0xE0, 0x00, 0xE0, 0xE0, 0x00, 0xE0, 0xFF, 0x80, 0xE0, 0xFF, 0xC0, 0xE0, 0xE3, 0xC0, 0xE0,
+    0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00,
+    0xE0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x00, 0x07, 0xF8, 0x00,
+    0x1F, 0xF8, 0x00, 0x3F, 0x18, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0x70, 0x7E, 0x00, 0xF0,
+    0xFF, 0x00, 0xE1, 0xF7, 0x80, 0xE1, 0xC3, 0x80, 0xE1, 0xC3, 0xC0, 0xF1, 0xC3, 0xC0, 0x71, 0xC3,
+    0xC0, 0x71, 0xC3, 0x80, 0x79, 0xC7, 0x80, 0x3F, 0xDF, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xF8, 0x00,
+    0x00, 0x70, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0x80, 0x1F,
+    0x80, 0x3F, 0x80, 0x7C, 0x00, 0xF1, 0xF0, 0xE3, 0xF8, 0xE7, 0xB8, 0xE7, 0x38, 0xE7, 0x18, 0xE7,
+    0x38, 0xF7, 0x38, 0x7F, 0xF8, 0x3F, 0xF0, 0x1F, 0xC0, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0xF8, 0x00,
+    0x78, 0x07, 0xF8, 0x1F, 0xFC, 0x3F, 0x3C, 0x78, 0x00, 0x78, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x78, 0x00, 0x3F, 0x1C, 0x1F,
+    0xFC, 0x07, 0xF8, 0x01, 0x80, 0x03, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x1F,
+    0xC0, 0x3F, 0xC0, 0x7C, 0xC0, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xF0, 0x00, 0x7C, 0xC0, 0x3F, 0xC0, 0x1F, 0xC0, 0x06, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x1F, 0x00, 0x1F, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07,
+    0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07,
+    0x80, 0x07, 0x80, 0x07, 0xE0, 0x07, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0xFF, 0xF0, 0xFF, 0xF0, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E,
+    0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03,
+    0x80, 0x03, 0x80, 0xF0, 0x1E, 0x70, 0x1C, 0x78, 0x3C, 0x38, 0x38, 0x3C, 0x78, 0x1E, 0xF0, 0x0E,
+    0xE0, 0x0F, 0xE0, 0x07, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03,
+    0x80, 0x03, 0x80, 0x03, 0x80, 0xE0, 0x70, 0xF0, 0x70, 0x70, 0x70, 0x70, 0xF0, 0x78, 0xE0, 0x38,
+    0xE0, 0x39, 0xC0, 0x3D, 0xC0, 0x1D, 0xC0, 0x1F, 0x80, 0x0F, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x07,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xF0, 0x1E, 0x70, 0x1C, 0x78, 0x3C, 0x38,
+    0x38, 0x3C, 0x78, 0x1E, 0x70, 0x0E, 0xE0, 0x0F, 0xE0, 0x07, 0xC0, 0x07, 0xC0, 0x3F, 0xF8, 0x3F,
+    0xF8, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0xE0, 0x70, 0xF0, 0x70, 0x70,
+    0x70, 0x70, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x39, 0xC0, 0x1D, 0xC0, 0x1F, 0x80, 0x1F, 0x80, 0x0F,
+    0x80, 0x7F, 0xE0, 0x7F, 0xE0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x70,
+    0x1E, 0x00, 0x78, 0x1C, 0x00, 0x3C, 0x3C, 0x00, 0x1C, 0x78, 0x00, 0x1E, 0x70, 0x00, 0x0F, 0xF0,
+    0x00, 0x07, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xE0, 0x00,
+    0x0E, 0xF0, 0x00, 0x1E, 0x78, 0x00, 0x3C, 0x3C, 0x00, 0x38, 0x1C, 0x00, 0x78, 0x1F, 0x80, 0xF0,
+    0x0F, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07,
+    0x80, 0x70, 0x70, 0x78, 0xE0, 0x39, 0xE0, 0x1D, 0xC0, 0x1F, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
+    0x80, 0x1F, 0xC0, 0x3D, 0xE0, 0x38, 0xE0, 0x70, 0xF8, 0xF0, 0x78, 0x00, 0x38, 0x00, 0x38, 0x00,
+    0x38, 0x00, 0x38, 0xFF, 0xF8, 0xE0, 0xFF, 0xF8, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x00, 0xE0, 0x07,
+    0x00, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x00,
+    0xE0, 0x07, 0x00, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x00, 0xE0,
+    0x07, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00,
+    0x00, 0x38, 0x00, 0x00, 0x38, 0xFF, 0xCE, 0xFF, 0xCE, 0x1E, 0x0E, 0x1E, 0x0E, 0x1E, 0x0E, 0x1E,
+    0x0E, 0x1E, 0x0E, 0x1E, 0x0E, 0x1E, 0x0E, 0x1E, 0x0E, 0x1E, 0x0E, 0x1F, 0xFF, 0x1F, 0xFF, 0x00,
+    0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0,
+    0x38, 0xE0, 0x38, 0xE0, 0x38, 0xF0, 0x38, 0x78, 0x78, 0x7F, 0xF8, 0x1F, 0xF8, 0x00, 0x38, 0x00,
+    0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00,
+    0x0E, 0x00, 0x0E, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xE0, 0x7F,
+    0xE0, 0x3F, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00,
+    0x70, 0x00, 0x70, 0x00, 0x70, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0,
+    0x38, 0xE7, 0x38, 0xF7, 0x38, 0x7F, 0x78, 0x7F, 0xF8, 0x3F, 0xF8, 0x07, 0x38, 0x07, 0x38, 0x07,
+    0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x76,
+    0x70, 0x7E, 0xF0, 0x7F, 0xF0, 0x3F, 0xF0, 0x06, 0x70, 0x06, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
+    0x70, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xC0, 0xFF,
+    0xF0, 0xF1, 0xF0, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0,
+    0x38, 0xE0, 0x38, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF,
+    0x80, 0xFF, 0xC0, 0xF3, 0xC0, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xC0, 0x03,
+    0xE7, 0xC0, 0x03, 0x81, 0xE0, 0xE7, 0x00, 0xE0, 0xE7, 0x00, 0xF0, 0xFF, 0x00, 0x70, 0x7F, 0xFF,
+    0xF0, 0x3F, 0xFF, 0xF0, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x80, 0x00,
+    0x03, 0x80, 0x00, 0x03, 0xF1, 0xC0, 0x01, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0x01, 0xF8, 0x07, 0xFC,
+    0xE7, 0x9E, 0xEF, 0x0E, 0xFE, 0x07, 0x7F, 0xFF, 0x3F, 0xFF, 0x0E, 0x00, 0x0E, 0x00, 0x0F, 0x00,
+    0x07, 0xCE, 0x07, 0xFE, 0x01, 0xFE, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xC0, 0x03, 0xE7, 0xC0, 0x03,
+    0x81, 0xE0, 0xE7, 0x00, 0xE0, 0xE7, 0x00, 0xF0, 0xFF, 0x00, 0x70, 0x7F, 0xFF, 0xF0, 0x3F, 0xFF,
+    0xF0, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0x80, 0x00,
+    0x03, 0xF1, 0xC0, 0x01, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00,
+    0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x01, 0xF8, 0x07, 0xFC, 0xE7, 0x9E, 0xEF, 0x0E,
     0xFE, 0x07, 0x7F, 0xFF, 0x3F, 0xFF, 0x0E, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x07, 0xCE, 0x07, 0xFE,
-    0x01, 0xFE, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x01, 0xC6, 0x00, 0x01, 0xDC, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1E, 0x0E, 0x0F, 0x1E, 0x1C, 0x3C, 0x1C, 0x38, 0xF0, 0x1C, 0x73, 0xC0, 0x3C, 0xEF,
-    0x00, 0x3D, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xC0, 0x03, 0xDD, 0xC0, 0x07,
-    0x39, 0xC0, 0x1C, 0x73, 0xC0, 0x70, 0xE3, 0xC1, 0xE1, 0xC3, 0x83, 0x83, 0x87, 0x8F, 0x07, 0x07,
-    0xBC, 0x0E, 0x07, 0x00, 0x03, 0x1C, 0x00, 0x77, 0x00, 0x0F, 0xE0, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1E, 0x38, 0x71, 0xC7, 0x1C, 0x1C, 0xE7, 0x01, 0xDD, 0xC0, 0x1F, 0xF0, 0x01, 0xFE,
-    0x00, 0x7F, 0xC0, 0x1D, 0xDC, 0x07, 0x39, 0xC1, 0xE7, 0x3C, 0x38, 0xE3, 0xCE, 0x1C, 0x3B, 0xC3,
-    0x87, 0x80, 0xE0, 0x7F, 0x07, 0xB8, 0x79, 0xC7, 0x8E, 0x78, 0x77, 0x83, 0xF8, 0x1F, 0xF0, 0xFF,
-    0xE7, 0x1F, 0xB8, 0x3D, 0xC0, 0xFE, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x07, 0xE0, 0x38, 0x03, 0xC0,
-    0x1C, 0x03, 0xE0, 0xFE, 0x07, 0xE0, 0xE1, 0xFC, 0x7B, 0x9E, 0x77, 0x8F, 0xC1, 0xFE, 0x3F, 0xE7,
-    0x3E, 0xE1, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0E, 0x01, 0xC0, 0x78, 0x1E, 0x0F, 0x81, 0xE0, 0x07,
-    0xFF, 0x01, 0xFF, 0xC0, 0x70, 0x70, 0x1C, 0x1C, 0x07, 0x07, 0x01, 0xC1, 0xC0, 0x70, 0x70, 0x1C,
-    0x1C, 0x07, 0x07, 0x01, 0xC1, 0xC0, 0xF0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x07, 0x81, 0xC7, 0xC0,
-    0x73, 0xE0, 0x1F, 0xF0, 0x07, 0xC0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x01,
-    0xC0, 0x0F, 0xF8, 0x0F, 0xF8, 0x0E, 0x38, 0x0E, 0x38, 0x0E, 0x38, 0x0E, 0x38, 0x0E, 0x38, 0x1C,
-    0x38, 0x1C, 0x38, 0x3C, 0x38, 0x78, 0x38, 0xF8, 0x3E, 0xE0, 0x3E, 0x00, 0x0E, 0x00, 0x0E, 0x00,
-    0x1E, 0x00, 0x1C, 0x00, 0x18, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8,
-    0x07, 0xE0, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x0F, 0x00, 0xF8, 0x03, 0xE0, 0xE0, 0xFC, 0x1F, 0x83,
-    0xF0, 0x7E, 0x0F, 0xFF, 0xFF, 0xFF, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0E, 0x01, 0xC0,
-    0x38, 0x0F, 0x07, 0xC0, 0xF8, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0,
-    0x1C, 0xE0, 0x1C, 0xFF, 0xFC, 0xFF, 0xFC, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0,
-    0x1C, 0xE0, 0x1C, 0xE0, 0x1F, 0xE0, 0x1F, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1C, 0x00,
-    0x1C, 0xE0, 0xE7, 0x07, 0x38, 0x39, 0xC1, 0xCE, 0x0E, 0x7F, 0xF3, 0xFF, 0x9C, 0x1C, 0xE0, 0xE7,
-    0x07, 0x38, 0x39, 0xC1, 0xFE, 0x0F, 0x80, 0x1C, 0x00, 0xE0, 0x0E, 0x00, 0x70, 0x03, 0x00, 0xE0,
-    0x3F, 0x01, 0xF8, 0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x1F, 0xC0, 0xEE, 0x07, 0x7C, 0x7B, 0xFF, 0xC7,
-    0xFE, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0x00, 0x38, 0x01, 0xC0,
-    0x0E, 0x00, 0x70, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xE3, 0xDF, 0xF9, 0xFF, 0x00, 0xE0,
-    0x1C, 0x03, 0x81, 0xF0, 0x3E, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x38, 0x01, 0xC1, 0xE0, 0x07,
-    0x07, 0xC0, 0x3C, 0x1F, 0x00, 0xF8, 0x7E, 0x06, 0xE1, 0xD8, 0x1B, 0x87, 0x70, 0xCE, 0x1C, 0xC3,
-    0x38, 0x73, 0x1C, 0xE1, 0xCE, 0x63, 0x87, 0x19, 0x8E, 0x1C, 0x7E, 0x38, 0x70, 0xF0, 0xE3, 0xC3,
-    0xC3, 0x8F, 0x0E, 0x0E, 0x38, 0x00, 0x3F, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80,
-    0x00, 0x1C, 0x00, 0x00, 0x70, 0x00, 0x01, 0x80, 0x70, 0x0E, 0x1E, 0x07, 0x87, 0x81, 0xE1, 0xF0,
-    0xF8, 0x7C, 0x36, 0x1D, 0x9D, 0xC7, 0x66, 0x71, 0x9F, 0x9C, 0x63, 0xC7, 0x38, 0xF1, 0xCE, 0x1C,
-    0x73, 0x80, 0x1F, 0xE0, 0x07, 0xC0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x07, 0x80, 0x00,
-    0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0E, 0x30, 0x03, 0xB8, 0x01, 0xFC, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0xC0, 0x03, 0xE0, 0x03, 0xF0, 0x01, 0xDC, 0x01,
-    0xCE, 0x00, 0xE7, 0x80, 0xF1, 0xC0, 0x70, 0xF0, 0x38, 0x38, 0x3C, 0x1C, 0x1F, 0xFF, 0x0F, 0xFF,
-    0x8E, 0x01, 0xC7, 0x00, 0xF7, 0x80, 0x3B, 0x80, 0x1E, 0x31, 0xC7, 0x70, 0xFE, 0x0F, 0x80, 0x00,
-    0x00, 0x1F, 0xE3, 0xFE, 0x63, 0xC0, 0x38, 0x03, 0x9F, 0xF7, 0xFF, 0xF3, 0xF8, 0x3F, 0x07, 0xF1,
-    0xFF, 0xFC, 0xFF, 0x00, 0x0E, 0x70, 0x07, 0xB8, 0x03, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,
-    0x00, 0x0F, 0x80, 0x07, 0xC0, 0x07, 0xE0, 0x03, 0xB8, 0x03, 0x9C, 0x01, 0xCF, 0x01, 0xE3, 0x80,
-    0xE1, 0xE0, 0x70, 0x70, 0x78, 0x38, 0x3F, 0xFE, 0x1F, 0xFF, 0x1C, 0x03, 0x8E, 0x01, 0xEF, 0x00,
-    0x77, 0x00, 0x3C, 0x3B, 0x8F, 0x78, 0xEE, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xF3, 0x1E, 0x01, 0xC0,
-    0x1C, 0xFF, 0xBF, 0xFF, 0x9F, 0xC1, 0xF8, 0x3F, 0x8F, 0xFF, 0xE7, 0xF8, 0x00, 0x3F, 0xFC, 0x00,
-    0xFF, 0xF8, 0x03, 0xF8, 0x00, 0x07, 0x70, 0x00, 0x1E, 0xE0, 0x00, 0x39, 0xC0, 0x00, 0xE3, 0x80,
-    0x03, 0xC7, 0xFC, 0x07, 0x0F, 0xF8, 0x1C, 0x1C, 0x00, 0x78, 0x38, 0x00, 0xFF, 0xF0, 0x03, 0xFF,
-    0xE0, 0x07, 0x01, 0xC0, 0x1E, 0x03, 0x80, 0x38, 0x07, 0xFF, 0xE0, 0x0F, 0xFE, 0x7F, 0x1F, 0x87,
-    0xFB, 0xFC, 0x63, 0xFB, 0xE0, 0x1E, 0x0E, 0x00, 0xE0, 0xE3, 0xFF, 0xFE, 0x7F, 0xFF, 0xEF, 0x9E,
-    0x00, 0xE0, 0xE0, 0x0E, 0x0F, 0x00, 0xF1, 0xF8, 0xCF, 0xFF, 0xFC, 0x3F, 0x9F, 0xC0, 0x71, 0x87,
-    0xB8, 0x3F, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0xFE, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00,
-    0xE0, 0x0F, 0xFC, 0xFF, 0xCE, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x38, 0xC3, 0xDC, 0x1F, 0x80, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xFE, 0x79, 0xEF, 0x0F,
-    0xE0, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0xE0, 0x0F, 0x00, 0x7C, 0x63, 0xFE, 0x1F, 0xE0, 0x3F, 0xE0,
-    0x7F, 0xF8, 0x38, 0xFC, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0xFF, 0xFF,
-    0xFF, 0xFE, 0xE0, 0x0E, 0xF0, 0x0E, 0x70, 0x1E, 0x78, 0x1C, 0x7C, 0x7C, 0x3F, 0xF8, 0x0F, 0xE0,
-    0x7F, 0x87, 0xFC, 0x63, 0xE0, 0x0F, 0x00, 0x70, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0x0F, 0x79,
-    0xE7, 0xFC, 0x3F, 0x80, 0x0E, 0xE0, 0x1E, 0xF0, 0x0E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x7F, 0xF8, 0x38, 0xFC, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0xFF, 0xFF,
-    0xFF, 0xFE, 0xE0, 0x0E, 0xF0, 0x0E, 0x70, 0x1E, 0x78, 0x1C, 0x7C, 0x7C, 0x3F, 0xF8, 0x0F, 0xE0,
-    0x39, 0xC3, 0xBC, 0x39, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x7F, 0xC6, 0x3E, 0x00, 0xF0, 0x07, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFE, 0x07, 0xF0, 0xF7, 0x9E, 0x7F, 0xC3, 0xF8, 0x01, 0xCE, 0x00, 0x03, 0xDC,
-    0x00, 0x07, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x07, 0x07, 0x8F, 0x0E, 0x1E, 0x0E,
-    0x1C, 0x78, 0x0E, 0x39, 0xE0, 0x1E, 0x77, 0x80, 0x1E, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF0,
-    0x00, 0x7F, 0xE0, 0x01, 0xEE, 0xE0, 0x03, 0x9C, 0xE0, 0x0E, 0x39, 0xE0, 0x38, 0x71, 0xE0, 0xF0,
-    0xE1, 0xC1, 0xC1, 0xC3, 0xC7, 0x83, 0x83, 0xDE, 0x07, 0x03, 0x80, 0x03, 0xB8, 0x00, 0xF7, 0x80,
-    0x0E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xC3, 0x8E, 0x38, 0xE0, 0xE7, 0x38, 0x0E, 0xEE,
-    0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0xEE, 0xE0, 0x39, 0xCE, 0x0F, 0x39, 0xE1, 0xC7,
-    0x1E, 0x70, 0xE1, 0xDE, 0x1C, 0x3C, 0x19, 0xC0, 0xF7, 0x81, 0x9C, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x07, 0xFF, 0x0E, 0x7C, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x00, 0x7C, 0x1F, 0xE0, 0x7F, 0xC0, 0x1F,
-    0x80, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0x03, 0x9E, 0x7E, 0x7F, 0xF0, 0xFF, 0x80, 0x73, 0x9D, 0xE7,
-    0x38, 0x00, 0x00, 0x3F, 0xCF, 0xFB, 0x9F, 0x01, 0xC0, 0xF3, 0xF8, 0xFE, 0x03, 0xC0, 0x70, 0x1F,
-    0x8F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFB, 0xFF, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01,
-    0xFC, 0x0F, 0xF0, 0x0F, 0xC0, 0x1E, 0x00, 0x70, 0x03, 0x80, 0x1D, 0xE7, 0xFF, 0xFE, 0x7F, 0xC0,
-    0x7F, 0xF7, 0xFE, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0F, 0x00, 0xF8, 0x0F, 0xE0, 0x3F, 0x00,
-    0xF0, 0x07, 0x00, 0x70, 0x07, 0x00, 0xF7, 0x3E, 0x7F, 0xE7, 0xF8, 0x1F, 0xE0, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1C, 0x03, 0xB8, 0x0F, 0x70, 0x3E, 0xE0, 0x7D, 0xC1, 0xFB, 0x87, 0xF7,
-    0x1E, 0xEE, 0x39, 0xDC, 0xE3, 0xBB, 0xC7, 0x7F, 0x0E, 0xFC, 0x1D, 0xF8, 0x3B, 0xE0, 0x77, 0x80,
-    0xEF, 0x01, 0xDC, 0x03, 0x80, 0x3F, 0x87, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xC1, 0xF8, 0x7F, 0x1F,
-    0xE3, 0xFC, 0xFF, 0xBB, 0xF7, 0x7F, 0xCF, 0xF1, 0xFE, 0x3F, 0x87, 0xE0, 0xFC, 0x1C, 0x1C, 0xE0,
-    0x3D, 0xC0, 0x73, 0x80, 0x00, 0x00, 0x00, 0x1C, 0x03, 0xB8, 0x0F, 0x70, 0x3E, 0xE0, 0x7D, 0xC1,
-    0xFB, 0x87, 0xF7, 0x1E, 0xEE, 0x39, 0xDC, 0xE3, 0xBB, 0xC7, 0x7F, 0x0E, 0xFC, 0x1D, 0xF8, 0x3B,
-    0xE0, 0x77, 0x80, 0xEF, 0x01, 0xDC, 0x03, 0x80, 0x3B, 0x8F, 0x78, 0xEE, 0x00, 0x00, 0x01, 0xC1,
-    0xF8, 0x7F, 0x1F, 0xE3, 0xFC, 0xFF, 0xBB, 0xF7, 0x7F, 0xCF, 0xF1, 0xFE, 0x3F, 0x87, 0xE0, 0xFC,
-    0x1C, 0x07, 0x38, 0x03, 0xBC, 0x01, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0xF0,
-    0x7E, 0x7C, 0x78, 0x0F, 0x38, 0x03, 0xDC, 0x01, 0xFE, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x80,
-    0x0F, 0xE0, 0x07, 0x70, 0x07, 0xB8, 0x03, 0xDE, 0x03, 0xC7, 0xE7, 0xC1, 0xFF, 0xC0, 0x3F, 0xC0,
-    0x19, 0xC1, 0xEF, 0x06, 0x70, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x8F, 0x3E, 0x70, 0x77, 0x03,
-    0xF8, 0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x3D, 0xC1, 0xCF, 0x3E, 0x3F, 0xE0, 0xFE, 0x00, 0x07, 0xF8,
-    0x0F, 0xFE, 0x0F, 0x8F, 0x8F, 0x01, 0xE7, 0x00, 0x7B, 0x80, 0x1F, 0x80, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x01, 0xFC, 0x00, 0xEE, 0x00, 0xF7, 0x80, 0x7B, 0xC0, 0x78, 0xFC, 0xF8, 0x3F, 0xF8,
-    0x07, 0xF8, 0x00, 0x1F, 0xC1, 0xFF, 0x1F, 0x7C, 0xE0, 0xEE, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x07,
-    0xE0, 0x7B, 0x83, 0x9E, 0x7C, 0x7F, 0xC1, 0xFC, 0x00, 0x07, 0x38, 0x03, 0xBC, 0x01, 0xCE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0xF0, 0x7C, 0x7C, 0x78, 0x0F, 0x38, 0x03, 0xDC, 0x00,
-    0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xE0, 0x07, 0x70, 0x07, 0xBC, 0x03, 0xDE,
-    0x03, 0xC7, 0xE7, 0xC1, 0xFF, 0xC0, 0x3F, 0xC0, 0x39, 0xC1, 0xEF, 0x0E, 0x70, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0xFF, 0x8F, 0xBE, 0x70, 0x77, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xF0, 0x3D, 0xC1,
-    0xCF, 0x3E, 0x3F, 0xE0, 0xFE, 0x00, 0x39, 0xC0, 0x7B, 0x80, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x3F, 0xF8, 0x38, 0xF8, 0x00, 0x78, 0x00, 0x78, 0x00, 0x70, 0x00, 0xE1, 0xFF, 0xC3, 0xFF,
-    0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x78, 0x01, 0xE3, 0x8F, 0x8F, 0xFE, 0x0F, 0xF8, 0x00,
-    0x73, 0x87, 0xB8, 0x73, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0xC6, 0x3C, 0x00, 0xE0, 0x0E, 0x1F,
-    0xE1, 0xFF, 0x00, 0xE0, 0x0E, 0x01, 0xE6, 0x3E, 0x7F, 0xC7, 0xF0, 0x0F, 0xF0, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1E, 0x03, 0xDC, 0x07, 0x3C, 0x0E, 0x38, 0x3C, 0x78, 0x70, 0x70, 0xE0,
-    0xF3, 0x80, 0xE7, 0x01, 0xFE, 0x01, 0xF8, 0x01, 0xF0, 0x03, 0xC0, 0x03, 0x80, 0x0E, 0x02, 0x7C,
-    0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x1F, 0xC1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x07, 0xF0, 0x77,
-    0x07, 0x70, 0xE7, 0x8E, 0x38, 0xE3, 0x8C, 0x1D, 0xC1, 0xDC, 0x1F, 0x80, 0xF8, 0x0F, 0x80, 0x70,
-    0x07, 0x00, 0x70, 0x9E, 0x0F, 0xC0, 0xF8, 0x00, 0x0E, 0x70, 0x3D, 0xE0, 0x39, 0xC0, 0x00, 0x00,
-    0x00, 0x1E, 0x03, 0xDC, 0x07, 0x3C, 0x0E, 0x38, 0x3C, 0x78, 0x70, 0x70, 0xE0, 0xF3, 0x80, 0xE7,
-    0x01, 0xFE, 0x01, 0xF8, 0x01, 0xF0, 0x03, 0xC0, 0x03, 0x80, 0x0E, 0x02, 0x7C, 0x07, 0xF0, 0x0F,
-    0xC0, 0x00, 0x1D, 0xC3, 0xDE, 0x1D, 0xC0, 0x00, 0x00, 0x0E, 0x07, 0xF0, 0x77, 0x07, 0x70, 0xE7,
-    0x8E, 0x38, 0xE3, 0x8C, 0x1D, 0xC1, 0xDC, 0x1F, 0x80, 0xF8, 0x0F, 0x80, 0x70, 0x07, 0x00, 0x70,
-    0x9E, 0x0F, 0xC0, 0xF8, 0x00, 0x01, 0x98, 0x07, 0x70, 0x1D, 0xC0, 0x73, 0x00, 0x66, 0x00, 0x00,
-    0x00, 0x00, 0x78, 0x0F, 0x70, 0x1C, 0xF0, 0x38, 0xE0, 0xF1, 0xE1, 0xC1, 0xC3, 0x83, 0xCE, 0x03,
-    0x9C, 0x07, 0xF8, 0x07, 0xE0, 0x07, 0xC0, 0x0F, 0x00, 0x0E, 0x00, 0x38, 0x09, 0xF0, 0x1F, 0xC0,
-    0x3F, 0x00, 0x07, 0x30, 0x77, 0x0E, 0xE1, 0xDC, 0x18, 0xC0, 0x00, 0x00, 0x0E, 0x07, 0xF0, 0x77,
-    0x07, 0x70, 0xE7, 0x8E, 0x38, 0xE3, 0x8C, 0x1D, 0xC1, 0xDC, 0x1F, 0x80, 0xF8, 0x0F, 0x80, 0x70,
-    0x07, 0x00, 0x70, 0x9E, 0x0F, 0xC0, 0xF8, 0x00, 0x1C, 0xE0, 0xEF, 0x07, 0x38, 0x00, 0x00, 0x00,
-    0x70, 0x1F, 0x80, 0xFC, 0x07, 0xE0, 0x3F, 0x01, 0xF8, 0x0F, 0xC0, 0x7F, 0x03, 0xBC, 0x3D, 0xFF,
-    0xE3, 0xFF, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x73, 0x8F, 0x71, 0xCE,
-    0x00, 0x00, 0x01, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0xC7, 0xBF, 0xF3, 0xFE, 0x01, 0xC0,
-    0x38, 0x07, 0x00, 0xE0, 0x1C, 0xFF, 0xFF, 0xFF, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00,
-    0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0xC0, 0xF8, 0x07, 0x00, 0xE0, 0x1C,
-    0x03, 0x80, 0x70, 0x00, 0xFF, 0x7F, 0xB8, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38,
-    0x1E, 0x0F, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x00, 0x07, 0x38, 0x01, 0xDE, 0x00, 0x73, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00,
-    0x3F, 0xFE, 0x0F, 0xFF, 0xE3, 0xF8, 0xFC, 0xFE, 0x07, 0x3F, 0x81, 0xCF, 0xE0, 0x7B, 0xF8, 0x1C,
-    0xFE, 0x07, 0x3F, 0x8F, 0xCF, 0xFF, 0xE3, 0xFF, 0xE0, 0xF0, 0x0E, 0xE0, 0x3D, 0xE0, 0x3B, 0x80,
-    0x00, 0x00, 0x00, 0x1C, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0xFE, 0x3F, 0xFE,
-    0x7E, 0x3C, 0xFC, 0x3D, 0xF8, 0x7B, 0xF1, 0xE7, 0xFF, 0xCF, 0xFF, 0x1C, 0x7F, 0xFD, 0xFF, 0xF0,
-    0x7F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF0, 0x33, 0x9D,
-    0xEE, 0x70, 0x7B, 0xDC, 0xE7, 0x30, 0x7B, 0xDC, 0xE7, 0x30, 0x33, 0xB9, 0xDD, 0xDE, 0xEE, 0x77,
-    0x38, 0x7B, 0xBD, 0xDC, 0xEE, 0x77, 0x73, 0x38, 0x7B, 0xBD, 0xDC, 0xEE, 0x77, 0x73, 0x38, 0x06,
-    0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0xFF, 0xDF, 0xF8, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00,
-    0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x06, 0x00, 0xC0, 0x18,
-    0x03, 0x00, 0x60, 0xFF, 0xDF, 0xF8, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x07, 0xFE, 0xFF, 0xC1,
-    0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x7D, 0xFF, 0xFF, 0xFF, 0xEF, 0x80, 0xF0,
-    0x70, 0x77, 0x87, 0x83, 0xFC, 0x1C, 0x1C, 0x3E, 0x07, 0x00, 0x03, 0xF8, 0x70, 0x00, 0x3D, 0xC3,
-    0x80, 0x01, 0xC6, 0x38, 0x00, 0x0E, 0x3B, 0xC0, 0x00, 0x71, 0xDC, 0x00, 0x03, 0x8D, 0xC0, 0x00,
-    0x1E, 0xEE, 0xF8, 0x7C, 0x7F, 0xEF, 0xE7, 0xF1, 0xF7, 0xF7, 0x3B, 0x80, 0x77, 0x1B, 0x8E, 0x07,
-    0xB8, 0xFC, 0x70, 0x39, 0xC7, 0xE3, 0x83, 0x8E, 0x37, 0x1C, 0x1C, 0x7B, 0x9D, 0xC1, 0xC1, 0xFC,
-    0xFE, 0x0E, 0x07, 0xC3, 0xE0, 0x0C, 0x38, 0xF1, 0xC7, 0x8E, 0x1E, 0x1C, 0x3C, 0x38, 0x30, 0xC3,
-    0x87, 0x1E, 0x38, 0xF3, 0x9E, 0x73, 0x8C, 0x00, 0x00, 0x38, 0x03, 0x80, 0x1C, 0x01, 0xC0, 0x0E,
-    0x00, 0xE0, 0x0E, 0x00, 0x70, 0x07, 0x00, 0x38, 0x03, 0x80, 0x1C, 0x01, 0xC0, 0x1C, 0x00, 0xE0,
-    0x0E, 0x00, 0x70, 0x00, 0x3E, 0x3F, 0x9D, 0xDC, 0x6E, 0x3F, 0x1F, 0x8C, 0xEE, 0x7F, 0x1F, 0x00,
-    0x07, 0x07, 0x87, 0xC7, 0xE7, 0x73, 0x3B, 0xFF, 0xFF, 0x07, 0x03, 0x80, 0x7E, 0xFD, 0x87, 0xEF,
-    0xE3, 0xC1, 0xE7, 0xFF, 0xF8, 0x0F, 0x1F, 0x9F, 0x0F, 0xC7, 0xF3, 0xB9, 0x8E, 0xEE, 0x7F, 0x1F,
-    0x00, 0x7F, 0x3F, 0x81, 0xC1, 0xC0, 0xE0, 0xE0, 0x70, 0x30, 0x38, 0x1C, 0x00, 0x3E, 0x3F, 0x9D,
-    0xCE, 0xE7, 0xE3, 0xF9, 0x8D, 0xEE, 0x7F, 0x1F, 0x00, 0x3E, 0x3F, 0x9D, 0xDC, 0x67, 0xF1, 0xF8,
-    0x1C, 0x3E, 0x7E, 0x3C, 0x00, 0x3E, 0x3F, 0x9D, 0xDC, 0x6E, 0x3F, 0x1F, 0x8C, 0xEE, 0x7F, 0x1F,
-    0x00, 0x3B, 0xFF, 0xF1, 0x8C, 0x63, 0x18, 0xC0, 0x7E, 0x7F, 0x67, 0x07, 0x0E, 0x1C, 0x38, 0x70,
-    0x7F, 0x7F, 0x7E, 0x7E, 0x6F, 0x3E, 0x3E, 0x0F, 0x07, 0x67, 0x7F, 0x7E, 0x07, 0x07, 0x87, 0xC7,
-    0xE7, 0x73, 0x3B, 0xFF, 0xFF, 0x07, 0x03, 0x80, 0x7E, 0xFD, 0x87, 0xEF, 0xE3, 0xC1, 0xE7, 0xFF,
-    0xF8, 0x0F, 0x1F, 0x9F, 0x0F, 0xC7, 0xF3, 0xB9, 0x8E, 0xEE, 0x7F, 0x1F, 0x00, 0x7F, 0x3F, 0x81,
-    0xC1, 0xC0, 0xE0, 0xE0, 0x70, 0x30, 0x38, 0x1C, 0x00, 0x3E, 0x3F, 0x9D, 0xCE, 0xE7, 0xE3, 0xF9,
-    0x8D, 0xEE, 0x7F, 0x1F, 0x00, 0x3E, 0x3F, 0x9D, 0xDC, 0x67, 0xF1, 0xF8, 0x1C, 0x3E, 0x7E, 0x3C,
-    0x00, 0x07, 0xF8, 0x7F, 0x87, 0xCC, 0x38, 0x03, 0x80, 0x7F, 0xF3, 0xFF, 0x87, 0x00, 0x38, 0x07,
-    0xFE, 0x3F, 0xF0, 0x70, 0x03, 0xC0, 0x0E, 0x00, 0x7C, 0x61, 0xFF, 0x07, 0xF8, 0xFF, 0xFF, 0xFF,
-    0xC1, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0xF0, 0x1F, 0x83, 0xF0, 0x7F, 0x03, 0xF8, 0x01, 0xF8, 0x0F,
-    0xC1, 0xF8, 0x3F, 0x81, 0xFC, 0x00, 0xE0, 0x07, 0x00, 0x1F, 0xC0, 0x7F, 0xC1, 0x8F, 0x00, 0x1C,
-    0x00, 0x71, 0xFF, 0xF7, 0xFF, 0xC0, 0xF8, 0x07, 0xC0, 0x7C, 0x07, 0xFF, 0xDF, 0xFF, 0x38, 0x00,
-    0xE0, 0x03, 0xC7, 0x0F, 0xFE, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0, 0x03, 0x8F, 0xFF, 0x7F,
-    0xF8, 0x07, 0x00, 0xF8, 0xFF, 0x87, 0xF0, 0x1E, 0x00, 0x78, 0x01, 0xC0, 0x07, 0x00, 0x3C, 0x00,
-    0xF0, 0x03, 0xC0, 0x7F, 0x83, 0xFE, 0x18, 0xF8, 0x01, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC3, 0xFF,
-    0x3F, 0xFB, 0xE7, 0xFC, 0x1F, 0xC0, 0xFE, 0x07, 0x70, 0x3B, 0x81, 0xDC, 0x1C, 0xFB, 0xE3, 0xFE,
-    0x0F, 0xE0, 0x03, 0xC0, 0x01, 0xE0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x67, 0x00, 0x73, 0x80, 0x38,
-    0xE0, 0x38, 0x70, 0x1C, 0x38, 0x1C, 0x0E, 0x0E, 0x07, 0x07, 0x03, 0xC7, 0x00, 0xE3, 0x80, 0x71,
-    0xC0, 0x3D, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F,
-    0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE,
-    0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xDC, 0x00, 0x70,
-    0x03, 0xC0, 0x0E, 0x00, 0x38, 0x01, 0xE0, 0x07, 0x80, 0x1C, 0x01, 0xE0, 0x1E, 0x00, 0xE0, 0x0F,
-    0x00, 0xF0, 0x07, 0x00, 0x78, 0x03, 0x80, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x00, 0x38,
-    0x03, 0x80, 0x1C, 0x01, 0xC0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x70, 0x07, 0x00, 0x38, 0x03, 0x80,
-    0x1C, 0x01, 0xC0, 0x1C, 0x00, 0xE0, 0x0E, 0x00, 0x70, 0x00, 0xFF, 0xF0, 0x00, 0x0E, 0x00, 0x18,
-    0x00, 0x70, 0x00, 0xE0, 0x01, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x30, 0x00, 0xE1, 0xE1,
-    0xC7, 0xC3, 0x0F, 0xCE, 0x03, 0x9C, 0x03, 0xB8, 0x07, 0x60, 0x07, 0xC0, 0x0F, 0x80, 0x1E, 0x00,
-    0x1C, 0x00, 0x3C, 0xF9, 0xFF, 0xF7, 0x7D, 0xF8, 0xE3, 0x77, 0xDD, 0xFF, 0xF3, 0xEF, 0x80, 0x07,
-    0x83, 0xE0, 0xF0, 0x78, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07,
-    0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x1F, 0x0F, 0x83, 0xC0, 0x7C, 0x3F, 0xF7,
-    0xEF, 0xFC, 0x3E, 0x00, 0x00, 0x00, 0x7C, 0x3F, 0xF7, 0xEF, 0xFC, 0x3E, 0x00, 0xC0, 0x1C, 0x01,
-    0xCF, 0xFF, 0xFF, 0xF0, 0x70, 0x07, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x38, 0x03, 0x80, 0x30, 0x00,
-    0x00, 0x70, 0x1F, 0x0F, 0xE3, 0xF8, 0xFC, 0x0F, 0x00, 0xFC, 0x03, 0xF8, 0x0F, 0xE0, 0x1F, 0x00,
-    0x70, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0xE0, 0x0F, 0x80, 0x7F, 0x00, 0xFC, 0x03, 0xF0, 0x0F,
-    0x03, 0xF0, 0xFC, 0x7F, 0x0F, 0x80, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0,
+    0x01, 0xFE, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x01, 0xC6, 0x00, 0x00, 0xEE,
+    0x00, 0x00, 0xFE, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x38, 0x3C,
+    0x3C, 0x38, 0x78, 0x1C, 0x38, 0xF0, 0x0E, 0x39, 0xE0, 0x0F, 0x3B, 0xC0, 0x07, 0xBF, 0x80, 0x03,
+    0xFF, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xBB, 0x80, 0x07, 0x39, 0xC0, 0x0E, 0x39,
+    0xE0, 0x1C, 0x38, 0xF0, 0x3C, 0x38, 0x70, 0x38, 0x38, 0x78, 0x78, 0x38, 0x3C, 0xF0, 0x38, 0x1C,
+    0x03, 0x1C, 0x00, 0x03, 0xB8, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x78, 0xE1, 0xC0, 0x38, 0xE3, 0x80, 0x1C, 0xE7, 0x00, 0x0E, 0xEE, 0x00, 0x07, 0xFC,
+    0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0E, 0xEE, 0x00, 0x1C, 0xE7, 0x00, 0x3C, 0xE7, 0x80,
+    0x38, 0xE3, 0xC0, 0x70, 0xE1, 0xC0, 0xF0, 0xE1, 0xE0, 0xE0, 0x78, 0xE0, 0xF0, 0xE1, 0xE0, 0xE3,
+    0xC0, 0xE7, 0x80, 0xEF, 0x00, 0xFE, 0x00, 0xFF, 0x80, 0xFF, 0xE0, 0xE3, 0xF0, 0xE0, 0xF0, 0xE0,
+    0x78, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0x00, 0x78, 0x00, 0x70, 0x01,
+    0xF0, 0x0F, 0xE0, 0x0F, 0xC0, 0xE1, 0xE0, 0xE3, 0xC0, 0xE7, 0x80, 0xEF, 0x00, 0xFC, 0x00, 0xFF,
+    0x00, 0xFF, 0x80, 0xE7, 0xC0, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00,
+    0xE0, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x80, 0x0F, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x07,
+    0x07, 0x00, 0x07, 0x07, 0x00, 0x07, 0x07, 0x00, 0x07, 0x07, 0x00, 0x07, 0x07, 0x00, 0x07, 0x07,
+    0x00, 0x07, 0x07, 0x00, 0x07, 0x07, 0x00, 0x0F, 0x07, 0x00, 0x0E, 0x07, 0x00, 0x0E, 0x07, 0x00,
+    0x1E, 0x07, 0x00, 0x7C, 0x07, 0x00, 0xF8, 0x07, 0xC0, 0xF0, 0x07, 0xC0, 0x00, 0x01, 0xC0, 0x00,
+    0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x0F, 0xF8, 0x0F, 0xF8, 0x0E,
+    0x38, 0x0E, 0x38, 0x0E, 0x38, 0x0E, 0x38, 0x0E, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x3C, 0x38, 0x78,
+    0x38, 0xF8, 0x3E, 0xE0, 0x3E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0x18, 0xE0,
+    0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xFF, 0xFC, 0xFF,
+    0xFC, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0,
+    0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0xF8, 0x00, 0xF8, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x01, 0xE0, 0x07, 0xC0, 0x07, 0xC0, 0xE0,
+    0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xFF, 0xFC, 0xFF,
+    0xFC, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1F, 0xE0,
+    0x1F, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x1C, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xF8, 0xE0, 0xF8, 0x00, 0x38, 0x00, 0x38, 0x00, 0x70, 0x00, 0x70, 0x00, 0x60, 0xE0,
+    0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xF0, 0x38, 0x70, 0x38, 0x7C,
+    0x78, 0x7F, 0xF8, 0x1F, 0xF8, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0xF8, 0x00,
+    0xF8, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xE0, 0x7F, 0xE0, 0x3F, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x38, 0x01, 0xC0,
+    0x78, 0x01, 0xC0, 0x7C, 0x03, 0xC0, 0x7C, 0x03, 0xE0, 0x7E, 0x06, 0xE0, 0x76, 0x06, 0xE0, 0x77,
+    0x0C, 0xE0, 0x73, 0x0C, 0xE0, 0x73, 0x1C, 0xE0, 0x73, 0x98, 0xE0, 0x71, 0x98, 0xE0, 0x71, 0xF8,
+    0xE0, 0x70, 0xF0, 0xE0, 0xF0, 0xF0, 0xE0, 0xF0, 0xE0, 0xE0, 0xE0, 0x00, 0xFC, 0xE0, 0x00, 0xFC,
+    0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x60, 0x70,
+    0x0E, 0x00, 0x78, 0x1E, 0x00, 0x78, 0x1E, 0x00, 0x7C, 0x3E, 0x00, 0x7C, 0x36, 0x00, 0x76, 0x77,
+    0x00, 0x76, 0x67, 0x00, 0x67, 0xE7, 0x00, 0x63, 0xC7, 0x00, 0xE3, 0xC7, 0x00, 0xE1, 0xC7, 0x00,
+    0xE0, 0x07, 0xC0, 0xE0, 0x07, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00,
+    0x07, 0x80, 0x00, 0x03, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x0E, 0x30, 0x00, 0x07, 0x70, 0x00, 0x07, 0xF0, 0x00, 0x03,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0,
+    0x00, 0x07, 0xE0, 0x00, 0x07, 0x70, 0x00, 0x0E, 0x70, 0x00, 0x0E, 0x78, 0x00, 0x1E, 0x38, 0x00,
+    0x1C, 0x3C, 0x00, 0x1C, 0x1C, 0x00, 0x3C, 0x1C, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x70,
+    0x0E, 0x00, 0x70, 0x0F, 0x00, 0xF0, 0x07, 0x00, 0xE0, 0x07, 0x80, 0x31, 0xC0, 0x3B, 0x80, 0x3F,
+    0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x63, 0xC0, 0x01, 0xC0, 0x00,
+    0xE0, 0x3F, 0xE0, 0x7F, 0xE0, 0xF9, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xE0, 0xFF, 0xE0, 0x3F,
+    0xC0, 0x0E, 0x70, 0x00, 0x0F, 0x70, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0x70, 0x00, 0x0E,
+    0x70, 0x00, 0x0E, 0x78, 0x00, 0x1E, 0x38, 0x00, 0x1C, 0x3C, 0x00, 0x1C, 0x1C, 0x00, 0x3C, 0x1C,
+    0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0F, 0x00, 0xF0, 0x07, 0x00,
+    0xE0, 0x07, 0x80, 0x3B, 0x80, 0x7B, 0xC0, 0x3B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F,
+    0xC0, 0x63, 0xC0, 0x01, 0xC0, 0x00, 0xE0, 0x3F, 0xE0, 0x7F, 0xE0, 0xF9, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xF1, 0xE0, 0xFF, 0xE0, 0x3F, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0xFE, 0x00,
+    0x00, 0xEE, 0x00, 0x01, 0xEE, 0x00, 0x01, 0xCE, 0x00, 0x03, 0x8E, 0x00, 0x07, 0x8F, 0xF8, 0x07,
+    0x0F, 0xF8, 0x0E, 0x0E, 0x00, 0x1E, 0x0E, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x38, 0x0E,
+    0x00, 0x78, 0x0E, 0x00, 0x70, 0x0F, 0xFE, 0xE0, 0x0F, 0xFE, 0x7F, 0x1F, 0x80, 0x7F, 0xBF, 0xC0,
+    0x63, 0xFB, 0xE0, 0x01, 0xE0, 0xE0, 0x00, 0xE0, 0xE0, 0x3F, 0xFF, 0xE0, 0x7F, 0xFF, 0xE0, 0xF9,
+    0xE0, 0x00, 0xE0, 0xE0, 0x00, 0xE0, 0xF0, 0x00, 0xF1, 0xF8, 0xC0, 0xFF, 0xFF, 0xC0, 0x3F, 0x9F,
+    0xC0, 0x71, 0x80, 0x7B, 0x80, 0x3F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF,
+    0xE0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x38,
+    0xC0, 0x3D, 0xC0, 0x1F, 0x80, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xE0, 0x79,
+    0xE0, 0xF0, 0xF0, 0xE0, 0x70, 0xFF, 0xF0, 0xFF, 0xF0, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0x7C,
+    0x60, 0x3F, 0xE0, 0x1F, 0xE0, 0x3F, 0xE0, 0x7F, 0xF8, 0x38, 0xFC, 0x00, 0x3C, 0x00, 0x1E, 0x00,
+    0x0E, 0x00, 0x0E, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFE, 0xE0, 0x0E, 0xF0, 0x0E, 0x70, 0x1E, 0x78,
+    0x1C, 0x7C, 0x7C, 0x3F, 0xF8, 0x0F, 0xE0, 0x7F, 0x80, 0x7F, 0xC0, 0x63, 0xE0, 0x00, 0xF0, 0x00,
+    0x70, 0x00, 0x70, 0xFF, 0xF0, 0xFF, 0xF0, 0xE0, 0x70, 0xF0, 0xF0, 0x79, 0xE0, 0x7F, 0xC0, 0x3F,
+    0x80, 0x0E, 0xE0, 0x1E, 0xF0, 0x0E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xF8, 0x38,
+    0xFC, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFE, 0xE0,
+    0x0E, 0xF0, 0x0E, 0x70, 0x1E, 0x78, 0x1C, 0x7C, 0x7C, 0x3F, 0xF8, 0x0F, 0xE0, 0x39, 0xC0, 0x3B,
+    0xC0, 0x39, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x63, 0xE0, 0x00, 0xF0, 0x00,
+    0x70, 0x00, 0x70, 0xFF, 0xF0, 0xFF, 0xF0, 0xE0, 0x70, 0xF0, 0xF0, 0x79, 0xE0, 0x7F, 0xC0, 0x3F,
+    0x80, 0x01, 0xCE, 0x00, 0x01, 0xEE, 0x00, 0x01, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x78, 0x38, 0x3C, 0x3C, 0x38, 0x78, 0x1C, 0x38, 0xF0, 0x0E, 0x39, 0xE0, 0x0F, 0x3B, 0xC0, 0x07,
+    0xBF, 0x80, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xBB, 0x80, 0x07, 0x39,
+    0xC0, 0x0E, 0x39, 0xE0, 0x1C, 0x38, 0xF0, 0x3C, 0x38, 0x70, 0x38, 0x38, 0x78, 0x78, 0x38, 0x3C,
+    0xF0, 0x38, 0x1C, 0x03, 0xB8, 0x00, 0x07, 0xBC, 0x00, 0x03, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x78, 0xE1, 0xC0, 0x38, 0xE3, 0x80, 0x1C, 0xE7, 0x00, 0x0E, 0xEE, 0x00, 0x07, 0xFC,
+    0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0E, 0xEE, 0x00, 0x1C, 0xE7, 0x00, 0x3C, 0xE7, 0x80,
+    0x38, 0xE3, 0xC0, 0x70, 0xE1, 0xC0, 0xF0, 0xE1, 0xE0, 0x19, 0xC0, 0x3D, 0xE0, 0x19, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0xF0, 0x39, 0xF0, 0x00, 0x78, 0x00, 0x78, 0x00, 0x70, 0x01,
+    0xF0, 0x1F, 0xE0, 0x1F, 0xF0, 0x01, 0xF8, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x79,
+    0xF8, 0x7F, 0xF0, 0x3F, 0xE0, 0x73, 0x80, 0x77, 0x80, 0x73, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0xFF, 0x80, 0xE7, 0xC0, 0x01, 0xC0, 0x03, 0xC0, 0x3F, 0x80, 0x3F, 0x80, 0x03, 0xC0, 0x01,
+    0xC0, 0x01, 0xC0, 0xE3, 0xC0, 0xFF, 0xC0, 0xFF, 0x00, 0x7F, 0xF8, 0x7F, 0xF8, 0x00, 0x70, 0x00,
+    0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x01, 0xF8, 0x00, 0x78, 0x00,
+    0x38, 0x00, 0x38, 0x00, 0x38, 0x79, 0xF8, 0xFF, 0xF0, 0x7F, 0xC0, 0x7F, 0xF0, 0x7F, 0xE0, 0x00,
+    0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x0F, 0xE0, 0x03, 0xF0, 0x00,
+    0xF0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0xF0, 0x73, 0xE0, 0x7F, 0xE0, 0x7F, 0x80, 0x1F,
+    0xE0, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1C, 0xE0, 0x3C, 0xE0, 0x7C, 0xE0,
+    0x7C, 0xE0, 0xFC, 0xE1, 0xFC, 0xE3, 0xDC, 0xE3, 0x9C, 0xE7, 0x1C, 0xEF, 0x1C, 0xFE, 0x1C, 0xFC,
+    0x1C, 0xFC, 0x1C, 0xF8, 0x1C, 0xF0, 0x1C, 0xF0, 0x1C, 0xE0, 0x1C, 0x3F, 0x80, 0x3F, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE1, 0xE0, 0xE3, 0xE0, 0xE3, 0xE0, 0xE7, 0xE0, 0xEE,
+    0xE0, 0xEE, 0xE0, 0xFC, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x1C,
+    0xE0, 0x1E, 0xE0, 0x1C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1C, 0xE0, 0x3C, 0xE0, 0x7C, 0xE0,
+    0x7C, 0xE0, 0xFC, 0xE1, 0xFC, 0xE3, 0xDC, 0xE3, 0x9C, 0xE7, 0x1C, 0xEF, 0x1C, 0xFE, 0x1C, 0xFC,
+    0x1C, 0xFC, 0x1C, 0xF8, 0x1C, 0xF0, 0x1C, 0xF0, 0x1C, 0xE0, 0x1C, 0x3B, 0x80, 0x7B, 0xC0, 0x3B,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE1, 0xE0, 0xE3, 0xE0, 0xE3, 0xE0, 0xE7, 0xE0, 0xEE,
+    0xE0, 0xEE, 0xE0, 0xFC, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x07,
+    0x38, 0x00, 0x07, 0x78, 0x00, 0x07, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8,
+    0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x3E, 0x00, 0x78, 0x0F, 0x00, 0x70, 0x07, 0x80, 0x70, 0x07, 0x80,
+    0xF0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xF0, 0x03, 0x80, 0x70,
+    0x07, 0x80, 0x70, 0x07, 0x80, 0x78, 0x0F, 0x00, 0x3F, 0x3E, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xF8,
+    0x00, 0x19, 0xC0, 0x3D, 0xE0, 0x19, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x79,
+    0xF0, 0x70, 0x70, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x78, 0x70, 0x70, 0x79,
+    0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x07, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3E, 0x3E, 0x00, 0x78, 0x0F,
+    0x00, 0x70, 0x07, 0x80, 0x70, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80,
+    0xE0, 0x03, 0x80, 0xF0, 0x03, 0x80, 0x70, 0x07, 0x80, 0x78, 0x07, 0x80, 0x78, 0x0F, 0x00, 0x3F,
+    0x3E, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x7D, 0xF0, 0x70, 0x70,
+    0xE0, 0x78, 0xFF, 0xF8, 0xFF, 0xF8, 0xE0, 0x38, 0xE0, 0x78, 0x70, 0x70, 0x79, 0xF0, 0x3F, 0xE0,
+    0x1F, 0xC0, 0x07, 0x38, 0x00, 0x07, 0x78, 0x00, 0x07, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3E, 0x3E, 0x00, 0x78, 0x0F, 0x00, 0x70, 0x07, 0x80,
+    0x70, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xE0, 0x03, 0x80, 0xF0,
+    0x03, 0x80, 0x70, 0x07, 0x80, 0x78, 0x07, 0x80, 0x78, 0x0F, 0x00, 0x3F, 0x3E, 0x00, 0x1F, 0xFC,
+    0x00, 0x07, 0xF8, 0x00, 0x39, 0xC0, 0x3D, 0xE0, 0x39, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
+    0x3F, 0xE0, 0x7D, 0xF0, 0x70, 0x70, 0xE0, 0x78, 0xFF, 0xF8, 0xFF, 0xF8, 0xE0, 0x38, 0xE0, 0x78,
+    0x70, 0x70, 0x79, 0xF0, 0x3F, 0xE0, 0x1F, 0xC0, 0x39, 0xC0, 0x3D, 0xC0, 0x39, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xE0, 0x71, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x1C,
+    0x1F, 0xFC, 0x1F, 0xFC, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x78, 0x71, 0xF0,
+    0xFF, 0xE0, 0x7F, 0xC0, 0x73, 0x80, 0x7B, 0x80, 0x73, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
+    0x7F, 0xC0, 0x63, 0xC0, 0x00, 0xE0, 0x00, 0xE0, 0x1F, 0xE0, 0x1F, 0xF0, 0x00, 0xE0, 0x00, 0xE0,
+    0x01, 0xE0, 0x63, 0xE0, 0x7F, 0xC0, 0x7F, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0x1E, 0x70, 0x1C, 0x78, 0x1C, 0x38, 0x3C, 0x3C, 0x38, 0x1C, 0x38, 0x1E, 0x70,
+    0x0E, 0x70, 0x0F, 0xF0, 0x07, 0xE0, 0x03, 0xE0, 0x03, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x4F, 0x80,
+    0x7F, 0x00, 0x7E, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x70,
+    0xF0, 0x70, 0x70, 0x70, 0x70, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xC0, 0x1D, 0xC0, 0x1D, 0xC0,
+    0x1F, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x9E, 0x00, 0xFC, 0x00,
+    0xF8, 0x00, 0x0E, 0x70, 0x1E, 0xF0, 0x0E, 0x70, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1E, 0x70, 0x1C,
+    0x78, 0x1C, 0x38, 0x3C, 0x3C, 0x38, 0x1C, 0x38, 0x1E, 0x70, 0x0E, 0x70, 0x0F, 0xF0, 0x07, 0xE0,
+    0x03, 0xE0, 0x03, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x4F, 0x80, 0x7F, 0x00, 0x7E, 0x00, 0x1D, 0xC0,
+    0x3D, 0xE0, 0x1D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x70, 0xF0, 0x70, 0x70, 0x70, 0x70, 0xE0,
+    0x78, 0xE0, 0x38, 0xE0, 0x38, 0xC0, 0x1D, 0xC0, 0x1D, 0xC0, 0x1F, 0x80, 0x0F, 0x80, 0x0F, 0x80,
+    0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x9E, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x01, 0x98, 0x03, 0xB8,
+    0x07, 0x70, 0x0E, 0x60, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1E, 0x70, 0x1C, 0x78, 0x1C,
+    0x38, 0x3C, 0x3C, 0x38, 0x1C, 0x38, 0x1E, 0x70, 0x0E, 0x70, 0x0F, 0xF0, 0x07, 0xE0, 0x03, 0xE0,
+    0x03, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x4F, 0x80, 0x7F, 0x00, 0x7E, 0x00, 0x07, 0x30, 0x07, 0x70,
+    0x0E, 0xE0, 0x1D, 0xC0, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x70, 0xF0, 0x70, 0x70, 0x70,
+    0x70, 0xE0, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xC0, 0x1D, 0xC0, 0x1D, 0xC0, 0x1F, 0x80, 0x0F, 0x80,
+    0x0F, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x9E, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x1C, 0xE0,
+    0x1D, 0xE0, 0x1C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38,
+    0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xF0, 0x38, 0x78, 0x78, 0x7F, 0xF8, 0x1F, 0xF8, 0x00, 0x38,
+    0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x73, 0x80, 0x7B, 0x80, 0x73, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xE0,
+    0x7F, 0xE0, 0x3F, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0xFF, 0xE0,
+    0xFF, 0xE0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+    0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x07, 0x38, 0x00, 0x07,
+    0x78, 0x00, 0x07, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0xC0, 0xE0, 0x03,
+    0xC0, 0xE0, 0x03, 0xC0, 0xE0, 0x03, 0xC0, 0xE0, 0x03, 0xC0, 0xE0, 0x03, 0xC0, 0xFF, 0x83, 0xC0,
+    0xFF, 0xE3, 0xC0, 0xE3, 0xF3, 0xC0, 0xE0, 0x73, 0xC0, 0xE0, 0x73, 0xC0, 0xE0, 0x7B, 0xC0, 0xE0,
+    0x73, 0xC0, 0xE0, 0x73, 0xC0, 0xE3, 0xF3, 0xC0, 0xFF, 0xE3, 0xC0, 0xFF, 0x83, 0xC0, 0x0E, 0xE0,
+    0x1E, 0xF0, 0x0E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E,
+    0xE0, 0x0E, 0xFF, 0x8E, 0xFF, 0xCE, 0xE3, 0xCE, 0xE1, 0xEE, 0xE1, 0xEE, 0xE3, 0xCE, 0xFF, 0xCE,
+    0xFF, 0x8E, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF,
+    0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x30, 0x70, 0x70, 0xF0, 0xE0, 0xE0, 0x78, 0x78, 0x70, 0x70,
+    0x70, 0x60, 0x78, 0x78, 0x70, 0x70, 0x70, 0x60, 0x33, 0x80, 0x73, 0x80, 0x77, 0x00, 0xF7, 0x00,
+    0xE7, 0x00, 0xE7, 0x00, 0x7B, 0x80, 0x7B, 0x80, 0x73, 0x80, 0x73, 0x80, 0x77, 0x00, 0x67, 0x00,
+    0x7B, 0x80, 0x7B, 0x80, 0x73, 0x80, 0x73, 0x80, 0x77, 0x00, 0x67, 0x00, 0x06, 0x00, 0x06, 0x00,
+    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+    0x7F, 0xE0, 0x7F, 0xE0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x7F, 0xE0,
+    0x7F, 0xE0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
+    0x7C, 0xFE, 0xFE, 0xFE, 0xFE, 0x7C, 0xF0, 0x70, 0x70, 0xF0, 0xF0, 0x78, 0xF0, 0x70, 0x70, 0x3E,
+    0x07, 0x00, 0x00, 0x7F, 0x0E, 0x00, 0x00, 0xF7, 0x0E, 0x00, 0x00, 0xE3, 0x1C, 0x00, 0x00, 0xE3,
+    0xBC, 0x00, 0x00, 0xE3, 0xB8, 0x00, 0x00, 0xE3, 0x70, 0x00, 0x00, 0xF7, 0x77, 0xC3, 0xE0, 0x7F,
+    0xEF, 0xE7, 0xF0, 0x3E, 0xFE, 0xE7, 0x70, 0x01, 0xDC, 0x6E, 0x38, 0x03, 0xDC, 0x7E, 0x38, 0x03,
+    0x9C, 0x7E, 0x38, 0x07, 0x1C, 0x6E, 0x38, 0x07, 0x1E, 0xE7, 0x70, 0x0E, 0x0F, 0xE7, 0xF0, 0x0E,
+    0x07, 0xC3, 0xE0, 0x0C, 0x1C, 0x3C, 0x38, 0x78, 0x70, 0x78, 0x38, 0x3C, 0x1C, 0x0C, 0xC0, 0xE0,
+    0x70, 0x78, 0x38, 0x3C, 0x38, 0x78, 0x70, 0xE0, 0xC0, 0x00, 0x38, 0x00, 0x70, 0x00, 0x70, 0x00,
+    0xE0, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x0E,
+    0x00, 0x1C, 0x00, 0x38, 0x00, 0x38, 0x00, 0x70, 0x00, 0x70, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x77,
+    0x00, 0xE3, 0x00, 0xE3, 0x80, 0xE3, 0x80, 0xE3, 0x00, 0x77, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x07,
+    0x00, 0x0F, 0x00, 0x1F, 0x00, 0x3F, 0x00, 0x77, 0x00, 0x67, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x07,
+    0x00, 0x07, 0x00, 0x7E, 0x7E, 0x60, 0xFC, 0xFE, 0x1E, 0x06, 0xCE, 0xFE, 0xFC, 0x0F, 0x00, 0x3F,
+    0x00, 0x7C, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x77, 0x00, 0x63, 0x80, 0x77, 0x00, 0x7F, 0x00, 0x3E,
+    0x00, 0x7F, 0x00, 0x7F, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x18,
+    0x00, 0x38, 0x00, 0x38, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x77, 0x00, 0x77, 0x00, 0x7E, 0x00, 0x7F,
+    0x00, 0x63, 0x00, 0xF7, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x77, 0x00, 0xE3,
+    0x00, 0x7F, 0x00, 0x3F, 0x00, 0x07, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x7F,
+    0x00, 0x77, 0x00, 0xE3, 0x00, 0xE3, 0x80, 0xE3, 0x80, 0xE3, 0x00, 0x77, 0x00, 0x7F, 0x00, 0x3E,
+    0x00, 0x38, 0x78, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x7F, 0x67, 0x07, 0x0E,
+    0x1C, 0x38, 0x70, 0x7F, 0x7F, 0x7E, 0x7E, 0x6F, 0x3E, 0x3E, 0x0F, 0x07, 0x67, 0x7F, 0x7E, 0x07,
+    0x00, 0x0F, 0x00, 0x1F, 0x00, 0x3F, 0x00, 0x77, 0x00, 0x67, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x07,
+    0x00, 0x07, 0x00, 0x7E, 0x7E, 0x60, 0xFC, 0xFE, 0x1E, 0x06, 0xCE, 0xFE, 0xFC, 0x0F, 0x00, 0x3F,
+    0x00, 0x7C, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x77, 0x00, 0x63, 0x80, 0x77, 0x00, 0x7F, 0x00, 0x3E,
+    0x00, 0x7F, 0x00, 0x7F, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x18,
+    0x00, 0x38, 0x00, 0x38, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x77, 0x00, 0x77, 0x00, 0x7E, 0x00, 0x7F,
+    0x00, 0x63, 0x00, 0xF7, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x77, 0x00, 0xE3,
+    0x00, 0x7F, 0x00, 0x3F, 0x00, 0x07, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x78, 0x00, 0x07, 0xF8, 0x0F,
+    0xF0, 0x1F, 0x30, 0x1C, 0x00, 0x38, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0x38, 0x00, 0x38, 0x00, 0xFF,
+    0xC0, 0xFF, 0xC0, 0x38, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x1F, 0x18, 0x0F, 0xF8, 0x07, 0xF8, 0xFF,
+    0xF8, 0xFF, 0xF8, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xE0, 0x07, 0xE0, 0x1F, 0x80, 0x7F,
+    0x00, 0x7F, 0x00, 0x07, 0xE0, 0x07, 0xE0, 0x1F, 0x80, 0x7F, 0x00, 0x7F, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x1F, 0xC0, 0x1F, 0xF0, 0x18, 0xF0, 0x00, 0x70, 0x00, 0x70, 0x7F, 0xFC, 0x7F, 0xFC, 0x03,
+    0xE0, 0x07, 0xC0, 0x1F, 0x00, 0x7F, 0xFC, 0x7F, 0xFC, 0x38, 0x00, 0x38, 0x00, 0x3C, 0x70, 0x3F,
+    0xF8, 0x0F, 0xF0, 0xFF, 0xF8, 0xFF, 0xF8, 0x03, 0xC0, 0x01, 0xC0, 0xFF, 0xF0, 0xFF, 0xF0, 0x01,
+    0xC0, 0x07, 0xC0, 0xFF, 0x80, 0xFE, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x0F,
+    0x00, 0x07, 0x80, 0x03, 0xC0, 0x7F, 0x80, 0x7F, 0xC0, 0x63, 0xE0, 0x00, 0xF0, 0x00, 0x70, 0x00,
+    0x70, 0x00, 0x70, 0x1F, 0xF8, 0x3F, 0xF8, 0x7C, 0xF8, 0xF0, 0x78, 0xE0, 0x78, 0xE0, 0x70, 0xE0,
+    0x70, 0xE0, 0x70, 0xE0, 0xE0, 0xFB, 0xE0, 0x7F, 0xC0, 0x3F, 0x80, 0x03, 0xC0, 0x00, 0x03, 0xC0,
+    0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x06, 0x70, 0x00, 0x0E, 0x70, 0x00, 0x0E, 0x38, 0x00,
+    0x1C, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x38, 0x1C, 0x00, 0x38, 0x1C, 0x00, 0x38, 0x1E, 0x00, 0x70,
+    0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0F, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFC,
+    0xFF, 0xFC, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C,
+    0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C,
+    0xE0, 0x3C, 0xE0, 0x3C, 0xE0, 0x3C, 0xFF, 0xF8, 0xFF, 0xF8, 0x70, 0x00, 0x38, 0x00, 0x3C, 0x00,
+    0x1C, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0x80, 0x07, 0x80, 0x0F, 0x00, 0x0E, 0x00,
+    0x1E, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x78, 0x00, 0x70, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF0,
+    0xFF, 0xF0, 0x00, 0x38, 0x00, 0x70, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80,
+    0x03, 0x80, 0x07, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x38, 0x00,
+    0x70, 0x00, 0x70, 0x00, 0xF0, 0xF0, 0xF0, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x1C, 0x00, 0x1C, 0x00,
+    0x18, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x30, 0x00, 0x70, 0x78, 0x70, 0xF8, 0x60, 0xFC,
+    0xE0, 0x1C, 0xE0, 0x0E, 0xE0, 0x0E, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0x80, 0x03, 0x80, 0x3C,
+    0xF8, 0x7F, 0xFC, 0x77, 0xDC, 0xE3, 0x8C, 0x77, 0xDC, 0x7F, 0xFC, 0x3E, 0xF8, 0x07, 0x80, 0x0F,
+    0x80, 0x0F, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C,
+    0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C,
+    0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0x7C, 0x30, 0xFF,
+    0x70, 0xEF, 0xF0, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x30, 0xFF, 0x70, 0xEF, 0xF0, 0xC3,
+    0xE0, 0x00, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0xFF, 0xF0, 0xFF, 0xF0, 0x07, 0x00, 0x07, 0x00, 0x0E,
+    0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x38, 0x00, 0x38, 0x00, 0x30, 0x00, 0x00, 0x70, 0x01, 0xF0, 0x0F,
+    0xE0, 0x3F, 0x80, 0xFC, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x01, 0xF0, 0x00,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0xE0, 0x00, 0xF8, 0x00, 0x7F, 0x00, 0x0F,
+    0xC0, 0x03, 0xF0, 0x00, 0xF0, 0x03, 0xF0, 0x0F, 0xC0, 0x7F, 0x00, 0xF8, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0,
 };
 
 static const EpdGlyph ubuntu_12_regularGlyphs[] = {
@@ -1087,591 +1361,591 @@ static const EpdGlyph ubuntu_12_regularGlyphs[] = {
     { 0, 0, 6, 0, 0, 0, 0 }, // 
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 5, 17, 7, 1, 17, 11, 0 }, // !
-    { 8, 6, 10, 1, 20, 6, 11 }, // "
-    { 15, 17, 17, 1, 17, 32, 17 }, // #
-    { 12, 23, 14, 1, 20, 35, 49 }, // $
-    { 20, 17, 21, 1, 17, 43, 84 }, // %
-    { 16, 17, 17, 1, 17, 34, 127 }, // &
-    { 4, 6, 6, 1, 20, 3, 161 }, // '
-    { 7, 25, 8, 1, 20, 22, 164 }, // (
-    { 7, 25, 8, 0, 20, 22, 186 }, // )
-    { 12, 10, 12, 0, 17, 15, 208 }, // *
-    { 12, 12, 14, 1, 14, 18, 223 }, // +
-    { 5, 7, 6, 0, 3, 5, 241 }, // ,
-    { 7, 2, 7, 0, 8, 2, 246 }, // -
-    { 4, 3, 6, 1, 3, 2, 248 }, // .
-    { 12, 25, 10, -1, 20, 38, 250 }, // /
-    { 12, 17, 14, 1, 17, 26, 288 }, // 0
-    { 8, 17, 14, 2, 17, 17, 314 }, // 1
-    { 12, 17, 14, 1, 17, 26, 331 }, // 2
-    { 12, 17, 14, 1, 17, 26, 357 }, // 3
-    { 13, 17, 14, 1, 17, 28, 383 }, // 4
-    { 12, 17, 14, 1, 17, 26, 411 }, // 5
-    { 12, 17, 14, 1, 17, 26, 437 }, // 6
-    { 12, 17, 14, 1, 17, 26, 463 }, // 7
-    { 12, 17, 14, 1, 17, 26, 489 }, // 8
-    { 12, 17, 14, 1, 17, 26, 515 }, // 9
-    { 4, 13, 6, 1, 13, 7, 541 }, // :
-    { 5, 17, 6, 0, 13, 11, 548 }, // ;
-    { 12, 11, 14, 1, 13, 17, 559 }, // <
-    { 12, 7, 14, 1, 11, 11, 576 }, // =
-    { 12, 11, 14, 1, 13, 17, 587 }, // >
-    { 10, 17, 10, 0, 17, 22, 604 }, // ?
-    { 22, 22, 24, 1, 18, 61, 626 }, // @
-    { 17, 17, 17, 0, 17, 37, 687 }, // A
-    { 13, 17, 16, 2, 17, 28, 724 }, // B
-    { 14, 17, 16, 1, 17, 30, 752 }, // C
-    { 15, 17, 18, 2, 17, 32, 782 }, // D
-    { 12, 17, 14, 2, 17, 26, 814 }, // E
-    { 11, 17, 13, 2, 17, 24, 840 }, // F
-    { 15, 17, 17, 1, 17, 32, 864 }, // G
-    { 14, 17, 18, 2, 17, 30, 896 }, // H
-    { 3, 17, 7, 2, 17, 7, 926 }, // I
-    { 11, 17, 13, 0, 17, 24, 933 }, // J
-    { 14, 17, 16, 2, 17, 30, 957 }, // K
-    { 11, 17, 13, 2, 17, 24, 987 }, // L
-    { 20, 17, 22, 1, 17, 43, 1011 }, // M
-    { 15, 17, 18, 2, 17, 32, 1054 }, // N
-    { 17, 17, 19, 1, 17, 37, 1086 }, // O
-    { 13, 17, 15, 2, 17, 28, 1123 }, // P
-    { 17, 22, 19, 1, 17, 47, 1151 }, // Q
-    { 14, 17, 16, 2, 17, 30, 1198 }, // R
-    { 13, 17, 13, 0, 17, 28, 1228 }, // S
-    { 14, 17, 14, 0, 17, 30, 1256 }, // T
-    { 14, 17, 17, 2, 17, 30, 1286 }, // U
-    { 17, 17, 16, 0, 17, 37, 1316 }, // V
-    { 23, 17, 23, 0, 17, 49, 1353 }, // W
-    { 16, 17, 16, 0, 17, 34, 1402 }, // X
-    { 15, 17, 15, 0, 17, 32, 1436 }, // Y
-    { 14, 17, 14, 0, 17, 30, 1468 }, // Z
-    { 7, 25, 8, 2, 20, 22, 1498 }, // [
-    { 12, 25, 10, -1, 20, 38, 1520 }, // <backslash>
-    { 6, 25, 8, 0, 20, 19, 1558 }, // ]
-    { 12, 9, 14, 1, 17, 14, 1577 }, // ^
-    { 14, 2, 12, -1, -3, 4, 1591 }, // _
-    { 6, 5, 9, 1, 20, 4, 1595 }, // `
-    { 11, 13, 13, 1, 13, 18, 1599 }, // a
-    { 12, 19, 15, 2, 19, 29, 1617 }, // b
-    { 11, 13, 12, 1, 13, 18, 1646 }, // c
-    { 12, 19, 15, 1, 19, 29, 1664 }, // d
-    { 12, 13, 14, 1, 13, 20, 1693 }, // e
-    { 8, 19, 10, 2, 19, 19, 1713 }, // f
-    { 12, 18, 14, 1, 13, 27, 1732 }, // g
-    { 11, 19, 14, 2, 19, 27, 1759 }, // h
-    { 4, 18, 6, 1, 18, 9, 1786 }, // i
-    { 7, 23, 6, -2, 18, 21, 1795 }, // j
-    { 11, 19, 13, 2, 19, 27, 1816 }, // k
-    { 6, 19, 7, 1, 19, 15, 1843 }, // l
-    { 18, 13, 22, 2, 13, 30, 1858 }, // m
-    { 11, 13, 14, 2, 13, 18, 1888 }, // n
-    { 13, 13, 15, 1, 13, 22, 1906 }, // o
-    { 12, 18, 15, 2, 13, 27, 1928 }, // p
-    { 12, 18, 15, 1, 13, 27, 1955 }, // q
-    { 8, 13, 10, 2, 13, 13, 1982 }, // r
-    { 10, 13, 11, 1, 13, 17, 1995 }, // s
-    { 9, 17, 10, 1, 17, 20, 2012 }, // t
-    { 12, 13, 14, 1, 13, 20, 2032 }, // u
-    { 13, 13, 13, 0, 13, 22, 2052 }, // v
-    { 19, 13, 19, 0, 13, 31, 2074 }, // w
-    { 13, 13, 13, 0, 13, 22, 2105 }, // x
-    { 12, 18, 12, 0, 13, 27, 2127 }, // y
-    { 11, 13, 12, 0, 13, 18, 2154 }, // z
-    { 8, 25, 8, 1, 20, 25, 2172 }, // {
-    { 3, 25, 7, 2, 20, 10, 2197 }, // |
-    { 8, 25, 8, 0, 20, 25, 2207 }, // }
-    { 12, 4, 14, 1, 10, 6, 2232 }, // ~
-    { 0, 0, 6, 0, 0, 0, 2238 }, //  
-    { 5, 18, 7, 1, 13, 12, 2238 }, // ¡
-    { 10, 19, 14, 2, 16, 24, 2250 }, // ¢
-    { 12, 17, 14, 1, 17, 26, 2274 }, // £
-    { 12, 12, 14, 1, 15, 18, 2300 }, // ¤
-    { 14, 17, 14, 0, 17, 30, 2318 }, // ¥
-    { 3, 25, 7, 2, 20, 10, 2348 }, // ¦
-    { 11, 20, 12, 1, 18, 28, 2358 }, // §
-    { 9, 3, 9, 0, 18, 4, 2386 }, // ¨
-    { 18, 17, 20, 1, 17, 39, 2390 }, // ©
-    { 9, 9, 10, 0, 17, 11, 2429 }, // ª
-    { 12, 11, 12, 0, 13, 17, 2440 }, // «
-    { 12, 9, 14, 1, 10, 14, 2457 }, // ¬
-    { 7, 2, 7, 0, 8, 2, 2471 }, // ­
-    { 18, 17, 20, 1, 17, 39, 2473 }, // ®
-    { 8, 2, 9, 1, 18, 2, 2512 }, // ¯
-    { 8, 7, 8, 0, 19, 7, 2514 }, // °
-    { 12, 15, 14, 1, 15, 23, 2521 }, // ±
-    { 8, 10, 9, 0, 18, 10, 2544 }, // ²
-    { 8, 10, 9, 0, 18, 10, 2554 }, // ³
-    { 5, 5, 9, 3, 20, 4, 2564 }, // ´
-    { 11, 18, 15, 2, 13, 25, 2568 }, // µ
-    { 13, 22, 16, 1, 17, 36, 2593 }, // ¶
-    { 4, 3, 6, 1, 9, 2, 2629 }, // ·
-    { 6, 6, 9, 1, 1, 5, 2631 }, // ¸
-    { 5, 10, 9, 1, 18, 7, 2636 }, // ¹
-    { 10, 9, 11, 1, 17, 12, 2643 }, // º
-    { 11, 11, 12, 1, 13, 16, 2655 }, // »
-    { 21, 18, 22, 1, 18, 48, 2671 }, // ¼
-    { 20, 18, 22, 1, 18, 45, 2719 }, // ½
-    { 22, 18, 22, 0, 18, 50, 2764 }, // ¾
-    { 10, 18, 10, 0, 13, 23, 2814 }, // ¿
-    { 17, 24, 17, 0, 24, 51, 2837 }, // À
-    { 17, 24, 17, 0, 24, 51, 2888 }, // Á
-    { 17, 24, 17, 0, 24, 51, 2939 }, // Â
-    { 17, 23, 17, 0, 23, 49, 2990 }, // Ã
-    { 17, 22, 17, 0, 22, 47, 3039 }, // Ä
-    { 17, 21, 17, 0, 21, 45, 3086 }, // Å
-    { 23, 17, 23, 0, 17, 49, 3131 }, // Æ
-    { 14, 23, 16, 1, 17, 41, 3180 }, // Ç
-    { 12, 24, 14, 2, 24, 36, 3221 }, // È
-    { 12, 24, 14, 2, 24, 36, 3257 }, // É
-    { 12, 24, 14, 2, 24, 36, 3293 }, // Ê
-    { 12, 22, 14, 2, 22, 33, 3329 }, // Ë
-    { 6, 24, 7, 0, 24, 18, 3362 }, // Ì
-    { 6, 24, 7, 1, 24, 18, 3380 }, // Í
-    { 8, 24, 7, -1, 24, 24, 3398 }, // Î
-    { 9, 22, 7, -1, 22, 25, 3422 }, // Ï
-    { 17, 17, 18, 0, 17, 37, 3447 }, // Ð
-    { 15, 23, 18, 2, 23, 44, 3484 }, // Ñ
-    { 17, 24, 19, 1, 24, 51, 3528 }, // Ò
-    { 17, 24, 19, 1, 24, 51, 3579 }, // Ó
-    { 17, 24, 19, 1, 24, 51, 3630 }, // Ô
-    { 17, 23, 19, 1, 23, 49, 3681 }, // Õ
-    { 17, 22, 19, 1, 22, 47, 3730 }, // Ö
-    { 11, 11, 14, 2, 13, 16, 3777 }, // ×
-    { 17, 19, 19, 1, 18, 41, 3793 }, // Ø
-    { 14, 24, 17, 2, 24, 42, 3834 }, // Ù
-    { 14, 24, 17, 2, 24, 42, 3876 }, // Ú
-    { 14, 24, 17, 2, 24, 42, 3918 }, // Û
-    { 14, 22, 17, 2, 22, 39, 3960 }, // Ü
-    { 15, 24, 15, 0, 24, 45, 3999 }, // Ý
-    { 13, 17, 15, 2, 17, 28, 4044 }, // Þ
-    { 13, 19, 16, 2, 19, 31, 4072 }, // ß
-    { 11, 20, 13, 1, 20, 28, 4103 }, // à
-    { 11, 20, 13, 1, 20, 28, 4131 }, // á
-    { 11, 20, 13, 1, 20, 28, 4159 }, // â
-    { 11, 19, 13, 1, 19, 27, 4187 }, // ã
-    { 11, 18, 13, 1, 18, 25, 4214 }, // ä
-    { 11, 20, 13, 1, 20, 28, 4239 }, // å
-    { 20, 13, 21, 1, 13, 33, 4267 }, // æ
-    { 11, 19, 12, 1, 13, 27, 4300 }, // ç
-    { 12, 20, 14, 1, 20, 30, 4327 }, // è
-    { 12, 20, 14, 1, 20, 30, 4357 }, // é
-    { 12, 20, 14, 1, 20, 30, 4387 }, // ê
-    { 12, 18, 14, 1, 18, 27, 4417 }, // ë
-    { 5, 20, 6, 0, 20, 13, 4444 }, // ì
-    { 6, 20, 6, 1, 20, 15, 4457 }, // í
-    { 8, 20, 6, -1, 20, 20, 4472 }, // î
-    { 8, 18, 6, -1, 18, 18, 4492 }, // ï
-    { 14, 19, 15, 1, 19, 34, 4510 }, // ð
-    { 11, 19, 14, 2, 19, 27, 4544 }, // ñ
-    { 13, 20, 15, 1, 20, 33, 4571 }, // ò
-    { 13, 20, 15, 1, 20, 33, 4604 }, // ó
-    { 13, 20, 15, 1, 20, 33, 4637 }, // ô
-    { 13, 19, 15, 1, 19, 31, 4670 }, // õ
-    { 13, 18, 15, 1, 18, 30, 4701 }, // ö
-    { 12, 12, 14, 1, 14, 18, 4731 }, // ÷
-    { 13, 15, 15, 1, 14, 25, 4749 }, // ø
-    { 12, 20, 14, 1, 20, 30, 4774 }, // ù
-    { 12, 20, 14, 1, 20, 30, 4804 }, // ú
-    { 12, 20, 14, 1, 20, 30, 4834 }, // û
-    { 12, 18, 14, 1, 18, 27, 4864 }, // ü
-    { 12, 25, 12, 0, 20, 38, 4891 }, // ý
-    { 12, 24, 15, 2, 19, 36, 4929 }, // þ
-    { 12, 23, 12, 0, 18, 35, 4965 }, // ÿ
-    { 17, 22, 17, 0, 22, 47, 5000 }, // Ā
-    { 11, 18, 13, 1, 18, 25, 5047 }, // ā
-    { 17, 23, 17, 0, 23, 49, 5072 }, // Ă
-    { 11, 19, 13, 1, 19, 27, 5121 }, // ă
-    { 17, 22, 17, 0, 17, 47, 5148 }, // Ą
-    { 11, 18, 13, 1, 13, 25, 5195 }, // ą
-    { 14, 24, 16, 1, 24, 42, 5220 }, // Ć
-    { 11, 20, 12, 1, 20, 28, 5262 }, // ć
-    { 14, 24, 16, 1, 24, 42, 5290 }, // Ĉ
-    { 11, 20, 12, 1, 20, 28, 5332 }, // ĉ
-    { 14, 22, 16, 1, 22, 39, 5360 }, // Ċ
-    { 11, 18, 12, 1, 18, 25, 5399 }, // ċ
-    { 14, 24, 16, 1, 24, 42, 5424 }, // Č
-    { 11, 20, 12, 1, 20, 28, 5466 }, // č
-    { 15, 24, 18, 2, 24, 45, 5494 }, // Ď
-    { 16, 19, 16, 1, 19, 38, 5539 }, // ď
-    { 17, 17, 18, 0, 17, 37, 5577 }, // Đ
-    { 14, 19, 15, 1, 19, 34, 5614 }, // đ
-    { 12, 22, 14, 2, 22, 33, 5648 }, // Ē
-    { 12, 18, 14, 1, 18, 27, 5681 }, // ē
-    { 12, 23, 14, 2, 23, 35, 5708 }, // Ĕ
-    { 12, 19, 14, 1, 19, 29, 5743 }, // ĕ
-    { 12, 22, 14, 2, 22, 33, 5772 }, // Ė
-    { 12, 18, 14, 1, 18, 27, 5805 }, // ė
-    { 12, 22, 14, 2, 17, 33, 5832 }, // Ę
-    { 12, 18, 14, 1, 13, 27, 5865 }, // ę
-    { 12, 24, 14, 2, 24, 36, 5892 }, // Ě
-    { 12, 21, 14, 1, 21, 32, 5928 }, // ě
-    { 15, 24, 17, 1, 24, 45, 5960 }, // Ĝ
-    { 12, 25, 14, 1, 20, 38, 6005 }, // ĝ
-    { 15, 23, 17, 1, 23, 44, 6043 }, // Ğ
-    { 12, 24, 14, 1, 19, 36, 6087 }, // ğ
-    { 15, 22, 17, 1, 22, 42, 6123 }, // Ġ
-    { 12, 23, 14, 1, 18, 35, 6165 }, // ġ
-    { 15, 21, 17, 1, 17, 40, 6200 }, // Ģ
-    { 12, 24, 14, 1, 19, 36, 6240 }, // ģ
-    { 14, 24, 18, 2, 24, 42, 6276 }, // Ĥ
-    { 12, 25, 14, 1, 25, 38, 6318 }, // ĥ
-    { 18, 17, 18, 0, 17, 39, 6356 }, // Ħ
-    { 13, 19, 14, 0, 19, 31, 6395 }, // ħ
-    { 9, 23, 7, -1, 23, 26, 6426 }, // Ĩ
-    { 9, 19, 6, -1, 19, 22, 6452 }, // ĩ
-    { 8, 22, 7, -1, 22, 22, 6474 }, // Ī
-    { 8, 18, 6, -1, 18, 18, 6496 }, // ī
-    { 7, 23, 7, 0, 23, 21, 6514 }, // Ĭ
-    { 8, 19, 6, -1, 19, 19, 6535 }, // ĭ
-    { 5, 22, 7, 0, 17, 14, 6554 }, // Į
-    { 5, 23, 6, 0, 18, 15, 6568 }, // į
-    { 4, 22, 7, 1, 22, 11, 6583 }, // İ
-    { 3, 13, 6, 2, 13, 5, 6594 }, // ı
-    { 16, 17, 19, 2, 17, 34, 6599 }, // Ĳ
-    { 11, 23, 13, 1, 18, 32, 6633 }, // ĳ
-    { 13, 24, 13, 0, 24, 39, 6665 }, // Ĵ
-    { 9, 25, 6, -2, 20, 29, 6704 }, // ĵ
-    { 14, 21, 16, 2, 17, 37, 6733 }, // Ķ
-    { 11, 23, 13, 2, 19, 32, 6770 }, // ķ
-    { 12, 13, 13, 2, 13, 20, 6802 }, // ĸ
-    { 11, 24, 13, 2, 24, 33, 6822 }, // Ĺ
-    { 6, 23, 7, 1, 23, 18, 6855 }, // ĺ
-    { 11, 21, 13, 2, 17, 29, 6873 }, // Ļ
-    { 7, 23, 7, 0, 19, 21, 6902 }, // ļ
-    { 11, 17, 13, 2, 17, 24, 6923 }, // Ľ
-    { 8, 19, 7, 1, 19, 19, 6947 }, // ľ
-    { 11, 17, 13, 2, 17, 24, 6966 }, // Ŀ
-    { 9, 19, 9, 1, 19, 22, 6990 }, // ŀ
-    { 15, 17, 13, -1, 17, 32, 7012 }, // Ł
-    { 8, 19, 7, 0, 19, 19, 7044 }, // ł
-    { 15, 24, 18, 2, 24, 45, 7063 }, // Ń
-    { 11, 20, 14, 2, 20, 28, 7108 }, // ń
-    { 15, 21, 18, 2, 17, 40, 7136 }, // Ņ
-    { 11, 17, 14, 2, 13, 24, 7176 }, // ņ
-    { 15, 24, 18, 2, 24, 45, 7200 }, // Ň
-    { 11, 20, 14, 2, 20, 28, 7245 }, // ň
-    { 13, 19, 14, 0, 19, 31, 7273 }, // ŉ
-    { 15, 22, 18, 2, 17, 42, 7304 }, // Ŋ
-    { 11, 18, 14, 2, 13, 25, 7346 }, // ŋ
-    { 17, 22, 19, 1, 22, 47, 7371 }, // Ō
-    { 13, 18, 15, 1, 18, 30, 7418 }, // ō
-    { 17, 23, 19, 1, 23, 49, 7448 }, // Ŏ
-    { 13, 19, 15, 1, 19, 31, 7497 }, // ŏ
-    { 17, 24, 19, 1, 24, 51, 7528 }, // Ő
-    { 13, 20, 15, 1, 20, 33, 7579 }, // ő
-    { 23, 17, 25, 1, 17, 49, 7612 }, // Œ
-    { 22, 13, 24, 1, 13, 36, 7661 }, // œ
-    { 14, 24, 16, 2, 24, 42, 7697 }, // Ŕ
-    { 8, 20, 10, 2, 20, 20, 7739 }, // ŕ
-    { 14, 21, 16, 2, 17, 37, 7759 }, // Ŗ
-    { 10, 17, 10, 0, 13, 22, 7796 }, // ŗ
-    { 14, 24, 16, 2, 24, 42, 7818 }, // Ř
-    { 8, 20, 10, 2, 20, 20, 7860 }, // ř
-    { 13, 24, 13, 0, 24, 39, 7880 }, // Ś
-    { 10, 20, 11, 1, 20, 25, 7919 }, // ś
-    { 13, 24, 13, 0, 24, 39, 7944 }, // Ŝ
-    { 10, 20, 11, 1, 20, 25, 7983 }, // ŝ
-    { 13, 22, 13, 0, 17, 36, 8008 }, // Ş
-    { 10, 18, 11, 1, 13, 23, 8044 }, // ş
-    { 13, 24, 13, 0, 24, 39, 8067 }, // Š
-    { 10, 20, 11, 1, 20, 25, 8106 }, // š
-    { 14, 23, 14, 0, 17, 41, 8131 }, // Ţ
-    { 9, 22, 10, 1, 17, 25, 8172 }, // ţ
-    { 14, 24, 14, 0, 24, 42, 8197 }, // Ť
-    { 9, 20, 10, 1, 20, 23, 8239 }, // ť
-    { 14, 17, 14, 0, 17, 30, 8262 }, // Ŧ
-    { 9, 17, 10, 1, 17, 20, 8292 }, // ŧ
-    { 14, 23, 17, 2, 23, 41, 8312 }, // Ũ
-    { 12, 19, 14, 1, 19, 29, 8353 }, // ũ
-    { 14, 22, 17, 2, 22, 39, 8382 }, // Ū
-    { 12, 18, 14, 1, 18, 27, 8421 }, // ū
-    { 14, 23, 17, 2, 23, 41, 8448 }, // Ŭ
-    { 12, 19, 14, 1, 19, 29, 8489 }, // ŭ
-    { 14, 24, 17, 2, 24, 42, 8518 }, // Ů
-    { 12, 20, 14, 1, 20, 30, 8560 }, // ů
-    { 14, 24, 17, 2, 24, 42, 8590 }, // Ű
-    { 12, 20, 14, 1, 20, 30, 8632 }, // ű
-    { 14, 22, 17, 2, 17, 39, 8662 }, // Ų
-    { 12, 18, 14, 1, 13, 27, 8701 }, // ų
-    { 23, 24, 23, 0, 24, 69, 8728 }, // Ŵ
-    { 19, 20, 19, 0, 20, 48, 8797 }, // ŵ
-    { 15, 24, 15, 0, 24, 45, 8845 }, // Ŷ
-    { 12, 25, 12, 0, 20, 38, 8890 }, // ŷ
-    { 15, 22, 15, 0, 22, 42, 8928 }, // Ÿ
-    { 14, 24, 14, 0, 24, 42, 8970 }, // Ź
-    { 11, 20, 12, 0, 20, 28, 9012 }, // ź
-    { 14, 22, 14, 0, 22, 39, 9040 }, // Ż
-    { 11, 18, 12, 0, 18, 25, 9079 }, // ż
-    { 14, 24, 14, 0, 24, 42, 9104 }, // Ž
-    { 11, 20, 12, 0, 20, 28, 9146 }, // ž
-    { 8, 19, 7, 2, 19, 19, 9174 }, // ſ
-    { 8, 4, 9, 1, 19, 4, 9193 }, // ̑
-    { 12, 24, 14, 2, 24, 36, 9197 }, // Ѐ
-    { 12, 22, 14, 2, 22, 33, 9233 }, // Ё
-    { 18, 17, 19, 0, 17, 39, 9266 }, // Ђ
-    { 11, 24, 13, 2, 24, 33, 9305 }, // Ѓ
-    { 14, 17, 16, 1, 17, 30, 9338 }, // Є
-    { 13, 17, 13, 0, 17, 28, 9368 }, // Ѕ
-    { 3, 17, 7, 2, 17, 7, 9396 }, // І
-    { 9, 22, 7, -1, 22, 25, 9403 }, // Ї
-    { 11, 17, 13, 0, 17, 24, 9428 }, // Ј
-    { 26, 18, 26, 0, 17, 59, 9452 }, // Љ
-    { 23, 17, 26, 2, 17, 49, 9511 }, // Њ
-    { 18, 17, 19, 0, 17, 39, 9560 }, // Ћ
-    { 14, 24, 16, 2, 24, 42, 9599 }, // Ќ
-    { 15, 24, 18, 2, 24, 45, 9641 }, // Ѝ
-    { 15, 23, 15, 0, 23, 44, 9686 }, // Ў
-    { 14, 22, 17, 2, 17, 39, 9730 }, // Џ
-    { 17, 17, 17, 0, 17, 37, 9769 }, // А
-    { 13, 17, 15, 2, 17, 28, 9806 }, // Б
-    { 13, 17, 16, 2, 17, 28, 9834 }, // В
-    { 11, 17, 13, 2, 17, 24, 9862 }, // Г
-    { 18, 22, 18, 0, 17, 50, 9886 }, // Д
-    { 12, 17, 14, 2, 17, 26, 9936 }, // Е
-    { 23, 17, 23, 0, 17, 49, 9962 }, // Ж
-    { 14, 17, 14, 0, 17, 30, 10011 }, // З
-    { 15, 17, 18, 2, 17, 32, 10041 }, // И
-    { 15, 23, 18, 2, 23, 44, 10073 }, // Й
-    { 14, 17, 16, 2, 17, 30, 10117 }, // К
-    { 16, 17, 18, 0, 17, 34, 10147 }, // Л
-    { 20, 17, 22, 1, 17, 43, 10181 }, // М
-    { 14, 17, 18, 2, 17, 30, 10224 }, // Н
-    { 17, 17, 19, 1, 17, 37, 10254 }, // О
-    { 14, 17, 17, 2, 17, 30, 10291 }, // П
-    { 13, 17, 15, 2, 17, 28, 10321 }, // Р
-    { 14, 17, 16, 1, 17, 30, 10349 }, // С
-    { 14, 17, 14, 0, 17, 30, 10379 }, // Т
-    { 15, 17, 15, 0, 17, 32, 10409 }, // У
-    { 20, 18, 22, 1, 18, 45, 10441 }, // Ф
-    { 16, 17, 16, 0, 17, 34, 10486 }, // Х
-    { 16, 22, 18, 2, 17, 44, 10520 }, // Ц
-    { 13, 17, 16, 1, 17, 28, 10564 }, // Ч
-    { 21, 17, 25, 2, 17, 45, 10592 }, // Ш
-    { 23, 22, 25, 2, 17, 64, 10637 }, // Щ
-    { 18, 17, 18, 0, 17, 39, 10701 }, // Ъ
-    { 18, 17, 21, 2, 17, 39, 10740 }, // Ы
-    { 13, 17, 15, 2, 17, 28, 10779 }, // Ь
-    { 15, 17, 16, 0, 17, 32, 10807 }, // Э
-    { 23, 17, 26, 2, 17, 49, 10839 }, // Ю
-    { 14, 17, 16, 0, 17, 30, 10888 }, // Я
-    { 11, 13, 13, 1, 13, 18, 10918 }, // а
-    { 13, 19, 15, 1, 19, 31, 10936 }, // б
-    { 11, 13, 14, 2, 13, 18, 10967 }, // в
-    { 9, 13, 10, 2, 13, 15, 10985 }, // г
-    { 15, 17, 15, 0, 13, 32, 11000 }, // д
-    { 12, 13, 14, 1, 13, 20, 11032 }, // е
-    { 19, 13, 19, 0, 13, 31, 11052 }, // ж
-    { 10, 13, 12, 1, 13, 17, 11083 }, // з
-    { 11, 13, 15, 2, 13, 18, 11100 }, // и
-    { 11, 19, 15, 2, 19, 27, 11118 }, // й
-    { 12, 13, 13, 2, 13, 20, 11145 }, // к
-    { 13, 13, 15, 0, 13, 22, 11165 }, // л
-    { 16, 13, 18, 1, 13, 26, 11187 }, // м
-    { 11, 13, 15, 2, 13, 18, 11213 }, // н
-    { 13, 13, 15, 1, 13, 22, 11231 }, // о
-    { 11, 13, 14, 2, 13, 18, 11253 }, // п
-    { 12, 18, 15, 2, 13, 27, 11271 }, // р
-    { 11, 13, 12, 1, 13, 18, 11298 }, // с
-    { 12, 13, 12, 0, 13, 20, 11316 }, // т
-    { 12, 18, 12, 0, 13, 27, 11336 }, // у
-    { 17, 24, 19, 1, 19, 51, 11363 }, // ф
-    { 13, 13, 13, 0, 13, 22, 11414 }, // х
-    { 13, 17, 15, 2, 13, 28, 11436 }, // ц
-    { 11, 13, 13, 1, 13, 18, 11464 }, // ч
-    { 17, 13, 21, 2, 13, 28, 11482 }, // ш
-    { 19, 17, 21, 2, 13, 41, 11510 }, // щ
-    { 15, 13, 15, 0, 13, 25, 11551 }, // ъ
-    { 15, 13, 19, 2, 13, 25, 11576 }, // ы
-    { 11, 13, 13, 2, 13, 18, 11601 }, // ь
-    { 12, 13, 12, 0, 13, 20, 11619 }, // э
-    { 17, 13, 20, 2, 13, 28, 11639 }, // ю
-    { 12, 13, 14, 0, 13, 20, 11667 }, // я
-    { 12, 20, 14, 1, 20, 30, 11687 }, // ѐ
-    { 12, 18, 14, 1, 18, 27, 11717 }, // ё
-    { 13, 24, 14, 0, 19, 39, 11744 }, // ђ
-    { 9, 20, 10, 2, 20, 23, 11783 }, // ѓ
-    { 11, 13, 12, 1, 13, 18, 11806 }, // є
-    { 10, 13, 11, 1, 13, 17, 11824 }, // ѕ
-    { 4, 18, 6, 1, 18, 9, 11841 }, // і
-    { 9, 18, 6, -1, 18, 21, 11850 }, // ї
-    { 7, 23, 6, -2, 18, 21, 11871 }, // ј
-    { 21, 13, 22, 0, 13, 35, 11892 }, // љ
-    { 19, 13, 21, 2, 13, 31, 11927 }, // њ
-    { 13, 19, 14, 0, 19, 31, 11958 }, // ћ
-    { 12, 20, 13, 2, 20, 30, 11989 }, // ќ
-    { 11, 20, 15, 2, 20, 28, 12019 }, // ѝ
-    { 12, 24, 12, 0, 19, 36, 12047 }, // ў
-    { 11, 17, 14, 2, 13, 24, 12083 }, // џ
-    { 18, 18, 18, 0, 18, 41, 12107 }, // Ѣ
-    { 15, 19, 15, 0, 19, 36, 12148 }, // ѣ
-    { 17, 17, 19, 1, 17, 37, 12184 }, // Ѳ
-    { 13, 13, 15, 1, 13, 22, 12221 }, // ѳ
-    { 20, 17, 19, 0, 17, 43, 12243 }, // Ѵ
-    { 15, 13, 14, 0, 13, 25, 12286 }, // ѵ
-    { 17, 28, 19, 2, 23, 60, 12311 }, // Ҋ
-    { 14, 24, 15, 2, 19, 42, 12371 }, // ҋ
-    { 15, 18, 16, 0, 18, 34, 12413 }, // Ҍ
-    { 13, 13, 13, 0, 13, 22, 12447 }, // ҍ
-    { 13, 17, 15, 2, 17, 28, 12469 }, // Ҏ
-    { 12, 18, 15, 2, 13, 27, 12497 }, // ҏ
-    { 11, 20, 13, 2, 20, 28, 12524 }, // Ґ
-    { 9, 16, 11, 2, 16, 18, 12552 }, // ґ
-    { 13, 17, 13, 0, 17, 28, 12570 }, // Ғ
-    { 11, 13, 11, 0, 13, 18, 12598 }, // ғ
-    { 13, 22, 16, 2, 17, 36, 12616 }, // Ҕ
-    { 11, 18, 14, 2, 13, 25, 12652 }, // ҕ
-    { 23, 22, 23, 0, 17, 64, 12677 }, // Җ
-    { 20, 17, 19, 0, 13, 43, 12741 }, // җ
-    { 14, 22, 14, 0, 17, 39, 12784 }, // Ҙ
-    { 10, 18, 12, 1, 13, 23, 12823 }, // ҙ
-    { 15, 22, 16, 2, 17, 42, 12846 }, // Қ
-    { 12, 17, 14, 2, 13, 26, 12888 }, // қ
-    { 16, 17, 18, 2, 17, 34, 12914 }, // Ҝ
-    { 14, 13, 15, 2, 13, 23, 12948 }, // ҝ
-    { 16, 17, 16, 0, 17, 34, 12971 }, // Ҟ
-    { 14, 13, 14, 0, 13, 23, 13005 }, // ҟ
-    { 19, 17, 18, 0, 17, 41, 13028 }, // Ҡ
-    { 15, 13, 15, 0, 13, 25, 13069 }, // ҡ
-    { 16, 22, 18, 2, 17, 44, 13094 }, // Ң
-    { 13, 17, 15, 2, 13, 28, 13138 }, // ң
-    { 18, 17, 20, 2, 17, 39, 13166 }, // Ҥ
-    { 14, 13, 16, 2, 13, 23, 13205 }, // ҥ
-    { 23, 22, 26, 2, 17, 64, 13228 }, // Ҧ
-    { 19, 18, 22, 2, 13, 43, 13292 }, // ҧ
-    { 18, 22, 20, 1, 17, 50, 13335 }, // Ҩ
-    { 14, 17, 15, 1, 13, 30, 13385 }, // ҩ
-    { 14, 23, 16, 1, 17, 41, 13415 }, // Ҫ
-    { 11, 19, 12, 1, 13, 27, 13456 }, // ҫ
-    { 14, 22, 14, 0, 17, 39, 13483 }, // Ҭ
-    { 12, 17, 12, 0, 13, 26, 13522 }, // ҭ
-    { 15, 17, 15, 0, 17, 32, 13548 }, // Ү
-    { 13, 18, 13, 0, 13, 30, 13580 }, // ү
-    { 15, 17, 15, 0, 17, 32, 13610 }, // Ұ
-    { 13, 18, 13, 0, 13, 30, 13642 }, // ұ
-    { 17, 22, 16, 0, 17, 47, 13672 }, // Ҳ
-    { 13, 17, 13, 0, 13, 28, 13719 }, // ҳ
-    { 21, 22, 21, 0, 17, 58, 13747 }, // Ҵ
-    { 16, 17, 17, 0, 13, 34, 13805 }, // ҵ
-    { 15, 22, 16, 1, 17, 42, 13839 }, // Ҷ
-    { 13, 17, 14, 1, 13, 28, 13881 }, // ҷ
-    { 13, 17, 16, 1, 17, 28, 13909 }, // Ҹ
-    { 12, 13, 13, 0, 13, 20, 13937 }, // ҹ
-    { 13, 17, 16, 2, 17, 28, 13957 }, // Һ
-    { 11, 19, 14, 2, 19, 27, 13985 }, // һ
-    { 20, 17, 21, 0, 17, 43, 14012 }, // Ҽ
-    { 16, 13, 17, 0, 13, 26, 14055 }, // ҽ
-    { 20, 22, 21, 0, 17, 55, 14081 }, // Ҿ
-    { 16, 17, 17, 0, 13, 34, 14136 }, // ҿ
-    { 3, 17, 7, 2, 17, 7, 14170 }, // Ӏ
-    { 23, 23, 23, 0, 23, 67, 14177 }, // Ӂ
-    { 19, 19, 19, 0, 19, 46, 14244 }, // ӂ
-    { 13, 22, 16, 2, 17, 36, 14290 }, // Ӄ
-    { 11, 18, 14, 2, 13, 25, 14326 }, // ӄ
-    { 18, 22, 18, 0, 17, 50, 14351 }, // Ӆ
-    { 16, 18, 15, 0, 13, 36, 14401 }, // ӆ
-    { 14, 22, 18, 2, 17, 39, 14437 }, // Ӈ
-    { 11, 18, 15, 2, 13, 25, 14476 }, // ӈ
-    { 16, 22, 18, 2, 17, 44, 14501 }, // Ӊ
-    { 13, 18, 15, 2, 13, 30, 14545 }, // ӊ
-    { 13, 22, 16, 1, 17, 36, 14575 }, // Ӌ
-    { 11, 17, 13, 1, 13, 24, 14611 }, // ӌ
-    { 22, 22, 22, 1, 17, 61, 14635 }, // Ӎ
-    { 18, 18, 19, 1, 13, 41, 14696 }, // ӎ
-    { 3, 17, 7, 2, 17, 7, 14737 }, // ӏ
-    { 17, 23, 17, 0, 23, 49, 14744 }, // Ӑ
-    { 11, 19, 13, 1, 19, 27, 14793 }, // ӑ
-    { 17, 22, 17, 0, 22, 47, 14820 }, // Ӓ
-    { 11, 18, 13, 1, 18, 25, 14867 }, // ӓ
-    { 23, 17, 23, 0, 17, 49, 14892 }, // Ӕ
-    { 20, 13, 21, 1, 13, 33, 14941 }, // ӕ
-    { 12, 23, 14, 2, 23, 35, 14974 }, // Ӗ
-    { 12, 19, 14, 1, 19, 29, 15009 }, // ӗ
-    { 16, 17, 18, 1, 17, 34, 15038 }, // Ә
-    { 12, 13, 14, 1, 13, 20, 15072 }, // ә
-    { 16, 22, 18, 1, 22, 44, 15092 }, // Ӛ
-    { 12, 18, 14, 1, 18, 27, 15136 }, // ӛ
-    { 23, 22, 23, 0, 22, 64, 15163 }, // Ӝ
-    { 19, 18, 19, 0, 18, 43, 15227 }, // ӝ
-    { 14, 22, 14, 0, 22, 39, 15270 }, // Ӟ
-    { 10, 18, 12, 1, 18, 23, 15309 }, // ӟ
-    { 13, 17, 14, 0, 17, 28, 15332 }, // Ӡ
-    { 12, 18, 12, -1, 13, 27, 15360 }, // ӡ
-    { 15, 22, 18, 2, 22, 42, 15387 }, // Ӣ
-    { 11, 18, 15, 2, 18, 25, 15429 }, // ӣ
-    { 15, 22, 18, 2, 22, 42, 15454 }, // Ӥ
-    { 11, 18, 15, 2, 18, 25, 15496 }, // ӥ
-    { 17, 22, 19, 1, 22, 47, 15521 }, // Ӧ
-    { 13, 18, 15, 1, 18, 30, 15568 }, // ӧ
-    { 17, 17, 19, 1, 17, 37, 15598 }, // Ө
-    { 13, 13, 15, 1, 13, 22, 15635 }, // ө
-    { 17, 22, 19, 1, 22, 47, 15657 }, // Ӫ
-    { 13, 18, 15, 1, 18, 30, 15704 }, // ӫ
-    { 15, 22, 16, 0, 22, 42, 15734 }, // Ӭ
-    { 12, 18, 12, 0, 18, 27, 15776 }, // ӭ
-    { 15, 22, 15, 0, 22, 42, 15803 }, // Ӯ
-    { 12, 23, 12, 0, 18, 35, 15845 }, // ӯ
-    { 15, 22, 15, 0, 22, 42, 15880 }, // Ӱ
-    { 12, 23, 12, 0, 18, 35, 15922 }, // ӱ
-    { 15, 24, 15, 0, 24, 45, 15957 }, // Ӳ
-    { 12, 25, 12, 0, 20, 38, 16002 }, // ӳ
-    { 13, 22, 16, 1, 22, 36, 16040 }, // Ӵ
-    { 11, 18, 13, 1, 18, 25, 16076 }, // ӵ
-    { 11, 22, 13, 2, 17, 31, 16101 }, // Ӷ
-    { 9, 17, 10, 2, 13, 20, 16132 }, // ӷ
-    { 18, 22, 21, 2, 22, 50, 16152 }, // Ӹ
-    { 15, 18, 19, 2, 18, 34, 16202 }, // ӹ
-    { 14, 2, 12, -1, 9, 4, 16236 }, // –
-    { 26, 2, 25, -1, 9, 7, 16240 }, // —
-    { 26, 2, 25, -1, 9, 7, 16247 }, // ―
-    { 5, 6, 6, 1, 19, 4, 16254 }, // ‘
-    { 5, 6, 6, 0, 19, 4, 16258 }, // ’
-    { 5, 6, 6, 0, 3, 4, 16262 }, // ‚
-    { 9, 6, 10, 1, 19, 7, 16266 }, // “
-    { 9, 6, 10, 0, 19, 7, 16273 }, // ”
-    { 9, 6, 10, 0, 3, 7, 16280 }, // „
-    { 11, 21, 12, 0, 17, 29, 16287 }, // †
-    { 11, 21, 12, 0, 17, 29, 16316 }, // ‡
-    { 7, 6, 9, 1, 12, 6, 16345 }, // •
-    { 21, 3, 25, 2, 3, 8, 16351 }, // …
-    { 29, 17, 31, 1, 17, 62, 16359 }, // ‰
-    { 7, 11, 7, 0, 13, 10, 16421 }, // ‹
-    { 6, 11, 7, 1, 13, 9, 16431 }, // ›
-    { 13, 17, 4, -5, 17, 28, 16440 }, // ⁄
-    { 9, 10, 9, 0, 18, 12, 16468 }, // ⁰
-    { 9, 10, 9, 0, 18, 12, 16480 }, // ⁴
-    { 7, 10, 9, 1, 18, 9, 16492 }, // ⁵
-    { 9, 10, 9, 0, 18, 12, 16501 }, // ⁶
-    { 9, 10, 9, 0, 18, 12, 16513 }, // ⁷
-    { 9, 10, 9, 0, 18, 12, 16525 }, // ⁸
-    { 9, 10, 9, 0, 18, 12, 16537 }, // ⁹
-    { 9, 10, 9, 0, 10, 12, 16549 }, // ₀
-    { 5, 10, 9, 1, 10, 7, 16561 }, // ₁
-    { 8, 10, 9, 0, 10, 10, 16568 }, // ₂
-    { 8, 10, 9, 0, 10, 10, 16578 }, // ₃
-    { 9, 10, 9, 0, 10, 12, 16588 }, // ₄
-    { 7, 10, 9, 1, 10, 9, 16600 }, // ₅
-    { 9, 10, 9, 0, 10, 12, 16609 }, // ₆
-    { 9, 10, 9, 0, 10, 12, 16621 }, // ₇
-    { 9, 10, 9, 0, 10, 12, 16633 }, // ₈
-    { 9, 10, 9, 0, 10, 12, 16645 }, // ₉
-    { 13, 17, 14, 1, 17, 28, 16657 }, // €
-    { 13, 17, 14, 1, 17, 28, 16685 }, // ₮
-    { 14, 17, 14, 0, 17, 30, 16713 }, // ₴
-    { 13, 17, 14, 1, 17, 28, 16743 }, // ₹
-    { 13, 19, 15, 1, 19, 31, 16771 }, // ∂
-    { 17, 17, 16, 0, 17, 37, 16802 }, // ∆
-    { 14, 20, 17, 2, 17, 35, 16839 }, // ∏
-    { 13, 20, 13, 0, 17, 33, 16874 }, // ∑
-    { 12, 2, 14, 1, 8, 3, 16907 }, // −
-    { 13, 17, 4, -5, 17, 28, 16910 }, // ∕
-    { 4, 3, 6, 1, 9, 2, 16938 }, // ∙
-    { 15, 20, 14, 0, 20, 38, 16940 }, // √
-    { 14, 7, 15, 0, 11, 13, 16978 }, // ∞
-    { 10, 24, 9, 0, 19, 30, 16991 }, // ∫
-    { 12, 10, 14, 1, 13, 15, 17021 }, // ≈
-    { 12, 13, 14, 1, 14, 20, 17036 }, // ≠
-    { 12, 15, 14, 1, 15, 23, 17056 }, // ≤
-    { 12, 15, 14, 1, 15, 23, 17079 }, // ≥
+    { 5, 17, 7, 1, 17, 17, 0 }, // !
+    { 8, 6, 10, 1, 20, 6, 17 }, // "
+    { 15, 17, 17, 1, 17, 34, 23 }, // #
+    { 12, 23, 14, 1, 20, 46, 57 }, // $
+    { 20, 17, 21, 1, 17, 51, 103 }, // %
+    { 16, 17, 17, 1, 17, 34, 154 }, // &
+    { 4, 6, 6, 1, 20, 6, 188 }, // '
+    { 7, 25, 8, 1, 20, 25, 194 }, // (
+    { 7, 25, 8, 0, 20, 25, 219 }, // )
+    { 12, 10, 12, 0, 17, 20, 244 }, // *
+    { 12, 12, 14, 1, 14, 24, 264 }, // +
+    { 5, 7, 6, 0, 3, 7, 288 }, // ,
+    { 7, 2, 7, 0, 8, 2, 295 }, // -
+    { 4, 3, 6, 1, 3, 3, 297 }, // .
+    { 12, 25, 10, -1, 20, 50, 300 }, // /
+    { 12, 17, 14, 1, 17, 34, 350 }, // 0
+    { 8, 17, 14, 2, 17, 17, 384 }, // 1
+    { 12, 17, 14, 1, 17, 34, 401 }, // 2
+    { 12, 17, 14, 1, 17, 34, 435 }, // 3
+    { 13, 17, 14, 1, 17, 34, 469 }, // 4
+    { 12, 17, 14, 1, 17, 34, 503 }, // 5
+    { 12, 17, 14, 1, 17, 34, 537 }, // 6
+    { 12, 17, 14, 1, 17, 34, 571 }, // 7
+    { 12, 17, 14, 1, 17, 34, 605 }, // 8
+    { 12, 17, 14, 1, 17, 34, 639 }, // 9
+    { 4, 13, 6, 1, 13, 13, 673 }, // :
+    { 5, 17, 6, 0, 13, 17, 686 }, // ;
+    { 12, 11, 14, 1, 13, 22, 703 }, // <
+    { 12, 7, 14, 1, 11, 14, 725 }, // =
+    { 12, 11, 14, 1, 13, 22, 739 }, // >
+    { 10, 17, 10, 0, 17, 34, 761 }, // ?
+    { 22, 22, 24, 1, 18, 66, 795 }, // @
+    { 17, 17, 17, 0, 17, 51, 861 }, // A
+    { 13, 17, 16, 2, 17, 34, 912 }, // B
+    { 14, 17, 16, 1, 17, 34, 946 }, // C
+    { 15, 17, 18, 2, 17, 34, 980 }, // D
+    { 12, 17, 14, 2, 17, 34, 1014 }, // E
+    { 11, 17, 13, 2, 17, 34, 1048 }, // F
+    { 15, 17, 17, 1, 17, 34, 1082 }, // G
+    { 14, 17, 18, 2, 17, 34, 1116 }, // H
+    { 3, 17, 7, 2, 17, 17, 1150 }, // I
+    { 11, 17, 13, 0, 17, 34, 1167 }, // J
+    { 14, 17, 16, 2, 17, 34, 1201 }, // K
+    { 11, 17, 13, 2, 17, 34, 1235 }, // L
+    { 20, 17, 22, 1, 17, 51, 1269 }, // M
+    { 15, 17, 18, 2, 17, 34, 1320 }, // N
+    { 17, 17, 19, 1, 17, 51, 1354 }, // O
+    { 13, 17, 15, 2, 17, 34, 1405 }, // P
+    { 17, 22, 19, 1, 17, 66, 1439 }, // Q
+    { 14, 17, 16, 2, 17, 34, 1505 }, // R
+    { 13, 17, 13, 0, 17, 34, 1539 }, // S
+    { 14, 17, 14, 0, 17, 34, 1573 }, // T
+    { 14, 17, 17, 2, 17, 34, 1607 }, // U
+    { 17, 17, 16, 0, 17, 51, 1641 }, // V
+    { 23, 17, 23, 0, 17, 51, 1692 }, // W
+    { 16, 17, 16, 0, 17, 34, 1743 }, // X
+    { 15, 17, 15, 0, 17, 34, 1777 }, // Y
+    { 14, 17, 14, 0, 17, 34, 1811 }, // Z
+    { 7, 25, 8, 2, 20, 25, 1845 }, // [
+    { 12, 25, 10, -1, 20, 50, 1870 }, // <backslash>
+    { 6, 25, 8, 0, 20, 25, 1920 }, // ]
+    { 12, 9, 14, 1, 17, 18, 1945 }, // ^
+    { 14, 2, 12, -1, -3, 4, 1963 }, // _
+    { 6, 5, 9, 1, 20, 5, 1967 }, // `
+    { 11, 13, 13, 1, 13, 26, 1972 }, // a
+    { 12, 19, 15, 2, 19, 38, 1998 }, // b
+    { 11, 13, 12, 1, 13, 26, 2036 }, // c
+    { 12, 19, 15, 1, 19, 38, 2062 }, // d
+    { 12, 13, 14, 1, 13, 26, 2100 }, // e
+    { 8, 19, 10, 2, 19, 19, 2126 }, // f
+    { 12, 18, 14, 1, 13, 36, 2145 }, // g
+    { 11, 19, 14, 2, 19, 38, 2181 }, // h
+    { 4, 18, 6, 1, 18, 18, 2219 }, // i
+    { 7, 23, 6, -2, 18, 23, 2237 }, // j
+    { 11, 19, 13, 2, 19, 38, 2260 }, // k
+    { 6, 19, 7, 1, 19, 19, 2298 }, // l
+    { 18, 13, 22, 2, 13, 39, 2317 }, // m
+    { 11, 13, 14, 2, 13, 26, 2356 }, // n
+    { 13, 13, 15, 1, 13, 26, 2382 }, // o
+    { 12, 18, 15, 2, 13, 36, 2408 }, // p
+    { 12, 18, 15, 1, 13, 36, 2444 }, // q
+    { 8, 13, 10, 2, 13, 13, 2480 }, // r
+    { 10, 13, 11, 1, 13, 26, 2493 }, // s
+    { 9, 17, 10, 1, 17, 34, 2519 }, // t
+    { 12, 13, 14, 1, 13, 26, 2553 }, // u
+    { 13, 13, 13, 0, 13, 26, 2579 }, // v
+    { 19, 13, 19, 0, 13, 39, 2605 }, // w
+    { 13, 13, 13, 0, 13, 26, 2644 }, // x
+    { 12, 18, 12, 0, 13, 36, 2670 }, // y
+    { 11, 13, 12, 0, 13, 26, 2706 }, // z
+    { 8, 25, 8, 1, 20, 25, 2732 }, // {
+    { 3, 25, 7, 2, 20, 25, 2757 }, // |
+    { 8, 25, 8, 0, 20, 25, 2782 }, // }
+    { 12, 4, 14, 1, 10, 8, 2807 }, // ~
+    { 0, 0, 6, 0, 0, 0, 2815 }, //  
+    { 5, 18, 7, 1, 13, 18, 2815 }, // ¡
+    { 10, 19, 14, 2, 16, 38, 2833 }, // ¢
+    { 12, 17, 14, 1, 17, 34, 2871 }, // £
+    { 12, 12, 14, 1, 15, 24, 2905 }, // ¤
+    { 14, 17, 14, 0, 17, 34, 2929 }, // ¥
+    { 3, 25, 7, 2, 20, 25, 2963 }, // ¦
+    { 11, 20, 12, 1, 18, 40, 2988 }, // §
+    { 9, 3, 9, 0, 18, 6, 3028 }, // ¨
+    { 18, 17, 20, 1, 17, 51, 3034 }, // ©
+    { 9, 9, 10, 0, 17, 18, 3085 }, // ª
+    { 12, 11, 12, 0, 13, 22, 3103 }, // «
+    { 12, 9, 14, 1, 10, 18, 3125 }, // ¬
+    { 7, 2, 7, 0, 8, 2, 3143 }, // ­
+    { 18, 17, 20, 1, 17, 51, 3145 }, // ®
+    { 8, 2, 9, 1, 18, 2, 3196 }, // ¯
+    { 8, 7, 8, 0, 19, 7, 3198 }, // °
+    { 12, 15, 14, 1, 15, 30, 3205 }, // ±
+    { 8, 10, 9, 0, 18, 10, 3235 }, // ²
+    { 8, 10, 9, 0, 18, 10, 3245 }, // ³
+    { 5, 5, 9, 3, 20, 5, 3255 }, // ´
+    { 11, 18, 15, 2, 13, 36, 3260 }, // µ
+    { 13, 22, 16, 1, 17, 44, 3296 }, // ¶
+    { 4, 3, 6, 1, 9, 3, 3340 }, // ·
+    { 6, 6, 9, 1, 1, 6, 3343 }, // ¸
+    { 5, 10, 9, 1, 18, 10, 3349 }, // ¹
+    { 10, 9, 11, 1, 17, 18, 3359 }, // º
+    { 11, 11, 12, 1, 13, 22, 3377 }, // »
+    { 21, 18, 22, 1, 18, 54, 3399 }, // ¼
+    { 20, 18, 22, 1, 18, 54, 3453 }, // ½
+    { 22, 18, 22, 0, 18, 54, 3507 }, // ¾
+    { 10, 18, 10, 0, 13, 36, 3561 }, // ¿
+    { 17, 24, 17, 0, 24, 72, 3597 }, // À
+    { 17, 24, 17, 0, 24, 72, 3669 }, // Á
+    { 17, 24, 17, 0, 24, 72, 3741 }, // Â
+    { 17, 23, 17, 0, 23, 69, 3813 }, // Ã
+    { 17, 22, 17, 0, 22, 66, 3882 }, // Ä
+    { 17, 21, 17, 0, 21, 63, 3948 }, // Å
+    { 23, 17, 23, 0, 17, 51, 4011 }, // Æ
+    { 14, 23, 16, 1, 17, 46, 4062 }, // Ç
+    { 12, 24, 14, 2, 24, 48, 4108 }, // È
+    { 12, 24, 14, 2, 24, 48, 4156 }, // É
+    { 12, 24, 14, 2, 24, 48, 4204 }, // Ê
+    { 12, 22, 14, 2, 22, 44, 4252 }, // Ë
+    { 6, 24, 7, 0, 24, 24, 4296 }, // Ì
+    { 6, 24, 7, 1, 24, 24, 4320 }, // Í
+    { 8, 24, 7, -1, 24, 24, 4344 }, // Î
+    { 9, 22, 7, -1, 22, 44, 4368 }, // Ï
+    { 17, 17, 18, 0, 17, 51, 4412 }, // Ð
+    { 15, 23, 18, 2, 23, 46, 4463 }, // Ñ
+    { 17, 24, 19, 1, 24, 72, 4509 }, // Ò
+    { 17, 24, 19, 1, 24, 72, 4581 }, // Ó
+    { 17, 24, 19, 1, 24, 72, 4653 }, // Ô
+    { 17, 23, 19, 1, 23, 69, 4725 }, // Õ
+    { 17, 22, 19, 1, 22, 66, 4794 }, // Ö
+    { 11, 11, 14, 2, 13, 22, 4860 }, // ×
+    { 17, 19, 19, 1, 18, 57, 4882 }, // Ø
+    { 14, 24, 17, 2, 24, 48, 4939 }, // Ù
+    { 14, 24, 17, 2, 24, 48, 4987 }, // Ú
+    { 14, 24, 17, 2, 24, 48, 5035 }, // Û
+    { 14, 22, 17, 2, 22, 44, 5083 }, // Ü
+    { 15, 24, 15, 0, 24, 48, 5127 }, // Ý
+    { 13, 17, 15, 2, 17, 34, 5175 }, // Þ
+    { 13, 19, 16, 2, 19, 38, 5209 }, // ß
+    { 11, 20, 13, 1, 20, 40, 5247 }, // à
+    { 11, 20, 13, 1, 20, 40, 5287 }, // á
+    { 11, 20, 13, 1, 20, 40, 5327 }, // â
+    { 11, 19, 13, 1, 19, 38, 5367 }, // ã
+    { 11, 18, 13, 1, 18, 36, 5405 }, // ä
+    { 11, 20, 13, 1, 20, 40, 5441 }, // å
+    { 20, 13, 21, 1, 13, 39, 5481 }, // æ
+    { 11, 19, 12, 1, 13, 38, 5520 }, // ç
+    { 12, 20, 14, 1, 20, 40, 5558 }, // è
+    { 12, 20, 14, 1, 20, 40, 5598 }, // é
+    { 12, 20, 14, 1, 20, 40, 5638 }, // ê
+    { 12, 18, 14, 1, 18, 36, 5678 }, // ë
+    { 5, 20, 6, 0, 20, 20, 5714 }, // ì
+    { 6, 20, 6, 1, 20, 20, 5734 }, // í
+    { 8, 20, 6, -1, 20, 20, 5754 }, // î
+    { 8, 18, 6, -1, 18, 18, 5774 }, // ï
+    { 14, 19, 15, 1, 19, 38, 5792 }, // ð
+    { 11, 19, 14, 2, 19, 38, 5830 }, // ñ
+    { 13, 20, 15, 1, 20, 40, 5868 }, // ò
+    { 13, 20, 15, 1, 20, 40, 5908 }, // ó
+    { 13, 20, 15, 1, 20, 40, 5948 }, // ô
+    { 13, 19, 15, 1, 19, 38, 5988 }, // õ
+    { 13, 18, 15, 1, 18, 36, 6026 }, // ö
+    { 12, 12, 14, 1, 14, 24, 6062 }, // ÷
+    { 13, 15, 15, 1, 14, 30, 6086 }, // ø
+    { 12, 20, 14, 1, 20, 40, 6116 }, // ù
+    { 12, 20, 14, 1, 20, 40, 6156 }, // ú
+    { 12, 20, 14, 1, 20, 40, 6196 }, // û
+    { 12, 18, 14, 1, 18, 36, 6236 }, // ü
+    { 12, 25, 12, 0, 20, 50, 6272 }, // ý
+    { 12, 24, 15, 2, 19, 48, 6322 }, // þ
+    { 12, 23, 12, 0, 18, 46, 6370 }, // ÿ
+    { 17, 22, 17, 0, 22, 66, 6416 }, // Ā
+    { 11, 18, 13, 1, 18, 36, 6482 }, // ā
+    { 17, 23, 17, 0, 23, 69, 6518 }, // Ă
+    { 11, 19, 13, 1, 19, 38, 6587 }, // ă
+    { 17, 22, 17, 0, 17, 66, 6625 }, // Ą
+    { 11, 18, 13, 1, 13, 36, 6691 }, // ą
+    { 14, 24, 16, 1, 24, 48, 6727 }, // Ć
+    { 11, 20, 12, 1, 20, 40, 6775 }, // ć
+    { 14, 24, 16, 1, 24, 48, 6815 }, // Ĉ
+    { 11, 20, 12, 1, 20, 40, 6863 }, // ĉ
+    { 14, 22, 16, 1, 22, 44, 6903 }, // Ċ
+    { 11, 18, 12, 1, 18, 36, 6947 }, // ċ
+    { 14, 24, 16, 1, 24, 48, 6983 }, // Č
+    { 11, 20, 12, 1, 20, 40, 7031 }, // č
+    { 15, 24, 18, 2, 24, 48, 7071 }, // Ď
+    { 16, 19, 16, 1, 19, 38, 7119 }, // ď
+    { 17, 17, 18, 0, 17, 51, 7157 }, // Đ
+    { 14, 19, 15, 1, 19, 38, 7208 }, // đ
+    { 12, 22, 14, 2, 22, 44, 7246 }, // Ē
+    { 12, 18, 14, 1, 18, 36, 7290 }, // ē
+    { 12, 23, 14, 2, 23, 46, 7326 }, // Ĕ
+    { 12, 19, 14, 1, 19, 38, 7372 }, // ĕ
+    { 12, 22, 14, 2, 22, 44, 7410 }, // Ė
+    { 12, 18, 14, 1, 18, 36, 7454 }, // ė
+    { 12, 22, 14, 2, 17, 44, 7490 }, // Ę
+    { 12, 18, 14, 1, 13, 36, 7534 }, // ę
+    { 12, 24, 14, 2, 24, 48, 7570 }, // Ě
+    { 12, 21, 14, 1, 21, 42, 7618 }, // ě
+    { 15, 24, 17, 1, 24, 48, 7660 }, // Ĝ
+    { 12, 25, 14, 1, 20, 50, 7708 }, // ĝ
+    { 15, 23, 17, 1, 23, 46, 7758 }, // Ğ
+    { 12, 24, 14, 1, 19, 48, 7804 }, // ğ
+    { 15, 22, 17, 1, 22, 44, 7852 }, // Ġ
+    { 12, 23, 14, 1, 18, 46, 7896 }, // ġ
+    { 15, 21, 17, 1, 17, 42, 7942 }, // Ģ
+    { 12, 24, 14, 1, 19, 48, 7984 }, // ģ
+    { 14, 24, 18, 2, 24, 48, 8032 }, // Ĥ
+    { 12, 25, 14, 1, 25, 50, 8080 }, // ĥ
+    { 18, 17, 18, 0, 17, 51, 8130 }, // Ħ
+    { 13, 19, 14, 0, 19, 38, 8181 }, // ħ
+    { 9, 23, 7, -1, 23, 46, 8219 }, // Ĩ
+    { 9, 19, 6, -1, 19, 38, 8265 }, // ĩ
+    { 8, 22, 7, -1, 22, 22, 8303 }, // Ī
+    { 8, 18, 6, -1, 18, 18, 8325 }, // ī
+    { 7, 23, 7, 0, 23, 23, 8343 }, // Ĭ
+    { 8, 19, 6, -1, 19, 19, 8366 }, // ĭ
+    { 5, 22, 7, 0, 17, 22, 8385 }, // Į
+    { 5, 23, 6, 0, 18, 23, 8407 }, // į
+    { 4, 22, 7, 1, 22, 22, 8430 }, // İ
+    { 3, 13, 6, 2, 13, 13, 8452 }, // ı
+    { 16, 17, 19, 2, 17, 34, 8465 }, // Ĳ
+    { 11, 23, 13, 1, 18, 46, 8499 }, // ĳ
+    { 13, 24, 13, 0, 24, 48, 8545 }, // Ĵ
+    { 9, 25, 6, -2, 20, 50, 8593 }, // ĵ
+    { 14, 21, 16, 2, 17, 42, 8643 }, // Ķ
+    { 11, 23, 13, 2, 19, 46, 8685 }, // ķ
+    { 12, 13, 13, 2, 13, 26, 8731 }, // ĸ
+    { 11, 24, 13, 2, 24, 48, 8757 }, // Ĺ
+    { 6, 23, 7, 1, 23, 23, 8805 }, // ĺ
+    { 11, 21, 13, 2, 17, 42, 8828 }, // Ļ
+    { 7, 23, 7, 0, 19, 23, 8870 }, // ļ
+    { 11, 17, 13, 2, 17, 34, 8893 }, // Ľ
+    { 8, 19, 7, 1, 19, 19, 8927 }, // ľ
+    { 11, 17, 13, 2, 17, 34, 8946 }, // Ŀ
+    { 9, 19, 9, 1, 19, 38, 8980 }, // ŀ
+    { 15, 17, 13, -1, 17, 34, 9018 }, // Ł
+    { 8, 19, 7, 0, 19, 19, 9052 }, // ł
+    { 15, 24, 18, 2, 24, 48, 9071 }, // Ń
+    { 11, 20, 14, 2, 20, 40, 9119 }, // ń
+    { 15, 21, 18, 2, 17, 42, 9159 }, // Ņ
+    { 11, 17, 14, 2, 13, 34, 9201 }, // ņ
+    { 15, 24, 18, 2, 24, 48, 9235 }, // Ň
+    { 11, 20, 14, 2, 20, 40, 9283 }, // ň
+    { 13, 19, 14, 0, 19, 38, 9323 }, // ŉ
+    { 15, 22, 18, 2, 17, 44, 9361 }, // Ŋ
+    { 11, 18, 14, 2, 13, 36, 9405 }, // ŋ
+    { 17, 22, 19, 1, 22, 66, 9441 }, // Ō
+    { 13, 18, 15, 1, 18, 36, 9507 }, // ō
+    { 17, 23, 19, 1, 23, 69, 9543 }, // Ŏ
+    { 13, 19, 15, 1, 19, 38, 9612 }, // ŏ
+    { 17, 24, 19, 1, 24, 72, 9650 }, // Ő
+    { 13, 20, 15, 1, 20, 40, 9722 }, // ő
+    { 23, 17, 25, 1, 17, 51, 9762 }, // Œ
+    { 22, 13, 24, 1, 13, 39, 9813 }, // œ
+    { 14, 24, 16, 2, 24, 48, 9852 }, // Ŕ
+    { 8, 20, 10, 2, 20, 20, 9900 }, // ŕ
+    { 14, 21, 16, 2, 17, 42, 9920 }, // Ŗ
+    { 10, 17, 10, 0, 13, 34, 9962 }, // ŗ
+    { 14, 24, 16, 2, 24, 48, 9996 }, // Ř
+    { 8, 20, 10, 2, 20, 20, 10044 }, // ř
+    { 13, 24, 13, 0, 24, 48, 10064 }, // Ś
+    { 10, 20, 11, 1, 20, 40, 10112 }, // ś
+    { 13, 24, 13, 0, 24, 48, 10152 }, // Ŝ
+    { 10, 20, 11, 1, 20, 40, 10200 }, // ŝ
+    { 13, 22, 13, 0, 17, 44, 10240 }, // Ş
+    { 10, 18, 11, 1, 13, 36, 10284 }, // ş
+    { 13, 24, 13, 0, 24, 48, 10320 }, // Š
+    { 10, 20, 11, 1, 20, 40, 10368 }, // š
+    { 14, 23, 14, 0, 17, 46, 10408 }, // Ţ
+    { 9, 22, 10, 1, 17, 44, 10454 }, // ţ
+    { 14, 24, 14, 0, 24, 48, 10498 }, // Ť
+    { 9, 20, 10, 1, 20, 40, 10546 }, // ť
+    { 14, 17, 14, 0, 17, 34, 10586 }, // Ŧ
+    { 9, 17, 10, 1, 17, 34, 10620 }, // ŧ
+    { 14, 23, 17, 2, 23, 46, 10654 }, // Ũ
+    { 12, 19, 14, 1, 19, 38, 10700 }, // ũ
+    { 14, 22, 17, 2, 22, 44, 10738 }, // Ū
+    { 12, 18, 14, 1, 18, 36, 10782 }, // ū
+    { 14, 23, 17, 2, 23, 46, 10818 }, // Ŭ
+    { 12, 19, 14, 1, 19, 38, 10864 }, // ŭ
+    { 14, 24, 17, 2, 24, 48, 10902 }, // Ů
+    { 12, 20, 14, 1, 20, 40, 10950 }, // ů
+    { 14, 24, 17, 2, 24, 48, 10990 }, // Ű
+    { 12, 20, 14, 1, 20, 40, 11038 }, // ű
+    { 14, 22, 17, 2, 17, 44, 11078 }, // Ų
+    { 12, 18, 14, 1, 13, 36, 11122 }, // ų
+    { 23, 24, 23, 0, 24, 72, 11158 }, // Ŵ
+    { 19, 20, 19, 0, 20, 60, 11230 }, // ŵ
+    { 15, 24, 15, 0, 24, 48, 11290 }, // Ŷ
+    { 12, 25, 12, 0, 20, 50, 11338 }, // ŷ
+    { 15, 22, 15, 0, 22, 44, 11388 }, // Ÿ
+    { 14, 24, 14, 0, 24, 48, 11432 }, // Ź
+    { 11, 20, 12, 0, 20, 40, 11480 }, // ź
+    { 14, 22, 14, 0, 22, 44, 11520 }, // Ż
+    { 11, 18, 12, 0, 18, 36, 11564 }, // ż
+    { 14, 24, 14, 0, 24, 48, 11600 }, // Ž
+    { 11, 20, 12, 0, 20, 40, 11648 }, // ž
+    { 8, 19, 7, 2, 19, 19, 11688 }, // ſ
+    { 8, 4, 9, 1, 19, 4, 11707 }, // ̑
+    { 12, 24, 14, 2, 24, 48, 11711 }, // Ѐ
+    { 12, 22, 14, 2, 22, 44, 11759 }, // Ё
+    { 18, 17, 19, 0, 17, 51, 11803 }, // Ђ
+    { 11, 24, 13, 2, 24, 48, 11854 }, // Ѓ
+    { 14, 17, 16, 1, 17, 34, 11902 }, // Є
+    { 13, 17, 13, 0, 17, 34, 11936 }, // Ѕ
+    { 3, 17, 7, 2, 17, 17, 11970 }, // І
+    { 9, 22, 7, -1, 22, 44, 11987 }, // Ї
+    { 11, 17, 13, 0, 17, 34, 12031 }, // Ј
+    { 26, 18, 26, 0, 17, 72, 12065 }, // Љ
+    { 23, 17, 26, 2, 17, 51, 12137 }, // Њ
+    { 18, 17, 19, 0, 17, 51, 12188 }, // Ћ
+    { 14, 24, 16, 2, 24, 48, 12239 }, // Ќ
+    { 15, 24, 18, 2, 24, 48, 12287 }, // Ѝ
+    { 15, 23, 15, 0, 23, 46, 12335 }, // Ў
+    { 14, 22, 17, 2, 17, 44, 12381 }, // Џ
+    { 17, 17, 17, 0, 17, 51, 12425 }, // А
+    { 13, 17, 15, 2, 17, 34, 12476 }, // Б
+    { 13, 17, 16, 2, 17, 34, 12510 }, // В
+    { 11, 17, 13, 2, 17, 34, 12544 }, // Г
+    { 18, 22, 18, 0, 17, 66, 12578 }, // Д
+    { 12, 17, 14, 2, 17, 34, 12644 }, // Е
+    { 23, 17, 23, 0, 17, 51, 12678 }, // Ж
+    { 14, 17, 14, 0, 17, 34, 12729 }, // З
+    { 15, 17, 18, 2, 17, 34, 12763 }, // И
+    { 15, 23, 18, 2, 23, 46, 12797 }, // Й
+    { 14, 17, 16, 2, 17, 34, 12843 }, // К
+    { 16, 17, 18, 0, 17, 34, 12877 }, // Л
+    { 20, 17, 22, 1, 17, 51, 12911 }, // М
+    { 14, 17, 18, 2, 17, 34, 12962 }, // Н
+    { 17, 17, 19, 1, 17, 51, 12996 }, // О
+    { 14, 17, 17, 2, 17, 34, 13047 }, // П
+    { 13, 17, 15, 2, 17, 34, 13081 }, // Р
+    { 14, 17, 16, 1, 17, 34, 13115 }, // С
+    { 14, 17, 14, 0, 17, 34, 13149 }, // Т
+    { 15, 17, 15, 0, 17, 34, 13183 }, // У
+    { 20, 18, 22, 1, 18, 54, 13217 }, // Ф
+    { 16, 17, 16, 0, 17, 34, 13271 }, // Х
+    { 16, 22, 18, 2, 17, 44, 13305 }, // Ц
+    { 13, 17, 16, 1, 17, 34, 13349 }, // Ч
+    { 21, 17, 25, 2, 17, 51, 13383 }, // Ш
+    { 23, 22, 25, 2, 17, 66, 13434 }, // Щ
+    { 18, 17, 18, 0, 17, 51, 13500 }, // Ъ
+    { 18, 17, 21, 2, 17, 51, 13551 }, // Ы
+    { 13, 17, 15, 2, 17, 34, 13602 }, // Ь
+    { 15, 17, 16, 0, 17, 34, 13636 }, // Э
+    { 23, 17, 26, 2, 17, 51, 13670 }, // Ю
+    { 14, 17, 16, 0, 17, 34, 13721 }, // Я
+    { 11, 13, 13, 1, 13, 26, 13755 }, // а
+    { 13, 19, 15, 1, 19, 38, 13781 }, // б
+    { 11, 13, 14, 2, 13, 26, 13819 }, // в
+    { 9, 13, 10, 2, 13, 26, 13845 }, // г
+    { 15, 17, 15, 0, 13, 34, 13871 }, // д
+    { 12, 13, 14, 1, 13, 26, 13905 }, // е
+    { 19, 13, 19, 0, 13, 39, 13931 }, // ж
+    { 10, 13, 12, 1, 13, 26, 13970 }, // з
+    { 11, 13, 15, 2, 13, 26, 13996 }, // и
+    { 11, 19, 15, 2, 19, 38, 14022 }, // й
+    { 12, 13, 13, 2, 13, 26, 14060 }, // к
+    { 13, 13, 15, 0, 13, 26, 14086 }, // л
+    { 16, 13, 18, 1, 13, 26, 14112 }, // м
+    { 11, 13, 15, 2, 13, 26, 14138 }, // н
+    { 13, 13, 15, 1, 13, 26, 14164 }, // о
+    { 11, 13, 14, 2, 13, 26, 14190 }, // п
+    { 12, 18, 15, 2, 13, 36, 14216 }, // р
+    { 11, 13, 12, 1, 13, 26, 14252 }, // с
+    { 12, 13, 12, 0, 13, 26, 14278 }, // т
+    { 12, 18, 12, 0, 13, 36, 14304 }, // у
+    { 17, 24, 19, 1, 19, 72, 14340 }, // ф
+    { 13, 13, 13, 0, 13, 26, 14412 }, // х
+    { 13, 17, 15, 2, 13, 34, 14438 }, // ц
+    { 11, 13, 13, 1, 13, 26, 14472 }, // ч
+    { 17, 13, 21, 2, 13, 39, 14498 }, // ш
+    { 19, 17, 21, 2, 13, 51, 14537 }, // щ
+    { 15, 13, 15, 0, 13, 26, 14588 }, // ъ
+    { 15, 13, 19, 2, 13, 26, 14614 }, // ы
+    { 11, 13, 13, 2, 13, 26, 14640 }, // ь
+    { 12, 13, 12, 0, 13, 26, 14666 }, // э
+    { 17, 13, 20, 2, 13, 39, 14692 }, // ю
+    { 12, 13, 14, 0, 13, 26, 14731 }, // я
+    { 12, 20, 14, 1, 20, 40, 14757 }, // ѐ
+    { 12, 18, 14, 1, 18, 36, 14797 }, // ё
+    { 13, 24, 14, 0, 19, 48, 14833 }, // ђ
+    { 9, 20, 10, 2, 20, 40, 14881 }, // ѓ
+    { 11, 13, 12, 1, 13, 26, 14921 }, // є
+    { 10, 13, 11, 1, 13, 26, 14947 }, // ѕ
+    { 4, 18, 6, 1, 18, 18, 14973 }, // і
+    { 9, 18, 6, -1, 18, 36, 14991 }, // ї
+    { 7, 23, 6, -2, 18, 23, 15027 }, // ј
+    { 21, 13, 22, 0, 13, 39, 15050 }, // љ
+    { 19, 13, 21, 2, 13, 39, 15089 }, // њ
+    { 13, 19, 14, 0, 19, 38, 15128 }, // ћ
+    { 12, 20, 13, 2, 20, 40, 15166 }, // ќ
+    { 11, 20, 15, 2, 20, 40, 15206 }, // ѝ
+    { 12, 24, 12, 0, 19, 48, 15246 }, // ў
+    { 11, 17, 14, 2, 13, 34, 15294 }, // џ
+    { 18, 18, 18, 0, 18, 54, 15328 }, // Ѣ
+    { 15, 19, 15, 0, 19, 38, 15382 }, // ѣ
+    { 17, 17, 19, 1, 17, 51, 15420 }, // Ѳ
+    { 13, 13, 15, 1, 13, 26, 15471 }, // ѳ
+    { 20, 17, 19, 0, 17, 51, 15497 }, // Ѵ
+    { 15, 13, 14, 0, 13, 26, 15548 }, // ѵ
+    { 17, 28, 19, 2, 23, 84, 15574 }, // Ҋ
+    { 14, 24, 15, 2, 19, 48, 15658 }, // ҋ
+    { 15, 18, 16, 0, 18, 36, 15706 }, // Ҍ
+    { 13, 13, 13, 0, 13, 26, 15742 }, // ҍ
+    { 13, 17, 15, 2, 17, 34, 15768 }, // Ҏ
+    { 12, 18, 15, 2, 13, 36, 15802 }, // ҏ
+    { 11, 20, 13, 2, 20, 40, 15838 }, // Ґ
+    { 9, 16, 11, 2, 16, 32, 15878 }, // ґ
+    { 13, 17, 13, 0, 17, 34, 15910 }, // Ғ
+    { 11, 13, 11, 0, 13, 26, 15944 }, // ғ
+    { 13, 22, 16, 2, 17, 44, 15970 }, // Ҕ
+    { 11, 18, 14, 2, 13, 36, 16014 }, // ҕ
+    { 23, 22, 23, 0, 17, 66, 16050 }, // Җ
+    { 20, 17, 19, 0, 13, 51, 16116 }, // җ
+    { 14, 22, 14, 0, 17, 44, 16167 }, // Ҙ
+    { 10, 18, 12, 1, 13, 36, 16211 }, // ҙ
+    { 15, 22, 16, 2, 17, 44, 16247 }, // Қ
+    { 12, 17, 14, 2, 13, 34, 16291 }, // қ
+    { 16, 17, 18, 2, 17, 34, 16325 }, // Ҝ
+    { 14, 13, 15, 2, 13, 26, 16359 }, // ҝ
+    { 16, 17, 16, 0, 17, 34, 16385 }, // Ҟ
+    { 14, 13, 14, 0, 13, 26, 16419 }, // ҟ
+    { 19, 17, 18, 0, 17, 51, 16445 }, // Ҡ
+    { 15, 13, 15, 0, 13, 26, 16496 }, // ҡ
+    { 16, 22, 18, 2, 17, 44, 16522 }, // Ң
+    { 13, 17, 15, 2, 13, 34, 16566 }, // ң
+    { 18, 17, 20, 2, 17, 51, 16600 }, // Ҥ
+    { 14, 13, 16, 2, 13, 26, 16651 }, // ҥ
+    { 23, 22, 26, 2, 17, 66, 16677 }, // Ҧ
+    { 19, 18, 22, 2, 13, 54, 16743 }, // ҧ
+    { 18, 22, 20, 1, 17, 66, 16797 }, // Ҩ
+    { 14, 17, 15, 1, 13, 34, 16863 }, // ҩ
+    { 14, 23, 16, 1, 17, 46, 16897 }, // Ҫ
+    { 11, 19, 12, 1, 13, 38, 16943 }, // ҫ
+    { 14, 22, 14, 0, 17, 44, 16981 }, // Ҭ
+    { 12, 17, 12, 0, 13, 34, 17025 }, // ҭ
+    { 15, 17, 15, 0, 17, 34, 17059 }, // Ү
+    { 13, 18, 13, 0, 13, 36, 17093 }, // ү
+    { 15, 17, 15, 0, 17, 34, 17129 }, // Ұ
+    { 13, 18, 13, 0, 13, 36, 17163 }, // ұ
+    { 17, 22, 16, 0, 17, 66, 17199 }, // Ҳ
+    { 13, 17, 13, 0, 13, 34, 17265 }, // ҳ
+    { 21, 22, 21, 0, 17, 66, 17299 }, // Ҵ
+    { 16, 17, 17, 0, 13, 34, 17365 }, // ҵ
+    { 15, 22, 16, 1, 17, 44, 17399 }, // Ҷ
+    { 13, 17, 14, 1, 13, 34, 17443 }, // ҷ
+    { 13, 17, 16, 1, 17, 34, 17477 }, // Ҹ
+    { 12, 13, 13, 0, 13, 26, 17511 }, // ҹ
+    { 13, 17, 16, 2, 17, 34, 17537 }, // Һ
+    { 11, 19, 14, 2, 19, 38, 17571 }, // һ
+    { 20, 17, 21, 0, 17, 51, 17609 }, // Ҽ
+    { 16, 13, 17, 0, 13, 26, 17660 }, // ҽ
+    { 20, 22, 21, 0, 17, 66, 17686 }, // Ҿ
+    { 16, 17, 17, 0, 13, 34, 17752 }, // ҿ
+    { 3, 17, 7, 2, 17, 17, 17786 }, // Ӏ
+    { 23, 23, 23, 0, 23, 69, 17803 }, // Ӂ
+    { 19, 19, 19, 0, 19, 57, 17872 }, // ӂ
+    { 13, 22, 16, 2, 17, 44, 17929 }, // Ӄ
+    { 11, 18, 14, 2, 13, 36, 17973 }, // ӄ
+    { 18, 22, 18, 0, 17, 66, 18009 }, // Ӆ
+    { 16, 18, 15, 0, 13, 36, 18075 }, // ӆ
+    { 14, 22, 18, 2, 17, 44, 18111 }, // Ӈ
+    { 11, 18, 15, 2, 13, 36, 18155 }, // ӈ
+    { 16, 22, 18, 2, 17, 44, 18191 }, // Ӊ
+    { 13, 18, 15, 2, 13, 36, 18235 }, // ӊ
+    { 13, 22, 16, 1, 17, 44, 18271 }, // Ӌ
+    { 11, 17, 13, 1, 13, 34, 18315 }, // ӌ
+    { 22, 22, 22, 1, 17, 66, 18349 }, // Ӎ
+    { 18, 18, 19, 1, 13, 54, 18415 }, // ӎ
+    { 3, 17, 7, 2, 17, 17, 18469 }, // ӏ
+    { 17, 23, 17, 0, 23, 69, 18486 }, // Ӑ
+    { 11, 19, 13, 1, 19, 38, 18555 }, // ӑ
+    { 17, 22, 17, 0, 22, 66, 18593 }, // Ӓ
+    { 11, 18, 13, 1, 18, 36, 18659 }, // ӓ
+    { 23, 17, 23, 0, 17, 51, 18695 }, // Ӕ
+    { 20, 13, 21, 1, 13, 39, 18746 }, // ӕ
+    { 12, 23, 14, 2, 23, 46, 18785 }, // Ӗ
+    { 12, 19, 14, 1, 19, 38, 18831 }, // ӗ
+    { 16, 17, 18, 1, 17, 34, 18869 }, // Ә
+    { 12, 13, 14, 1, 13, 26, 18903 }, // ә
+    { 16, 22, 18, 1, 22, 44, 18929 }, // Ӛ
+    { 12, 18, 14, 1, 18, 36, 18973 }, // ӛ
+    { 23, 22, 23, 0, 22, 66, 19009 }, // Ӝ
+    { 19, 18, 19, 0, 18, 54, 19075 }, // ӝ
+    { 14, 22, 14, 0, 22, 44, 19129 }, // Ӟ
+    { 10, 18, 12, 1, 18, 36, 19173 }, // ӟ
+    { 13, 17, 14, 0, 17, 34, 19209 }, // Ӡ
+    { 12, 18, 12, -1, 13, 36, 19243 }, // ӡ
+    { 15, 22, 18, 2, 22, 44, 19279 }, // Ӣ
+    { 11, 18, 15, 2, 18, 36, 19323 }, // ӣ
+    { 15, 22, 18, 2, 22, 44, 19359 }, // Ӥ
+    { 11, 18, 15, 2, 18, 36, 19403 }, // ӥ
+    { 17, 22, 19, 1, 22, 66, 19439 }, // Ӧ
+    { 13, 18, 15, 1, 18, 36, 19505 }, // ӧ
+    { 17, 17, 19, 1, 17, 51, 19541 }, // Ө
+    { 13, 13, 15, 1, 13, 26, 19592 }, // ө
+    { 17, 22, 19, 1, 22, 66, 19618 }, // Ӫ
+    { 13, 18, 15, 1, 18, 36, 19684 }, // ӫ
+    { 15, 22, 16, 0, 22, 44, 19720 }, // Ӭ
+    { 12, 18, 12, 0, 18, 36, 19764 }, // ӭ
+    { 15, 22, 15, 0, 22, 44, 19800 }, // Ӯ
+    { 12, 23, 12, 0, 18, 46, 19844 }, // ӯ
+    { 15, 22, 15, 0, 22, 44, 19890 }, // Ӱ
+    { 12, 23, 12, 0, 18, 46, 19934 }, // ӱ
+    { 15, 24, 15, 0, 24, 48, 19980 }, // Ӳ
+    { 12, 25, 12, 0, 20, 50, 20028 }, // ӳ
+    { 13, 22, 16, 1, 22, 44, 20078 }, // Ӵ
+    { 11, 18, 13, 1, 18, 36, 20122 }, // ӵ
+    { 11, 22, 13, 2, 17, 44, 20158 }, // Ӷ
+    { 9, 17, 10, 2, 13, 34, 20202 }, // ӷ
+    { 18, 22, 21, 2, 22, 66, 20236 }, // Ӹ
+    { 15, 18, 19, 2, 18, 36, 20302 }, // ӹ
+    { 14, 2, 12, -1, 9, 4, 20338 }, // –
+    { 26, 2, 25, -1, 9, 8, 20342 }, // —
+    { 26, 2, 25, -1, 9, 8, 20350 }, // ―
+    { 5, 6, 6, 1, 19, 6, 20358 }, // ‘
+    { 5, 6, 6, 0, 19, 6, 20364 }, // ’
+    { 5, 6, 6, 0, 3, 6, 20370 }, // ‚
+    { 9, 6, 10, 1, 19, 12, 20376 }, // “
+    { 9, 6, 10, 0, 19, 12, 20388 }, // ”
+    { 9, 6, 10, 0, 3, 12, 20400 }, // „
+    { 11, 21, 12, 0, 17, 42, 20412 }, // †
+    { 11, 21, 12, 0, 17, 42, 20454 }, // ‡
+    { 7, 6, 9, 1, 12, 6, 20496 }, // •
+    { 21, 3, 25, 2, 3, 9, 20502 }, // …
+    { 29, 17, 31, 1, 17, 68, 20511 }, // ‰
+    { 7, 11, 7, 0, 13, 11, 20579 }, // ‹
+    { 6, 11, 7, 1, 13, 11, 20590 }, // ›
+    { 13, 17, 4, -5, 17, 34, 20601 }, // ⁄
+    { 9, 10, 9, 0, 18, 20, 20635 }, // ⁰
+    { 9, 10, 9, 0, 18, 20, 20655 }, // ⁴
+    { 7, 10, 9, 1, 18, 10, 20675 }, // ⁵
+    { 9, 10, 9, 0, 18, 20, 20685 }, // ⁶
+    { 9, 10, 9, 0, 18, 20, 20705 }, // ⁷
+    { 9, 10, 9, 0, 18, 20, 20725 }, // ⁸
+    { 9, 10, 9, 0, 18, 20, 20745 }, // ⁹
+    { 9, 10, 9, 0, 10, 20, 20765 }, // ₀
+    { 5, 10, 9, 1, 10, 10, 20785 }, // ₁
+    { 8, 10, 9, 0, 10, 10, 20795 }, // ₂
+    { 8, 10, 9, 0, 10, 10, 20805 }, // ₃
+    { 9, 10, 9, 0, 10, 20, 20815 }, // ₄
+    { 7, 10, 9, 1, 10, 10, 20835 }, // ₅
+    { 9, 10, 9, 0, 10, 20, 20845 }, // ₆
+    { 9, 10, 9, 0, 10, 20, 20865 }, // ₇
+    { 9, 10, 9, 0, 10, 20, 20885 }, // ₈
+    { 9, 10, 9, 0, 10, 20, 20905 }, // ₉
+    { 13, 17, 14, 1, 17, 34, 20925 }, // €
+    { 13, 17, 14, 1, 17, 34, 20959 }, // ₮
+    { 14, 17, 14, 0, 17, 34, 20993 }, // ₴
+    { 13, 17, 14, 1, 17, 34, 21027 }, // ₹
+    { 13, 19, 15, 1, 19, 38, 21061 }, // ∂
+    { 17, 17, 16, 0, 17, 51, 21099 }, // ∆
+    { 14, 20, 17, 2, 17, 40, 21150 }, // ∏
+    { 13, 20, 13, 0, 17, 40, 21190 }, // ∑
+    { 12, 2, 14, 1, 8, 4, 21230 }, // −
+    { 13, 17, 4, -5, 17, 34, 21234 }, // ∕
+    { 4, 3, 6, 1, 9, 3, 21268 }, // ∙
+    { 15, 20, 14, 0, 20, 40, 21271 }, // √
+    { 14, 7, 15, 0, 11, 14, 21311 }, // ∞
+    { 10, 24, 9, 0, 19, 48, 21325 }, // ∫
+    { 12, 10, 14, 1, 13, 20, 21373 }, // ≈
+    { 12, 13, 14, 1, 14, 26, 21393 }, // ≠
+    { 12, 15, 14, 1, 15, 30, 21419 }, // ≤
+    { 12, 15, 14, 1, 15, 30, 21449 }, // ≥
 };
 
 static const EpdUnicodeInterval ubuntu_12_regularIntervals[] = {
@@ -1715,6 +1989,19 @@ static const EpdUnicodeInterval ubuntu_12_regularIntervals[] = {
     { 0x2264, 0x2265, 0x24D },
 };
 
+static const EpdFontMetrics ubuntu_12_regularMetrics = {
+    12, 31, 6,
+    -5, 30, 25, -6,
+    {
+        6, 7, 10, 17, 14, 21, 17, 6, 8, 8, 12, 14, 6, 7, 6, 10,
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 6, 6, 14, 14, 14, 10,
+        24, 17, 16, 16, 18, 14, 13, 17, 18, 7, 13, 16, 13, 22, 18, 19,
+        15, 19, 16, 13, 14, 17, 16, 23, 16, 15, 14, 8, 10, 8, 14, 12,
+        9, 13, 15, 12, 15, 14, 10, 14, 14, 6, 6, 13, 7, 22, 14, 15,
+        15, 15, 10, 11, 10, 14, 13, 19, 13, 12, 12, 8, 7, 8, 14,
+    },
+};
+
 static const EpdFontData ubuntu_12_regular = {
     ubuntu_12_regularBitmaps,
     ubuntu_12_regularGlyphs,
@@ -1724,4 +2011,9 @@ static const EpdFontData ubuntu_12_regular = {
     24,
     -5,
     false,
+    nullptr,
+    &ubuntu_12_regularMetrics,
+    nullptr,
+    0,
+    true,
 };
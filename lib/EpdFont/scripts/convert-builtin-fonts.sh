@@ -4,6 +4,15 @@ set -e
 
 cd "$(dirname "$0")"
 
+# Set FONT_MANIFEST (e.g. font-manifest.txt) to export only the listed code points
+MANIFEST_ARGS=()
+if [ -n "$FONT_MANIFEST" ]; then
+  MANIFEST_ARGS=(--manifest "$FONT_MANIFEST")
+fi
+
+# Body fonts kern the text MicroSlate displays; pairs of other scripts would multiply the table size
+KERN_ARGS=(--kern-manifest font-manifest.txt)
+
 READER_FONT_STYLES=("Regular" "Italic" "Bold" "BoldItalic")
 BOOKERLY_FONT_SIZES=(12 14 16 18)
 NOTOSANS_FONT_SIZES=(12 14 16 18)
@@ -14,7 +23,7 @@ for size in ${BOOKERLY_FONT_SIZES[@]}; do
     font_name="bookerly_${size}_$(echo $style | tr '[:upper:]' '[:lower:]')"
     font_path="../builtinFonts/source/Bookerly/Bookerly-${style}.ttf"
     output_path="../builtinFonts/${font_name}.h"
-    python fontconvert.py $font_name $size $font_path --2bit > $output_path
+    python fontconvert.py $font_name $size $font_path --2bit "${KERN_ARGS[@]}" "${MANIFEST_ARGS[@]}" > $output_path
     echo "Generated $output_path"
   done
 done
@@ -24,7 +33,7 @@ for size in ${NOTOSANS_FONT_SIZES[@]}; do
     font_name="notosans_${size}_$(echo $style | tr '[:upper:]' '[:lower:]')"
     font_path="../builtinFonts/source/NotoSans/NotoSans-${style}.ttf"
     output_path="../builtinFonts/${font_name}.h"
-    python fontconvert.py $font_name $size $font_path --2bit > $output_path
+    python fontconvert.py $font_name $size $font_path --2bit "${KERN_ARGS[@]}" "${MANIFEST_ARGS[@]}" > $output_path
     echo "Generated $output_path"
   done
 done
@@ -34,7 +43,7 @@ for size in ${OPENDYSLEXIC_FONT_SIZES[@]}; do
     font_name="opendyslexic_${size}_$(echo $style | tr '[:upper:]' '[:lower:]')"
     font_path="../builtinFonts/source/OpenDyslexic/OpenDyslexic-${style}.otf"
     output_path="../builtinFonts/${font_name}.h"
-    python fontconvert.py $font_name $size $font_path --2bit > $output_path
+    python fontconvert.py $font_name $size $font_path --2bit "${KERN_ARGS[@]}" "${MANIFEST_ARGS[@]}" > $output_path
     echo "Generated $output_path"
   done
 done
@@ -47,9 +56,9 @@ for size in ${UI_FONT_SIZES[@]}; do
     font_name="ubuntu_${size}_$(echo $style | tr '[:upper:]' '[:lower:]')"
     font_path="../builtinFonts/source/Ubuntu/Ubuntu-${style}.ttf"
     output_path="../builtinFonts/${font_name}.h"
-    python fontconvert.py $font_name $size $font_path > $output_path
+    python fontconvert.py $font_name $size $font_path --row-aligned --no-kerning "${MANIFEST_ARGS[@]}" > $output_path
     echo "Generated $output_path"
   done
 done
 
-python fontconvert.py notosans_8_regular 8 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf > ../builtinFonts/notosans_8_regular.h
+python fontconvert.py notosans_8_regular 8 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --no-kerning "${MANIFEST_ARGS[@]}" > ../builtinFonts/notosans_8_regular.h
@@ -1,10 +1,13 @@
 #!python3
 import freetype
+from fontTools.ttLib import TTFont
 import zlib
 import sys
 import re
 import math
 import argparse
+import heapq
+import struct
 from collections import namedtuple
 
 # Originally from https://github.com/vroland/epdiy
@@ -14,8 +17,16 @@ parser.add_argument("name", action="store", help="name of the font.")
 parser.add_argument("size", type=int, help="font size to use.")
 parser.add_argument("fontstack", action="store", nargs='+', help="list of font files, ordered by descending priority.")
 parser.add_argument("--2bit", dest="is2Bit", action="store_true", help="generate 2-bit greyscale bitmap instead of 1-bit black and white.")
+parser.add_argument("--binary", dest="binary", action="store", metavar="PATH", help="write a binary .epdfont file (loadable from SD at runtime) to PATH instead of printing a header.")
+parser.add_argument("--compress", dest="compress", action="store_true", help="Huffman-code the pixel runs of each glyph bitmap (decoded into a RAM glyph cache on use).")
+parser.add_argument("--row-aligned", dest="row_aligned", action="store_true", help="start every bitmap row on a byte boundary (1-bit only), so glyphs can be drawn a byte at a time.")
+parser.add_argument("--manifest", dest="manifest", action="store", metavar="PATH", help="export only the code points listed in this manifest (see font-manifest.txt) instead of the built-in interval table.")
+parser.add_argument("--no-kerning", dest="kerning", action="store_false", help="do not export the kerning pairs of the font.")
+parser.add_argument("--kern-manifest", dest="kern_manifest", action="store", metavar="PATH", help="export only the kerning pairs between code points listed in this manifest (see font-manifest.txt), to keep the pair table small.")
 parser.add_argument("--additional-intervals", dest="additional_intervals", action="append", help="Additional code point intervals to export as min,max. This argument can be repeated.")
 args = parser.parse_args()
+if args.row_aligned and (args.is2Bit or args.compress):
+    parser.error("--row-aligned only applies to uncompressed 1-bit fonts")
 
 GlyphProps = namedtuple("GlyphProps", ["width", "height", "advance_x", "left", "top", "data_length", "data_offset", "code_point"])
 
@@ -132,134 +143,281 @@ def load_glyph(code_point):
     print(f"code point {code_point} ({hex(code_point)}) not found in font stack!", file=sys.stderr)
     return None
 
-unmerged_intervals = sorted(intervals + add_ints)
-intervals = []
-unvalidated_intervals = []
-for i_start, i_end in unmerged_intervals:
-    if len(unvalidated_intervals) > 0 and i_start + 1 <= unvalidated_intervals[-1][1]:
-        unvalidated_intervals[-1] = (unvalidated_intervals[-1][0], max(unvalidated_intervals[-1][1], i_end))
-        continue
-    unvalidated_intervals.append((i_start, i_end))
-
-for i_start, i_end in unvalidated_intervals:
-    start = i_start
-    for code_point in range(i_start, i_end + 1):
-        face = load_glyph(code_point)
-        if face is None:
-            if start < code_point:
-                intervals.append((start, code_point - 1))
-            start = code_point + 1
-    if start != i_end + 1:
-        intervals.append((start, i_end))
+def merge_intervals(unmerged):
+    merged = []
+    for i_start, i_end in sorted(unmerged):
+        if len(merged) > 0 and i_start + 1 <= merged[-1][1]:
+            merged[-1] = (merged[-1][0], max(merged[-1][1], i_end))
+            continue
+        merged.append((i_start, i_end))
+    return merged
+
+def available_intervals(requested):
+    # Split the requested intervals around code points missing from the font stack
+    available = []
+    for i_start, i_end in requested:
+        start = i_start
+        for code_point in range(i_start, i_end + 1):
+            face = load_glyph(code_point)
+            if face is None:
+                if start < code_point:
+                    available.append((start, code_point - 1))
+                start = code_point + 1
+        if start != i_end + 1:
+            available.append((start, i_end))
+    return available
+
+def read_manifest(path):
+    # One entry per line: a code point or range (0x20-0x7E, U+2026), or "chars: <text>" for literal characters
+    code_points = set()
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            if line.startswith("chars:"):
+                code_points.update(ord(c) for c in line[len("chars:"):].strip() if not c.isspace())
+                continue
+            for token in line.split():
+                bounds = [int(b.replace("U+", "0x"), base=0) for b in token.split("-")]
+                code_points.update(range(bounds[0], bounds[-1] + 1))
+
+    # Densely packed: one interval per run of consecutive code points
+    dense = []
+    for code_point in sorted(code_points):
+        if dense and dense[-1][1] + 1 == code_point:
+            dense[-1] = (dense[-1][0], code_point)
+        else:
+            dense.append((code_point, code_point))
+    return dense
+
+default_intervals = merge_intervals(intervals + add_ints)
+if args.manifest:
+    intervals = available_intervals(merge_intervals(read_manifest(args.manifest) + add_ints))
+else:
+    intervals = available_intervals(default_intervals)
 
 for face in font_stack:
     face.set_char_size(size << 6, size << 6, 150, 150)
 
+def render_glyph(code_point, data_offset):
+    face = load_glyph(code_point)
+    bitmap = face.glyph.bitmap
+
+    # Build out 4-bit greyscale bitmap
+    pixels4g = []
+    px = 0
+    for i, v in enumerate(bitmap.buffer):
+        y = i / bitmap.width
+        x = i % bitmap.width
+        if x % 2 == 0:
+            px = (v >> 4)
+        else:
+            px = px | (v & 0xF0)
+            pixels4g.append(px);
+            px = 0
+        # eol
+        if x == bitmap.width - 1 and bitmap.width % 2 > 0:
+            pixels4g.append(px)
+            px = 0
+
+    if is2Bit:
+        # 0-3 white, 4-7 light grey, 8-11 dark grey, 12-15 black
+        # Downsample to 2-bit bitmap
+        pixels2b = []
+        px = 0
+        pitch = (bitmap.width // 2) + (bitmap.width % 2)
+        for y in range(bitmap.rows):
+            for x in range(bitmap.width):
+                px = px << 2
+                bm = pixels4g[y * pitch + (x // 2)]
+                bm = (bm >> ((x % 2) * 4)) & 0xF
+
+                if bm >= 12:
+                    px += 3
+                elif bm >= 8:
+                    px += 2
+                elif bm >= 4:
+                    px += 1
+
+                if (y * bitmap.width + x) % 4 == 3:
+                    pixels2b.append(px)
+                    px = 0
+        if (bitmap.width * bitmap.rows) % 4 != 0:
+            px = px << (4 - (bitmap.width * bitmap.rows) % 4) * 2
+            pixels2b.append(px)
+
+        # for y in range(bitmap.rows):
+        #     line = ''
+        #     for x in range(bitmap.width):
+        #         pixelPosition = y * bitmap.width + x
+        #         byte = pixels2b[pixelPosition // 4]
+        #         bit_index = (3 - (pixelPosition % 4)) * 2
+        #         line += '#' if ((byte >> bit_index) & 3) > 0 else '.'
+        #     print(line)
+        # print('')
+    else:
+        # Downsample to 1-bit bitmap - treat any 2+ as black
+        pixelsbw = []
+        px = 0
+        pitch = (bitmap.width // 2) + (bitmap.width % 2)
+        for y in range(bitmap.rows):
+            for x in range(bitmap.width):
+                px = px << 1
+                bm = pixels4g[y * pitch + (x // 2)]
+                px += 1 if ((x & 1) == 0 and bm & 0xE > 0) or ((x & 1) == 1 and bm & 0xE0 > 0) else 0
+
+                if args.row_aligned:
+                    # Each row is padded to whole bytes
+                    if x % 8 == 7 or x == bitmap.width - 1:
+                        pixelsbw.append(px << (7 - x % 8))
+                        px = 0
+                elif (y * bitmap.width + x) % 8 == 7:
+                    pixelsbw.append(px)
+                    px = 0
+        if not args.row_aligned and (bitmap.width * bitmap.rows) % 8 != 0:
+            px = px << (8 - (bitmap.width * bitmap.rows) % 8)
+            pixelsbw.append(px)
+
+        # for y in range(bitmap.rows):
+        #     line = ''
+        #     for x in range(bitmap.width):
+        #         pixelPosition = y * bitmap.width + x
+        #         byte = pixelsbw[pixelPosition // 8]
+        #         bit_index = 7 - (pixelPosition % 8)
+        #         line += '#' if (byte >> bit_index) & 1 else '.'
+        #     print(line)
+        # print('')
+
+    pixels = pixels2b if is2Bit else pixelsbw
+
+    # Build output data
+    packed = bytes(pixels)
+    glyph = GlyphProps(
+        width = bitmap.width,
+        height = bitmap.rows,
+        advance_x = norm_floor(face.glyph.advance.x),
+        left = face.glyph.bitmap_left,
+        top = face.glyph.bitmap_top,
+        data_length = len(packed),
+        data_offset = data_offset,
+        code_point = code_point,
+    )
+    return glyph, packed
+
 total_size = 0
 all_glyphs = []
 
 for i_start, i_end in intervals:
     for code_point in range(i_start, i_end + 1):
-        face = load_glyph(code_point)
-        bitmap = face.glyph.bitmap
-
-        # Build out 4-bit greyscale bitmap
-        pixels4g = []
-        px = 0
-        for i, v in enumerate(bitmap.buffer):
-            y = i / bitmap.width
-            x = i % bitmap.width
-            if x % 2 == 0:
-                px = (v >> 4)
-            else:
-                px = px | (v & 0xF0)
-                pixels4g.append(px);
-                px = 0
-            # eol
-            if x == bitmap.width - 1 and bitmap.width % 2 > 0:
-                pixels4g.append(px)
-                px = 0
-
-        if is2Bit:
-            # 0-3 white, 4-7 light grey, 8-11 dark grey, 12-15 black
-            # Downsample to 2-bit bitmap
-            pixels2b = []
-            px = 0
-            pitch = (bitmap.width // 2) + (bitmap.width % 2)
-            for y in range(bitmap.rows):
-                for x in range(bitmap.width):
-                    px = px << 2
-                    bm = pixels4g[y * pitch + (x // 2)]
-                    bm = (bm >> ((x % 2) * 4)) & 0xF
-
-                    if bm >= 12:
-                        px += 3
-                    elif bm >= 8:
-                        px += 2
-                    elif bm >= 4:
-                        px += 1
-
-                    if (y * bitmap.width + x) % 4 == 3:
-                        pixels2b.append(px)
-                        px = 0
-            if (bitmap.width * bitmap.rows) % 4 != 0:
-                px = px << (4 - (bitmap.width * bitmap.rows) % 4) * 2
-                pixels2b.append(px)
-
-            # for y in range(bitmap.rows):
-            #     line = ''
-            #     for x in range(bitmap.width):
-            #         pixelPosition = y * bitmap.width + x
-            #         byte = pixels2b[pixelPosition // 4]
-            #         bit_index = (3 - (pixelPosition % 4)) * 2
-            #         line += '#' if ((byte >> bit_index) & 3) > 0 else '.'
-            #     print(line)
-            # print('')
-        else:
-            # Downsample to 1-bit bitmap - treat any 2+ as black
-            pixelsbw = []
-            px = 0
-            pitch = (bitmap.width // 2) + (bitmap.width % 2)
-            for y in range(bitmap.rows):
-                for x in range(bitmap.width):
-                    px = px << 1
-                    bm = pixels4g[y * pitch + (x // 2)]
-                    px += 1 if ((x & 1) == 0 and bm & 0xE > 0) or ((x & 1) == 1 and bm & 0xE0 > 0) else 0
-
-                    if (y * bitmap.width + x) % 8 == 7:
-                        pixelsbw.append(px)
-                        px = 0
-            if (bitmap.width * bitmap.rows) % 8 != 0:
-                px = px << (8 - (bitmap.width * bitmap.rows) % 8)
-                pixelsbw.append(px)
-
-            # for y in range(bitmap.rows):
-            #     line = ''
-            #     for x in range(bitmap.width):
-            #         pixelPosition = y * bitmap.width + x
-            #         byte = pixelsbw[pixelPosition // 8]
-            #         bit_index = 7 - (pixelPosition % 8)
-            #         line += '#' if (byte >> bit_index) & 1 else '.'
-            #     print(line)
-            # print('')
-
-        pixels = pixels2b if is2Bit else pixelsbw
-
-        # Build output data
-        packed = bytes(pixels)
-        glyph = GlyphProps(
-            width = bitmap.width,
-            height = bitmap.rows,
-            advance_x = norm_floor(face.glyph.advance.x),
-            left = face.glyph.bitmap_left,
-            top = face.glyph.bitmap_top,
-            data_length = len(packed),
-            data_offset = total_size,
-            code_point = code_point,
-        )
+        glyph, packed = render_glyph(code_point, total_size)
         total_size += len(packed)
         all_glyphs.append((glyph, packed))
 
+if args.manifest:
+    # Build-time report: what the subset saves against the built-in interval table (sizeof(EpdGlyph) is 16,
+    # sizeof(EpdUnicodeInterval) is 12)
+    full_intervals = available_intervals(default_intervals)
+    full_glyphs = sum(i_end - i_start + 1 for i_start, i_end in full_intervals)
+    full_bitmap = sum(len(render_glyph(code_point, 0)[1]) for i_start, i_end in full_intervals for code_point in range(i_start, i_end + 1))
+    full_bytes = full_bitmap + full_glyphs * 16 + len(full_intervals) * 12
+    subset_bytes = total_size + len(all_glyphs) * 16 + len(intervals) * 12
+    print(f"{font_name}: {len(all_glyphs)}/{full_glyphs} glyphs, {len(intervals)}/{len(full_intervals)} intervals, "
+          f"{subset_bytes}/{full_bytes} bytes, saved {full_bytes - subset_bytes} bytes", file=sys.stderr)
+
+def unpack_pixels(packed, count):
+    bits = 2 if is2Bit else 1
+    per_byte = 8 // bits
+    mask = (1 << bits) - 1
+    return [(packed[i // per_byte] >> ((per_byte - 1 - i % per_byte) * bits)) & mask for i in range(count)]
+
+# Glyph compression, see EpdGlyphCodec.h: runs of one pixel value become symbols
+# value * MAX_RUN + (length - 1), coded with a canonical Huffman code shared by the whole font.
+MAX_RUN = 16
+MAX_SYMBOLS = 4 * MAX_RUN
+MAX_CODE_LENGTH = 15
+
+def run_symbols(pixels):
+    symbols = []
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and run < MAX_RUN and pixels[i + run] == pixels[i]:
+            run += 1
+        symbols.append(pixels[i] * MAX_RUN + run - 1)
+        i += run
+    return symbols
+
+def huffman_code_lengths(counts):
+    # Halve the counts until the longest code fits the decoder's limit
+    while True:
+        nodes = [(c, s, [s]) for s, c in enumerate(counts) if c > 0]
+        lengths = [0] * MAX_SYMBOLS
+        if len(nodes) == 1:
+            lengths[nodes[0][1]] = 1
+            return lengths
+        heapq.heapify(nodes)
+        tiebreak = MAX_SYMBOLS
+        while len(nodes) > 1:
+            a = heapq.heappop(nodes)
+            b = heapq.heappop(nodes)
+            for sym in a[2] + b[2]:
+                lengths[sym] += 1
+            heapq.heappush(nodes, (a[0] + b[0], tiebreak, a[2] + b[2]))
+            tiebreak += 1
+        if max(lengths) <= MAX_CODE_LENGTH:
+            return lengths
+        counts = [(c + 1) // 2 if c > 0 else 0 for c in counts]
+
+def canonical_codes(lengths):
+    codes = {}
+    code = 0
+    prev_len = 0
+    for sym in sorted((s for s in range(MAX_SYMBOLS) if lengths[s]), key=lambda s: (lengths[s], s)):
+        code <<= lengths[sym] - prev_len
+        prev_len = lengths[sym]
+        codes[sym] = (code, lengths[sym])
+        code += 1
+    return codes
+
+def encode_symbols(symbols, codes):
+    out = []
+    acc = 0
+    nbits = 0
+    for sym in symbols:
+        code, length = codes[sym]
+        acc = (acc << length) | code
+        nbits += length
+        while nbits >= 8:
+            nbits -= 8
+            out.append((acc >> nbits) & 0xFF)
+    if nbits > 0:
+        out.append((acc << (8 - nbits)) & 0xFF)
+    return bytes(out)
+
+# Largest decoded bitmap, sizes the runtime glyph cache slots
+max_glyph_bytes = max((len(packed) for _, packed in all_glyphs), default=0)
+code_lengths = None
+
+if args.compress:
+    glyph_symbols = [run_symbols(unpack_pixels(packed, props.width * props.height)) for props, packed in all_glyphs]
+    counts = [0] * MAX_SYMBOLS
+    for symbols in glyph_symbols:
+        for sym in symbols:
+            counts[sym] += 1
+    code_lengths = huffman_code_lengths(counts)
+    codes = canonical_codes(code_lengths)
+
+    raw_size = total_size
+    compressed_glyphs = []
+    total_size = 0
+    for (props, packed), symbols in zip(all_glyphs, glyph_symbols):
+        coded = encode_symbols(symbols, codes)
+        compressed_glyphs.append((props._replace(data_length=len(coded), data_offset=total_size), coded))
+        total_size += len(coded)
+    all_glyphs = compressed_glyphs
+    print(f"compressed bitmaps: {raw_size} -> {total_size} bytes ({100 * total_size / max(raw_size, 1):.1f}%)", file=sys.stderr)
+
 # pipe seems to be a good heuristic for the "real" descender
 face = load_glyph(ord('|'))
 
@@ -270,11 +428,172 @@ for index, glyph in enumerate(all_glyphs):
     glyph_data.extend([b for b in packed])
     glyph_props.append(props)
 
+# Layout metrics, computed the same way as EpdFont::computeMetrics does for fonts without this block
+advance_by_code_point = {g.code_point: g.advance_x for g in glyph_props}
+replacement_advance = advance_by_code_point.get(0xFFFD, 0)
+ascii_advances = [advance_by_code_point.get(cp, replacement_advance) for cp in range(0x20, 0x7F)]
+metrics = {
+    "avg_advance_x": sum(ascii_advances[ord('a') - 0x20:ord('z') - 0x20 + 1]) // 26,
+    "max_advance_x": max((g.advance_x for g in glyph_props), default=0),
+    "space_advance_x": ascii_advances[0],
+    "min_left": min((g.left for g in glyph_props), default=0),
+    "max_right": max((g.left + g.width for g in glyph_props), default=0),
+    "max_top": max((g.top for g in glyph_props), default=0),
+    "min_bottom": min((g.top - g.height for g in glyph_props), default=0),
+}
+
+# Kerning pairs from the 'kern' feature of the fonts' GPOS tables (the shipped fonts have no legacy 'kern'
+# table, the only one FreeType reads), between code points in the BMP that come from the same face. Walking the
+# pair adjustment subtables visits only the pairs the font kerns, instead of probing every pair of glyphs.
+# Stored as an open-addressed hash table, see EpdFont::getKerning.
+MAX_KERN_TABLE_SIZE = 1 << 16
+
+def kern_slot(key, table_size):
+    return (((key * 0x9E3779B1) & 0xFFFFFFFF) >> 16) & (table_size - 1)
+
+def gpos_kern_lookups(gpos):
+    if not gpos.FeatureList or not gpos.LookupList:
+        return []
+    indices = sorted({i for record in gpos.FeatureList.FeatureRecord if record.FeatureTag == "kern"
+                      for i in record.Feature.LookupListIndex})
+    return [gpos.LookupList.Lookup[i] for i in indices]
+
+def pair_subtables(lookup):
+    for subtable in lookup.SubTable:
+        if lookup.LookupType == 9:  # Extension
+            subtable = subtable.ExtSubTable
+        if subtable.LookupType == 2:
+            yield subtable
+
+def x_advance(value):
+    return (getattr(value, "XAdvance", 0) or 0) if value is not None else 0
+
+def gpos_kerning(font, code_points_by_glyph):
+    # Font-unit adjustments by (left glyph name, right glyph name), summed over lookups. Within a lookup the
+    # first subtable that matches a pair applies, as in a shaper: a format 1 subtable matches the pairs it
+    # lists, a format 2 (class) subtable every pair whose left glyph it covers
+    if "GPOS" not in font:
+        return {}
+    gpos = font["GPOS"].table
+    ours = set(code_points_by_glyph)
+    total = {}
+    for lookup in gpos_kern_lookups(gpos):
+        found = {}
+        closed = set()  # Left glyphs a class subtable has already matched with every right glyph
+        for st in pair_subtables(lookup):
+            if st.Format == 1:
+                for first, pair_set in zip(st.Coverage.glyphs, st.PairSet):
+                    if first not in ours or first in closed:
+                        continue
+                    for record in pair_set.PairValueRecord:
+                        if record.SecondGlyph in ours:
+                            found.setdefault((first, record.SecondGlyph), x_advance(record.Value1))
+            elif st.Format == 2:
+                firsts = [g for g in st.Coverage.glyphs if g in ours and g not in closed]
+                class1 = st.ClassDef1.classDefs
+                class2 = st.ClassDef2.classDefs
+                seconds_by_class = {}
+                for g in ours:
+                    seconds_by_class.setdefault(class2.get(g, 0), []).append(g)
+                for first in firsts:
+                    row = st.Class1Record[class1.get(first, 0)].Class2Record
+                    for c2, seconds in seconds_by_class.items():
+                        adjust = x_advance(row[c2].Value1)
+                        if adjust:
+                            for second in seconds:
+                                found.setdefault((first, second), adjust)
+                closed.update(firsts)
+        for pair, adjust in found.items():
+            total[pair] = total.get(pair, 0) + adjust
+    return total
+
+def kerning_pairs(code_points):
+    by_face = {}
+    for code_point in code_points:
+        if code_point > 0xFFFF:
+            continue
+        for face_index, face in enumerate(font_stack):
+            if face.get_char_index(code_point) > 0:
+                by_face.setdefault(face_index, []).append(code_point)
+                break
+    pairs = {}
+    for face_index, face_code_points in by_face.items():
+        font = TTFont(args.fontstack[face_index], lazy=True)
+        cmap = font.getBestCmap()
+        code_points_by_glyph = {}
+        for code_point in face_code_points:
+            if code_point in cmap:
+                code_points_by_glyph.setdefault(cmap[code_point], []).append(code_point)
+        # Font units to pixels, as FreeType scales unfitted kerning
+        scale = font_stack[face_index].size.x_scale / 65536 / 64
+        for (left, right), adjust in gpos_kerning(font, code_points_by_glyph).items():
+            adjust = round(adjust * scale)
+            if adjust == 0:
+                continue
+            for left_cp in code_points_by_glyph[left]:
+                for right_cp in code_points_by_glyph[right]:
+                    pairs[(left_cp << 16) | right_cp] = max(-128, min(127, adjust))
+    if len(pairs) > MAX_KERN_TABLE_SIZE // 2:
+        print(f"{len(pairs)} kerning pairs, keeping the {MAX_KERN_TABLE_SIZE // 2} strongest", file=sys.stderr)
+        pairs = dict(sorted(pairs.items(), key=lambda p: -abs(p[1]))[:MAX_KERN_TABLE_SIZE // 2])
+    return pairs
+
+def kerning_table(pairs):
+    if not pairs:
+        return []
+    # At most half full, so probes stay short and there is always an empty slot to end a lookup
+    table_size = 1
+    while table_size < 2 * len(pairs):
+        table_size <<= 1
+    table = [(0, 0)] * table_size
+    for key, adjust in sorted(pairs.items()):
+        slot = kern_slot(key, table_size)
+        while table[slot][0] != 0:
+            slot = (slot + 1) & (table_size - 1)
+        table[slot] = (key, adjust)
+    return table
+
+kern_code_points = [g.code_point for g in glyph_props]
+if args.kern_manifest:
+    kern_code_points = [cp for i_start, i_end in read_manifest(args.kern_manifest) for cp in range(i_start, i_end + 1)
+                        if cp in advance_by_code_point]
+kern_table = kerning_table(kerning_pairs(kern_code_points)) if args.kerning else []
+if kern_table:
+    print(f"{font_name}: {sum(1 for key, _ in kern_table if key)} kerning pairs, {len(kern_table)} slots", file=sys.stderr)
+
+if args.binary:
+    # Layout documented in EpdFontFile.h
+    EPDFONT_VERSION = 1
+    EPDFONT_FLAG_2BIT = 0x01
+    EPDFONT_FLAG_COMPRESSED = 0x02
+    EPDFONT_FLAG_ROW_ALIGNED = 0x04
+    flags = (EPDFONT_FLAG_2BIT if is2Bit else 0) | (EPDFONT_FLAG_COMPRESSED if args.compress else 0) | \
+            (EPDFONT_FLAG_ROW_ALIGNED if args.row_aligned else 0)
+    with open(args.binary, "wb") as out:
+        out.write(struct.pack("<4sBBBxhhIIIHHI",
+                              b"EPDF", EPDFONT_VERSION, flags,
+                              norm_ceil(face.size.height), norm_ceil(face.size.ascender), norm_floor(face.size.descender),
+                              len(intervals), len(glyph_props), len(glyph_data),
+                              max_glyph_bytes, 0, len(kern_table)))
+        if code_lengths:
+            out.write(bytes(code_lengths))
+        offset = 0
+        for i_start, i_end in intervals:
+            out.write(struct.pack("<III", i_start, i_end, offset))
+            offset += i_end - i_start + 1
+        for g in glyph_props:
+            out.write(struct.pack("<BBBxhhHxxI", g.width, g.height, g.advance_x, g.left, g.top, g.data_length, g.data_offset))
+        for key, adjust in kern_table:
+            out.write(struct.pack("<Ibxxx", key, adjust))
+        out.write(bytes(glyph_data))
+    print(f"wrote {args.binary}: {len(glyph_props)} glyphs, {len(glyph_data)} bitmap bytes", file=sys.stderr)
+    sys.exit(0)
+
 print(f"""/**
  * generated by fontconvert.py
  * name: {font_name}
  * size: {size}
- * mode: {'2-bit' if is2Bit else '1-bit'}
+ * mode: {'2-bit' if is2Bit else '1-bit'}{', compressed' if args.compress else ''}{', row-aligned' if args.row_aligned else ''}
  * Command used: {' '.join(sys.argv)}
  */
 #pragma once
@@ -286,6 +605,12 @@ for c in chunks(glyph_data, 16):
     print ("    " + " ".join(f"0x{b:02X}," for b in c))
 print ("};\n");
 
+if code_lengths:
+    print(f"static const uint8_t {font_name}RunCodeLengths[{MAX_SYMBOLS}] = {{")
+    for c in chunks(code_lengths, 16):
+        print("    " + " ".join(f"{b}," for b in c))
+    print("};\n")
+
 print(f"static const EpdGlyph {font_name}Glyphs[] = {{")
 for i, g in enumerate(glyph_props):
     print ("    { " + ", ".join([f"{a}" for a in list(g[:-1])]),"},", f"// {chr(g.code_point) if g.code_point != 92 else '<backslash>'}")
@@ -298,6 +623,21 @@ for i_start, i_end in intervals:
     offset += i_end - i_start + 1
 print ("};\n");
 
+print(f"static const EpdFontMetrics {font_name}Metrics = {{")
+print(f"    {metrics['avg_advance_x']}, {metrics['max_advance_x']}, {metrics['space_advance_x']},")
+print(f"    {metrics['min_left']}, {metrics['max_right']}, {metrics['max_top']}, {metrics['min_bottom']},")
+print("    {")
+for c in chunks(ascii_advances, 16):
+    print("        " + " ".join(f"{a}," for a in c))
+print("    },")
+print("};\n")
+
+if kern_table:
+    print(f"static const EpdKernPair {font_name}KernPairs[{len(kern_table)}] = {{")
+    for c in chunks(kern_table, 4):
+        print("    " + " ".join(f"{{ 0x{key:08X}, {adjust} }}," for key, adjust in c))
+    print("};\n")
+
 print(f"static const EpdFontData {font_name} = {{")
 print(f"    {font_name}Bitmaps,")
 print(f"    {font_name}Glyphs,")
@@ -307,4 +647,11 @@ print(f"    {norm_ceil(face.size.height)},")
 print(f"    {norm_ceil(face.size.ascender)},")
 print(f"    {norm_floor(face.size.descender)},")
 print(f"    {'true' if is2Bit else 'false'},")
+print(f"    {font_name}RunCodeLengths," if code_lengths else "    nullptr,")
+print(f"    &{font_name}Metrics,")
+if kern_table or args.row_aligned:
+    print(f"    {font_name}KernPairs," if kern_table else "    nullptr,")
+    print(f"    {len(kern_table)},")
+if args.row_aligned:
+    print("    true,")
 print("};")
@@ -0,0 +1,213 @@
+#include "FrameSnapshot.h"
+
+#include <Arduino.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace PackBits {
+
+size_t encode(const uint8_t* src, const size_t srcLen, uint8_t* dst, const size_t dstCapacity) {
+  size_t in = 0;
+  size_t out = 0;
+
+  while (in < srcLen) {
+    size_t run = 1;
+    while (in + run < srcLen && run < 128 && src[in + run] == src[in]) {
+      run++;
+    }
+
+    if (run >= 2) {
+      // Repeat block: header -(run - 1), then the byte
+      if (out + 2 > dstCapacity) return 0;
+      dst[out++] = static_cast<uint8_t>(257 - run);
+      dst[out++] = src[in];
+      in += run;
+      continue;
+    }
+
+    // Literal block: stop where a run of three or more starts, it encodes better as a repeat
+    const size_t start = in;
+    size_t length = 0;
+    while (in < srcLen && length < 128) {
+      if (in + 2 < srcLen && src[in] == src[in + 1] && src[in] == src[in + 2]) break;
+      in++;
+      length++;
+    }
+
+    if (out + 1 + length > dstCapacity) return 0;
+    dst[out++] = static_cast<uint8_t>(length - 1);
+    memcpy(dst + out, src + start, length);
+    out += length;
+  }
+
+  return out;
+}
+
+bool decode(const uint8_t* src, const size_t srcLen, uint8_t* dst, const size_t dstLen) {
+  size_t in = 0;
+  size_t out = 0;
+
+  while (in < srcLen && out < dstLen) {
+    const auto header = static_cast<int8_t>(src[in++]);
+    if (header >= 0) {
+      const size_t length = header + 1;
+      if (in + length > srcLen || out + length > dstLen) return false;
+      memcpy(dst + out, src + in, length);
+      in += length;
+      out += length;
+    } else if (header != -128) {
+      const size_t length = 1 - header;
+      if (in >= srcLen || out + length > dstLen) return false;
+      memset(dst + out, src[in++], length);
+      out += length;
+    }
+  }
+
+  return out == dstLen;
+}
+
+}  // namespace PackBits
+
+FrameSnapshotPool::~FrameSnapshotPool() { free(pool); }
+
+int FrameSnapshotPool::find(const uint32_t key) const {
+  for (int i = 0; i < entryCount; i++) {
+    if (entries[i].key == key) return i;
+  }
+  return -1;
+}
+
+void FrameSnapshotPool::removeAt(const int index) {
+  const Entry removed = entries[index];
+
+  // Keep the pool contiguous so new snapshots always go at the end
+  memmove(pool + removed.offset, pool + removed.offset + removed.size, used - removed.offset - removed.size);
+  used -= removed.size;
+
+  entries[index] = entries[--entryCount];
+  for (int i = 0; i < entryCount; i++) {
+    if (entries[i].offset > removed.offset) entries[i].offset -= removed.size;
+  }
+}
+
+bool FrameSnapshotPool::evictLeastRecentlyUsed() {
+  if (entryCount == 0) return false;
+
+  int oldest = 0;
+  for (int i = 1; i < entryCount; i++) {
+    if (entries[i].lastUse < entries[oldest].lastUse) oldest = i;
+  }
+  removeAt(oldest);
+  return true;
+}
+
+bool FrameSnapshotPool::store(const uint32_t key, const uint8_t* frameBuffer) {
+  if (!frameBuffer) return false;
+
+  if (!pool) {
+    pool = static_cast<uint8_t*>(malloc(POOL_SIZE));
+    if (!pool) {
+      Serial.printf("[%lu] [SNAP] !! Failed to allocate snapshot pool (%zu bytes)\n", millis(), POOL_SIZE);
+      return false;
+    }
+  }
+
+  remove(key);
+  if (entryCount == MAX_SNAPSHOTS) evictLeastRecentlyUsed();
+
+  while (true) {
+    Entry entry = {};
+    entry.key = key;
+    entry.offset = used;
+
+    size_t encoded = 0;
+    bool fits = true;
+    for (int band = 0; band < NUM_BANDS; band++) {
+      const size_t bandBytes = PackBits::encode(frameBuffer + band * BAND_SIZE, BAND_SIZE, pool + used + encoded,
+                                                POOL_SIZE - used - encoded);
+      if (bandBytes == 0) {
+        fits = false;
+        break;
+      }
+      encoded += bandBytes;
+      entry.bandEnd[band] = static_cast<uint16_t>(encoded);
+    }
+
+    if (fits) {
+      entry.size = encoded;
+      entry.lastUse = ++useCounter;
+      entries[entryCount++] = entry;
+      used += encoded;
+      return true;
+    }
+
+    if (!evictLeastRecentlyUsed()) {
+      Serial.printf("[%lu] [SNAP] !! Frame does not compress into %zu bytes\n", millis(), POOL_SIZE);
+      return false;
+    }
+  }
+}
+
+bool FrameSnapshotPool::decodeBand(const Entry& entry, const int band, uint8_t* out) const {
+  const size_t start = band == 0 ? 0 : entry.bandEnd[band - 1];
+  return PackBits::decode(pool + entry.offset + start, entry.bandEnd[band] - start, out, BAND_SIZE);
+}
+
+bool FrameSnapshotPool::restore(const uint32_t key, uint8_t* frameBuffer) {
+  const int index = find(key);
+  if (index < 0 || !frameBuffer) return false;
+
+  Entry& entry = entries[index];
+  for (int band = 0; band < NUM_BANDS; band++) {
+    if (!decodeBand(entry, band, frameBuffer + band * BAND_SIZE)) {
+      Serial.printf("[%lu] [SNAP] !! Corrupt snapshot band %d\n", millis(), band);
+      return false;
+    }
+  }
+  entry.lastUse = ++useCounter;
+  return true;
+}
+
+bool FrameSnapshotPool::restoreRows(const uint32_t key, const int firstRow, const int numRows, uint8_t* out) {
+  const int index = find(key);
+  if (index < 0 || !out || firstRow < 0 || numRows <= 0 || firstRow + numRows > HalDisplay::DISPLAY_HEIGHT) {
+    return false;
+  }
+
+  Entry& entry = entries[index];
+  uint8_t bandBuffer[BAND_SIZE];
+  int row = firstRow;
+  const int endRow = firstRow + numRows;
+
+  while (row < endRow) {
+    const int band = row / BAND_ROWS;
+    const int bandFirstRow = band * BAND_ROWS;
+    const int rowsFromBand = std::min(endRow, bandFirstRow + BAND_ROWS) - row;
+    uint8_t* dst = out + (row - firstRow) * HalDisplay::DISPLAY_WIDTH_BYTES;
+
+    if (row == bandFirstRow && rowsFromBand == BAND_ROWS) {
+      // Whole band requested, decode in place
+      if (!decodeBand(entry, band, dst)) return false;
+    } else {
+      if (!decodeBand(entry, band, bandBuffer)) return false;
+      memcpy(dst, bandBuffer + (row - bandFirstRow) * HalDisplay::DISPLAY_WIDTH_BYTES,
+             rowsFromBand * HalDisplay::DISPLAY_WIDTH_BYTES);
+    }
+    row += rowsFromBand;
+  }
+
+  entry.lastUse = ++useCounter;
+  return true;
+}
+
+void FrameSnapshotPool::remove(const uint32_t key) {
+  const int index = find(key);
+  if (index >= 0) removeAt(index);
+}
+
+void FrameSnapshotPool::clear() {
+  entryCount = 0;
+  used = 0;
+}
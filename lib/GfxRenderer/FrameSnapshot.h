@@ -0,0 +1,64 @@
+#pragma once
+
+#include <HalDisplay.h>
+
+#include <cstddef>
+#include <cstdint>
+
+// PackBits run-length codec. Runs of up to 128 equal bytes become two bytes; anything else is stored as
+// literal blocks with a one-byte header.
+namespace PackBits {
+// Worst case output size for `srcLen` input bytes (all literals)
+constexpr size_t maxEncodedSize(const size_t srcLen) { return srcLen + (srcLen + 127) / 128; }
+// Returns the encoded size, or 0 if the output would not fit in `dstCapacity`
+size_t encode(const uint8_t* src, size_t srcLen, uint8_t* dst, size_t dstCapacity);
+// Decodes exactly `dstLen` bytes. Returns false on malformed or short input.
+bool decode(const uint8_t* src, size_t srcLen, uint8_t* dst, size_t dstLen);
+}  // namespace PackBits
+
+// Bounded pool of PackBits-compressed frame buffers, keyed by caller-chosen ids.
+// Each frame is encoded in independent bands of BAND_ROWS panel rows so any row range can be decoded
+// without touching the rest. The pool memory is allocated on first use; when it runs out, the least
+// recently used snapshot is evicted.
+class FrameSnapshotPool {
+ public:
+  static constexpr size_t POOL_SIZE = 16 * 1024;
+  static constexpr int MAX_SNAPSHOTS = 4;
+  static constexpr int BAND_ROWS = 16;
+  static constexpr int NUM_BANDS = HalDisplay::DISPLAY_HEIGHT / BAND_ROWS;
+  static constexpr size_t BAND_SIZE = BAND_ROWS * HalDisplay::DISPLAY_WIDTH_BYTES;
+  static_assert(NUM_BANDS * BAND_ROWS == HalDisplay::DISPLAY_HEIGHT, "Snapshot bands do not line up with the panel");
+
+  FrameSnapshotPool() = default;
+  ~FrameSnapshotPool();
+  FrameSnapshotPool(const FrameSnapshotPool& other) = delete;
+  FrameSnapshotPool& operator=(const FrameSnapshotPool& other) = delete;
+
+  bool store(uint32_t key, const uint8_t* frameBuffer);  // Replaces an existing snapshot with the same key
+  bool restore(uint32_t key, uint8_t* frameBuffer);
+  bool restoreRows(uint32_t key, int firstRow, int numRows, uint8_t* out);  // `out` receives numRows full rows
+  bool contains(uint32_t key) const { return find(key) >= 0; }
+  void remove(uint32_t key);
+  void clear();
+  size_t usedBytes() const { return used; }
+
+ private:
+  struct Entry {
+    uint32_t key;
+    uint32_t lastUse;
+    size_t offset;  // Start of the encoded bands within the pool
+    size_t size;
+    uint16_t bandEnd[NUM_BANDS];  // End of each encoded band, relative to offset
+  };
+
+  uint8_t* pool = nullptr;
+  Entry entries[MAX_SNAPSHOTS] = {};
+  int entryCount = 0;
+  size_t used = 0;
+  uint32_t useCounter = 0;
+
+  int find(uint32_t key) const;
+  void removeAt(int index);
+  bool evictLeastRecentlyUsed();
+  bool decodeBand(const Entry& entry, int band, uint8_t* out) const;
+};
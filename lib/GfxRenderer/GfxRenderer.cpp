@@ -2,7 +2,10 @@
 
 #include <Utf8.h>
 
-void GfxRenderer::insertFont(const int fontId, EpdFontFamily font) { fontMap.insert({fontId, font}); }
+void GfxRenderer::insertFont(const int fontId, EpdFontFamily font) {
+  fontMap.insert_or_assign(fontId, font);
+  glyphRuns.removeFont(fontId);
+}
 
 void GfxRenderer::rotateCoordinates(const int x, const int y, int* rotatedX, int* rotatedY) const {
   switch (orientation) {
@@ -65,6 +68,257 @@ void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
   }
 }
 
+// Draws a row-aligned 1-bit glyph (EpdFontData::rowAligned). One glyph column to the right moves (colDx, colDy) in
+// logical coordinates and one row down moves (rowDx, rowDy), so rotated text can use it as well. Pixels are
+// addressed by stepping through the panel buffer instead of a divide per pixel, whole zero bytes are skipped, and
+// when glyph rows run along panel rows they are merged in a byte at a time.
+void GfxRenderer::blitGlyph1Bit(const uint8_t* bitmap, const int width, const int height, const int x, const int y,
+                                const int colDx, const int colDy, const int rowDx, const int rowDy,
+                                const bool state) const {
+  uint8_t* frameBuffer = display.getFrameBuffer();
+  if (!frameBuffer) {
+    Serial.printf("[%lu] [GFX] !! No framebuffer\n", millis());
+    return;
+  }
+
+  const int rowBytes = (width + 7) >> 3;
+
+  // Panel position of the first pixel and the panel steps for one column and one row
+  int startX = 0, startY = 0, originX = 0, originY = 0, colX = 0, colY = 0, rowX = 0, rowY = 0;
+  rotateCoordinates(x, y, &startX, &startY);
+  rotateCoordinates(0, 0, &originX, &originY);
+  rotateCoordinates(colDx, colDy, &colX, &colY);
+  rotateCoordinates(rowDx, rowDy, &rowX, &rowY);
+  colX -= originX;
+  colY -= originY;
+  rowX -= originX;
+  rowY -= originY;
+
+  // Glyphs that are not fully on the panel take the bounds-checked path
+  const int lastX = startX + (width - 1) * colX + (height - 1) * rowX;
+  const int lastY = startY + (width - 1) * colY + (height - 1) * rowY;
+  if (std::min(startX, lastX) < 0 || std::max(startX, lastX) >= HalDisplay::DISPLAY_WIDTH ||
+      std::min(startY, lastY) < 0 || std::max(startY, lastY) >= HalDisplay::DISPLAY_HEIGHT) {
+    for (int glyphY = 0; glyphY < height; glyphY++) {
+      const uint8_t* row = bitmap + glyphY * rowBytes;
+      for (int glyphX = 0; glyphX < width; glyphX++) {
+        if (row[glyphX >> 3] & (0x80 >> (glyphX & 7))) {
+          drawPixel(x + glyphX * colDx + glyphY * rowDx, y + glyphX * colDy + glyphY * rowDy, state);
+        }
+      }
+    }
+    return;
+  }
+
+  if (colX == 1 && colY == 0) {
+    // Glyph rows run left to right along panel rows: shift each source byte into the two bytes it straddles.
+    // Padding bits are zero, so the byte after the row is only touched where the glyph has pixels.
+    const int shift = startX & 7;
+    for (int glyphY = 0; glyphY < height; glyphY++) {
+      const uint8_t* src = bitmap + glyphY * rowBytes;
+      uint8_t* dst = frameBuffer + (startY + glyphY * rowY) * HalDisplay::DISPLAY_WIDTH_BYTES +
+                     ((startX + glyphY * rowX) >> 3);
+      for (int b = 0; b < rowBytes; b++) {
+        if (!src[b]) continue;
+        const uint8_t high = src[b] >> shift;
+        const uint8_t low = shift ? static_cast<uint8_t>(src[b] << (8 - shift)) : 0;
+        if (state) {
+          dst[b] &= ~high;
+          if (low) dst[b + 1] &= ~low;
+        } else {
+          dst[b] |= high;
+          if (low) dst[b + 1] |= low;
+        }
+      }
+    }
+    return;
+  }
+
+  for (int glyphY = 0; glyphY < height; glyphY++) {
+    const uint8_t* src = bitmap + glyphY * rowBytes;
+    for (int b = 0; b < rowBytes; b++) {
+      if (!src[b]) continue;
+      int px = startX + glyphY * rowX + 8 * b * colX;
+      int py = startY + glyphY * rowY + 8 * b * colY;
+      for (uint8_t mask = 0x80; mask; mask >>= 1, px += colX, py += colY) {
+        if (!(src[b] & mask)) continue;
+        uint8_t* dst = frameBuffer + py * HalDisplay::DISPLAY_WIDTH_BYTES + (px >> 3);
+        const uint8_t bit = 0x80 >> (px & 7);
+        if (state) {
+          *dst &= ~bit;
+        } else {
+          *dst |= bit;
+        }
+      }
+    }
+  }
+}
+
+// Rasterizes key.text into a new strip of the glyph run cache. Walks the string twice: once for the ink bounds,
+// which fix the strip size, and once to set the pixels. Runs only on a cache miss.
+bool GfxRenderer::renderGlyphRun(const EpdFontFamily& font, const GlyphRunCache::Key& key,
+                                 GlyphRunCache::Strip* strip) const {
+  const auto style = static_cast<EpdFontFamily::Style>(key.style);
+  const EpdFontData* data = font.getData(style);
+
+  // Ink bounds relative to the origin (left edge, baseline), inclusive
+  int minX = 0, minY = 0, maxX = -1, maxY = -1;
+  int penX = 0;
+  uint32_t prevCp = 0;
+  uint32_t cp;
+  const uint8_t* p = reinterpret_cast<const uint8_t*>(key.text);
+  while ((cp = utf8NextCodepoint(&p))) {
+    penX += font.getKerning(prevCp, cp, style);
+    prevCp = cp;
+    const EpdGlyph* glyph = font.getGlyph(cp, style);
+    if (!glyph) glyph = font.getGlyph(REPLACEMENT_GLYPH, style);
+    if (!glyph) continue;
+
+    if (glyph->width > 0 && glyph->height > 0) {
+      const int left = penX + glyph->left;
+      const int top = -glyph->top;
+      if (maxX < minX) {
+        minX = left;
+        minY = top;
+        maxX = left + glyph->width - 1;
+        maxY = top + glyph->height - 1;
+      } else {
+        minX = std::min(minX, left);
+        minY = std::min(minY, top);
+        maxX = std::max(maxX, left + glyph->width - 1);
+        maxY = std::max(maxY, top + glyph->height - 1);
+      }
+    }
+    penX += glyph->advanceX;
+  }
+
+  int textWidth = 0, textHeight = 0;
+  font.getTextDimensions(key.text, &textWidth, &textHeight, style);
+
+  // Nothing to draw (whitespace only): cache an empty strip
+  if (maxX < minX) {
+    if (!glyphRuns.insert(key, 0, 0, 0, 0, textWidth)) return false;
+    return glyphRuns.find(key, strip);
+  }
+
+  // Panel steps for one logical pixel right and one down
+  int originX = 0, originY = 0, colX = 0, colY = 0, rowX = 0, rowY = 0;
+  rotateCoordinates(0, 0, &originX, &originY);
+  rotateCoordinates(1, 0, &colX, &colY);
+  rotateCoordinates(0, 1, &rowX, &rowY);
+  colX -= originX;
+  colY -= originY;
+  rowX -= originX;
+  rowY -= originY;
+
+  const int cornerAX = minX * colX + minY * rowX, cornerAY = minX * colY + minY * rowY;
+  const int cornerBX = maxX * colX + maxY * rowX, cornerBY = maxX * colY + maxY * rowY;
+  const int offsetX = std::min(cornerAX, cornerBX);
+  const int offsetY = std::min(cornerAY, cornerBY);
+  const int width = std::abs(cornerBX - cornerAX) + 1;
+  const int height = std::abs(cornerBY - cornerAY) + 1;
+
+  uint8_t* bits = glyphRuns.insert(key, offsetX, offsetY, width, height, textWidth);
+  if (!bits) return false;
+  const int stripRowBytes = (width + 7) >> 3;
+
+  penX = 0;
+  prevCp = 0;
+  p = reinterpret_cast<const uint8_t*>(key.text);
+  while ((cp = utf8NextCodepoint(&p))) {
+    penX += font.getKerning(prevCp, cp, style);
+    prevCp = cp;
+    const EpdGlyph* glyph = font.getGlyph(cp, style);
+    if (!glyph) glyph = font.getGlyph(REPLACEMENT_GLYPH, style);
+    if (!glyph) continue;
+
+    const uint8_t* bitmap = glyph->width > 0 && glyph->height > 0 ? font.getGlyphBitmap(glyph, style) : nullptr;
+    if (bitmap) {
+      const int glyphRowBytes = (glyph->width + 7) >> 3;
+      for (int glyphY = 0; glyphY < glyph->height; glyphY++) {
+        for (int glyphX = 0; glyphX < glyph->width; glyphX++) {
+          bool ink;
+          const int pixelPosition = glyphY * glyph->width + glyphX;
+          if (data->is2Bit) {
+            ink = (bitmap[pixelPosition / 4] >> ((3 - pixelPosition % 4) * 2)) & 0x3;  // Grays are black in BW
+          } else if (data->rowAligned) {
+            ink = bitmap[glyphY * glyphRowBytes + (glyphX >> 3)] & (0x80 >> (glyphX & 7));
+          } else {
+            ink = bitmap[pixelPosition / 8] & (0x80 >> (pixelPosition % 8));
+          }
+          if (!ink) continue;
+
+          const int a = penX + glyph->left + glyphX;
+          const int b = glyphY - glyph->top;
+          const int px = a * colX + b * rowX - offsetX;
+          const int py = a * colY + b * rowY - offsetY;
+          bits[py * stripRowBytes + (px >> 3)] |= 0x80 >> (px & 7);
+        }
+      }
+    }
+    penX += glyph->advanceX;
+  }
+
+  return glyphRuns.find(key, strip);
+}
+
+void GfxRenderer::drawStaticText(const int fontId, const int x, const int y, const char* text, const int maxWidth,
+                                 const bool black, const EpdFontFamily::Style style) const {
+  if (text == nullptr || *text == '\0') {
+    return;
+  }
+
+  if (fontMap.count(fontId) == 0) {
+    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+    return;
+  }
+  const auto& font = fontMap.at(fontId);
+
+  // Strips only hold the BW rendering
+  uint8_t* frameBuffer = display.getFrameBuffer();
+  GlyphRunCache::Strip strip = {};
+  bool cached = false;
+  if (renderMode == BW && frameBuffer) {
+    const GlyphRunCache::Key key = {text, GlyphRunCache::hashText(text), fontId, static_cast<uint8_t>(style)};
+    cached = glyphRuns.find(key, &strip) || renderGlyphRun(font, key, &strip);
+  }
+
+  int left = 0, top = 0;
+  if (cached) {
+    rotateCoordinates(x, y + getFontAscenderSize(fontId), &left, &top);
+    left += strip.offsetX;
+    top += strip.offsetY;
+  }
+
+  // Text that needs truncating, or a strip that is not fully on the panel, takes the regular path
+  if (!cached || strip.textWidth > maxWidth || left < 0 || top < 0 || left + strip.width > HalDisplay::DISPLAY_WIDTH ||
+      top + strip.height > HalDisplay::DISPLAY_HEIGHT) {
+    const std::string clipped = truncatedText(fontId, text, maxWidth, style);
+    drawText(fontId, x, y, clipped.c_str(), black, style);
+    return;
+  }
+
+  // Same byte merge as blitGlyph1Bit, strip rows are panel rows
+  const int rowBytes = (strip.width + 7) >> 3;
+  const int shift = left & 7;
+  for (int row = 0; row < strip.height; row++) {
+    const uint8_t* src = strip.bits + row * rowBytes;
+    uint8_t* dst = frameBuffer + (top + row) * HalDisplay::DISPLAY_WIDTH_BYTES + (left >> 3);
+    for (int b = 0; b < rowBytes; b++) {
+      if (!src[b]) continue;
+      const uint8_t high = src[b] >> shift;
+      const uint8_t low = shift ? static_cast<uint8_t>(src[b] << (8 - shift)) : 0;
+      if (black) {
+        dst[b] &= ~high;
+        if (low) dst[b + 1] &= ~low;
+      } else {
+        dst[b] |= high;
+        if (low) dst[b + 1] |= low;
+      }
+    }
+  }
+}
+
 int GfxRenderer::getTextWidth(const int fontId, const char* text, const EpdFontFamily::Style style) const {
   if (fontMap.count(fontId) == 0) {
     Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
@@ -104,7 +358,10 @@ void GfxRenderer::drawText(const int fontId, const int x, const int y, const cha
   }
 
   uint32_t cp;
+  uint32_t prevCp = 0;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
+    xpos += font.getKerning(prevCp, cp, style);
+    prevCp = cp;
     renderChar(font, cp, &xpos, &yPos, black, style);
   }
 }
@@ -460,7 +717,7 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
 
       const uint8_t val = outputRow[bmpX / 4] >> (6 - ((bmpX * 2) % 8)) & 0x3;
 
-      if (renderMode == BW && val < 3) {
+      if ((renderMode == BW || renderMode == GRAYSCALE) && val < 3) {
         drawPixel(screenX, screenY);
       } else if (renderMode == GRAYSCALE_MSB && (val == 1 || val == 2)) {
         drawPixel(screenX, screenY, false);
@@ -619,32 +876,203 @@ void GfxRenderer::invertScreen() const {
     Serial.printf("[%lu] [GFX] !! No framebuffer in invertScreen\n", millis());
     return;
   }
-  for (int i = 0; i < HalDisplay::BUFFER_SIZE; i++) {
-    buffer[i] = ~buffer[i];
+
+  // Flip a word at a time; the frame buffer is not guaranteed to be word-aligned, so handle the edges bytewise
+  uint8_t* p = buffer;
+  uint8_t* const end = buffer + HalDisplay::BUFFER_SIZE;
+  while (p < end && (reinterpret_cast<uintptr_t>(p) & 3) != 0) {
+    *p = ~*p;
+    p++;
+  }
+  auto* words = reinterpret_cast<uint32_t*>(p);
+  const size_t wordCount = (end - p) / 4;
+  for (size_t i = 0; i < wordCount; i++) {
+    words[i] = ~words[i];
+  }
+  p += wordCount * 4;
+  while (p < end) {
+    *p = ~*p;
+    p++;
   }
 }
 
 void GfxRenderer::displayBuffer(const HalDisplay::RefreshMode refreshMode) const {
   display.displayBuffer(refreshMode, fadingFix);
+  refreshCount++;
+}
+
+void GfxRenderer::displayRegion(const int x, const int y, const int width, const int height) {
+  queueRegion(x, y, width, height);
+  displayQueuedRegions();
+}
+
+/**
+ * Queue a logical rectangle for a partial refresh. The rectangle is clipped to the screen, rotated into
+ * panel coordinates and widened so its panel x and width are multiples of 8, as the controller requires.
+ * Overlapping or touching windows are merged so a region is never refreshed twice; if the queue is full the
+ * last queued window is folded into the new one.
+ */
+void GfxRenderer::queueRegion(int x, int y, int width, int height) {
+  // Clip to the logical screen
+  if (x < 0) {
+    width += x;
+    x = 0;
+  }
+  if (y < 0) {
+    height += y;
+    y = 0;
+  }
+  width = std::min(width, getScreenWidth() - x);
+  height = std::min(height, getScreenHeight() - y);
+  if (width <= 0 || height <= 0) {
+    return;
+  }
+
+  int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+  rotateCoordinates(x, y, &x0, &y0);
+  rotateCoordinates(x + width - 1, y + height - 1, &x1, &y1);
+
+  const int left = std::min(x0, x1) & ~7;
+  const int right = (std::max(x0, x1) | 7) + 1;  // Exclusive, byte-aligned
+  const int top = std::min(y0, y1);
+  const int bottom = std::max(y0, y1) + 1;
+
+  PanelRect rect = {static_cast<int16_t>(left), static_cast<int16_t>(top), static_cast<int16_t>(right - left),
+                    static_cast<int16_t>(bottom - top)};
+
+  // Merge with any queued window it overlaps or touches; a merge can create new overlaps, so rescan. With the
+  // queue still full, fold the last window in as well and rescan, as the grown window may now reach others.
+  const auto mergeInto = [](PanelRect& rect, const PanelRect& other) {
+    const int16_t mergedX = std::min(rect.x, other.x);
+    const int16_t mergedY = std::min(rect.y, other.y);
+    rect.width = static_cast<int16_t>(std::max(rect.x + rect.width, other.x + other.width) - mergedX);
+    rect.height = static_cast<int16_t>(std::max(rect.y + rect.height, other.y + other.height) - mergedY);
+    rect.x = mergedX;
+    rect.y = mergedY;
+  };
+  bool merged = true;
+  while (merged) {
+    merged = false;
+    for (int i = 0; i < queuedRegionCount; i++) {
+      const PanelRect& other = queuedRegions[i];
+      if (rect.x > other.x + other.width || other.x > rect.x + rect.width || rect.y > other.y + other.height ||
+          other.y > rect.y + rect.height) {
+        continue;
+      }
+
+      mergeInto(rect, other);
+      queuedRegions[i] = queuedRegions[--queuedRegionCount];
+      merged = true;
+      break;
+    }
+
+    if (!merged && queuedRegionCount == MAX_QUEUED_REGIONS) {
+      mergeInto(rect, queuedRegions[--queuedRegionCount]);
+      merged = true;
+    }
+  }
+
+  queuedRegions[queuedRegionCount++] = rect;
+}
+
+/**
+ * Refresh every queued window with a fast partial update. When the windows cover at least half of the panel,
+ * a single full-frame fast refresh is cheaper than several windowed ones and is used instead.
+ */
+void GfxRenderer::displayQueuedRegions() {
+  if (queuedRegionCount == 0) {
+    return;
+  }
+
+  int coveredArea = 0;
+  for (int i = 0; i < queuedRegionCount; i++) {
+    coveredArea += queuedRegions[i].width * queuedRegions[i].height;
+  }
+
+  if (coveredArea * 2 >= HalDisplay::DISPLAY_WIDTH * HalDisplay::DISPLAY_HEIGHT) {
+    display.displayBuffer(HalDisplay::FAST_REFRESH, fadingFix);
+  } else {
+    // Keep the analog circuits up between windows; only the last one may power them down
+    for (int i = 0; i < queuedRegionCount; i++) {
+      const PanelRect& rect = queuedRegions[i];
+      display.displayWindow(rect.x, rect.y, rect.width, rect.height, fadingFix && i == queuedRegionCount - 1);
+    }
+  }
+  refreshCount++;
+
+  queuedRegionCount = 0;
 }
 
 std::string GfxRenderer::truncatedText(const int fontId, const char* text, const int maxWidth,
                                        const EpdFontFamily::Style style) const {
-  if (!text || maxWidth <= 0) return "";
+  TextMeasurement item = {text, maxWidth, 0, 0, false};
+  measureTexts(fontId, &item, 1, style);
+  std::string result(text ? text : "", item.fitBytes);
+  return item.truncated ? result + "..." : result;
+}
 
-  std::string item = text;
-  const char* ellipsis = "...";
-  int textWidth = getTextWidth(fontId, item.c_str(), style);
-  if (textWidth <= maxWidth) {
-    // Text fits, return as is
-    return item;
+void GfxRenderer::measureTexts(const int fontId, TextMeasurement* items, const int count,
+                               const EpdFontFamily::Style style) const {
+  for (int i = 0; i < count; i++) {
+    items[i].width = 0;
+    items[i].fitBytes = 0;
+    items[i].truncated = false;
   }
 
-  while (!item.empty() && getTextWidth(fontId, (item + ellipsis).c_str(), style) >= maxWidth) {
-    utf8RemoveLastChar(item);
+  if (fontMap.count(fontId) == 0) {
+    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+    return;
   }
+  const EpdFontFamily& font = fontMap.at(fontId);
+
+  const auto withEllipsis = [&font, style](EpdFont::TextCursor cursor) {
+    for (int dot = 0; dot < 3; dot++) font.addCodepoint(cursor, '.', style);
+    return cursor.maxX - cursor.minX;
+  };
+
+  for (int i = 0; i < count; i++) {
+    TextMeasurement& item = items[i];
+    if (!item.text || item.maxWidth <= 0) continue;
+
+    // Walk the string once. Like truncatedText used to, keep the longest non-empty prefix that still fits
+    // (strictly) with "..." appended; if none does, only "..." is drawn.
+    EpdFont::TextCursor cursor;
+    const char* p = item.text;
+    size_t bestBytes = 0;
+    int bestWidth = withEllipsis(cursor);
+    uint32_t cp;
+    while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&p)))) {
+      font.addCodepoint(cursor, cp, style);
+      const int width = withEllipsis(cursor);
+      if (width < item.maxWidth) {
+        bestBytes = p - item.text;
+        bestWidth = width;
+      }
+    }
 
-  return item.empty() ? ellipsis : item + ellipsis;
+    const int fullWidth = cursor.maxX - cursor.minX;
+    if (fullWidth <= item.maxWidth) {
+      item.width = fullWidth;
+      item.fitBytes = p - item.text;
+    } else {
+      item.width = bestWidth;
+      item.fitBytes = bestBytes;
+      item.truncated = true;
+    }
+  }
+}
+
+void GfxRenderer::drawMeasuredText(const int fontId, const int x, const int y, const TextMeasurement& item,
+                                   const bool black, const EpdFontFamily::Style style) const {
+  if (!item.text || (item.fitBytes == 0 && !item.truncated)) return;
+
+  if (!item.truncated) {
+    drawText(fontId, x, y, item.text, black, style);
+    return;
+  }
+  std::string clipped(item.text, item.fitBytes);
+  clipped += "...";
+  drawText(fontId, x, y, clipped.c_str(), black, style);
 }
 
 // Note: Internal driver treats screen in command orientation; this library exposes a logical orientation
@@ -682,19 +1110,40 @@ int GfxRenderer::getSpaceWidth(const int fontId) const {
     return 0;
   }
 
-  return fontMap.at(fontId).getGlyph(' ', EpdFontFamily::REGULAR)->advanceX;
+  return fontMap.at(fontId).getMetrics(EpdFontFamily::REGULAR).spaceAdvanceX;
+}
+
+const EpdFontMetrics* GfxRenderer::getFontMetrics(const int fontId) const {
+  if (fontMap.count(fontId) == 0) {
+    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+    return nullptr;
+  }
+
+  return &fontMap.at(fontId).getMetrics(EpdFontFamily::REGULAR);
 }
 
-int GfxRenderer::getTextAdvanceX(const int fontId, const char* text) const {
+int GfxRenderer::getTextAdvanceX(const int fontId, const char* text, const EpdFontFamily::Style style) const {
   if (fontMap.count(fontId) == 0) {
     Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
     return 0;
   }
 
+  const EpdFontFamily& font = fontMap.at(fontId);
+  const EpdFontMetrics& metrics = font.getMetrics(style);
   uint32_t cp;
+  uint32_t prevCp = 0;
   int width = 0;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
-    width += fontMap.at(fontId).getGlyph(cp, EpdFontFamily::REGULAR)->advanceX;
+    width += font.getKerning(prevCp, cp, style);
+    prevCp = cp;
+    // Printable ASCII comes straight from the metrics table, anything else needs the glyph
+    if (cp >= ' ' && cp <= '~') {
+      width += metrics.asciiAdvanceX[cp - ' '];
+      continue;
+    }
+    const EpdGlyph* glyph = font.getGlyph(cp, style);
+    if (!glyph) glyph = font.getGlyph(REPLACEMENT_GLYPH, style);
+    if (glyph) width += glyph->advanceX;
   }
   return width;
 }
@@ -750,7 +1199,10 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
   int yPos = y;  // Current Y position (decreases as we draw characters)
 
   uint32_t cp;
+  uint32_t prevCp = 0;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
+    yPos -= font.getKerning(prevCp, cp, style);
+    prevCp = cp;
     const EpdGlyph* glyph = font.getGlyph(cp, style);
     if (!glyph) {
       glyph = font.getGlyph(REPLACEMENT_GLYPH, style);
@@ -760,15 +1212,17 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
     }
 
     const int is2Bit = font.getData(style)->is2Bit;
-    const uint32_t offset = glyph->dataOffset;
     const uint8_t width = glyph->width;
     const uint8_t height = glyph->height;
     const int left = glyph->left;
     const int top = glyph->top;
 
-    const uint8_t* bitmap = &font.getData(style)->bitmap[offset];
+    const uint8_t* bitmap = font.getGlyphBitmap(glyph, style);
 
-    if (bitmap != nullptr) {
+    if (bitmap != nullptr && !is2Bit && font.getData(style)->rowAligned) {
+      // Same transformation as below: glyph columns go up the screen, rows go right
+      blitGlyph1Bit(bitmap, width, height, x + font.getData(style)->ascender - top, yPos - left, 0, -1, 1, 0, black);
+    } else if (bitmap != nullptr) {
       for (int glyphY = 0; glyphY < height; glyphY++) {
         for (int glyphX = 0; glyphX < width; glyphX++) {
           const int pixelPosition = glyphY * width + glyphX;
@@ -784,7 +1238,7 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
             const uint8_t bit_index = (3 - pixelPosition % 4) * 2;
             const uint8_t bmpVal = 3 - ((byte >> bit_index) & 0x3);
 
-            if (renderMode == BW && bmpVal < 3) {
+            if ((renderMode == BW || renderMode == GRAYSCALE) && bmpVal < 3) {
               drawPixel(screenX, screenY, black);
             } else if (renderMode == GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
               drawPixel(screenX, screenY, false);
@@ -819,7 +1273,129 @@ void GfxRenderer::copyGrayscaleLsbBuffers() const { display.copyGrayscaleLsbBuff
 
 void GfxRenderer::copyGrayscaleMsbBuffers() const { display.copyGrayscaleMsbBuffers(display.getFrameBuffer()); }
 
-void GfxRenderer::displayGrayBuffer() const { display.displayGrayBuffer(fadingFix); }
+void GfxRenderer::displayGrayBuffer() const {
+  display.displayGrayBuffer(fadingFix);
+  refreshCount++;
+}
+
+void GfxRenderer::recordGrayscaleGlyph(const uint8_t* bitmap, const int x, const int y, const int width,
+                                       const int height) const {
+  int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+  rotateCoordinates(x, y, &x0, &y0);
+  rotateCoordinates(x + width - 1, y + height - 1, &x1, &y1);
+
+  GrayscaleGlyph glyph;
+  glyph.bitmap = bitmap;
+  glyph.x = static_cast<int16_t>(x);
+  glyph.y = static_cast<int16_t>(y);
+  glyph.width = static_cast<uint8_t>(width);
+  glyph.height = static_cast<uint8_t>(height);
+  glyph.panelTop = static_cast<int16_t>(std::min(y0, y1));
+  glyph.panelBottom = static_cast<int16_t>(std::max(y0, y1));
+  grayscaleGlyphs.push_back(glyph);
+}
+
+void GfxRenderer::rasterizeGrayscaleGlyph(const GrayscaleGlyph& glyph, const int bandY, const int bandHeight,
+                                          uint8_t* lsbBand, uint8_t* msbBand) const {
+  for (int glyphY = 0; glyphY < glyph.height; glyphY++) {
+    for (int glyphX = 0; glyphX < glyph.width; glyphX++) {
+      const int pixelPosition = glyphY * glyph.width + glyphX;
+      const uint8_t byte = glyph.bitmap[pixelPosition / 4];
+      const uint8_t bit_index = (3 - pixelPosition % 4) * 2;
+      // Same mapping as renderChar: 0 -> black, 1 -> dark grey, 2 -> light grey, 3 -> white
+      const uint8_t bmpVal = 3 - ((byte >> bit_index) & 0x3);
+      if (bmpVal != 1 && bmpVal != 2) {
+        continue;
+      }
+
+      int panelX = 0, panelY = 0;
+      rotateCoordinates(glyph.x + glyphX, glyph.y + glyphY, &panelX, &panelY);
+      if (panelY < bandY || panelY >= bandY + bandHeight || panelX < 0 || panelX >= HalDisplay::DISPLAY_WIDTH) {
+        continue;
+      }
+
+      const int byteIndex = (panelY - bandY) * HalDisplay::DISPLAY_WIDTH_BYTES + panelX / 8;
+      const uint8_t mask = 1 << (7 - panelX % 8);
+      msbBand[byteIndex] |= mask;
+      if (bmpVal == 1) {
+        lsbBand[byteIndex] |= mask;
+      }
+    }
+  }
+}
+
+// Rasterizes the recorded glyphs into both gray planes and streams them to the controller band by band, then
+// forgets the glyphs. Returns false if there was nothing to write.
+bool GfxRenderer::writeGrayscalePlanes() {
+  if (grayscaleGlyphs.empty()) {
+    return false;
+  }
+
+  if (!display.getFrameBuffer()) {
+    Serial.printf("[%lu] [GFX] !! No framebuffer for the grayscale planes\n", millis());
+    grayscaleGlyphs.clear();
+    return false;
+  }
+
+  constexpr size_t bandSize = GRAYSCALE_BAND_ROWS * HalDisplay::DISPLAY_WIDTH_BYTES;
+  auto* lsbBand = static_cast<uint8_t*>(malloc(bandSize * 2));
+  if (!lsbBand) {
+    Serial.printf("[%lu] [GFX] !! Failed to allocate grayscale bands (%zu bytes)\n", millis(), bandSize * 2);
+    grayscaleGlyphs.clear();
+    return false;
+  }
+  uint8_t* msbBand = lsbBand + bandSize;
+
+  for (int bandY = 0; bandY < HalDisplay::DISPLAY_HEIGHT; bandY += GRAYSCALE_BAND_ROWS) {
+    const int bandHeight = std::min(GRAYSCALE_BAND_ROWS, HalDisplay::DISPLAY_HEIGHT - bandY);
+    memset(lsbBand, 0, bandSize * 2);
+
+    for (const auto& glyph : grayscaleGlyphs) {
+      if (glyph.panelBottom < bandY || glyph.panelTop >= bandY + bandHeight) {
+        continue;
+      }
+      rasterizeGrayscaleGlyph(glyph, bandY, bandHeight, lsbBand, msbBand);
+    }
+
+    display.writeGrayscaleBand(bandY, bandHeight, lsbBand, msbBand);
+  }
+
+  free(lsbBand);
+  grayscaleGlyphs.clear();
+  grayscaleGlyphs.shrink_to_fit();
+  return true;
+}
+
+/**
+ * Single-pass alternative to the BW / GRAYSCALE_LSB / GRAYSCALE_MSB sequence for anti-aliased text.
+ * Switch to GRAYSCALE and draw the screen once: everything lands in the BW frame as in BW mode, and the
+ * placement of each anti-aliased glyph is recorded as it is drawn. Display the BW frame as usual, then
+ * call this. Both gray planes are rasterized from the recorded glyphs together and streamed to the
+ * controller in bands of GRAYSCALE_BAND_ROWS rows, so no full-screen buffer is stored or allocated.
+ * Returns the renderer to BW mode.
+ */
+void GfxRenderer::displayGrayscale() {
+  renderMode = BW;
+  if (!writeGrayscalePlanes()) {
+    return;
+  }
+
+  display.displayGrayBuffer(fadingFix);
+  refreshCount++;
+  // RED RAM now holds the MSB plane; restore the BW baseline for the next differential refresh
+  display.cleanupGrayscaleBuffers(display.getFrameBuffer());
+}
+
+void GfxRenderer::restoreGrayscale() {
+  renderMode = BW;
+  if (!writeGrayscalePlanes()) {
+    return;
+  }
+
+  // BW RAM holds the LSB plane and RED RAM the BW baseline, as after displayGrayscale
+  display.cleanupGrayscaleBuffers(display.getFrameBuffer());
+  display.markGrayscaleShown();
+}
 
 void GfxRenderer::freeBwBufferChunks() {
   for (auto& bwBufferChunk : bwBufferChunks) {
@@ -833,8 +1409,9 @@ void GfxRenderer::freeBwBufferChunks() {
 /**
  * This should be called before grayscale buffers are populated.
  * A `restoreBwBuffer` call should always follow the grayscale render if this method was called.
- * Uses chunked allocation to avoid needing 48KB of contiguous memory.
- * Returns true if buffer was stored successfully, false if allocation failed.
+ * The frame is PackBits-compressed into the snapshot pool. A frame that does not compress into the pool (dense
+ * dithered images) is copied into 8KB heap chunks instead, so no large contiguous allocation is needed either way.
+ * Returns true if buffer was stored successfully, false if neither the pool nor the chunk allocations had room.
  */
 bool GfxRenderer::storeBwBuffer() {
   const uint8_t* frameBuffer = display.getFrameBuffer();
@@ -843,78 +1420,65 @@ bool GfxRenderer::storeBwBuffer() {
     return false;
   }
 
-  // Allocate and copy each chunk
-  for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
-    // Check if any chunks are already allocated
-    if (bwBufferChunks[i]) {
-      Serial.printf("[%lu] [GFX] !! BW buffer chunk %zu already stored - this is likely a bug, freeing chunk\n",
-                    millis(), i);
-      free(bwBufferChunks[i]);
-      bwBufferChunks[i] = nullptr;
-    }
+  freeBwBufferChunks();
+  if (snapshots.store(BW_SNAPSHOT_KEY, frameBuffer)) {
+    Serial.printf("[%lu] [GFX] Stored BW buffer (%zu bytes compressed)\n", millis(), snapshots.usedBytes());
+    return true;
+  }
 
-    const size_t offset = i * BW_BUFFER_CHUNK_SIZE;
+  for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
     bwBufferChunks[i] = static_cast<uint8_t*>(malloc(BW_BUFFER_CHUNK_SIZE));
-
     if (!bwBufferChunks[i]) {
-      Serial.printf("[%lu] [GFX] !! Failed to allocate BW buffer chunk %zu (%zu bytes)\n", millis(), i,
+      Serial.printf("[%lu] [GFX] !! Failed to store BW buffer (chunk %zu of %zu bytes)\n", millis(), i,
                     BW_BUFFER_CHUNK_SIZE);
-      // Free previously allocated chunks
       freeBwBufferChunks();
       return false;
     }
-
-    memcpy(bwBufferChunks[i], frameBuffer + offset, BW_BUFFER_CHUNK_SIZE);
+    memcpy(bwBufferChunks[i], frameBuffer + i * BW_BUFFER_CHUNK_SIZE, BW_BUFFER_CHUNK_SIZE);
   }
 
-  Serial.printf("[%lu] [GFX] Stored BW buffer in %zu chunks (%zu bytes each)\n", millis(), BW_BUFFER_NUM_CHUNKS,
-                BW_BUFFER_CHUNK_SIZE);
+  Serial.printf("[%lu] [GFX] Stored BW buffer in %zu chunks (does not compress)\n", millis(), BW_BUFFER_NUM_CHUNKS);
   return true;
 }
 
 /**
  * This can only be called if `storeBwBuffer` was called prior to the grayscale render.
  * It should be called to restore the BW buffer state after grayscale rendering is complete.
- * Uses chunked restoration to match chunked storage.
  */
 void GfxRenderer::restoreBwBuffer() {
-  // Check if any all chunks are allocated
-  bool missingChunks = false;
-  for (const auto& bwBufferChunk : bwBufferChunks) {
-    if (!bwBufferChunk) {
-      missingChunks = true;
-      break;
-    }
-  }
-
-  if (missingChunks) {
-    freeBwBufferChunks();
-    return;
-  }
-
   uint8_t* frameBuffer = display.getFrameBuffer();
   if (!frameBuffer) {
     Serial.printf("[%lu] [GFX] !! No framebuffer in restoreBwBuffer\n", millis());
+    snapshots.remove(BW_SNAPSHOT_KEY);
     freeBwBufferChunks();
     return;
   }
 
-  for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
-    // Check if chunk is missing
-    if (!bwBufferChunks[i]) {
-      Serial.printf("[%lu] [GFX] !! BW buffer chunks not stored - this is likely a bug\n", millis());
-      freeBwBufferChunks();
-      return;
+  if (bwBufferChunks[0]) {
+    for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
+      memcpy(frameBuffer + i * BW_BUFFER_CHUNK_SIZE, bwBufferChunks[i], BW_BUFFER_CHUNK_SIZE);
     }
-
-    const size_t offset = i * BW_BUFFER_CHUNK_SIZE;
-    memcpy(frameBuffer + offset, bwBufferChunks[i], BW_BUFFER_CHUNK_SIZE);
+    freeBwBufferChunks();
+    snapshots.remove(BW_SNAPSHOT_KEY);
+  } else if (snapshots.restore(BW_SNAPSHOT_KEY, frameBuffer)) {
+    snapshots.remove(BW_SNAPSHOT_KEY);
+  } else {
+    Serial.printf("[%lu] [GFX] !! BW buffer not stored - this is likely a bug\n", millis());
+    return;
   }
 
   display.cleanupGrayscaleBuffers(frameBuffer);
+  Serial.printf("[%lu] [GFX] Restored BW buffer\n", millis());
+}
 
-  freeBwBufferChunks();
-  Serial.printf("[%lu] [GFX] Restored and freed BW buffer chunks\n", millis());
+bool GfxRenderer::storeScreen(const uint32_t key) {
+  if (key == BW_SNAPSHOT_KEY) return false;
+  return snapshots.store(key, display.getFrameBuffer());
+}
+
+bool GfxRenderer::restoreScreen(const uint32_t key) {
+  if (key == BW_SNAPSHOT_KEY) return false;
+  return snapshots.restore(key, display.getFrameBuffer());
 }
 
 /**
@@ -942,15 +1506,21 @@ void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, const uint32_t cp,
   }
 
   const int is2Bit = fontFamily.getData(style)->is2Bit;
-  const uint32_t offset = glyph->dataOffset;
   const uint8_t width = glyph->width;
   const uint8_t height = glyph->height;
   const int left = glyph->left;
 
-  const uint8_t* bitmap = nullptr;
-  bitmap = &fontFamily.getData(style)->bitmap[offset];
-
-  if (bitmap != nullptr) {
+  const uint8_t* bitmap = fontFamily.getGlyphBitmap(glyph, style);
+  // GRAYSCALE: the glyph is drawn in BW below and, if anti-aliased, recorded for the gray planes from the same
+  // placement. Recorded bitmaps are read at compose time, so glyphs of streamed fonts (cache-backed, not
+  // stable) only get their BW rendering.
+  if (renderMode == GRAYSCALE && bitmap && is2Bit && width > 0 && height > 0 &&
+      fontFamily.hasResidentBitmaps(style)) {
+    recordGrayscaleGlyph(bitmap, *x + left, *y - glyph->top, width, height);
+  }
+  if (bitmap != nullptr && !is2Bit && fontFamily.getData(style)->rowAligned) {
+    blitGlyph1Bit(bitmap, width, height, *x + left, *y - glyph->top, 1, 0, 0, 1, pixelState);
+  } else if (bitmap != nullptr) {
     for (int glyphY = 0; glyphY < height; glyphY++) {
       const int screenY = *y - glyph->top + glyphY;
       for (int glyphX = 0; glyphX < width; glyphX++) {
@@ -965,8 +1535,8 @@ void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, const uint32_t cp,
           // 0 -> black, 1 -> dark grey, 2 -> light grey, 3 -> white
           const uint8_t bmpVal = 3 - ((byte >> bit_index) & 0x3);
 
-          if (renderMode == BW && bmpVal < 3) {
-            // Black (also paints over the grays in BW mode)
+          if ((renderMode == BW || renderMode == GRAYSCALE) && bmpVal < 3) {
+            // Black (also paints over the grays in BW mode; GRAYSCALE adds them back from the recorded glyph)
             drawPixel(screenX, screenY, pixelState);
           } else if (renderMode == GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
             // Light gray (also mark the MSB if it's going to be a dark gray too)
@@ -4,8 +4,11 @@
 #include <HalDisplay.h>
 
 #include <map>
+#include <vector>
 
 #include "Bitmap.h"
+#include "FrameSnapshot.h"
+#include "GlyphRunCache.h"
 
 // Color representation: uint8_t mapped to 4x4 Bayer matrix dithering levels
 // 0 = transparent, 1-16 = gray levels (white to black)
@@ -13,7 +16,9 @@ enum Color : uint8_t { Clear = 0x00, White = 0x01, LightGray = 0x05, DarkGray =
 
 class GfxRenderer {
  public:
-  enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB };
+  // GRAYSCALE draws like BW and also records 2-bit glyphs, so one pass yields the BW frame and both gray planes
+  // (see displayGrayscale)
+  enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB, GRAYSCALE };
 
   // Logical screen orientation from the perspective of callers
   enum Orientation {
@@ -24,28 +29,62 @@ class GfxRenderer {
   };
 
  private:
-  static constexpr size_t BW_BUFFER_CHUNK_SIZE = 8000;  // 8KB chunks to allow for non-contiguous memory
+  static constexpr uint32_t BW_SNAPSHOT_KEY = 0xFFFFFFFF;  // Reserved snapshot id for storeBwBuffer
+  static constexpr size_t BW_BUFFER_CHUNK_SIZE = 8000;  // Fallback copy in 8KB chunks, no 48KB contiguous block
   static constexpr size_t BW_BUFFER_NUM_CHUNKS = HalDisplay::BUFFER_SIZE / BW_BUFFER_CHUNK_SIZE;
   static_assert(BW_BUFFER_CHUNK_SIZE * BW_BUFFER_NUM_CHUNKS == HalDisplay::BUFFER_SIZE,
                 "BW buffer chunking does not line up with display buffer size");
+  static constexpr int MAX_QUEUED_REGIONS = 4;     // Pending partial refresh windows before they are coalesced
+  static constexpr int GRAYSCALE_BAND_ROWS = 40;  // Panel rows composed per band (2 x 4KB plane buffers)
+
+  // 2-bit glyph placed while in GRAYSCALE mode, rasterized later band by band
+  struct GrayscaleGlyph {
+    const uint8_t* bitmap;
+    int16_t x;  // Logical top-left of the glyph bitmap
+    int16_t y;
+    uint8_t width;
+    uint8_t height;
+    int16_t panelTop;  // Panel row span covered by the glyph (inclusive), used to skip bands
+    int16_t panelBottom;
+  };
+
+  // Byte-aligned rectangle in panel coordinates
+  struct PanelRect {
+    int16_t x;
+    int16_t y;
+    int16_t width;
+    int16_t height;
+  };
 
   HalDisplay& display;
   RenderMode renderMode;
   Orientation orientation;
   bool fadingFix;
-  uint8_t* bwBufferChunks[BW_BUFFER_NUM_CHUNKS] = {nullptr};
+  FrameSnapshotPool snapshots;
+  uint8_t* bwBufferChunks[BW_BUFFER_NUM_CHUNKS] = {nullptr};  // Used when the frame does not fit in snapshots
+  mutable GlyphRunCache glyphRuns;
   std::map<int, EpdFontFamily> fontMap;
+  mutable std::vector<GrayscaleGlyph> grayscaleGlyphs;
+  PanelRect queuedRegions[MAX_QUEUED_REGIONS] = {};
+  int queuedRegionCount = 0;
+  mutable uint32_t refreshCount = 0;
   void renderChar(const EpdFontFamily& fontFamily, uint32_t cp, int* x, const int* y, bool pixelState,
                   EpdFontFamily::Style style) const;
   void freeBwBufferChunks();
   void rotateCoordinates(int x, int y, int* rotatedX, int* rotatedY) const;
+  void blitGlyph1Bit(const uint8_t* bitmap, int width, int height, int x, int y, int colDx, int colDy, int rowDx,
+                     int rowDy, bool state) const;
+  bool renderGlyphRun(const EpdFontFamily& font, const GlyphRunCache::Key& key, GlyphRunCache::Strip* strip) const;
   void drawPixelDither(int x, int y, Color color) const;
   void fillArc(int maxRadius, int cx, int cy, int xDir, int yDir, Color color) const;
+  void recordGrayscaleGlyph(const uint8_t* bitmap, int x, int y, int width, int height) const;
+  void rasterizeGrayscaleGlyph(const GrayscaleGlyph& glyph, int bandY, int bandHeight, uint8_t* lsbBand,
+                               uint8_t* msbBand) const;
+  bool writeGrayscalePlanes();
 
  public:
   explicit GfxRenderer(HalDisplay& halDisplay)
       : display(halDisplay), renderMode(BW), orientation(Portrait), fadingFix(false) {}
-  ~GfxRenderer() { freeBwBufferChunks(); }
 
   static constexpr int VIEWABLE_MARGIN_TOP = 9;
   static constexpr int VIEWABLE_MARGIN_RIGHT = 3;
@@ -53,12 +92,18 @@ class GfxRenderer {
   static constexpr int VIEWABLE_MARGIN_LEFT = 3;
 
   // Setup
-  void insertFont(int fontId, EpdFontFamily font);
+  void insertFont(int fontId, EpdFontFamily font);  // Replaces a font already registered under fontId
 
   // Orientation control (affects logical width/height and coordinate transforms)
-  void setOrientation(const Orientation o) { orientation = o; }
+  void setOrientation(const Orientation o) {
+    if (o != orientation) glyphRuns.clear();  // Strips are stored in panel orientation
+    orientation = o;
+  }
   Orientation getOrientation() const { return orientation; }
 
+  // Dark mode: draw in normal polarity, the display inverts the frame on transfer
+  void setInverted(const bool enabled) { display.setInvertOutput(enabled); }
+
   // Fading fix control
   void setFadingFix(const bool enabled) { fadingFix = enabled; }
 
@@ -66,8 +111,13 @@ class GfxRenderer {
   int getScreenWidth() const;
   int getScreenHeight() const;
   void displayBuffer(HalDisplay::RefreshMode refreshMode = HalDisplay::FAST_REFRESH) const;
-  // EXPERIMENTAL: Windowed update - display only a rectangular region
-  // void displayWindow(int x, int y, int width, int height) const;
+  // Partial refresh of a logical rectangle (rotated to panel space and widened to byte alignment)
+  void displayRegion(int x, int y, int width, int height);
+  void queueRegion(int x, int y, int width, int height);  // Overlapping requests are merged
+  void displayQueuedRegions();
+  // Panel refreshes issued so far. A caller that saved it after its own refresh can tell the panel still shows
+  // that frame, and that refreshing only the regions it changed since is enough.
+  uint32_t getRefreshCount() const { return refreshCount; }
   void invertScreen() const;
   void clearScreen(uint8_t color = 0xFF) const;
 
@@ -100,12 +150,32 @@ class GfxRenderer {
   void drawText(int fontId, int x, int y, const char* text, bool black = true,
                 EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   int getSpaceWidth(int fontId) const;
-  int getTextAdvanceX(int fontId, const char* text) const;
+  const EpdFontMetrics* getFontMetrics(int fontId) const;  // Regular style, nullptr if the font is not registered
+  int getTextAdvanceX(int fontId, const char* text, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   int getFontAscenderSize(int fontId) const;
   int getLineHeight(int fontId) const;
   std::string truncatedText(int fontId, const char* text, int maxWidth,
                             EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
 
+  // Batch measurement for list layout: one font lookup for all items and a single UTF-8 pass per item.
+  // Results follow truncatedText exactly, so drawMeasuredText draws the same string it would return.
+  struct TextMeasurement {
+    const char* text;  // In
+    int maxWidth;      // In
+    int width;         // Out: width of the string that will be drawn
+    size_t fitBytes;   // Out: bytes of text drawn (before the "..." when truncated)
+    bool truncated;    // Out
+  };
+  void measureTexts(int fontId, TextMeasurement* items, int count,
+                    EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
+  void drawMeasuredText(int fontId, int x, int y, const TextMeasurement& item, bool black = true,
+                        EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
+
+  // Text whose storage and content never change (string literals, static tables): the string is rendered once
+  // into a GlyphRunCache strip and later draws copy the strip. Clipped to maxWidth like truncatedText.
+  void drawStaticText(int fontId, int x, int y, const char* text, int maxWidth, bool black = true,
+                      EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
+
   // Helper for drawing rotated text (90 degrees clockwise, for side buttons)
   void drawTextRotated90CW(int fontId, int x, int y, const char* text, bool black = true,
                            EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
@@ -116,10 +186,19 @@ class GfxRenderer {
   void copyGrayscaleLsbBuffers() const;
   void copyGrayscaleMsbBuffers() const;
   void displayGrayBuffer() const;
-  bool storeBwBuffer();    // Returns true if buffer was stored successfully
+  void displayGrayscale();
+  // Like displayGrayscale without the refresh, for a panel that still shows the recorded glyphs in gray (resume
+  // from deep sleep): the controller RAM is left as displayGrayscale leaves it, so the next refresh reverts them
+  void restoreGrayscale();
+  bool storeBwBuffer();    // Returns true if buffer was stored (compressed, or copied if it does not compress)
   void restoreBwBuffer();  // Restore and free the stored buffer
   void cleanupGrayscaleWithFrameBuffer() const;
 
+  // Screen cache: compressed copies of whole frames, keyed by the caller (any key except 0xFFFFFFFF)
+  bool storeScreen(uint32_t key);
+  bool restoreScreen(uint32_t key);  // Returns false if the screen is not cached; frame buffer is left untouched
+  void invalidateScreens() { snapshots.clear(); }
+
   // Low level functions
   uint8_t* getFrameBuffer() const;
   static size_t getBufferSize();
@@ -0,0 +1,111 @@
+#include "GlyphRunCache.h"
+
+#include <Arduino.h>
+
+#include <cstdlib>
+#include <cstring>
+
+GlyphRunCache::~GlyphRunCache() { free(pool); }
+
+uint32_t GlyphRunCache::hashText(const char* text) {
+  // FNV-1a
+  uint32_t hash = 2166136261u;
+  for (const char* p = text; *p; p++) {
+    hash = (hash ^ static_cast<uint8_t>(*p)) * 16777619u;
+  }
+  return hash;
+}
+
+int GlyphRunCache::find(const Key& key) const {
+  for (int i = 0; i < entryCount; i++) {
+    const Key& k = entries[i].key;
+    if (k.text == key.text && k.fontId == key.fontId && k.style == key.style) return i;
+  }
+  return -1;
+}
+
+bool GlyphRunCache::find(const Key& key, Strip* strip) {
+  const int index = find(key);
+  if (index < 0) return false;
+
+  Entry& entry = entries[index];
+  if (entry.key.hash != key.hash) {
+    // Same buffer, different text
+    removeAt(index);
+    return false;
+  }
+
+  entry.lastUse = ++useCounter;
+  *strip = {pool + entry.offset, entry.offsetX, entry.offsetY, entry.width, entry.height, entry.textWidth};
+  return true;
+}
+
+void GlyphRunCache::removeAt(const int index) {
+  const Entry removed = entries[index];
+
+  // Keep the pool contiguous so new strips always go at the end
+  memmove(pool + removed.offset, pool + removed.offset + removed.size, used - removed.offset - removed.size);
+  used -= removed.size;
+
+  entries[index] = entries[--entryCount];
+  for (int i = 0; i < entryCount; i++) {
+    if (entries[i].offset > removed.offset) entries[i].offset -= removed.size;
+  }
+}
+
+bool GlyphRunCache::evictLeastRecentlyUsed() {
+  if (entryCount == 0) return false;
+
+  int oldest = 0;
+  for (int i = 1; i < entryCount; i++) {
+    if (entries[i].lastUse < entries[oldest].lastUse) oldest = i;
+  }
+  removeAt(oldest);
+  return true;
+}
+
+uint8_t* GlyphRunCache::insert(const Key& key, const int offsetX, const int offsetY, const int width, const int height,
+                               const int textWidth) {
+  const size_t size = static_cast<size_t>((width + 7) / 8) * height;
+  if (size > POOL_SIZE) return nullptr;
+
+  if (!pool) {
+    pool = static_cast<uint8_t*>(malloc(POOL_SIZE));
+    if (!pool) {
+      Serial.printf("[%lu] [GRUN] !! Failed to allocate glyph run pool (%zu bytes)\n", millis(), POOL_SIZE);
+      return nullptr;
+    }
+  }
+
+  const int existing = find(key);
+  if (existing >= 0) removeAt(existing);
+  while (entryCount == MAX_STRIPS || used + size > POOL_SIZE) {
+    evictLeastRecentlyUsed();
+  }
+
+  Entry& entry = entries[entryCount++];
+  entry.key = key;
+  entry.lastUse = ++useCounter;
+  entry.offset = used;
+  entry.size = size;
+  entry.offsetX = static_cast<int16_t>(offsetX);
+  entry.offsetY = static_cast<int16_t>(offsetY);
+  entry.width = static_cast<uint16_t>(width);
+  entry.height = static_cast<uint16_t>(height);
+  entry.textWidth = static_cast<int16_t>(textWidth);
+  used += size;
+
+  memset(pool + entry.offset, 0, size);
+  return pool + entry.offset;
+}
+
+void GlyphRunCache::removeFont(const int fontId) {
+  for (int i = entryCount - 1; i >= 0; i--) {
+    if (entries[i].key.fontId == fontId) removeAt(i);
+  }
+}
+
+void GlyphRunCache::clear() {
+  entryCount = 0;
+  used = 0;
+}
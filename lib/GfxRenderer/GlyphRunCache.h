@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Pre-rendered strips for text that never changes (screen titles, footer hints, menu labels).
+// A strip is the 1-bit ink mask of a whole string in panel orientation, so drawing a cached label is a shifted
+// row copy into the frame buffer, whatever the screen orientation. Strips are keyed by font, style and the
+// address of the string; a hash of its content guards against a buffer that was reused for other text.
+// The pool memory is allocated on first use; when it runs out, the least recently used strip is evicted.
+class GlyphRunCache {
+ public:
+  static constexpr size_t POOL_SIZE = 8 * 1024;
+  static constexpr int MAX_STRIPS = 32;
+
+  struct Key {
+    const char* text;
+    uint32_t hash;  // hashText(text)
+    int fontId;
+    uint8_t style;
+  };
+
+  // `height` panel rows of (width + 7) / 8 bytes, MSB first, padding bits zero. (offsetX, offsetY) is the panel
+  // position of the first bit relative to the panel position of the text origin (left edge, baseline).
+  struct Strip {
+    const uint8_t* bits;  // Valid until the next insert
+    int16_t offsetX;
+    int16_t offsetY;
+    uint16_t width;
+    uint16_t height;
+    int16_t textWidth;  // Logical width as measured by getTextWidth, for clipping decisions
+  };
+
+  GlyphRunCache() = default;
+  ~GlyphRunCache();
+  GlyphRunCache(const GlyphRunCache& other) = delete;
+  GlyphRunCache& operator=(const GlyphRunCache& other) = delete;
+
+  static uint32_t hashText(const char* text);
+
+  bool find(const Key& key, Strip* strip);
+  // Reserves a zeroed strip for `key`, replacing any previous one. Returns nullptr if it can never fit.
+  uint8_t* insert(const Key& key, int offsetX, int offsetY, int width, int height, int textWidth);
+  void removeFont(int fontId);  // Strips of a font slot whose font was replaced
+  void clear();
+  size_t usedBytes() const { return used; }
+
+ private:
+  struct Entry {
+    Key key;
+    uint32_t lastUse;
+    size_t offset;  // Start of the strip within the pool
+    size_t size;
+    int16_t offsetX;
+    int16_t offsetY;
+    uint16_t width;
+    uint16_t height;
+    int16_t textWidth;
+  };
+
+  uint8_t* pool = nullptr;
+  Entry entries[MAX_STRIPS] = {};
+  int entryCount = 0;
+  size_t used = 0;
+  uint32_t useCounter = 0;
+
+  int find(const Key& key) const;  // Matches the address, font and style; the hash is checked by the caller
+  void removeAt(int index);
+  bool evictLeastRecentlyUsed();
+};
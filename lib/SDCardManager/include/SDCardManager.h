@@ -4,14 +4,42 @@
 #include <vector>
 #include <string>
 #include <SdFat.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
 
 class SDCardManager {
  public:
   SDCardManager();
   bool begin();
   bool ready() const;
-  // Release the SPI bus to save power. Next access auto-reinitializes.
+  // Done with the card for now. It is released (and reinitialized on the next access) once it has been idle for
+  // the idle timeout, so a burst of operations pays for one initialization. Inside a session: at its end.
   void sleep();
+  // Release right away, e.g. before deep sleep. No effect inside a session.
+  void sleepNow();
+  // Main loop: release the card when the idle timeout has passed
+  void loop();
+  void setIdleTimeout(uint32_t ms) { idleTimeoutMs = ms; }
+
+  // Sessions keep the card initialized from begin to end, whatever sleep() calls happen in between, for work made of
+  // several operations or done with FsFile handles. They nest and may be used from any task. Beginning a session
+  // does not touch the card: it is initialized by the first access.
+  void beginSession();
+  void endSession();
+
+  // The SPI bus is shared with the display (SPI_MISO included). The card holds this lock while it initializes and
+  // the display while it uploads a frame, so neither sequence is cut in two by the other. Recursive.
+  void lockBus();
+  void unlockBus();
+
+  struct Stats {
+    uint32_t initCount;     // Card initializations (sd.begin)
+    uint32_t initFailures;
+    uint32_t initMillis;    // Time spent in them
+    uint32_t releaseCount;
+  };
+  const Stats& stats() const { return counters; }
+
   std::vector<String> listFiles(const char* path = "/", int maxFiles = 200);
   // Read the entire file at `path` into a String. Returns empty string on failure.
   String readFile(const char* path);
@@ -48,8 +76,15 @@ class SDCardManager {
   static SDCardManager instance;
 
   bool ensureReady();
-  bool initialized = false;
+  void release();
+  volatile bool initialized = false;
   bool hasCard = false;  // true after first successful begin() — distinguishes sleep from no card
+  volatile uint32_t sessionDepth = 0;
+  volatile bool releasePending = false;  // sleep() was called, release once idle
+  volatile unsigned long lastUseMs = 0;
+  uint32_t idleTimeoutMs = 0;            // 0 = release on sleep()
+  Stats counters = {};
+  SemaphoreHandle_t busMutex = nullptr;
   SdFat sd;
 };
 
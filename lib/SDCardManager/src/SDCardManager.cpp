@@ -10,14 +10,24 @@ SDCardManager SDCardManager::instance;
 SDCardManager::SDCardManager() : sd() {}
 
 bool SDCardManager::begin() {
-  if (!sd.begin(SD_CS, SPI_FQ)) {
+  if (!busMutex) busMutex = xSemaphoreCreateRecursiveMutex();
+
+  lockBus();
+  const unsigned long start = millis();
+  const bool ok = sd.begin(SD_CS, SPI_FQ);
+  counters.initCount++;
+  counters.initMillis += millis() - start;
+  if (!ok) {
+    counters.initFailures++;
     if (Serial) Serial.printf("[%lu] [SD] SD card not detected\n", millis());
     initialized = false;
   } else {
-    if (Serial) Serial.printf("[%lu] [SD] SD card detected\n", millis());
+    if (Serial) Serial.printf("[%lu] [SD] SD card detected (%lu ms)\n", millis(), millis() - start);
     initialized = true;
     hasCard = true;
   }
+  lastUseMs = millis();
+  unlockBus();
 
   return initialized;
 }
@@ -28,16 +38,61 @@ bool SDCardManager::ready() const {
 
 void SDCardManager::sleep() {
   if (!initialized) return;
-  // Mark as sleeping — SD card enters standby naturally when CS is deasserted.
-  // Cannot call SPI.end() because the display shares the same SPI bus.
-  // ensureReady() will re-init the SD card on next access.
-  initialized = false;
+  lastUseMs = millis();
+  releasePending = true;
+  if (idleTimeoutMs == 0) release();
+}
+
+void SDCardManager::sleepNow() {
+  if (initialized) release();
+}
+
+void SDCardManager::loop() {
+  if (initialized && releasePending && sessionDepth == 0 && millis() - lastUseMs >= idleTimeoutMs) release();
+}
+
+void SDCardManager::release() {
+  lockBus();
+  if (initialized && sessionDepth == 0) {
+    // Mark as sleeping — SD card enters standby naturally when CS is deasserted.
+    // Cannot call SPI.end() because the display shares the same SPI bus.
+    // ensureReady() will re-init the SD card on next access.
+    initialized = false;
+    releasePending = false;
+    counters.releaseCount++;
+  }
+  unlockBus();
+}
+
+void SDCardManager::beginSession() {
+  lockBus();
+  sessionDepth++;
+  unlockBus();
+}
+
+void SDCardManager::endSession() {
+  lockBus();
+  if (sessionDepth > 0) sessionDepth--;
+  lastUseMs = millis();
+  unlockBus();
+}
+
+void SDCardManager::lockBus() {
+  if (busMutex) xSemaphoreTakeRecursive(busMutex, portMAX_DELAY);
+}
+
+void SDCardManager::unlockBus() {
+  if (busMutex) xSemaphoreGiveRecursive(busMutex);
 }
 
 bool SDCardManager::ensureReady() {
+  lastUseMs = millis();
   if (initialized) return true;
   if (!hasCard) return false;  // No card was ever detected — don't retry
-  return begin();
+  lockBus();
+  const bool ok = initialized || begin();  // Another task may have initialized it while this one waited
+  unlockBus();
+  return ok;
 }
 
 std::vector<String> SDCardManager::listFiles(const char* path, const int maxFiles) {
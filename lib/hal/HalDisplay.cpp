@@ -32,10 +32,22 @@ void HalDisplay::displayBuffer(HalDisplay::RefreshMode mode, bool turnOffScreen)
   einkDisplay.displayBuffer(convertRefreshMode(mode), turnOffScreen);
 }
 
+void HalDisplay::displayWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool turnOffScreen) {
+  einkDisplay.displayWindow(x, y, w, h, turnOffScreen);
+}
+
 void HalDisplay::refreshDisplay(HalDisplay::RefreshMode mode, bool turnOffScreen) {
   einkDisplay.refreshDisplay(convertRefreshMode(mode), turnOffScreen);
 }
 
+void HalDisplay::writeBaseline() { einkDisplay.writeBaseline(); }
+
+void HalDisplay::powerOn() { einkDisplay.powerOn(); }
+
+void HalDisplay::setInvertOutput(bool enabled) { einkDisplay.setInvertOutput(enabled); }
+
+void HalDisplay::setBusLock(void (*acquire)(), void (*release)()) { einkDisplay.setBusLock(acquire, release); }
+
 void HalDisplay::deepSleep() { einkDisplay.deepSleep(); }
 
 uint8_t* HalDisplay::getFrameBuffer() const { return einkDisplay.getFrameBuffer(); }
@@ -48,6 +60,12 @@ void HalDisplay::copyGrayscaleLsbBuffers(const uint8_t* lsbBuffer) { einkDisplay
 
 void HalDisplay::copyGrayscaleMsbBuffers(const uint8_t* msbBuffer) { einkDisplay.copyGrayscaleMsbBuffers(msbBuffer); }
 
+void HalDisplay::writeGrayscaleBand(uint16_t y, uint16_t h, const uint8_t* lsbBand, const uint8_t* msbBand) {
+  einkDisplay.writeGrayscaleBand(y, h, lsbBand, msbBand);
+}
+
 void HalDisplay::cleanupGrayscaleBuffers(const uint8_t* bwBuffer) { einkDisplay.cleanupGrayscaleBuffers(bwBuffer); }
 
 void HalDisplay::displayGrayBuffer(bool turnOffScreen) { einkDisplay.displayGrayBuffer(turnOffScreen); }
+
+void HalDisplay::markGrayscaleShown() { einkDisplay.markGrayscaleShown(); }
@@ -32,7 +32,19 @@ class HalDisplay {
                  bool fromProgmem = false) const;
 
   void displayBuffer(RefreshMode mode = RefreshMode::FAST_REFRESH, bool turnOffScreen = false);
+  // Fast refresh of a panel-space window; x and w must be multiples of 8
+  void displayWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool turnOffScreen = false);
   void refreshDisplay(RefreshMode mode = RefreshMode::FAST_REFRESH, bool turnOffScreen = false);
+  // Load the frame buffer into controller RAM as the currently displayed image, without refreshing
+  void writeBaseline();
+  // Power up the panel without refreshing, so the next FAST_REFRESH is differential (see EInkDisplay::powerOn)
+  void powerOn();
+
+  // Dark mode: frame data is inverted while it is sent to the panel
+  void setInvertOutput(bool enabled);
+
+  // Lock held while a frame is uploaded over the SPI bus shared with the SD card
+  void setBusLock(void (*acquire)(), void (*release)());
 
   // Power management
   void deepSleep();
@@ -43,9 +55,11 @@ class HalDisplay {
   void copyGrayscaleBuffers(const uint8_t* lsbBuffer, const uint8_t* msbBuffer);
   void copyGrayscaleLsbBuffers(const uint8_t* lsbBuffer);
   void copyGrayscaleMsbBuffers(const uint8_t* msbBuffer);
+  void writeGrayscaleBand(uint16_t y, uint16_t h, const uint8_t* lsbBand, const uint8_t* msbBand);
   void cleanupGrayscaleBuffers(const uint8_t* bwBuffer);
 
   void displayGrayBuffer(bool turnOffScreen = false);
+  void markGrayscaleShown();
 
  private:
   EInkDisplay einkDisplay;
@@ -0,0 +1,80 @@
+#include "buffer_snapshot.h"
+#include "config.h"
+#include <Arduino.h>
+#include <freertos/semphr.h>
+#include <cstdlib>
+#include <cstring>
+
+static constexpr size_t PAGE_COUNT = (TEXT_BUFFER_SIZE + SNAPSHOT_PAGE_SIZE - 1) / SNAPSHOT_PAGE_SIZE;
+
+static const char* liveBuffer = nullptr;
+static size_t length = 0;
+static bool active = false;
+static bool lost = false;                    // A page could not be preserved
+static size_t pagesRead = 0;                 // The save task reads in order: pages below this are done
+static char* preserved[PAGE_COUNT] = {};     // Original content of pages changed since snapshotBegin
+static SemaphoreHandle_t lock = nullptr;
+
+static void freePages() {
+  for (size_t i = 0; i < PAGE_COUNT; i++) {
+    free(preserved[i]);
+    preserved[i] = nullptr;
+  }
+}
+
+static size_t pageBytes(size_t page) {
+  const size_t start = page * SNAPSHOT_PAGE_SIZE;
+  if (start >= length) return 0;
+  return length - start < SNAPSHOT_PAGE_SIZE ? length - start : SNAPSHOT_PAGE_SIZE;
+}
+
+void snapshotBegin(const char* buf, size_t len) {
+  if (!lock) lock = xSemaphoreCreateMutex();
+  liveBuffer = buf;
+  length = len;
+  pagesRead = 0;
+  lost = false;
+  active = true;
+}
+
+void snapshotEnd() {
+  xSemaphoreTake(lock, portMAX_DELAY);
+  active = false;
+  freePages();
+  xSemaphoreGive(lock);
+}
+
+bool snapshotActive() { return active; }
+size_t snapshotLength() { return length; }
+
+void snapshotPreserve(size_t from) {
+  if (!active || from >= length) return;
+
+  xSemaphoreTake(lock, portMAX_DELAY);
+  size_t first = from / SNAPSHOT_PAGE_SIZE;
+  if (first < pagesRead) first = pagesRead;
+  for (size_t page = first; page * SNAPSHOT_PAGE_SIZE < length && !lost; page++) {
+    if (preserved[page]) continue;
+    preserved[page] = (char*)malloc(SNAPSHOT_PAGE_SIZE);
+    if (!preserved[page]) {
+      DBG_PRINTLN("snapshotPreserve: out of memory, save will be retried");
+      lost = true;
+      break;
+    }
+    memcpy(preserved[page], liveBuffer + page * SNAPSHOT_PAGE_SIZE, pageBytes(page));
+  }
+  xSemaphoreGive(lock);
+}
+
+int snapshotReadPage(size_t page, char* out) {
+  xSemaphoreTake(lock, portMAX_DELAY);
+  int n = lost ? -1 : (int)pageBytes(page);
+  if (n > 0) {
+    memcpy(out, preserved[page] ? preserved[page] : liveBuffer + page * SNAPSHOT_PAGE_SIZE, n);
+    free(preserved[page]);
+    preserved[page] = nullptr;
+    pagesRead = page + 1;
+  }
+  xSemaphoreGive(lock);
+  return n;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+
+// Copy-on-write snapshot of the editor buffer for the background save task.
+// The buffer is split in SNAPSHOT_PAGE_SIZE pages. The save task reads the snapshot page by page straight from the
+// live buffer; before the editor changes bytes the task has not read yet, it preserves the affected pages
+// (snapshotPreserve), so the task still sees the content as it was when the save started. Typing at the end of
+// a note copies one page at most; pages already written out are never copied.
+
+// Main task: freeze buf[0..len) (no snapshot may be active)
+void snapshotBegin(const char* buf, size_t len);
+// Main task: release the preserved pages once the save task is done
+void snapshotEnd();
+bool snapshotActive();
+size_t snapshotLength();
+
+// Editor hook: buf[from..] is about to change
+void snapshotPreserve(size_t from);
+
+// Save task: copy page `page` of the snapshot into out (SNAPSHOT_PAGE_SIZE bytes). Returns the number of bytes,
+// 0 past the end, or -1 if a page could not be preserved (out of memory) and the snapshot is lost.
+int snapshotReadPage(size_t page, char* out);
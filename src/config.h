@@ -12,7 +12,9 @@ enum class UIState {
   NEW_FILE,
   SETTINGS,
   BLUETOOTH_SETTINGS,
-  WIFI_SYNC
+  WIFI_SYNC,
+  SEARCH,
+  HISTORY
 };
 
 // --- Display Orientation ---
@@ -31,6 +33,22 @@ enum class WritingMode : uint8_t {
   PAGINATION = 2    // Page-based display instead of scrolling
 };
 
+// --- Body Font (editor text, see font_registry.h) ---
+enum class BodyFont : uint8_t {
+  NOTOSANS     = 0,
+  BOOKERLY     = 1,
+  OPENDYSLEXIC = 2
+};
+static constexpr int BODY_FONT_COUNT = 3;
+
+// --- File browser sort order (see note_index.h) ---
+enum class NoteSort : uint8_t {
+  RECENT = 0,  // Most recently saved first
+  NAME   = 1,  // Title A-Z
+  SIZE   = 2   // Largest first
+};
+static constexpr int NOTE_SORT_COUNT = 3;
+
 // --- BLE Connection State ---
 enum class BLEState : uint8_t {
   DISCONNECTED,
@@ -46,23 +64,62 @@ struct KeyEvent {
   bool pressed;
 };
 
-// --- File Info ---
+// --- File Info (one note list entry) ---
 static constexpr int MAX_FILENAME_LEN = 64;
 static constexpr int MAX_TITLE_LEN = 40;
 
 struct FileInfo {
   char filename[MAX_FILENAME_LEN];
   char title[MAX_TITLE_LEN];
-  unsigned long modTime;
+  unsigned long modTime;  // Save counter (no clock on the device), higher is more recent
+  uint32_t size;
+  uint32_t crc;           // CRC32 of the file content
+};
+
+// --- Full-text search hit (see search_index.h) ---
+struct SearchHit {
+  char filename[MAX_FILENAME_LEN];
+  uint16_t offset;  // First match in the note
+};
+
+// --- Note version (see note_history.h) ---
+struct HistoryVersion {
+  uint32_t number;  // Counts the note's saves, higher is more recent
+  uint32_t length;
+  uint32_t stored;  // Bytes the version takes in the history
 };
 
 // --- Auto-save timing ---
 static constexpr unsigned long AUTO_SAVE_IDLE_MS = 10000;    // Save after 10s of no keystrokes
 static constexpr unsigned long AUTO_SAVE_MAX_MS  = 120000;   // Hard cap: save every 2min during continuous typing
 
+// --- SD card ---
+static constexpr uint32_t SD_IDLE_RELEASE_MS = 5000;               // Card kept initialized this long after use
+
+// --- Edit journal (see edit_journal.h) ---
+static constexpr size_t JOURNAL_RAM_SIZE = 4096;                   // Edits held between autosaves
+static constexpr size_t JOURNAL_MAX_BYTES = 16384;                 // Larger journals are compacted into the note
+static constexpr unsigned long JOURNAL_COMPACT_IDLE_MS = 60000;    // Compact after 1min without keystrokes
+
+// --- Background save (see buffer_snapshot.h) ---
+static constexpr size_t SNAPSHOT_PAGE_SIZE = 512;                  // Copy-on-write granularity, one SD sector
+static constexpr size_t SAVE_STAGING_SIZE = 4096;                  // Sectors sent to the card per write
+static constexpr uint32_t SAVE_TASK_STACK = 6144;                  // Also runs the search indexer
+static_assert(SAVE_STAGING_SIZE % SNAPSHOT_PAGE_SIZE == 0, "Staging holds whole snapshot pages");
+
+// --- Full-text search (see search_index.h) ---
+static constexpr int SEARCH_MAX_HITS = 50;
+static constexpr int SEARCH_QUERY_LEN = 40;
+static constexpr size_t SEARCH_BUFFER_SIZE = 4096;                 // Postings collected before they go to the card
+static constexpr uint32_t SEARCH_COMPACT_MIN_BYTES = 32768;        // Stale postings tolerated before compaction
+
+// --- Version history (see note_history.h) ---
+static constexpr int HISTORY_MAX_VERSIONS = 32;                    // Per note
+static constexpr uint32_t HISTORY_BUDGET_BYTES = 32768;            // Per note; the newest version is always kept
+
 // --- Buffer/Queue Sizes ---
 static constexpr size_t TEXT_BUFFER_SIZE = 16384;
-static constexpr int MAX_FILES = 50;
+static constexpr int FILE_WINDOW_SIZE = 32;   // Note list entries held in RAM (one browser page)
 static constexpr int INPUT_QUEUE_SIZE = 50;
 static constexpr int MAX_LINES = 1024;
 
@@ -75,6 +132,8 @@ static constexpr int MAX_LINES = 1024;
 static constexpr uint8_t HID_KEY_A          = 0x04;
 static constexpr uint8_t HID_KEY_B          = 0x05;
 static constexpr uint8_t HID_KEY_D          = 0x07;
+static constexpr uint8_t HID_KEY_F          = 0x09;
+static constexpr uint8_t HID_KEY_H          = 0x0B;
 static constexpr uint8_t HID_KEY_N          = 0x11;
 static constexpr uint8_t HID_KEY_P          = 0x13;
 static constexpr uint8_t HID_KEY_Q          = 0x14;
@@ -0,0 +1,314 @@
+#include "edit_journal.h"
+#include "config.h"
+#include "recovery_log.h"
+#include <Arduino.h>
+#include <SDCardManager.h>
+#include <esp_rom_crc.h>
+#include <cstring>
+
+static constexpr uint32_t JOURNAL_MAGIC = 0x314A534D;  // "MSJ1"
+static constexpr uint8_t OP_INSERT = 1;
+static constexpr uint8_t OP_DELETE = 2;
+
+struct JournalHeader {
+  uint32_t magic;
+  uint32_t baseLength;
+  uint32_t baseCrc;
+  uint32_t reserved;
+};
+
+struct JournalRecord {
+  uint32_t seq;
+  uint32_t pos;
+  uint16_t len;
+  uint8_t op;
+  uint8_t reserved;
+};
+static_assert(sizeof(JournalHeader) == 16, "Journal header layout");
+static_assert(sizeof(JournalRecord) == 12, "Journal record layout");
+
+// --- Edits not yet flushed: [op][pos (u32)][len (u16)][text for inserts] each, in order ---
+static constexpr size_t PENDING_HEADER = 7;
+static uint8_t pending[JOURNAL_RAM_SIZE];
+static size_t pendingLen = 0;
+static size_t lastRecord = 0;       // Offset of the newest record (only valid if pendingLen > 0)
+static bool pendingOverflow = false;
+
+// --- Journal on disk for the current note ---
+static uint32_t baseLength = 0;
+static uint32_t baseCrc = 0;
+static uint32_t nextSeq = 1;
+static size_t diskBytes = 0;        // 0 = no journal file yet
+
+static void journalPath(const char* path, char* out, size_t outLen) {
+  snprintf(out, outLen, "%s.jnl", path);
+}
+
+static const char* noteName(const char* path) {
+  const char* slash = strrchr(path, '/');
+  return slash ? slash + 1 : path;
+}
+
+static uint32_t readU32(const uint8_t* p) { uint32_t v; memcpy(&v, p, 4); return v; }
+static uint16_t readU16(const uint8_t* p) { uint16_t v; memcpy(&v, p, 2); return v; }
+static void writeU32(uint8_t* p, uint32_t v) { memcpy(p, &v, 4); }
+static void writeU16(uint8_t* p, uint16_t v) { memcpy(p, &v, 2); }
+
+static uint32_t recordCrc(const JournalRecord& record, const char* text) {
+  uint32_t crc = esp_rom_crc32_le(0, (const uint8_t*)&record, sizeof(record));
+  if (record.op == OP_INSERT) crc = esp_rom_crc32_le(crc, (const uint8_t*)text, record.len);
+  return crc;
+}
+
+// Deletes carry no text, so only inserts take `len` bytes of the log
+static uint8_t* appendPending(uint8_t op, int pos, int len) {
+  const size_t textLen = op == OP_INSERT ? (size_t)len : 0;
+  if (pendingOverflow || pendingLen + PENDING_HEADER + textLen > sizeof(pending)) {
+    pendingOverflow = true;
+    return nullptr;
+  }
+  uint8_t* rec = pending + pendingLen;
+  rec[0] = op;
+  writeU32(rec + 1, (uint32_t)pos);
+  writeU16(rec + 5, (uint16_t)len);
+  lastRecord = pendingLen;
+  pendingLen += PENDING_HEADER + textLen;
+  return rec + PENDING_HEADER;
+}
+
+void journalRecordInsert(int pos, char c) {
+  if (pendingOverflow) return;
+
+  if (pendingLen > 0) {
+    uint8_t* last = pending + lastRecord;
+    uint32_t lastPos = readU32(last + 1);
+    uint16_t lastLen = readU16(last + 5);
+    // Typing continues the previous insert
+    if (last[0] == OP_INSERT && (uint32_t)pos == lastPos + lastLen && lastLen < UINT16_MAX &&
+        pendingLen < sizeof(pending)) {
+      pending[pendingLen++] = (uint8_t)c;
+      writeU16(last + 5, lastLen + 1);
+      return;
+    }
+  }
+
+  uint8_t* text = appendPending(OP_INSERT, pos, 1);
+  if (text) text[0] = (uint8_t)c;
+}
+
+void journalRecordDelete(int pos, int len) {
+  if (pendingOverflow || len <= 0) return;
+
+  if (pendingLen > 0) {
+    uint8_t* last = pending + lastRecord;
+    uint32_t lastPos = readU32(last + 1);
+    uint16_t lastLen = readU16(last + 5);
+
+    // Backspace over text typed since the last flush: drop it from the insert instead
+    if (last[0] == OP_INSERT && len == 1 && lastLen > 0 && (uint32_t)pos == lastPos + lastLen - 1) {
+      pendingLen--;
+      if (--lastLen == 0) {
+        pendingLen = lastRecord;
+        // The record before it becomes the newest one again; find it by walking from the start
+        size_t offset = 0;
+        lastRecord = 0;
+        while (offset < pendingLen) {
+          lastRecord = offset;
+          offset += PENDING_HEADER + (pending[offset] == OP_INSERT ? readU16(pending + offset + 5) : 0);
+        }
+      } else {
+        writeU16(last + 5, lastLen);
+      }
+      return;
+    }
+
+    if (last[0] == OP_DELETE && lastLen + len <= UINT16_MAX) {
+      if ((uint32_t)(pos + len) == lastPos) {  // Backspace run
+        writeU32(last + 1, (uint32_t)pos);
+        writeU16(last + 5, lastLen + len);
+        return;
+      }
+      if ((uint32_t)pos == lastPos) {  // Delete-key run
+        writeU16(last + 5, lastLen + len);
+        return;
+      }
+    }
+  }
+
+  appendPending(OP_DELETE, pos, len);
+}
+
+void journalReset(const char* buf, size_t len) {
+  pendingLen = 0;
+  lastRecord = 0;
+  pendingOverflow = false;
+  baseLength = (uint32_t)len;
+  baseCrc = esp_rom_crc32_le(0, (const uint8_t*)buf, len);
+  nextSeq = 1;
+  diskBytes = 0;
+}
+
+void journalDiscardPending() {
+  pendingLen = 0;
+  lastRecord = 0;
+  pendingOverflow = false;
+}
+
+void journalBeginSave() { journalDiscardPending(); }
+
+void journalEndSave(bool saved, size_t len, uint32_t crc) {
+  if (!saved) {
+    // The dropped edits are only in the editor buffer now; the journal on disk still matches the old note
+    pendingOverflow = true;
+    return;
+  }
+  baseLength = (uint32_t)len;
+  baseCrc = crc;
+  nextSeq = 1;
+  diskBytes = 0;
+}
+
+bool journalHasPendingEdits() { return pendingLen > 0 || pendingOverflow; }
+size_t journalDiskBytes() { return diskBytes; }
+
+bool journalFlush(const char* path) {
+  if (pendingOverflow) return false;
+  if (pendingLen == 0) return true;
+
+  // Each pending record grows by the seq and CRC fields on disk
+  size_t recordCount = 0;
+  for (size_t offset = 0; offset < pendingLen; recordCount++) {
+    offset += PENDING_HEADER + (pending[offset] == OP_INSERT ? readU16(pending + offset + 5) : 0);
+  }
+  const size_t appendBytes = pendingLen + recordCount * (sizeof(JournalRecord) + 4 - PENDING_HEADER);
+  const size_t headerBytes = diskBytes == 0 ? sizeof(JournalHeader) : 0;
+  if (diskBytes + headerBytes + appendBytes > JOURNAL_MAX_BYTES) return false;
+
+  char jnlPath[336];
+  journalPath(path, jnlPath, sizeof(jnlPath));
+  if (diskBytes == 0) recoveryMark(noteName(path), RECOVER_JOURNAL);  // Boot recovery folds it in after a crash
+  auto file = diskBytes == 0 ? SdMan.open(jnlPath, O_WRONLY | O_CREAT | O_TRUNC)
+                             : SdMan.open(jnlPath, O_WRONLY | O_APPEND);
+  if (!file) {
+    DBG_PRINTF("journalFlush: could not open %s\n", jnlPath);
+    return false;
+  }
+
+  bool ok = true;
+  if (headerBytes) {
+    JournalHeader header = {JOURNAL_MAGIC, baseLength, baseCrc, 0};
+    ok = file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+  }
+
+  uint32_t seq = nextSeq;
+  for (size_t offset = 0; ok && offset < pendingLen; seq++) {
+    const uint8_t* rec = pending + offset;
+    JournalRecord record = {};
+    record.seq = seq;
+    record.op = rec[0];
+    record.pos = readU32(rec + 1);
+    record.len = readU16(rec + 5);
+    const char* text = (const char*)rec + PENDING_HEADER;
+    const uint32_t crc = recordCrc(record, text);
+
+    ok = file.write((const uint8_t*)&record, sizeof(record)) == sizeof(record);
+    if (ok && record.op == OP_INSERT) ok = file.write((const uint8_t*)text, record.len) == record.len;
+    if (ok) ok = file.write((const uint8_t*)&crc, sizeof(crc)) == sizeof(crc);
+    offset += PENDING_HEADER + (record.op == OP_INSERT ? record.len : 0);
+  }
+  file.close();
+
+  if (!ok) {
+    DBG_PRINTF("journalFlush: write failed on %s\n", jnlPath);
+    return false;
+  }
+
+  diskBytes += headerBytes + appendBytes;
+  nextSeq = seq;
+  pendingLen = 0;
+  lastRecord = 0;
+  DBG_PRINTF("Journaled %d edits (%d bytes)\n", (int)recordCount, (int)(headerBytes + appendBytes));
+  return true;
+}
+
+int journalReplay(const char* path, char* buf, size_t* len, size_t cap) {
+  journalReset(buf, *len);
+
+  char jnlPath[336];
+  journalPath(path, jnlPath, sizeof(jnlPath));
+  if (!SdMan.exists(jnlPath)) return 0;
+
+  auto file = SdMan.open(jnlPath, O_RDWR);
+  if (!file) return 0;
+
+  JournalHeader header;
+  if (file.read((uint8_t*)&header, sizeof(header)) != (int)sizeof(header) || header.magic != JOURNAL_MAGIC ||
+      header.baseLength != baseLength || header.baseCrc != baseCrc) {
+    // Written against other content (the note was saved or replaced without compacting)
+    file.close();
+    journalRemove(path);
+    DBG_PRINTF("Discarded stale journal %s\n", jnlPath);
+    return 0;
+  }
+
+  int applied = 0;
+  size_t good = sizeof(header);
+  const size_t fileSize = file.size();
+  while (true) {
+    JournalRecord record;
+    uint32_t crc = 0;
+    if (file.read((uint8_t*)&record, sizeof(record)) != (int)sizeof(record) || record.seq != nextSeq) break;
+
+    if (record.op == OP_INSERT) {
+      if (record.pos > *len || *len + record.len >= cap) break;
+      // Open a gap and read the text straight into it; close it again if the record turns out torn
+      char* gap = buf + record.pos;
+      memmove(gap + record.len, gap, *len - record.pos);
+      if (file.read((uint8_t*)gap, record.len) != (int)record.len ||
+          file.read((uint8_t*)&crc, sizeof(crc)) != (int)sizeof(crc) || crc != recordCrc(record, gap)) {
+        memmove(gap, gap + record.len, *len - record.pos);
+        break;
+      }
+      *len += record.len;
+    } else if (record.op == OP_DELETE) {
+      if (record.pos + record.len > *len) break;
+      if (file.read((uint8_t*)&crc, sizeof(crc)) != (int)sizeof(crc) || crc != recordCrc(record, nullptr)) break;
+      memmove(buf + record.pos, buf + record.pos + record.len, *len - record.pos - record.len);
+      *len -= record.len;
+    } else {
+      break;
+    }
+
+    applied++;
+    nextSeq++;
+    good = file.position();
+  }
+
+  // Cut a torn tail so the next append follows the last good record
+  if (good < fileSize) {
+    file.truncate(good);
+    DBG_PRINTF("Journal %s: dropped %d torn bytes\n", jnlPath, (int)(fileSize - good));
+  }
+  file.close();
+
+  diskBytes = good;
+  DBG_PRINTF("Replayed %d journal records from %s\n", applied, jnlPath);
+  return applied;
+}
+
+void journalRemove(const char* path) {
+  char jnlPath[336];
+  journalPath(path, jnlPath, sizeof(jnlPath));
+  SdMan.remove(jnlPath);
+  recoveryClear(noteName(path), RECOVER_JOURNAL);
+}
+
+void journalRename(const char* oldPath, const char* newPath) {
+  char oldJnl[336], newJnl[336];
+  journalPath(oldPath, oldJnl, sizeof(oldJnl));
+  journalPath(newPath, newJnl, sizeof(newJnl));
+  if (SdMan.exists(oldJnl)) {
+    SdMan.rename(oldJnl, newJnl);
+    recoveryRename(noteName(oldPath), noteName(newPath));
+  }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Append-only edit journal for autosaves.
+// The editor reports every edit here and autosave appends the edits made since the last flush to
+// /notes/<note>.txt.jnl, so its I/O is proportional to what was typed. A full save (saveCurrentFile) compacts:
+// the .txt is rewritten and the journal removed. loadFile replays a journal left behind by a crash or power loss.
+//
+// Journal layout, little endian:
+//   header   16 bytes: magic "MSJ1", base length, base CRC32 (the .txt content the records apply to), reserved
+//   records  {seq, pos (u32 each), len (u16), op (u8), reserved (u8)}, then len bytes of text for inserts,
+//            then the CRC32 of the record (u32)
+// Records apply in order. Replay stops at the first record with a bad CRC or sequence number (torn append) and
+// cuts the file there, so later appends continue from the last good record.
+
+// Editor hooks: queue edits in RAM until the next flush. Typing and backspacing runs merge into one record.
+void journalRecordInsert(int pos, char c);
+void journalRecordDelete(int pos, int len);
+
+// The note on disk now holds exactly buf[0..len) and has no journal (after a full save or a new note)
+void journalReset(const char* buf, size_t len);
+
+// Background save: the pending edits are part of the snapshot being saved, so they are dropped; edits made while
+// the save runs are recorded against the snapshot. journalEndSave rebases the journal on the saved content, or
+// forces the next autosave to be a full save if the save failed. No flush may happen in between.
+void journalBeginSave();
+void journalEndSave(bool saved, size_t len, uint32_t crc);
+
+// The buffer is back to the content on disk (edits that cancel out): forget the edits recorded since the last flush
+void journalDiscardPending();
+
+// True if edits were recorded since the last flush
+bool journalHasPendingEdits();
+// Bytes of journal on disk for the current note (0 = nothing to compact)
+size_t journalDiskBytes();
+
+// Append the edits recorded since the last flush to the journal of the note at `path`. Returns false if the
+// edits could not be journaled (RAM log overflow, journal over JOURNAL_MAX_BYTES, write error): the caller must
+// do a full save instead.
+bool journalFlush(const char* path);
+
+// Load path: call after reading the note into buf (len bytes, capacity cap). Resets the journal state to that
+// content, then applies the note's journal if it was written against it; a stale journal is deleted.
+// Returns the number of records applied.
+int journalReplay(const char* path, char* buf, size_t* len, size_t cap);
+
+void journalRemove(const char* path);
+void journalRename(const char* oldPath, const char* newPath);
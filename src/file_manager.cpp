@@ -1,19 +1,23 @@
 #include "file_manager.h"
 #include "text_editor.h"
+#include "edit_journal.h"
+#include "note_index.h"
+#include "buffer_snapshot.h"
+#include "search_index.h"
+#include "recovery_log.h"
+#include "note_history.h"
 #include <Arduino.h>
 #include <SDCardManager.h>
+#include <esp_rom_crc.h>
+#include <algorithm>
 #include <cstring>
 
-// --- File list ---
-static FileInfo fileList[MAX_FILES];
-static int fileCount = 0;
-
 // Shared state
 extern UIState currentState;
 
 // Convert filename to a readable display title.
 // "my_note_2.txt" -> "My Note 2"
-static void filenameToTitle(const char* filename, char* out, int maxLen) {
+void filenameToTitle(const char* filename, char* out, int maxLen) {
   int j = 0;
   bool capitalizeNext = true;
   for (int i = 0; filename[i] != '\0' && filename[i] != '.' && j < maxLen - 1; i++) {
@@ -50,8 +54,11 @@ static void titleToFilename(const char* title, char* out, int maxLen) {
   strcpy(out + j, ".txt");
 }
 
+static void waitForSave();
+
 // Derive a unique /notes/ filename from a title, handling collisions with _2, _3 suffix.
 void deriveUniqueFilename(const char* title, char* out, int maxLen) {
+  waitForSave();
   titleToFilename(title, out, maxLen);
 
   char path[320];
@@ -70,6 +77,9 @@ void deriveUniqueFilename(const char* title, char* out, int maxLen) {
   }
 }
 
+static void recoverSaves();
+static void foldJournals();
+
 void fileManagerSetup() {
   if (!SdMan.begin()) {
     DBG_PRINTLN("SD Card mount failed!");
@@ -81,50 +91,275 @@ void fileManagerSetup() {
   }
 
   DBG_PRINTLN("SD Card initialized");
-  refreshFileList();
+  recoverSaves();  // Before the index scan, so it finds the recovered notes
+  noteIndexSetup();
+  foldJournals();
+  SdMan.sleep();
 }
 
-void refreshFileList() {
-  fileCount = 0;
+// --- Note list window: the entries on screen, read from the note index on demand ---
+static FileInfo fileWindow[FILE_WINDOW_SIZE];
+static int windowFirst = 0;
+static int windowCount = 0;  // 0 = not loaded
+
+static void invalidateFileWindow() { windowCount = 0; }
 
-  auto root = SdMan.open("/notes");
-  if (!root || !root.isDirectory()) {
-    if (root) root.close();
+// --- Unchanged content ---
+// Length and CRC32 of what the card holds for the open note (its .txt with the journal applied). A buffer that
+// matches it, say after a character typed and deleted again, is not written a second time.
+static bool onCardValid = false;
+static size_t onCardLength = 0;
+static uint32_t onCardCrc = 0;
+
+static void setContentOnCard(size_t length, uint32_t crc) {
+  onCardValid = true;
+  onCardLength = length;
+  onCardCrc = crc;
+}
+
+// No save may be running
+static bool skipUnchangedSave() {
+  if (!onCardValid || editorGetLength() != onCardLength || editorGetContentCrc() != onCardCrc) return false;
+  journalDiscardPending();
+  if (journalDiskBytes() == 0) editorSetUnsavedChanges(false);  // Else idle compaction still folds the journal in
+  DBG_PRINTLN("Save skipped: content unchanged");
+  return true;
+}
+
+// --- Background save ---
+// Saves run on their own task from a snapshot of the buffer (see buffer_snapshot.h) so typing continues while
+// the SD card wakes up, the note is written and the files are rotated. The main loop finishes them in
+// fileManagerLoop: journal rebase, index update and the completion callback all happen on the main task.
+//
+// While a save runs, its task owns the SD card and the files of the note, the search index (searchIndexBegin,
+// Feed, End, which can compact the whole index), the version history (historyRecord), the recovery log
+// (recoveryMark, recoveryClear) and the note's journal file (journalRemove). None of these modules lock. Every
+// main task entry point of this file that reaches the card or one of them must call waitForSave() first.
+struct SaveJob {
+  char filename[MAX_FILENAME_LEN];
+  bool hadJournal;
+  bool ok;
+  uint32_t crc;
+  uint16_t fatDate;
+  uint16_t fatTime;
+};
+static SaveJob saveJob;
+// Whole sectors from offset 0, so SdFat sends them to the card as multi-sector writes with no read-modify-write
+// of a partial sector. Word aligned for the SPI DMA.
+alignas(4) static char saveStaging[SAVE_STAGING_SIZE];
+static volatile bool saveRunning = false;
+static volatile bool saveDone = false;
+static bool saveAgain = false;  // requestSave during a save: another one follows it (fileManagerLoop)
+static void (*saveCallback)(bool ok, const char* filename) = nullptr;
+
+// Runs on the save task: reads the snapshot and saveJob, writes the note and calls the modules listed above
+static void runSave() {
+  char path[320], tmpPath[336], bakPath[336];
+  snprintf(path, sizeof(path), "/notes/%s", saveJob.filename);
+  snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", path);
+  snprintf(bakPath, sizeof(bakPath), "%s.bak", path);
+  saveJob.ok = false;
+
+  // Step 1: Write the snapshot to .tmp
+  [[maybe_unused]] const unsigned long startMs = millis();  // Debug output only
+  auto file = SdMan.open(tmpPath, O_WRONLY | O_CREAT | O_TRUNC);
+  if (!file) {
+    DBG_PRINTF("saveCurrentFile: could not create tmp: %s\n", tmpPath);
     return;
   }
 
-  root.rewindDirectory();
-  char name[256];
+  // Contiguous clusters for the whole note up front instead of one FAT update per cluster as it grows.
+  // Best effort: a fragmented card still takes the write.
+  const size_t toWrite = snapshotLength();
+  const size_t sectorBytes = (toWrite + SNAPSHOT_PAGE_SIZE - 1) / SNAPSHOT_PAGE_SIZE * SNAPSHOT_PAGE_SIZE;
+  if (sectorBytes > 0 && !file.preAllocate(sectorBytes)) {
+    DBG_PRINTLN("saveCurrentFile: no contiguous space, writing unallocated");
+  }
 
-  for (auto file = root.openNextFile(); file; file = root.openNextFile()) {
-    file.getName(name, sizeof(name));
-    if (name[0] == '.' || fileCount >= MAX_FILES) {
-      file.close();
-      if (fileCount >= MAX_FILES) break;
-      continue;
+  size_t written = 0;
+  uint32_t crc = 0;
+  int n = 0;
+  bool writeOk = true;
+  const bool indexing = searchIndexBegin(saveJob.filename);  // Search postings come from the same pass
+  for (size_t page = 0; writeOk;) {
+    // Fill the staging buffer with snapshot pages; only the last one can be short
+    size_t staged = 0;
+    while (staged < SAVE_STAGING_SIZE && (n = snapshotReadPage(page, saveStaging + staged)) > 0) {
+      crc = esp_rom_crc32_le(crc, (const uint8_t*)saveStaging + staged, n);
+      searchIndexFeed(saveStaging + staged, n);
+      staged += n;
+      page++;
+      if ((size_t)n < SNAPSHOT_PAGE_SIZE) break;
     }
+    if (staged == 0) break;
+
+    // Pad the tail to a sector; the truncate below cuts it off
+    const size_t padded = (staged + SNAPSHOT_PAGE_SIZE - 1) / SNAPSHOT_PAGE_SIZE * SNAPSHOT_PAGE_SIZE;
+    memset(saveStaging + staged, 0, padded - staged);
+    writeOk = file.write((const uint8_t*)saveStaging, padded) == padded;
+    if (writeOk) written += staged;
+    if (n <= 0 || (size_t)n < SNAPSHOT_PAGE_SIZE) break;
+  }
+  writeOk = writeOk && file.truncate(toWrite);  // Exact length, frees the clusters preallocated past it
+  file.sync();
+  file.getModifyDateTime(&saveJob.fatDate, &saveJob.fatTime);  // Recorded in the index to spot edits made on a PC
+  file.close();
+
+  // Step 2: Verify bytes written match expected length
+  if (n < 0 || !writeOk || written != toWrite) {
+    DBG_PRINTF("saveCurrentFile: write mismatch (%d/%d) — aborting\n", (int)written, (int)toWrite);
+    SdMan.remove(tmpPath);
+    if (indexing) searchIndexEnd(false, 0);
+    return;
+  }
+  DBG_PRINTF("saveCurrentFile: %d bytes written in %lu ms\n", (int)toWrite, millis() - startMs);
 
-    int nameLen = strlen(name);
-    if (nameLen > 4 && strcmp(name + nameLen - 4, ".txt") == 0) {
-      strncpy(fileList[fileCount].filename, name, MAX_FILENAME_LEN - 1);
-      fileList[fileCount].filename[MAX_FILENAME_LEN - 1] = '\0';
+  // The note being replaced becomes a version in the history
+  historyRecord(saveJob.filename, tmpPath, crc);
 
-      filenameToTitle(name, fileList[fileCount].title, MAX_TITLE_LEN);
-      fileList[fileCount].modTime = 0;
-      fileCount++;
-    }
-    file.close();
+  // Listed before the renames: a power loss between them is finished at the next boot (recoverSaves)
+  recoveryMark(saveJob.filename, RECOVER_SAVE, toWrite, crc);
+
+  // Step 3: Rotate original → .bak (original is now safe in .tmp, preserve previous .bak)
+  if (SdMan.exists(path)) {
+    SdMan.remove(bakPath);          // Remove old .bak (if any)
+    SdMan.rename(path, bakPath);    // Original becomes new .bak
   }
-  root.close();
+
+  // Step 4: Promote .tmp → original
+  SdMan.rename(tmpPath, path);
+
+  // Step 5: The journal is folded into the new file
+  if (saveJob.hadJournal) journalRemove(path);
+  recoveryClear(saveJob.filename, RECOVER_SAVE);
+
+  if (indexing) searchIndexEnd(true, crc);
+  saveJob.crc = crc;
+  saveJob.ok = true;
+}
+
+static void saveTask(void*) {
+  runSave();
+  saveDone = true;
+  vTaskDelete(NULL);
+}
+
+static void finishSave() {
+  saveDone = false;
+  saveRunning = false;
+  const size_t length = snapshotLength();
+  snapshotEnd();
+
+  journalEndSave(saveJob.ok, length, saveJob.crc);
+  if (saveJob.ok) {
+    setContentOnCard(length, saveJob.crc);
+    if (!journalHasPendingEdits()) editorSetUnsavedChanges(false);  // Nothing typed since the snapshot
+    noteIndexUpdate(saveJob.filename, length, saveJob.crc, saveJob.fatDate, saveJob.fatTime);
+    invalidateFileWindow();
+    DBG_PRINTF("Saved: %s\n", saveJob.filename);
+  }
+  SdMan.endSession();
   SdMan.sleep();
+  if (saveCallback) saveCallback(saveJob.ok, saveJob.filename);
+}
+
+// Block until a background save is finished, for operations that touch the card or the buffer
+static void waitForSave() {
+  while (saveRunning && !saveDone) delay(2);
+  if (saveDone) finishSave();
+}
 
-  DBG_PRINTF("File listing: %d files found\n", fileCount);
+bool startBackgroundSave() {
+  const char* filename = editorGetCurrentFile();
+  if (saveRunning || filename[0] == '\0') return false;
+  if (journalDiskBytes() == 0 && skipUnchangedSave()) return false;  // A journal still gets compacted
+
+  strncpy(saveJob.filename, filename, MAX_FILENAME_LEN - 1);
+  saveJob.filename[MAX_FILENAME_LEN - 1] = '\0';
+  saveJob.hadJournal = journalDiskBytes() > 0;
+  snapshotBegin(editorGetBuffer(), editorGetLength());
+  journalBeginSave();
+  SdMan.beginSession();  // Until finishSave: the card is not released under the save task
+  saveRunning = true;
+
+  if (xTaskCreate(saveTask, "save", SAVE_TASK_STACK, NULL, 1, NULL) != pdPASS) {
+    DBG_PRINTLN("startBackgroundSave: no task, saving inline");
+    runSave();
+    saveDone = true;
+  }
+  return true;
 }
 
-int getFileCount() { return fileCount; }
-FileInfo* getFileList() { return fileList; }
+void requestSave() {
+  if (saveRunning) {
+    saveAgain = true;
+  } else {
+    startBackgroundSave();
+  }
+}
+
+void saveCurrentFile() {
+  const bool wasRunning = saveRunning;
+  saveAgain = false;  // Covered by this save
+  waitForSave();
+  if (wasRunning && !editorHasUnsavedChanges()) return;  // That save covered everything
+  // Unchanged content is still saved when it has a journal: this is where the journal gets compacted
+  if (editorGetCurrentFile()[0] != '\0' && journalDiskBytes() == 0 && skipUnchangedSave()) return;
+  if (startBackgroundSave()) waitForSave();
+}
+
+bool isSaveInProgress() { return saveRunning; }
+
+void setSaveCallback(void (*callback)(bool ok, const char* filename)) { saveCallback = callback; }
+
+void fileManagerLoop() {
+  if (saveDone) finishSave();
+  if (saveAgain && !saveRunning) {
+    saveAgain = false;
+    startBackgroundSave();  // Skipped if the save that just finished already holds the buffer
+  }
+}
+
+int getFileCount() { return noteIndexCount(); }
+
+const FileInfo* getFileWindow(int first, int count) {
+  const int total = noteIndexCount();
+  if (first < 0 || first >= total) return nullptr;
+  if (count > total - first) count = total - first;
+  if (count > FILE_WINDOW_SIZE) count = FILE_WINDOW_SIZE;
+
+  if (windowCount == 0 || first < windowFirst || first + count > windowFirst + windowCount) {
+    waitForSave();
+    // Center the request in the window so scrolling a row at a time does not reload it every time
+    windowFirst = std::max(0, std::min(first - (FILE_WINDOW_SIZE - count) / 2, total - FILE_WINDOW_SIZE));
+    windowCount = noteIndexRead(windowFirst, fileWindow, FILE_WINDOW_SIZE);
+    SdMan.sleep();
+    if (first + count > windowFirst + windowCount) return nullptr;  // Index read failed
+  }
+  return fileWindow + (first - windowFirst);
+}
+
+const FileInfo* getFileAt(int index) { return getFileWindow(index, 1); }
+
+int findFileIndex(const char* filename) {
+  waitForSave();
+  int index = noteIndexFind(filename);
+  SdMan.sleep();
+  return index;
+}
+
+void setFileSort(NoteSort sort) {
+  if (sort == noteIndexGetSort()) return;
+  waitForSave();
+  noteIndexSetSort(sort);
+  invalidateFileWindow();
+  SdMan.sleep();
+}
+
+NoteSort getFileSort() { return noteIndexGetSort(); }
 
 void loadFile(const char* filename) {
+  waitForSave();
   char path[320];
   snprintf(path, sizeof(path), "/notes/%s", filename);
 
@@ -137,9 +372,12 @@ void loadFile(const char* filename) {
   char* buf = editorGetBuffer();
   int readResult = file.read(buf, TEXT_BUFFER_SIZE - 1);
   size_t bytesRead = (readResult > 0) ? (size_t)readResult : 0;
-  buf[bytesRead] = '\0';
   file.close();
 
+  // Edits autosaved after the last full save
+  int replayed = journalReplay(path, buf, &bytesRead, TEXT_BUFFER_SIZE);
+  buf[bytesRead] = '\0';
+
   editorSetCurrentFile(filename);
   editorLoadBuffer(bytesRead);
 
@@ -147,64 +385,51 @@ void loadFile(const char* filename) {
   char title[MAX_TITLE_LEN];
   filenameToTitle(filename, title, MAX_TITLE_LEN);
   editorSetCurrentTitle(title);
-  editorSetUnsavedChanges(false);
+  editorSetUnsavedChanges(replayed > 0);  // Journaled edits are not in the .txt yet
+  setContentOnCard(bytesRead, editorGetContentCrc());
 
   currentState = UIState::TEXT_EDITOR;
   SdMan.sleep();
   DBG_PRINTF("Loaded: %s (%d bytes)\n", filename, (int)bytesRead);
 }
 
-void saveCurrentFile(bool refreshList) {
+// Autosave: append the edits since the last autosave to the note's journal. Falls back to a full save when the
+// edits cannot be journaled (see journalFlush).
+void autosaveCurrentFile() {
   const char* filename = editorGetCurrentFile();
   if (filename[0] == '\0') return;
 
-  char path[320], tmpPath[336], bakPath[336];
-  snprintf(path, sizeof(path), "/notes/%s", filename);
-  snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", path);
-  snprintf(bakPath, sizeof(bakPath), "%s.bak", path);
-
-  // Step 1: Write new content to .tmp
-  auto file = SdMan.open(tmpPath, O_WRONLY | O_CREAT | O_TRUNC);
-  if (!file) {
-    DBG_PRINTF("saveCurrentFile: could not create tmp: %s\n", tmpPath);
-    return;
-  }
-
-  size_t toWrite = editorGetLength();
-  size_t written = file.write((const uint8_t*)editorGetBuffer(), toWrite);
-  file.close();
+  if (saveRunning) return;  // The save in progress covers these edits up to its snapshot
+  if (skipUnchangedSave()) return;
 
-  // Step 2: Verify bytes written match expected length
-  if (written != toWrite) {
-    DBG_PRINTF("saveCurrentFile: write mismatch (%d/%d) — aborting\n", (int)written, (int)toWrite);
-    SdMan.remove(tmpPath);
+  char path[320];
+  snprintf(path, sizeof(path), "/notes/%s", filename);
+  if (!journalFlush(path)) {
+    startBackgroundSave();
     return;
   }
-
-  // Step 3: Rotate original → .bak (original is now safe in .tmp, preserve previous .bak)
-  if (SdMan.exists(path)) {
-    SdMan.remove(bakPath);          // Remove old .bak (if any)
-    SdMan.rename(path, bakPath);    // Original becomes new .bak
-  }
-
-  // Step 4: Promote .tmp → original
-  SdMan.rename(tmpPath, path);
-
-  editorSetUnsavedChanges(false);
-  if (refreshList) refreshFileList();
+  setContentOnCard(editorGetLength(), editorGetContentCrc());
   SdMan.sleep();
-  DBG_PRINTF("Saved: %s\n", filename);
 }
 
 void createNewFile() {
+  waitForSave();
   editorClear();
+  journalReset(editorGetBuffer(), 0);
+  onCardValid = false;            // Nothing on the card until the first save
   editorSetCurrentFile("");       // filename derived from title when user confirms
   editorSetCurrentTitle("Untitled");
   editorSetUnsavedChanges(true);
 }
 
 // Rename a file on disk to match a new title, updating editor state if needed.
-void updateFileTitle(const char* filename, const char* newTitle) {
+void updateFileTitle(const char* name, const char* newTitle) {
+  // `name` may point into the file list, which the index updates below rewrite
+  char filename[MAX_FILENAME_LEN];
+  strncpy(filename, name, MAX_FILENAME_LEN - 1);
+  filename[MAX_FILENAME_LEN - 1] = '\0';
+
+  waitForSave();
   char newFilename[MAX_FILENAME_LEN];
   deriveUniqueFilename(newTitle, newFilename, MAX_FILENAME_LEN);
 
@@ -213,23 +438,169 @@ void updateFileTitle(const char* filename, const char* newTitle) {
     snprintf(oldPath, sizeof(oldPath), "/notes/%s", filename);
     snprintf(newPath, sizeof(newPath), "/notes/%s", newFilename);
     SdMan.rename(oldPath, newPath);
+    journalRename(oldPath, newPath);
+    noteIndexRename(filename, newFilename);
+    searchIndexRename(filename, newFilename);
+    historyRename(filename, newFilename);
+    invalidateFileWindow();
 
     if (strcmp(editorGetCurrentFile(), filename) == 0) {
       editorSetCurrentFile(newFilename);
     }
   }
 
-  refreshFileList();
   SdMan.sleep();
 }
 
-void deleteFile(const char* filename) {
+void deleteFile(const char* name) {
+  char filename[MAX_FILENAME_LEN];
+  strncpy(filename, name, MAX_FILENAME_LEN - 1);
+  filename[MAX_FILENAME_LEN - 1] = '\0';
+
+  waitForSave();
   char path[320], bakPath[336];
   snprintf(path, sizeof(path), "/notes/%s", filename);
   snprintf(bakPath, sizeof(bakPath), "%s.bak", path);
   SdMan.remove(path);
   SdMan.remove(bakPath);
-  refreshFileList();
+  journalRemove(path);
+  noteIndexRemove(filename);
+  searchIndexRemove(filename);
+  historyRemove(filename);
+  if (strcmp(editorGetCurrentFile(), filename) == 0) onCardValid = false;
+  invalidateFileWindow();
   SdMan.sleep();
   DBG_PRINTF("Deleted: %s\n", filename);
 }
+
+void refreshSearchIndex() {
+  waitForSave();
+  searchIndexRefresh();
+  SdMan.sleep();
+}
+
+int searchNotes(const char* query, SearchHit* hits, int maxHits) {
+  waitForSave();
+  int count = searchQuery(query, hits, maxHits);
+  SdMan.sleep();
+  return count;
+}
+
+int listNoteVersions(const char* filename, HistoryVersion* out, int maxVersions) {
+  waitForSave();
+  int count = historyList(filename, out, maxVersions);
+  SdMan.sleep();
+  return count;
+}
+
+bool restoreNoteVersion(const char* filename, uint32_t number) {
+  // Open the note and save what a journal holds, so the content being replaced is the latest version in the
+  // history and the restore itself can be undone. The version is rebuilt from the .txt, so a journal forces a full
+  // save even when the content on the card is unchanged.
+  loadFile(filename);
+  if (strcmp(editorGetCurrentFile(), filename) != 0) return false;
+  if (journalDiskBytes() > 0) {
+    if (startBackgroundSave()) waitForSave();
+    if (journalDiskBytes() > 0) return false;  // Not compacted: restoring would drop the journaled edits
+  } else if (editorHasUnsavedChanges()) {
+    saveCurrentFile();
+  }
+
+  SdMan.beginSession();
+  const int length = historyRestore(filename, number, editorGetBuffer(), TEXT_BUFFER_SIZE);
+  SdMan.endSession();
+  if (length < 0) {
+    loadFile(filename);  // The buffer may hold part of the version
+    return false;
+  }
+  editorLoadBuffer(length);
+  editorSetUnsavedChanges(true);
+  saveCurrentFile();
+  DBG_PRINTF("Restored: %s v%lu (%d bytes)\n", filename, (unsigned long)number, length);
+  return true;
+}
+
+// --- Boot recovery ---
+// Only the notes listed in the recovery log are visited (see recovery_log.h), so an ordinary boot reads one
+// small file whatever the number of notes.
+static constexpr int RECOVERY_BATCH = 8;
+
+static bool fileMatches(const char* path, uint32_t length, uint32_t crc) {
+  auto file = SdMan.open(path, O_RDONLY);
+  if (!file) return false;
+  if (file.size() != length) {
+    file.close();
+    return false;
+  }
+  char chunk[512];
+  uint32_t actual = 0;
+  int n;
+  while ((n = file.read(chunk, sizeof(chunk))) > 0) actual = esp_rom_crc32_le(actual, (const uint8_t*)chunk, n);
+  file.close();
+  return n == 0 && actual == crc;
+}
+
+// A save cut off between its renames (see runSave): finish it if .tmp holds the content that was saved, else keep
+// the newest complete copy. Copies are told apart by checksum, not by file dates.
+static void recoverSaves() {
+  RecoveryEntry batch[RECOVERY_BATCH];
+  int count;
+  bool progress = true;
+  while (progress && (count = recoveryList(RECOVER_SAVE, batch, RECOVERY_BATCH)) > 0) {
+    for (int i = 0; i < count; i++) {
+      const RecoveryEntry& entry = batch[i];
+      char path[320], tmpPath[336], bakPath[336];
+      snprintf(path, sizeof(path), "/notes/%s", entry.filename);
+      snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", path);
+      snprintf(bakPath, sizeof(bakPath), "%s.bak", path);
+
+      if (fileMatches(tmpPath, entry.length, entry.crc)) {
+        if (SdMan.exists(path)) {
+          SdMan.remove(bakPath);
+          SdMan.rename(path, bakPath);
+        }
+        SdMan.rename(tmpPath, path);
+        DBG_PRINTF("Recovery: finished the save of %s\n", entry.filename);
+      } else {
+        // .tmp is incomplete or gone: the note is either the saved content already or the previous version
+        SdMan.remove(tmpPath);
+        if (!SdMan.exists(path) && SdMan.exists(bakPath)) {
+          SdMan.rename(bakPath, path);
+          DBG_PRINTF("Recovery: restored %s from .bak\n", entry.filename);
+        }
+      }
+      progress = recoveryClear(entry.filename, RECOVER_SAVE) && progress;
+    }
+  }
+}
+
+// Edits journaled before a power loss are folded into their note, so the .txt, the note index and the search
+// index all hold the latest text. Runs the normal load and save path; the editor is left empty.
+static void foldJournals() {
+  const UIState state = currentState;
+  RecoveryEntry batch[RECOVERY_BATCH];
+  int count;
+  bool progress = true;
+  while (progress && (count = recoveryList(RECOVER_JOURNAL, batch, RECOVERY_BATCH)) > 0) {
+    for (int i = 0; i < count; i++) {
+      const RecoveryEntry& entry = batch[i];
+      char path[320];
+      snprintf(path, sizeof(path), "/notes/%s", entry.filename);
+
+      if (!SdMan.exists(path)) {
+        journalRemove(path);  // The note was deleted on a computer
+      } else {
+        loadFile(entry.filename);  // Replays the journal, or drops it if it no longer matches the note
+        if (journalDiskBytes() > 0 && startBackgroundSave()) waitForSave();
+        DBG_PRINTF("Recovery: folded the journal of %s\n", entry.filename);
+      }
+      // Gone after a successful save; a save that failed leaves the journal for next time
+      if (journalDiskBytes() > 0 || !recoveryClear(entry.filename, RECOVER_JOURNAL)) progress = false;
+    }
+  }
+
+  editorInit();
+  journalReset(editorGetBuffer(), 0);
+  onCardValid = false;
+  currentState = state;
+}
@@ -3,13 +3,37 @@
 #include "config.h"
 
 void fileManagerSetup();
-void refreshFileList();
+// Note list, paged: entries come from the note index in the current sort order, and only a window of up to
+// FILE_WINDOW_SIZE entries is held in RAM. Pointers stay valid until the next call that moves the window or
+// changes the list.
 int getFileCount();
-FileInfo* getFileList();
+const FileInfo* getFileWindow(int first, int count);  // Entries [first, first + count), nullptr if out of range
+const FileInfo* getFileAt(int index);
+int findFileIndex(const char* filename);              // -1 if not listed
+void setFileSort(NoteSort sort);
+NoteSort getFileSort();
 
 void loadFile(const char* filename);
-void saveCurrentFile(bool refreshList = true);
+void saveCurrentFile();      // Full save, compacts the edit journal; returns when it is on the card.
+                             // Skipped when the content on the card (note and journal) already matches.
+void autosaveCurrentFile();  // Journals the edits since the last autosave
+// Full save on the save task from a snapshot of the buffer; typing continues meanwhile. False if a save is
+// already running, the note has no file yet or the card already holds this content.
+bool startBackgroundSave();
+// Ctrl+S: start a background save, or queue one behind the save in progress. Never waits for the card.
+void requestSave();
+bool isSaveInProgress();
+void setSaveCallback(void (*callback)(bool ok, const char* filename));  // Called from fileManagerLoop
+void fileManagerLoop();      // Main loop: completes a finished background save, starts a queued one
 void createNewFile();
 void deriveUniqueFilename(const char* title, char* out, int maxLen);
 void updateFileTitle(const char* filename, const char* newTitle);
 void deleteFile(const char* filename);
+// Full-text search (see search_index.h). Refresh before searching to cover notes edited on a PC.
+void refreshSearchIndex();
+int searchNotes(const char* query, SearchHit* hits, int maxHits);
+// Version history (see note_history.h). Restoring opens the note with the version as its content and saves it,
+// so the content it replaces becomes a version in turn. False if the version could not be rebuilt.
+int listNoteVersions(const char* filename, HistoryVersion* out, int maxVersions);  // Newest first
+bool restoreNoteVersion(const char* filename, uint32_t number);
+void filenameToTitle(const char* filename, char* out, int maxLen);
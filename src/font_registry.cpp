@@ -0,0 +1,113 @@
+#include "font_registry.h"
+
+#include <Arduino.h>
+#include <EpdFont.h>
+#include <EpdFontFamily.h>
+#include <GfxRenderer.h>
+
+// Font data includes (constant data in flash, nothing is built until a family is activated)
+#include <builtinFonts/bookerly_14_bold.h>
+#include <builtinFonts/bookerly_14_regular.h>
+#include <builtinFonts/notosans_12_bold.h>
+#include <builtinFonts/notosans_12_regular.h>
+#include <builtinFonts/notosans_14_bold.h>
+#include <builtinFonts/notosans_14_regular.h>
+#include <builtinFonts/opendyslexic_12_bold.h>
+#include <builtinFonts/opendyslexic_12_regular.h>
+#include <builtinFonts/ubuntu_10_bold.h>
+#include <builtinFonts/ubuntu_10_regular.h>
+
+// Shared state (defined in main.cpp)
+extern BodyFont bodyFont;
+
+struct FamilySpec {
+  const char* name;
+  uint8_t size;
+  const EpdFontData* regular;
+  const EpdFontData* bold;
+};
+
+// The catalogue. Body fonts are sized to a similar x-height so the line layout stays comparable.
+static const FamilySpec catalogue[] = {
+  {"NotoSans", 14, &notosans_14_regular, &notosans_14_bold},
+  {"Bookerly", 14, &bookerly_14_regular, &bookerly_14_bold},
+  {"OpenDyslexic", 12, &opendyslexic_12_regular, &opendyslexic_12_bold},
+  {"NotoSans", 12, &notosans_12_regular, &notosans_12_bold},
+  {"Ubuntu", 10, &ubuntu_10_regular, &ubuntu_10_bold},
+};
+static constexpr int CATALOGUE_SIZE = sizeof(catalogue) / sizeof(catalogue[0]);
+
+// Catalogue entries behind each BodyFont value, and the fixed UI families
+static const int bodyFamilies[BODY_FONT_COUNT] = {0, 1, 2};
+static constexpr int UI_FAMILY = 3;
+static constexpr int SMALL_FAMILY = 4;
+
+// Built fonts of the active families, indexed like the catalogue
+struct ActiveFamily {
+  EpdFont* regular;
+  EpdFont* bold;
+  int users;  // Font slots currently showing this family
+};
+static ActiveFamily active[CATALOGUE_SIZE] = {};
+
+// Font slots and the catalogue entry each one shows (-1 = none yet)
+struct FontSlot {
+  int fontId;
+  int family;
+};
+static FontSlot slots[] = {{FONT_BODY, -1}, {FONT_UI, -1}, {FONT_SMALL, -1}};
+
+static void activateFamily(const int family) {
+  ActiveFamily& a = active[family];
+  if (a.users++ > 0) return;
+
+  const unsigned long start = millis();
+  a.regular = new EpdFont(catalogue[family].regular);
+  a.bold = new EpdFont(catalogue[family].bold);
+  DBG_PRINTF("[FONT] Activated %s %d in %lums\n", catalogue[family].name, catalogue[family].size,
+             millis() - start);
+}
+
+static void releaseFamily(const int family) {
+  ActiveFamily& a = active[family];
+  if (--a.users > 0) return;
+
+  delete a.regular;
+  delete a.bold;
+  a.regular = nullptr;
+  a.bold = nullptr;
+  DBG_PRINTF("[FONT] Released %s %d\n", catalogue[family].name, catalogue[family].size);
+}
+
+static void assignFamily(GfxRenderer& renderer, FontSlot& slot, const int family) {
+  if (slot.family == family) return;
+
+  activateFamily(family);
+  renderer.insertFont(slot.fontId, EpdFontFamily(active[family].regular, active[family].bold));
+
+  // The renderer no longer references the old fonts once the slot is replaced
+  const int previous = slot.family;
+  slot.family = family;
+  if (previous >= 0) releaseFamily(previous);
+}
+
+void fontRegistrySetup(GfxRenderer& renderer) {
+  assignFamily(renderer, slots[1], UI_FAMILY);
+  assignFamily(renderer, slots[2], SMALL_FAMILY);
+  fontRegistrySelectBody(renderer, bodyFont);
+}
+
+void fontRegistrySelectBody(GfxRenderer& renderer, BodyFont font) {
+  int index = static_cast<int>(font);
+  if (index < 0 || index >= BODY_FONT_COUNT) index = 0;
+  if (slots[0].family == bodyFamilies[index]) return;
+
+  assignFamily(renderer, slots[0], bodyFamilies[index]);
+  renderer.invalidateScreens();  // Cached frames were drawn with the previous body font
+}
+
+const char* fontRegistryBodyName(BodyFont font) {
+  int index = static_cast<int>(font);
+  if (index < 0 || index >= BODY_FONT_COUNT) index = 0;
+  return catalogue[bodyFamilies[index]].name;
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "config.h"
+
+class GfxRenderer;
+
+// Catalogue of the built-in font families.
+// Every family/size the firmware can show is described by a constant entry; its EpdFont objects (glyph
+// lookup tables and bitmap caches) are only built when the family is first assigned to a font slot, and
+// are freed again when another family replaces it. Unused entries cost no RAM and no boot time.
+
+// Register the UI fonts and the current body font (bodyFont). Call once at boot, after settings are loaded.
+void fontRegistrySetup(GfxRenderer& renderer);
+
+// Make `font` the family used for FONT_BODY. No-op if it is already active.
+void fontRegistrySelectBody(GfxRenderer& renderer, BodyFont font);
+
+const char* fontRegistryBodyName(BodyFont font);
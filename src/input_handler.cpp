@@ -10,9 +10,11 @@
 // External variables
 extern bool autoReconnectEnabled;
 extern bool darkMode;
+extern BodyFont bodyFont;
 extern bool cleanMode;
 extern bool deleteConfirmPending;
 extern WritingMode writingMode;
+extern NoteSort noteSort;
 
 // External functions
 void storePairedDevice(const std::string& address, const std::string& name);
@@ -49,6 +51,16 @@ extern int charsPerLine;
 extern bool screenDirty;
 extern char renameBuffer[];
 extern int renameBufferLen;
+extern char searchBuffer[];
+extern int searchBufferLen;
+extern SearchHit searchHits[];
+extern int searchHitCount;
+extern int searchSelection;
+extern char historyFile[];
+extern HistoryVersion historyVersions[];
+extern int historyCount;
+extern int historySelection;
+extern bool historyRestoreFailed;
 
 void inputSetup() {
   queueHead = 0;
@@ -130,7 +142,7 @@ static void handleEditorKey(uint8_t keyCode, uint8_t modifiers) {
   // Ctrl shortcuts
   if (isCtrl(modifiers)) {
     if (keyCode == HID_KEY_S) {
-      saveCurrentFile();
+      requestSave();
       screenDirty = true;
       return;
     }
@@ -173,6 +185,9 @@ static void handleEditorKey(uint8_t keyCode, uint8_t modifiers) {
   // ESC = save and return to file browser
   if (keyCode == HID_KEY_ESCAPE) {
     if (editorHasUnsavedChanges()) saveCurrentFile();
+    // Saving moved the note to the top of the list; keep it selected
+    int index = findFileIndex(editorGetCurrentFile());
+    selectedFileIndex = index >= 0 ? index : 0;
     currentState = UIState::FILE_BROWSER;
     screenDirty = true;
     return;
@@ -241,8 +256,8 @@ static void handleRenameKey(uint8_t keyCode, uint8_t modifiers) {
         saveCurrentFile();
       } else {
         // Updating title of a file selected in the browser
-        FileInfo* files = getFileList();
-        updateFileTitle(files[selectedFileIndex].filename, renameBuffer);
+        const FileInfo* file = getFileAt(selectedFileIndex);
+        if (file) updateFileTitle(file->filename, renameBuffer);
       }
     }
     currentState = renameReturnState;
@@ -274,6 +289,101 @@ static void handleRenameKey(uint8_t keyCode, uint8_t modifiers) {
   }
 }
 
+// Open the search screen with the previous query and hits; notes edited since the last search are indexed now
+static void openSearch() {
+  refreshSearchIndex();
+  searchSelection = 0;
+  currentState = UIState::SEARCH;
+  screenDirty = true;
+}
+
+// Handle search input: typing edits the query, Enter runs it, and once the hits are listed Enter opens the
+// selected note at its first match
+static void handleSearchKey(uint8_t keyCode, uint8_t modifiers) {
+  if (keyCode == HID_KEY_ENTER) {
+    if (searchHitCount < 0) {
+      searchHitCount = searchBufferLen > 0 ? searchNotes(searchBuffer, searchHits, SEARCH_MAX_HITS) : -1;
+      searchSelection = 0;
+    } else if (searchHitCount > 0) {
+      const SearchHit& hit = searchHits[searchSelection];
+      loadFile(hit.filename);
+      if (strcmp(editorGetCurrentFile(), hit.filename) == 0) editorRestoreView(hit.offset, 0);
+    }
+    screenDirty = true;
+    return;
+  }
+
+  if (keyCode == HID_KEY_ESCAPE) {
+    currentState = UIState::FILE_BROWSER;
+    screenDirty = true;
+    return;
+  }
+
+  if (keyCode == HID_KEY_DOWN || keyCode == HID_KEY_UP) {
+    if (searchHitCount > 0) {
+      const int step = keyCode == HID_KEY_DOWN ? 1 : searchHitCount - 1;
+      searchSelection = (searchSelection + step) % searchHitCount;
+      screenDirty = true;
+    }
+    return;
+  }
+
+  if (keyCode == HID_KEY_BACKSPACE) {
+    if (searchBufferLen > 0) {
+      searchBuffer[--searchBufferLen] = '\0';
+      searchHitCount = -1;
+      screenDirty = true;
+    }
+    return;
+  }
+
+  char c = hidToAscii(keyCode, modifiers);
+  if (c != 0 && c >= ' ' && searchBufferLen < SEARCH_QUERY_LEN - 1) {
+    searchBuffer[searchBufferLen++] = c;
+    searchBuffer[searchBufferLen] = '\0';
+    searchHitCount = -1;
+    screenDirty = true;
+  }
+}
+
+// Open the version history of a note
+static void openHistory(const char* filename) {
+  strncpy(historyFile, filename, MAX_FILENAME_LEN - 1);
+  historyFile[MAX_FILENAME_LEN - 1] = '\0';
+  historyCount = listNoteVersions(historyFile, historyVersions, HISTORY_MAX_VERSIONS);
+  historySelection = 0;
+  historyRestoreFailed = false;
+  currentState = UIState::HISTORY;
+  screenDirty = true;
+}
+
+// Handle history input: Enter restores the selected version and opens the note
+static void handleHistoryKey(uint8_t keyCode) {
+  if (keyCode == HID_KEY_ENTER && historyCount > 0) {
+    if (!restoreNoteVersion(historyFile, historyVersions[historySelection].number)) {
+      // The list may have changed (a journal was saved), show it again
+      historyCount = listNoteVersions(historyFile, historyVersions, HISTORY_MAX_VERSIONS);
+      historySelection = 0;
+      historyRestoreFailed = true;
+      currentState = UIState::HISTORY;
+    }
+    screenDirty = true;
+    return;
+  }
+
+  if (keyCode == HID_KEY_ESCAPE) {
+    currentState = UIState::FILE_BROWSER;
+    screenDirty = true;
+    return;
+  }
+
+  if ((keyCode == HID_KEY_DOWN || keyCode == HID_KEY_UP) && historyCount > 0) {
+    const int step = keyCode == HID_KEY_DOWN ? 1 : historyCount - 1;
+    historySelection = (historySelection + step) % historyCount;
+    screenDirty = true;
+  }
+}
+
 static void dispatchEvent(const KeyEvent& event) {
   if (!event.pressed) return;
 
@@ -310,8 +420,8 @@ static void dispatchEvent(const KeyEvent& event) {
       // Delete confirmation pending — Enter confirms, anything else cancels
       if (deleteConfirmPending) {
         if (event.keyCode == HID_KEY_ENTER && fc > 0) {
-          FileInfo* files = getFileList();
-          deleteFile(files[selectedFileIndex].filename);
+          const FileInfo* file = getFileAt(selectedFileIndex);
+          if (file) deleteFile(file->filename);
           int newFc = getFileCount();
           if (selectedFileIndex >= newFc) selectedFileIndex = newFc - 1;
           if (selectedFileIndex < 0) selectedFileIndex = 0;
@@ -328,19 +438,28 @@ static void dispatchEvent(const KeyEvent& event) {
         selectedFileIndex = (selectedFileIndex - 1 + fc) % fc;
         screenDirty = true;
       } else if (event.keyCode == HID_KEY_ENTER && fc > 0) {
-        FileInfo* files = getFileList();
-        loadFile(files[selectedFileIndex].filename);
+        const FileInfo* file = getFileAt(selectedFileIndex);
+        if (file) loadFile(file->filename);
         screenDirty = true;
       } else if (isCtrl(event.modifiers) && event.keyCode == HID_KEY_N) {
-        if (fc > 0) {
-          FileInfo* files = getFileList();
-          openTitleEdit(files[selectedFileIndex].title, UIState::FILE_BROWSER);
-        }
+        const FileInfo* file = fc > 0 ? getFileAt(selectedFileIndex) : nullptr;
+        if (file) openTitleEdit(file->title, UIState::FILE_BROWSER);
       } else if (isCtrl(event.modifiers) && event.keyCode == HID_KEY_D) {
         if (fc > 0) {
           deleteConfirmPending = true;
           screenDirty = true;
         }
+      } else if (isCtrl(event.modifiers) && event.keyCode == HID_KEY_F) {
+        openSearch();
+      } else if (isCtrl(event.modifiers) && event.keyCode == HID_KEY_H) {
+        const FileInfo* file = fc > 0 ? getFileAt(selectedFileIndex) : nullptr;
+        if (file) openHistory(file->filename);
+      } else if (event.keyCode == HID_KEY_TAB) {
+        // Cycle the sort order; the list restarts at the top
+        noteSort = static_cast<NoteSort>((static_cast<int>(noteSort) + 1) % NOTE_SORT_COUNT);
+        setFileSort(noteSort);
+        selectedFileIndex = 0;
+        screenDirty = true;
       } else if (event.keyCode == HID_KEY_ESCAPE) {
         currentState = UIState::MAIN_MENU;
         screenDirty = true;
@@ -356,8 +475,16 @@ static void dispatchEvent(const KeyEvent& event) {
       handleRenameKey(event.keyCode, event.modifiers);
       break;
 
+    case UIState::SEARCH:
+      handleSearchKey(event.keyCode, event.modifiers);
+      break;
+
+    case UIState::HISTORY:
+      handleHistoryKey(event.keyCode);
+      break;
+
     case UIState::SETTINGS: {
-      const int SETTINGS_COUNT = 5;  // Orientation, Dark Mode, Writing Mode, Bluetooth, Clear Paired
+      const int SETTINGS_COUNT = 6;  // Orientation, Dark Mode, Writing Mode, Body Font, Bluetooth, Clear Paired
 
       // Up/Down: navigate settings list (physical buttons also map here)
       if (event.keyCode == HID_KEY_DOWN) {
@@ -378,8 +505,11 @@ static void dispatchEvent(const KeyEvent& event) {
           int v = static_cast<int>(writingMode);
           writingMode = static_cast<WritingMode>((v + 1) % 3);
         } else if (settingsSelection == 3) {
-          currentState = UIState::BLUETOOTH_SETTINGS;
+          int v = static_cast<int>(bodyFont);
+          bodyFont = static_cast<BodyFont>((v + 1) % BODY_FONT_COUNT);
         } else if (settingsSelection == 4) {
+          currentState = UIState::BLUETOOTH_SETTINGS;
+        } else if (settingsSelection == 5) {
           clearAllBluetoothBonds();
         }
         screenDirty = true;
@@ -394,6 +524,9 @@ static void dispatchEvent(const KeyEvent& event) {
         } else if (settingsSelection == 2) {
           int v = static_cast<int>(writingMode);
           writingMode = static_cast<WritingMode>((v - 1 + 3) % 3);
+        } else if (settingsSelection == 3) {
+          int v = static_cast<int>(bodyFont);
+          bodyFont = static_cast<BodyFont>((v - 1 + BODY_FONT_COUNT) % BODY_FONT_COUNT);
         }
         screenDirty = true;
 
@@ -3,7 +3,9 @@
 #include <HalGPIO.h>
 #include <GfxRenderer.h>
 #include <esp_pm.h>
+#include <esp_sleep.h>
 #include <Preferences.h>
+#include <SDCardManager.h>
 
 #include "config.h"
 #include "ble_keyboard.h"
@@ -12,6 +14,9 @@
 #include "file_manager.h"
 #include "ui_renderer.h"
 #include "wifi_sync.h"
+#include "resume_state.h"
+#include "font_registry.h"
+#include "edit_journal.h"
 
 // Enum for sleep reasons
 enum class SleepReason {
@@ -21,6 +26,7 @@ enum class SleepReason {
 };
 
 // Forward declarations
+void layoutSleepScreen();
 void renderSleepScreen();
 void enterDeepSleep(SleepReason reason);
 
@@ -50,11 +56,35 @@ bool screenDirty = true;
 char renameBuffer[MAX_FILENAME_LEN] = "";
 int renameBufferLen = 0;
 
+// Search screen
+char searchBuffer[SEARCH_QUERY_LEN] = "";
+int searchBufferLen = 0;
+SearchHit searchHits[SEARCH_MAX_HITS];
+int searchHitCount = -1;  // -1 = query not run yet
+int searchSelection = 0;
+char historyFile[MAX_FILENAME_LEN] = "";
+HistoryVersion historyVersions[HISTORY_MAX_VERSIONS];
+int historyCount = 0;
+int historySelection = 0;
+bool historyRestoreFailed = false;
+
 // UI mode flags
 bool darkMode = false;
 bool cleanMode = false;
 bool deleteConfirmPending = false;
 WritingMode writingMode = WritingMode::NORMAL;
+BodyFont bodyFont = BodyFont::NOTOSANS;
+NoteSort noteSort = NoteSort::RECENT;
+bool saveFailed = false;  // Last save of the open note did not reach the card
+
+// Background save finished: show failures in the editor header until a save succeeds
+static void onSaveComplete(bool ok, [[maybe_unused]] const char* filename) {
+  if (saveFailed == ok) screenDirty = true;
+  saveFailed = !ok;
+  if (!ok) {
+    DBG_PRINTF("Save failed: %s\n", filename);
+  }
+}
 
 // --- Screen update ---
 static void updateScreen() {
@@ -75,20 +105,28 @@ static void updateScreen() {
     lastOrientation = currentOrientation;
   }
 
+  // Switch the body font if it was changed in settings (builds the new family, frees the old one)
+  fontRegistrySelectBody(renderer, bodyFont);
+
   // Auto-compute chars per line from font metrics so text always fills the screen
   {
     int sw = renderer.getScreenWidth();
     int textAreaWidth = sw - 20;  // 10px margins each side
-    int avgCharW = renderer.getTextAdvanceX(FONT_BODY, "abcdefghijklmnopqrstuvwxyz") / 26;
+    const EpdFontMetrics* metrics = renderer.getFontMetrics(FONT_BODY);
+    int avgCharW = metrics ? metrics->avgAdvanceX : 0;
     if (avgCharW > 0) charsPerLine = textAreaWidth / avgCharW;
   }
   editorSetCharsPerLine(charsPerLine);
 
+  renderer.setInverted(darkMode);
+
   switch (currentState) {
     case UIState::MAIN_MENU:         drawMainMenu(renderer, gpio); break;
     case UIState::FILE_BROWSER:      drawFileBrowser(renderer, gpio); break;
     case UIState::TEXT_EDITOR:       drawTextEditor(renderer, gpio); break;
     case UIState::RENAME_FILE:       drawRenameScreen(renderer, gpio); break;
+    case UIState::SEARCH:            drawSearchScreen(renderer, gpio); break;
+    case UIState::HISTORY:           drawHistoryScreen(renderer, gpio); break;
     case UIState::SETTINGS:          drawSettingsMenu(renderer, gpio); break;
     case UIState::BLUETOOTH_SETTINGS: drawBluetoothSettings(renderer, gpio); break;
     case UIState::WIFI_SYNC:          drawSyncScreen(renderer, gpio); break;
@@ -104,15 +142,23 @@ void setup() {
 
   gpio.begin();
   display.begin();
+  display.setBusLock([] { SdMan.lockBus(); }, [] { SdMan.unlockBus(); });
+  SdMan.setIdleTimeout(SD_IDLE_RELEASE_MS);
 
   renderer.setFadingFix(true);  // Power down display analog circuits after each refresh — reduces idle drain
-  rendererSetup(renderer);
 
   // Load persisted UI settings from NVS early so startup screen uses saved orientation
   uiPrefs.begin("ui_prefs", false);
   currentOrientation = static_cast<Orientation>(uiPrefs.getUChar("orient", 0));
   darkMode = uiPrefs.getBool("darkMode", false);
   writingMode = static_cast<WritingMode>(uiPrefs.getUChar("writeMode", 0));
+  bodyFont = static_cast<BodyFont>(uiPrefs.getUChar("bodyFont", 0));
+  if (static_cast<int>(bodyFont) >= BODY_FONT_COUNT) bodyFont = BodyFont::NOTOSANS;
+  noteSort = static_cast<NoteSort>(uiPrefs.getUChar("noteSort", 0));
+  if (static_cast<int>(noteSort) >= NOTE_SORT_COUNT) noteSort = NoteSort::RECENT;
+
+  // Fonts come after the settings so only the saved body font gets built
+  rendererSetup(renderer);
 
   // Apply saved orientation
   {
@@ -128,7 +174,9 @@ void setup() {
 
   editorInit();
   inputSetup();
+  setFileSort(noteSort);  // Before the index loads, so it is sorted once
   fileManagerSetup();
+  setSaveCallback(onSaveComplete);
   bleSetup();
 
   // Enable automatic light sleep between loop iterations.
@@ -148,10 +196,25 @@ void setup() {
 
   DBG_PRINTLN("MicroSlate ready.");
 
-  // The display needs one FULL_REFRESH after power-on to initialize its analog
-  // circuits before FAST_REFRESH will work.
-  renderer.clearScreen();
-  renderer.displayBuffer(HalDisplay::FULL_REFRESH);
+  // Waking from our own deep sleep: the panel still shows the sleep screen, so load that frame
+  // back as the RAM baseline and power the panel up the way the full refresh below would, so the
+  // first update is a fast differential refresh. Any other boot (reset, brown-out, flash) finds the
+  // panel in an unknown state, so the saved frame is dropped and the panel gets its full refresh.
+  const bool sleepWake = esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_GPIO;
+  if (!sleepWake) resumeStateDiscard();
+  if (sleepWake && resumeStateRestore(renderer.getFrameBuffer())) {
+    display.writeBaseline();
+    display.powerOn();
+    // The sleep screen was left anti-aliased: lay it out again to put the gray planes back in the
+    // controller, so the first refresh reverts the gray as it would right after displayGrayscale
+    layoutSleepScreen();
+    renderer.restoreGrayscale();
+  } else {
+    // The display needs one FULL_REFRESH after power-on to initialize its analog
+    // circuits before FAST_REFRESH will work.
+    renderer.clearScreen();
+    renderer.displayBuffer(HalDisplay::FULL_REFRESH);
+  }
 
   screenDirty = true;
 }
@@ -160,14 +223,20 @@ void setup() {
 void enterDeepSleep(SleepReason reason) {
   DBG_PRINTLN("Entering deep sleep...");
   
-  // Render the sleep screen before entering deep sleep
-  renderSleepScreen();
-
-  // Save any unsaved work
+  // Save any unsaved work first so the note can be reopened on wake
   if (currentState == UIState::TEXT_EDITOR && editorHasUnsavedChanges()) {
     saveCurrentFile();
   }
 
+  // Render the sleep screen, then keep that frame for an instant resume
+  renderSleepScreen();
+  resumeStateSave(renderer.getFrameBuffer());
+
+  const auto& sd = SdMan.stats();
+  DBG_PRINTF("SD: %lu inits (%lu failed, %lu ms), %lu releases\n", (unsigned long)sd.initCount,
+             (unsigned long)sd.initFailures, (unsigned long)sd.initMillis, (unsigned long)sd.releaseCount);
+  SdMan.sleepNow();
+
   display.deepSleep();     // Power down display first
   gpio.startDeepSleep();   // Waits for power button release, then sleeps
   // Will not return - device is asleep
@@ -334,6 +403,9 @@ static void processPhysicalButtons() {
       }
       if (btnBack && !btnBackLast) {
         if (editorHasUnsavedChanges()) saveCurrentFile();
+        // Saving moved the note to the top of the list; keep it selected
+        int index = findFileIndex(editorGetCurrentFile());
+        selectedFileIndex = index >= 0 ? index : 0;
         currentState = UIState::FILE_BROWSER;
         screenDirty = true;
       }
@@ -352,6 +424,8 @@ static void processPhysicalButtons() {
       }
       break;
 
+    case UIState::SEARCH:
+    case UIState::HISTORY:
     case UIState::BLUETOOTH_SETTINGS:
       if ((btnUp && !btnUpLast) || (btnRight && !btnRightLast)) {
         enqueueKeyEvent(HID_KEY_UP, 0, true);
@@ -430,12 +504,18 @@ void registerActivity() {
   lastActivityTime = millis();
 }
 
-// Function to render the sleep screen
-void renderSleepScreen() {
+// Draw the sleep screen into the frame buffer and record its anti-aliased glyphs; deterministic, so
+// a resume can rebuild the gray planes it left on the panel
+void layoutSleepScreen() {
+  // The sleep screen is always shown light
+  renderer.setInverted(false);
   renderer.clearScreen();
   
   int sw = renderer.getScreenWidth();
   int sh = renderer.getScreenHeight();
+
+  // One layout pass: GRAYSCALE draws the BW frame and records the anti-aliased glyphs for the gray planes
+  renderer.setRenderMode(GfxRenderer::GRAYSCALE);
   
   // Title: "MicroSlate"
   const char* title = "MicroSlate";
@@ -457,9 +537,15 @@ void renderSleepScreen() {
   int footerX = (sw - footerWidth) / 2;
   int footerY = sh * 0.75; // 75% down the screen (moved up from bottom)
   renderer.drawText(FONT_SMALL, footerX, footerY, footer);
-  
-  // Perform a full display refresh to ensure the sleep screen is visible
+}
+
+// Function to render the sleep screen
+void renderSleepScreen() {
+  layoutSleepScreen();
+
+  // Perform a full display refresh to ensure the sleep screen is visible, then anti-alias the recorded glyphs
   renderer.displayBuffer(HalDisplay::FULL_REFRESH);
+  renderer.displayGrayscale();
   
   // Small delay to ensure the display update is complete
   delay(500);
@@ -504,20 +590,32 @@ void loop() {
     lastInputTime = millis();
   }
 
+  // Finish a background save (journal rebase, note index, onSaveComplete)
+  fileManagerLoop();
+
+  // Release the SD card once it has been idle for a while
+  SdMan.loop();
+
   // Auto-save: hybrid idle + hard cap for crash protection.
   // - Saves after 10s of no keystrokes (catches natural pauses between sentences)
   // - Hard cap every 2min during continuous typing (never lose more than 2min of work)
+  // Autosaves only append the new edits to the note's journal; after a longer pause the journal is
+  // compacted into the note with a full save.
   static unsigned long lastAutoSaveMs = 0;
   if (currentState == UIState::TEXT_EDITOR
       && editorHasUnsavedChanges()
       && editorGetCurrentFile()[0] != '\0') {
     unsigned long now = millis();
-    bool idleTrigger = (now - lastInputTime) > AUTO_SAVE_IDLE_MS
-                    && (now - lastAutoSaveMs) > AUTO_SAVE_IDLE_MS;
-    bool capTrigger  = (now - lastAutoSaveMs) > AUTO_SAVE_MAX_MS;
-    if (idleTrigger || capTrigger) {
-      lastAutoSaveMs = now;
-      saveCurrentFile(false);  // Skip refreshFileList — file list unchanged by content update
+    if (journalHasPendingEdits()) {
+      bool idleTrigger = (now - lastInputTime) > AUTO_SAVE_IDLE_MS
+                      && (now - lastAutoSaveMs) > AUTO_SAVE_IDLE_MS;
+      bool capTrigger  = (now - lastAutoSaveMs) > AUTO_SAVE_MAX_MS;
+      if (idleTrigger || capTrigger) {
+        lastAutoSaveMs = now;
+        autosaveCurrentFile();
+      }
+    } else if (journalDiskBytes() > 0 && (now - lastInputTime) > JOURNAL_COMPACT_IDLE_MS) {
+      startBackgroundSave();  // No-op while a save is already running
     }
   }
 
@@ -539,14 +637,21 @@ void loop() {
   static Orientation lastSavedOrientation = currentOrientation;
   static bool lastSavedDarkMode = darkMode;
   static WritingMode lastSavedWritingMode = writingMode;
+  static BodyFont lastSavedBodyFont = bodyFont;
+  static NoteSort lastSavedNoteSort = noteSort;
   if (currentOrientation != lastSavedOrientation || darkMode != lastSavedDarkMode
-      || writingMode != lastSavedWritingMode) {
+      || writingMode != lastSavedWritingMode || bodyFont != lastSavedBodyFont
+      || noteSort != lastSavedNoteSort) {
     uiPrefs.putUChar("orient", static_cast<uint8_t>(currentOrientation));
     uiPrefs.putBool("darkMode", darkMode);
     uiPrefs.putUChar("writeMode", static_cast<uint8_t>(writingMode));
+    uiPrefs.putUChar("bodyFont", static_cast<uint8_t>(bodyFont));
+    uiPrefs.putUChar("noteSort", static_cast<uint8_t>(noteSort));
     lastSavedOrientation = currentOrientation;
     lastSavedDarkMode = darkMode;
     lastSavedWritingMode = writingMode;
+    lastSavedBodyFont = bodyFont;
+    lastSavedNoteSort = noteSort;
   }
 
   // Check for idle timeout (skip while WiFi sync is active)
@@ -0,0 +1,473 @@
+#include "note_history.h"
+#include <Arduino.h>
+#include <SDCardManager.h>
+#include <esp_rom_crc.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+static const char* HISTORY_DIR = "/notes/.history";
+static constexpr uint32_t HISTORY_MAGIC = 0x5648534D;  // "MSHV"
+static constexpr size_t PATH_LEN = MAX_FILENAME_LEN + 32;
+static constexpr size_t BLOCK = 16;                              // Matches are looked up by blocks of the new version
+static constexpr size_t HASH_SLOTS = TEXT_BUFFER_SIZE / BLOCK;
+static constexpr size_t OLD_WINDOW = 1024;                       // Old version bytes held while they are matched
+static constexpr size_t MAX_INSERT = OLD_WINDOW / 2;            // Longer inserts are split
+static constexpr size_t PAGE_SIZE = 512;
+static constexpr size_t OUT_SIZE = 512;
+static_assert(MAX_INSERT + 2 * BLOCK < OLD_WINDOW, "The window holds a pending insert and a block");
+static_assert(HASH_SLOTS <= UINT16_MAX, "Block numbers are stored as u16");
+
+struct HistoryHeader {
+  uint32_t magic;
+  uint16_t recordSize;
+  uint16_t count;
+  uint32_t committed;   // File bytes that belong to the history; a torn append lies past them
+  uint32_t nextNumber;
+};
+static_assert(sizeof(HistoryHeader) == 16, "History header layout");
+
+struct RecordHeader {
+  uint32_t size;     // Whole record
+  uint32_t number;
+  uint32_t length;   // Of this version
+  uint32_t crc;      // Of this version
+  uint32_t baseCrc;  // Of the newer version the operations copy from
+};
+static_assert(sizeof(RecordHeader) == 20, "History record layout");
+
+// --- Helpers ---
+
+static void historyPath(const char* filename, char* out, size_t outLen, const char* suffix = "") {
+  snprintf(out, outLen, "%s/%s%s", HISTORY_DIR, filename, suffix);
+}
+
+static bool readRecord(FsFile& file, uint32_t offset, RecordHeader* record) {
+  return file.seekSet(offset) && file.read((uint8_t*)record, sizeof(*record)) == (int)sizeof(*record);
+}
+
+// Offsets of the committed records, oldest first, and offsets[count] = committed end. False if the file does not
+// hold a history.
+static bool readLayout(FsFile& file, HistoryHeader* header, uint32_t* offsets) {
+  if (!file.seekSet(0) || file.read((uint8_t*)header, sizeof(*header)) != (int)sizeof(*header) ||
+      header->magic != HISTORY_MAGIC || header->recordSize != sizeof(RecordHeader) ||
+      header->count > HISTORY_MAX_VERSIONS || header->committed > file.size()) {
+    return false;
+  }
+  uint32_t pos = sizeof(HistoryHeader);
+  for (int i = 0; i < header->count; i++) {
+    RecordHeader record;
+    if (!readRecord(file, pos, &record) || record.size < sizeof(record) || record.size > header->committed - pos) {
+      return false;
+    }
+    offsets[i] = pos;
+    pos += record.size;
+  }
+  offsets[header->count] = pos;
+  return pos == header->committed;
+}
+
+static uint32_t blockHash(uint32_t h) { return (h ^ (h >> 11) ^ (h >> 23)) % HASH_SLOTS; }
+
+// --- Recording (save task) ---
+// Both versions are on the card: the note and the .tmp the save just wrote (the snapshot cannot be read twice).
+// The old version is read once, front to back, through a window. Each BLOCK bytes at every offset
+// are looked up among the blocks of the new version; a hit is grown in both directions into a copy, and the bytes
+// skipped over become an insert.
+
+struct DeltaWork {
+  uint16_t blocks[HASH_SLOTS];       // Hash of a block of the new version -> block number + 1
+  char newPage[PAGE_SIZE];
+  char oldWindow[OLD_WINDOW];
+  uint8_t out[OUT_SIZE];
+};
+static DeltaWork* work = nullptr;
+static FsFile* newFile;
+static size_t newPage;
+static size_t newLen;
+static FsFile* oldFile;
+static size_t oldStart;   // Old version offset of oldWindow[0]
+static size_t oldCount;   // Bytes in the window
+static uint32_t oldCrc;
+static FsFile* outFile;
+static size_t outLen;
+static uint32_t outBytes;
+static bool deltaFailed;
+
+static int newByte(size_t pos) {
+  const size_t page = pos / PAGE_SIZE;
+  if (page != newPage) {
+    if (!newFile->seekSet(page * PAGE_SIZE) || newFile->read((uint8_t*)work->newPage, PAGE_SIZE) <= 0) {
+      deltaFailed = true;
+      return -1;
+    }
+    newPage = page;
+  }
+  return (uint8_t)work->newPage[pos % PAGE_SIZE];
+}
+
+// Byte `pos` of the old version. Bytes before `keep` may be dropped from the window to make room.
+static int oldByte(size_t pos, size_t keep) {
+  while (pos >= oldStart + oldCount) {
+    const size_t drop = std::min(keep, oldStart + oldCount) - oldStart;
+    memmove(work->oldWindow, work->oldWindow + drop, oldCount - drop);
+    oldStart += drop;
+    oldCount -= drop;
+    const int n = oldFile->read((uint8_t*)work->oldWindow + oldCount, OLD_WINDOW - oldCount);
+    if (n <= 0) {
+      deltaFailed = true;
+      return -1;
+    }
+    oldCrc = esp_rom_crc32_le(oldCrc, (const uint8_t*)work->oldWindow + oldCount, n);
+    oldCount += n;
+  }
+  return (uint8_t)work->oldWindow[pos - oldStart];
+}
+
+static void flushOut() {
+  if (outLen > 0 && outFile->write(work->out, outLen) != outLen) deltaFailed = true;
+  outBytes += outLen;
+  outLen = 0;
+}
+
+static void emitByte(uint8_t b) {
+  if (outLen == OUT_SIZE) flushOut();
+  work->out[outLen++] = b;
+}
+
+static void emitVarint(uint32_t v) {
+  for (; v >= 0x80; v >>= 7) emitByte((uint8_t)(v | 0x80));
+  emitByte((uint8_t)v);
+}
+
+// old[from..to), all in the window
+static void emitInsert(size_t from, size_t to) {
+  if (to == from) return;
+  emitVarint((uint32_t)(to - from) << 1);
+  for (size_t i = from; i < to; i++) emitByte((uint8_t)work->oldWindow[i - oldStart]);
+}
+
+static void emitCopy(size_t from, size_t len) {
+  emitVarint((uint32_t)len << 1 | 1);
+  emitVarint((uint32_t)from);
+}
+
+static void buildBlockTable() {
+  memset(work->blocks, 0, sizeof(work->blocks));
+  for (size_t b = 0; (b + 1) * BLOCK <= newLen && b < HASH_SLOTS && !deltaFailed; b++) {
+    uint32_t h = 0;
+    for (size_t i = 0; i < BLOCK; i++) h = h * 31 + newByte(b * BLOCK + i);
+    uint16_t& slot = work->blocks[blockHash(h)];
+    if (slot == 0) slot = (uint16_t)(b + 1);  // The first block wins: copies stay near the front
+  }
+}
+
+static void writeDelta(size_t oldLen) {
+  size_t p = 0;    // Next old byte to match
+  size_t lit = 0;  // Start of the pending insert
+  while (p < oldLen && !deltaFailed) {
+    if (p - lit >= MAX_INSERT) {
+      emitInsert(lit, p);
+      lit = p;
+    }
+    if (p + BLOCK > oldLen) {
+      oldByte(p++, lit);
+      continue;
+    }
+
+    uint32_t h = 0;
+    for (size_t i = 0; i < BLOCK; i++) h = h * 31 + oldByte(p + i, lit);
+    const uint16_t slot = work->blocks[blockHash(h)];
+    if (slot != 0 && !deltaFailed) {
+      size_t from = (size_t)(slot - 1) * BLOCK;
+      size_t len = 0;
+      while (len < BLOCK && oldByte(p + len, lit) == newByte(from + len)) len++;
+      if (len == BLOCK) {
+        // Grow the match backwards over the pending insert, then forwards as far as it goes
+        while (p > lit && from > 0 && oldByte(p - 1, lit) == newByte(from - 1)) {
+          p--;
+          from--;
+          len++;
+        }
+        emitInsert(lit, p);
+        while (p + len < oldLen && from + len < newLen && oldByte(p + len, p + len) == newByte(from + len)) len++;
+        emitCopy(from, len);
+        p += len;
+        lit = p;
+        continue;
+      }
+    }
+    p++;
+  }
+  if (!deltaFailed) emitInsert(lit, oldLen);
+  flushOut();
+}
+
+// Replace the history with the records from keepFrom on plus the one appended at the committed end
+static bool rewrite(FsFile& file, const char* path, const HistoryHeader& header, const uint32_t* offsets,
+                    int keepFrom, uint32_t recordSize) {
+  char tmpPath[PATH_LEN];
+  snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", path);
+  auto out = SdMan.open(tmpPath, O_WRONLY | O_CREAT | O_TRUNC);
+  if (!out) return false;
+
+  const uint32_t from = offsets[keepFrom];
+  const uint32_t bytes = header.committed + recordSize - from;
+  const HistoryHeader fresh = {HISTORY_MAGIC, sizeof(RecordHeader), (uint16_t)(header.count - keepFrom + 1),
+                               (uint32_t)sizeof(HistoryHeader) + bytes, header.nextNumber + 1};
+  bool ok = out.write((const uint8_t*)&fresh, sizeof(fresh)) == sizeof(fresh) && file.seekSet(from);
+  for (uint32_t done = 0; ok && done < bytes;) {
+    const size_t n = std::min<size_t>(OLD_WINDOW, bytes - done);
+    ok = file.read((uint8_t*)work->oldWindow, n) == (int)n && out.write((const uint8_t*)work->oldWindow, n) == n;
+    done += n;
+  }
+  out.close();
+  file.close();
+  if (!ok) {
+    SdMan.remove(tmpPath);
+    return false;
+  }
+  SdMan.remove(path);
+  return SdMan.rename(tmpPath, path);
+}
+
+bool historyRecord(const char* filename, const char* newPath, uint32_t newCrc) {
+  char path[PATH_LEN];
+  snprintf(path, sizeof(path), "/notes/%s", filename);
+  auto old = SdMan.open(path, O_RDONLY);
+  if (!old) return false;  // A new note: there is no earlier version
+  auto next = SdMan.open(newPath, O_RDONLY);
+  if (!next) {
+    old.close();
+    return false;
+  }
+
+  if (!SdMan.exists(HISTORY_DIR)) SdMan.mkdir(HISTORY_DIR);
+  historyPath(filename, path, sizeof(path));
+  auto file = SdMan.open(path, O_RDWR | O_CREAT);
+  work = file ? (DeltaWork*)malloc(sizeof(DeltaWork)) : nullptr;
+  if (!work) {
+    if (file) file.close();
+    old.close();
+    next.close();
+    return false;
+  }
+
+  HistoryHeader header;
+  uint32_t offsets[HISTORY_MAX_VERSIONS + 1];
+  if (!readLayout(file, &header, offsets)) {
+    header = {HISTORY_MAGIC, sizeof(RecordHeader), 0, sizeof(HistoryHeader), 1};
+    offsets[0] = sizeof(HistoryHeader);
+  }
+
+  // The record goes past the committed end (cutting what a torn append left there) and counts once the header
+  // says so
+  const size_t oldLen = old.size();
+  const size_t newLength = next.size();
+  RecordHeader record = {0, header.nextNumber, (uint32_t)oldLen, 0, newCrc};
+  bool ok = file.truncate(header.committed) && file.seekSet(header.committed) &&
+            file.write((const uint8_t*)&record, sizeof(record)) == sizeof(record);
+  if (ok) {
+    newFile = &next;
+    newPage = SIZE_MAX;
+    newLen = newLength;
+    oldFile = &old;
+    oldStart = 0;
+    oldCount = 0;
+    oldCrc = 0;
+    outFile = &file;
+    outLen = 0;
+    outBytes = 0;
+    deltaFailed = false;
+    buildBlockTable();
+    writeDelta(oldLen);
+    record.size = sizeof(record) + outBytes;
+    record.crc = oldCrc;
+    ok = !deltaFailed && !(oldLen == newLength && oldCrc == newCrc) && file.seekSet(header.committed) &&
+         file.write((const uint8_t*)&record, sizeof(record)) == sizeof(record);
+  }
+  old.close();
+  next.close();
+
+  // A chain the note no longer matches (edited on a PC) cannot be rebuilt: start over from this version
+  RecordHeader newest;
+  int keepFrom = 0;
+  if (ok && header.count > 0 && (!readRecord(file, offsets[header.count - 1], &newest) || newest.baseCrc != oldCrc)) {
+    keepFrom = header.count;
+  }
+  if (ok && (header.count + 1 > HISTORY_MAX_VERSIONS ||
+             header.committed - sizeof(HistoryHeader) + record.size > HISTORY_BUDGET_BYTES)) {
+    // Drop down to 3/4 of the budget, so the next saves append without rewriting the file again
+    const uint32_t target = HISTORY_BUDGET_BYTES * 3 / 4;
+    while (keepFrom < header.count && (header.count - keepFrom + 1 > HISTORY_MAX_VERSIONS ||
+                                       header.committed - offsets[keepFrom] + record.size > target)) {
+      keepFrom++;
+    }
+  }
+
+  if (!ok) {
+    file.truncate(header.committed);
+    file.close();
+  } else if (keepFrom > 0) {
+    ok = rewrite(file, path, header, offsets, keepFrom, record.size);
+  } else {
+    header.count++;
+    header.committed += record.size;
+    header.nextNumber++;
+    ok = file.seekSet(0) && file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+    file.close();
+  }
+  free(work);
+  work = nullptr;
+  if (ok) {
+    DBG_PRINTF("History: %s v%lu, %lu bytes stored\n", filename, (unsigned long)record.number,
+               (unsigned long)record.size);
+  }
+  return ok;
+}
+
+// --- Rename, remove, list ---
+
+void historyRename(const char* oldName, const char* newName) {
+  char oldPath[PATH_LEN], newPath[PATH_LEN];
+  historyPath(oldName, oldPath, sizeof(oldPath));
+  historyPath(newName, newPath, sizeof(newPath));
+  if (!SdMan.exists(oldPath)) return;
+  SdMan.remove(newPath);  // Left by a note deleted on a PC
+  SdMan.rename(oldPath, newPath);
+}
+
+void historyRemove(const char* filename) {
+  char path[PATH_LEN];
+  historyPath(filename, path, sizeof(path));
+  SdMan.remove(path);
+}
+
+int historyList(const char* filename, HistoryVersion* out, int maxVersions) {
+  char path[PATH_LEN];
+  historyPath(filename, path, sizeof(path));
+  auto file = SdMan.open(path, O_RDONLY);
+  if (!file) return 0;
+  HistoryHeader header;
+  uint32_t offsets[HISTORY_MAX_VERSIONS + 1];
+  int n = 0;
+  if (readLayout(file, &header, offsets)) {
+    for (int i = header.count - 1; i >= 0 && n < maxVersions; i--) {
+      RecordHeader record;
+      if (!readRecord(file, offsets[i], &record)) break;
+      out[n++] = {record.number, record.length, record.size};
+    }
+  }
+  file.close();
+  return n;
+}
+
+// --- Restore ---
+
+static bool readVarint(FsFile& file, uint32_t* remaining, uint32_t* value) {
+  *value = 0;
+  for (int shift = 0; shift < 32 && *remaining > 0; shift += 7) {
+    const int b = file.read();
+    if (b < 0) return false;
+    (*remaining)--;
+    *value |= (uint32_t)(b & 0x7F) << shift;
+    if (!(b & 0x80)) return true;
+  }
+  return false;
+}
+
+static bool copyBytes(FsFile& from, FsFile& to, uint32_t len, uint8_t* chunk, size_t chunkSize) {
+  while (len > 0) {
+    const size_t n = std::min<size_t>(chunkSize, len);
+    if (from.read(chunk, n) != (int)n || to.write(chunk, n) != n) return false;
+    len -= n;
+  }
+  return true;
+}
+
+// Rebuild the version of the record at `offset` from base (the newer version) into out
+static bool applyRecord(FsFile& history, uint32_t offset, const RecordHeader& record, FsFile& base, FsFile& out) {
+  uint8_t chunk[256];
+  uint32_t remaining = record.size - sizeof(record);
+  uint32_t produced = 0;
+  if (!history.seekSet(offset + sizeof(record))) return false;
+  while (remaining > 0) {
+    uint32_t op, from;
+    if (!readVarint(history, &remaining, &op)) return false;
+    const uint32_t len = op >> 1;
+    if (len > record.length - produced) return false;
+    if (op & 1) {
+      if (!readVarint(history, &remaining, &from) || !base.seekSet(from) ||
+          !copyBytes(base, out, len, chunk, sizeof(chunk))) {
+        return false;
+      }
+    } else {
+      if (len > remaining || !copyBytes(history, out, len, chunk, sizeof(chunk))) return false;
+      remaining -= len;
+    }
+    produced += len;
+  }
+  return produced == record.length;
+}
+
+static bool fileCrc(const char* path, uint32_t* crc) {
+  auto file = SdMan.open(path, O_RDONLY);
+  if (!file) return false;
+  uint8_t chunk[256];
+  int n;
+  *crc = 0;
+  while ((n = file.read(chunk, sizeof(chunk))) > 0) *crc = esp_rom_crc32_le(*crc, chunk, n);
+  file.close();
+  return n == 0;
+}
+
+int historyRestore(const char* filename, uint32_t number, char* buf, size_t cap) {
+  char path[PATH_LEN], notePath[PATH_LEN], tmpPaths[2][PATH_LEN];
+  historyPath(filename, path, sizeof(path));
+  snprintf(notePath, sizeof(notePath), "/notes/%s", filename);
+  historyPath(".restore0", tmpPaths[0], sizeof(tmpPaths[0]));
+  historyPath(".restore1", tmpPaths[1], sizeof(tmpPaths[1]));
+
+  auto history = SdMan.open(path, O_RDONLY);
+  if (!history) return -1;
+  HistoryHeader header;
+  uint32_t offsets[HISTORY_MAX_VERSIONS + 1];
+  RecordHeader record;
+  int target = -1;
+  if (readLayout(history, &header, offsets)) {
+    for (int i = 0; i < header.count && target < 0; i++) {
+      if (readRecord(history, offsets[i], &record) && record.number == number) target = i;
+    }
+  }
+
+  // The newest version is rebuilt from the note, which must still be the content it was stored against
+  uint32_t crc;
+  bool ok = target >= 0 && record.length < cap && readRecord(history, offsets[header.count - 1], &record) &&
+            fileCrc(notePath, &crc) && crc == record.baseCrc;
+  if (!ok) {
+    DBG_PRINTF("History: %s v%lu cannot be rebuilt\n", filename, (unsigned long)number);
+  }
+
+  // Apply the deltas newest first, each on the output of the previous one
+  const char* basePath = notePath;
+  for (int i = header.count - 1; ok && i >= target; i--) {
+    auto base = SdMan.open(basePath, O_RDONLY);
+    auto out = SdMan.open(tmpPaths[i & 1], O_WRONLY | O_CREAT | O_TRUNC);
+    ok = base && out && readRecord(history, offsets[i], &record) && applyRecord(history, offsets[i], record, base, out);
+    if (base) base.close();
+    if (out) out.close();
+    basePath = tmpPaths[i & 1];
+  }
+  history.close();
+
+  int length = -1;
+  if (ok) {
+    auto file = SdMan.open(basePath, O_RDONLY);
+    const int n = file ? file.read(buf, record.length) : -1;
+    if (file) file.close();
+    if (n == (int)record.length && esp_rom_crc32_le(0, (const uint8_t*)buf, n) == record.crc) length = n;
+  }
+  SdMan.remove(tmpPaths[0]);
+  SdMan.remove(tmpPaths[1]);
+  return length;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "config.h"
+
+// Earlier versions of each note, kept as reverse deltas in /notes/.history/<note>.
+// Every full save stores the content it replaces as copy/insert operations against the content being saved: runs
+// found in the new version are copied from it, the rest is inserted literally, so a version costs about the size
+// of the change. The newest version is rebuilt from the note itself, older ones by applying the deltas in turn.
+// A note keeps up to HISTORY_MAX_VERSIONS versions in HISTORY_BUDGET_BYTES; once either is exceeded the oldest
+// ones are dropped.
+//
+// File layout, little endian:
+//   header   16 bytes: magic "MSHV", record header size (u16), count (u16), committed bytes, next number (u32 each)
+//   records  oldest first: {size (whole record), number, length, crc, base crc (u32 each)}, then the operations:
+//            varint (len << 1 | 1) + varint offset = copy len bytes of the newer version from offset,
+//            varint (len << 1) + len bytes = insert them
+// Each record holds the CRC32 of its version and of the newer version it is rebuilt from. When the note no longer
+// matches the newest record (edited on a PC), the chain cannot be rebuilt and the next save starts it over.
+
+// Save task, once the new content is on the card (newPath, CRC32 newCrc) and before it replaces the note: store
+// the note's current content as a version of it. Returns true if a version was added.
+bool historyRecord(const char* filename, const char* newPath, uint32_t newCrc);
+
+void historyRename(const char* oldName, const char* newName);
+void historyRemove(const char* filename);
+
+// Versions of the note, newest first. Returns the number listed.
+int historyList(const char* filename, HistoryVersion* out, int maxVersions);
+
+// Rebuild version `number` of the note into buf (capacity cap). Returns its length, -1 if it cannot be rebuilt.
+int historyRestore(const char* filename, uint32_t number, char* buf, size_t cap);
@@ -0,0 +1,500 @@
+#include "note_index.h"
+#include "file_manager.h"
+#include <Arduino.h>
+#include <SDCardManager.h>
+#include <esp_rom_crc.h>
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <strings.h>
+
+static const char* INDEX_PATH = "/notes/.index";
+static constexpr uint32_t INDEX_MAGIC = 0x5849534D;  // "MSIX"
+static constexpr uint16_t INDEX_VERSION = 1;
+static constexpr int MAX_NOTES = UINT16_MAX;          // Slots are u16 in RAM
+
+struct IndexHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t recordSize;
+  uint32_t count;
+  uint32_t generation;
+};
+
+struct IndexRecord {
+  char filename[MAX_FILENAME_LEN];
+  char title[MAX_TITLE_LEN];
+  uint32_t size;
+  uint32_t modTime;
+  uint32_t crc;
+  uint16_t fatDate;
+  uint16_t fatTime;
+};
+static_assert(sizeof(IndexHeader) == 16, "Index header layout");
+
+// --- RAM: entryCount elements each, nothing else per note ---
+static uint16_t* order = nullptr;     // Slots in sort order
+static uint32_t* nameHash = nullptr;  // Per slot: filename hash, to find a note without reading every record
+static int capacity = 0;
+static int entryCount = 0;
+static uint32_t generation = 0;
+static NoteSort sortKey = NoteSort::RECENT;
+
+static uint32_t hashName(const char* name) {
+  // FNV-1a
+  uint32_t hash = 2166136261u;
+  for (const char* p = name; *p; p++) {
+    hash = (hash ^ (uint8_t)*p) * 16777619u;
+  }
+  return hash;
+}
+
+static bool reserve(int count) {
+  if (count <= capacity) return true;
+  if (count > MAX_NOTES) return false;
+  int newCapacity = capacity ? capacity : 64;
+  while (newCapacity < count) newCapacity *= 2;
+  if (newCapacity > MAX_NOTES) newCapacity = MAX_NOTES;
+
+  uint16_t* newOrder = (uint16_t*)realloc(order, newCapacity * sizeof(uint16_t));
+  if (newOrder) order = newOrder;
+  uint32_t* newHash = (uint32_t*)realloc(nameHash, newCapacity * sizeof(uint32_t));
+  if (newHash) nameHash = newHash;
+  if (!newOrder || !newHash) {
+    DBG_PRINTF("noteIndex: out of memory for %d notes\n", count);
+    return false;
+  }
+  capacity = newCapacity;
+  return true;
+}
+
+static uint32_t slotOffset(int slot) { return sizeof(IndexHeader) + (uint32_t)slot * sizeof(IndexRecord); }
+
+static bool readRecord(FsFile& file, int slot, IndexRecord* rec) {
+  if (!file.seekSet(slotOffset(slot)) || file.read((uint8_t*)rec, sizeof(*rec)) != (int)sizeof(*rec)) return false;
+  rec->filename[MAX_FILENAME_LEN - 1] = '\0';
+  rec->title[MAX_TITLE_LEN - 1] = '\0';
+  return true;
+}
+
+static bool writeRecord(FsFile& file, int slot, const IndexRecord& rec) {
+  return file.seekSet(slotOffset(slot)) && file.write((const uint8_t*)&rec, sizeof(rec)) == sizeof(rec);
+}
+
+static bool writeHeader(FsFile& file) {
+  IndexHeader header = {INDEX_MAGIC, INDEX_VERSION, (uint16_t)sizeof(IndexRecord), (uint32_t)entryCount, generation};
+  return file.seekSet(0) && file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+}
+
+static void newRecord(const char* filename, IndexRecord* rec) {
+  memset(rec, 0, sizeof(*rec));
+  strncpy(rec->filename, filename, MAX_FILENAME_LEN - 1);
+  filenameToTitle(filename, rec->title, MAX_TITLE_LEN);
+}
+
+// Slot of `filename` (its record in rec), -1 if not indexed
+static int findSlot(FsFile& file, const char* filename, IndexRecord* rec) {
+  const uint32_t hash = hashName(filename);
+  for (int slot = 0; slot < entryCount; slot++) {
+    if (nameHash[slot] == hash && readRecord(file, slot, rec) && strcmp(rec->filename, filename) == 0) return slot;
+  }
+  return -1;
+}
+
+static int orderPosition(int slot) {
+  for (int i = 0; i < entryCount; i++) {
+    if (order[i] == slot) return i;
+  }
+  return -1;
+}
+
+// The index could not be updated: drop it, the next boot rebuilds it from the directory
+static void discardIndex(FsFile& file) {
+  file.close();
+  SdMan.remove(INDEX_PATH);
+  DBG_PRINTLN("noteIndex: write failed, index will be rebuilt");
+}
+
+// --- Sorting ---
+
+static bool sortsBefore(const IndexRecord& a, const IndexRecord& b) {
+  switch (sortKey) {
+    case NoteSort::NAME: {
+      const int c = strcasecmp(a.title, b.title);
+      if (c != 0) return c < 0;
+      return strcmp(a.filename, b.filename) < 0;
+    }
+    case NoteSort::SIZE:
+      if (a.size != b.size) return a.size > b.size;
+      break;
+    default:
+      break;
+  }
+  return a.modTime > b.modTime;
+}
+
+// order[0..n) is sorted: insert `slot` at its position, one record read per bisection step
+static void insertOrdered(FsFile& file, int n, int slot, const IndexRecord& rec) {
+  int lo = 0, hi = n;
+  IndexRecord other;
+  while (lo < hi) {
+    const int mid = (lo + hi) / 2;
+    if (readRecord(file, order[mid], &other) && sortsBefore(other, rec)) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  memmove(order + lo + 1, order + lo, (n - lo) * sizeof(uint16_t));
+  order[lo] = (uint16_t)slot;
+}
+
+static void removeOrdered(int n, int pos) { memmove(order + pos, order + pos + 1, (n - pos - 1) * sizeof(uint16_t)); }
+
+// Sort keys fit in 12 bytes: recency and size exactly, titles by their first 12 characters (ties are settled by
+// reading both records)
+struct SortEntry {
+  uint32_t key[3];
+  uint16_t slot;
+};
+
+static SortEntry sortEntry(const IndexRecord& rec, int slot) {
+  SortEntry e = {{0, 0, 0}, (uint16_t)slot};
+  switch (sortKey) {
+    case NoteSort::NAME:
+      for (int i = 0; i < 12 && rec.title[i]; i++) {
+        e.key[i / 4] |= (uint32_t)(uint8_t)tolower(rec.title[i]) << (24 - 8 * (i % 4));
+      }
+      break;
+    case NoteSort::SIZE:
+      e.key[0] = ~rec.size;
+      e.key[1] = ~rec.modTime;
+      break;
+    default:
+      e.key[0] = ~rec.modTime;
+      break;
+  }
+  return e;
+}
+
+static void sortAll(FsFile& file) {
+  if (entryCount == 0) return;
+  SortEntry* entries = (SortEntry*)malloc(entryCount * sizeof(SortEntry));
+  if (!entries) {
+    DBG_PRINTLN("noteIndex: out of memory, list left unsorted");
+    return;
+  }
+
+  IndexRecord rec;
+  file.seekSet(sizeof(IndexHeader));
+  for (int slot = 0; slot < entryCount; slot++) {
+    if (file.read((uint8_t*)&rec, sizeof(rec)) != (int)sizeof(rec)) memset(&rec, 0, sizeof(rec));
+    entries[slot] = sortEntry(rec, slot);
+  }
+
+  std::sort(entries, entries + entryCount, [&file](const SortEntry& a, const SortEntry& b) {
+    for (int i = 0; i < 3; i++) {
+      if (a.key[i] != b.key[i]) return a.key[i] < b.key[i];
+    }
+    IndexRecord ra, rb;
+    if (sortKey == NoteSort::NAME && readRecord(file, a.slot, &ra) && readRecord(file, b.slot, &rb)) {
+      return sortsBefore(ra, rb);
+    }
+    return a.slot < b.slot;
+  });
+
+  for (int i = 0; i < entryCount; i++) order[i] = entries[i].slot;
+  free(entries);
+}
+
+// --- Boot ---
+
+// Load the header and filename hashes; size and FAT timestamp of every record go to the reconcile arrays
+static bool loadIndex(FsFile& file, uint32_t** sizes, uint32_t** stamps) {
+  IndexHeader header;
+  if (file.read((uint8_t*)&header, sizeof(header)) != (int)sizeof(header) || header.magic != INDEX_MAGIC ||
+      header.version != INDEX_VERSION || header.recordSize != sizeof(IndexRecord) || header.count > MAX_NOTES ||
+      file.size() != slotOffset(header.count) || !reserve(header.count)) {
+    return false;
+  }
+
+  *sizes = (uint32_t*)malloc(header.count * sizeof(uint32_t) + 1);
+  *stamps = (uint32_t*)malloc(header.count * sizeof(uint32_t) + 1);
+  if (!*sizes || !*stamps) return false;
+
+  IndexRecord rec;
+  for (uint32_t slot = 0; slot < header.count; slot++) {
+    if (file.read((uint8_t*)&rec, sizeof(rec)) != (int)sizeof(rec)) return false;
+    rec.filename[MAX_FILENAME_LEN - 1] = '\0';
+    nameHash[slot] = hashName(rec.filename);
+    (*sizes)[slot] = rec.size;
+    (*stamps)[slot] = (uint32_t)rec.fatDate << 16 | rec.fatTime;
+  }
+  entryCount = (int)header.count;
+  generation = header.generation;
+  return true;
+}
+
+static uint32_t crcOfFile(FsFile& file) {
+  uint8_t chunk[512];
+  uint32_t crc = 0;
+  int n;
+  while ((n = file.read(chunk, sizeof(chunk))) > 0) {
+    crc = esp_rom_crc32_le(crc, chunk, n);
+  }
+  return crc;
+}
+
+void noteIndexSetup() {
+  entryCount = 0;
+  generation = 0;
+
+  auto root = SdMan.open("/notes");
+  if (!root || !root.isDirectory()) {
+    if (root) root.close();
+    return;
+  }
+  auto index = SdMan.open(INDEX_PATH, O_RDWR | O_CREAT);
+  if (!index) {
+    DBG_PRINTF("noteIndex: could not open %s\n", INDEX_PATH);
+    root.close();
+    return;
+  }
+
+  uint32_t* sizes = nullptr;
+  uint32_t* stamps = nullptr;
+  bool changed = false;
+  if (!loadIndex(index, &sizes, &stamps)) {
+    DBG_PRINTLN("noteIndex: index missing or invalid, rebuilding");
+    entryCount = 0;
+    generation = 0;
+    changed = true;
+  }
+
+  // Reconcile lookups: loaded slots by filename hash, and which of them are still on the card
+  uint16_t* byHash = (uint16_t*)malloc(entryCount * sizeof(uint16_t) + 1);
+  uint8_t* seen = (uint8_t*)calloc(entryCount / 8 + 1, 1);
+  if (!byHash || !seen) {
+    DBG_PRINTLN("noteIndex: out of memory, rebuilding");
+    entryCount = 0;
+    changed = true;
+  }
+  const int lookupCount = entryCount;
+  for (int i = 0; i < lookupCount; i++) byHash[i] = (uint16_t)i;
+  std::sort(byHash, byHash + lookupCount, [](uint16_t a, uint16_t b) { return nameHash[a] < nameHash[b]; });
+
+  root.rewindDirectory();
+  char name[256];
+  IndexRecord rec;
+  for (auto file = root.openNextFile(); file; file = root.openNextFile()) {
+    file.getName(name, sizeof(name));
+    int nameLen = strlen(name);
+    if (name[0] == '.' || nameLen <= 4 || nameLen >= MAX_FILENAME_LEN || strcmp(name + nameLen - 4, ".txt") != 0) {
+      file.close();
+      continue;
+    }
+
+    uint16_t fatDate = 0, fatTime = 0;
+    file.getModifyDateTime(&fatDate, &fatTime);
+    const uint32_t size = (uint32_t)file.size();
+    const uint32_t stamp = (uint32_t)fatDate << 16 | fatTime;
+
+    const uint32_t hash = hashName(name);
+    const uint16_t* it = std::lower_bound(byHash, byHash + lookupCount, hash,
+                                          [](uint16_t slot, uint32_t h) { return nameHash[slot] < h; });
+    int slot = -1;
+    for (; it != byHash + lookupCount && nameHash[*it] == hash; it++) {
+      if (readRecord(index, *it, &rec) && strcmp(rec.filename, name) == 0) {
+        slot = *it;
+        break;
+      }
+    }
+
+    if (slot >= 0) {
+      seen[slot / 8] |= 1 << (slot % 8);
+      if (sizes[slot] == size && stamps[slot] == stamp) {
+        file.close();
+        continue;
+      }
+    } else {
+      // New note
+      if (!reserve(entryCount + 1)) {
+        file.close();
+        continue;
+      }
+      slot = entryCount++;
+      nameHash[slot] = hash;
+      newRecord(name, &rec);
+    }
+
+    // New, or changed outside the device
+    rec.size = size;
+    rec.crc = crcOfFile(file);
+    rec.modTime = ++generation;
+    rec.fatDate = fatDate;
+    rec.fatTime = fatTime;
+    writeRecord(index, slot, rec);
+    changed = true;
+    file.close();
+  }
+  root.close();
+
+  // Drop notes whose file is gone. Going down, the last record moved into a freed slot was already kept.
+  for (int slot = lookupCount - 1; slot >= 0; slot--) {
+    if (seen[slot / 8] & (1 << (slot % 8))) continue;
+    const int last = entryCount - 1;
+    if (slot != last && readRecord(index, last, &rec)) {
+      writeRecord(index, slot, rec);
+      nameHash[slot] = nameHash[last];
+    }
+    entryCount--;
+    changed = true;
+  }
+  free(byHash);
+  free(seen);
+  free(sizes);
+  free(stamps);
+
+  bool ok = true;
+  if (changed) ok = index.truncate(slotOffset(entryCount)) && writeHeader(index);
+  if (!ok) {
+    discardIndex(index);
+    entryCount = 0;
+    return;
+  }
+  sortAll(index);
+  index.close();
+  DBG_PRINTF("Note index: %d notes%s\n", entryCount, changed ? " (updated)" : "");
+}
+
+// --- Queries ---
+
+int noteIndexCount() { return entryCount; }
+
+void noteIndexSetSort(NoteSort sort) {
+  if (sort == sortKey) return;
+  sortKey = sort;
+  auto index = SdMan.open(INDEX_PATH, O_RDONLY);
+  if (!index) return;
+  sortAll(index);
+  index.close();
+}
+
+NoteSort noteIndexGetSort() { return sortKey; }
+
+int noteIndexRead(int first, FileInfo* out, int count) {
+  if (first < 0 || first >= entryCount) return 0;
+  if (count > entryCount - first) count = entryCount - first;
+
+  auto index = SdMan.open(INDEX_PATH, O_RDONLY);
+  if (!index) return 0;
+  IndexRecord rec;
+  int n = 0;
+  for (; n < count && readRecord(index, order[first + n], &rec); n++) {
+    FileInfo& info = out[n];
+    strcpy(info.filename, rec.filename);
+    strcpy(info.title, rec.title);
+    info.size = rec.size;
+    info.modTime = rec.modTime;
+    info.crc = rec.crc;
+  }
+  index.close();
+  return n;
+}
+
+int noteIndexFind(const char* filename) {
+  auto index = SdMan.open(INDEX_PATH, O_RDONLY);
+  if (!index) return -1;
+  IndexRecord rec;
+  const int slot = findSlot(index, filename, &rec);
+  index.close();
+  return slot >= 0 ? orderPosition(slot) : -1;
+}
+
+// --- Updates: one or two records rewritten in place ---
+
+void noteIndexUpdate(const char* filename, uint32_t size, uint32_t crc, uint16_t fatDate, uint16_t fatTime) {
+  auto index = SdMan.open(INDEX_PATH, O_RDWR);
+  if (!index) return;
+
+  IndexRecord rec;
+  int slot = findSlot(index, filename, &rec);
+  const bool added = slot < 0;
+  if (added) {
+    if (!reserve(entryCount + 1)) {
+      index.close();
+      return;
+    }
+    slot = entryCount++;
+    nameHash[slot] = hashName(filename);
+    newRecord(filename, &rec);
+  } else {
+    removeOrdered(entryCount, orderPosition(slot));
+  }
+  rec.size = size;
+  rec.crc = crc;
+  rec.modTime = ++generation;
+  rec.fatDate = fatDate;
+  rec.fatTime = fatTime;
+  insertOrdered(index, entryCount - 1, slot, rec);
+
+  if (!writeRecord(index, slot, rec) || !writeHeader(index)) {
+    discardIndex(index);
+    return;
+  }
+  index.close();
+  DBG_PRINTF("Note index: %s %s\n", added ? "added" : "updated", filename);
+}
+
+void noteIndexRename(const char* oldName, const char* newName) {
+  auto index = SdMan.open(INDEX_PATH, O_RDWR);
+  if (!index) return;
+
+  IndexRecord rec;
+  const int slot = findSlot(index, oldName, &rec);
+  if (slot < 0) {
+    index.close();
+    return;
+  }
+  memset(rec.filename, 0, sizeof(rec.filename));
+  strncpy(rec.filename, newName, MAX_FILENAME_LEN - 1);
+  filenameToTitle(newName, rec.title, MAX_TITLE_LEN);
+  nameHash[slot] = hashName(rec.filename);
+  removeOrdered(entryCount, orderPosition(slot));
+  insertOrdered(index, entryCount - 1, slot, rec);
+
+  if (!writeRecord(index, slot, rec)) {
+    discardIndex(index);
+    return;
+  }
+  index.close();
+}
+
+void noteIndexRemove(const char* filename) {
+  auto index = SdMan.open(INDEX_PATH, O_RDWR);
+  if (!index) return;
+
+  IndexRecord rec;
+  const int slot = findSlot(index, filename, &rec);
+  if (slot < 0) {
+    index.close();
+    return;
+  }
+  removeOrdered(entryCount, orderPosition(slot));
+  const int last = --entryCount;
+
+  // Keep the slots dense: the last record moves into the freed one
+  bool ok = true;
+  if (slot != last) {
+    ok = readRecord(index, last, &rec) && writeRecord(index, slot, rec);
+    nameHash[slot] = nameHash[last];
+    order[orderPosition(last)] = (uint16_t)slot;
+  }
+
+  if (!ok || !index.truncate(slotOffset(entryCount)) || !writeHeader(index)) {
+    discardIndex(index);
+    return;
+  }
+  index.close();
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "config.h"
+
+// Persistent index of the notes in /notes, stored in /notes/.index.
+// Holds filename, title, size, CRC32 and a save counter for every note. The records stay on the card: RAM holds
+// the current sort order and a filename hash per note (6 bytes each), so the note count is not bounded by a
+// static list and the file browser reads only the page it shows. The device has no clock: modTime is the value
+// of a counter bumped on every save, higher is more recent.
+//
+// File layout, little endian:
+//   header   16 bytes: magic "MSIX", version (u16), record size (u16), count, generation (u32 each)
+//   records  count x {filename, title (fixed char arrays), size, modTime, crc (u32 each), fatDate, fatTime (u16)}
+// Records are dense and in no particular order (a delete moves the last record into the freed slot).
+
+// Boot: load the index and bring it in line with the directory. One pass over the directory entries; only notes
+// that are new or whose size or FAT timestamp changed (edited on a PC) are read to compute their CRC.
+void noteIndexSetup();
+
+int noteIndexCount();
+
+// Sort order of noteIndexRead/noteIndexFind. Changing it re-sorts from one sequential pass over the index.
+void noteIndexSetSort(NoteSort sort);
+NoteSort noteIndexGetSort();
+
+// Read up to `count` entries starting at position `first` of the sort order. Returns the number read.
+int noteIndexRead(int first, FileInfo* out, int count);
+// Position of a note in the sort order, -1 if it is not indexed
+int noteIndexFind(const char* filename);
+
+// A note was written: add or refresh its entry (it becomes the most recent)
+void noteIndexUpdate(const char* filename, uint32_t size, uint32_t crc, uint16_t fatDate, uint16_t fatTime);
+void noteIndexRename(const char* oldName, const char* newName);
+void noteIndexRemove(const char* filename);
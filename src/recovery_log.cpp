@@ -0,0 +1,129 @@
+#include "recovery_log.h"
+#include <Arduino.h>
+#include <SDCardManager.h>
+#include <cstring>
+
+static const char* LOG_PATH = "/notes/.recovery";
+static constexpr uint32_t LOG_MAGIC = 0x4C52534D;  // "MSRL"
+
+struct LogHeader {
+  uint32_t magic;
+  uint16_t recordSize;
+  uint16_t reserved;
+};
+static_assert(sizeof(LogHeader) == 8, "Recovery log header layout");
+
+static uint32_t slotOffset(int slot) { return sizeof(LogHeader) + (uint32_t)slot * sizeof(RecoveryEntry); }
+
+static int slotCount(FsFile& file) { return (int)((file.size() - sizeof(LogHeader)) / sizeof(RecoveryEntry)); }
+
+static bool validHeader(FsFile& file) {
+  LogHeader header;
+  return file.size() >= sizeof(LogHeader) && file.seekSet(0) &&
+         file.read((uint8_t*)&header, sizeof(header)) == (int)sizeof(header) && header.magic == LOG_MAGIC &&
+         header.recordSize == sizeof(RecoveryEntry);
+}
+
+static bool readEntry(FsFile& file, int slot, RecoveryEntry* entry) {
+  if (!file.seekSet(slotOffset(slot)) || file.read((uint8_t*)entry, sizeof(*entry)) != (int)sizeof(*entry)) {
+    return false;
+  }
+  entry->filename[MAX_FILENAME_LEN - 1] = '\0';
+  return true;
+}
+
+static bool writeEntry(FsFile& file, int slot, const RecoveryEntry& entry) {
+  return file.seekSet(slotOffset(slot)) && file.write((const uint8_t*)&entry, sizeof(entry)) == sizeof(entry);
+}
+
+// Slot of the note's entry, -1 if it has none. *freeSlot = first free slot (or the end of the file).
+static int findEntry(FsFile& file, const char* filename, RecoveryEntry* entry, int* freeSlot = nullptr) {
+  const int count = slotCount(file);
+  if (freeSlot) *freeSlot = count;
+  for (int slot = 0; slot < count; slot++) {
+    if (!readEntry(file, slot, entry)) break;
+    if (entry->flags == 0) {
+      if (freeSlot && *freeSlot == count) *freeSlot = slot;
+    } else if (strcmp(entry->filename, filename) == 0) {
+      return slot;
+    }
+  }
+  return -1;
+}
+
+bool recoveryMark(const char* filename, uint32_t flags, uint32_t length, uint32_t crc) {
+  auto file = SdMan.open(LOG_PATH, O_RDWR | O_CREAT);
+  if (!file) return false;
+  if (!validHeader(file)) {
+    const LogHeader header = {LOG_MAGIC, sizeof(RecoveryEntry), 0};
+    if (!file.truncate(0) || !file.seekSet(0) ||
+        file.write((const uint8_t*)&header, sizeof(header)) != sizeof(header)) {
+      file.close();
+      return false;
+    }
+  }
+
+  RecoveryEntry entry;
+  int freeSlot;
+  int slot = findEntry(file, filename, &entry, &freeSlot);
+  if (slot < 0) {
+    slot = freeSlot;
+    memset(&entry, 0, sizeof(entry));
+    strncpy(entry.filename, filename, MAX_FILENAME_LEN - 1);
+  }
+  entry.flags |= flags;
+  if (flags & RECOVER_SAVE) {
+    entry.length = length;
+    entry.crc = crc;
+  }
+  const bool ok = writeEntry(file, slot, entry);
+  file.close();  // Close syncs: the entry is on the card before the state it describes
+  return ok;
+}
+
+bool recoveryClear(const char* filename, uint32_t flags) {
+  auto file = SdMan.open(LOG_PATH, O_RDWR);
+  if (!file) return !SdMan.exists(LOG_PATH);
+  RecoveryEntry entry;
+  bool ok = true;
+  const int slot = validHeader(file) ? findEntry(file, filename, &entry) : -1;
+  if (slot >= 0) {
+    entry.flags &= ~flags;
+    ok = writeEntry(file, slot, entry);
+
+    // Free slots at the end are cut, so the log is empty again once nothing is pending
+    int count = slotCount(file);
+    while (count > 0 && readEntry(file, count - 1, &entry) && entry.flags == 0) count--;
+    if (count < slotCount(file)) file.truncate(slotOffset(count));
+  }
+  file.close();
+  return ok;
+}
+
+void recoveryRename(const char* oldName, const char* newName) {
+  auto file = SdMan.open(LOG_PATH, O_RDWR);
+  if (!file) return;
+  RecoveryEntry entry;
+  const int slot = validHeader(file) ? findEntry(file, oldName, &entry) : -1;
+  if (slot >= 0) {
+    memset(entry.filename, 0, sizeof(entry.filename));
+    strncpy(entry.filename, newName, MAX_FILENAME_LEN - 1);
+    writeEntry(file, slot, entry);
+  }
+  file.close();
+}
+
+int recoveryList(uint32_t flags, RecoveryEntry* out, int maxEntries) {
+  auto file = SdMan.open(LOG_PATH, O_RDONLY);
+  if (!file) return 0;
+  int n = 0;
+  if (validHeader(file)) {
+    const int count = slotCount(file);
+    for (int slot = 0; slot < count && n < maxEntries; slot++) {
+      if (!readEntry(file, slot, &out[n])) break;
+      if (out[n].flags & flags) n++;
+    }
+  }
+  file.close();
+  return n;
+}
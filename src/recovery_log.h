@@ -0,0 +1,30 @@
+#pragma once
+
+#include "config.h"
+
+// Notes whose state on the card is more than their .txt: a full save between its renames, or an edit journal.
+// Listed in /notes/.recovery so boot recovery visits only those notes, however many notes there are. Entries are
+// added before the state exists on the card and removed after it is gone, so a power loss can leave a stale
+// entry (harmless, recovery finds nothing to do) but never an unlisted note.
+//
+// File layout, little endian:
+//   header   8 bytes: magic "MSRL", record size (u16), reserved (u16)
+//   records  {filename (fixed char array), flags, length, crc (u32 each)}; flags 0 = free slot
+
+static constexpr uint32_t RECOVER_SAVE = 1;     // .tmp holds `length` bytes with `crc` and is being promoted
+static constexpr uint32_t RECOVER_JOURNAL = 2;  // The note has a .jnl
+
+struct RecoveryEntry {
+  char filename[MAX_FILENAME_LEN];
+  uint32_t flags;
+  uint32_t length;
+  uint32_t crc;
+};
+
+// Add flags to the note's entry (length and crc are stored with RECOVER_SAVE). False if the log is not writable.
+bool recoveryMark(const char* filename, uint32_t flags, uint32_t length = 0, uint32_t crc = 0);
+bool recoveryClear(const char* filename, uint32_t flags);  // False if the entry could not be updated
+void recoveryRename(const char* oldName, const char* newName);
+
+// Boot: read up to maxEntries entries with any of `flags` set. Returns the number read.
+int recoveryList(uint32_t flags, RecoveryEntry* out, int maxEntries);
@@ -0,0 +1,126 @@
+#include "resume_state.h"
+#include "config.h"
+#include "file_manager.h"
+#include "text_editor.h"
+#include <Arduino.h>
+#include <FrameSnapshot.h>
+#include <SDCardManager.h>
+#include <cstring>
+
+// Shared state
+extern UIState currentState;
+extern int charsPerLine;
+
+static const char* RESUME_PATH = "/.resume";
+static constexpr uint32_t RESUME_MAGIC = 0x4D535253;  // "MSRS"
+static constexpr uint16_t RESUME_VERSION = 1;
+
+// Frame is stored in the same bands as the in-memory screen cache: [uint16 length][PackBits data] each
+static constexpr int NUM_BANDS = FrameSnapshotPool::NUM_BANDS;
+static constexpr size_t BAND_SIZE = FrameSnapshotPool::BAND_SIZE;
+static constexpr size_t MAX_ENCODED_BAND = PackBits::maxEncodedSize(BAND_SIZE);
+
+struct ResumeHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint8_t state;            // UIState to return to (TEXT_EDITOR or MAIN_MENU)
+  uint8_t reserved;
+  int32_t cursorPosition;
+  int32_t viewportStart;
+  int16_t charsPerLine;     // Line layout the viewport refers to
+  int16_t visibleLines;
+  char filename[MAX_FILENAME_LEN];
+};
+
+void resumeStateSave(const uint8_t* frameBuffer) {
+  ResumeHeader header = {};
+  header.magic = RESUME_MAGIC;
+  header.version = RESUME_VERSION;
+  header.state = (uint8_t)UIState::MAIN_MENU;
+
+  // Only a note that exists on disk can be reopened; unsaved "Untitled" notes resume to the menu
+  const char* filename = editorGetCurrentFile();
+  if (currentState == UIState::TEXT_EDITOR && filename[0] != '\0') {
+    header.state = (uint8_t)UIState::TEXT_EDITOR;
+    header.cursorPosition = editorGetCursorPosition();
+    header.viewportStart = editorGetViewportStart();
+    strncpy(header.filename, filename, MAX_FILENAME_LEN - 1);
+  }
+  header.charsPerLine = (int16_t)charsPerLine;
+  header.visibleLines = (int16_t)editorGetStoredVisibleLines();
+
+  auto file = SdMan.open(RESUME_PATH, O_WRONLY | O_CREAT | O_TRUNC);
+  if (!file) {
+    DBG_PRINTF("resumeStateSave: could not create %s\n", RESUME_PATH);
+    return;
+  }
+
+  bool ok = file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+
+  uint8_t encoded[MAX_ENCODED_BAND];
+  for (int band = 0; ok && band < NUM_BANDS; band++) {
+    const uint16_t len = (uint16_t)PackBits::encode(frameBuffer + band * BAND_SIZE, BAND_SIZE, encoded,
+                                                    sizeof(encoded));
+    ok = len > 0 && file.write((const uint8_t*)&len, sizeof(len)) == sizeof(len) &&
+         file.write(encoded, len) == len;
+  }
+
+  size_t total = file.size();
+  file.close();
+
+  if (!ok) {
+    DBG_PRINTLN("resumeStateSave: write failed");
+    SdMan.remove(RESUME_PATH);
+  } else {
+    DBG_PRINTF("Resume state saved (%d bytes)\n", (int)total);
+  }
+  SdMan.sleep();
+}
+
+bool resumeStateRestore(uint8_t* frameBuffer) {
+  auto file = SdMan.open(RESUME_PATH, O_RDONLY);
+  if (!file) return false;
+
+  ResumeHeader header;
+  bool ok = file.read((uint8_t*)&header, sizeof(header)) == (int)sizeof(header) &&
+            header.magic == RESUME_MAGIC && header.version == RESUME_VERSION;
+
+  uint8_t encoded[MAX_ENCODED_BAND];
+  for (int band = 0; ok && band < NUM_BANDS; band++) {
+    uint16_t len = 0;
+    ok = file.read((uint8_t*)&len, sizeof(len)) == (int)sizeof(len) && len > 0 && len <= sizeof(encoded) &&
+         file.read(encoded, len) == (int)len &&
+         PackBits::decode(encoded, len, frameBuffer + band * BAND_SIZE, BAND_SIZE);
+  }
+  file.close();
+
+  // One-shot: a stale frame must never be used as the baseline after the panel has changed
+  SdMan.remove(RESUME_PATH);
+
+  if (!ok) {
+    DBG_PRINTLN("resumeStateRestore: invalid resume file, ignoring");
+    SdMan.sleep();
+    return false;
+  }
+
+  if (header.state == (uint8_t)UIState::TEXT_EDITOR) {
+    header.filename[MAX_FILENAME_LEN - 1] = '\0';
+    loadFile(header.filename);
+    if (strcmp(editorGetCurrentFile(), header.filename) == 0) {
+      editorSetCharsPerLine(header.charsPerLine);
+      editorSetVisibleLines(header.visibleLines);
+      editorRestoreView(header.cursorPosition, header.viewportStart);
+    }
+  }
+
+  SdMan.sleep();
+  DBG_PRINTF("Resumed from sleep (state %d)\n", (int)currentState);
+  return true;
+}
+
+void resumeStateDiscard() {
+  if (!SdMan.exists(RESUME_PATH)) return;
+  SdMan.remove(RESUME_PATH);
+  SdMan.sleep();
+  DBG_PRINTLN("Resume state dropped: not a wake from deep sleep");
+}
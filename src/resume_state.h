@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+
+// Instant resume after deep sleep.
+// The frame left on the panel at sleep (the sleep screen) is saved to SD in compressed form together
+// with the editor state. On wake it is loaded back into the controller RAM (HalDisplay::writeBaseline) and
+// the panel is powered up (HalDisplay::powerOn), so the first screen update is a fast differential refresh
+// instead of a blank full refresh.
+
+// Save the frame buffer and UI state. Call after the sleep screen has been displayed.
+void resumeStateSave(const uint8_t* frameBuffer);
+
+// Decode the saved frame into `frameBuffer` and restore the UI state (reopens the note that was being
+// edited). The saved state is consumed. Returns false if there is nothing valid to resume from.
+bool resumeStateRestore(uint8_t* frameBuffer);
+
+// Drop the saved state without using it, for boots that are not a wake from deep sleep
+void resumeStateDiscard();
@@ -0,0 +1,643 @@
+#include "search_index.h"
+#include "note_index.h"
+#include <Arduino.h>
+#include <SDCardManager.h>
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+static const char* SEARCH_DIR = "/notes/.search";
+static const char* TABLE_PATH = "/notes/.search/notes";
+static constexpr uint32_t SEARCH_MAGIC = 0x5346534D;  // "MSFS"
+static constexpr uint16_t SEARCH_VERSION = 1;
+static constexpr int BUCKET_COUNT = 28;
+static constexpr int MIN_WORD = 2;
+static constexpr int MAX_WORD = 31;
+static constexpr size_t POSTING_HEADER = 9;
+static constexpr int SEEN_SLOTS = 2048;                // Distinct words tracked per note (dedup only)
+static constexpr uint16_t NO_ENTRY = 0xFFFF;
+static constexpr uint32_t MAX_OFFSET = 0xFFFE;         // Queries keep offset + 1 in a u16
+static_assert(SEARCH_BUFFER_SIZE < NO_ENTRY, "Posting positions are stored as u16");
+
+struct TableHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t recordSize;
+  uint32_t count;
+  uint32_t nextVersion;
+  uint32_t liveBytes;
+  uint32_t staleBytes;
+  uint32_t bucketBytes[BUCKET_COUNT];
+};
+
+struct NoteRecord {
+  char filename[MAX_FILENAME_LEN];
+  uint32_t version;
+  uint32_t crc;
+  uint32_t bytes;  // Postings of this version
+};
+static_assert(sizeof(TableHeader) == 136, "Search table header layout");
+
+struct Posting {
+  uint32_t version;
+  uint16_t id;
+  uint16_t offset;
+  uint8_t wordLen;
+  char word[MAX_WORD + 1];
+};
+
+// --- Helpers ---
+
+static bool isWordByte(uint8_t c) { return isalnum(c) || c >= 0x80; }
+
+static int bucketOf(uint8_t c) {
+  if (c >= 'a' && c <= 'z') return c - 'a';
+  if (c >= '0' && c <= '9') return 26;
+  return 27;
+}
+
+static void bucketPath(int bucket, char* out, size_t outLen, const char* suffix = "") {
+  const char name = bucket < 26 ? 'a' + bucket : (bucket == 26 ? '0' : '_');
+  snprintf(out, outLen, "%s/%c%s", SEARCH_DIR, name, suffix);
+}
+
+static uint32_t recordOffset(uint32_t id) { return sizeof(TableHeader) + id * sizeof(NoteRecord); }
+
+static bool readHeader(FsFile& table, TableHeader* header) {
+  return table.seekSet(0) && table.read((uint8_t*)header, sizeof(*header)) == (int)sizeof(*header) &&
+         header->magic == SEARCH_MAGIC && header->version == SEARCH_VERSION &&
+         header->recordSize == sizeof(NoteRecord) && table.size() == recordOffset(header->count);
+}
+
+static bool writeHeader(FsFile& table, const TableHeader& header) {
+  return table.seekSet(0) && table.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+}
+
+static bool readNote(FsFile& table, uint32_t id, NoteRecord* note) {
+  if (!table.seekSet(recordOffset(id)) || table.read((uint8_t*)note, sizeof(*note)) != (int)sizeof(*note)) {
+    return false;
+  }
+  note->filename[MAX_FILENAME_LEN - 1] = '\0';
+  return true;
+}
+
+static bool writeNote(FsFile& table, uint32_t id, const NoteRecord& note) {
+  return table.seekSet(recordOffset(id)) && table.write((const uint8_t*)&note, sizeof(note)) == sizeof(note);
+}
+
+// Open the note table; a missing or invalid one starts the index over (old buckets are cut by their length 0)
+static FsFile openTable(TableHeader* header) {
+  if (!SdMan.exists(SEARCH_DIR)) SdMan.mkdir(SEARCH_DIR);
+  auto table = SdMan.open(TABLE_PATH, O_RDWR | O_CREAT);
+  if (table && !readHeader(table, header)) {
+    DBG_PRINTLN("searchIndex: starting a new index");
+    memset(header, 0, sizeof(*header));
+    header->magic = SEARCH_MAGIC;
+    header->version = SEARCH_VERSION;
+    header->recordSize = sizeof(NoteRecord);
+    header->nextVersion = 1;
+    if (!table.truncate(0) || !writeHeader(table, *header)) table.close();
+  }
+  return table;
+}
+
+// Id of a live note (its record in note), -1 if not indexed
+static int findNote(FsFile& table, const TableHeader& header, const char* filename, NoteRecord* note) {
+  table.seekSet(sizeof(TableHeader));
+  for (uint32_t id = 0; id < header.count; id++) {
+    if (table.read((uint8_t*)note, sizeof(*note)) != (int)sizeof(*note)) break;
+    note->filename[MAX_FILENAME_LEN - 1] = '\0';
+    if (note->version != 0 && strcmp(note->filename, filename) == 0) return (int)id;
+  }
+  return -1;
+}
+
+// Sequential reader for a bucket, up to its committed length
+struct PostingReader {
+  FsFile file;
+  uint32_t remaining = 0;
+  uint8_t buf[512 + POSTING_HEADER + MAX_WORD];
+  size_t len = 0;
+  size_t pos = 0;
+};
+
+static bool openBucket(PostingReader& reader, int bucket, uint32_t committed) {
+  char path[48];
+  bucketPath(bucket, path, sizeof(path));
+  reader.file = SdMan.open(path, O_RDONLY);
+  if (!reader.file) return false;
+  reader.remaining = std::min<uint32_t>(committed, reader.file.size());
+  reader.len = reader.pos = 0;
+  return true;
+}
+
+// Raw entry (header + word) at reader.buf + reader.pos, or false at the end
+static const uint8_t* nextEntry(PostingReader& reader, Posting* posting, size_t* entryLen) {
+  if (reader.len - reader.pos < POSTING_HEADER + MAX_WORD && reader.remaining > 0) {
+    memmove(reader.buf, reader.buf + reader.pos, reader.len - reader.pos);
+    reader.len -= reader.pos;
+    reader.pos = 0;
+    const size_t want = std::min<size_t>(sizeof(reader.buf) - reader.len, reader.remaining);
+    const int n = reader.file.read(reader.buf + reader.len, want);
+    if (n <= 0) {
+      reader.remaining = 0;
+    } else {
+      reader.len += n;
+      reader.remaining -= n;
+    }
+  }
+  if (reader.len - reader.pos < POSTING_HEADER) return nullptr;
+
+  const uint8_t* entry = reader.buf + reader.pos;
+  memcpy(&posting->version, entry, 4);
+  memcpy(&posting->id, entry + 4, 2);
+  memcpy(&posting->offset, entry + 6, 2);
+  posting->wordLen = entry[8];
+  if (posting->wordLen > MAX_WORD || reader.len - reader.pos < POSTING_HEADER + posting->wordLen) return nullptr;
+  memcpy(posting->word, entry + POSTING_HEADER, posting->wordLen);
+  posting->word[posting->wordLen] = '\0';
+  *entryLen = POSTING_HEADER + posting->wordLen;
+  reader.pos += *entryLen;
+  return entry;
+}
+
+// --- Indexer (save task) ---
+// Postings are collected in RAM and appended to the buckets when the buffer fills and at the end
+
+static bool indexing = false;
+static bool indexFailed = false;
+static TableHeader indexHeader;               // Header as of searchIndexBegin; bucketBytes track our appends
+static NoteRecord indexNote;
+static uint32_t indexId = 0;
+static uint32_t indexBytes = 0;
+static uint8_t* postings = nullptr;
+static size_t postingsLen = 0;
+static uint32_t* seen = nullptr;              // Open addressing set of word hashes (0 = empty)
+static uint16_t* seenEntry = nullptr;         // Where that word's posting is in `postings`, NO_ENTRY once flushed
+static int seenCount = 0;
+static char word[MAX_WORD + 1];
+static int wordLen = 0;
+static uint32_t wordStart = 0;
+static uint32_t textPos = 0;
+
+static void flushPostings() {
+  for (int bucket = 0; bucket < BUCKET_COUNT && !indexFailed; bucket++) {
+    FsFile file;
+    for (size_t offset = 0; offset < postingsLen;) {
+      const size_t entryLen = POSTING_HEADER + postings[offset + 8];
+      if (bucketOf(postings[offset + POSTING_HEADER]) == bucket) {
+        if (!file) {
+          char path[48];
+          bucketPath(bucket, path, sizeof(path));
+          file = SdMan.open(path, O_RDWR | O_CREAT);
+          // Cut whatever follows the committed postings (torn append, aborted save)
+          uint32_t& committed = indexHeader.bucketBytes[bucket];
+          if (!file) {
+            indexFailed = true;
+            break;
+          }
+          if (file.size() > committed) file.truncate(committed);
+          if (file.size() < committed) committed = file.size();
+          file.seekSet(committed);
+        }
+        if (file.write(postings + offset, entryLen) != entryLen) {
+          indexFailed = true;
+          break;
+        }
+        indexHeader.bucketBytes[bucket] += entryLen;
+        indexBytes += entryLen;
+      }
+      offset += entryLen;
+    }
+    if (file) file.close();
+  }
+  postingsLen = 0;
+  memset(seenEntry, 0xFF, SEEN_SLOTS * sizeof(uint16_t));
+}
+
+// The posting at `entry` in the buffer is the current word
+static bool isCurrentWord(uint16_t entry, int len) {
+  return entry != NO_ENTRY && postings[entry + 8] == len && memcmp(postings + entry + POSTING_HEADER, word, len) == 0;
+}
+
+static void endWord() {
+  const int len = wordLen;
+  wordLen = 0;
+  if (len < MIN_WORD) return;
+
+  // Only the first occurrence of a word is stored. A hash hit is confirmed against the posting in the buffer;
+  // a different word with the same hash gets its own slot, and a word whose posting was flushed already is
+  // stored again (queries keep the first offset per note).
+  uint32_t hash = 2166136261u;
+  for (int i = 0; i < len; i++) hash = (hash ^ (uint8_t)word[i]) * 16777619u;
+  if (hash == 0) hash = 1;
+  int slot = -1;
+  if (seenCount < SEEN_SLOTS * 3 / 4) {
+    slot = hash % SEEN_SLOTS;
+    for (; seen[slot] != 0; slot = (slot + 1) % SEEN_SLOTS) {
+      if (seen[slot] != hash) continue;
+      if (seenEntry[slot] == NO_ENTRY) break;  // Flushed: cannot be confirmed, this slot takes the new posting
+      if (isCurrentWord(seenEntry[slot], len)) return;
+    }
+    if (seen[slot] == 0) {
+      seen[slot] = hash;
+      seenCount++;
+    }
+  }
+
+  if (postingsLen + POSTING_HEADER + len > SEARCH_BUFFER_SIZE) flushPostings();
+  if (slot >= 0) seenEntry[slot] = (uint16_t)postingsLen;
+  uint8_t* entry = postings + postingsLen;
+  const uint16_t id = (uint16_t)indexId;
+  const uint16_t offset = (uint16_t)std::min(wordStart, MAX_OFFSET);  // Notes over 64 KB come from a PC
+  memcpy(entry, &indexNote.version, 4);
+  memcpy(entry + 4, &id, 2);
+  memcpy(entry + 6, &offset, 2);
+  entry[8] = (uint8_t)len;
+  memcpy(entry + POSTING_HEADER, word, len);
+  postingsLen += POSTING_HEADER + len;
+}
+
+bool searchIndexBegin(const char* filename) {
+  TableHeader header;
+  auto table = openTable(&header);
+  if (!table) return false;
+
+  NoteRecord note;
+  int id = findNote(table, header, filename, &note);
+  if (id < 0) {
+    // New note: take the id of a deleted one, or a new record at the end
+    id = (int)header.count;
+    table.seekSet(sizeof(TableHeader));
+    for (uint32_t i = 0; i < header.count; i++) {
+      if (table.read((uint8_t*)&note, sizeof(note)) != (int)sizeof(note)) break;
+      if (note.version == 0) {
+        id = (int)i;
+        break;
+      }
+    }
+  }
+
+  // Versions are never reused, so postings of an aborted save can never become live
+  const uint32_t version = header.nextVersion++;
+  const bool ok = id <= UINT16_MAX && writeHeader(table, header);
+  table.close();
+  if (!ok) return false;
+
+  postings = (uint8_t*)malloc(SEARCH_BUFFER_SIZE);
+  seen = (uint32_t*)calloc(SEEN_SLOTS, sizeof(uint32_t));
+  seenEntry = (uint16_t*)malloc(SEEN_SLOTS * sizeof(uint16_t));
+  if (!postings || !seen || !seenEntry) {
+    free(postings);
+    free(seen);
+    free(seenEntry);
+    postings = nullptr;
+    seen = nullptr;
+    seenEntry = nullptr;
+    return false;
+  }
+
+  indexHeader = header;
+  memset(&indexNote, 0, sizeof(indexNote));
+  strncpy(indexNote.filename, filename, MAX_FILENAME_LEN - 1);
+  indexNote.version = version;
+  indexId = (uint32_t)id;
+  indexBytes = 0;
+  postingsLen = 0;
+  seenCount = 0;
+  memset(seenEntry, 0xFF, SEEN_SLOTS * sizeof(uint16_t));
+  wordLen = 0;
+  textPos = 0;
+  indexFailed = false;
+  indexing = true;
+  return true;
+}
+
+void searchIndexFeed(const char* text, size_t len) {
+  if (!indexing) return;
+  for (size_t i = 0; i < len; i++, textPos++) {
+    const uint8_t c = (uint8_t)text[i];
+    if (isWordByte(c)) {
+      if (wordLen == 0) wordStart = textPos;
+      if (wordLen < MAX_WORD) word[wordLen++] = (char)tolower(c);
+    } else if (wordLen > 0) {
+      endWord();
+    }
+  }
+}
+
+static void compact(FsFile& table, TableHeader& header);
+
+void searchIndexEnd(bool saved, uint32_t crc) {
+  if (!indexing) return;
+  indexing = false;
+  if (saved && wordLen > 0) endWord();
+  if (saved && !indexFailed) flushPostings();
+  free(postings);
+  free(seen);
+  free(seenEntry);
+  postings = nullptr;
+  seen = nullptr;
+  seenEntry = nullptr;
+  if (!saved || indexFailed) return;  // Bucket lengths stay as committed: the new postings are dropped
+
+  TableHeader header;
+  auto table = SdMan.open(TABLE_PATH, O_RDWR);
+  if (!table || !readHeader(table, &header)) {
+    if (table) table.close();
+    return;
+  }
+
+  NoteRecord old;
+  if (indexId < header.count && readNote(table, indexId, &old) && old.version != 0) {
+    header.liveBytes -= std::min(header.liveBytes, old.bytes);
+    header.staleBytes += old.bytes;
+  }
+  indexNote.crc = crc;
+  indexNote.bytes = indexBytes;
+  header.liveBytes += indexBytes;
+  if (indexId >= header.count) header.count = indexId + 1;
+  memcpy(header.bucketBytes, indexHeader.bucketBytes, sizeof(header.bucketBytes));
+
+  // Record first: the header commits the new bucket lengths, and with them the postings
+  if (writeNote(table, indexId, indexNote) && writeHeader(table, header)) {
+    if (header.staleBytes > SEARCH_COMPACT_MIN_BYTES && header.staleBytes > header.liveBytes) {
+      compact(table, header);
+    }
+  }
+  table.close();
+}
+
+// Drop the postings of old versions: each bucket is rewritten to a copy that replaces it
+static void compact(FsFile& table, TableHeader& header) {
+  uint32_t* versions = (uint32_t*)malloc(header.count * sizeof(uint32_t) + 1);
+  if (!versions) return;
+  NoteRecord note;
+  for (uint32_t id = 0; id < header.count; id++) {
+    versions[id] = readNote(table, id, &note) ? note.version : 0;
+  }
+
+  PostingReader* reader = new (std::nothrow) PostingReader();
+  if (!reader) {
+    free(versions);
+    return;
+  }
+  uint32_t before = 0, after = 0;
+  for (int bucket = 0; bucket < BUCKET_COUNT; bucket++) {
+    if (header.bucketBytes[bucket] == 0 || !openBucket(*reader, bucket, header.bucketBytes[bucket])) continue;
+    char path[48], tmpPath[48];
+    bucketPath(bucket, path, sizeof(path));
+    bucketPath(bucket, tmpPath, sizeof(tmpPath), ".tmp");
+    auto out = SdMan.open(tmpPath, O_WRONLY | O_CREAT | O_TRUNC);
+    if (!out) {
+      reader->file.close();
+      continue;
+    }
+
+    Posting posting;
+    size_t entryLen;
+    uint32_t kept = 0;
+    bool ok = true;
+    const uint8_t* entry;
+    while (ok && (entry = nextEntry(*reader, &posting, &entryLen)) != nullptr) {
+      if (posting.id < header.count && posting.version == versions[posting.id]) {
+        ok = out.write(entry, entryLen) == entryLen;
+        kept += entryLen;
+      }
+    }
+    reader->file.close();
+    out.close();
+    if (!ok) {
+      SdMan.remove(tmpPath);
+      continue;
+    }
+    SdMan.remove(path);
+    SdMan.rename(tmpPath, path);
+    before += header.bucketBytes[bucket];
+    after += kept;
+    header.bucketBytes[bucket] = kept;
+  }
+  delete reader;
+  free(versions);
+
+  header.staleBytes = 0;
+  header.liveBytes = 0;
+  for (int bucket = 0; bucket < BUCKET_COUNT; bucket++) header.liveBytes += header.bucketBytes[bucket];
+  writeHeader(table, header);
+  DBG_PRINTF("searchIndex: compacted %u -> %u bytes\n", (unsigned)before, (unsigned)after);
+}
+
+// --- File manager hooks ---
+
+void searchIndexRename(const char* oldName, const char* newName) {
+  TableHeader header;
+  auto table = SdMan.open(TABLE_PATH, O_RDWR);
+  if (!table) return;
+  NoteRecord note;
+  int id = readHeader(table, &header) ? findNote(table, header, oldName, &note) : -1;
+  if (id >= 0) {
+    memset(note.filename, 0, sizeof(note.filename));
+    strncpy(note.filename, newName, MAX_FILENAME_LEN - 1);
+    writeNote(table, id, note);
+  }
+  table.close();
+}
+
+void searchIndexRemove(const char* filename) {
+  TableHeader header;
+  auto table = SdMan.open(TABLE_PATH, O_RDWR);
+  if (!table) return;
+  NoteRecord note;
+  int id = readHeader(table, &header) ? findNote(table, header, filename, &note) : -1;
+  if (id >= 0) {
+    header.liveBytes -= std::min(header.liveBytes, note.bytes);
+    header.staleBytes += note.bytes;
+    note.version = 0;
+    if (writeNote(table, id, note)) writeHeader(table, header);
+  }
+  table.close();
+}
+
+// --- Refresh and queries (main task) ---
+
+static bool indexFile(const char* filename, uint32_t crc) {
+  char path[320];
+  snprintf(path, sizeof(path), "/notes/%s", filename);
+  auto file = SdMan.open(path, O_RDONLY);
+  if (!file) return false;
+  if (!searchIndexBegin(filename)) {
+    file.close();
+    return false;
+  }
+  char chunk[512];
+  int n;
+  while ((n = file.read(chunk, sizeof(chunk))) > 0) searchIndexFeed(chunk, n);
+  file.close();
+  searchIndexEnd(n == 0, crc);
+  return n == 0;
+}
+
+int searchIndexRefresh() {
+  TableHeader header;
+  auto table = openTable(&header);
+  if (!table) return 0;
+
+  // Table in RAM for the comparison: filename hash and CRC of every live note
+  const uint32_t count = header.count;
+  uint32_t* hashes = (uint32_t*)malloc(count * sizeof(uint32_t) + 1);
+  uint32_t* crcs = (uint32_t*)malloc(count * sizeof(uint32_t) + 1);
+  uint8_t* listed = (uint8_t*)calloc(count + 1, 1);
+  const int total = noteIndexCount();
+  uint8_t* stale = (uint8_t*)calloc(total + 1, 1);  // Per note list entry: missing from the index or changed
+  if (!hashes || !crcs || !listed || !stale) {
+    free(hashes);
+    free(crcs);
+    free(listed);
+    free(stale);
+    table.close();
+    return 0;
+  }
+  NoteRecord note;
+  for (uint32_t id = 0; id < count; id++) {
+    hashes[id] = 0;
+    if (!readNote(table, id, &note) || note.version == 0) continue;
+    uint32_t hash = 2166136261u;
+    for (const char* p = note.filename; *p; p++) hash = (hash ^ (uint8_t)*p) * 16777619u;
+    hashes[id] = hash | 1;
+    crcs[id] = note.crc;
+  }
+
+  // Match the note list against the table. A hash only picks candidates: each record is taken once, and only
+  // if its filename is the note's, so two names with the same hash each keep their own entry.
+  FileInfo batch[8];
+  for (int first = 0; first < total; first += 8) {
+    const int n = noteIndexRead(first, batch, 8);
+    for (int i = 0; i < n; i++) {
+      uint32_t hash = 2166136261u;
+      for (const char* p = batch[i].filename; *p; p++) hash = (hash ^ (uint8_t)*p) * 16777619u;
+      hash |= 1;
+
+      bool current = false;
+      for (uint32_t id = 0; id < count; id++) {
+        if (hashes[id] != hash || listed[id]) continue;
+        if (!readNote(table, id, &note) || strcmp(note.filename, batch[i].filename) != 0) continue;
+        listed[id] = 1;
+        current = crcs[id] == batch[i].crc;
+        break;
+      }
+      stale[first + i] = !current;
+    }
+  }
+  table.close();
+
+  // Notes missing from the index or changed since they were indexed (indexFile rewrites the table)
+  int indexed = 0;
+  for (int first = 0; first < total; first += 8) {
+    const int n = noteIndexRead(first, batch, 8);
+    for (int i = 0; i < n; i++) {
+      if (stale[first + i] && indexFile(batch[i].filename, batch[i].crc)) indexed++;
+    }
+  }
+
+  // Notes that are gone (deleted on a PC)
+  table = SdMan.open(TABLE_PATH, O_RDWR);
+  if (table && readHeader(table, &header)) {
+    for (uint32_t id = 0; id < count; id++) {
+      if (hashes[id] == 0 || listed[id] || !readNote(table, id, &note)) continue;
+      header.liveBytes -= std::min(header.liveBytes, note.bytes);
+      header.staleBytes += note.bytes;
+      note.version = 0;
+      writeNote(table, id, note);
+    }
+    writeHeader(table, header);
+  }
+  if (table) table.close();
+
+  free(hashes);
+  free(crcs);
+  free(listed);
+  free(stale);
+  DBG_PRINTF("searchIndex: %d notes indexed\n", indexed);
+  return indexed;
+}
+
+int searchQuery(const char* query, SearchHit* hits, int maxHits) {
+  TableHeader header;
+  auto table = SdMan.open(TABLE_PATH, O_RDONLY);
+  if (!table) return 0;
+  if (!readHeader(table, &header) || header.count == 0) {
+    table.close();
+    return 0;
+  }
+
+  const uint32_t count = header.count;
+  uint32_t* versions = (uint32_t*)malloc(count * sizeof(uint32_t));
+  uint16_t* best = (uint16_t*)malloc(count * sizeof(uint16_t));     // First offset + 1 per note, 0 = no match
+  uint16_t* current = (uint16_t*)malloc(count * sizeof(uint16_t));
+  PostingReader* reader = new (std::nothrow) PostingReader();
+  bool ok = versions && best && current && reader;
+  NoteRecord note;
+  for (uint32_t id = 0; ok && id < count; id++) {
+    versions[id] = readNote(table, id, &note) ? note.version : 0;
+  }
+
+  int terms = 0;
+  const char* p = query;
+  while (ok && *p) {
+    // Next term: a run of word characters, '*' right after it makes it a prefix
+    while (*p && !isWordByte((uint8_t)*p)) p++;
+    char term[MAX_WORD + 1];
+    int termLen = 0;
+    while (*p && isWordByte((uint8_t)*p)) {
+      if (termLen < MAX_WORD) term[termLen++] = (char)tolower((uint8_t)*p);
+      p++;
+    }
+    const bool prefix = *p == '*';
+    if (termLen == 0) continue;
+    term[termLen] = '\0';
+
+    memset(current, 0, count * sizeof(uint16_t));
+    const int bucket = bucketOf((uint8_t)term[0]);
+    if (header.bucketBytes[bucket] > 0 && openBucket(*reader, bucket, header.bucketBytes[bucket])) {
+      Posting posting;
+      size_t entryLen;
+      while (nextEntry(*reader, &posting, &entryLen)) {
+        if (posting.id >= count || posting.version != versions[posting.id]) continue;
+        if (prefix ? (posting.wordLen < termLen || memcmp(posting.word, term, termLen) != 0)
+                   : (posting.wordLen != termLen || memcmp(posting.word, term, termLen) != 0)) {
+          continue;
+        }
+        const uint16_t at = posting.offset + 1;
+        if (current[posting.id] == 0 || at < current[posting.id]) current[posting.id] = at;
+      }
+      reader->file.close();
+    }
+
+    // Every term must match: keep the offset of the first term
+    for (uint32_t id = 0; id < count; id++) {
+      if (terms == 0) {
+        best[id] = current[id];
+      } else if (current[id] == 0) {
+        best[id] = 0;
+      }
+    }
+    terms++;
+  }
+
+  int hitCount = 0;
+  for (uint32_t id = 0; ok && terms > 0 && id < count && hitCount < maxHits; id++) {
+    if (best[id] == 0 || !readNote(table, id, &note)) continue;
+    strcpy(hits[hitCount].filename, note.filename);
+    hits[hitCount].offset = best[id] - 1;
+    hitCount++;
+  }
+  table.close();
+
+  free(versions);
+  free(best);
+  free(current);
+  delete reader;
+  return hitCount;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "config.h"
+
+// Full-text search over all notes, with an inverted index on the card in /notes/.search/.
+// Every word of a note (ASCII letters and digits, UTF-8 sequences, 2+ characters, lowercased) is stored once with
+// its first offset. Postings are appended to one of 28 bucket files chosen by the first character of the word
+// (a-z, digits, other), so a query reads a single bucket per term instead of the notes themselves.
+//
+// Saving a note appends its postings under a new version number; the note table maps each note to its live
+// version, and postings of older versions are skipped by queries and dropped when the index is compacted.
+//
+//   notes    header 136 bytes: magic "MSFS", version (u16), record size (u16), count, next version, live bytes,
+//            stale bytes, committed length of each bucket (28) (u32 each);
+//            records {filename (fixed char array), version, crc, bytes (u32 each)}, the record number is the
+//            note id (version 0 = deleted, the id is reused)
+//   a..z, 0, _   postings {version (u32), note id (u16), offset (u16), word length (u8), word}
+// Bucket bytes past the committed length (a torn append, an aborted save) are ignored and cut on the next append.
+
+// Save task: index the note while it is written. Feed it the whole content in order; End commits the postings
+// if the note was saved (crc = CRC32 of the content) and compacts the index when it holds too many stale ones.
+bool searchIndexBegin(const char* filename);  // False if indexing is not possible (no memory, no card)
+void searchIndexFeed(const char* text, size_t len);
+void searchIndexEnd(bool saved, uint32_t crc);
+
+void searchIndexRename(const char* oldName, const char* newName);
+void searchIndexRemove(const char* filename);
+
+// Index the notes the index does not cover yet (new, edited on a PC) and forget deleted ones.
+// Returns the number of notes indexed.
+int searchIndexRefresh();
+
+// Notes containing every term of the query. A term matches whole words; a trailing '*' makes it a prefix
+// ("pro*" matches "project"). Returns the number of hits, offset = first match of the first term.
+int searchQuery(const char* query, SearchHit* hits, int maxHits);
@@ -1,4 +1,7 @@
 #include "text_editor.h"
+#include "edit_journal.h"
+#include "buffer_snapshot.h"
+#include <esp_rom_crc.h>
 #include <cstring>
 #include <algorithm>
 
@@ -7,6 +10,15 @@ static char textBuffer[TEXT_BUFFER_SIZE];
 static size_t textLength = 0;
 static int cursorPosition = 0;
 
+// --- Content CRC ---
+// crcPrefix[k] is the CRC32 of the first k blocks of the buffer, valid for k <= crcValidBlocks. An edit only
+// invalidates the prefixes past it, so after typing at the end of a note just the last block is hashed again.
+static constexpr size_t CRC_BLOCK = 512;
+static uint32_t crcPrefix[TEXT_BUFFER_SIZE / CRC_BLOCK + 1];
+static size_t crcValidBlocks = 0;
+
+static void invalidateCrcFrom(size_t pos) { crcValidBlocks = std::min(crcValidBlocks, pos / CRC_BLOCK); }
+
 // --- File metadata ---
 static char currentFile[MAX_FILENAME_LEN] = "";
 static char currentTitle[MAX_TITLE_LEN] = "Untitled";
@@ -101,6 +113,7 @@ static void ensureCursorVisible(int visibleLines) {
 }
 
 void editorInit() {
+  invalidateCrcFrom(0);
   memset(textBuffer, 0, TEXT_BUFFER_SIZE);
   textLength = 0;
   cursorPosition = 0;
@@ -113,6 +126,7 @@ void editorInit() {
 }
 
 void editorClear() {
+  invalidateCrcFrom(0);
   memset(textBuffer, 0, TEXT_BUFFER_SIZE);
   textLength = 0;
   cursorPosition = 0;
@@ -123,6 +137,7 @@ void editorClear() {
 }
 
 void editorLoadBuffer(size_t length) {
+  invalidateCrcFrom(0);
   textLength = length;
   textBuffer[textLength] = '\0';
   cursorPosition = (int)textLength;  // Start at end
@@ -135,16 +150,31 @@ void editorLoadBuffer(size_t length) {
 
 char* editorGetBuffer() { return textBuffer; }
 size_t editorGetLength() { return textLength; }
+
+uint32_t editorGetContentCrc() {
+  const size_t fullBlocks = textLength / CRC_BLOCK;
+  for (; crcValidBlocks < fullBlocks; crcValidBlocks++) {
+    crcPrefix[crcValidBlocks + 1] = esp_rom_crc32_le(crcPrefix[crcValidBlocks],
+                                                     (const uint8_t*)textBuffer + crcValidBlocks * CRC_BLOCK, CRC_BLOCK);
+  }
+  crcValidBlocks = fullBlocks;
+  return esp_rom_crc32_le(crcPrefix[fullBlocks], (const uint8_t*)textBuffer + fullBlocks * CRC_BLOCK,
+                          textLength - fullBlocks * CRC_BLOCK);
+}
 int editorGetCursorPosition() { return cursorPosition; }
 
 void editorInsertChar(char c) {
   if (textLength >= TEXT_BUFFER_SIZE - 1) return;
 
+  snapshotPreserve(cursorPosition);  // A background save may still be reading the tail
+  invalidateCrcFrom(cursorPosition);
+
   // Shift text right
   for (int i = (int)textLength; i > cursorPosition; i--) {
     textBuffer[i] = textBuffer[i - 1];
   }
   textBuffer[cursorPosition] = c;
+  journalRecordInsert(cursorPosition, c);
   cursorPosition++;
   textLength++;
   textBuffer[textLength] = '\0';
@@ -158,9 +188,12 @@ void editorInsertChar(char c) {
 void editorDeleteChar() {
   if (cursorPosition <= 0 || textLength == 0) return;
 
+  snapshotPreserve(cursorPosition - 1);
+  invalidateCrcFrom(cursorPosition - 1);
   for (int i = cursorPosition - 1; i < (int)textLength - 1; i++) {
     textBuffer[i] = textBuffer[i + 1];
   }
+  journalRecordDelete(cursorPosition - 1, 1);
   cursorPosition--;
   textLength--;
   textBuffer[textLength] = '\0';
@@ -174,9 +207,12 @@ void editorDeleteChar() {
 void editorDeleteForward() {
   if (cursorPosition >= (int)textLength) return;
 
+  snapshotPreserve(cursorPosition);
+  invalidateCrcFrom(cursorPosition);
   for (int i = cursorPosition; i < (int)textLength - 1; i++) {
     textBuffer[i] = textBuffer[i + 1];
   }
+  journalRecordDelete(cursorPosition, 1);
   textLength--;
   textBuffer[textLength] = '\0';
   unsavedChanges = true;
@@ -283,6 +319,13 @@ int editorGetLinePosition(int lineIndex) {
   return linePositions[lineIndex];
 }
 
+void editorRestoreView(int cursorPos, int viewportStart) {
+  cursorPosition = std::max(0, std::min(cursorPos, (int)textLength));
+  editorRecalculateLines();
+  viewportStartLine = std::max(0, std::min(viewportStart, lineCount - 1));
+  ensureCursorVisible(storedVisibleLines);
+}
+
 void editorSetCurrentFile(const char* filename) {
   strncpy(currentFile, filename, MAX_FILENAME_LEN - 1);
   currentFile[MAX_FILENAME_LEN - 1] = '\0';
@@ -9,6 +9,7 @@ void editorLoadBuffer(size_t length);  // After filling buffer externally, set l
 // Buffer access
 char* editorGetBuffer();
 size_t editorGetLength();
+uint32_t editorGetContentCrc();  // CRC32 of the buffer, as saved; rehashes only from the first edit since the last call
 int editorGetCursorPosition();
 
 // Editing operations
@@ -35,6 +36,7 @@ int editorGetCursorLine();
 int editorGetCursorCol();
 int editorGetLineCount();
 int editorGetLinePosition(int lineIndex);
+void editorRestoreView(int cursorPos, int viewportStart);  // Clamped to the loaded buffer
 
 // File metadata
 void editorSetCurrentFile(const char* filename);
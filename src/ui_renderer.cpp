@@ -4,19 +4,28 @@
 #include "file_manager.h"
 #include "ble_keyboard.h"
 #include "wifi_sync.h"
+#include "font_registry.h"
 
 #include <GfxRenderer.h>
 #include <HalGPIO.h>
 #include <HalDisplay.h>
-#include <EpdFont.h>
 #include <EpdFontFamily.h>
 
+#include <algorithm>
+#include <vector>
+
 // External variables
 extern bool autoReconnectEnabled;
 extern bool darkMode;
 extern bool cleanMode;
 extern bool deleteConfirmPending;
 extern WritingMode writingMode;
+extern bool saveFailed;
+extern BodyFont bodyFont;
+
+// Screens are always drawn in normal polarity. Dark mode is applied by the display driver while the
+// frame is sent to the panel (GfxRenderer::setInverted), so it costs nothing at draw time.
+static constexpr bool tc = true;  // text color
 
 // External functions
 bool getStoredDevice(std::string& address, std::string& name);
@@ -24,27 +33,6 @@ uint32_t getCurrentPasskey();
 bool isDeviceScanning();
 uint32_t getScanAgeMs();
 
-// Font data includes
-#include <builtinFonts/notosans_14_regular.h>
-#include <builtinFonts/notosans_14_bold.h>
-#include <builtinFonts/notosans_12_regular.h>
-#include <builtinFonts/notosans_12_bold.h>
-#include <builtinFonts/ubuntu_10_regular.h>
-#include <builtinFonts/ubuntu_10_bold.h>
-
-// Font objects (file-scoped)
-static EpdFont ns14Regular(&notosans_14_regular);
-static EpdFont ns14Bold(&notosans_14_bold);
-static EpdFontFamily ns14Family(&ns14Regular, &ns14Bold);
-
-static EpdFont ns12Regular(&notosans_12_regular);
-static EpdFont ns12Bold(&notosans_12_bold);
-static EpdFontFamily ns12Family(&ns12Regular, &ns12Bold);
-
-static EpdFont u10Regular(&ubuntu_10_regular);
-static EpdFont u10Bold(&ubuntu_10_bold);
-static EpdFontFamily u10Family(&u10Regular, &u10Bold);
-
 // Extern shared state (defined in main.cpp)
 extern UIState currentState;
 extern int mainMenuSelection;
@@ -55,11 +43,18 @@ extern Orientation currentOrientation;
 extern int charsPerLine;
 extern char renameBuffer[];
 extern int renameBufferLen;
+extern char searchBuffer[];
+extern SearchHit searchHits[];
+extern int searchHitCount;
+extern int searchSelection;
+extern char historyFile[];
+extern HistoryVersion historyVersions[];
+extern int historyCount;
+extern int historySelection;
+extern bool historyRestoreFailed;
 
 void rendererSetup(GfxRenderer& renderer) {
-  renderer.insertFont(FONT_BODY, ns14Family);
-  renderer.insertFont(FONT_UI, ns12Family);
-  renderer.insertFont(FONT_SMALL, u10Family);
+  fontRegistrySetup(renderer);
 }
 
 // ---------------------------------------------------------------------------
@@ -67,6 +62,18 @@ void rendererSetup(GfxRenderer& renderer) {
 // exceeds screen width.  This is how crosspoint-reader prevents GFX errors.
 // ---------------------------------------------------------------------------
 
+// Width available to text drawn at (x, y): maxW, or up to a 5px right margin if maxW <= 0.
+// 0 if nothing may be drawn (empty text, origin off screen). Shared by every clipped draw helper.
+static int clipWidth(GfxRenderer& r, int x, int y, const char* text, int maxW) {
+  if (!text || !text[0]) return 0;
+  int sw = r.getScreenWidth();
+  int sh = r.getScreenHeight();
+  if (x < 0 || x >= sw || y < 0 || y >= sh) return 0;
+
+  if (maxW <= 0) maxW = sw - x - 5;   // 5px right margin
+  return maxW > 0 ? maxW : 0;
+}
+
 // Draw text that is guaranteed not to overflow the screen width.
 // maxW = available pixel width from x to right edge (caller computes).
 // Falls back to sw - x - 5 if maxW <= 0.
@@ -74,13 +81,8 @@ static void drawClippedText(GfxRenderer& r, int font, int x, int y,
                             const char* text, int maxW = 0,
                             bool black = true,
                             EpdFontFamily::Style style = EpdFontFamily::REGULAR) {
-  if (!text || !text[0]) return;
-  int sw = r.getScreenWidth();
-  int sh = r.getScreenHeight();
-  if (x < 0 || x >= sw || y < 0 || y >= sh) return;
-
-  if (maxW <= 0) maxW = sw - x - 5;   // 5px right margin
-  if (maxW <= 0) return;
+  maxW = clipWidth(r, x, y, text, maxW);
+  if (maxW == 0) return;
 
   auto clipped = r.truncatedText(font, text, maxW, style);
   if (!clipped.empty()) {
@@ -88,6 +90,18 @@ static void drawClippedText(GfxRenderer& r, int font, int x, int y,
   }
 }
 
+// Same as drawClippedText for strings that never change (literals, static tables): the renderer keeps them
+// pre-rendered, so redraws skip glyph lookup and rasterization.
+static void drawStaticLabel(GfxRenderer& r, int font, int x, int y,
+                            const char* text, int maxW = 0,
+                            bool black = true,
+                            EpdFontFamily::Style style = EpdFontFamily::REGULAR) {
+  maxW = clipWidth(r, x, y, text, maxW);
+  if (maxW == 0) return;
+
+  r.drawStaticText(font, x, y, text, maxW, black, style);
+}
+
 // Draw right-aligned text (e.g. battery %, RSSI, settings values).
 // Computes its own X from the measured text width.
 static void drawRightText(GfxRenderer& r, int font, int rightEdge, int y,
@@ -103,6 +117,25 @@ static void drawRightText(GfxRenderer& r, int font, int rightEdge, int y,
   drawClippedText(r, font, x, y, text, rightEdge - x, black, style);
 }
 
+// Draw a row measured by GfxRenderer::measureTexts — the list-screen counterpart of drawClippedText.
+// Rows are measured in one batch with maxWidth set to the space the row may use.
+static void drawMeasuredRow(GfxRenderer& r, int font, int x, int y,
+                            const GfxRenderer::TextMeasurement& m, bool black = true,
+                            EpdFontFamily::Style style = EpdFontFamily::REGULAR) {
+  if (x < 0 || x >= r.getScreenWidth() || y < 0 || y >= r.getScreenHeight()) return;
+  r.drawMeasuredText(font, x, y, m, black, style);
+}
+
+// Right-aligned variant (settings values, RSSI). Measure with maxWidth = rightEdge - 5: the same
+// placement drawRightText computes, without measuring again.
+static void drawMeasuredRight(GfxRenderer& r, int font, int rightEdge, int y,
+                              const GfxRenderer::TextMeasurement& m, bool black = true) {
+  if (!m.text || !m.text[0]) return;
+  int x = m.truncated ? 5 : rightEdge - (m.width > 0 ? m.width : 30);
+  if (x < 5) x = 5;
+  drawMeasuredRow(r, font, x, y, m, black);
+}
+
 // Safe line — just clamp to screen
 static void clippedLine(GfxRenderer& r, int x1, int y1, int x2, int y2,
                         bool state = true) {
@@ -136,7 +169,7 @@ static void drawBattery(GfxRenderer& renderer, HalGPIO& gpio) {
   int pct = gpio.getBatteryPercentage();
   char buf[8];
   snprintf(buf, sizeof(buf), "%d%%", pct);
-  drawRightText(renderer, FONT_SMALL, renderer.getScreenWidth() - 8, 5, buf, !darkMode);
+  drawRightText(renderer, FONT_SMALL, renderer.getScreenWidth() - 8, 5, buf, tc);
 }
 
 // Helper: draw BLE status
@@ -148,7 +181,7 @@ static void drawBleStatus(GfxRenderer& renderer, int x, int y) {
     case BLEState::CONNECTING:   status = "Connecting..."; break;
     case BLEState::DISCONNECTED: status = "KB Disconnected"; break;
   }
-  drawClippedText(renderer, FONT_SMALL, x, y, status, 0, !darkMode);
+  drawClippedText(renderer, FONT_SMALL, x, y, status, 0, tc);
 }
 
 // ===========================================================================
@@ -156,12 +189,19 @@ static void drawBleStatus(GfxRenderer& renderer, int x, int y) {
 // ===========================================================================
 
 void drawMainMenu(GfxRenderer& renderer, HalGPIO& gpio) {
+  // The menu only depends on this state, so returning to it can reuse the compressed frame
+  const uint32_t screenKey = (static_cast<uint32_t>('M') << 24) | (mainMenuSelection << 16) |
+                             (static_cast<uint32_t>(renderer.getOrientation()) << 12) |
+                             (static_cast<uint32_t>(getConnectionState()) << 8) |
+                             (gpio.getBatteryPercentage() & 0xFF);
+  if (renderer.restoreScreen(screenKey)) {
+    renderer.displayBuffer(HalDisplay::FAST_REFRESH);
+    return;
+  }
+
   renderer.clearScreen();
   int sw = renderer.getScreenWidth();
   int sh = renderer.getScreenHeight();
-  bool tc = !darkMode;  // text color
-
-  if (darkMode) clippedFillRect(renderer, 0, 0, sw, sh, true);
 
   // Title
   renderer.drawCenteredText(FONT_BODY, 30, "MicroSlate", tc, EpdFontFamily::BOLD);
@@ -172,9 +212,9 @@ void drawMainMenu(GfxRenderer& renderer, HalGPIO& gpio) {
     int yPos = 90 + (i * 45);
     if (i == mainMenuSelection) {
       clippedFillRect(renderer, 5, yPos - 5, sw - 10, 35, tc);
-      drawClippedText(renderer, FONT_UI, 20, yPos, menuItems[i], sw - 40, !tc);
+      drawStaticLabel(renderer, FONT_UI, 20, yPos, menuItems[i], sw - 40, !tc);
     } else {
-      drawClippedText(renderer, FONT_UI, 20, yPos, menuItems[i], sw - 40, tc);
+      drawStaticLabel(renderer, FONT_UI, 20, yPos, menuItems[i], sw - 40, tc);
     }
   }
 
@@ -182,11 +222,12 @@ void drawMainMenu(GfxRenderer& renderer, HalGPIO& gpio) {
   constexpr int bm = 60;
   if (sh > bm + 40) {
     clippedLine(renderer, 10, sh - bm, sw - 10, sh - bm, tc);
-    drawClippedText(renderer, FONT_SMALL, 20, sh - bm + 12, "Arrows: Navigate  Enter: Select", 0, tc);
+    drawStaticLabel(renderer, FONT_SMALL, 20, sh - bm + 12, "Arrows: Navigate  Enter: Select", 0, tc);
     drawBleStatus(renderer, 20, sh - bm + 28);
   }
   drawBattery(renderer, gpio);
 
+  renderer.storeScreen(screenKey);
   renderer.displayBuffer(HalDisplay::FAST_REFRESH);
 }
 
@@ -194,12 +235,12 @@ void drawFileBrowser(GfxRenderer& renderer, HalGPIO& gpio) {
   renderer.clearScreen();
   int sw = renderer.getScreenWidth();
   int sh = renderer.getScreenHeight();
-  bool tc = !darkMode;
 
-  if (darkMode) clippedFillRect(renderer, 0, 0, sw, sh, true);
-
-  // Header
-  drawClippedText(renderer, FONT_SMALL, 10, 5, "Notes", 0, tc, EpdFontFamily::BOLD);
+  // Header: title and sort order
+  drawStaticLabel(renderer, FONT_SMALL, 10, 5, "Notes", 0, tc, EpdFontFamily::BOLD);
+  static const char* const sortLabels[NOTE_SORT_COUNT] = {"Recent", "A-Z", "Size"};
+  const int sortX = 10 + renderer.getTextAdvanceX(FONT_SMALL, "Notes", EpdFontFamily::BOLD) + 10;
+  drawStaticLabel(renderer, FONT_SMALL, sortX, 5, sortLabels[static_cast<int>(getFileSort())], 0, tc);
   drawBattery(renderer, gpio);
   clippedLine(renderer, 5, 32, sw - 5, 32, tc);
 
@@ -214,29 +255,39 @@ void drawFileBrowser(GfxRenderer& renderer, HalGPIO& gpio) {
   }
 
   if (fc == 0) {
-    drawClippedText(renderer, FONT_UI, 20, listTop + 14, "No notes yet.", 0, tc);
-    drawClippedText(renderer, FONT_SMALL, 20, listTop + 36, "Press Ctrl+N to create one.", 0, tc);
+    drawStaticLabel(renderer, FONT_UI, 20, listTop + 14, "No notes yet.", 0, tc);
+    drawStaticLabel(renderer, FONT_SMALL, 20, listTop + 36, "Press Ctrl+N to create one.", 0, tc);
   }
 
-  FileInfo* files = getFileList();
-  for (int i = startIdx; i < fc && (i - startIdx) < maxVisible; i++) {
-    int yPos = listTop + (i - startIdx) * lineH;
+  // Measure every visible title in one pass, then draw. Only this page of the list is read from the index.
+  int rowCount = std::min(fc - startIdx, maxVisible);
+  const FileInfo* files = rowCount > 0 ? getFileWindow(startIdx, rowCount) : nullptr;
+  if (!files) rowCount = 0;
+  std::vector<GfxRenderer::TextMeasurement> rows(rowCount);
+  for (int row = 0; row < rowCount; row++) {
+    rows[row] = {files[row].title, sw - 30};
+  }
+  renderer.measureTexts(FONT_UI, rows.data(), rowCount);
+
+  for (int row = 0; row < rowCount; row++) {
+    int i = startIdx + row;
+    int yPos = listTop + row * lineH;
 
     if (i == selectedFileIndex) {
       clippedFillRect(renderer, 5, yPos - 3, sw - 10, lineH - 1, tc);
-      drawClippedText(renderer, FONT_UI, 15, yPos, files[i].title, sw - 30, !tc);
+      drawMeasuredRow(renderer, FONT_UI, 15, yPos, rows[row], !tc);
     } else {
-      drawClippedText(renderer, FONT_UI, 15, yPos, files[i].title, sw - 30, tc);
+      drawMeasuredRow(renderer, FONT_UI, 15, yPos, rows[row], tc);
     }
   }
 
   // Footer
   clippedLine(renderer, 5, sh - footerH - 2, sw - 5, sh - footerH - 2, tc);
   if (deleteConfirmPending && fc > 0) {
-    drawClippedText(renderer, FONT_SMALL, 10, sh - footerH + 4, "Delete? Enter:Yes  Esc:No", 0, tc);
+    drawStaticLabel(renderer, FONT_SMALL, 10, sh - footerH + 4, "Delete? Enter:Yes  Esc:No", 0, tc);
   } else {
-    drawClippedText(renderer, FONT_SMALL, 10, sh - footerH + 4,
-                    "Ctrl+N:Title  Ctrl+D:Delete", 0, tc);
+    drawStaticLabel(renderer, FONT_SMALL, 10, sh - footerH + 4,
+                    "Ctrl+N:Title  Ctrl+D:Del  Ctrl+F:Find  Ctrl+H:History  Tab:Sort", 0, tc);
   }
 
   renderer.displayBuffer(HalDisplay::FAST_REFRESH);
@@ -303,7 +354,9 @@ static int drawEditorHeader(GfxRenderer& renderer, HalGPIO& gpio, int sw, bool t
 
   const char* title = editorGetCurrentTitle();
   char headerBuf[64];
-  if (editorHasUnsavedChanges()) {
+  if (saveFailed) {
+    snprintf(headerBuf, sizeof(headerBuf), "%s * (save failed)", title);
+  } else if (editorHasUnsavedChanges()) {
     snprintf(headerBuf, sizeof(headerBuf), "%s *", title);
   } else {
     strncpy(headerBuf, title, sizeof(headerBuf) - 1);
@@ -327,13 +380,26 @@ static int drawEditorHeader(GfxRenderer& renderer, HalGPIO& gpio, int sw, bool t
   return 38;
 }
 
+// Layout of the last typewriter frame sent to the panel, and the renderer's refresh count right after it
+struct TypewriterFrame {
+  GfxRenderer::Orientation orientation;
+  bool dark;
+  BodyFont font;
+  int textAreaTop;
+  int lineY;
+  int lineHeight;
+  uint32_t refreshCount = UINT32_MAX;  // No frame yet
+
+  bool operator==(const TypewriterFrame& o) const {
+    return orientation == o.orientation && dark == o.dark && font == o.font && textAreaTop == o.textAreaTop &&
+           lineY == o.lineY && lineHeight == o.lineHeight && refreshCount == o.refreshCount;
+  }
+};
+
 void drawTextEditor(GfxRenderer& renderer, HalGPIO& gpio) {
   renderer.clearScreen();
   int sw = renderer.getScreenWidth();
   int sh = renderer.getScreenHeight();
-  bool tc = !darkMode;
-
-  if (darkMode) clippedFillRect(renderer, 0, 0, sw, sh, true);
 
   int lineHeight = renderer.getLineHeight(FONT_BODY);
   if (lineHeight <= 0) lineHeight = 20;
@@ -359,7 +425,20 @@ void drawTextEditor(GfxRenderer& renderer, HalGPIO& gpio) {
 
     editorSetVisibleLines(1);
 
-    renderer.displayBuffer(HalDisplay::FAST_REFRESH);
+    // A typewriter frame is the header and one line band on a blank screen. If the panel still shows the
+    // previous one, with the same layout, only those two bands can differ, so refresh just them.
+    static TypewriterFrame lastFrame;
+    TypewriterFrame frame = {renderer.getOrientation(), darkMode, bodyFont, textAreaTop, centerY, lineHeight,
+                             renderer.getRefreshCount()};
+    if (lastFrame == frame) {
+      if (textAreaTop > 0) renderer.queueRegion(0, 0, sw, textAreaTop);
+      renderer.queueRegion(0, centerY, sw, lineHeight);
+      renderer.displayQueuedRegions();
+    } else {
+      renderer.displayBuffer(HalDisplay::FAST_REFRESH);
+    }
+    frame.refreshCount = renderer.getRefreshCount();
+    lastFrame = frame;
     return;
   }
 
@@ -437,15 +516,12 @@ void drawRenameScreen(GfxRenderer& renderer, HalGPIO& gpio) {
   renderer.clearScreen();
   int sw = renderer.getScreenWidth();
   int sh = renderer.getScreenHeight();
-  bool tc = !darkMode;
 
-  if (darkMode) clippedFillRect(renderer, 0, 0, sw, sh, true);
-
-  drawClippedText(renderer, FONT_SMALL, 10, 5, "Edit Title", 0, tc, EpdFontFamily::BOLD);
+  drawStaticLabel(renderer, FONT_SMALL, 10, 5, "Edit Title", 0, tc, EpdFontFamily::BOLD);
   drawBattery(renderer, gpio);
   clippedLine(renderer, 5, 32, sw - 5, 32, tc);
 
-  drawClippedText(renderer, FONT_SMALL, 20, 42, "Note title:", 0, tc);
+  drawStaticLabel(renderer, FONT_SMALL, 20, 42, "Note title:", 0, tc);
   int boxY = 64, boxH = 36;
   int textY = boxY + 8;
   renderer.drawRect(15, boxY, sw - 30, boxH, tc);
@@ -458,27 +534,132 @@ void drawRenameScreen(GfxRenderer& renderer, HalGPIO& gpio) {
 
   // Footer
   clippedLine(renderer, 5, sh - 36, sw - 5, sh - 36, tc);
-  drawClippedText(renderer, FONT_SMALL, 10, sh - 30, "Enter: Confirm   Esc: Cancel", 0, tc);
+  drawStaticLabel(renderer, FONT_SMALL, 10, sh - 30, "Enter: Confirm   Esc: Cancel", 0, tc);
 
   renderer.displayBuffer(HalDisplay::FAST_REFRESH);
 }
 
-void drawSettingsMenu(GfxRenderer& renderer, HalGPIO& gpio) {
+void drawSearchScreen(GfxRenderer& renderer, HalGPIO& gpio) {
+  renderer.clearScreen();
+  int sw = renderer.getScreenWidth();
+  int sh = renderer.getScreenHeight();
+
+  drawStaticLabel(renderer, FONT_SMALL, 10, 5, "Search", 0, tc, EpdFontFamily::BOLD);
+  drawBattery(renderer, gpio);
+  clippedLine(renderer, 5, 32, sw - 5, 32, tc);
+
+  // Query box, same as the title edit screen
+  int boxY = 42, boxH = 36;
+  int textY = boxY + 8;
+  renderer.drawRect(15, boxY, sw - 30, boxH, tc);
+  drawClippedText(renderer, FONT_UI, 20, textY, searchBuffer, sw - 50, tc);
+  int cursorX = 20 + renderer.getTextAdvanceX(FONT_UI, searchBuffer);
+  if (cursorX + 2 < sw - 15)
+    renderer.fillRect(cursorX, textY, 2, 16, tc);
+
+  int lineH = 30;
+  int listTop = boxY + boxH + 14;
+  int footerH = 28;
+  if (searchHitCount == 0) {
+    drawStaticLabel(renderer, FONT_UI, 20, listTop, "No matching notes.", 0, tc);
+  } else if (searchHitCount < 0) {
+    drawStaticLabel(renderer, FONT_SMALL, 20, listTop, "Whole words; end one with * to match a prefix.", 0, tc);
+  }
+
+  // Hits, scrolled to keep the selection visible
+  int maxVisible = (sh - listTop - footerH) / lineH;
+  int startIdx = 0;
+  if (searchHitCount > maxVisible && searchSelection >= maxVisible) {
+    startIdx = searchSelection - maxVisible + 1;
+  }
+  for (int i = startIdx; i < searchHitCount && i - startIdx < maxVisible; i++) {
+    int yPos = listTop + (i - startIdx) * lineH;
+    char title[MAX_TITLE_LEN];
+    filenameToTitle(searchHits[i].filename, title, MAX_TITLE_LEN);
+    if (i == searchSelection) {
+      clippedFillRect(renderer, 5, yPos - 3, sw - 10, lineH - 1, tc);
+      drawClippedText(renderer, FONT_UI, 15, yPos, title, sw - 30, !tc);
+    } else {
+      drawClippedText(renderer, FONT_UI, 15, yPos, title, sw - 30, tc);
+    }
+  }
+
+  // Footer
+  clippedLine(renderer, 5, sh - footerH - 2, sw - 5, sh - footerH - 2, tc);
+  drawStaticLabel(renderer, FONT_SMALL, 10, sh - footerH + 4,
+                  searchHitCount > 0 ? "Enter:Open  Esc:Back" : "Enter:Search  Esc:Back", 0, tc);
+
+  renderer.displayBuffer(HalDisplay::FAST_REFRESH);
+}
+
+void drawHistoryScreen(GfxRenderer& renderer, HalGPIO& gpio) {
   renderer.clearScreen();
   int sw = renderer.getScreenWidth();
   int sh = renderer.getScreenHeight();
 
-  if (darkMode) clippedFillRect(renderer, 0, 0, sw, sh, true);
+  // Header: the note's title
+  drawStaticLabel(renderer, FONT_SMALL, 10, 5, "History", 0, tc, EpdFontFamily::BOLD);
+  char title[MAX_TITLE_LEN];
+  filenameToTitle(historyFile, title, MAX_TITLE_LEN);
+  const int titleX = 10 + renderer.getTextAdvanceX(FONT_SMALL, "History", EpdFontFamily::BOLD) + 10;
+  drawClippedText(renderer, FONT_SMALL, titleX, 5, title, sw - titleX - 60, tc);
+  drawBattery(renderer, gpio);
+  clippedLine(renderer, 5, 32, sw - 5, 32, tc);
+
+  int lineH = 30;
+  int listTop = 42;
+  int footerH = 28;
+  if (historyCount == 0) {
+    drawStaticLabel(renderer, FONT_UI, 20, listTop + 14, "No earlier versions yet.", 0, tc);
+    drawStaticLabel(renderer, FONT_SMALL, 20, listTop + 36, "Each save keeps the version it replaces.", 0, tc);
+  }
+
+  // Versions, newest first, scrolled to keep the selection visible
+  int maxVisible = (sh - listTop - footerH) / lineH;
+  int startIdx = 0;
+  if (historyCount > maxVisible && historySelection >= maxVisible) {
+    startIdx = historySelection - maxVisible + 1;
+  }
+  for (int i = startIdx; i < historyCount && i - startIdx < maxVisible; i++) {
+    int yPos = listTop + (i - startIdx) * lineH;
+    const HistoryVersion& version = historyVersions[i];
+    char line[64];
+    snprintf(line, sizeof(line), "Version %lu   %lu chars, %lu B stored", (unsigned long)version.number,
+             (unsigned long)version.length, (unsigned long)version.stored);
+    if (i == historySelection) {
+      clippedFillRect(renderer, 5, yPos - 3, sw - 10, lineH - 1, tc);
+      drawClippedText(renderer, FONT_UI, 15, yPos, line, sw - 30, !tc);
+    } else {
+      drawClippedText(renderer, FONT_UI, 15, yPos, line, sw - 30, tc);
+    }
+  }
+
+  // Footer
+  clippedLine(renderer, 5, sh - footerH - 2, sw - 5, sh - footerH - 2, tc);
+  if (historyRestoreFailed) {
+    drawStaticLabel(renderer, FONT_SMALL, 10, sh - footerH + 4, "Could not restore that version.", 0, tc);
+  } else {
+    drawStaticLabel(renderer, FONT_SMALL, 10, sh - footerH + 4,
+                    historyCount > 0 ? "Enter:Restore  Esc:Back" : "Esc:Back", 0, tc);
+  }
+
+  renderer.displayBuffer(HalDisplay::FAST_REFRESH);
+}
+
+void drawSettingsMenu(GfxRenderer& renderer, HalGPIO& gpio) {
+  renderer.clearScreen();
+  int sw = renderer.getScreenWidth();
+  int sh = renderer.getScreenHeight();
 
-  drawClippedText(renderer, FONT_SMALL, 10, 5, "Settings", 0, !darkMode, EpdFontFamily::BOLD);
+  drawStaticLabel(renderer, FONT_SMALL, 10, 5, "Settings", 0, tc, EpdFontFamily::BOLD);
   drawBattery(renderer, gpio);
-  clippedLine(renderer, 5, 32, sw - 5, 32, !darkMode);
+  clippedLine(renderer, 5, 32, sw - 5, 32, tc);
 
-  // Setting items: Orientation, Dark Mode, Writing Mode, Bluetooth, Clear Paired
+  // Setting items: Orientation, Dark Mode, Writing Mode, Body Font, Bluetooth, Clear Paired
   static const char* labels[] = {
-    "Orientation", "Dark Mode", "Writing Mode", "Bluetooth", "Clear Paired"
+    "Orientation", "Dark Mode", "Writing Mode", "Body Font", "Bluetooth", "Clear Paired"
   };
-  const int SETTINGS_COUNT = 5;
+  const int SETTINGS_COUNT = 6;
 
   // Compute line height to fit all items — use smaller spacing if needed
   int lineH = 38;
@@ -488,54 +669,54 @@ void drawSettingsMenu(GfxRenderer& renderer, HalGPIO& gpio) {
     if (lineH < 24) lineH = 24;
   }
 
+  // Value on the right of each item
+  char values[SETTINGS_COUNT][32] = {};
+  switch (currentOrientation) {
+    case Orientation::PORTRAIT:      strcpy(values[0], "Portrait"); break;
+    case Orientation::LANDSCAPE_CW:  strcpy(values[0], "Landscape CW"); break;
+    case Orientation::PORTRAIT_INV:  strcpy(values[0], "Inverted"); break;
+    case Orientation::LANDSCAPE_CCW: strcpy(values[0], "Landscape CCW"); break;
+  }
+  strcpy(values[1], darkMode ? "Dark" : "Light");
+  switch (writingMode) {
+    case WritingMode::NORMAL:     strcpy(values[2], "Normal"); break;
+    case WritingMode::TYPEWRITER: strcpy(values[2], "Typewriter"); break;
+    case WritingMode::PAGINATION: strcpy(values[2], "Pagination"); break;
+  }
+  strcpy(values[3], fontRegistryBodyName(bodyFont));
+  {
+    std::string storedAddr, storedName;
+    if (getStoredDevice(storedAddr, storedName)) {
+      snprintf(values[5], sizeof(values[5]), "%s", storedName.c_str());
+    } else {
+      strcpy(values[5], "None");
+    }
+  }
+
+  // Values measured in one batch; the labels are static
+  GfxRenderer::TextMeasurement rows[SETTINGS_COUNT];
+  for (int i = 0; i < SETTINGS_COUNT; i++) {
+    rows[i] = {values[i], sw - 20 - 5};
+  }
+  renderer.measureTexts(FONT_UI, rows, SETTINGS_COUNT);
+
   for (int i = 0; i < SETTINGS_COUNT; i++) {
     int yPos = listTop + (i * lineH);
     bool sel = (i == settingsSelection);
 
     if (sel) {
-      clippedFillRect(renderer, 5, yPos - 5, sw - 10, lineH - 6, !darkMode);
-      drawClippedText(renderer, FONT_UI, 15, yPos, labels[i], sw / 2 - 15, darkMode);
-    } else {
-      drawClippedText(renderer, FONT_UI, 15, yPos, labels[i], sw / 2 - 15, !darkMode);
-    }
-
-    // Value on the right
-    char val[32] = "";
-    if (i == 0) {
-      switch (currentOrientation) {
-        case Orientation::PORTRAIT:      strcpy(val, "Portrait"); break;
-        case Orientation::LANDSCAPE_CW:  strcpy(val, "Landscape CW"); break;
-        case Orientation::PORTRAIT_INV:  strcpy(val, "Inverted"); break;
-        case Orientation::LANDSCAPE_CCW: strcpy(val, "Landscape CCW"); break;
-      }
-    } else if (i == 1) {
-      strcpy(val, darkMode ? "Dark" : "Light");
-    } else if (i == 2) {
-      switch (writingMode) {
-        case WritingMode::NORMAL:     strcpy(val, "Normal"); break;
-        case WritingMode::TYPEWRITER: strcpy(val, "Typewriter"); break;
-        case WritingMode::PAGINATION: strcpy(val, "Pagination"); break;
-      }
-    } else if (i == 4) {
-      std::string storedAddr, storedName;
-      if (getStoredDevice(storedAddr, storedName)) {
-        snprintf(val, sizeof(val), "%s", storedName.c_str());
-      } else {
-        strcpy(val, "None");
-      }
-    }
-
-    if (val[0] != '\0') {
-      drawRightText(renderer, FONT_UI, sw - 20, yPos, val, sel ? darkMode : !darkMode);
+      clippedFillRect(renderer, 5, yPos - 5, sw - 10, lineH - 6, tc);
     }
+    drawStaticLabel(renderer, FONT_UI, 15, yPos, labels[i], sw / 2 - 15, sel ? !tc : tc);
+    drawMeasuredRight(renderer, FONT_UI, sw - 20, yPos, rows[i], sel ? !tc : tc);
   }
 
   // Footer
   constexpr int bm = 60;
   if (sh > bm + 30) {
-    clippedLine(renderer, 10, sh - bm, sw - 10, sh - bm, !darkMode);
-    drawClippedText(renderer, FONT_SMALL, 20, sh - bm + 12,
-                    "Arrows:Navigate  Enter:Change  Esc:Back", 0, !darkMode);
+    clippedLine(renderer, 10, sh - bm, sw - 10, sh - bm, tc);
+    drawStaticLabel(renderer, FONT_SMALL, 20, sh - bm + 12,
+                    "Arrows:Navigate  Enter:Change  Esc:Back", 0, tc);
   }
 
   renderer.displayBuffer(HalDisplay::FAST_REFRESH);
@@ -546,12 +727,9 @@ void drawBluetoothSettings(GfxRenderer& renderer, HalGPIO& gpio) {
   int sh = renderer.getScreenHeight();
 
   renderer.clearScreen();
-  bool tc = !darkMode;
-
-  if (darkMode) clippedFillRect(renderer, 0, 0, sw, sh, true);
 
   // Header
-  drawClippedText(renderer, FONT_SMALL, 10, 5, "Bluetooth Devices", 0, tc, EpdFontFamily::BOLD);
+  drawStaticLabel(renderer, FONT_SMALL, 10, 5, "Bluetooth Devices", 0, tc, EpdFontFamily::BOLD);
   drawBattery(renderer, gpio);
   clippedLine(renderer, 5, 32, sw - 5, 32, tc);
 
@@ -577,11 +755,11 @@ void drawBluetoothSettings(GfxRenderer& renderer, HalGPIO& gpio) {
   uint32_t passkey = getCurrentPasskey();
   if (passkey > 0) {
     char passkeyStr[32];
-    drawClippedText(renderer, FONT_UI, 20, 100, "PAIRING CODE:", 0, tc, EpdFontFamily::BOLD);
+    drawStaticLabel(renderer, FONT_UI, 20, 100, "PAIRING CODE:", 0, tc, EpdFontFamily::BOLD);
     snprintf(passkeyStr, sizeof(passkeyStr), "%06lu", passkey);
     drawClippedText(renderer, FONT_BODY, 20, 130, passkeyStr, 0, tc, EpdFontFamily::BOLD);
-    drawClippedText(renderer, FONT_SMALL, 20, 160, "Type this code on your keyboard", 0, tc);
-    drawClippedText(renderer, FONT_SMALL, 20, 180, "then press Enter", 0, tc);
+    drawStaticLabel(renderer, FONT_SMALL, 20, 160, "Type this code on your keyboard", 0, tc);
+    drawStaticLabel(renderer, FONT_SMALL, 20, 180, "then press Enter", 0, tc);
   } else if (isDeviceScanning()) {
     static uint8_t dotPhase = 0;
     static uint32_t lastAnimMs = 0;
@@ -618,34 +796,41 @@ void drawBluetoothSettings(GfxRenderer& renderer, HalGPIO& gpio) {
     int devicesToShow = (deviceCount - startIndex < maxDevicesToShow)
                         ? deviceCount - startIndex : maxDevicesToShow;
 
-    for (int i = 0; i < devicesToShow; i++) {
+    // Stop drawing if we'd go into the footer zone
+    int rowsOnScreen = devicesToShow;
+    while (rowsOnScreen > 0 && 90 + (rowsOnScreen - 1) * 30 > sh - 100) rowsOnScreen--;
+
+    // Measure names (FONT_UI) and RSSI (FONT_SMALL) for all visible rows up front.
+    // Available name width: leave room for RSSI on the right (~80px)
+    int nameMaxW = sw - 100;
+    GfxRenderer::TextMeasurement names[10];
+    GfxRenderer::TextMeasurement rssi[10];
+    char rssiStr[10][16];
+    for (int i = 0; i < rowsOnScreen; i++) {
+      const BleDeviceInfo& dev = devices[startIndex + i];
+      names[i] = {dev.name.empty() ? dev.address.c_str() : dev.name.c_str(), nameMaxW};
+      snprintf(rssiStr[i], sizeof(rssiStr[i]), "%ddBm", dev.rssi);
+      rssi[i] = {rssiStr[i], sw - 10 - 5};
+    }
+    renderer.measureTexts(FONT_UI, names, rowsOnScreen);
+    renderer.measureTexts(FONT_SMALL, rssi, rowsOnScreen);
+
+    for (int i = 0; i < rowsOnScreen; i++) {
       int deviceIndex = startIndex + i;
       int yPos = 90 + (i * 30);
 
-      // Stop drawing if we'd go into the footer zone
-      if (yPos > sh - 100) break;
-
       bool isSelected = (bluetoothDeviceSelection == deviceIndex);
       bool isConnected = (getCurrentDeviceAddress() == devices[deviceIndex].address);
 
-      const char* displayName = devices[deviceIndex].name.empty()
-                                ? devices[deviceIndex].address.c_str()
-                                : devices[deviceIndex].name.c_str();
-
-      // Available width: leave room for RSSI on the right (~80px)
-      int nameMaxW = sw - 100;
-
       if (isSelected || isConnected) {
         clippedFillRect(renderer, 5, yPos - 5, sw - 10, 25, tc);
-        drawClippedText(renderer, FONT_UI, 15, yPos, displayName, nameMaxW, !tc);
+        drawMeasuredRow(renderer, FONT_UI, 15, yPos, names[i], !tc);
       } else {
-        drawClippedText(renderer, FONT_UI, 15, yPos, displayName, nameMaxW, tc);
+        drawMeasuredRow(renderer, FONT_UI, 15, yPos, names[i], tc);
       }
 
       // RSSI on the right
-      char rssiStr[16];
-      snprintf(rssiStr, sizeof(rssiStr), "%ddBm", devices[deviceIndex].rssi);
-      drawRightText(renderer, FONT_SMALL, sw - 10, yPos, rssiStr, tc);
+      drawMeasuredRight(renderer, FONT_SMALL, sw - 10, yPos, rssi[i], tc);
     }
 
     // Page indicator
@@ -659,15 +844,15 @@ void drawBluetoothSettings(GfxRenderer& renderer, HalGPIO& gpio) {
         drawClippedText(renderer, FONT_SMALL, 15, navY, navHint, 0, tc);
     }
   } else {
-    drawClippedText(renderer, FONT_UI, 20, 80, "No devices found", 0, tc);
-    drawClippedText(renderer, FONT_SMALL, 20, 100, "Press Enter to scan for devices", 0, tc);
+    drawStaticLabel(renderer, FONT_UI, 20, 80, "No devices found", 0, tc);
+    drawStaticLabel(renderer, FONT_SMALL, 20, 100, "Press Enter to scan for devices", 0, tc);
   }
 
   // Footer
   constexpr int bm = 60;
   if (sh > bm + 30) {
     clippedLine(renderer, 10, sh - bm, sw - 10, sh - bm, tc);
-    drawClippedText(renderer, FONT_SMALL, 20, sh - bm + 12,
+    drawStaticLabel(renderer, FONT_SMALL, 20, sh - bm + 12,
                     "Enter:Connect  Right:Scan  Left:Disconnect  Esc:Back", 0, tc);
   }
 
@@ -693,12 +878,9 @@ void drawSyncScreen(GfxRenderer& renderer, HalGPIO& gpio) {
   renderer.clearScreen();
   int sw = renderer.getScreenWidth();
   int sh = renderer.getScreenHeight();
-  bool tc = !darkMode;
-
-  if (darkMode) clippedFillRect(renderer, 0, 0, sw, sh, true);
 
   // Header
-  drawClippedText(renderer, FONT_SMALL, 10, 5, "Sync", 0, tc, EpdFontFamily::BOLD);
+  drawStaticLabel(renderer, FONT_SMALL, 10, 5, "Sync", 0, tc, EpdFontFamily::BOLD);
   drawBattery(renderer, gpio);
   clippedLine(renderer, 5, 32, sw - 5, 32, tc);
 
@@ -706,7 +888,7 @@ void drawSyncScreen(GfxRenderer& renderer, HalGPIO& gpio) {
 
   switch (state) {
     case SyncState::SCANNING: {
-      drawClippedText(renderer, FONT_UI, 20, 80, "Scanning for networks...", sw - 40, tc);
+      drawStaticLabel(renderer, FONT_UI, 20, 80, "Scanning for networks...", sw - 40, tc);
       break;
     }
 
@@ -717,9 +899,9 @@ void drawSyncScreen(GfxRenderer& renderer, HalGPIO& gpio) {
       if (nc == 0) {
         const char* st = getSyncStatusText();
         drawClippedText(renderer, FONT_UI, 20, 60, st[0] ? st : "No networks found", sw - 40, tc);
-        drawClippedText(renderer, FONT_SMALL, 20, 90, "Enter: Rescan  Esc: Back", 0, tc);
+        drawStaticLabel(renderer, FONT_SMALL, 20, 90, "Enter: Rescan  Esc: Back", 0, tc);
       } else {
-        drawClippedText(renderer, FONT_SMALL, 10, 38, "Select network:", 0, tc);
+        drawStaticLabel(renderer, FONT_SMALL, 10, 38, "Select network:", 0, tc);
 
         int lineH = 28;
         int listTop = 56;
@@ -755,7 +937,7 @@ void drawSyncScreen(GfxRenderer& renderer, HalGPIO& gpio) {
       // Footer
       constexpr int bm = 28;
       clippedLine(renderer, 10, sh - bm - 2, sw - 10, sh - bm - 2, tc);
-      drawClippedText(renderer, FONT_SMALL, 10, sh - bm + 4,
+      drawStaticLabel(renderer, FONT_SMALL, 10, sh - bm + 4,
                       "*=encrypted +=saved  Enter:Select  Esc:Back", 0, tc);
       break;
     }
@@ -785,14 +967,14 @@ void drawSyncScreen(GfxRenderer& renderer, HalGPIO& gpio) {
       if (cursorX + cursorW < sw)
         renderer.fillRect(cursorX, 66, cursorW, 20, tc);
 
-      drawClippedText(renderer, FONT_SMALL, 20, 110, "Enter: Connect   Esc: Cancel", 0, tc);
+      drawStaticLabel(renderer, FONT_SMALL, 20, 110, "Enter: Connect   Esc: Cancel", 0, tc);
       break;
     }
 
     case SyncState::CONNECTING: {
       const char* st = getSyncStatusText();
       drawClippedText(renderer, FONT_UI, 20, 80, st, sw - 40, tc);
-      drawClippedText(renderer, FONT_SMALL, 20, 110, "Esc: Cancel", 0, tc);
+      drawStaticLabel(renderer, FONT_SMALL, 20, 110, "Esc: Cancel", 0, tc);
       break;
     }
 
@@ -802,9 +984,9 @@ void drawSyncScreen(GfxRenderer& renderer, HalGPIO& gpio) {
 
       int logCount = getSyncLogCount();
       if (logCount == 0) {
-        drawClippedText(renderer, FONT_UI, 20, 75, "Waiting for PC...", sw - 40, tc);
-        drawClippedText(renderer, FONT_SMALL, 20, 110, "Run microslate_sync.py on PC", sw - 40, tc);
-        drawClippedText(renderer, FONT_SMALL, 20, 130, "See README for setup", sw - 40, tc);
+        drawStaticLabel(renderer, FONT_UI, 20, 75, "Waiting for PC...", sw - 40, tc);
+        drawStaticLabel(renderer, FONT_SMALL, 20, 110, "Run microslate_sync.py on PC", sw - 40, tc);
+        drawStaticLabel(renderer, FONT_SMALL, 20, 130, "See README for setup", sw - 40, tc);
       } else {
         // Show activity log
         int yPos = 68;
@@ -826,31 +1008,31 @@ void drawSyncScreen(GfxRenderer& renderer, HalGPIO& gpio) {
 
     case SyncState::DONE: {
       const char* summary = getSyncStatusText();
-      drawClippedText(renderer, FONT_SMALL, 20, 50, "Sync Complete", 0, tc, EpdFontFamily::BOLD);
+      drawStaticLabel(renderer, FONT_SMALL, 20, 50, "Sync Complete", 0, tc, EpdFontFamily::BOLD);
       drawClippedText(renderer, FONT_UI, 20, 85, summary, sw - 40, tc);
-      drawClippedText(renderer, FONT_SMALL, 20, 125, "Returning to menu...", 0, tc);
+      drawStaticLabel(renderer, FONT_SMALL, 20, 125, "Returning to menu...", 0, tc);
       break;
     }
 
     case SyncState::CONNECT_FAILED: {
-      drawClippedText(renderer, FONT_UI, 20, 80, "Connection failed", sw - 40, tc);
-      drawClippedText(renderer, FONT_SMALL, 20, 110, "Enter: Retry   Esc: Back", 0, tc);
+      drawStaticLabel(renderer, FONT_UI, 20, 80, "Connection failed", sw - 40, tc);
+      drawStaticLabel(renderer, FONT_SMALL, 20, 110, "Enter: Retry   Esc: Back", 0, tc);
       break;
     }
 
     case SyncState::SAVE_PROMPT: {
       const char* ip = getSyncStatusText();
-      drawClippedText(renderer, FONT_SMALL, 20, 50, "Connected!", 0, tc, EpdFontFamily::BOLD);
+      drawStaticLabel(renderer, FONT_SMALL, 20, 50, "Connected!", 0, tc, EpdFontFamily::BOLD);
       drawClippedText(renderer, FONT_UI, 20, 80, ip, sw - 40, tc);
-      drawClippedText(renderer, FONT_SMALL, 20, 120, "Save password?", 0, tc, EpdFontFamily::BOLD);
-      drawClippedText(renderer, FONT_SMALL, 20, 145, "Enter/Up: Yes   Down/Esc: No", 0, tc);
+      drawStaticLabel(renderer, FONT_SMALL, 20, 120, "Save password?", 0, tc, EpdFontFamily::BOLD);
+      drawStaticLabel(renderer, FONT_SMALL, 20, 145, "Enter/Up: Yes   Down/Esc: No", 0, tc);
       break;
     }
 
     case SyncState::FORGET_PROMPT: {
-      drawClippedText(renderer, FONT_UI, 20, 80, "Saved password failed", sw - 40, tc);
-      drawClippedText(renderer, FONT_SMALL, 20, 120, "Forget saved password?", 0, tc, EpdFontFamily::BOLD);
-      drawClippedText(renderer, FONT_SMALL, 20, 145, "Enter/Up: Yes   Down/Esc: No", 0, tc);
+      drawStaticLabel(renderer, FONT_UI, 20, 80, "Saved password failed", sw - 40, tc);
+      drawStaticLabel(renderer, FONT_SMALL, 20, 120, "Forget saved password?", 0, tc, EpdFontFamily::BOLD);
+      drawStaticLabel(renderer, FONT_SMALL, 20, 145, "Enter/Up: Yes   Down/Esc: No", 0, tc);
       break;
     }
   }
@@ -8,6 +8,8 @@ void drawMainMenu(GfxRenderer& renderer, HalGPIO& gpio);
 void drawFileBrowser(GfxRenderer& renderer, HalGPIO& gpio);
 void drawTextEditor(GfxRenderer& renderer, HalGPIO& gpio);
 void drawRenameScreen(GfxRenderer& renderer, HalGPIO& gpio);
+void drawSearchScreen(GfxRenderer& renderer, HalGPIO& gpio);
+void drawHistoryScreen(GfxRenderer& renderer, HalGPIO& gpio);
 void drawSettingsMenu(GfxRenderer& renderer, HalGPIO& gpio);
 void drawBluetoothSettings(GfxRenderer& renderer, HalGPIO& gpio);
 void drawSyncScreen(GfxRenderer& renderer, HalGPIO& gpio);
@@ -0,0 +1,25 @@
+#pragma once
+// Host stand-in for the parts of the Arduino core the storage modules use.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <freertos/FreeRTOS.h>  // Pulled in by the Arduino core on the ESP32
+
+struct HostSerial {
+  bool muted = false;  // For benchmarks that draw off the panel on purpose
+
+  template <class... Args>
+  int printf(const char* fmt, Args... args) {
+    return muted ? 0 : ::printf(fmt, args...);
+  }
+};
+extern HostSerial Serial;
+
+unsigned long millis();
+void delay(unsigned long ms);
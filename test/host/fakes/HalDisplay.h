@@ -0,0 +1,40 @@
+#pragma once
+// Host stand-in for the display HAL: the frame buffer GfxRenderer draws into, with no panel behind it.
+
+#include <Arduino.h>
+
+class HalDisplay {
+ public:
+  enum RefreshMode { FULL_REFRESH, HALF_REFRESH, FAST_REFRESH };
+
+  static constexpr uint16_t DISPLAY_WIDTH = 800;
+  static constexpr uint16_t DISPLAY_HEIGHT = 480;
+  static constexpr uint16_t DISPLAY_WIDTH_BYTES = DISPLAY_WIDTH / 8;
+  static constexpr uint32_t BUFFER_SIZE = DISPLAY_WIDTH_BYTES * DISPLAY_HEIGHT;
+
+  void begin() {}
+  void clearScreen(const uint8_t color = 0xFF) const { memset(frameBuffer, color, BUFFER_SIZE); }
+  void drawImage(const uint8_t*, uint16_t, uint16_t, uint16_t, uint16_t, bool = false) const {}
+
+  void displayBuffer(RefreshMode = FAST_REFRESH, bool = false) {}
+  void displayWindow(uint16_t, uint16_t, uint16_t, uint16_t, bool = false) {}
+  void refreshDisplay(RefreshMode = FAST_REFRESH, bool = false) {}
+  void writeBaseline() {}
+  void powerOn() {}
+  void setInvertOutput(bool) {}
+  void setBusLock(void (*)(), void (*)()) {}
+  void deepSleep() {}
+
+  uint8_t* getFrameBuffer() const { return frameBuffer; }
+
+  void copyGrayscaleBuffers(const uint8_t*, const uint8_t*) {}
+  void copyGrayscaleLsbBuffers(const uint8_t*) {}
+  void copyGrayscaleMsbBuffers(const uint8_t*) {}
+  void writeGrayscaleBand(uint16_t, uint16_t, const uint8_t*, const uint8_t*) {}
+  void cleanupGrayscaleBuffers(const uint8_t*) {}
+  void displayGrayBuffer(bool = false) {}
+  void markGrayscaleShown() {}
+
+ private:
+  mutable uint8_t frameBuffer[BUFFER_SIZE] = {};
+};
@@ -0,0 +1,219 @@
+#pragma once
+// In-memory SD card for the host tests, with the subset of the SDCardManager/FsFile interface the storage modules
+// use. Files live in fakeCard.files keyed by absolute path; directories are implied by the paths under them.
+// writeBudget simulates power loss: once that many bytes have been written, further writes are dropped.
+// With mirrorDir set, files opened for writing are also written through to that host directory (every write
+// committed before it returns, like a card command), so benchmarks pay for real I/O; reads still come from memory.
+
+#include <Arduino.h>
+#include <map>
+#include <string>
+#include <vector>
+
+typedef int oflag_t;
+#define O_RDONLY 0x00
+#define O_WRONLY 0x01
+#define O_RDWR 0x02
+#define O_CREAT 0x10
+#define O_TRUNC 0x20
+#define O_APPEND 0x40
+
+struct FakeCard {
+  std::map<std::string, std::vector<uint8_t>> files;
+  std::map<std::string, uint16_t> modifyTime;  // bumped on every open for writing
+  size_t bytesWritten = 0;
+  size_t writeCalls = 0;
+  size_t partialSectorWrites = 0;  // writes starting or ending inside a 512-byte sector: SdFat caches those
+  long writeBudget = -1;           // bytes left before the simulated power loss, -1 = unlimited
+  std::string mirrorDir;           // host directory the card is written through to, empty = memory only
+
+  void clear() {
+    files.clear();
+    modifyTime.clear();
+    writeBudget = -1;
+  }
+  std::string text(const std::string& path) const {
+    auto it = files.find(path);
+    return it == files.end() ? std::string() : std::string(it->second.begin(), it->second.end());
+  }
+  void put(const std::string& path, const std::string& content) {
+    files[path] = std::vector<uint8_t>(content.begin(), content.end());
+  }
+  bool isDirectory(const std::string& path) const {
+    const std::string prefix = path + "/";
+    auto it = files.lower_bound(prefix);
+    return it != files.end() && it->first.compare(0, prefix.size(), prefix) == 0;
+  }
+};
+inline FakeCard fakeCard;
+
+// Write-through to fakeCard.mirrorDir (fakes/host_mirror.cpp, kept apart from the O_* flags above). Paths are host
+// paths; fds are -1 when there is no mirror, and every call on -1 succeeds.
+int hostMirrorOpen(const std::string& hostPath, bool truncate);
+bool hostMirrorWrite(int fd, const void* buf, size_t n, uint64_t pos);
+bool hostMirrorTruncate(int fd, uint64_t n);
+bool hostMirrorAllocate(int fd, uint64_t n);
+bool hostMirrorSync(int fd);
+void hostMirrorClose(int fd);
+void hostMirrorRemove(const std::string& hostPath);
+void hostMirrorRename(const std::string& hostPath, const std::string& newHostPath);
+
+class FsFile {
+ public:
+  explicit operator bool() const { return data != nullptr || directory; }
+
+  int read() {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+  }
+  int read(void* buf, size_t n) {
+    if (!data) return -1;
+    const size_t k = pos < data->size() ? std::min(n, data->size() - pos) : 0;
+    memcpy(buf, data->data() + pos, k);
+    pos += k;
+    return static_cast<int>(k);
+  }
+  size_t write(const void* buf, size_t n) {
+    if (!data || !writable) return 0;
+    if (append) pos = data->size();
+    size_t k = n;
+    if (fakeCard.writeBudget >= 0) {
+      k = std::min<size_t>(n, fakeCard.writeBudget);
+      fakeCard.writeBudget -= k;
+    }
+    if (data->size() < pos + k) data->resize(pos + k);
+    memcpy(data->data() + pos, buf, k);
+    if (!hostMirrorWrite(hostFd, buf, k, pos)) return 0;
+    fakeCard.writeCalls++;
+    if (pos % 512 != 0 || (pos + k) % 512 != 0) fakeCard.partialSectorWrites++;
+    pos += k;
+    fakeCard.bytesWritten += k;
+    return k;
+  }
+  uint64_t position() const { return pos; }
+  uint64_t size() const { return data ? data->size() : 0; }
+  bool seekSet(uint64_t p) {
+    pos = p;
+    return data != nullptr;
+  }
+  bool seek(uint64_t p) { return seekSet(p); }
+  bool seekCur(int64_t d) { return seekSet(pos + d); }
+  bool truncate(uint64_t n) {
+    if (!data || !writable) return false;
+    data->resize(n);
+    return hostMirrorTruncate(hostFd, n);
+  }
+  bool preAllocate(uint64_t n) {
+    if (!data || !data->empty()) return false;
+    return hostMirrorAllocate(hostFd, n);
+  }
+  bool sync() { return data != nullptr && hostMirrorSync(hostFd); }
+  bool close() {
+    hostMirrorClose(hostFd);
+    hostFd = -1;
+    data = nullptr;
+    directory = false;
+    return true;
+  }
+
+  bool isDirectory() const { return directory; }
+  void rewindDirectory() { next = 0; }
+  FsFile openNextFile() {
+    FsFile file;
+    while (next < listing.size()) {
+      auto it = fakeCard.files.find(listing[next++]);
+      if (it == fakeCard.files.end()) continue;
+      file.data = &it->second;
+      file.path = it->first;
+      break;
+    }
+    return file;
+  }
+  size_t getName(char* out, size_t n) {
+    const std::string base = path.substr(path.rfind('/') + 1);
+    snprintf(out, n, "%s", base.c_str());
+    return base.size();
+  }
+  bool getModifyDateTime(uint16_t* date, uint16_t* time) {
+    *date = 1;
+    *time = fakeCard.modifyTime[path];
+    return true;
+  }
+
+ private:
+  friend class SDCardManager;
+  std::vector<uint8_t>* data = nullptr;
+  std::string path;
+  size_t pos = 0;
+  bool writable = false;
+  bool append = false;
+  bool directory = false;
+  int hostFd = -1;  // write-through file under fakeCard.mirrorDir
+  std::vector<std::string> listing;  // directories: files directly inside
+  size_t next = 0;
+};
+
+class SDCardManager {
+ public:
+  bool begin() { return true; }
+  void sleep() {}
+  void beginSession() {}
+  void endSession() {}
+
+  FsFile open(const char* path, oflag_t oflag = O_RDONLY) {
+    FsFile file;
+    const std::string p = path;
+    if (fakeCard.isDirectory(p)) {
+      file.directory = true;
+      file.path = p;
+      for (const auto& kv : fakeCard.files) {
+        if (kv.first.compare(0, p.size() + 1, p + "/") == 0 && kv.first.find('/', p.size() + 1) == std::string::npos) {
+          file.listing.push_back(kv.first);
+        }
+      }
+      return file;
+    }
+    auto it = fakeCard.files.find(p);
+    if (it == fakeCard.files.end()) {
+      if (!(oflag & O_CREAT)) return file;
+      it = fakeCard.files.emplace(p, std::vector<uint8_t>{}).first;
+    }
+    file.writable = oflag & (O_WRONLY | O_RDWR);
+    if (file.writable) {
+      fakeCard.modifyTime[p]++;
+      if (!fakeCard.mirrorDir.empty()) file.hostFd = hostMirrorOpen(fakeCard.mirrorDir + p, oflag & O_TRUNC);
+    }
+    if (oflag & O_TRUNC) it->second.clear();
+    file.data = &it->second;
+    file.path = p;
+    file.append = oflag & O_APPEND;
+    return file;
+  }
+  bool openFileForRead(const char*, const std::string& path, FsFile& file) {
+    file = open(path.c_str());
+    return static_cast<bool>(file);
+  }
+  bool mkdir(const char*, bool = true) { return true; }
+  bool exists(const char* path) { return fakeCard.files.count(path) || fakeCard.isDirectory(path); }
+  bool remove(const char* path) {
+    if (!fakeCard.mirrorDir.empty()) hostMirrorRemove(fakeCard.mirrorDir + path);
+    return fakeCard.files.erase(path) > 0;
+  }
+  // Like SdFat: fails if the new path exists
+  bool rename(const char* path, const char* newPath) {
+    auto it = fakeCard.files.find(path);
+    if (it == fakeCard.files.end() || fakeCard.files.count(newPath)) return false;
+    if (!fakeCard.mirrorDir.empty()) hostMirrorRename(fakeCard.mirrorDir + path, fakeCard.mirrorDir + newPath);
+    fakeCard.files[newPath] = std::move(it->second);
+    fakeCard.files.erase(it);
+    fakeCard.modifyTime[newPath] = fakeCard.modifyTime[path];
+    return true;
+  }
+
+  static SDCardManager& getInstance() {
+    static SDCardManager instance;
+    return instance;
+  }
+};
+
+#define SdMan SDCardManager::getInstance()
@@ -0,0 +1,3 @@
+#pragma once
+// FsFile for the library code that includes SdFat directly; the in-memory card is in SDCardManager.h
+#include <SDCardManager.h>
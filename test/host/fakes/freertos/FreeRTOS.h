@@ -0,0 +1,28 @@
+#pragma once
+// Host stand-in for FreeRTOS: single threaded, so locks always succeed and a created task runs to completion
+// inside xTaskCreate.
+
+#include <cstdint>
+
+typedef void* SemaphoreHandle_t;
+typedef void* TaskHandle_t;
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define portMAX_DELAY 0xffffffffu
+#define pdMS_TO_TICKS(ms) (ms)
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex() { return reinterpret_cast<SemaphoreHandle_t>(1); }
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t, TickType_t) { return pdTRUE; }
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t) { return pdTRUE; }
+
+inline BaseType_t xTaskCreate(void (*task)(void*), const char*, uint32_t, void* arg, UBaseType_t, TaskHandle_t*) {
+  task(arg);
+  return pdPASS;
+}
+inline void vTaskDelete(TaskHandle_t) {}
+inline void vTaskDelay(TickType_t) {}
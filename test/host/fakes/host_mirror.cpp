@@ -0,0 +1,36 @@
+// The host side of FakeCard::mirrorDir. Does not include SDCardManager.h: its O_* flags are SdFat's, not the host's.
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+int hostMirrorOpen(const std::string& hostPath, const bool truncate) {
+  for (size_t slash = hostPath.find('/', 1); slash != std::string::npos; slash = hostPath.find('/', slash + 1)) {
+    mkdir(hostPath.substr(0, slash).c_str(), 0755);
+  }
+  // O_DSYNC: each write reaches the disk before it returns, as each card write command does
+  return open(hostPath.c_str(), O_WRONLY | O_CREAT | O_DSYNC | (truncate ? O_TRUNC : 0), 0644);
+}
+
+bool hostMirrorWrite(const int fd, const void* buf, const size_t n, const uint64_t pos) {
+  return fd < 0 || pwrite(fd, buf, n, pos) == static_cast<ssize_t>(n);
+}
+
+bool hostMirrorTruncate(const int fd, const uint64_t n) { return fd < 0 || ftruncate(fd, n) == 0; }
+
+bool hostMirrorAllocate(const int fd, const uint64_t n) { return fd < 0 || posix_fallocate(fd, 0, n) == 0; }
+
+bool hostMirrorSync(const int fd) { return fd < 0 || fsync(fd) == 0; }
+
+void hostMirrorClose(const int fd) {
+  if (fd >= 0) close(fd);
+}
+
+void hostMirrorRemove(const std::string& hostPath) { unlink(hostPath.c_str()); }
+
+void hostMirrorRename(const std::string& hostPath, const std::string& newHostPath) {
+  rename(hostPath.c_str(), newHostPath.c_str());
+}
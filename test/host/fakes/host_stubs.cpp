@@ -0,0 +1,10 @@
+#include <Arduino.h>
+#include "config.h"
+
+HostSerial Serial;
+
+// Defined in main.cpp on the device
+UIState currentState;
+
+unsigned long millis() { return 0; }
+void delay(unsigned long) {}
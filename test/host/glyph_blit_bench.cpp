@@ -0,0 +1,104 @@
+// Glyphs per second drawn by GfxRenderer::drawText from ubuntu_10_regular in its row-aligned layout (blitGlyph1Bit)
+// and from the same glyphs repacked tightly as before --row-aligned (per-pixel path), in all four orientations.
+// Both layouts must also produce byte-identical frames, including for text running off the panel.
+#include <EpdFontFamily.h>
+#include <GfxRenderer.h>
+
+#include <builtinFonts/ubuntu_10_regular.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+static constexpr int ROW_ALIGNED = 0;
+static constexpr int TIGHT = 1;
+static constexpr int FRAMES = 200;
+static const char* const SAMPLE = "The quick brown fox jumps over the lazy dog. 0123456789 (MicroSlate)";
+
+// The same glyphs with every row continuing straight after the previous one
+static EpdFontData repackTight(const EpdFontData& font, std::vector<EpdGlyph>& glyphs, std::vector<uint8_t>& bits) {
+  const EpdUnicodeInterval& last = font.intervals[font.intervalCount - 1];
+  glyphs.assign(font.glyph, font.glyph + last.offset + (last.last - last.first) + 1);
+  for (auto& glyph : glyphs) {
+    const uint8_t* src = font.bitmap + glyph.dataOffset;
+    const int rowBytes = (glyph.width + 7) / 8;
+    const size_t start = bits.size();
+    bits.resize(start + (glyph.width * glyph.height + 7) / 8);
+    for (int y = 0; y < glyph.height; y++) {
+      for (int x = 0; x < glyph.width; x++) {
+        if (src[y * rowBytes + x / 8] & (0x80 >> (x % 8))) {
+          const int bit = y * glyph.width + x;
+          bits[start + bit / 8] |= 0x80 >> (bit % 8);
+        }
+      }
+    }
+    glyph.dataOffset = start;
+    glyph.dataLength = bits.size() - start;
+  }
+
+  EpdFontData tight = font;
+  tight.bitmap = bits.data();
+  tight.glyph = glyphs.data();
+  tight.rowAligned = false;
+  return tight;
+}
+
+// Fills the screen with lines of SAMPLE, the first and last ones partly off the panel; returns the glyphs drawn
+static long drawPage(GfxRenderer& renderer, const int fontId) {
+  const int lineHeight = renderer.getLineHeight(fontId);
+  long glyphs = 0;
+  for (int y = -lineHeight / 2, indent = -20; y < renderer.getScreenHeight(); y += lineHeight, indent += 7) {
+    renderer.drawText(fontId, indent % 60, y, SAMPLE);
+    for (const char* c = SAMPLE; *c; c++) glyphs += *c != ' ';
+  }
+  return glyphs;
+}
+
+int main() {
+  Serial.muted = true;  // drawPixel logs every pixel it clips
+  static HalDisplay display;
+  GfxRenderer renderer(display);
+
+  std::vector<EpdGlyph> tightGlyphs;
+  std::vector<uint8_t> tightBits;
+  const EpdFontData tightData = repackTight(ubuntu_10_regular, tightGlyphs, tightBits);
+  const EpdFont rowAlignedFont(&ubuntu_10_regular);
+  const EpdFont tightFont(&tightData);
+  renderer.insertFont(ROW_ALIGNED, EpdFontFamily(&rowAlignedFont));
+  renderer.insertFont(TIGHT, EpdFontFamily(&tightFont));
+
+  const struct {
+    GfxRenderer::Orientation orientation;
+    const char* name;
+  } orientations[] = {{GfxRenderer::Portrait, "portrait"},
+                      {GfxRenderer::LandscapeClockwise, "landscape CW"},
+                      {GfxRenderer::PortraitInverted, "portrait inverted"},
+                      {GfxRenderer::LandscapeCounterClockwise, "landscape CCW"}};
+
+  printf("glyph_blit_bench: ubuntu_10_regular, %d pages per layout, M glyphs/s\n", FRAMES);
+  printf("%-18s %8s %12s\n", "orientation", "tight", "row-aligned");
+  int failures = 0;
+  for (const auto& o : orientations) {
+    renderer.setOrientation(o.orientation);
+
+    std::vector<uint8_t> frames[2];
+    double glyphsPerSec[2];
+    for (const int fontId : {TIGHT, ROW_ALIGNED}) {
+      long glyphs = 0;
+      const auto start = std::chrono::steady_clock::now();
+      for (int frame = 0; frame < FRAMES; frame++) {
+        renderer.clearScreen();
+        glyphs += drawPage(renderer, fontId);
+      }
+      const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      glyphsPerSec[fontId] = glyphs / elapsed.count();
+      frames[fontId].assign(display.getFrameBuffer(), display.getFrameBuffer() + HalDisplay::BUFFER_SIZE);
+    }
+
+    printf("%-18s %8.2f %12.2f\n", o.name, glyphsPerSec[TIGHT] / 1e6, glyphsPerSec[ROW_ALIGNED] / 1e6);
+    if (frames[TIGHT] != frames[ROW_ALIGNED]) {
+      printf("FAIL %s: the layouts drew different frames\n", o.name);
+      failures++;
+    }
+  }
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,238 @@
+// Raw against Huffman-coded glyph bitmaps (fontconvert.py --compress) on notosans_14_regular: bitmap bytes, text
+// drawn per second through GfxRenderer, and the hit rate of the 4 KB decode cache, for prose and for pages cycling
+// through every glyph of the font. The built-in headers are not compressed, so the font is coded here the way
+// fontconvert.py does it; every glyph must decode to its raw bitmap.
+#include <EpdFontFamily.h>
+#include <GfxRenderer.h>
+#include <Utf8.h>
+
+#include <builtinFonts/notosans_14_regular.h>
+#include <chrono>
+#include <queue>
+#include <vector>
+
+using namespace EpdGlyphCodec;
+
+static constexpr int RAW = 0;
+static constexpr int COMPRESSED = 1;
+static constexpr int PAGES = 50;
+
+// fontconvert.py run_symbols
+static std::vector<int> runSymbols(const uint8_t* packed, const EpdGlyph& glyph) {
+  std::vector<int> symbols;
+  const int pixels = glyph.width * glyph.height;
+  auto pixel = [packed](const int p) { return (packed[p / 4] >> ((3 - p % 4) * 2)) & 3; };
+  for (int p = 0; p < pixels;) {
+    int run = 1;
+    while (p + run < pixels && run < MAX_RUN && pixel(p + run) == pixel(p)) run++;
+    symbols.push_back(pixel(p) * MAX_RUN + run - 1);
+    p += run;
+  }
+  return symbols;
+}
+
+// fontconvert.py huffman_code_lengths: halve the counts until the longest code fits the decoder
+static std::vector<uint8_t> codeLengths(std::vector<long> counts) {
+  struct Node {
+    long count;
+    int order;
+    std::vector<int> symbols;
+    bool operator>(const Node& other) const {
+      return count != other.count ? count > other.count : order > other.order;
+    }
+  };
+  while (true) {
+    std::priority_queue<Node, std::vector<Node>, std::greater<Node>> nodes;
+    for (int s = 0; s < MAX_SYMBOLS; s++) {
+      if (counts[s] > 0) nodes.push({counts[s], s, {s}});
+    }
+    std::vector<uint8_t> lengths(MAX_SYMBOLS, 0);
+    if (nodes.size() == 1) {
+      lengths[nodes.top().symbols[0]] = 1;
+      return lengths;
+    }
+    for (int order = MAX_SYMBOLS; nodes.size() > 1; order++) {
+      Node a = nodes.top();
+      nodes.pop();
+      Node b = nodes.top();
+      nodes.pop();
+      a.symbols.insert(a.symbols.end(), b.symbols.begin(), b.symbols.end());
+      for (const int s : a.symbols) lengths[s]++;
+      nodes.push({a.count + b.count, order, a.symbols});
+    }
+    if (*std::max_element(lengths.begin(), lengths.end()) <= MAX_CODE_LENGTH) return lengths;
+    for (auto& c : counts) c = c > 0 ? (c + 1) / 2 : 0;
+  }
+}
+
+// fontconvert.py canonical_codes and encode_symbols
+static std::vector<uint8_t> encode(const std::vector<int>& symbols, const std::vector<uint8_t>& lengths) {
+  uint32_t codes[MAX_SYMBOLS] = {};
+  uint32_t code = 0;
+  int prevLength = 0;
+  for (int length = 1; length <= MAX_CODE_LENGTH; length++) {
+    for (int s = 0; s < MAX_SYMBOLS; s++) {
+      if (lengths[s] != length) continue;
+      code <<= length - prevLength;
+      prevLength = length;
+      codes[s] = code++;
+    }
+  }
+
+  std::vector<uint8_t> out;
+  uint64_t acc = 0;
+  int bits = 0;
+  for (const int s : symbols) {
+    acc = (acc << lengths[s]) | codes[s];
+    bits += lengths[s];
+    while (bits >= 8) {
+      bits -= 8;
+      out.push_back(static_cast<uint8_t>(acc >> bits));
+    }
+  }
+  if (bits > 0) out.push_back(static_cast<uint8_t>(acc << (8 - bits)));
+  return out;
+}
+
+// Every code point of the font, in order: far more bitmaps than the cache holds
+static std::string everyGlyph(const EpdFontData& font) {
+  std::string text;
+  for (uint32_t i = 0; i < font.intervalCount; i++) {
+    for (uint32_t cp = font.intervals[i].first; cp <= font.intervals[i].last; cp++) {
+      if (cp < 0x21 || (cp >= 0x7F && cp < 0xA1) || (cp >= 0x300 && cp < 0x370) || (cp >= 0x2000 && cp < 0x2010) ||
+          (cp >= 0x2028 && cp < 0x2030) || (cp >= 0x205F && cp < 0x2070)) {
+        continue;  // Controls, spaces and combining marks
+      }
+      if (cp < 0x80) {
+        text += static_cast<char>(cp);
+      } else if (cp < 0x800) {
+        text += static_cast<char>(0xC0 | cp >> 6);
+        text += static_cast<char>(0x80 | (cp & 0x3F));
+      } else {
+        text += static_cast<char>(0xE0 | cp >> 12);
+        text += static_cast<char>(0x80 | (cp >> 6 & 0x3F));
+        text += static_cast<char>(0x80 | (cp & 0x3F));
+      }
+      if (text.size() % 24 < 3) text += ' ';  // Word breaks for the line wrapping
+    }
+  }
+  return text;
+}
+
+struct CompressedFont {
+  std::vector<EpdGlyph> glyphs;
+  std::vector<uint8_t> bitmap;
+  std::vector<uint8_t> lengths;
+  EpdFontData data;
+};
+
+static void compress(const EpdFontData& raw, CompressedFont& out) {
+  const EpdUnicodeInterval& last = raw.intervals[raw.intervalCount - 1];
+  out.glyphs.assign(raw.glyph, raw.glyph + last.offset + (last.last - last.first) + 1);
+
+  std::vector<std::vector<int>> symbols;
+  std::vector<long> counts(MAX_SYMBOLS, 0);
+  for (const auto& glyph : out.glyphs) {
+    symbols.push_back(runSymbols(raw.bitmap + glyph.dataOffset, glyph));
+    for (const int s : symbols.back()) counts[s]++;
+  }
+  out.lengths = codeLengths(counts);
+
+  for (size_t i = 0; i < out.glyphs.size(); i++) {
+    const std::vector<uint8_t> coded = encode(symbols[i], out.lengths);
+    out.glyphs[i].dataOffset = out.bitmap.size();
+    out.glyphs[i].dataLength = coded.size();
+    out.bitmap.insert(out.bitmap.end(), coded.begin(), coded.end());
+  }
+
+  out.data = raw;
+  out.data.bitmap = out.bitmap.data();
+  out.data.glyph = out.glyphs.data();
+  out.data.runCodeLengths = out.lengths.data();
+}
+
+int main() {
+  Serial.muted = true;
+  static HalDisplay display;
+  GfxRenderer renderer(display);
+
+  CompressedFont compressed;
+  compress(notosans_14_regular, compressed);
+  const EpdFont rawFont(&notosans_14_regular);
+  const EpdFont compressedFont(&compressed.data);
+  renderer.insertFont(RAW, EpdFontFamily(&rawFont));
+  renderer.insertFont(COMPRESSED, EpdFontFamily(&compressedFont));
+
+  int failures = 0;
+  size_t rawBytes = 0;
+  for (size_t i = 0; i < compressed.glyphs.size(); i++) {
+    const EpdGlyph& glyph = notosans_14_regular.glyph[i];
+    const size_t size = unpackedSize(glyph, true);
+    rawBytes += size;
+    const uint8_t* decoded = compressedFont.getGlyphBitmap(&compressed.glyphs[i]);
+    if (size > 0 && (!decoded || memcmp(decoded, notosans_14_regular.bitmap + glyph.dataOffset, size) != 0)) {
+      printf("FAIL glyph %zu does not decode to its raw bitmap\n", i);
+      failures++;
+    }
+  }
+  printf("glyph_cache_bench: notosans_14_regular, bitmaps %zu -> %zu bytes (%.0f%%), %d pages per text\n", rawBytes,
+         compressed.bitmap.size(), 100.0 * compressed.bitmap.size() / rawBytes, PAGES);
+  printf("%-16s %10s %12s %10s\n", "text", "raw", "compressed", "hit rate");
+
+  const std::string allGlyphs = everyGlyph(notosans_14_regular);
+  const struct {
+    const char* name;
+    const char* text;
+  } samples[] = {
+      {"English", "It was the best of times, it was the worst of times, it was the age of wisdom, it was the age "
+                  "of foolishness, it was the epoch of belief, it was the epoch of incredulity (1859)."},
+      {"accented Latin", "Der Bäcker würzt süße Brötchen; l'été dernier, à Noël, où était la forêt ? "
+                         "«Ça déçoit», dit Zoë — naïve, même après ces années-là."},
+      {"Cyrillic", "Все счастливые семьи похожи друг на друга, каждая несчастливая семья несчастлива "
+                   "по-своему. Всё смешалось в доме Облонских."},
+      {"every glyph", allGlyphs.c_str()},
+  };
+  renderer.setOrientation(GfxRenderer::LandscapeCounterClockwise);
+  const int lineHeight = renderer.getLineHeight(RAW);
+  for (const auto& sample : samples) {
+    std::vector<std::string> lines;  // The sample wrapped to the screen width, repeated to fill a page
+    std::string line;
+    long glyphsPerPage = 0;
+    for (const char* p = sample.text; lines.size() * lineHeight < static_cast<size_t>(renderer.getScreenHeight());) {
+      const char* word = p;
+      while (*p && *p != ' ') p++;
+      const std::string next = line + (line.empty() ? "" : " ") + std::string(word, p);
+      if (renderer.getTextWidth(RAW, next.c_str()) > renderer.getScreenWidth() && !line.empty()) {
+        lines.push_back(line);
+        line = std::string(word, p);
+      } else {
+        line = next;
+      }
+      if (*p) p++;
+      if (!*p) p = sample.text;
+    }
+    for (const auto& l : lines) {
+      const uint8_t* p = reinterpret_cast<const uint8_t*>(l.c_str());
+      while (utf8NextCodepoint(&p)) glyphsPerPage++;
+    }
+
+    double glyphsPerSec[2];
+    uint32_t hits = 0, misses = 0;
+    for (const int fontId : {RAW, COMPRESSED}) {
+      const uint32_t hitsBefore = compressedFont.getBitmapCache().getHits();
+      const uint32_t missesBefore = compressedFont.getBitmapCache().getMisses();
+      const auto start = std::chrono::steady_clock::now();
+      for (int page = 0; page < PAGES; page++) {
+        renderer.clearScreen();
+        for (size_t i = 0; i < lines.size(); i++) renderer.drawText(fontId, 0, i * lineHeight, lines[i].c_str());
+      }
+      const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      glyphsPerSec[fontId] = glyphsPerPage * PAGES / elapsed.count();
+      hits = compressedFont.getBitmapCache().getHits() - hitsBefore;
+      misses = compressedFont.getBitmapCache().getMisses() - missesBefore;
+    }
+    printf("%-16s %10.2f %12.2f %9.1f%%\n", sample.name, glyphsPerSec[RAW] / 1e6, glyphsPerSec[COMPRESSED] / 1e6,
+           100.0 * hits / std::max<uint32_t>(hits + misses, 1));
+  }
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,82 @@
+// Code point lookups per second on notosans_14_regular: EpdFont::getGlyph (direct ASCII table and recent-glyph
+// cache) against the interval binary search every lookup went through before, for English, accented Latin and
+// Cyrillic text. Both must return the same glyph for every code point.
+#include <EpdFont.h>
+#include <Utf8.h>
+
+#include <builtinFonts/notosans_14_regular.h>
+#include <chrono>
+#include <vector>
+
+static constexpr int PASSES = 2000;
+static volatile uintptr_t sink;  // Keeps the lookups from being optimized away
+
+// EpdFont::getGlyph before the ASCII table and recent-glyph cache
+static const EpdGlyph* intervalSearch(const EpdFontData* data, const uint32_t cp) {
+  int left = 0;
+  int right = static_cast<int>(data->intervalCount) - 1;
+  while (left <= right) {
+    const int mid = left + (right - left) / 2;
+    const EpdUnicodeInterval* interval = &data->intervals[mid];
+    if (cp < interval->first) {
+      right = mid - 1;
+    } else if (cp > interval->last) {
+      left = mid + 1;
+    } else {
+      return &data->glyph[interval->offset + (cp - interval->first)];
+    }
+  }
+  return nullptr;
+}
+
+static std::vector<uint32_t> decode(const char* text) {
+  std::vector<uint32_t> cps;
+  uint32_t cp;
+  while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) cps.push_back(cp);
+  return cps;
+}
+
+template <class Lookup>
+static double lookupsPerSec(const std::vector<uint32_t>& cps, Lookup lookup) {
+  uintptr_t sum = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (int pass = 0; pass < PASSES; pass++) {
+    for (const uint32_t cp : cps) sum += reinterpret_cast<uintptr_t>(lookup(cp));
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  sink = sum;
+  return static_cast<double>(cps.size()) * PASSES / elapsed.count();
+}
+
+int main() {
+  const struct {
+    const char* name;
+    const char* text;
+  } samples[] = {
+      {"English", "It was the best of times, it was the worst of times, it was the age of wisdom, it was the age "
+                  "of foolishness, it was the epoch of belief, it was the epoch of incredulity (1859)."},
+      {"accented Latin", "Der Bäcker würzt süße Brötchen; l'été dernier, à Noël, où était la forêt ? "
+                         "«Ça déçoit», dit Zoë — naïve, même après ces années-là."},
+      {"Cyrillic", "Все счастливые семьи похожи друг на друга, каждая несчастливая семья несчастлива "
+                   "по-своему. Всё смешалось в доме Облонских."},
+  };
+
+  const EpdFont font(&notosans_14_regular);
+  printf("glyph_lookup_bench: notosans_14_regular, %d passes per text, M lookups/s\n", PASSES);
+  printf("%-16s %10s %10s\n", "text", "interval", "getGlyph");
+  int failures = 0;
+  for (const auto& sample : samples) {
+    const std::vector<uint32_t> cps = decode(sample.text);
+    for (const uint32_t cp : cps) {
+      if (font.getGlyph(cp) != intervalSearch(&notosans_14_regular, cp)) {
+        printf("FAIL %s: U+%04X resolves to a different glyph\n", sample.name, static_cast<unsigned>(cp));
+        failures++;
+      }
+    }
+
+    const double before = lookupsPerSec(cps, [](const uint32_t cp) { return intervalSearch(&notosans_14_regular, cp); });
+    const double after = lookupsPerSec(cps, [&font](const uint32_t cp) { return font.getGlyph(cp); });
+    printf("%-16s %10.1f %10.1f\n", sample.name, before / 1e6, after / 1e6);
+  }
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,118 @@
+// Saves of a 4 KB note with a few small random edits each: every listed version must rebuild to the content it
+// replaced, a version must cost about the size of its change, and restoring a version (then undoing it) must
+// round-trip through the note itself, including edits that are only in the note's journal.
+#include <SDCardManager.h>
+#include <map>
+#include <random>
+#include <string>
+
+#include "config.h"
+#include "edit_journal.h"
+#include "file_manager.h"
+#include "note_history.h"
+#include "note_index.h"
+#include "text_editor.h"
+
+static constexpr size_t MAX_AVERAGE_STORED = 50;  // Bytes per version, record header included
+
+static std::string note() { return fakeCard.text("/notes/h.txt"); }
+
+int main() {
+  std::mt19937 rng(7);
+  int failures = 0;
+  noteIndexSetup();
+  editorInit();
+
+  const char words[] = "lorem ipsum dolor sit amet ";
+  std::string text;
+  while (text.size() < 4096) text += words[rng() % (sizeof(words) - 1)];
+  char* buf = editorGetBuffer();
+  memcpy(buf, text.data(), text.size());
+  editorSetCurrentFile("h.txt");
+  editorLoadBuffer(text.size());
+  journalReset(buf, text.size());
+  editorSetUnsavedChanges(true);
+  saveCurrentFile();
+
+  std::map<uint32_t, std::string> expected;
+  HistoryVersion versions[HISTORY_MAX_VERSIONS];
+  size_t storedTotal = 0;
+  for (int save = 0; save < 120; save++) {
+    const std::string before = note();
+    for (int edits = 1 + rng() % 4; edits > 0; edits--) {
+      const int pos = rng() % (editorGetLength() + 1);
+      editorLoadBuffer(editorGetLength());  // cursor at the end
+      for (int k = editorGetLength() - pos; k > 0; k--) editorMoveCursorLeft();
+      if (rng() % 3) {
+        for (int k = rng() % 30; k >= 0; k--) editorInsertChar('a' + rng() % 26);
+      } else {
+        for (int k = rng() % 30; k >= 0; k--) editorDeleteChar();
+      }
+    }
+    saveCurrentFile();
+    if (historyList("h.txt", versions, HISTORY_MAX_VERSIONS) > 0 && !expected.count(versions[0].number)) {
+      expected[versions[0].number] = before;
+      storedTotal += versions[0].stored;
+    }
+  }
+
+  const size_t averageStored = expected.empty() ? 0 : storedTotal / expected.size();
+  printf("%zu versions recorded, %zu bytes each on average\n", expected.size(), averageStored);
+  if (expected.empty() || averageStored >= MAX_AVERAGE_STORED) {
+    printf("FAIL versions average %zu bytes, limit %zu\n", averageStored, MAX_AVERAGE_STORED);
+    failures++;
+  }
+
+  static char out[TEXT_BUFFER_SIZE];
+  const int count = historyList("h.txt", versions, HISTORY_MAX_VERSIONS);
+  for (int i = 0; i < count; i++) {
+    const int len = historyRestore("h.txt", versions[i].number, out, TEXT_BUFFER_SIZE);
+    if (len < 0 || std::string(out, len) != expected[versions[i].number]) {
+      printf("FAIL version %u does not rebuild (length %d)\n", versions[i].number, len);
+      failures++;
+    }
+  }
+
+  const std::string current = note();
+  const uint32_t oldest = versions[count - 1].number;
+  if (!restoreNoteVersion("h.txt", oldest) || note() != expected[oldest]) {
+    printf("FAIL restoring version %u\n", oldest);
+    failures++;
+  }
+  historyList("h.txt", versions, HISTORY_MAX_VERSIONS);
+  if (!restoreNoteVersion("h.txt", versions[0].number) || note() != current) {
+    printf("FAIL undoing the restore\n");
+    failures++;
+  }
+
+  // Restore while the latest edits are only journaled: they must become the newest version, not be lost
+  auto saveText = [](const char* content) {
+    char* b = editorGetBuffer();
+    strcpy(b, content);
+    editorSetCurrentFile("r.txt");
+    editorLoadBuffer(strlen(content));
+    journalReset(b, strlen(content));
+    editorSetUnsavedChanges(true);
+    saveCurrentFile();
+  };
+  saveText("version one");
+  saveText("version one two");
+  loadFile("r.txt");
+  editorMoveCursorEnd();
+  for (const char* c = " JOURNALED"; *c; c++) editorInsertChar(*c);
+  autosaveCurrentFile();
+  historyList("r.txt", versions, HISTORY_MAX_VERSIONS);
+  if (!restoreNoteVersion("r.txt", versions[0].number) || fakeCard.text("/notes/r.txt") != "version one") {
+    printf("FAIL restoring over a journal gave \"%s\"\n", fakeCard.text("/notes/r.txt").c_str());
+    failures++;
+  }
+  historyList("r.txt", versions, HISTORY_MAX_VERSIONS);
+  const int len = historyRestore("r.txt", versions[0].number, out, TEXT_BUFFER_SIZE);
+  if (len < 0 || std::string(out, len) != "version one two JOURNALED" || fakeCard.files.count("/notes/r.txt.jnl")) {
+    printf("FAIL journaled edits missing from the history after a restore\n");
+    failures++;
+  }
+
+  printf("history_delta_test: %d failures\n", failures);
+  return failures == 0 ? 0 : 1;
+}
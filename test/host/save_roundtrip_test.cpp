@@ -0,0 +1,59 @@
+// Full saves through saveCurrentFile: the note on the card must hold exactly the buffer, with no temporary file
+// left, for empty notes, exact multiples of the sector size and random lengths up to the buffer size. A full save
+// after an autosave must fold the journal into the note even though the content on the card did not change.
+#include <SDCardManager.h>
+#include <random>
+#include <string>
+
+#include "config.h"
+#include "edit_journal.h"
+#include "file_manager.h"
+#include "note_index.h"
+#include "text_editor.h"
+
+int main() {
+  std::mt19937 rng(3);
+  int failures = 0;
+  noteIndexSetup();
+
+  for (int save = 0; save < 300; save++) {
+    const size_t len = save < 5 ? save * 512 : rng() % (TEXT_BUFFER_SIZE - 1);
+    char* buf = editorGetBuffer();
+    for (size_t i = 0; i < len; i++) buf[i] = 'a' + rng() % 26;
+    buf[len] = '\0';
+    editorSetCurrentFile("x.txt");
+    editorLoadBuffer(len);
+    journalReset(buf, len);
+    editorSetUnsavedChanges(true);
+    saveCurrentFile();
+
+    if (fakeCard.text("/notes/x.txt") != std::string(buf, len)) {
+      printf("FAIL save %d: %zu bytes did not round-trip\n", save, len);
+      failures++;
+    }
+    if (fakeCard.files.count("/notes/x.txt.tmp")) {
+      printf("FAIL save %d: temporary file left behind\n", save);
+      failures++;
+    }
+  }
+
+  // Autosave journals the edit, then the explicit save (Ctrl+S, exit, sleep) compacts
+  fakeCard.put("/notes/j.txt", "hello");
+  loadFile("j.txt");
+  editorMoveCursorEnd();
+  editorInsertChar('!');
+  autosaveCurrentFile();
+  if (!fakeCard.files.count("/notes/j.txt.jnl")) {
+    printf("FAIL autosave did not journal the edit\n");
+    failures++;
+  }
+  saveCurrentFile();
+  if (fakeCard.text("/notes/j.txt") != "hello!" || fakeCard.files.count("/notes/j.txt.jnl")) {
+    printf("FAIL explicit save after autosave left \"%s\" and %s journal\n", fakeCard.text("/notes/j.txt").c_str(),
+           fakeCard.files.count("/notes/j.txt.jnl") ? "a" : "no");
+    failures++;
+  }
+
+  printf("save_roundtrip_test: %d failures\n", failures);
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,121 @@
+// Timing of the note write step of a save: the loop before the sector-staged writes (one file.write per 512-byte
+// snapshot page, no preallocation) against the current one in runSave (preallocate, 4 KB staged whole-sector
+// writes, truncate). Both read the same snapshot and write the .tmp file; the rotation steps are not timed.
+//
+//   save_write_bench [host-dir]
+//
+// Without an argument the card is in memory and only the call counts mean anything. With a directory the fake
+// writes through to it with every write committed before it returns, which charges each write call a fixed
+// cost as the SPI card does; the times are still a host disk's, not a card's. Card numbers come from the
+// "saveCurrentFile: N bytes written in M ms" line a debug build prints for every save.
+#include <SDCardManager.h>
+
+#include <chrono>
+#include <random>
+#include <string>
+
+#include "buffer_snapshot.h"
+#include "config.h"
+#include "esp_rom_crc.h"
+
+static constexpr const char* TMP_PATH = "/notes/bench.txt.tmp";
+static constexpr int SAVES = 50;
+
+// Step 1 of runSave before the staging buffer
+static bool writePages() {
+  static char chunk[SNAPSHOT_PAGE_SIZE];
+  auto file = SdMan.open(TMP_PATH, O_WRONLY | O_CREAT | O_TRUNC);
+  if (!file) return false;
+  size_t written = 0;
+  uint32_t crc = 0;
+  int n;
+  for (size_t page = 0; (n = snapshotReadPage(page, chunk)) > 0; page++) {
+    crc = esp_rom_crc32_le(crc, (const uint8_t*)chunk, n);
+    if (file.write((const uint8_t*)chunk, n) != (size_t)n) break;
+    written += n;
+  }
+  file.sync();
+  file.close();
+  return n == 0 && written == snapshotLength();
+}
+
+// Step 1 of runSave as it is now
+static bool writeSectors() {
+  alignas(4) static char staging[SAVE_STAGING_SIZE];
+  auto file = SdMan.open(TMP_PATH, O_WRONLY | O_CREAT | O_TRUNC);
+  if (!file) return false;
+  const size_t toWrite = snapshotLength();
+  const size_t sectorBytes = (toWrite + SNAPSHOT_PAGE_SIZE - 1) / SNAPSHOT_PAGE_SIZE * SNAPSHOT_PAGE_SIZE;
+  if (sectorBytes > 0) file.preAllocate(sectorBytes);
+
+  size_t written = 0;
+  uint32_t crc = 0;
+  int n = 0;
+  bool writeOk = true;
+  for (size_t page = 0; writeOk;) {
+    size_t staged = 0;
+    while (staged < SAVE_STAGING_SIZE && (n = snapshotReadPage(page, staging + staged)) > 0) {
+      crc = esp_rom_crc32_le(crc, (const uint8_t*)staging + staged, n);
+      staged += n;
+      page++;
+      if ((size_t)n < SNAPSHOT_PAGE_SIZE) break;
+    }
+    if (staged == 0) break;
+    const size_t padded = (staged + SNAPSHOT_PAGE_SIZE - 1) / SNAPSHOT_PAGE_SIZE * SNAPSHOT_PAGE_SIZE;
+    memset(staging + staged, 0, padded - staged);
+    writeOk = file.write((const uint8_t*)staging, padded) == padded;
+    if (writeOk) written += staged;
+    if (n <= 0 || (size_t)n < SNAPSHOT_PAGE_SIZE) break;
+  }
+  writeOk = writeOk && file.truncate(toWrite);
+  file.sync();
+  file.close();
+  return n >= 0 && writeOk && written == toWrite;
+}
+
+struct Result {
+  double msPerSave;
+  double callsPerSave;
+  double partialPerSave;
+  bool ok;
+};
+
+static Result run(bool (*write)(), const std::string& note) {
+  fakeCard.writeCalls = 0;
+  fakeCard.partialSectorWrites = 0;
+  bool ok = true;
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < SAVES; i++) {
+    snapshotBegin(note.data(), note.size());
+    ok = write() && ok;
+    snapshotEnd();
+  }
+  const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+  ok = ok && fakeCard.text(TMP_PATH) == note;
+  return {elapsed.count() / SAVES, (double)fakeCard.writeCalls / SAVES, (double)fakeCard.partialSectorWrites / SAVES,
+          ok};
+}
+
+int main(int argc, char** argv) {
+  if (argc > 1) fakeCard.mirrorDir = argv[1];
+  printf("save_write_bench: %d saves per size, %s\n", SAVES,
+         fakeCard.mirrorDir.empty() ? "in memory" : ("written through to " + fakeCard.mirrorDir).c_str());
+  printf("%8s  %26s  %26s\n", "bytes", "per page: ms calls partial", "sectors: ms calls partial");
+
+  std::mt19937 rng(46);
+  int failures = 0;
+  for (const size_t len : {(size_t)700, (size_t)4096, (size_t)9000, TEXT_BUFFER_SIZE - 1}) {
+    std::string note(len, ' ');
+    for (auto& c : note) c = 'a' + rng() % 26;
+    const Result pages = run(writePages, note);
+    const Result sectors = run(writeSectors, note);
+    printf("%8zu  %10.3f %7.1f %7.1f  %10.3f %7.1f %7.1f\n", len, pages.msPerSave, pages.callsPerSave,
+           pages.partialPerSave, sectors.msPerSave, sectors.callsPerSave, sectors.partialPerSave);
+    if (!pages.ok || !sectors.ok) {
+      printf("FAIL %zu bytes did not round-trip\n", len);
+      failures++;
+    }
+  }
+  SdMan.remove(TMP_PATH);
+  return failures == 0 ? 0 : 1;
+}
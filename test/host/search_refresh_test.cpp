@@ -0,0 +1,39 @@
+// Refreshing the search index after notes were copied onto the card: two filenames with the same hash must each
+// keep their own entry, so a second refresh finds both current and every word still leads to its own note.
+#include <SDCardManager.h>
+#include <string>
+
+#include "config.h"
+#include "note_index.h"
+#include "search_index.h"
+
+// Same FNV-1a hash (low bit set) as search_index.cpp uses for the note table
+static constexpr const char* FIRST = "n12289.txt";
+static constexpr const char* SECOND = "n251290.txt";
+
+static std::string find(const char* query) {
+  SearchHit hits[4];
+  const int n = searchQuery(query, hits, 4);
+  return n == 1 ? hits[0].filename : std::to_string(n) + " hits";
+}
+
+int main() {
+  int failures = 0;
+  fakeCard.put(std::string("/notes/") + FIRST, "apples and apricots");
+  fakeCard.put(std::string("/notes/") + SECOND, "bananas and blueberries");
+  noteIndexSetup();
+
+  const int first = searchIndexRefresh();
+  const int second = searchIndexRefresh();
+  if (first != 2 || second != 0) {
+    printf("FAIL refreshes indexed %d then %d notes, expected 2 then 0\n", first, second);
+    failures++;
+  }
+  if (find("apricots") != FIRST || find("blueberries") != SECOND) {
+    printf("FAIL \"apricots\" -> %s, \"blueberries\" -> %s\n", find("apricots").c_str(), find("blueberries").c_str());
+    failures++;
+  }
+
+  printf("search_refresh_test: %d failures\n", failures);
+  return failures == 0 ? 0 : 1;
+}